@@ -25,6 +25,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "mmu.h"
 
 struct {
   struct spinlock lock;
@@ -33,8 +34,13 @@ struct {
   // Linked list of all buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
+
+  // Private buffer for bwritethrough().
+  struct buf through;
 } bcache;
 
+static uchar bdata[NBUF+1][BSIZE];  // for buf[] and through
+
 void
 binit(void)
 {
@@ -47,12 +53,58 @@ binit(void)
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
   for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+    b->data = bdata[b - bcache.buf];
     b->next = bcache.head.next;
     b->prev = &bcache.head;
     initsleeplock(&b->lock, "buffer");
     bcache.head.next->prev = b;
     bcache.head.next = b;
   }
+  bcache.through.data = bdata[NBUF];
+  initsleeplock(&bcache.through.lock, "through");
+}
+
+// Add n buffers to the cache, for log.c, which must be able to
+// pin more than NBUF allows when the log is larger than
+// LOGSIZE.  Returns -1 if memory runs out.
+int
+bgrow(int n)
+{
+  struct buf *b;
+  char *hdr, *mem;
+  int nhdr, nmem;
+
+  if(BSIZE > PGSIZE)
+    panic("bgrow: BSIZE");
+  hdr = mem = 0;
+  nhdr = nmem = 0;
+  for(; n > 0; n--){
+    if(nhdr == 0){
+      if((hdr = kalloc()) == 0)
+        return -1;
+      nhdr = PGSIZE / sizeof(struct buf);
+    }
+    if(nmem == 0){
+      if((mem = kalloc()) == 0)
+        return -1;
+      nmem = PGSIZE / BSIZE;
+    }
+    b = (struct buf*)hdr;
+    hdr += sizeof(*b);
+    nhdr--;
+    memset(b, 0, sizeof(*b));
+    b->data = (uchar*)mem;
+    mem += BSIZE;
+    nmem--;
+    initsleeplock(&b->lock, "buffer");
+    acquire(&bcache.lock);
+    b->prev = bcache.head.prev;
+    b->next = &bcache.head;
+    bcache.head.prev->next = b;
+    bcache.head.prev = b;
+    release(&bcache.lock);
+  }
+  return 0;
 }
 
 // Look through buffer cache for block on device dev.
@@ -105,6 +157,18 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Return a locked buf for a block that the caller is about to
+// overwrite entirely, without reading its old contents from disk.
+struct buf*
+bnew(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  b->flags |= B_VALID;
+  return b;
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,6 +179,25 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write data to b's block on disk, leaving b itself, which
+// must be locked, unchanged.  For log.c, to install an older
+// version of a block than the one cached.
+void
+bwritethrough(struct buf *b, uchar *data)
+{
+  struct buf *tb = &bcache.through;
+
+  if(!holdingsleep(&b->lock))
+    panic("bwritethrough");
+  acquiresleep(&tb->lock);
+  tb->dev = b->dev;
+  tb->blockno = b->blockno;
+  memmove(tb->data, data, BSIZE);
+  tb->flags = B_VALID | B_DIRTY;
+  iderw(tb);
+  releasesleep(&tb->lock);
+}
+
 // Release a locked buffer.
 // Move to the head of the MRU list.
 void
@@ -7,7 +7,9 @@ struct buf {
   struct buf *prev; // LRU cache list
   struct buf *next;
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uint deadline;     // ticks by which the disk should start this request
+  uint64 qtime;      // rdtsc() when queued, for latency statistics
+  uchar *data;       // BSIZE bytes
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
@@ -0,0 +1,2771 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	be 01 00 00 00       	mov    $0x1,%esi
+    1014:	53                   	push   %ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 18             	sub    $0x18,%esp
+    1019:	8b 01                	mov    (%ecx),%eax
+    101b:	8b 59 04             	mov    0x4(%ecx),%ebx
+    101e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1021:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+    1024:	83 f8 01             	cmp    $0x1,%eax
+    1027:	7f 26                	jg     104f <main+0x4f>
+    1029:	eb 52                	jmp    107d <main+0x7d>
+    102b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+    1030:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+    1033:	83 c6 01             	add    $0x1,%esi
+    1036:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+    1039:	50                   	push   %eax
+    103a:	e8 51 00 00 00       	call   1090 <cat>
+    close(fd);
+    103f:	89 3c 24             	mov    %edi,(%esp)
+    1042:	e8 47 04 00 00       	call   148e <close>
+  for(i = 1; i < argc; i++){
+    1047:	83 c4 10             	add    $0x10,%esp
+    104a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+    104d:	74 29                	je     1078 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+    104f:	83 ec 08             	sub    $0x8,%esp
+    1052:	6a 00                	push   $0x0
+    1054:	ff 33                	push   (%ebx)
+    1056:	e8 60 04 00 00       	call   14bb <open>
+    105b:	83 c4 10             	add    $0x10,%esp
+    105e:	89 c7                	mov    %eax,%edi
+    1060:	85 c0                	test   %eax,%eax
+    1062:	79 cc                	jns    1030 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+    1064:	50                   	push   %eax
+    1065:	ff 33                	push   (%ebx)
+    1067:	68 3b 23 00 00       	push   $0x233b
+    106c:	6a 01                	push   $0x1
+    106e:	e8 ed 08 00 00       	call   1960 <printf>
+      exit();
+    1073:	e8 78 03 00 00       	call   13f0 <exit>
+  }
+  exit();
+    1078:	e8 73 03 00 00       	call   13f0 <exit>
+    cat(0);
+    107d:	83 ec 0c             	sub    $0xc,%esp
+    1080:	6a 00                	push   $0x0
+    1082:	e8 09 00 00 00       	call   1090 <cat>
+    exit();
+    1087:	e8 64 03 00 00       	call   13f0 <exit>
+    108c:	66 90                	xchg   %ax,%ax
+    108e:	66 90                	xchg   %ax,%ax
+
+00001090 <cat>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	56                   	push   %esi
+    1094:	53                   	push   %ebx
+    1095:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+    1098:	eb 20                	jmp    10ba <cat+0x2a>
+    109a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (fwrite(buf, 1, n, stdout) != n) {
+    10a0:	ff 35 84 2a 00 00    	push   0x2a84
+    10a6:	53                   	push   %ebx
+    10a7:	6a 01                	push   $0x1
+    10a9:	68 e0 2c 00 00       	push   $0x2ce0
+    10ae:	e8 dd 0a 00 00       	call   1b90 <fwrite>
+    10b3:	83 c4 10             	add    $0x10,%esp
+    10b6:	39 d8                	cmp    %ebx,%eax
+    10b8:	75 25                	jne    10df <cat+0x4f>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+    10ba:	83 ec 04             	sub    $0x4,%esp
+    10bd:	68 00 02 00 00       	push   $0x200
+    10c2:	68 e0 2c 00 00       	push   $0x2ce0
+    10c7:	56                   	push   %esi
+    10c8:	e8 a3 03 00 00       	call   1470 <read>
+    10cd:	83 c4 10             	add    $0x10,%esp
+    10d0:	89 c3                	mov    %eax,%ebx
+    10d2:	85 c0                	test   %eax,%eax
+    10d4:	7f ca                	jg     10a0 <cat+0x10>
+  if(n < 0){
+    10d6:	75 1b                	jne    10f3 <cat+0x63>
+}
+    10d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10db:	5b                   	pop    %ebx
+    10dc:	5e                   	pop    %esi
+    10dd:	5d                   	pop    %ebp
+    10de:	c3                   	ret
+      printf(1, "cat: write error\n");
+    10df:	83 ec 08             	sub    $0x8,%esp
+    10e2:	68 18 23 00 00       	push   $0x2318
+    10e7:	6a 01                	push   $0x1
+    10e9:	e8 72 08 00 00       	call   1960 <printf>
+      exit();
+    10ee:	e8 fd 02 00 00       	call   13f0 <exit>
+    printf(1, "cat: read error\n");
+    10f3:	50                   	push   %eax
+    10f4:	50                   	push   %eax
+    10f5:	68 2a 23 00 00       	push   $0x232a
+    10fa:	6a 01                	push   $0x1
+    10fc:	e8 5f 08 00 00       	call   1960 <printf>
+    exit();
+    1101:	e8 ea 02 00 00       	call   13f0 <exit>
+    1106:	66 90                	xchg   %ax,%ax
+    1108:	66 90                	xchg   %ax,%ax
+    110a:	66 90                	xchg   %ax,%ax
+    110c:	66 90                	xchg   %ax,%ax
+    110e:	66 90                	xchg   %ax,%ax
+
+00001110 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1111:	31 c0                	xor    %eax,%eax
+{
+    1113:	89 e5                	mov    %esp,%ebp
+    1115:	53                   	push   %ebx
+    1116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1127:	83 c0 01             	add    $0x1,%eax
+    112a:	84 d2                	test   %dl,%dl
+    112c:	75 f2                	jne    1120 <strcpy+0x10>
+    ;
+  return os;
+}
+    112e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1131:	89 c8                	mov    %ecx,%eax
+    1133:	c9                   	leave
+    1134:	c3                   	ret
+    1135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	53                   	push   %ebx
+    1144:	8b 55 08             	mov    0x8(%ebp),%edx
+    1147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    114a:	0f b6 02             	movzbl (%edx),%eax
+    114d:	84 c0                	test   %al,%al
+    114f:	75 17                	jne    1168 <strcmp+0x28>
+    1151:	eb 3a                	jmp    118d <strcmp+0x4d>
+    1153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1157:	90                   	nop
+    1158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    115c:	83 c2 01             	add    $0x1,%edx
+    115f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1162:	84 c0                	test   %al,%al
+    1164:	74 1a                	je     1180 <strcmp+0x40>
+    p++, q++;
+    1166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1168:	0f b6 19             	movzbl (%ecx),%ebx
+    116b:	38 c3                	cmp    %al,%bl
+    116d:	74 e9                	je     1158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    116f:	29 d8                	sub    %ebx,%eax
+}
+    1171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1174:	c9                   	leave
+    1175:	c3                   	ret
+    1176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1184:	31 c0                	xor    %eax,%eax
+    1186:	29 d8                	sub    %ebx,%eax
+}
+    1188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    118b:	c9                   	leave
+    118c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    118d:	0f b6 19             	movzbl (%ecx),%ebx
+    1190:	31 c0                	xor    %eax,%eax
+    1192:	eb db                	jmp    116f <strcmp+0x2f>
+    1194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+
+000011a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    11a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    11a9:	74 15                	je     11c0 <strlen+0x20>
+    11ab:	31 c0                	xor    %eax,%eax
+    11ad:	8d 76 00             	lea    0x0(%esi),%esi
+    11b0:	83 c0 01             	add    $0x1,%eax
+    11b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    11b7:	89 c1                	mov    %eax,%ecx
+    11b9:	75 f5                	jne    11b0 <strlen+0x10>
+    ;
+  return n;
+}
+    11bb:	89 c8                	mov    %ecx,%eax
+    11bd:	5d                   	pop    %ebp
+    11be:	c3                   	ret
+    11bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    11c0:	31 c9                	xor    %ecx,%ecx
+}
+    11c2:	5d                   	pop    %ebp
+    11c3:	89 c8                	mov    %ecx,%eax
+    11c5:	c3                   	ret
+    11c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	57                   	push   %edi
+    11d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    11d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11dd:	89 d7                	mov    %edx,%edi
+    11df:	fc                   	cld
+    11e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11e5:	89 d0                	mov    %edx,%eax
+    11e7:	c9                   	leave
+    11e8:	c3                   	ret
+    11e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    11fa:	0f b6 10             	movzbl (%eax),%edx
+    11fd:	84 d2                	test   %dl,%dl
+    11ff:	75 12                	jne    1213 <strchr+0x23>
+    1201:	eb 1d                	jmp    1220 <strchr+0x30>
+    1203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1207:	90                   	nop
+    1208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    120c:	83 c0 01             	add    $0x1,%eax
+    120f:	84 d2                	test   %dl,%dl
+    1211:	74 0d                	je     1220 <strchr+0x30>
+    if(*s == c)
+    1213:	38 d1                	cmp    %dl,%cl
+    1215:	75 f1                	jne    1208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1217:	5d                   	pop    %ebp
+    1218:	c3                   	ret
+    1219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1220:	31 c0                	xor    %eax,%eax
+}
+    1222:	5d                   	pop    %ebp
+    1223:	c3                   	ret
+    1224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    122f:	90                   	nop
+
+00001230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	57                   	push   %edi
+    1234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1239:	31 db                	xor    %ebx,%ebx
+{
+    123b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    123e:	eb 27                	jmp    1267 <gets+0x37>
+    cc = read(0, &c, 1);
+    1240:	83 ec 04             	sub    $0x4,%esp
+    1243:	6a 01                	push   $0x1
+    1245:	56                   	push   %esi
+    1246:	6a 00                	push   $0x0
+    1248:	e8 23 02 00 00       	call   1470 <read>
+    if(cc < 1)
+    124d:	83 c4 10             	add    $0x10,%esp
+    1250:	85 c0                	test   %eax,%eax
+    1252:	7e 1d                	jle    1271 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1258:	8b 55 08             	mov    0x8(%ebp),%edx
+    125b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    125f:	3c 0a                	cmp    $0xa,%al
+    1261:	74 10                	je     1273 <gets+0x43>
+    1263:	3c 0d                	cmp    $0xd,%al
+    1265:	74 0c                	je     1273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1267:	89 df                	mov    %ebx,%edi
+    1269:	83 c3 01             	add    $0x1,%ebx
+    126c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    126f:	7c cf                	jl     1240 <gets+0x10>
+    1271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1273:	8b 45 08             	mov    0x8(%ebp),%eax
+    1276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    127a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    127d:	5b                   	pop    %ebx
+    127e:	5e                   	pop    %esi
+    127f:	5f                   	pop    %edi
+    1280:	5d                   	pop    %ebp
+    1281:	c3                   	ret
+    1282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	56                   	push   %esi
+    1294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1295:	83 ec 08             	sub    $0x8,%esp
+    1298:	6a 00                	push   $0x0
+    129a:	ff 75 08             	push   0x8(%ebp)
+    129d:	e8 19 02 00 00       	call   14bb <open>
+  if(fd < 0)
+    12a2:	83 c4 10             	add    $0x10,%esp
+    12a5:	85 c0                	test   %eax,%eax
+    12a7:	78 27                	js     12d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    12a9:	83 ec 08             	sub    $0x8,%esp
+    12ac:	ff 75 0c             	push   0xc(%ebp)
+    12af:	89 c3                	mov    %eax,%ebx
+    12b1:	50                   	push   %eax
+    12b2:	e8 31 02 00 00       	call   14e8 <fstat>
+  close(fd);
+    12b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    12ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    12bc:	e8 cd 01 00 00       	call   148e <close>
+  return r;
+    12c1:	83 c4 10             	add    $0x10,%esp
+}
+    12c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12c7:	89 f0                	mov    %esi,%eax
+    12c9:	5b                   	pop    %ebx
+    12ca:	5e                   	pop    %esi
+    12cb:	5d                   	pop    %ebp
+    12cc:	c3                   	ret
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    12d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12d5:	eb ed                	jmp    12c4 <stat+0x34>
+    12d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12de:	66 90                	xchg   %ax,%ax
+
+000012e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	53                   	push   %ebx
+    12e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12e7:	0f be 02             	movsbl (%edx),%eax
+    12ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    12f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    12f5:	77 1e                	ja     1315 <atoi+0x35>
+    12f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1300:	83 c2 01             	add    $0x1,%edx
+    1303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    130a:	0f be 02             	movsbl (%edx),%eax
+    130d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1310:	80 fb 09             	cmp    $0x9,%bl
+    1313:	76 eb                	jbe    1300 <atoi+0x20>
+  return n;
+}
+    1315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1318:	89 c8                	mov    %ecx,%eax
+    131a:	c9                   	leave
+    131b:	c3                   	ret
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+    1325:	8b 45 10             	mov    0x10(%ebp),%eax
+    1328:	8b 55 08             	mov    0x8(%ebp),%edx
+    132b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    132e:	85 c0                	test   %eax,%eax
+    1330:	7e 13                	jle    1345 <memmove+0x25>
+    1332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1334:	89 d7                	mov    %edx,%edi
+    1336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1341:	39 f8                	cmp    %edi,%eax
+    1343:	75 fb                	jne    1340 <memmove+0x20>
+  return vdst;
+}
+    1345:	5e                   	pop    %esi
+    1346:	89 d0                	mov    %edx,%eax
+    1348:	5f                   	pop    %edi
+    1349:	5d                   	pop    %ebp
+    134a:	c3                   	ret
+    134b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    134f:	90                   	nop
+
+00001350 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	56                   	push   %esi
+    1354:	53                   	push   %ebx
+    1355:	8b 75 10             	mov    0x10(%ebp),%esi
+    1358:	8b 55 08             	mov    0x8(%ebp),%edx
+    135b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    135e:	85 f6                	test   %esi,%esi
+    1360:	74 2e                	je     1390 <memcmp+0x40>
+    1362:	01 c6                	add    %eax,%esi
+    1364:	eb 14                	jmp    137a <memcmp+0x2a>
+    1366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1370:	83 c0 01             	add    $0x1,%eax
+    1373:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1376:	39 f0                	cmp    %esi,%eax
+    1378:	74 16                	je     1390 <memcmp+0x40>
+    if(*s1 != *s2)
+    137a:	0f b6 0a             	movzbl (%edx),%ecx
+    137d:	0f b6 18             	movzbl (%eax),%ebx
+    1380:	38 d9                	cmp    %bl,%cl
+    1382:	74 ec                	je     1370 <memcmp+0x20>
+      return *s1 - *s2;
+    1384:	0f b6 c1             	movzbl %cl,%eax
+    1387:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1389:	5b                   	pop    %ebx
+    138a:	5e                   	pop    %esi
+    138b:	5d                   	pop    %ebp
+    138c:	c3                   	ret
+    138d:	8d 76 00             	lea    0x0(%esi),%esi
+    1390:	5b                   	pop    %ebx
+  return 0;
+    1391:	31 c0                	xor    %eax,%eax
+}
+    1393:	5e                   	pop    %esi
+    1394:	5d                   	pop    %ebp
+    1395:	c3                   	ret
+    1396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    139d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013a0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    13a0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    13a5:	c3                   	ret
+    13a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013b0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    13b0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    13b5:	c3                   	ret
+    13b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013c0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    13c0:	a1 e0 2e 00 00       	mov    0x2ee0,%eax
+    13c5:	85 c0                	test   %eax,%eax
+    13c7:	74 17                	je     13e0 <fork+0x20>
+{
+    13c9:	55                   	push   %ebp
+    13ca:	89 e5                	mov    %esp,%ebp
+    13cc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    13cf:	ff d0                	call   *%eax
+  return _fork();
+}
+    13d1:	c9                   	leave
+  return _fork();
+    13d2:	e9 5d 00 00 00       	jmp    1434 <_fork>
+    13d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13de:	66 90                	xchg   %ax,%ax
+    13e0:	e9 4f 00 00 00       	jmp    1434 <_fork>
+    13e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013f0 <exit>:
+
+int
+exit(void)
+{
+    13f0:	55                   	push   %ebp
+    13f1:	89 e5                	mov    %esp,%ebp
+    13f3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    13f6:	a1 e0 2e 00 00       	mov    0x2ee0,%eax
+    13fb:	85 c0                	test   %eax,%eax
+    13fd:	74 02                	je     1401 <exit+0x11>
+    flushhook();
+    13ff:	ff d0                	call   *%eax
+  _exit();
+    1401:	e8 3d 00 00 00       	call   1443 <_exit>
+    1406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001410 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1410:	55                   	push   %ebp
+  if(flushhook)
+    1411:	a1 e0 2e 00 00       	mov    0x2ee0,%eax
+{
+    1416:	89 e5                	mov    %esp,%ebp
+    1418:	56                   	push   %esi
+    1419:	53                   	push   %ebx
+    141a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    141d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1420:	85 c0                	test   %eax,%eax
+    1422:	74 02                	je     1426 <exec+0x16>
+    flushhook();
+    1424:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1426:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1429:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    142c:	5b                   	pop    %ebx
+    142d:	5e                   	pop    %esi
+    142e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    142f:	e9 78 00 00 00       	jmp    14ac <_exec>
+
+00001434 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1434:	b8 01 00 00 00       	mov    $0x1,%eax
+    1439:	89 e1                	mov    %esp,%ecx
+    143b:	ba 42 14 00 00       	mov    $0x1442,%edx
+    1440:	0f 34                	sysenter
+    1442:	c3                   	ret
+
+00001443 <_exit>:
+RAWSYSCALL(exit)
+    1443:	b8 02 00 00 00       	mov    $0x2,%eax
+    1448:	89 e1                	mov    %esp,%ecx
+    144a:	ba 51 14 00 00       	mov    $0x1451,%edx
+    144f:	0f 34                	sysenter
+    1451:	c3                   	ret
+
+00001452 <wait>:
+SYSCALL(wait)
+    1452:	b8 03 00 00 00       	mov    $0x3,%eax
+    1457:	89 e1                	mov    %esp,%ecx
+    1459:	ba 60 14 00 00       	mov    $0x1460,%edx
+    145e:	0f 34                	sysenter
+    1460:	c3                   	ret
+
+00001461 <pipe>:
+SYSCALL(pipe)
+    1461:	b8 04 00 00 00       	mov    $0x4,%eax
+    1466:	89 e1                	mov    %esp,%ecx
+    1468:	ba 6f 14 00 00       	mov    $0x146f,%edx
+    146d:	0f 34                	sysenter
+    146f:	c3                   	ret
+
+00001470 <read>:
+SYSCALL(read)
+    1470:	b8 05 00 00 00       	mov    $0x5,%eax
+    1475:	89 e1                	mov    %esp,%ecx
+    1477:	ba 7e 14 00 00       	mov    $0x147e,%edx
+    147c:	0f 34                	sysenter
+    147e:	c3                   	ret
+
+0000147f <write>:
+SYSCALL(write)
+    147f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1484:	89 e1                	mov    %esp,%ecx
+    1486:	ba 8d 14 00 00       	mov    $0x148d,%edx
+    148b:	0f 34                	sysenter
+    148d:	c3                   	ret
+
+0000148e <close>:
+SYSCALL(close)
+    148e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1493:	89 e1                	mov    %esp,%ecx
+    1495:	ba 9c 14 00 00       	mov    $0x149c,%edx
+    149a:	0f 34                	sysenter
+    149c:	c3                   	ret
+
+0000149d <kill>:
+SYSCALL(kill)
+    149d:	b8 06 00 00 00       	mov    $0x6,%eax
+    14a2:	89 e1                	mov    %esp,%ecx
+    14a4:	ba ab 14 00 00       	mov    $0x14ab,%edx
+    14a9:	0f 34                	sysenter
+    14ab:	c3                   	ret
+
+000014ac <_exec>:
+RAWSYSCALL(exec)
+    14ac:	b8 07 00 00 00       	mov    $0x7,%eax
+    14b1:	89 e1                	mov    %esp,%ecx
+    14b3:	ba ba 14 00 00       	mov    $0x14ba,%edx
+    14b8:	0f 34                	sysenter
+    14ba:	c3                   	ret
+
+000014bb <open>:
+SYSCALL(open)
+    14bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+    14c0:	89 e1                	mov    %esp,%ecx
+    14c2:	ba c9 14 00 00       	mov    $0x14c9,%edx
+    14c7:	0f 34                	sysenter
+    14c9:	c3                   	ret
+
+000014ca <mknod>:
+SYSCALL(mknod)
+    14ca:	b8 11 00 00 00       	mov    $0x11,%eax
+    14cf:	89 e1                	mov    %esp,%ecx
+    14d1:	ba d8 14 00 00       	mov    $0x14d8,%edx
+    14d6:	0f 34                	sysenter
+    14d8:	c3                   	ret
+
+000014d9 <unlink>:
+SYSCALL(unlink)
+    14d9:	b8 12 00 00 00       	mov    $0x12,%eax
+    14de:	89 e1                	mov    %esp,%ecx
+    14e0:	ba e7 14 00 00       	mov    $0x14e7,%edx
+    14e5:	0f 34                	sysenter
+    14e7:	c3                   	ret
+
+000014e8 <fstat>:
+SYSCALL(fstat)
+    14e8:	b8 08 00 00 00       	mov    $0x8,%eax
+    14ed:	89 e1                	mov    %esp,%ecx
+    14ef:	ba f6 14 00 00       	mov    $0x14f6,%edx
+    14f4:	0f 34                	sysenter
+    14f6:	c3                   	ret
+
+000014f7 <link>:
+SYSCALL(link)
+    14f7:	b8 13 00 00 00       	mov    $0x13,%eax
+    14fc:	89 e1                	mov    %esp,%ecx
+    14fe:	ba 05 15 00 00       	mov    $0x1505,%edx
+    1503:	0f 34                	sysenter
+    1505:	c3                   	ret
+
+00001506 <mkdir>:
+SYSCALL(mkdir)
+    1506:	b8 14 00 00 00       	mov    $0x14,%eax
+    150b:	89 e1                	mov    %esp,%ecx
+    150d:	ba 14 15 00 00       	mov    $0x1514,%edx
+    1512:	0f 34                	sysenter
+    1514:	c3                   	ret
+
+00001515 <chdir>:
+SYSCALL(chdir)
+    1515:	b8 09 00 00 00       	mov    $0x9,%eax
+    151a:	89 e1                	mov    %esp,%ecx
+    151c:	ba 23 15 00 00       	mov    $0x1523,%edx
+    1521:	0f 34                	sysenter
+    1523:	c3                   	ret
+
+00001524 <dup>:
+SYSCALL(dup)
+    1524:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1529:	89 e1                	mov    %esp,%ecx
+    152b:	ba 32 15 00 00       	mov    $0x1532,%edx
+    1530:	0f 34                	sysenter
+    1532:	c3                   	ret
+
+00001533 <getpid>:
+SYSCALL(getpid)
+    1533:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1538:	89 e1                	mov    %esp,%ecx
+    153a:	ba 41 15 00 00       	mov    $0x1541,%edx
+    153f:	0f 34                	sysenter
+    1541:	c3                   	ret
+
+00001542 <sbrk>:
+SYSCALL(sbrk)
+    1542:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1547:	89 e1                	mov    %esp,%ecx
+    1549:	ba 50 15 00 00       	mov    $0x1550,%edx
+    154e:	0f 34                	sysenter
+    1550:	c3                   	ret
+
+00001551 <sleep>:
+SYSCALL(sleep)
+    1551:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1556:	89 e1                	mov    %esp,%ecx
+    1558:	ba 5f 15 00 00       	mov    $0x155f,%edx
+    155d:	0f 34                	sysenter
+    155f:	c3                   	ret
+
+00001560 <uptime>:
+SYSCALL(uptime)
+    1560:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1565:	89 e1                	mov    %esp,%ecx
+    1567:	ba 6e 15 00 00       	mov    $0x156e,%edx
+    156c:	0f 34                	sysenter
+    156e:	c3                   	ret
+
+0000156f <mprotect>:
+SYSCALL(mprotect)
+    156f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1574:	89 e1                	mov    %esp,%ecx
+    1576:	ba 7d 15 00 00       	mov    $0x157d,%edx
+    157b:	0f 34                	sysenter
+    157d:	c3                   	ret
+
+0000157e <munprotect>:
+SYSCALL(munprotect)
+    157e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1583:	89 e1                	mov    %esp,%ecx
+    1585:	ba 8c 15 00 00       	mov    $0x158c,%edx
+    158a:	0f 34                	sysenter
+    158c:	c3                   	ret
+
+0000158d <kstat>:
+SYSCALL(kstat)
+    158d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1592:	89 e1                	mov    %esp,%ecx
+    1594:	ba 9b 15 00 00       	mov    $0x159b,%edx
+    1599:	0f 34                	sysenter
+    159b:	c3                   	ret
+
+0000159c <fcntl>:
+SYSCALL(fcntl)
+    159c:	b8 19 00 00 00       	mov    $0x19,%eax
+    15a1:	89 e1                	mov    %esp,%ecx
+    15a3:	ba aa 15 00 00       	mov    $0x15aa,%edx
+    15a8:	0f 34                	sysenter
+    15aa:	c3                   	ret
+
+000015ab <splice>:
+SYSCALL(splice)
+    15ab:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    15b0:	89 e1                	mov    %esp,%ecx
+    15b2:	ba b9 15 00 00       	mov    $0x15b9,%edx
+    15b7:	0f 34                	sysenter
+    15b9:	c3                   	ret
+
+000015ba <sendfile>:
+SYSCALL(sendfile)
+    15ba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    15bf:	89 e1                	mov    %esp,%ecx
+    15c1:	ba c8 15 00 00       	mov    $0x15c8,%edx
+    15c6:	0f 34                	sysenter
+    15c8:	c3                   	ret
+
+000015c9 <lseek>:
+SYSCALL(lseek)
+    15c9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    15ce:	89 e1                	mov    %esp,%ecx
+    15d0:	ba d7 15 00 00       	mov    $0x15d7,%edx
+    15d5:	0f 34                	sysenter
+    15d7:	c3                   	ret
+
+000015d8 <pread>:
+SYSCALL(pread)
+    15d8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    15dd:	89 e1                	mov    %esp,%ecx
+    15df:	ba e6 15 00 00       	mov    $0x15e6,%edx
+    15e4:	0f 34                	sysenter
+    15e6:	c3                   	ret
+
+000015e7 <pwrite>:
+SYSCALL(pwrite)
+    15e7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    15ec:	89 e1                	mov    %esp,%ecx
+    15ee:	ba f5 15 00 00       	mov    $0x15f5,%edx
+    15f3:	0f 34                	sysenter
+    15f5:	c3                   	ret
+
+000015f6 <readv>:
+SYSCALL(readv)
+    15f6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    15fb:	89 e1                	mov    %esp,%ecx
+    15fd:	ba 04 16 00 00       	mov    $0x1604,%edx
+    1602:	0f 34                	sysenter
+    1604:	c3                   	ret
+
+00001605 <writev>:
+SYSCALL(writev)
+    1605:	b8 20 00 00 00       	mov    $0x20,%eax
+    160a:	89 e1                	mov    %esp,%ecx
+    160c:	ba 13 16 00 00       	mov    $0x1613,%edx
+    1611:	0f 34                	sysenter
+    1613:	c3                   	ret
+
+00001614 <ringsetup>:
+SYSCALL(ringsetup)
+    1614:	b8 21 00 00 00       	mov    $0x21,%eax
+    1619:	89 e1                	mov    %esp,%ecx
+    161b:	ba 22 16 00 00       	mov    $0x1622,%edx
+    1620:	0f 34                	sysenter
+    1622:	c3                   	ret
+
+00001623 <ringenter>:
+SYSCALL(ringenter)
+    1623:	b8 22 00 00 00       	mov    $0x22,%eax
+    1628:	89 e1                	mov    %esp,%ecx
+    162a:	ba 31 16 00 00       	mov    $0x1631,%edx
+    162f:	0f 34                	sysenter
+    1631:	c3                   	ret
+
+00001632 <intgetpid>:
+INTSYSCALL(getpid)
+    1632:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1637:	cd 40                	int    $0x40
+    1639:	c3                   	ret
+    163a:	66 90                	xchg   %ax,%ax
+    163c:	66 90                	xchg   %ax,%ax
+    163e:	66 90                	xchg   %ax,%ax
+
+00001640 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	57                   	push   %edi
+    1644:	56                   	push   %esi
+    1645:	53                   	push   %ebx
+    1646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1648:	89 d1                	mov    %edx,%ecx
+{
+    164a:	83 ec 2c             	sub    $0x2c,%esp
+    164d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1650:	85 d2                	test   %edx,%edx
+    1652:	0f 89 c0 00 00 00    	jns    1718 <printint+0xd8>
+    1658:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    165c:	0f 84 b6 00 00 00    	je     1718 <printint+0xd8>
+    x = -xx;
+    1662:	f7 d9                	neg    %ecx
+    neg = 1;
+    1664:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1669:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    166c:	31 f6                	xor    %esi,%esi
+    166e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1670:	89 c8                	mov    %ecx,%eax
+    1672:	31 d2                	xor    %edx,%edx
+    1674:	89 f7                	mov    %esi,%edi
+    1676:	f7 f3                	div    %ebx
+    1678:	8d 76 01             	lea    0x1(%esi),%esi
+    167b:	0f b6 92 b0 23 00 00 	movzbl 0x23b0(%edx),%edx
+    1682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1686:	89 ca                	mov    %ecx,%edx
+    1688:	89 c1                	mov    %eax,%ecx
+    168a:	39 da                	cmp    %ebx,%edx
+    168c:	73 e2                	jae    1670 <printint+0x30>
+  if(neg)
+    168e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1691:	85 c0                	test   %eax,%eax
+    1693:	74 07                	je     169c <printint+0x5c>
+    buf[i++] = '-';
+    1695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    169a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    169c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    169f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    16a2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    16a4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    16a7:	8b 41 08             	mov    0x8(%ecx),%eax
+    16aa:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    16ad:	89 ce                	mov    %ecx,%esi
+    16af:	eb 1c                	jmp    16cd <printint+0x8d>
+    16b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    16b8:	89 c1                	mov    %eax,%ecx
+    16ba:	83 c0 01             	add    $0x1,%eax
+    16bd:	89 46 08             	mov    %eax,0x8(%esi)
+    16c0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    16c4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    16c7:	39 df                	cmp    %ebx,%edi
+    16c9:	74 41                	je     170c <printint+0xcc>
+    16cb:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    16cd:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    16d0:	3d 80 00 00 00       	cmp    $0x80,%eax
+    16d5:	75 e1                	jne    16b8 <printint+0x78>
+  if(o->f)
+    16d7:	8b 06                	mov    (%esi),%eax
+    16d9:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    16dc:	85 c0                	test   %eax,%eax
+    16de:	74 40                	je     1720 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    16e0:	50                   	push   %eax
+    16e1:	68 80 00 00 00       	push   $0x80
+    16e6:	6a 01                	push   $0x1
+    16e8:	ff 75 d4             	push   -0x2c(%ebp)
+    16eb:	e8 a0 04 00 00       	call   1b90 <fwrite>
+    16f0:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    16f4:	83 c4 10             	add    $0x10,%esp
+}
+    16f7:	b8 01 00 00 00       	mov    $0x1,%eax
+    16fc:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    16fe:	89 46 08             	mov    %eax,0x8(%esi)
+    1701:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1705:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1708:	39 df                	cmp    %ebx,%edi
+    170a:	75 bf                	jne    16cb <printint+0x8b>
+}
+    170c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    170f:	5b                   	pop    %ebx
+    1710:	5e                   	pop    %esi
+    1711:	5f                   	pop    %edi
+    1712:	5d                   	pop    %ebp
+    1713:	c3                   	ret
+    1714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1718:	31 c0                	xor    %eax,%eax
+    171a:	e9 4a ff ff ff       	jmp    1669 <printint+0x29>
+    171f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1720:	83 ec 04             	sub    $0x4,%esp
+    1723:	68 80 00 00 00       	push   $0x80
+    1728:	ff 75 d4             	push   -0x2c(%ebp)
+    172b:	ff 76 04             	push   0x4(%esi)
+    172e:	e8 4c fd ff ff       	call   147f <write>
+    1733:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1737:	83 c4 10             	add    $0x10,%esp
+    173a:	eb bb                	jmp    16f7 <printint+0xb7>
+    173c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001740 <putc>:
+{
+    1740:	55                   	push   %ebp
+    1741:	89 e5                	mov    %esp,%ebp
+    1743:	56                   	push   %esi
+    1744:	89 d6                	mov    %edx,%esi
+    1746:	53                   	push   %ebx
+    1747:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1749:	8b 40 08             	mov    0x8(%eax),%eax
+    174c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1751:	74 1d                	je     1770 <putc+0x30>
+  o->buf[o->n++] = c;
+    1753:	89 f1                	mov    %esi,%ecx
+    1755:	8d 50 01             	lea    0x1(%eax),%edx
+    1758:	89 53 08             	mov    %edx,0x8(%ebx)
+    175b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    175f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1762:	5b                   	pop    %ebx
+    1763:	5e                   	pop    %esi
+    1764:	5d                   	pop    %ebp
+    1765:	c3                   	ret
+    1766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    176d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1770:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1772:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1775:	85 c0                	test   %eax,%eax
+    1777:	74 2f                	je     17a8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1779:	50                   	push   %eax
+    177a:	68 80 00 00 00       	push   $0x80
+    177f:	6a 01                	push   $0x1
+    1781:	52                   	push   %edx
+    1782:	e8 09 04 00 00       	call   1b90 <fwrite>
+    1787:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    178a:	89 f1                	mov    %esi,%ecx
+}
+    178c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1791:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1793:	89 53 08             	mov    %edx,0x8(%ebx)
+    1796:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    179a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    179d:	5b                   	pop    %ebx
+    179e:	5e                   	pop    %esi
+    179f:	5d                   	pop    %ebp
+    17a0:	c3                   	ret
+    17a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    17a8:	83 ec 04             	sub    $0x4,%esp
+    17ab:	68 80 00 00 00       	push   $0x80
+    17b0:	52                   	push   %edx
+    17b1:	ff 73 04             	push   0x4(%ebx)
+    17b4:	e8 c6 fc ff ff       	call   147f <write>
+    17b9:	83 c4 10             	add    $0x10,%esp
+    17bc:	eb cc                	jmp    178a <putc+0x4a>
+    17be:	66 90                	xchg   %ax,%ax
+
+000017c0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	57                   	push   %edi
+    17c4:	89 c7                	mov    %eax,%edi
+    17c6:	56                   	push   %esi
+    17c7:	31 f6                	xor    %esi,%esi
+    17c9:	53                   	push   %ebx
+    17ca:	8d 5a 01             	lea    0x1(%edx),%ebx
+    17cd:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    17d0:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    17d3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    17d6:	84 c0                	test   %al,%al
+    17d8:	75 1e                	jne    17f8 <vprintf.constprop.0+0x38>
+    17da:	eb 53                	jmp    182f <vprintf.constprop.0+0x6f>
+    17dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    17e0:	83 f8 25             	cmp    $0x25,%eax
+    17e3:	74 3b                	je     1820 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    17e5:	89 ca                	mov    %ecx,%edx
+    17e7:	89 f8                	mov    %edi,%eax
+    17e9:	e8 52 ff ff ff       	call   1740 <putc>
+  for(i = 0; fmt[i]; i++){
+    17ee:	0f b6 03             	movzbl (%ebx),%eax
+    17f1:	83 c3 01             	add    $0x1,%ebx
+    17f4:	84 c0                	test   %al,%al
+    17f6:	74 37                	je     182f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    17f8:	0f be c8             	movsbl %al,%ecx
+    17fb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    17fe:	85 f6                	test   %esi,%esi
+    1800:	74 de                	je     17e0 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1802:	83 fe 25             	cmp    $0x25,%esi
+    1805:	75 e7                	jne    17ee <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1807:	83 f8 25             	cmp    $0x25,%eax
+    180a:	74 4e                	je     185a <vprintf.constprop.0+0x9a>
+    180c:	83 e8 63             	sub    $0x63,%eax
+    180f:	83 f8 15             	cmp    $0x15,%eax
+    1812:	77 34                	ja     1848 <vprintf.constprop.0+0x88>
+    1814:	ff 24 85 58 23 00 00 	jmp    *0x2358(,%eax,4)
+    181b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    181f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1820:	0f b6 03             	movzbl (%ebx),%eax
+    1823:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1826:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    182b:	84 c0                	test   %al,%al
+    182d:	75 c9                	jne    17f8 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    182f:	8b 47 08             	mov    0x8(%edi),%eax
+    1832:	85 c0                	test   %eax,%eax
+    1834:	0f 8f de 00 00 00    	jg     1918 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    183a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    183d:	5b                   	pop    %ebx
+    183e:	5e                   	pop    %esi
+    183f:	5f                   	pop    %edi
+    1840:	5d                   	pop    %ebp
+    1841:	c3                   	ret
+    1842:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1848:	ba 25 00 00 00       	mov    $0x25,%edx
+    184d:	89 f8                	mov    %edi,%eax
+    184f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1852:	e8 e9 fe ff ff       	call   1740 <putc>
+        putc(o, c);
+    1857:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    185a:	89 ca                	mov    %ecx,%edx
+    185c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    185e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1860:	e8 db fe ff ff       	call   1740 <putc>
+    1865:	eb 87                	jmp    17ee <vprintf.constprop.0+0x2e>
+    1867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1870:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1873:	83 ec 0c             	sub    $0xc,%esp
+    1876:	b9 10 00 00 00       	mov    $0x10,%ecx
+    187b:	8b 16                	mov    (%esi),%edx
+    187d:	6a 00                	push   $0x0
+        ap++;
+    187f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1882:	89 f8                	mov    %edi,%eax
+    1884:	e8 b7 fd ff ff       	call   1640 <printint>
+        ap++;
+    1889:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    188c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    188f:	31 f6                	xor    %esi,%esi
+    1891:	e9 58 ff ff ff       	jmp    17ee <vprintf.constprop.0+0x2e>
+    1896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    189d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    18a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    18a3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    18a5:	83 c0 04             	add    $0x4,%eax
+    18a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    18ab:	85 f6                	test   %esi,%esi
+    18ad:	75 1b                	jne    18ca <vprintf.constprop.0+0x10a>
+    18af:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    18b4:	be 50 23 00 00       	mov    $0x2350,%esi
+    18b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    18c0:	89 f8                	mov    %edi,%eax
+          s++;
+    18c2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    18c5:	e8 76 fe ff ff       	call   1740 <putc>
+        while(*s != 0){
+    18ca:	0f be 16             	movsbl (%esi),%edx
+    18cd:	84 d2                	test   %dl,%dl
+    18cf:	75 ef                	jne    18c0 <vprintf.constprop.0+0x100>
+      state = 0;
+    18d1:	31 f6                	xor    %esi,%esi
+    18d3:	e9 16 ff ff ff       	jmp    17ee <vprintf.constprop.0+0x2e>
+    18d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18df:	90                   	nop
+        printint(o, *ap, 10, 1);
+    18e0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    18e3:	83 ec 0c             	sub    $0xc,%esp
+    18e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    18eb:	8b 16                	mov    (%esi),%edx
+    18ed:	6a 01                	push   $0x1
+    18ef:	eb 8e                	jmp    187f <vprintf.constprop.0+0xbf>
+    18f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    18f8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    18fb:	89 f8                	mov    %edi,%eax
+    18fd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1900:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1903:	e8 38 fe ff ff       	call   1740 <putc>
+        ap++;
+    1908:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    190b:	31 f6                	xor    %esi,%esi
+    190d:	e9 dc fe ff ff       	jmp    17ee <vprintf.constprop.0+0x2e>
+    1912:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1918:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    191a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    191d:	85 d2                	test   %edx,%edx
+    191f:	74 1f                	je     1940 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1921:	52                   	push   %edx
+    1922:	50                   	push   %eax
+    1923:	6a 01                	push   $0x1
+    1925:	51                   	push   %ecx
+    1926:	e8 65 02 00 00       	call   1b90 <fwrite>
+    192b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    192e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1938:	5b                   	pop    %ebx
+    1939:	5e                   	pop    %esi
+    193a:	5f                   	pop    %edi
+    193b:	5d                   	pop    %ebp
+    193c:	c3                   	ret
+    193d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1940:	83 ec 04             	sub    $0x4,%esp
+    1943:	50                   	push   %eax
+    1944:	51                   	push   %ecx
+    1945:	ff 77 04             	push   0x4(%edi)
+    1948:	e8 32 fb ff ff       	call   147f <write>
+    194d:	83 c4 10             	add    $0x10,%esp
+    1950:	eb dc                	jmp    192e <vprintf.constprop.0+0x16e>
+    1952:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001960 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1960:	55                   	push   %ebp
+    1961:	89 e5                	mov    %esp,%ebp
+    1963:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1969:	a1 84 2a 00 00       	mov    0x2a84,%eax
+{
+    196e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1971:	83 fa 01             	cmp    $0x1,%edx
+    1974:	74 0c                	je     1982 <printf+0x22>
+    1976:	31 c0                	xor    %eax,%eax
+    1978:	83 fa 02             	cmp    $0x2,%edx
+    197b:	0f 44 05 80 2a 00 00 	cmove  0x2a80,%eax
+  o.fd = fd;
+    1982:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1988:	8b 55 0c             	mov    0xc(%ebp),%edx
+    198b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    198e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1994:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    199a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    19a1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    19a4:	e8 17 fe ff ff       	call   17c0 <vprintf.constprop.0>
+}
+    19a9:	c9                   	leave
+    19aa:	c3                   	ret
+    19ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19af:	90                   	nop
+
+000019b0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    19b0:	55                   	push   %ebp
+    19b1:	89 e5                	mov    %esp,%ebp
+    19b3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    19b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    19bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    19bf:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    19c2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    19c9:	ff ff ff 
+  o.n = 0;
+    19cc:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    19d3:	00 00 00 
+  o.f = f;
+    19d6:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    19dc:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    19e2:	e8 d9 fd ff ff       	call   17c0 <vprintf.constprop.0>
+}
+    19e7:	c9                   	leave
+    19e8:	c3                   	ret
+    19e9:	66 90                	xchg   %ax,%ax
+    19eb:	66 90                	xchg   %ax,%ax
+    19ed:	66 90                	xchg   %ax,%ax
+    19ef:	90                   	nop
+
+000019f0 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    19f0:	55                   	push   %ebp
+    19f1:	89 e5                	mov    %esp,%ebp
+    19f3:	53                   	push   %ebx
+    19f4:	89 c3                	mov    %eax,%ebx
+    19f6:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    19f9:	8b 40 0c             	mov    0xc(%eax),%eax
+    19fc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    19ff:	74 17                	je     1a18 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1a01:	83 f8 02             	cmp    $0x2,%eax
+    1a04:	74 07                	je     1a0d <setmode+0x1d>
+    1a06:	8b 43 18             	mov    0x18(%ebx),%eax
+    1a09:	85 c0                	test   %eax,%eax
+    1a0b:	74 38                	je     1a45 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1a0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a10:	c9                   	leave
+    1a11:	c3                   	ret
+    1a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1a18:	83 ec 08             	sub    $0x8,%esp
+    1a1b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1a1e:	50                   	push   %eax
+    1a1f:	ff 33                	push   (%ebx)
+    1a21:	e8 c2 fa ff ff       	call   14e8 <fstat>
+    1a26:	83 c4 10             	add    $0x10,%esp
+    1a29:	89 c2                	mov    %eax,%edx
+    1a2b:	31 c0                	xor    %eax,%eax
+    1a2d:	85 d2                	test   %edx,%edx
+    1a2f:	75 0a                	jne    1a3b <setmode+0x4b>
+    1a31:	31 c0                	xor    %eax,%eax
+    1a33:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1a38:	0f 94 c0             	sete   %al
+    1a3b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1a3e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1a41:	85 c0                	test   %eax,%eax
+    1a43:	75 c8                	jne    1a0d <setmode+0x1d>
+    1a45:	83 ec 0c             	sub    $0xc,%esp
+    1a48:	68 00 04 00 00       	push   $0x400
+    1a4d:	e8 de 07 00 00       	call   2230 <malloc>
+    1a52:	83 c4 10             	add    $0x10,%esp
+    1a55:	89 43 18             	mov    %eax,0x18(%ebx)
+    1a58:	85 c0                	test   %eax,%eax
+    1a5a:	75 b1                	jne    1a0d <setmode+0x1d>
+    f->mode = IONBF;
+    1a5c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1a63:	eb a8                	jmp    1a0d <setmode+0x1d>
+    1a65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001a70 <drain>:
+{
+    1a70:	55                   	push   %ebp
+    1a71:	89 e5                	mov    %esp,%ebp
+    1a73:	57                   	push   %edi
+    1a74:	56                   	push   %esi
+    1a75:	53                   	push   %ebx
+    1a76:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1a79:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1a7c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1a7f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1a86:	85 ff                	test   %edi,%edi
+    1a88:	7f 0e                	jg     1a98 <drain+0x28>
+  return 0;
+    1a8a:	31 c0                	xor    %eax,%eax
+}
+    1a8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a8f:	5b                   	pop    %ebx
+    1a90:	5e                   	pop    %esi
+    1a91:	5f                   	pop    %edi
+    1a92:	5d                   	pop    %ebp
+    1a93:	c3                   	ret
+    1a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1a98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a9b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1a9e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1aa0:	eb 0e                	jmp    1ab0 <drain+0x40>
+    1aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1aa8:	29 c7                	sub    %eax,%edi
+    1aaa:	01 c3                	add    %eax,%ebx
+    1aac:	85 ff                	test   %edi,%edi
+    1aae:	7e da                	jle    1a8a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1ab0:	83 ec 04             	sub    $0x4,%esp
+    1ab3:	57                   	push   %edi
+    1ab4:	53                   	push   %ebx
+    1ab5:	56                   	push   %esi
+    1ab6:	e8 c4 f9 ff ff       	call   147f <write>
+    1abb:	83 c4 10             	add    $0x10,%esp
+    1abe:	85 c0                	test   %eax,%eax
+    1ac0:	7f e6                	jg     1aa8 <drain+0x38>
+    f->err = 1;
+    1ac2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1ac5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1acc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ad1:	eb b9                	jmp    1a8c <drain+0x1c>
+    1ad3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001ae0 <flushall>:
+
+static void
+flushall(void)
+{
+    1ae0:	55                   	push   %ebp
+    1ae1:	89 e5                	mov    %esp,%ebp
+    1ae3:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ae4:	bb a0 2a 00 00       	mov    $0x2aa0,%ebx
+{
+    1ae9:	83 ec 04             	sub    $0x4,%esp
+    1aec:	eb 0d                	jmp    1afb <flushall+0x1b>
+    1aee:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1af0:	83 c3 24             	add    $0x24,%ebx
+    1af3:	81 fb e0 2c 00 00    	cmp    $0x2ce0,%ebx
+    1af9:	74 19                	je     1b14 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1afb:	8b 43 08             	mov    0x8(%ebx),%eax
+    1afe:	85 c0                	test   %eax,%eax
+    1b00:	74 ee                	je     1af0 <flushall+0x10>
+    1b02:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b04:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1b07:	e8 64 ff ff ff       	call   1a70 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b0c:	81 fb e0 2c 00 00    	cmp    $0x2ce0,%ebx
+    1b12:	75 e7                	jne    1afb <flushall+0x1b>
+}
+    1b14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1b17:	c9                   	leave
+    1b18:	c3                   	ret
+    1b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b20 <fflush>:
+{
+    1b20:	55                   	push   %ebp
+    1b21:	89 e5                	mov    %esp,%ebp
+    1b23:	57                   	push   %edi
+    1b24:	56                   	push   %esi
+    1b25:	53                   	push   %ebx
+    1b26:	83 ec 0c             	sub    $0xc,%esp
+    1b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1b2c:	85 c0                	test   %eax,%eax
+    1b2e:	74 28                	je     1b58 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1b30:	8b 70 08             	mov    0x8(%eax),%esi
+    1b33:	85 f6                	test   %esi,%esi
+    1b35:	75 11                	jne    1b48 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1b37:	83 c4 0c             	add    $0xc,%esp
+    1b3a:	89 f0                	mov    %esi,%eax
+    1b3c:	5b                   	pop    %ebx
+    1b3d:	5e                   	pop    %esi
+    1b3e:	5f                   	pop    %edi
+    1b3f:	5d                   	pop    %ebp
+    1b40:	c3                   	ret
+    1b41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b48:	83 c4 0c             	add    $0xc,%esp
+    1b4b:	5b                   	pop    %ebx
+    1b4c:	5e                   	pop    %esi
+    1b4d:	5f                   	pop    %edi
+    1b4e:	5d                   	pop    %ebp
+  return drain(f);
+    1b4f:	e9 1c ff ff ff       	jmp    1a70 <drain>
+    1b54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1b58:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b5a:	bb a0 2a 00 00       	mov    $0x2aa0,%ebx
+        r = -1;
+    1b5f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1b64:	eb 15                	jmp    1b7b <fflush+0x5b>
+    1b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b70:	83 c3 24             	add    $0x24,%ebx
+    1b73:	81 fb e0 2c 00 00    	cmp    $0x2ce0,%ebx
+    1b79:	74 bc                	je     1b37 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1b7b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1b7e:	85 c0                	test   %eax,%eax
+    1b80:	74 ee                	je     1b70 <fflush+0x50>
+    1b82:	89 d8                	mov    %ebx,%eax
+    1b84:	e8 e7 fe ff ff       	call   1a70 <drain>
+        r = -1;
+    1b89:	85 c0                	test   %eax,%eax
+    1b8b:	0f 48 f7             	cmovs  %edi,%esi
+    1b8e:	eb e0                	jmp    1b70 <fflush+0x50>
+
+00001b90 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1b90:	55                   	push   %ebp
+    1b91:	89 e5                	mov    %esp,%ebp
+    1b93:	57                   	push   %edi
+    1b94:	56                   	push   %esi
+    1b95:	53                   	push   %ebx
+    1b96:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1b99:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1b9c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1ba0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1ba3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1ba6:	85 d2                	test   %edx,%edx
+    1ba8:	0f 8e 26 01 00 00    	jle    1cd4 <fwrite+0x144>
+  if(!f->writable){
+    1bae:	8b 46 08             	mov    0x8(%esi),%eax
+    1bb1:	85 c0                	test   %eax,%eax
+    1bb3:	0f 84 14 01 00 00    	je     1ccd <fwrite+0x13d>
+  setmode(f);
+    1bb9:	89 f0                	mov    %esi,%eax
+    1bbb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1bbe:	e8 2d fe ff ff       	call   19f0 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1bc3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1bc7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1bca:	c7 05 e0 2e 00 00 e0 	movl   $0x1ae0,0x2ee0
+    1bd1:	1a 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1bd4:	0f 84 b6 00 00 00    	je     1c90 <fwrite+0x100>
+    1bda:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1be0:	0f 8f aa 00 00 00    	jg     1c90 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1be6:	8b 46 20             	mov    0x20(%esi),%eax
+    1be9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1bec:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1bee:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1bf3:	74 6c                	je     1c61 <fwrite+0xd1>
+    1bf5:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1bf8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1bfb:	ba 00 04 00 00       	mov    $0x400,%edx
+    1c00:	29 c2                	sub    %eax,%edx
+    1c02:	39 ca                	cmp    %ecx,%edx
+    1c04:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1c07:	85 d2                	test   %edx,%edx
+    1c09:	0f 8e d1 00 00 00    	jle    1ce0 <fwrite+0x150>
+    1c0f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1c12:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1c15:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c1f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1c20:	8d 50 01             	lea    0x1(%eax),%edx
+    1c23:	83 c3 01             	add    $0x1,%ebx
+    1c26:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1c29:	89 56 20             	mov    %edx,0x20(%esi)
+    1c2c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1c30:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1c33:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1c36:	b8 01 00 00 00       	mov    $0x1,%eax
+    1c3b:	80 fa 0a             	cmp    $0xa,%dl
+    1c3e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c41:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1c44:	39 cb                	cmp    %ecx,%ebx
+    1c46:	75 d8                	jne    1c20 <fwrite+0x90>
+    1c48:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1c4b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1c4e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1c51:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1c54:	85 db                	test   %ebx,%ebx
+    1c56:	7e 19                	jle    1c71 <fwrite+0xe1>
+    n -= k;
+    1c58:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1c5a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1c5f:	75 97                	jne    1bf8 <fwrite+0x68>
+    1c61:	89 f0                	mov    %esi,%eax
+    1c63:	e8 08 fe ff ff       	call   1a70 <drain>
+    1c68:	85 c0                	test   %eax,%eax
+    1c6a:	78 68                	js     1cd4 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1c6c:	8b 46 20             	mov    0x20(%esi),%eax
+    1c6f:	eb 87                	jmp    1bf8 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c71:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1c76:	74 74                	je     1cec <fwrite+0x15c>
+    1c78:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1c7c:	75 04                	jne    1c82 <fwrite+0xf2>
+    1c7e:	85 ff                	test   %edi,%edi
+    1c80:	75 6a                	jne    1cec <fwrite+0x15c>
+    return nmemb;
+    1c82:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c88:	5b                   	pop    %ebx
+    1c89:	5e                   	pop    %esi
+    1c8a:	5f                   	pop    %edi
+    1c8b:	5d                   	pop    %ebp
+    1c8c:	c3                   	ret
+    1c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1c90:	89 f0                	mov    %esi,%eax
+    1c92:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c95:	e8 d6 fd ff ff       	call   1a70 <drain>
+    1c9a:	85 c0                	test   %eax,%eax
+    1c9c:	78 2f                	js     1ccd <fwrite+0x13d>
+    1c9e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1ca1:	8b 3e                	mov    (%esi),%edi
+    1ca3:	89 de                	mov    %ebx,%esi
+    1ca5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1ca8:	eb 0e                	jmp    1cb8 <fwrite+0x128>
+    1caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1cb0:	29 c3                	sub    %eax,%ebx
+    1cb2:	01 c6                	add    %eax,%esi
+    1cb4:	85 db                	test   %ebx,%ebx
+    1cb6:	7e ca                	jle    1c82 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1cb8:	83 ec 04             	sub    $0x4,%esp
+    1cbb:	53                   	push   %ebx
+    1cbc:	56                   	push   %esi
+    1cbd:	57                   	push   %edi
+    1cbe:	e8 bc f7 ff ff       	call   147f <write>
+    1cc3:	83 c4 10             	add    $0x10,%esp
+    1cc6:	85 c0                	test   %eax,%eax
+    1cc8:	7f e6                	jg     1cb0 <fwrite+0x120>
+    1cca:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1ccd:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1cd4:	31 c0                	xor    %eax,%eax
+}
+    1cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cd9:	5b                   	pop    %ebx
+    1cda:	5e                   	pop    %esi
+    1cdb:	5f                   	pop    %edi
+    1cdc:	5d                   	pop    %ebp
+    1cdd:	c3                   	ret
+    1cde:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1ce0:	89 d9                	mov    %ebx,%ecx
+    1ce2:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1ce5:	89 cb                	mov    %ecx,%ebx
+    1ce7:	e9 6e ff ff ff       	jmp    1c5a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1cec:	89 f0                	mov    %esi,%eax
+    1cee:	e8 7d fd ff ff       	call   1a70 <drain>
+    1cf3:	85 c0                	test   %eax,%eax
+    1cf5:	79 8b                	jns    1c82 <fwrite+0xf2>
+    return 0;
+    1cf7:	31 c0                	xor    %eax,%eax
+    1cf9:	eb db                	jmp    1cd6 <fwrite+0x146>
+    1cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cff:	90                   	nop
+
+00001d00 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1d00:	55                   	push   %ebp
+    1d01:	89 e5                	mov    %esp,%ebp
+    1d03:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1d06:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d09:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1d0c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1d0f:	ff 75 0c             	push   0xc(%ebp)
+    1d12:	6a 01                	push   $0x1
+    1d14:	6a 01                	push   $0x1
+    1d16:	50                   	push   %eax
+    1d17:	e8 74 fe ff ff       	call   1b90 <fwrite>
+    1d1c:	83 c4 10             	add    $0x10,%esp
+    1d1f:	83 f8 01             	cmp    $0x1,%eax
+    1d22:	75 0c                	jne    1d30 <fputc+0x30>
+    1d24:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1d28:	c9                   	leave
+    1d29:	c3                   	ret
+    1d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1d30:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1d31:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1d36:	c3                   	ret
+    1d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d3e:	66 90                	xchg   %ax,%ax
+
+00001d40 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1d40:	55                   	push   %ebp
+    1d41:	89 e5                	mov    %esp,%ebp
+    1d43:	57                   	push   %edi
+    1d44:	56                   	push   %esi
+    1d45:	53                   	push   %ebx
+    1d46:	83 ec 1c             	sub    $0x1c,%esp
+    1d49:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1d4c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1d4f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1d52:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1d55:	85 d2                	test   %edx,%edx
+    1d57:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1d5a:	7e 12                	jle    1d6e <fread+0x2e>
+    1d5c:	85 ff                	test   %edi,%edi
+    1d5e:	7e 0e                	jle    1d6e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1d60:	8b 43 04             	mov    0x4(%ebx),%eax
+    1d63:	85 c0                	test   %eax,%eax
+    1d65:	75 19                	jne    1d80 <fread+0x40>
+    f->err = 1;
+    1d67:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1d6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1d71:	31 c0                	xor    %eax,%eax
+}
+    1d73:	5b                   	pop    %ebx
+    1d74:	5e                   	pop    %esi
+    1d75:	5f                   	pop    %edi
+    1d76:	5d                   	pop    %ebp
+    1d77:	c3                   	ret
+    1d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d7f:	90                   	nop
+  setmode(f);
+    1d80:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1d82:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1d84:	e8 67 fc ff ff       	call   19f0 <setmode>
+  for(n = 0; n < want; n += k){
+    1d89:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1d8c:	89 f7                	mov    %esi,%edi
+    1d8e:	eb 31                	jmp    1dc1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1d90:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1d94:	74 08                	je     1d9e <fread+0x5e>
+    1d96:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1d9c:	7e 62                	jle    1e00 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1d9e:	83 ec 04             	sub    $0x4,%esp
+    1da1:	56                   	push   %esi
+    1da2:	8b 45 08             	mov    0x8(%ebp),%eax
+    1da5:	01 f8                	add    %edi,%eax
+    1da7:	50                   	push   %eax
+    1da8:	ff 33                	push   (%ebx)
+    1daa:	e8 c1 f6 ff ff       	call   1470 <read>
+    1daf:	83 c4 10             	add    $0x10,%esp
+    1db2:	85 c0                	test   %eax,%eax
+    1db4:	0f 8e ce 00 00 00    	jle    1e88 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1dba:	01 c7                	add    %eax,%edi
+    1dbc:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1dbf:	7e 36                	jle    1df7 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1dc1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1dc4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1dc7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1dca:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1dcc:	39 c1                	cmp    %eax,%ecx
+    1dce:	7d c0                	jge    1d90 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1dd0:	29 c8                	sub    %ecx,%eax
+    1dd2:	39 f0                	cmp    %esi,%eax
+    1dd4:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1dd7:	83 ec 04             	sub    $0x4,%esp
+    1dda:	56                   	push   %esi
+    1ddb:	03 4b 18             	add    0x18(%ebx),%ecx
+    1dde:	51                   	push   %ecx
+    1ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+    1de2:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1de4:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1de6:	50                   	push   %eax
+    1de7:	e8 34 f5 ff ff       	call   1320 <memmove>
+      f->r += k;
+    1dec:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1def:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1df2:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1df5:	7f ca                	jg     1dc1 <fread+0x81>
+    1df7:	89 fe                	mov    %edi,%esi
+    1df9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1dfc:	eb 3f                	jmp    1e3d <fread+0xfd>
+    1dfe:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1e00:	3b 1d 88 2a 00 00    	cmp    0x2a88,%ebx
+    1e06:	74 68                	je     1e70 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1e08:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1e0b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1e12:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1e19:	68 00 04 00 00       	push   $0x400
+    1e1e:	ff 73 18             	push   0x18(%ebx)
+    1e21:	ff 33                	push   (%ebx)
+    1e23:	e8 48 f6 ff ff       	call   1470 <read>
+    1e28:	83 c4 10             	add    $0x10,%esp
+    1e2b:	85 c0                	test   %eax,%eax
+    1e2d:	78 21                	js     1e50 <fread+0x110>
+  else if(n == 0)
+    1e2f:	75 2f                	jne    1e60 <fread+0x120>
+    f->eof = 1;
+    1e31:	89 fe                	mov    %edi,%esi
+    1e33:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e36:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1e3d:	89 f0                	mov    %esi,%eax
+}
+    1e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1e42:	99                   	cltd
+}
+    1e43:	5b                   	pop    %ebx
+    1e44:	5e                   	pop    %esi
+  return n / size;
+    1e45:	f7 ff                	idiv   %edi
+}
+    1e47:	5f                   	pop    %edi
+    1e48:	5d                   	pop    %ebp
+    1e49:	c3                   	ret
+    1e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1e50:	89 fe                	mov    %edi,%esi
+    1e52:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e55:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1e5c:	eb df                	jmp    1e3d <fread+0xfd>
+    1e5e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1e60:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1e63:	e9 54 ff ff ff       	jmp    1dbc <fread+0x7c>
+    1e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e6f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1e70:	83 ec 0c             	sub    $0xc,%esp
+    1e73:	ff 35 84 2a 00 00    	push   0x2a84
+    1e79:	e8 a2 fc ff ff       	call   1b20 <fflush>
+    1e7e:	83 c4 10             	add    $0x10,%esp
+    1e81:	eb 85                	jmp    1e08 <fread+0xc8>
+    1e83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e87:	90                   	nop
+        if(k < 0)
+    1e88:	89 fe                	mov    %edi,%esi
+    1e8a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e8d:	74 a7                	je     1e36 <fread+0xf6>
+    1e8f:	eb c4                	jmp    1e55 <fread+0x115>
+    1e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e9f:	90                   	nop
+
+00001ea0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1ea0:	55                   	push   %ebp
+    1ea1:	89 e5                	mov    %esp,%ebp
+    1ea3:	53                   	push   %ebx
+    1ea4:	83 ec 14             	sub    $0x14,%esp
+    1ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1eaa:	8b 50 04             	mov    0x4(%eax),%edx
+    1ead:	85 d2                	test   %edx,%edx
+    1eaf:	74 08                	je     1eb9 <fgetc+0x19>
+    1eb1:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1eb4:	3b 50 20             	cmp    0x20(%eax),%edx
+    1eb7:	7c 27                	jl     1ee0 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1eb9:	50                   	push   %eax
+    1eba:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1ebd:	6a 01                	push   $0x1
+    1ebf:	6a 01                	push   $0x1
+    1ec1:	50                   	push   %eax
+    1ec2:	e8 79 fe ff ff       	call   1d40 <fread>
+    1ec7:	83 c4 10             	add    $0x10,%esp
+    1eca:	83 f8 01             	cmp    $0x1,%eax
+    1ecd:	75 29                	jne    1ef8 <fgetc+0x58>
+    1ecf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1ed3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ed6:	c9                   	leave
+    1ed7:	c3                   	ret
+    1ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1edf:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1ee0:	8b 48 18             	mov    0x18(%eax),%ecx
+    1ee3:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1ee6:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1ee9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1eec:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1ef0:	c9                   	leave
+    1ef1:	c3                   	ret
+    1ef2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1ef8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1efd:	eb d4                	jmp    1ed3 <fgetc+0x33>
+    1eff:	90                   	nop
+
+00001f00 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1f00:	55                   	push   %ebp
+    1f01:	89 e5                	mov    %esp,%ebp
+    1f03:	57                   	push   %edi
+    1f04:	56                   	push   %esi
+    1f05:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1f06:	31 db                	xor    %ebx,%ebx
+{
+    1f08:	83 ec 1c             	sub    $0x1c,%esp
+    1f0b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1f0e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1f10:	eb 2e                	jmp    1f40 <fgets+0x40>
+    1f12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f18:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1f1b:	57                   	push   %edi
+    1f1c:	6a 01                	push   $0x1
+    1f1e:	6a 01                	push   $0x1
+    1f20:	50                   	push   %eax
+    1f21:	e8 1a fe ff ff       	call   1d40 <fread>
+    1f26:	83 c4 10             	add    $0x10,%esp
+    1f29:	83 f8 01             	cmp    $0x1,%eax
+    1f2c:	75 62                	jne    1f90 <fgets+0x90>
+    1f2e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f35:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1f37:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1f3b:	83 f9 0a             	cmp    $0xa,%ecx
+    1f3e:	74 34                	je     1f74 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1f40:	89 de                	mov    %ebx,%esi
+    1f42:	83 c3 01             	add    $0x1,%ebx
+    1f45:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1f48:	7d 46                	jge    1f90 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1f4a:	8b 47 04             	mov    0x4(%edi),%eax
+    1f4d:	85 c0                	test   %eax,%eax
+    1f4f:	74 c7                	je     1f18 <fgets+0x18>
+    1f51:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1f54:	3b 47 20             	cmp    0x20(%edi),%eax
+    1f57:	7d bf                	jge    1f18 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1f59:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1f5c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1f5f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1f62:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1f65:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1f69:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1f6b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1f6f:	83 f9 0a             	cmp    $0xa,%ecx
+    1f72:	75 cc                	jne    1f40 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1f74:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f77:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1f7b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f81:	5b                   	pop    %ebx
+    1f82:	5e                   	pop    %esi
+    1f83:	5f                   	pop    %edi
+    1f84:	5d                   	pop    %ebp
+    1f85:	c3                   	ret
+    1f86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f8d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    1f90:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f93:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    1f97:	31 c0                	xor    %eax,%eax
+    1f99:	85 f6                	test   %esi,%esi
+    1f9b:	74 e1                	je     1f7e <fgets+0x7e>
+    1f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1fa0:	eb dc                	jmp    1f7e <fgets+0x7e>
+    1fa2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001fb0 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    1fb0:	55                   	push   %ebp
+    1fb1:	89 e5                	mov    %esp,%ebp
+    1fb3:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1fb4:	bb a0 2a 00 00       	mov    $0x2aa0,%ebx
+{
+    1fb9:	83 ec 04             	sub    $0x4,%esp
+    1fbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    1fc0:	8b 53 04             	mov    0x4(%ebx),%edx
+    1fc3:	85 d2                	test   %edx,%edx
+    1fc5:	75 07                	jne    1fce <fdopen+0x1e>
+    1fc7:	8b 43 08             	mov    0x8(%ebx),%eax
+    1fca:	85 c0                	test   %eax,%eax
+    1fcc:	74 1a                	je     1fe8 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1fce:	83 c3 24             	add    $0x24,%ebx
+    1fd1:	81 fb e0 2c 00 00    	cmp    $0x2ce0,%ebx
+    1fd7:	75 e7                	jne    1fc0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    1fd9:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    1fdb:	89 d8                	mov    %ebx,%eax
+    1fdd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fe0:	c9                   	leave
+    1fe1:	c3                   	ret
+    1fe2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    1fe8:	81 fb e0 2c 00 00    	cmp    $0x2ce0,%ebx
+    1fee:	74 e9                	je     1fd9 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    1ff0:	83 ec 04             	sub    $0x4,%esp
+    1ff3:	6a 24                	push   $0x24
+    1ff5:	6a 00                	push   $0x0
+    1ff7:	53                   	push   %ebx
+    1ff8:	e8 d3 f1 ff ff       	call   11d0 <memset>
+  f->fd = fd;
+    1ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2000:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2007:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    200a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    200c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    200f:	80 38 72             	cmpb   $0x72,(%eax)
+    2012:	74 14                	je     2028 <fdopen+0x78>
+    f->writable = 1;
+    2014:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    201b:	89 d8                	mov    %ebx,%eax
+    201d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2020:	c9                   	leave
+    2021:	c3                   	ret
+    2022:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2028:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    202f:	89 d8                	mov    %ebx,%eax
+    2031:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2034:	c9                   	leave
+    2035:	c3                   	ret
+    2036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    203d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002040 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2040:	55                   	push   %ebp
+    2041:	89 e5                	mov    %esp,%ebp
+    2043:	56                   	push   %esi
+    2044:	53                   	push   %ebx
+    2045:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2048:	0f b6 06             	movzbl (%esi),%eax
+    204b:	3c 72                	cmp    $0x72,%al
+    204d:	74 61                	je     20b0 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    204f:	3c 77                	cmp    $0x77,%al
+    2051:	74 7d                	je     20d0 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2053:	3c 61                	cmp    $0x61,%al
+    2055:	75 49                	jne    20a0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2057:	83 ec 08             	sub    $0x8,%esp
+    205a:	68 01 02 00 00       	push   $0x201
+    205f:	ff 75 08             	push   0x8(%ebp)
+    2062:	e8 54 f4 ff ff       	call   14bb <open>
+    2067:	83 c4 10             	add    $0x10,%esp
+    206a:	89 c3                	mov    %eax,%ebx
+    206c:	85 c0                	test   %eax,%eax
+    206e:	78 30                	js     20a0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2070:	83 ec 04             	sub    $0x4,%esp
+    2073:	6a 02                	push   $0x2
+    2075:	6a 00                	push   $0x0
+    2077:	50                   	push   %eax
+    2078:	e8 4c f5 ff ff       	call   15c9 <lseek>
+    207d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2080:	83 ec 08             	sub    $0x8,%esp
+    2083:	56                   	push   %esi
+    2084:	53                   	push   %ebx
+    2085:	e8 26 ff ff ff       	call   1fb0 <fdopen>
+    208a:	83 c4 10             	add    $0x10,%esp
+    208d:	85 c0                	test   %eax,%eax
+    208f:	75 11                	jne    20a2 <fopen+0x62>
+    close(fd);
+    2091:	83 ec 0c             	sub    $0xc,%esp
+    2094:	53                   	push   %ebx
+    2095:	e8 f4 f3 ff ff       	call   148e <close>
+    209a:	83 c4 10             	add    $0x10,%esp
+    209d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    20a0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    20a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    20a5:	5b                   	pop    %ebx
+    20a6:	5e                   	pop    %esi
+    20a7:	5d                   	pop    %ebp
+    20a8:	c3                   	ret
+    20a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    20b0:	83 ec 08             	sub    $0x8,%esp
+    20b3:	6a 00                	push   $0x0
+    20b5:	ff 75 08             	push   0x8(%ebp)
+    20b8:	e8 fe f3 ff ff       	call   14bb <open>
+    20bd:	83 c4 10             	add    $0x10,%esp
+    20c0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    20c2:	85 db                	test   %ebx,%ebx
+    20c4:	78 da                	js     20a0 <fopen+0x60>
+    20c6:	eb b8                	jmp    2080 <fopen+0x40>
+    20c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20cf:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    20d0:	83 ec 08             	sub    $0x8,%esp
+    20d3:	68 01 06 00 00       	push   $0x601
+    20d8:	ff 75 08             	push   0x8(%ebp)
+    20db:	e8 db f3 ff ff       	call   14bb <open>
+    20e0:	83 c4 10             	add    $0x10,%esp
+    20e3:	89 c3                	mov    %eax,%ebx
+    20e5:	eb db                	jmp    20c2 <fopen+0x82>
+    20e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ee:	66 90                	xchg   %ax,%ax
+
+000020f0 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    20f0:	55                   	push   %ebp
+    20f1:	89 e5                	mov    %esp,%ebp
+    20f3:	56                   	push   %esi
+    20f4:	53                   	push   %ebx
+    20f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    20f8:	83 ec 0c             	sub    $0xc,%esp
+    20fb:	53                   	push   %ebx
+    20fc:	e8 1f fa ff ff       	call   1b20 <fflush>
+    2101:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2103:	58                   	pop    %eax
+    2104:	ff 33                	push   (%ebx)
+    2106:	e8 83 f3 ff ff       	call   148e <close>
+    210b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    210e:	85 c0                	test   %eax,%eax
+    2110:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2115:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2118:	8b 43 18             	mov    0x18(%ebx),%eax
+    211b:	85 c0                	test   %eax,%eax
+    211d:	0f 95 c1             	setne  %cl
+    2120:	3d 00 33 00 00       	cmp    $0x3300,%eax
+    2125:	0f 95 c2             	setne  %dl
+    2128:	84 d1                	test   %dl,%cl
+    212a:	74 07                	je     2133 <fclose+0x43>
+    212c:	3d 00 2f 00 00       	cmp    $0x2f00,%eax
+    2131:	75 25                	jne    2158 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2133:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    213a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    213c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2143:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    214a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    214d:	5b                   	pop    %ebx
+    214e:	5e                   	pop    %esi
+    214f:	5d                   	pop    %ebp
+    2150:	c3                   	ret
+    2151:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2158:	83 ec 0c             	sub    $0xc,%esp
+    215b:	50                   	push   %eax
+    215c:	e8 3f 00 00 00       	call   21a0 <free>
+    2161:	83 c4 10             	add    $0x10,%esp
+    2164:	eb cd                	jmp    2133 <fclose+0x43>
+    2166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    216d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002170 <feof>:
+
+int
+feof(FILE *f)
+{
+    2170:	55                   	push   %ebp
+    2171:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2173:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2176:	5d                   	pop    %ebp
+  return f->eof;
+    2177:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    217a:	c3                   	ret
+    217b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    217f:	90                   	nop
+
+00002180 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2180:	55                   	push   %ebp
+    2181:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2183:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2186:	5d                   	pop    %ebp
+  return f->err;
+    2187:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    218a:	c3                   	ret
+    218b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    218f:	90                   	nop
+
+00002190 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2190:	55                   	push   %ebp
+    2191:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2193:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2196:	5d                   	pop    %ebp
+  return f->fd;
+    2197:	8b 00                	mov    (%eax),%eax
+}
+    2199:	c3                   	ret
+    219a:	66 90                	xchg   %ax,%ax
+    219c:	66 90                	xchg   %ax,%ax
+    219e:	66 90                	xchg   %ax,%ax
+
+000021a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    21a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    21a1:	a1 00 37 00 00       	mov    0x3700,%eax
+{
+    21a6:	89 e5                	mov    %esp,%ebp
+    21a8:	57                   	push   %edi
+    21a9:	56                   	push   %esi
+    21aa:	53                   	push   %ebx
+    21ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    21ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    21b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    21ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    21bc:	39 ca                	cmp    %ecx,%edx
+    21be:	73 30                	jae    21f0 <free+0x50>
+    21c0:	39 c1                	cmp    %eax,%ecx
+    21c2:	72 04                	jb     21c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    21c4:	39 c2                	cmp    %eax,%edx
+    21c6:	72 f0                	jb     21b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    21c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    21cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    21ce:	39 f8                	cmp    %edi,%eax
+    21d0:	74 2e                	je     2200 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    21d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    21d5:	8b 42 04             	mov    0x4(%edx),%eax
+    21d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    21db:	39 f1                	cmp    %esi,%ecx
+    21dd:	74 38                	je     2217 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    21df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    21e1:	5b                   	pop    %ebx
+  freep = p;
+    21e2:	89 15 00 37 00 00    	mov    %edx,0x3700
+}
+    21e8:	5e                   	pop    %esi
+    21e9:	5f                   	pop    %edi
+    21ea:	5d                   	pop    %ebp
+    21eb:	c3                   	ret
+    21ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    21f0:	39 c1                	cmp    %eax,%ecx
+    21f2:	72 d0                	jb     21c4 <free+0x24>
+    21f4:	eb c2                	jmp    21b8 <free+0x18>
+    21f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2200:	03 70 04             	add    0x4(%eax),%esi
+    2203:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2206:	8b 02                	mov    (%edx),%eax
+    2208:	8b 00                	mov    (%eax),%eax
+    220a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    220d:	8b 42 04             	mov    0x4(%edx),%eax
+    2210:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2213:	39 f1                	cmp    %esi,%ecx
+    2215:	75 c8                	jne    21df <free+0x3f>
+    p->s.size += bp->s.size;
+    2217:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    221a:	89 15 00 37 00 00    	mov    %edx,0x3700
+    p->s.size += bp->s.size;
+    2220:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2223:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2226:	89 0a                	mov    %ecx,(%edx)
+}
+    2228:	5b                   	pop    %ebx
+    2229:	5e                   	pop    %esi
+    222a:	5f                   	pop    %edi
+    222b:	5d                   	pop    %ebp
+    222c:	c3                   	ret
+    222d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002230 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2230:	55                   	push   %ebp
+    2231:	89 e5                	mov    %esp,%ebp
+    2233:	57                   	push   %edi
+    2234:	56                   	push   %esi
+    2235:	53                   	push   %ebx
+    2236:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2239:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    223c:	8b 15 00 37 00 00    	mov    0x3700,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2242:	8d 78 07             	lea    0x7(%eax),%edi
+    2245:	c1 ef 03             	shr    $0x3,%edi
+    2248:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    224b:	85 d2                	test   %edx,%edx
+    224d:	0f 84 8d 00 00 00    	je     22e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2253:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2255:	8b 48 04             	mov    0x4(%eax),%ecx
+    2258:	39 f9                	cmp    %edi,%ecx
+    225a:	73 64                	jae    22c0 <malloc+0x90>
+  if(nu < 4096)
+    225c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2261:	39 df                	cmp    %ebx,%edi
+    2263:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2266:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    226d:	eb 0a                	jmp    2279 <malloc+0x49>
+    226f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2270:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2272:	8b 48 04             	mov    0x4(%eax),%ecx
+    2275:	39 f9                	cmp    %edi,%ecx
+    2277:	73 47                	jae    22c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2279:	89 c2                	mov    %eax,%edx
+    227b:	39 05 00 37 00 00    	cmp    %eax,0x3700
+    2281:	75 ed                	jne    2270 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2283:	83 ec 0c             	sub    $0xc,%esp
+    2286:	56                   	push   %esi
+    2287:	e8 b6 f2 ff ff       	call   1542 <sbrk>
+  if(p == (char*)-1)
+    228c:	83 c4 10             	add    $0x10,%esp
+    228f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2292:	74 1c                	je     22b0 <malloc+0x80>
+  hp->s.size = nu;
+    2294:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2297:	83 ec 0c             	sub    $0xc,%esp
+    229a:	83 c0 08             	add    $0x8,%eax
+    229d:	50                   	push   %eax
+    229e:	e8 fd fe ff ff       	call   21a0 <free>
+  return freep;
+    22a3:	8b 15 00 37 00 00    	mov    0x3700,%edx
+      if((p = morecore(nunits)) == 0)
+    22a9:	83 c4 10             	add    $0x10,%esp
+    22ac:	85 d2                	test   %edx,%edx
+    22ae:	75 c0                	jne    2270 <malloc+0x40>
+        return 0;
+  }
+}
+    22b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    22b3:	31 c0                	xor    %eax,%eax
+}
+    22b5:	5b                   	pop    %ebx
+    22b6:	5e                   	pop    %esi
+    22b7:	5f                   	pop    %edi
+    22b8:	5d                   	pop    %ebp
+    22b9:	c3                   	ret
+    22ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    22c0:	39 cf                	cmp    %ecx,%edi
+    22c2:	74 4c                	je     2310 <malloc+0xe0>
+        p->s.size -= nunits;
+    22c4:	29 f9                	sub    %edi,%ecx
+    22c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    22c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    22cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    22cf:	89 15 00 37 00 00    	mov    %edx,0x3700
+}
+    22d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    22d8:	83 c0 08             	add    $0x8,%eax
+}
+    22db:	5b                   	pop    %ebx
+    22dc:	5e                   	pop    %esi
+    22dd:	5f                   	pop    %edi
+    22de:	5d                   	pop    %ebp
+    22df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    22e0:	c7 05 00 37 00 00 04 	movl   $0x3704,0x3700
+    22e7:	37 00 00 
+    base.s.size = 0;
+    22ea:	b8 04 37 00 00       	mov    $0x3704,%eax
+    base.s.ptr = freep = prevp = &base;
+    22ef:	c7 05 04 37 00 00 04 	movl   $0x3704,0x3704
+    22f6:	37 00 00 
+    base.s.size = 0;
+    22f9:	c7 05 08 37 00 00 00 	movl   $0x0,0x3708
+    2300:	00 00 00 
+    if(p->s.size >= nunits){
+    2303:	e9 54 ff ff ff       	jmp    225c <malloc+0x2c>
+    2308:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    230f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2310:	8b 08                	mov    (%eax),%ecx
+    2312:	89 0a                	mov    %ecx,(%edx)
+    2314:	eb b9                	jmp    22cf <malloc+0x9f>
@@ -0,0 +1,2851 @@
+
+_conbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+
+char buf[1024];
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	81 ec 28 01 00 00    	sub    $0x128,%esp
+    1017:	8b 19                	mov    (%ecx),%ebx
+    1019:	8b 71 04             	mov    0x4(%ecx),%esi
+  int kb, line, i, t, start;
+  uint total, want;
+  struct kstat before, after;
+
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+    101c:	83 fb 01             	cmp    $0x1,%ebx
+    101f:	0f 8f bd 00 00 00    	jg     10e2 <main+0xe2>
+  line = argc > 2 ? atoi(argv[2]) : 64;
+  if(kb <= 0 || line < 2 || line > sizeof(buf)){
+    1025:	c7 85 d4 fe ff ff 40 	movl   $0x40,-0x12c(%ebp)
+    102c:	00 00 00 
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+    102f:	ba 40 00 00 00       	mov    $0x40,%edx
+  line = argc > 2 ? atoi(argv[2]) : 64;
+    1034:	bb 40 00 00 00       	mov    $0x40,%ebx
+    printf(2, "usage: conbench [kb [line]]\n");
+    exit();
+  }
+  for(i = 0; i < line - 1; i++)
+    buf[i] = 'a' + i % 26;
+    1039:	89 95 d0 fe ff ff    	mov    %edx,-0x130(%ebp)
+  for(i = 0; i < line - 1; i++)
+    103f:	8d 73 ff             	lea    -0x1(%ebx),%esi
+    1042:	31 c9                	xor    %ecx,%ecx
+    buf[i] = 'a' + i % 26;
+    1044:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+    1049:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1050:	89 c8                	mov    %ecx,%eax
+    1052:	f7 e7                	mul    %edi
+    1054:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < line - 1; i++)
+    1056:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+    1059:	c1 ea 03             	shr    $0x3,%edx
+    105c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    105f:	29 d0                	sub    %edx,%eax
+    1061:	83 c0 61             	add    $0x61,%eax
+    1064:	88 81 1f 2e 00 00    	mov    %al,0x2e1f(%ecx)
+  for(i = 0; i < line - 1; i++)
+    106a:	39 ce                	cmp    %ecx,%esi
+    106c:	75 e2                	jne    1050 <main+0x50>
+  buf[line - 1] = '\n';
+  want = kb * 1024;
+
+  kstat(&before);
+    106e:	83 ec 0c             	sub    $0xc,%esp
+    1071:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+  buf[line - 1] = '\n';
+    1077:	8b 95 d0 fe ff ff    	mov    -0x130(%ebp),%edx
+  start = uptime();
+  for(total = 0; total < want; total += line)
+    107d:	31 ff                	xor    %edi,%edi
+  kstat(&before);
+    107f:	50                   	push   %eax
+  buf[line - 1] = '\n';
+    1080:	c6 86 20 2e 00 00 0a 	movb   $0xa,0x2e20(%esi)
+  want = kb * 1024;
+    1087:	89 d6                	mov    %edx,%esi
+    1089:	c1 e6 0a             	shl    $0xa,%esi
+  kstat(&before);
+    108c:	e8 dc 05 00 00       	call   166d <kstat>
+  start = uptime();
+    1091:	e8 aa 05 00 00       	call   1640 <uptime>
+    1096:	83 c4 10             	add    $0x10,%esp
+    1099:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+  for(total = 0; total < want; total += line)
+    109f:	eb 17                	jmp    10b8 <main+0xb8>
+    10a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10a8:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+    10ae:	01 c7                	add    %eax,%edi
+    10b0:	39 f7                	cmp    %esi,%edi
+    10b2:	0f 83 a0 00 00 00    	jae    1158 <main+0x158>
+    if(write(1, buf, line) != line){
+    10b8:	83 ec 04             	sub    $0x4,%esp
+    10bb:	53                   	push   %ebx
+    10bc:	68 20 2e 00 00       	push   $0x2e20
+    10c1:	6a 01                	push   $0x1
+    10c3:	e8 97 04 00 00       	call   155f <write>
+    10c8:	83 c4 10             	add    $0x10,%esp
+    10cb:	39 d8                	cmp    %ebx,%eax
+    10cd:	74 d9                	je     10a8 <main+0xa8>
+      printf(2, "conbench: write failed\n");
+    10cf:	51                   	push   %ecx
+    10d0:	51                   	push   %ecx
+    10d1:	68 15 24 00 00       	push   $0x2415
+    10d6:	6a 02                	push   $0x2
+    10d8:	e8 63 09 00 00       	call   1a40 <printf>
+      exit();
+    10dd:	e8 ee 03 00 00       	call   14d0 <exit>
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+    10e2:	83 ec 0c             	sub    $0xc,%esp
+    10e5:	ff 76 04             	push   0x4(%esi)
+    10e8:	e8 d3 02 00 00       	call   13c0 <atoi>
+  line = argc > 2 ? atoi(argv[2]) : 64;
+    10ed:	83 c4 10             	add    $0x10,%esp
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+    10f0:	89 c2                	mov    %eax,%edx
+  line = argc > 2 ? atoi(argv[2]) : 64;
+    10f2:	83 fb 02             	cmp    $0x2,%ebx
+    10f5:	75 17                	jne    110e <main+0x10e>
+  if(kb <= 0 || line < 2 || line > sizeof(buf)){
+    10f7:	85 c0                	test   %eax,%eax
+    10f9:	7f 49                	jg     1144 <main+0x144>
+    printf(2, "usage: conbench [kb [line]]\n");
+    10fb:	53                   	push   %ebx
+    10fc:	53                   	push   %ebx
+    10fd:	68 f8 23 00 00       	push   $0x23f8
+    1102:	6a 02                	push   $0x2
+    1104:	e8 37 09 00 00       	call   1a40 <printf>
+    exit();
+    1109:	e8 c2 03 00 00       	call   14d0 <exit>
+  line = argc > 2 ? atoi(argv[2]) : 64;
+    110e:	83 ec 0c             	sub    $0xc,%esp
+    1111:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+    1117:	ff 76 08             	push   0x8(%esi)
+    111a:	e8 a1 02 00 00       	call   13c0 <atoi>
+  if(kb <= 0 || line < 2 || line > sizeof(buf)){
+    111f:	83 c4 10             	add    $0x10,%esp
+    1122:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  line = argc > 2 ? atoi(argv[2]) : 64;
+    1128:	89 c3                	mov    %eax,%ebx
+  if(kb <= 0 || line < 2 || line > sizeof(buf)){
+    112a:	8d 40 fe             	lea    -0x2(%eax),%eax
+    112d:	3d fe 03 00 00       	cmp    $0x3fe,%eax
+    1132:	77 c7                	ja     10fb <main+0xfb>
+    1134:	8b 95 d0 fe ff ff    	mov    -0x130(%ebp),%edx
+    113a:	85 d2                	test   %edx,%edx
+    113c:	0f 8f f7 fe ff ff    	jg     1039 <main+0x39>
+    1142:	eb b7                	jmp    10fb <main+0xfb>
+    1144:	c7 85 d4 fe ff ff 40 	movl   $0x40,-0x12c(%ebp)
+    114b:	00 00 00 
+    114e:	bb 40 00 00 00       	mov    $0x40,%ebx
+    1153:	e9 e1 fe ff ff       	jmp    1039 <main+0x39>
+    }
+  t = uptime() - start;
+    1158:	e8 e3 04 00 00       	call   1640 <uptime>
+    115d:	8b b5 d0 fe ff ff    	mov    -0x130(%ebp),%esi
+  kstat(&after);
+    1163:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - start;
+    1166:	29 f0                	sub    %esi,%eax
+    1168:	89 c6                	mov    %eax,%esi
+  kstat(&after);
+    116a:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    1170:	50                   	push   %eax
+    1171:	e8 f7 04 00 00       	call   166d <kstat>
+
+  printf(1, "conbench: %d bytes in %d-byte writes in %d ticks", total, line, t);
+    1176:	89 34 24             	mov    %esi,(%esp)
+    1179:	53                   	push   %ebx
+    117a:	57                   	push   %edi
+    117b:	68 3c 24 00 00       	push   $0x243c
+    1180:	6a 01                	push   $0x1
+    1182:	e8 b9 08 00 00       	call   1a40 <printf>
+  if(t > 0)
+    1187:	83 c4 20             	add    $0x20,%esp
+    118a:	85 f6                	test   %esi,%esi
+    118c:	7e 18                	jle    11a6 <main+0x1a6>
+    printf(1, ", %d bytes/s", total*100/t);
+    118e:	6b c7 64             	imul   $0x64,%edi,%eax
+    1191:	52                   	push   %edx
+    1192:	31 d2                	xor    %edx,%edx
+    1194:	f7 f6                	div    %esi
+    1196:	50                   	push   %eax
+    1197:	68 2d 24 00 00       	push   $0x242d
+    119c:	6a 01                	push   $0x1
+    119e:	e8 9d 08 00 00       	call   1a40 <printf>
+    11a3:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n");
+    11a6:	50                   	push   %eax
+    11a7:	50                   	push   %eax
+    11a8:	68 13 24 00 00       	push   $0x2413
+    11ad:	6a 01                	push   $0x1
+    11af:	e8 8c 08 00 00       	call   1a40 <printf>
+  printf(1, "conbench: uart sent %d, %d polled, %d writes waited for room\n",
+    11b4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    11b7:	2b 85 58 ff ff ff    	sub    -0xa8(%ebp),%eax
+    11bd:	89 04 24             	mov    %eax,(%esp)
+    11c0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    11c3:	2b 85 54 ff ff ff    	sub    -0xac(%ebp),%eax
+    11c9:	50                   	push   %eax
+    11ca:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    11cd:	2b 85 50 ff ff ff    	sub    -0xb0(%ebp),%eax
+    11d3:	50                   	push   %eax
+    11d4:	68 70 24 00 00       	push   $0x2470
+    11d9:	6a 01                	push   $0x1
+    11db:	e8 60 08 00 00       	call   1a40 <printf>
+    after.uart_tx - before.uart_tx,
+    after.uart_txpolled - before.uart_txpolled,
+    after.uart_txwaits - before.uart_txwaits);
+  exit();
+    11e0:	83 c4 20             	add    $0x20,%esp
+    11e3:	e8 e8 02 00 00       	call   14d0 <exit>
+    11e8:	66 90                	xchg   %ax,%ax
+    11ea:	66 90                	xchg   %ax,%ax
+    11ec:	66 90                	xchg   %ax,%ax
+    11ee:	66 90                	xchg   %ax,%ax
+
+000011f0 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    11f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11f1:	31 c0                	xor    %eax,%eax
+{
+    11f3:	89 e5                	mov    %esp,%ebp
+    11f5:	53                   	push   %ebx
+    11f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1207:	83 c0 01             	add    $0x1,%eax
+    120a:	84 d2                	test   %dl,%dl
+    120c:	75 f2                	jne    1200 <strcpy+0x10>
+    ;
+  return os;
+}
+    120e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1211:	89 c8                	mov    %ecx,%eax
+    1213:	c9                   	leave
+    1214:	c3                   	ret
+    1215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	53                   	push   %ebx
+    1224:	8b 55 08             	mov    0x8(%ebp),%edx
+    1227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    122a:	0f b6 02             	movzbl (%edx),%eax
+    122d:	84 c0                	test   %al,%al
+    122f:	75 17                	jne    1248 <strcmp+0x28>
+    1231:	eb 3a                	jmp    126d <strcmp+0x4d>
+    1233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1237:	90                   	nop
+    1238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    123c:	83 c2 01             	add    $0x1,%edx
+    123f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1242:	84 c0                	test   %al,%al
+    1244:	74 1a                	je     1260 <strcmp+0x40>
+    p++, q++;
+    1246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1248:	0f b6 19             	movzbl (%ecx),%ebx
+    124b:	38 c3                	cmp    %al,%bl
+    124d:	74 e9                	je     1238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    124f:	29 d8                	sub    %ebx,%eax
+}
+    1251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1254:	c9                   	leave
+    1255:	c3                   	ret
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1264:	31 c0                	xor    %eax,%eax
+    1266:	29 d8                	sub    %ebx,%eax
+}
+    1268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    126b:	c9                   	leave
+    126c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    126d:	0f b6 19             	movzbl (%ecx),%ebx
+    1270:	31 c0                	xor    %eax,%eax
+    1272:	eb db                	jmp    124f <strcmp+0x2f>
+    1274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    127b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    127f:	90                   	nop
+
+00001280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1286:	80 3a 00             	cmpb   $0x0,(%edx)
+    1289:	74 15                	je     12a0 <strlen+0x20>
+    128b:	31 c0                	xor    %eax,%eax
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+    1290:	83 c0 01             	add    $0x1,%eax
+    1293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1297:	89 c1                	mov    %eax,%ecx
+    1299:	75 f5                	jne    1290 <strlen+0x10>
+    ;
+  return n;
+}
+    129b:	89 c8                	mov    %ecx,%eax
+    129d:	5d                   	pop    %ebp
+    129e:	c3                   	ret
+    129f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    12a0:	31 c9                	xor    %ecx,%ecx
+}
+    12a2:	5d                   	pop    %ebp
+    12a3:	89 c8                	mov    %ecx,%eax
+    12a5:	c3                   	ret
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	57                   	push   %edi
+    12b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    12b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    12ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12bd:	89 d7                	mov    %edx,%edi
+    12bf:	fc                   	cld
+    12c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    12c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    12c5:	89 d0                	mov    %edx,%eax
+    12c7:	c9                   	leave
+    12c8:	c3                   	ret
+    12c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    12da:	0f b6 10             	movzbl (%eax),%edx
+    12dd:	84 d2                	test   %dl,%dl
+    12df:	75 12                	jne    12f3 <strchr+0x23>
+    12e1:	eb 1d                	jmp    1300 <strchr+0x30>
+    12e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12e7:	90                   	nop
+    12e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    12ec:	83 c0 01             	add    $0x1,%eax
+    12ef:	84 d2                	test   %dl,%dl
+    12f1:	74 0d                	je     1300 <strchr+0x30>
+    if(*s == c)
+    12f3:	38 d1                	cmp    %dl,%cl
+    12f5:	75 f1                	jne    12e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    12f7:	5d                   	pop    %ebp
+    12f8:	c3                   	ret
+    12f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1300:	31 c0                	xor    %eax,%eax
+}
+    1302:	5d                   	pop    %ebp
+    1303:	c3                   	ret
+    1304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    130f:	90                   	nop
+
+00001310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	57                   	push   %edi
+    1314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1319:	31 db                	xor    %ebx,%ebx
+{
+    131b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    131e:	eb 27                	jmp    1347 <gets+0x37>
+    cc = read(0, &c, 1);
+    1320:	83 ec 04             	sub    $0x4,%esp
+    1323:	6a 01                	push   $0x1
+    1325:	56                   	push   %esi
+    1326:	6a 00                	push   $0x0
+    1328:	e8 23 02 00 00       	call   1550 <read>
+    if(cc < 1)
+    132d:	83 c4 10             	add    $0x10,%esp
+    1330:	85 c0                	test   %eax,%eax
+    1332:	7e 1d                	jle    1351 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1338:	8b 55 08             	mov    0x8(%ebp),%edx
+    133b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    133f:	3c 0a                	cmp    $0xa,%al
+    1341:	74 10                	je     1353 <gets+0x43>
+    1343:	3c 0d                	cmp    $0xd,%al
+    1345:	74 0c                	je     1353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1347:	89 df                	mov    %ebx,%edi
+    1349:	83 c3 01             	add    $0x1,%ebx
+    134c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    134f:	7c cf                	jl     1320 <gets+0x10>
+    1351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1353:	8b 45 08             	mov    0x8(%ebp),%eax
+    1356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    135a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    135d:	5b                   	pop    %ebx
+    135e:	5e                   	pop    %esi
+    135f:	5f                   	pop    %edi
+    1360:	5d                   	pop    %ebp
+    1361:	c3                   	ret
+    1362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001370 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	56                   	push   %esi
+    1374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1375:	83 ec 08             	sub    $0x8,%esp
+    1378:	6a 00                	push   $0x0
+    137a:	ff 75 08             	push   0x8(%ebp)
+    137d:	e8 19 02 00 00       	call   159b <open>
+  if(fd < 0)
+    1382:	83 c4 10             	add    $0x10,%esp
+    1385:	85 c0                	test   %eax,%eax
+    1387:	78 27                	js     13b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1389:	83 ec 08             	sub    $0x8,%esp
+    138c:	ff 75 0c             	push   0xc(%ebp)
+    138f:	89 c3                	mov    %eax,%ebx
+    1391:	50                   	push   %eax
+    1392:	e8 31 02 00 00       	call   15c8 <fstat>
+  close(fd);
+    1397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    139a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    139c:	e8 cd 01 00 00       	call   156e <close>
+  return r;
+    13a1:	83 c4 10             	add    $0x10,%esp
+}
+    13a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13a7:	89 f0                	mov    %esi,%eax
+    13a9:	5b                   	pop    %ebx
+    13aa:	5e                   	pop    %esi
+    13ab:	5d                   	pop    %ebp
+    13ac:	c3                   	ret
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    13b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13b5:	eb ed                	jmp    13a4 <stat+0x34>
+    13b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13be:	66 90                	xchg   %ax,%ax
+
+000013c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	53                   	push   %ebx
+    13c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    13c7:	0f be 02             	movsbl (%edx),%eax
+    13ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    13cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    13d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    13d5:	77 1e                	ja     13f5 <atoi+0x35>
+    13d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    13e0:	83 c2 01             	add    $0x1,%edx
+    13e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    13e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    13ea:	0f be 02             	movsbl (%edx),%eax
+    13ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    13f0:	80 fb 09             	cmp    $0x9,%bl
+    13f3:	76 eb                	jbe    13e0 <atoi+0x20>
+  return n;
+}
+    13f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13f8:	89 c8                	mov    %ecx,%eax
+    13fa:	c9                   	leave
+    13fb:	c3                   	ret
+    13fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	56                   	push   %esi
+    1405:	8b 45 10             	mov    0x10(%ebp),%eax
+    1408:	8b 55 08             	mov    0x8(%ebp),%edx
+    140b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    140e:	85 c0                	test   %eax,%eax
+    1410:	7e 13                	jle    1425 <memmove+0x25>
+    1412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1414:	89 d7                	mov    %edx,%edi
+    1416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1421:	39 f8                	cmp    %edi,%eax
+    1423:	75 fb                	jne    1420 <memmove+0x20>
+  return vdst;
+}
+    1425:	5e                   	pop    %esi
+    1426:	89 d0                	mov    %edx,%eax
+    1428:	5f                   	pop    %edi
+    1429:	5d                   	pop    %ebp
+    142a:	c3                   	ret
+    142b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+
+00001430 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1430:	55                   	push   %ebp
+    1431:	89 e5                	mov    %esp,%ebp
+    1433:	56                   	push   %esi
+    1434:	53                   	push   %ebx
+    1435:	8b 75 10             	mov    0x10(%ebp),%esi
+    1438:	8b 55 08             	mov    0x8(%ebp),%edx
+    143b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    143e:	85 f6                	test   %esi,%esi
+    1440:	74 2e                	je     1470 <memcmp+0x40>
+    1442:	01 c6                	add    %eax,%esi
+    1444:	eb 14                	jmp    145a <memcmp+0x2a>
+    1446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1450:	83 c0 01             	add    $0x1,%eax
+    1453:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1456:	39 f0                	cmp    %esi,%eax
+    1458:	74 16                	je     1470 <memcmp+0x40>
+    if(*s1 != *s2)
+    145a:	0f b6 0a             	movzbl (%edx),%ecx
+    145d:	0f b6 18             	movzbl (%eax),%ebx
+    1460:	38 d9                	cmp    %bl,%cl
+    1462:	74 ec                	je     1450 <memcmp+0x20>
+      return *s1 - *s2;
+    1464:	0f b6 c1             	movzbl %cl,%eax
+    1467:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1469:	5b                   	pop    %ebx
+    146a:	5e                   	pop    %esi
+    146b:	5d                   	pop    %ebp
+    146c:	c3                   	ret
+    146d:	8d 76 00             	lea    0x0(%esi),%esi
+    1470:	5b                   	pop    %ebx
+  return 0;
+    1471:	31 c0                	xor    %eax,%eax
+}
+    1473:	5e                   	pop    %esi
+    1474:	5d                   	pop    %ebp
+    1475:	c3                   	ret
+    1476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001480 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1480:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1485:	c3                   	ret
+    1486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001490 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1490:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1495:	c3                   	ret
+    1496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    149d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014a0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    14a0:	a1 20 32 00 00       	mov    0x3220,%eax
+    14a5:	85 c0                	test   %eax,%eax
+    14a7:	74 17                	je     14c0 <fork+0x20>
+{
+    14a9:	55                   	push   %ebp
+    14aa:	89 e5                	mov    %esp,%ebp
+    14ac:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    14af:	ff d0                	call   *%eax
+  return _fork();
+}
+    14b1:	c9                   	leave
+  return _fork();
+    14b2:	e9 5d 00 00 00       	jmp    1514 <_fork>
+    14b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14be:	66 90                	xchg   %ax,%ax
+    14c0:	e9 4f 00 00 00       	jmp    1514 <_fork>
+    14c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014d0 <exit>:
+
+int
+exit(void)
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 e5                	mov    %esp,%ebp
+    14d3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    14d6:	a1 20 32 00 00       	mov    0x3220,%eax
+    14db:	85 c0                	test   %eax,%eax
+    14dd:	74 02                	je     14e1 <exit+0x11>
+    flushhook();
+    14df:	ff d0                	call   *%eax
+  _exit();
+    14e1:	e8 3d 00 00 00       	call   1523 <_exit>
+    14e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014f0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    14f0:	55                   	push   %ebp
+  if(flushhook)
+    14f1:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+    14f6:	89 e5                	mov    %esp,%ebp
+    14f8:	56                   	push   %esi
+    14f9:	53                   	push   %ebx
+    14fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    14fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1500:	85 c0                	test   %eax,%eax
+    1502:	74 02                	je     1506 <exec+0x16>
+    flushhook();
+    1504:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1506:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1509:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    150c:	5b                   	pop    %ebx
+    150d:	5e                   	pop    %esi
+    150e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    150f:	e9 78 00 00 00       	jmp    158c <_exec>
+
+00001514 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1514:	b8 01 00 00 00       	mov    $0x1,%eax
+    1519:	89 e1                	mov    %esp,%ecx
+    151b:	ba 22 15 00 00       	mov    $0x1522,%edx
+    1520:	0f 34                	sysenter
+    1522:	c3                   	ret
+
+00001523 <_exit>:
+RAWSYSCALL(exit)
+    1523:	b8 02 00 00 00       	mov    $0x2,%eax
+    1528:	89 e1                	mov    %esp,%ecx
+    152a:	ba 31 15 00 00       	mov    $0x1531,%edx
+    152f:	0f 34                	sysenter
+    1531:	c3                   	ret
+
+00001532 <wait>:
+SYSCALL(wait)
+    1532:	b8 03 00 00 00       	mov    $0x3,%eax
+    1537:	89 e1                	mov    %esp,%ecx
+    1539:	ba 40 15 00 00       	mov    $0x1540,%edx
+    153e:	0f 34                	sysenter
+    1540:	c3                   	ret
+
+00001541 <pipe>:
+SYSCALL(pipe)
+    1541:	b8 04 00 00 00       	mov    $0x4,%eax
+    1546:	89 e1                	mov    %esp,%ecx
+    1548:	ba 4f 15 00 00       	mov    $0x154f,%edx
+    154d:	0f 34                	sysenter
+    154f:	c3                   	ret
+
+00001550 <read>:
+SYSCALL(read)
+    1550:	b8 05 00 00 00       	mov    $0x5,%eax
+    1555:	89 e1                	mov    %esp,%ecx
+    1557:	ba 5e 15 00 00       	mov    $0x155e,%edx
+    155c:	0f 34                	sysenter
+    155e:	c3                   	ret
+
+0000155f <write>:
+SYSCALL(write)
+    155f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1564:	89 e1                	mov    %esp,%ecx
+    1566:	ba 6d 15 00 00       	mov    $0x156d,%edx
+    156b:	0f 34                	sysenter
+    156d:	c3                   	ret
+
+0000156e <close>:
+SYSCALL(close)
+    156e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1573:	89 e1                	mov    %esp,%ecx
+    1575:	ba 7c 15 00 00       	mov    $0x157c,%edx
+    157a:	0f 34                	sysenter
+    157c:	c3                   	ret
+
+0000157d <kill>:
+SYSCALL(kill)
+    157d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1582:	89 e1                	mov    %esp,%ecx
+    1584:	ba 8b 15 00 00       	mov    $0x158b,%edx
+    1589:	0f 34                	sysenter
+    158b:	c3                   	ret
+
+0000158c <_exec>:
+RAWSYSCALL(exec)
+    158c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1591:	89 e1                	mov    %esp,%ecx
+    1593:	ba 9a 15 00 00       	mov    $0x159a,%edx
+    1598:	0f 34                	sysenter
+    159a:	c3                   	ret
+
+0000159b <open>:
+SYSCALL(open)
+    159b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    15a0:	89 e1                	mov    %esp,%ecx
+    15a2:	ba a9 15 00 00       	mov    $0x15a9,%edx
+    15a7:	0f 34                	sysenter
+    15a9:	c3                   	ret
+
+000015aa <mknod>:
+SYSCALL(mknod)
+    15aa:	b8 11 00 00 00       	mov    $0x11,%eax
+    15af:	89 e1                	mov    %esp,%ecx
+    15b1:	ba b8 15 00 00       	mov    $0x15b8,%edx
+    15b6:	0f 34                	sysenter
+    15b8:	c3                   	ret
+
+000015b9 <unlink>:
+SYSCALL(unlink)
+    15b9:	b8 12 00 00 00       	mov    $0x12,%eax
+    15be:	89 e1                	mov    %esp,%ecx
+    15c0:	ba c7 15 00 00       	mov    $0x15c7,%edx
+    15c5:	0f 34                	sysenter
+    15c7:	c3                   	ret
+
+000015c8 <fstat>:
+SYSCALL(fstat)
+    15c8:	b8 08 00 00 00       	mov    $0x8,%eax
+    15cd:	89 e1                	mov    %esp,%ecx
+    15cf:	ba d6 15 00 00       	mov    $0x15d6,%edx
+    15d4:	0f 34                	sysenter
+    15d6:	c3                   	ret
+
+000015d7 <link>:
+SYSCALL(link)
+    15d7:	b8 13 00 00 00       	mov    $0x13,%eax
+    15dc:	89 e1                	mov    %esp,%ecx
+    15de:	ba e5 15 00 00       	mov    $0x15e5,%edx
+    15e3:	0f 34                	sysenter
+    15e5:	c3                   	ret
+
+000015e6 <mkdir>:
+SYSCALL(mkdir)
+    15e6:	b8 14 00 00 00       	mov    $0x14,%eax
+    15eb:	89 e1                	mov    %esp,%ecx
+    15ed:	ba f4 15 00 00       	mov    $0x15f4,%edx
+    15f2:	0f 34                	sysenter
+    15f4:	c3                   	ret
+
+000015f5 <chdir>:
+SYSCALL(chdir)
+    15f5:	b8 09 00 00 00       	mov    $0x9,%eax
+    15fa:	89 e1                	mov    %esp,%ecx
+    15fc:	ba 03 16 00 00       	mov    $0x1603,%edx
+    1601:	0f 34                	sysenter
+    1603:	c3                   	ret
+
+00001604 <dup>:
+SYSCALL(dup)
+    1604:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1609:	89 e1                	mov    %esp,%ecx
+    160b:	ba 12 16 00 00       	mov    $0x1612,%edx
+    1610:	0f 34                	sysenter
+    1612:	c3                   	ret
+
+00001613 <getpid>:
+SYSCALL(getpid)
+    1613:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1618:	89 e1                	mov    %esp,%ecx
+    161a:	ba 21 16 00 00       	mov    $0x1621,%edx
+    161f:	0f 34                	sysenter
+    1621:	c3                   	ret
+
+00001622 <sbrk>:
+SYSCALL(sbrk)
+    1622:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1627:	89 e1                	mov    %esp,%ecx
+    1629:	ba 30 16 00 00       	mov    $0x1630,%edx
+    162e:	0f 34                	sysenter
+    1630:	c3                   	ret
+
+00001631 <sleep>:
+SYSCALL(sleep)
+    1631:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1636:	89 e1                	mov    %esp,%ecx
+    1638:	ba 3f 16 00 00       	mov    $0x163f,%edx
+    163d:	0f 34                	sysenter
+    163f:	c3                   	ret
+
+00001640 <uptime>:
+SYSCALL(uptime)
+    1640:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1645:	89 e1                	mov    %esp,%ecx
+    1647:	ba 4e 16 00 00       	mov    $0x164e,%edx
+    164c:	0f 34                	sysenter
+    164e:	c3                   	ret
+
+0000164f <mprotect>:
+SYSCALL(mprotect)
+    164f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1654:	89 e1                	mov    %esp,%ecx
+    1656:	ba 5d 16 00 00       	mov    $0x165d,%edx
+    165b:	0f 34                	sysenter
+    165d:	c3                   	ret
+
+0000165e <munprotect>:
+SYSCALL(munprotect)
+    165e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1663:	89 e1                	mov    %esp,%ecx
+    1665:	ba 6c 16 00 00       	mov    $0x166c,%edx
+    166a:	0f 34                	sysenter
+    166c:	c3                   	ret
+
+0000166d <kstat>:
+SYSCALL(kstat)
+    166d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1672:	89 e1                	mov    %esp,%ecx
+    1674:	ba 7b 16 00 00       	mov    $0x167b,%edx
+    1679:	0f 34                	sysenter
+    167b:	c3                   	ret
+
+0000167c <fcntl>:
+SYSCALL(fcntl)
+    167c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1681:	89 e1                	mov    %esp,%ecx
+    1683:	ba 8a 16 00 00       	mov    $0x168a,%edx
+    1688:	0f 34                	sysenter
+    168a:	c3                   	ret
+
+0000168b <splice>:
+SYSCALL(splice)
+    168b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1690:	89 e1                	mov    %esp,%ecx
+    1692:	ba 99 16 00 00       	mov    $0x1699,%edx
+    1697:	0f 34                	sysenter
+    1699:	c3                   	ret
+
+0000169a <sendfile>:
+SYSCALL(sendfile)
+    169a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    169f:	89 e1                	mov    %esp,%ecx
+    16a1:	ba a8 16 00 00       	mov    $0x16a8,%edx
+    16a6:	0f 34                	sysenter
+    16a8:	c3                   	ret
+
+000016a9 <lseek>:
+SYSCALL(lseek)
+    16a9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    16ae:	89 e1                	mov    %esp,%ecx
+    16b0:	ba b7 16 00 00       	mov    $0x16b7,%edx
+    16b5:	0f 34                	sysenter
+    16b7:	c3                   	ret
+
+000016b8 <pread>:
+SYSCALL(pread)
+    16b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    16bd:	89 e1                	mov    %esp,%ecx
+    16bf:	ba c6 16 00 00       	mov    $0x16c6,%edx
+    16c4:	0f 34                	sysenter
+    16c6:	c3                   	ret
+
+000016c7 <pwrite>:
+SYSCALL(pwrite)
+    16c7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    16cc:	89 e1                	mov    %esp,%ecx
+    16ce:	ba d5 16 00 00       	mov    $0x16d5,%edx
+    16d3:	0f 34                	sysenter
+    16d5:	c3                   	ret
+
+000016d6 <readv>:
+SYSCALL(readv)
+    16d6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    16db:	89 e1                	mov    %esp,%ecx
+    16dd:	ba e4 16 00 00       	mov    $0x16e4,%edx
+    16e2:	0f 34                	sysenter
+    16e4:	c3                   	ret
+
+000016e5 <writev>:
+SYSCALL(writev)
+    16e5:	b8 20 00 00 00       	mov    $0x20,%eax
+    16ea:	89 e1                	mov    %esp,%ecx
+    16ec:	ba f3 16 00 00       	mov    $0x16f3,%edx
+    16f1:	0f 34                	sysenter
+    16f3:	c3                   	ret
+
+000016f4 <ringsetup>:
+SYSCALL(ringsetup)
+    16f4:	b8 21 00 00 00       	mov    $0x21,%eax
+    16f9:	89 e1                	mov    %esp,%ecx
+    16fb:	ba 02 17 00 00       	mov    $0x1702,%edx
+    1700:	0f 34                	sysenter
+    1702:	c3                   	ret
+
+00001703 <ringenter>:
+SYSCALL(ringenter)
+    1703:	b8 22 00 00 00       	mov    $0x22,%eax
+    1708:	89 e1                	mov    %esp,%ecx
+    170a:	ba 11 17 00 00       	mov    $0x1711,%edx
+    170f:	0f 34                	sysenter
+    1711:	c3                   	ret
+
+00001712 <intgetpid>:
+INTSYSCALL(getpid)
+    1712:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1717:	cd 40                	int    $0x40
+    1719:	c3                   	ret
+    171a:	66 90                	xchg   %ax,%ax
+    171c:	66 90                	xchg   %ax,%ax
+    171e:	66 90                	xchg   %ax,%ax
+
+00001720 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1720:	55                   	push   %ebp
+    1721:	89 e5                	mov    %esp,%ebp
+    1723:	57                   	push   %edi
+    1724:	56                   	push   %esi
+    1725:	53                   	push   %ebx
+    1726:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1728:	89 d1                	mov    %edx,%ecx
+{
+    172a:	83 ec 2c             	sub    $0x2c,%esp
+    172d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1730:	85 d2                	test   %edx,%edx
+    1732:	0f 89 c0 00 00 00    	jns    17f8 <printint+0xd8>
+    1738:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    173c:	0f 84 b6 00 00 00    	je     17f8 <printint+0xd8>
+    x = -xx;
+    1742:	f7 d9                	neg    %ecx
+    neg = 1;
+    1744:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1749:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    174c:	31 f6                	xor    %esi,%esi
+    174e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1750:	89 c8                	mov    %ecx,%eax
+    1752:	31 d2                	xor    %edx,%edx
+    1754:	89 f7                	mov    %esi,%edi
+    1756:	f7 f3                	div    %ebx
+    1758:	8d 76 01             	lea    0x1(%esi),%esi
+    175b:	0f b6 92 10 25 00 00 	movzbl 0x2510(%edx),%edx
+    1762:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1766:	89 ca                	mov    %ecx,%edx
+    1768:	89 c1                	mov    %eax,%ecx
+    176a:	39 da                	cmp    %ebx,%edx
+    176c:	73 e2                	jae    1750 <printint+0x30>
+  if(neg)
+    176e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1771:	85 c0                	test   %eax,%eax
+    1773:	74 07                	je     177c <printint+0x5c>
+    buf[i++] = '-';
+    1775:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    177a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    177c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    177f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1782:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1784:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1787:	8b 41 08             	mov    0x8(%ecx),%eax
+    178a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    178d:	89 ce                	mov    %ecx,%esi
+    178f:	eb 1c                	jmp    17ad <printint+0x8d>
+    1791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1798:	89 c1                	mov    %eax,%ecx
+    179a:	83 c0 01             	add    $0x1,%eax
+    179d:	89 46 08             	mov    %eax,0x8(%esi)
+    17a0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    17a4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    17a7:	39 df                	cmp    %ebx,%edi
+    17a9:	74 41                	je     17ec <printint+0xcc>
+    17ab:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    17ad:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    17b0:	3d 80 00 00 00       	cmp    $0x80,%eax
+    17b5:	75 e1                	jne    1798 <printint+0x78>
+  if(o->f)
+    17b7:	8b 06                	mov    (%esi),%eax
+    17b9:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    17bc:	85 c0                	test   %eax,%eax
+    17be:	74 40                	je     1800 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    17c0:	50                   	push   %eax
+    17c1:	68 80 00 00 00       	push   $0x80
+    17c6:	6a 01                	push   $0x1
+    17c8:	ff 75 d4             	push   -0x2c(%ebp)
+    17cb:	e8 a0 04 00 00       	call   1c70 <fwrite>
+    17d0:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    17d4:	83 c4 10             	add    $0x10,%esp
+}
+    17d7:	b8 01 00 00 00       	mov    $0x1,%eax
+    17dc:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    17de:	89 46 08             	mov    %eax,0x8(%esi)
+    17e1:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    17e5:	8d 57 ff             	lea    -0x1(%edi),%edx
+    17e8:	39 df                	cmp    %ebx,%edi
+    17ea:	75 bf                	jne    17ab <printint+0x8b>
+}
+    17ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17ef:	5b                   	pop    %ebx
+    17f0:	5e                   	pop    %esi
+    17f1:	5f                   	pop    %edi
+    17f2:	5d                   	pop    %ebp
+    17f3:	c3                   	ret
+    17f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    17f8:	31 c0                	xor    %eax,%eax
+    17fa:	e9 4a ff ff ff       	jmp    1749 <printint+0x29>
+    17ff:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1800:	83 ec 04             	sub    $0x4,%esp
+    1803:	68 80 00 00 00       	push   $0x80
+    1808:	ff 75 d4             	push   -0x2c(%ebp)
+    180b:	ff 76 04             	push   0x4(%esi)
+    180e:	e8 4c fd ff ff       	call   155f <write>
+    1813:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1817:	83 c4 10             	add    $0x10,%esp
+    181a:	eb bb                	jmp    17d7 <printint+0xb7>
+    181c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001820 <putc>:
+{
+    1820:	55                   	push   %ebp
+    1821:	89 e5                	mov    %esp,%ebp
+    1823:	56                   	push   %esi
+    1824:	89 d6                	mov    %edx,%esi
+    1826:	53                   	push   %ebx
+    1827:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1829:	8b 40 08             	mov    0x8(%eax),%eax
+    182c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1831:	74 1d                	je     1850 <putc+0x30>
+  o->buf[o->n++] = c;
+    1833:	89 f1                	mov    %esi,%ecx
+    1835:	8d 50 01             	lea    0x1(%eax),%edx
+    1838:	89 53 08             	mov    %edx,0x8(%ebx)
+    183b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    183f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1842:	5b                   	pop    %ebx
+    1843:	5e                   	pop    %esi
+    1844:	5d                   	pop    %ebp
+    1845:	c3                   	ret
+    1846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1850:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1852:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1855:	85 c0                	test   %eax,%eax
+    1857:	74 2f                	je     1888 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1859:	50                   	push   %eax
+    185a:	68 80 00 00 00       	push   $0x80
+    185f:	6a 01                	push   $0x1
+    1861:	52                   	push   %edx
+    1862:	e8 09 04 00 00       	call   1c70 <fwrite>
+    1867:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    186a:	89 f1                	mov    %esi,%ecx
+}
+    186c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1871:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1873:	89 53 08             	mov    %edx,0x8(%ebx)
+    1876:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    187a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    187d:	5b                   	pop    %ebx
+    187e:	5e                   	pop    %esi
+    187f:	5d                   	pop    %ebp
+    1880:	c3                   	ret
+    1881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1888:	83 ec 04             	sub    $0x4,%esp
+    188b:	68 80 00 00 00       	push   $0x80
+    1890:	52                   	push   %edx
+    1891:	ff 73 04             	push   0x4(%ebx)
+    1894:	e8 c6 fc ff ff       	call   155f <write>
+    1899:	83 c4 10             	add    $0x10,%esp
+    189c:	eb cc                	jmp    186a <putc+0x4a>
+    189e:	66 90                	xchg   %ax,%ax
+
+000018a0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    18a0:	55                   	push   %ebp
+    18a1:	89 e5                	mov    %esp,%ebp
+    18a3:	57                   	push   %edi
+    18a4:	89 c7                	mov    %eax,%edi
+    18a6:	56                   	push   %esi
+    18a7:	31 f6                	xor    %esi,%esi
+    18a9:	53                   	push   %ebx
+    18aa:	8d 5a 01             	lea    0x1(%edx),%ebx
+    18ad:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    18b0:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    18b3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    18b6:	84 c0                	test   %al,%al
+    18b8:	75 1e                	jne    18d8 <vprintf.constprop.0+0x38>
+    18ba:	eb 53                	jmp    190f <vprintf.constprop.0+0x6f>
+    18bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    18c0:	83 f8 25             	cmp    $0x25,%eax
+    18c3:	74 3b                	je     1900 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    18c5:	89 ca                	mov    %ecx,%edx
+    18c7:	89 f8                	mov    %edi,%eax
+    18c9:	e8 52 ff ff ff       	call   1820 <putc>
+  for(i = 0; fmt[i]; i++){
+    18ce:	0f b6 03             	movzbl (%ebx),%eax
+    18d1:	83 c3 01             	add    $0x1,%ebx
+    18d4:	84 c0                	test   %al,%al
+    18d6:	74 37                	je     190f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    18d8:	0f be c8             	movsbl %al,%ecx
+    18db:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    18de:	85 f6                	test   %esi,%esi
+    18e0:	74 de                	je     18c0 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    18e2:	83 fe 25             	cmp    $0x25,%esi
+    18e5:	75 e7                	jne    18ce <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    18e7:	83 f8 25             	cmp    $0x25,%eax
+    18ea:	74 4e                	je     193a <vprintf.constprop.0+0x9a>
+    18ec:	83 e8 63             	sub    $0x63,%eax
+    18ef:	83 f8 15             	cmp    $0x15,%eax
+    18f2:	77 34                	ja     1928 <vprintf.constprop.0+0x88>
+    18f4:	ff 24 85 b8 24 00 00 	jmp    *0x24b8(,%eax,4)
+    18fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18ff:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1900:	0f b6 03             	movzbl (%ebx),%eax
+    1903:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1906:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    190b:	84 c0                	test   %al,%al
+    190d:	75 c9                	jne    18d8 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    190f:	8b 47 08             	mov    0x8(%edi),%eax
+    1912:	85 c0                	test   %eax,%eax
+    1914:	0f 8f de 00 00 00    	jg     19f8 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    191a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    191d:	5b                   	pop    %ebx
+    191e:	5e                   	pop    %esi
+    191f:	5f                   	pop    %edi
+    1920:	5d                   	pop    %ebp
+    1921:	c3                   	ret
+    1922:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1928:	ba 25 00 00 00       	mov    $0x25,%edx
+    192d:	89 f8                	mov    %edi,%eax
+    192f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1932:	e8 e9 fe ff ff       	call   1820 <putc>
+        putc(o, c);
+    1937:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    193a:	89 ca                	mov    %ecx,%edx
+    193c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    193e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1940:	e8 db fe ff ff       	call   1820 <putc>
+    1945:	eb 87                	jmp    18ce <vprintf.constprop.0+0x2e>
+    1947:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    194e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1950:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1953:	83 ec 0c             	sub    $0xc,%esp
+    1956:	b9 10 00 00 00       	mov    $0x10,%ecx
+    195b:	8b 16                	mov    (%esi),%edx
+    195d:	6a 00                	push   $0x0
+        ap++;
+    195f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1962:	89 f8                	mov    %edi,%eax
+    1964:	e8 b7 fd ff ff       	call   1720 <printint>
+        ap++;
+    1969:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    196c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    196f:	31 f6                	xor    %esi,%esi
+    1971:	e9 58 ff ff ff       	jmp    18ce <vprintf.constprop.0+0x2e>
+    1976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    197d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1980:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1983:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1985:	83 c0 04             	add    $0x4,%eax
+    1988:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    198b:	85 f6                	test   %esi,%esi
+    198d:	75 1b                	jne    19aa <vprintf.constprop.0+0x10a>
+    198f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1994:	be ae 24 00 00       	mov    $0x24ae,%esi
+    1999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    19a0:	89 f8                	mov    %edi,%eax
+          s++;
+    19a2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    19a5:	e8 76 fe ff ff       	call   1820 <putc>
+        while(*s != 0){
+    19aa:	0f be 16             	movsbl (%esi),%edx
+    19ad:	84 d2                	test   %dl,%dl
+    19af:	75 ef                	jne    19a0 <vprintf.constprop.0+0x100>
+      state = 0;
+    19b1:	31 f6                	xor    %esi,%esi
+    19b3:	e9 16 ff ff ff       	jmp    18ce <vprintf.constprop.0+0x2e>
+    19b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bf:	90                   	nop
+        printint(o, *ap, 10, 1);
+    19c0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    19c3:	83 ec 0c             	sub    $0xc,%esp
+    19c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    19cb:	8b 16                	mov    (%esi),%edx
+    19cd:	6a 01                	push   $0x1
+    19cf:	eb 8e                	jmp    195f <vprintf.constprop.0+0xbf>
+    19d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    19d8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    19db:	89 f8                	mov    %edi,%eax
+    19dd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    19e0:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    19e3:	e8 38 fe ff ff       	call   1820 <putc>
+        ap++;
+    19e8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    19eb:	31 f6                	xor    %esi,%esi
+    19ed:	e9 dc fe ff ff       	jmp    18ce <vprintf.constprop.0+0x2e>
+    19f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    19f8:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    19fa:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    19fd:	85 d2                	test   %edx,%edx
+    19ff:	74 1f                	je     1a20 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1a01:	52                   	push   %edx
+    1a02:	50                   	push   %eax
+    1a03:	6a 01                	push   $0x1
+    1a05:	51                   	push   %ecx
+    1a06:	e8 65 02 00 00       	call   1c70 <fwrite>
+    1a0b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1a0e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a18:	5b                   	pop    %ebx
+    1a19:	5e                   	pop    %esi
+    1a1a:	5f                   	pop    %edi
+    1a1b:	5d                   	pop    %ebp
+    1a1c:	c3                   	ret
+    1a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1a20:	83 ec 04             	sub    $0x4,%esp
+    1a23:	50                   	push   %eax
+    1a24:	51                   	push   %ecx
+    1a25:	ff 77 04             	push   0x4(%edi)
+    1a28:	e8 32 fb ff ff       	call   155f <write>
+    1a2d:	83 c4 10             	add    $0x10,%esp
+    1a30:	eb dc                	jmp    1a0e <vprintf.constprop.0+0x16e>
+    1a32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a40 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1a40:	55                   	push   %ebp
+    1a41:	89 e5                	mov    %esp,%ebp
+    1a43:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a49:	a1 c4 2b 00 00       	mov    0x2bc4,%eax
+{
+    1a4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a51:	83 fa 01             	cmp    $0x1,%edx
+    1a54:	74 0c                	je     1a62 <printf+0x22>
+    1a56:	31 c0                	xor    %eax,%eax
+    1a58:	83 fa 02             	cmp    $0x2,%edx
+    1a5b:	0f 44 05 c0 2b 00 00 	cmove  0x2bc0,%eax
+  o.fd = fd;
+    1a62:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a68:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1a6b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a6e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a74:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1a7a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1a81:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a84:	e8 17 fe ff ff       	call   18a0 <vprintf.constprop.0>
+}
+    1a89:	c9                   	leave
+    1a8a:	c3                   	ret
+    1a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a8f:	90                   	nop
+
+00001a90 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1a90:	55                   	push   %ebp
+    1a91:	89 e5                	mov    %esp,%ebp
+    1a93:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1a9f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1aa2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1aa9:	ff ff ff 
+  o.n = 0;
+    1aac:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1ab3:	00 00 00 
+  o.f = f;
+    1ab6:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1abc:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1ac2:	e8 d9 fd ff ff       	call   18a0 <vprintf.constprop.0>
+}
+    1ac7:	c9                   	leave
+    1ac8:	c3                   	ret
+    1ac9:	66 90                	xchg   %ax,%ax
+    1acb:	66 90                	xchg   %ax,%ax
+    1acd:	66 90                	xchg   %ax,%ax
+    1acf:	90                   	nop
+
+00001ad0 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1ad0:	55                   	push   %ebp
+    1ad1:	89 e5                	mov    %esp,%ebp
+    1ad3:	53                   	push   %ebx
+    1ad4:	89 c3                	mov    %eax,%ebx
+    1ad6:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1ad9:	8b 40 0c             	mov    0xc(%eax),%eax
+    1adc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1adf:	74 17                	je     1af8 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1ae1:	83 f8 02             	cmp    $0x2,%eax
+    1ae4:	74 07                	je     1aed <setmode+0x1d>
+    1ae6:	8b 43 18             	mov    0x18(%ebx),%eax
+    1ae9:	85 c0                	test   %eax,%eax
+    1aeb:	74 38                	je     1b25 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1aed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1af0:	c9                   	leave
+    1af1:	c3                   	ret
+    1af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1af8:	83 ec 08             	sub    $0x8,%esp
+    1afb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1afe:	50                   	push   %eax
+    1aff:	ff 33                	push   (%ebx)
+    1b01:	e8 c2 fa ff ff       	call   15c8 <fstat>
+    1b06:	83 c4 10             	add    $0x10,%esp
+    1b09:	89 c2                	mov    %eax,%edx
+    1b0b:	31 c0                	xor    %eax,%eax
+    1b0d:	85 d2                	test   %edx,%edx
+    1b0f:	75 0a                	jne    1b1b <setmode+0x4b>
+    1b11:	31 c0                	xor    %eax,%eax
+    1b13:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1b18:	0f 94 c0             	sete   %al
+    1b1b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1b1e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1b21:	85 c0                	test   %eax,%eax
+    1b23:	75 c8                	jne    1aed <setmode+0x1d>
+    1b25:	83 ec 0c             	sub    $0xc,%esp
+    1b28:	68 00 04 00 00       	push   $0x400
+    1b2d:	e8 de 07 00 00       	call   2310 <malloc>
+    1b32:	83 c4 10             	add    $0x10,%esp
+    1b35:	89 43 18             	mov    %eax,0x18(%ebx)
+    1b38:	85 c0                	test   %eax,%eax
+    1b3a:	75 b1                	jne    1aed <setmode+0x1d>
+    f->mode = IONBF;
+    1b3c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1b43:	eb a8                	jmp    1aed <setmode+0x1d>
+    1b45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b50 <drain>:
+{
+    1b50:	55                   	push   %ebp
+    1b51:	89 e5                	mov    %esp,%ebp
+    1b53:	57                   	push   %edi
+    1b54:	56                   	push   %esi
+    1b55:	53                   	push   %ebx
+    1b56:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1b59:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1b5c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1b5f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1b66:	85 ff                	test   %edi,%edi
+    1b68:	7f 0e                	jg     1b78 <drain+0x28>
+  return 0;
+    1b6a:	31 c0                	xor    %eax,%eax
+}
+    1b6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b6f:	5b                   	pop    %ebx
+    1b70:	5e                   	pop    %esi
+    1b71:	5f                   	pop    %edi
+    1b72:	5d                   	pop    %ebp
+    1b73:	c3                   	ret
+    1b74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1b78:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b7b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1b7e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1b80:	eb 0e                	jmp    1b90 <drain+0x40>
+    1b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1b88:	29 c7                	sub    %eax,%edi
+    1b8a:	01 c3                	add    %eax,%ebx
+    1b8c:	85 ff                	test   %edi,%edi
+    1b8e:	7e da                	jle    1b6a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1b90:	83 ec 04             	sub    $0x4,%esp
+    1b93:	57                   	push   %edi
+    1b94:	53                   	push   %ebx
+    1b95:	56                   	push   %esi
+    1b96:	e8 c4 f9 ff ff       	call   155f <write>
+    1b9b:	83 c4 10             	add    $0x10,%esp
+    1b9e:	85 c0                	test   %eax,%eax
+    1ba0:	7f e6                	jg     1b88 <drain+0x38>
+    f->err = 1;
+    1ba2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1ba5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1bac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1bb1:	eb b9                	jmp    1b6c <drain+0x1c>
+    1bb3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001bc0 <flushall>:
+
+static void
+flushall(void)
+{
+    1bc0:	55                   	push   %ebp
+    1bc1:	89 e5                	mov    %esp,%ebp
+    1bc3:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1bc4:	bb e0 2b 00 00       	mov    $0x2be0,%ebx
+{
+    1bc9:	83 ec 04             	sub    $0x4,%esp
+    1bcc:	eb 0d                	jmp    1bdb <flushall+0x1b>
+    1bce:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1bd0:	83 c3 24             	add    $0x24,%ebx
+    1bd3:	81 fb 20 2e 00 00    	cmp    $0x2e20,%ebx
+    1bd9:	74 19                	je     1bf4 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1bdb:	8b 43 08             	mov    0x8(%ebx),%eax
+    1bde:	85 c0                	test   %eax,%eax
+    1be0:	74 ee                	je     1bd0 <flushall+0x10>
+    1be2:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1be4:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1be7:	e8 64 ff ff ff       	call   1b50 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1bec:	81 fb 20 2e 00 00    	cmp    $0x2e20,%ebx
+    1bf2:	75 e7                	jne    1bdb <flushall+0x1b>
+}
+    1bf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1bf7:	c9                   	leave
+    1bf8:	c3                   	ret
+    1bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c00 <fflush>:
+{
+    1c00:	55                   	push   %ebp
+    1c01:	89 e5                	mov    %esp,%ebp
+    1c03:	57                   	push   %edi
+    1c04:	56                   	push   %esi
+    1c05:	53                   	push   %ebx
+    1c06:	83 ec 0c             	sub    $0xc,%esp
+    1c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1c0c:	85 c0                	test   %eax,%eax
+    1c0e:	74 28                	je     1c38 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1c10:	8b 70 08             	mov    0x8(%eax),%esi
+    1c13:	85 f6                	test   %esi,%esi
+    1c15:	75 11                	jne    1c28 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1c17:	83 c4 0c             	add    $0xc,%esp
+    1c1a:	89 f0                	mov    %esi,%eax
+    1c1c:	5b                   	pop    %ebx
+    1c1d:	5e                   	pop    %esi
+    1c1e:	5f                   	pop    %edi
+    1c1f:	5d                   	pop    %ebp
+    1c20:	c3                   	ret
+    1c21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c28:	83 c4 0c             	add    $0xc,%esp
+    1c2b:	5b                   	pop    %ebx
+    1c2c:	5e                   	pop    %esi
+    1c2d:	5f                   	pop    %edi
+    1c2e:	5d                   	pop    %ebp
+  return drain(f);
+    1c2f:	e9 1c ff ff ff       	jmp    1b50 <drain>
+    1c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1c38:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c3a:	bb e0 2b 00 00       	mov    $0x2be0,%ebx
+        r = -1;
+    1c3f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1c44:	eb 15                	jmp    1c5b <fflush+0x5b>
+    1c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c50:	83 c3 24             	add    $0x24,%ebx
+    1c53:	81 fb 20 2e 00 00    	cmp    $0x2e20,%ebx
+    1c59:	74 bc                	je     1c17 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1c5b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1c5e:	85 c0                	test   %eax,%eax
+    1c60:	74 ee                	je     1c50 <fflush+0x50>
+    1c62:	89 d8                	mov    %ebx,%eax
+    1c64:	e8 e7 fe ff ff       	call   1b50 <drain>
+        r = -1;
+    1c69:	85 c0                	test   %eax,%eax
+    1c6b:	0f 48 f7             	cmovs  %edi,%esi
+    1c6e:	eb e0                	jmp    1c50 <fflush+0x50>
+
+00001c70 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1c70:	55                   	push   %ebp
+    1c71:	89 e5                	mov    %esp,%ebp
+    1c73:	57                   	push   %edi
+    1c74:	56                   	push   %esi
+    1c75:	53                   	push   %ebx
+    1c76:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1c79:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1c7c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1c80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1c83:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1c86:	85 d2                	test   %edx,%edx
+    1c88:	0f 8e 26 01 00 00    	jle    1db4 <fwrite+0x144>
+  if(!f->writable){
+    1c8e:	8b 46 08             	mov    0x8(%esi),%eax
+    1c91:	85 c0                	test   %eax,%eax
+    1c93:	0f 84 14 01 00 00    	je     1dad <fwrite+0x13d>
+  setmode(f);
+    1c99:	89 f0                	mov    %esi,%eax
+    1c9b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c9e:	e8 2d fe ff ff       	call   1ad0 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1ca3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1ca7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1caa:	c7 05 20 32 00 00 c0 	movl   $0x1bc0,0x3220
+    1cb1:	1b 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1cb4:	0f 84 b6 00 00 00    	je     1d70 <fwrite+0x100>
+    1cba:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1cc0:	0f 8f aa 00 00 00    	jg     1d70 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1cc6:	8b 46 20             	mov    0x20(%esi),%eax
+    1cc9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1ccc:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1cce:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1cd3:	74 6c                	je     1d41 <fwrite+0xd1>
+    1cd5:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1cd8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1cdb:	ba 00 04 00 00       	mov    $0x400,%edx
+    1ce0:	29 c2                	sub    %eax,%edx
+    1ce2:	39 ca                	cmp    %ecx,%edx
+    1ce4:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1ce7:	85 d2                	test   %edx,%edx
+    1ce9:	0f 8e d1 00 00 00    	jle    1dc0 <fwrite+0x150>
+    1cef:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1cf2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1cf5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cff:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1d00:	8d 50 01             	lea    0x1(%eax),%edx
+    1d03:	83 c3 01             	add    $0x1,%ebx
+    1d06:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1d09:	89 56 20             	mov    %edx,0x20(%esi)
+    1d0c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1d10:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1d13:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1d16:	b8 01 00 00 00       	mov    $0x1,%eax
+    1d1b:	80 fa 0a             	cmp    $0xa,%dl
+    1d1e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d21:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1d24:	39 cb                	cmp    %ecx,%ebx
+    1d26:	75 d8                	jne    1d00 <fwrite+0x90>
+    1d28:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1d2b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1d2e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1d31:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1d34:	85 db                	test   %ebx,%ebx
+    1d36:	7e 19                	jle    1d51 <fwrite+0xe1>
+    n -= k;
+    1d38:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1d3a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1d3f:	75 97                	jne    1cd8 <fwrite+0x68>
+    1d41:	89 f0                	mov    %esi,%eax
+    1d43:	e8 08 fe ff ff       	call   1b50 <drain>
+    1d48:	85 c0                	test   %eax,%eax
+    1d4a:	78 68                	js     1db4 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1d4c:	8b 46 20             	mov    0x20(%esi),%eax
+    1d4f:	eb 87                	jmp    1cd8 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d51:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1d56:	74 74                	je     1dcc <fwrite+0x15c>
+    1d58:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1d5c:	75 04                	jne    1d62 <fwrite+0xf2>
+    1d5e:	85 ff                	test   %edi,%edi
+    1d60:	75 6a                	jne    1dcc <fwrite+0x15c>
+    return nmemb;
+    1d62:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d68:	5b                   	pop    %ebx
+    1d69:	5e                   	pop    %esi
+    1d6a:	5f                   	pop    %edi
+    1d6b:	5d                   	pop    %ebp
+    1d6c:	c3                   	ret
+    1d6d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1d70:	89 f0                	mov    %esi,%eax
+    1d72:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1d75:	e8 d6 fd ff ff       	call   1b50 <drain>
+    1d7a:	85 c0                	test   %eax,%eax
+    1d7c:	78 2f                	js     1dad <fwrite+0x13d>
+    1d7e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1d81:	8b 3e                	mov    (%esi),%edi
+    1d83:	89 de                	mov    %ebx,%esi
+    1d85:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1d88:	eb 0e                	jmp    1d98 <fwrite+0x128>
+    1d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1d90:	29 c3                	sub    %eax,%ebx
+    1d92:	01 c6                	add    %eax,%esi
+    1d94:	85 db                	test   %ebx,%ebx
+    1d96:	7e ca                	jle    1d62 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1d98:	83 ec 04             	sub    $0x4,%esp
+    1d9b:	53                   	push   %ebx
+    1d9c:	56                   	push   %esi
+    1d9d:	57                   	push   %edi
+    1d9e:	e8 bc f7 ff ff       	call   155f <write>
+    1da3:	83 c4 10             	add    $0x10,%esp
+    1da6:	85 c0                	test   %eax,%eax
+    1da8:	7f e6                	jg     1d90 <fwrite+0x120>
+    1daa:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1dad:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1db4:	31 c0                	xor    %eax,%eax
+}
+    1db6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1db9:	5b                   	pop    %ebx
+    1dba:	5e                   	pop    %esi
+    1dbb:	5f                   	pop    %edi
+    1dbc:	5d                   	pop    %ebp
+    1dbd:	c3                   	ret
+    1dbe:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1dc0:	89 d9                	mov    %ebx,%ecx
+    1dc2:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1dc5:	89 cb                	mov    %ecx,%ebx
+    1dc7:	e9 6e ff ff ff       	jmp    1d3a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1dcc:	89 f0                	mov    %esi,%eax
+    1dce:	e8 7d fd ff ff       	call   1b50 <drain>
+    1dd3:	85 c0                	test   %eax,%eax
+    1dd5:	79 8b                	jns    1d62 <fwrite+0xf2>
+    return 0;
+    1dd7:	31 c0                	xor    %eax,%eax
+    1dd9:	eb db                	jmp    1db6 <fwrite+0x146>
+    1ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ddf:	90                   	nop
+
+00001de0 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1de0:	55                   	push   %ebp
+    1de1:	89 e5                	mov    %esp,%ebp
+    1de3:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1de6:	8b 45 08             	mov    0x8(%ebp),%eax
+    1de9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1dec:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1def:	ff 75 0c             	push   0xc(%ebp)
+    1df2:	6a 01                	push   $0x1
+    1df4:	6a 01                	push   $0x1
+    1df6:	50                   	push   %eax
+    1df7:	e8 74 fe ff ff       	call   1c70 <fwrite>
+    1dfc:	83 c4 10             	add    $0x10,%esp
+    1dff:	83 f8 01             	cmp    $0x1,%eax
+    1e02:	75 0c                	jne    1e10 <fputc+0x30>
+    1e04:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1e08:	c9                   	leave
+    1e09:	c3                   	ret
+    1e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1e10:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1e11:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1e16:	c3                   	ret
+    1e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e1e:	66 90                	xchg   %ax,%ax
+
+00001e20 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1e20:	55                   	push   %ebp
+    1e21:	89 e5                	mov    %esp,%ebp
+    1e23:	57                   	push   %edi
+    1e24:	56                   	push   %esi
+    1e25:	53                   	push   %ebx
+    1e26:	83 ec 1c             	sub    $0x1c,%esp
+    1e29:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1e2c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1e2f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1e32:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1e35:	85 d2                	test   %edx,%edx
+    1e37:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1e3a:	7e 12                	jle    1e4e <fread+0x2e>
+    1e3c:	85 ff                	test   %edi,%edi
+    1e3e:	7e 0e                	jle    1e4e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1e40:	8b 43 04             	mov    0x4(%ebx),%eax
+    1e43:	85 c0                	test   %eax,%eax
+    1e45:	75 19                	jne    1e60 <fread+0x40>
+    f->err = 1;
+    1e47:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1e4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1e51:	31 c0                	xor    %eax,%eax
+}
+    1e53:	5b                   	pop    %ebx
+    1e54:	5e                   	pop    %esi
+    1e55:	5f                   	pop    %edi
+    1e56:	5d                   	pop    %ebp
+    1e57:	c3                   	ret
+    1e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e5f:	90                   	nop
+  setmode(f);
+    1e60:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1e62:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1e64:	e8 67 fc ff ff       	call   1ad0 <setmode>
+  for(n = 0; n < want; n += k){
+    1e69:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1e6c:	89 f7                	mov    %esi,%edi
+    1e6e:	eb 31                	jmp    1ea1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1e70:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1e74:	74 08                	je     1e7e <fread+0x5e>
+    1e76:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1e7c:	7e 62                	jle    1ee0 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1e7e:	83 ec 04             	sub    $0x4,%esp
+    1e81:	56                   	push   %esi
+    1e82:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e85:	01 f8                	add    %edi,%eax
+    1e87:	50                   	push   %eax
+    1e88:	ff 33                	push   (%ebx)
+    1e8a:	e8 c1 f6 ff ff       	call   1550 <read>
+    1e8f:	83 c4 10             	add    $0x10,%esp
+    1e92:	85 c0                	test   %eax,%eax
+    1e94:	0f 8e ce 00 00 00    	jle    1f68 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1e9a:	01 c7                	add    %eax,%edi
+    1e9c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1e9f:	7e 36                	jle    1ed7 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1ea1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1ea4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1ea7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1eaa:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1eac:	39 c1                	cmp    %eax,%ecx
+    1eae:	7d c0                	jge    1e70 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1eb0:	29 c8                	sub    %ecx,%eax
+    1eb2:	39 f0                	cmp    %esi,%eax
+    1eb4:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1eb7:	83 ec 04             	sub    $0x4,%esp
+    1eba:	56                   	push   %esi
+    1ebb:	03 4b 18             	add    0x18(%ebx),%ecx
+    1ebe:	51                   	push   %ecx
+    1ebf:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ec2:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1ec4:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1ec6:	50                   	push   %eax
+    1ec7:	e8 34 f5 ff ff       	call   1400 <memmove>
+      f->r += k;
+    1ecc:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1ecf:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1ed2:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1ed5:	7f ca                	jg     1ea1 <fread+0x81>
+    1ed7:	89 fe                	mov    %edi,%esi
+    1ed9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1edc:	eb 3f                	jmp    1f1d <fread+0xfd>
+    1ede:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1ee0:	3b 1d c8 2b 00 00    	cmp    0x2bc8,%ebx
+    1ee6:	74 68                	je     1f50 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1ee8:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1eeb:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1ef2:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1ef9:	68 00 04 00 00       	push   $0x400
+    1efe:	ff 73 18             	push   0x18(%ebx)
+    1f01:	ff 33                	push   (%ebx)
+    1f03:	e8 48 f6 ff ff       	call   1550 <read>
+    1f08:	83 c4 10             	add    $0x10,%esp
+    1f0b:	85 c0                	test   %eax,%eax
+    1f0d:	78 21                	js     1f30 <fread+0x110>
+  else if(n == 0)
+    1f0f:	75 2f                	jne    1f40 <fread+0x120>
+    f->eof = 1;
+    1f11:	89 fe                	mov    %edi,%esi
+    1f13:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f16:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1f1d:	89 f0                	mov    %esi,%eax
+}
+    1f1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1f22:	99                   	cltd
+}
+    1f23:	5b                   	pop    %ebx
+    1f24:	5e                   	pop    %esi
+  return n / size;
+    1f25:	f7 ff                	idiv   %edi
+}
+    1f27:	5f                   	pop    %edi
+    1f28:	5d                   	pop    %ebp
+    1f29:	c3                   	ret
+    1f2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1f30:	89 fe                	mov    %edi,%esi
+    1f32:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f35:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1f3c:	eb df                	jmp    1f1d <fread+0xfd>
+    1f3e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1f40:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1f43:	e9 54 ff ff ff       	jmp    1e9c <fread+0x7c>
+    1f48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f4f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1f50:	83 ec 0c             	sub    $0xc,%esp
+    1f53:	ff 35 c4 2b 00 00    	push   0x2bc4
+    1f59:	e8 a2 fc ff ff       	call   1c00 <fflush>
+    1f5e:	83 c4 10             	add    $0x10,%esp
+    1f61:	eb 85                	jmp    1ee8 <fread+0xc8>
+    1f63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f67:	90                   	nop
+        if(k < 0)
+    1f68:	89 fe                	mov    %edi,%esi
+    1f6a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f6d:	74 a7                	je     1f16 <fread+0xf6>
+    1f6f:	eb c4                	jmp    1f35 <fread+0x115>
+    1f71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f7f:	90                   	nop
+
+00001f80 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1f80:	55                   	push   %ebp
+    1f81:	89 e5                	mov    %esp,%ebp
+    1f83:	53                   	push   %ebx
+    1f84:	83 ec 14             	sub    $0x14,%esp
+    1f87:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1f8a:	8b 50 04             	mov    0x4(%eax),%edx
+    1f8d:	85 d2                	test   %edx,%edx
+    1f8f:	74 08                	je     1f99 <fgetc+0x19>
+    1f91:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1f94:	3b 50 20             	cmp    0x20(%eax),%edx
+    1f97:	7c 27                	jl     1fc0 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f99:	50                   	push   %eax
+    1f9a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1f9d:	6a 01                	push   $0x1
+    1f9f:	6a 01                	push   $0x1
+    1fa1:	50                   	push   %eax
+    1fa2:	e8 79 fe ff ff       	call   1e20 <fread>
+    1fa7:	83 c4 10             	add    $0x10,%esp
+    1faa:	83 f8 01             	cmp    $0x1,%eax
+    1fad:	75 29                	jne    1fd8 <fgetc+0x58>
+    1faf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1fb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fb6:	c9                   	leave
+    1fb7:	c3                   	ret
+    1fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fbf:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1fc0:	8b 48 18             	mov    0x18(%eax),%ecx
+    1fc3:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1fc6:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1fc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1fcc:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1fd0:	c9                   	leave
+    1fd1:	c3                   	ret
+    1fd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1fd8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1fdd:	eb d4                	jmp    1fb3 <fgetc+0x33>
+    1fdf:	90                   	nop
+
+00001fe0 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1fe0:	55                   	push   %ebp
+    1fe1:	89 e5                	mov    %esp,%ebp
+    1fe3:	57                   	push   %edi
+    1fe4:	56                   	push   %esi
+    1fe5:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1fe6:	31 db                	xor    %ebx,%ebx
+{
+    1fe8:	83 ec 1c             	sub    $0x1c,%esp
+    1feb:	8b 75 10             	mov    0x10(%ebp),%esi
+    1fee:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1ff0:	eb 2e                	jmp    2020 <fgets+0x40>
+    1ff2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1ff8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1ffb:	57                   	push   %edi
+    1ffc:	6a 01                	push   $0x1
+    1ffe:	6a 01                	push   $0x1
+    2000:	50                   	push   %eax
+    2001:	e8 1a fe ff ff       	call   1e20 <fread>
+    2006:	83 c4 10             	add    $0x10,%esp
+    2009:	83 f8 01             	cmp    $0x1,%eax
+    200c:	75 62                	jne    2070 <fgets+0x90>
+    200e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    2012:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2015:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    2017:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    201b:	83 f9 0a             	cmp    $0xa,%ecx
+    201e:	74 34                	je     2054 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    2020:	89 de                	mov    %ebx,%esi
+    2022:	83 c3 01             	add    $0x1,%ebx
+    2025:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    2028:	7d 46                	jge    2070 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    202a:	8b 47 04             	mov    0x4(%edi),%eax
+    202d:	85 c0                	test   %eax,%eax
+    202f:	74 c7                	je     1ff8 <fgets+0x18>
+    2031:	8b 47 1c             	mov    0x1c(%edi),%eax
+    2034:	3b 47 20             	cmp    0x20(%edi),%eax
+    2037:	7d bf                	jge    1ff8 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    2039:	8b 4f 18             	mov    0x18(%edi),%ecx
+    203c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    203f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    2042:	89 77 1c             	mov    %esi,0x1c(%edi)
+    2045:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    2049:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    204b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    204f:	83 f9 0a             	cmp    $0xa,%ecx
+    2052:	75 cc                	jne    2020 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2054:	8b 45 08             	mov    0x8(%ebp),%eax
+    2057:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    205b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    205e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2061:	5b                   	pop    %ebx
+    2062:	5e                   	pop    %esi
+    2063:	5f                   	pop    %edi
+    2064:	5d                   	pop    %ebp
+    2065:	c3                   	ret
+    2066:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    206d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2070:	8b 45 08             	mov    0x8(%ebp),%eax
+    2073:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2077:	31 c0                	xor    %eax,%eax
+    2079:	85 f6                	test   %esi,%esi
+    207b:	74 e1                	je     205e <fgets+0x7e>
+    207d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2080:	eb dc                	jmp    205e <fgets+0x7e>
+    2082:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2089:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002090 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    2090:	55                   	push   %ebp
+    2091:	89 e5                	mov    %esp,%ebp
+    2093:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2094:	bb e0 2b 00 00       	mov    $0x2be0,%ebx
+{
+    2099:	83 ec 04             	sub    $0x4,%esp
+    209c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    20a0:	8b 53 04             	mov    0x4(%ebx),%edx
+    20a3:	85 d2                	test   %edx,%edx
+    20a5:	75 07                	jne    20ae <fdopen+0x1e>
+    20a7:	8b 43 08             	mov    0x8(%ebx),%eax
+    20aa:	85 c0                	test   %eax,%eax
+    20ac:	74 1a                	je     20c8 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    20ae:	83 c3 24             	add    $0x24,%ebx
+    20b1:	81 fb 20 2e 00 00    	cmp    $0x2e20,%ebx
+    20b7:	75 e7                	jne    20a0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    20b9:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    20bb:	89 d8                	mov    %ebx,%eax
+    20bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    20c0:	c9                   	leave
+    20c1:	c3                   	ret
+    20c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    20c8:	81 fb 20 2e 00 00    	cmp    $0x2e20,%ebx
+    20ce:	74 e9                	je     20b9 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    20d0:	83 ec 04             	sub    $0x4,%esp
+    20d3:	6a 24                	push   $0x24
+    20d5:	6a 00                	push   $0x0
+    20d7:	53                   	push   %ebx
+    20d8:	e8 d3 f1 ff ff       	call   12b0 <memset>
+  f->fd = fd;
+    20dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    20e0:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    20e7:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    20ea:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    20ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+    20ef:	80 38 72             	cmpb   $0x72,(%eax)
+    20f2:	74 14                	je     2108 <fdopen+0x78>
+    f->writable = 1;
+    20f4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    20fb:	89 d8                	mov    %ebx,%eax
+    20fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2100:	c9                   	leave
+    2101:	c3                   	ret
+    2102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2108:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    210f:	89 d8                	mov    %ebx,%eax
+    2111:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2114:	c9                   	leave
+    2115:	c3                   	ret
+    2116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    211d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002120 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2120:	55                   	push   %ebp
+    2121:	89 e5                	mov    %esp,%ebp
+    2123:	56                   	push   %esi
+    2124:	53                   	push   %ebx
+    2125:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2128:	0f b6 06             	movzbl (%esi),%eax
+    212b:	3c 72                	cmp    $0x72,%al
+    212d:	74 61                	je     2190 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    212f:	3c 77                	cmp    $0x77,%al
+    2131:	74 7d                	je     21b0 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2133:	3c 61                	cmp    $0x61,%al
+    2135:	75 49                	jne    2180 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2137:	83 ec 08             	sub    $0x8,%esp
+    213a:	68 01 02 00 00       	push   $0x201
+    213f:	ff 75 08             	push   0x8(%ebp)
+    2142:	e8 54 f4 ff ff       	call   159b <open>
+    2147:	83 c4 10             	add    $0x10,%esp
+    214a:	89 c3                	mov    %eax,%ebx
+    214c:	85 c0                	test   %eax,%eax
+    214e:	78 30                	js     2180 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2150:	83 ec 04             	sub    $0x4,%esp
+    2153:	6a 02                	push   $0x2
+    2155:	6a 00                	push   $0x0
+    2157:	50                   	push   %eax
+    2158:	e8 4c f5 ff ff       	call   16a9 <lseek>
+    215d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2160:	83 ec 08             	sub    $0x8,%esp
+    2163:	56                   	push   %esi
+    2164:	53                   	push   %ebx
+    2165:	e8 26 ff ff ff       	call   2090 <fdopen>
+    216a:	83 c4 10             	add    $0x10,%esp
+    216d:	85 c0                	test   %eax,%eax
+    216f:	75 11                	jne    2182 <fopen+0x62>
+    close(fd);
+    2171:	83 ec 0c             	sub    $0xc,%esp
+    2174:	53                   	push   %ebx
+    2175:	e8 f4 f3 ff ff       	call   156e <close>
+    217a:	83 c4 10             	add    $0x10,%esp
+    217d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2180:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2182:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2185:	5b                   	pop    %ebx
+    2186:	5e                   	pop    %esi
+    2187:	5d                   	pop    %ebp
+    2188:	c3                   	ret
+    2189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2190:	83 ec 08             	sub    $0x8,%esp
+    2193:	6a 00                	push   $0x0
+    2195:	ff 75 08             	push   0x8(%ebp)
+    2198:	e8 fe f3 ff ff       	call   159b <open>
+    219d:	83 c4 10             	add    $0x10,%esp
+    21a0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    21a2:	85 db                	test   %ebx,%ebx
+    21a4:	78 da                	js     2180 <fopen+0x60>
+    21a6:	eb b8                	jmp    2160 <fopen+0x40>
+    21a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21af:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    21b0:	83 ec 08             	sub    $0x8,%esp
+    21b3:	68 01 06 00 00       	push   $0x601
+    21b8:	ff 75 08             	push   0x8(%ebp)
+    21bb:	e8 db f3 ff ff       	call   159b <open>
+    21c0:	83 c4 10             	add    $0x10,%esp
+    21c3:	89 c3                	mov    %eax,%ebx
+    21c5:	eb db                	jmp    21a2 <fopen+0x82>
+    21c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21ce:	66 90                	xchg   %ax,%ax
+
+000021d0 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    21d0:	55                   	push   %ebp
+    21d1:	89 e5                	mov    %esp,%ebp
+    21d3:	56                   	push   %esi
+    21d4:	53                   	push   %ebx
+    21d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    21d8:	83 ec 0c             	sub    $0xc,%esp
+    21db:	53                   	push   %ebx
+    21dc:	e8 1f fa ff ff       	call   1c00 <fflush>
+    21e1:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    21e3:	58                   	pop    %eax
+    21e4:	ff 33                	push   (%ebx)
+    21e6:	e8 83 f3 ff ff       	call   156e <close>
+    21eb:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    21ee:	85 c0                	test   %eax,%eax
+    21f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    21f5:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    21f8:	8b 43 18             	mov    0x18(%ebx),%eax
+    21fb:	85 c0                	test   %eax,%eax
+    21fd:	0f 95 c1             	setne  %cl
+    2200:	3d 40 36 00 00       	cmp    $0x3640,%eax
+    2205:	0f 95 c2             	setne  %dl
+    2208:	84 d1                	test   %dl,%cl
+    220a:	74 07                	je     2213 <fclose+0x43>
+    220c:	3d 40 32 00 00       	cmp    $0x3240,%eax
+    2211:	75 25                	jne    2238 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2213:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    221a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    221c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2223:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    222a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    222d:	5b                   	pop    %ebx
+    222e:	5e                   	pop    %esi
+    222f:	5d                   	pop    %ebp
+    2230:	c3                   	ret
+    2231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2238:	83 ec 0c             	sub    $0xc,%esp
+    223b:	50                   	push   %eax
+    223c:	e8 3f 00 00 00       	call   2280 <free>
+    2241:	83 c4 10             	add    $0x10,%esp
+    2244:	eb cd                	jmp    2213 <fclose+0x43>
+    2246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    224d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002250 <feof>:
+
+int
+feof(FILE *f)
+{
+    2250:	55                   	push   %ebp
+    2251:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2253:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2256:	5d                   	pop    %ebp
+  return f->eof;
+    2257:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    225a:	c3                   	ret
+    225b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    225f:	90                   	nop
+
+00002260 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2260:	55                   	push   %ebp
+    2261:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2263:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2266:	5d                   	pop    %ebp
+  return f->err;
+    2267:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    226a:	c3                   	ret
+    226b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    226f:	90                   	nop
+
+00002270 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2270:	55                   	push   %ebp
+    2271:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2273:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2276:	5d                   	pop    %ebp
+  return f->fd;
+    2277:	8b 00                	mov    (%eax),%eax
+}
+    2279:	c3                   	ret
+    227a:	66 90                	xchg   %ax,%ax
+    227c:	66 90                	xchg   %ax,%ax
+    227e:	66 90                	xchg   %ax,%ax
+
+00002280 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2280:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2281:	a1 40 3a 00 00       	mov    0x3a40,%eax
+{
+    2286:	89 e5                	mov    %esp,%ebp
+    2288:	57                   	push   %edi
+    2289:	56                   	push   %esi
+    228a:	53                   	push   %ebx
+    228b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    228e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2298:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    229a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    229c:	39 ca                	cmp    %ecx,%edx
+    229e:	73 30                	jae    22d0 <free+0x50>
+    22a0:	39 c1                	cmp    %eax,%ecx
+    22a2:	72 04                	jb     22a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    22a4:	39 c2                	cmp    %eax,%edx
+    22a6:	72 f0                	jb     2298 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    22a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    22ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    22ae:	39 f8                	cmp    %edi,%eax
+    22b0:	74 2e                	je     22e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    22b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    22b5:	8b 42 04             	mov    0x4(%edx),%eax
+    22b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    22bb:	39 f1                	cmp    %esi,%ecx
+    22bd:	74 38                	je     22f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    22bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    22c1:	5b                   	pop    %ebx
+  freep = p;
+    22c2:	89 15 40 3a 00 00    	mov    %edx,0x3a40
+}
+    22c8:	5e                   	pop    %esi
+    22c9:	5f                   	pop    %edi
+    22ca:	5d                   	pop    %ebp
+    22cb:	c3                   	ret
+    22cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    22d0:	39 c1                	cmp    %eax,%ecx
+    22d2:	72 d0                	jb     22a4 <free+0x24>
+    22d4:	eb c2                	jmp    2298 <free+0x18>
+    22d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    22e0:	03 70 04             	add    0x4(%eax),%esi
+    22e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    22e6:	8b 02                	mov    (%edx),%eax
+    22e8:	8b 00                	mov    (%eax),%eax
+    22ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    22ed:	8b 42 04             	mov    0x4(%edx),%eax
+    22f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    22f3:	39 f1                	cmp    %esi,%ecx
+    22f5:	75 c8                	jne    22bf <free+0x3f>
+    p->s.size += bp->s.size;
+    22f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    22fa:	89 15 40 3a 00 00    	mov    %edx,0x3a40
+    p->s.size += bp->s.size;
+    2300:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2303:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2306:	89 0a                	mov    %ecx,(%edx)
+}
+    2308:	5b                   	pop    %ebx
+    2309:	5e                   	pop    %esi
+    230a:	5f                   	pop    %edi
+    230b:	5d                   	pop    %ebp
+    230c:	c3                   	ret
+    230d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002310 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2310:	55                   	push   %ebp
+    2311:	89 e5                	mov    %esp,%ebp
+    2313:	57                   	push   %edi
+    2314:	56                   	push   %esi
+    2315:	53                   	push   %ebx
+    2316:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2319:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    231c:	8b 15 40 3a 00 00    	mov    0x3a40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2322:	8d 78 07             	lea    0x7(%eax),%edi
+    2325:	c1 ef 03             	shr    $0x3,%edi
+    2328:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    232b:	85 d2                	test   %edx,%edx
+    232d:	0f 84 8d 00 00 00    	je     23c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2333:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2335:	8b 48 04             	mov    0x4(%eax),%ecx
+    2338:	39 f9                	cmp    %edi,%ecx
+    233a:	73 64                	jae    23a0 <malloc+0x90>
+  if(nu < 4096)
+    233c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2341:	39 df                	cmp    %ebx,%edi
+    2343:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2346:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    234d:	eb 0a                	jmp    2359 <malloc+0x49>
+    234f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2350:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2352:	8b 48 04             	mov    0x4(%eax),%ecx
+    2355:	39 f9                	cmp    %edi,%ecx
+    2357:	73 47                	jae    23a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2359:	89 c2                	mov    %eax,%edx
+    235b:	39 05 40 3a 00 00    	cmp    %eax,0x3a40
+    2361:	75 ed                	jne    2350 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2363:	83 ec 0c             	sub    $0xc,%esp
+    2366:	56                   	push   %esi
+    2367:	e8 b6 f2 ff ff       	call   1622 <sbrk>
+  if(p == (char*)-1)
+    236c:	83 c4 10             	add    $0x10,%esp
+    236f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2372:	74 1c                	je     2390 <malloc+0x80>
+  hp->s.size = nu;
+    2374:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2377:	83 ec 0c             	sub    $0xc,%esp
+    237a:	83 c0 08             	add    $0x8,%eax
+    237d:	50                   	push   %eax
+    237e:	e8 fd fe ff ff       	call   2280 <free>
+  return freep;
+    2383:	8b 15 40 3a 00 00    	mov    0x3a40,%edx
+      if((p = morecore(nunits)) == 0)
+    2389:	83 c4 10             	add    $0x10,%esp
+    238c:	85 d2                	test   %edx,%edx
+    238e:	75 c0                	jne    2350 <malloc+0x40>
+        return 0;
+  }
+}
+    2390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2393:	31 c0                	xor    %eax,%eax
+}
+    2395:	5b                   	pop    %ebx
+    2396:	5e                   	pop    %esi
+    2397:	5f                   	pop    %edi
+    2398:	5d                   	pop    %ebp
+    2399:	c3                   	ret
+    239a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    23a0:	39 cf                	cmp    %ecx,%edi
+    23a2:	74 4c                	je     23f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    23a4:	29 f9                	sub    %edi,%ecx
+    23a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    23a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    23ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    23af:	89 15 40 3a 00 00    	mov    %edx,0x3a40
+}
+    23b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    23b8:	83 c0 08             	add    $0x8,%eax
+}
+    23bb:	5b                   	pop    %ebx
+    23bc:	5e                   	pop    %esi
+    23bd:	5f                   	pop    %edi
+    23be:	5d                   	pop    %ebp
+    23bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    23c0:	c7 05 40 3a 00 00 44 	movl   $0x3a44,0x3a40
+    23c7:	3a 00 00 
+    base.s.size = 0;
+    23ca:	b8 44 3a 00 00       	mov    $0x3a44,%eax
+    base.s.ptr = freep = prevp = &base;
+    23cf:	c7 05 44 3a 00 00 44 	movl   $0x3a44,0x3a44
+    23d6:	3a 00 00 
+    base.s.size = 0;
+    23d9:	c7 05 48 3a 00 00 00 	movl   $0x0,0x3a48
+    23e0:	00 00 00 
+    if(p->s.size >= nunits){
+    23e3:	e9 54 ff ff ff       	jmp    233c <malloc+0x2c>
+    23e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    23f0:	8b 08                	mov    (%eax),%ecx
+    23f2:	89 0a                	mov    %ecx,(%edx)
+    23f4:	eb b9                	jmp    23af <malloc+0x9f>
@@ -0,0 +1,52 @@
+// Console output benchmark.
+//   conbench [kb [line]]
+// Writes kb KB (default 64) to the console in line-byte
+// write()s (default 64), then prints how long that took and
+// how the serial port sent it: by interrupt from its ring,
+// or polled out because the ring was full.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "kstat.h"
+
+char buf[1024];
+
+int
+main(int argc, char *argv[])
+{
+  int kb, line, i, t, start;
+  uint total, want;
+  struct kstat before, after;
+
+  kb = argc > 1 ? atoi(argv[1]) : 64;
+  line = argc > 2 ? atoi(argv[2]) : 64;
+  if(kb <= 0 || line < 2 || line > sizeof(buf)){
+    printf(2, "usage: conbench [kb [line]]\n");
+    exit();
+  }
+  for(i = 0; i < line - 1; i++)
+    buf[i] = 'a' + i % 26;
+  buf[line - 1] = '\n';
+  want = kb * 1024;
+
+  kstat(&before);
+  start = uptime();
+  for(total = 0; total < want; total += line)
+    if(write(1, buf, line) != line){
+      printf(2, "conbench: write failed\n");
+      exit();
+    }
+  t = uptime() - start;
+  kstat(&after);
+
+  printf(1, "conbench: %d bytes in %d-byte writes in %d ticks", total, line, t);
+  if(t > 0)
+    printf(1, ", %d bytes/s", total*100/t);
+  printf(1, "\n");
+  printf(1, "conbench: uart sent %d, %d polled, %d writes waited for room\n",
+    after.uart_tx - before.uart_tx,
+    after.uart_txpolled - before.uart_txpolled,
+    after.uart_txwaits - before.uart_txwaits);
+  exit();
+}
@@ -22,6 +22,7 @@ static int panicked = 0;
 static struct {
   struct spinlock lock;
   int locking;
+  struct sleeplock wlock;  // held by consolewrite(), which may sleep
 } cons;
 
 static void
@@ -111,6 +112,7 @@ panic(char *s)
 
   cli();
   cons.locking = 0;
+  uartsync();
   // use lapiccpunum so that we can call panic from mycpu()
   cprintf("lapicid %d: panic: ", lapicid());
   cprintf(s);
@@ -276,10 +278,21 @@ consolewrite(struct inode *ip, char *buf, int n)
   int i;
 
   iunlock(ip);
+  // One write() at a time, so that each reaches the screen
+  // and the serial line whole, and in the same order.
+  acquiresleep(&cons.wlock);
   acquire(&cons.lock);
+  if(panicked){
+    cli();
+    for(;;)
+      ;
+  }
   for(i = 0; i < n; i++)
-    consputc(buf[i] & 0xff);
+    cgaputc(buf[i] & 0xff);
   release(&cons.lock);
+  // Outside cons.lock, since it may sleep for room.
+  n = uartwrite(buf, n);
+  releasesleep(&cons.wlock);
   ilock(ip);
 
   return n;
@@ -289,6 +302,7 @@ void
 consoleinit(void)
 {
   initlock(&cons.lock, "console");
+  initsleeplock(&cons.wlock, "conswrite");
 
   devsw[CONSOLE].write = consolewrite;
   devsw[CONSOLE].read = consoleread;
@@ -0,0 +1,2894 @@
+
+_cp:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+
+char path[512];
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	83 ec 48             	sub    $0x48,%esp
+  int in, out, n;
+  char *dst, *p;
+  struct stat st, sst;
+
+  if(argc != 3){
+    1014:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+    1017:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc != 3){
+    101a:	74 13                	je     102f <main+0x2f>
+    printf(2, "Usage: cp src dst\n");
+    101c:	52                   	push   %edx
+    101d:	52                   	push   %edx
+    101e:	68 38 24 00 00       	push   $0x2438
+    1023:	6a 02                	push   $0x2
+    1025:	e8 56 0a 00 00       	call   1a80 <printf>
+    exit();
+    102a:	e8 e1 04 00 00       	call   1510 <exit>
+  }
+  if((in = open(argv[1], O_RDONLY)) < 0){
+    102f:	50                   	push   %eax
+    1030:	50                   	push   %eax
+    1031:	6a 00                	push   $0x0
+    1033:	ff 76 04             	push   0x4(%esi)
+    1036:	e8 a0 05 00 00       	call   15db <open>
+    103b:	83 c4 10             	add    $0x10,%esp
+    103e:	89 c3                	mov    %eax,%ebx
+    1040:	85 c0                	test   %eax,%eax
+    1042:	0f 88 ba 00 00 00    	js     1102 <main+0x102>
+    printf(2, "cp: cannot open %s\n", argv[1]);
+    exit();
+  }
+  if(fstat(in, &sst) < 0 || sst.type == T_DIR){
+    1048:	50                   	push   %eax
+    1049:	50                   	push   %eax
+    104a:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    104d:	50                   	push   %eax
+    104e:	53                   	push   %ebx
+    104f:	e8 b4 05 00 00       	call   1608 <fstat>
+    1054:	83 c4 10             	add    $0x10,%esp
+    1057:	85 c0                	test   %eax,%eax
+    1059:	0f 88 8e 00 00 00    	js     10ed <main+0xed>
+    105f:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+    1064:	0f 84 83 00 00 00    	je     10ed <main+0xed>
+    printf(2, "cp: %s is not a file\n", argv[1]);
+    exit();
+  }
+
+  dst = argv[2];
+    106a:	8b 7e 08             	mov    0x8(%esi),%edi
+  if(stat(dst, &st) >= 0 && st.type == T_DIR){
+    106d:	8d 4d c0             	lea    -0x40(%ebp),%ecx
+    1070:	50                   	push   %eax
+    1071:	50                   	push   %eax
+    1072:	51                   	push   %ecx
+    1073:	57                   	push   %edi
+    1074:	e8 37 03 00 00       	call   13b0 <stat>
+    1079:	83 c4 10             	add    $0x10,%esp
+    107c:	8d 4d c0             	lea    -0x40(%ebp),%ecx
+    107f:	85 c0                	test   %eax,%eax
+    1081:	78 0b                	js     108e <main+0x8e>
+    1083:	66 83 7d c0 01       	cmpw   $0x1,-0x40(%ebp)
+    1088:	0f 84 b9 00 00 00    	je     1147 <main+0x147>
+    strcpy(path + strlen(path), "/");
+    strcpy(path + strlen(path), p);
+    dst = path;
+  }
+  // Truncating dst would empty src if they were one file.
+  if(stat(dst, &st) >= 0 && st.dev == sst.dev && st.ino == sst.ino){
+    108e:	50                   	push   %eax
+    108f:	50                   	push   %eax
+    1090:	51                   	push   %ecx
+    1091:	57                   	push   %edi
+    1092:	e8 19 03 00 00       	call   13b0 <stat>
+    1097:	83 c4 10             	add    $0x10,%esp
+    109a:	85 c0                	test   %eax,%eax
+    109c:	78 08                	js     10a6 <main+0xa6>
+    109e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    10a1:	39 45 c4             	cmp    %eax,-0x3c(%ebp)
+    10a4:	74 71                	je     1117 <main+0x117>
+    printf(2, "cp: %s and %s are the same file\n", argv[1], dst);
+    exit();
+  }
+  if((out = open(dst, O_CREATE|O_WRONLY|O_TRUNC)) < 0){
+    10a6:	51                   	push   %ecx
+    10a7:	51                   	push   %ecx
+    10a8:	68 01 06 00 00       	push   $0x601
+    10ad:	57                   	push   %edi
+    10ae:	e8 28 05 00 00       	call   15db <open>
+    10b3:	83 c4 10             	add    $0x10,%esp
+    10b6:	89 c6                	mov    %eax,%esi
+    10b8:	85 c0                	test   %eax,%eax
+    10ba:	78 78                	js     1134 <main+0x134>
+    printf(2, "cp: cannot create %s\n", dst);
+    exit();
+  }
+
+  while((n = sendfile(out, in, -1, 1024*1024)) > 0)
+    10bc:	68 00 00 10 00       	push   $0x100000
+    10c1:	6a ff                	push   $0xffffffff
+    10c3:	53                   	push   %ebx
+    10c4:	56                   	push   %esi
+    10c5:	e8 10 06 00 00       	call   16da <sendfile>
+    10ca:	83 c4 10             	add    $0x10,%esp
+    10cd:	85 c0                	test   %eax,%eax
+    10cf:	7f eb                	jg     10bc <main+0xbc>
+    ;
+  if(n < 0)
+    10d1:	0f 85 d7 00 00 00    	jne    11ae <main+0x1ae>
+    printf(2, "cp: copy to %s failed\n", dst);
+  close(in);
+    10d7:	83 ec 0c             	sub    $0xc,%esp
+    10da:	53                   	push   %ebx
+    10db:	e8 ce 04 00 00       	call   15ae <close>
+  close(out);
+    10e0:	89 34 24             	mov    %esi,(%esp)
+    10e3:	e8 c6 04 00 00       	call   15ae <close>
+  exit();
+    10e8:	e8 23 04 00 00       	call   1510 <exit>
+    printf(2, "cp: %s is not a file\n", argv[1]);
+    10ed:	50                   	push   %eax
+    10ee:	ff 76 04             	push   0x4(%esi)
+    10f1:	68 5f 24 00 00       	push   $0x245f
+    10f6:	6a 02                	push   $0x2
+    10f8:	e8 83 09 00 00       	call   1a80 <printf>
+    exit();
+    10fd:	e8 0e 04 00 00       	call   1510 <exit>
+    printf(2, "cp: cannot open %s\n", argv[1]);
+    1102:	50                   	push   %eax
+    1103:	ff 76 04             	push   0x4(%esi)
+    1106:	68 4b 24 00 00       	push   $0x244b
+    110b:	6a 02                	push   $0x2
+    110d:	e8 6e 09 00 00       	call   1a80 <printf>
+    exit();
+    1112:	e8 f9 03 00 00       	call   1510 <exit>
+  if(stat(dst, &st) >= 0 && st.dev == sst.dev && st.ino == sst.ino){
+    1117:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    111a:	39 45 c8             	cmp    %eax,-0x38(%ebp)
+    111d:	75 87                	jne    10a6 <main+0xa6>
+    printf(2, "cp: %s and %s are the same file\n", argv[1], dst);
+    111f:	57                   	push   %edi
+    1120:	ff 76 04             	push   0x4(%esi)
+    1123:	68 b8 24 00 00       	push   $0x24b8
+    1128:	6a 02                	push   $0x2
+    112a:	e8 51 09 00 00       	call   1a80 <printf>
+    exit();
+    112f:	e8 dc 03 00 00       	call   1510 <exit>
+    printf(2, "cp: cannot create %s\n", dst);
+    1134:	52                   	push   %edx
+    1135:	57                   	push   %edi
+    1136:	68 8a 24 00 00       	push   $0x248a
+    113b:	6a 02                	push   $0x2
+    113d:	e8 3e 09 00 00       	call   1a80 <printf>
+    exit();
+    1142:	e8 c9 03 00 00       	call   1510 <exit>
+    for(p = argv[1] + strlen(argv[1]); p > argv[1] && p[-1] != '/'; p--)
+    1147:	8b 56 04             	mov    0x4(%esi),%edx
+    114a:	83 ec 0c             	sub    $0xc,%esp
+    114d:	52                   	push   %edx
+    114e:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+    1151:	e8 6a 01 00 00       	call   12c0 <strlen>
+    1156:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+    1159:	83 c4 10             	add    $0x10,%esp
+    115c:	01 c2                	add    %eax,%edx
+    115e:	8b 46 04             	mov    0x4(%esi),%eax
+    1161:	eb 09                	jmp    116c <main+0x16c>
+    1163:	80 7a ff 2f          	cmpb   $0x2f,-0x1(%edx)
+    1167:	74 07                	je     1170 <main+0x170>
+    1169:	83 ea 01             	sub    $0x1,%edx
+    116c:	39 d0                	cmp    %edx,%eax
+    116e:	72 f3                	jb     1163 <main+0x163>
+    if(strlen(dst) + 1 + strlen(p) + 1 > sizeof(path)){
+    1170:	83 ec 0c             	sub    $0xc,%esp
+    1173:	89 55 b0             	mov    %edx,-0x50(%ebp)
+    1176:	57                   	push   %edi
+    1177:	e8 44 01 00 00       	call   12c0 <strlen>
+    117c:	8b 55 b0             	mov    -0x50(%ebp),%edx
+    117f:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    1182:	89 14 24             	mov    %edx,(%esp)
+    1185:	e8 36 01 00 00       	call   12c0 <strlen>
+    118a:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+    118d:	83 c4 10             	add    $0x10,%esp
+    1190:	8d 44 02 02          	lea    0x2(%edx,%eax,1),%eax
+    1194:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1199:	76 29                	jbe    11c4 <main+0x1c4>
+      printf(2, "cp: path too long\n");
+    119b:	51                   	push   %ecx
+    119c:	51                   	push   %ecx
+    119d:	68 75 24 00 00       	push   $0x2475
+    11a2:	6a 02                	push   $0x2
+    11a4:	e8 d7 08 00 00       	call   1a80 <printf>
+      exit();
+    11a9:	e8 62 03 00 00       	call   1510 <exit>
+    printf(2, "cp: copy to %s failed\n", dst);
+    11ae:	50                   	push   %eax
+    11af:	57                   	push   %edi
+    11b0:	68 a0 24 00 00       	push   $0x24a0
+    11b5:	6a 02                	push   $0x2
+    11b7:	e8 c4 08 00 00       	call   1a80 <printf>
+    11bc:	83 c4 10             	add    $0x10,%esp
+    11bf:	e9 13 ff ff ff       	jmp    10d7 <main+0xd7>
+    11c4:	8b 55 b0             	mov    -0x50(%ebp),%edx
+    11c7:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+    strcpy(path, dst);
+    11ca:	50                   	push   %eax
+    11cb:	50                   	push   %eax
+    11cc:	57                   	push   %edi
+    11cd:	68 40 2e 00 00       	push   $0x2e40
+    11d2:	e8 59 00 00 00       	call   1230 <strcpy>
+    strcpy(path + strlen(path), "/");
+    11d7:	c7 04 24 40 2e 00 00 	movl   $0x2e40,(%esp)
+    11de:	e8 dd 00 00 00       	call   12c0 <strlen>
+    11e3:	5a                   	pop    %edx
+    11e4:	59                   	pop    %ecx
+    11e5:	68 88 24 00 00       	push   $0x2488
+    11ea:	05 40 2e 00 00       	add    $0x2e40,%eax
+    11ef:	50                   	push   %eax
+    11f0:	e8 3b 00 00 00       	call   1230 <strcpy>
+    strcpy(path + strlen(path), p);
+    11f5:	c7 04 24 40 2e 00 00 	movl   $0x2e40,(%esp)
+    11fc:	e8 bf 00 00 00       	call   12c0 <strlen>
+    1201:	5f                   	pop    %edi
+    1202:	5a                   	pop    %edx
+    dst = path;
+    1203:	bf 40 2e 00 00       	mov    $0x2e40,%edi
+    strcpy(path + strlen(path), p);
+    1208:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+    120b:	05 40 2e 00 00       	add    $0x2e40,%eax
+    1210:	52                   	push   %edx
+    1211:	50                   	push   %eax
+    1212:	e8 19 00 00 00       	call   1230 <strcpy>
+    1217:	83 c4 10             	add    $0x10,%esp
+    dst = path;
+    121a:	8d 4d c0             	lea    -0x40(%ebp),%ecx
+    121d:	e9 6c fe ff ff       	jmp    108e <main+0x8e>
+    1222:	66 90                	xchg   %ax,%ax
+    1224:	66 90                	xchg   %ax,%ax
+    1226:	66 90                	xchg   %ax,%ax
+    1228:	66 90                	xchg   %ax,%ax
+    122a:	66 90                	xchg   %ax,%ax
+    122c:	66 90                	xchg   %ax,%ax
+    122e:	66 90                	xchg   %ax,%ax
+
+00001230 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1231:	31 c0                	xor    %eax,%eax
+{
+    1233:	89 e5                	mov    %esp,%ebp
+    1235:	53                   	push   %ebx
+    1236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    123c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1247:	83 c0 01             	add    $0x1,%eax
+    124a:	84 d2                	test   %dl,%dl
+    124c:	75 f2                	jne    1240 <strcpy+0x10>
+    ;
+  return os;
+}
+    124e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1251:	89 c8                	mov    %ecx,%eax
+    1253:	c9                   	leave
+    1254:	c3                   	ret
+    1255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	53                   	push   %ebx
+    1264:	8b 55 08             	mov    0x8(%ebp),%edx
+    1267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    126a:	0f b6 02             	movzbl (%edx),%eax
+    126d:	84 c0                	test   %al,%al
+    126f:	75 17                	jne    1288 <strcmp+0x28>
+    1271:	eb 3a                	jmp    12ad <strcmp+0x4d>
+    1273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1277:	90                   	nop
+    1278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    127c:	83 c2 01             	add    $0x1,%edx
+    127f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1282:	84 c0                	test   %al,%al
+    1284:	74 1a                	je     12a0 <strcmp+0x40>
+    p++, q++;
+    1286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1288:	0f b6 19             	movzbl (%ecx),%ebx
+    128b:	38 c3                	cmp    %al,%bl
+    128d:	74 e9                	je     1278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    128f:	29 d8                	sub    %ebx,%eax
+}
+    1291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1294:	c9                   	leave
+    1295:	c3                   	ret
+    1296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    12a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    12a4:	31 c0                	xor    %eax,%eax
+    12a6:	29 d8                	sub    %ebx,%eax
+}
+    12a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12ab:	c9                   	leave
+    12ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    12ad:	0f b6 19             	movzbl (%ecx),%ebx
+    12b0:	31 c0                	xor    %eax,%eax
+    12b2:	eb db                	jmp    128f <strcmp+0x2f>
+    12b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+
+000012c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    12c6:	80 3a 00             	cmpb   $0x0,(%edx)
+    12c9:	74 15                	je     12e0 <strlen+0x20>
+    12cb:	31 c0                	xor    %eax,%eax
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+    12d0:	83 c0 01             	add    $0x1,%eax
+    12d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    12d7:	89 c1                	mov    %eax,%ecx
+    12d9:	75 f5                	jne    12d0 <strlen+0x10>
+    ;
+  return n;
+}
+    12db:	89 c8                	mov    %ecx,%eax
+    12dd:	5d                   	pop    %ebp
+    12de:	c3                   	ret
+    12df:	90                   	nop
+  for(n = 0; s[n]; n++)
+    12e0:	31 c9                	xor    %ecx,%ecx
+}
+    12e2:	5d                   	pop    %ebp
+    12e3:	89 c8                	mov    %ecx,%eax
+    12e5:	c3                   	ret
+    12e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	57                   	push   %edi
+    12f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    12f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    12fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12fd:	89 d7                	mov    %edx,%edi
+    12ff:	fc                   	cld
+    1300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1305:	89 d0                	mov    %edx,%eax
+    1307:	c9                   	leave
+    1308:	c3                   	ret
+    1309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001310 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	8b 45 08             	mov    0x8(%ebp),%eax
+    1316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    131a:	0f b6 10             	movzbl (%eax),%edx
+    131d:	84 d2                	test   %dl,%dl
+    131f:	75 12                	jne    1333 <strchr+0x23>
+    1321:	eb 1d                	jmp    1340 <strchr+0x30>
+    1323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1327:	90                   	nop
+    1328:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    132c:	83 c0 01             	add    $0x1,%eax
+    132f:	84 d2                	test   %dl,%dl
+    1331:	74 0d                	je     1340 <strchr+0x30>
+    if(*s == c)
+    1333:	38 d1                	cmp    %dl,%cl
+    1335:	75 f1                	jne    1328 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1337:	5d                   	pop    %ebp
+    1338:	c3                   	ret
+    1339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1340:	31 c0                	xor    %eax,%eax
+}
+    1342:	5d                   	pop    %ebp
+    1343:	c3                   	ret
+    1344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    134f:	90                   	nop
+
+00001350 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	57                   	push   %edi
+    1354:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1355:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1358:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1359:	31 db                	xor    %ebx,%ebx
+{
+    135b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    135e:	eb 27                	jmp    1387 <gets+0x37>
+    cc = read(0, &c, 1);
+    1360:	83 ec 04             	sub    $0x4,%esp
+    1363:	6a 01                	push   $0x1
+    1365:	56                   	push   %esi
+    1366:	6a 00                	push   $0x0
+    1368:	e8 23 02 00 00       	call   1590 <read>
+    if(cc < 1)
+    136d:	83 c4 10             	add    $0x10,%esp
+    1370:	85 c0                	test   %eax,%eax
+    1372:	7e 1d                	jle    1391 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1378:	8b 55 08             	mov    0x8(%ebp),%edx
+    137b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    137f:	3c 0a                	cmp    $0xa,%al
+    1381:	74 10                	je     1393 <gets+0x43>
+    1383:	3c 0d                	cmp    $0xd,%al
+    1385:	74 0c                	je     1393 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1387:	89 df                	mov    %ebx,%edi
+    1389:	83 c3 01             	add    $0x1,%ebx
+    138c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    138f:	7c cf                	jl     1360 <gets+0x10>
+    1391:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1393:	8b 45 08             	mov    0x8(%ebp),%eax
+    1396:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    139a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    139d:	5b                   	pop    %ebx
+    139e:	5e                   	pop    %esi
+    139f:	5f                   	pop    %edi
+    13a0:	5d                   	pop    %ebp
+    13a1:	c3                   	ret
+    13a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000013b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    13b0:	55                   	push   %ebp
+    13b1:	89 e5                	mov    %esp,%ebp
+    13b3:	56                   	push   %esi
+    13b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    13b5:	83 ec 08             	sub    $0x8,%esp
+    13b8:	6a 00                	push   $0x0
+    13ba:	ff 75 08             	push   0x8(%ebp)
+    13bd:	e8 19 02 00 00       	call   15db <open>
+  if(fd < 0)
+    13c2:	83 c4 10             	add    $0x10,%esp
+    13c5:	85 c0                	test   %eax,%eax
+    13c7:	78 27                	js     13f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    13c9:	83 ec 08             	sub    $0x8,%esp
+    13cc:	ff 75 0c             	push   0xc(%ebp)
+    13cf:	89 c3                	mov    %eax,%ebx
+    13d1:	50                   	push   %eax
+    13d2:	e8 31 02 00 00       	call   1608 <fstat>
+  close(fd);
+    13d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    13da:	89 c6                	mov    %eax,%esi
+  close(fd);
+    13dc:	e8 cd 01 00 00       	call   15ae <close>
+  return r;
+    13e1:	83 c4 10             	add    $0x10,%esp
+}
+    13e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13e7:	89 f0                	mov    %esi,%eax
+    13e9:	5b                   	pop    %ebx
+    13ea:	5e                   	pop    %esi
+    13eb:	5d                   	pop    %ebp
+    13ec:	c3                   	ret
+    13ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    13f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13f5:	eb ed                	jmp    13e4 <stat+0x34>
+    13f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fe:	66 90                	xchg   %ax,%ax
+
+00001400 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	53                   	push   %ebx
+    1404:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1407:	0f be 02             	movsbl (%edx),%eax
+    140a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    140d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1410:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1415:	77 1e                	ja     1435 <atoi+0x35>
+    1417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1420:	83 c2 01             	add    $0x1,%edx
+    1423:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1426:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    142a:	0f be 02             	movsbl (%edx),%eax
+    142d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1430:	80 fb 09             	cmp    $0x9,%bl
+    1433:	76 eb                	jbe    1420 <atoi+0x20>
+  return n;
+}
+    1435:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1438:	89 c8                	mov    %ecx,%eax
+    143a:	c9                   	leave
+    143b:	c3                   	ret
+    143c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001440 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	57                   	push   %edi
+    1444:	56                   	push   %esi
+    1445:	8b 45 10             	mov    0x10(%ebp),%eax
+    1448:	8b 55 08             	mov    0x8(%ebp),%edx
+    144b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    144e:	85 c0                	test   %eax,%eax
+    1450:	7e 13                	jle    1465 <memmove+0x25>
+    1452:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1454:	89 d7                	mov    %edx,%edi
+    1456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1460:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1461:	39 f8                	cmp    %edi,%eax
+    1463:	75 fb                	jne    1460 <memmove+0x20>
+  return vdst;
+}
+    1465:	5e                   	pop    %esi
+    1466:	89 d0                	mov    %edx,%eax
+    1468:	5f                   	pop    %edi
+    1469:	5d                   	pop    %ebp
+    146a:	c3                   	ret
+    146b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    146f:	90                   	nop
+
+00001470 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1470:	55                   	push   %ebp
+    1471:	89 e5                	mov    %esp,%ebp
+    1473:	56                   	push   %esi
+    1474:	53                   	push   %ebx
+    1475:	8b 75 10             	mov    0x10(%ebp),%esi
+    1478:	8b 55 08             	mov    0x8(%ebp),%edx
+    147b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    147e:	85 f6                	test   %esi,%esi
+    1480:	74 2e                	je     14b0 <memcmp+0x40>
+    1482:	01 c6                	add    %eax,%esi
+    1484:	eb 14                	jmp    149a <memcmp+0x2a>
+    1486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1490:	83 c0 01             	add    $0x1,%eax
+    1493:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1496:	39 f0                	cmp    %esi,%eax
+    1498:	74 16                	je     14b0 <memcmp+0x40>
+    if(*s1 != *s2)
+    149a:	0f b6 0a             	movzbl (%edx),%ecx
+    149d:	0f b6 18             	movzbl (%eax),%ebx
+    14a0:	38 d9                	cmp    %bl,%cl
+    14a2:	74 ec                	je     1490 <memcmp+0x20>
+      return *s1 - *s2;
+    14a4:	0f b6 c1             	movzbl %cl,%eax
+    14a7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    14a9:	5b                   	pop    %ebx
+    14aa:	5e                   	pop    %esi
+    14ab:	5d                   	pop    %ebp
+    14ac:	c3                   	ret
+    14ad:	8d 76 00             	lea    0x0(%esi),%esi
+    14b0:	5b                   	pop    %ebx
+  return 0;
+    14b1:	31 c0                	xor    %eax,%eax
+}
+    14b3:	5e                   	pop    %esi
+    14b4:	5d                   	pop    %ebp
+    14b5:	c3                   	ret
+    14b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014c0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    14c0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    14c5:	c3                   	ret
+    14c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014d0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    14d0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    14d5:	c3                   	ret
+    14d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014e0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    14e0:	a1 40 30 00 00       	mov    0x3040,%eax
+    14e5:	85 c0                	test   %eax,%eax
+    14e7:	74 17                	je     1500 <fork+0x20>
+{
+    14e9:	55                   	push   %ebp
+    14ea:	89 e5                	mov    %esp,%ebp
+    14ec:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    14ef:	ff d0                	call   *%eax
+  return _fork();
+}
+    14f1:	c9                   	leave
+  return _fork();
+    14f2:	e9 5d 00 00 00       	jmp    1554 <_fork>
+    14f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14fe:	66 90                	xchg   %ax,%ax
+    1500:	e9 4f 00 00 00       	jmp    1554 <_fork>
+    1505:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001510 <exit>:
+
+int
+exit(void)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1516:	a1 40 30 00 00       	mov    0x3040,%eax
+    151b:	85 c0                	test   %eax,%eax
+    151d:	74 02                	je     1521 <exit+0x11>
+    flushhook();
+    151f:	ff d0                	call   *%eax
+  _exit();
+    1521:	e8 3d 00 00 00       	call   1563 <_exit>
+    1526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001530 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1530:	55                   	push   %ebp
+  if(flushhook)
+    1531:	a1 40 30 00 00       	mov    0x3040,%eax
+{
+    1536:	89 e5                	mov    %esp,%ebp
+    1538:	56                   	push   %esi
+    1539:	53                   	push   %ebx
+    153a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    153d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1540:	85 c0                	test   %eax,%eax
+    1542:	74 02                	je     1546 <exec+0x16>
+    flushhook();
+    1544:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1546:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1549:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    154c:	5b                   	pop    %ebx
+    154d:	5e                   	pop    %esi
+    154e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    154f:	e9 78 00 00 00       	jmp    15cc <_exec>
+
+00001554 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1554:	b8 01 00 00 00       	mov    $0x1,%eax
+    1559:	89 e1                	mov    %esp,%ecx
+    155b:	ba 62 15 00 00       	mov    $0x1562,%edx
+    1560:	0f 34                	sysenter
+    1562:	c3                   	ret
+
+00001563 <_exit>:
+RAWSYSCALL(exit)
+    1563:	b8 02 00 00 00       	mov    $0x2,%eax
+    1568:	89 e1                	mov    %esp,%ecx
+    156a:	ba 71 15 00 00       	mov    $0x1571,%edx
+    156f:	0f 34                	sysenter
+    1571:	c3                   	ret
+
+00001572 <wait>:
+SYSCALL(wait)
+    1572:	b8 03 00 00 00       	mov    $0x3,%eax
+    1577:	89 e1                	mov    %esp,%ecx
+    1579:	ba 80 15 00 00       	mov    $0x1580,%edx
+    157e:	0f 34                	sysenter
+    1580:	c3                   	ret
+
+00001581 <pipe>:
+SYSCALL(pipe)
+    1581:	b8 04 00 00 00       	mov    $0x4,%eax
+    1586:	89 e1                	mov    %esp,%ecx
+    1588:	ba 8f 15 00 00       	mov    $0x158f,%edx
+    158d:	0f 34                	sysenter
+    158f:	c3                   	ret
+
+00001590 <read>:
+SYSCALL(read)
+    1590:	b8 05 00 00 00       	mov    $0x5,%eax
+    1595:	89 e1                	mov    %esp,%ecx
+    1597:	ba 9e 15 00 00       	mov    $0x159e,%edx
+    159c:	0f 34                	sysenter
+    159e:	c3                   	ret
+
+0000159f <write>:
+SYSCALL(write)
+    159f:	b8 10 00 00 00       	mov    $0x10,%eax
+    15a4:	89 e1                	mov    %esp,%ecx
+    15a6:	ba ad 15 00 00       	mov    $0x15ad,%edx
+    15ab:	0f 34                	sysenter
+    15ad:	c3                   	ret
+
+000015ae <close>:
+SYSCALL(close)
+    15ae:	b8 15 00 00 00       	mov    $0x15,%eax
+    15b3:	89 e1                	mov    %esp,%ecx
+    15b5:	ba bc 15 00 00       	mov    $0x15bc,%edx
+    15ba:	0f 34                	sysenter
+    15bc:	c3                   	ret
+
+000015bd <kill>:
+SYSCALL(kill)
+    15bd:	b8 06 00 00 00       	mov    $0x6,%eax
+    15c2:	89 e1                	mov    %esp,%ecx
+    15c4:	ba cb 15 00 00       	mov    $0x15cb,%edx
+    15c9:	0f 34                	sysenter
+    15cb:	c3                   	ret
+
+000015cc <_exec>:
+RAWSYSCALL(exec)
+    15cc:	b8 07 00 00 00       	mov    $0x7,%eax
+    15d1:	89 e1                	mov    %esp,%ecx
+    15d3:	ba da 15 00 00       	mov    $0x15da,%edx
+    15d8:	0f 34                	sysenter
+    15da:	c3                   	ret
+
+000015db <open>:
+SYSCALL(open)
+    15db:	b8 0f 00 00 00       	mov    $0xf,%eax
+    15e0:	89 e1                	mov    %esp,%ecx
+    15e2:	ba e9 15 00 00       	mov    $0x15e9,%edx
+    15e7:	0f 34                	sysenter
+    15e9:	c3                   	ret
+
+000015ea <mknod>:
+SYSCALL(mknod)
+    15ea:	b8 11 00 00 00       	mov    $0x11,%eax
+    15ef:	89 e1                	mov    %esp,%ecx
+    15f1:	ba f8 15 00 00       	mov    $0x15f8,%edx
+    15f6:	0f 34                	sysenter
+    15f8:	c3                   	ret
+
+000015f9 <unlink>:
+SYSCALL(unlink)
+    15f9:	b8 12 00 00 00       	mov    $0x12,%eax
+    15fe:	89 e1                	mov    %esp,%ecx
+    1600:	ba 07 16 00 00       	mov    $0x1607,%edx
+    1605:	0f 34                	sysenter
+    1607:	c3                   	ret
+
+00001608 <fstat>:
+SYSCALL(fstat)
+    1608:	b8 08 00 00 00       	mov    $0x8,%eax
+    160d:	89 e1                	mov    %esp,%ecx
+    160f:	ba 16 16 00 00       	mov    $0x1616,%edx
+    1614:	0f 34                	sysenter
+    1616:	c3                   	ret
+
+00001617 <link>:
+SYSCALL(link)
+    1617:	b8 13 00 00 00       	mov    $0x13,%eax
+    161c:	89 e1                	mov    %esp,%ecx
+    161e:	ba 25 16 00 00       	mov    $0x1625,%edx
+    1623:	0f 34                	sysenter
+    1625:	c3                   	ret
+
+00001626 <mkdir>:
+SYSCALL(mkdir)
+    1626:	b8 14 00 00 00       	mov    $0x14,%eax
+    162b:	89 e1                	mov    %esp,%ecx
+    162d:	ba 34 16 00 00       	mov    $0x1634,%edx
+    1632:	0f 34                	sysenter
+    1634:	c3                   	ret
+
+00001635 <chdir>:
+SYSCALL(chdir)
+    1635:	b8 09 00 00 00       	mov    $0x9,%eax
+    163a:	89 e1                	mov    %esp,%ecx
+    163c:	ba 43 16 00 00       	mov    $0x1643,%edx
+    1641:	0f 34                	sysenter
+    1643:	c3                   	ret
+
+00001644 <dup>:
+SYSCALL(dup)
+    1644:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1649:	89 e1                	mov    %esp,%ecx
+    164b:	ba 52 16 00 00       	mov    $0x1652,%edx
+    1650:	0f 34                	sysenter
+    1652:	c3                   	ret
+
+00001653 <getpid>:
+SYSCALL(getpid)
+    1653:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1658:	89 e1                	mov    %esp,%ecx
+    165a:	ba 61 16 00 00       	mov    $0x1661,%edx
+    165f:	0f 34                	sysenter
+    1661:	c3                   	ret
+
+00001662 <sbrk>:
+SYSCALL(sbrk)
+    1662:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1667:	89 e1                	mov    %esp,%ecx
+    1669:	ba 70 16 00 00       	mov    $0x1670,%edx
+    166e:	0f 34                	sysenter
+    1670:	c3                   	ret
+
+00001671 <sleep>:
+SYSCALL(sleep)
+    1671:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1676:	89 e1                	mov    %esp,%ecx
+    1678:	ba 7f 16 00 00       	mov    $0x167f,%edx
+    167d:	0f 34                	sysenter
+    167f:	c3                   	ret
+
+00001680 <uptime>:
+SYSCALL(uptime)
+    1680:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1685:	89 e1                	mov    %esp,%ecx
+    1687:	ba 8e 16 00 00       	mov    $0x168e,%edx
+    168c:	0f 34                	sysenter
+    168e:	c3                   	ret
+
+0000168f <mprotect>:
+SYSCALL(mprotect)
+    168f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1694:	89 e1                	mov    %esp,%ecx
+    1696:	ba 9d 16 00 00       	mov    $0x169d,%edx
+    169b:	0f 34                	sysenter
+    169d:	c3                   	ret
+
+0000169e <munprotect>:
+SYSCALL(munprotect)
+    169e:	b8 17 00 00 00       	mov    $0x17,%eax
+    16a3:	89 e1                	mov    %esp,%ecx
+    16a5:	ba ac 16 00 00       	mov    $0x16ac,%edx
+    16aa:	0f 34                	sysenter
+    16ac:	c3                   	ret
+
+000016ad <kstat>:
+SYSCALL(kstat)
+    16ad:	b8 18 00 00 00       	mov    $0x18,%eax
+    16b2:	89 e1                	mov    %esp,%ecx
+    16b4:	ba bb 16 00 00       	mov    $0x16bb,%edx
+    16b9:	0f 34                	sysenter
+    16bb:	c3                   	ret
+
+000016bc <fcntl>:
+SYSCALL(fcntl)
+    16bc:	b8 19 00 00 00       	mov    $0x19,%eax
+    16c1:	89 e1                	mov    %esp,%ecx
+    16c3:	ba ca 16 00 00       	mov    $0x16ca,%edx
+    16c8:	0f 34                	sysenter
+    16ca:	c3                   	ret
+
+000016cb <splice>:
+SYSCALL(splice)
+    16cb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    16d0:	89 e1                	mov    %esp,%ecx
+    16d2:	ba d9 16 00 00       	mov    $0x16d9,%edx
+    16d7:	0f 34                	sysenter
+    16d9:	c3                   	ret
+
+000016da <sendfile>:
+SYSCALL(sendfile)
+    16da:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    16df:	89 e1                	mov    %esp,%ecx
+    16e1:	ba e8 16 00 00       	mov    $0x16e8,%edx
+    16e6:	0f 34                	sysenter
+    16e8:	c3                   	ret
+
+000016e9 <lseek>:
+SYSCALL(lseek)
+    16e9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    16ee:	89 e1                	mov    %esp,%ecx
+    16f0:	ba f7 16 00 00       	mov    $0x16f7,%edx
+    16f5:	0f 34                	sysenter
+    16f7:	c3                   	ret
+
+000016f8 <pread>:
+SYSCALL(pread)
+    16f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    16fd:	89 e1                	mov    %esp,%ecx
+    16ff:	ba 06 17 00 00       	mov    $0x1706,%edx
+    1704:	0f 34                	sysenter
+    1706:	c3                   	ret
+
+00001707 <pwrite>:
+SYSCALL(pwrite)
+    1707:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    170c:	89 e1                	mov    %esp,%ecx
+    170e:	ba 15 17 00 00       	mov    $0x1715,%edx
+    1713:	0f 34                	sysenter
+    1715:	c3                   	ret
+
+00001716 <readv>:
+SYSCALL(readv)
+    1716:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    171b:	89 e1                	mov    %esp,%ecx
+    171d:	ba 24 17 00 00       	mov    $0x1724,%edx
+    1722:	0f 34                	sysenter
+    1724:	c3                   	ret
+
+00001725 <writev>:
+SYSCALL(writev)
+    1725:	b8 20 00 00 00       	mov    $0x20,%eax
+    172a:	89 e1                	mov    %esp,%ecx
+    172c:	ba 33 17 00 00       	mov    $0x1733,%edx
+    1731:	0f 34                	sysenter
+    1733:	c3                   	ret
+
+00001734 <ringsetup>:
+SYSCALL(ringsetup)
+    1734:	b8 21 00 00 00       	mov    $0x21,%eax
+    1739:	89 e1                	mov    %esp,%ecx
+    173b:	ba 42 17 00 00       	mov    $0x1742,%edx
+    1740:	0f 34                	sysenter
+    1742:	c3                   	ret
+
+00001743 <ringenter>:
+SYSCALL(ringenter)
+    1743:	b8 22 00 00 00       	mov    $0x22,%eax
+    1748:	89 e1                	mov    %esp,%ecx
+    174a:	ba 51 17 00 00       	mov    $0x1751,%edx
+    174f:	0f 34                	sysenter
+    1751:	c3                   	ret
+
+00001752 <intgetpid>:
+INTSYSCALL(getpid)
+    1752:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1757:	cd 40                	int    $0x40
+    1759:	c3                   	ret
+    175a:	66 90                	xchg   %ax,%ax
+    175c:	66 90                	xchg   %ax,%ax
+    175e:	66 90                	xchg   %ax,%ax
+
+00001760 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1760:	55                   	push   %ebp
+    1761:	89 e5                	mov    %esp,%ebp
+    1763:	57                   	push   %edi
+    1764:	56                   	push   %esi
+    1765:	53                   	push   %ebx
+    1766:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1768:	89 d1                	mov    %edx,%ecx
+{
+    176a:	83 ec 2c             	sub    $0x2c,%esp
+    176d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1770:	85 d2                	test   %edx,%edx
+    1772:	0f 89 c0 00 00 00    	jns    1838 <printint+0xd8>
+    1778:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    177c:	0f 84 b6 00 00 00    	je     1838 <printint+0xd8>
+    x = -xx;
+    1782:	f7 d9                	neg    %ecx
+    neg = 1;
+    1784:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1789:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    178c:	31 f6                	xor    %esi,%esi
+    178e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1790:	89 c8                	mov    %ecx,%eax
+    1792:	31 d2                	xor    %edx,%edx
+    1794:	89 f7                	mov    %esi,%edi
+    1796:	f7 f3                	div    %ebx
+    1798:	8d 76 01             	lea    0x1(%esi),%esi
+    179b:	0f b6 92 38 25 00 00 	movzbl 0x2538(%edx),%edx
+    17a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    17a6:	89 ca                	mov    %ecx,%edx
+    17a8:	89 c1                	mov    %eax,%ecx
+    17aa:	39 da                	cmp    %ebx,%edx
+    17ac:	73 e2                	jae    1790 <printint+0x30>
+  if(neg)
+    17ae:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    17b1:	85 c0                	test   %eax,%eax
+    17b3:	74 07                	je     17bc <printint+0x5c>
+    buf[i++] = '-';
+    17b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    17ba:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    17bc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    17bf:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    17c2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    17c4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    17c7:	8b 41 08             	mov    0x8(%ecx),%eax
+    17ca:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    17cd:	89 ce                	mov    %ecx,%esi
+    17cf:	eb 1c                	jmp    17ed <printint+0x8d>
+    17d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    17d8:	89 c1                	mov    %eax,%ecx
+    17da:	83 c0 01             	add    $0x1,%eax
+    17dd:	89 46 08             	mov    %eax,0x8(%esi)
+    17e0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    17e4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    17e7:	39 df                	cmp    %ebx,%edi
+    17e9:	74 41                	je     182c <printint+0xcc>
+    17eb:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    17ed:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    17f0:	3d 80 00 00 00       	cmp    $0x80,%eax
+    17f5:	75 e1                	jne    17d8 <printint+0x78>
+  if(o->f)
+    17f7:	8b 06                	mov    (%esi),%eax
+    17f9:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    17fc:	85 c0                	test   %eax,%eax
+    17fe:	74 40                	je     1840 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1800:	50                   	push   %eax
+    1801:	68 80 00 00 00       	push   $0x80
+    1806:	6a 01                	push   $0x1
+    1808:	ff 75 d4             	push   -0x2c(%ebp)
+    180b:	e8 a0 04 00 00       	call   1cb0 <fwrite>
+    1810:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1814:	83 c4 10             	add    $0x10,%esp
+}
+    1817:	b8 01 00 00 00       	mov    $0x1,%eax
+    181c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    181e:	89 46 08             	mov    %eax,0x8(%esi)
+    1821:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1825:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1828:	39 df                	cmp    %ebx,%edi
+    182a:	75 bf                	jne    17eb <printint+0x8b>
+}
+    182c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    182f:	5b                   	pop    %ebx
+    1830:	5e                   	pop    %esi
+    1831:	5f                   	pop    %edi
+    1832:	5d                   	pop    %ebp
+    1833:	c3                   	ret
+    1834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1838:	31 c0                	xor    %eax,%eax
+    183a:	e9 4a ff ff ff       	jmp    1789 <printint+0x29>
+    183f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1840:	83 ec 04             	sub    $0x4,%esp
+    1843:	68 80 00 00 00       	push   $0x80
+    1848:	ff 75 d4             	push   -0x2c(%ebp)
+    184b:	ff 76 04             	push   0x4(%esi)
+    184e:	e8 4c fd ff ff       	call   159f <write>
+    1853:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1857:	83 c4 10             	add    $0x10,%esp
+    185a:	eb bb                	jmp    1817 <printint+0xb7>
+    185c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001860 <putc>:
+{
+    1860:	55                   	push   %ebp
+    1861:	89 e5                	mov    %esp,%ebp
+    1863:	56                   	push   %esi
+    1864:	89 d6                	mov    %edx,%esi
+    1866:	53                   	push   %ebx
+    1867:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1869:	8b 40 08             	mov    0x8(%eax),%eax
+    186c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1871:	74 1d                	je     1890 <putc+0x30>
+  o->buf[o->n++] = c;
+    1873:	89 f1                	mov    %esi,%ecx
+    1875:	8d 50 01             	lea    0x1(%eax),%edx
+    1878:	89 53 08             	mov    %edx,0x8(%ebx)
+    187b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    187f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1882:	5b                   	pop    %ebx
+    1883:	5e                   	pop    %esi
+    1884:	5d                   	pop    %ebp
+    1885:	c3                   	ret
+    1886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    188d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1890:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1892:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1895:	85 c0                	test   %eax,%eax
+    1897:	74 2f                	je     18c8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1899:	50                   	push   %eax
+    189a:	68 80 00 00 00       	push   $0x80
+    189f:	6a 01                	push   $0x1
+    18a1:	52                   	push   %edx
+    18a2:	e8 09 04 00 00       	call   1cb0 <fwrite>
+    18a7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    18aa:	89 f1                	mov    %esi,%ecx
+}
+    18ac:	ba 01 00 00 00       	mov    $0x1,%edx
+    18b1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    18b3:	89 53 08             	mov    %edx,0x8(%ebx)
+    18b6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    18ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    18bd:	5b                   	pop    %ebx
+    18be:	5e                   	pop    %esi
+    18bf:	5d                   	pop    %ebp
+    18c0:	c3                   	ret
+    18c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    18c8:	83 ec 04             	sub    $0x4,%esp
+    18cb:	68 80 00 00 00       	push   $0x80
+    18d0:	52                   	push   %edx
+    18d1:	ff 73 04             	push   0x4(%ebx)
+    18d4:	e8 c6 fc ff ff       	call   159f <write>
+    18d9:	83 c4 10             	add    $0x10,%esp
+    18dc:	eb cc                	jmp    18aa <putc+0x4a>
+    18de:	66 90                	xchg   %ax,%ax
+
+000018e0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    18e0:	55                   	push   %ebp
+    18e1:	89 e5                	mov    %esp,%ebp
+    18e3:	57                   	push   %edi
+    18e4:	89 c7                	mov    %eax,%edi
+    18e6:	56                   	push   %esi
+    18e7:	31 f6                	xor    %esi,%esi
+    18e9:	53                   	push   %ebx
+    18ea:	8d 5a 01             	lea    0x1(%edx),%ebx
+    18ed:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    18f0:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    18f3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    18f6:	84 c0                	test   %al,%al
+    18f8:	75 1e                	jne    1918 <vprintf.constprop.0+0x38>
+    18fa:	eb 53                	jmp    194f <vprintf.constprop.0+0x6f>
+    18fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1900:	83 f8 25             	cmp    $0x25,%eax
+    1903:	74 3b                	je     1940 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1905:	89 ca                	mov    %ecx,%edx
+    1907:	89 f8                	mov    %edi,%eax
+    1909:	e8 52 ff ff ff       	call   1860 <putc>
+  for(i = 0; fmt[i]; i++){
+    190e:	0f b6 03             	movzbl (%ebx),%eax
+    1911:	83 c3 01             	add    $0x1,%ebx
+    1914:	84 c0                	test   %al,%al
+    1916:	74 37                	je     194f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1918:	0f be c8             	movsbl %al,%ecx
+    191b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    191e:	85 f6                	test   %esi,%esi
+    1920:	74 de                	je     1900 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1922:	83 fe 25             	cmp    $0x25,%esi
+    1925:	75 e7                	jne    190e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1927:	83 f8 25             	cmp    $0x25,%eax
+    192a:	74 4e                	je     197a <vprintf.constprop.0+0x9a>
+    192c:	83 e8 63             	sub    $0x63,%eax
+    192f:	83 f8 15             	cmp    $0x15,%eax
+    1932:	77 34                	ja     1968 <vprintf.constprop.0+0x88>
+    1934:	ff 24 85 e0 24 00 00 	jmp    *0x24e0(,%eax,4)
+    193b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    193f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1940:	0f b6 03             	movzbl (%ebx),%eax
+    1943:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1946:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    194b:	84 c0                	test   %al,%al
+    194d:	75 c9                	jne    1918 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    194f:	8b 47 08             	mov    0x8(%edi),%eax
+    1952:	85 c0                	test   %eax,%eax
+    1954:	0f 8f de 00 00 00    	jg     1a38 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    195a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    195d:	5b                   	pop    %ebx
+    195e:	5e                   	pop    %esi
+    195f:	5f                   	pop    %edi
+    1960:	5d                   	pop    %ebp
+    1961:	c3                   	ret
+    1962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1968:	ba 25 00 00 00       	mov    $0x25,%edx
+    196d:	89 f8                	mov    %edi,%eax
+    196f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1972:	e8 e9 fe ff ff       	call   1860 <putc>
+        putc(o, c);
+    1977:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    197a:	89 ca                	mov    %ecx,%edx
+    197c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    197e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1980:	e8 db fe ff ff       	call   1860 <putc>
+    1985:	eb 87                	jmp    190e <vprintf.constprop.0+0x2e>
+    1987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1990:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1993:	83 ec 0c             	sub    $0xc,%esp
+    1996:	b9 10 00 00 00       	mov    $0x10,%ecx
+    199b:	8b 16                	mov    (%esi),%edx
+    199d:	6a 00                	push   $0x0
+        ap++;
+    199f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    19a2:	89 f8                	mov    %edi,%eax
+    19a4:	e8 b7 fd ff ff       	call   1760 <printint>
+        ap++;
+    19a9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    19ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    19af:	31 f6                	xor    %esi,%esi
+    19b1:	e9 58 ff ff ff       	jmp    190e <vprintf.constprop.0+0x2e>
+    19b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    19c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19c3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    19c5:	83 c0 04             	add    $0x4,%eax
+    19c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    19cb:	85 f6                	test   %esi,%esi
+    19cd:	75 1b                	jne    19ea <vprintf.constprop.0+0x10a>
+    19cf:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    19d4:	be d9 24 00 00       	mov    $0x24d9,%esi
+    19d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    19e0:	89 f8                	mov    %edi,%eax
+          s++;
+    19e2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    19e5:	e8 76 fe ff ff       	call   1860 <putc>
+        while(*s != 0){
+    19ea:	0f be 16             	movsbl (%esi),%edx
+    19ed:	84 d2                	test   %dl,%dl
+    19ef:	75 ef                	jne    19e0 <vprintf.constprop.0+0x100>
+      state = 0;
+    19f1:	31 f6                	xor    %esi,%esi
+    19f3:	e9 16 ff ff ff       	jmp    190e <vprintf.constprop.0+0x2e>
+    19f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19ff:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1a00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1a03:	83 ec 0c             	sub    $0xc,%esp
+    1a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1a0b:	8b 16                	mov    (%esi),%edx
+    1a0d:	6a 01                	push   $0x1
+    1a0f:	eb 8e                	jmp    199f <vprintf.constprop.0+0xbf>
+    1a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1a18:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1a1b:	89 f8                	mov    %edi,%eax
+    1a1d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1a20:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1a23:	e8 38 fe ff ff       	call   1860 <putc>
+        ap++;
+    1a28:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    1a2b:	31 f6                	xor    %esi,%esi
+    1a2d:	e9 dc fe ff ff       	jmp    190e <vprintf.constprop.0+0x2e>
+    1a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1a38:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    1a3a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    1a3d:	85 d2                	test   %edx,%edx
+    1a3f:	74 1f                	je     1a60 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1a41:	52                   	push   %edx
+    1a42:	50                   	push   %eax
+    1a43:	6a 01                	push   $0x1
+    1a45:	51                   	push   %ecx
+    1a46:	e8 65 02 00 00       	call   1cb0 <fwrite>
+    1a4b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1a4e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a58:	5b                   	pop    %ebx
+    1a59:	5e                   	pop    %esi
+    1a5a:	5f                   	pop    %edi
+    1a5b:	5d                   	pop    %ebp
+    1a5c:	c3                   	ret
+    1a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1a60:	83 ec 04             	sub    $0x4,%esp
+    1a63:	50                   	push   %eax
+    1a64:	51                   	push   %ecx
+    1a65:	ff 77 04             	push   0x4(%edi)
+    1a68:	e8 32 fb ff ff       	call   159f <write>
+    1a6d:	83 c4 10             	add    $0x10,%esp
+    1a70:	eb dc                	jmp    1a4e <vprintf.constprop.0+0x16e>
+    1a72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a80 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1a80:	55                   	push   %ebp
+    1a81:	89 e5                	mov    %esp,%ebp
+    1a83:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a89:	a1 e4 2b 00 00       	mov    0x2be4,%eax
+{
+    1a8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a91:	83 fa 01             	cmp    $0x1,%edx
+    1a94:	74 0c                	je     1aa2 <printf+0x22>
+    1a96:	31 c0                	xor    %eax,%eax
+    1a98:	83 fa 02             	cmp    $0x2,%edx
+    1a9b:	0f 44 05 e0 2b 00 00 	cmove  0x2be0,%eax
+  o.fd = fd;
+    1aa2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1aa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1aab:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1aae:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1ab4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1aba:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1ac1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1ac4:	e8 17 fe ff ff       	call   18e0 <vprintf.constprop.0>
+}
+    1ac9:	c9                   	leave
+    1aca:	c3                   	ret
+    1acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1acf:	90                   	nop
+
+00001ad0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1ad0:	55                   	push   %ebp
+    1ad1:	89 e5                	mov    %esp,%ebp
+    1ad3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1ad9:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1adc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1adf:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1ae2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1ae9:	ff ff ff 
+  o.n = 0;
+    1aec:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1af3:	00 00 00 
+  o.f = f;
+    1af6:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1afc:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1b02:	e8 d9 fd ff ff       	call   18e0 <vprintf.constprop.0>
+}
+    1b07:	c9                   	leave
+    1b08:	c3                   	ret
+    1b09:	66 90                	xchg   %ax,%ax
+    1b0b:	66 90                	xchg   %ax,%ax
+    1b0d:	66 90                	xchg   %ax,%ax
+    1b0f:	90                   	nop
+
+00001b10 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1b10:	55                   	push   %ebp
+    1b11:	89 e5                	mov    %esp,%ebp
+    1b13:	53                   	push   %ebx
+    1b14:	89 c3                	mov    %eax,%ebx
+    1b16:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1b19:	8b 40 0c             	mov    0xc(%eax),%eax
+    1b1c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1b1f:	74 17                	je     1b38 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1b21:	83 f8 02             	cmp    $0x2,%eax
+    1b24:	74 07                	je     1b2d <setmode+0x1d>
+    1b26:	8b 43 18             	mov    0x18(%ebx),%eax
+    1b29:	85 c0                	test   %eax,%eax
+    1b2b:	74 38                	je     1b65 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1b2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1b30:	c9                   	leave
+    1b31:	c3                   	ret
+    1b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1b38:	83 ec 08             	sub    $0x8,%esp
+    1b3b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1b3e:	50                   	push   %eax
+    1b3f:	ff 33                	push   (%ebx)
+    1b41:	e8 c2 fa ff ff       	call   1608 <fstat>
+    1b46:	83 c4 10             	add    $0x10,%esp
+    1b49:	89 c2                	mov    %eax,%edx
+    1b4b:	31 c0                	xor    %eax,%eax
+    1b4d:	85 d2                	test   %edx,%edx
+    1b4f:	75 0a                	jne    1b5b <setmode+0x4b>
+    1b51:	31 c0                	xor    %eax,%eax
+    1b53:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1b58:	0f 94 c0             	sete   %al
+    1b5b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1b5e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1b61:	85 c0                	test   %eax,%eax
+    1b63:	75 c8                	jne    1b2d <setmode+0x1d>
+    1b65:	83 ec 0c             	sub    $0xc,%esp
+    1b68:	68 00 04 00 00       	push   $0x400
+    1b6d:	e8 de 07 00 00       	call   2350 <malloc>
+    1b72:	83 c4 10             	add    $0x10,%esp
+    1b75:	89 43 18             	mov    %eax,0x18(%ebx)
+    1b78:	85 c0                	test   %eax,%eax
+    1b7a:	75 b1                	jne    1b2d <setmode+0x1d>
+    f->mode = IONBF;
+    1b7c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1b83:	eb a8                	jmp    1b2d <setmode+0x1d>
+    1b85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b90 <drain>:
+{
+    1b90:	55                   	push   %ebp
+    1b91:	89 e5                	mov    %esp,%ebp
+    1b93:	57                   	push   %edi
+    1b94:	56                   	push   %esi
+    1b95:	53                   	push   %ebx
+    1b96:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1b99:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1b9c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1b9f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1ba6:	85 ff                	test   %edi,%edi
+    1ba8:	7f 0e                	jg     1bb8 <drain+0x28>
+  return 0;
+    1baa:	31 c0                	xor    %eax,%eax
+}
+    1bac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1baf:	5b                   	pop    %ebx
+    1bb0:	5e                   	pop    %esi
+    1bb1:	5f                   	pop    %edi
+    1bb2:	5d                   	pop    %ebp
+    1bb3:	c3                   	ret
+    1bb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1bb8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bbb:	8b 58 18             	mov    0x18(%eax),%ebx
+    1bbe:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1bc0:	eb 0e                	jmp    1bd0 <drain+0x40>
+    1bc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1bc8:	29 c7                	sub    %eax,%edi
+    1bca:	01 c3                	add    %eax,%ebx
+    1bcc:	85 ff                	test   %edi,%edi
+    1bce:	7e da                	jle    1baa <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1bd0:	83 ec 04             	sub    $0x4,%esp
+    1bd3:	57                   	push   %edi
+    1bd4:	53                   	push   %ebx
+    1bd5:	56                   	push   %esi
+    1bd6:	e8 c4 f9 ff ff       	call   159f <write>
+    1bdb:	83 c4 10             	add    $0x10,%esp
+    1bde:	85 c0                	test   %eax,%eax
+    1be0:	7f e6                	jg     1bc8 <drain+0x38>
+    f->err = 1;
+    1be2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1be5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1bec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1bf1:	eb b9                	jmp    1bac <drain+0x1c>
+    1bf3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001c00 <flushall>:
+
+static void
+flushall(void)
+{
+    1c00:	55                   	push   %ebp
+    1c01:	89 e5                	mov    %esp,%ebp
+    1c03:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c04:	bb 00 2c 00 00       	mov    $0x2c00,%ebx
+{
+    1c09:	83 ec 04             	sub    $0x4,%esp
+    1c0c:	eb 0d                	jmp    1c1b <flushall+0x1b>
+    1c0e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c10:	83 c3 24             	add    $0x24,%ebx
+    1c13:	81 fb 40 2e 00 00    	cmp    $0x2e40,%ebx
+    1c19:	74 19                	je     1c34 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1c1b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1c1e:	85 c0                	test   %eax,%eax
+    1c20:	74 ee                	je     1c10 <flushall+0x10>
+    1c22:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c24:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1c27:	e8 64 ff ff ff       	call   1b90 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c2c:	81 fb 40 2e 00 00    	cmp    $0x2e40,%ebx
+    1c32:	75 e7                	jne    1c1b <flushall+0x1b>
+}
+    1c34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c37:	c9                   	leave
+    1c38:	c3                   	ret
+    1c39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c40 <fflush>:
+{
+    1c40:	55                   	push   %ebp
+    1c41:	89 e5                	mov    %esp,%ebp
+    1c43:	57                   	push   %edi
+    1c44:	56                   	push   %esi
+    1c45:	53                   	push   %ebx
+    1c46:	83 ec 0c             	sub    $0xc,%esp
+    1c49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1c4c:	85 c0                	test   %eax,%eax
+    1c4e:	74 28                	je     1c78 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1c50:	8b 70 08             	mov    0x8(%eax),%esi
+    1c53:	85 f6                	test   %esi,%esi
+    1c55:	75 11                	jne    1c68 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1c57:	83 c4 0c             	add    $0xc,%esp
+    1c5a:	89 f0                	mov    %esi,%eax
+    1c5c:	5b                   	pop    %ebx
+    1c5d:	5e                   	pop    %esi
+    1c5e:	5f                   	pop    %edi
+    1c5f:	5d                   	pop    %ebp
+    1c60:	c3                   	ret
+    1c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c68:	83 c4 0c             	add    $0xc,%esp
+    1c6b:	5b                   	pop    %ebx
+    1c6c:	5e                   	pop    %esi
+    1c6d:	5f                   	pop    %edi
+    1c6e:	5d                   	pop    %ebp
+  return drain(f);
+    1c6f:	e9 1c ff ff ff       	jmp    1b90 <drain>
+    1c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1c78:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c7a:	bb 00 2c 00 00       	mov    $0x2c00,%ebx
+        r = -1;
+    1c7f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1c84:	eb 15                	jmp    1c9b <fflush+0x5b>
+    1c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c90:	83 c3 24             	add    $0x24,%ebx
+    1c93:	81 fb 40 2e 00 00    	cmp    $0x2e40,%ebx
+    1c99:	74 bc                	je     1c57 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1c9b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1c9e:	85 c0                	test   %eax,%eax
+    1ca0:	74 ee                	je     1c90 <fflush+0x50>
+    1ca2:	89 d8                	mov    %ebx,%eax
+    1ca4:	e8 e7 fe ff ff       	call   1b90 <drain>
+        r = -1;
+    1ca9:	85 c0                	test   %eax,%eax
+    1cab:	0f 48 f7             	cmovs  %edi,%esi
+    1cae:	eb e0                	jmp    1c90 <fflush+0x50>
+
+00001cb0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1cb0:	55                   	push   %ebp
+    1cb1:	89 e5                	mov    %esp,%ebp
+    1cb3:	57                   	push   %edi
+    1cb4:	56                   	push   %esi
+    1cb5:	53                   	push   %ebx
+    1cb6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1cb9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1cbc:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1cc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1cc3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1cc6:	85 d2                	test   %edx,%edx
+    1cc8:	0f 8e 26 01 00 00    	jle    1df4 <fwrite+0x144>
+  if(!f->writable){
+    1cce:	8b 46 08             	mov    0x8(%esi),%eax
+    1cd1:	85 c0                	test   %eax,%eax
+    1cd3:	0f 84 14 01 00 00    	je     1ded <fwrite+0x13d>
+  setmode(f);
+    1cd9:	89 f0                	mov    %esi,%eax
+    1cdb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1cde:	e8 2d fe ff ff       	call   1b10 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1ce3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1ce7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1cea:	c7 05 40 30 00 00 00 	movl   $0x1c00,0x3040
+    1cf1:	1c 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1cf4:	0f 84 b6 00 00 00    	je     1db0 <fwrite+0x100>
+    1cfa:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1d00:	0f 8f aa 00 00 00    	jg     1db0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1d06:	8b 46 20             	mov    0x20(%esi),%eax
+    1d09:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1d0c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1d0e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1d13:	74 6c                	je     1d81 <fwrite+0xd1>
+    1d15:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1d18:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1d1b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1d20:	29 c2                	sub    %eax,%edx
+    1d22:	39 ca                	cmp    %ecx,%edx
+    1d24:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1d27:	85 d2                	test   %edx,%edx
+    1d29:	0f 8e d1 00 00 00    	jle    1e00 <fwrite+0x150>
+    1d2f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1d32:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1d35:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1d38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d3f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1d40:	8d 50 01             	lea    0x1(%eax),%edx
+    1d43:	83 c3 01             	add    $0x1,%ebx
+    1d46:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1d49:	89 56 20             	mov    %edx,0x20(%esi)
+    1d4c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1d50:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1d53:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1d56:	b8 01 00 00 00       	mov    $0x1,%eax
+    1d5b:	80 fa 0a             	cmp    $0xa,%dl
+    1d5e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d61:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1d64:	39 cb                	cmp    %ecx,%ebx
+    1d66:	75 d8                	jne    1d40 <fwrite+0x90>
+    1d68:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1d6b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1d6e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1d71:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1d74:	85 db                	test   %ebx,%ebx
+    1d76:	7e 19                	jle    1d91 <fwrite+0xe1>
+    n -= k;
+    1d78:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1d7a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1d7f:	75 97                	jne    1d18 <fwrite+0x68>
+    1d81:	89 f0                	mov    %esi,%eax
+    1d83:	e8 08 fe ff ff       	call   1b90 <drain>
+    1d88:	85 c0                	test   %eax,%eax
+    1d8a:	78 68                	js     1df4 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1d8c:	8b 46 20             	mov    0x20(%esi),%eax
+    1d8f:	eb 87                	jmp    1d18 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d91:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1d96:	74 74                	je     1e0c <fwrite+0x15c>
+    1d98:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1d9c:	75 04                	jne    1da2 <fwrite+0xf2>
+    1d9e:	85 ff                	test   %edi,%edi
+    1da0:	75 6a                	jne    1e0c <fwrite+0x15c>
+    return nmemb;
+    1da2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1da8:	5b                   	pop    %ebx
+    1da9:	5e                   	pop    %esi
+    1daa:	5f                   	pop    %edi
+    1dab:	5d                   	pop    %ebp
+    1dac:	c3                   	ret
+    1dad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1db0:	89 f0                	mov    %esi,%eax
+    1db2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1db5:	e8 d6 fd ff ff       	call   1b90 <drain>
+    1dba:	85 c0                	test   %eax,%eax
+    1dbc:	78 2f                	js     1ded <fwrite+0x13d>
+    1dbe:	89 75 14             	mov    %esi,0x14(%ebp)
+    1dc1:	8b 3e                	mov    (%esi),%edi
+    1dc3:	89 de                	mov    %ebx,%esi
+    1dc5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1dc8:	eb 0e                	jmp    1dd8 <fwrite+0x128>
+    1dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1dd0:	29 c3                	sub    %eax,%ebx
+    1dd2:	01 c6                	add    %eax,%esi
+    1dd4:	85 db                	test   %ebx,%ebx
+    1dd6:	7e ca                	jle    1da2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1dd8:	83 ec 04             	sub    $0x4,%esp
+    1ddb:	53                   	push   %ebx
+    1ddc:	56                   	push   %esi
+    1ddd:	57                   	push   %edi
+    1dde:	e8 bc f7 ff ff       	call   159f <write>
+    1de3:	83 c4 10             	add    $0x10,%esp
+    1de6:	85 c0                	test   %eax,%eax
+    1de8:	7f e6                	jg     1dd0 <fwrite+0x120>
+    1dea:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1ded:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1df4:	31 c0                	xor    %eax,%eax
+}
+    1df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1df9:	5b                   	pop    %ebx
+    1dfa:	5e                   	pop    %esi
+    1dfb:	5f                   	pop    %edi
+    1dfc:	5d                   	pop    %ebp
+    1dfd:	c3                   	ret
+    1dfe:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1e00:	89 d9                	mov    %ebx,%ecx
+    1e02:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1e05:	89 cb                	mov    %ecx,%ebx
+    1e07:	e9 6e ff ff ff       	jmp    1d7a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1e0c:	89 f0                	mov    %esi,%eax
+    1e0e:	e8 7d fd ff ff       	call   1b90 <drain>
+    1e13:	85 c0                	test   %eax,%eax
+    1e15:	79 8b                	jns    1da2 <fwrite+0xf2>
+    return 0;
+    1e17:	31 c0                	xor    %eax,%eax
+    1e19:	eb db                	jmp    1df6 <fwrite+0x146>
+    1e1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e1f:	90                   	nop
+
+00001e20 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1e20:	55                   	push   %ebp
+    1e21:	89 e5                	mov    %esp,%ebp
+    1e23:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1e26:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e29:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1e2c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1e2f:	ff 75 0c             	push   0xc(%ebp)
+    1e32:	6a 01                	push   $0x1
+    1e34:	6a 01                	push   $0x1
+    1e36:	50                   	push   %eax
+    1e37:	e8 74 fe ff ff       	call   1cb0 <fwrite>
+    1e3c:	83 c4 10             	add    $0x10,%esp
+    1e3f:	83 f8 01             	cmp    $0x1,%eax
+    1e42:	75 0c                	jne    1e50 <fputc+0x30>
+    1e44:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1e48:	c9                   	leave
+    1e49:	c3                   	ret
+    1e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1e50:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1e51:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1e56:	c3                   	ret
+    1e57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e5e:	66 90                	xchg   %ax,%ax
+
+00001e60 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1e60:	55                   	push   %ebp
+    1e61:	89 e5                	mov    %esp,%ebp
+    1e63:	57                   	push   %edi
+    1e64:	56                   	push   %esi
+    1e65:	53                   	push   %ebx
+    1e66:	83 ec 1c             	sub    $0x1c,%esp
+    1e69:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1e6c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1e6f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1e72:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1e75:	85 d2                	test   %edx,%edx
+    1e77:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1e7a:	7e 12                	jle    1e8e <fread+0x2e>
+    1e7c:	85 ff                	test   %edi,%edi
+    1e7e:	7e 0e                	jle    1e8e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1e80:	8b 43 04             	mov    0x4(%ebx),%eax
+    1e83:	85 c0                	test   %eax,%eax
+    1e85:	75 19                	jne    1ea0 <fread+0x40>
+    f->err = 1;
+    1e87:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1e8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1e91:	31 c0                	xor    %eax,%eax
+}
+    1e93:	5b                   	pop    %ebx
+    1e94:	5e                   	pop    %esi
+    1e95:	5f                   	pop    %edi
+    1e96:	5d                   	pop    %ebp
+    1e97:	c3                   	ret
+    1e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e9f:	90                   	nop
+  setmode(f);
+    1ea0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1ea2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1ea4:	e8 67 fc ff ff       	call   1b10 <setmode>
+  for(n = 0; n < want; n += k){
+    1ea9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1eac:	89 f7                	mov    %esi,%edi
+    1eae:	eb 31                	jmp    1ee1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1eb0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1eb4:	74 08                	je     1ebe <fread+0x5e>
+    1eb6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1ebc:	7e 62                	jle    1f20 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1ebe:	83 ec 04             	sub    $0x4,%esp
+    1ec1:	56                   	push   %esi
+    1ec2:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ec5:	01 f8                	add    %edi,%eax
+    1ec7:	50                   	push   %eax
+    1ec8:	ff 33                	push   (%ebx)
+    1eca:	e8 c1 f6 ff ff       	call   1590 <read>
+    1ecf:	83 c4 10             	add    $0x10,%esp
+    1ed2:	85 c0                	test   %eax,%eax
+    1ed4:	0f 8e ce 00 00 00    	jle    1fa8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1eda:	01 c7                	add    %eax,%edi
+    1edc:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1edf:	7e 36                	jle    1f17 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1ee1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1ee4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1ee7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1eea:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1eec:	39 c1                	cmp    %eax,%ecx
+    1eee:	7d c0                	jge    1eb0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1ef0:	29 c8                	sub    %ecx,%eax
+    1ef2:	39 f0                	cmp    %esi,%eax
+    1ef4:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1ef7:	83 ec 04             	sub    $0x4,%esp
+    1efa:	56                   	push   %esi
+    1efb:	03 4b 18             	add    0x18(%ebx),%ecx
+    1efe:	51                   	push   %ecx
+    1eff:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f02:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1f04:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1f06:	50                   	push   %eax
+    1f07:	e8 34 f5 ff ff       	call   1440 <memmove>
+      f->r += k;
+    1f0c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1f0f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1f12:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1f15:	7f ca                	jg     1ee1 <fread+0x81>
+    1f17:	89 fe                	mov    %edi,%esi
+    1f19:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f1c:	eb 3f                	jmp    1f5d <fread+0xfd>
+    1f1e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1f20:	3b 1d e8 2b 00 00    	cmp    0x2be8,%ebx
+    1f26:	74 68                	je     1f90 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1f28:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1f2b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1f32:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1f39:	68 00 04 00 00       	push   $0x400
+    1f3e:	ff 73 18             	push   0x18(%ebx)
+    1f41:	ff 33                	push   (%ebx)
+    1f43:	e8 48 f6 ff ff       	call   1590 <read>
+    1f48:	83 c4 10             	add    $0x10,%esp
+    1f4b:	85 c0                	test   %eax,%eax
+    1f4d:	78 21                	js     1f70 <fread+0x110>
+  else if(n == 0)
+    1f4f:	75 2f                	jne    1f80 <fread+0x120>
+    f->eof = 1;
+    1f51:	89 fe                	mov    %edi,%esi
+    1f53:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f56:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1f5d:	89 f0                	mov    %esi,%eax
+}
+    1f5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1f62:	99                   	cltd
+}
+    1f63:	5b                   	pop    %ebx
+    1f64:	5e                   	pop    %esi
+  return n / size;
+    1f65:	f7 ff                	idiv   %edi
+}
+    1f67:	5f                   	pop    %edi
+    1f68:	5d                   	pop    %ebp
+    1f69:	c3                   	ret
+    1f6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1f70:	89 fe                	mov    %edi,%esi
+    1f72:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f75:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1f7c:	eb df                	jmp    1f5d <fread+0xfd>
+    1f7e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1f80:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1f83:	e9 54 ff ff ff       	jmp    1edc <fread+0x7c>
+    1f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f8f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1f90:	83 ec 0c             	sub    $0xc,%esp
+    1f93:	ff 35 e4 2b 00 00    	push   0x2be4
+    1f99:	e8 a2 fc ff ff       	call   1c40 <fflush>
+    1f9e:	83 c4 10             	add    $0x10,%esp
+    1fa1:	eb 85                	jmp    1f28 <fread+0xc8>
+    1fa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1fa7:	90                   	nop
+        if(k < 0)
+    1fa8:	89 fe                	mov    %edi,%esi
+    1faa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1fad:	74 a7                	je     1f56 <fread+0xf6>
+    1faf:	eb c4                	jmp    1f75 <fread+0x115>
+    1fb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fbf:	90                   	nop
+
+00001fc0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1fc0:	55                   	push   %ebp
+    1fc1:	89 e5                	mov    %esp,%ebp
+    1fc3:	53                   	push   %ebx
+    1fc4:	83 ec 14             	sub    $0x14,%esp
+    1fc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1fca:	8b 50 04             	mov    0x4(%eax),%edx
+    1fcd:	85 d2                	test   %edx,%edx
+    1fcf:	74 08                	je     1fd9 <fgetc+0x19>
+    1fd1:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1fd4:	3b 50 20             	cmp    0x20(%eax),%edx
+    1fd7:	7c 27                	jl     2000 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1fd9:	50                   	push   %eax
+    1fda:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1fdd:	6a 01                	push   $0x1
+    1fdf:	6a 01                	push   $0x1
+    1fe1:	50                   	push   %eax
+    1fe2:	e8 79 fe ff ff       	call   1e60 <fread>
+    1fe7:	83 c4 10             	add    $0x10,%esp
+    1fea:	83 f8 01             	cmp    $0x1,%eax
+    1fed:	75 29                	jne    2018 <fgetc+0x58>
+    1fef:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1ff3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ff6:	c9                   	leave
+    1ff7:	c3                   	ret
+    1ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fff:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    2000:	8b 48 18             	mov    0x18(%eax),%ecx
+    2003:	8d 5a 01             	lea    0x1(%edx),%ebx
+    2006:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    2009:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    200c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    2010:	c9                   	leave
+    2011:	c3                   	ret
+    2012:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2018:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    201d:	eb d4                	jmp    1ff3 <fgetc+0x33>
+    201f:	90                   	nop
+
+00002020 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    2020:	55                   	push   %ebp
+    2021:	89 e5                	mov    %esp,%ebp
+    2023:	57                   	push   %edi
+    2024:	56                   	push   %esi
+    2025:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    2026:	31 db                	xor    %ebx,%ebx
+{
+    2028:	83 ec 1c             	sub    $0x1c,%esp
+    202b:	8b 75 10             	mov    0x10(%ebp),%esi
+    202e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    2030:	eb 2e                	jmp    2060 <fgets+0x40>
+    2032:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2038:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    203b:	57                   	push   %edi
+    203c:	6a 01                	push   $0x1
+    203e:	6a 01                	push   $0x1
+    2040:	50                   	push   %eax
+    2041:	e8 1a fe ff ff       	call   1e60 <fread>
+    2046:	83 c4 10             	add    $0x10,%esp
+    2049:	83 f8 01             	cmp    $0x1,%eax
+    204c:	75 62                	jne    20b0 <fgets+0x90>
+    204e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    2052:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2055:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    2057:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    205b:	83 f9 0a             	cmp    $0xa,%ecx
+    205e:	74 34                	je     2094 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    2060:	89 de                	mov    %ebx,%esi
+    2062:	83 c3 01             	add    $0x1,%ebx
+    2065:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    2068:	7d 46                	jge    20b0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    206a:	8b 47 04             	mov    0x4(%edi),%eax
+    206d:	85 c0                	test   %eax,%eax
+    206f:	74 c7                	je     2038 <fgets+0x18>
+    2071:	8b 47 1c             	mov    0x1c(%edi),%eax
+    2074:	3b 47 20             	cmp    0x20(%edi),%eax
+    2077:	7d bf                	jge    2038 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    2079:	8b 4f 18             	mov    0x18(%edi),%ecx
+    207c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    207f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    2082:	89 77 1c             	mov    %esi,0x1c(%edi)
+    2085:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    2089:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    208b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    208f:	83 f9 0a             	cmp    $0xa,%ecx
+    2092:	75 cc                	jne    2060 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2094:	8b 45 08             	mov    0x8(%ebp),%eax
+    2097:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    209b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    209e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20a1:	5b                   	pop    %ebx
+    20a2:	5e                   	pop    %esi
+    20a3:	5f                   	pop    %edi
+    20a4:	5d                   	pop    %ebp
+    20a5:	c3                   	ret
+    20a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ad:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    20b0:	8b 45 08             	mov    0x8(%ebp),%eax
+    20b3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    20b7:	31 c0                	xor    %eax,%eax
+    20b9:	85 f6                	test   %esi,%esi
+    20bb:	74 e1                	je     209e <fgets+0x7e>
+    20bd:	8b 45 08             	mov    0x8(%ebp),%eax
+    20c0:	eb dc                	jmp    209e <fgets+0x7e>
+    20c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000020d0 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    20d0:	55                   	push   %ebp
+    20d1:	89 e5                	mov    %esp,%ebp
+    20d3:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    20d4:	bb 00 2c 00 00       	mov    $0x2c00,%ebx
+{
+    20d9:	83 ec 04             	sub    $0x4,%esp
+    20dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    20e0:	8b 53 04             	mov    0x4(%ebx),%edx
+    20e3:	85 d2                	test   %edx,%edx
+    20e5:	75 07                	jne    20ee <fdopen+0x1e>
+    20e7:	8b 43 08             	mov    0x8(%ebx),%eax
+    20ea:	85 c0                	test   %eax,%eax
+    20ec:	74 1a                	je     2108 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    20ee:	83 c3 24             	add    $0x24,%ebx
+    20f1:	81 fb 40 2e 00 00    	cmp    $0x2e40,%ebx
+    20f7:	75 e7                	jne    20e0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    20f9:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    20fb:	89 d8                	mov    %ebx,%eax
+    20fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2100:	c9                   	leave
+    2101:	c3                   	ret
+    2102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2108:	81 fb 40 2e 00 00    	cmp    $0x2e40,%ebx
+    210e:	74 e9                	je     20f9 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2110:	83 ec 04             	sub    $0x4,%esp
+    2113:	6a 24                	push   $0x24
+    2115:	6a 00                	push   $0x0
+    2117:	53                   	push   %ebx
+    2118:	e8 d3 f1 ff ff       	call   12f0 <memset>
+  f->fd = fd;
+    211d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2120:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2127:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    212a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    212c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    212f:	80 38 72             	cmpb   $0x72,(%eax)
+    2132:	74 14                	je     2148 <fdopen+0x78>
+    f->writable = 1;
+    2134:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    213b:	89 d8                	mov    %ebx,%eax
+    213d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2140:	c9                   	leave
+    2141:	c3                   	ret
+    2142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2148:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    214f:	89 d8                	mov    %ebx,%eax
+    2151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2154:	c9                   	leave
+    2155:	c3                   	ret
+    2156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    215d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002160 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2160:	55                   	push   %ebp
+    2161:	89 e5                	mov    %esp,%ebp
+    2163:	56                   	push   %esi
+    2164:	53                   	push   %ebx
+    2165:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2168:	0f b6 06             	movzbl (%esi),%eax
+    216b:	3c 72                	cmp    $0x72,%al
+    216d:	74 61                	je     21d0 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    216f:	3c 77                	cmp    $0x77,%al
+    2171:	74 7d                	je     21f0 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2173:	3c 61                	cmp    $0x61,%al
+    2175:	75 49                	jne    21c0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2177:	83 ec 08             	sub    $0x8,%esp
+    217a:	68 01 02 00 00       	push   $0x201
+    217f:	ff 75 08             	push   0x8(%ebp)
+    2182:	e8 54 f4 ff ff       	call   15db <open>
+    2187:	83 c4 10             	add    $0x10,%esp
+    218a:	89 c3                	mov    %eax,%ebx
+    218c:	85 c0                	test   %eax,%eax
+    218e:	78 30                	js     21c0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2190:	83 ec 04             	sub    $0x4,%esp
+    2193:	6a 02                	push   $0x2
+    2195:	6a 00                	push   $0x0
+    2197:	50                   	push   %eax
+    2198:	e8 4c f5 ff ff       	call   16e9 <lseek>
+    219d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    21a0:	83 ec 08             	sub    $0x8,%esp
+    21a3:	56                   	push   %esi
+    21a4:	53                   	push   %ebx
+    21a5:	e8 26 ff ff ff       	call   20d0 <fdopen>
+    21aa:	83 c4 10             	add    $0x10,%esp
+    21ad:	85 c0                	test   %eax,%eax
+    21af:	75 11                	jne    21c2 <fopen+0x62>
+    close(fd);
+    21b1:	83 ec 0c             	sub    $0xc,%esp
+    21b4:	53                   	push   %ebx
+    21b5:	e8 f4 f3 ff ff       	call   15ae <close>
+    21ba:	83 c4 10             	add    $0x10,%esp
+    21bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    21c0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    21c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    21c5:	5b                   	pop    %ebx
+    21c6:	5e                   	pop    %esi
+    21c7:	5d                   	pop    %ebp
+    21c8:	c3                   	ret
+    21c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    21d0:	83 ec 08             	sub    $0x8,%esp
+    21d3:	6a 00                	push   $0x0
+    21d5:	ff 75 08             	push   0x8(%ebp)
+    21d8:	e8 fe f3 ff ff       	call   15db <open>
+    21dd:	83 c4 10             	add    $0x10,%esp
+    21e0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    21e2:	85 db                	test   %ebx,%ebx
+    21e4:	78 da                	js     21c0 <fopen+0x60>
+    21e6:	eb b8                	jmp    21a0 <fopen+0x40>
+    21e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21ef:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    21f0:	83 ec 08             	sub    $0x8,%esp
+    21f3:	68 01 06 00 00       	push   $0x601
+    21f8:	ff 75 08             	push   0x8(%ebp)
+    21fb:	e8 db f3 ff ff       	call   15db <open>
+    2200:	83 c4 10             	add    $0x10,%esp
+    2203:	89 c3                	mov    %eax,%ebx
+    2205:	eb db                	jmp    21e2 <fopen+0x82>
+    2207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    220e:	66 90                	xchg   %ax,%ax
+
+00002210 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2210:	55                   	push   %ebp
+    2211:	89 e5                	mov    %esp,%ebp
+    2213:	56                   	push   %esi
+    2214:	53                   	push   %ebx
+    2215:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2218:	83 ec 0c             	sub    $0xc,%esp
+    221b:	53                   	push   %ebx
+    221c:	e8 1f fa ff ff       	call   1c40 <fflush>
+    2221:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2223:	58                   	pop    %eax
+    2224:	ff 33                	push   (%ebx)
+    2226:	e8 83 f3 ff ff       	call   15ae <close>
+    222b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    222e:	85 c0                	test   %eax,%eax
+    2230:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2235:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2238:	8b 43 18             	mov    0x18(%ebx),%eax
+    223b:	85 c0                	test   %eax,%eax
+    223d:	0f 95 c1             	setne  %cl
+    2240:	3d 60 34 00 00       	cmp    $0x3460,%eax
+    2245:	0f 95 c2             	setne  %dl
+    2248:	84 d1                	test   %dl,%cl
+    224a:	74 07                	je     2253 <fclose+0x43>
+    224c:	3d 60 30 00 00       	cmp    $0x3060,%eax
+    2251:	75 25                	jne    2278 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2253:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    225a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    225c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2263:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    226a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    226d:	5b                   	pop    %ebx
+    226e:	5e                   	pop    %esi
+    226f:	5d                   	pop    %ebp
+    2270:	c3                   	ret
+    2271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2278:	83 ec 0c             	sub    $0xc,%esp
+    227b:	50                   	push   %eax
+    227c:	e8 3f 00 00 00       	call   22c0 <free>
+    2281:	83 c4 10             	add    $0x10,%esp
+    2284:	eb cd                	jmp    2253 <fclose+0x43>
+    2286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    228d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002290 <feof>:
+
+int
+feof(FILE *f)
+{
+    2290:	55                   	push   %ebp
+    2291:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2293:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2296:	5d                   	pop    %ebp
+  return f->eof;
+    2297:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    229a:	c3                   	ret
+    229b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    229f:	90                   	nop
+
+000022a0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    22a0:	55                   	push   %ebp
+    22a1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    22a3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    22a6:	5d                   	pop    %ebp
+  return f->err;
+    22a7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    22aa:	c3                   	ret
+    22ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22af:	90                   	nop
+
+000022b0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    22b0:	55                   	push   %ebp
+    22b1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    22b3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    22b6:	5d                   	pop    %ebp
+  return f->fd;
+    22b7:	8b 00                	mov    (%eax),%eax
+}
+    22b9:	c3                   	ret
+    22ba:	66 90                	xchg   %ax,%ax
+    22bc:	66 90                	xchg   %ax,%ax
+    22be:	66 90                	xchg   %ax,%ax
+
+000022c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    22c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    22c1:	a1 60 38 00 00       	mov    0x3860,%eax
+{
+    22c6:	89 e5                	mov    %esp,%ebp
+    22c8:	57                   	push   %edi
+    22c9:	56                   	push   %esi
+    22ca:	53                   	push   %ebx
+    22cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    22ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    22d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    22da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    22dc:	39 ca                	cmp    %ecx,%edx
+    22de:	73 30                	jae    2310 <free+0x50>
+    22e0:	39 c1                	cmp    %eax,%ecx
+    22e2:	72 04                	jb     22e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    22e4:	39 c2                	cmp    %eax,%edx
+    22e6:	72 f0                	jb     22d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    22e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    22eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    22ee:	39 f8                	cmp    %edi,%eax
+    22f0:	74 2e                	je     2320 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    22f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    22f5:	8b 42 04             	mov    0x4(%edx),%eax
+    22f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    22fb:	39 f1                	cmp    %esi,%ecx
+    22fd:	74 38                	je     2337 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    22ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2301:	5b                   	pop    %ebx
+  freep = p;
+    2302:	89 15 60 38 00 00    	mov    %edx,0x3860
+}
+    2308:	5e                   	pop    %esi
+    2309:	5f                   	pop    %edi
+    230a:	5d                   	pop    %ebp
+    230b:	c3                   	ret
+    230c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2310:	39 c1                	cmp    %eax,%ecx
+    2312:	72 d0                	jb     22e4 <free+0x24>
+    2314:	eb c2                	jmp    22d8 <free+0x18>
+    2316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    231d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2320:	03 70 04             	add    0x4(%eax),%esi
+    2323:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2326:	8b 02                	mov    (%edx),%eax
+    2328:	8b 00                	mov    (%eax),%eax
+    232a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    232d:	8b 42 04             	mov    0x4(%edx),%eax
+    2330:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2333:	39 f1                	cmp    %esi,%ecx
+    2335:	75 c8                	jne    22ff <free+0x3f>
+    p->s.size += bp->s.size;
+    2337:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    233a:	89 15 60 38 00 00    	mov    %edx,0x3860
+    p->s.size += bp->s.size;
+    2340:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2343:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2346:	89 0a                	mov    %ecx,(%edx)
+}
+    2348:	5b                   	pop    %ebx
+    2349:	5e                   	pop    %esi
+    234a:	5f                   	pop    %edi
+    234b:	5d                   	pop    %ebp
+    234c:	c3                   	ret
+    234d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002350 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2350:	55                   	push   %ebp
+    2351:	89 e5                	mov    %esp,%ebp
+    2353:	57                   	push   %edi
+    2354:	56                   	push   %esi
+    2355:	53                   	push   %ebx
+    2356:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2359:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    235c:	8b 15 60 38 00 00    	mov    0x3860,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2362:	8d 78 07             	lea    0x7(%eax),%edi
+    2365:	c1 ef 03             	shr    $0x3,%edi
+    2368:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    236b:	85 d2                	test   %edx,%edx
+    236d:	0f 84 8d 00 00 00    	je     2400 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2373:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2375:	8b 48 04             	mov    0x4(%eax),%ecx
+    2378:	39 f9                	cmp    %edi,%ecx
+    237a:	73 64                	jae    23e0 <malloc+0x90>
+  if(nu < 4096)
+    237c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2381:	39 df                	cmp    %ebx,%edi
+    2383:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2386:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    238d:	eb 0a                	jmp    2399 <malloc+0x49>
+    238f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2390:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2392:	8b 48 04             	mov    0x4(%eax),%ecx
+    2395:	39 f9                	cmp    %edi,%ecx
+    2397:	73 47                	jae    23e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2399:	89 c2                	mov    %eax,%edx
+    239b:	39 05 60 38 00 00    	cmp    %eax,0x3860
+    23a1:	75 ed                	jne    2390 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    23a3:	83 ec 0c             	sub    $0xc,%esp
+    23a6:	56                   	push   %esi
+    23a7:	e8 b6 f2 ff ff       	call   1662 <sbrk>
+  if(p == (char*)-1)
+    23ac:	83 c4 10             	add    $0x10,%esp
+    23af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    23b2:	74 1c                	je     23d0 <malloc+0x80>
+  hp->s.size = nu;
+    23b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    23b7:	83 ec 0c             	sub    $0xc,%esp
+    23ba:	83 c0 08             	add    $0x8,%eax
+    23bd:	50                   	push   %eax
+    23be:	e8 fd fe ff ff       	call   22c0 <free>
+  return freep;
+    23c3:	8b 15 60 38 00 00    	mov    0x3860,%edx
+      if((p = morecore(nunits)) == 0)
+    23c9:	83 c4 10             	add    $0x10,%esp
+    23cc:	85 d2                	test   %edx,%edx
+    23ce:	75 c0                	jne    2390 <malloc+0x40>
+        return 0;
+  }
+}
+    23d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    23d3:	31 c0                	xor    %eax,%eax
+}
+    23d5:	5b                   	pop    %ebx
+    23d6:	5e                   	pop    %esi
+    23d7:	5f                   	pop    %edi
+    23d8:	5d                   	pop    %ebp
+    23d9:	c3                   	ret
+    23da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    23e0:	39 cf                	cmp    %ecx,%edi
+    23e2:	74 4c                	je     2430 <malloc+0xe0>
+        p->s.size -= nunits;
+    23e4:	29 f9                	sub    %edi,%ecx
+    23e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    23e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    23ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    23ef:	89 15 60 38 00 00    	mov    %edx,0x3860
+}
+    23f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    23f8:	83 c0 08             	add    $0x8,%eax
+}
+    23fb:	5b                   	pop    %ebx
+    23fc:	5e                   	pop    %esi
+    23fd:	5f                   	pop    %edi
+    23fe:	5d                   	pop    %ebp
+    23ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2400:	c7 05 60 38 00 00 64 	movl   $0x3864,0x3860
+    2407:	38 00 00 
+    base.s.size = 0;
+    240a:	b8 64 38 00 00       	mov    $0x3864,%eax
+    base.s.ptr = freep = prevp = &base;
+    240f:	c7 05 64 38 00 00 64 	movl   $0x3864,0x3864
+    2416:	38 00 00 
+    base.s.size = 0;
+    2419:	c7 05 68 38 00 00 00 	movl   $0x0,0x3868
+    2420:	00 00 00 
+    if(p->s.size >= nunits){
+    2423:	e9 54 ff ff ff       	jmp    237c <malloc+0x2c>
+    2428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    242f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2430:	8b 08                	mov    (%eax),%ecx
+    2432:	89 0a                	mov    %ecx,(%edx)
+    2434:	eb b9                	jmp    23ef <malloc+0x9f>
@@ -0,0 +1,65 @@
+// Copy a file, with sendfile() so that the data never
+// passes through user space.
+//   cp src dst
+// If dst is a directory, the copy goes in it, under the
+// last element of src's name.  An existing dst is overwritten.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+
+char path[512];
+
+int
+main(int argc, char *argv[])
+{
+  int in, out, n;
+  char *dst, *p;
+  struct stat st, sst;
+
+  if(argc != 3){
+    printf(2, "Usage: cp src dst\n");
+    exit();
+  }
+  if((in = open(argv[1], O_RDONLY)) < 0){
+    printf(2, "cp: cannot open %s\n", argv[1]);
+    exit();
+  }
+  if(fstat(in, &sst) < 0 || sst.type == T_DIR){
+    printf(2, "cp: %s is not a file\n", argv[1]);
+    exit();
+  }
+
+  dst = argv[2];
+  if(stat(dst, &st) >= 0 && st.type == T_DIR){
+    for(p = argv[1] + strlen(argv[1]); p > argv[1] && p[-1] != '/'; p--)
+      ;
+    if(strlen(dst) + 1 + strlen(p) + 1 > sizeof(path)){
+      printf(2, "cp: path too long\n");
+      exit();
+    }
+    strcpy(path, dst);
+    strcpy(path + strlen(path), "/");
+    strcpy(path + strlen(path), p);
+    dst = path;
+  }
+  // Truncating dst would empty src if they were one file.
+  if(stat(dst, &st) >= 0 && st.dev == sst.dev && st.ino == sst.ino){
+    printf(2, "cp: %s and %s are the same file\n", argv[1], dst);
+    exit();
+  }
+  if((out = open(dst, O_CREATE|O_WRONLY|O_TRUNC)) < 0){
+    printf(2, "cp: cannot create %s\n", dst);
+    exit();
+  }
+
+  while((n = sendfile(out, in, -1, 1024*1024)) > 0)
+    ;
+  if(n < 0)
+    printf(2, "cp: copy to %s failed\n", dst);
+  close(in);
+  close(out);
+  exit();
+}
@@ -0,0 +1,216 @@
+// Directory name cache.
+//
+// The name cache remembers the results of directory lookups:
+// that name in directory dir on dev is inode inum, found at
+// byte offset off, or, if inum is 0, that there is no such
+// name.  dirlookup() consults it before reading the directory,
+// so that looking up the same paths again, as exec and open
+// do all the time, need not scan each directory along the way.
+//
+// Interface:
+// * dclookup() returns 1 and the cached answer, or 0 if the
+//   cache does not know.
+// * dcenter() records an answer, replacing any older one.
+// * dcforget() drops one name, and dcpurge() every name in a
+//   directory that is being freed.
+//
+// Callers hold the directory's inode lock, the same lock that
+// serializes changes to the directory itself, so that the cache
+// and the directory cannot disagree.  Entries are recycled in
+// least recently used order.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "kstat.h"
+
+#define NDCACHE 512
+#define NDHASH  127
+
+struct dentry {
+  uint dev;
+  uint dir;           // inode number of the directory
+  char name[DIRSIZ];
+  uint inum;          // 0 if name is known not to exist
+  uint off;           // offset of name's dirent in dir
+  struct dentry *hnext; // hash chain
+  struct dentry *prev;  // LRU list
+  struct dentry *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry entry[NDCACHE];
+  struct dentry *hash[NDHASH];
+
+  // Linked list of all entries, through prev/next.
+  // head.next is most recently used.
+  struct dentry head;
+
+  uint hits, neghits, misses;
+} dcache;
+
+static uint
+dhash(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + name[i];
+  return h % NDHASH;
+}
+
+void
+dcinit(void)
+{
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.head.prev = &dcache.head;
+  dcache.head.next = &dcache.head;
+  for(d = dcache.entry; d < dcache.entry+NDCACHE; d++){
+    d->next = dcache.head.next;
+    d->prev = &dcache.head;
+    dcache.head.next->prev = d;
+    dcache.head.next = d;
+  }
+}
+
+// Find the entry for name in dir.  Caller holds dcache.lock.
+static struct dentry*
+dfind(uint dev, uint dir, char *name)
+{
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dev, dir, name)]; d; d = d->hnext)
+    if(d->dev == dev && d->dir == dir && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Take d off its hash chain, and move it to the least
+// recently used end of the list, to be recycled first.
+// Caller holds dcache.lock.
+static void
+dremove(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp != d; pp = &(*pp)->hnext)
+    ;
+  *pp = d->hnext;
+  d->dir = 0;
+
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->prev = dcache.head.prev;
+  d->next = &dcache.head;
+  dcache.head.prev->next = d;
+  dcache.head.prev = d;
+}
+
+// Look up name in directory dir on dev.  If the cache knows,
+// set *inum (0 if there is no such name) and *off, and return 1.
+int
+dclookup(uint dev, uint dir, char *name, uint *inum, uint *off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dev, dir, name)) == 0){
+    dcache.misses++;
+    release(&dcache.lock);
+    return 0;
+  }
+  *inum = d->inum;
+  *off = d->off;
+  if(d->inum)
+    dcache.hits++;
+  else
+    dcache.neghits++;
+
+  // Move to the most recently used end.
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->next = dcache.head.next;
+  d->prev = &dcache.head;
+  dcache.head.next->prev = d;
+  dcache.head.next = d;
+  release(&dcache.lock);
+  return 1;
+}
+
+// Remember that name in directory dir on dev is inode inum,
+// at offset off, or does not exist if inum is 0.
+void
+dcenter(uint dev, uint dir, char *name, uint inum, uint off)
+{
+  struct dentry *d;
+  uint h;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dev, dir, name)) != 0)
+    dremove(d);
+
+  // Recycle the least recently used entry.
+  d = dcache.head.prev;
+  if(d->dir != 0)
+    dremove(d);
+  d->dev = dev;
+  d->dir = dir;
+  strncpy(d->name, name, DIRSIZ);
+  d->inum = inum;
+  d->off = off;
+  h = dhash(dev, dir, name);
+  d->hnext = dcache.hash[h];
+  dcache.hash[h] = d;
+
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->next = dcache.head.next;
+  d->prev = &dcache.head;
+  dcache.head.next->prev = d;
+  dcache.head.next = d;
+  release(&dcache.lock);
+}
+
+// Forget name in directory dir on dev.
+void
+dcforget(uint dev, uint dir, char *name)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dev, dir, name)) != 0)
+    dremove(d);
+  release(&dcache.lock);
+}
+
+// Forget every name in directory dir on dev,
+// which is being freed.
+void
+dcpurge(uint dev, uint dir)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.entry; d < dcache.entry+NDCACHE; d++)
+    if(d->dir == dir && d->dev == dev)
+      dremove(d);
+  release(&dcache.lock);
+}
+
+// Report hit rates.
+void
+dcstat(struct kstat *st)
+{
+  acquire(&dcache.lock);
+  st->dcache_hits = dcache.hits;
+  st->dcache_neghits = dcache.neghits;
+  st->dcache_misses = dcache.misses;
+  release(&dcache.lock);
+}
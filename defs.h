@@ -2,6 +2,9 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct iovec;
+struct kstat;
+struct pcidev;
 struct pipe;
 struct proc;
 struct rtcdate;
@@ -9,12 +12,16 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct uticks;
 
 // bio.c
 void            binit(void);
+int             bgrow(int);
 struct buf*     bread(uint, uint);
+struct buf*     bnew(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bwritethrough(struct buf*, uchar*);
 
 // console.c
 void            consoleinit(void);
@@ -22,6 +29,18 @@ void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
 void            panic(char*) __attribute__((noreturn));
 
+// dcache.c
+void            dcinit(void);
+int             dclookup(uint, uint, char*, uint*, uint*);
+void            dcenter(uint, uint, char*, uint, uint);
+void            dcforget(uint, uint, char*);
+void            dcpurge(uint, uint);
+void            dcstat(struct kstat*);
+
+// copy.S
+int             ucopy(void*, void*, uint);
+int             ucopystr(char*, char*, uint);
+
 // exec.c
 int             exec(char*, char**);
 
@@ -33,6 +52,13 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filesplice(struct file*, struct file*, int);
+int             filepread(struct file*, char*, int, uint);
+int             filepwrite(struct file*, char*, int, uint);
+int             filereadv(struct file*, struct iovec*, int);
+int             filewritev(struct file*, struct iovec*, int);
+int             fileseek(struct file*, int, int);
+int             filesendfile(struct file*, struct file*, int, int);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
@@ -40,9 +66,11 @@ int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            icacheinit(void);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
+void            itrunc(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
@@ -52,11 +80,15 @@ struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
+void            fsstat(struct kstat*);
 
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            idestat(struct kstat*);
+uint            idesize(int);
+extern int      ideirq;
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -86,6 +118,7 @@ void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
+void            logstat(struct kstat*);
 
 // mp.c
 extern int      ismp;
@@ -100,6 +133,21 @@ int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
+int             pipegetsize(struct pipe*);
+int             pipesetsize(struct pipe*, int);
+void            pipeinit(void);
+int             pipesplice(struct pipe*, struct pipe*, int);
+int             pipesplicein(struct pipe*, struct file*, uint*, int);
+int             pipespliceout(struct pipe*, struct file*, int);
+void            pipestat(struct kstat*);
+
+// pci.c
+void            pciinit(void);
+void            pcienable(struct pcidev*);
+struct pcidev*  pcifind(int, int);
+struct pcidev*  pcifindclass(int, int);
+uint            pciread(struct pcidev*, int);
+void            pciwrite(struct pcidev*, int, uint);
 
 //PAGEBREAK: 16
 // proc.c
@@ -108,10 +156,12 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+void            kproc(char*, void(*)(void));
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
+void            procstat(struct kstat*);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            setproc(struct proc*);
@@ -155,8 +205,10 @@ int             argint(int, int*);
 int             argptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
+int             fetchptr(uint, char**, int);
 int             fetchstr(uint, char**);
 void            syscall(void);
+void            syscallstat(struct kstat*);
 
 // timer.c
 void            timerinit(void);
@@ -166,11 +218,15 @@ void            idtinit(void);
 extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
+extern struct uticks *uticks;
 
 // uart.c
 void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
+void            uartstat(struct kstat*);
+void            uartsync(void);
+int             uartwrite(char*, int);
 
 // vm.c
 void            seginit(void);
@@ -185,8 +241,13 @@ int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
-int             copyout(pde_t*, uint, void*, uint);
+int             copyoutvm(pde_t*, uint, void*, uint);
+int             uvalid(uint, uint);
+int             copyin(void*, uint, uint);
+int             copyout(uint, void*, uint);
+int             copystr(char*, uint, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             mapupages(pde_t*, char*);
 
 
 // number of elements in fixed-size array
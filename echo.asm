@@ -0,0 +1,2687 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	83 ec 08             	sub    $0x8,%esp
+    1014:	8b 31                	mov    (%ecx),%esi
+    1016:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+    1019:	83 fe 01             	cmp    $0x1,%esi
+    101c:	7e 47                	jle    1065 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+    101e:	8b 47 04             	mov    0x4(%edi),%eax
+    1021:	83 fe 02             	cmp    $0x2,%esi
+    1024:	74 2a                	je     1050 <main+0x50>
+    1026:	bb 02 00 00 00       	mov    $0x2,%ebx
+    102b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+    1030:	68 78 22 00 00       	push   $0x2278
+    1035:	83 c3 01             	add    $0x1,%ebx
+    1038:	50                   	push   %eax
+    1039:	68 7a 22 00 00       	push   $0x227a
+    103e:	6a 01                	push   $0x1
+    1040:	e8 7b 08 00 00       	call   18c0 <printf>
+    1045:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+    1049:	83 c4 10             	add    $0x10,%esp
+    104c:	39 f3                	cmp    %esi,%ebx
+    104e:	75 e0                	jne    1030 <main+0x30>
+    1050:	68 7f 22 00 00       	push   $0x227f
+    1055:	50                   	push   %eax
+    1056:	68 7a 22 00 00       	push   $0x227a
+    105b:	6a 01                	push   $0x1
+    105d:	e8 5e 08 00 00       	call   18c0 <printf>
+    1062:	83 c4 10             	add    $0x10,%esp
+  exit();
+    1065:	e8 e6 02 00 00       	call   1350 <exit>
+    106a:	66 90                	xchg   %ax,%ax
+    106c:	66 90                	xchg   %ax,%ax
+    106e:	66 90                	xchg   %ax,%ax
+
+00001070 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1070:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1071:	31 c0                	xor    %eax,%eax
+{
+    1073:	89 e5                	mov    %esp,%ebp
+    1075:	53                   	push   %ebx
+    1076:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1079:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1080:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1084:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1087:	83 c0 01             	add    $0x1,%eax
+    108a:	84 d2                	test   %dl,%dl
+    108c:	75 f2                	jne    1080 <strcpy+0x10>
+    ;
+  return os;
+}
+    108e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1091:	89 c8                	mov    %ecx,%eax
+    1093:	c9                   	leave
+    1094:	c3                   	ret
+    1095:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    10a0:	55                   	push   %ebp
+    10a1:	89 e5                	mov    %esp,%ebp
+    10a3:	53                   	push   %ebx
+    10a4:	8b 55 08             	mov    0x8(%ebp),%edx
+    10a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    10aa:	0f b6 02             	movzbl (%edx),%eax
+    10ad:	84 c0                	test   %al,%al
+    10af:	75 17                	jne    10c8 <strcmp+0x28>
+    10b1:	eb 3a                	jmp    10ed <strcmp+0x4d>
+    10b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10b7:	90                   	nop
+    10b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    10bc:	83 c2 01             	add    $0x1,%edx
+    10bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    10c2:	84 c0                	test   %al,%al
+    10c4:	74 1a                	je     10e0 <strcmp+0x40>
+    p++, q++;
+    10c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    10c8:	0f b6 19             	movzbl (%ecx),%ebx
+    10cb:	38 c3                	cmp    %al,%bl
+    10cd:	74 e9                	je     10b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    10cf:	29 d8                	sub    %ebx,%eax
+}
+    10d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10d4:	c9                   	leave
+    10d5:	c3                   	ret
+    10d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10e4:	31 c0                	xor    %eax,%eax
+    10e6:	29 d8                	sub    %ebx,%eax
+}
+    10e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10eb:	c9                   	leave
+    10ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10ed:	0f b6 19             	movzbl (%ecx),%ebx
+    10f0:	31 c0                	xor    %eax,%eax
+    10f2:	eb db                	jmp    10cf <strcmp+0x2f>
+    10f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10ff:	90                   	nop
+
+00001100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1106:	80 3a 00             	cmpb   $0x0,(%edx)
+    1109:	74 15                	je     1120 <strlen+0x20>
+    110b:	31 c0                	xor    %eax,%eax
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+    1110:	83 c0 01             	add    $0x1,%eax
+    1113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1117:	89 c1                	mov    %eax,%ecx
+    1119:	75 f5                	jne    1110 <strlen+0x10>
+    ;
+  return n;
+}
+    111b:	89 c8                	mov    %ecx,%eax
+    111d:	5d                   	pop    %ebp
+    111e:	c3                   	ret
+    111f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1120:	31 c9                	xor    %ecx,%ecx
+}
+    1122:	5d                   	pop    %ebp
+    1123:	89 c8                	mov    %ecx,%eax
+    1125:	c3                   	ret
+    1126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	57                   	push   %edi
+    1134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    113a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    113d:	89 d7                	mov    %edx,%edi
+    113f:	fc                   	cld
+    1140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1145:	89 d0                	mov    %edx,%eax
+    1147:	c9                   	leave
+    1148:	c3                   	ret
+    1149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	8b 45 08             	mov    0x8(%ebp),%eax
+    1156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    115a:	0f b6 10             	movzbl (%eax),%edx
+    115d:	84 d2                	test   %dl,%dl
+    115f:	75 12                	jne    1173 <strchr+0x23>
+    1161:	eb 1d                	jmp    1180 <strchr+0x30>
+    1163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1167:	90                   	nop
+    1168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    116c:	83 c0 01             	add    $0x1,%eax
+    116f:	84 d2                	test   %dl,%dl
+    1171:	74 0d                	je     1180 <strchr+0x30>
+    if(*s == c)
+    1173:	38 d1                	cmp    %dl,%cl
+    1175:	75 f1                	jne    1168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1177:	5d                   	pop    %ebp
+    1178:	c3                   	ret
+    1179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1180:	31 c0                	xor    %eax,%eax
+}
+    1182:	5d                   	pop    %ebp
+    1183:	c3                   	ret
+    1184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+
+00001190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	57                   	push   %edi
+    1194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1199:	31 db                	xor    %ebx,%ebx
+{
+    119b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    119e:	eb 27                	jmp    11c7 <gets+0x37>
+    cc = read(0, &c, 1);
+    11a0:	83 ec 04             	sub    $0x4,%esp
+    11a3:	6a 01                	push   $0x1
+    11a5:	56                   	push   %esi
+    11a6:	6a 00                	push   $0x0
+    11a8:	e8 23 02 00 00       	call   13d0 <read>
+    if(cc < 1)
+    11ad:	83 c4 10             	add    $0x10,%esp
+    11b0:	85 c0                	test   %eax,%eax
+    11b2:	7e 1d                	jle    11d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    11b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    11b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    11bf:	3c 0a                	cmp    $0xa,%al
+    11c1:	74 10                	je     11d3 <gets+0x43>
+    11c3:	3c 0d                	cmp    $0xd,%al
+    11c5:	74 0c                	je     11d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    11c7:	89 df                	mov    %ebx,%edi
+    11c9:	83 c3 01             	add    $0x1,%ebx
+    11cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    11cf:	7c cf                	jl     11a0 <gets+0x10>
+    11d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    11d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    11da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11dd:	5b                   	pop    %ebx
+    11de:	5e                   	pop    %esi
+    11df:	5f                   	pop    %edi
+    11e0:	5d                   	pop    %ebp
+    11e1:	c3                   	ret
+    11e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	56                   	push   %esi
+    11f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11f5:	83 ec 08             	sub    $0x8,%esp
+    11f8:	6a 00                	push   $0x0
+    11fa:	ff 75 08             	push   0x8(%ebp)
+    11fd:	e8 19 02 00 00       	call   141b <open>
+  if(fd < 0)
+    1202:	83 c4 10             	add    $0x10,%esp
+    1205:	85 c0                	test   %eax,%eax
+    1207:	78 27                	js     1230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1209:	83 ec 08             	sub    $0x8,%esp
+    120c:	ff 75 0c             	push   0xc(%ebp)
+    120f:	89 c3                	mov    %eax,%ebx
+    1211:	50                   	push   %eax
+    1212:	e8 31 02 00 00       	call   1448 <fstat>
+  close(fd);
+    1217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    121a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    121c:	e8 cd 01 00 00       	call   13ee <close>
+  return r;
+    1221:	83 c4 10             	add    $0x10,%esp
+}
+    1224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1227:	89 f0                	mov    %esi,%eax
+    1229:	5b                   	pop    %ebx
+    122a:	5e                   	pop    %esi
+    122b:	5d                   	pop    %ebp
+    122c:	c3                   	ret
+    122d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1235:	eb ed                	jmp    1224 <stat+0x34>
+    1237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123e:	66 90                	xchg   %ax,%ax
+
+00001240 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	53                   	push   %ebx
+    1244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1247:	0f be 02             	movsbl (%edx),%eax
+    124a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    124d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1255:	77 1e                	ja     1275 <atoi+0x35>
+    1257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1260:	83 c2 01             	add    $0x1,%edx
+    1263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    126a:	0f be 02             	movsbl (%edx),%eax
+    126d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1270:	80 fb 09             	cmp    $0x9,%bl
+    1273:	76 eb                	jbe    1260 <atoi+0x20>
+  return n;
+}
+    1275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1278:	89 c8                	mov    %ecx,%eax
+    127a:	c9                   	leave
+    127b:	c3                   	ret
+    127c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	57                   	push   %edi
+    1284:	56                   	push   %esi
+    1285:	8b 45 10             	mov    0x10(%ebp),%eax
+    1288:	8b 55 08             	mov    0x8(%ebp),%edx
+    128b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    128e:	85 c0                	test   %eax,%eax
+    1290:	7e 13                	jle    12a5 <memmove+0x25>
+    1292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1294:	89 d7                	mov    %edx,%edi
+    1296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    12a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    12a1:	39 f8                	cmp    %edi,%eax
+    12a3:	75 fb                	jne    12a0 <memmove+0x20>
+  return vdst;
+}
+    12a5:	5e                   	pop    %esi
+    12a6:	89 d0                	mov    %edx,%eax
+    12a8:	5f                   	pop    %edi
+    12a9:	5d                   	pop    %ebp
+    12aa:	c3                   	ret
+    12ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12af:	90                   	nop
+
+000012b0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	56                   	push   %esi
+    12b4:	53                   	push   %ebx
+    12b5:	8b 75 10             	mov    0x10(%ebp),%esi
+    12b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    12be:	85 f6                	test   %esi,%esi
+    12c0:	74 2e                	je     12f0 <memcmp+0x40>
+    12c2:	01 c6                	add    %eax,%esi
+    12c4:	eb 14                	jmp    12da <memcmp+0x2a>
+    12c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    12d0:	83 c0 01             	add    $0x1,%eax
+    12d3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    12d6:	39 f0                	cmp    %esi,%eax
+    12d8:	74 16                	je     12f0 <memcmp+0x40>
+    if(*s1 != *s2)
+    12da:	0f b6 0a             	movzbl (%edx),%ecx
+    12dd:	0f b6 18             	movzbl (%eax),%ebx
+    12e0:	38 d9                	cmp    %bl,%cl
+    12e2:	74 ec                	je     12d0 <memcmp+0x20>
+      return *s1 - *s2;
+    12e4:	0f b6 c1             	movzbl %cl,%eax
+    12e7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    12e9:	5b                   	pop    %ebx
+    12ea:	5e                   	pop    %esi
+    12eb:	5d                   	pop    %ebp
+    12ec:	c3                   	ret
+    12ed:	8d 76 00             	lea    0x0(%esi),%esi
+    12f0:	5b                   	pop    %ebx
+  return 0;
+    12f1:	31 c0                	xor    %eax,%eax
+}
+    12f3:	5e                   	pop    %esi
+    12f4:	5d                   	pop    %ebp
+    12f5:	c3                   	ret
+    12f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001300 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1300:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1305:	c3                   	ret
+    1306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001310 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1310:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1315:	c3                   	ret
+    1316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    131d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001320 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1320:	a1 e0 2b 00 00       	mov    0x2be0,%eax
+    1325:	85 c0                	test   %eax,%eax
+    1327:	74 17                	je     1340 <fork+0x20>
+{
+    1329:	55                   	push   %ebp
+    132a:	89 e5                	mov    %esp,%ebp
+    132c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    132f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1331:	c9                   	leave
+  return _fork();
+    1332:	e9 5d 00 00 00       	jmp    1394 <_fork>
+    1337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133e:	66 90                	xchg   %ax,%ax
+    1340:	e9 4f 00 00 00       	jmp    1394 <_fork>
+    1345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001350 <exit>:
+
+int
+exit(void)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1356:	a1 e0 2b 00 00       	mov    0x2be0,%eax
+    135b:	85 c0                	test   %eax,%eax
+    135d:	74 02                	je     1361 <exit+0x11>
+    flushhook();
+    135f:	ff d0                	call   *%eax
+  _exit();
+    1361:	e8 3d 00 00 00       	call   13a3 <_exit>
+    1366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001370 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1370:	55                   	push   %ebp
+  if(flushhook)
+    1371:	a1 e0 2b 00 00       	mov    0x2be0,%eax
+{
+    1376:	89 e5                	mov    %esp,%ebp
+    1378:	56                   	push   %esi
+    1379:	53                   	push   %ebx
+    137a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    137d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1380:	85 c0                	test   %eax,%eax
+    1382:	74 02                	je     1386 <exec+0x16>
+    flushhook();
+    1384:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1386:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1389:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    138c:	5b                   	pop    %ebx
+    138d:	5e                   	pop    %esi
+    138e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    138f:	e9 78 00 00 00       	jmp    140c <_exec>
+
+00001394 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1394:	b8 01 00 00 00       	mov    $0x1,%eax
+    1399:	89 e1                	mov    %esp,%ecx
+    139b:	ba a2 13 00 00       	mov    $0x13a2,%edx
+    13a0:	0f 34                	sysenter
+    13a2:	c3                   	ret
+
+000013a3 <_exit>:
+RAWSYSCALL(exit)
+    13a3:	b8 02 00 00 00       	mov    $0x2,%eax
+    13a8:	89 e1                	mov    %esp,%ecx
+    13aa:	ba b1 13 00 00       	mov    $0x13b1,%edx
+    13af:	0f 34                	sysenter
+    13b1:	c3                   	ret
+
+000013b2 <wait>:
+SYSCALL(wait)
+    13b2:	b8 03 00 00 00       	mov    $0x3,%eax
+    13b7:	89 e1                	mov    %esp,%ecx
+    13b9:	ba c0 13 00 00       	mov    $0x13c0,%edx
+    13be:	0f 34                	sysenter
+    13c0:	c3                   	ret
+
+000013c1 <pipe>:
+SYSCALL(pipe)
+    13c1:	b8 04 00 00 00       	mov    $0x4,%eax
+    13c6:	89 e1                	mov    %esp,%ecx
+    13c8:	ba cf 13 00 00       	mov    $0x13cf,%edx
+    13cd:	0f 34                	sysenter
+    13cf:	c3                   	ret
+
+000013d0 <read>:
+SYSCALL(read)
+    13d0:	b8 05 00 00 00       	mov    $0x5,%eax
+    13d5:	89 e1                	mov    %esp,%ecx
+    13d7:	ba de 13 00 00       	mov    $0x13de,%edx
+    13dc:	0f 34                	sysenter
+    13de:	c3                   	ret
+
+000013df <write>:
+SYSCALL(write)
+    13df:	b8 10 00 00 00       	mov    $0x10,%eax
+    13e4:	89 e1                	mov    %esp,%ecx
+    13e6:	ba ed 13 00 00       	mov    $0x13ed,%edx
+    13eb:	0f 34                	sysenter
+    13ed:	c3                   	ret
+
+000013ee <close>:
+SYSCALL(close)
+    13ee:	b8 15 00 00 00       	mov    $0x15,%eax
+    13f3:	89 e1                	mov    %esp,%ecx
+    13f5:	ba fc 13 00 00       	mov    $0x13fc,%edx
+    13fa:	0f 34                	sysenter
+    13fc:	c3                   	ret
+
+000013fd <kill>:
+SYSCALL(kill)
+    13fd:	b8 06 00 00 00       	mov    $0x6,%eax
+    1402:	89 e1                	mov    %esp,%ecx
+    1404:	ba 0b 14 00 00       	mov    $0x140b,%edx
+    1409:	0f 34                	sysenter
+    140b:	c3                   	ret
+
+0000140c <_exec>:
+RAWSYSCALL(exec)
+    140c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1411:	89 e1                	mov    %esp,%ecx
+    1413:	ba 1a 14 00 00       	mov    $0x141a,%edx
+    1418:	0f 34                	sysenter
+    141a:	c3                   	ret
+
+0000141b <open>:
+SYSCALL(open)
+    141b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1420:	89 e1                	mov    %esp,%ecx
+    1422:	ba 29 14 00 00       	mov    $0x1429,%edx
+    1427:	0f 34                	sysenter
+    1429:	c3                   	ret
+
+0000142a <mknod>:
+SYSCALL(mknod)
+    142a:	b8 11 00 00 00       	mov    $0x11,%eax
+    142f:	89 e1                	mov    %esp,%ecx
+    1431:	ba 38 14 00 00       	mov    $0x1438,%edx
+    1436:	0f 34                	sysenter
+    1438:	c3                   	ret
+
+00001439 <unlink>:
+SYSCALL(unlink)
+    1439:	b8 12 00 00 00       	mov    $0x12,%eax
+    143e:	89 e1                	mov    %esp,%ecx
+    1440:	ba 47 14 00 00       	mov    $0x1447,%edx
+    1445:	0f 34                	sysenter
+    1447:	c3                   	ret
+
+00001448 <fstat>:
+SYSCALL(fstat)
+    1448:	b8 08 00 00 00       	mov    $0x8,%eax
+    144d:	89 e1                	mov    %esp,%ecx
+    144f:	ba 56 14 00 00       	mov    $0x1456,%edx
+    1454:	0f 34                	sysenter
+    1456:	c3                   	ret
+
+00001457 <link>:
+SYSCALL(link)
+    1457:	b8 13 00 00 00       	mov    $0x13,%eax
+    145c:	89 e1                	mov    %esp,%ecx
+    145e:	ba 65 14 00 00       	mov    $0x1465,%edx
+    1463:	0f 34                	sysenter
+    1465:	c3                   	ret
+
+00001466 <mkdir>:
+SYSCALL(mkdir)
+    1466:	b8 14 00 00 00       	mov    $0x14,%eax
+    146b:	89 e1                	mov    %esp,%ecx
+    146d:	ba 74 14 00 00       	mov    $0x1474,%edx
+    1472:	0f 34                	sysenter
+    1474:	c3                   	ret
+
+00001475 <chdir>:
+SYSCALL(chdir)
+    1475:	b8 09 00 00 00       	mov    $0x9,%eax
+    147a:	89 e1                	mov    %esp,%ecx
+    147c:	ba 83 14 00 00       	mov    $0x1483,%edx
+    1481:	0f 34                	sysenter
+    1483:	c3                   	ret
+
+00001484 <dup>:
+SYSCALL(dup)
+    1484:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1489:	89 e1                	mov    %esp,%ecx
+    148b:	ba 92 14 00 00       	mov    $0x1492,%edx
+    1490:	0f 34                	sysenter
+    1492:	c3                   	ret
+
+00001493 <getpid>:
+SYSCALL(getpid)
+    1493:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1498:	89 e1                	mov    %esp,%ecx
+    149a:	ba a1 14 00 00       	mov    $0x14a1,%edx
+    149f:	0f 34                	sysenter
+    14a1:	c3                   	ret
+
+000014a2 <sbrk>:
+SYSCALL(sbrk)
+    14a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14a7:	89 e1                	mov    %esp,%ecx
+    14a9:	ba b0 14 00 00       	mov    $0x14b0,%edx
+    14ae:	0f 34                	sysenter
+    14b0:	c3                   	ret
+
+000014b1 <sleep>:
+SYSCALL(sleep)
+    14b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14b6:	89 e1                	mov    %esp,%ecx
+    14b8:	ba bf 14 00 00       	mov    $0x14bf,%edx
+    14bd:	0f 34                	sysenter
+    14bf:	c3                   	ret
+
+000014c0 <uptime>:
+SYSCALL(uptime)
+    14c0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14c5:	89 e1                	mov    %esp,%ecx
+    14c7:	ba ce 14 00 00       	mov    $0x14ce,%edx
+    14cc:	0f 34                	sysenter
+    14ce:	c3                   	ret
+
+000014cf <mprotect>:
+SYSCALL(mprotect)
+    14cf:	b8 16 00 00 00       	mov    $0x16,%eax
+    14d4:	89 e1                	mov    %esp,%ecx
+    14d6:	ba dd 14 00 00       	mov    $0x14dd,%edx
+    14db:	0f 34                	sysenter
+    14dd:	c3                   	ret
+
+000014de <munprotect>:
+SYSCALL(munprotect)
+    14de:	b8 17 00 00 00       	mov    $0x17,%eax
+    14e3:	89 e1                	mov    %esp,%ecx
+    14e5:	ba ec 14 00 00       	mov    $0x14ec,%edx
+    14ea:	0f 34                	sysenter
+    14ec:	c3                   	ret
+
+000014ed <kstat>:
+SYSCALL(kstat)
+    14ed:	b8 18 00 00 00       	mov    $0x18,%eax
+    14f2:	89 e1                	mov    %esp,%ecx
+    14f4:	ba fb 14 00 00       	mov    $0x14fb,%edx
+    14f9:	0f 34                	sysenter
+    14fb:	c3                   	ret
+
+000014fc <fcntl>:
+SYSCALL(fcntl)
+    14fc:	b8 19 00 00 00       	mov    $0x19,%eax
+    1501:	89 e1                	mov    %esp,%ecx
+    1503:	ba 0a 15 00 00       	mov    $0x150a,%edx
+    1508:	0f 34                	sysenter
+    150a:	c3                   	ret
+
+0000150b <splice>:
+SYSCALL(splice)
+    150b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1510:	89 e1                	mov    %esp,%ecx
+    1512:	ba 19 15 00 00       	mov    $0x1519,%edx
+    1517:	0f 34                	sysenter
+    1519:	c3                   	ret
+
+0000151a <sendfile>:
+SYSCALL(sendfile)
+    151a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    151f:	89 e1                	mov    %esp,%ecx
+    1521:	ba 28 15 00 00       	mov    $0x1528,%edx
+    1526:	0f 34                	sysenter
+    1528:	c3                   	ret
+
+00001529 <lseek>:
+SYSCALL(lseek)
+    1529:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    152e:	89 e1                	mov    %esp,%ecx
+    1530:	ba 37 15 00 00       	mov    $0x1537,%edx
+    1535:	0f 34                	sysenter
+    1537:	c3                   	ret
+
+00001538 <pread>:
+SYSCALL(pread)
+    1538:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    153d:	89 e1                	mov    %esp,%ecx
+    153f:	ba 46 15 00 00       	mov    $0x1546,%edx
+    1544:	0f 34                	sysenter
+    1546:	c3                   	ret
+
+00001547 <pwrite>:
+SYSCALL(pwrite)
+    1547:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    154c:	89 e1                	mov    %esp,%ecx
+    154e:	ba 55 15 00 00       	mov    $0x1555,%edx
+    1553:	0f 34                	sysenter
+    1555:	c3                   	ret
+
+00001556 <readv>:
+SYSCALL(readv)
+    1556:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    155b:	89 e1                	mov    %esp,%ecx
+    155d:	ba 64 15 00 00       	mov    $0x1564,%edx
+    1562:	0f 34                	sysenter
+    1564:	c3                   	ret
+
+00001565 <writev>:
+SYSCALL(writev)
+    1565:	b8 20 00 00 00       	mov    $0x20,%eax
+    156a:	89 e1                	mov    %esp,%ecx
+    156c:	ba 73 15 00 00       	mov    $0x1573,%edx
+    1571:	0f 34                	sysenter
+    1573:	c3                   	ret
+
+00001574 <ringsetup>:
+SYSCALL(ringsetup)
+    1574:	b8 21 00 00 00       	mov    $0x21,%eax
+    1579:	89 e1                	mov    %esp,%ecx
+    157b:	ba 82 15 00 00       	mov    $0x1582,%edx
+    1580:	0f 34                	sysenter
+    1582:	c3                   	ret
+
+00001583 <ringenter>:
+SYSCALL(ringenter)
+    1583:	b8 22 00 00 00       	mov    $0x22,%eax
+    1588:	89 e1                	mov    %esp,%ecx
+    158a:	ba 91 15 00 00       	mov    $0x1591,%edx
+    158f:	0f 34                	sysenter
+    1591:	c3                   	ret
+
+00001592 <intgetpid>:
+INTSYSCALL(getpid)
+    1592:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1597:	cd 40                	int    $0x40
+    1599:	c3                   	ret
+    159a:	66 90                	xchg   %ax,%ax
+    159c:	66 90                	xchg   %ax,%ax
+    159e:	66 90                	xchg   %ax,%ax
+
+000015a0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    15a0:	55                   	push   %ebp
+    15a1:	89 e5                	mov    %esp,%ebp
+    15a3:	57                   	push   %edi
+    15a4:	56                   	push   %esi
+    15a5:	53                   	push   %ebx
+    15a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    15a8:	89 d1                	mov    %edx,%ecx
+{
+    15aa:	83 ec 2c             	sub    $0x2c,%esp
+    15ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    15b0:	85 d2                	test   %edx,%edx
+    15b2:	0f 89 c0 00 00 00    	jns    1678 <printint+0xd8>
+    15b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    15bc:	0f 84 b6 00 00 00    	je     1678 <printint+0xd8>
+    x = -xx;
+    15c2:	f7 d9                	neg    %ecx
+    neg = 1;
+    15c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    15c9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    15cc:	31 f6                	xor    %esi,%esi
+    15ce:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    15d0:	89 c8                	mov    %ecx,%eax
+    15d2:	31 d2                	xor    %edx,%edx
+    15d4:	89 f7                	mov    %esi,%edi
+    15d6:	f7 f3                	div    %ebx
+    15d8:	8d 76 01             	lea    0x1(%esi),%esi
+    15db:	0f b6 92 e0 22 00 00 	movzbl 0x22e0(%edx),%edx
+    15e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    15e6:	89 ca                	mov    %ecx,%edx
+    15e8:	89 c1                	mov    %eax,%ecx
+    15ea:	39 da                	cmp    %ebx,%edx
+    15ec:	73 e2                	jae    15d0 <printint+0x30>
+  if(neg)
+    15ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    15f1:	85 c0                	test   %eax,%eax
+    15f3:	74 07                	je     15fc <printint+0x5c>
+    buf[i++] = '-';
+    15f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    15fa:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    15fc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    15ff:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1602:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1604:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1607:	8b 41 08             	mov    0x8(%ecx),%eax
+    160a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    160d:	89 ce                	mov    %ecx,%esi
+    160f:	eb 1c                	jmp    162d <printint+0x8d>
+    1611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1618:	89 c1                	mov    %eax,%ecx
+    161a:	83 c0 01             	add    $0x1,%eax
+    161d:	89 46 08             	mov    %eax,0x8(%esi)
+    1620:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1624:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1627:	39 df                	cmp    %ebx,%edi
+    1629:	74 41                	je     166c <printint+0xcc>
+    162b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    162d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1630:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1635:	75 e1                	jne    1618 <printint+0x78>
+  if(o->f)
+    1637:	8b 06                	mov    (%esi),%eax
+    1639:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    163c:	85 c0                	test   %eax,%eax
+    163e:	74 40                	je     1680 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1640:	50                   	push   %eax
+    1641:	68 80 00 00 00       	push   $0x80
+    1646:	6a 01                	push   $0x1
+    1648:	ff 75 d4             	push   -0x2c(%ebp)
+    164b:	e8 a0 04 00 00       	call   1af0 <fwrite>
+    1650:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1654:	83 c4 10             	add    $0x10,%esp
+}
+    1657:	b8 01 00 00 00       	mov    $0x1,%eax
+    165c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    165e:	89 46 08             	mov    %eax,0x8(%esi)
+    1661:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1665:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1668:	39 df                	cmp    %ebx,%edi
+    166a:	75 bf                	jne    162b <printint+0x8b>
+}
+    166c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    166f:	5b                   	pop    %ebx
+    1670:	5e                   	pop    %esi
+    1671:	5f                   	pop    %edi
+    1672:	5d                   	pop    %ebp
+    1673:	c3                   	ret
+    1674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1678:	31 c0                	xor    %eax,%eax
+    167a:	e9 4a ff ff ff       	jmp    15c9 <printint+0x29>
+    167f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1680:	83 ec 04             	sub    $0x4,%esp
+    1683:	68 80 00 00 00       	push   $0x80
+    1688:	ff 75 d4             	push   -0x2c(%ebp)
+    168b:	ff 76 04             	push   0x4(%esi)
+    168e:	e8 4c fd ff ff       	call   13df <write>
+    1693:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1697:	83 c4 10             	add    $0x10,%esp
+    169a:	eb bb                	jmp    1657 <printint+0xb7>
+    169c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000016a0 <putc>:
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	56                   	push   %esi
+    16a4:	89 d6                	mov    %edx,%esi
+    16a6:	53                   	push   %ebx
+    16a7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    16a9:	8b 40 08             	mov    0x8(%eax),%eax
+    16ac:	3d 80 00 00 00       	cmp    $0x80,%eax
+    16b1:	74 1d                	je     16d0 <putc+0x30>
+  o->buf[o->n++] = c;
+    16b3:	89 f1                	mov    %esi,%ecx
+    16b5:	8d 50 01             	lea    0x1(%eax),%edx
+    16b8:	89 53 08             	mov    %edx,0x8(%ebx)
+    16bb:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    16bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16c2:	5b                   	pop    %ebx
+    16c3:	5e                   	pop    %esi
+    16c4:	5d                   	pop    %ebp
+    16c5:	c3                   	ret
+    16c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    16d0:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    16d2:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    16d5:	85 c0                	test   %eax,%eax
+    16d7:	74 2f                	je     1708 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    16d9:	50                   	push   %eax
+    16da:	68 80 00 00 00       	push   $0x80
+    16df:	6a 01                	push   $0x1
+    16e1:	52                   	push   %edx
+    16e2:	e8 09 04 00 00       	call   1af0 <fwrite>
+    16e7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    16ea:	89 f1                	mov    %esi,%ecx
+}
+    16ec:	ba 01 00 00 00       	mov    $0x1,%edx
+    16f1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    16f3:	89 53 08             	mov    %edx,0x8(%ebx)
+    16f6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    16fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16fd:	5b                   	pop    %ebx
+    16fe:	5e                   	pop    %esi
+    16ff:	5d                   	pop    %ebp
+    1700:	c3                   	ret
+    1701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1708:	83 ec 04             	sub    $0x4,%esp
+    170b:	68 80 00 00 00       	push   $0x80
+    1710:	52                   	push   %edx
+    1711:	ff 73 04             	push   0x4(%ebx)
+    1714:	e8 c6 fc ff ff       	call   13df <write>
+    1719:	83 c4 10             	add    $0x10,%esp
+    171c:	eb cc                	jmp    16ea <putc+0x4a>
+    171e:	66 90                	xchg   %ax,%ax
+
+00001720 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1720:	55                   	push   %ebp
+    1721:	89 e5                	mov    %esp,%ebp
+    1723:	57                   	push   %edi
+    1724:	89 c7                	mov    %eax,%edi
+    1726:	56                   	push   %esi
+    1727:	31 f6                	xor    %esi,%esi
+    1729:	53                   	push   %ebx
+    172a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    172d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1730:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1733:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1736:	84 c0                	test   %al,%al
+    1738:	75 1e                	jne    1758 <vprintf.constprop.0+0x38>
+    173a:	eb 53                	jmp    178f <vprintf.constprop.0+0x6f>
+    173c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1740:	83 f8 25             	cmp    $0x25,%eax
+    1743:	74 3b                	je     1780 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1745:	89 ca                	mov    %ecx,%edx
+    1747:	89 f8                	mov    %edi,%eax
+    1749:	e8 52 ff ff ff       	call   16a0 <putc>
+  for(i = 0; fmt[i]; i++){
+    174e:	0f b6 03             	movzbl (%ebx),%eax
+    1751:	83 c3 01             	add    $0x1,%ebx
+    1754:	84 c0                	test   %al,%al
+    1756:	74 37                	je     178f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1758:	0f be c8             	movsbl %al,%ecx
+    175b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    175e:	85 f6                	test   %esi,%esi
+    1760:	74 de                	je     1740 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1762:	83 fe 25             	cmp    $0x25,%esi
+    1765:	75 e7                	jne    174e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1767:	83 f8 25             	cmp    $0x25,%eax
+    176a:	74 4e                	je     17ba <vprintf.constprop.0+0x9a>
+    176c:	83 e8 63             	sub    $0x63,%eax
+    176f:	83 f8 15             	cmp    $0x15,%eax
+    1772:	77 34                	ja     17a8 <vprintf.constprop.0+0x88>
+    1774:	ff 24 85 88 22 00 00 	jmp    *0x2288(,%eax,4)
+    177b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    177f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1780:	0f b6 03             	movzbl (%ebx),%eax
+    1783:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1786:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    178b:	84 c0                	test   %al,%al
+    178d:	75 c9                	jne    1758 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    178f:	8b 47 08             	mov    0x8(%edi),%eax
+    1792:	85 c0                	test   %eax,%eax
+    1794:	0f 8f de 00 00 00    	jg     1878 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    179a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    179d:	5b                   	pop    %ebx
+    179e:	5e                   	pop    %esi
+    179f:	5f                   	pop    %edi
+    17a0:	5d                   	pop    %ebp
+    17a1:	c3                   	ret
+    17a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    17a8:	ba 25 00 00 00       	mov    $0x25,%edx
+    17ad:	89 f8                	mov    %edi,%eax
+    17af:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    17b2:	e8 e9 fe ff ff       	call   16a0 <putc>
+        putc(o, c);
+    17b7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    17ba:	89 ca                	mov    %ecx,%edx
+    17bc:	89 f8                	mov    %edi,%eax
+      state = 0;
+    17be:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    17c0:	e8 db fe ff ff       	call   16a0 <putc>
+    17c5:	eb 87                	jmp    174e <vprintf.constprop.0+0x2e>
+    17c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ce:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    17d0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    17d3:	83 ec 0c             	sub    $0xc,%esp
+    17d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    17db:	8b 16                	mov    (%esi),%edx
+    17dd:	6a 00                	push   $0x0
+        ap++;
+    17df:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    17e2:	89 f8                	mov    %edi,%eax
+    17e4:	e8 b7 fd ff ff       	call   15a0 <printint>
+        ap++;
+    17e9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    17ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17ef:	31 f6                	xor    %esi,%esi
+    17f1:	e9 58 ff ff ff       	jmp    174e <vprintf.constprop.0+0x2e>
+    17f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1800:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1803:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1805:	83 c0 04             	add    $0x4,%eax
+    1808:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    180b:	85 f6                	test   %esi,%esi
+    180d:	75 1b                	jne    182a <vprintf.constprop.0+0x10a>
+    180f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1814:	be 81 22 00 00       	mov    $0x2281,%esi
+    1819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1820:	89 f8                	mov    %edi,%eax
+          s++;
+    1822:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1825:	e8 76 fe ff ff       	call   16a0 <putc>
+        while(*s != 0){
+    182a:	0f be 16             	movsbl (%esi),%edx
+    182d:	84 d2                	test   %dl,%dl
+    182f:	75 ef                	jne    1820 <vprintf.constprop.0+0x100>
+      state = 0;
+    1831:	31 f6                	xor    %esi,%esi
+    1833:	e9 16 ff ff ff       	jmp    174e <vprintf.constprop.0+0x2e>
+    1838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1840:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1843:	83 ec 0c             	sub    $0xc,%esp
+    1846:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    184b:	8b 16                	mov    (%esi),%edx
+    184d:	6a 01                	push   $0x1
+    184f:	eb 8e                	jmp    17df <vprintf.constprop.0+0xbf>
+    1851:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1858:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    185b:	89 f8                	mov    %edi,%eax
+    185d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1860:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1863:	e8 38 fe ff ff       	call   16a0 <putc>
+        ap++;
+    1868:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    186b:	31 f6                	xor    %esi,%esi
+    186d:	e9 dc fe ff ff       	jmp    174e <vprintf.constprop.0+0x2e>
+    1872:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1878:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    187a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    187d:	85 d2                	test   %edx,%edx
+    187f:	74 1f                	je     18a0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1881:	52                   	push   %edx
+    1882:	50                   	push   %eax
+    1883:	6a 01                	push   $0x1
+    1885:	51                   	push   %ecx
+    1886:	e8 65 02 00 00       	call   1af0 <fwrite>
+    188b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    188e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1898:	5b                   	pop    %ebx
+    1899:	5e                   	pop    %esi
+    189a:	5f                   	pop    %edi
+    189b:	5d                   	pop    %ebp
+    189c:	c3                   	ret
+    189d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    18a0:	83 ec 04             	sub    $0x4,%esp
+    18a3:	50                   	push   %eax
+    18a4:	51                   	push   %ecx
+    18a5:	ff 77 04             	push   0x4(%edi)
+    18a8:	e8 32 fb ff ff       	call   13df <write>
+    18ad:	83 c4 10             	add    $0x10,%esp
+    18b0:	eb dc                	jmp    188e <vprintf.constprop.0+0x16e>
+    18b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000018c0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18c9:	a1 84 29 00 00       	mov    0x2984,%eax
+{
+    18ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18d1:	83 fa 01             	cmp    $0x1,%edx
+    18d4:	74 0c                	je     18e2 <printf+0x22>
+    18d6:	31 c0                	xor    %eax,%eax
+    18d8:	83 fa 02             	cmp    $0x2,%edx
+    18db:	0f 44 05 80 29 00 00 	cmove  0x2980,%eax
+  o.fd = fd;
+    18e2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18eb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18ee:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18f4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    18fa:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1901:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1904:	e8 17 fe ff ff       	call   1720 <vprintf.constprop.0>
+}
+    1909:	c9                   	leave
+    190a:	c3                   	ret
+    190b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    190f:	90                   	nop
+
+00001910 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1910:	55                   	push   %ebp
+    1911:	89 e5                	mov    %esp,%ebp
+    1913:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1919:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    191c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    191f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1922:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1929:	ff ff ff 
+  o.n = 0;
+    192c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1933:	00 00 00 
+  o.f = f;
+    1936:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    193c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1942:	e8 d9 fd ff ff       	call   1720 <vprintf.constprop.0>
+}
+    1947:	c9                   	leave
+    1948:	c3                   	ret
+    1949:	66 90                	xchg   %ax,%ax
+    194b:	66 90                	xchg   %ax,%ax
+    194d:	66 90                	xchg   %ax,%ax
+    194f:	90                   	nop
+
+00001950 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1950:	55                   	push   %ebp
+    1951:	89 e5                	mov    %esp,%ebp
+    1953:	53                   	push   %ebx
+    1954:	89 c3                	mov    %eax,%ebx
+    1956:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1959:	8b 40 0c             	mov    0xc(%eax),%eax
+    195c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    195f:	74 17                	je     1978 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1961:	83 f8 02             	cmp    $0x2,%eax
+    1964:	74 07                	je     196d <setmode+0x1d>
+    1966:	8b 43 18             	mov    0x18(%ebx),%eax
+    1969:	85 c0                	test   %eax,%eax
+    196b:	74 38                	je     19a5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    196d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1970:	c9                   	leave
+    1971:	c3                   	ret
+    1972:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1978:	83 ec 08             	sub    $0x8,%esp
+    197b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    197e:	50                   	push   %eax
+    197f:	ff 33                	push   (%ebx)
+    1981:	e8 c2 fa ff ff       	call   1448 <fstat>
+    1986:	83 c4 10             	add    $0x10,%esp
+    1989:	89 c2                	mov    %eax,%edx
+    198b:	31 c0                	xor    %eax,%eax
+    198d:	85 d2                	test   %edx,%edx
+    198f:	75 0a                	jne    199b <setmode+0x4b>
+    1991:	31 c0                	xor    %eax,%eax
+    1993:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1998:	0f 94 c0             	sete   %al
+    199b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    199e:	8b 43 18             	mov    0x18(%ebx),%eax
+    19a1:	85 c0                	test   %eax,%eax
+    19a3:	75 c8                	jne    196d <setmode+0x1d>
+    19a5:	83 ec 0c             	sub    $0xc,%esp
+    19a8:	68 00 04 00 00       	push   $0x400
+    19ad:	e8 de 07 00 00       	call   2190 <malloc>
+    19b2:	83 c4 10             	add    $0x10,%esp
+    19b5:	89 43 18             	mov    %eax,0x18(%ebx)
+    19b8:	85 c0                	test   %eax,%eax
+    19ba:	75 b1                	jne    196d <setmode+0x1d>
+    f->mode = IONBF;
+    19bc:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    19c3:	eb a8                	jmp    196d <setmode+0x1d>
+    19c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000019d0 <drain>:
+{
+    19d0:	55                   	push   %ebp
+    19d1:	89 e5                	mov    %esp,%ebp
+    19d3:	57                   	push   %edi
+    19d4:	56                   	push   %esi
+    19d5:	53                   	push   %ebx
+    19d6:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    19d9:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    19dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    19df:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19e6:	85 ff                	test   %edi,%edi
+    19e8:	7f 0e                	jg     19f8 <drain+0x28>
+  return 0;
+    19ea:	31 c0                	xor    %eax,%eax
+}
+    19ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19ef:	5b                   	pop    %ebx
+    19f0:	5e                   	pop    %esi
+    19f1:	5f                   	pop    %edi
+    19f2:	5d                   	pop    %ebp
+    19f3:	c3                   	ret
+    19f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19fb:	8b 58 18             	mov    0x18(%eax),%ebx
+    19fe:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1a00:	eb 0e                	jmp    1a10 <drain+0x40>
+    1a02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1a08:	29 c7                	sub    %eax,%edi
+    1a0a:	01 c3                	add    %eax,%ebx
+    1a0c:	85 ff                	test   %edi,%edi
+    1a0e:	7e da                	jle    19ea <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1a10:	83 ec 04             	sub    $0x4,%esp
+    1a13:	57                   	push   %edi
+    1a14:	53                   	push   %ebx
+    1a15:	56                   	push   %esi
+    1a16:	e8 c4 f9 ff ff       	call   13df <write>
+    1a1b:	83 c4 10             	add    $0x10,%esp
+    1a1e:	85 c0                	test   %eax,%eax
+    1a20:	7f e6                	jg     1a08 <drain+0x38>
+    f->err = 1;
+    1a22:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a25:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1a2c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a31:	eb b9                	jmp    19ec <drain+0x1c>
+    1a33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001a40 <flushall>:
+
+static void
+flushall(void)
+{
+    1a40:	55                   	push   %ebp
+    1a41:	89 e5                	mov    %esp,%ebp
+    1a43:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a44:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+{
+    1a49:	83 ec 04             	sub    $0x4,%esp
+    1a4c:	eb 0d                	jmp    1a5b <flushall+0x1b>
+    1a4e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a50:	83 c3 24             	add    $0x24,%ebx
+    1a53:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1a59:	74 19                	je     1a74 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1a5b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1a5e:	85 c0                	test   %eax,%eax
+    1a60:	74 ee                	je     1a50 <flushall+0x10>
+    1a62:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a64:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1a67:	e8 64 ff ff ff       	call   19d0 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a6c:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1a72:	75 e7                	jne    1a5b <flushall+0x1b>
+}
+    1a74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a77:	c9                   	leave
+    1a78:	c3                   	ret
+    1a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a80 <fflush>:
+{
+    1a80:	55                   	push   %ebp
+    1a81:	89 e5                	mov    %esp,%ebp
+    1a83:	57                   	push   %edi
+    1a84:	56                   	push   %esi
+    1a85:	53                   	push   %ebx
+    1a86:	83 ec 0c             	sub    $0xc,%esp
+    1a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1a8c:	85 c0                	test   %eax,%eax
+    1a8e:	74 28                	je     1ab8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1a90:	8b 70 08             	mov    0x8(%eax),%esi
+    1a93:	85 f6                	test   %esi,%esi
+    1a95:	75 11                	jne    1aa8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1a97:	83 c4 0c             	add    $0xc,%esp
+    1a9a:	89 f0                	mov    %esi,%eax
+    1a9c:	5b                   	pop    %ebx
+    1a9d:	5e                   	pop    %esi
+    1a9e:	5f                   	pop    %edi
+    1a9f:	5d                   	pop    %ebp
+    1aa0:	c3                   	ret
+    1aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aa8:	83 c4 0c             	add    $0xc,%esp
+    1aab:	5b                   	pop    %ebx
+    1aac:	5e                   	pop    %esi
+    1aad:	5f                   	pop    %edi
+    1aae:	5d                   	pop    %ebp
+  return drain(f);
+    1aaf:	e9 1c ff ff ff       	jmp    19d0 <drain>
+    1ab4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1ab8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1aba:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+        r = -1;
+    1abf:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1ac4:	eb 15                	jmp    1adb <fflush+0x5b>
+    1ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1acd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ad0:	83 c3 24             	add    $0x24,%ebx
+    1ad3:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1ad9:	74 bc                	je     1a97 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1adb:	8b 43 08             	mov    0x8(%ebx),%eax
+    1ade:	85 c0                	test   %eax,%eax
+    1ae0:	74 ee                	je     1ad0 <fflush+0x50>
+    1ae2:	89 d8                	mov    %ebx,%eax
+    1ae4:	e8 e7 fe ff ff       	call   19d0 <drain>
+        r = -1;
+    1ae9:	85 c0                	test   %eax,%eax
+    1aeb:	0f 48 f7             	cmovs  %edi,%esi
+    1aee:	eb e0                	jmp    1ad0 <fflush+0x50>
+
+00001af0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1af0:	55                   	push   %ebp
+    1af1:	89 e5                	mov    %esp,%ebp
+    1af3:	57                   	push   %edi
+    1af4:	56                   	push   %esi
+    1af5:	53                   	push   %ebx
+    1af6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1af9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1afc:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1b00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1b03:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1b06:	85 d2                	test   %edx,%edx
+    1b08:	0f 8e 26 01 00 00    	jle    1c34 <fwrite+0x144>
+  if(!f->writable){
+    1b0e:	8b 46 08             	mov    0x8(%esi),%eax
+    1b11:	85 c0                	test   %eax,%eax
+    1b13:	0f 84 14 01 00 00    	je     1c2d <fwrite+0x13d>
+  setmode(f);
+    1b19:	89 f0                	mov    %esi,%eax
+    1b1b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1b1e:	e8 2d fe ff ff       	call   1950 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b23:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1b27:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1b2a:	c7 05 e0 2b 00 00 40 	movl   $0x1a40,0x2be0
+    1b31:	1a 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b34:	0f 84 b6 00 00 00    	je     1bf0 <fwrite+0x100>
+    1b3a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1b40:	0f 8f aa 00 00 00    	jg     1bf0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b46:	8b 46 20             	mov    0x20(%esi),%eax
+    1b49:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1b4c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b4e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b53:	74 6c                	je     1bc1 <fwrite+0xd1>
+    1b55:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1b58:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1b5b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1b60:	29 c2                	sub    %eax,%edx
+    1b62:	39 ca                	cmp    %ecx,%edx
+    1b64:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1b67:	85 d2                	test   %edx,%edx
+    1b69:	0f 8e d1 00 00 00    	jle    1c40 <fwrite+0x150>
+    1b6f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1b72:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1b75:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b7f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1b80:	8d 50 01             	lea    0x1(%eax),%edx
+    1b83:	83 c3 01             	add    $0x1,%ebx
+    1b86:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1b89:	89 56 20             	mov    %edx,0x20(%esi)
+    1b8c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1b90:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1b93:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1b96:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b9b:	80 fa 0a             	cmp    $0xa,%dl
+    1b9e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1ba1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1ba4:	39 cb                	cmp    %ecx,%ebx
+    1ba6:	75 d8                	jne    1b80 <fwrite+0x90>
+    1ba8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1bab:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1bae:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1bb1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1bb4:	85 db                	test   %ebx,%ebx
+    1bb6:	7e 19                	jle    1bd1 <fwrite+0xe1>
+    n -= k;
+    1bb8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1bba:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1bbf:	75 97                	jne    1b58 <fwrite+0x68>
+    1bc1:	89 f0                	mov    %esi,%eax
+    1bc3:	e8 08 fe ff ff       	call   19d0 <drain>
+    1bc8:	85 c0                	test   %eax,%eax
+    1bca:	78 68                	js     1c34 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1bcc:	8b 46 20             	mov    0x20(%esi),%eax
+    1bcf:	eb 87                	jmp    1b58 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1bd1:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1bd6:	74 74                	je     1c4c <fwrite+0x15c>
+    1bd8:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1bdc:	75 04                	jne    1be2 <fwrite+0xf2>
+    1bde:	85 ff                	test   %edi,%edi
+    1be0:	75 6a                	jne    1c4c <fwrite+0x15c>
+    return nmemb;
+    1be2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1be5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1be8:	5b                   	pop    %ebx
+    1be9:	5e                   	pop    %esi
+    1bea:	5f                   	pop    %edi
+    1beb:	5d                   	pop    %ebp
+    1bec:	c3                   	ret
+    1bed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1bf0:	89 f0                	mov    %esi,%eax
+    1bf2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1bf5:	e8 d6 fd ff ff       	call   19d0 <drain>
+    1bfa:	85 c0                	test   %eax,%eax
+    1bfc:	78 2f                	js     1c2d <fwrite+0x13d>
+    1bfe:	89 75 14             	mov    %esi,0x14(%ebp)
+    1c01:	8b 3e                	mov    (%esi),%edi
+    1c03:	89 de                	mov    %ebx,%esi
+    1c05:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1c08:	eb 0e                	jmp    1c18 <fwrite+0x128>
+    1c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1c10:	29 c3                	sub    %eax,%ebx
+    1c12:	01 c6                	add    %eax,%esi
+    1c14:	85 db                	test   %ebx,%ebx
+    1c16:	7e ca                	jle    1be2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1c18:	83 ec 04             	sub    $0x4,%esp
+    1c1b:	53                   	push   %ebx
+    1c1c:	56                   	push   %esi
+    1c1d:	57                   	push   %edi
+    1c1e:	e8 bc f7 ff ff       	call   13df <write>
+    1c23:	83 c4 10             	add    $0x10,%esp
+    1c26:	85 c0                	test   %eax,%eax
+    1c28:	7f e6                	jg     1c10 <fwrite+0x120>
+    1c2a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1c2d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1c34:	31 c0                	xor    %eax,%eax
+}
+    1c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c39:	5b                   	pop    %ebx
+    1c3a:	5e                   	pop    %esi
+    1c3b:	5f                   	pop    %edi
+    1c3c:	5d                   	pop    %ebp
+    1c3d:	c3                   	ret
+    1c3e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1c40:	89 d9                	mov    %ebx,%ecx
+    1c42:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1c45:	89 cb                	mov    %ecx,%ebx
+    1c47:	e9 6e ff ff ff       	jmp    1bba <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c4c:	89 f0                	mov    %esi,%eax
+    1c4e:	e8 7d fd ff ff       	call   19d0 <drain>
+    1c53:	85 c0                	test   %eax,%eax
+    1c55:	79 8b                	jns    1be2 <fwrite+0xf2>
+    return 0;
+    1c57:	31 c0                	xor    %eax,%eax
+    1c59:	eb db                	jmp    1c36 <fwrite+0x146>
+    1c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c5f:	90                   	nop
+
+00001c60 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1c66:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c69:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c6c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1c6f:	ff 75 0c             	push   0xc(%ebp)
+    1c72:	6a 01                	push   $0x1
+    1c74:	6a 01                	push   $0x1
+    1c76:	50                   	push   %eax
+    1c77:	e8 74 fe ff ff       	call   1af0 <fwrite>
+    1c7c:	83 c4 10             	add    $0x10,%esp
+    1c7f:	83 f8 01             	cmp    $0x1,%eax
+    1c82:	75 0c                	jne    1c90 <fputc+0x30>
+    1c84:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1c88:	c9                   	leave
+    1c89:	c3                   	ret
+    1c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1c90:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1c96:	c3                   	ret
+    1c97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c9e:	66 90                	xchg   %ax,%ax
+
+00001ca0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1ca0:	55                   	push   %ebp
+    1ca1:	89 e5                	mov    %esp,%ebp
+    1ca3:	57                   	push   %edi
+    1ca4:	56                   	push   %esi
+    1ca5:	53                   	push   %ebx
+    1ca6:	83 ec 1c             	sub    $0x1c,%esp
+    1ca9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1cac:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1caf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1cb2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1cb5:	85 d2                	test   %edx,%edx
+    1cb7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1cba:	7e 12                	jle    1cce <fread+0x2e>
+    1cbc:	85 ff                	test   %edi,%edi
+    1cbe:	7e 0e                	jle    1cce <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1cc0:	8b 43 04             	mov    0x4(%ebx),%eax
+    1cc3:	85 c0                	test   %eax,%eax
+    1cc5:	75 19                	jne    1ce0 <fread+0x40>
+    f->err = 1;
+    1cc7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1cce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1cd1:	31 c0                	xor    %eax,%eax
+}
+    1cd3:	5b                   	pop    %ebx
+    1cd4:	5e                   	pop    %esi
+    1cd5:	5f                   	pop    %edi
+    1cd6:	5d                   	pop    %ebp
+    1cd7:	c3                   	ret
+    1cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cdf:	90                   	nop
+  setmode(f);
+    1ce0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1ce2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1ce4:	e8 67 fc ff ff       	call   1950 <setmode>
+  for(n = 0; n < want; n += k){
+    1ce9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1cec:	89 f7                	mov    %esi,%edi
+    1cee:	eb 31                	jmp    1d21 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1cf0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1cf4:	74 08                	je     1cfe <fread+0x5e>
+    1cf6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1cfc:	7e 62                	jle    1d60 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1cfe:	83 ec 04             	sub    $0x4,%esp
+    1d01:	56                   	push   %esi
+    1d02:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d05:	01 f8                	add    %edi,%eax
+    1d07:	50                   	push   %eax
+    1d08:	ff 33                	push   (%ebx)
+    1d0a:	e8 c1 f6 ff ff       	call   13d0 <read>
+    1d0f:	83 c4 10             	add    $0x10,%esp
+    1d12:	85 c0                	test   %eax,%eax
+    1d14:	0f 8e ce 00 00 00    	jle    1de8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1d1a:	01 c7                	add    %eax,%edi
+    1d1c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d1f:	7e 36                	jle    1d57 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d21:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1d24:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1d27:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d2a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1d2c:	39 c1                	cmp    %eax,%ecx
+    1d2e:	7d c0                	jge    1cf0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d30:	29 c8                	sub    %ecx,%eax
+    1d32:	39 f0                	cmp    %esi,%eax
+    1d34:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1d37:	83 ec 04             	sub    $0x4,%esp
+    1d3a:	56                   	push   %esi
+    1d3b:	03 4b 18             	add    0x18(%ebx),%ecx
+    1d3e:	51                   	push   %ecx
+    1d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d42:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1d44:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1d46:	50                   	push   %eax
+    1d47:	e8 34 f5 ff ff       	call   1280 <memmove>
+      f->r += k;
+    1d4c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1d4f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1d52:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d55:	7f ca                	jg     1d21 <fread+0x81>
+    1d57:	89 fe                	mov    %edi,%esi
+    1d59:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d5c:	eb 3f                	jmp    1d9d <fread+0xfd>
+    1d5e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1d60:	3b 1d 88 29 00 00    	cmp    0x2988,%ebx
+    1d66:	74 68                	je     1dd0 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d68:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1d6b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1d72:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d79:	68 00 04 00 00       	push   $0x400
+    1d7e:	ff 73 18             	push   0x18(%ebx)
+    1d81:	ff 33                	push   (%ebx)
+    1d83:	e8 48 f6 ff ff       	call   13d0 <read>
+    1d88:	83 c4 10             	add    $0x10,%esp
+    1d8b:	85 c0                	test   %eax,%eax
+    1d8d:	78 21                	js     1db0 <fread+0x110>
+  else if(n == 0)
+    1d8f:	75 2f                	jne    1dc0 <fread+0x120>
+    f->eof = 1;
+    1d91:	89 fe                	mov    %edi,%esi
+    1d93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d96:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1d9d:	89 f0                	mov    %esi,%eax
+}
+    1d9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1da2:	99                   	cltd
+}
+    1da3:	5b                   	pop    %ebx
+    1da4:	5e                   	pop    %esi
+  return n / size;
+    1da5:	f7 ff                	idiv   %edi
+}
+    1da7:	5f                   	pop    %edi
+    1da8:	5d                   	pop    %ebp
+    1da9:	c3                   	ret
+    1daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1db0:	89 fe                	mov    %edi,%esi
+    1db2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1db5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1dbc:	eb df                	jmp    1d9d <fread+0xfd>
+    1dbe:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1dc0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1dc3:	e9 54 ff ff ff       	jmp    1d1c <fread+0x7c>
+    1dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dcf:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1dd0:	83 ec 0c             	sub    $0xc,%esp
+    1dd3:	ff 35 84 29 00 00    	push   0x2984
+    1dd9:	e8 a2 fc ff ff       	call   1a80 <fflush>
+    1dde:	83 c4 10             	add    $0x10,%esp
+    1de1:	eb 85                	jmp    1d68 <fread+0xc8>
+    1de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1de7:	90                   	nop
+        if(k < 0)
+    1de8:	89 fe                	mov    %edi,%esi
+    1dea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1ded:	74 a7                	je     1d96 <fread+0xf6>
+    1def:	eb c4                	jmp    1db5 <fread+0x115>
+    1df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dff:	90                   	nop
+
+00001e00 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1e00:	55                   	push   %ebp
+    1e01:	89 e5                	mov    %esp,%ebp
+    1e03:	53                   	push   %ebx
+    1e04:	83 ec 14             	sub    $0x14,%esp
+    1e07:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1e0a:	8b 50 04             	mov    0x4(%eax),%edx
+    1e0d:	85 d2                	test   %edx,%edx
+    1e0f:	74 08                	je     1e19 <fgetc+0x19>
+    1e11:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1e14:	3b 50 20             	cmp    0x20(%eax),%edx
+    1e17:	7c 27                	jl     1e40 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e19:	50                   	push   %eax
+    1e1a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1e1d:	6a 01                	push   $0x1
+    1e1f:	6a 01                	push   $0x1
+    1e21:	50                   	push   %eax
+    1e22:	e8 79 fe ff ff       	call   1ca0 <fread>
+    1e27:	83 c4 10             	add    $0x10,%esp
+    1e2a:	83 f8 01             	cmp    $0x1,%eax
+    1e2d:	75 29                	jne    1e58 <fgetc+0x58>
+    1e2f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1e33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e36:	c9                   	leave
+    1e37:	c3                   	ret
+    1e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e3f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1e40:	8b 48 18             	mov    0x18(%eax),%ecx
+    1e43:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1e46:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1e49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1e4c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1e50:	c9                   	leave
+    1e51:	c3                   	ret
+    1e52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e58:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e5d:	eb d4                	jmp    1e33 <fgetc+0x33>
+    1e5f:	90                   	nop
+
+00001e60 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1e60:	55                   	push   %ebp
+    1e61:	89 e5                	mov    %esp,%ebp
+    1e63:	57                   	push   %edi
+    1e64:	56                   	push   %esi
+    1e65:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1e66:	31 db                	xor    %ebx,%ebx
+{
+    1e68:	83 ec 1c             	sub    $0x1c,%esp
+    1e6b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1e6e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1e70:	eb 2e                	jmp    1ea0 <fgets+0x40>
+    1e72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e78:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1e7b:	57                   	push   %edi
+    1e7c:	6a 01                	push   $0x1
+    1e7e:	6a 01                	push   $0x1
+    1e80:	50                   	push   %eax
+    1e81:	e8 1a fe ff ff       	call   1ca0 <fread>
+    1e86:	83 c4 10             	add    $0x10,%esp
+    1e89:	83 f8 01             	cmp    $0x1,%eax
+    1e8c:	75 62                	jne    1ef0 <fgets+0x90>
+    1e8e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1e92:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e95:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1e97:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1e9b:	83 f9 0a             	cmp    $0xa,%ecx
+    1e9e:	74 34                	je     1ed4 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1ea0:	89 de                	mov    %ebx,%esi
+    1ea2:	83 c3 01             	add    $0x1,%ebx
+    1ea5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1ea8:	7d 46                	jge    1ef0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1eaa:	8b 47 04             	mov    0x4(%edi),%eax
+    1ead:	85 c0                	test   %eax,%eax
+    1eaf:	74 c7                	je     1e78 <fgets+0x18>
+    1eb1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1eb4:	3b 47 20             	cmp    0x20(%edi),%eax
+    1eb7:	7d bf                	jge    1e78 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1eb9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1ebc:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1ec2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1ec5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1ec9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1ecb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1ecf:	83 f9 0a             	cmp    $0xa,%ecx
+    1ed2:	75 cc                	jne    1ea0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1ed4:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ed7:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1edb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1ede:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ee1:	5b                   	pop    %ebx
+    1ee2:	5e                   	pop    %esi
+    1ee3:	5f                   	pop    %edi
+    1ee4:	5d                   	pop    %ebp
+    1ee5:	c3                   	ret
+    1ee6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1eed:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    1ef0:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ef3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    1ef7:	31 c0                	xor    %eax,%eax
+    1ef9:	85 f6                	test   %esi,%esi
+    1efb:	74 e1                	je     1ede <fgets+0x7e>
+    1efd:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f00:	eb dc                	jmp    1ede <fgets+0x7e>
+    1f02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001f10 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    1f10:	55                   	push   %ebp
+    1f11:	89 e5                	mov    %esp,%ebp
+    1f13:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f14:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+{
+    1f19:	83 ec 04             	sub    $0x4,%esp
+    1f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    1f20:	8b 53 04             	mov    0x4(%ebx),%edx
+    1f23:	85 d2                	test   %edx,%edx
+    1f25:	75 07                	jne    1f2e <fdopen+0x1e>
+    1f27:	8b 43 08             	mov    0x8(%ebx),%eax
+    1f2a:	85 c0                	test   %eax,%eax
+    1f2c:	74 1a                	je     1f48 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f2e:	83 c3 24             	add    $0x24,%ebx
+    1f31:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1f37:	75 e7                	jne    1f20 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    1f39:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    1f3b:	89 d8                	mov    %ebx,%eax
+    1f3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f40:	c9                   	leave
+    1f41:	c3                   	ret
+    1f42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    1f48:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1f4e:	74 e9                	je     1f39 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    1f50:	83 ec 04             	sub    $0x4,%esp
+    1f53:	6a 24                	push   $0x24
+    1f55:	6a 00                	push   $0x0
+    1f57:	53                   	push   %ebx
+    1f58:	e8 d3 f1 ff ff       	call   1130 <memset>
+  f->fd = fd;
+    1f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    1f60:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    1f67:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    1f6a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    1f6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1f6f:	80 38 72             	cmpb   $0x72,(%eax)
+    1f72:	74 14                	je     1f88 <fdopen+0x78>
+    f->writable = 1;
+    1f74:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    1f7b:	89 d8                	mov    %ebx,%eax
+    1f7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f80:	c9                   	leave
+    1f81:	c3                   	ret
+    1f82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    1f88:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    1f8f:	89 d8                	mov    %ebx,%eax
+    1f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f94:	c9                   	leave
+    1f95:	c3                   	ret
+    1f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001fa0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    1fa0:	55                   	push   %ebp
+    1fa1:	89 e5                	mov    %esp,%ebp
+    1fa3:	56                   	push   %esi
+    1fa4:	53                   	push   %ebx
+    1fa5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    1fa8:	0f b6 06             	movzbl (%esi),%eax
+    1fab:	3c 72                	cmp    $0x72,%al
+    1fad:	74 61                	je     2010 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    1faf:	3c 77                	cmp    $0x77,%al
+    1fb1:	74 7d                	je     2030 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    1fb3:	3c 61                	cmp    $0x61,%al
+    1fb5:	75 49                	jne    2000 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    1fb7:	83 ec 08             	sub    $0x8,%esp
+    1fba:	68 01 02 00 00       	push   $0x201
+    1fbf:	ff 75 08             	push   0x8(%ebp)
+    1fc2:	e8 54 f4 ff ff       	call   141b <open>
+    1fc7:	83 c4 10             	add    $0x10,%esp
+    1fca:	89 c3                	mov    %eax,%ebx
+    1fcc:	85 c0                	test   %eax,%eax
+    1fce:	78 30                	js     2000 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    1fd0:	83 ec 04             	sub    $0x4,%esp
+    1fd3:	6a 02                	push   $0x2
+    1fd5:	6a 00                	push   $0x0
+    1fd7:	50                   	push   %eax
+    1fd8:	e8 4c f5 ff ff       	call   1529 <lseek>
+    1fdd:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    1fe0:	83 ec 08             	sub    $0x8,%esp
+    1fe3:	56                   	push   %esi
+    1fe4:	53                   	push   %ebx
+    1fe5:	e8 26 ff ff ff       	call   1f10 <fdopen>
+    1fea:	83 c4 10             	add    $0x10,%esp
+    1fed:	85 c0                	test   %eax,%eax
+    1fef:	75 11                	jne    2002 <fopen+0x62>
+    close(fd);
+    1ff1:	83 ec 0c             	sub    $0xc,%esp
+    1ff4:	53                   	push   %ebx
+    1ff5:	e8 f4 f3 ff ff       	call   13ee <close>
+    1ffa:	83 c4 10             	add    $0x10,%esp
+    1ffd:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2000:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2002:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2005:	5b                   	pop    %ebx
+    2006:	5e                   	pop    %esi
+    2007:	5d                   	pop    %ebp
+    2008:	c3                   	ret
+    2009:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2010:	83 ec 08             	sub    $0x8,%esp
+    2013:	6a 00                	push   $0x0
+    2015:	ff 75 08             	push   0x8(%ebp)
+    2018:	e8 fe f3 ff ff       	call   141b <open>
+    201d:	83 c4 10             	add    $0x10,%esp
+    2020:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2022:	85 db                	test   %ebx,%ebx
+    2024:	78 da                	js     2000 <fopen+0x60>
+    2026:	eb b8                	jmp    1fe0 <fopen+0x40>
+    2028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    202f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2030:	83 ec 08             	sub    $0x8,%esp
+    2033:	68 01 06 00 00       	push   $0x601
+    2038:	ff 75 08             	push   0x8(%ebp)
+    203b:	e8 db f3 ff ff       	call   141b <open>
+    2040:	83 c4 10             	add    $0x10,%esp
+    2043:	89 c3                	mov    %eax,%ebx
+    2045:	eb db                	jmp    2022 <fopen+0x82>
+    2047:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    204e:	66 90                	xchg   %ax,%ax
+
+00002050 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2050:	55                   	push   %ebp
+    2051:	89 e5                	mov    %esp,%ebp
+    2053:	56                   	push   %esi
+    2054:	53                   	push   %ebx
+    2055:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2058:	83 ec 0c             	sub    $0xc,%esp
+    205b:	53                   	push   %ebx
+    205c:	e8 1f fa ff ff       	call   1a80 <fflush>
+    2061:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2063:	58                   	pop    %eax
+    2064:	ff 33                	push   (%ebx)
+    2066:	e8 83 f3 ff ff       	call   13ee <close>
+    206b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    206e:	85 c0                	test   %eax,%eax
+    2070:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2075:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2078:	8b 43 18             	mov    0x18(%ebx),%eax
+    207b:	85 c0                	test   %eax,%eax
+    207d:	0f 95 c1             	setne  %cl
+    2080:	3d 00 30 00 00       	cmp    $0x3000,%eax
+    2085:	0f 95 c2             	setne  %dl
+    2088:	84 d1                	test   %dl,%cl
+    208a:	74 07                	je     2093 <fclose+0x43>
+    208c:	3d 00 2c 00 00       	cmp    $0x2c00,%eax
+    2091:	75 25                	jne    20b8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2093:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    209a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    209c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    20a3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    20aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    20ad:	5b                   	pop    %ebx
+    20ae:	5e                   	pop    %esi
+    20af:	5d                   	pop    %ebp
+    20b0:	c3                   	ret
+    20b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    20b8:	83 ec 0c             	sub    $0xc,%esp
+    20bb:	50                   	push   %eax
+    20bc:	e8 3f 00 00 00       	call   2100 <free>
+    20c1:	83 c4 10             	add    $0x10,%esp
+    20c4:	eb cd                	jmp    2093 <fclose+0x43>
+    20c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020d0 <feof>:
+
+int
+feof(FILE *f)
+{
+    20d0:	55                   	push   %ebp
+    20d1:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    20d3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20d6:	5d                   	pop    %ebp
+  return f->eof;
+    20d7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    20da:	c3                   	ret
+    20db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20df:	90                   	nop
+
+000020e0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    20e0:	55                   	push   %ebp
+    20e1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    20e3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20e6:	5d                   	pop    %ebp
+  return f->err;
+    20e7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    20ea:	c3                   	ret
+    20eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20ef:	90                   	nop
+
+000020f0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    20f0:	55                   	push   %ebp
+    20f1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    20f3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20f6:	5d                   	pop    %ebp
+  return f->fd;
+    20f7:	8b 00                	mov    (%eax),%eax
+}
+    20f9:	c3                   	ret
+    20fa:	66 90                	xchg   %ax,%ax
+    20fc:	66 90                	xchg   %ax,%ax
+    20fe:	66 90                	xchg   %ax,%ax
+
+00002100 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2100:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2101:	a1 00 34 00 00       	mov    0x3400,%eax
+{
+    2106:	89 e5                	mov    %esp,%ebp
+    2108:	57                   	push   %edi
+    2109:	56                   	push   %esi
+    210a:	53                   	push   %ebx
+    210b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    210e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2118:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    211a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    211c:	39 ca                	cmp    %ecx,%edx
+    211e:	73 30                	jae    2150 <free+0x50>
+    2120:	39 c1                	cmp    %eax,%ecx
+    2122:	72 04                	jb     2128 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2124:	39 c2                	cmp    %eax,%edx
+    2126:	72 f0                	jb     2118 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2128:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    212b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    212e:	39 f8                	cmp    %edi,%eax
+    2130:	74 2e                	je     2160 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2132:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2135:	8b 42 04             	mov    0x4(%edx),%eax
+    2138:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    213b:	39 f1                	cmp    %esi,%ecx
+    213d:	74 38                	je     2177 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    213f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2141:	5b                   	pop    %ebx
+  freep = p;
+    2142:	89 15 00 34 00 00    	mov    %edx,0x3400
+}
+    2148:	5e                   	pop    %esi
+    2149:	5f                   	pop    %edi
+    214a:	5d                   	pop    %ebp
+    214b:	c3                   	ret
+    214c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2150:	39 c1                	cmp    %eax,%ecx
+    2152:	72 d0                	jb     2124 <free+0x24>
+    2154:	eb c2                	jmp    2118 <free+0x18>
+    2156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    215d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2160:	03 70 04             	add    0x4(%eax),%esi
+    2163:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2166:	8b 02                	mov    (%edx),%eax
+    2168:	8b 00                	mov    (%eax),%eax
+    216a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    216d:	8b 42 04             	mov    0x4(%edx),%eax
+    2170:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2173:	39 f1                	cmp    %esi,%ecx
+    2175:	75 c8                	jne    213f <free+0x3f>
+    p->s.size += bp->s.size;
+    2177:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    217a:	89 15 00 34 00 00    	mov    %edx,0x3400
+    p->s.size += bp->s.size;
+    2180:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2183:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2186:	89 0a                	mov    %ecx,(%edx)
+}
+    2188:	5b                   	pop    %ebx
+    2189:	5e                   	pop    %esi
+    218a:	5f                   	pop    %edi
+    218b:	5d                   	pop    %ebp
+    218c:	c3                   	ret
+    218d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002190 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2190:	55                   	push   %ebp
+    2191:	89 e5                	mov    %esp,%ebp
+    2193:	57                   	push   %edi
+    2194:	56                   	push   %esi
+    2195:	53                   	push   %ebx
+    2196:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2199:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    219c:	8b 15 00 34 00 00    	mov    0x3400,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    21a2:	8d 78 07             	lea    0x7(%eax),%edi
+    21a5:	c1 ef 03             	shr    $0x3,%edi
+    21a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    21ab:	85 d2                	test   %edx,%edx
+    21ad:	0f 84 8d 00 00 00    	je     2240 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    21b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    21b5:	8b 48 04             	mov    0x4(%eax),%ecx
+    21b8:	39 f9                	cmp    %edi,%ecx
+    21ba:	73 64                	jae    2220 <malloc+0x90>
+  if(nu < 4096)
+    21bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    21c1:	39 df                	cmp    %ebx,%edi
+    21c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    21c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    21cd:	eb 0a                	jmp    21d9 <malloc+0x49>
+    21cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    21d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    21d2:	8b 48 04             	mov    0x4(%eax),%ecx
+    21d5:	39 f9                	cmp    %edi,%ecx
+    21d7:	73 47                	jae    2220 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    21d9:	89 c2                	mov    %eax,%edx
+    21db:	39 05 00 34 00 00    	cmp    %eax,0x3400
+    21e1:	75 ed                	jne    21d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    21e3:	83 ec 0c             	sub    $0xc,%esp
+    21e6:	56                   	push   %esi
+    21e7:	e8 b6 f2 ff ff       	call   14a2 <sbrk>
+  if(p == (char*)-1)
+    21ec:	83 c4 10             	add    $0x10,%esp
+    21ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+    21f2:	74 1c                	je     2210 <malloc+0x80>
+  hp->s.size = nu;
+    21f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    21f7:	83 ec 0c             	sub    $0xc,%esp
+    21fa:	83 c0 08             	add    $0x8,%eax
+    21fd:	50                   	push   %eax
+    21fe:	e8 fd fe ff ff       	call   2100 <free>
+  return freep;
+    2203:	8b 15 00 34 00 00    	mov    0x3400,%edx
+      if((p = morecore(nunits)) == 0)
+    2209:	83 c4 10             	add    $0x10,%esp
+    220c:	85 d2                	test   %edx,%edx
+    220e:	75 c0                	jne    21d0 <malloc+0x40>
+        return 0;
+  }
+}
+    2210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2213:	31 c0                	xor    %eax,%eax
+}
+    2215:	5b                   	pop    %ebx
+    2216:	5e                   	pop    %esi
+    2217:	5f                   	pop    %edi
+    2218:	5d                   	pop    %ebp
+    2219:	c3                   	ret
+    221a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2220:	39 cf                	cmp    %ecx,%edi
+    2222:	74 4c                	je     2270 <malloc+0xe0>
+        p->s.size -= nunits;
+    2224:	29 f9                	sub    %edi,%ecx
+    2226:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2229:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    222c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    222f:	89 15 00 34 00 00    	mov    %edx,0x3400
+}
+    2235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2238:	83 c0 08             	add    $0x8,%eax
+}
+    223b:	5b                   	pop    %ebx
+    223c:	5e                   	pop    %esi
+    223d:	5f                   	pop    %edi
+    223e:	5d                   	pop    %ebp
+    223f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2240:	c7 05 00 34 00 00 04 	movl   $0x3404,0x3400
+    2247:	34 00 00 
+    base.s.size = 0;
+    224a:	b8 04 34 00 00       	mov    $0x3404,%eax
+    base.s.ptr = freep = prevp = &base;
+    224f:	c7 05 04 34 00 00 04 	movl   $0x3404,0x3404
+    2256:	34 00 00 
+    base.s.size = 0;
+    2259:	c7 05 08 34 00 00 00 	movl   $0x0,0x3408
+    2260:	00 00 00 
+    if(p->s.size >= nunits){
+    2263:	e9 54 ff ff ff       	jmp    21bc <malloc+0x2c>
+    2268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    226f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2270:	8b 08                	mov    (%eax),%ecx
+    2272:	89 0a                	mov    %ecx,(%edx)
+    2274:	eb b9                	jmp    222f <malloc+0x9f>
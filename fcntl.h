@@ -2,3 +2,19 @@
 #define O_WRONLY  0x001
 #define O_RDWR    0x002
 #define O_CREATE  0x200
+#define O_TRUNC   0x400
+
+// fcntl() commands
+#define F_SETPIPE_SZ 1031  // resize a pipe's buffer
+#define F_GETPIPE_SZ 1032  // get the size of a pipe's buffer
+
+// lseek() whence
+#define SEEK_SET  0
+#define SEEK_CUR  1
+#define SEEK_END  2
+
+// A buffer for readv() and writev().
+struct iovec {
+  void *iov_base;
+  int iov_len;
+};
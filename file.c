@@ -5,10 +5,12 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "fcntl.h"
 
 struct devsw devsw[NDEV];
 struct {
@@ -112,46 +114,294 @@ fileread(struct file *f, char *addr, int n)
   panic("fileread");
 }
 
+// Read from file f at offset off, leaving f's offset alone.
+int
+filepread(struct file *f, char *addr, int n, uint off)
+{
+  int r;
+
+  if(f->readable == 0 || f->type != FD_INODE)
+    return -1;
+  ilock(f->ip);
+  r = readi(f->ip, addr, off, n);
+  iunlock(f->ip);
+  return r;
+}
+
+// Read into the cnt buffers of iov from inode file f at *off,
+// advancing *off, under one ilock.  Stops at the end of the file.
+static int
+inodereadv(struct file *f, struct iovec *iov, int cnt, uint *off)
+{
+  int i, r, tot;
+
+  tot = 0;
+  ilock(f->ip);
+  for(i = 0; i < cnt; i++){
+    if((r = readi(f->ip, iov[i].iov_base, *off, iov[i].iov_len)) < 0){
+      if(tot == 0)
+        tot = -1;
+      break;
+    }
+    *off += r;
+    tot += r;
+    if(r < iov[i].iov_len)
+      break;
+  }
+  iunlock(f->ip);
+  return tot;
+}
+
 //PAGEBREAK!
+// Write the cnt buffers of iov to inode file f at *off,
+// advancing *off.  Buffers share a transaction while they fit.
+// Returns the bytes written, which a failure cuts short,
+// or -1 if it came before any were.
+static int
+inodewritev(struct file *f, struct iovec *iov, int cnt, uint *off)
+{
+  // write a few blocks at a time to avoid exceeding
+  // the maximum log transaction size, including
+  // i-node, up to two indirect blocks at each of
+  // three levels and their allocation blocks,
+  // and 2 blocks of slop for non-aligned writes.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  // Since the buffers go to consecutive offsets, they
+  // need no more slop together than one write would.
+  int max = ((MAXOPBLOCKS-1-3*2*2-2) / 2) * BSIZE;
+  int i, r, n1, done, tx, tot, intx;
+
+  tot = tx = intx = 0;
+  for(i = 0; i < cnt; i++){
+    for(done = 0; done < iov[i].iov_len; done += r){
+      if(intx && tx == max){
+        iunlock(f->ip);
+        end_op();
+        intx = 0;
+      }
+      if(!intx){
+        begin_op();
+        ilock(f->ip);
+        intx = 1;
+        tx = 0;
+      }
+      n1 = iov[i].iov_len - done;
+      if(n1 > max - tx)
+        n1 = max - tx;
+      if((r = writei(f->ip, (char*)iov[i].iov_base + done, *off, n1)) > 0){
+        *off += r;
+        tot += r;
+        tx += r;
+      }
+      if(r != n1){
+        // error, or a missing user page
+        if(tot == 0)
+          tot = -1;
+        goto out;
+      }
+    }
+  }
+out:
+  if(intx){
+    iunlock(f->ip);
+    end_op();
+  }
+  return tot;
+}
+
 // Write to file f.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
+  struct iovec iov;
 
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return pipewrite(f->pipe, addr, n);
   if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
+    iov.iov_base = addr;
+    iov.iov_len = n;
+    return inodewritev(f, &iov, 1, &f->off);
+  }
+  panic("filewrite");
+}
 
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
+// Write to file f at offset off, leaving f's offset alone.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+  struct iovec iov;
+
+  if(f->writable == 0 || f->type != FD_INODE)
+    return -1;
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return inodewritev(f, &iov, 1, &off);
+}
+
+// Read from file f into the cnt buffers of iov.  From a pipe,
+// each buffer is a separate read, and a short one ends it.
+int
+filereadv(struct file *f, struct iovec *iov, int cnt)
+{
+  int i, r, tot;
 
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+  if(f->readable == 0)
+    return -1;
+  if(f->type == FD_INODE)
+    return inodereadv(f, iov, cnt, &f->off);
+  tot = 0;
+  for(i = 0; i < cnt; i++){
+    if((r = fileread(f, iov[i].iov_base, iov[i].iov_len)) < 0){
+      if(tot == 0)
+        tot = -1;
+      break;
     }
-    return i == n ? n : -1;
+    tot += r;
+    if(r < iov[i].iov_len)
+      break;
   }
-  panic("filewrite");
+  return tot;
+}
+
+// Write the cnt buffers of iov to file f.  If one fails,
+// returns what the ones before it wrote.
+int
+filewritev(struct file *f, struct iovec *iov, int cnt)
+{
+  int i, tot;
+
+  if(f->writable == 0)
+    return -1;
+  if(f->type == FD_INODE)
+    return inodewritev(f, iov, cnt, &f->off);
+  tot = 0;
+  for(i = 0; i < cnt; i++){
+    if(filewrite(f, iov[i].iov_base, iov[i].iov_len) < 0){
+      if(tot == 0)
+        tot = -1;
+      break;
+    }
+    tot += iov[i].iov_len;
+  }
+  return tot;
+}
+
+// Set f's offset: to off, or off past its current value or
+// past the end of the file, as whence says.  Files have no
+// holes, so the offset cannot pass the end.
+int
+fileseek(struct file *f, int off, int whence)
+{
+  uint base, size;
+
+  if(f->type != FD_INODE)
+    return -1;
+  ilock(f->ip);
+  size = f->ip->size;
+  iunlock(f->ip);
+  switch(whence){
+  case SEEK_SET:
+    base = 0;
+    break;
+  case SEEK_CUR:
+    base = f->off;
+    break;
+  case SEEK_END:
+    base = size;
+    break;
+  default:
+    return -1;
+  }
+  // -(off+1) cannot overflow, as -off can.
+  if((off < 0 && (uint)-(off+1) >= base) || base + off > size)
+    return -1;
+  f->off = base + off;
+  return f->off;
+}
+
+// Move up to n bytes from fin to fout without copying them
+// through user memory.  One of them must be a pipe.
+int
+filesplice(struct file *fin, struct file *fout, int n)
+{
+  if(fin->readable == 0 || fout->writable == 0)
+    return -1;
+  if(fin->type == FD_PIPE && fout->type == FD_PIPE)
+    return pipesplice(fin->pipe, fout->pipe, n);
+  if(fin->type == FD_INODE && fout->type == FD_PIPE)
+    return pipesplicein(fout->pipe, fin, 0, n);
+  if(fin->type == FD_PIPE && fout->type == FD_INODE)
+    return pipespliceout(fin->pipe, fout, n);
+  return -1;
 }
 
+// Copy up to n bytes from file fin, starting at offset off, or
+// at fin's offset if off is negative, to fout, a file or pipe.
+// To a file, the data goes through a kernel page, a page at a
+// time, in transactions as large as filewrite() would use; the
+// two inodes are never locked at once.  fin and fout must
+// differ, since each has its offset advanced.
+int
+filesendfile(struct file *fout, struct file *fin, int off, int n)
+{
+  int max = ((MAXOPBLOCKS-1-3*2*2-2) / 2) * BSIZE;
+  int i, m, r, w, tx, err, eof;
+  uint o;
+  char *page;
+
+  if(fin == fout || fin->readable == 0 || fin->type != FD_INODE ||
+     fout->writable == 0)
+    return -1;
+  o = off < 0 ? fin->off : off;
+  if(fout->type == FD_PIPE)
+    i = pipesplicein(fout->pipe, fin, &o, n);
+  else if(fout->type == FD_INODE){
+    if((page = kalloc()) == 0)
+      return -1;
+    err = eof = 0;
+    for(i = 0; i < n && !err && !eof; ){
+      begin_op();
+      for(tx = 0; tx < max && i < n; tx += r){
+        m = n - i;
+        if(m > PGSIZE)
+          m = PGSIZE;
+        if(m > max - tx)
+          m = max - tx;
+        ilock(fin->ip);
+        r = readi(fin->ip, page, o, m);
+        iunlock(fin->ip);
+        if(r <= 0){
+          err = r < 0;
+          eof = r == 0;
+          break;
+        }
+        ilock(fout->ip);
+        if((w = writei(fout->ip, page, fout->off, r)) > 0){
+          fout->off += w;
+          o += w;
+          i += w;
+        }
+        iunlock(fout->ip);
+        if(w != r){
+          err = 1;
+          break;
+        }
+        if(r < m){
+          eof = 1;
+          break;
+        }
+      }
+      end_op();
+    }
+    kfree(page);
+    if(i == 0 && err)
+      i = -1;
+  } else
+    return -1;
+  if(off < 0 && i > 0)
+    fin->off += i;
+  return i;
+}
@@ -14,6 +14,9 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext; // icache hash chain
+  struct inode *prev; // icache LRU list, while ref is 0
+  struct inode *next;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -22,7 +25,9 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+3];
+
+  uint bgoal;         // block to try first for the next allocation
 };
 
 // table mapping major device number to
@@ -0,0 +1,961 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+    1006:	e8 35 00 00 00       	call   1040 <forktest>
+  exit();
+    100b:	e8 f0 03 00 00       	call   1400 <exit>
+
+00001010 <printf>:
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	53                   	push   %ebx
+    1014:	83 ec 10             	sub    $0x10,%esp
+    1017:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+    101a:	53                   	push   %ebx
+    101b:	e8 90 01 00 00       	call   11b0 <strlen>
+    1020:	83 c4 0c             	add    $0xc,%esp
+    1023:	50                   	push   %eax
+    1024:	53                   	push   %ebx
+    1025:	ff 75 08             	push   0x8(%ebp)
+    1028:	e8 62 04 00 00       	call   148f <write>
+}
+    102d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1030:	83 c4 10             	add    $0x10,%esp
+    1033:	c9                   	leave
+    1034:	c3                   	ret
+    1035:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001040 <forktest>:
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+    1044:	31 db                	xor    %ebx,%ebx
+{
+    1046:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+    1049:	68 4c 16 00 00       	push   $0x164c
+    104e:	e8 5d 01 00 00       	call   11b0 <strlen>
+    1053:	83 c4 0c             	add    $0xc,%esp
+    1056:	50                   	push   %eax
+    1057:	68 4c 16 00 00       	push   $0x164c
+    105c:	6a 01                	push   $0x1
+    105e:	e8 2c 04 00 00       	call   148f <write>
+    1063:	83 c4 10             	add    $0x10,%esp
+    1066:	eb 19                	jmp    1081 <forktest+0x41>
+    1068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+    if(pid == 0)
+    1070:	74 5b                	je     10cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+    1072:	83 c3 01             	add    $0x1,%ebx
+    1075:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    107b:	0f 84 86 00 00 00    	je     1107 <forktest+0xc7>
+    pid = fork();
+    1081:	e8 4a 03 00 00       	call   13d0 <fork>
+    if(pid < 0)
+    1086:	85 c0                	test   %eax,%eax
+    1088:	79 e6                	jns    1070 <forktest+0x30>
+  for(; n > 0; n--){
+    108a:	85 db                	test   %ebx,%ebx
+    108c:	74 10                	je     109e <forktest+0x5e>
+    108e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+    1090:	e8 cd 03 00 00       	call   1462 <wait>
+    1095:	85 c0                	test   %eax,%eax
+    1097:	78 39                	js     10d2 <forktest+0x92>
+  for(; n > 0; n--){
+    1099:	83 eb 01             	sub    $0x1,%ebx
+    109c:	75 f2                	jne    1090 <forktest+0x50>
+  if(wait() != -1){
+    109e:	e8 bf 03 00 00       	call   1462 <wait>
+    10a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10a6:	75 4c                	jne    10f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+    10a8:	83 ec 0c             	sub    $0xc,%esp
+    10ab:	68 7e 16 00 00       	push   $0x167e
+    10b0:	e8 fb 00 00 00       	call   11b0 <strlen>
+    10b5:	83 c4 0c             	add    $0xc,%esp
+    10b8:	50                   	push   %eax
+    10b9:	68 7e 16 00 00       	push   $0x167e
+    10be:	6a 01                	push   $0x1
+    10c0:	e8 ca 03 00 00       	call   148f <write>
+}
+    10c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10c8:	83 c4 10             	add    $0x10,%esp
+    10cb:	c9                   	leave
+    10cc:	c3                   	ret
+      exit();
+    10cd:	e8 2e 03 00 00       	call   1400 <exit>
+  write(fd, s, strlen(s));
+    10d2:	83 ec 0c             	sub    $0xc,%esp
+    10d5:	68 57 16 00 00       	push   $0x1657
+    10da:	e8 d1 00 00 00       	call   11b0 <strlen>
+    10df:	83 c4 0c             	add    $0xc,%esp
+    10e2:	50                   	push   %eax
+    10e3:	68 57 16 00 00       	push   $0x1657
+    10e8:	6a 01                	push   $0x1
+    10ea:	e8 a0 03 00 00       	call   148f <write>
+      exit();
+    10ef:	e8 0c 03 00 00       	call   1400 <exit>
+    printf(1, "wait got too many\n");
+    10f4:	50                   	push   %eax
+    10f5:	50                   	push   %eax
+    10f6:	68 6b 16 00 00       	push   $0x166b
+    10fb:	6a 01                	push   $0x1
+    10fd:	e8 0e ff ff ff       	call   1010 <printf>
+    exit();
+    1102:	e8 f9 02 00 00       	call   1400 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+    1107:	52                   	push   %edx
+    1108:	68 e8 03 00 00       	push   $0x3e8
+    110d:	68 8c 16 00 00       	push   $0x168c
+    1112:	6a 01                	push   $0x1
+    1114:	e8 f7 fe ff ff       	call   1010 <printf>
+    exit();
+    1119:	e8 e2 02 00 00       	call   1400 <exit>
+    111e:	66 90                	xchg   %ax,%ax
+
+00001120 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1121:	31 c0                	xor    %eax,%eax
+{
+    1123:	89 e5                	mov    %esp,%ebp
+    1125:	53                   	push   %ebx
+    1126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    112c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1137:	83 c0 01             	add    $0x1,%eax
+    113a:	84 d2                	test   %dl,%dl
+    113c:	75 f2                	jne    1130 <strcpy+0x10>
+    ;
+  return os;
+}
+    113e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1141:	89 c8                	mov    %ecx,%eax
+    1143:	c9                   	leave
+    1144:	c3                   	ret
+    1145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	53                   	push   %ebx
+    1154:	8b 55 08             	mov    0x8(%ebp),%edx
+    1157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    115a:	0f b6 02             	movzbl (%edx),%eax
+    115d:	84 c0                	test   %al,%al
+    115f:	75 17                	jne    1178 <strcmp+0x28>
+    1161:	eb 3a                	jmp    119d <strcmp+0x4d>
+    1163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1167:	90                   	nop
+    1168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    116c:	83 c2 01             	add    $0x1,%edx
+    116f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1172:	84 c0                	test   %al,%al
+    1174:	74 1a                	je     1190 <strcmp+0x40>
+    p++, q++;
+    1176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1178:	0f b6 19             	movzbl (%ecx),%ebx
+    117b:	38 c3                	cmp    %al,%bl
+    117d:	74 e9                	je     1168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    117f:	29 d8                	sub    %ebx,%eax
+}
+    1181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1184:	c9                   	leave
+    1185:	c3                   	ret
+    1186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1194:	31 c0                	xor    %eax,%eax
+    1196:	29 d8                	sub    %ebx,%eax
+}
+    1198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    119b:	c9                   	leave
+    119c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    119d:	0f b6 19             	movzbl (%ecx),%ebx
+    11a0:	31 c0                	xor    %eax,%eax
+    11a2:	eb db                	jmp    117f <strcmp+0x2f>
+    11a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11af:	90                   	nop
+
+000011b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    11b6:	80 3a 00             	cmpb   $0x0,(%edx)
+    11b9:	74 15                	je     11d0 <strlen+0x20>
+    11bb:	31 c0                	xor    %eax,%eax
+    11bd:	8d 76 00             	lea    0x0(%esi),%esi
+    11c0:	83 c0 01             	add    $0x1,%eax
+    11c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    11c7:	89 c1                	mov    %eax,%ecx
+    11c9:	75 f5                	jne    11c0 <strlen+0x10>
+    ;
+  return n;
+}
+    11cb:	89 c8                	mov    %ecx,%eax
+    11cd:	5d                   	pop    %ebp
+    11ce:	c3                   	ret
+    11cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    11d0:	31 c9                	xor    %ecx,%ecx
+}
+    11d2:	5d                   	pop    %ebp
+    11d3:	89 c8                	mov    %ecx,%eax
+    11d5:	c3                   	ret
+    11d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	57                   	push   %edi
+    11e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    11e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11ed:	89 d7                	mov    %edx,%edi
+    11ef:	fc                   	cld
+    11f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11f5:	89 d0                	mov    %edx,%eax
+    11f7:	c9                   	leave
+    11f8:	c3                   	ret
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	8b 45 08             	mov    0x8(%ebp),%eax
+    1206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    120a:	0f b6 10             	movzbl (%eax),%edx
+    120d:	84 d2                	test   %dl,%dl
+    120f:	75 12                	jne    1223 <strchr+0x23>
+    1211:	eb 1d                	jmp    1230 <strchr+0x30>
+    1213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1217:	90                   	nop
+    1218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    121c:	83 c0 01             	add    $0x1,%eax
+    121f:	84 d2                	test   %dl,%dl
+    1221:	74 0d                	je     1230 <strchr+0x30>
+    if(*s == c)
+    1223:	38 d1                	cmp    %dl,%cl
+    1225:	75 f1                	jne    1218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1227:	5d                   	pop    %ebp
+    1228:	c3                   	ret
+    1229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1230:	31 c0                	xor    %eax,%eax
+}
+    1232:	5d                   	pop    %ebp
+    1233:	c3                   	ret
+    1234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+
+00001240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1249:	31 db                	xor    %ebx,%ebx
+{
+    124b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    124e:	eb 27                	jmp    1277 <gets+0x37>
+    cc = read(0, &c, 1);
+    1250:	83 ec 04             	sub    $0x4,%esp
+    1253:	6a 01                	push   $0x1
+    1255:	56                   	push   %esi
+    1256:	6a 00                	push   $0x0
+    1258:	e8 23 02 00 00       	call   1480 <read>
+    if(cc < 1)
+    125d:	83 c4 10             	add    $0x10,%esp
+    1260:	85 c0                	test   %eax,%eax
+    1262:	7e 1d                	jle    1281 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1268:	8b 55 08             	mov    0x8(%ebp),%edx
+    126b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    126f:	3c 0a                	cmp    $0xa,%al
+    1271:	74 10                	je     1283 <gets+0x43>
+    1273:	3c 0d                	cmp    $0xd,%al
+    1275:	74 0c                	je     1283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1277:	89 df                	mov    %ebx,%edi
+    1279:	83 c3 01             	add    $0x1,%ebx
+    127c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    127f:	7c cf                	jl     1250 <gets+0x10>
+    1281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1283:	8b 45 08             	mov    0x8(%ebp),%eax
+    1286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    128a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    128d:	5b                   	pop    %ebx
+    128e:	5e                   	pop    %esi
+    128f:	5f                   	pop    %edi
+    1290:	5d                   	pop    %ebp
+    1291:	c3                   	ret
+    1292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	56                   	push   %esi
+    12a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    12a5:	83 ec 08             	sub    $0x8,%esp
+    12a8:	6a 00                	push   $0x0
+    12aa:	ff 75 08             	push   0x8(%ebp)
+    12ad:	e8 19 02 00 00       	call   14cb <open>
+  if(fd < 0)
+    12b2:	83 c4 10             	add    $0x10,%esp
+    12b5:	85 c0                	test   %eax,%eax
+    12b7:	78 27                	js     12e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    12b9:	83 ec 08             	sub    $0x8,%esp
+    12bc:	ff 75 0c             	push   0xc(%ebp)
+    12bf:	89 c3                	mov    %eax,%ebx
+    12c1:	50                   	push   %eax
+    12c2:	e8 31 02 00 00       	call   14f8 <fstat>
+  close(fd);
+    12c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    12ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+    12cc:	e8 cd 01 00 00       	call   149e <close>
+  return r;
+    12d1:	83 c4 10             	add    $0x10,%esp
+}
+    12d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12d7:	89 f0                	mov    %esi,%eax
+    12d9:	5b                   	pop    %ebx
+    12da:	5e                   	pop    %esi
+    12db:	5d                   	pop    %ebp
+    12dc:	c3                   	ret
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    12e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12e5:	eb ed                	jmp    12d4 <stat+0x34>
+    12e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ee:	66 90                	xchg   %ax,%ax
+
+000012f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	53                   	push   %ebx
+    12f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12f7:	0f be 02             	movsbl (%edx),%eax
+    12fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1305:	77 1e                	ja     1325 <atoi+0x35>
+    1307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1310:	83 c2 01             	add    $0x1,%edx
+    1313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    131a:	0f be 02             	movsbl (%edx),%eax
+    131d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1320:	80 fb 09             	cmp    $0x9,%bl
+    1323:	76 eb                	jbe    1310 <atoi+0x20>
+  return n;
+}
+    1325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1328:	89 c8                	mov    %ecx,%eax
+    132a:	c9                   	leave
+    132b:	c3                   	ret
+    132c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	57                   	push   %edi
+    1334:	56                   	push   %esi
+    1335:	8b 45 10             	mov    0x10(%ebp),%eax
+    1338:	8b 55 08             	mov    0x8(%ebp),%edx
+    133b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    133e:	85 c0                	test   %eax,%eax
+    1340:	7e 13                	jle    1355 <memmove+0x25>
+    1342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1344:	89 d7                	mov    %edx,%edi
+    1346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1351:	39 f8                	cmp    %edi,%eax
+    1353:	75 fb                	jne    1350 <memmove+0x20>
+  return vdst;
+}
+    1355:	5e                   	pop    %esi
+    1356:	89 d0                	mov    %edx,%eax
+    1358:	5f                   	pop    %edi
+    1359:	5d                   	pop    %ebp
+    135a:	c3                   	ret
+    135b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    135f:	90                   	nop
+
+00001360 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	56                   	push   %esi
+    1364:	53                   	push   %ebx
+    1365:	8b 75 10             	mov    0x10(%ebp),%esi
+    1368:	8b 55 08             	mov    0x8(%ebp),%edx
+    136b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    136e:	85 f6                	test   %esi,%esi
+    1370:	74 2e                	je     13a0 <memcmp+0x40>
+    1372:	01 c6                	add    %eax,%esi
+    1374:	eb 14                	jmp    138a <memcmp+0x2a>
+    1376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1380:	83 c0 01             	add    $0x1,%eax
+    1383:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1386:	39 f0                	cmp    %esi,%eax
+    1388:	74 16                	je     13a0 <memcmp+0x40>
+    if(*s1 != *s2)
+    138a:	0f b6 0a             	movzbl (%edx),%ecx
+    138d:	0f b6 18             	movzbl (%eax),%ebx
+    1390:	38 d9                	cmp    %bl,%cl
+    1392:	74 ec                	je     1380 <memcmp+0x20>
+      return *s1 - *s2;
+    1394:	0f b6 c1             	movzbl %cl,%eax
+    1397:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1399:	5b                   	pop    %ebx
+    139a:	5e                   	pop    %esi
+    139b:	5d                   	pop    %ebp
+    139c:	c3                   	ret
+    139d:	8d 76 00             	lea    0x0(%esi),%esi
+    13a0:	5b                   	pop    %ebx
+  return 0;
+    13a1:	31 c0                	xor    %eax,%eax
+}
+    13a3:	5e                   	pop    %esi
+    13a4:	5d                   	pop    %ebp
+    13a5:	c3                   	ret
+    13a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013b0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    13b0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    13b5:	c3                   	ret
+    13b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013c0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    13c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    13c5:	c3                   	ret
+    13c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013d0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    13d0:	a1 5c 19 00 00       	mov    0x195c,%eax
+    13d5:	85 c0                	test   %eax,%eax
+    13d7:	74 17                	je     13f0 <fork+0x20>
+{
+    13d9:	55                   	push   %ebp
+    13da:	89 e5                	mov    %esp,%ebp
+    13dc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    13df:	ff d0                	call   *%eax
+  return _fork();
+}
+    13e1:	c9                   	leave
+  return _fork();
+    13e2:	e9 5d 00 00 00       	jmp    1444 <_fork>
+    13e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ee:	66 90                	xchg   %ax,%ax
+    13f0:	e9 4f 00 00 00       	jmp    1444 <_fork>
+    13f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001400 <exit>:
+
+int
+exit(void)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1406:	a1 5c 19 00 00       	mov    0x195c,%eax
+    140b:	85 c0                	test   %eax,%eax
+    140d:	74 02                	je     1411 <exit+0x11>
+    flushhook();
+    140f:	ff d0                	call   *%eax
+  _exit();
+    1411:	e8 3d 00 00 00       	call   1453 <_exit>
+    1416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001420 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1420:	55                   	push   %ebp
+  if(flushhook)
+    1421:	a1 5c 19 00 00       	mov    0x195c,%eax
+{
+    1426:	89 e5                	mov    %esp,%ebp
+    1428:	56                   	push   %esi
+    1429:	53                   	push   %ebx
+    142a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    142d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1430:	85 c0                	test   %eax,%eax
+    1432:	74 02                	je     1436 <exec+0x16>
+    flushhook();
+    1434:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1436:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1439:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    143c:	5b                   	pop    %ebx
+    143d:	5e                   	pop    %esi
+    143e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    143f:	e9 78 00 00 00       	jmp    14bc <_exec>
+
+00001444 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1444:	b8 01 00 00 00       	mov    $0x1,%eax
+    1449:	89 e1                	mov    %esp,%ecx
+    144b:	ba 52 14 00 00       	mov    $0x1452,%edx
+    1450:	0f 34                	sysenter
+    1452:	c3                   	ret
+
+00001453 <_exit>:
+RAWSYSCALL(exit)
+    1453:	b8 02 00 00 00       	mov    $0x2,%eax
+    1458:	89 e1                	mov    %esp,%ecx
+    145a:	ba 61 14 00 00       	mov    $0x1461,%edx
+    145f:	0f 34                	sysenter
+    1461:	c3                   	ret
+
+00001462 <wait>:
+SYSCALL(wait)
+    1462:	b8 03 00 00 00       	mov    $0x3,%eax
+    1467:	89 e1                	mov    %esp,%ecx
+    1469:	ba 70 14 00 00       	mov    $0x1470,%edx
+    146e:	0f 34                	sysenter
+    1470:	c3                   	ret
+
+00001471 <pipe>:
+SYSCALL(pipe)
+    1471:	b8 04 00 00 00       	mov    $0x4,%eax
+    1476:	89 e1                	mov    %esp,%ecx
+    1478:	ba 7f 14 00 00       	mov    $0x147f,%edx
+    147d:	0f 34                	sysenter
+    147f:	c3                   	ret
+
+00001480 <read>:
+SYSCALL(read)
+    1480:	b8 05 00 00 00       	mov    $0x5,%eax
+    1485:	89 e1                	mov    %esp,%ecx
+    1487:	ba 8e 14 00 00       	mov    $0x148e,%edx
+    148c:	0f 34                	sysenter
+    148e:	c3                   	ret
+
+0000148f <write>:
+SYSCALL(write)
+    148f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1494:	89 e1                	mov    %esp,%ecx
+    1496:	ba 9d 14 00 00       	mov    $0x149d,%edx
+    149b:	0f 34                	sysenter
+    149d:	c3                   	ret
+
+0000149e <close>:
+SYSCALL(close)
+    149e:	b8 15 00 00 00       	mov    $0x15,%eax
+    14a3:	89 e1                	mov    %esp,%ecx
+    14a5:	ba ac 14 00 00       	mov    $0x14ac,%edx
+    14aa:	0f 34                	sysenter
+    14ac:	c3                   	ret
+
+000014ad <kill>:
+SYSCALL(kill)
+    14ad:	b8 06 00 00 00       	mov    $0x6,%eax
+    14b2:	89 e1                	mov    %esp,%ecx
+    14b4:	ba bb 14 00 00       	mov    $0x14bb,%edx
+    14b9:	0f 34                	sysenter
+    14bb:	c3                   	ret
+
+000014bc <_exec>:
+RAWSYSCALL(exec)
+    14bc:	b8 07 00 00 00       	mov    $0x7,%eax
+    14c1:	89 e1                	mov    %esp,%ecx
+    14c3:	ba ca 14 00 00       	mov    $0x14ca,%edx
+    14c8:	0f 34                	sysenter
+    14ca:	c3                   	ret
+
+000014cb <open>:
+SYSCALL(open)
+    14cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+    14d0:	89 e1                	mov    %esp,%ecx
+    14d2:	ba d9 14 00 00       	mov    $0x14d9,%edx
+    14d7:	0f 34                	sysenter
+    14d9:	c3                   	ret
+
+000014da <mknod>:
+SYSCALL(mknod)
+    14da:	b8 11 00 00 00       	mov    $0x11,%eax
+    14df:	89 e1                	mov    %esp,%ecx
+    14e1:	ba e8 14 00 00       	mov    $0x14e8,%edx
+    14e6:	0f 34                	sysenter
+    14e8:	c3                   	ret
+
+000014e9 <unlink>:
+SYSCALL(unlink)
+    14e9:	b8 12 00 00 00       	mov    $0x12,%eax
+    14ee:	89 e1                	mov    %esp,%ecx
+    14f0:	ba f7 14 00 00       	mov    $0x14f7,%edx
+    14f5:	0f 34                	sysenter
+    14f7:	c3                   	ret
+
+000014f8 <fstat>:
+SYSCALL(fstat)
+    14f8:	b8 08 00 00 00       	mov    $0x8,%eax
+    14fd:	89 e1                	mov    %esp,%ecx
+    14ff:	ba 06 15 00 00       	mov    $0x1506,%edx
+    1504:	0f 34                	sysenter
+    1506:	c3                   	ret
+
+00001507 <link>:
+SYSCALL(link)
+    1507:	b8 13 00 00 00       	mov    $0x13,%eax
+    150c:	89 e1                	mov    %esp,%ecx
+    150e:	ba 15 15 00 00       	mov    $0x1515,%edx
+    1513:	0f 34                	sysenter
+    1515:	c3                   	ret
+
+00001516 <mkdir>:
+SYSCALL(mkdir)
+    1516:	b8 14 00 00 00       	mov    $0x14,%eax
+    151b:	89 e1                	mov    %esp,%ecx
+    151d:	ba 24 15 00 00       	mov    $0x1524,%edx
+    1522:	0f 34                	sysenter
+    1524:	c3                   	ret
+
+00001525 <chdir>:
+SYSCALL(chdir)
+    1525:	b8 09 00 00 00       	mov    $0x9,%eax
+    152a:	89 e1                	mov    %esp,%ecx
+    152c:	ba 33 15 00 00       	mov    $0x1533,%edx
+    1531:	0f 34                	sysenter
+    1533:	c3                   	ret
+
+00001534 <dup>:
+SYSCALL(dup)
+    1534:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1539:	89 e1                	mov    %esp,%ecx
+    153b:	ba 42 15 00 00       	mov    $0x1542,%edx
+    1540:	0f 34                	sysenter
+    1542:	c3                   	ret
+
+00001543 <getpid>:
+SYSCALL(getpid)
+    1543:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1548:	89 e1                	mov    %esp,%ecx
+    154a:	ba 51 15 00 00       	mov    $0x1551,%edx
+    154f:	0f 34                	sysenter
+    1551:	c3                   	ret
+
+00001552 <sbrk>:
+SYSCALL(sbrk)
+    1552:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1557:	89 e1                	mov    %esp,%ecx
+    1559:	ba 60 15 00 00       	mov    $0x1560,%edx
+    155e:	0f 34                	sysenter
+    1560:	c3                   	ret
+
+00001561 <sleep>:
+SYSCALL(sleep)
+    1561:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1566:	89 e1                	mov    %esp,%ecx
+    1568:	ba 6f 15 00 00       	mov    $0x156f,%edx
+    156d:	0f 34                	sysenter
+    156f:	c3                   	ret
+
+00001570 <uptime>:
+SYSCALL(uptime)
+    1570:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1575:	89 e1                	mov    %esp,%ecx
+    1577:	ba 7e 15 00 00       	mov    $0x157e,%edx
+    157c:	0f 34                	sysenter
+    157e:	c3                   	ret
+
+0000157f <mprotect>:
+SYSCALL(mprotect)
+    157f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1584:	89 e1                	mov    %esp,%ecx
+    1586:	ba 8d 15 00 00       	mov    $0x158d,%edx
+    158b:	0f 34                	sysenter
+    158d:	c3                   	ret
+
+0000158e <munprotect>:
+SYSCALL(munprotect)
+    158e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1593:	89 e1                	mov    %esp,%ecx
+    1595:	ba 9c 15 00 00       	mov    $0x159c,%edx
+    159a:	0f 34                	sysenter
+    159c:	c3                   	ret
+
+0000159d <kstat>:
+SYSCALL(kstat)
+    159d:	b8 18 00 00 00       	mov    $0x18,%eax
+    15a2:	89 e1                	mov    %esp,%ecx
+    15a4:	ba ab 15 00 00       	mov    $0x15ab,%edx
+    15a9:	0f 34                	sysenter
+    15ab:	c3                   	ret
+
+000015ac <fcntl>:
+SYSCALL(fcntl)
+    15ac:	b8 19 00 00 00       	mov    $0x19,%eax
+    15b1:	89 e1                	mov    %esp,%ecx
+    15b3:	ba ba 15 00 00       	mov    $0x15ba,%edx
+    15b8:	0f 34                	sysenter
+    15ba:	c3                   	ret
+
+000015bb <splice>:
+SYSCALL(splice)
+    15bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    15c0:	89 e1                	mov    %esp,%ecx
+    15c2:	ba c9 15 00 00       	mov    $0x15c9,%edx
+    15c7:	0f 34                	sysenter
+    15c9:	c3                   	ret
+
+000015ca <sendfile>:
+SYSCALL(sendfile)
+    15ca:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    15cf:	89 e1                	mov    %esp,%ecx
+    15d1:	ba d8 15 00 00       	mov    $0x15d8,%edx
+    15d6:	0f 34                	sysenter
+    15d8:	c3                   	ret
+
+000015d9 <lseek>:
+SYSCALL(lseek)
+    15d9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    15de:	89 e1                	mov    %esp,%ecx
+    15e0:	ba e7 15 00 00       	mov    $0x15e7,%edx
+    15e5:	0f 34                	sysenter
+    15e7:	c3                   	ret
+
+000015e8 <pread>:
+SYSCALL(pread)
+    15e8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    15ed:	89 e1                	mov    %esp,%ecx
+    15ef:	ba f6 15 00 00       	mov    $0x15f6,%edx
+    15f4:	0f 34                	sysenter
+    15f6:	c3                   	ret
+
+000015f7 <pwrite>:
+SYSCALL(pwrite)
+    15f7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    15fc:	89 e1                	mov    %esp,%ecx
+    15fe:	ba 05 16 00 00       	mov    $0x1605,%edx
+    1603:	0f 34                	sysenter
+    1605:	c3                   	ret
+
+00001606 <readv>:
+SYSCALL(readv)
+    1606:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    160b:	89 e1                	mov    %esp,%ecx
+    160d:	ba 14 16 00 00       	mov    $0x1614,%edx
+    1612:	0f 34                	sysenter
+    1614:	c3                   	ret
+
+00001615 <writev>:
+SYSCALL(writev)
+    1615:	b8 20 00 00 00       	mov    $0x20,%eax
+    161a:	89 e1                	mov    %esp,%ecx
+    161c:	ba 23 16 00 00       	mov    $0x1623,%edx
+    1621:	0f 34                	sysenter
+    1623:	c3                   	ret
+
+00001624 <ringsetup>:
+SYSCALL(ringsetup)
+    1624:	b8 21 00 00 00       	mov    $0x21,%eax
+    1629:	89 e1                	mov    %esp,%ecx
+    162b:	ba 32 16 00 00       	mov    $0x1632,%edx
+    1630:	0f 34                	sysenter
+    1632:	c3                   	ret
+
+00001633 <ringenter>:
+SYSCALL(ringenter)
+    1633:	b8 22 00 00 00       	mov    $0x22,%eax
+    1638:	89 e1                	mov    %esp,%ecx
+    163a:	ba 41 16 00 00       	mov    $0x1641,%edx
+    163f:	0f 34                	sysenter
+    1641:	c3                   	ret
+
+00001642 <intgetpid>:
+INTSYSCALL(getpid)
+    1642:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1647:	cd 40                	int    $0x40
+    1649:	c3                   	ret
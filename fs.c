@@ -14,15 +14,17 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "kstat.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
-static void itrunc(struct inode*);
+static uint blast(struct inode*);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -52,31 +54,113 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// Allocation hints.  bcursor is just past the last block
+// allocated; balloc starts there when the caller has no better
+// idea, rather than rescanning the allocated start of the disk.
+// bfreecnt[i] counts the free blocks in bitmap block i, or is
+// BFREEUNKNOWN until that block is first read, so full bitmap
+// blocks can be skipped without reading them.  A count changes
+// only while its bitmap block is locked; others may read it
+// unlocked, as a hint.
+#define NBFREECNT 4096
+#define BFREEUNKNOWN 0xffff
+static uint bcursor;
+static ushort bfreecnt[NBFREECNT];
+static uint nzeroed, nnozero;   // blocks allocated with and without bzero
+
+// Count the free blocks in bitmap block bp,
+// whose first bit is for block b.
 static uint
-balloc(uint dev)
+bcountfree(struct buf *bp, uint b)
 {
-  int b, bi, m;
+  uint *map, nbits, n, w, x;
+
+  map = (uint*)bp->data;
+  nbits = sb.size - b < BPB ? sb.size - b : BPB;
+  n = 0;
+  for(w = 0; w*32 < nbits; w++){
+    x = ~map[w];
+    if(nbits - w*32 < 32)
+      x &= (1 << (nbits - w*32)) - 1;
+    for(; x; x &= x - 1)
+      n++;
+  }
+  return n;
+}
+
+// Allocate a run of up to want contiguous disk blocks, at or
+// after goal if possible, all marked in one bitmap block.
+// Returns the first block and sets *got to the run's length.
+// The blocks are zeroed unless zero is 0, in which case the
+// caller must overwrite every one of them in the same
+// transaction, before anyone can read them.
+static uint
+ballocrun(uint dev, uint goal, uint want, uint *got, int zero)
+{
+  uint b, bi, i, k, n, w, nbmap, *map;
   struct buf *bp;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
+  if(goal == 0 || goal >= sb.size)
+    goal = bcursor;
+
+  // Visit each bitmap block once, starting at goal's and wrapping
+  // around, then the part of the first one before goal.
+  // Search a word at a time for a clear bit.
+  nbmap = (sb.size + BPB - 1) / BPB;
+  b = goal - goal % BPB;
+  w = goal % BPB / 32;
+  for(i = 0; i <= nbmap; i++){
+    n = b / BPB;
+    if(n >= NBFREECNT || bfreecnt[n] != 0){
+      bp = bread(dev, BBLOCK(b, sb));
+      if(n < NBFREECNT && bfreecnt[n] == BFREEUNKNOWN)
+        bfreecnt[n] = bcountfree(bp, b);
+      map = (uint*)bp->data;
+      for(; w < BPB/32; w++){
+        if(map[w] == 0xffffffff)
+          continue;
+        bi = w*32 + bsf(~map[w]);
+        if(b + bi >= sb.size)
+          break;
+        // Mark blocks in use, as many free ones in a row as wanted.
+        for(k = bi; k < bi + want && k < BPB && b + k < sb.size; k++){
+          if(map[k/32] & (1 << (k % 32)))
+            break;
+          map[k/32] |= 1 << (k % 32);
+        }
+        if(n < NBFREECNT)
+          bfreecnt[n] -= k - bi;
         log_write(bp);
         brelse(bp);
-        bzero(dev, b + bi);
+        bcursor = b + k < sb.size ? b + k : 0;
+        *got = k - bi;
+        if(zero){
+          for(k = 0; k < *got; k++)
+            bzero(dev, b + bi + k);
+          nzeroed += *got;
+        } else
+          nnozero += *got;
         return b + bi;
       }
+      brelse(bp);
     }
-    brelse(bp);
+    w = 0;
+    b += BPB;
+    if(b >= sb.size)
+      b = 0;
   }
   panic("balloc: out of blocks");
 }
 
+// Allocate a zeroed disk block, at or after goal if possible.
+static uint
+balloc(uint dev, uint goal)
+{
+  uint got;
+
+  return ballocrun(dev, goal, 1, &got, 1);
+}
+
 // Free a disk block.
 static void
 bfree(int dev, uint b)
@@ -90,6 +174,8 @@ bfree(int dev, uint b)
   if((bp->data[bi/8] & m) == 0)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
+  if(b/BPB < NBFREECNT && bfreecnt[b/BPB] != BFREEUNKNOWN)
+    bfreecnt[b/BPB]++;
   log_write(bp);
   brelse(bp);
 }
@@ -120,17 +206,19 @@ bfree(int dev, uint b)
 //   the reference and link counts have fallen to zero.
 //
 // * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
+//   is unused if ip->ref is zero. Otherwise ip->ref tracks
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() finds or
 //   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+//   decrements ref.  An unused entry keeps its inode until
+//   iget() recycles it, least recently used first, so that
+//   reopening a file soon after need not read the disk.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
 //   ilock() reads the inode from
 //   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ip->valid when it frees the inode on disk.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -155,34 +243,70 @@ bfree(int dev, uint b)
 // multi-step atomic operations.
 //
 // The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
+// entries. Since ip->ref indicates whether an entry is in use,
 // and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// holds, one must hold icache.lock while using any of those
+// fields, or the hash and LRU links.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
+//
+// Entries are allocated a page at a time as the cache grows,
+// up to NINODE of them.  Each entry holding an inode is on the
+// hash chain for its (dev, inum); each unused entry is also on
+// the LRU list, most recently used first.
+
+#define NIHASH 127
+#define IHASH(dev, inum) (((dev)*31 + (inum)) % NIHASH)
 
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *hash[NIHASH];
+  int n;               // entries allocated so far
+
+  // List of unused entries, through prev/next.
+  // lru.next is most recently used.
+  struct inode lru;
 } icache;
+static uint ihits, imisses;
 
+// Set up the empty inode cache.  Called from main(), since
+// userinit() looks up "/" before the first process runs iinit().
 void
-iinit(int dev)
+icacheinit(void)
 {
-  int i = 0;
-  
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  icache.lru.prev = &icache.lru;
+  icache.lru.next = &icache.lru;
+}
 
+void
+iinit(int dev)
+{
   readsb(dev, &sb);
+  memset(bfreecnt, 0xff, sizeof(bfreecnt));  // BFREEUNKNOWN
+  if(sb.bsize != BSIZE)
+    panic("iinit: file system block size");
+  if(sb.size > idesize(dev))
+    panic("iinit: file system larger than disk");
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
- inodestart %d bmap start %d\n", sb.size, sb.nblocks,
+ inodestart %d bmap start %d bsize %d flags %x\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
-          sb.bmapstart);
+          sb.bmapstart, sb.bsize, sb.flags);
+}
+
+// Report block allocation and inode cache statistics.
+void
+fsstat(struct kstat *st)
+{
+  st->fs_zeroed = nzeroed;
+  st->fs_nozero = nnozero;
+  acquire(&icache.lock);
+  st->icache_hits = ihits;
+  st->icache_misses = imisses;
+  st->icache_size = icache.n;
+  release(&icache.lock);
 }
 
 static struct inode* iget(uint dev, uint inum);
@@ -235,37 +359,80 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// Unlink ip from the LRU list.  Caller holds icache.lock.
+static void
+lruremove(struct inode *ip)
+{
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+}
+
+// Add a page of fresh entries to the LRU list, if the
+// cache may grow.  Caller holds icache.lock.
+static void
+igrow(void)
+{
+  struct inode *ip, *end;
+  char *mem;
+
+  if(icache.n >= NINODE || (mem = kalloc()) == 0)
+    return;
+  memset(mem, 0, PGSIZE);
+  end = (struct inode*)mem + PGSIZE/sizeof(struct inode);
+  for(ip = (struct inode*)mem; ip < end && icache.n < NINODE; ip++){
+    initsleeplock(&ip->lock, "inode");
+    ip->inum = 0;   // on no hash chain
+    // Least recently used end, so these are taken first.
+    ip->prev = icache.lru.prev;
+    ip->next = &icache.lru;
+    icache.lru.prev->next = ip;
+    icache.lru.prev = ip;
+    icache.n++;
+  }
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(ip = icache.hash[IHASH(dev, inum)]; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        lruremove(ip);
+      ihits++;
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
-
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  imisses++;
+
+  // Recycle the least recently used entry, after
+  // growing the cache if it is still small.
+  if(icache.lru.prev == &icache.lru)
+    igrow();
+  ip = icache.lru.prev;
+  if(ip == &icache.lru)
     panic("iget: no inodes");
+  lruremove(ip);
+  if(ip->inum != 0){
+    for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+      ;
+    *pp = ip->hnext;
+  }
 
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->hnext = icache.hash[IHASH(dev, inum)];
+  icache.hash[IHASH(dev, inum)] = ip;
   release(&icache.lock);
 
   return ip;
@@ -289,6 +456,7 @@ ilock(struct inode *ip)
 {
   struct buf *bp;
   struct dinode *dip;
+  uint addr;
 
   if(ip == 0 || ip->ref < 1)
     panic("ilock");
@@ -305,6 +473,11 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    // Grow the file next to its last block.
+    if((addr = blast(ip)) != 0)
+      ip->bgoal = addr + 1;
+    else
+      ip->bgoal = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -338,6 +511,8 @@ iput(struct inode *ip)
     release(&icache.lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcpurge(ip->dev, ip->inum);
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
@@ -347,7 +522,21 @@ iput(struct inode *ip)
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref == 0){
+    // Keep a valid inode for reuse, most recently used
+    // first; a freed one is the first to be recycled.
+    if(ip->valid){
+      ip->next = icache.lru.next;
+      ip->prev = &icache.lru;
+      icache.lru.next->prev = ip;
+      icache.lru.next = ip;
+    } else {
+      ip->prev = icache.lru.prev;
+      ip->next = &icache.lru;
+      icache.lru.prev->next = ip;
+      icache.lru.prev = ip;
+    }
+  }
   release(&icache.lock);
 }
 
@@ -365,71 +554,429 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT], the next NDINDIRECT
+// in the blocks listed in ip->addrs[NDIRECT+1], and the
+// last NTINDIRECT one level further down from ip->addrs[NDIRECT+2].
+
+// Allocate a block for ip, next to the one it got last
+// so that its blocks tend to be contiguous.
+static uint
+iballoc(struct inode *ip, int zero)
+{
+  uint addr, got;
+
+  addr = ballocrun(ip->dev, ip->bgoal, 1, &got, zero);
+  ip->bgoal = addr + 1;
+  return addr;
+}
+
+static uint emap(struct inode*, uint);
+static uint eextend(struct inode*, uint, uint);
 
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap allocates one.  A caller
+// about to overwrite the whole block passes fresh, and if the
+// block is new it is left unzeroed and *fresh is set to 1.
 static uint
-bmap(struct inode *ip, uint bn)
+bmap(struct inode *ip, uint bn, int *fresh)
 {
-  uint addr, *a;
+  uint addr, *a, level, n, i;
   struct buf *bp;
 
+  if(sb.flags & FS_EXTENTS){
+    if((addr = emap(ip, bn)) == 0){
+      eextend(ip, bn+1, 0);
+      addr = emap(ip, bn);
+    }
+    return addr;
+  }
+
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[bn]) == 0){
+      ip->addrs[bn] = addr = iballoc(ip, fresh == 0);
+      if(fresh)
+        *fresh = 1;
+    }
     return addr;
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  // Find the level of indirection that maps bn; the tree
+  // rooted at ip->addrs[NDIRECT+level] maps n blocks.
+  n = NINDIRECT;
+  for(level = 0; level < 3 && bn >= n; level++){
+    bn -= n;
+    n *= NINDIRECT;
+  }
+  if(level == 3)
+    panic("bmap: out of range");
+
+  if((addr = ip->addrs[NDIRECT+level]) == 0)
+    ip->addrs[NDIRECT+level] = addr = iballoc(ip, 1);
+  do {
+    // Load indirect block, allocating the next one if necessary.
+    n /= NINDIRECT;
+    i = bn / n;
+    bn %= n;
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[i]) == 0){
+      // Indirect blocks are always zeroed; only data can be fresh.
+      a[i] = addr = iballoc(ip, n > 1 || fresh == 0);
+      if(n == 1 && fresh)
+        *fresh = 1;
       log_write(bp);
     }
     brelse(bp);
-    return addr;
+  } while(n > 1);
+  return addr;
+}
+
+// Return the disk block address of the last block of
+// block-mapped inode ip, or 0 if it has none, without
+// allocating.  Extent-mapped inodes find their own goal.
+static uint
+blast(struct inode *ip)
+{
+  uint addr, bn, level, n;
+  struct buf *bp;
+
+  if((sb.flags & FS_EXTENTS) || ip->size == 0)
+    return 0;
+  bn = (ip->size-1)/BSIZE;
+  if(bn < NDIRECT)
+    return ip->addrs[bn];
+  bn -= NDIRECT;
+
+  n = NINDIRECT;
+  for(level = 0; level < 3 && bn >= n; level++){
+    bn -= n;
+    n *= NINDIRECT;
+  }
+  if(level == 3)
+    return 0;
+  addr = ip->addrs[NDIRECT+level];
+  while(addr != 0 && n > 1){
+    n /= NINDIRECT;
+    bp = bread(ip->dev, addr);
+    addr = ((uint*)bp->data)[bn / n];
+    brelse(bp);
+    bn %= n;
   }
+  return addr;
+}
+
+// Truncation frees a large file over several transactions,
+// as filewrite() writes one, so that freeing its blocks never
+// logs more than TRUNCBLOCKS blocks at a time.  The first
+// transaction is the caller's.  Each leaves the inode mapping
+// only blocks not yet freed, so a crash at worst leaks some.
+#define TRUNCBLOCKS (MAXOPBLOCKS/2)
 
-  panic("bmap: out of range");
+struct trunc {
+  struct inode *ip;
+  int budget;   // blocks this transaction may still log
+  uint lastbb;  // bitmap block of the last block freed
+};
+
+// Free block b, unless it needs a bitmap block logged and
+// the transaction has no room left for one.
+static int
+tfree(struct trunc *t, uint b)
+{
+  if(BBLOCK(b, sb) != t->lastbb){
+    if(t->budget == 0)
+      return 0;
+    t->budget--;
+    t->lastbb = BBLOCK(b, sb);
+  }
+  bfree(t->ip->dev, b);
+  return 1;
 }
 
-// Truncate inode (discard contents).
-// Only called when the inode has no links
-// to it (no directory entries referring to it)
-// and has no in-memory reference to it (is
-// not an open file or current directory).
+// Record the inode and go on in a new transaction.
 static void
-itrunc(struct inode *ip)
+tnext(struct trunc *t)
+{
+  iupdate(t->ip);
+  end_op();
+  begin_op();
+  t->budget = TRUNCBLOCKS;
+  t->lastbb = 0;
+}
+
+// Free the blocks listed in indirect block *addr, which are
+// themselves indirect if level > 0, clearing their entries.
+// If that finishes within t's budget, frees *addr too, sets
+// it to 0, and returns 1.
+static int
+ifreeind(struct trunc *t, uint *addr, int level)
 {
-  int i, j;
   struct buf *bp;
   uint *a;
+  int j, done, dirty;
 
-  for(i = 0; i < NDIRECT; i++){
-    if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
-      ip->addrs[i] = 0;
+  if(t->budget == 0)
+    return 0;
+  t->budget--;  // to log bp
+  bp = bread(t->ip->dev, *addr);
+  a = (uint*)bp->data;
+  done = 1;
+  dirty = 0;
+  for(j = 0; j < NINDIRECT && done; j++){
+    if(a[j] == 0)
+      continue;
+    if(level > 0)
+      done = ifreeind(t, &a[j], level-1);
+    else if((done = tfree(t, a[j])) != 0)
+      a[j] = 0;
+    if(a[j] == 0)
+      dirty = 1;
+  }
+  if(dirty)
+    log_write(bp);
+  else
+    t->budget++;
+  brelse(bp);
+  if(!done || !tfree(t, *addr))
+    return 0;
+  *addr = 0;
+  return 1;
+}
+
+// Extent-mapped inodes.
+//
+// With FS_EXTENTS, ip->addrs[] holds NEXTENT extents followed by
+// the address of a chain of extent blocks.  Files only grow at the
+// end, so the extents map the file's blocks in order, and new
+// blocks either lengthen the last extent or start a new one.
+
+// Return the disk block address of the nth block in extent-mapped
+// inode ip, or 0 if it has not been allocated.
+static uint
+emap(struct inode *ip, uint bn)
+{
+  struct extent *e;
+  struct buf *bp;
+  uint i, n, next;
+
+  e = (struct extent*)ip->addrs;
+  n = NEXTENT;
+  next = ip->addrs[EXTBLOCK];
+  bp = 0;
+  for(;;){
+    for(i = 0; i < n && e[i].len != 0; i++){
+      if(bn < e[i].len){
+        bn = e[i].start + bn;
+        if(bp)
+          brelse(bp);
+        return bn;
+      }
+      bn -= e[i].len;
     }
+    if(bp)
+      brelse(bp);
+    if(i < n || next == 0)
+      return 0;
+    bp = bread(ip->dev, next);
+    e = ((struct extblock*)bp->data)->e;
+    n = NEXTENTB;
+    next = ((struct extblock*)bp->data)->next;
   }
+}
 
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+// Add the run of len blocks at start to the end of ip's extents.
+static void
+eappend(struct inode *ip, uint start, uint len)
+{
+  struct extent *e;
+  struct extblock *eb;
+  struct buf *bp;
+  uint i, n, *next, addr;
+
+  // Find the container holding the last extent.
+  e = (struct extent*)ip->addrs;
+  n = NEXTENT;
+  next = &ip->addrs[EXTBLOCK];
+  bp = 0;
+  for(;;){
+    for(i = 0; i < n && e[i].len != 0; i++)
+      ;
+    if(i < n || *next == 0)
+      break;
+    if(bp)
+      brelse(bp);
+    bp = bread(ip->dev, *next);
+    eb = (struct extblock*)bp->data;
+    e = eb->e;
+    n = NEXTENTB;
+    next = &eb->next;
+  }
+
+  if(i > 0 && e[i-1].start + e[i-1].len == start){
+    e[i-1].len += len;    // contiguous with the last extent
+  } else if(i < n){
+    e[i].start = start;
+    e[i].len = len;
+  } else {
+    // Container full: chain a new extent block.
+    addr = balloc(ip->dev, start + len);
+    *next = addr;
+    if(bp){
+      log_write(bp);
+      brelse(bp);
     }
+    bp = bread(ip->dev, addr);
+    eb = (struct extblock*)bp->data;
+    eb->e[0].start = start;
+    eb->e[0].len = len;
+  }
+  if(bp){
+    log_write(bp);
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
+}
+
+// Make extent-mapped inode ip at least nblocks long, allocating
+// contiguous runs where the disk allows.  New blocks before
+// block nozero are not zeroed: the caller overwrites them.
+// Returns how many blocks ip had before.  Caller updates the
+// on-disk inode.
+static uint
+eextend(struct inode *ip, uint nblocks, uint nozero)
+{
+  struct extent *e;
+  struct buf *bp;
+  uint i, n, next, have, old, goal, start, got;
+
+  // Count the blocks ip has, and find where the last one is.
+  have = goal = 0;
+  e = (struct extent*)ip->addrs;
+  n = NEXTENT;
+  next = ip->addrs[EXTBLOCK];
+  bp = 0;
+  for(;;){
+    for(i = 0; i < n && e[i].len != 0; i++){
+      have += e[i].len;
+      goal = e[i].start + e[i].len;
+    }
+    if(bp)
+      brelse(bp);
+    if(i < n || next == 0)
+      break;
+    bp = bread(ip->dev, next);
+    e = ((struct extblock*)bp->data)->e;
+    n = NEXTENTB;
+    next = ((struct extblock*)bp->data)->next;
+  }
+
+  // Allocate the unzeroed and zeroed parts as separate runs.
+  old = have;
+  while(have < nblocks){
+    if(have < nozero)
+      start = ballocrun(ip->dev, goal, min(nblocks, nozero) - have, &got, 0);
+    else
+      start = ballocrun(ip->dev, goal, nblocks - have, &got, 1);
+    eappend(ip, start, got);
+    have += got;
+    goal = start + got;
+  }
+  return old;
+}
 
+// Free the blocks of extent-mapped inode t->ip.  Extents
+// shrink from the front as their blocks are freed.
+static void
+etrunc(struct trunc *t)
+{
+  struct inode *ip;
+  struct extent *e;
+  struct extblock *eb;
+  struct buf *bp;
+  uint i, addr;
+
+  ip = t->ip;
+  e = (struct extent*)ip->addrs;
+  for(i = 0; i < NEXTENT && e[i].len != 0; i++){
+    while(e[i].len > 0){
+      if(!tfree(t, e[i].start)){
+        tnext(t);
+        continue;
+      }
+      e[i].start++;
+      e[i].len--;
+    }
+  }
+
+  while((addr = ip->addrs[EXTBLOCK]) != 0){
+    if(t->budget < 2)
+      tnext(t);
+    t->budget--;  // to log bp
+    bp = bread(ip->dev, addr);
+    eb = (struct extblock*)bp->data;
+    for(i = 0; i < NEXTENTB && eb->e[i].len != 0; i++){
+      while(eb->e[i].len > 0){
+        if(!tfree(t, eb->e[i].start)){
+          log_write(bp);
+          brelse(bp);
+          tnext(t);
+          t->budget--;
+          bp = bread(ip->dev, addr);
+          eb = (struct extblock*)bp->data;
+          continue;
+        }
+        eb->e[i].start++;
+        eb->e[i].len--;
+      }
+    }
+    ip->addrs[EXTBLOCK] = eb->next;
+    brelse(bp);
+    if(!tfree(t, addr)){
+      tnext(t);
+      tfree(t, addr);
+    }
+  }
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+}
+
+// Truncate inode (discard contents).
+// Called when the inode has no links to it
+// and no in-memory reference to it, and by
+// open() with O_TRUNC.  Caller holds ip->lock.
+// Runs in the caller's transaction and may go on in others.
+void
+itrunc(struct inode *ip)
+{
+  struct trunc t;
+  int i, done;
+
+  // Empty first, so that after a crash between transactions
+  // the blocks not yet freed lie past the end.
+  ip->size = 0;
+  t.ip = ip;
+  t.budget = TRUNCBLOCKS;
+  t.lastbb = 0;
+  if(sb.flags & FS_EXTENTS)
+    etrunc(&t);
+  else {
+    // Each pass frees what fits in one transaction; the
+    // blocks it frees are cleared, so the next skips them.
+    for(;;){
+      done = 1;
+      for(i = 0; i < NDIRECT && done; i++){
+        if(ip->addrs[i] == 0)
+          continue;
+        if((done = tfree(&t, ip->addrs[i])) != 0)
+          ip->addrs[i] = 0;
+      }
+      for(i = 0; i < 3 && done; i++)
+        if(ip->addrs[NDIRECT+i])
+          done = ifreeind(&t, &ip->addrs[NDIRECT+i], i);
+      if(done)
+        break;
+      tnext(&t);
+    }
+  }
   ip->size = 0;
   iupdate(ip);
 }
@@ -467,9 +1014,12 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    bp = bread(ip->dev, bmap(ip, off/BSIZE, 0));
     m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(dst, bp->data + off%BSIZE, m);
+    if(ucopy(dst, bp->data + off%BSIZE, m) < 0){
+      brelse(bp);
+      return -1;
+    }
     brelse(bp);
   }
   return n;
@@ -481,7 +1031,9 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, bn, addr, old, nozero;
+  uint addrs[NDIRECT+3];
+  int fresh;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -492,22 +1044,64 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if(n > 0 && (off + n - 1)/BSIZE >= MAXFILE)
     return -1;
 
+  // Allocate the new blocks together, so that they can be
+  // contiguous and take few bitmap updates.  Those this write
+  // covers completely need not be zeroed.
+  memmove(addrs, ip->addrs, sizeof(addrs));
+  old = MAXFILE;
+  nozero = 0;
+  if((sb.flags & FS_EXTENTS) && n > 0){
+    nozero = (off + n)/BSIZE;
+    old = eextend(ip, (off + n - 1)/BSIZE + 1, nozero);
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    bn = off/BSIZE;
     m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(bp->data + off%BSIZE, src, m);
+    // A new block about to be overwritten whole
+    // need not be read from the disk either.
+    fresh = 0;
+    if(sb.flags & FS_EXTENTS){
+      addr = emap(ip, bn);
+      fresh = m == BSIZE && bn >= old;
+    } else
+      addr = bmap(ip, bn, m == BSIZE ? &fresh : 0);
+    bp = fresh ? bnew(ip->dev, addr) : bread(ip->dev, addr);
+    if(ucopy(bp->data + off%BSIZE, src, m) < 0){
+      // A missing user page: stop short.  Leave no
+      // stale data in a block that was not read.
+      if(fresh){
+        memset(bp->data, 0, BSIZE);
+        log_write(bp);
+      }
+      brelse(bp);
+      // Nor in the new ones eextend() left for the copy
+      // to fill.  They stay allocated, past the end.
+      for(bn++; bn < nozero; bn++){
+        if(bn < old)
+          continue;
+        bp = bnew(ip->dev, emap(ip, bn));
+        memset(bp->data, 0, BSIZE);
+        log_write(bp);
+        brelse(bp);
+      }
+      break;
+    }
     log_write(bp);
     brelse(bp);
   }
 
-  if(n > 0 && off > ip->size){
+  // Write the inode back if the size or the block map changed,
+  // even if nothing was copied, so no new block is lost.
+  if(off > ip->size){
     ip->size = off;
     iupdate(ip);
-  }
-  return n;
+  } else if(memcmp(addrs, ip->addrs, sizeof(addrs)) != 0)
+    iupdate(ip);
+  return tot;
 }
 
 //PAGEBREAK!
@@ -519,18 +1113,322 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Hashed directories; see fs.h.
+
+// Hash of a name, to index hashed directories.
+// mkfs.c has a copy.
+static uint
+dxhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+// Index entries fit in block blk after its dxhead.
+#define DXCAP(blk) (DPB - ((blk) == 0 ? DXROOT+1 : 1))
+
+// The dxhead of directory block blk, held in bp.
+static struct dxhead*
+dxhead(struct buf *bp, uint blk)
+{
+  return (struct dxhead*)bp->data + (blk == 0 ? DXROOT : 0);
+}
+
+// Insert an index entry after dxhead h, keeping them sorted.
+static void
+dxinsert(struct dxhead *h, uint hash, uint block)
+{
+  struct dxentry *e;
+  uint i;
+
+  e = (struct dxentry*)(h+1);
+  for(i = h->count; i > 0 && e[i-1].hash > hash; i--)
+    e[i] = e[i-1];
+  memset(&e[i], 0, sizeof(e[i]));
+  e[i].hash = hash;
+  e[i].block = block;
+  h->count++;
+}
+
+// Is dp a hashed directory?  Caller holds dp->lock.
+static int
+dxis(struct inode *dp)
+{
+  struct buf *bp;
+  struct dxhead *h;
+  int r;
+
+  if(dp->size <= BSIZE)
+    return 0;
+  bp = bread(dp->dev, bmap(dp, 0, 0));
+  h = dxhead(bp, 0);
+  r = h->inum == 0 && h->magic == DX_MAGIC;
+  brelse(bp);
+  return r;
+}
+
+// Find the leaf of hashed directory dp that holds names with
+// this hash.  Sets *levels and path[] to the index blocks on
+// the way down, root first.
+static uint
+dxfind(struct inode *dp, uint hash, uint *path, uint *levels)
+{
+  struct buf *bp;
+  struct dxhead *h;
+  struct dxentry *e;
+  uint blk, i, n;
+
+  blk = 0;
+  *levels = 1;
+  for(n = 0; n < *levels; n++){
+    bp = bread(dp->dev, bmap(dp, blk, 0));
+    h = dxhead(bp, blk);
+    if(blk == 0)
+      *levels = h->levels;
+    if(h->magic != DX_MAGIC || *levels < 1 || *levels > 2 ||
+       h->count == 0 || h->count > DXCAP(blk))
+      panic("dxfind: bad index");
+    e = (struct dxentry*)(h+1);
+    for(i = 1; i < h->count && e[i].hash <= hash; i++)
+      ;
+    path[n] = blk;
+    blk = e[i-1].block;
+    brelse(bp);
+  }
+  return blk;
+}
+
+// Add a zeroed block to the end of directory dp.
+// Returns its block number within dp.
+static uint
+dxgrow(struct inode *dp)
+{
+  uint blk;
+
+  blk = dp->size / BSIZE;
+  bmap(dp, blk, 0);
+  dp->size += BSIZE;
+  iupdate(dp);
+  return blk;
+}
+
+// Turn full one-block directory dp into a hashed directory,
+// moving every name but . and .. to a single leaf.
+static void
+dxconvert(struct inode *dp)
+{
+  struct buf *bp, *nbp;
+  struct dirent *de, *nde;
+  struct dxhead *h;
+  uint nb, i;
+
+  nb = dxgrow(dp);
+  bp = bread(dp->dev, bmap(dp, 0, 0));
+  nbp = bread(dp->dev, bmap(dp, nb, 0));
+  de = (struct dirent*)bp->data;
+  nde = (struct dirent*)nbp->data;
+  for(i = 2; i < DPB; i++){
+    nde[i-2] = de[i];
+    if(de[i].inum)
+      dcenter(dp->dev, dp->inum, de[i].name, de[i].inum,
+              nb*BSIZE + (i-2)*sizeof(*de));
+  }
+  memset(&de[2], 0, (DPB-2)*sizeof(*de));
+  h = dxhead(bp, 0);
+  h->magic = DX_MAGIC;
+  h->levels = 1;
+  dxinsert(h, 0, nb);
+  log_write(nbp);
+  brelse(nbp);
+  log_write(bp);
+  brelse(bp);
+}
+
+// Make room in the full index block at the bottom of path[]
+// in hashed directory dp: add a level if it is the root, or
+// else split it in two.  Returns -1 if the root is full too.
+static int
+dxsplitindex(struct inode *dp, uint *path, uint levels)
+{
+  struct buf *rbp, *bp, *nbp;
+  struct dxhead *rh, *h, *nh;
+  uint nb, half;
+
+  rbp = bread(dp->dev, bmap(dp, 0, 0));
+  rh = dxhead(rbp, 0);
+  if(levels == 2 && rh->count == DXCAP(0)){
+    brelse(rbp);
+    return -1;
+  }
+  nb = dxgrow(dp);
+  nbp = bread(dp->dev, bmap(dp, nb, 0));
+  nh = dxhead(nbp, nb);
+  nh->magic = DX_MAGIC;
+  if(levels == 1){
+    // Move the root's entries down a level.
+    nh->count = rh->count;
+    memmove(nh+1, rh+1, rh->count*sizeof(struct dxentry));
+    memset(rh+1, 0, rh->count*sizeof(struct dxentry));
+    rh->count = 0;
+    rh->levels = 2;
+    dxinsert(rh, 0, nb);
+  } else {
+    // Move the upper half of the index block to nb.
+    bp = bread(dp->dev, bmap(dp, path[1], 0));
+    h = dxhead(bp, path[1]);
+    half = h->count / 2;
+    nh->count = h->count - half;
+    memmove(nh+1, (struct dxentry*)(h+1) + half, nh->count*sizeof(struct dxentry));
+    memset((struct dxentry*)(h+1) + half, 0, nh->count*sizeof(struct dxentry));
+    h->count = half;
+    dxinsert(rh, ((struct dxentry*)(nh+1))->hash, nb);
+    log_write(bp);
+    brelse(bp);
+  }
+  log_write(nbp);
+  brelse(nbp);
+  log_write(rbp);
+  brelse(rbp);
+  return 0;
+}
+
+// Make room in full leaf of hashed directory dp by moving the
+// names with the upper half of its hashes to a new leaf.
+// Returns -1 if that cannot be done, or there is no page
+// free to sort the hashes in.
+static int
+dxsplit(struct inode *dp, uint leaf, uint *path, uint levels)
+{
+  struct buf *ibp, *bp, *nbp;
+  struct dxhead *h;
+  struct dirent *de, *nde;
+  uint ib, nb, *hs, hash, split, i, j, k;
+
+  ib = path[levels-1];
+  ibp = bread(dp->dev, bmap(dp, ib, 0));
+  h = dxhead(ibp, ib);
+  if(h->count == DXCAP(ib)){
+    brelse(ibp);
+    return dxsplitindex(dp, path, levels);
+  }
+
+  // Sort the leaf's hashes and split near the median, between
+  // two different hashes so that each hash stays in one leaf.
+  bp = bread(dp->dev, bmap(dp, leaf, 0));
+  de = (struct dirent*)bp->data;
+  if((hs = (uint*)kalloc()) == 0){
+    brelse(bp);
+    brelse(ibp);
+    return -1;
+  }
+  for(i = 0; i < DPB; i++){
+    hash = dxhash(de[i].name);
+    for(j = i; j > 0 && hs[j-1] > hash; j--)
+      hs[j] = hs[j-1];
+    hs[j] = hash;
+  }
+  for(j = DPB/2; j > 0 && hs[j] == hs[j-1]; j--)
+    ;
+  if(j == 0)
+    for(j = DPB/2 + 1; j < DPB && hs[j] == hs[j-1]; j++)
+      ;
+  split = hs[j < DPB ? j : 0];
+  kfree((char*)hs);
+  if(j == DPB){
+    brelse(bp);
+    brelse(ibp);
+    return -1;
+  }
+
+  nb = dxgrow(dp);
+  nbp = bread(dp->dev, bmap(dp, nb, 0));
+  nde = (struct dirent*)nbp->data;
+  k = 0;
+  for(i = 0; i < DPB; i++){
+    if(dxhash(de[i].name) < split)
+      continue;
+    nde[k] = de[i];
+    memset(&de[i], 0, sizeof(de[i]));
+    dcenter(dp->dev, dp->inum, nde[k].name, nde[k].inum, nb*BSIZE + k*sizeof(*de));
+    k++;
+  }
+  dxinsert(h, split, nb);
+  log_write(nbp);
+  brelse(nbp);
+  log_write(bp);
+  brelse(bp);
+  log_write(ibp);
+  brelse(ibp);
+  return 0;
+}
+
+// Add (name, inum) to hashed directory dp.
+static int
+dxlink(struct inode *dp, char *name, uint inum)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint hash, leaf, levels, path[2], i;
+
+  hash = dxhash(name);
+  for(;;){
+    leaf = dxfind(dp, hash, path, &levels);
+    bp = bread(dp->dev, bmap(dp, leaf, 0));
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DPB; i++){
+      if(de[i].inum == 0){
+        strncpy(de[i].name, name, DIRSIZ);
+        de[i].inum = inum;
+        log_write(bp);
+        brelse(bp);
+        dcenter(dp->dev, dp->inum, name, inum, leaf*BSIZE + i*sizeof(*de));
+        return 0;
+      }
+    }
+    brelse(bp);
+    if(dxsplit(dp, leaf, path, levels) < 0)
+      return -1;
+  }
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// The name cache answers repeated lookups, and in
+// a hashed directory only one leaf need be read.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
+  uint off, start, end, inum, levels, path[2];
   struct dirent de;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
+  if(dclookup(dp->dev, dp->inum, name, &inum, &off)){
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+
+  start = 0;
+  end = dp->size;
+  if(dxis(dp)){
+    if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+      end = 2*sizeof(de);  // ahead of the index in block 0
+    else {
+      start = dxfind(dp, dxhash(name), path, &levels) * BSIZE;
+      end = start + BSIZE;
+    }
+  }
+
+  for(off = start; off < end; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
     if(de.inum == 0)
@@ -540,14 +1438,17 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       if(poff)
         *poff = off;
       inum = de.inum;
+      dcenter(dp->dev, dp->inum, name, inum, off);
       return iget(dp->dev, inum);
     }
   }
 
+  dcenter(dp->dev, dp->inum, name, 0, 0);
   return 0;
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// Returns -1 if name is present or a hashed directory is full.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
@@ -561,6 +1462,9 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
+  if(dxis(dp))
+    return dxlink(dp, name, inum);
+
   // Look for an empty dirent.
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -569,10 +1473,17 @@ dirlink(struct inode *dp, char *name, uint inum)
       break;
   }
 
+  // Rather than grow past one block, start hashing.
+  if(off == BSIZE && dp->size == BSIZE && (sb.flags & FS_HTREE)){
+    dxconvert(dp);
+    return dxlink(dp, name, inum);
+  }
+
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcenter(dp->dev, dp->inum, name, inum, off);
 
   return 0;
 }
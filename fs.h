@@ -3,7 +3,9 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+#ifndef BSIZE
+#define BSIZE 512  // block size; make BSIZE=4096 overrides
+#endif
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
@@ -19,11 +21,18 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint bsize;        // Block size (bytes); must match BSIZE
+  uint flags;        // FS_* features
 };
 
-#define NDIRECT 12
+#define FS_EXTENTS 0x1   // files are mapped by extents (mkfs -e)
+#define FS_HTREE   0x2   // large directories are hashed (mkfs -d)
+
+#define NDIRECT 10
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define NTINDIRECT (NDINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT + NTINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +41,26 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+3];   // Data block addresses, then single,
+                           // double and triple indirect blocks
+};
+
+// On a file system with FS_EXTENTS, addrs[] instead holds NEXTENT
+// extents, runs of disk blocks that map the file's blocks in order,
+// then the address of an extent block holding more.  Unused extents
+// have len 0.
+struct extent {
+  uint start;           // First disk block of the run
+  uint len;             // Number of blocks
+};
+#define NEXTENT ((NDIRECT+2) / 2)
+#define EXTBLOCK (NDIRECT+2)       // addrs[] index of first extent block
+#define NEXTENTB (BSIZE / sizeof(struct extent) - 1)
+
+struct extblock {
+  struct extent e[NEXTENTB];
+  uint next;            // Next extent block, or 0
+  uint unused;
 };
 
 // Inodes per block.
@@ -55,3 +83,34 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Dirents per block.
+#define DPB           (BSIZE / sizeof(struct dirent))
+
+// On a file system with FS_HTREE, a directory that outgrows one
+// block is indexed by name hash, like ext3's htree.  Block 0 keeps
+// "." and "..", then a dxhead and index entries sorted by hash,
+// each naming the directory block that holds the names with hashes
+// from its own up to the next entry's.  With two levels, those
+// blocks are index blocks, starting with their own dxhead, and the
+// entries in them name leaves.  Leaves are blocks of ordinary
+// dirents.  Index slots have inum 0, so a linear reader such as
+// ls sees them as free dirents and finds only the real names.
+struct dxhead {
+  ushort inum;          // 0
+  ushort magic;         // DX_MAGIC
+  uint levels;          // in block 0: 1 or 2 levels of index
+  uint count;           // index entries that follow
+  uint unused;
+};
+
+struct dxentry {
+  ushort inum;          // 0
+  ushort unused;
+  uint hash;            // lowest hash in block; 0 in the first entry
+  uint block;           // directory block number
+  uint unused1;
+};
+
+#define DX_MAGIC 0x4854
+#define DXROOT   2      // slot of the dxhead in block 0
+
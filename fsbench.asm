@@ -0,0 +1,4180 @@
+
+_fsbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  unlink("fsbench.dd");
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ba 00 01 00 00       	mov    $0x100,%edx
+    100c:	ff 71 fc             	push   -0x4(%ecx)
+    100f:	55                   	push   %ebp
+    1010:	89 e5                	mov    %esp,%ebp
+    1012:	57                   	push   %edi
+    path(argc > 2 ? atoi(argv[2]) : 10, argc > 3 ? atoi(argv[3]) : 1000);
+    exit();
+  }
+
+  kb = 256;
+  n = 100;
+    1013:	bf 64 00 00 00       	mov    $0x64,%edi
+{
+    1018:	56                   	push   %esi
+    1019:	53                   	push   %ebx
+    101a:	51                   	push   %ecx
+    101b:	83 ec 18             	sub    $0x18,%esp
+    101e:	8b 19                	mov    (%ecx),%ebx
+    1020:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc > 1 && strcmp(argv[1], "fill") == 0){
+    1023:	83 fb 01             	cmp    $0x1,%ebx
+    1026:	7f 2d                	jg     1055 <main+0x55>
+    1028:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if(argc > 1)
+    kb = atoi(argv[1]);
+  if(argc > 2)
+    n = atoi(argv[2]);
+  memset(buf, 'f', sizeof(buf));
+    102b:	50                   	push   %eax
+    102c:	68 00 10 00 00       	push   $0x1000
+    1031:	6a 66                	push   $0x66
+    1033:	68 c0 3d 00 00       	push   $0x3dc0
+    1038:	e8 f3 0e 00 00       	call   1f30 <memset>
+
+  sequential(kb);
+    103d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1040:	89 14 24             	mov    %edx,(%esp)
+    1043:	e8 b8 01 00 00       	call   1200 <sequential>
+  metadata(n);
+    1048:	89 3c 24             	mov    %edi,(%esp)
+    104b:	e8 b0 03 00 00       	call   1400 <metadata>
+  exit();
+    1050:	e8 fb 10 00 00       	call   2150 <exit>
+  if(argc > 1 && strcmp(argv[1], "fill") == 0){
+    1055:	50                   	push   %eax
+    1056:	50                   	push   %eax
+    1057:	68 59 31 00 00       	push   $0x3159
+    105c:	ff 76 04             	push   0x4(%esi)
+    105f:	e8 3c 0e 00 00       	call   1ea0 <strcmp>
+    1064:	83 c4 10             	add    $0x10,%esp
+    1067:	85 c0                	test   %eax,%eax
+    1069:	75 31                	jne    109c <main+0x9c>
+    memset(buf, 'f', sizeof(buf));
+    106b:	50                   	push   %eax
+    106c:	68 00 10 00 00       	push   $0x1000
+    1071:	6a 66                	push   $0x66
+    1073:	68 c0 3d 00 00       	push   $0x3dc0
+    1078:	e8 b3 0e 00 00       	call   1f30 <memset>
+    fill(argc > 2 ? atoi(argv[2]) : 32);
+    107d:	83 c4 10             	add    $0x10,%esp
+    1080:	b8 20 00 00 00       	mov    $0x20,%eax
+    1085:	83 fb 02             	cmp    $0x2,%ebx
+    1088:	0f 85 82 00 00 00    	jne    1110 <main+0x110>
+    108e:	83 ec 0c             	sub    $0xc,%esp
+    1091:	50                   	push   %eax
+    1092:	e8 59 06 00 00       	call   16f0 <fill>
+    exit();
+    1097:	e8 b4 10 00 00       	call   2150 <exit>
+  if(argc > 1 && strcmp(argv[1], "dir") == 0){
+    109c:	50                   	push   %eax
+    109d:	50                   	push   %eax
+    109e:	68 1f 32 00 00       	push   $0x321f
+    10a3:	ff 76 04             	push   0x4(%esi)
+    10a6:	e8 f5 0d 00 00       	call   1ea0 <strcmp>
+    10ab:	83 c4 10             	add    $0x10,%esp
+    10ae:	85 c0                	test   %eax,%eax
+    10b0:	75 26                	jne    10d8 <main+0xd8>
+    bigdir(argc > 2 ? atoi(argv[2]) : 10000);
+    10b2:	b8 10 27 00 00       	mov    $0x2710,%eax
+    10b7:	83 fb 02             	cmp    $0x2,%ebx
+    10ba:	74 0e                	je     10ca <main+0xca>
+    10bc:	83 ec 0c             	sub    $0xc,%esp
+    10bf:	ff 76 08             	push   0x8(%esi)
+    10c2:	e8 79 0f 00 00       	call   2040 <atoi>
+    10c7:	83 c4 10             	add    $0x10,%esp
+    10ca:	83 ec 0c             	sub    $0xc,%esp
+    10cd:	50                   	push   %eax
+    10ce:	e8 5d 0b 00 00       	call   1c30 <bigdir>
+    exit();
+    10d3:	e8 78 10 00 00       	call   2150 <exit>
+  if(argc > 1 && strcmp(argv[1], "path") == 0){
+    10d8:	51                   	push   %ecx
+    10d9:	51                   	push   %ecx
+    10da:	68 23 32 00 00       	push   $0x3223
+    10df:	ff 76 04             	push   0x4(%esi)
+    10e2:	e8 b9 0d 00 00       	call   1ea0 <strcmp>
+    10e7:	83 c4 10             	add    $0x10,%esp
+    10ea:	85 c0                	test   %eax,%eax
+    10ec:	75 55                	jne    1143 <main+0x143>
+    path(argc > 2 ? atoi(argv[2]) : 10, argc > 3 ? atoi(argv[3]) : 1000);
+    10ee:	83 fb 03             	cmp    $0x3,%ebx
+    10f1:	7f 30                	jg     1123 <main+0x123>
+    10f3:	83 fb 02             	cmp    $0x2,%ebx
+    10f6:	b8 0a 00 00 00       	mov    $0xa,%eax
+    10fb:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+    1100:	75 31                	jne    1133 <main+0x133>
+    1102:	52                   	push   %edx
+    1103:	52                   	push   %edx
+    1104:	53                   	push   %ebx
+    1105:	50                   	push   %eax
+    1106:	e8 05 08 00 00       	call   1910 <path>
+    exit();
+    110b:	e8 40 10 00 00       	call   2150 <exit>
+    fill(argc > 2 ? atoi(argv[2]) : 32);
+    1110:	83 ec 0c             	sub    $0xc,%esp
+    1113:	ff 76 08             	push   0x8(%esi)
+    1116:	e8 25 0f 00 00       	call   2040 <atoi>
+    111b:	83 c4 10             	add    $0x10,%esp
+    111e:	e9 6b ff ff ff       	jmp    108e <main+0x8e>
+    path(argc > 2 ? atoi(argv[2]) : 10, argc > 3 ? atoi(argv[3]) : 1000);
+    1123:	83 ec 0c             	sub    $0xc,%esp
+    1126:	ff 76 0c             	push   0xc(%esi)
+    1129:	e8 12 0f 00 00       	call   2040 <atoi>
+    112e:	83 c4 10             	add    $0x10,%esp
+    1131:	89 c3                	mov    %eax,%ebx
+    1133:	83 ec 0c             	sub    $0xc,%esp
+    1136:	ff 76 08             	push   0x8(%esi)
+    1139:	e8 02 0f 00 00       	call   2040 <atoi>
+    113e:	83 c4 10             	add    $0x10,%esp
+    1141:	eb bf                	jmp    1102 <main+0x102>
+    kb = atoi(argv[1]);
+    1143:	83 ec 0c             	sub    $0xc,%esp
+    1146:	ff 76 04             	push   0x4(%esi)
+    1149:	e8 f2 0e 00 00       	call   2040 <atoi>
+  if(argc > 2)
+    114e:	83 c4 10             	add    $0x10,%esp
+    kb = atoi(argv[1]);
+    1151:	89 c2                	mov    %eax,%edx
+  if(argc > 2)
+    1153:	83 fb 02             	cmp    $0x2,%ebx
+    1156:	0f 84 cc fe ff ff    	je     1028 <main+0x28>
+    n = atoi(argv[2]);
+    115c:	83 ec 0c             	sub    $0xc,%esp
+    115f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1162:	ff 76 08             	push   0x8(%esi)
+    1165:	e8 d6 0e 00 00       	call   2040 <atoi>
+    116a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    116d:	83 c4 10             	add    $0x10,%esp
+    1170:	89 c7                	mov    %eax,%edi
+    1172:	e9 b1 fe ff ff       	jmp    1028 <main+0x28>
+    1177:	66 90                	xchg   %ax,%ax
+    1179:	66 90                	xchg   %ax,%ax
+    117b:	66 90                	xchg   %ax,%ax
+    117d:	66 90                	xchg   %ax,%ax
+    117f:	90                   	nop
+
+00001180 <report>:
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	57                   	push   %edi
+    1184:	56                   	push   %esi
+    1185:	53                   	push   %ebx
+    1186:	83 ec 1c             	sub    $0x1c,%esp
+    1189:	8b 55 08             	mov    0x8(%ebp),%edx
+    118c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+    118f:	8b 75 0c             	mov    0xc(%ebp),%esi
+    1192:	8b 7d 10             	mov    0x10(%ebp),%edi
+    1195:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    1198:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  t = uptime() - start;
+    119b:	e8 20 11 00 00       	call   22c0 <uptime>
+    11a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  printf(1, "%s: %d %s in %d ticks", what, n, unit, t);
+    11a3:	83 ec 08             	sub    $0x8,%esp
+  t = uptime() - start;
+    11a6:	29 c8                	sub    %ecx,%eax
+  printf(1, "%s: %d %s in %d ticks", what, n, unit, t);
+    11a8:	50                   	push   %eax
+  t = uptime() - start;
+    11a9:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s: %d %s in %d ticks", what, n, unit, t);
+    11ab:	57                   	push   %edi
+    11ac:	56                   	push   %esi
+    11ad:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    11b0:	52                   	push   %edx
+    11b1:	68 78 30 00 00       	push   $0x3078
+    11b6:	6a 01                	push   $0x1
+    11b8:	e8 03 15 00 00       	call   26c0 <printf>
+  if(t > 0)
+    11bd:	83 c4 20             	add    $0x20,%esp
+    11c0:	85 db                	test   %ebx,%ebx
+    11c2:	7e 17                	jle    11db <report+0x5b>
+    printf(1, ", %d %s/s", n*100/t, unit);
+    11c4:	6b c6 64             	imul   $0x64,%esi,%eax
+    11c7:	57                   	push   %edi
+    11c8:	99                   	cltd
+    11c9:	f7 fb                	idiv   %ebx
+    11cb:	50                   	push   %eax
+    11cc:	68 8e 30 00 00       	push   $0x308e
+    11d1:	6a 01                	push   $0x1
+    11d3:	e8 e8 14 00 00       	call   26c0 <printf>
+    11d8:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n");
+    11db:	c7 45 0c e3 30 00 00 	movl   $0x30e3,0xc(%ebp)
+    11e2:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+    11e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11ec:	5b                   	pop    %ebx
+    11ed:	5e                   	pop    %esi
+    11ee:	5f                   	pop    %edi
+    11ef:	5d                   	pop    %ebp
+  printf(1, "\n");
+    11f0:	e9 cb 14 00 00       	jmp    26c0 <printf>
+    11f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001200 <sequential>:
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	57                   	push   %edi
+    1204:	56                   	push   %esi
+  kstat(&before);
+    1205:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+{
+    120b:	53                   	push   %ebx
+    120c:	81 ec 38 01 00 00    	sub    $0x138,%esp
+    1212:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  kstat(&before);
+    1215:	50                   	push   %eax
+    1216:	e8 d2 10 00 00       	call   22ed <kstat>
+  start = uptime();
+    121b:	e8 a0 10 00 00       	call   22c0 <uptime>
+    1220:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  if((fd = open("fsbench.big", O_CREATE|O_RDWR)) < 0){
+    1226:	5e                   	pop    %esi
+    1227:	5f                   	pop    %edi
+    1228:	68 02 02 00 00       	push   $0x202
+    122d:	68 98 30 00 00       	push   $0x3098
+    1232:	e8 e4 0f 00 00       	call   221b <open>
+    1237:	83 c4 10             	add    $0x10,%esp
+    123a:	85 c0                	test   %eax,%eax
+    123c:	0f 88 ab 01 00 00    	js     13ed <sequential+0x1ed>
+    1242:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < kb; i += sizeof(buf)/1024)
+    1244:	31 ff                	xor    %edi,%edi
+    1246:	85 db                	test   %ebx,%ebx
+    1248:	0f 8e 26 01 00 00    	jle    1374 <sequential+0x174>
+    124e:	66 90                	xchg   %ax,%ax
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1250:	83 ec 04             	sub    $0x4,%esp
+    1253:	68 00 10 00 00       	push   $0x1000
+    1258:	68 c0 3d 00 00       	push   $0x3dc0
+    125d:	56                   	push   %esi
+    125e:	e8 7c 0f 00 00       	call   21df <write>
+    1263:	83 c4 10             	add    $0x10,%esp
+    1266:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    126b:	0f 85 68 01 00 00    	jne    13d9 <sequential+0x1d9>
+  for(i = 0; i < kb; i += sizeof(buf)/1024)
+    1271:	83 c7 04             	add    $0x4,%edi
+    1274:	39 fb                	cmp    %edi,%ebx
+    1276:	7f d8                	jg     1250 <sequential+0x50>
+  close(fd);
+    1278:	83 ec 0c             	sub    $0xc,%esp
+    127b:	56                   	push   %esi
+    127c:	e8 6d 0f 00 00       	call   21ee <close>
+  report("seqwrite", kb, "KB", start);
+    1281:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+    1287:	68 bb 30 00 00       	push   $0x30bb
+    128c:	53                   	push   %ebx
+    128d:	68 be 30 00 00       	push   $0x30be
+    1292:	e8 e9 fe ff ff       	call   1180 <report>
+  if(kstat(&after) == 0 && kb > 0)
+    1297:	83 c4 14             	add    $0x14,%esp
+    129a:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    12a0:	50                   	push   %eax
+    12a1:	e8 47 10 00 00       	call   22ed <kstat>
+    12a6:	83 c4 10             	add    $0x10,%esp
+    12a9:	85 c0                	test   %eax,%eax
+    12ab:	0f 84 87 00 00 00    	je     1338 <sequential+0x138>
+  start = uptime();
+    12b1:	e8 0a 10 00 00       	call   22c0 <uptime>
+  fd = open("fsbench.big", O_RDONLY);
+    12b6:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < kb; i += sizeof(buf)/1024)
+    12b9:	31 ff                	xor    %edi,%edi
+  start = uptime();
+    12bb:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  fd = open("fsbench.big", O_RDONLY);
+    12c1:	6a 00                	push   $0x0
+    12c3:	68 98 30 00 00       	push   $0x3098
+    12c8:	e8 4e 0f 00 00       	call   221b <open>
+    12cd:	83 c4 10             	add    $0x10,%esp
+    12d0:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < kb; i += sizeof(buf)/1024)
+    12d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf)){
+    12d8:	83 ec 04             	sub    $0x4,%esp
+    12db:	68 00 10 00 00       	push   $0x1000
+    12e0:	68 c0 3d 00 00       	push   $0x3dc0
+    12e5:	56                   	push   %esi
+    12e6:	e8 e5 0e 00 00       	call   21d0 <read>
+    12eb:	83 c4 10             	add    $0x10,%esp
+    12ee:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    12f3:	0f 85 cc 00 00 00    	jne    13c5 <sequential+0x1c5>
+  for(i = 0; i < kb; i += sizeof(buf)/1024)
+    12f9:	83 c7 04             	add    $0x4,%edi
+    12fc:	39 fb                	cmp    %edi,%ebx
+    12fe:	7f d8                	jg     12d8 <sequential+0xd8>
+  close(fd);
+    1300:	83 ec 0c             	sub    $0xc,%esp
+    1303:	56                   	push   %esi
+    1304:	e8 e5 0e 00 00       	call   21ee <close>
+  report("seqread", kb, "KB", start);
+    1309:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+    130f:	68 bb 30 00 00       	push   $0x30bb
+    1314:	53                   	push   %ebx
+    1315:	68 c7 30 00 00       	push   $0x30c7
+    131a:	e8 61 fe ff ff       	call   1180 <report>
+  unlink("fsbench.big");
+    131f:	83 c4 14             	add    $0x14,%esp
+    1322:	68 98 30 00 00       	push   $0x3098
+    1327:	e8 0d 0f 00 00       	call   2239 <unlink>
+}
+    132c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    132f:	5b                   	pop    %ebx
+    1330:	5e                   	pop    %esi
+    1331:	5f                   	pop    %edi
+    1332:	5d                   	pop    %ebp
+    1333:	c3                   	ret
+    1334:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "seqwrite: %d log blocks/MB, %d blocks zeroed, %d not\n",
+    1338:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    133b:	83 ec 0c             	sub    $0xc,%esp
+    133e:	2b 85 2c ff ff ff    	sub    -0xd4(%ebp),%eax
+    1344:	31 d2                	xor    %edx,%edx
+    1346:	50                   	push   %eax
+    1347:	8b 45 ac             	mov    -0x54(%ebp),%eax
+    134a:	2b 85 28 ff ff ff    	sub    -0xd8(%ebp),%eax
+    1350:	50                   	push   %eax
+      (after.log_blocks - before.log_blocks) * 1024 / kb,
+    1351:	8b 45 98             	mov    -0x68(%ebp),%eax
+    1354:	2b 85 14 ff ff ff    	sub    -0xec(%ebp),%eax
+    135a:	c1 e0 0a             	shl    $0xa,%eax
+    printf(1, "seqwrite: %d log blocks/MB, %d blocks zeroed, %d not\n",
+    135d:	f7 f3                	div    %ebx
+    135f:	50                   	push   %eax
+    1360:	68 4c 32 00 00       	push   $0x324c
+    1365:	6a 01                	push   $0x1
+    1367:	e8 54 13 00 00       	call   26c0 <printf>
+    136c:	83 c4 20             	add    $0x20,%esp
+    136f:	e9 3d ff ff ff       	jmp    12b1 <sequential+0xb1>
+  close(fd);
+    1374:	83 ec 0c             	sub    $0xc,%esp
+    1377:	50                   	push   %eax
+    1378:	e8 71 0e 00 00       	call   21ee <close>
+  report("seqwrite", kb, "KB", start);
+    137d:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+    1383:	68 bb 30 00 00       	push   $0x30bb
+    1388:	53                   	push   %ebx
+    1389:	68 be 30 00 00       	push   $0x30be
+    138e:	e8 ed fd ff ff       	call   1180 <report>
+  if(kstat(&after) == 0 && kb > 0)
+    1393:	83 c4 14             	add    $0x14,%esp
+    1396:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    139c:	50                   	push   %eax
+    139d:	e8 4b 0f 00 00       	call   22ed <kstat>
+  start = uptime();
+    13a2:	e8 19 0f 00 00       	call   22c0 <uptime>
+    13a7:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  fd = open("fsbench.big", O_RDONLY);
+    13ad:	58                   	pop    %eax
+    13ae:	5a                   	pop    %edx
+    13af:	6a 00                	push   $0x0
+    13b1:	68 98 30 00 00       	push   $0x3098
+    13b6:	e8 60 0e 00 00       	call   221b <open>
+    13bb:	83 c4 10             	add    $0x10,%esp
+    13be:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < kb; i += sizeof(buf)/1024)
+    13c0:	e9 3b ff ff ff       	jmp    1300 <sequential+0x100>
+      printf(2, "fsbench: read failed\n");
+    13c5:	83 ec 08             	sub    $0x8,%esp
+    13c8:	68 cf 30 00 00       	push   $0x30cf
+    13cd:	6a 02                	push   $0x2
+    13cf:	e8 ec 12 00 00       	call   26c0 <printf>
+      exit();
+    13d4:	e8 77 0d 00 00       	call   2150 <exit>
+      printf(2, "fsbench: write failed\n");
+    13d9:	83 ec 08             	sub    $0x8,%esp
+    13dc:	68 a4 30 00 00       	push   $0x30a4
+    13e1:	6a 02                	push   $0x2
+    13e3:	e8 d8 12 00 00       	call   26c0 <printf>
+      exit();
+    13e8:	e8 63 0d 00 00       	call   2150 <exit>
+    printf(2, "fsbench: create fsbench.big failed\n");
+    13ed:	51                   	push   %ecx
+    13ee:	51                   	push   %ecx
+    13ef:	68 28 32 00 00       	push   $0x3228
+    13f4:	6a 02                	push   $0x2
+    13f6:	e8 c5 12 00 00       	call   26c0 <printf>
+    exit();
+    13fb:	e8 50 0d 00 00       	call   2150 <exit>
+
+00001400 <metadata>:
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	56                   	push   %esi
+    1405:	53                   	push   %ebx
+    1406:	83 ec 48             	sub    $0x48,%esp
+  if(mkdir("fsbench.d") < 0){
+    1409:	68 e5 30 00 00       	push   $0x30e5
+    140e:	e8 53 0e 00 00       	call   2266 <mkdir>
+    1413:	83 c4 10             	add    $0x10,%esp
+    1416:	85 c0                	test   %eax,%eax
+    1418:	0f 88 b6 02 00 00    	js     16d4 <metadata+0x2d4>
+  strcpy(name, "fsbench.d/f");
+    141e:	83 ec 08             	sub    $0x8,%esp
+    1421:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1424:	68 ef 30 00 00       	push   $0x30ef
+    1429:	50                   	push   %eax
+    142a:	e8 41 0a 00 00       	call   1e70 <strcpy>
+  start = uptime();
+    142f:	e8 8c 0e 00 00       	call   22c0 <uptime>
+  for(i = 0; i < n; i++){
+    1434:	8b 55 08             	mov    0x8(%ebp),%edx
+    1437:	83 c4 10             	add    $0x10,%esp
+    143a:	85 d2                	test   %edx,%edx
+    143c:	0f 8e 13 02 00 00    	jle    1655 <metadata+0x255>
+    1442:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1445:	31 db                	xor    %ebx,%ebx
+    name[11] = 'a' + i/26/26%26;
+    1447:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    144c:	eb 04                	jmp    1452 <metadata+0x52>
+    144e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < n; i++){
+    1450:	89 c3                	mov    %eax,%ebx
+    name[11] = 'a' + i/26/26%26;
+    1452:	b8 eb 5d f2 60       	mov    $0x60f25deb,%eax
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    1457:	83 ec 08             	sub    $0x8,%esp
+    name[14] = 0;
+    145a:	c6 45 d6 00          	movb   $0x0,-0x2a(%ebp)
+    name[11] = 'a' + i/26/26%26;
+    145e:	f7 e3                	mul    %ebx
+    1460:	89 d1                	mov    %edx,%ecx
+    1462:	c1 e9 08             	shr    $0x8,%ecx
+    1465:	89 c8                	mov    %ecx,%eax
+    1467:	f7 e6                	mul    %esi
+    name[12] = 'a' + i/26%26;
+    1469:	89 d8                	mov    %ebx,%eax
+    name[11] = 'a' + i/26/26%26;
+    146b:	c1 ea 03             	shr    $0x3,%edx
+    146e:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    1471:	29 d1                	sub    %edx,%ecx
+    name[12] = 'a' + i/26%26;
+    1473:	f7 e6                	mul    %esi
+    name[11] = 'a' + i/26/26%26;
+    1475:	83 c1 61             	add    $0x61,%ecx
+    1478:	88 4d d3             	mov    %cl,-0x2d(%ebp)
+    name[12] = 'a' + i/26%26;
+    147b:	89 d1                	mov    %edx,%ecx
+    147d:	c1 e9 03             	shr    $0x3,%ecx
+    1480:	89 c8                	mov    %ecx,%eax
+    1482:	f7 e6                	mul    %esi
+    1484:	89 c8                	mov    %ecx,%eax
+    name[13] = 'a' + i%26;
+    1486:	6b c9 1a             	imul   $0x1a,%ecx,%ecx
+    name[12] = 'a' + i/26%26;
+    1489:	c1 ea 03             	shr    $0x3,%edx
+    148c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    148f:	29 d0                	sub    %edx,%eax
+    1491:	83 c0 61             	add    $0x61,%eax
+    1494:	88 45 d4             	mov    %al,-0x2c(%ebp)
+    name[13] = 'a' + i%26;
+    1497:	89 d8                	mov    %ebx,%eax
+    1499:	29 c8                	sub    %ecx,%eax
+    149b:	83 c0 61             	add    $0x61,%eax
+    149e:	88 45 d5             	mov    %al,-0x2b(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    14a1:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    14a4:	68 02 02 00 00       	push   $0x202
+    14a9:	50                   	push   %eax
+    14aa:	e8 6c 0d 00 00       	call   221b <open>
+    14af:	83 c4 10             	add    $0x10,%esp
+    14b2:	89 c7                	mov    %eax,%edi
+    14b4:	85 c0                	test   %eax,%eax
+    14b6:	0f 88 d0 01 00 00    	js     168c <metadata+0x28c>
+    write(fd, name, 15);
+    14bc:	83 ec 04             	sub    $0x4,%esp
+    14bf:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    14c2:	6a 0f                	push   $0xf
+    14c4:	50                   	push   %eax
+    14c5:	57                   	push   %edi
+    14c6:	e8 14 0d 00 00       	call   21df <write>
+    close(fd);
+    14cb:	89 3c 24             	mov    %edi,(%esp)
+    14ce:	e8 1b 0d 00 00       	call   21ee <close>
+  for(i = 0; i < n; i++){
+    14d3:	8d 43 01             	lea    0x1(%ebx),%eax
+    14d6:	83 c4 10             	add    $0x10,%esp
+    14d9:	39 45 08             	cmp    %eax,0x8(%ebp)
+    14dc:	0f 85 6e ff ff ff    	jne    1450 <metadata+0x50>
+    14e2:	89 c7                	mov    %eax,%edi
+    14e4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  for(i = 0; i < n; i++){
+    14e7:	31 f6                	xor    %esi,%esi
+  report("create", n, "files", start);
+    14e9:	50                   	push   %eax
+    14ea:	68 16 31 00 00       	push   $0x3116
+    14ef:	ff 75 08             	push   0x8(%ebp)
+    14f2:	68 1c 31 00 00       	push   $0x311c
+    14f7:	e8 84 fc ff ff       	call   1180 <report>
+  start = uptime();
+    14fc:	e8 bf 0d 00 00       	call   22c0 <uptime>
+    1501:	83 c4 10             	add    $0x10,%esp
+    1504:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1507:	eb 09                	jmp    1512 <metadata+0x112>
+    1509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++){
+    1510:	89 c6                	mov    %eax,%esi
+    name[11] = 'a' + i/26/26%26;
+    1512:	b8 eb 5d f2 60       	mov    $0x60f25deb,%eax
+    if((fd = open(name, O_RDONLY)) < 0){
+    1517:	83 ec 08             	sub    $0x8,%esp
+    name[11] = 'a' + i/26/26%26;
+    151a:	f7 e6                	mul    %esi
+    151c:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    1521:	89 d1                	mov    %edx,%ecx
+    1523:	c1 e9 08             	shr    $0x8,%ecx
+    1526:	f7 e1                	mul    %ecx
+    name[12] = 'a' + i/26%26;
+    1528:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    name[11] = 'a' + i/26/26%26;
+    152d:	c1 ea 03             	shr    $0x3,%edx
+    1530:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    1533:	29 d1                	sub    %edx,%ecx
+    name[12] = 'a' + i/26%26;
+    1535:	f7 e6                	mul    %esi
+    1537:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    name[11] = 'a' + i/26/26%26;
+    153c:	83 c1 61             	add    $0x61,%ecx
+    153f:	88 4d d3             	mov    %cl,-0x2d(%ebp)
+    name[12] = 'a' + i/26%26;
+    1542:	89 d1                	mov    %edx,%ecx
+    1544:	c1 e9 03             	shr    $0x3,%ecx
+    1547:	f7 e1                	mul    %ecx
+    1549:	89 c8                	mov    %ecx,%eax
+    name[13] = 'a' + i%26;
+    154b:	6b c9 1a             	imul   $0x1a,%ecx,%ecx
+    name[12] = 'a' + i/26%26;
+    154e:	c1 ea 03             	shr    $0x3,%edx
+    1551:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    1554:	29 d0                	sub    %edx,%eax
+    1556:	83 c0 61             	add    $0x61,%eax
+    1559:	88 45 d4             	mov    %al,-0x2c(%ebp)
+    name[13] = 'a' + i%26;
+    155c:	89 f0                	mov    %esi,%eax
+    155e:	29 c8                	sub    %ecx,%eax
+    1560:	83 c0 61             	add    $0x61,%eax
+    1563:	88 45 d5             	mov    %al,-0x2b(%ebp)
+    if((fd = open(name, O_RDONLY)) < 0){
+    1566:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1569:	6a 00                	push   $0x0
+    156b:	50                   	push   %eax
+    156c:	e8 aa 0c 00 00       	call   221b <open>
+    1571:	83 c4 10             	add    $0x10,%esp
+    1574:	85 c0                	test   %eax,%eax
+    1576:	0f 88 40 01 00 00    	js     16bc <metadata+0x2bc>
+    close(fd);
+    157c:	83 ec 0c             	sub    $0xc,%esp
+    157f:	50                   	push   %eax
+    1580:	e8 69 0c 00 00       	call   21ee <close>
+  for(i = 0; i < n; i++){
+    1585:	8d 46 01             	lea    0x1(%esi),%eax
+    1588:	83 c4 10             	add    $0x10,%esp
+    158b:	39 de                	cmp    %ebx,%esi
+    158d:	75 81                	jne    1510 <metadata+0x110>
+  report("open", n, "files", start);
+    158f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  for(i = 0; i < n; i++){
+    1592:	31 f6                	xor    %esi,%esi
+  report("open", n, "files", start);
+    1594:	52                   	push   %edx
+    1595:	68 16 31 00 00       	push   $0x3116
+    159a:	57                   	push   %edi
+    name[11] = 'a' + i/26/26%26;
+    159b:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+  report("open", n, "files", start);
+    15a0:	68 9e 31 00 00       	push   $0x319e
+    15a5:	e8 d6 fb ff ff       	call   1180 <report>
+  start = uptime();
+    15aa:	e8 11 0d 00 00       	call   22c0 <uptime>
+    15af:	83 c4 10             	add    $0x10,%esp
+    15b2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    15b5:	eb 0b                	jmp    15c2 <metadata+0x1c2>
+    15b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15be:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < n; i++){
+    15c0:	89 c6                	mov    %eax,%esi
+    name[11] = 'a' + i/26/26%26;
+    15c2:	b8 eb 5d f2 60       	mov    $0x60f25deb,%eax
+    if(unlink(name) < 0){
+    15c7:	83 ec 0c             	sub    $0xc,%esp
+    name[11] = 'a' + i/26/26%26;
+    15ca:	f7 e6                	mul    %esi
+    15cc:	c1 ea 08             	shr    $0x8,%edx
+    15cf:	89 d0                	mov    %edx,%eax
+    15d1:	89 d1                	mov    %edx,%ecx
+    15d3:	f7 e7                	mul    %edi
+    name[12] = 'a' + i/26%26;
+    15d5:	89 f0                	mov    %esi,%eax
+    name[11] = 'a' + i/26/26%26;
+    15d7:	c1 ea 03             	shr    $0x3,%edx
+    15da:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    15dd:	29 d1                	sub    %edx,%ecx
+    name[12] = 'a' + i/26%26;
+    15df:	f7 e7                	mul    %edi
+    name[11] = 'a' + i/26/26%26;
+    15e1:	83 c1 61             	add    $0x61,%ecx
+    15e4:	88 4d d3             	mov    %cl,-0x2d(%ebp)
+    name[12] = 'a' + i/26%26;
+    15e7:	89 d1                	mov    %edx,%ecx
+    15e9:	c1 e9 03             	shr    $0x3,%ecx
+    15ec:	89 c8                	mov    %ecx,%eax
+    15ee:	f7 e7                	mul    %edi
+    15f0:	89 c8                	mov    %ecx,%eax
+    name[13] = 'a' + i%26;
+    15f2:	6b c9 1a             	imul   $0x1a,%ecx,%ecx
+    name[12] = 'a' + i/26%26;
+    15f5:	c1 ea 03             	shr    $0x3,%edx
+    15f8:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    15fb:	29 d0                	sub    %edx,%eax
+    15fd:	83 c0 61             	add    $0x61,%eax
+    1600:	88 45 d4             	mov    %al,-0x2c(%ebp)
+    name[13] = 'a' + i%26;
+    1603:	89 f0                	mov    %esi,%eax
+    1605:	29 c8                	sub    %ecx,%eax
+    1607:	83 c0 61             	add    $0x61,%eax
+    160a:	88 45 d5             	mov    %al,-0x2b(%ebp)
+    if(unlink(name) < 0){
+    160d:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1610:	50                   	push   %eax
+    1611:	e8 23 0c 00 00       	call   2239 <unlink>
+    1616:	83 c4 10             	add    $0x10,%esp
+    1619:	85 c0                	test   %eax,%eax
+    161b:	0f 88 83 00 00 00    	js     16a4 <metadata+0x2a4>
+  for(i = 0; i < n; i++){
+    1621:	8d 46 01             	lea    0x1(%esi),%eax
+    1624:	39 f3                	cmp    %esi,%ebx
+    1626:	75 98                	jne    15c0 <metadata+0x1c0>
+    1628:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  report("unlink", n, "files", start);
+    162b:	52                   	push   %edx
+    162c:	68 16 31 00 00       	push   $0x3116
+    1631:	ff 75 08             	push   0x8(%ebp)
+    1634:	68 6e 31 00 00       	push   $0x316e
+    1639:	e8 42 fb ff ff       	call   1180 <report>
+  unlink("fsbench.d");
+    163e:	c7 04 24 e5 30 00 00 	movl   $0x30e5,(%esp)
+    1645:	e8 ef 0b 00 00       	call   2239 <unlink>
+}
+    164a:	83 c4 10             	add    $0x10,%esp
+    164d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1650:	5b                   	pop    %ebx
+    1651:	5e                   	pop    %esi
+    1652:	5f                   	pop    %edi
+    1653:	5d                   	pop    %ebp
+    1654:	c3                   	ret
+  report("create", n, "files", start);
+    1655:	50                   	push   %eax
+    1656:	68 16 31 00 00       	push   $0x3116
+    165b:	ff 75 08             	push   0x8(%ebp)
+    165e:	68 1c 31 00 00       	push   $0x311c
+    1663:	e8 18 fb ff ff       	call   1180 <report>
+  start = uptime();
+    1668:	e8 53 0c 00 00       	call   22c0 <uptime>
+  report("open", n, "files", start);
+    166d:	50                   	push   %eax
+    166e:	68 16 31 00 00       	push   $0x3116
+    1673:	ff 75 08             	push   0x8(%ebp)
+    1676:	68 9e 31 00 00       	push   $0x319e
+    167b:	e8 00 fb ff ff       	call   1180 <report>
+  start = uptime();
+    1680:	83 c4 20             	add    $0x20,%esp
+    1683:	e8 38 0c 00 00       	call   22c0 <uptime>
+    1688:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < n; i++){
+    168a:	eb 9f                	jmp    162b <metadata+0x22b>
+      printf(2, "fsbench: create %s failed\n", name);
+    168c:	83 ec 04             	sub    $0x4,%esp
+    168f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1692:	50                   	push   %eax
+    1693:	68 fb 30 00 00       	push   $0x30fb
+    1698:	6a 02                	push   $0x2
+    169a:	e8 21 10 00 00       	call   26c0 <printf>
+      exit();
+    169f:	e8 ac 0a 00 00       	call   2150 <exit>
+      printf(2, "fsbench: unlink %s failed\n", name);
+    16a4:	83 ec 04             	sub    $0x4,%esp
+    16a7:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    16aa:	50                   	push   %eax
+    16ab:	68 3c 31 00 00       	push   $0x313c
+    16b0:	6a 02                	push   $0x2
+    16b2:	e8 09 10 00 00       	call   26c0 <printf>
+      exit();
+    16b7:	e8 94 0a 00 00       	call   2150 <exit>
+      printf(2, "fsbench: open %s failed\n", name);
+    16bc:	83 ec 04             	sub    $0x4,%esp
+    16bf:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    16c2:	50                   	push   %eax
+    16c3:	68 23 31 00 00       	push   $0x3123
+    16c8:	6a 02                	push   $0x2
+    16ca:	e8 f1 0f 00 00       	call   26c0 <printf>
+      exit();
+    16cf:	e8 7c 0a 00 00       	call   2150 <exit>
+    printf(2, "fsbench: mkdir fsbench.d failed\n");
+    16d4:	51                   	push   %ecx
+    16d5:	51                   	push   %ecx
+    16d6:	68 84 32 00 00       	push   $0x3284
+    16db:	6a 02                	push   $0x2
+    16dd:	e8 de 0f 00 00       	call   26c0 <printf>
+    exit();
+    16e2:	e8 69 0a 00 00       	call   2150 <exit>
+    16e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ee:	66 90                	xchg   %ax,%ax
+
+000016f0 <fill>:
+{
+    16f0:	55                   	push   %ebp
+    16f1:	89 e5                	mov    %esp,%ebp
+    16f3:	57                   	push   %edi
+    16f4:	56                   	push   %esi
+  strcpy(name, "fsfill");
+    16f5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+{
+    16f8:	53                   	push   %ebx
+    16f9:	83 ec 34             	sub    $0x34,%esp
+  strcpy(name, "fsfill");
+    16fc:	68 57 31 00 00       	push   $0x3157
+    1701:	50                   	push   %eax
+    1702:	e8 69 07 00 00       	call   1e70 <strcpy>
+  start = part = uptime();
+    1707:	e8 b4 0b 00 00       	call   22c0 <uptime>
+  for(i = 0; i < mb; i++){
+    170c:	8b 55 08             	mov    0x8(%ebp),%edx
+    170f:	83 c4 10             	add    $0x10,%esp
+  start = part = uptime();
+    1712:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < mb; i++){
+    1715:	85 d2                	test   %edx,%edx
+    1717:	0f 8e c7 01 00 00    	jle    18e4 <fill+0x1f4>
+  start = part = uptime();
+    171d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < mb; i++){
+    1720:	31 db                	xor    %ebx,%ebx
+    1722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[6] = '0' + i/100%10;
+    1728:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+    172d:	83 ec 08             	sub    $0x8,%esp
+    name[9] = 0;
+    1730:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[6] = '0' + i/100%10;
+    1734:	f7 e3                	mul    %ebx
+    1736:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    173b:	89 d1                	mov    %edx,%ecx
+    173d:	c1 e9 05             	shr    $0x5,%ecx
+    1740:	f7 e1                	mul    %ecx
+    1742:	c1 ea 03             	shr    $0x3,%edx
+    1745:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1748:	01 c0                	add    %eax,%eax
+    174a:	29 c1                	sub    %eax,%ecx
+    name[7] = '0' + i/10%10;
+    174c:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    1751:	f7 e3                	mul    %ebx
+    name[6] = '0' + i/100%10;
+    1753:	83 c1 30             	add    $0x30,%ecx
+    name[7] = '0' + i/10%10;
+    1756:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    name[6] = '0' + i/100%10;
+    175b:	88 4d de             	mov    %cl,-0x22(%ebp)
+    name[7] = '0' + i/10%10;
+    175e:	89 d1                	mov    %edx,%ecx
+    1760:	c1 e9 03             	shr    $0x3,%ecx
+    1763:	f7 e1                	mul    %ecx
+    1765:	89 c8                	mov    %ecx,%eax
+    1767:	c1 ea 03             	shr    $0x3,%edx
+    176a:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    176d:	01 d2                	add    %edx,%edx
+    176f:	29 d0                	sub    %edx,%eax
+    name[8] = '0' + i%10;
+    1771:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    name[7] = '0' + i/10%10;
+    1774:	83 c0 30             	add    $0x30,%eax
+    name[8] = '0' + i%10;
+    1777:	01 d2                	add    %edx,%edx
+    name[7] = '0' + i/10%10;
+    1779:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[8] = '0' + i%10;
+    177c:	89 d8                	mov    %ebx,%eax
+    177e:	29 d0                	sub    %edx,%eax
+    1780:	83 c0 30             	add    $0x30,%eax
+    1783:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+    1786:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1789:	68 02 02 00 00       	push   $0x202
+    178e:	50                   	push   %eax
+    178f:	e8 87 0a 00 00       	call   221b <open>
+    1794:	83 c4 10             	add    $0x10,%esp
+    1797:	89 c7                	mov    %eax,%edi
+    1799:	85 c0                	test   %eax,%eax
+    179b:	78 43                	js     17e0 <fill+0xf0>
+    for(j = 0; j < 1024*1024/sizeof(buf); j++)
+    179d:	31 f6                	xor    %esi,%esi
+    179f:	eb 16                	jmp    17b7 <fill+0xc7>
+    17a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17a8:	83 c6 01             	add    $0x1,%esi
+    17ab:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+    17b1:	0f 84 de 00 00 00    	je     1895 <fill+0x1a5>
+      if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+    17b7:	83 ec 04             	sub    $0x4,%esp
+    17ba:	68 00 10 00 00       	push   $0x1000
+    17bf:	68 c0 3d 00 00       	push   $0x3dc0
+    17c4:	57                   	push   %edi
+    17c5:	e8 15 0a 00 00       	call   21df <write>
+    17ca:	83 c4 10             	add    $0x10,%esp
+    17cd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    17d2:	74 d4                	je     17a8 <fill+0xb8>
+    close(fd);
+    17d4:	83 ec 0c             	sub    $0xc,%esp
+    17d7:	57                   	push   %edi
+    17d8:	e8 11 0a 00 00       	call   21ee <close>
+    if(j < 1024*1024/sizeof(buf))
+    17dd:	83 c4 10             	add    $0x10,%esp
+  report("fill total", i*1024, "KB", start);
+    17e0:	89 d8                	mov    %ebx,%eax
+    17e2:	ff 75 d0             	push   -0x30(%ebp)
+  for(j = 0; j <= i && j < mb; j++){
+    17e5:	31 f6                	xor    %esi,%esi
+    name[6] = '0' + j/100%10;
+    17e7:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+  report("fill total", i*1024, "KB", start);
+    17ec:	c1 e0 0a             	shl    $0xa,%eax
+    17ef:	68 bb 30 00 00       	push   $0x30bb
+    17f4:	50                   	push   %eax
+    17f5:	68 5e 31 00 00       	push   $0x315e
+    17fa:	e8 81 f9 ff ff       	call   1180 <report>
+  start = uptime();
+    17ff:	e8 bc 0a 00 00       	call   22c0 <uptime>
+    1804:	83 c4 10             	add    $0x10,%esp
+    name[6] = '0' + j/100%10;
+    1807:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    180a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1810:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    unlink(name);
+    1815:	83 ec 0c             	sub    $0xc,%esp
+    name[6] = '0' + j/100%10;
+    1818:	f7 e6                	mul    %esi
+    181a:	89 d1                	mov    %edx,%ecx
+    181c:	c1 e9 05             	shr    $0x5,%ecx
+    181f:	89 c8                	mov    %ecx,%eax
+    1821:	f7 e7                	mul    %edi
+    1823:	c1 ea 03             	shr    $0x3,%edx
+    1826:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1829:	01 c0                	add    %eax,%eax
+    182b:	29 c1                	sub    %eax,%ecx
+    name[7] = '0' + j/10%10;
+    182d:	89 f0                	mov    %esi,%eax
+    182f:	f7 e7                	mul    %edi
+    name[6] = '0' + j/100%10;
+    1831:	83 c1 30             	add    $0x30,%ecx
+    1834:	88 4d de             	mov    %cl,-0x22(%ebp)
+    name[7] = '0' + j/10%10;
+    1837:	89 d1                	mov    %edx,%ecx
+    1839:	c1 e9 03             	shr    $0x3,%ecx
+    183c:	89 c8                	mov    %ecx,%eax
+    183e:	f7 e7                	mul    %edi
+    1840:	89 c8                	mov    %ecx,%eax
+    1842:	c1 ea 03             	shr    $0x3,%edx
+    1845:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    1848:	01 d2                	add    %edx,%edx
+    184a:	29 d0                	sub    %edx,%eax
+    name[8] = '0' + j%10;
+    184c:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    name[7] = '0' + j/10%10;
+    184f:	83 c0 30             	add    $0x30,%eax
+    name[8] = '0' + j%10;
+    1852:	01 d2                	add    %edx,%edx
+    name[7] = '0' + j/10%10;
+    1854:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[8] = '0' + j%10;
+    1857:	89 f0                	mov    %esi,%eax
+  for(j = 0; j <= i && j < mb; j++){
+    1859:	83 c6 01             	add    $0x1,%esi
+    name[8] = '0' + j%10;
+    185c:	29 d0                	sub    %edx,%eax
+    185e:	83 c0 30             	add    $0x30,%eax
+    1861:	88 45 e0             	mov    %al,-0x20(%ebp)
+    unlink(name);
+    1864:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1867:	50                   	push   %eax
+    1868:	e8 cc 09 00 00       	call   2239 <unlink>
+  for(j = 0; j <= i && j < mb; j++){
+    186d:	83 c4 10             	add    $0x10,%esp
+    1870:	39 de                	cmp    %ebx,%esi
+    1872:	7f 05                	jg     1879 <fill+0x189>
+    1874:	39 75 08             	cmp    %esi,0x8(%ebp)
+    1877:	7f 97                	jg     1810 <fill+0x120>
+    1879:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  report("fill unlink", j, "files", start);
+    187c:	52                   	push   %edx
+    187d:	68 16 31 00 00       	push   $0x3116
+    1882:	56                   	push   %esi
+    1883:	68 69 31 00 00       	push   $0x3169
+    1888:	e8 f3 f8 ff ff       	call   1180 <report>
+}
+    188d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1890:	5b                   	pop    %ebx
+    1891:	5e                   	pop    %esi
+    1892:	5f                   	pop    %edi
+    1893:	5d                   	pop    %ebp
+    1894:	c3                   	ret
+    close(fd);
+    1895:	83 ec 0c             	sub    $0xc,%esp
+    if((i+1) % 8 == 0){
+    1898:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+    189b:	57                   	push   %edi
+    189c:	e8 4d 09 00 00       	call   21ee <close>
+    if((i+1) % 8 == 0){
+    18a1:	83 c4 10             	add    $0x10,%esp
+    18a4:	f6 c3 07             	test   $0x7,%bl
+    18a7:	74 17                	je     18c0 <fill+0x1d0>
+  for(i = 0; i < mb; i++){
+    18a9:	3b 5d 08             	cmp    0x8(%ebp),%ebx
+    18ac:	0f 85 76 fe ff ff    	jne    1728 <fill+0x38>
+    18b2:	e9 29 ff ff ff       	jmp    17e0 <fill+0xf0>
+    18b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18be:	66 90                	xchg   %ax,%ax
+      report("fill", 8*1024, "KB", part);
+    18c0:	ff 75 d4             	push   -0x2c(%ebp)
+    18c3:	68 bb 30 00 00       	push   $0x30bb
+    18c8:	68 00 20 00 00       	push   $0x2000
+    18cd:	68 59 31 00 00       	push   $0x3159
+    18d2:	e8 a9 f8 ff ff       	call   1180 <report>
+      part = uptime();
+    18d7:	e8 e4 09 00 00       	call   22c0 <uptime>
+    18dc:	83 c4 10             	add    $0x10,%esp
+    18df:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    18e2:	eb c5                	jmp    18a9 <fill+0x1b9>
+  report("fill total", i*1024, "KB", start);
+    18e4:	ff 75 d0             	push   -0x30(%ebp)
+  for(j = 0; j <= i && j < mb; j++){
+    18e7:	31 f6                	xor    %esi,%esi
+  report("fill total", i*1024, "KB", start);
+    18e9:	68 bb 30 00 00       	push   $0x30bb
+    18ee:	6a 00                	push   $0x0
+    18f0:	68 5e 31 00 00       	push   $0x315e
+    18f5:	e8 86 f8 ff ff       	call   1180 <report>
+  start = uptime();
+    18fa:	e8 c1 09 00 00       	call   22c0 <uptime>
+    18ff:	83 c4 10             	add    $0x10,%esp
+    1902:	89 c2                	mov    %eax,%edx
+  for(j = 0; j <= i && j < mb; j++){
+    1904:	e9 73 ff ff ff       	jmp    187c <fill+0x18c>
+    1909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001910 <path>:
+{
+    1910:	55                   	push   %ebp
+    1911:	89 e5                	mov    %esp,%ebp
+    1913:	57                   	push   %edi
+    1914:	56                   	push   %esi
+    1915:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+    191b:	53                   	push   %ebx
+    depth = 10;
+    191c:	89 f7                	mov    %esi,%edi
+{
+    191e:	81 ec 2c 03 00 00    	sub    $0x32c,%esp
+  if(depth < 1 || depth > sizeof(p)/3 - 2)
+    1924:	8b 45 08             	mov    0x8(%ebp),%eax
+    1927:	83 e8 01             	sub    $0x1,%eax
+    depth = 10;
+    192a:	3d a7 00 00 00       	cmp    $0xa7,%eax
+    192f:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1934:	0f 46 45 08          	cmovbe 0x8(%ebp),%eax
+    1938:	89 45 08             	mov    %eax,0x8(%ebp)
+    193b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+    193e:	89 85 d4 fc ff ff    	mov    %eax,-0x32c(%ebp)
+    1944:	8d 1c 06             	lea    (%esi,%eax,1),%ebx
+    1947:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    194e:	66 90                	xchg   %ax,%ax
+    strcpy(p + 3*i, "fp/");
+    1950:	83 ec 08             	sub    $0x8,%esp
+    1953:	68 75 31 00 00       	push   $0x3175
+    1958:	57                   	push   %edi
+    1959:	e8 12 05 00 00       	call   1e70 <strcpy>
+    p[3*i+2] = 0;
+    195e:	c6 47 02 00          	movb   $0x0,0x2(%edi)
+    if(mkdir(p) < 0){
+    1962:	89 34 24             	mov    %esi,(%esp)
+    1965:	e8 fc 08 00 00       	call   2266 <mkdir>
+    196a:	83 c4 10             	add    $0x10,%esp
+    196d:	85 c0                	test   %eax,%eax
+    196f:	0f 88 83 01 00 00    	js     1af8 <path+0x1e8>
+    p[3*i+2] = '/';
+    1975:	c6 47 02 2f          	movb   $0x2f,0x2(%edi)
+  for(i = 0; i < depth; i++){
+    1979:	83 c7 03             	add    $0x3,%edi
+    197c:	39 df                	cmp    %ebx,%edi
+    197e:	75 d0                	jne    1950 <path+0x40>
+  strcpy(p + 3*depth, "f");
+    1980:	83 ec 08             	sub    $0x8,%esp
+    1983:	68 f9 30 00 00       	push   $0x30f9
+    1988:	8b 85 d4 fc ff ff    	mov    -0x32c(%ebp),%eax
+    198e:	01 f0                	add    %esi,%eax
+    1990:	50                   	push   %eax
+    1991:	e8 da 04 00 00       	call   1e70 <strcpy>
+  if((fd = open(p, O_CREATE|O_RDWR)) < 0){
+    1996:	59                   	pop    %ecx
+    1997:	5b                   	pop    %ebx
+    1998:	68 02 02 00 00       	push   $0x202
+    199d:	56                   	push   %esi
+    199e:	e8 78 08 00 00       	call   221b <open>
+    19a3:	83 c4 10             	add    $0x10,%esp
+    19a6:	85 c0                	test   %eax,%eax
+    19a8:	0f 88 74 01 00 00    	js     1b22 <path+0x212>
+  close(fd);
+    19ae:	83 ec 0c             	sub    $0xc,%esp
+    19b1:	50                   	push   %eax
+    19b2:	e8 37 08 00 00       	call   21ee <close>
+  kstat(&before);
+    19b7:	8d 85 e0 fc ff ff    	lea    -0x320(%ebp),%eax
+    19bd:	89 04 24             	mov    %eax,(%esp)
+    19c0:	e8 28 09 00 00       	call   22ed <kstat>
+  start = uptime();
+    19c5:	e8 f6 08 00 00       	call   22c0 <uptime>
+  for(i = 0; i < n; i++){
+    19ca:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+    19cd:	89 85 d0 fc ff ff    	mov    %eax,-0x330(%ebp)
+  for(i = 0; i < n; i++){
+    19d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    19d6:	85 c0                	test   %eax,%eax
+    19d8:	0f 8e e0 00 00 00    	jle    1abe <path+0x1ae>
+    19de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    19e1:	31 db                	xor    %ebx,%ebx
+    19e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19e7:	90                   	nop
+    if((fd = open(p, O_RDONLY)) < 0){
+    19e8:	83 ec 08             	sub    $0x8,%esp
+    19eb:	6a 00                	push   $0x0
+    19ed:	56                   	push   %esi
+    19ee:	e8 28 08 00 00       	call   221b <open>
+    19f3:	83 c4 10             	add    $0x10,%esp
+    19f6:	85 c0                	test   %eax,%eax
+    19f8:	0f 88 0f 01 00 00    	js     1b0d <path+0x1fd>
+    close(fd);
+    19fe:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n; i++){
+    1a01:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+    1a04:	50                   	push   %eax
+    1a05:	e8 e4 07 00 00       	call   21ee <close>
+  for(i = 0; i < n; i++){
+    1a0a:	83 c4 10             	add    $0x10,%esp
+    1a0d:	39 df                	cmp    %ebx,%edi
+    1a0f:	75 d7                	jne    19e8 <path+0xd8>
+  t = uptime() - start;
+    1a11:	e8 aa 08 00 00       	call   22c0 <uptime>
+    1a16:	8b bd d0 fc ff ff    	mov    -0x330(%ebp),%edi
+  kstat(&after);
+    1a1c:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - start;
+    1a1f:	29 f8                	sub    %edi,%eax
+    1a21:	89 c3                	mov    %eax,%ebx
+  kstat(&after);
+    1a23:	8d 85 64 fd ff ff    	lea    -0x29c(%ebp),%eax
+    1a29:	50                   	push   %eax
+    1a2a:	e8 be 08 00 00       	call   22ed <kstat>
+  report("path open", n, "opens", start);
+    1a2f:	57                   	push   %edi
+    1a30:	68 93 31 00 00       	push   $0x3193
+    1a35:	ff 75 0c             	push   0xc(%ebp)
+    1a38:	68 99 31 00 00       	push   $0x3199
+    1a3d:	e8 3e f7 ff ff       	call   1180 <report>
+    printf(1, "path open: %d components, %d us per open, dcache %d hits %d misses\n",
+    1a42:	8b 85 c8 fd ff ff    	mov    -0x238(%ebp),%eax
+    1a48:	83 c4 18             	add    $0x18,%esp
+    1a4b:	2b 85 44 fd ff ff    	sub    -0x2bc(%ebp),%eax
+    1a51:	50                   	push   %eax
+    1a52:	8b 85 c0 fd ff ff    	mov    -0x240(%ebp),%eax
+    1a58:	2b 85 3c fd ff ff    	sub    -0x2c4(%ebp),%eax
+    1a5e:	50                   	push   %eax
+      depth + 1, t*10000/n, after.dcache_hits - before.dcache_hits,
+    1a5f:	69 c3 10 27 00 00    	imul   $0x2710,%ebx,%eax
+    printf(1, "path open: %d components, %d us per open, dcache %d hits %d misses\n",
+    1a65:	99                   	cltd
+    1a66:	f7 7d 0c             	idivl  0xc(%ebp)
+    1a69:	50                   	push   %eax
+    1a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+    1a6d:	83 c0 01             	add    $0x1,%eax
+    1a70:	50                   	push   %eax
+    1a71:	68 a8 32 00 00       	push   $0x32a8
+    1a76:	6a 01                	push   $0x1
+    1a78:	e8 43 0c 00 00       	call   26c0 <printf>
+  unlink(p);
+    1a7d:	83 c4 14             	add    $0x14,%esp
+    1a80:	56                   	push   %esi
+    1a81:	e8 b3 07 00 00       	call   2239 <unlink>
+    1a86:	83 c4 10             	add    $0x10,%esp
+    1a89:	8b 85 d4 fc ff ff    	mov    -0x32c(%ebp),%eax
+    1a8f:	8d 7e ff             	lea    -0x1(%esi),%edi
+    1a92:	8d 5c 06 ff          	lea    -0x1(%esi,%eax,1),%ebx
+    1a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a9d:	8d 76 00             	lea    0x0(%esi),%esi
+    unlink(p);
+    1aa0:	83 ec 0c             	sub    $0xc,%esp
+    p[3*i-1] = 0;
+    1aa3:	c6 03 00             	movb   $0x0,(%ebx)
+  for(i = depth; i > 0; i--){
+    1aa6:	83 eb 03             	sub    $0x3,%ebx
+    unlink(p);
+    1aa9:	56                   	push   %esi
+    1aaa:	e8 8a 07 00 00       	call   2239 <unlink>
+  for(i = depth; i > 0; i--){
+    1aaf:	83 c4 10             	add    $0x10,%esp
+    1ab2:	39 fb                	cmp    %edi,%ebx
+    1ab4:	75 ea                	jne    1aa0 <path+0x190>
+}
+    1ab6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ab9:	5b                   	pop    %ebx
+    1aba:	5e                   	pop    %esi
+    1abb:	5f                   	pop    %edi
+    1abc:	5d                   	pop    %ebp
+    1abd:	c3                   	ret
+  t = uptime() - start;
+    1abe:	e8 fd 07 00 00       	call   22c0 <uptime>
+  kstat(&after);
+    1ac3:	83 ec 0c             	sub    $0xc,%esp
+    1ac6:	8d 85 64 fd ff ff    	lea    -0x29c(%ebp),%eax
+    1acc:	50                   	push   %eax
+    1acd:	e8 1b 08 00 00       	call   22ed <kstat>
+  report("path open", n, "opens", start);
+    1ad2:	ff b5 d0 fc ff ff    	push   -0x330(%ebp)
+    1ad8:	68 93 31 00 00       	push   $0x3193
+    1add:	ff 75 0c             	push   0xc(%ebp)
+    1ae0:	68 99 31 00 00       	push   $0x3199
+    1ae5:	e8 96 f6 ff ff       	call   1180 <report>
+  unlink(p);
+    1aea:	83 c4 14             	add    $0x14,%esp
+    1aed:	56                   	push   %esi
+    1aee:	e8 46 07 00 00       	call   2239 <unlink>
+    1af3:	83 c4 10             	add    $0x10,%esp
+    1af6:	eb 91                	jmp    1a89 <path+0x179>
+      printf(2, "fsbench: mkdir %s failed\n", p);
+    1af8:	83 ec 04             	sub    $0x4,%esp
+    1afb:	56                   	push   %esi
+    1afc:	68 79 31 00 00       	push   $0x3179
+    1b01:	6a 02                	push   $0x2
+    1b03:	e8 b8 0b 00 00       	call   26c0 <printf>
+      exit();
+    1b08:	e8 43 06 00 00       	call   2150 <exit>
+      printf(2, "fsbench: open %s failed\n", p);
+    1b0d:	83 ec 04             	sub    $0x4,%esp
+    1b10:	56                   	push   %esi
+    1b11:	68 23 31 00 00       	push   $0x3123
+    1b16:	6a 02                	push   $0x2
+    1b18:	e8 a3 0b 00 00       	call   26c0 <printf>
+      exit();
+    1b1d:	e8 2e 06 00 00       	call   2150 <exit>
+    printf(2, "fsbench: create %s failed\n", p);
+    1b22:	52                   	push   %edx
+    1b23:	56                   	push   %esi
+    1b24:	68 fb 30 00 00       	push   $0x30fb
+    1b29:	6a 02                	push   $0x2
+    1b2b:	e8 90 0b 00 00       	call   26c0 <printf>
+    exit();
+    1b30:	e8 1b 06 00 00       	call   2150 <exit>
+    1b35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b40 <ddname>:
+{
+    1b40:	55                   	push   %ebp
+    1b41:	89 e5                	mov    %esp,%ebp
+    1b43:	57                   	push   %edi
+    1b44:	56                   	push   %esi
+    1b45:	53                   	push   %ebx
+  name[12] = '0' + i/10000%10;
+    1b46:	bb 67 66 66 66       	mov    $0x66666667,%ebx
+{
+    1b4b:	83 ec 14             	sub    $0x14,%esp
+    1b4e:	8b 75 08             	mov    0x8(%ebp),%esi
+  strcpy(name, "fsbench.dd/x");
+    1b51:	68 a3 31 00 00       	push   $0x31a3
+    1b56:	56                   	push   %esi
+    1b57:	e8 14 03 00 00       	call   1e70 <strcpy>
+  name[12] = '0' + i/10000%10;
+    1b5c:	b8 ad 8b db 68       	mov    $0x68db8bad,%eax
+    1b61:	f7 6d 0c             	imull  0xc(%ebp)
+    1b64:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  name[17] = 0;
+    1b67:	c6 46 11 00          	movb   $0x0,0x11(%esi)
+  name[12] = '0' + i/10000%10;
+    1b6b:	c1 ff 1f             	sar    $0x1f,%edi
+    1b6e:	c1 fa 0c             	sar    $0xc,%edx
+    1b71:	89 d1                	mov    %edx,%ecx
+    1b73:	29 f9                	sub    %edi,%ecx
+    1b75:	89 c8                	mov    %ecx,%eax
+    1b77:	f7 eb                	imul   %ebx
+    1b79:	89 c8                	mov    %ecx,%eax
+    1b7b:	c1 f8 1f             	sar    $0x1f,%eax
+    1b7e:	c1 fa 02             	sar    $0x2,%edx
+    1b81:	29 c2                	sub    %eax,%edx
+    1b83:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1b86:	01 c0                	add    %eax,%eax
+    1b88:	29 c1                	sub    %eax,%ecx
+  name[13] = '0' + i/1000%10;
+    1b8a:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    1b8f:	f7 6d 0c             	imull  0xc(%ebp)
+  name[12] = '0' + i/10000%10;
+    1b92:	83 c1 30             	add    $0x30,%ecx
+    1b95:	88 4e 0c             	mov    %cl,0xc(%esi)
+  name[13] = '0' + i/1000%10;
+    1b98:	89 d1                	mov    %edx,%ecx
+    1b9a:	c1 f9 06             	sar    $0x6,%ecx
+    1b9d:	29 f9                	sub    %edi,%ecx
+    1b9f:	89 c8                	mov    %ecx,%eax
+    1ba1:	f7 eb                	imul   %ebx
+    1ba3:	89 c8                	mov    %ecx,%eax
+    1ba5:	c1 f8 1f             	sar    $0x1f,%eax
+    1ba8:	c1 fa 02             	sar    $0x2,%edx
+    1bab:	29 c2                	sub    %eax,%edx
+    1bad:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1bb0:	01 c0                	add    %eax,%eax
+    1bb2:	29 c1                	sub    %eax,%ecx
+  name[14] = '0' + i/100%10;
+    1bb4:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    1bb9:	f7 6d 0c             	imull  0xc(%ebp)
+  name[13] = '0' + i/1000%10;
+    1bbc:	83 c1 30             	add    $0x30,%ecx
+    1bbf:	88 4e 0d             	mov    %cl,0xd(%esi)
+  name[14] = '0' + i/100%10;
+    1bc2:	89 d1                	mov    %edx,%ecx
+    1bc4:	c1 f9 05             	sar    $0x5,%ecx
+    1bc7:	29 f9                	sub    %edi,%ecx
+    1bc9:	89 c8                	mov    %ecx,%eax
+    1bcb:	f7 eb                	imul   %ebx
+    1bcd:	89 c8                	mov    %ecx,%eax
+    1bcf:	c1 f8 1f             	sar    $0x1f,%eax
+    1bd2:	c1 fa 02             	sar    $0x2,%edx
+    1bd5:	29 c2                	sub    %eax,%edx
+    1bd7:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1bda:	01 c0                	add    %eax,%eax
+    1bdc:	29 c1                	sub    %eax,%ecx
+  name[15] = '0' + i/10%10;
+    1bde:	89 d8                	mov    %ebx,%eax
+  name[14] = '0' + i/100%10;
+    1be0:	83 c1 30             	add    $0x30,%ecx
+  name[15] = '0' + i/10%10;
+    1be3:	f7 6d 0c             	imull  0xc(%ebp)
+}
+    1be6:	83 c4 10             	add    $0x10,%esp
+  name[14] = '0' + i/100%10;
+    1be9:	88 4e 0e             	mov    %cl,0xe(%esi)
+  name[15] = '0' + i/10%10;
+    1bec:	89 d1                	mov    %edx,%ecx
+    1bee:	c1 f9 02             	sar    $0x2,%ecx
+    1bf1:	29 f9                	sub    %edi,%ecx
+    1bf3:	89 c8                	mov    %ecx,%eax
+    1bf5:	f7 eb                	imul   %ebx
+    1bf7:	89 c8                	mov    %ecx,%eax
+    1bf9:	c1 f8 1f             	sar    $0x1f,%eax
+    1bfc:	c1 fa 02             	sar    $0x2,%edx
+    1bff:	29 c2                	sub    %eax,%edx
+    1c01:	89 c8                	mov    %ecx,%eax
+    1c03:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    1c06:	01 d2                	add    %edx,%edx
+    1c08:	29 d0                	sub    %edx,%eax
+  name[16] = '0' + i%10;
+    1c0a:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+  name[15] = '0' + i/10%10;
+    1c0d:	83 c0 30             	add    $0x30,%eax
+  name[16] = '0' + i%10;
+    1c10:	01 d2                	add    %edx,%edx
+  name[15] = '0' + i/10%10;
+    1c12:	88 46 0f             	mov    %al,0xf(%esi)
+  name[16] = '0' + i%10;
+    1c15:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1c18:	29 d0                	sub    %edx,%eax
+    1c1a:	83 c0 30             	add    $0x30,%eax
+    1c1d:	88 46 10             	mov    %al,0x10(%esi)
+}
+    1c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c23:	5b                   	pop    %ebx
+    1c24:	5e                   	pop    %esi
+    1c25:	5f                   	pop    %edi
+    1c26:	5d                   	pop    %ebp
+    1c27:	c3                   	ret
+    1c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c2f:	90                   	nop
+
+00001c30 <bigdir>:
+{
+    1c30:	55                   	push   %ebp
+    1c31:	89 e5                	mov    %esp,%ebp
+    1c33:	57                   	push   %edi
+    1c34:	56                   	push   %esi
+    1c35:	53                   	push   %ebx
+    1c36:	83 ec 68             	sub    $0x68,%esp
+  if(mkdir("fsbench.dd") < 0 || (fd = open("fsbench.dd/f", O_CREATE|O_RDWR)) < 0){
+    1c39:	68 b0 31 00 00       	push   $0x31b0
+    1c3e:	e8 23 06 00 00       	call   2266 <mkdir>
+    1c43:	83 c4 10             	add    $0x10,%esp
+    1c46:	8b 55 08             	mov    0x8(%ebp),%edx
+    1c49:	85 c0                	test   %eax,%eax
+    1c4b:	0f 88 09 02 00 00    	js     1e5a <bigdir+0x22a>
+    1c51:	83 ec 08             	sub    $0x8,%esp
+    1c54:	89 55 08             	mov    %edx,0x8(%ebp)
+    1c57:	68 02 02 00 00       	push   $0x202
+    1c5c:	68 bb 31 00 00       	push   $0x31bb
+    1c61:	e8 b5 05 00 00       	call   221b <open>
+    1c66:	83 c4 10             	add    $0x10,%esp
+    1c69:	85 c0                	test   %eax,%eax
+    1c6b:	0f 88 e9 01 00 00    	js     1e5a <bigdir+0x22a>
+  close(fd);
+    1c71:	83 ec 0c             	sub    $0xc,%esp
+    1c74:	50                   	push   %eax
+    1c75:	e8 74 05 00 00       	call   21ee <close>
+  start = uptime();
+    1c7a:	e8 41 06 00 00       	call   22c0 <uptime>
+  for(i = 0; i < n; i++){
+    1c7f:	8b 55 08             	mov    0x8(%ebp),%edx
+    1c82:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+    1c85:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++){
+    1c87:	85 d2                	test   %edx,%edx
+    1c89:	0f 8e 52 01 00 00    	jle    1de1 <bigdir+0x1b1>
+    1c8f:	31 f6                	xor    %esi,%esi
+    1c91:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+    1c94:	eb 15                	jmp    1cab <bigdir+0x7b>
+    1c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c9d:	8d 76 00             	lea    0x0(%esi),%esi
+    1ca0:	83 c6 01             	add    $0x1,%esi
+    1ca3:	39 f2                	cmp    %esi,%edx
+    1ca5:	0f 84 15 01 00 00    	je     1dc0 <bigdir+0x190>
+    ddname(name, i);
+    1cab:	83 ec 08             	sub    $0x8,%esp
+    1cae:	89 55 08             	mov    %edx,0x8(%ebp)
+    1cb1:	56                   	push   %esi
+    1cb2:	53                   	push   %ebx
+    1cb3:	e8 88 fe ff ff       	call   1b40 <ddname>
+    if(link("fsbench.dd/f", name) < 0){
+    1cb8:	59                   	pop    %ecx
+    1cb9:	58                   	pop    %eax
+    1cba:	53                   	push   %ebx
+    1cbb:	68 bb 31 00 00       	push   $0x31bb
+    1cc0:	e8 92 05 00 00       	call   2257 <link>
+    1cc5:	83 c4 10             	add    $0x10,%esp
+    1cc8:	8b 55 08             	mov    0x8(%ebp),%edx
+    1ccb:	85 c0                	test   %eax,%eax
+    1ccd:	79 d1                	jns    1ca0 <bigdir+0x70>
+      printf(2, "fsbench: link %s failed\n", name);
+    1ccf:	83 ec 04             	sub    $0x4,%esp
+    1cd2:	53                   	push   %ebx
+    1cd3:	68 c8 31 00 00       	push   $0x31c8
+    1cd8:	6a 02                	push   $0x2
+    1cda:	e8 e1 09 00 00       	call   26c0 <printf>
+  report("dir link", n, "names", start);
+    1cdf:	57                   	push   %edi
+    1ce0:	68 e1 31 00 00       	push   $0x31e1
+    1ce5:	56                   	push   %esi
+    1ce6:	68 e7 31 00 00       	push   $0x31e7
+    1ceb:	e8 90 f4 ff ff       	call   1180 <report>
+  start = uptime();
+    1cf0:	83 c4 20             	add    $0x20,%esp
+    1cf3:	e8 c8 05 00 00       	call   22c0 <uptime>
+    1cf8:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  for(i = 0; i < n; i++){
+    1cfb:	85 f6                	test   %esi,%esi
+    1cfd:	0f 84 1d 01 00 00    	je     1e20 <bigdir+0x1f0>
+  start = uptime();
+    1d03:	31 ff                	xor    %edi,%edi
+    1d05:	eb 0b                	jmp    1d12 <bigdir+0xe2>
+    1d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d0e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < n; i++){
+    1d10:	89 d7                	mov    %edx,%edi
+    ddname(name, i);
+    1d12:	83 ec 08             	sub    $0x8,%esp
+    1d15:	57                   	push   %edi
+    1d16:	53                   	push   %ebx
+    1d17:	e8 24 fe ff ff       	call   1b40 <ddname>
+    if(stat(name, &st) < 0){
+    1d1c:	58                   	pop    %eax
+    1d1d:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+    1d20:	5a                   	pop    %edx
+    1d21:	50                   	push   %eax
+    1d22:	53                   	push   %ebx
+    1d23:	e8 c8 02 00 00       	call   1ff0 <stat>
+    1d28:	83 c4 10             	add    $0x10,%esp
+    1d2b:	85 c0                	test   %eax,%eax
+    1d2d:	0f 88 12 01 00 00    	js     1e45 <bigdir+0x215>
+  for(i = 0; i < n; i++){
+    1d33:	8d 57 01             	lea    0x1(%edi),%edx
+    1d36:	39 f2                	cmp    %esi,%edx
+    1d38:	75 d6                	jne    1d10 <bigdir+0xe0>
+    1d3a:	89 55 08             	mov    %edx,0x8(%ebp)
+  report("dir lookup", n, "names", start);
+    1d3d:	ff 75 a4             	push   -0x5c(%ebp)
+    1d40:	68 e1 31 00 00       	push   $0x31e1
+    1d45:	56                   	push   %esi
+    1d46:	68 f0 31 00 00       	push   $0x31f0
+    1d4b:	e8 30 f4 ff ff       	call   1180 <report>
+  start = uptime();
+    1d50:	e8 6b 05 00 00       	call   22c0 <uptime>
+  for(i = 0; i < n; i++){
+    1d55:	8b 55 08             	mov    0x8(%ebp),%edx
+  start = uptime();
+    1d58:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+    1d5b:	31 c9                	xor    %ecx,%ecx
+  start = uptime();
+    1d5d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++){
+    1d5f:	90                   	nop
+    ddname(name, i);
+    1d60:	83 ec 08             	sub    $0x8,%esp
+    1d63:	89 55 08             	mov    %edx,0x8(%ebp)
+    1d66:	51                   	push   %ecx
+    1d67:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+    1d6a:	53                   	push   %ebx
+    1d6b:	e8 d0 fd ff ff       	call   1b40 <ddname>
+    unlink(name);
+    1d70:	89 1c 24             	mov    %ebx,(%esp)
+    1d73:	e8 c1 04 00 00       	call   2239 <unlink>
+  for(i = 0; i < n; i++){
+    1d78:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+    1d7b:	83 c4 10             	add    $0x10,%esp
+    1d7e:	8b 55 08             	mov    0x8(%ebp),%edx
+    1d81:	89 c8                	mov    %ecx,%eax
+    1d83:	83 c1 01             	add    $0x1,%ecx
+    1d86:	39 c7                	cmp    %eax,%edi
+    1d88:	75 d6                	jne    1d60 <bigdir+0x130>
+  report("dir unlink", n, "names", start);
+    1d8a:	56                   	push   %esi
+    1d8b:	68 e1 31 00 00       	push   $0x31e1
+    1d90:	52                   	push   %edx
+    1d91:	68 14 32 00 00       	push   $0x3214
+    1d96:	e8 e5 f3 ff ff       	call   1180 <report>
+  unlink("fsbench.dd/f");
+    1d9b:	c7 04 24 bb 31 00 00 	movl   $0x31bb,(%esp)
+    1da2:	e8 92 04 00 00       	call   2239 <unlink>
+  unlink("fsbench.dd");
+    1da7:	c7 04 24 b0 31 00 00 	movl   $0x31b0,(%esp)
+    1dae:	e8 86 04 00 00       	call   2239 <unlink>
+}
+    1db3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1db6:	5b                   	pop    %ebx
+    1db7:	5e                   	pop    %esi
+    1db8:	5f                   	pop    %edi
+    1db9:	5d                   	pop    %ebp
+    1dba:	c3                   	ret
+    1dbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1dbf:	90                   	nop
+  report("dir link", n, "names", start);
+    1dc0:	57                   	push   %edi
+    1dc1:	68 e1 31 00 00       	push   $0x31e1
+    1dc6:	56                   	push   %esi
+    1dc7:	68 e7 31 00 00       	push   $0x31e7
+    1dcc:	e8 af f3 ff ff       	call   1180 <report>
+  start = uptime();
+    1dd1:	e8 ea 04 00 00       	call   22c0 <uptime>
+    1dd6:	83 c4 10             	add    $0x10,%esp
+    1dd9:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  for(i = 0; i < n; i++){
+    1ddc:	e9 22 ff ff ff       	jmp    1d03 <bigdir+0xd3>
+  report("dir link", n, "names", start);
+    1de1:	50                   	push   %eax
+    1de2:	68 e1 31 00 00       	push   $0x31e1
+    1de7:	52                   	push   %edx
+    1de8:	89 55 08             	mov    %edx,0x8(%ebp)
+    1deb:	68 e7 31 00 00       	push   $0x31e7
+    1df0:	e8 8b f3 ff ff       	call   1180 <report>
+  start = uptime();
+    1df5:	e8 c6 04 00 00       	call   22c0 <uptime>
+  report("dir lookup", n, "names", start);
+    1dfa:	50                   	push   %eax
+    1dfb:	68 e1 31 00 00       	push   $0x31e1
+    1e00:	8b 55 08             	mov    0x8(%ebp),%edx
+    1e03:	52                   	push   %edx
+    1e04:	68 f0 31 00 00       	push   $0x31f0
+    1e09:	e8 72 f3 ff ff       	call   1180 <report>
+  start = uptime();
+    1e0e:	83 c4 20             	add    $0x20,%esp
+    1e11:	e8 aa 04 00 00       	call   22c0 <uptime>
+    1e16:	8b 55 08             	mov    0x8(%ebp),%edx
+    1e19:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++){
+    1e1b:	e9 6a ff ff ff       	jmp    1d8a <bigdir+0x15a>
+  report("dir lookup", n, "names", start);
+    1e20:	ff 75 a4             	push   -0x5c(%ebp)
+    1e23:	68 e1 31 00 00       	push   $0x31e1
+    1e28:	6a 00                	push   $0x0
+    1e2a:	68 f0 31 00 00       	push   $0x31f0
+    1e2f:	e8 4c f3 ff ff       	call   1180 <report>
+  start = uptime();
+    1e34:	e8 87 04 00 00       	call   22c0 <uptime>
+    1e39:	83 c4 10             	add    $0x10,%esp
+    1e3c:	31 d2                	xor    %edx,%edx
+    1e3e:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++){
+    1e40:	e9 45 ff ff ff       	jmp    1d8a <bigdir+0x15a>
+      printf(2, "fsbench: stat %s failed\n", name);
+    1e45:	83 ec 04             	sub    $0x4,%esp
+    1e48:	53                   	push   %ebx
+    1e49:	68 fb 31 00 00       	push   $0x31fb
+    1e4e:	6a 02                	push   $0x2
+    1e50:	e8 6b 08 00 00       	call   26c0 <printf>
+      exit();
+    1e55:	e8 f6 02 00 00       	call   2150 <exit>
+    printf(2, "fsbench: create fsbench.dd/f failed\n");
+    1e5a:	50                   	push   %eax
+    1e5b:	50                   	push   %eax
+    1e5c:	68 ec 32 00 00       	push   $0x32ec
+    1e61:	6a 02                	push   $0x2
+    1e63:	e8 58 08 00 00       	call   26c0 <printf>
+    exit();
+    1e68:	e8 e3 02 00 00       	call   2150 <exit>
+    1e6d:	66 90                	xchg   %ax,%ax
+    1e6f:	90                   	nop
+
+00001e70 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1e70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1e71:	31 c0                	xor    %eax,%eax
+{
+    1e73:	89 e5                	mov    %esp,%ebp
+    1e75:	53                   	push   %ebx
+    1e76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1e79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1e80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1e84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1e87:	83 c0 01             	add    $0x1,%eax
+    1e8a:	84 d2                	test   %dl,%dl
+    1e8c:	75 f2                	jne    1e80 <strcpy+0x10>
+    ;
+  return os;
+}
+    1e8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e91:	89 c8                	mov    %ecx,%eax
+    1e93:	c9                   	leave
+    1e94:	c3                   	ret
+    1e95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ea0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1ea0:	55                   	push   %ebp
+    1ea1:	89 e5                	mov    %esp,%ebp
+    1ea3:	53                   	push   %ebx
+    1ea4:	8b 55 08             	mov    0x8(%ebp),%edx
+    1ea7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    1eaa:	0f b6 02             	movzbl (%edx),%eax
+    1ead:	84 c0                	test   %al,%al
+    1eaf:	75 17                	jne    1ec8 <strcmp+0x28>
+    1eb1:	eb 3a                	jmp    1eed <strcmp+0x4d>
+    1eb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1eb7:	90                   	nop
+    1eb8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    1ebc:	83 c2 01             	add    $0x1,%edx
+    1ebf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1ec2:	84 c0                	test   %al,%al
+    1ec4:	74 1a                	je     1ee0 <strcmp+0x40>
+    p++, q++;
+    1ec6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1ec8:	0f b6 19             	movzbl (%ecx),%ebx
+    1ecb:	38 c3                	cmp    %al,%bl
+    1ecd:	74 e9                	je     1eb8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    1ecf:	29 d8                	sub    %ebx,%eax
+}
+    1ed1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ed4:	c9                   	leave
+    1ed5:	c3                   	ret
+    1ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1edd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1ee0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1ee4:	31 c0                	xor    %eax,%eax
+    1ee6:	29 d8                	sub    %ebx,%eax
+}
+    1ee8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1eeb:	c9                   	leave
+    1eec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    1eed:	0f b6 19             	movzbl (%ecx),%ebx
+    1ef0:	31 c0                	xor    %eax,%eax
+    1ef2:	eb db                	jmp    1ecf <strcmp+0x2f>
+    1ef4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1eff:	90                   	nop
+
+00001f00 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1f00:	55                   	push   %ebp
+    1f01:	89 e5                	mov    %esp,%ebp
+    1f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1f06:	80 3a 00             	cmpb   $0x0,(%edx)
+    1f09:	74 15                	je     1f20 <strlen+0x20>
+    1f0b:	31 c0                	xor    %eax,%eax
+    1f0d:	8d 76 00             	lea    0x0(%esi),%esi
+    1f10:	83 c0 01             	add    $0x1,%eax
+    1f13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1f17:	89 c1                	mov    %eax,%ecx
+    1f19:	75 f5                	jne    1f10 <strlen+0x10>
+    ;
+  return n;
+}
+    1f1b:	89 c8                	mov    %ecx,%eax
+    1f1d:	5d                   	pop    %ebp
+    1f1e:	c3                   	ret
+    1f1f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1f20:	31 c9                	xor    %ecx,%ecx
+}
+    1f22:	5d                   	pop    %ebp
+    1f23:	89 c8                	mov    %ecx,%eax
+    1f25:	c3                   	ret
+    1f26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001f30 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1f30:	55                   	push   %ebp
+    1f31:	89 e5                	mov    %esp,%ebp
+    1f33:	57                   	push   %edi
+    1f34:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1f37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1f3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1f3d:	89 d7                	mov    %edx,%edi
+    1f3f:	fc                   	cld
+    1f40:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1f42:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1f45:	89 d0                	mov    %edx,%eax
+    1f47:	c9                   	leave
+    1f48:	c3                   	ret
+    1f49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001f50 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1f50:	55                   	push   %ebp
+    1f51:	89 e5                	mov    %esp,%ebp
+    1f53:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    1f5a:	0f b6 10             	movzbl (%eax),%edx
+    1f5d:	84 d2                	test   %dl,%dl
+    1f5f:	75 12                	jne    1f73 <strchr+0x23>
+    1f61:	eb 1d                	jmp    1f80 <strchr+0x30>
+    1f63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f67:	90                   	nop
+    1f68:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    1f6c:	83 c0 01             	add    $0x1,%eax
+    1f6f:	84 d2                	test   %dl,%dl
+    1f71:	74 0d                	je     1f80 <strchr+0x30>
+    if(*s == c)
+    1f73:	38 d1                	cmp    %dl,%cl
+    1f75:	75 f1                	jne    1f68 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1f77:	5d                   	pop    %ebp
+    1f78:	c3                   	ret
+    1f79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1f80:	31 c0                	xor    %eax,%eax
+}
+    1f82:	5d                   	pop    %ebp
+    1f83:	c3                   	ret
+    1f84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f8f:	90                   	nop
+
+00001f90 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	57                   	push   %edi
+    1f94:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1f95:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1f98:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1f99:	31 db                	xor    %ebx,%ebx
+{
+    1f9b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    1f9e:	eb 27                	jmp    1fc7 <gets+0x37>
+    cc = read(0, &c, 1);
+    1fa0:	83 ec 04             	sub    $0x4,%esp
+    1fa3:	6a 01                	push   $0x1
+    1fa5:	56                   	push   %esi
+    1fa6:	6a 00                	push   $0x0
+    1fa8:	e8 23 02 00 00       	call   21d0 <read>
+    if(cc < 1)
+    1fad:	83 c4 10             	add    $0x10,%esp
+    1fb0:	85 c0                	test   %eax,%eax
+    1fb2:	7e 1d                	jle    1fd1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1fb4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+    1fbb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    1fbf:	3c 0a                	cmp    $0xa,%al
+    1fc1:	74 10                	je     1fd3 <gets+0x43>
+    1fc3:	3c 0d                	cmp    $0xd,%al
+    1fc5:	74 0c                	je     1fd3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1fc7:	89 df                	mov    %ebx,%edi
+    1fc9:	83 c3 01             	add    $0x1,%ebx
+    1fcc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1fcf:	7c cf                	jl     1fa0 <gets+0x10>
+    1fd1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+    1fd6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    1fda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fdd:	5b                   	pop    %ebx
+    1fde:	5e                   	pop    %esi
+    1fdf:	5f                   	pop    %edi
+    1fe0:	5d                   	pop    %ebp
+    1fe1:	c3                   	ret
+    1fe2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fe9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ff0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1ff0:	55                   	push   %ebp
+    1ff1:	89 e5                	mov    %esp,%ebp
+    1ff3:	56                   	push   %esi
+    1ff4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1ff5:	83 ec 08             	sub    $0x8,%esp
+    1ff8:	6a 00                	push   $0x0
+    1ffa:	ff 75 08             	push   0x8(%ebp)
+    1ffd:	e8 19 02 00 00       	call   221b <open>
+  if(fd < 0)
+    2002:	83 c4 10             	add    $0x10,%esp
+    2005:	85 c0                	test   %eax,%eax
+    2007:	78 27                	js     2030 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    2009:	83 ec 08             	sub    $0x8,%esp
+    200c:	ff 75 0c             	push   0xc(%ebp)
+    200f:	89 c3                	mov    %eax,%ebx
+    2011:	50                   	push   %eax
+    2012:	e8 31 02 00 00       	call   2248 <fstat>
+  close(fd);
+    2017:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    201a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    201c:	e8 cd 01 00 00       	call   21ee <close>
+  return r;
+    2021:	83 c4 10             	add    $0x10,%esp
+}
+    2024:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2027:	89 f0                	mov    %esi,%eax
+    2029:	5b                   	pop    %ebx
+    202a:	5e                   	pop    %esi
+    202b:	5d                   	pop    %ebp
+    202c:	c3                   	ret
+    202d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    2030:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    2035:	eb ed                	jmp    2024 <stat+0x34>
+    2037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    203e:	66 90                	xchg   %ax,%ax
+
+00002040 <atoi>:
+
+int
+atoi(const char *s)
+{
+    2040:	55                   	push   %ebp
+    2041:	89 e5                	mov    %esp,%ebp
+    2043:	53                   	push   %ebx
+    2044:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    2047:	0f be 02             	movsbl (%edx),%eax
+    204a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    204d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    2050:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    2055:	77 1e                	ja     2075 <atoi+0x35>
+    2057:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    205e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    2060:	83 c2 01             	add    $0x1,%edx
+    2063:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    2066:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    206a:	0f be 02             	movsbl (%edx),%eax
+    206d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    2070:	80 fb 09             	cmp    $0x9,%bl
+    2073:	76 eb                	jbe    2060 <atoi+0x20>
+  return n;
+}
+    2075:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2078:	89 c8                	mov    %ecx,%eax
+    207a:	c9                   	leave
+    207b:	c3                   	ret
+    207c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002080 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    2080:	55                   	push   %ebp
+    2081:	89 e5                	mov    %esp,%ebp
+    2083:	57                   	push   %edi
+    2084:	56                   	push   %esi
+    2085:	8b 45 10             	mov    0x10(%ebp),%eax
+    2088:	8b 55 08             	mov    0x8(%ebp),%edx
+    208b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    208e:	85 c0                	test   %eax,%eax
+    2090:	7e 13                	jle    20a5 <memmove+0x25>
+    2092:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    2094:	89 d7                	mov    %edx,%edi
+    2096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    209d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    20a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    20a1:	39 f8                	cmp    %edi,%eax
+    20a3:	75 fb                	jne    20a0 <memmove+0x20>
+  return vdst;
+}
+    20a5:	5e                   	pop    %esi
+    20a6:	89 d0                	mov    %edx,%eax
+    20a8:	5f                   	pop    %edi
+    20a9:	5d                   	pop    %ebp
+    20aa:	c3                   	ret
+    20ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20af:	90                   	nop
+
+000020b0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    20b0:	55                   	push   %ebp
+    20b1:	89 e5                	mov    %esp,%ebp
+    20b3:	56                   	push   %esi
+    20b4:	53                   	push   %ebx
+    20b5:	8b 75 10             	mov    0x10(%ebp),%esi
+    20b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    20bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    20be:	85 f6                	test   %esi,%esi
+    20c0:	74 2e                	je     20f0 <memcmp+0x40>
+    20c2:	01 c6                	add    %eax,%esi
+    20c4:	eb 14                	jmp    20da <memcmp+0x2a>
+    20c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    20d0:	83 c0 01             	add    $0x1,%eax
+    20d3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    20d6:	39 f0                	cmp    %esi,%eax
+    20d8:	74 16                	je     20f0 <memcmp+0x40>
+    if(*s1 != *s2)
+    20da:	0f b6 0a             	movzbl (%edx),%ecx
+    20dd:	0f b6 18             	movzbl (%eax),%ebx
+    20e0:	38 d9                	cmp    %bl,%cl
+    20e2:	74 ec                	je     20d0 <memcmp+0x20>
+      return *s1 - *s2;
+    20e4:	0f b6 c1             	movzbl %cl,%eax
+    20e7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    20e9:	5b                   	pop    %ebx
+    20ea:	5e                   	pop    %esi
+    20eb:	5d                   	pop    %ebp
+    20ec:	c3                   	ret
+    20ed:	8d 76 00             	lea    0x0(%esi),%esi
+    20f0:	5b                   	pop    %ebx
+  return 0;
+    20f1:	31 c0                	xor    %eax,%eax
+}
+    20f3:	5e                   	pop    %esi
+    20f4:	5d                   	pop    %ebp
+    20f5:	c3                   	ret
+    20f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002100 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    2100:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    2105:	c3                   	ret
+    2106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    210d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002110 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    2110:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    2115:	c3                   	ret
+    2116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    211d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002120 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    2120:	a1 c0 4d 00 00       	mov    0x4dc0,%eax
+    2125:	85 c0                	test   %eax,%eax
+    2127:	74 17                	je     2140 <fork+0x20>
+{
+    2129:	55                   	push   %ebp
+    212a:	89 e5                	mov    %esp,%ebp
+    212c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    212f:	ff d0                	call   *%eax
+  return _fork();
+}
+    2131:	c9                   	leave
+  return _fork();
+    2132:	e9 5d 00 00 00       	jmp    2194 <_fork>
+    2137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    213e:	66 90                	xchg   %ax,%ax
+    2140:	e9 4f 00 00 00       	jmp    2194 <_fork>
+    2145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    214c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002150 <exit>:
+
+int
+exit(void)
+{
+    2150:	55                   	push   %ebp
+    2151:	89 e5                	mov    %esp,%ebp
+    2153:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    2156:	a1 c0 4d 00 00       	mov    0x4dc0,%eax
+    215b:	85 c0                	test   %eax,%eax
+    215d:	74 02                	je     2161 <exit+0x11>
+    flushhook();
+    215f:	ff d0                	call   *%eax
+  _exit();
+    2161:	e8 3d 00 00 00       	call   21a3 <_exit>
+    2166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    216d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002170 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    2170:	55                   	push   %ebp
+  if(flushhook)
+    2171:	a1 c0 4d 00 00       	mov    0x4dc0,%eax
+{
+    2176:	89 e5                	mov    %esp,%ebp
+    2178:	56                   	push   %esi
+    2179:	53                   	push   %ebx
+    217a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    217d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    2180:	85 c0                	test   %eax,%eax
+    2182:	74 02                	je     2186 <exec+0x16>
+    flushhook();
+    2184:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    2186:	89 75 0c             	mov    %esi,0xc(%ebp)
+    2189:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    218c:	5b                   	pop    %ebx
+    218d:	5e                   	pop    %esi
+    218e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    218f:	e9 78 00 00 00       	jmp    220c <_exec>
+
+00002194 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    2194:	b8 01 00 00 00       	mov    $0x1,%eax
+    2199:	89 e1                	mov    %esp,%ecx
+    219b:	ba a2 21 00 00       	mov    $0x21a2,%edx
+    21a0:	0f 34                	sysenter
+    21a2:	c3                   	ret
+
+000021a3 <_exit>:
+RAWSYSCALL(exit)
+    21a3:	b8 02 00 00 00       	mov    $0x2,%eax
+    21a8:	89 e1                	mov    %esp,%ecx
+    21aa:	ba b1 21 00 00       	mov    $0x21b1,%edx
+    21af:	0f 34                	sysenter
+    21b1:	c3                   	ret
+
+000021b2 <wait>:
+SYSCALL(wait)
+    21b2:	b8 03 00 00 00       	mov    $0x3,%eax
+    21b7:	89 e1                	mov    %esp,%ecx
+    21b9:	ba c0 21 00 00       	mov    $0x21c0,%edx
+    21be:	0f 34                	sysenter
+    21c0:	c3                   	ret
+
+000021c1 <pipe>:
+SYSCALL(pipe)
+    21c1:	b8 04 00 00 00       	mov    $0x4,%eax
+    21c6:	89 e1                	mov    %esp,%ecx
+    21c8:	ba cf 21 00 00       	mov    $0x21cf,%edx
+    21cd:	0f 34                	sysenter
+    21cf:	c3                   	ret
+
+000021d0 <read>:
+SYSCALL(read)
+    21d0:	b8 05 00 00 00       	mov    $0x5,%eax
+    21d5:	89 e1                	mov    %esp,%ecx
+    21d7:	ba de 21 00 00       	mov    $0x21de,%edx
+    21dc:	0f 34                	sysenter
+    21de:	c3                   	ret
+
+000021df <write>:
+SYSCALL(write)
+    21df:	b8 10 00 00 00       	mov    $0x10,%eax
+    21e4:	89 e1                	mov    %esp,%ecx
+    21e6:	ba ed 21 00 00       	mov    $0x21ed,%edx
+    21eb:	0f 34                	sysenter
+    21ed:	c3                   	ret
+
+000021ee <close>:
+SYSCALL(close)
+    21ee:	b8 15 00 00 00       	mov    $0x15,%eax
+    21f3:	89 e1                	mov    %esp,%ecx
+    21f5:	ba fc 21 00 00       	mov    $0x21fc,%edx
+    21fa:	0f 34                	sysenter
+    21fc:	c3                   	ret
+
+000021fd <kill>:
+SYSCALL(kill)
+    21fd:	b8 06 00 00 00       	mov    $0x6,%eax
+    2202:	89 e1                	mov    %esp,%ecx
+    2204:	ba 0b 22 00 00       	mov    $0x220b,%edx
+    2209:	0f 34                	sysenter
+    220b:	c3                   	ret
+
+0000220c <_exec>:
+RAWSYSCALL(exec)
+    220c:	b8 07 00 00 00       	mov    $0x7,%eax
+    2211:	89 e1                	mov    %esp,%ecx
+    2213:	ba 1a 22 00 00       	mov    $0x221a,%edx
+    2218:	0f 34                	sysenter
+    221a:	c3                   	ret
+
+0000221b <open>:
+SYSCALL(open)
+    221b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    2220:	89 e1                	mov    %esp,%ecx
+    2222:	ba 29 22 00 00       	mov    $0x2229,%edx
+    2227:	0f 34                	sysenter
+    2229:	c3                   	ret
+
+0000222a <mknod>:
+SYSCALL(mknod)
+    222a:	b8 11 00 00 00       	mov    $0x11,%eax
+    222f:	89 e1                	mov    %esp,%ecx
+    2231:	ba 38 22 00 00       	mov    $0x2238,%edx
+    2236:	0f 34                	sysenter
+    2238:	c3                   	ret
+
+00002239 <unlink>:
+SYSCALL(unlink)
+    2239:	b8 12 00 00 00       	mov    $0x12,%eax
+    223e:	89 e1                	mov    %esp,%ecx
+    2240:	ba 47 22 00 00       	mov    $0x2247,%edx
+    2245:	0f 34                	sysenter
+    2247:	c3                   	ret
+
+00002248 <fstat>:
+SYSCALL(fstat)
+    2248:	b8 08 00 00 00       	mov    $0x8,%eax
+    224d:	89 e1                	mov    %esp,%ecx
+    224f:	ba 56 22 00 00       	mov    $0x2256,%edx
+    2254:	0f 34                	sysenter
+    2256:	c3                   	ret
+
+00002257 <link>:
+SYSCALL(link)
+    2257:	b8 13 00 00 00       	mov    $0x13,%eax
+    225c:	89 e1                	mov    %esp,%ecx
+    225e:	ba 65 22 00 00       	mov    $0x2265,%edx
+    2263:	0f 34                	sysenter
+    2265:	c3                   	ret
+
+00002266 <mkdir>:
+SYSCALL(mkdir)
+    2266:	b8 14 00 00 00       	mov    $0x14,%eax
+    226b:	89 e1                	mov    %esp,%ecx
+    226d:	ba 74 22 00 00       	mov    $0x2274,%edx
+    2272:	0f 34                	sysenter
+    2274:	c3                   	ret
+
+00002275 <chdir>:
+SYSCALL(chdir)
+    2275:	b8 09 00 00 00       	mov    $0x9,%eax
+    227a:	89 e1                	mov    %esp,%ecx
+    227c:	ba 83 22 00 00       	mov    $0x2283,%edx
+    2281:	0f 34                	sysenter
+    2283:	c3                   	ret
+
+00002284 <dup>:
+SYSCALL(dup)
+    2284:	b8 0a 00 00 00       	mov    $0xa,%eax
+    2289:	89 e1                	mov    %esp,%ecx
+    228b:	ba 92 22 00 00       	mov    $0x2292,%edx
+    2290:	0f 34                	sysenter
+    2292:	c3                   	ret
+
+00002293 <getpid>:
+SYSCALL(getpid)
+    2293:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2298:	89 e1                	mov    %esp,%ecx
+    229a:	ba a1 22 00 00       	mov    $0x22a1,%edx
+    229f:	0f 34                	sysenter
+    22a1:	c3                   	ret
+
+000022a2 <sbrk>:
+SYSCALL(sbrk)
+    22a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    22a7:	89 e1                	mov    %esp,%ecx
+    22a9:	ba b0 22 00 00       	mov    $0x22b0,%edx
+    22ae:	0f 34                	sysenter
+    22b0:	c3                   	ret
+
+000022b1 <sleep>:
+SYSCALL(sleep)
+    22b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    22b6:	89 e1                	mov    %esp,%ecx
+    22b8:	ba bf 22 00 00       	mov    $0x22bf,%edx
+    22bd:	0f 34                	sysenter
+    22bf:	c3                   	ret
+
+000022c0 <uptime>:
+SYSCALL(uptime)
+    22c0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    22c5:	89 e1                	mov    %esp,%ecx
+    22c7:	ba ce 22 00 00       	mov    $0x22ce,%edx
+    22cc:	0f 34                	sysenter
+    22ce:	c3                   	ret
+
+000022cf <mprotect>:
+SYSCALL(mprotect)
+    22cf:	b8 16 00 00 00       	mov    $0x16,%eax
+    22d4:	89 e1                	mov    %esp,%ecx
+    22d6:	ba dd 22 00 00       	mov    $0x22dd,%edx
+    22db:	0f 34                	sysenter
+    22dd:	c3                   	ret
+
+000022de <munprotect>:
+SYSCALL(munprotect)
+    22de:	b8 17 00 00 00       	mov    $0x17,%eax
+    22e3:	89 e1                	mov    %esp,%ecx
+    22e5:	ba ec 22 00 00       	mov    $0x22ec,%edx
+    22ea:	0f 34                	sysenter
+    22ec:	c3                   	ret
+
+000022ed <kstat>:
+SYSCALL(kstat)
+    22ed:	b8 18 00 00 00       	mov    $0x18,%eax
+    22f2:	89 e1                	mov    %esp,%ecx
+    22f4:	ba fb 22 00 00       	mov    $0x22fb,%edx
+    22f9:	0f 34                	sysenter
+    22fb:	c3                   	ret
+
+000022fc <fcntl>:
+SYSCALL(fcntl)
+    22fc:	b8 19 00 00 00       	mov    $0x19,%eax
+    2301:	89 e1                	mov    %esp,%ecx
+    2303:	ba 0a 23 00 00       	mov    $0x230a,%edx
+    2308:	0f 34                	sysenter
+    230a:	c3                   	ret
+
+0000230b <splice>:
+SYSCALL(splice)
+    230b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    2310:	89 e1                	mov    %esp,%ecx
+    2312:	ba 19 23 00 00       	mov    $0x2319,%edx
+    2317:	0f 34                	sysenter
+    2319:	c3                   	ret
+
+0000231a <sendfile>:
+SYSCALL(sendfile)
+    231a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    231f:	89 e1                	mov    %esp,%ecx
+    2321:	ba 28 23 00 00       	mov    $0x2328,%edx
+    2326:	0f 34                	sysenter
+    2328:	c3                   	ret
+
+00002329 <lseek>:
+SYSCALL(lseek)
+    2329:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    232e:	89 e1                	mov    %esp,%ecx
+    2330:	ba 37 23 00 00       	mov    $0x2337,%edx
+    2335:	0f 34                	sysenter
+    2337:	c3                   	ret
+
+00002338 <pread>:
+SYSCALL(pread)
+    2338:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    233d:	89 e1                	mov    %esp,%ecx
+    233f:	ba 46 23 00 00       	mov    $0x2346,%edx
+    2344:	0f 34                	sysenter
+    2346:	c3                   	ret
+
+00002347 <pwrite>:
+SYSCALL(pwrite)
+    2347:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    234c:	89 e1                	mov    %esp,%ecx
+    234e:	ba 55 23 00 00       	mov    $0x2355,%edx
+    2353:	0f 34                	sysenter
+    2355:	c3                   	ret
+
+00002356 <readv>:
+SYSCALL(readv)
+    2356:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    235b:	89 e1                	mov    %esp,%ecx
+    235d:	ba 64 23 00 00       	mov    $0x2364,%edx
+    2362:	0f 34                	sysenter
+    2364:	c3                   	ret
+
+00002365 <writev>:
+SYSCALL(writev)
+    2365:	b8 20 00 00 00       	mov    $0x20,%eax
+    236a:	89 e1                	mov    %esp,%ecx
+    236c:	ba 73 23 00 00       	mov    $0x2373,%edx
+    2371:	0f 34                	sysenter
+    2373:	c3                   	ret
+
+00002374 <ringsetup>:
+SYSCALL(ringsetup)
+    2374:	b8 21 00 00 00       	mov    $0x21,%eax
+    2379:	89 e1                	mov    %esp,%ecx
+    237b:	ba 82 23 00 00       	mov    $0x2382,%edx
+    2380:	0f 34                	sysenter
+    2382:	c3                   	ret
+
+00002383 <ringenter>:
+SYSCALL(ringenter)
+    2383:	b8 22 00 00 00       	mov    $0x22,%eax
+    2388:	89 e1                	mov    %esp,%ecx
+    238a:	ba 91 23 00 00       	mov    $0x2391,%edx
+    238f:	0f 34                	sysenter
+    2391:	c3                   	ret
+
+00002392 <intgetpid>:
+INTSYSCALL(getpid)
+    2392:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2397:	cd 40                	int    $0x40
+    2399:	c3                   	ret
+    239a:	66 90                	xchg   %ax,%ax
+    239c:	66 90                	xchg   %ax,%ax
+    239e:	66 90                	xchg   %ax,%ax
+
+000023a0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    23a0:	55                   	push   %ebp
+    23a1:	89 e5                	mov    %esp,%ebp
+    23a3:	57                   	push   %edi
+    23a4:	56                   	push   %esi
+    23a5:	53                   	push   %ebx
+    23a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    23a8:	89 d1                	mov    %edx,%ecx
+{
+    23aa:	83 ec 2c             	sub    $0x2c,%esp
+    23ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    23b0:	85 d2                	test   %edx,%edx
+    23b2:	0f 89 c0 00 00 00    	jns    2478 <printint+0xd8>
+    23b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    23bc:	0f 84 b6 00 00 00    	je     2478 <printint+0xd8>
+    x = -xx;
+    23c2:	f7 d9                	neg    %ecx
+    neg = 1;
+    23c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    23c9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    23cc:	31 f6                	xor    %esi,%esi
+    23ce:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    23d0:	89 c8                	mov    %ecx,%eax
+    23d2:	31 d2                	xor    %edx,%edx
+    23d4:	89 f7                	mov    %esi,%edi
+    23d6:	f7 f3                	div    %ebx
+    23d8:	8d 76 01             	lea    0x1(%esi),%esi
+    23db:	0f b6 92 70 33 00 00 	movzbl 0x3370(%edx),%edx
+    23e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    23e6:	89 ca                	mov    %ecx,%edx
+    23e8:	89 c1                	mov    %eax,%ecx
+    23ea:	39 da                	cmp    %ebx,%edx
+    23ec:	73 e2                	jae    23d0 <printint+0x30>
+  if(neg)
+    23ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    23f1:	85 c0                	test   %eax,%eax
+    23f3:	74 07                	je     23fc <printint+0x5c>
+    buf[i++] = '-';
+    23f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    23fa:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    23fc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    23ff:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    2402:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    2404:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    2407:	8b 41 08             	mov    0x8(%ecx),%eax
+    240a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    240d:	89 ce                	mov    %ecx,%esi
+    240f:	eb 1c                	jmp    242d <printint+0x8d>
+    2411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    2418:	89 c1                	mov    %eax,%ecx
+    241a:	83 c0 01             	add    $0x1,%eax
+    241d:	89 46 08             	mov    %eax,0x8(%esi)
+    2420:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    2424:	8d 57 ff             	lea    -0x1(%edi),%edx
+    2427:	39 df                	cmp    %ebx,%edi
+    2429:	74 41                	je     246c <printint+0xcc>
+    242b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    242d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    2430:	3d 80 00 00 00       	cmp    $0x80,%eax
+    2435:	75 e1                	jne    2418 <printint+0x78>
+  if(o->f)
+    2437:	8b 06                	mov    (%esi),%eax
+    2439:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    243c:	85 c0                	test   %eax,%eax
+    243e:	74 40                	je     2480 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    2440:	50                   	push   %eax
+    2441:	68 80 00 00 00       	push   $0x80
+    2446:	6a 01                	push   $0x1
+    2448:	ff 75 d4             	push   -0x2c(%ebp)
+    244b:	e8 a0 04 00 00       	call   28f0 <fwrite>
+    2450:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    2454:	83 c4 10             	add    $0x10,%esp
+}
+    2457:	b8 01 00 00 00       	mov    $0x1,%eax
+    245c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    245e:	89 46 08             	mov    %eax,0x8(%esi)
+    2461:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    2465:	8d 57 ff             	lea    -0x1(%edi),%edx
+    2468:	39 df                	cmp    %ebx,%edi
+    246a:	75 bf                	jne    242b <printint+0x8b>
+}
+    246c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    246f:	5b                   	pop    %ebx
+    2470:	5e                   	pop    %esi
+    2471:	5f                   	pop    %edi
+    2472:	5d                   	pop    %ebp
+    2473:	c3                   	ret
+    2474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    2478:	31 c0                	xor    %eax,%eax
+    247a:	e9 4a ff ff ff       	jmp    23c9 <printint+0x29>
+    247f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    2480:	83 ec 04             	sub    $0x4,%esp
+    2483:	68 80 00 00 00       	push   $0x80
+    2488:	ff 75 d4             	push   -0x2c(%ebp)
+    248b:	ff 76 04             	push   0x4(%esi)
+    248e:	e8 4c fd ff ff       	call   21df <write>
+    2493:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    2497:	83 c4 10             	add    $0x10,%esp
+    249a:	eb bb                	jmp    2457 <printint+0xb7>
+    249c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000024a0 <putc>:
+{
+    24a0:	55                   	push   %ebp
+    24a1:	89 e5                	mov    %esp,%ebp
+    24a3:	56                   	push   %esi
+    24a4:	89 d6                	mov    %edx,%esi
+    24a6:	53                   	push   %ebx
+    24a7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    24a9:	8b 40 08             	mov    0x8(%eax),%eax
+    24ac:	3d 80 00 00 00       	cmp    $0x80,%eax
+    24b1:	74 1d                	je     24d0 <putc+0x30>
+  o->buf[o->n++] = c;
+    24b3:	89 f1                	mov    %esi,%ecx
+    24b5:	8d 50 01             	lea    0x1(%eax),%edx
+    24b8:	89 53 08             	mov    %edx,0x8(%ebx)
+    24bb:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    24bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    24c2:	5b                   	pop    %ebx
+    24c3:	5e                   	pop    %esi
+    24c4:	5d                   	pop    %ebp
+    24c5:	c3                   	ret
+    24c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24cd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    24d0:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    24d2:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    24d5:	85 c0                	test   %eax,%eax
+    24d7:	74 2f                	je     2508 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    24d9:	50                   	push   %eax
+    24da:	68 80 00 00 00       	push   $0x80
+    24df:	6a 01                	push   $0x1
+    24e1:	52                   	push   %edx
+    24e2:	e8 09 04 00 00       	call   28f0 <fwrite>
+    24e7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    24ea:	89 f1                	mov    %esi,%ecx
+}
+    24ec:	ba 01 00 00 00       	mov    $0x1,%edx
+    24f1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    24f3:	89 53 08             	mov    %edx,0x8(%ebx)
+    24f6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    24fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    24fd:	5b                   	pop    %ebx
+    24fe:	5e                   	pop    %esi
+    24ff:	5d                   	pop    %ebp
+    2500:	c3                   	ret
+    2501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    2508:	83 ec 04             	sub    $0x4,%esp
+    250b:	68 80 00 00 00       	push   $0x80
+    2510:	52                   	push   %edx
+    2511:	ff 73 04             	push   0x4(%ebx)
+    2514:	e8 c6 fc ff ff       	call   21df <write>
+    2519:	83 c4 10             	add    $0x10,%esp
+    251c:	eb cc                	jmp    24ea <putc+0x4a>
+    251e:	66 90                	xchg   %ax,%ax
+
+00002520 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    2520:	55                   	push   %ebp
+    2521:	89 e5                	mov    %esp,%ebp
+    2523:	57                   	push   %edi
+    2524:	89 c7                	mov    %eax,%edi
+    2526:	56                   	push   %esi
+    2527:	31 f6                	xor    %esi,%esi
+    2529:	53                   	push   %ebx
+    252a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    252d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    2530:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    2533:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    2536:	84 c0                	test   %al,%al
+    2538:	75 1e                	jne    2558 <vprintf.constprop.0+0x38>
+    253a:	eb 53                	jmp    258f <vprintf.constprop.0+0x6f>
+    253c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    2540:	83 f8 25             	cmp    $0x25,%eax
+    2543:	74 3b                	je     2580 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    2545:	89 ca                	mov    %ecx,%edx
+    2547:	89 f8                	mov    %edi,%eax
+    2549:	e8 52 ff ff ff       	call   24a0 <putc>
+  for(i = 0; fmt[i]; i++){
+    254e:	0f b6 03             	movzbl (%ebx),%eax
+    2551:	83 c3 01             	add    $0x1,%ebx
+    2554:	84 c0                	test   %al,%al
+    2556:	74 37                	je     258f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    2558:	0f be c8             	movsbl %al,%ecx
+    255b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    255e:	85 f6                	test   %esi,%esi
+    2560:	74 de                	je     2540 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    2562:	83 fe 25             	cmp    $0x25,%esi
+    2565:	75 e7                	jne    254e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    2567:	83 f8 25             	cmp    $0x25,%eax
+    256a:	74 4e                	je     25ba <vprintf.constprop.0+0x9a>
+    256c:	83 e8 63             	sub    $0x63,%eax
+    256f:	83 f8 15             	cmp    $0x15,%eax
+    2572:	77 34                	ja     25a8 <vprintf.constprop.0+0x88>
+    2574:	ff 24 85 18 33 00 00 	jmp    *0x3318(,%eax,4)
+    257b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    257f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    2580:	0f b6 03             	movzbl (%ebx),%eax
+    2583:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    2586:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    258b:	84 c0                	test   %al,%al
+    258d:	75 c9                	jne    2558 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    258f:	8b 47 08             	mov    0x8(%edi),%eax
+    2592:	85 c0                	test   %eax,%eax
+    2594:	0f 8f de 00 00 00    	jg     2678 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    259a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    259d:	5b                   	pop    %ebx
+    259e:	5e                   	pop    %esi
+    259f:	5f                   	pop    %edi
+    25a0:	5d                   	pop    %ebp
+    25a1:	c3                   	ret
+    25a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    25a8:	ba 25 00 00 00       	mov    $0x25,%edx
+    25ad:	89 f8                	mov    %edi,%eax
+    25af:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    25b2:	e8 e9 fe ff ff       	call   24a0 <putc>
+        putc(o, c);
+    25b7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    25ba:	89 ca                	mov    %ecx,%edx
+    25bc:	89 f8                	mov    %edi,%eax
+      state = 0;
+    25be:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    25c0:	e8 db fe ff ff       	call   24a0 <putc>
+    25c5:	eb 87                	jmp    254e <vprintf.constprop.0+0x2e>
+    25c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25ce:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    25d0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    25d3:	83 ec 0c             	sub    $0xc,%esp
+    25d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    25db:	8b 16                	mov    (%esi),%edx
+    25dd:	6a 00                	push   $0x0
+        ap++;
+    25df:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    25e2:	89 f8                	mov    %edi,%eax
+    25e4:	e8 b7 fd ff ff       	call   23a0 <printint>
+        ap++;
+    25e9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    25ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    25ef:	31 f6                	xor    %esi,%esi
+    25f1:	e9 58 ff ff ff       	jmp    254e <vprintf.constprop.0+0x2e>
+    25f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    2600:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2603:	8b 30                	mov    (%eax),%esi
+        ap++;
+    2605:	83 c0 04             	add    $0x4,%eax
+    2608:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    260b:	85 f6                	test   %esi,%esi
+    260d:	75 1b                	jne    262a <vprintf.constprop.0+0x10a>
+    260f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    2614:	be 11 33 00 00       	mov    $0x3311,%esi
+    2619:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    2620:	89 f8                	mov    %edi,%eax
+          s++;
+    2622:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    2625:	e8 76 fe ff ff       	call   24a0 <putc>
+        while(*s != 0){
+    262a:	0f be 16             	movsbl (%esi),%edx
+    262d:	84 d2                	test   %dl,%dl
+    262f:	75 ef                	jne    2620 <vprintf.constprop.0+0x100>
+      state = 0;
+    2631:	31 f6                	xor    %esi,%esi
+    2633:	e9 16 ff ff ff       	jmp    254e <vprintf.constprop.0+0x2e>
+    2638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    263f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    2640:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    2643:	83 ec 0c             	sub    $0xc,%esp
+    2646:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    264b:	8b 16                	mov    (%esi),%edx
+    264d:	6a 01                	push   $0x1
+    264f:	eb 8e                	jmp    25df <vprintf.constprop.0+0xbf>
+    2651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    2658:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    265b:	89 f8                	mov    %edi,%eax
+    265d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    2660:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    2663:	e8 38 fe ff ff       	call   24a0 <putc>
+        ap++;
+    2668:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    266b:	31 f6                	xor    %esi,%esi
+    266d:	e9 dc fe ff ff       	jmp    254e <vprintf.constprop.0+0x2e>
+    2672:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    2678:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    267a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    267d:	85 d2                	test   %edx,%edx
+    267f:	74 1f                	je     26a0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    2681:	52                   	push   %edx
+    2682:	50                   	push   %eax
+    2683:	6a 01                	push   $0x1
+    2685:	51                   	push   %ecx
+    2686:	e8 65 02 00 00       	call   28f0 <fwrite>
+    268b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    268e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    2695:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2698:	5b                   	pop    %ebx
+    2699:	5e                   	pop    %esi
+    269a:	5f                   	pop    %edi
+    269b:	5d                   	pop    %ebp
+    269c:	c3                   	ret
+    269d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    26a0:	83 ec 04             	sub    $0x4,%esp
+    26a3:	50                   	push   %eax
+    26a4:	51                   	push   %ecx
+    26a5:	ff 77 04             	push   0x4(%edi)
+    26a8:	e8 32 fb ff ff       	call   21df <write>
+    26ad:	83 c4 10             	add    $0x10,%esp
+    26b0:	eb dc                	jmp    268e <vprintf.constprop.0+0x16e>
+    26b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000026c0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    26c0:	55                   	push   %ebp
+    26c1:	89 e5                	mov    %esp,%ebp
+    26c3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    26c9:	a1 64 3b 00 00       	mov    0x3b64,%eax
+{
+    26ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    26d1:	83 fa 01             	cmp    $0x1,%edx
+    26d4:	74 0c                	je     26e2 <printf+0x22>
+    26d6:	31 c0                	xor    %eax,%eax
+    26d8:	83 fa 02             	cmp    $0x2,%edx
+    26db:	0f 44 05 60 3b 00 00 	cmove  0x3b60,%eax
+  o.fd = fd;
+    26e2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    26e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    26eb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    26ee:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    26f4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    26fa:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    2701:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    2704:	e8 17 fe ff ff       	call   2520 <vprintf.constprop.0>
+}
+    2709:	c9                   	leave
+    270a:	c3                   	ret
+    270b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    270f:	90                   	nop
+
+00002710 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    2710:	55                   	push   %ebp
+    2711:	89 e5                	mov    %esp,%ebp
+    2713:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    2719:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    271c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    271f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    2722:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    2729:	ff ff ff 
+  o.n = 0;
+    272c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    2733:	00 00 00 
+  o.f = f;
+    2736:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    273c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    2742:	e8 d9 fd ff ff       	call   2520 <vprintf.constprop.0>
+}
+    2747:	c9                   	leave
+    2748:	c3                   	ret
+    2749:	66 90                	xchg   %ax,%ax
+    274b:	66 90                	xchg   %ax,%ax
+    274d:	66 90                	xchg   %ax,%ax
+    274f:	90                   	nop
+
+00002750 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    2750:	55                   	push   %ebp
+    2751:	89 e5                	mov    %esp,%ebp
+    2753:	53                   	push   %ebx
+    2754:	89 c3                	mov    %eax,%ebx
+    2756:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    2759:	8b 40 0c             	mov    0xc(%eax),%eax
+    275c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    275f:	74 17                	je     2778 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    2761:	83 f8 02             	cmp    $0x2,%eax
+    2764:	74 07                	je     276d <setmode+0x1d>
+    2766:	8b 43 18             	mov    0x18(%ebx),%eax
+    2769:	85 c0                	test   %eax,%eax
+    276b:	74 38                	je     27a5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    276d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2770:	c9                   	leave
+    2771:	c3                   	ret
+    2772:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    2778:	83 ec 08             	sub    $0x8,%esp
+    277b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    277e:	50                   	push   %eax
+    277f:	ff 33                	push   (%ebx)
+    2781:	e8 c2 fa ff ff       	call   2248 <fstat>
+    2786:	83 c4 10             	add    $0x10,%esp
+    2789:	89 c2                	mov    %eax,%edx
+    278b:	31 c0                	xor    %eax,%eax
+    278d:	85 d2                	test   %edx,%edx
+    278f:	75 0a                	jne    279b <setmode+0x4b>
+    2791:	31 c0                	xor    %eax,%eax
+    2793:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    2798:	0f 94 c0             	sete   %al
+    279b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    279e:	8b 43 18             	mov    0x18(%ebx),%eax
+    27a1:	85 c0                	test   %eax,%eax
+    27a3:	75 c8                	jne    276d <setmode+0x1d>
+    27a5:	83 ec 0c             	sub    $0xc,%esp
+    27a8:	68 00 04 00 00       	push   $0x400
+    27ad:	e8 de 07 00 00       	call   2f90 <malloc>
+    27b2:	83 c4 10             	add    $0x10,%esp
+    27b5:	89 43 18             	mov    %eax,0x18(%ebx)
+    27b8:	85 c0                	test   %eax,%eax
+    27ba:	75 b1                	jne    276d <setmode+0x1d>
+    f->mode = IONBF;
+    27bc:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    27c3:	eb a8                	jmp    276d <setmode+0x1d>
+    27c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000027d0 <drain>:
+{
+    27d0:	55                   	push   %ebp
+    27d1:	89 e5                	mov    %esp,%ebp
+    27d3:	57                   	push   %edi
+    27d4:	56                   	push   %esi
+    27d5:	53                   	push   %ebx
+    27d6:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    27d9:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    27dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    27df:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    27e6:	85 ff                	test   %edi,%edi
+    27e8:	7f 0e                	jg     27f8 <drain+0x28>
+  return 0;
+    27ea:	31 c0                	xor    %eax,%eax
+}
+    27ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    27ef:	5b                   	pop    %ebx
+    27f0:	5e                   	pop    %esi
+    27f1:	5f                   	pop    %edi
+    27f2:	5d                   	pop    %ebp
+    27f3:	c3                   	ret
+    27f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    27f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    27fb:	8b 58 18             	mov    0x18(%eax),%ebx
+    27fe:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    2800:	eb 0e                	jmp    2810 <drain+0x40>
+    2802:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    2808:	29 c7                	sub    %eax,%edi
+    280a:	01 c3                	add    %eax,%ebx
+    280c:	85 ff                	test   %edi,%edi
+    280e:	7e da                	jle    27ea <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    2810:	83 ec 04             	sub    $0x4,%esp
+    2813:	57                   	push   %edi
+    2814:	53                   	push   %ebx
+    2815:	56                   	push   %esi
+    2816:	e8 c4 f9 ff ff       	call   21df <write>
+    281b:	83 c4 10             	add    $0x10,%esp
+    281e:	85 c0                	test   %eax,%eax
+    2820:	7f e6                	jg     2808 <drain+0x38>
+    f->err = 1;
+    2822:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2825:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    282c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2831:	eb b9                	jmp    27ec <drain+0x1c>
+    2833:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    283a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002840 <flushall>:
+
+static void
+flushall(void)
+{
+    2840:	55                   	push   %ebp
+    2841:	89 e5                	mov    %esp,%ebp
+    2843:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    2844:	bb 80 3b 00 00       	mov    $0x3b80,%ebx
+{
+    2849:	83 ec 04             	sub    $0x4,%esp
+    284c:	eb 0d                	jmp    285b <flushall+0x1b>
+    284e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    2850:	83 c3 24             	add    $0x24,%ebx
+    2853:	81 fb c0 3d 00 00    	cmp    $0x3dc0,%ebx
+    2859:	74 19                	je     2874 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    285b:	8b 43 08             	mov    0x8(%ebx),%eax
+    285e:	85 c0                	test   %eax,%eax
+    2860:	74 ee                	je     2850 <flushall+0x10>
+    2862:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    2864:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    2867:	e8 64 ff ff ff       	call   27d0 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    286c:	81 fb c0 3d 00 00    	cmp    $0x3dc0,%ebx
+    2872:	75 e7                	jne    285b <flushall+0x1b>
+}
+    2874:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2877:	c9                   	leave
+    2878:	c3                   	ret
+    2879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002880 <fflush>:
+{
+    2880:	55                   	push   %ebp
+    2881:	89 e5                	mov    %esp,%ebp
+    2883:	57                   	push   %edi
+    2884:	56                   	push   %esi
+    2885:	53                   	push   %ebx
+    2886:	83 ec 0c             	sub    $0xc,%esp
+    2889:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    288c:	85 c0                	test   %eax,%eax
+    288e:	74 28                	je     28b8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    2890:	8b 70 08             	mov    0x8(%eax),%esi
+    2893:	85 f6                	test   %esi,%esi
+    2895:	75 11                	jne    28a8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    2897:	83 c4 0c             	add    $0xc,%esp
+    289a:	89 f0                	mov    %esi,%eax
+    289c:	5b                   	pop    %ebx
+    289d:	5e                   	pop    %esi
+    289e:	5f                   	pop    %edi
+    289f:	5d                   	pop    %ebp
+    28a0:	c3                   	ret
+    28a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28a8:	83 c4 0c             	add    $0xc,%esp
+    28ab:	5b                   	pop    %ebx
+    28ac:	5e                   	pop    %esi
+    28ad:	5f                   	pop    %edi
+    28ae:	5d                   	pop    %ebp
+  return drain(f);
+    28af:	e9 1c ff ff ff       	jmp    27d0 <drain>
+    28b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    28b8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    28ba:	bb 80 3b 00 00       	mov    $0x3b80,%ebx
+        r = -1;
+    28bf:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    28c4:	eb 15                	jmp    28db <fflush+0x5b>
+    28c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28cd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    28d0:	83 c3 24             	add    $0x24,%ebx
+    28d3:	81 fb c0 3d 00 00    	cmp    $0x3dc0,%ebx
+    28d9:	74 bc                	je     2897 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    28db:	8b 43 08             	mov    0x8(%ebx),%eax
+    28de:	85 c0                	test   %eax,%eax
+    28e0:	74 ee                	je     28d0 <fflush+0x50>
+    28e2:	89 d8                	mov    %ebx,%eax
+    28e4:	e8 e7 fe ff ff       	call   27d0 <drain>
+        r = -1;
+    28e9:	85 c0                	test   %eax,%eax
+    28eb:	0f 48 f7             	cmovs  %edi,%esi
+    28ee:	eb e0                	jmp    28d0 <fflush+0x50>
+
+000028f0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    28f0:	55                   	push   %ebp
+    28f1:	89 e5                	mov    %esp,%ebp
+    28f3:	57                   	push   %edi
+    28f4:	56                   	push   %esi
+    28f5:	53                   	push   %ebx
+    28f6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    28f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    28fc:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    2900:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    2903:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    2906:	85 d2                	test   %edx,%edx
+    2908:	0f 8e 26 01 00 00    	jle    2a34 <fwrite+0x144>
+  if(!f->writable){
+    290e:	8b 46 08             	mov    0x8(%esi),%eax
+    2911:	85 c0                	test   %eax,%eax
+    2913:	0f 84 14 01 00 00    	je     2a2d <fwrite+0x13d>
+  setmode(f);
+    2919:	89 f0                	mov    %esi,%eax
+    291b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    291e:	e8 2d fe ff ff       	call   2750 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    2923:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    2927:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    292a:	c7 05 c0 4d 00 00 40 	movl   $0x2840,0x4dc0
+    2931:	28 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    2934:	0f 84 b6 00 00 00    	je     29f0 <fwrite+0x100>
+    293a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    2940:	0f 8f aa 00 00 00    	jg     29f0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    2946:	8b 46 20             	mov    0x20(%esi),%eax
+    2949:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    294c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    294e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    2953:	74 6c                	je     29c1 <fwrite+0xd1>
+    2955:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    2958:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    295b:	ba 00 04 00 00       	mov    $0x400,%edx
+    2960:	29 c2                	sub    %eax,%edx
+    2962:	39 ca                	cmp    %ecx,%edx
+    2964:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    2967:	85 d2                	test   %edx,%edx
+    2969:	0f 8e d1 00 00 00    	jle    2a40 <fwrite+0x150>
+    296f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    2972:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    2975:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    2978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    297f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    2980:	8d 50 01             	lea    0x1(%eax),%edx
+    2983:	83 c3 01             	add    $0x1,%ebx
+    2986:	8b 4e 18             	mov    0x18(%esi),%ecx
+    2989:	89 56 20             	mov    %edx,0x20(%esi)
+    298c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    2990:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    2993:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    2996:	b8 01 00 00 00       	mov    $0x1,%eax
+    299b:	80 fa 0a             	cmp    $0xa,%dl
+    299e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    29a1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    29a4:	39 cb                	cmp    %ecx,%ebx
+    29a6:	75 d8                	jne    2980 <fwrite+0x90>
+    29a8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    29ab:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    29ae:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    29b1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    29b4:	85 db                	test   %ebx,%ebx
+    29b6:	7e 19                	jle    29d1 <fwrite+0xe1>
+    n -= k;
+    29b8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    29ba:	3d 00 04 00 00       	cmp    $0x400,%eax
+    29bf:	75 97                	jne    2958 <fwrite+0x68>
+    29c1:	89 f0                	mov    %esi,%eax
+    29c3:	e8 08 fe ff ff       	call   27d0 <drain>
+    29c8:	85 c0                	test   %eax,%eax
+    29ca:	78 68                	js     2a34 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    29cc:	8b 46 20             	mov    0x20(%esi),%eax
+    29cf:	eb 87                	jmp    2958 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    29d1:	3d 00 04 00 00       	cmp    $0x400,%eax
+    29d6:	74 74                	je     2a4c <fwrite+0x15c>
+    29d8:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    29dc:	75 04                	jne    29e2 <fwrite+0xf2>
+    29de:	85 ff                	test   %edi,%edi
+    29e0:	75 6a                	jne    2a4c <fwrite+0x15c>
+    return nmemb;
+    29e2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    29e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    29e8:	5b                   	pop    %ebx
+    29e9:	5e                   	pop    %esi
+    29ea:	5f                   	pop    %edi
+    29eb:	5d                   	pop    %ebp
+    29ec:	c3                   	ret
+    29ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    29f0:	89 f0                	mov    %esi,%eax
+    29f2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    29f5:	e8 d6 fd ff ff       	call   27d0 <drain>
+    29fa:	85 c0                	test   %eax,%eax
+    29fc:	78 2f                	js     2a2d <fwrite+0x13d>
+    29fe:	89 75 14             	mov    %esi,0x14(%ebp)
+    2a01:	8b 3e                	mov    (%esi),%edi
+    2a03:	89 de                	mov    %ebx,%esi
+    2a05:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    2a08:	eb 0e                	jmp    2a18 <fwrite+0x128>
+    2a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    2a10:	29 c3                	sub    %eax,%ebx
+    2a12:	01 c6                	add    %eax,%esi
+    2a14:	85 db                	test   %ebx,%ebx
+    2a16:	7e ca                	jle    29e2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    2a18:	83 ec 04             	sub    $0x4,%esp
+    2a1b:	53                   	push   %ebx
+    2a1c:	56                   	push   %esi
+    2a1d:	57                   	push   %edi
+    2a1e:	e8 bc f7 ff ff       	call   21df <write>
+    2a23:	83 c4 10             	add    $0x10,%esp
+    2a26:	85 c0                	test   %eax,%eax
+    2a28:	7f e6                	jg     2a10 <fwrite+0x120>
+    2a2a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    2a2d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    2a34:	31 c0                	xor    %eax,%eax
+}
+    2a36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2a39:	5b                   	pop    %ebx
+    2a3a:	5e                   	pop    %esi
+    2a3b:	5f                   	pop    %edi
+    2a3c:	5d                   	pop    %ebp
+    2a3d:	c3                   	ret
+    2a3e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    2a40:	89 d9                	mov    %ebx,%ecx
+    2a42:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    2a45:	89 cb                	mov    %ecx,%ebx
+    2a47:	e9 6e ff ff ff       	jmp    29ba <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    2a4c:	89 f0                	mov    %esi,%eax
+    2a4e:	e8 7d fd ff ff       	call   27d0 <drain>
+    2a53:	85 c0                	test   %eax,%eax
+    2a55:	79 8b                	jns    29e2 <fwrite+0xf2>
+    return 0;
+    2a57:	31 c0                	xor    %eax,%eax
+    2a59:	eb db                	jmp    2a36 <fwrite+0x146>
+    2a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2a5f:	90                   	nop
+
+00002a60 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    2a60:	55                   	push   %ebp
+    2a61:	89 e5                	mov    %esp,%ebp
+    2a63:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    2a66:	8b 45 08             	mov    0x8(%ebp),%eax
+    2a69:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    2a6c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    2a6f:	ff 75 0c             	push   0xc(%ebp)
+    2a72:	6a 01                	push   $0x1
+    2a74:	6a 01                	push   $0x1
+    2a76:	50                   	push   %eax
+    2a77:	e8 74 fe ff ff       	call   28f0 <fwrite>
+    2a7c:	83 c4 10             	add    $0x10,%esp
+    2a7f:	83 f8 01             	cmp    $0x1,%eax
+    2a82:	75 0c                	jne    2a90 <fputc+0x30>
+    2a84:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2a88:	c9                   	leave
+    2a89:	c3                   	ret
+    2a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    2a90:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    2a91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    2a96:	c3                   	ret
+    2a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a9e:	66 90                	xchg   %ax,%ax
+
+00002aa0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    2aa0:	55                   	push   %ebp
+    2aa1:	89 e5                	mov    %esp,%ebp
+    2aa3:	57                   	push   %edi
+    2aa4:	56                   	push   %esi
+    2aa5:	53                   	push   %ebx
+    2aa6:	83 ec 1c             	sub    $0x1c,%esp
+    2aa9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    2aac:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    2aaf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    2ab2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    2ab5:	85 d2                	test   %edx,%edx
+    2ab7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    2aba:	7e 12                	jle    2ace <fread+0x2e>
+    2abc:	85 ff                	test   %edi,%edi
+    2abe:	7e 0e                	jle    2ace <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    2ac0:	8b 43 04             	mov    0x4(%ebx),%eax
+    2ac3:	85 c0                	test   %eax,%eax
+    2ac5:	75 19                	jne    2ae0 <fread+0x40>
+    f->err = 1;
+    2ac7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    2ace:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    2ad1:	31 c0                	xor    %eax,%eax
+}
+    2ad3:	5b                   	pop    %ebx
+    2ad4:	5e                   	pop    %esi
+    2ad5:	5f                   	pop    %edi
+    2ad6:	5d                   	pop    %ebp
+    2ad7:	c3                   	ret
+    2ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2adf:	90                   	nop
+  setmode(f);
+    2ae0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    2ae2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    2ae4:	e8 67 fc ff ff       	call   2750 <setmode>
+  for(n = 0; n < want; n += k){
+    2ae9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    2aec:	89 f7                	mov    %esi,%edi
+    2aee:	eb 31                	jmp    2b21 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    2af0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    2af4:	74 08                	je     2afe <fread+0x5e>
+    2af6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    2afc:	7e 62                	jle    2b60 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    2afe:	83 ec 04             	sub    $0x4,%esp
+    2b01:	56                   	push   %esi
+    2b02:	8b 45 08             	mov    0x8(%ebp),%eax
+    2b05:	01 f8                	add    %edi,%eax
+    2b07:	50                   	push   %eax
+    2b08:	ff 33                	push   (%ebx)
+    2b0a:	e8 c1 f6 ff ff       	call   21d0 <read>
+    2b0f:	83 c4 10             	add    $0x10,%esp
+    2b12:	85 c0                	test   %eax,%eax
+    2b14:	0f 8e ce 00 00 00    	jle    2be8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    2b1a:	01 c7                	add    %eax,%edi
+    2b1c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    2b1f:	7e 36                	jle    2b57 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2b21:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    2b24:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    2b27:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2b2a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    2b2c:	39 c1                	cmp    %eax,%ecx
+    2b2e:	7d c0                	jge    2af0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2b30:	29 c8                	sub    %ecx,%eax
+    2b32:	39 f0                	cmp    %esi,%eax
+    2b34:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    2b37:	83 ec 04             	sub    $0x4,%esp
+    2b3a:	56                   	push   %esi
+    2b3b:	03 4b 18             	add    0x18(%ebx),%ecx
+    2b3e:	51                   	push   %ecx
+    2b3f:	8b 45 08             	mov    0x8(%ebp),%eax
+    2b42:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    2b44:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    2b46:	50                   	push   %eax
+    2b47:	e8 34 f5 ff ff       	call   2080 <memmove>
+      f->r += k;
+    2b4c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    2b4f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    2b52:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    2b55:	7f ca                	jg     2b21 <fread+0x81>
+    2b57:	89 fe                	mov    %edi,%esi
+    2b59:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2b5c:	eb 3f                	jmp    2b9d <fread+0xfd>
+    2b5e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    2b60:	3b 1d 68 3b 00 00    	cmp    0x3b68,%ebx
+    2b66:	74 68                	je     2bd0 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    2b68:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    2b6b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    2b72:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    2b79:	68 00 04 00 00       	push   $0x400
+    2b7e:	ff 73 18             	push   0x18(%ebx)
+    2b81:	ff 33                	push   (%ebx)
+    2b83:	e8 48 f6 ff ff       	call   21d0 <read>
+    2b88:	83 c4 10             	add    $0x10,%esp
+    2b8b:	85 c0                	test   %eax,%eax
+    2b8d:	78 21                	js     2bb0 <fread+0x110>
+  else if(n == 0)
+    2b8f:	75 2f                	jne    2bc0 <fread+0x120>
+    f->eof = 1;
+    2b91:	89 fe                	mov    %edi,%esi
+    2b93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2b96:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    2b9d:	89 f0                	mov    %esi,%eax
+}
+    2b9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    2ba2:	99                   	cltd
+}
+    2ba3:	5b                   	pop    %ebx
+    2ba4:	5e                   	pop    %esi
+  return n / size;
+    2ba5:	f7 ff                	idiv   %edi
+}
+    2ba7:	5f                   	pop    %edi
+    2ba8:	5d                   	pop    %ebp
+    2ba9:	c3                   	ret
+    2baa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    2bb0:	89 fe                	mov    %edi,%esi
+    2bb2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2bb5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    2bbc:	eb df                	jmp    2b9d <fread+0xfd>
+    2bbe:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    2bc0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    2bc3:	e9 54 ff ff ff       	jmp    2b1c <fread+0x7c>
+    2bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bcf:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    2bd0:	83 ec 0c             	sub    $0xc,%esp
+    2bd3:	ff 35 64 3b 00 00    	push   0x3b64
+    2bd9:	e8 a2 fc ff ff       	call   2880 <fflush>
+    2bde:	83 c4 10             	add    $0x10,%esp
+    2be1:	eb 85                	jmp    2b68 <fread+0xc8>
+    2be3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2be7:	90                   	nop
+        if(k < 0)
+    2be8:	89 fe                	mov    %edi,%esi
+    2bea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2bed:	74 a7                	je     2b96 <fread+0xf6>
+    2bef:	eb c4                	jmp    2bb5 <fread+0x115>
+    2bf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bff:	90                   	nop
+
+00002c00 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    2c00:	55                   	push   %ebp
+    2c01:	89 e5                	mov    %esp,%ebp
+    2c03:	53                   	push   %ebx
+    2c04:	83 ec 14             	sub    $0x14,%esp
+    2c07:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    2c0a:	8b 50 04             	mov    0x4(%eax),%edx
+    2c0d:	85 d2                	test   %edx,%edx
+    2c0f:	74 08                	je     2c19 <fgetc+0x19>
+    2c11:	8b 50 1c             	mov    0x1c(%eax),%edx
+    2c14:	3b 50 20             	cmp    0x20(%eax),%edx
+    2c17:	7c 27                	jl     2c40 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2c19:	50                   	push   %eax
+    2c1a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    2c1d:	6a 01                	push   $0x1
+    2c1f:	6a 01                	push   $0x1
+    2c21:	50                   	push   %eax
+    2c22:	e8 79 fe ff ff       	call   2aa0 <fread>
+    2c27:	83 c4 10             	add    $0x10,%esp
+    2c2a:	83 f8 01             	cmp    $0x1,%eax
+    2c2d:	75 29                	jne    2c58 <fgetc+0x58>
+    2c2f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2c33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2c36:	c9                   	leave
+    2c37:	c3                   	ret
+    2c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c3f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    2c40:	8b 48 18             	mov    0x18(%eax),%ecx
+    2c43:	8d 5a 01             	lea    0x1(%edx),%ebx
+    2c46:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    2c49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    2c4c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    2c50:	c9                   	leave
+    2c51:	c3                   	ret
+    2c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2c58:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c5d:	eb d4                	jmp    2c33 <fgetc+0x33>
+    2c5f:	90                   	nop
+
+00002c60 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    2c60:	55                   	push   %ebp
+    2c61:	89 e5                	mov    %esp,%ebp
+    2c63:	57                   	push   %edi
+    2c64:	56                   	push   %esi
+    2c65:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    2c66:	31 db                	xor    %ebx,%ebx
+{
+    2c68:	83 ec 1c             	sub    $0x1c,%esp
+    2c6b:	8b 75 10             	mov    0x10(%ebp),%esi
+    2c6e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    2c70:	eb 2e                	jmp    2ca0 <fgets+0x40>
+    2c72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2c78:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    2c7b:	57                   	push   %edi
+    2c7c:	6a 01                	push   $0x1
+    2c7e:	6a 01                	push   $0x1
+    2c80:	50                   	push   %eax
+    2c81:	e8 1a fe ff ff       	call   2aa0 <fread>
+    2c86:	83 c4 10             	add    $0x10,%esp
+    2c89:	83 f8 01             	cmp    $0x1,%eax
+    2c8c:	75 62                	jne    2cf0 <fgets+0x90>
+    2c8e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    2c92:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2c95:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    2c97:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    2c9b:	83 f9 0a             	cmp    $0xa,%ecx
+    2c9e:	74 34                	je     2cd4 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    2ca0:	89 de                	mov    %ebx,%esi
+    2ca2:	83 c3 01             	add    $0x1,%ebx
+    2ca5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    2ca8:	7d 46                	jge    2cf0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    2caa:	8b 47 04             	mov    0x4(%edi),%eax
+    2cad:	85 c0                	test   %eax,%eax
+    2caf:	74 c7                	je     2c78 <fgets+0x18>
+    2cb1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    2cb4:	3b 47 20             	cmp    0x20(%edi),%eax
+    2cb7:	7d bf                	jge    2c78 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    2cb9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    2cbc:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    2cbf:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    2cc2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    2cc5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    2cc9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    2ccb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    2ccf:	83 f9 0a             	cmp    $0xa,%ecx
+    2cd2:	75 cc                	jne    2ca0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2cd4:	8b 45 08             	mov    0x8(%ebp),%eax
+    2cd7:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    2cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2cde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2ce1:	5b                   	pop    %ebx
+    2ce2:	5e                   	pop    %esi
+    2ce3:	5f                   	pop    %edi
+    2ce4:	5d                   	pop    %ebp
+    2ce5:	c3                   	ret
+    2ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ced:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2cf0:	8b 45 08             	mov    0x8(%ebp),%eax
+    2cf3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2cf7:	31 c0                	xor    %eax,%eax
+    2cf9:	85 f6                	test   %esi,%esi
+    2cfb:	74 e1                	je     2cde <fgets+0x7e>
+    2cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+    2d00:	eb dc                	jmp    2cde <fgets+0x7e>
+    2d02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002d10 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    2d10:	55                   	push   %ebp
+    2d11:	89 e5                	mov    %esp,%ebp
+    2d13:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2d14:	bb 80 3b 00 00       	mov    $0x3b80,%ebx
+{
+    2d19:	83 ec 04             	sub    $0x4,%esp
+    2d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    2d20:	8b 53 04             	mov    0x4(%ebx),%edx
+    2d23:	85 d2                	test   %edx,%edx
+    2d25:	75 07                	jne    2d2e <fdopen+0x1e>
+    2d27:	8b 43 08             	mov    0x8(%ebx),%eax
+    2d2a:	85 c0                	test   %eax,%eax
+    2d2c:	74 1a                	je     2d48 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2d2e:	83 c3 24             	add    $0x24,%ebx
+    2d31:	81 fb c0 3d 00 00    	cmp    $0x3dc0,%ebx
+    2d37:	75 e7                	jne    2d20 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2d39:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    2d3b:	89 d8                	mov    %ebx,%eax
+    2d3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d40:	c9                   	leave
+    2d41:	c3                   	ret
+    2d42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2d48:	81 fb c0 3d 00 00    	cmp    $0x3dc0,%ebx
+    2d4e:	74 e9                	je     2d39 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2d50:	83 ec 04             	sub    $0x4,%esp
+    2d53:	6a 24                	push   $0x24
+    2d55:	6a 00                	push   $0x0
+    2d57:	53                   	push   %ebx
+    2d58:	e8 d3 f1 ff ff       	call   1f30 <memset>
+  f->fd = fd;
+    2d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2d60:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2d67:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    2d6a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    2d6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2d6f:	80 38 72             	cmpb   $0x72,(%eax)
+    2d72:	74 14                	je     2d88 <fdopen+0x78>
+    f->writable = 1;
+    2d74:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    2d7b:	89 d8                	mov    %ebx,%eax
+    2d7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d80:	c9                   	leave
+    2d81:	c3                   	ret
+    2d82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2d88:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    2d8f:	89 d8                	mov    %ebx,%eax
+    2d91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d94:	c9                   	leave
+    2d95:	c3                   	ret
+    2d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002da0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2da0:	55                   	push   %ebp
+    2da1:	89 e5                	mov    %esp,%ebp
+    2da3:	56                   	push   %esi
+    2da4:	53                   	push   %ebx
+    2da5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2da8:	0f b6 06             	movzbl (%esi),%eax
+    2dab:	3c 72                	cmp    $0x72,%al
+    2dad:	74 61                	je     2e10 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    2daf:	3c 77                	cmp    $0x77,%al
+    2db1:	74 7d                	je     2e30 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2db3:	3c 61                	cmp    $0x61,%al
+    2db5:	75 49                	jne    2e00 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2db7:	83 ec 08             	sub    $0x8,%esp
+    2dba:	68 01 02 00 00       	push   $0x201
+    2dbf:	ff 75 08             	push   0x8(%ebp)
+    2dc2:	e8 54 f4 ff ff       	call   221b <open>
+    2dc7:	83 c4 10             	add    $0x10,%esp
+    2dca:	89 c3                	mov    %eax,%ebx
+    2dcc:	85 c0                	test   %eax,%eax
+    2dce:	78 30                	js     2e00 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2dd0:	83 ec 04             	sub    $0x4,%esp
+    2dd3:	6a 02                	push   $0x2
+    2dd5:	6a 00                	push   $0x0
+    2dd7:	50                   	push   %eax
+    2dd8:	e8 4c f5 ff ff       	call   2329 <lseek>
+    2ddd:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2de0:	83 ec 08             	sub    $0x8,%esp
+    2de3:	56                   	push   %esi
+    2de4:	53                   	push   %ebx
+    2de5:	e8 26 ff ff ff       	call   2d10 <fdopen>
+    2dea:	83 c4 10             	add    $0x10,%esp
+    2ded:	85 c0                	test   %eax,%eax
+    2def:	75 11                	jne    2e02 <fopen+0x62>
+    close(fd);
+    2df1:	83 ec 0c             	sub    $0xc,%esp
+    2df4:	53                   	push   %ebx
+    2df5:	e8 f4 f3 ff ff       	call   21ee <close>
+    2dfa:	83 c4 10             	add    $0x10,%esp
+    2dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2e00:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2e02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2e05:	5b                   	pop    %ebx
+    2e06:	5e                   	pop    %esi
+    2e07:	5d                   	pop    %ebp
+    2e08:	c3                   	ret
+    2e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2e10:	83 ec 08             	sub    $0x8,%esp
+    2e13:	6a 00                	push   $0x0
+    2e15:	ff 75 08             	push   0x8(%ebp)
+    2e18:	e8 fe f3 ff ff       	call   221b <open>
+    2e1d:	83 c4 10             	add    $0x10,%esp
+    2e20:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2e22:	85 db                	test   %ebx,%ebx
+    2e24:	78 da                	js     2e00 <fopen+0x60>
+    2e26:	eb b8                	jmp    2de0 <fopen+0x40>
+    2e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e2f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2e30:	83 ec 08             	sub    $0x8,%esp
+    2e33:	68 01 06 00 00       	push   $0x601
+    2e38:	ff 75 08             	push   0x8(%ebp)
+    2e3b:	e8 db f3 ff ff       	call   221b <open>
+    2e40:	83 c4 10             	add    $0x10,%esp
+    2e43:	89 c3                	mov    %eax,%ebx
+    2e45:	eb db                	jmp    2e22 <fopen+0x82>
+    2e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e4e:	66 90                	xchg   %ax,%ax
+
+00002e50 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2e50:	55                   	push   %ebp
+    2e51:	89 e5                	mov    %esp,%ebp
+    2e53:	56                   	push   %esi
+    2e54:	53                   	push   %ebx
+    2e55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2e58:	83 ec 0c             	sub    $0xc,%esp
+    2e5b:	53                   	push   %ebx
+    2e5c:	e8 1f fa ff ff       	call   2880 <fflush>
+    2e61:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2e63:	58                   	pop    %eax
+    2e64:	ff 33                	push   (%ebx)
+    2e66:	e8 83 f3 ff ff       	call   21ee <close>
+    2e6b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    2e6e:	85 c0                	test   %eax,%eax
+    2e70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2e75:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2e78:	8b 43 18             	mov    0x18(%ebx),%eax
+    2e7b:	85 c0                	test   %eax,%eax
+    2e7d:	0f 95 c1             	setne  %cl
+    2e80:	3d e0 51 00 00       	cmp    $0x51e0,%eax
+    2e85:	0f 95 c2             	setne  %dl
+    2e88:	84 d1                	test   %dl,%cl
+    2e8a:	74 07                	je     2e93 <fclose+0x43>
+    2e8c:	3d e0 4d 00 00       	cmp    $0x4de0,%eax
+    2e91:	75 25                	jne    2eb8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2e93:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    2e9a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    2e9c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2ea3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    2eaa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2ead:	5b                   	pop    %ebx
+    2eae:	5e                   	pop    %esi
+    2eaf:	5d                   	pop    %ebp
+    2eb0:	c3                   	ret
+    2eb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2eb8:	83 ec 0c             	sub    $0xc,%esp
+    2ebb:	50                   	push   %eax
+    2ebc:	e8 3f 00 00 00       	call   2f00 <free>
+    2ec1:	83 c4 10             	add    $0x10,%esp
+    2ec4:	eb cd                	jmp    2e93 <fclose+0x43>
+    2ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002ed0 <feof>:
+
+int
+feof(FILE *f)
+{
+    2ed0:	55                   	push   %ebp
+    2ed1:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2ed6:	5d                   	pop    %ebp
+  return f->eof;
+    2ed7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    2eda:	c3                   	ret
+    2edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2edf:	90                   	nop
+
+00002ee0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2ee0:	55                   	push   %ebp
+    2ee1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2ee3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2ee6:	5d                   	pop    %ebp
+  return f->err;
+    2ee7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    2eea:	c3                   	ret
+    2eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2eef:	90                   	nop
+
+00002ef0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2ef0:	55                   	push   %ebp
+    2ef1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2ef6:	5d                   	pop    %ebp
+  return f->fd;
+    2ef7:	8b 00                	mov    (%eax),%eax
+}
+    2ef9:	c3                   	ret
+    2efa:	66 90                	xchg   %ax,%ax
+    2efc:	66 90                	xchg   %ax,%ax
+    2efe:	66 90                	xchg   %ax,%ax
+
+00002f00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2f00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2f01:	a1 e0 55 00 00       	mov    0x55e0,%eax
+{
+    2f06:	89 e5                	mov    %esp,%ebp
+    2f08:	57                   	push   %edi
+    2f09:	56                   	push   %esi
+    2f0a:	53                   	push   %ebx
+    2f0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    2f0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2f18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2f1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2f1c:	39 ca                	cmp    %ecx,%edx
+    2f1e:	73 30                	jae    2f50 <free+0x50>
+    2f20:	39 c1                	cmp    %eax,%ecx
+    2f22:	72 04                	jb     2f28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2f24:	39 c2                	cmp    %eax,%edx
+    2f26:	72 f0                	jb     2f18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2f28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    2f2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    2f2e:	39 f8                	cmp    %edi,%eax
+    2f30:	74 2e                	je     2f60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2f32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2f35:	8b 42 04             	mov    0x4(%edx),%eax
+    2f38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2f3b:	39 f1                	cmp    %esi,%ecx
+    2f3d:	74 38                	je     2f77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    2f3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2f41:	5b                   	pop    %ebx
+  freep = p;
+    2f42:	89 15 e0 55 00 00    	mov    %edx,0x55e0
+}
+    2f48:	5e                   	pop    %esi
+    2f49:	5f                   	pop    %edi
+    2f4a:	5d                   	pop    %ebp
+    2f4b:	c3                   	ret
+    2f4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2f50:	39 c1                	cmp    %eax,%ecx
+    2f52:	72 d0                	jb     2f24 <free+0x24>
+    2f54:	eb c2                	jmp    2f18 <free+0x18>
+    2f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2f5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2f60:	03 70 04             	add    0x4(%eax),%esi
+    2f63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2f66:	8b 02                	mov    (%edx),%eax
+    2f68:	8b 00                	mov    (%eax),%eax
+    2f6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    2f6d:	8b 42 04             	mov    0x4(%edx),%eax
+    2f70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2f73:	39 f1                	cmp    %esi,%ecx
+    2f75:	75 c8                	jne    2f3f <free+0x3f>
+    p->s.size += bp->s.size;
+    2f77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    2f7a:	89 15 e0 55 00 00    	mov    %edx,0x55e0
+    p->s.size += bp->s.size;
+    2f80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2f83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2f86:	89 0a                	mov    %ecx,(%edx)
+}
+    2f88:	5b                   	pop    %ebx
+    2f89:	5e                   	pop    %esi
+    2f8a:	5f                   	pop    %edi
+    2f8b:	5d                   	pop    %ebp
+    2f8c:	c3                   	ret
+    2f8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002f90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2f90:	55                   	push   %ebp
+    2f91:	89 e5                	mov    %esp,%ebp
+    2f93:	57                   	push   %edi
+    2f94:	56                   	push   %esi
+    2f95:	53                   	push   %ebx
+    2f96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2f99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    2f9c:	8b 15 e0 55 00 00    	mov    0x55e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2fa2:	8d 78 07             	lea    0x7(%eax),%edi
+    2fa5:	c1 ef 03             	shr    $0x3,%edi
+    2fa8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    2fab:	85 d2                	test   %edx,%edx
+    2fad:	0f 84 8d 00 00 00    	je     3040 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2fb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2fb5:	8b 48 04             	mov    0x4(%eax),%ecx
+    2fb8:	39 f9                	cmp    %edi,%ecx
+    2fba:	73 64                	jae    3020 <malloc+0x90>
+  if(nu < 4096)
+    2fbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2fc1:	39 df                	cmp    %ebx,%edi
+    2fc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2fc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    2fcd:	eb 0a                	jmp    2fd9 <malloc+0x49>
+    2fcf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2fd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2fd2:	8b 48 04             	mov    0x4(%eax),%ecx
+    2fd5:	39 f9                	cmp    %edi,%ecx
+    2fd7:	73 47                	jae    3020 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2fd9:	89 c2                	mov    %eax,%edx
+    2fdb:	39 05 e0 55 00 00    	cmp    %eax,0x55e0
+    2fe1:	75 ed                	jne    2fd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2fe3:	83 ec 0c             	sub    $0xc,%esp
+    2fe6:	56                   	push   %esi
+    2fe7:	e8 b6 f2 ff ff       	call   22a2 <sbrk>
+  if(p == (char*)-1)
+    2fec:	83 c4 10             	add    $0x10,%esp
+    2fef:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2ff2:	74 1c                	je     3010 <malloc+0x80>
+  hp->s.size = nu;
+    2ff4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2ff7:	83 ec 0c             	sub    $0xc,%esp
+    2ffa:	83 c0 08             	add    $0x8,%eax
+    2ffd:	50                   	push   %eax
+    2ffe:	e8 fd fe ff ff       	call   2f00 <free>
+  return freep;
+    3003:	8b 15 e0 55 00 00    	mov    0x55e0,%edx
+      if((p = morecore(nunits)) == 0)
+    3009:	83 c4 10             	add    $0x10,%esp
+    300c:	85 d2                	test   %edx,%edx
+    300e:	75 c0                	jne    2fd0 <malloc+0x40>
+        return 0;
+  }
+}
+    3010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    3013:	31 c0                	xor    %eax,%eax
+}
+    3015:	5b                   	pop    %ebx
+    3016:	5e                   	pop    %esi
+    3017:	5f                   	pop    %edi
+    3018:	5d                   	pop    %ebp
+    3019:	c3                   	ret
+    301a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    3020:	39 cf                	cmp    %ecx,%edi
+    3022:	74 4c                	je     3070 <malloc+0xe0>
+        p->s.size -= nunits;
+    3024:	29 f9                	sub    %edi,%ecx
+    3026:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    3029:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    302c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    302f:	89 15 e0 55 00 00    	mov    %edx,0x55e0
+}
+    3035:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    3038:	83 c0 08             	add    $0x8,%eax
+}
+    303b:	5b                   	pop    %ebx
+    303c:	5e                   	pop    %esi
+    303d:	5f                   	pop    %edi
+    303e:	5d                   	pop    %ebp
+    303f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    3040:	c7 05 e0 55 00 00 e4 	movl   $0x55e4,0x55e0
+    3047:	55 00 00 
+    base.s.size = 0;
+    304a:	b8 e4 55 00 00       	mov    $0x55e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    304f:	c7 05 e4 55 00 00 e4 	movl   $0x55e4,0x55e4
+    3056:	55 00 00 
+    base.s.size = 0;
+    3059:	c7 05 e8 55 00 00 00 	movl   $0x0,0x55e8
+    3060:	00 00 00 
+    if(p->s.size >= nunits){
+    3063:	e9 54 ff ff ff       	jmp    2fbc <malloc+0x2c>
+    3068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    306f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    3070:	8b 08                	mov    (%eax),%ecx
+    3072:	89 0a                	mov    %ecx,(%edx)
+    3074:	eb b9                	jmp    302f <malloc+0x9f>
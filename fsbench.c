@@ -0,0 +1,309 @@
+// File system benchmark.
+//   fsbench [kb [nfiles]]
+// Writes and reads back a kb-KB file (default 256) sequentially,
+// then creates, opens and unlinks nfiles small files (default 100)
+// in a fresh directory, printing the ticks each phase took and
+// the log blocks written per MB of file data.
+//   fsbench fill [mb]
+// Fills mb MB (default 32) of the disk with 1 MB files, printing
+// the write rate every 8 MB to show whether allocation slows down
+// as the disk fills, then removes them.  The kernel panics if the
+// disk runs out, so leave mb below the free space.
+//   fsbench path [depth [n]]
+// Makes a chain of depth nested directories (default 10) and
+// opens a file at the bottom n times (default 1000) by its full
+// path, printing the time per lookup and how often the name
+// cache answered.
+//   fsbench dir [n]
+// Links n names (default 10000) to one file in a fresh directory,
+// then looks each up and unlinks it, printing the rate of each;
+// shows how lookup cost grows with directory size.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "kstat.h"
+
+char buf[4096];
+
+// Print the time taken for n units of work since start.
+void
+report(char *what, int n, char *unit, int start)
+{
+  int t;
+
+  t = uptime() - start;
+  printf(1, "%s: %d %s in %d ticks", what, n, unit, t);
+  if(t > 0)
+    printf(1, ", %d %s/s", n*100/t, unit);
+  printf(1, "\n");
+}
+
+void
+sequential(int kb)
+{
+  int fd, i, start;
+  struct kstat before, after;
+
+  kstat(&before);
+  start = uptime();
+  if((fd = open("fsbench.big", O_CREATE|O_RDWR)) < 0){
+    printf(2, "fsbench: create fsbench.big failed\n");
+    exit();
+  }
+  for(i = 0; i < kb; i += sizeof(buf)/1024)
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "fsbench: write failed\n");
+      exit();
+    }
+  close(fd);
+  report("seqwrite", kb, "KB", start);
+  // Log traffic per MB written shows what block allocation costs.
+  if(kstat(&after) == 0 && kb > 0)
+    printf(1, "seqwrite: %d log blocks/MB, %d blocks zeroed, %d not\n",
+      (after.log_blocks - before.log_blocks) * 1024 / kb,
+      after.fs_zeroed - before.fs_zeroed, after.fs_nozero - before.fs_nozero);
+
+  start = uptime();
+  fd = open("fsbench.big", O_RDONLY);
+  for(i = 0; i < kb; i += sizeof(buf)/1024)
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "fsbench: read failed\n");
+      exit();
+    }
+  close(fd);
+  report("seqread", kb, "KB", start);
+  unlink("fsbench.big");
+}
+
+void
+metadata(int n)
+{
+  int fd, i, start;
+  char name[32];
+
+  if(mkdir("fsbench.d") < 0){
+    printf(2, "fsbench: mkdir fsbench.d failed\n");
+    exit();
+  }
+  strcpy(name, "fsbench.d/f");
+
+  start = uptime();
+  for(i = 0; i < n; i++){
+    name[11] = 'a' + i/26/26%26;
+    name[12] = 'a' + i/26%26;
+    name[13] = 'a' + i%26;
+    name[14] = 0;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(2, "fsbench: create %s failed\n", name);
+      exit();
+    }
+    write(fd, name, 15);
+    close(fd);
+  }
+  report("create", n, "files", start);
+
+  start = uptime();
+  for(i = 0; i < n; i++){
+    name[11] = 'a' + i/26/26%26;
+    name[12] = 'a' + i/26%26;
+    name[13] = 'a' + i%26;
+    if((fd = open(name, O_RDONLY)) < 0){
+      printf(2, "fsbench: open %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  report("open", n, "files", start);
+
+  start = uptime();
+  for(i = 0; i < n; i++){
+    name[11] = 'a' + i/26/26%26;
+    name[12] = 'a' + i/26%26;
+    name[13] = 'a' + i%26;
+    if(unlink(name) < 0){
+      printf(2, "fsbench: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  report("unlink", n, "files", start);
+  unlink("fsbench.d");
+}
+
+void
+fill(int mb)
+{
+  int fd, i, j, start, part;
+  char name[16];
+
+  strcpy(name, "fsfill");
+  start = part = uptime();
+  for(i = 0; i < mb; i++){
+    name[6] = '0' + i/100%10;
+    name[7] = '0' + i/10%10;
+    name[8] = '0' + i%10;
+    name[9] = 0;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+      break;
+    for(j = 0; j < 1024*1024/sizeof(buf); j++)
+      if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+        break;
+    close(fd);
+    if(j < 1024*1024/sizeof(buf))
+      break;
+    if((i+1) % 8 == 0){
+      report("fill", 8*1024, "KB", part);
+      part = uptime();
+    }
+  }
+  report("fill total", i*1024, "KB", start);
+
+  start = uptime();
+  for(j = 0; j <= i && j < mb; j++){
+    name[6] = '0' + j/100%10;
+    name[7] = '0' + j/10%10;
+    name[8] = '0' + j%10;
+    unlink(name);
+  }
+  report("fill unlink", j, "files", start);
+}
+
+void
+path(int depth, int n)
+{
+  int fd, i, start, t;
+  char p[512];
+  struct kstat before, after;
+
+  if(depth < 1 || depth > sizeof(p)/3 - 2)
+    depth = 10;
+  for(i = 0; i < depth; i++){
+    strcpy(p + 3*i, "fp/");
+    p[3*i+2] = 0;
+    if(mkdir(p) < 0){
+      printf(2, "fsbench: mkdir %s failed\n", p);
+      exit();
+    }
+    p[3*i+2] = '/';
+  }
+  strcpy(p + 3*depth, "f");
+  if((fd = open(p, O_CREATE|O_RDWR)) < 0){
+    printf(2, "fsbench: create %s failed\n", p);
+    exit();
+  }
+  close(fd);
+
+  kstat(&before);
+  start = uptime();
+  for(i = 0; i < n; i++){
+    if((fd = open(p, O_RDONLY)) < 0){
+      printf(2, "fsbench: open %s failed\n", p);
+      exit();
+    }
+    close(fd);
+  }
+  t = uptime() - start;
+  kstat(&after);
+  report("path open", n, "opens", start);
+  if(n > 0)
+    printf(1, "path open: %d components, %d us per open, dcache %d hits %d misses\n",
+      depth + 1, t*10000/n, after.dcache_hits - before.dcache_hits,
+      after.dcache_misses - before.dcache_misses);
+
+  // Remove from the bottom up.
+  unlink(p);
+  for(i = depth; i > 0; i--){
+    p[3*i-1] = 0;
+    unlink(p);
+  }
+}
+
+// Set the name of the ith entry in bigdir().
+void
+ddname(char *name, int i)
+{
+  strcpy(name, "fsbench.dd/x");
+  name[12] = '0' + i/10000%10;
+  name[13] = '0' + i/1000%10;
+  name[14] = '0' + i/100%10;
+  name[15] = '0' + i/10%10;
+  name[16] = '0' + i%10;
+  name[17] = 0;
+}
+
+void
+bigdir(int n)
+{
+  int fd, i, start;
+  char name[32];
+  struct stat st;
+
+  if(mkdir("fsbench.dd") < 0 || (fd = open("fsbench.dd/f", O_CREATE|O_RDWR)) < 0){
+    printf(2, "fsbench: create fsbench.dd/f failed\n");
+    exit();
+  }
+  close(fd);
+
+  start = uptime();
+  for(i = 0; i < n; i++){
+    ddname(name, i);
+    if(link("fsbench.dd/f", name) < 0){
+      printf(2, "fsbench: link %s failed\n", name);
+      n = i;
+      break;
+    }
+  }
+  report("dir link", n, "names", start);
+
+  start = uptime();
+  for(i = 0; i < n; i++){
+    ddname(name, i);
+    if(stat(name, &st) < 0){
+      printf(2, "fsbench: stat %s failed\n", name);
+      exit();
+    }
+  }
+  report("dir lookup", n, "names", start);
+
+  start = uptime();
+  for(i = 0; i < n; i++){
+    ddname(name, i);
+    unlink(name);
+  }
+  report("dir unlink", n, "names", start);
+  unlink("fsbench.dd/f");
+  unlink("fsbench.dd");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int kb, n;
+
+  if(argc > 1 && strcmp(argv[1], "fill") == 0){
+    memset(buf, 'f', sizeof(buf));
+    fill(argc > 2 ? atoi(argv[2]) : 32);
+    exit();
+  }
+  if(argc > 1 && strcmp(argv[1], "dir") == 0){
+    bigdir(argc > 2 ? atoi(argv[2]) : 10000);
+    exit();
+  }
+  if(argc > 1 && strcmp(argv[1], "path") == 0){
+    path(argc > 2 ? atoi(argv[2]) : 10, argc > 3 ? atoi(argv[3]) : 1000);
+    exit();
+  }
+
+  kb = 256;
+  n = 100;
+  if(argc > 1)
+    kb = atoi(argv[1]);
+  if(argc > 2)
+    n = atoi(argv[2]);
+  memset(buf, 'f', sizeof(buf));
+
+  sequential(kb);
+  metadata(n);
+  exit();
+}
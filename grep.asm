@@ -0,0 +1,3121 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	83 ec 18             	sub    $0x18,%esp
+    1014:	8b 01                	mov    (%ecx),%eax
+    1016:	8b 59 04             	mov    0x4(%ecx),%ebx
+    1019:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+    101c:	83 f8 01             	cmp    $0x1,%eax
+    101f:	7e 6f                	jle    1090 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+    1021:	8b 43 04             	mov    0x4(%ebx),%eax
+    1024:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+    1027:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+    102b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+    1030:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+    1033:	75 2d                	jne    1062 <main+0x62>
+    1035:	eb 6c                	jmp    10a3 <main+0xa3>
+    1037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+    1040:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+    1043:	83 c6 01             	add    $0x1,%esi
+    1046:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+    1049:	50                   	push   %eax
+    104a:	ff 75 e0             	push   -0x20(%ebp)
+    104d:	e8 9e 01 00 00       	call   11f0 <grep>
+    close(fd);
+    1052:	89 3c 24             	mov    %edi,(%esp)
+    1055:	e8 c4 06 00 00       	call   171e <close>
+  for(i = 2; i < argc; i++){
+    105a:	83 c4 10             	add    $0x10,%esp
+    105d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+    1060:	7e 29                	jle    108b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+    1062:	83 ec 08             	sub    $0x8,%esp
+    1065:	6a 00                	push   $0x0
+    1067:	ff 33                	push   (%ebx)
+    1069:	e8 dd 06 00 00       	call   174b <open>
+    106e:	83 c4 10             	add    $0x10,%esp
+    1071:	89 c7                	mov    %eax,%edi
+    1073:	85 c0                	test   %eax,%eax
+    1075:	79 c9                	jns    1040 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+    1077:	50                   	push   %eax
+    1078:	ff 33                	push   (%ebx)
+    107a:	68 c8 25 00 00       	push   $0x25c8
+    107f:	6a 01                	push   $0x1
+    1081:	e8 6a 0b 00 00       	call   1bf0 <printf>
+      exit();
+    1086:	e8 f5 05 00 00       	call   1680 <exit>
+  }
+  exit();
+    108b:	e8 f0 05 00 00       	call   1680 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+    1090:	51                   	push   %ecx
+    1091:	51                   	push   %ecx
+    1092:	68 a8 25 00 00       	push   $0x25a8
+    1097:	6a 02                	push   $0x2
+    1099:	e8 52 0b 00 00       	call   1bf0 <printf>
+    exit();
+    109e:	e8 dd 05 00 00       	call   1680 <exit>
+    grep(pattern, 0);
+    10a3:	52                   	push   %edx
+    10a4:	52                   	push   %edx
+    10a5:	6a 00                	push   $0x0
+    10a7:	50                   	push   %eax
+    10a8:	e8 43 01 00 00       	call   11f0 <grep>
+    exit();
+    10ad:	e8 ce 05 00 00       	call   1680 <exit>
+    10b2:	66 90                	xchg   %ax,%ax
+    10b4:	66 90                	xchg   %ax,%ax
+    10b6:	66 90                	xchg   %ax,%ax
+    10b8:	66 90                	xchg   %ax,%ax
+    10ba:	66 90                	xchg   %ax,%ax
+    10bc:	66 90                	xchg   %ax,%ax
+    10be:	66 90                	xchg   %ax,%ax
+
+000010c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	57                   	push   %edi
+    10c4:	56                   	push   %esi
+    10c5:	53                   	push   %ebx
+    10c6:	83 ec 0c             	sub    $0xc,%esp
+    10c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+    10cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+    10cf:	0f b6 0f             	movzbl (%edi),%ecx
+    10d2:	84 c9                	test   %cl,%cl
+    10d4:	0f 84 96 00 00 00    	je     1170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+    10da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    10de:	3c 2a                	cmp    $0x2a,%al
+    10e0:	74 2d                	je     110f <matchhere+0x4f>
+    10e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+    10e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+    10eb:	80 f9 24             	cmp    $0x24,%cl
+    10ee:	74 50                	je     1140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+    10f0:	89 f2                	mov    %esi,%edx
+    10f2:	84 d2                	test   %dl,%dl
+    10f4:	74 6e                	je     1164 <matchhere+0xa4>
+    10f6:	80 f9 2e             	cmp    $0x2e,%cl
+    10f9:	75 65                	jne    1160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+    10fb:	83 c3 01             	add    $0x1,%ebx
+    10fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+    1101:	84 c0                	test   %al,%al
+    1103:	74 6b                	je     1170 <matchhere+0xb0>
+    1105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+    1107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    110b:	3c 2a                	cmp    $0x2a,%al
+    110d:	75 d9                	jne    10e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+    110f:	8d 77 02             	lea    0x2(%edi),%esi
+    1112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+    1115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+    1118:	83 ec 08             	sub    $0x8,%esp
+    111b:	53                   	push   %ebx
+    111c:	56                   	push   %esi
+    111d:	e8 9e ff ff ff       	call   10c0 <matchhere>
+    1122:	83 c4 10             	add    $0x10,%esp
+    1125:	85 c0                	test   %eax,%eax
+    1127:	75 47                	jne    1170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+    1129:	0f be 13             	movsbl (%ebx),%edx
+    112c:	84 d2                	test   %dl,%dl
+    112e:	74 45                	je     1175 <matchhere+0xb5>
+    1130:	83 c3 01             	add    $0x1,%ebx
+    1133:	39 fa                	cmp    %edi,%edx
+    1135:	74 e1                	je     1118 <matchhere+0x58>
+    1137:	83 ff 2e             	cmp    $0x2e,%edi
+    113a:	74 dc                	je     1118 <matchhere+0x58>
+    113c:	eb 37                	jmp    1175 <matchhere+0xb5>
+    113e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+    1140:	84 c0                	test   %al,%al
+    1142:	74 39                	je     117d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+    1144:	89 f2                	mov    %esi,%edx
+    1146:	84 d2                	test   %dl,%dl
+    1148:	74 1a                	je     1164 <matchhere+0xa4>
+    114a:	80 fa 24             	cmp    $0x24,%dl
+    114d:	75 15                	jne    1164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+    114f:	83 c3 01             	add    $0x1,%ebx
+    1152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+    1155:	89 c1                	mov    %eax,%ecx
+    1157:	eb ae                	jmp    1107 <matchhere+0x47>
+    1159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+    1160:	38 ca                	cmp    %cl,%dl
+    1162:	74 97                	je     10fb <matchhere+0x3b>
+}
+    1164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+    1167:	31 c0                	xor    %eax,%eax
+}
+    1169:	5b                   	pop    %ebx
+    116a:	5e                   	pop    %esi
+    116b:	5f                   	pop    %edi
+    116c:	5d                   	pop    %ebp
+    116d:	c3                   	ret
+    116e:	66 90                	xchg   %ax,%ax
+    return 1;
+    1170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    1175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1178:	5b                   	pop    %ebx
+    1179:	5e                   	pop    %esi
+    117a:	5f                   	pop    %edi
+    117b:	5d                   	pop    %ebp
+    117c:	c3                   	ret
+    return *text == '\0';
+    117d:	89 f0                	mov    %esi,%eax
+    117f:	84 c0                	test   %al,%al
+    1181:	0f 94 c0             	sete   %al
+    1184:	0f b6 c0             	movzbl %al,%eax
+    1187:	eb ec                	jmp    1175 <matchhere+0xb5>
+    1189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001190 <match>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	56                   	push   %esi
+    1194:	53                   	push   %ebx
+    1195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+    119b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+    119e:	75 11                	jne    11b1 <match+0x21>
+    11a0:	eb 2e                	jmp    11d0 <match+0x40>
+    11a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+    11a8:	83 c6 01             	add    $0x1,%esi
+    11ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+    11af:	74 16                	je     11c7 <match+0x37>
+    if(matchhere(re, text))
+    11b1:	83 ec 08             	sub    $0x8,%esp
+    11b4:	56                   	push   %esi
+    11b5:	53                   	push   %ebx
+    11b6:	e8 05 ff ff ff       	call   10c0 <matchhere>
+    11bb:	83 c4 10             	add    $0x10,%esp
+    11be:	85 c0                	test   %eax,%eax
+    11c0:	74 e6                	je     11a8 <match+0x18>
+      return 1;
+    11c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    11c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11ca:	5b                   	pop    %ebx
+    11cb:	5e                   	pop    %esi
+    11cc:	5d                   	pop    %ebp
+    11cd:	c3                   	ret
+    11ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+    11d0:	83 c3 01             	add    $0x1,%ebx
+    11d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    11d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11d9:	5b                   	pop    %ebx
+    11da:	5e                   	pop    %esi
+    11db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+    11dc:	e9 df fe ff ff       	jmp    10c0 <matchhere>
+    11e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+
+000011f0 <grep>:
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	57                   	push   %edi
+  m = 0;
+    11f4:	31 ff                	xor    %edi,%edi
+{
+    11f6:	56                   	push   %esi
+    11f7:	53                   	push   %ebx
+    11f8:	83 ec 1c             	sub    $0x1c,%esp
+    11fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    11fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+    1201:	8d 43 01             	lea    0x1(%ebx),%eax
+    1204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+    1210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+    1218:	83 ec 04             	sub    $0x4,%esp
+    121b:	29 c8                	sub    %ecx,%eax
+    121d:	50                   	push   %eax
+    121e:	8d 81 20 30 00 00    	lea    0x3020(%ecx),%eax
+    1224:	50                   	push   %eax
+    1225:	ff 75 0c             	push   0xc(%ebp)
+    1228:	e8 d3 04 00 00       	call   1700 <read>
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	85 c0                	test   %eax,%eax
+    1232:	0f 8e fd 00 00 00    	jle    1335 <grep+0x145>
+    m += n;
+    1238:	01 45 e0             	add    %eax,-0x20(%ebp)
+    123b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+    123e:	bf 20 30 00 00       	mov    $0x3020,%edi
+    1243:	89 de                	mov    %ebx,%esi
+    1245:	c6 81 20 30 00 00 00 	movb   $0x0,0x3020(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+    124c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1250:	83 ec 08             	sub    $0x8,%esp
+    1253:	6a 0a                	push   $0xa
+    1255:	57                   	push   %edi
+    1256:	e8 25 02 00 00       	call   1480 <strchr>
+    125b:	83 c4 10             	add    $0x10,%esp
+    125e:	89 c2                	mov    %eax,%edx
+    1260:	85 c0                	test   %eax,%eax
+    1262:	0f 84 88 00 00 00    	je     12f0 <grep+0x100>
+      *q = 0;
+    1268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+    126b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+    126e:	74 58                	je     12c8 <grep+0xd8>
+    1270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    1273:	89 d3                	mov    %edx,%ebx
+    1275:	eb 12                	jmp    1289 <grep+0x99>
+    1277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    127e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+    1280:	83 c7 01             	add    $0x1,%edi
+    1283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+    1287:	74 37                	je     12c0 <grep+0xd0>
+    if(matchhere(re, text))
+    1289:	83 ec 08             	sub    $0x8,%esp
+    128c:	57                   	push   %edi
+    128d:	56                   	push   %esi
+    128e:	e8 2d fe ff ff       	call   10c0 <matchhere>
+    1293:	83 c4 10             	add    $0x10,%esp
+    1296:	85 c0                	test   %eax,%eax
+    1298:	74 e6                	je     1280 <grep+0x90>
+        fwrite(p, 1, q+1 - p, stdout);
+    129a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    129d:	89 da                	mov    %ebx,%edx
+    129f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+    12a2:	89 d8                	mov    %ebx,%eax
+        *q = '\n';
+    12a4:	c6 02 0a             	movb   $0xa,(%edx)
+        fwrite(p, 1, q+1 - p, stdout);
+    12a7:	29 f8                	sub    %edi,%eax
+    12a9:	ff 35 c4 2d 00 00    	push   0x2dc4
+    12af:	50                   	push   %eax
+    12b0:	6a 01                	push   $0x1
+    12b2:	57                   	push   %edi
+    12b3:	89 df                	mov    %ebx,%edi
+    12b5:	e8 66 0b 00 00       	call   1e20 <fwrite>
+    12ba:	83 c4 10             	add    $0x10,%esp
+    12bd:	eb 91                	jmp    1250 <grep+0x60>
+    12bf:	90                   	nop
+    12c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+    12c3:	eb 8b                	jmp    1250 <grep+0x60>
+    12c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+    12c8:	83 ec 08             	sub    $0x8,%esp
+    12cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    12ce:	57                   	push   %edi
+    12cf:	ff 75 dc             	push   -0x24(%ebp)
+    12d2:	e8 e9 fd ff ff       	call   10c0 <matchhere>
+        fwrite(p, 1, q+1 - p, stdout);
+    12d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+    12da:	83 c4 10             	add    $0x10,%esp
+        fwrite(p, 1, q+1 - p, stdout);
+    12dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+    12e0:	85 c0                	test   %eax,%eax
+    12e2:	75 be                	jne    12a2 <grep+0xb2>
+        fwrite(p, 1, q+1 - p, stdout);
+    12e4:	89 df                	mov    %ebx,%edi
+    12e6:	e9 65 ff ff ff       	jmp    1250 <grep+0x60>
+    12eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ef:	90                   	nop
+    if(p == buf)
+    12f0:	89 f3                	mov    %esi,%ebx
+    12f2:	81 ff 20 30 00 00    	cmp    $0x3020,%edi
+    12f8:	74 2f                	je     1329 <grep+0x139>
+    if(m > 0){
+    12fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    12fd:	85 c0                	test   %eax,%eax
+    12ff:	0f 8e 0b ff ff ff    	jle    1210 <grep+0x20>
+      m -= p - buf;
+    1305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+    1307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+    130a:	2d 20 30 00 00       	sub    $0x3020,%eax
+    130f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+    1312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+    1315:	51                   	push   %ecx
+    1316:	57                   	push   %edi
+    1317:	68 20 30 00 00       	push   $0x3020
+    131c:	e8 8f 02 00 00       	call   15b0 <memmove>
+    1321:	83 c4 10             	add    $0x10,%esp
+    1324:	e9 e7 fe ff ff       	jmp    1210 <grep+0x20>
+      m = 0;
+    1329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    1330:	e9 db fe ff ff       	jmp    1210 <grep+0x20>
+}
+    1335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1338:	5b                   	pop    %ebx
+    1339:	5e                   	pop    %esi
+    133a:	5f                   	pop    %edi
+    133b:	5d                   	pop    %ebp
+    133c:	c3                   	ret
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001340 <matchstar>:
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	57                   	push   %edi
+    1344:	56                   	push   %esi
+    1345:	53                   	push   %ebx
+    1346:	83 ec 0c             	sub    $0xc,%esp
+    1349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    134c:	8b 75 0c             	mov    0xc(%ebp),%esi
+    134f:	8b 7d 10             	mov    0x10(%ebp),%edi
+    1352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+    1358:	83 ec 08             	sub    $0x8,%esp
+    135b:	57                   	push   %edi
+    135c:	56                   	push   %esi
+    135d:	e8 5e fd ff ff       	call   10c0 <matchhere>
+    1362:	83 c4 10             	add    $0x10,%esp
+    1365:	85 c0                	test   %eax,%eax
+    1367:	75 1f                	jne    1388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+    1369:	0f be 17             	movsbl (%edi),%edx
+    136c:	84 d2                	test   %dl,%dl
+    136e:	74 0c                	je     137c <matchstar+0x3c>
+    1370:	83 c7 01             	add    $0x1,%edi
+    1373:	39 da                	cmp    %ebx,%edx
+    1375:	74 e1                	je     1358 <matchstar+0x18>
+    1377:	83 fb 2e             	cmp    $0x2e,%ebx
+    137a:	74 dc                	je     1358 <matchstar+0x18>
+}
+    137c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    137f:	5b                   	pop    %ebx
+    1380:	5e                   	pop    %esi
+    1381:	5f                   	pop    %edi
+    1382:	5d                   	pop    %ebp
+    1383:	c3                   	ret
+    1384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+    138b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    1390:	5b                   	pop    %ebx
+    1391:	5e                   	pop    %esi
+    1392:	5f                   	pop    %edi
+    1393:	5d                   	pop    %ebp
+    1394:	c3                   	ret
+    1395:	66 90                	xchg   %ax,%ax
+    1397:	66 90                	xchg   %ax,%ax
+    1399:	66 90                	xchg   %ax,%ax
+    139b:	66 90                	xchg   %ax,%ax
+    139d:	66 90                	xchg   %ax,%ax
+    139f:	90                   	nop
+
+000013a0 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    13a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    13a1:	31 c0                	xor    %eax,%eax
+{
+    13a3:	89 e5                	mov    %esp,%ebp
+    13a5:	53                   	push   %ebx
+    13a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    13a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    13ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    13b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    13b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    13b7:	83 c0 01             	add    $0x1,%eax
+    13ba:	84 d2                	test   %dl,%dl
+    13bc:	75 f2                	jne    13b0 <strcpy+0x10>
+    ;
+  return os;
+}
+    13be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13c1:	89 c8                	mov    %ecx,%eax
+    13c3:	c9                   	leave
+    13c4:	c3                   	ret
+    13c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	53                   	push   %ebx
+    13d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    13d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    13da:	0f b6 02             	movzbl (%edx),%eax
+    13dd:	84 c0                	test   %al,%al
+    13df:	75 17                	jne    13f8 <strcmp+0x28>
+    13e1:	eb 3a                	jmp    141d <strcmp+0x4d>
+    13e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13e7:	90                   	nop
+    13e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    13ec:	83 c2 01             	add    $0x1,%edx
+    13ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    13f2:	84 c0                	test   %al,%al
+    13f4:	74 1a                	je     1410 <strcmp+0x40>
+    p++, q++;
+    13f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    13f8:	0f b6 19             	movzbl (%ecx),%ebx
+    13fb:	38 c3                	cmp    %al,%bl
+    13fd:	74 e9                	je     13e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    13ff:	29 d8                	sub    %ebx,%eax
+}
+    1401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1404:	c9                   	leave
+    1405:	c3                   	ret
+    1406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1414:	31 c0                	xor    %eax,%eax
+    1416:	29 d8                	sub    %ebx,%eax
+}
+    1418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    141b:	c9                   	leave
+    141c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    141d:	0f b6 19             	movzbl (%ecx),%ebx
+    1420:	31 c0                	xor    %eax,%eax
+    1422:	eb db                	jmp    13ff <strcmp+0x2f>
+    1424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+
+00001430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1430:	55                   	push   %ebp
+    1431:	89 e5                	mov    %esp,%ebp
+    1433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1436:	80 3a 00             	cmpb   $0x0,(%edx)
+    1439:	74 15                	je     1450 <strlen+0x20>
+    143b:	31 c0                	xor    %eax,%eax
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+    1440:	83 c0 01             	add    $0x1,%eax
+    1443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1447:	89 c1                	mov    %eax,%ecx
+    1449:	75 f5                	jne    1440 <strlen+0x10>
+    ;
+  return n;
+}
+    144b:	89 c8                	mov    %ecx,%eax
+    144d:	5d                   	pop    %ebp
+    144e:	c3                   	ret
+    144f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1450:	31 c9                	xor    %ecx,%ecx
+}
+    1452:	5d                   	pop    %ebp
+    1453:	89 c8                	mov    %ecx,%eax
+    1455:	c3                   	ret
+    1456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    146a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    146d:	89 d7                	mov    %edx,%edi
+    146f:	fc                   	cld
+    1470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1475:	89 d0                	mov    %edx,%eax
+    1477:	c9                   	leave
+    1478:	c3                   	ret
+    1479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	8b 45 08             	mov    0x8(%ebp),%eax
+    1486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    148a:	0f b6 10             	movzbl (%eax),%edx
+    148d:	84 d2                	test   %dl,%dl
+    148f:	75 12                	jne    14a3 <strchr+0x23>
+    1491:	eb 1d                	jmp    14b0 <strchr+0x30>
+    1493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1497:	90                   	nop
+    1498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    149c:	83 c0 01             	add    $0x1,%eax
+    149f:	84 d2                	test   %dl,%dl
+    14a1:	74 0d                	je     14b0 <strchr+0x30>
+    if(*s == c)
+    14a3:	38 d1                	cmp    %dl,%cl
+    14a5:	75 f1                	jne    1498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    14a7:	5d                   	pop    %ebp
+    14a8:	c3                   	ret
+    14a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    14b0:	31 c0                	xor    %eax,%eax
+}
+    14b2:	5d                   	pop    %ebp
+    14b3:	c3                   	ret
+    14b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14bf:	90                   	nop
+
+000014c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	57                   	push   %edi
+    14c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    14c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    14c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    14c9:	31 db                	xor    %ebx,%ebx
+{
+    14cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    14ce:	eb 27                	jmp    14f7 <gets+0x37>
+    cc = read(0, &c, 1);
+    14d0:	83 ec 04             	sub    $0x4,%esp
+    14d3:	6a 01                	push   $0x1
+    14d5:	56                   	push   %esi
+    14d6:	6a 00                	push   $0x0
+    14d8:	e8 23 02 00 00       	call   1700 <read>
+    if(cc < 1)
+    14dd:	83 c4 10             	add    $0x10,%esp
+    14e0:	85 c0                	test   %eax,%eax
+    14e2:	7e 1d                	jle    1501 <gets+0x41>
+      break;
+    buf[i++] = c;
+    14e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    14e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    14eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    14ef:	3c 0a                	cmp    $0xa,%al
+    14f1:	74 10                	je     1503 <gets+0x43>
+    14f3:	3c 0d                	cmp    $0xd,%al
+    14f5:	74 0c                	je     1503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    14f7:	89 df                	mov    %ebx,%edi
+    14f9:	83 c3 01             	add    $0x1,%ebx
+    14fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    14ff:	7c cf                	jl     14d0 <gets+0x10>
+    1501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1503:	8b 45 08             	mov    0x8(%ebp),%eax
+    1506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    150a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    150d:	5b                   	pop    %ebx
+    150e:	5e                   	pop    %esi
+    150f:	5f                   	pop    %edi
+    1510:	5d                   	pop    %ebp
+    1511:	c3                   	ret
+    1512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1520:	55                   	push   %ebp
+    1521:	89 e5                	mov    %esp,%ebp
+    1523:	56                   	push   %esi
+    1524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1525:	83 ec 08             	sub    $0x8,%esp
+    1528:	6a 00                	push   $0x0
+    152a:	ff 75 08             	push   0x8(%ebp)
+    152d:	e8 19 02 00 00       	call   174b <open>
+  if(fd < 0)
+    1532:	83 c4 10             	add    $0x10,%esp
+    1535:	85 c0                	test   %eax,%eax
+    1537:	78 27                	js     1560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1539:	83 ec 08             	sub    $0x8,%esp
+    153c:	ff 75 0c             	push   0xc(%ebp)
+    153f:	89 c3                	mov    %eax,%ebx
+    1541:	50                   	push   %eax
+    1542:	e8 31 02 00 00       	call   1778 <fstat>
+  close(fd);
+    1547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    154a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    154c:	e8 cd 01 00 00       	call   171e <close>
+  return r;
+    1551:	83 c4 10             	add    $0x10,%esp
+}
+    1554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1557:	89 f0                	mov    %esi,%eax
+    1559:	5b                   	pop    %ebx
+    155a:	5e                   	pop    %esi
+    155b:	5d                   	pop    %ebp
+    155c:	c3                   	ret
+    155d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1565:	eb ed                	jmp    1554 <stat+0x34>
+    1567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156e:	66 90                	xchg   %ax,%ax
+
+00001570 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+    1573:	53                   	push   %ebx
+    1574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1577:	0f be 02             	movsbl (%edx),%eax
+    157a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    157d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1585:	77 1e                	ja     15a5 <atoi+0x35>
+    1587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1590:	83 c2 01             	add    $0x1,%edx
+    1593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    159a:	0f be 02             	movsbl (%edx),%eax
+    159d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    15a0:	80 fb 09             	cmp    $0x9,%bl
+    15a3:	76 eb                	jbe    1590 <atoi+0x20>
+  return n;
+}
+    15a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    15a8:	89 c8                	mov    %ecx,%eax
+    15aa:	c9                   	leave
+    15ab:	c3                   	ret
+    15ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    15b0:	55                   	push   %ebp
+    15b1:	89 e5                	mov    %esp,%ebp
+    15b3:	57                   	push   %edi
+    15b4:	56                   	push   %esi
+    15b5:	8b 45 10             	mov    0x10(%ebp),%eax
+    15b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    15bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    15be:	85 c0                	test   %eax,%eax
+    15c0:	7e 13                	jle    15d5 <memmove+0x25>
+    15c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    15c4:	89 d7                	mov    %edx,%edi
+    15c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    15d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    15d1:	39 f8                	cmp    %edi,%eax
+    15d3:	75 fb                	jne    15d0 <memmove+0x20>
+  return vdst;
+}
+    15d5:	5e                   	pop    %esi
+    15d6:	89 d0                	mov    %edx,%eax
+    15d8:	5f                   	pop    %edi
+    15d9:	5d                   	pop    %ebp
+    15da:	c3                   	ret
+    15db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15df:	90                   	nop
+
+000015e0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    15e0:	55                   	push   %ebp
+    15e1:	89 e5                	mov    %esp,%ebp
+    15e3:	56                   	push   %esi
+    15e4:	53                   	push   %ebx
+    15e5:	8b 75 10             	mov    0x10(%ebp),%esi
+    15e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    15eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    15ee:	85 f6                	test   %esi,%esi
+    15f0:	74 2e                	je     1620 <memcmp+0x40>
+    15f2:	01 c6                	add    %eax,%esi
+    15f4:	eb 14                	jmp    160a <memcmp+0x2a>
+    15f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1600:	83 c0 01             	add    $0x1,%eax
+    1603:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1606:	39 f0                	cmp    %esi,%eax
+    1608:	74 16                	je     1620 <memcmp+0x40>
+    if(*s1 != *s2)
+    160a:	0f b6 0a             	movzbl (%edx),%ecx
+    160d:	0f b6 18             	movzbl (%eax),%ebx
+    1610:	38 d9                	cmp    %bl,%cl
+    1612:	74 ec                	je     1600 <memcmp+0x20>
+      return *s1 - *s2;
+    1614:	0f b6 c1             	movzbl %cl,%eax
+    1617:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1619:	5b                   	pop    %ebx
+    161a:	5e                   	pop    %esi
+    161b:	5d                   	pop    %ebp
+    161c:	c3                   	ret
+    161d:	8d 76 00             	lea    0x0(%esi),%esi
+    1620:	5b                   	pop    %ebx
+  return 0;
+    1621:	31 c0                	xor    %eax,%eax
+}
+    1623:	5e                   	pop    %esi
+    1624:	5d                   	pop    %ebp
+    1625:	c3                   	ret
+    1626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001630 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1630:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1635:	c3                   	ret
+    1636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001640 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1640:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1645:	c3                   	ret
+    1646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    164d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001650 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1650:	a1 20 34 00 00       	mov    0x3420,%eax
+    1655:	85 c0                	test   %eax,%eax
+    1657:	74 17                	je     1670 <fork+0x20>
+{
+    1659:	55                   	push   %ebp
+    165a:	89 e5                	mov    %esp,%ebp
+    165c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    165f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1661:	c9                   	leave
+  return _fork();
+    1662:	e9 5d 00 00 00       	jmp    16c4 <_fork>
+    1667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166e:	66 90                	xchg   %ax,%ax
+    1670:	e9 4f 00 00 00       	jmp    16c4 <_fork>
+    1675:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    167c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001680 <exit>:
+
+int
+exit(void)
+{
+    1680:	55                   	push   %ebp
+    1681:	89 e5                	mov    %esp,%ebp
+    1683:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1686:	a1 20 34 00 00       	mov    0x3420,%eax
+    168b:	85 c0                	test   %eax,%eax
+    168d:	74 02                	je     1691 <exit+0x11>
+    flushhook();
+    168f:	ff d0                	call   *%eax
+  _exit();
+    1691:	e8 3d 00 00 00       	call   16d3 <_exit>
+    1696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000016a0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    16a0:	55                   	push   %ebp
+  if(flushhook)
+    16a1:	a1 20 34 00 00       	mov    0x3420,%eax
+{
+    16a6:	89 e5                	mov    %esp,%ebp
+    16a8:	56                   	push   %esi
+    16a9:	53                   	push   %ebx
+    16aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    16ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    16b0:	85 c0                	test   %eax,%eax
+    16b2:	74 02                	je     16b6 <exec+0x16>
+    flushhook();
+    16b4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    16b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+    16b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    16bc:	5b                   	pop    %ebx
+    16bd:	5e                   	pop    %esi
+    16be:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    16bf:	e9 78 00 00 00       	jmp    173c <_exec>
+
+000016c4 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    16c4:	b8 01 00 00 00       	mov    $0x1,%eax
+    16c9:	89 e1                	mov    %esp,%ecx
+    16cb:	ba d2 16 00 00       	mov    $0x16d2,%edx
+    16d0:	0f 34                	sysenter
+    16d2:	c3                   	ret
+
+000016d3 <_exit>:
+RAWSYSCALL(exit)
+    16d3:	b8 02 00 00 00       	mov    $0x2,%eax
+    16d8:	89 e1                	mov    %esp,%ecx
+    16da:	ba e1 16 00 00       	mov    $0x16e1,%edx
+    16df:	0f 34                	sysenter
+    16e1:	c3                   	ret
+
+000016e2 <wait>:
+SYSCALL(wait)
+    16e2:	b8 03 00 00 00       	mov    $0x3,%eax
+    16e7:	89 e1                	mov    %esp,%ecx
+    16e9:	ba f0 16 00 00       	mov    $0x16f0,%edx
+    16ee:	0f 34                	sysenter
+    16f0:	c3                   	ret
+
+000016f1 <pipe>:
+SYSCALL(pipe)
+    16f1:	b8 04 00 00 00       	mov    $0x4,%eax
+    16f6:	89 e1                	mov    %esp,%ecx
+    16f8:	ba ff 16 00 00       	mov    $0x16ff,%edx
+    16fd:	0f 34                	sysenter
+    16ff:	c3                   	ret
+
+00001700 <read>:
+SYSCALL(read)
+    1700:	b8 05 00 00 00       	mov    $0x5,%eax
+    1705:	89 e1                	mov    %esp,%ecx
+    1707:	ba 0e 17 00 00       	mov    $0x170e,%edx
+    170c:	0f 34                	sysenter
+    170e:	c3                   	ret
+
+0000170f <write>:
+SYSCALL(write)
+    170f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1714:	89 e1                	mov    %esp,%ecx
+    1716:	ba 1d 17 00 00       	mov    $0x171d,%edx
+    171b:	0f 34                	sysenter
+    171d:	c3                   	ret
+
+0000171e <close>:
+SYSCALL(close)
+    171e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1723:	89 e1                	mov    %esp,%ecx
+    1725:	ba 2c 17 00 00       	mov    $0x172c,%edx
+    172a:	0f 34                	sysenter
+    172c:	c3                   	ret
+
+0000172d <kill>:
+SYSCALL(kill)
+    172d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1732:	89 e1                	mov    %esp,%ecx
+    1734:	ba 3b 17 00 00       	mov    $0x173b,%edx
+    1739:	0f 34                	sysenter
+    173b:	c3                   	ret
+
+0000173c <_exec>:
+RAWSYSCALL(exec)
+    173c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1741:	89 e1                	mov    %esp,%ecx
+    1743:	ba 4a 17 00 00       	mov    $0x174a,%edx
+    1748:	0f 34                	sysenter
+    174a:	c3                   	ret
+
+0000174b <open>:
+SYSCALL(open)
+    174b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1750:	89 e1                	mov    %esp,%ecx
+    1752:	ba 59 17 00 00       	mov    $0x1759,%edx
+    1757:	0f 34                	sysenter
+    1759:	c3                   	ret
+
+0000175a <mknod>:
+SYSCALL(mknod)
+    175a:	b8 11 00 00 00       	mov    $0x11,%eax
+    175f:	89 e1                	mov    %esp,%ecx
+    1761:	ba 68 17 00 00       	mov    $0x1768,%edx
+    1766:	0f 34                	sysenter
+    1768:	c3                   	ret
+
+00001769 <unlink>:
+SYSCALL(unlink)
+    1769:	b8 12 00 00 00       	mov    $0x12,%eax
+    176e:	89 e1                	mov    %esp,%ecx
+    1770:	ba 77 17 00 00       	mov    $0x1777,%edx
+    1775:	0f 34                	sysenter
+    1777:	c3                   	ret
+
+00001778 <fstat>:
+SYSCALL(fstat)
+    1778:	b8 08 00 00 00       	mov    $0x8,%eax
+    177d:	89 e1                	mov    %esp,%ecx
+    177f:	ba 86 17 00 00       	mov    $0x1786,%edx
+    1784:	0f 34                	sysenter
+    1786:	c3                   	ret
+
+00001787 <link>:
+SYSCALL(link)
+    1787:	b8 13 00 00 00       	mov    $0x13,%eax
+    178c:	89 e1                	mov    %esp,%ecx
+    178e:	ba 95 17 00 00       	mov    $0x1795,%edx
+    1793:	0f 34                	sysenter
+    1795:	c3                   	ret
+
+00001796 <mkdir>:
+SYSCALL(mkdir)
+    1796:	b8 14 00 00 00       	mov    $0x14,%eax
+    179b:	89 e1                	mov    %esp,%ecx
+    179d:	ba a4 17 00 00       	mov    $0x17a4,%edx
+    17a2:	0f 34                	sysenter
+    17a4:	c3                   	ret
+
+000017a5 <chdir>:
+SYSCALL(chdir)
+    17a5:	b8 09 00 00 00       	mov    $0x9,%eax
+    17aa:	89 e1                	mov    %esp,%ecx
+    17ac:	ba b3 17 00 00       	mov    $0x17b3,%edx
+    17b1:	0f 34                	sysenter
+    17b3:	c3                   	ret
+
+000017b4 <dup>:
+SYSCALL(dup)
+    17b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    17b9:	89 e1                	mov    %esp,%ecx
+    17bb:	ba c2 17 00 00       	mov    $0x17c2,%edx
+    17c0:	0f 34                	sysenter
+    17c2:	c3                   	ret
+
+000017c3 <getpid>:
+SYSCALL(getpid)
+    17c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    17c8:	89 e1                	mov    %esp,%ecx
+    17ca:	ba d1 17 00 00       	mov    $0x17d1,%edx
+    17cf:	0f 34                	sysenter
+    17d1:	c3                   	ret
+
+000017d2 <sbrk>:
+SYSCALL(sbrk)
+    17d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    17d7:	89 e1                	mov    %esp,%ecx
+    17d9:	ba e0 17 00 00       	mov    $0x17e0,%edx
+    17de:	0f 34                	sysenter
+    17e0:	c3                   	ret
+
+000017e1 <sleep>:
+SYSCALL(sleep)
+    17e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    17e6:	89 e1                	mov    %esp,%ecx
+    17e8:	ba ef 17 00 00       	mov    $0x17ef,%edx
+    17ed:	0f 34                	sysenter
+    17ef:	c3                   	ret
+
+000017f0 <uptime>:
+SYSCALL(uptime)
+    17f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    17f5:	89 e1                	mov    %esp,%ecx
+    17f7:	ba fe 17 00 00       	mov    $0x17fe,%edx
+    17fc:	0f 34                	sysenter
+    17fe:	c3                   	ret
+
+000017ff <mprotect>:
+SYSCALL(mprotect)
+    17ff:	b8 16 00 00 00       	mov    $0x16,%eax
+    1804:	89 e1                	mov    %esp,%ecx
+    1806:	ba 0d 18 00 00       	mov    $0x180d,%edx
+    180b:	0f 34                	sysenter
+    180d:	c3                   	ret
+
+0000180e <munprotect>:
+SYSCALL(munprotect)
+    180e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1813:	89 e1                	mov    %esp,%ecx
+    1815:	ba 1c 18 00 00       	mov    $0x181c,%edx
+    181a:	0f 34                	sysenter
+    181c:	c3                   	ret
+
+0000181d <kstat>:
+SYSCALL(kstat)
+    181d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1822:	89 e1                	mov    %esp,%ecx
+    1824:	ba 2b 18 00 00       	mov    $0x182b,%edx
+    1829:	0f 34                	sysenter
+    182b:	c3                   	ret
+
+0000182c <fcntl>:
+SYSCALL(fcntl)
+    182c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1831:	89 e1                	mov    %esp,%ecx
+    1833:	ba 3a 18 00 00       	mov    $0x183a,%edx
+    1838:	0f 34                	sysenter
+    183a:	c3                   	ret
+
+0000183b <splice>:
+SYSCALL(splice)
+    183b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1840:	89 e1                	mov    %esp,%ecx
+    1842:	ba 49 18 00 00       	mov    $0x1849,%edx
+    1847:	0f 34                	sysenter
+    1849:	c3                   	ret
+
+0000184a <sendfile>:
+SYSCALL(sendfile)
+    184a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    184f:	89 e1                	mov    %esp,%ecx
+    1851:	ba 58 18 00 00       	mov    $0x1858,%edx
+    1856:	0f 34                	sysenter
+    1858:	c3                   	ret
+
+00001859 <lseek>:
+SYSCALL(lseek)
+    1859:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    185e:	89 e1                	mov    %esp,%ecx
+    1860:	ba 67 18 00 00       	mov    $0x1867,%edx
+    1865:	0f 34                	sysenter
+    1867:	c3                   	ret
+
+00001868 <pread>:
+SYSCALL(pread)
+    1868:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    186d:	89 e1                	mov    %esp,%ecx
+    186f:	ba 76 18 00 00       	mov    $0x1876,%edx
+    1874:	0f 34                	sysenter
+    1876:	c3                   	ret
+
+00001877 <pwrite>:
+SYSCALL(pwrite)
+    1877:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    187c:	89 e1                	mov    %esp,%ecx
+    187e:	ba 85 18 00 00       	mov    $0x1885,%edx
+    1883:	0f 34                	sysenter
+    1885:	c3                   	ret
+
+00001886 <readv>:
+SYSCALL(readv)
+    1886:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    188b:	89 e1                	mov    %esp,%ecx
+    188d:	ba 94 18 00 00       	mov    $0x1894,%edx
+    1892:	0f 34                	sysenter
+    1894:	c3                   	ret
+
+00001895 <writev>:
+SYSCALL(writev)
+    1895:	b8 20 00 00 00       	mov    $0x20,%eax
+    189a:	89 e1                	mov    %esp,%ecx
+    189c:	ba a3 18 00 00       	mov    $0x18a3,%edx
+    18a1:	0f 34                	sysenter
+    18a3:	c3                   	ret
+
+000018a4 <ringsetup>:
+SYSCALL(ringsetup)
+    18a4:	b8 21 00 00 00       	mov    $0x21,%eax
+    18a9:	89 e1                	mov    %esp,%ecx
+    18ab:	ba b2 18 00 00       	mov    $0x18b2,%edx
+    18b0:	0f 34                	sysenter
+    18b2:	c3                   	ret
+
+000018b3 <ringenter>:
+SYSCALL(ringenter)
+    18b3:	b8 22 00 00 00       	mov    $0x22,%eax
+    18b8:	89 e1                	mov    %esp,%ecx
+    18ba:	ba c1 18 00 00       	mov    $0x18c1,%edx
+    18bf:	0f 34                	sysenter
+    18c1:	c3                   	ret
+
+000018c2 <intgetpid>:
+INTSYSCALL(getpid)
+    18c2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    18c7:	cd 40                	int    $0x40
+    18c9:	c3                   	ret
+    18ca:	66 90                	xchg   %ax,%ax
+    18cc:	66 90                	xchg   %ax,%ax
+    18ce:	66 90                	xchg   %ax,%ax
+
+000018d0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    18d0:	55                   	push   %ebp
+    18d1:	89 e5                	mov    %esp,%ebp
+    18d3:	57                   	push   %edi
+    18d4:	56                   	push   %esi
+    18d5:	53                   	push   %ebx
+    18d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    18d8:	89 d1                	mov    %edx,%ecx
+{
+    18da:	83 ec 2c             	sub    $0x2c,%esp
+    18dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    18e0:	85 d2                	test   %edx,%edx
+    18e2:	0f 89 c0 00 00 00    	jns    19a8 <printint+0xd8>
+    18e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    18ec:	0f 84 b6 00 00 00    	je     19a8 <printint+0xd8>
+    x = -xx;
+    18f2:	f7 d9                	neg    %ecx
+    neg = 1;
+    18f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    18f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    18fc:	31 f6                	xor    %esi,%esi
+    18fe:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1900:	89 c8                	mov    %ecx,%eax
+    1902:	31 d2                	xor    %edx,%edx
+    1904:	89 f7                	mov    %esi,%edi
+    1906:	f7 f3                	div    %ebx
+    1908:	8d 76 01             	lea    0x1(%esi),%esi
+    190b:	0f b6 92 40 26 00 00 	movzbl 0x2640(%edx),%edx
+    1912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1916:	89 ca                	mov    %ecx,%edx
+    1918:	89 c1                	mov    %eax,%ecx
+    191a:	39 da                	cmp    %ebx,%edx
+    191c:	73 e2                	jae    1900 <printint+0x30>
+  if(neg)
+    191e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1921:	85 c0                	test   %eax,%eax
+    1923:	74 07                	je     192c <printint+0x5c>
+    buf[i++] = '-';
+    1925:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    192a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    192c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    192f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1932:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1934:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1937:	8b 41 08             	mov    0x8(%ecx),%eax
+    193a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    193d:	89 ce                	mov    %ecx,%esi
+    193f:	eb 1c                	jmp    195d <printint+0x8d>
+    1941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1948:	89 c1                	mov    %eax,%ecx
+    194a:	83 c0 01             	add    $0x1,%eax
+    194d:	89 46 08             	mov    %eax,0x8(%esi)
+    1950:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1954:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1957:	39 df                	cmp    %ebx,%edi
+    1959:	74 41                	je     199c <printint+0xcc>
+    195b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    195d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1960:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1965:	75 e1                	jne    1948 <printint+0x78>
+  if(o->f)
+    1967:	8b 06                	mov    (%esi),%eax
+    1969:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    196c:	85 c0                	test   %eax,%eax
+    196e:	74 40                	je     19b0 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1970:	50                   	push   %eax
+    1971:	68 80 00 00 00       	push   $0x80
+    1976:	6a 01                	push   $0x1
+    1978:	ff 75 d4             	push   -0x2c(%ebp)
+    197b:	e8 a0 04 00 00       	call   1e20 <fwrite>
+    1980:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1984:	83 c4 10             	add    $0x10,%esp
+}
+    1987:	b8 01 00 00 00       	mov    $0x1,%eax
+    198c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    198e:	89 46 08             	mov    %eax,0x8(%esi)
+    1991:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1995:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1998:	39 df                	cmp    %ebx,%edi
+    199a:	75 bf                	jne    195b <printint+0x8b>
+}
+    199c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    199f:	5b                   	pop    %ebx
+    19a0:	5e                   	pop    %esi
+    19a1:	5f                   	pop    %edi
+    19a2:	5d                   	pop    %ebp
+    19a3:	c3                   	ret
+    19a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    19a8:	31 c0                	xor    %eax,%eax
+    19aa:	e9 4a ff ff ff       	jmp    18f9 <printint+0x29>
+    19af:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    19b0:	83 ec 04             	sub    $0x4,%esp
+    19b3:	68 80 00 00 00       	push   $0x80
+    19b8:	ff 75 d4             	push   -0x2c(%ebp)
+    19bb:	ff 76 04             	push   0x4(%esi)
+    19be:	e8 4c fd ff ff       	call   170f <write>
+    19c3:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    19c7:	83 c4 10             	add    $0x10,%esp
+    19ca:	eb bb                	jmp    1987 <printint+0xb7>
+    19cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000019d0 <putc>:
+{
+    19d0:	55                   	push   %ebp
+    19d1:	89 e5                	mov    %esp,%ebp
+    19d3:	56                   	push   %esi
+    19d4:	89 d6                	mov    %edx,%esi
+    19d6:	53                   	push   %ebx
+    19d7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    19d9:	8b 40 08             	mov    0x8(%eax),%eax
+    19dc:	3d 80 00 00 00       	cmp    $0x80,%eax
+    19e1:	74 1d                	je     1a00 <putc+0x30>
+  o->buf[o->n++] = c;
+    19e3:	89 f1                	mov    %esi,%ecx
+    19e5:	8d 50 01             	lea    0x1(%eax),%edx
+    19e8:	89 53 08             	mov    %edx,0x8(%ebx)
+    19eb:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    19ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    19f2:	5b                   	pop    %ebx
+    19f3:	5e                   	pop    %esi
+    19f4:	5d                   	pop    %ebp
+    19f5:	c3                   	ret
+    19f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19fd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1a00:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1a02:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1a05:	85 c0                	test   %eax,%eax
+    1a07:	74 2f                	je     1a38 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1a09:	50                   	push   %eax
+    1a0a:	68 80 00 00 00       	push   $0x80
+    1a0f:	6a 01                	push   $0x1
+    1a11:	52                   	push   %edx
+    1a12:	e8 09 04 00 00       	call   1e20 <fwrite>
+    1a17:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    1a1a:	89 f1                	mov    %esi,%ecx
+}
+    1a1c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1a21:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1a23:	89 53 08             	mov    %edx,0x8(%ebx)
+    1a26:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    1a2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1a2d:	5b                   	pop    %ebx
+    1a2e:	5e                   	pop    %esi
+    1a2f:	5d                   	pop    %ebp
+    1a30:	c3                   	ret
+    1a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1a38:	83 ec 04             	sub    $0x4,%esp
+    1a3b:	68 80 00 00 00       	push   $0x80
+    1a40:	52                   	push   %edx
+    1a41:	ff 73 04             	push   0x4(%ebx)
+    1a44:	e8 c6 fc ff ff       	call   170f <write>
+    1a49:	83 c4 10             	add    $0x10,%esp
+    1a4c:	eb cc                	jmp    1a1a <putc+0x4a>
+    1a4e:	66 90                	xchg   %ax,%ax
+
+00001a50 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1a50:	55                   	push   %ebp
+    1a51:	89 e5                	mov    %esp,%ebp
+    1a53:	57                   	push   %edi
+    1a54:	89 c7                	mov    %eax,%edi
+    1a56:	56                   	push   %esi
+    1a57:	31 f6                	xor    %esi,%esi
+    1a59:	53                   	push   %ebx
+    1a5a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1a5d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1a60:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1a63:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1a66:	84 c0                	test   %al,%al
+    1a68:	75 1e                	jne    1a88 <vprintf.constprop.0+0x38>
+    1a6a:	eb 53                	jmp    1abf <vprintf.constprop.0+0x6f>
+    1a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1a70:	83 f8 25             	cmp    $0x25,%eax
+    1a73:	74 3b                	je     1ab0 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1a75:	89 ca                	mov    %ecx,%edx
+    1a77:	89 f8                	mov    %edi,%eax
+    1a79:	e8 52 ff ff ff       	call   19d0 <putc>
+  for(i = 0; fmt[i]; i++){
+    1a7e:	0f b6 03             	movzbl (%ebx),%eax
+    1a81:	83 c3 01             	add    $0x1,%ebx
+    1a84:	84 c0                	test   %al,%al
+    1a86:	74 37                	je     1abf <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1a88:	0f be c8             	movsbl %al,%ecx
+    1a8b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    1a8e:	85 f6                	test   %esi,%esi
+    1a90:	74 de                	je     1a70 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1a92:	83 fe 25             	cmp    $0x25,%esi
+    1a95:	75 e7                	jne    1a7e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1a97:	83 f8 25             	cmp    $0x25,%eax
+    1a9a:	74 4e                	je     1aea <vprintf.constprop.0+0x9a>
+    1a9c:	83 e8 63             	sub    $0x63,%eax
+    1a9f:	83 f8 15             	cmp    $0x15,%eax
+    1aa2:	77 34                	ja     1ad8 <vprintf.constprop.0+0x88>
+    1aa4:	ff 24 85 e8 25 00 00 	jmp    *0x25e8(,%eax,4)
+    1aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1aaf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1ab0:	0f b6 03             	movzbl (%ebx),%eax
+    1ab3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1ab6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    1abb:	84 c0                	test   %al,%al
+    1abd:	75 c9                	jne    1a88 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    1abf:	8b 47 08             	mov    0x8(%edi),%eax
+    1ac2:	85 c0                	test   %eax,%eax
+    1ac4:	0f 8f de 00 00 00    	jg     1ba8 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    1aca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1acd:	5b                   	pop    %ebx
+    1ace:	5e                   	pop    %esi
+    1acf:	5f                   	pop    %edi
+    1ad0:	5d                   	pop    %ebp
+    1ad1:	c3                   	ret
+    1ad2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1ad8:	ba 25 00 00 00       	mov    $0x25,%edx
+    1add:	89 f8                	mov    %edi,%eax
+    1adf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1ae2:	e8 e9 fe ff ff       	call   19d0 <putc>
+        putc(o, c);
+    1ae7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1aea:	89 ca                	mov    %ecx,%edx
+    1aec:	89 f8                	mov    %edi,%eax
+      state = 0;
+    1aee:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1af0:	e8 db fe ff ff       	call   19d0 <putc>
+    1af5:	eb 87                	jmp    1a7e <vprintf.constprop.0+0x2e>
+    1af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afe:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1b00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b03:	83 ec 0c             	sub    $0xc,%esp
+    1b06:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1b0b:	8b 16                	mov    (%esi),%edx
+    1b0d:	6a 00                	push   $0x0
+        ap++;
+    1b0f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1b12:	89 f8                	mov    %edi,%eax
+    1b14:	e8 b7 fd ff ff       	call   18d0 <printint>
+        ap++;
+    1b19:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    1b1c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1b1f:	31 f6                	xor    %esi,%esi
+    1b21:	e9 58 ff ff ff       	jmp    1a7e <vprintf.constprop.0+0x2e>
+    1b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b2d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1b30:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b33:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1b35:	83 c0 04             	add    $0x4,%eax
+    1b38:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    1b3b:	85 f6                	test   %esi,%esi
+    1b3d:	75 1b                	jne    1b5a <vprintf.constprop.0+0x10a>
+    1b3f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1b44:	be de 25 00 00       	mov    $0x25de,%esi
+    1b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1b50:	89 f8                	mov    %edi,%eax
+          s++;
+    1b52:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1b55:	e8 76 fe ff ff       	call   19d0 <putc>
+        while(*s != 0){
+    1b5a:	0f be 16             	movsbl (%esi),%edx
+    1b5d:	84 d2                	test   %dl,%dl
+    1b5f:	75 ef                	jne    1b50 <vprintf.constprop.0+0x100>
+      state = 0;
+    1b61:	31 f6                	xor    %esi,%esi
+    1b63:	e9 16 ff ff ff       	jmp    1a7e <vprintf.constprop.0+0x2e>
+    1b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b6f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1b70:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b73:	83 ec 0c             	sub    $0xc,%esp
+    1b76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1b7b:	8b 16                	mov    (%esi),%edx
+    1b7d:	6a 01                	push   $0x1
+    1b7f:	eb 8e                	jmp    1b0f <vprintf.constprop.0+0xbf>
+    1b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1b88:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b8b:	89 f8                	mov    %edi,%eax
+    1b8d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1b90:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1b93:	e8 38 fe ff ff       	call   19d0 <putc>
+        ap++;
+    1b98:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    1b9b:	31 f6                	xor    %esi,%esi
+    1b9d:	e9 dc fe ff ff       	jmp    1a7e <vprintf.constprop.0+0x2e>
+    1ba2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1ba8:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    1baa:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    1bad:	85 d2                	test   %edx,%edx
+    1baf:	74 1f                	je     1bd0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1bb1:	52                   	push   %edx
+    1bb2:	50                   	push   %eax
+    1bb3:	6a 01                	push   $0x1
+    1bb5:	51                   	push   %ecx
+    1bb6:	e8 65 02 00 00       	call   1e20 <fwrite>
+    1bbb:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1bbe:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1bc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bc8:	5b                   	pop    %ebx
+    1bc9:	5e                   	pop    %esi
+    1bca:	5f                   	pop    %edi
+    1bcb:	5d                   	pop    %ebp
+    1bcc:	c3                   	ret
+    1bcd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1bd0:	83 ec 04             	sub    $0x4,%esp
+    1bd3:	50                   	push   %eax
+    1bd4:	51                   	push   %ecx
+    1bd5:	ff 77 04             	push   0x4(%edi)
+    1bd8:	e8 32 fb ff ff       	call   170f <write>
+    1bdd:	83 c4 10             	add    $0x10,%esp
+    1be0:	eb dc                	jmp    1bbe <vprintf.constprop.0+0x16e>
+    1be2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001bf0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1bf0:	55                   	push   %ebp
+    1bf1:	89 e5                	mov    %esp,%ebp
+    1bf3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1bf9:	a1 c4 2d 00 00       	mov    0x2dc4,%eax
+{
+    1bfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1c01:	83 fa 01             	cmp    $0x1,%edx
+    1c04:	74 0c                	je     1c12 <printf+0x22>
+    1c06:	31 c0                	xor    %eax,%eax
+    1c08:	83 fa 02             	cmp    $0x2,%edx
+    1c0b:	0f 44 05 c0 2d 00 00 	cmove  0x2dc0,%eax
+  o.fd = fd;
+    1c12:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1c18:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1c1b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1c1e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1c24:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1c2a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1c31:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1c34:	e8 17 fe ff ff       	call   1a50 <vprintf.constprop.0>
+}
+    1c39:	c9                   	leave
+    1c3a:	c3                   	ret
+    1c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c3f:	90                   	nop
+
+00001c40 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1c40:	55                   	push   %ebp
+    1c41:	89 e5                	mov    %esp,%ebp
+    1c43:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1c49:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1c4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1c4f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1c52:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1c59:	ff ff ff 
+  o.n = 0;
+    1c5c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1c63:	00 00 00 
+  o.f = f;
+    1c66:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1c6c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1c72:	e8 d9 fd ff ff       	call   1a50 <vprintf.constprop.0>
+}
+    1c77:	c9                   	leave
+    1c78:	c3                   	ret
+    1c79:	66 90                	xchg   %ax,%ax
+    1c7b:	66 90                	xchg   %ax,%ax
+    1c7d:	66 90                	xchg   %ax,%ax
+    1c7f:	90                   	nop
+
+00001c80 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1c80:	55                   	push   %ebp
+    1c81:	89 e5                	mov    %esp,%ebp
+    1c83:	53                   	push   %ebx
+    1c84:	89 c3                	mov    %eax,%ebx
+    1c86:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1c89:	8b 40 0c             	mov    0xc(%eax),%eax
+    1c8c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c8f:	74 17                	je     1ca8 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1c91:	83 f8 02             	cmp    $0x2,%eax
+    1c94:	74 07                	je     1c9d <setmode+0x1d>
+    1c96:	8b 43 18             	mov    0x18(%ebx),%eax
+    1c99:	85 c0                	test   %eax,%eax
+    1c9b:	74 38                	je     1cd5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1c9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ca0:	c9                   	leave
+    1ca1:	c3                   	ret
+    1ca2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1ca8:	83 ec 08             	sub    $0x8,%esp
+    1cab:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1cae:	50                   	push   %eax
+    1caf:	ff 33                	push   (%ebx)
+    1cb1:	e8 c2 fa ff ff       	call   1778 <fstat>
+    1cb6:	83 c4 10             	add    $0x10,%esp
+    1cb9:	89 c2                	mov    %eax,%edx
+    1cbb:	31 c0                	xor    %eax,%eax
+    1cbd:	85 d2                	test   %edx,%edx
+    1cbf:	75 0a                	jne    1ccb <setmode+0x4b>
+    1cc1:	31 c0                	xor    %eax,%eax
+    1cc3:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1cc8:	0f 94 c0             	sete   %al
+    1ccb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1cce:	8b 43 18             	mov    0x18(%ebx),%eax
+    1cd1:	85 c0                	test   %eax,%eax
+    1cd3:	75 c8                	jne    1c9d <setmode+0x1d>
+    1cd5:	83 ec 0c             	sub    $0xc,%esp
+    1cd8:	68 00 04 00 00       	push   $0x400
+    1cdd:	e8 de 07 00 00       	call   24c0 <malloc>
+    1ce2:	83 c4 10             	add    $0x10,%esp
+    1ce5:	89 43 18             	mov    %eax,0x18(%ebx)
+    1ce8:	85 c0                	test   %eax,%eax
+    1cea:	75 b1                	jne    1c9d <setmode+0x1d>
+    f->mode = IONBF;
+    1cec:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1cf3:	eb a8                	jmp    1c9d <setmode+0x1d>
+    1cf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001d00 <drain>:
+{
+    1d00:	55                   	push   %ebp
+    1d01:	89 e5                	mov    %esp,%ebp
+    1d03:	57                   	push   %edi
+    1d04:	56                   	push   %esi
+    1d05:	53                   	push   %ebx
+    1d06:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1d09:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1d0c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1d0f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1d16:	85 ff                	test   %edi,%edi
+    1d18:	7f 0e                	jg     1d28 <drain+0x28>
+  return 0;
+    1d1a:	31 c0                	xor    %eax,%eax
+}
+    1d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d1f:	5b                   	pop    %ebx
+    1d20:	5e                   	pop    %esi
+    1d21:	5f                   	pop    %edi
+    1d22:	5d                   	pop    %ebp
+    1d23:	c3                   	ret
+    1d24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1d28:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1d2b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1d2e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1d30:	eb 0e                	jmp    1d40 <drain+0x40>
+    1d32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1d38:	29 c7                	sub    %eax,%edi
+    1d3a:	01 c3                	add    %eax,%ebx
+    1d3c:	85 ff                	test   %edi,%edi
+    1d3e:	7e da                	jle    1d1a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1d40:	83 ec 04             	sub    $0x4,%esp
+    1d43:	57                   	push   %edi
+    1d44:	53                   	push   %ebx
+    1d45:	56                   	push   %esi
+    1d46:	e8 c4 f9 ff ff       	call   170f <write>
+    1d4b:	83 c4 10             	add    $0x10,%esp
+    1d4e:	85 c0                	test   %eax,%eax
+    1d50:	7f e6                	jg     1d38 <drain+0x38>
+    f->err = 1;
+    1d52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1d55:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1d5c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d61:	eb b9                	jmp    1d1c <drain+0x1c>
+    1d63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001d70 <flushall>:
+
+static void
+flushall(void)
+{
+    1d70:	55                   	push   %ebp
+    1d71:	89 e5                	mov    %esp,%ebp
+    1d73:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d74:	bb e0 2d 00 00       	mov    $0x2de0,%ebx
+{
+    1d79:	83 ec 04             	sub    $0x4,%esp
+    1d7c:	eb 0d                	jmp    1d8b <flushall+0x1b>
+    1d7e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d80:	83 c3 24             	add    $0x24,%ebx
+    1d83:	81 fb 20 30 00 00    	cmp    $0x3020,%ebx
+    1d89:	74 19                	je     1da4 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1d8b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1d8e:	85 c0                	test   %eax,%eax
+    1d90:	74 ee                	je     1d80 <flushall+0x10>
+    1d92:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d94:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1d97:	e8 64 ff ff ff       	call   1d00 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d9c:	81 fb 20 30 00 00    	cmp    $0x3020,%ebx
+    1da2:	75 e7                	jne    1d8b <flushall+0x1b>
+}
+    1da4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1da7:	c9                   	leave
+    1da8:	c3                   	ret
+    1da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001db0 <fflush>:
+{
+    1db0:	55                   	push   %ebp
+    1db1:	89 e5                	mov    %esp,%ebp
+    1db3:	57                   	push   %edi
+    1db4:	56                   	push   %esi
+    1db5:	53                   	push   %ebx
+    1db6:	83 ec 0c             	sub    $0xc,%esp
+    1db9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1dbc:	85 c0                	test   %eax,%eax
+    1dbe:	74 28                	je     1de8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1dc0:	8b 70 08             	mov    0x8(%eax),%esi
+    1dc3:	85 f6                	test   %esi,%esi
+    1dc5:	75 11                	jne    1dd8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1dc7:	83 c4 0c             	add    $0xc,%esp
+    1dca:	89 f0                	mov    %esi,%eax
+    1dcc:	5b                   	pop    %ebx
+    1dcd:	5e                   	pop    %esi
+    1dce:	5f                   	pop    %edi
+    1dcf:	5d                   	pop    %ebp
+    1dd0:	c3                   	ret
+    1dd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dd8:	83 c4 0c             	add    $0xc,%esp
+    1ddb:	5b                   	pop    %ebx
+    1ddc:	5e                   	pop    %esi
+    1ddd:	5f                   	pop    %edi
+    1dde:	5d                   	pop    %ebp
+  return drain(f);
+    1ddf:	e9 1c ff ff ff       	jmp    1d00 <drain>
+    1de4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1de8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1dea:	bb e0 2d 00 00       	mov    $0x2de0,%ebx
+        r = -1;
+    1def:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1df4:	eb 15                	jmp    1e0b <fflush+0x5b>
+    1df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1e00:	83 c3 24             	add    $0x24,%ebx
+    1e03:	81 fb 20 30 00 00    	cmp    $0x3020,%ebx
+    1e09:	74 bc                	je     1dc7 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1e0b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1e0e:	85 c0                	test   %eax,%eax
+    1e10:	74 ee                	je     1e00 <fflush+0x50>
+    1e12:	89 d8                	mov    %ebx,%eax
+    1e14:	e8 e7 fe ff ff       	call   1d00 <drain>
+        r = -1;
+    1e19:	85 c0                	test   %eax,%eax
+    1e1b:	0f 48 f7             	cmovs  %edi,%esi
+    1e1e:	eb e0                	jmp    1e00 <fflush+0x50>
+
+00001e20 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1e20:	55                   	push   %ebp
+    1e21:	89 e5                	mov    %esp,%ebp
+    1e23:	57                   	push   %edi
+    1e24:	56                   	push   %esi
+    1e25:	53                   	push   %ebx
+    1e26:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1e29:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1e2c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1e30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1e33:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1e36:	85 d2                	test   %edx,%edx
+    1e38:	0f 8e 26 01 00 00    	jle    1f64 <fwrite+0x144>
+  if(!f->writable){
+    1e3e:	8b 46 08             	mov    0x8(%esi),%eax
+    1e41:	85 c0                	test   %eax,%eax
+    1e43:	0f 84 14 01 00 00    	je     1f5d <fwrite+0x13d>
+  setmode(f);
+    1e49:	89 f0                	mov    %esi,%eax
+    1e4b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1e4e:	e8 2d fe ff ff       	call   1c80 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1e53:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1e57:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1e5a:	c7 05 20 34 00 00 70 	movl   $0x1d70,0x3420
+    1e61:	1d 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1e64:	0f 84 b6 00 00 00    	je     1f20 <fwrite+0x100>
+    1e6a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1e70:	0f 8f aa 00 00 00    	jg     1f20 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1e76:	8b 46 20             	mov    0x20(%esi),%eax
+    1e79:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1e7c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1e7e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1e83:	74 6c                	je     1ef1 <fwrite+0xd1>
+    1e85:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1e88:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1e8b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1e90:	29 c2                	sub    %eax,%edx
+    1e92:	39 ca                	cmp    %ecx,%edx
+    1e94:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1e97:	85 d2                	test   %edx,%edx
+    1e99:	0f 8e d1 00 00 00    	jle    1f70 <fwrite+0x150>
+    1e9f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1ea2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1ea5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1eaf:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1eb0:	8d 50 01             	lea    0x1(%eax),%edx
+    1eb3:	83 c3 01             	add    $0x1,%ebx
+    1eb6:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1eb9:	89 56 20             	mov    %edx,0x20(%esi)
+    1ebc:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1ec0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1ec3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1ec6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1ecb:	80 fa 0a             	cmp    $0xa,%dl
+    1ece:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1ed1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1ed4:	39 cb                	cmp    %ecx,%ebx
+    1ed6:	75 d8                	jne    1eb0 <fwrite+0x90>
+    1ed8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1edb:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1ede:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1ee1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1ee4:	85 db                	test   %ebx,%ebx
+    1ee6:	7e 19                	jle    1f01 <fwrite+0xe1>
+    n -= k;
+    1ee8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1eea:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1eef:	75 97                	jne    1e88 <fwrite+0x68>
+    1ef1:	89 f0                	mov    %esi,%eax
+    1ef3:	e8 08 fe ff ff       	call   1d00 <drain>
+    1ef8:	85 c0                	test   %eax,%eax
+    1efa:	78 68                	js     1f64 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1efc:	8b 46 20             	mov    0x20(%esi),%eax
+    1eff:	eb 87                	jmp    1e88 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1f01:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1f06:	74 74                	je     1f7c <fwrite+0x15c>
+    1f08:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1f0c:	75 04                	jne    1f12 <fwrite+0xf2>
+    1f0e:	85 ff                	test   %edi,%edi
+    1f10:	75 6a                	jne    1f7c <fwrite+0x15c>
+    return nmemb;
+    1f12:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1f15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f18:	5b                   	pop    %ebx
+    1f19:	5e                   	pop    %esi
+    1f1a:	5f                   	pop    %edi
+    1f1b:	5d                   	pop    %ebp
+    1f1c:	c3                   	ret
+    1f1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1f20:	89 f0                	mov    %esi,%eax
+    1f22:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1f25:	e8 d6 fd ff ff       	call   1d00 <drain>
+    1f2a:	85 c0                	test   %eax,%eax
+    1f2c:	78 2f                	js     1f5d <fwrite+0x13d>
+    1f2e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1f31:	8b 3e                	mov    (%esi),%edi
+    1f33:	89 de                	mov    %ebx,%esi
+    1f35:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1f38:	eb 0e                	jmp    1f48 <fwrite+0x128>
+    1f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1f40:	29 c3                	sub    %eax,%ebx
+    1f42:	01 c6                	add    %eax,%esi
+    1f44:	85 db                	test   %ebx,%ebx
+    1f46:	7e ca                	jle    1f12 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1f48:	83 ec 04             	sub    $0x4,%esp
+    1f4b:	53                   	push   %ebx
+    1f4c:	56                   	push   %esi
+    1f4d:	57                   	push   %edi
+    1f4e:	e8 bc f7 ff ff       	call   170f <write>
+    1f53:	83 c4 10             	add    $0x10,%esp
+    1f56:	85 c0                	test   %eax,%eax
+    1f58:	7f e6                	jg     1f40 <fwrite+0x120>
+    1f5a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1f5d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1f64:	31 c0                	xor    %eax,%eax
+}
+    1f66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f69:	5b                   	pop    %ebx
+    1f6a:	5e                   	pop    %esi
+    1f6b:	5f                   	pop    %edi
+    1f6c:	5d                   	pop    %ebp
+    1f6d:	c3                   	ret
+    1f6e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1f70:	89 d9                	mov    %ebx,%ecx
+    1f72:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1f75:	89 cb                	mov    %ecx,%ebx
+    1f77:	e9 6e ff ff ff       	jmp    1eea <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1f7c:	89 f0                	mov    %esi,%eax
+    1f7e:	e8 7d fd ff ff       	call   1d00 <drain>
+    1f83:	85 c0                	test   %eax,%eax
+    1f85:	79 8b                	jns    1f12 <fwrite+0xf2>
+    return 0;
+    1f87:	31 c0                	xor    %eax,%eax
+    1f89:	eb db                	jmp    1f66 <fwrite+0x146>
+    1f8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f8f:	90                   	nop
+
+00001f90 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1f96:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f99:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1f9c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1f9f:	ff 75 0c             	push   0xc(%ebp)
+    1fa2:	6a 01                	push   $0x1
+    1fa4:	6a 01                	push   $0x1
+    1fa6:	50                   	push   %eax
+    1fa7:	e8 74 fe ff ff       	call   1e20 <fwrite>
+    1fac:	83 c4 10             	add    $0x10,%esp
+    1faf:	83 f8 01             	cmp    $0x1,%eax
+    1fb2:	75 0c                	jne    1fc0 <fputc+0x30>
+    1fb4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1fb8:	c9                   	leave
+    1fb9:	c3                   	ret
+    1fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1fc0:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1fc1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1fc6:	c3                   	ret
+    1fc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fce:	66 90                	xchg   %ax,%ax
+
+00001fd0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1fd0:	55                   	push   %ebp
+    1fd1:	89 e5                	mov    %esp,%ebp
+    1fd3:	57                   	push   %edi
+    1fd4:	56                   	push   %esi
+    1fd5:	53                   	push   %ebx
+    1fd6:	83 ec 1c             	sub    $0x1c,%esp
+    1fd9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1fdc:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1fdf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1fe2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1fe5:	85 d2                	test   %edx,%edx
+    1fe7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1fea:	7e 12                	jle    1ffe <fread+0x2e>
+    1fec:	85 ff                	test   %edi,%edi
+    1fee:	7e 0e                	jle    1ffe <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1ff0:	8b 43 04             	mov    0x4(%ebx),%eax
+    1ff3:	85 c0                	test   %eax,%eax
+    1ff5:	75 19                	jne    2010 <fread+0x40>
+    f->err = 1;
+    1ff7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    2001:	31 c0                	xor    %eax,%eax
+}
+    2003:	5b                   	pop    %ebx
+    2004:	5e                   	pop    %esi
+    2005:	5f                   	pop    %edi
+    2006:	5d                   	pop    %ebp
+    2007:	c3                   	ret
+    2008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    200f:	90                   	nop
+  setmode(f);
+    2010:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    2012:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    2014:	e8 67 fc ff ff       	call   1c80 <setmode>
+  for(n = 0; n < want; n += k){
+    2019:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    201c:	89 f7                	mov    %esi,%edi
+    201e:	eb 31                	jmp    2051 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    2020:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    2024:	74 08                	je     202e <fread+0x5e>
+    2026:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    202c:	7e 62                	jle    2090 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    202e:	83 ec 04             	sub    $0x4,%esp
+    2031:	56                   	push   %esi
+    2032:	8b 45 08             	mov    0x8(%ebp),%eax
+    2035:	01 f8                	add    %edi,%eax
+    2037:	50                   	push   %eax
+    2038:	ff 33                	push   (%ebx)
+    203a:	e8 c1 f6 ff ff       	call   1700 <read>
+    203f:	83 c4 10             	add    $0x10,%esp
+    2042:	85 c0                	test   %eax,%eax
+    2044:	0f 8e ce 00 00 00    	jle    2118 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    204a:	01 c7                	add    %eax,%edi
+    204c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    204f:	7e 36                	jle    2087 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2051:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    2054:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    2057:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    205a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    205c:	39 c1                	cmp    %eax,%ecx
+    205e:	7d c0                	jge    2020 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2060:	29 c8                	sub    %ecx,%eax
+    2062:	39 f0                	cmp    %esi,%eax
+    2064:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    2067:	83 ec 04             	sub    $0x4,%esp
+    206a:	56                   	push   %esi
+    206b:	03 4b 18             	add    0x18(%ebx),%ecx
+    206e:	51                   	push   %ecx
+    206f:	8b 45 08             	mov    0x8(%ebp),%eax
+    2072:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    2074:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    2076:	50                   	push   %eax
+    2077:	e8 34 f5 ff ff       	call   15b0 <memmove>
+      f->r += k;
+    207c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    207f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    2082:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    2085:	7f ca                	jg     2051 <fread+0x81>
+    2087:	89 fe                	mov    %edi,%esi
+    2089:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    208c:	eb 3f                	jmp    20cd <fread+0xfd>
+    208e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    2090:	3b 1d c8 2d 00 00    	cmp    0x2dc8,%ebx
+    2096:	74 68                	je     2100 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    2098:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    209b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    20a2:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    20a9:	68 00 04 00 00       	push   $0x400
+    20ae:	ff 73 18             	push   0x18(%ebx)
+    20b1:	ff 33                	push   (%ebx)
+    20b3:	e8 48 f6 ff ff       	call   1700 <read>
+    20b8:	83 c4 10             	add    $0x10,%esp
+    20bb:	85 c0                	test   %eax,%eax
+    20bd:	78 21                	js     20e0 <fread+0x110>
+  else if(n == 0)
+    20bf:	75 2f                	jne    20f0 <fread+0x120>
+    f->eof = 1;
+    20c1:	89 fe                	mov    %edi,%esi
+    20c3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    20c6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    20cd:	89 f0                	mov    %esi,%eax
+}
+    20cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    20d2:	99                   	cltd
+}
+    20d3:	5b                   	pop    %ebx
+    20d4:	5e                   	pop    %esi
+  return n / size;
+    20d5:	f7 ff                	idiv   %edi
+}
+    20d7:	5f                   	pop    %edi
+    20d8:	5d                   	pop    %ebp
+    20d9:	c3                   	ret
+    20da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    20e0:	89 fe                	mov    %edi,%esi
+    20e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    20e5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    20ec:	eb df                	jmp    20cd <fread+0xfd>
+    20ee:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    20f0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    20f3:	e9 54 ff ff ff       	jmp    204c <fread+0x7c>
+    20f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ff:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    2100:	83 ec 0c             	sub    $0xc,%esp
+    2103:	ff 35 c4 2d 00 00    	push   0x2dc4
+    2109:	e8 a2 fc ff ff       	call   1db0 <fflush>
+    210e:	83 c4 10             	add    $0x10,%esp
+    2111:	eb 85                	jmp    2098 <fread+0xc8>
+    2113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2117:	90                   	nop
+        if(k < 0)
+    2118:	89 fe                	mov    %edi,%esi
+    211a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    211d:	74 a7                	je     20c6 <fread+0xf6>
+    211f:	eb c4                	jmp    20e5 <fread+0x115>
+    2121:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    212f:	90                   	nop
+
+00002130 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    2130:	55                   	push   %ebp
+    2131:	89 e5                	mov    %esp,%ebp
+    2133:	53                   	push   %ebx
+    2134:	83 ec 14             	sub    $0x14,%esp
+    2137:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    213a:	8b 50 04             	mov    0x4(%eax),%edx
+    213d:	85 d2                	test   %edx,%edx
+    213f:	74 08                	je     2149 <fgetc+0x19>
+    2141:	8b 50 1c             	mov    0x1c(%eax),%edx
+    2144:	3b 50 20             	cmp    0x20(%eax),%edx
+    2147:	7c 27                	jl     2170 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2149:	50                   	push   %eax
+    214a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    214d:	6a 01                	push   $0x1
+    214f:	6a 01                	push   $0x1
+    2151:	50                   	push   %eax
+    2152:	e8 79 fe ff ff       	call   1fd0 <fread>
+    2157:	83 c4 10             	add    $0x10,%esp
+    215a:	83 f8 01             	cmp    $0x1,%eax
+    215d:	75 29                	jne    2188 <fgetc+0x58>
+    215f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2163:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2166:	c9                   	leave
+    2167:	c3                   	ret
+    2168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    216f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    2170:	8b 48 18             	mov    0x18(%eax),%ecx
+    2173:	8d 5a 01             	lea    0x1(%edx),%ebx
+    2176:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    2179:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    217c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    2180:	c9                   	leave
+    2181:	c3                   	ret
+    2182:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2188:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    218d:	eb d4                	jmp    2163 <fgetc+0x33>
+    218f:	90                   	nop
+
+00002190 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    2190:	55                   	push   %ebp
+    2191:	89 e5                	mov    %esp,%ebp
+    2193:	57                   	push   %edi
+    2194:	56                   	push   %esi
+    2195:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    2196:	31 db                	xor    %ebx,%ebx
+{
+    2198:	83 ec 1c             	sub    $0x1c,%esp
+    219b:	8b 75 10             	mov    0x10(%ebp),%esi
+    219e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    21a0:	eb 2e                	jmp    21d0 <fgets+0x40>
+    21a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    21a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    21ab:	57                   	push   %edi
+    21ac:	6a 01                	push   $0x1
+    21ae:	6a 01                	push   $0x1
+    21b0:	50                   	push   %eax
+    21b1:	e8 1a fe ff ff       	call   1fd0 <fread>
+    21b6:	83 c4 10             	add    $0x10,%esp
+    21b9:	83 f8 01             	cmp    $0x1,%eax
+    21bc:	75 62                	jne    2220 <fgets+0x90>
+    21be:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    21c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    21c5:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    21c7:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    21cb:	83 f9 0a             	cmp    $0xa,%ecx
+    21ce:	74 34                	je     2204 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    21d0:	89 de                	mov    %ebx,%esi
+    21d2:	83 c3 01             	add    $0x1,%ebx
+    21d5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    21d8:	7d 46                	jge    2220 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    21da:	8b 47 04             	mov    0x4(%edi),%eax
+    21dd:	85 c0                	test   %eax,%eax
+    21df:	74 c7                	je     21a8 <fgets+0x18>
+    21e1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    21e4:	3b 47 20             	cmp    0x20(%edi),%eax
+    21e7:	7d bf                	jge    21a8 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    21e9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    21ec:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    21ef:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    21f2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    21f5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    21f9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    21fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    21ff:	83 f9 0a             	cmp    $0xa,%ecx
+    2202:	75 cc                	jne    21d0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2204:	8b 45 08             	mov    0x8(%ebp),%eax
+    2207:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    220b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    220e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2211:	5b                   	pop    %ebx
+    2212:	5e                   	pop    %esi
+    2213:	5f                   	pop    %edi
+    2214:	5d                   	pop    %ebp
+    2215:	c3                   	ret
+    2216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    221d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2220:	8b 45 08             	mov    0x8(%ebp),%eax
+    2223:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2227:	31 c0                	xor    %eax,%eax
+    2229:	85 f6                	test   %esi,%esi
+    222b:	74 e1                	je     220e <fgets+0x7e>
+    222d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2230:	eb dc                	jmp    220e <fgets+0x7e>
+    2232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002240 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    2240:	55                   	push   %ebp
+    2241:	89 e5                	mov    %esp,%ebp
+    2243:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2244:	bb e0 2d 00 00       	mov    $0x2de0,%ebx
+{
+    2249:	83 ec 04             	sub    $0x4,%esp
+    224c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    2250:	8b 53 04             	mov    0x4(%ebx),%edx
+    2253:	85 d2                	test   %edx,%edx
+    2255:	75 07                	jne    225e <fdopen+0x1e>
+    2257:	8b 43 08             	mov    0x8(%ebx),%eax
+    225a:	85 c0                	test   %eax,%eax
+    225c:	74 1a                	je     2278 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    225e:	83 c3 24             	add    $0x24,%ebx
+    2261:	81 fb 20 30 00 00    	cmp    $0x3020,%ebx
+    2267:	75 e7                	jne    2250 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2269:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    226b:	89 d8                	mov    %ebx,%eax
+    226d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2270:	c9                   	leave
+    2271:	c3                   	ret
+    2272:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2278:	81 fb 20 30 00 00    	cmp    $0x3020,%ebx
+    227e:	74 e9                	je     2269 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2280:	83 ec 04             	sub    $0x4,%esp
+    2283:	6a 24                	push   $0x24
+    2285:	6a 00                	push   $0x0
+    2287:	53                   	push   %ebx
+    2288:	e8 d3 f1 ff ff       	call   1460 <memset>
+  f->fd = fd;
+    228d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2290:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2297:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    229a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    229c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    229f:	80 38 72             	cmpb   $0x72,(%eax)
+    22a2:	74 14                	je     22b8 <fdopen+0x78>
+    f->writable = 1;
+    22a4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    22ab:	89 d8                	mov    %ebx,%eax
+    22ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    22b0:	c9                   	leave
+    22b1:	c3                   	ret
+    22b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    22b8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    22bf:	89 d8                	mov    %ebx,%eax
+    22c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    22c4:	c9                   	leave
+    22c5:	c3                   	ret
+    22c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000022d0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    22d0:	55                   	push   %ebp
+    22d1:	89 e5                	mov    %esp,%ebp
+    22d3:	56                   	push   %esi
+    22d4:	53                   	push   %ebx
+    22d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    22d8:	0f b6 06             	movzbl (%esi),%eax
+    22db:	3c 72                	cmp    $0x72,%al
+    22dd:	74 61                	je     2340 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    22df:	3c 77                	cmp    $0x77,%al
+    22e1:	74 7d                	je     2360 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    22e3:	3c 61                	cmp    $0x61,%al
+    22e5:	75 49                	jne    2330 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    22e7:	83 ec 08             	sub    $0x8,%esp
+    22ea:	68 01 02 00 00       	push   $0x201
+    22ef:	ff 75 08             	push   0x8(%ebp)
+    22f2:	e8 54 f4 ff ff       	call   174b <open>
+    22f7:	83 c4 10             	add    $0x10,%esp
+    22fa:	89 c3                	mov    %eax,%ebx
+    22fc:	85 c0                	test   %eax,%eax
+    22fe:	78 30                	js     2330 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2300:	83 ec 04             	sub    $0x4,%esp
+    2303:	6a 02                	push   $0x2
+    2305:	6a 00                	push   $0x0
+    2307:	50                   	push   %eax
+    2308:	e8 4c f5 ff ff       	call   1859 <lseek>
+    230d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2310:	83 ec 08             	sub    $0x8,%esp
+    2313:	56                   	push   %esi
+    2314:	53                   	push   %ebx
+    2315:	e8 26 ff ff ff       	call   2240 <fdopen>
+    231a:	83 c4 10             	add    $0x10,%esp
+    231d:	85 c0                	test   %eax,%eax
+    231f:	75 11                	jne    2332 <fopen+0x62>
+    close(fd);
+    2321:	83 ec 0c             	sub    $0xc,%esp
+    2324:	53                   	push   %ebx
+    2325:	e8 f4 f3 ff ff       	call   171e <close>
+    232a:	83 c4 10             	add    $0x10,%esp
+    232d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2330:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2332:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2335:	5b                   	pop    %ebx
+    2336:	5e                   	pop    %esi
+    2337:	5d                   	pop    %ebp
+    2338:	c3                   	ret
+    2339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2340:	83 ec 08             	sub    $0x8,%esp
+    2343:	6a 00                	push   $0x0
+    2345:	ff 75 08             	push   0x8(%ebp)
+    2348:	e8 fe f3 ff ff       	call   174b <open>
+    234d:	83 c4 10             	add    $0x10,%esp
+    2350:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2352:	85 db                	test   %ebx,%ebx
+    2354:	78 da                	js     2330 <fopen+0x60>
+    2356:	eb b8                	jmp    2310 <fopen+0x40>
+    2358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    235f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2360:	83 ec 08             	sub    $0x8,%esp
+    2363:	68 01 06 00 00       	push   $0x601
+    2368:	ff 75 08             	push   0x8(%ebp)
+    236b:	e8 db f3 ff ff       	call   174b <open>
+    2370:	83 c4 10             	add    $0x10,%esp
+    2373:	89 c3                	mov    %eax,%ebx
+    2375:	eb db                	jmp    2352 <fopen+0x82>
+    2377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    237e:	66 90                	xchg   %ax,%ax
+
+00002380 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2380:	55                   	push   %ebp
+    2381:	89 e5                	mov    %esp,%ebp
+    2383:	56                   	push   %esi
+    2384:	53                   	push   %ebx
+    2385:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2388:	83 ec 0c             	sub    $0xc,%esp
+    238b:	53                   	push   %ebx
+    238c:	e8 1f fa ff ff       	call   1db0 <fflush>
+    2391:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2393:	58                   	pop    %eax
+    2394:	ff 33                	push   (%ebx)
+    2396:	e8 83 f3 ff ff       	call   171e <close>
+    239b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    239e:	85 c0                	test   %eax,%eax
+    23a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    23a5:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    23a8:	8b 43 18             	mov    0x18(%ebx),%eax
+    23ab:	85 c0                	test   %eax,%eax
+    23ad:	0f 95 c1             	setne  %cl
+    23b0:	3d 40 38 00 00       	cmp    $0x3840,%eax
+    23b5:	0f 95 c2             	setne  %dl
+    23b8:	84 d1                	test   %dl,%cl
+    23ba:	74 07                	je     23c3 <fclose+0x43>
+    23bc:	3d 40 34 00 00       	cmp    $0x3440,%eax
+    23c1:	75 25                	jne    23e8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    23c3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    23ca:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    23cc:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    23d3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    23da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    23dd:	5b                   	pop    %ebx
+    23de:	5e                   	pop    %esi
+    23df:	5d                   	pop    %ebp
+    23e0:	c3                   	ret
+    23e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    23e8:	83 ec 0c             	sub    $0xc,%esp
+    23eb:	50                   	push   %eax
+    23ec:	e8 3f 00 00 00       	call   2430 <free>
+    23f1:	83 c4 10             	add    $0x10,%esp
+    23f4:	eb cd                	jmp    23c3 <fclose+0x43>
+    23f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002400 <feof>:
+
+int
+feof(FILE *f)
+{
+    2400:	55                   	push   %ebp
+    2401:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2403:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2406:	5d                   	pop    %ebp
+  return f->eof;
+    2407:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    240a:	c3                   	ret
+    240b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    240f:	90                   	nop
+
+00002410 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2410:	55                   	push   %ebp
+    2411:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2413:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2416:	5d                   	pop    %ebp
+  return f->err;
+    2417:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    241a:	c3                   	ret
+    241b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    241f:	90                   	nop
+
+00002420 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2420:	55                   	push   %ebp
+    2421:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2423:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2426:	5d                   	pop    %ebp
+  return f->fd;
+    2427:	8b 00                	mov    (%eax),%eax
+}
+    2429:	c3                   	ret
+    242a:	66 90                	xchg   %ax,%ax
+    242c:	66 90                	xchg   %ax,%ax
+    242e:	66 90                	xchg   %ax,%ax
+
+00002430 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2430:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2431:	a1 40 3c 00 00       	mov    0x3c40,%eax
+{
+    2436:	89 e5                	mov    %esp,%ebp
+    2438:	57                   	push   %edi
+    2439:	56                   	push   %esi
+    243a:	53                   	push   %ebx
+    243b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    243e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2448:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    244a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    244c:	39 ca                	cmp    %ecx,%edx
+    244e:	73 30                	jae    2480 <free+0x50>
+    2450:	39 c1                	cmp    %eax,%ecx
+    2452:	72 04                	jb     2458 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2454:	39 c2                	cmp    %eax,%edx
+    2456:	72 f0                	jb     2448 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2458:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    245b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    245e:	39 f8                	cmp    %edi,%eax
+    2460:	74 2e                	je     2490 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2462:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2465:	8b 42 04             	mov    0x4(%edx),%eax
+    2468:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    246b:	39 f1                	cmp    %esi,%ecx
+    246d:	74 38                	je     24a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    246f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2471:	5b                   	pop    %ebx
+  freep = p;
+    2472:	89 15 40 3c 00 00    	mov    %edx,0x3c40
+}
+    2478:	5e                   	pop    %esi
+    2479:	5f                   	pop    %edi
+    247a:	5d                   	pop    %ebp
+    247b:	c3                   	ret
+    247c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2480:	39 c1                	cmp    %eax,%ecx
+    2482:	72 d0                	jb     2454 <free+0x24>
+    2484:	eb c2                	jmp    2448 <free+0x18>
+    2486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    248d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2490:	03 70 04             	add    0x4(%eax),%esi
+    2493:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2496:	8b 02                	mov    (%edx),%eax
+    2498:	8b 00                	mov    (%eax),%eax
+    249a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    249d:	8b 42 04             	mov    0x4(%edx),%eax
+    24a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    24a3:	39 f1                	cmp    %esi,%ecx
+    24a5:	75 c8                	jne    246f <free+0x3f>
+    p->s.size += bp->s.size;
+    24a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    24aa:	89 15 40 3c 00 00    	mov    %edx,0x3c40
+    p->s.size += bp->s.size;
+    24b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    24b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    24b6:	89 0a                	mov    %ecx,(%edx)
+}
+    24b8:	5b                   	pop    %ebx
+    24b9:	5e                   	pop    %esi
+    24ba:	5f                   	pop    %edi
+    24bb:	5d                   	pop    %ebp
+    24bc:	c3                   	ret
+    24bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000024c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    24c0:	55                   	push   %ebp
+    24c1:	89 e5                	mov    %esp,%ebp
+    24c3:	57                   	push   %edi
+    24c4:	56                   	push   %esi
+    24c5:	53                   	push   %ebx
+    24c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    24c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    24cc:	8b 15 40 3c 00 00    	mov    0x3c40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    24d2:	8d 78 07             	lea    0x7(%eax),%edi
+    24d5:	c1 ef 03             	shr    $0x3,%edi
+    24d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    24db:	85 d2                	test   %edx,%edx
+    24dd:	0f 84 8d 00 00 00    	je     2570 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    24e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    24e5:	8b 48 04             	mov    0x4(%eax),%ecx
+    24e8:	39 f9                	cmp    %edi,%ecx
+    24ea:	73 64                	jae    2550 <malloc+0x90>
+  if(nu < 4096)
+    24ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    24f1:	39 df                	cmp    %ebx,%edi
+    24f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    24f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    24fd:	eb 0a                	jmp    2509 <malloc+0x49>
+    24ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2500:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2502:	8b 48 04             	mov    0x4(%eax),%ecx
+    2505:	39 f9                	cmp    %edi,%ecx
+    2507:	73 47                	jae    2550 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2509:	89 c2                	mov    %eax,%edx
+    250b:	39 05 40 3c 00 00    	cmp    %eax,0x3c40
+    2511:	75 ed                	jne    2500 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2513:	83 ec 0c             	sub    $0xc,%esp
+    2516:	56                   	push   %esi
+    2517:	e8 b6 f2 ff ff       	call   17d2 <sbrk>
+  if(p == (char*)-1)
+    251c:	83 c4 10             	add    $0x10,%esp
+    251f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2522:	74 1c                	je     2540 <malloc+0x80>
+  hp->s.size = nu;
+    2524:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2527:	83 ec 0c             	sub    $0xc,%esp
+    252a:	83 c0 08             	add    $0x8,%eax
+    252d:	50                   	push   %eax
+    252e:	e8 fd fe ff ff       	call   2430 <free>
+  return freep;
+    2533:	8b 15 40 3c 00 00    	mov    0x3c40,%edx
+      if((p = morecore(nunits)) == 0)
+    2539:	83 c4 10             	add    $0x10,%esp
+    253c:	85 d2                	test   %edx,%edx
+    253e:	75 c0                	jne    2500 <malloc+0x40>
+        return 0;
+  }
+}
+    2540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2543:	31 c0                	xor    %eax,%eax
+}
+    2545:	5b                   	pop    %ebx
+    2546:	5e                   	pop    %esi
+    2547:	5f                   	pop    %edi
+    2548:	5d                   	pop    %ebp
+    2549:	c3                   	ret
+    254a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2550:	39 cf                	cmp    %ecx,%edi
+    2552:	74 4c                	je     25a0 <malloc+0xe0>
+        p->s.size -= nunits;
+    2554:	29 f9                	sub    %edi,%ecx
+    2556:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2559:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    255c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    255f:	89 15 40 3c 00 00    	mov    %edx,0x3c40
+}
+    2565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2568:	83 c0 08             	add    $0x8,%eax
+}
+    256b:	5b                   	pop    %ebx
+    256c:	5e                   	pop    %esi
+    256d:	5f                   	pop    %edi
+    256e:	5d                   	pop    %ebp
+    256f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2570:	c7 05 40 3c 00 00 44 	movl   $0x3c44,0x3c40
+    2577:	3c 00 00 
+    base.s.size = 0;
+    257a:	b8 44 3c 00 00       	mov    $0x3c44,%eax
+    base.s.ptr = freep = prevp = &base;
+    257f:	c7 05 44 3c 00 00 44 	movl   $0x3c44,0x3c44
+    2586:	3c 00 00 
+    base.s.size = 0;
+    2589:	c7 05 48 3c 00 00 00 	movl   $0x0,0x3c48
+    2590:	00 00 00 
+    if(p->s.size >= nunits){
+    2593:	e9 54 ff ff ff       	jmp    24ec <malloc+0x2c>
+    2598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    259f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    25a0:	8b 08                	mov    (%eax),%ecx
+    25a2:	89 0a                	mov    %ecx,(%edx)
+    25a4:	eb b9                	jmp    255f <malloc+0x9f>
@@ -1,4 +1,6 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code: bus-master DMA when the PCI controller offers it,
+// programmed I/O otherwise, with an elevator that merges adjacent
+// requests.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +14,8 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "kstat.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,15 +27,67 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_IDENTIFY 0xec
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+// Bus-master registers of the primary channel, from the
+// controller's BAR4.
+#define BM_CMD        0       // command
+#define BM_STATUS     2       // status
+#define BM_PRDT       4       // physical address of the PRD table
+#define BM_CMD_START  0x01    // start transfer
+#define BM_CMD_READ   0x08    // transfer is device to memory
+#define BM_STATUS_ERR 0x02    // transfer failed (write 1 to clear)
+#define BM_STATUS_INTR 0x04   // drive interrupted (write 1 to clear)
+
+// Physical region descriptor: one contiguous piece of a DMA
+// transfer, which must not cross a 64K boundary.
+struct prd {
+  uint addr;        // physical address
+  ushort count;     // bytes, 0 meaning 64K
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last descriptor in the table
+
+// Most sectors moved by one READ/WRITE MULTIPLE command;
+// ideinit() sets each drive's multiple count to this.
+#define IDE_MAXSECT   16
+
+// Most sectors moved by one DMA command.
+#define IDE_MAXDMASECT 64
+
+// Ticks a request may wait before it is started ahead of the
+// elevator order.  Reads get less, since someone usually waits on them.
+#define IDE_RDEADLINE 10
+#define IDE_WDEADLINE 50
+
+// idequeue holds requests waiting for the disk, sorted by
+// (dev, blockno).  idedispatch() sweeps upward from where the last
+// command ended (C-LOOK), wrapping to the lowest request when it
+// runs off the end, and merges the request it picks with the
+// adjacent blocks that follow it into one multi-sector command.
+// The bufs of the command in flight hang off ideactive, linked
+// through qnext.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *ideactive;
+static uint ideposdev, ideposblock;
+static struct kstat idestats;
+
+int ideirq = IRQ_IDE;
+
+// Bus-master DMA state; the PRD table is aligned so that it
+// cannot cross a 64K boundary.
+static int idedma;
+static ushort idebm;
+static struct prd prdt[2*IDE_MAXDMASECT] __attribute__((aligned(1024)));
 
 static int havedisk1;
+static uint idesect[2];   // size of each disk, in sectors
 static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
@@ -51,9 +107,11 @@ void
 ideinit(void)
 {
   int i;
+  struct pcidev *d;
+  ushort id[SECTOR_SIZE/2];
 
   initlock(&idelock, "ide");
-  ioapicenable(IRQ_IDE, ncpu - 1);
+  ioapicenable(ideirq, ncpu - 1);
   idewait(0);
 
   // Check if disk 1 is present
@@ -65,67 +123,222 @@ ideinit(void)
     }
   }
 
+  // Let READ/WRITE MULTIPLE move IDE_MAXSECT sectors per interrupt,
+  // and ask each disk for its size, polling rather than interrupting.
+  outb(0x3f6, 2);
+  for(i=0; i<=havedisk1; i++){
+    outb(0x1f6, 0xe0 | (i<<4));
+    outb(0x1f2, IDE_MAXSECT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    idewait(0);
+    outb(0x1f7, IDE_CMD_IDENTIFY);
+    if(idewait(1) >= 0){
+      insl(0x1f0, id, SECTOR_SIZE/4);
+      idesect[i] = id[60] | (id[61] << 16);  // LBA28 sectors
+    }
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  // Use bus-master DMA if there is a PCI IDE controller (class 1,
+  // subclass 1) with bus-master registers.  Build with IDEPIO to
+  // stay with programmed I/O.
+  d = pcifindclass(0x01, 0x01);
+  if(d != 0 && (d->bar[4] & PCI_BAR_IO)){
+#ifndef IDEPIO
+    pcienable(d);
+    idebm = d->bar[4] & PCI_BAR_IOMASK;
+    idedma = 1;
+#endif
+  }
+  idestats.disk_dma = idedma;
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Load the PRD table with the data of the bufs at b, and point
+// the bus-master controller at it.  Caller must hold idelock.
+static void
+ideprd(struct buf *b)
+{
+  struct buf *p;
+  struct prd *d;
+  uint pa, end, n;
+
+  d = prdt;
+  for(p = b; p; p = p->qnext){
+    pa = V2P(p->data);
+    end = pa + BSIZE;
+    for(; pa < end; pa += n){
+      n = end - pa;
+      if((pa & 0xffff) + n > 0x10000)
+        n = 0x10000 - (pa & 0xffff);
+      d->addr = pa;
+      d->count = n;
+      d->flags = 0;
+      d++;
+    }
+  }
+  d[-1].flags = PRD_EOT;
+
+  outl(idebm+BM_PRDT, V2P(prdt));
+  outb(idebm+BM_STATUS, inb(idebm+BM_STATUS) | BM_STATUS_ERR | BM_STATUS_INTR);
+  outb(idebm+BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_CMD_READ);
+}
+
+// Start the command for the chain of adjacent bufs at b.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *p;
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector, nsect;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  sector = b->blockno * sector_per_block;
+  nsect = 0;
+  for(p = b; p; p = p->qnext)
+    nsect += sector_per_block;
+  if(nsect > (idedma ? IDE_MAXDMASECT : IDE_MAXSECT))
+    panic("idestart");
 
-  if (sector_per_block > 7) panic("idestart");
+  int read_cmd = (nsect == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsect == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  if(idedma){
+    read_cmd = IDE_CMD_RDDMA;
+    write_cmd = IDE_CMD_WRDMA;
+  }
 
   idewait(0);
+  if(idedma)
+    ideprd(b);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    if(!idedma)
+      for(p = b; p; p = p->qnext)
+        outsl(0x1f0, p->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
+  if(idedma)
+    outb(idebm+BM_CMD, inb(idebm+BM_CMD) | BM_CMD_START);
+  idestats.disk_sectors += nsect;
+}
+
+// Does b sort before block blockno of dev?
+static int
+idebefore(struct buf *b, uint dev, uint blockno)
+{
+  if(b->dev != dev)
+    return b->dev < dev;
+  return b->blockno < blockno;
+}
+
+// If the disk is idle, pick the next request from idequeue,
+// merge the requests for the blocks after it, and start the disk.
+// Caller must hold idelock.
+static void
+idedispatch(void)
+{
+  struct buf **pp, **pick, *b, *last;
+  int nsect, sector_per_block = BSIZE/SECTOR_SIZE;
+  int maxsect = idedma ? IDE_MAXDMASECT : IDE_MAXSECT;
+  uint64 t0;
+
+  if(ideactive != 0 || idequeue == 0)
+    return;
+
+  // The most overdue request goes first; otherwise continue the sweep.
+  pick = 0;
+  for(pp = &idequeue; *pp; pp = &(*pp)->qnext){
+    if((int)(ticks - (*pp)->deadline) >= 0 &&
+       (pick == 0 || (int)((*pp)->deadline - (*pick)->deadline) < 0))
+      pick = pp;
+  }
+  if(pick != 0)
+    idestats.disk_expired++;
+  else {
+    for(pp = &idequeue; *pp; pp = &(*pp)->qnext)
+      if(!idebefore(*pp, ideposdev, ideposblock))
+        break;
+    pick = *pp ? pp : &idequeue;
+  }
+
+  // Take the run of adjacent blocks, same direction, starting at pick.
+  b = last = *pick;
+  nsect = sector_per_block;
+  while(last->qnext != 0 && nsect + sector_per_block <= maxsect &&
+        last->qnext->dev == b->dev &&
+        last->qnext->blockno == last->blockno + 1 &&
+        (last->qnext->flags & B_DIRTY) == (b->flags & B_DIRTY)){
+    last = last->qnext;
+    nsect += sector_per_block;
+    idestats.disk_merged++;
+  }
+  *pick = last->qnext;
+  last->qnext = 0;
+
+  ideactive = b;
+  ideposdev = last->dev;
+  ideposblock = last->blockno + 1;
+  idestats.disk_cmds++;
+  t0 = rdtsc();
+  idestart(b);
+  idestats.disk_cpu += (rdtsc() - t0) >> KSTAT_CYCSHIFT;
 }
 
 // Interrupt handler.
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next;
+  uint lat;
+  uint64 now;
 
-  // First queued buffer is the active request.
+  // ideactive is the command that just finished.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = ideactive) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
+  ideactive = 0;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  // Stop the DMA engine, or read data if needed.
+  now = rdtsc();
+  if(idedma){
+    outb(idebm+BM_CMD, 0);
+    outb(idebm+BM_STATUS, inb(idebm+BM_STATUS) | BM_STATUS_ERR | BM_STATUS_INTR);
+    idewait(1);
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+    for(next = b; next; next = next->qnext)
+      insl(0x1f0, next->data, BSIZE/4);
+  idestats.disk_cpu += (rdtsc() - now) >> KSTAT_CYCSHIFT;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for these bufs.
+  now = rdtsc();
+  for(; b; b = next){
+    next = b->qnext;
+    lat = (now - b->qtime) >> KSTAT_CYCSHIFT;
+    idestats.disk_reqs++;
+    idestats.disk_qdepth--;
+    idestats.disk_lat += lat;
+    if(lat > idestats.disk_latmax)
+      idestats.disk_latmax = lat;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  // Start disk on next request in queue.
+  idedispatch();
 
   release(&idelock);
 }
@@ -145,24 +358,58 @@ iderw(struct buf *b)
     panic("iderw: nothing to do");
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
+  if(b->blockno >= idesize(b->dev))
+    panic("iderw: block out of range");
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  // Insert b into idequeue in (dev, blockno) order.
+  b->qtime = rdtsc();
+  b->deadline = ticks + ((b->flags & B_DIRTY) ? IDE_WDEADLINE : IDE_RDEADLINE);
+  for(pp=&idequeue; *pp && idebefore(*pp, b->dev, b->blockno); pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+  idestats.disk_qsum += idestats.disk_qdepth++;
+  if(idestats.disk_qdepth > idestats.disk_qmax)
+    idestats.disk_qmax = idestats.disk_qdepth;
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  idedispatch();
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
+  release(&idelock);
+}
 
+// Copy out the request queue statistics.
+void
+idestat(struct kstat *st)
+{
+  acquire(&idelock);
+  st->disk_reqs = idestats.disk_reqs;
+  st->disk_cmds = idestats.disk_cmds;
+  st->disk_merged = idestats.disk_merged;
+  st->disk_expired = idestats.disk_expired;
+  st->disk_qdepth = idestats.disk_qdepth;
+  st->disk_qmax = idestats.disk_qmax;
+  st->disk_qsum = idestats.disk_qsum;
+  st->disk_lat = idestats.disk_lat;
+  st->disk_latmax = idestats.disk_latmax;
+  st->disk_dma = idestats.disk_dma;
+  st->disk_sectors = idestats.disk_sectors;
+  st->disk_cpu = idestats.disk_cpu;
   release(&idelock);
 }
+
+// Size of disk dev, in blocks.
+uint
+idesize(int dev)
+{
+  if(dev < 0 || dev > havedisk1)
+    return 0;
+  return idesect[dev] / (BSIZE/SECTOR_SIZE);
+}
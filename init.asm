@@ -0,0 +1,2749 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	53                   	push   %ebx
+    100e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+    100f:	83 ec 08             	sub    $0x8,%esp
+    1012:	6a 02                	push   $0x2
+    1014:	68 f8 22 00 00       	push   $0x22f8
+    1019:	e8 7d 04 00 00       	call   149b <open>
+    101e:	83 c4 10             	add    $0x10,%esp
+    1021:	85 c0                	test   %eax,%eax
+    1023:	0f 88 9f 00 00 00    	js     10c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+    1029:	83 ec 0c             	sub    $0xc,%esp
+    102c:	6a 00                	push   $0x0
+    102e:	e8 d1 04 00 00       	call   1504 <dup>
+  dup(0);  // stderr
+    1033:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    103a:	e8 c5 04 00 00       	call   1504 <dup>
+    103f:	83 c4 10             	add    $0x10,%esp
+    1042:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+    1048:	83 ec 08             	sub    $0x8,%esp
+    104b:	68 00 23 00 00       	push   $0x2300
+    1050:	6a 01                	push   $0x1
+    1052:	e8 e9 08 00 00       	call   1940 <printf>
+    pid = fork();
+    1057:	e8 44 03 00 00       	call   13a0 <fork>
+    if(pid < 0){
+    105c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    105f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1061:	85 c0                	test   %eax,%eax
+    1063:	78 2c                	js     1091 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    1065:	74 3d                	je     10a4 <main+0xa4>
+    1067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+    1070:	e8 bd 03 00 00       	call   1432 <wait>
+    1075:	85 c0                	test   %eax,%eax
+    1077:	78 cf                	js     1048 <main+0x48>
+    1079:	39 c3                	cmp    %eax,%ebx
+    107b:	74 cb                	je     1048 <main+0x48>
+      printf(1, "zombie!\n");
+    107d:	83 ec 08             	sub    $0x8,%esp
+    1080:	68 3f 23 00 00       	push   $0x233f
+    1085:	6a 01                	push   $0x1
+    1087:	e8 b4 08 00 00       	call   1940 <printf>
+    108c:	83 c4 10             	add    $0x10,%esp
+    108f:	eb df                	jmp    1070 <main+0x70>
+      printf(1, "init: fork failed\n");
+    1091:	53                   	push   %ebx
+    1092:	53                   	push   %ebx
+    1093:	68 13 23 00 00       	push   $0x2313
+    1098:	6a 01                	push   $0x1
+    109a:	e8 a1 08 00 00       	call   1940 <printf>
+      exit();
+    109f:	e8 2c 03 00 00       	call   13d0 <exit>
+      exec("sh", argv);
+    10a4:	50                   	push   %eax
+    10a5:	50                   	push   %eax
+    10a6:	68 40 2a 00 00       	push   $0x2a40
+    10ab:	68 26 23 00 00       	push   $0x2326
+    10b0:	e8 3b 03 00 00       	call   13f0 <exec>
+      printf(1, "init: exec sh failed\n");
+    10b5:	5a                   	pop    %edx
+    10b6:	59                   	pop    %ecx
+    10b7:	68 29 23 00 00       	push   $0x2329
+    10bc:	6a 01                	push   $0x1
+    10be:	e8 7d 08 00 00       	call   1940 <printf>
+      exit();
+    10c3:	e8 08 03 00 00       	call   13d0 <exit>
+    mknod("console", 1, 1);
+    10c8:	50                   	push   %eax
+    10c9:	6a 01                	push   $0x1
+    10cb:	6a 01                	push   $0x1
+    10cd:	68 f8 22 00 00       	push   $0x22f8
+    10d2:	e8 d3 03 00 00       	call   14aa <mknod>
+    open("console", O_RDWR);
+    10d7:	58                   	pop    %eax
+    10d8:	5a                   	pop    %edx
+    10d9:	6a 02                	push   $0x2
+    10db:	68 f8 22 00 00       	push   $0x22f8
+    10e0:	e8 b6 03 00 00       	call   149b <open>
+    10e5:	83 c4 10             	add    $0x10,%esp
+    10e8:	e9 3c ff ff ff       	jmp    1029 <main+0x29>
+    10ed:	66 90                	xchg   %ax,%ax
+    10ef:	90                   	nop
+
+000010f0 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    10f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    10f1:	31 c0                	xor    %eax,%eax
+{
+    10f3:	89 e5                	mov    %esp,%ebp
+    10f5:	53                   	push   %ebx
+    10f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    10f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    10fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1107:	83 c0 01             	add    $0x1,%eax
+    110a:	84 d2                	test   %dl,%dl
+    110c:	75 f2                	jne    1100 <strcpy+0x10>
+    ;
+  return os;
+}
+    110e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1111:	89 c8                	mov    %ecx,%eax
+    1113:	c9                   	leave
+    1114:	c3                   	ret
+    1115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	53                   	push   %ebx
+    1124:	8b 55 08             	mov    0x8(%ebp),%edx
+    1127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    112a:	0f b6 02             	movzbl (%edx),%eax
+    112d:	84 c0                	test   %al,%al
+    112f:	75 17                	jne    1148 <strcmp+0x28>
+    1131:	eb 3a                	jmp    116d <strcmp+0x4d>
+    1133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1137:	90                   	nop
+    1138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    113c:	83 c2 01             	add    $0x1,%edx
+    113f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1142:	84 c0                	test   %al,%al
+    1144:	74 1a                	je     1160 <strcmp+0x40>
+    p++, q++;
+    1146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1148:	0f b6 19             	movzbl (%ecx),%ebx
+    114b:	38 c3                	cmp    %al,%bl
+    114d:	74 e9                	je     1138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    114f:	29 d8                	sub    %ebx,%eax
+}
+    1151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1154:	c9                   	leave
+    1155:	c3                   	ret
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1164:	31 c0                	xor    %eax,%eax
+    1166:	29 d8                	sub    %ebx,%eax
+}
+    1168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    116b:	c9                   	leave
+    116c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    116d:	0f b6 19             	movzbl (%ecx),%ebx
+    1170:	31 c0                	xor    %eax,%eax
+    1172:	eb db                	jmp    114f <strcmp+0x2f>
+    1174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+
+00001180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1186:	80 3a 00             	cmpb   $0x0,(%edx)
+    1189:	74 15                	je     11a0 <strlen+0x20>
+    118b:	31 c0                	xor    %eax,%eax
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+    1190:	83 c0 01             	add    $0x1,%eax
+    1193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1197:	89 c1                	mov    %eax,%ecx
+    1199:	75 f5                	jne    1190 <strlen+0x10>
+    ;
+  return n;
+}
+    119b:	89 c8                	mov    %ecx,%eax
+    119d:	5d                   	pop    %ebp
+    119e:	c3                   	ret
+    119f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    11a0:	31 c9                	xor    %ecx,%ecx
+}
+    11a2:	5d                   	pop    %ebp
+    11a3:	89 c8                	mov    %ecx,%eax
+    11a5:	c3                   	ret
+    11a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	57                   	push   %edi
+    11b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    11b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11bd:	89 d7                	mov    %edx,%edi
+    11bf:	fc                   	cld
+    11c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    11c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    11c5:	89 d0                	mov    %edx,%eax
+    11c7:	c9                   	leave
+    11c8:	c3                   	ret
+    11c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    11da:	0f b6 10             	movzbl (%eax),%edx
+    11dd:	84 d2                	test   %dl,%dl
+    11df:	75 12                	jne    11f3 <strchr+0x23>
+    11e1:	eb 1d                	jmp    1200 <strchr+0x30>
+    11e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e7:	90                   	nop
+    11e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    11ec:	83 c0 01             	add    $0x1,%eax
+    11ef:	84 d2                	test   %dl,%dl
+    11f1:	74 0d                	je     1200 <strchr+0x30>
+    if(*s == c)
+    11f3:	38 d1                	cmp    %dl,%cl
+    11f5:	75 f1                	jne    11e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    11f7:	5d                   	pop    %ebp
+    11f8:	c3                   	ret
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1200:	31 c0                	xor    %eax,%eax
+}
+    1202:	5d                   	pop    %ebp
+    1203:	c3                   	ret
+    1204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+
+00001210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	57                   	push   %edi
+    1214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1219:	31 db                	xor    %ebx,%ebx
+{
+    121b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    121e:	eb 27                	jmp    1247 <gets+0x37>
+    cc = read(0, &c, 1);
+    1220:	83 ec 04             	sub    $0x4,%esp
+    1223:	6a 01                	push   $0x1
+    1225:	56                   	push   %esi
+    1226:	6a 00                	push   $0x0
+    1228:	e8 23 02 00 00       	call   1450 <read>
+    if(cc < 1)
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	85 c0                	test   %eax,%eax
+    1232:	7e 1d                	jle    1251 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1238:	8b 55 08             	mov    0x8(%ebp),%edx
+    123b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    123f:	3c 0a                	cmp    $0xa,%al
+    1241:	74 10                	je     1253 <gets+0x43>
+    1243:	3c 0d                	cmp    $0xd,%al
+    1245:	74 0c                	je     1253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1247:	89 df                	mov    %ebx,%edi
+    1249:	83 c3 01             	add    $0x1,%ebx
+    124c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    124f:	7c cf                	jl     1220 <gets+0x10>
+    1251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1253:	8b 45 08             	mov    0x8(%ebp),%eax
+    1256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    125a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    125d:	5b                   	pop    %ebx
+    125e:	5e                   	pop    %esi
+    125f:	5f                   	pop    %edi
+    1260:	5d                   	pop    %ebp
+    1261:	c3                   	ret
+    1262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001270 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	56                   	push   %esi
+    1274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1275:	83 ec 08             	sub    $0x8,%esp
+    1278:	6a 00                	push   $0x0
+    127a:	ff 75 08             	push   0x8(%ebp)
+    127d:	e8 19 02 00 00       	call   149b <open>
+  if(fd < 0)
+    1282:	83 c4 10             	add    $0x10,%esp
+    1285:	85 c0                	test   %eax,%eax
+    1287:	78 27                	js     12b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1289:	83 ec 08             	sub    $0x8,%esp
+    128c:	ff 75 0c             	push   0xc(%ebp)
+    128f:	89 c3                	mov    %eax,%ebx
+    1291:	50                   	push   %eax
+    1292:	e8 31 02 00 00       	call   14c8 <fstat>
+  close(fd);
+    1297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    129a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    129c:	e8 cd 01 00 00       	call   146e <close>
+  return r;
+    12a1:	83 c4 10             	add    $0x10,%esp
+}
+    12a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12a7:	89 f0                	mov    %esi,%eax
+    12a9:	5b                   	pop    %ebx
+    12aa:	5e                   	pop    %esi
+    12ab:	5d                   	pop    %ebp
+    12ac:	c3                   	ret
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    12b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12b5:	eb ed                	jmp    12a4 <stat+0x34>
+    12b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12be:	66 90                	xchg   %ax,%ax
+
+000012c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	53                   	push   %ebx
+    12c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    12c7:	0f be 02             	movsbl (%edx),%eax
+    12ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    12cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    12d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    12d5:	77 1e                	ja     12f5 <atoi+0x35>
+    12d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    12e0:	83 c2 01             	add    $0x1,%edx
+    12e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    12e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    12ea:	0f be 02             	movsbl (%edx),%eax
+    12ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    12f0:	80 fb 09             	cmp    $0x9,%bl
+    12f3:	76 eb                	jbe    12e0 <atoi+0x20>
+  return n;
+}
+    12f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12f8:	89 c8                	mov    %ecx,%eax
+    12fa:	c9                   	leave
+    12fb:	c3                   	ret
+    12fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001300 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	57                   	push   %edi
+    1304:	56                   	push   %esi
+    1305:	8b 45 10             	mov    0x10(%ebp),%eax
+    1308:	8b 55 08             	mov    0x8(%ebp),%edx
+    130b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    130e:	85 c0                	test   %eax,%eax
+    1310:	7e 13                	jle    1325 <memmove+0x25>
+    1312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1314:	89 d7                	mov    %edx,%edi
+    1316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    131d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1321:	39 f8                	cmp    %edi,%eax
+    1323:	75 fb                	jne    1320 <memmove+0x20>
+  return vdst;
+}
+    1325:	5e                   	pop    %esi
+    1326:	89 d0                	mov    %edx,%eax
+    1328:	5f                   	pop    %edi
+    1329:	5d                   	pop    %ebp
+    132a:	c3                   	ret
+    132b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    132f:	90                   	nop
+
+00001330 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	56                   	push   %esi
+    1334:	53                   	push   %ebx
+    1335:	8b 75 10             	mov    0x10(%ebp),%esi
+    1338:	8b 55 08             	mov    0x8(%ebp),%edx
+    133b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    133e:	85 f6                	test   %esi,%esi
+    1340:	74 2e                	je     1370 <memcmp+0x40>
+    1342:	01 c6                	add    %eax,%esi
+    1344:	eb 14                	jmp    135a <memcmp+0x2a>
+    1346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1350:	83 c0 01             	add    $0x1,%eax
+    1353:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1356:	39 f0                	cmp    %esi,%eax
+    1358:	74 16                	je     1370 <memcmp+0x40>
+    if(*s1 != *s2)
+    135a:	0f b6 0a             	movzbl (%edx),%ecx
+    135d:	0f b6 18             	movzbl (%eax),%ebx
+    1360:	38 d9                	cmp    %bl,%cl
+    1362:	74 ec                	je     1350 <memcmp+0x20>
+      return *s1 - *s2;
+    1364:	0f b6 c1             	movzbl %cl,%eax
+    1367:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1369:	5b                   	pop    %ebx
+    136a:	5e                   	pop    %esi
+    136b:	5d                   	pop    %ebp
+    136c:	c3                   	ret
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+    1370:	5b                   	pop    %ebx
+  return 0;
+    1371:	31 c0                	xor    %eax,%eax
+}
+    1373:	5e                   	pop    %esi
+    1374:	5d                   	pop    %ebp
+    1375:	c3                   	ret
+    1376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001380 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1380:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1385:	c3                   	ret
+    1386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001390 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1390:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1395:	c3                   	ret
+    1396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    139d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013a0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    13a0:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+    13a5:	85 c0                	test   %eax,%eax
+    13a7:	74 17                	je     13c0 <fork+0x20>
+{
+    13a9:	55                   	push   %ebp
+    13aa:	89 e5                	mov    %esp,%ebp
+    13ac:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    13af:	ff d0                	call   *%eax
+  return _fork();
+}
+    13b1:	c9                   	leave
+  return _fork();
+    13b2:	e9 5d 00 00 00       	jmp    1414 <_fork>
+    13b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13be:	66 90                	xchg   %ax,%ax
+    13c0:	e9 4f 00 00 00       	jmp    1414 <_fork>
+    13c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013d0 <exit>:
+
+int
+exit(void)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    13d6:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+    13db:	85 c0                	test   %eax,%eax
+    13dd:	74 02                	je     13e1 <exit+0x11>
+    flushhook();
+    13df:	ff d0                	call   *%eax
+  _exit();
+    13e1:	e8 3d 00 00 00       	call   1423 <_exit>
+    13e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013f0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    13f0:	55                   	push   %ebp
+  if(flushhook)
+    13f1:	a1 c0 2c 00 00       	mov    0x2cc0,%eax
+{
+    13f6:	89 e5                	mov    %esp,%ebp
+    13f8:	56                   	push   %esi
+    13f9:	53                   	push   %ebx
+    13fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    13fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1400:	85 c0                	test   %eax,%eax
+    1402:	74 02                	je     1406 <exec+0x16>
+    flushhook();
+    1404:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1406:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1409:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    140c:	5b                   	pop    %ebx
+    140d:	5e                   	pop    %esi
+    140e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    140f:	e9 78 00 00 00       	jmp    148c <_exec>
+
+00001414 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1414:	b8 01 00 00 00       	mov    $0x1,%eax
+    1419:	89 e1                	mov    %esp,%ecx
+    141b:	ba 22 14 00 00       	mov    $0x1422,%edx
+    1420:	0f 34                	sysenter
+    1422:	c3                   	ret
+
+00001423 <_exit>:
+RAWSYSCALL(exit)
+    1423:	b8 02 00 00 00       	mov    $0x2,%eax
+    1428:	89 e1                	mov    %esp,%ecx
+    142a:	ba 31 14 00 00       	mov    $0x1431,%edx
+    142f:	0f 34                	sysenter
+    1431:	c3                   	ret
+
+00001432 <wait>:
+SYSCALL(wait)
+    1432:	b8 03 00 00 00       	mov    $0x3,%eax
+    1437:	89 e1                	mov    %esp,%ecx
+    1439:	ba 40 14 00 00       	mov    $0x1440,%edx
+    143e:	0f 34                	sysenter
+    1440:	c3                   	ret
+
+00001441 <pipe>:
+SYSCALL(pipe)
+    1441:	b8 04 00 00 00       	mov    $0x4,%eax
+    1446:	89 e1                	mov    %esp,%ecx
+    1448:	ba 4f 14 00 00       	mov    $0x144f,%edx
+    144d:	0f 34                	sysenter
+    144f:	c3                   	ret
+
+00001450 <read>:
+SYSCALL(read)
+    1450:	b8 05 00 00 00       	mov    $0x5,%eax
+    1455:	89 e1                	mov    %esp,%ecx
+    1457:	ba 5e 14 00 00       	mov    $0x145e,%edx
+    145c:	0f 34                	sysenter
+    145e:	c3                   	ret
+
+0000145f <write>:
+SYSCALL(write)
+    145f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1464:	89 e1                	mov    %esp,%ecx
+    1466:	ba 6d 14 00 00       	mov    $0x146d,%edx
+    146b:	0f 34                	sysenter
+    146d:	c3                   	ret
+
+0000146e <close>:
+SYSCALL(close)
+    146e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1473:	89 e1                	mov    %esp,%ecx
+    1475:	ba 7c 14 00 00       	mov    $0x147c,%edx
+    147a:	0f 34                	sysenter
+    147c:	c3                   	ret
+
+0000147d <kill>:
+SYSCALL(kill)
+    147d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1482:	89 e1                	mov    %esp,%ecx
+    1484:	ba 8b 14 00 00       	mov    $0x148b,%edx
+    1489:	0f 34                	sysenter
+    148b:	c3                   	ret
+
+0000148c <_exec>:
+RAWSYSCALL(exec)
+    148c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1491:	89 e1                	mov    %esp,%ecx
+    1493:	ba 9a 14 00 00       	mov    $0x149a,%edx
+    1498:	0f 34                	sysenter
+    149a:	c3                   	ret
+
+0000149b <open>:
+SYSCALL(open)
+    149b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    14a0:	89 e1                	mov    %esp,%ecx
+    14a2:	ba a9 14 00 00       	mov    $0x14a9,%edx
+    14a7:	0f 34                	sysenter
+    14a9:	c3                   	ret
+
+000014aa <mknod>:
+SYSCALL(mknod)
+    14aa:	b8 11 00 00 00       	mov    $0x11,%eax
+    14af:	89 e1                	mov    %esp,%ecx
+    14b1:	ba b8 14 00 00       	mov    $0x14b8,%edx
+    14b6:	0f 34                	sysenter
+    14b8:	c3                   	ret
+
+000014b9 <unlink>:
+SYSCALL(unlink)
+    14b9:	b8 12 00 00 00       	mov    $0x12,%eax
+    14be:	89 e1                	mov    %esp,%ecx
+    14c0:	ba c7 14 00 00       	mov    $0x14c7,%edx
+    14c5:	0f 34                	sysenter
+    14c7:	c3                   	ret
+
+000014c8 <fstat>:
+SYSCALL(fstat)
+    14c8:	b8 08 00 00 00       	mov    $0x8,%eax
+    14cd:	89 e1                	mov    %esp,%ecx
+    14cf:	ba d6 14 00 00       	mov    $0x14d6,%edx
+    14d4:	0f 34                	sysenter
+    14d6:	c3                   	ret
+
+000014d7 <link>:
+SYSCALL(link)
+    14d7:	b8 13 00 00 00       	mov    $0x13,%eax
+    14dc:	89 e1                	mov    %esp,%ecx
+    14de:	ba e5 14 00 00       	mov    $0x14e5,%edx
+    14e3:	0f 34                	sysenter
+    14e5:	c3                   	ret
+
+000014e6 <mkdir>:
+SYSCALL(mkdir)
+    14e6:	b8 14 00 00 00       	mov    $0x14,%eax
+    14eb:	89 e1                	mov    %esp,%ecx
+    14ed:	ba f4 14 00 00       	mov    $0x14f4,%edx
+    14f2:	0f 34                	sysenter
+    14f4:	c3                   	ret
+
+000014f5 <chdir>:
+SYSCALL(chdir)
+    14f5:	b8 09 00 00 00       	mov    $0x9,%eax
+    14fa:	89 e1                	mov    %esp,%ecx
+    14fc:	ba 03 15 00 00       	mov    $0x1503,%edx
+    1501:	0f 34                	sysenter
+    1503:	c3                   	ret
+
+00001504 <dup>:
+SYSCALL(dup)
+    1504:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1509:	89 e1                	mov    %esp,%ecx
+    150b:	ba 12 15 00 00       	mov    $0x1512,%edx
+    1510:	0f 34                	sysenter
+    1512:	c3                   	ret
+
+00001513 <getpid>:
+SYSCALL(getpid)
+    1513:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1518:	89 e1                	mov    %esp,%ecx
+    151a:	ba 21 15 00 00       	mov    $0x1521,%edx
+    151f:	0f 34                	sysenter
+    1521:	c3                   	ret
+
+00001522 <sbrk>:
+SYSCALL(sbrk)
+    1522:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1527:	89 e1                	mov    %esp,%ecx
+    1529:	ba 30 15 00 00       	mov    $0x1530,%edx
+    152e:	0f 34                	sysenter
+    1530:	c3                   	ret
+
+00001531 <sleep>:
+SYSCALL(sleep)
+    1531:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1536:	89 e1                	mov    %esp,%ecx
+    1538:	ba 3f 15 00 00       	mov    $0x153f,%edx
+    153d:	0f 34                	sysenter
+    153f:	c3                   	ret
+
+00001540 <uptime>:
+SYSCALL(uptime)
+    1540:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1545:	89 e1                	mov    %esp,%ecx
+    1547:	ba 4e 15 00 00       	mov    $0x154e,%edx
+    154c:	0f 34                	sysenter
+    154e:	c3                   	ret
+
+0000154f <mprotect>:
+SYSCALL(mprotect)
+    154f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1554:	89 e1                	mov    %esp,%ecx
+    1556:	ba 5d 15 00 00       	mov    $0x155d,%edx
+    155b:	0f 34                	sysenter
+    155d:	c3                   	ret
+
+0000155e <munprotect>:
+SYSCALL(munprotect)
+    155e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1563:	89 e1                	mov    %esp,%ecx
+    1565:	ba 6c 15 00 00       	mov    $0x156c,%edx
+    156a:	0f 34                	sysenter
+    156c:	c3                   	ret
+
+0000156d <kstat>:
+SYSCALL(kstat)
+    156d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1572:	89 e1                	mov    %esp,%ecx
+    1574:	ba 7b 15 00 00       	mov    $0x157b,%edx
+    1579:	0f 34                	sysenter
+    157b:	c3                   	ret
+
+0000157c <fcntl>:
+SYSCALL(fcntl)
+    157c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1581:	89 e1                	mov    %esp,%ecx
+    1583:	ba 8a 15 00 00       	mov    $0x158a,%edx
+    1588:	0f 34                	sysenter
+    158a:	c3                   	ret
+
+0000158b <splice>:
+SYSCALL(splice)
+    158b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1590:	89 e1                	mov    %esp,%ecx
+    1592:	ba 99 15 00 00       	mov    $0x1599,%edx
+    1597:	0f 34                	sysenter
+    1599:	c3                   	ret
+
+0000159a <sendfile>:
+SYSCALL(sendfile)
+    159a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    159f:	89 e1                	mov    %esp,%ecx
+    15a1:	ba a8 15 00 00       	mov    $0x15a8,%edx
+    15a6:	0f 34                	sysenter
+    15a8:	c3                   	ret
+
+000015a9 <lseek>:
+SYSCALL(lseek)
+    15a9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    15ae:	89 e1                	mov    %esp,%ecx
+    15b0:	ba b7 15 00 00       	mov    $0x15b7,%edx
+    15b5:	0f 34                	sysenter
+    15b7:	c3                   	ret
+
+000015b8 <pread>:
+SYSCALL(pread)
+    15b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    15bd:	89 e1                	mov    %esp,%ecx
+    15bf:	ba c6 15 00 00       	mov    $0x15c6,%edx
+    15c4:	0f 34                	sysenter
+    15c6:	c3                   	ret
+
+000015c7 <pwrite>:
+SYSCALL(pwrite)
+    15c7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    15cc:	89 e1                	mov    %esp,%ecx
+    15ce:	ba d5 15 00 00       	mov    $0x15d5,%edx
+    15d3:	0f 34                	sysenter
+    15d5:	c3                   	ret
+
+000015d6 <readv>:
+SYSCALL(readv)
+    15d6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    15db:	89 e1                	mov    %esp,%ecx
+    15dd:	ba e4 15 00 00       	mov    $0x15e4,%edx
+    15e2:	0f 34                	sysenter
+    15e4:	c3                   	ret
+
+000015e5 <writev>:
+SYSCALL(writev)
+    15e5:	b8 20 00 00 00       	mov    $0x20,%eax
+    15ea:	89 e1                	mov    %esp,%ecx
+    15ec:	ba f3 15 00 00       	mov    $0x15f3,%edx
+    15f1:	0f 34                	sysenter
+    15f3:	c3                   	ret
+
+000015f4 <ringsetup>:
+SYSCALL(ringsetup)
+    15f4:	b8 21 00 00 00       	mov    $0x21,%eax
+    15f9:	89 e1                	mov    %esp,%ecx
+    15fb:	ba 02 16 00 00       	mov    $0x1602,%edx
+    1600:	0f 34                	sysenter
+    1602:	c3                   	ret
+
+00001603 <ringenter>:
+SYSCALL(ringenter)
+    1603:	b8 22 00 00 00       	mov    $0x22,%eax
+    1608:	89 e1                	mov    %esp,%ecx
+    160a:	ba 11 16 00 00       	mov    $0x1611,%edx
+    160f:	0f 34                	sysenter
+    1611:	c3                   	ret
+
+00001612 <intgetpid>:
+INTSYSCALL(getpid)
+    1612:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1617:	cd 40                	int    $0x40
+    1619:	c3                   	ret
+    161a:	66 90                	xchg   %ax,%ax
+    161c:	66 90                	xchg   %ax,%ax
+    161e:	66 90                	xchg   %ax,%ax
+
+00001620 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1620:	55                   	push   %ebp
+    1621:	89 e5                	mov    %esp,%ebp
+    1623:	57                   	push   %edi
+    1624:	56                   	push   %esi
+    1625:	53                   	push   %ebx
+    1626:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1628:	89 d1                	mov    %edx,%ecx
+{
+    162a:	83 ec 2c             	sub    $0x2c,%esp
+    162d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1630:	85 d2                	test   %edx,%edx
+    1632:	0f 89 c0 00 00 00    	jns    16f8 <printint+0xd8>
+    1638:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    163c:	0f 84 b6 00 00 00    	je     16f8 <printint+0xd8>
+    x = -xx;
+    1642:	f7 d9                	neg    %ecx
+    neg = 1;
+    1644:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1649:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    164c:	31 f6                	xor    %esi,%esi
+    164e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1650:	89 c8                	mov    %ecx,%eax
+    1652:	31 d2                	xor    %edx,%edx
+    1654:	89 f7                	mov    %esi,%edi
+    1656:	f7 f3                	div    %ebx
+    1658:	8d 76 01             	lea    0x1(%esi),%esi
+    165b:	0f b6 92 a8 23 00 00 	movzbl 0x23a8(%edx),%edx
+    1662:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1666:	89 ca                	mov    %ecx,%edx
+    1668:	89 c1                	mov    %eax,%ecx
+    166a:	39 da                	cmp    %ebx,%edx
+    166c:	73 e2                	jae    1650 <printint+0x30>
+  if(neg)
+    166e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1671:	85 c0                	test   %eax,%eax
+    1673:	74 07                	je     167c <printint+0x5c>
+    buf[i++] = '-';
+    1675:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    167a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    167c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    167f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1682:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1684:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1687:	8b 41 08             	mov    0x8(%ecx),%eax
+    168a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    168d:	89 ce                	mov    %ecx,%esi
+    168f:	eb 1c                	jmp    16ad <printint+0x8d>
+    1691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1698:	89 c1                	mov    %eax,%ecx
+    169a:	83 c0 01             	add    $0x1,%eax
+    169d:	89 46 08             	mov    %eax,0x8(%esi)
+    16a0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    16a4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    16a7:	39 df                	cmp    %ebx,%edi
+    16a9:	74 41                	je     16ec <printint+0xcc>
+    16ab:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    16ad:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    16b0:	3d 80 00 00 00       	cmp    $0x80,%eax
+    16b5:	75 e1                	jne    1698 <printint+0x78>
+  if(o->f)
+    16b7:	8b 06                	mov    (%esi),%eax
+    16b9:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    16bc:	85 c0                	test   %eax,%eax
+    16be:	74 40                	je     1700 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    16c0:	50                   	push   %eax
+    16c1:	68 80 00 00 00       	push   $0x80
+    16c6:	6a 01                	push   $0x1
+    16c8:	ff 75 d4             	push   -0x2c(%ebp)
+    16cb:	e8 a0 04 00 00       	call   1b70 <fwrite>
+    16d0:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    16d4:	83 c4 10             	add    $0x10,%esp
+}
+    16d7:	b8 01 00 00 00       	mov    $0x1,%eax
+    16dc:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    16de:	89 46 08             	mov    %eax,0x8(%esi)
+    16e1:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    16e5:	8d 57 ff             	lea    -0x1(%edi),%edx
+    16e8:	39 df                	cmp    %ebx,%edi
+    16ea:	75 bf                	jne    16ab <printint+0x8b>
+}
+    16ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16ef:	5b                   	pop    %ebx
+    16f0:	5e                   	pop    %esi
+    16f1:	5f                   	pop    %edi
+    16f2:	5d                   	pop    %ebp
+    16f3:	c3                   	ret
+    16f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    16f8:	31 c0                	xor    %eax,%eax
+    16fa:	e9 4a ff ff ff       	jmp    1649 <printint+0x29>
+    16ff:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1700:	83 ec 04             	sub    $0x4,%esp
+    1703:	68 80 00 00 00       	push   $0x80
+    1708:	ff 75 d4             	push   -0x2c(%ebp)
+    170b:	ff 76 04             	push   0x4(%esi)
+    170e:	e8 4c fd ff ff       	call   145f <write>
+    1713:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1717:	83 c4 10             	add    $0x10,%esp
+    171a:	eb bb                	jmp    16d7 <printint+0xb7>
+    171c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001720 <putc>:
+{
+    1720:	55                   	push   %ebp
+    1721:	89 e5                	mov    %esp,%ebp
+    1723:	56                   	push   %esi
+    1724:	89 d6                	mov    %edx,%esi
+    1726:	53                   	push   %ebx
+    1727:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1729:	8b 40 08             	mov    0x8(%eax),%eax
+    172c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1731:	74 1d                	je     1750 <putc+0x30>
+  o->buf[o->n++] = c;
+    1733:	89 f1                	mov    %esi,%ecx
+    1735:	8d 50 01             	lea    0x1(%eax),%edx
+    1738:	89 53 08             	mov    %edx,0x8(%ebx)
+    173b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    173f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1742:	5b                   	pop    %ebx
+    1743:	5e                   	pop    %esi
+    1744:	5d                   	pop    %ebp
+    1745:	c3                   	ret
+    1746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1750:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1752:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1755:	85 c0                	test   %eax,%eax
+    1757:	74 2f                	je     1788 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1759:	50                   	push   %eax
+    175a:	68 80 00 00 00       	push   $0x80
+    175f:	6a 01                	push   $0x1
+    1761:	52                   	push   %edx
+    1762:	e8 09 04 00 00       	call   1b70 <fwrite>
+    1767:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    176a:	89 f1                	mov    %esi,%ecx
+}
+    176c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1771:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1773:	89 53 08             	mov    %edx,0x8(%ebx)
+    1776:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    177a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    177d:	5b                   	pop    %ebx
+    177e:	5e                   	pop    %esi
+    177f:	5d                   	pop    %ebp
+    1780:	c3                   	ret
+    1781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1788:	83 ec 04             	sub    $0x4,%esp
+    178b:	68 80 00 00 00       	push   $0x80
+    1790:	52                   	push   %edx
+    1791:	ff 73 04             	push   0x4(%ebx)
+    1794:	e8 c6 fc ff ff       	call   145f <write>
+    1799:	83 c4 10             	add    $0x10,%esp
+    179c:	eb cc                	jmp    176a <putc+0x4a>
+    179e:	66 90                	xchg   %ax,%ax
+
+000017a0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    17a0:	55                   	push   %ebp
+    17a1:	89 e5                	mov    %esp,%ebp
+    17a3:	57                   	push   %edi
+    17a4:	89 c7                	mov    %eax,%edi
+    17a6:	56                   	push   %esi
+    17a7:	31 f6                	xor    %esi,%esi
+    17a9:	53                   	push   %ebx
+    17aa:	8d 5a 01             	lea    0x1(%edx),%ebx
+    17ad:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    17b0:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    17b3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    17b6:	84 c0                	test   %al,%al
+    17b8:	75 1e                	jne    17d8 <vprintf.constprop.0+0x38>
+    17ba:	eb 53                	jmp    180f <vprintf.constprop.0+0x6f>
+    17bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    17c0:	83 f8 25             	cmp    $0x25,%eax
+    17c3:	74 3b                	je     1800 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    17c5:	89 ca                	mov    %ecx,%edx
+    17c7:	89 f8                	mov    %edi,%eax
+    17c9:	e8 52 ff ff ff       	call   1720 <putc>
+  for(i = 0; fmt[i]; i++){
+    17ce:	0f b6 03             	movzbl (%ebx),%eax
+    17d1:	83 c3 01             	add    $0x1,%ebx
+    17d4:	84 c0                	test   %al,%al
+    17d6:	74 37                	je     180f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    17d8:	0f be c8             	movsbl %al,%ecx
+    17db:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    17de:	85 f6                	test   %esi,%esi
+    17e0:	74 de                	je     17c0 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    17e2:	83 fe 25             	cmp    $0x25,%esi
+    17e5:	75 e7                	jne    17ce <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    17e7:	83 f8 25             	cmp    $0x25,%eax
+    17ea:	74 4e                	je     183a <vprintf.constprop.0+0x9a>
+    17ec:	83 e8 63             	sub    $0x63,%eax
+    17ef:	83 f8 15             	cmp    $0x15,%eax
+    17f2:	77 34                	ja     1828 <vprintf.constprop.0+0x88>
+    17f4:	ff 24 85 50 23 00 00 	jmp    *0x2350(,%eax,4)
+    17fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17ff:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1800:	0f b6 03             	movzbl (%ebx),%eax
+    1803:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1806:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    180b:	84 c0                	test   %al,%al
+    180d:	75 c9                	jne    17d8 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    180f:	8b 47 08             	mov    0x8(%edi),%eax
+    1812:	85 c0                	test   %eax,%eax
+    1814:	0f 8f de 00 00 00    	jg     18f8 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    181a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    181d:	5b                   	pop    %ebx
+    181e:	5e                   	pop    %esi
+    181f:	5f                   	pop    %edi
+    1820:	5d                   	pop    %ebp
+    1821:	c3                   	ret
+    1822:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1828:	ba 25 00 00 00       	mov    $0x25,%edx
+    182d:	89 f8                	mov    %edi,%eax
+    182f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1832:	e8 e9 fe ff ff       	call   1720 <putc>
+        putc(o, c);
+    1837:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    183a:	89 ca                	mov    %ecx,%edx
+    183c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    183e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1840:	e8 db fe ff ff       	call   1720 <putc>
+    1845:	eb 87                	jmp    17ce <vprintf.constprop.0+0x2e>
+    1847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1850:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1853:	83 ec 0c             	sub    $0xc,%esp
+    1856:	b9 10 00 00 00       	mov    $0x10,%ecx
+    185b:	8b 16                	mov    (%esi),%edx
+    185d:	6a 00                	push   $0x0
+        ap++;
+    185f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1862:	89 f8                	mov    %edi,%eax
+    1864:	e8 b7 fd ff ff       	call   1620 <printint>
+        ap++;
+    1869:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    186c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    186f:	31 f6                	xor    %esi,%esi
+    1871:	e9 58 ff ff ff       	jmp    17ce <vprintf.constprop.0+0x2e>
+    1876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1880:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1883:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1885:	83 c0 04             	add    $0x4,%eax
+    1888:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    188b:	85 f6                	test   %esi,%esi
+    188d:	75 1b                	jne    18aa <vprintf.constprop.0+0x10a>
+    188f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1894:	be 48 23 00 00       	mov    $0x2348,%esi
+    1899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    18a0:	89 f8                	mov    %edi,%eax
+          s++;
+    18a2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    18a5:	e8 76 fe ff ff       	call   1720 <putc>
+        while(*s != 0){
+    18aa:	0f be 16             	movsbl (%esi),%edx
+    18ad:	84 d2                	test   %dl,%dl
+    18af:	75 ef                	jne    18a0 <vprintf.constprop.0+0x100>
+      state = 0;
+    18b1:	31 f6                	xor    %esi,%esi
+    18b3:	e9 16 ff ff ff       	jmp    17ce <vprintf.constprop.0+0x2e>
+    18b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bf:	90                   	nop
+        printint(o, *ap, 10, 1);
+    18c0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    18c3:	83 ec 0c             	sub    $0xc,%esp
+    18c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    18cb:	8b 16                	mov    (%esi),%edx
+    18cd:	6a 01                	push   $0x1
+    18cf:	eb 8e                	jmp    185f <vprintf.constprop.0+0xbf>
+    18d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    18d8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    18db:	89 f8                	mov    %edi,%eax
+    18dd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    18e0:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    18e3:	e8 38 fe ff ff       	call   1720 <putc>
+        ap++;
+    18e8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    18eb:	31 f6                	xor    %esi,%esi
+    18ed:	e9 dc fe ff ff       	jmp    17ce <vprintf.constprop.0+0x2e>
+    18f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    18f8:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    18fa:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    18fd:	85 d2                	test   %edx,%edx
+    18ff:	74 1f                	je     1920 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1901:	52                   	push   %edx
+    1902:	50                   	push   %eax
+    1903:	6a 01                	push   $0x1
+    1905:	51                   	push   %ecx
+    1906:	e8 65 02 00 00       	call   1b70 <fwrite>
+    190b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    190e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1918:	5b                   	pop    %ebx
+    1919:	5e                   	pop    %esi
+    191a:	5f                   	pop    %edi
+    191b:	5d                   	pop    %ebp
+    191c:	c3                   	ret
+    191d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1920:	83 ec 04             	sub    $0x4,%esp
+    1923:	50                   	push   %eax
+    1924:	51                   	push   %ecx
+    1925:	ff 77 04             	push   0x4(%edi)
+    1928:	e8 32 fb ff ff       	call   145f <write>
+    192d:	83 c4 10             	add    $0x10,%esp
+    1930:	eb dc                	jmp    190e <vprintf.constprop.0+0x16e>
+    1932:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001940 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1940:	55                   	push   %ebp
+    1941:	89 e5                	mov    %esp,%ebp
+    1943:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1949:	a1 64 2a 00 00       	mov    0x2a64,%eax
+{
+    194e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1951:	83 fa 01             	cmp    $0x1,%edx
+    1954:	74 0c                	je     1962 <printf+0x22>
+    1956:	31 c0                	xor    %eax,%eax
+    1958:	83 fa 02             	cmp    $0x2,%edx
+    195b:	0f 44 05 60 2a 00 00 	cmove  0x2a60,%eax
+  o.fd = fd;
+    1962:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1968:	8b 55 0c             	mov    0xc(%ebp),%edx
+    196b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    196e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1974:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    197a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1981:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1984:	e8 17 fe ff ff       	call   17a0 <vprintf.constprop.0>
+}
+    1989:	c9                   	leave
+    198a:	c3                   	ret
+    198b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    198f:	90                   	nop
+
+00001990 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1990:	55                   	push   %ebp
+    1991:	89 e5                	mov    %esp,%ebp
+    1993:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1999:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    199c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    199f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    19a2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    19a9:	ff ff ff 
+  o.n = 0;
+    19ac:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    19b3:	00 00 00 
+  o.f = f;
+    19b6:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    19bc:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    19c2:	e8 d9 fd ff ff       	call   17a0 <vprintf.constprop.0>
+}
+    19c7:	c9                   	leave
+    19c8:	c3                   	ret
+    19c9:	66 90                	xchg   %ax,%ax
+    19cb:	66 90                	xchg   %ax,%ax
+    19cd:	66 90                	xchg   %ax,%ax
+    19cf:	90                   	nop
+
+000019d0 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    19d0:	55                   	push   %ebp
+    19d1:	89 e5                	mov    %esp,%ebp
+    19d3:	53                   	push   %ebx
+    19d4:	89 c3                	mov    %eax,%ebx
+    19d6:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    19d9:	8b 40 0c             	mov    0xc(%eax),%eax
+    19dc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    19df:	74 17                	je     19f8 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    19e1:	83 f8 02             	cmp    $0x2,%eax
+    19e4:	74 07                	je     19ed <setmode+0x1d>
+    19e6:	8b 43 18             	mov    0x18(%ebx),%eax
+    19e9:	85 c0                	test   %eax,%eax
+    19eb:	74 38                	je     1a25 <setmode+0x55>
+    f->mode = IONBF;
+}
+    19ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    19f0:	c9                   	leave
+    19f1:	c3                   	ret
+    19f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    19f8:	83 ec 08             	sub    $0x8,%esp
+    19fb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    19fe:	50                   	push   %eax
+    19ff:	ff 33                	push   (%ebx)
+    1a01:	e8 c2 fa ff ff       	call   14c8 <fstat>
+    1a06:	83 c4 10             	add    $0x10,%esp
+    1a09:	89 c2                	mov    %eax,%edx
+    1a0b:	31 c0                	xor    %eax,%eax
+    1a0d:	85 d2                	test   %edx,%edx
+    1a0f:	75 0a                	jne    1a1b <setmode+0x4b>
+    1a11:	31 c0                	xor    %eax,%eax
+    1a13:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1a18:	0f 94 c0             	sete   %al
+    1a1b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1a1e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1a21:	85 c0                	test   %eax,%eax
+    1a23:	75 c8                	jne    19ed <setmode+0x1d>
+    1a25:	83 ec 0c             	sub    $0xc,%esp
+    1a28:	68 00 04 00 00       	push   $0x400
+    1a2d:	e8 de 07 00 00       	call   2210 <malloc>
+    1a32:	83 c4 10             	add    $0x10,%esp
+    1a35:	89 43 18             	mov    %eax,0x18(%ebx)
+    1a38:	85 c0                	test   %eax,%eax
+    1a3a:	75 b1                	jne    19ed <setmode+0x1d>
+    f->mode = IONBF;
+    1a3c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1a43:	eb a8                	jmp    19ed <setmode+0x1d>
+    1a45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001a50 <drain>:
+{
+    1a50:	55                   	push   %ebp
+    1a51:	89 e5                	mov    %esp,%ebp
+    1a53:	57                   	push   %edi
+    1a54:	56                   	push   %esi
+    1a55:	53                   	push   %ebx
+    1a56:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1a59:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1a5c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1a5f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1a66:	85 ff                	test   %edi,%edi
+    1a68:	7f 0e                	jg     1a78 <drain+0x28>
+  return 0;
+    1a6a:	31 c0                	xor    %eax,%eax
+}
+    1a6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a6f:	5b                   	pop    %ebx
+    1a70:	5e                   	pop    %esi
+    1a71:	5f                   	pop    %edi
+    1a72:	5d                   	pop    %ebp
+    1a73:	c3                   	ret
+    1a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1a78:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a7b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1a7e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1a80:	eb 0e                	jmp    1a90 <drain+0x40>
+    1a82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1a88:	29 c7                	sub    %eax,%edi
+    1a8a:	01 c3                	add    %eax,%ebx
+    1a8c:	85 ff                	test   %edi,%edi
+    1a8e:	7e da                	jle    1a6a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1a90:	83 ec 04             	sub    $0x4,%esp
+    1a93:	57                   	push   %edi
+    1a94:	53                   	push   %ebx
+    1a95:	56                   	push   %esi
+    1a96:	e8 c4 f9 ff ff       	call   145f <write>
+    1a9b:	83 c4 10             	add    $0x10,%esp
+    1a9e:	85 c0                	test   %eax,%eax
+    1aa0:	7f e6                	jg     1a88 <drain+0x38>
+    f->err = 1;
+    1aa2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1aa5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1aac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ab1:	eb b9                	jmp    1a6c <drain+0x1c>
+    1ab3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001ac0 <flushall>:
+
+static void
+flushall(void)
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	89 e5                	mov    %esp,%ebp
+    1ac3:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ac4:	bb 80 2a 00 00       	mov    $0x2a80,%ebx
+{
+    1ac9:	83 ec 04             	sub    $0x4,%esp
+    1acc:	eb 0d                	jmp    1adb <flushall+0x1b>
+    1ace:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ad0:	83 c3 24             	add    $0x24,%ebx
+    1ad3:	81 fb c0 2c 00 00    	cmp    $0x2cc0,%ebx
+    1ad9:	74 19                	je     1af4 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1adb:	8b 43 08             	mov    0x8(%ebx),%eax
+    1ade:	85 c0                	test   %eax,%eax
+    1ae0:	74 ee                	je     1ad0 <flushall+0x10>
+    1ae2:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ae4:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1ae7:	e8 64 ff ff ff       	call   1a50 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1aec:	81 fb c0 2c 00 00    	cmp    $0x2cc0,%ebx
+    1af2:	75 e7                	jne    1adb <flushall+0x1b>
+}
+    1af4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1af7:	c9                   	leave
+    1af8:	c3                   	ret
+    1af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b00 <fflush>:
+{
+    1b00:	55                   	push   %ebp
+    1b01:	89 e5                	mov    %esp,%ebp
+    1b03:	57                   	push   %edi
+    1b04:	56                   	push   %esi
+    1b05:	53                   	push   %ebx
+    1b06:	83 ec 0c             	sub    $0xc,%esp
+    1b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1b0c:	85 c0                	test   %eax,%eax
+    1b0e:	74 28                	je     1b38 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1b10:	8b 70 08             	mov    0x8(%eax),%esi
+    1b13:	85 f6                	test   %esi,%esi
+    1b15:	75 11                	jne    1b28 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1b17:	83 c4 0c             	add    $0xc,%esp
+    1b1a:	89 f0                	mov    %esi,%eax
+    1b1c:	5b                   	pop    %ebx
+    1b1d:	5e                   	pop    %esi
+    1b1e:	5f                   	pop    %edi
+    1b1f:	5d                   	pop    %ebp
+    1b20:	c3                   	ret
+    1b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b28:	83 c4 0c             	add    $0xc,%esp
+    1b2b:	5b                   	pop    %ebx
+    1b2c:	5e                   	pop    %esi
+    1b2d:	5f                   	pop    %edi
+    1b2e:	5d                   	pop    %ebp
+  return drain(f);
+    1b2f:	e9 1c ff ff ff       	jmp    1a50 <drain>
+    1b34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1b38:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b3a:	bb 80 2a 00 00       	mov    $0x2a80,%ebx
+        r = -1;
+    1b3f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1b44:	eb 15                	jmp    1b5b <fflush+0x5b>
+    1b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b50:	83 c3 24             	add    $0x24,%ebx
+    1b53:	81 fb c0 2c 00 00    	cmp    $0x2cc0,%ebx
+    1b59:	74 bc                	je     1b17 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1b5b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1b5e:	85 c0                	test   %eax,%eax
+    1b60:	74 ee                	je     1b50 <fflush+0x50>
+    1b62:	89 d8                	mov    %ebx,%eax
+    1b64:	e8 e7 fe ff ff       	call   1a50 <drain>
+        r = -1;
+    1b69:	85 c0                	test   %eax,%eax
+    1b6b:	0f 48 f7             	cmovs  %edi,%esi
+    1b6e:	eb e0                	jmp    1b50 <fflush+0x50>
+
+00001b70 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1b70:	55                   	push   %ebp
+    1b71:	89 e5                	mov    %esp,%ebp
+    1b73:	57                   	push   %edi
+    1b74:	56                   	push   %esi
+    1b75:	53                   	push   %ebx
+    1b76:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1b79:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1b7c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1b80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1b83:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1b86:	85 d2                	test   %edx,%edx
+    1b88:	0f 8e 26 01 00 00    	jle    1cb4 <fwrite+0x144>
+  if(!f->writable){
+    1b8e:	8b 46 08             	mov    0x8(%esi),%eax
+    1b91:	85 c0                	test   %eax,%eax
+    1b93:	0f 84 14 01 00 00    	je     1cad <fwrite+0x13d>
+  setmode(f);
+    1b99:	89 f0                	mov    %esi,%eax
+    1b9b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1b9e:	e8 2d fe ff ff       	call   19d0 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1ba3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1ba7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1baa:	c7 05 c0 2c 00 00 c0 	movl   $0x1ac0,0x2cc0
+    1bb1:	1a 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1bb4:	0f 84 b6 00 00 00    	je     1c70 <fwrite+0x100>
+    1bba:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1bc0:	0f 8f aa 00 00 00    	jg     1c70 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1bc6:	8b 46 20             	mov    0x20(%esi),%eax
+    1bc9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1bcc:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1bce:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1bd3:	74 6c                	je     1c41 <fwrite+0xd1>
+    1bd5:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1bd8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1bdb:	ba 00 04 00 00       	mov    $0x400,%edx
+    1be0:	29 c2                	sub    %eax,%edx
+    1be2:	39 ca                	cmp    %ecx,%edx
+    1be4:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1be7:	85 d2                	test   %edx,%edx
+    1be9:	0f 8e d1 00 00 00    	jle    1cc0 <fwrite+0x150>
+    1bef:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1bf2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1bf5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1bf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bff:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1c00:	8d 50 01             	lea    0x1(%eax),%edx
+    1c03:	83 c3 01             	add    $0x1,%ebx
+    1c06:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1c09:	89 56 20             	mov    %edx,0x20(%esi)
+    1c0c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1c10:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1c13:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1c16:	b8 01 00 00 00       	mov    $0x1,%eax
+    1c1b:	80 fa 0a             	cmp    $0xa,%dl
+    1c1e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c21:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1c24:	39 cb                	cmp    %ecx,%ebx
+    1c26:	75 d8                	jne    1c00 <fwrite+0x90>
+    1c28:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1c2b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1c2e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1c31:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1c34:	85 db                	test   %ebx,%ebx
+    1c36:	7e 19                	jle    1c51 <fwrite+0xe1>
+    n -= k;
+    1c38:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1c3a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1c3f:	75 97                	jne    1bd8 <fwrite+0x68>
+    1c41:	89 f0                	mov    %esi,%eax
+    1c43:	e8 08 fe ff ff       	call   1a50 <drain>
+    1c48:	85 c0                	test   %eax,%eax
+    1c4a:	78 68                	js     1cb4 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1c4c:	8b 46 20             	mov    0x20(%esi),%eax
+    1c4f:	eb 87                	jmp    1bd8 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c51:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1c56:	74 74                	je     1ccc <fwrite+0x15c>
+    1c58:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1c5c:	75 04                	jne    1c62 <fwrite+0xf2>
+    1c5e:	85 ff                	test   %edi,%edi
+    1c60:	75 6a                	jne    1ccc <fwrite+0x15c>
+    return nmemb;
+    1c62:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c68:	5b                   	pop    %ebx
+    1c69:	5e                   	pop    %esi
+    1c6a:	5f                   	pop    %edi
+    1c6b:	5d                   	pop    %ebp
+    1c6c:	c3                   	ret
+    1c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1c70:	89 f0                	mov    %esi,%eax
+    1c72:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c75:	e8 d6 fd ff ff       	call   1a50 <drain>
+    1c7a:	85 c0                	test   %eax,%eax
+    1c7c:	78 2f                	js     1cad <fwrite+0x13d>
+    1c7e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1c81:	8b 3e                	mov    (%esi),%edi
+    1c83:	89 de                	mov    %ebx,%esi
+    1c85:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1c88:	eb 0e                	jmp    1c98 <fwrite+0x128>
+    1c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1c90:	29 c3                	sub    %eax,%ebx
+    1c92:	01 c6                	add    %eax,%esi
+    1c94:	85 db                	test   %ebx,%ebx
+    1c96:	7e ca                	jle    1c62 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1c98:	83 ec 04             	sub    $0x4,%esp
+    1c9b:	53                   	push   %ebx
+    1c9c:	56                   	push   %esi
+    1c9d:	57                   	push   %edi
+    1c9e:	e8 bc f7 ff ff       	call   145f <write>
+    1ca3:	83 c4 10             	add    $0x10,%esp
+    1ca6:	85 c0                	test   %eax,%eax
+    1ca8:	7f e6                	jg     1c90 <fwrite+0x120>
+    1caa:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1cad:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1cb4:	31 c0                	xor    %eax,%eax
+}
+    1cb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cb9:	5b                   	pop    %ebx
+    1cba:	5e                   	pop    %esi
+    1cbb:	5f                   	pop    %edi
+    1cbc:	5d                   	pop    %ebp
+    1cbd:	c3                   	ret
+    1cbe:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1cc0:	89 d9                	mov    %ebx,%ecx
+    1cc2:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1cc5:	89 cb                	mov    %ecx,%ebx
+    1cc7:	e9 6e ff ff ff       	jmp    1c3a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1ccc:	89 f0                	mov    %esi,%eax
+    1cce:	e8 7d fd ff ff       	call   1a50 <drain>
+    1cd3:	85 c0                	test   %eax,%eax
+    1cd5:	79 8b                	jns    1c62 <fwrite+0xf2>
+    return 0;
+    1cd7:	31 c0                	xor    %eax,%eax
+    1cd9:	eb db                	jmp    1cb6 <fwrite+0x146>
+    1cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cdf:	90                   	nop
+
+00001ce0 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1ce0:	55                   	push   %ebp
+    1ce1:	89 e5                	mov    %esp,%ebp
+    1ce3:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ce9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1cec:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1cef:	ff 75 0c             	push   0xc(%ebp)
+    1cf2:	6a 01                	push   $0x1
+    1cf4:	6a 01                	push   $0x1
+    1cf6:	50                   	push   %eax
+    1cf7:	e8 74 fe ff ff       	call   1b70 <fwrite>
+    1cfc:	83 c4 10             	add    $0x10,%esp
+    1cff:	83 f8 01             	cmp    $0x1,%eax
+    1d02:	75 0c                	jne    1d10 <fputc+0x30>
+    1d04:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1d08:	c9                   	leave
+    1d09:	c3                   	ret
+    1d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1d10:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1d11:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1d16:	c3                   	ret
+    1d17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d1e:	66 90                	xchg   %ax,%ax
+
+00001d20 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1d20:	55                   	push   %ebp
+    1d21:	89 e5                	mov    %esp,%ebp
+    1d23:	57                   	push   %edi
+    1d24:	56                   	push   %esi
+    1d25:	53                   	push   %ebx
+    1d26:	83 ec 1c             	sub    $0x1c,%esp
+    1d29:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1d2c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1d2f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1d32:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1d35:	85 d2                	test   %edx,%edx
+    1d37:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1d3a:	7e 12                	jle    1d4e <fread+0x2e>
+    1d3c:	85 ff                	test   %edi,%edi
+    1d3e:	7e 0e                	jle    1d4e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1d40:	8b 43 04             	mov    0x4(%ebx),%eax
+    1d43:	85 c0                	test   %eax,%eax
+    1d45:	75 19                	jne    1d60 <fread+0x40>
+    f->err = 1;
+    1d47:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1d51:	31 c0                	xor    %eax,%eax
+}
+    1d53:	5b                   	pop    %ebx
+    1d54:	5e                   	pop    %esi
+    1d55:	5f                   	pop    %edi
+    1d56:	5d                   	pop    %ebp
+    1d57:	c3                   	ret
+    1d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d5f:	90                   	nop
+  setmode(f);
+    1d60:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1d62:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1d64:	e8 67 fc ff ff       	call   19d0 <setmode>
+  for(n = 0; n < want; n += k){
+    1d69:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1d6c:	89 f7                	mov    %esi,%edi
+    1d6e:	eb 31                	jmp    1da1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1d70:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1d74:	74 08                	je     1d7e <fread+0x5e>
+    1d76:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1d7c:	7e 62                	jle    1de0 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1d7e:	83 ec 04             	sub    $0x4,%esp
+    1d81:	56                   	push   %esi
+    1d82:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d85:	01 f8                	add    %edi,%eax
+    1d87:	50                   	push   %eax
+    1d88:	ff 33                	push   (%ebx)
+    1d8a:	e8 c1 f6 ff ff       	call   1450 <read>
+    1d8f:	83 c4 10             	add    $0x10,%esp
+    1d92:	85 c0                	test   %eax,%eax
+    1d94:	0f 8e ce 00 00 00    	jle    1e68 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1d9a:	01 c7                	add    %eax,%edi
+    1d9c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d9f:	7e 36                	jle    1dd7 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1da1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1da4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1da7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1daa:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1dac:	39 c1                	cmp    %eax,%ecx
+    1dae:	7d c0                	jge    1d70 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1db0:	29 c8                	sub    %ecx,%eax
+    1db2:	39 f0                	cmp    %esi,%eax
+    1db4:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1db7:	83 ec 04             	sub    $0x4,%esp
+    1dba:	56                   	push   %esi
+    1dbb:	03 4b 18             	add    0x18(%ebx),%ecx
+    1dbe:	51                   	push   %ecx
+    1dbf:	8b 45 08             	mov    0x8(%ebp),%eax
+    1dc2:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1dc4:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1dc6:	50                   	push   %eax
+    1dc7:	e8 34 f5 ff ff       	call   1300 <memmove>
+      f->r += k;
+    1dcc:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1dcf:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1dd2:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1dd5:	7f ca                	jg     1da1 <fread+0x81>
+    1dd7:	89 fe                	mov    %edi,%esi
+    1dd9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1ddc:	eb 3f                	jmp    1e1d <fread+0xfd>
+    1dde:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1de0:	3b 1d 68 2a 00 00    	cmp    0x2a68,%ebx
+    1de6:	74 68                	je     1e50 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1de8:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1deb:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1df2:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1df9:	68 00 04 00 00       	push   $0x400
+    1dfe:	ff 73 18             	push   0x18(%ebx)
+    1e01:	ff 33                	push   (%ebx)
+    1e03:	e8 48 f6 ff ff       	call   1450 <read>
+    1e08:	83 c4 10             	add    $0x10,%esp
+    1e0b:	85 c0                	test   %eax,%eax
+    1e0d:	78 21                	js     1e30 <fread+0x110>
+  else if(n == 0)
+    1e0f:	75 2f                	jne    1e40 <fread+0x120>
+    f->eof = 1;
+    1e11:	89 fe                	mov    %edi,%esi
+    1e13:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e16:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1e1d:	89 f0                	mov    %esi,%eax
+}
+    1e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1e22:	99                   	cltd
+}
+    1e23:	5b                   	pop    %ebx
+    1e24:	5e                   	pop    %esi
+  return n / size;
+    1e25:	f7 ff                	idiv   %edi
+}
+    1e27:	5f                   	pop    %edi
+    1e28:	5d                   	pop    %ebp
+    1e29:	c3                   	ret
+    1e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1e30:	89 fe                	mov    %edi,%esi
+    1e32:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e35:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1e3c:	eb df                	jmp    1e1d <fread+0xfd>
+    1e3e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1e40:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1e43:	e9 54 ff ff ff       	jmp    1d9c <fread+0x7c>
+    1e48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e4f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1e50:	83 ec 0c             	sub    $0xc,%esp
+    1e53:	ff 35 64 2a 00 00    	push   0x2a64
+    1e59:	e8 a2 fc ff ff       	call   1b00 <fflush>
+    1e5e:	83 c4 10             	add    $0x10,%esp
+    1e61:	eb 85                	jmp    1de8 <fread+0xc8>
+    1e63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e67:	90                   	nop
+        if(k < 0)
+    1e68:	89 fe                	mov    %edi,%esi
+    1e6a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e6d:	74 a7                	je     1e16 <fread+0xf6>
+    1e6f:	eb c4                	jmp    1e35 <fread+0x115>
+    1e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e7f:	90                   	nop
+
+00001e80 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1e80:	55                   	push   %ebp
+    1e81:	89 e5                	mov    %esp,%ebp
+    1e83:	53                   	push   %ebx
+    1e84:	83 ec 14             	sub    $0x14,%esp
+    1e87:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1e8a:	8b 50 04             	mov    0x4(%eax),%edx
+    1e8d:	85 d2                	test   %edx,%edx
+    1e8f:	74 08                	je     1e99 <fgetc+0x19>
+    1e91:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1e94:	3b 50 20             	cmp    0x20(%eax),%edx
+    1e97:	7c 27                	jl     1ec0 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e99:	50                   	push   %eax
+    1e9a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1e9d:	6a 01                	push   $0x1
+    1e9f:	6a 01                	push   $0x1
+    1ea1:	50                   	push   %eax
+    1ea2:	e8 79 fe ff ff       	call   1d20 <fread>
+    1ea7:	83 c4 10             	add    $0x10,%esp
+    1eaa:	83 f8 01             	cmp    $0x1,%eax
+    1ead:	75 29                	jne    1ed8 <fgetc+0x58>
+    1eaf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1eb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1eb6:	c9                   	leave
+    1eb7:	c3                   	ret
+    1eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ebf:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1ec0:	8b 48 18             	mov    0x18(%eax),%ecx
+    1ec3:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1ec6:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1ec9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1ecc:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1ed0:	c9                   	leave
+    1ed1:	c3                   	ret
+    1ed2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1ed8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1edd:	eb d4                	jmp    1eb3 <fgetc+0x33>
+    1edf:	90                   	nop
+
+00001ee0 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1ee0:	55                   	push   %ebp
+    1ee1:	89 e5                	mov    %esp,%ebp
+    1ee3:	57                   	push   %edi
+    1ee4:	56                   	push   %esi
+    1ee5:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1ee6:	31 db                	xor    %ebx,%ebx
+{
+    1ee8:	83 ec 1c             	sub    $0x1c,%esp
+    1eeb:	8b 75 10             	mov    0x10(%ebp),%esi
+    1eee:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1ef0:	eb 2e                	jmp    1f20 <fgets+0x40>
+    1ef2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1ef8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1efb:	57                   	push   %edi
+    1efc:	6a 01                	push   $0x1
+    1efe:	6a 01                	push   $0x1
+    1f00:	50                   	push   %eax
+    1f01:	e8 1a fe ff ff       	call   1d20 <fread>
+    1f06:	83 c4 10             	add    $0x10,%esp
+    1f09:	83 f8 01             	cmp    $0x1,%eax
+    1f0c:	75 62                	jne    1f70 <fgets+0x90>
+    1f0e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f15:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1f17:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1f1b:	83 f9 0a             	cmp    $0xa,%ecx
+    1f1e:	74 34                	je     1f54 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1f20:	89 de                	mov    %ebx,%esi
+    1f22:	83 c3 01             	add    $0x1,%ebx
+    1f25:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1f28:	7d 46                	jge    1f70 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1f2a:	8b 47 04             	mov    0x4(%edi),%eax
+    1f2d:	85 c0                	test   %eax,%eax
+    1f2f:	74 c7                	je     1ef8 <fgets+0x18>
+    1f31:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1f34:	3b 47 20             	cmp    0x20(%edi),%eax
+    1f37:	7d bf                	jge    1ef8 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1f39:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1f3c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1f3f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1f42:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1f45:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1f49:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1f4b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1f4f:	83 f9 0a             	cmp    $0xa,%ecx
+    1f52:	75 cc                	jne    1f20 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1f54:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f57:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1f5b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1f5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f61:	5b                   	pop    %ebx
+    1f62:	5e                   	pop    %esi
+    1f63:	5f                   	pop    %edi
+    1f64:	5d                   	pop    %ebp
+    1f65:	c3                   	ret
+    1f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f6d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    1f70:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f73:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    1f77:	31 c0                	xor    %eax,%eax
+    1f79:	85 f6                	test   %esi,%esi
+    1f7b:	74 e1                	je     1f5e <fgets+0x7e>
+    1f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f80:	eb dc                	jmp    1f5e <fgets+0x7e>
+    1f82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001f90 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f94:	bb 80 2a 00 00       	mov    $0x2a80,%ebx
+{
+    1f99:	83 ec 04             	sub    $0x4,%esp
+    1f9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    1fa0:	8b 53 04             	mov    0x4(%ebx),%edx
+    1fa3:	85 d2                	test   %edx,%edx
+    1fa5:	75 07                	jne    1fae <fdopen+0x1e>
+    1fa7:	8b 43 08             	mov    0x8(%ebx),%eax
+    1faa:	85 c0                	test   %eax,%eax
+    1fac:	74 1a                	je     1fc8 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1fae:	83 c3 24             	add    $0x24,%ebx
+    1fb1:	81 fb c0 2c 00 00    	cmp    $0x2cc0,%ebx
+    1fb7:	75 e7                	jne    1fa0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    1fb9:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    1fbb:	89 d8                	mov    %ebx,%eax
+    1fbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fc0:	c9                   	leave
+    1fc1:	c3                   	ret
+    1fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    1fc8:	81 fb c0 2c 00 00    	cmp    $0x2cc0,%ebx
+    1fce:	74 e9                	je     1fb9 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    1fd0:	83 ec 04             	sub    $0x4,%esp
+    1fd3:	6a 24                	push   $0x24
+    1fd5:	6a 00                	push   $0x0
+    1fd7:	53                   	push   %ebx
+    1fd8:	e8 d3 f1 ff ff       	call   11b0 <memset>
+  f->fd = fd;
+    1fdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    1fe0:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    1fe7:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    1fea:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    1fec:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1fef:	80 38 72             	cmpb   $0x72,(%eax)
+    1ff2:	74 14                	je     2008 <fdopen+0x78>
+    f->writable = 1;
+    1ff4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    1ffb:	89 d8                	mov    %ebx,%eax
+    1ffd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2000:	c9                   	leave
+    2001:	c3                   	ret
+    2002:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2008:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    200f:	89 d8                	mov    %ebx,%eax
+    2011:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2014:	c9                   	leave
+    2015:	c3                   	ret
+    2016:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    201d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002020 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2020:	55                   	push   %ebp
+    2021:	89 e5                	mov    %esp,%ebp
+    2023:	56                   	push   %esi
+    2024:	53                   	push   %ebx
+    2025:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2028:	0f b6 06             	movzbl (%esi),%eax
+    202b:	3c 72                	cmp    $0x72,%al
+    202d:	74 61                	je     2090 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    202f:	3c 77                	cmp    $0x77,%al
+    2031:	74 7d                	je     20b0 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2033:	3c 61                	cmp    $0x61,%al
+    2035:	75 49                	jne    2080 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2037:	83 ec 08             	sub    $0x8,%esp
+    203a:	68 01 02 00 00       	push   $0x201
+    203f:	ff 75 08             	push   0x8(%ebp)
+    2042:	e8 54 f4 ff ff       	call   149b <open>
+    2047:	83 c4 10             	add    $0x10,%esp
+    204a:	89 c3                	mov    %eax,%ebx
+    204c:	85 c0                	test   %eax,%eax
+    204e:	78 30                	js     2080 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2050:	83 ec 04             	sub    $0x4,%esp
+    2053:	6a 02                	push   $0x2
+    2055:	6a 00                	push   $0x0
+    2057:	50                   	push   %eax
+    2058:	e8 4c f5 ff ff       	call   15a9 <lseek>
+    205d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2060:	83 ec 08             	sub    $0x8,%esp
+    2063:	56                   	push   %esi
+    2064:	53                   	push   %ebx
+    2065:	e8 26 ff ff ff       	call   1f90 <fdopen>
+    206a:	83 c4 10             	add    $0x10,%esp
+    206d:	85 c0                	test   %eax,%eax
+    206f:	75 11                	jne    2082 <fopen+0x62>
+    close(fd);
+    2071:	83 ec 0c             	sub    $0xc,%esp
+    2074:	53                   	push   %ebx
+    2075:	e8 f4 f3 ff ff       	call   146e <close>
+    207a:	83 c4 10             	add    $0x10,%esp
+    207d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2080:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2082:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2085:	5b                   	pop    %ebx
+    2086:	5e                   	pop    %esi
+    2087:	5d                   	pop    %ebp
+    2088:	c3                   	ret
+    2089:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2090:	83 ec 08             	sub    $0x8,%esp
+    2093:	6a 00                	push   $0x0
+    2095:	ff 75 08             	push   0x8(%ebp)
+    2098:	e8 fe f3 ff ff       	call   149b <open>
+    209d:	83 c4 10             	add    $0x10,%esp
+    20a0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    20a2:	85 db                	test   %ebx,%ebx
+    20a4:	78 da                	js     2080 <fopen+0x60>
+    20a6:	eb b8                	jmp    2060 <fopen+0x40>
+    20a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20af:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    20b0:	83 ec 08             	sub    $0x8,%esp
+    20b3:	68 01 06 00 00       	push   $0x601
+    20b8:	ff 75 08             	push   0x8(%ebp)
+    20bb:	e8 db f3 ff ff       	call   149b <open>
+    20c0:	83 c4 10             	add    $0x10,%esp
+    20c3:	89 c3                	mov    %eax,%ebx
+    20c5:	eb db                	jmp    20a2 <fopen+0x82>
+    20c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ce:	66 90                	xchg   %ax,%ax
+
+000020d0 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    20d0:	55                   	push   %ebp
+    20d1:	89 e5                	mov    %esp,%ebp
+    20d3:	56                   	push   %esi
+    20d4:	53                   	push   %ebx
+    20d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    20d8:	83 ec 0c             	sub    $0xc,%esp
+    20db:	53                   	push   %ebx
+    20dc:	e8 1f fa ff ff       	call   1b00 <fflush>
+    20e1:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    20e3:	58                   	pop    %eax
+    20e4:	ff 33                	push   (%ebx)
+    20e6:	e8 83 f3 ff ff       	call   146e <close>
+    20eb:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    20ee:	85 c0                	test   %eax,%eax
+    20f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    20f5:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    20f8:	8b 43 18             	mov    0x18(%ebx),%eax
+    20fb:	85 c0                	test   %eax,%eax
+    20fd:	0f 95 c1             	setne  %cl
+    2100:	3d e0 30 00 00       	cmp    $0x30e0,%eax
+    2105:	0f 95 c2             	setne  %dl
+    2108:	84 d1                	test   %dl,%cl
+    210a:	74 07                	je     2113 <fclose+0x43>
+    210c:	3d e0 2c 00 00       	cmp    $0x2ce0,%eax
+    2111:	75 25                	jne    2138 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2113:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    211a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    211c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2123:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    212a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    212d:	5b                   	pop    %ebx
+    212e:	5e                   	pop    %esi
+    212f:	5d                   	pop    %ebp
+    2130:	c3                   	ret
+    2131:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2138:	83 ec 0c             	sub    $0xc,%esp
+    213b:	50                   	push   %eax
+    213c:	e8 3f 00 00 00       	call   2180 <free>
+    2141:	83 c4 10             	add    $0x10,%esp
+    2144:	eb cd                	jmp    2113 <fclose+0x43>
+    2146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    214d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002150 <feof>:
+
+int
+feof(FILE *f)
+{
+    2150:	55                   	push   %ebp
+    2151:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2153:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2156:	5d                   	pop    %ebp
+  return f->eof;
+    2157:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    215a:	c3                   	ret
+    215b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    215f:	90                   	nop
+
+00002160 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2160:	55                   	push   %ebp
+    2161:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2163:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2166:	5d                   	pop    %ebp
+  return f->err;
+    2167:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    216a:	c3                   	ret
+    216b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    216f:	90                   	nop
+
+00002170 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2170:	55                   	push   %ebp
+    2171:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2173:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2176:	5d                   	pop    %ebp
+  return f->fd;
+    2177:	8b 00                	mov    (%eax),%eax
+}
+    2179:	c3                   	ret
+    217a:	66 90                	xchg   %ax,%ax
+    217c:	66 90                	xchg   %ax,%ax
+    217e:	66 90                	xchg   %ax,%ax
+
+00002180 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2180:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2181:	a1 e0 34 00 00       	mov    0x34e0,%eax
+{
+    2186:	89 e5                	mov    %esp,%ebp
+    2188:	57                   	push   %edi
+    2189:	56                   	push   %esi
+    218a:	53                   	push   %ebx
+    218b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    218e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2191:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2198:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    219a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    219c:	39 ca                	cmp    %ecx,%edx
+    219e:	73 30                	jae    21d0 <free+0x50>
+    21a0:	39 c1                	cmp    %eax,%ecx
+    21a2:	72 04                	jb     21a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    21a4:	39 c2                	cmp    %eax,%edx
+    21a6:	72 f0                	jb     2198 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    21a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    21ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    21ae:	39 f8                	cmp    %edi,%eax
+    21b0:	74 2e                	je     21e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    21b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    21b5:	8b 42 04             	mov    0x4(%edx),%eax
+    21b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    21bb:	39 f1                	cmp    %esi,%ecx
+    21bd:	74 38                	je     21f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    21bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    21c1:	5b                   	pop    %ebx
+  freep = p;
+    21c2:	89 15 e0 34 00 00    	mov    %edx,0x34e0
+}
+    21c8:	5e                   	pop    %esi
+    21c9:	5f                   	pop    %edi
+    21ca:	5d                   	pop    %ebp
+    21cb:	c3                   	ret
+    21cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    21d0:	39 c1                	cmp    %eax,%ecx
+    21d2:	72 d0                	jb     21a4 <free+0x24>
+    21d4:	eb c2                	jmp    2198 <free+0x18>
+    21d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    21e0:	03 70 04             	add    0x4(%eax),%esi
+    21e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    21e6:	8b 02                	mov    (%edx),%eax
+    21e8:	8b 00                	mov    (%eax),%eax
+    21ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    21ed:	8b 42 04             	mov    0x4(%edx),%eax
+    21f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    21f3:	39 f1                	cmp    %esi,%ecx
+    21f5:	75 c8                	jne    21bf <free+0x3f>
+    p->s.size += bp->s.size;
+    21f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    21fa:	89 15 e0 34 00 00    	mov    %edx,0x34e0
+    p->s.size += bp->s.size;
+    2200:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2203:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2206:	89 0a                	mov    %ecx,(%edx)
+}
+    2208:	5b                   	pop    %ebx
+    2209:	5e                   	pop    %esi
+    220a:	5f                   	pop    %edi
+    220b:	5d                   	pop    %ebp
+    220c:	c3                   	ret
+    220d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002210 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2210:	55                   	push   %ebp
+    2211:	89 e5                	mov    %esp,%ebp
+    2213:	57                   	push   %edi
+    2214:	56                   	push   %esi
+    2215:	53                   	push   %ebx
+    2216:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2219:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    221c:	8b 15 e0 34 00 00    	mov    0x34e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2222:	8d 78 07             	lea    0x7(%eax),%edi
+    2225:	c1 ef 03             	shr    $0x3,%edi
+    2228:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    222b:	85 d2                	test   %edx,%edx
+    222d:	0f 84 8d 00 00 00    	je     22c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2233:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2235:	8b 48 04             	mov    0x4(%eax),%ecx
+    2238:	39 f9                	cmp    %edi,%ecx
+    223a:	73 64                	jae    22a0 <malloc+0x90>
+  if(nu < 4096)
+    223c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2241:	39 df                	cmp    %ebx,%edi
+    2243:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2246:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    224d:	eb 0a                	jmp    2259 <malloc+0x49>
+    224f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2250:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2252:	8b 48 04             	mov    0x4(%eax),%ecx
+    2255:	39 f9                	cmp    %edi,%ecx
+    2257:	73 47                	jae    22a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2259:	89 c2                	mov    %eax,%edx
+    225b:	39 05 e0 34 00 00    	cmp    %eax,0x34e0
+    2261:	75 ed                	jne    2250 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2263:	83 ec 0c             	sub    $0xc,%esp
+    2266:	56                   	push   %esi
+    2267:	e8 b6 f2 ff ff       	call   1522 <sbrk>
+  if(p == (char*)-1)
+    226c:	83 c4 10             	add    $0x10,%esp
+    226f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2272:	74 1c                	je     2290 <malloc+0x80>
+  hp->s.size = nu;
+    2274:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2277:	83 ec 0c             	sub    $0xc,%esp
+    227a:	83 c0 08             	add    $0x8,%eax
+    227d:	50                   	push   %eax
+    227e:	e8 fd fe ff ff       	call   2180 <free>
+  return freep;
+    2283:	8b 15 e0 34 00 00    	mov    0x34e0,%edx
+      if((p = morecore(nunits)) == 0)
+    2289:	83 c4 10             	add    $0x10,%esp
+    228c:	85 d2                	test   %edx,%edx
+    228e:	75 c0                	jne    2250 <malloc+0x40>
+        return 0;
+  }
+}
+    2290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2293:	31 c0                	xor    %eax,%eax
+}
+    2295:	5b                   	pop    %ebx
+    2296:	5e                   	pop    %esi
+    2297:	5f                   	pop    %edi
+    2298:	5d                   	pop    %ebp
+    2299:	c3                   	ret
+    229a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    22a0:	39 cf                	cmp    %ecx,%edi
+    22a2:	74 4c                	je     22f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    22a4:	29 f9                	sub    %edi,%ecx
+    22a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    22a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    22ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    22af:	89 15 e0 34 00 00    	mov    %edx,0x34e0
+}
+    22b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    22b8:	83 c0 08             	add    $0x8,%eax
+}
+    22bb:	5b                   	pop    %ebx
+    22bc:	5e                   	pop    %esi
+    22bd:	5f                   	pop    %edi
+    22be:	5d                   	pop    %ebp
+    22bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    22c0:	c7 05 e0 34 00 00 e4 	movl   $0x34e4,0x34e0
+    22c7:	34 00 00 
+    base.s.size = 0;
+    22ca:	b8 e4 34 00 00       	mov    $0x34e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    22cf:	c7 05 e4 34 00 00 e4 	movl   $0x34e4,0x34e4
+    22d6:	34 00 00 
+    base.s.size = 0;
+    22d9:	c7 05 e8 34 00 00 00 	movl   $0x0,0x34e8
+    22e0:	00 00 00 
+    if(p->s.size >= nunits){
+    22e3:	e9 54 ff ff ff       	jmp    223c <malloc+0x2c>
+    22e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    22f0:	8b 08                	mov    (%eax),%ecx
+    22f2:	89 0a                	mov    %ecx,(%edx)
+    22f4:	eb b9                	jmp    22af <malloc+0x9f>
@@ -0,0 +1,2691 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 08             	sub    $0x8,%esp
+    1019:	8b 31                	mov    (%ecx),%esi
+    101b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+    101e:	83 fe 01             	cmp    $0x1,%esi
+    1021:	7e 27                	jle    104a <main+0x4a>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+    1028:	83 ec 0c             	sub    $0xc,%esp
+    102b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+    102e:	83 c3 01             	add    $0x1,%ebx
+    kill(atoi(argv[i]));
+    1031:	e8 fa 01 00 00       	call   1230 <atoi>
+    1036:	89 04 24             	mov    %eax,(%esp)
+    1039:	e8 af 03 00 00       	call   13ed <kill>
+  for(i=1; i<argc; i++)
+    103e:	83 c4 10             	add    $0x10,%esp
+    1041:	39 de                	cmp    %ebx,%esi
+    1043:	75 e3                	jne    1028 <main+0x28>
+  exit();
+    1045:	e8 f6 02 00 00       	call   1340 <exit>
+    printf(2, "usage: kill pid...\n");
+    104a:	50                   	push   %eax
+    104b:	50                   	push   %eax
+    104c:	68 68 22 00 00       	push   $0x2268
+    1051:	6a 02                	push   $0x2
+    1053:	e8 58 08 00 00       	call   18b0 <printf>
+    exit();
+    1058:	e8 e3 02 00 00       	call   1340 <exit>
+    105d:	66 90                	xchg   %ax,%ax
+    105f:	90                   	nop
+
+00001060 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1060:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1061:	31 c0                	xor    %eax,%eax
+{
+    1063:	89 e5                	mov    %esp,%ebp
+    1065:	53                   	push   %ebx
+    1066:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1069:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    106c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1070:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1074:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1077:	83 c0 01             	add    $0x1,%eax
+    107a:	84 d2                	test   %dl,%dl
+    107c:	75 f2                	jne    1070 <strcpy+0x10>
+    ;
+  return os;
+}
+    107e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1081:	89 c8                	mov    %ecx,%eax
+    1083:	c9                   	leave
+    1084:	c3                   	ret
+    1085:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	53                   	push   %ebx
+    1094:	8b 55 08             	mov    0x8(%ebp),%edx
+    1097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    109a:	0f b6 02             	movzbl (%edx),%eax
+    109d:	84 c0                	test   %al,%al
+    109f:	75 17                	jne    10b8 <strcmp+0x28>
+    10a1:	eb 3a                	jmp    10dd <strcmp+0x4d>
+    10a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10a7:	90                   	nop
+    10a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    10ac:	83 c2 01             	add    $0x1,%edx
+    10af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    10b2:	84 c0                	test   %al,%al
+    10b4:	74 1a                	je     10d0 <strcmp+0x40>
+    p++, q++;
+    10b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    10b8:	0f b6 19             	movzbl (%ecx),%ebx
+    10bb:	38 c3                	cmp    %al,%bl
+    10bd:	74 e9                	je     10a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    10bf:	29 d8                	sub    %ebx,%eax
+}
+    10c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10c4:	c9                   	leave
+    10c5:	c3                   	ret
+    10c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10d4:	31 c0                	xor    %eax,%eax
+    10d6:	29 d8                	sub    %ebx,%eax
+}
+    10d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10db:	c9                   	leave
+    10dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10dd:	0f b6 19             	movzbl (%ecx),%ebx
+    10e0:	31 c0                	xor    %eax,%eax
+    10e2:	eb db                	jmp    10bf <strcmp+0x2f>
+    10e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+
+000010f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    10f6:	80 3a 00             	cmpb   $0x0,(%edx)
+    10f9:	74 15                	je     1110 <strlen+0x20>
+    10fb:	31 c0                	xor    %eax,%eax
+    10fd:	8d 76 00             	lea    0x0(%esi),%esi
+    1100:	83 c0 01             	add    $0x1,%eax
+    1103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1107:	89 c1                	mov    %eax,%ecx
+    1109:	75 f5                	jne    1100 <strlen+0x10>
+    ;
+  return n;
+}
+    110b:	89 c8                	mov    %ecx,%eax
+    110d:	5d                   	pop    %ebp
+    110e:	c3                   	ret
+    110f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1110:	31 c9                	xor    %ecx,%ecx
+}
+    1112:	5d                   	pop    %ebp
+    1113:	89 c8                	mov    %ecx,%eax
+    1115:	c3                   	ret
+    1116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	57                   	push   %edi
+    1124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    112a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    112d:	89 d7                	mov    %edx,%edi
+    112f:	fc                   	cld
+    1130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1135:	89 d0                	mov    %edx,%eax
+    1137:	c9                   	leave
+    1138:	c3                   	ret
+    1139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	8b 45 08             	mov    0x8(%ebp),%eax
+    1146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    114a:	0f b6 10             	movzbl (%eax),%edx
+    114d:	84 d2                	test   %dl,%dl
+    114f:	75 12                	jne    1163 <strchr+0x23>
+    1151:	eb 1d                	jmp    1170 <strchr+0x30>
+    1153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1157:	90                   	nop
+    1158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    115c:	83 c0 01             	add    $0x1,%eax
+    115f:	84 d2                	test   %dl,%dl
+    1161:	74 0d                	je     1170 <strchr+0x30>
+    if(*s == c)
+    1163:	38 d1                	cmp    %dl,%cl
+    1165:	75 f1                	jne    1158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1167:	5d                   	pop    %ebp
+    1168:	c3                   	ret
+    1169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1170:	31 c0                	xor    %eax,%eax
+}
+    1172:	5d                   	pop    %ebp
+    1173:	c3                   	ret
+    1174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+
+00001180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	57                   	push   %edi
+    1184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1189:	31 db                	xor    %ebx,%ebx
+{
+    118b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    118e:	eb 27                	jmp    11b7 <gets+0x37>
+    cc = read(0, &c, 1);
+    1190:	83 ec 04             	sub    $0x4,%esp
+    1193:	6a 01                	push   $0x1
+    1195:	56                   	push   %esi
+    1196:	6a 00                	push   $0x0
+    1198:	e8 23 02 00 00       	call   13c0 <read>
+    if(cc < 1)
+    119d:	83 c4 10             	add    $0x10,%esp
+    11a0:	85 c0                	test   %eax,%eax
+    11a2:	7e 1d                	jle    11c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    11a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    11a8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    11af:	3c 0a                	cmp    $0xa,%al
+    11b1:	74 10                	je     11c3 <gets+0x43>
+    11b3:	3c 0d                	cmp    $0xd,%al
+    11b5:	74 0c                	je     11c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    11b7:	89 df                	mov    %ebx,%edi
+    11b9:	83 c3 01             	add    $0x1,%ebx
+    11bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    11bf:	7c cf                	jl     1190 <gets+0x10>
+    11c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    11c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    11ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11cd:	5b                   	pop    %ebx
+    11ce:	5e                   	pop    %esi
+    11cf:	5f                   	pop    %edi
+    11d0:	5d                   	pop    %ebp
+    11d1:	c3                   	ret
+    11d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	56                   	push   %esi
+    11e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11e5:	83 ec 08             	sub    $0x8,%esp
+    11e8:	6a 00                	push   $0x0
+    11ea:	ff 75 08             	push   0x8(%ebp)
+    11ed:	e8 19 02 00 00       	call   140b <open>
+  if(fd < 0)
+    11f2:	83 c4 10             	add    $0x10,%esp
+    11f5:	85 c0                	test   %eax,%eax
+    11f7:	78 27                	js     1220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    11f9:	83 ec 08             	sub    $0x8,%esp
+    11fc:	ff 75 0c             	push   0xc(%ebp)
+    11ff:	89 c3                	mov    %eax,%ebx
+    1201:	50                   	push   %eax
+    1202:	e8 31 02 00 00       	call   1438 <fstat>
+  close(fd);
+    1207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    120a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    120c:	e8 cd 01 00 00       	call   13de <close>
+  return r;
+    1211:	83 c4 10             	add    $0x10,%esp
+}
+    1214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1217:	89 f0                	mov    %esi,%eax
+    1219:	5b                   	pop    %ebx
+    121a:	5e                   	pop    %esi
+    121b:	5d                   	pop    %ebp
+    121c:	c3                   	ret
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1225:	eb ed                	jmp    1214 <stat+0x34>
+    1227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122e:	66 90                	xchg   %ax,%ax
+
+00001230 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	53                   	push   %ebx
+    1234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1237:	0f be 02             	movsbl (%edx),%eax
+    123a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    123d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1245:	77 1e                	ja     1265 <atoi+0x35>
+    1247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1250:	83 c2 01             	add    $0x1,%edx
+    1253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    125a:	0f be 02             	movsbl (%edx),%eax
+    125d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1260:	80 fb 09             	cmp    $0x9,%bl
+    1263:	76 eb                	jbe    1250 <atoi+0x20>
+  return n;
+}
+    1265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1268:	89 c8                	mov    %ecx,%eax
+    126a:	c9                   	leave
+    126b:	c3                   	ret
+    126c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	57                   	push   %edi
+    1274:	56                   	push   %esi
+    1275:	8b 45 10             	mov    0x10(%ebp),%eax
+    1278:	8b 55 08             	mov    0x8(%ebp),%edx
+    127b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    127e:	85 c0                	test   %eax,%eax
+    1280:	7e 13                	jle    1295 <memmove+0x25>
+    1282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1284:	89 d7                	mov    %edx,%edi
+    1286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1291:	39 f8                	cmp    %edi,%eax
+    1293:	75 fb                	jne    1290 <memmove+0x20>
+  return vdst;
+}
+    1295:	5e                   	pop    %esi
+    1296:	89 d0                	mov    %edx,%eax
+    1298:	5f                   	pop    %edi
+    1299:	5d                   	pop    %ebp
+    129a:	c3                   	ret
+    129b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+
+000012a0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	56                   	push   %esi
+    12a4:	53                   	push   %ebx
+    12a5:	8b 75 10             	mov    0x10(%ebp),%esi
+    12a8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    12ae:	85 f6                	test   %esi,%esi
+    12b0:	74 2e                	je     12e0 <memcmp+0x40>
+    12b2:	01 c6                	add    %eax,%esi
+    12b4:	eb 14                	jmp    12ca <memcmp+0x2a>
+    12b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    12c0:	83 c0 01             	add    $0x1,%eax
+    12c3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    12c6:	39 f0                	cmp    %esi,%eax
+    12c8:	74 16                	je     12e0 <memcmp+0x40>
+    if(*s1 != *s2)
+    12ca:	0f b6 0a             	movzbl (%edx),%ecx
+    12cd:	0f b6 18             	movzbl (%eax),%ebx
+    12d0:	38 d9                	cmp    %bl,%cl
+    12d2:	74 ec                	je     12c0 <memcmp+0x20>
+      return *s1 - *s2;
+    12d4:	0f b6 c1             	movzbl %cl,%eax
+    12d7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    12d9:	5b                   	pop    %ebx
+    12da:	5e                   	pop    %esi
+    12db:	5d                   	pop    %ebp
+    12dc:	c3                   	ret
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+    12e0:	5b                   	pop    %ebx
+  return 0;
+    12e1:	31 c0                	xor    %eax,%eax
+}
+    12e3:	5e                   	pop    %esi
+    12e4:	5d                   	pop    %ebp
+    12e5:	c3                   	ret
+    12e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012f0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    12f0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    12f5:	c3                   	ret
+    12f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001300 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1300:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1305:	c3                   	ret
+    1306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001310 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1310:	a1 e0 2b 00 00       	mov    0x2be0,%eax
+    1315:	85 c0                	test   %eax,%eax
+    1317:	74 17                	je     1330 <fork+0x20>
+{
+    1319:	55                   	push   %ebp
+    131a:	89 e5                	mov    %esp,%ebp
+    131c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    131f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1321:	c9                   	leave
+  return _fork();
+    1322:	e9 5d 00 00 00       	jmp    1384 <_fork>
+    1327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132e:	66 90                	xchg   %ax,%ax
+    1330:	e9 4f 00 00 00       	jmp    1384 <_fork>
+    1335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001340 <exit>:
+
+int
+exit(void)
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1346:	a1 e0 2b 00 00       	mov    0x2be0,%eax
+    134b:	85 c0                	test   %eax,%eax
+    134d:	74 02                	je     1351 <exit+0x11>
+    flushhook();
+    134f:	ff d0                	call   *%eax
+  _exit();
+    1351:	e8 3d 00 00 00       	call   1393 <_exit>
+    1356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001360 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1360:	55                   	push   %ebp
+  if(flushhook)
+    1361:	a1 e0 2b 00 00       	mov    0x2be0,%eax
+{
+    1366:	89 e5                	mov    %esp,%ebp
+    1368:	56                   	push   %esi
+    1369:	53                   	push   %ebx
+    136a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    136d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1370:	85 c0                	test   %eax,%eax
+    1372:	74 02                	je     1376 <exec+0x16>
+    flushhook();
+    1374:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1376:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1379:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    137c:	5b                   	pop    %ebx
+    137d:	5e                   	pop    %esi
+    137e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    137f:	e9 78 00 00 00       	jmp    13fc <_exec>
+
+00001384 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1384:	b8 01 00 00 00       	mov    $0x1,%eax
+    1389:	89 e1                	mov    %esp,%ecx
+    138b:	ba 92 13 00 00       	mov    $0x1392,%edx
+    1390:	0f 34                	sysenter
+    1392:	c3                   	ret
+
+00001393 <_exit>:
+RAWSYSCALL(exit)
+    1393:	b8 02 00 00 00       	mov    $0x2,%eax
+    1398:	89 e1                	mov    %esp,%ecx
+    139a:	ba a1 13 00 00       	mov    $0x13a1,%edx
+    139f:	0f 34                	sysenter
+    13a1:	c3                   	ret
+
+000013a2 <wait>:
+SYSCALL(wait)
+    13a2:	b8 03 00 00 00       	mov    $0x3,%eax
+    13a7:	89 e1                	mov    %esp,%ecx
+    13a9:	ba b0 13 00 00       	mov    $0x13b0,%edx
+    13ae:	0f 34                	sysenter
+    13b0:	c3                   	ret
+
+000013b1 <pipe>:
+SYSCALL(pipe)
+    13b1:	b8 04 00 00 00       	mov    $0x4,%eax
+    13b6:	89 e1                	mov    %esp,%ecx
+    13b8:	ba bf 13 00 00       	mov    $0x13bf,%edx
+    13bd:	0f 34                	sysenter
+    13bf:	c3                   	ret
+
+000013c0 <read>:
+SYSCALL(read)
+    13c0:	b8 05 00 00 00       	mov    $0x5,%eax
+    13c5:	89 e1                	mov    %esp,%ecx
+    13c7:	ba ce 13 00 00       	mov    $0x13ce,%edx
+    13cc:	0f 34                	sysenter
+    13ce:	c3                   	ret
+
+000013cf <write>:
+SYSCALL(write)
+    13cf:	b8 10 00 00 00       	mov    $0x10,%eax
+    13d4:	89 e1                	mov    %esp,%ecx
+    13d6:	ba dd 13 00 00       	mov    $0x13dd,%edx
+    13db:	0f 34                	sysenter
+    13dd:	c3                   	ret
+
+000013de <close>:
+SYSCALL(close)
+    13de:	b8 15 00 00 00       	mov    $0x15,%eax
+    13e3:	89 e1                	mov    %esp,%ecx
+    13e5:	ba ec 13 00 00       	mov    $0x13ec,%edx
+    13ea:	0f 34                	sysenter
+    13ec:	c3                   	ret
+
+000013ed <kill>:
+SYSCALL(kill)
+    13ed:	b8 06 00 00 00       	mov    $0x6,%eax
+    13f2:	89 e1                	mov    %esp,%ecx
+    13f4:	ba fb 13 00 00       	mov    $0x13fb,%edx
+    13f9:	0f 34                	sysenter
+    13fb:	c3                   	ret
+
+000013fc <_exec>:
+RAWSYSCALL(exec)
+    13fc:	b8 07 00 00 00       	mov    $0x7,%eax
+    1401:	89 e1                	mov    %esp,%ecx
+    1403:	ba 0a 14 00 00       	mov    $0x140a,%edx
+    1408:	0f 34                	sysenter
+    140a:	c3                   	ret
+
+0000140b <open>:
+SYSCALL(open)
+    140b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1410:	89 e1                	mov    %esp,%ecx
+    1412:	ba 19 14 00 00       	mov    $0x1419,%edx
+    1417:	0f 34                	sysenter
+    1419:	c3                   	ret
+
+0000141a <mknod>:
+SYSCALL(mknod)
+    141a:	b8 11 00 00 00       	mov    $0x11,%eax
+    141f:	89 e1                	mov    %esp,%ecx
+    1421:	ba 28 14 00 00       	mov    $0x1428,%edx
+    1426:	0f 34                	sysenter
+    1428:	c3                   	ret
+
+00001429 <unlink>:
+SYSCALL(unlink)
+    1429:	b8 12 00 00 00       	mov    $0x12,%eax
+    142e:	89 e1                	mov    %esp,%ecx
+    1430:	ba 37 14 00 00       	mov    $0x1437,%edx
+    1435:	0f 34                	sysenter
+    1437:	c3                   	ret
+
+00001438 <fstat>:
+SYSCALL(fstat)
+    1438:	b8 08 00 00 00       	mov    $0x8,%eax
+    143d:	89 e1                	mov    %esp,%ecx
+    143f:	ba 46 14 00 00       	mov    $0x1446,%edx
+    1444:	0f 34                	sysenter
+    1446:	c3                   	ret
+
+00001447 <link>:
+SYSCALL(link)
+    1447:	b8 13 00 00 00       	mov    $0x13,%eax
+    144c:	89 e1                	mov    %esp,%ecx
+    144e:	ba 55 14 00 00       	mov    $0x1455,%edx
+    1453:	0f 34                	sysenter
+    1455:	c3                   	ret
+
+00001456 <mkdir>:
+SYSCALL(mkdir)
+    1456:	b8 14 00 00 00       	mov    $0x14,%eax
+    145b:	89 e1                	mov    %esp,%ecx
+    145d:	ba 64 14 00 00       	mov    $0x1464,%edx
+    1462:	0f 34                	sysenter
+    1464:	c3                   	ret
+
+00001465 <chdir>:
+SYSCALL(chdir)
+    1465:	b8 09 00 00 00       	mov    $0x9,%eax
+    146a:	89 e1                	mov    %esp,%ecx
+    146c:	ba 73 14 00 00       	mov    $0x1473,%edx
+    1471:	0f 34                	sysenter
+    1473:	c3                   	ret
+
+00001474 <dup>:
+SYSCALL(dup)
+    1474:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1479:	89 e1                	mov    %esp,%ecx
+    147b:	ba 82 14 00 00       	mov    $0x1482,%edx
+    1480:	0f 34                	sysenter
+    1482:	c3                   	ret
+
+00001483 <getpid>:
+SYSCALL(getpid)
+    1483:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1488:	89 e1                	mov    %esp,%ecx
+    148a:	ba 91 14 00 00       	mov    $0x1491,%edx
+    148f:	0f 34                	sysenter
+    1491:	c3                   	ret
+
+00001492 <sbrk>:
+SYSCALL(sbrk)
+    1492:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1497:	89 e1                	mov    %esp,%ecx
+    1499:	ba a0 14 00 00       	mov    $0x14a0,%edx
+    149e:	0f 34                	sysenter
+    14a0:	c3                   	ret
+
+000014a1 <sleep>:
+SYSCALL(sleep)
+    14a1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14a6:	89 e1                	mov    %esp,%ecx
+    14a8:	ba af 14 00 00       	mov    $0x14af,%edx
+    14ad:	0f 34                	sysenter
+    14af:	c3                   	ret
+
+000014b0 <uptime>:
+SYSCALL(uptime)
+    14b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14b5:	89 e1                	mov    %esp,%ecx
+    14b7:	ba be 14 00 00       	mov    $0x14be,%edx
+    14bc:	0f 34                	sysenter
+    14be:	c3                   	ret
+
+000014bf <mprotect>:
+SYSCALL(mprotect)
+    14bf:	b8 16 00 00 00       	mov    $0x16,%eax
+    14c4:	89 e1                	mov    %esp,%ecx
+    14c6:	ba cd 14 00 00       	mov    $0x14cd,%edx
+    14cb:	0f 34                	sysenter
+    14cd:	c3                   	ret
+
+000014ce <munprotect>:
+SYSCALL(munprotect)
+    14ce:	b8 17 00 00 00       	mov    $0x17,%eax
+    14d3:	89 e1                	mov    %esp,%ecx
+    14d5:	ba dc 14 00 00       	mov    $0x14dc,%edx
+    14da:	0f 34                	sysenter
+    14dc:	c3                   	ret
+
+000014dd <kstat>:
+SYSCALL(kstat)
+    14dd:	b8 18 00 00 00       	mov    $0x18,%eax
+    14e2:	89 e1                	mov    %esp,%ecx
+    14e4:	ba eb 14 00 00       	mov    $0x14eb,%edx
+    14e9:	0f 34                	sysenter
+    14eb:	c3                   	ret
+
+000014ec <fcntl>:
+SYSCALL(fcntl)
+    14ec:	b8 19 00 00 00       	mov    $0x19,%eax
+    14f1:	89 e1                	mov    %esp,%ecx
+    14f3:	ba fa 14 00 00       	mov    $0x14fa,%edx
+    14f8:	0f 34                	sysenter
+    14fa:	c3                   	ret
+
+000014fb <splice>:
+SYSCALL(splice)
+    14fb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1500:	89 e1                	mov    %esp,%ecx
+    1502:	ba 09 15 00 00       	mov    $0x1509,%edx
+    1507:	0f 34                	sysenter
+    1509:	c3                   	ret
+
+0000150a <sendfile>:
+SYSCALL(sendfile)
+    150a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    150f:	89 e1                	mov    %esp,%ecx
+    1511:	ba 18 15 00 00       	mov    $0x1518,%edx
+    1516:	0f 34                	sysenter
+    1518:	c3                   	ret
+
+00001519 <lseek>:
+SYSCALL(lseek)
+    1519:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    151e:	89 e1                	mov    %esp,%ecx
+    1520:	ba 27 15 00 00       	mov    $0x1527,%edx
+    1525:	0f 34                	sysenter
+    1527:	c3                   	ret
+
+00001528 <pread>:
+SYSCALL(pread)
+    1528:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    152d:	89 e1                	mov    %esp,%ecx
+    152f:	ba 36 15 00 00       	mov    $0x1536,%edx
+    1534:	0f 34                	sysenter
+    1536:	c3                   	ret
+
+00001537 <pwrite>:
+SYSCALL(pwrite)
+    1537:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    153c:	89 e1                	mov    %esp,%ecx
+    153e:	ba 45 15 00 00       	mov    $0x1545,%edx
+    1543:	0f 34                	sysenter
+    1545:	c3                   	ret
+
+00001546 <readv>:
+SYSCALL(readv)
+    1546:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    154b:	89 e1                	mov    %esp,%ecx
+    154d:	ba 54 15 00 00       	mov    $0x1554,%edx
+    1552:	0f 34                	sysenter
+    1554:	c3                   	ret
+
+00001555 <writev>:
+SYSCALL(writev)
+    1555:	b8 20 00 00 00       	mov    $0x20,%eax
+    155a:	89 e1                	mov    %esp,%ecx
+    155c:	ba 63 15 00 00       	mov    $0x1563,%edx
+    1561:	0f 34                	sysenter
+    1563:	c3                   	ret
+
+00001564 <ringsetup>:
+SYSCALL(ringsetup)
+    1564:	b8 21 00 00 00       	mov    $0x21,%eax
+    1569:	89 e1                	mov    %esp,%ecx
+    156b:	ba 72 15 00 00       	mov    $0x1572,%edx
+    1570:	0f 34                	sysenter
+    1572:	c3                   	ret
+
+00001573 <ringenter>:
+SYSCALL(ringenter)
+    1573:	b8 22 00 00 00       	mov    $0x22,%eax
+    1578:	89 e1                	mov    %esp,%ecx
+    157a:	ba 81 15 00 00       	mov    $0x1581,%edx
+    157f:	0f 34                	sysenter
+    1581:	c3                   	ret
+
+00001582 <intgetpid>:
+INTSYSCALL(getpid)
+    1582:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1587:	cd 40                	int    $0x40
+    1589:	c3                   	ret
+    158a:	66 90                	xchg   %ax,%ax
+    158c:	66 90                	xchg   %ax,%ax
+    158e:	66 90                	xchg   %ax,%ax
+
+00001590 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1590:	55                   	push   %ebp
+    1591:	89 e5                	mov    %esp,%ebp
+    1593:	57                   	push   %edi
+    1594:	56                   	push   %esi
+    1595:	53                   	push   %ebx
+    1596:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1598:	89 d1                	mov    %edx,%ecx
+{
+    159a:	83 ec 2c             	sub    $0x2c,%esp
+    159d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    15a0:	85 d2                	test   %edx,%edx
+    15a2:	0f 89 c0 00 00 00    	jns    1668 <printint+0xd8>
+    15a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    15ac:	0f 84 b6 00 00 00    	je     1668 <printint+0xd8>
+    x = -xx;
+    15b2:	f7 d9                	neg    %ecx
+    neg = 1;
+    15b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    15b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    15bc:	31 f6                	xor    %esi,%esi
+    15be:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    15c0:	89 c8                	mov    %ecx,%eax
+    15c2:	31 d2                	xor    %edx,%edx
+    15c4:	89 f7                	mov    %esi,%edi
+    15c6:	f7 f3                	div    %ebx
+    15c8:	8d 76 01             	lea    0x1(%esi),%esi
+    15cb:	0f b6 92 dc 22 00 00 	movzbl 0x22dc(%edx),%edx
+    15d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    15d6:	89 ca                	mov    %ecx,%edx
+    15d8:	89 c1                	mov    %eax,%ecx
+    15da:	39 da                	cmp    %ebx,%edx
+    15dc:	73 e2                	jae    15c0 <printint+0x30>
+  if(neg)
+    15de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    15e1:	85 c0                	test   %eax,%eax
+    15e3:	74 07                	je     15ec <printint+0x5c>
+    buf[i++] = '-';
+    15e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    15ea:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    15ec:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    15ef:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    15f2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    15f4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    15f7:	8b 41 08             	mov    0x8(%ecx),%eax
+    15fa:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    15fd:	89 ce                	mov    %ecx,%esi
+    15ff:	eb 1c                	jmp    161d <printint+0x8d>
+    1601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1608:	89 c1                	mov    %eax,%ecx
+    160a:	83 c0 01             	add    $0x1,%eax
+    160d:	89 46 08             	mov    %eax,0x8(%esi)
+    1610:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1614:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1617:	39 df                	cmp    %ebx,%edi
+    1619:	74 41                	je     165c <printint+0xcc>
+    161b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    161d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1620:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1625:	75 e1                	jne    1608 <printint+0x78>
+  if(o->f)
+    1627:	8b 06                	mov    (%esi),%eax
+    1629:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    162c:	85 c0                	test   %eax,%eax
+    162e:	74 40                	je     1670 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1630:	50                   	push   %eax
+    1631:	68 80 00 00 00       	push   $0x80
+    1636:	6a 01                	push   $0x1
+    1638:	ff 75 d4             	push   -0x2c(%ebp)
+    163b:	e8 a0 04 00 00       	call   1ae0 <fwrite>
+    1640:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1644:	83 c4 10             	add    $0x10,%esp
+}
+    1647:	b8 01 00 00 00       	mov    $0x1,%eax
+    164c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    164e:	89 46 08             	mov    %eax,0x8(%esi)
+    1651:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1655:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1658:	39 df                	cmp    %ebx,%edi
+    165a:	75 bf                	jne    161b <printint+0x8b>
+}
+    165c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    165f:	5b                   	pop    %ebx
+    1660:	5e                   	pop    %esi
+    1661:	5f                   	pop    %edi
+    1662:	5d                   	pop    %ebp
+    1663:	c3                   	ret
+    1664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1668:	31 c0                	xor    %eax,%eax
+    166a:	e9 4a ff ff ff       	jmp    15b9 <printint+0x29>
+    166f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1670:	83 ec 04             	sub    $0x4,%esp
+    1673:	68 80 00 00 00       	push   $0x80
+    1678:	ff 75 d4             	push   -0x2c(%ebp)
+    167b:	ff 76 04             	push   0x4(%esi)
+    167e:	e8 4c fd ff ff       	call   13cf <write>
+    1683:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1687:	83 c4 10             	add    $0x10,%esp
+    168a:	eb bb                	jmp    1647 <printint+0xb7>
+    168c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001690 <putc>:
+{
+    1690:	55                   	push   %ebp
+    1691:	89 e5                	mov    %esp,%ebp
+    1693:	56                   	push   %esi
+    1694:	89 d6                	mov    %edx,%esi
+    1696:	53                   	push   %ebx
+    1697:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1699:	8b 40 08             	mov    0x8(%eax),%eax
+    169c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    16a1:	74 1d                	je     16c0 <putc+0x30>
+  o->buf[o->n++] = c;
+    16a3:	89 f1                	mov    %esi,%ecx
+    16a5:	8d 50 01             	lea    0x1(%eax),%edx
+    16a8:	89 53 08             	mov    %edx,0x8(%ebx)
+    16ab:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    16af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16b2:	5b                   	pop    %ebx
+    16b3:	5e                   	pop    %esi
+    16b4:	5d                   	pop    %ebp
+    16b5:	c3                   	ret
+    16b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16bd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    16c0:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    16c2:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    16c5:	85 c0                	test   %eax,%eax
+    16c7:	74 2f                	je     16f8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    16c9:	50                   	push   %eax
+    16ca:	68 80 00 00 00       	push   $0x80
+    16cf:	6a 01                	push   $0x1
+    16d1:	52                   	push   %edx
+    16d2:	e8 09 04 00 00       	call   1ae0 <fwrite>
+    16d7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    16da:	89 f1                	mov    %esi,%ecx
+}
+    16dc:	ba 01 00 00 00       	mov    $0x1,%edx
+    16e1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    16e3:	89 53 08             	mov    %edx,0x8(%ebx)
+    16e6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    16ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16ed:	5b                   	pop    %ebx
+    16ee:	5e                   	pop    %esi
+    16ef:	5d                   	pop    %ebp
+    16f0:	c3                   	ret
+    16f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    16f8:	83 ec 04             	sub    $0x4,%esp
+    16fb:	68 80 00 00 00       	push   $0x80
+    1700:	52                   	push   %edx
+    1701:	ff 73 04             	push   0x4(%ebx)
+    1704:	e8 c6 fc ff ff       	call   13cf <write>
+    1709:	83 c4 10             	add    $0x10,%esp
+    170c:	eb cc                	jmp    16da <putc+0x4a>
+    170e:	66 90                	xchg   %ax,%ax
+
+00001710 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1710:	55                   	push   %ebp
+    1711:	89 e5                	mov    %esp,%ebp
+    1713:	57                   	push   %edi
+    1714:	89 c7                	mov    %eax,%edi
+    1716:	56                   	push   %esi
+    1717:	31 f6                	xor    %esi,%esi
+    1719:	53                   	push   %ebx
+    171a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    171d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1720:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1723:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1726:	84 c0                	test   %al,%al
+    1728:	75 1e                	jne    1748 <vprintf.constprop.0+0x38>
+    172a:	eb 53                	jmp    177f <vprintf.constprop.0+0x6f>
+    172c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1730:	83 f8 25             	cmp    $0x25,%eax
+    1733:	74 3b                	je     1770 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1735:	89 ca                	mov    %ecx,%edx
+    1737:	89 f8                	mov    %edi,%eax
+    1739:	e8 52 ff ff ff       	call   1690 <putc>
+  for(i = 0; fmt[i]; i++){
+    173e:	0f b6 03             	movzbl (%ebx),%eax
+    1741:	83 c3 01             	add    $0x1,%ebx
+    1744:	84 c0                	test   %al,%al
+    1746:	74 37                	je     177f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1748:	0f be c8             	movsbl %al,%ecx
+    174b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    174e:	85 f6                	test   %esi,%esi
+    1750:	74 de                	je     1730 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1752:	83 fe 25             	cmp    $0x25,%esi
+    1755:	75 e7                	jne    173e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1757:	83 f8 25             	cmp    $0x25,%eax
+    175a:	74 4e                	je     17aa <vprintf.constprop.0+0x9a>
+    175c:	83 e8 63             	sub    $0x63,%eax
+    175f:	83 f8 15             	cmp    $0x15,%eax
+    1762:	77 34                	ja     1798 <vprintf.constprop.0+0x88>
+    1764:	ff 24 85 84 22 00 00 	jmp    *0x2284(,%eax,4)
+    176b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    176f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1770:	0f b6 03             	movzbl (%ebx),%eax
+    1773:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1776:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    177b:	84 c0                	test   %al,%al
+    177d:	75 c9                	jne    1748 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    177f:	8b 47 08             	mov    0x8(%edi),%eax
+    1782:	85 c0                	test   %eax,%eax
+    1784:	0f 8f de 00 00 00    	jg     1868 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    178a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    178d:	5b                   	pop    %ebx
+    178e:	5e                   	pop    %esi
+    178f:	5f                   	pop    %edi
+    1790:	5d                   	pop    %ebp
+    1791:	c3                   	ret
+    1792:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1798:	ba 25 00 00 00       	mov    $0x25,%edx
+    179d:	89 f8                	mov    %edi,%eax
+    179f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    17a2:	e8 e9 fe ff ff       	call   1690 <putc>
+        putc(o, c);
+    17a7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    17aa:	89 ca                	mov    %ecx,%edx
+    17ac:	89 f8                	mov    %edi,%eax
+      state = 0;
+    17ae:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    17b0:	e8 db fe ff ff       	call   1690 <putc>
+    17b5:	eb 87                	jmp    173e <vprintf.constprop.0+0x2e>
+    17b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17be:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    17c0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    17c3:	83 ec 0c             	sub    $0xc,%esp
+    17c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    17cb:	8b 16                	mov    (%esi),%edx
+    17cd:	6a 00                	push   $0x0
+        ap++;
+    17cf:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    17d2:	89 f8                	mov    %edi,%eax
+    17d4:	e8 b7 fd ff ff       	call   1590 <printint>
+        ap++;
+    17d9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    17dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17df:	31 f6                	xor    %esi,%esi
+    17e1:	e9 58 ff ff ff       	jmp    173e <vprintf.constprop.0+0x2e>
+    17e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    17f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    17f3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    17f5:	83 c0 04             	add    $0x4,%eax
+    17f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    17fb:	85 f6                	test   %esi,%esi
+    17fd:	75 1b                	jne    181a <vprintf.constprop.0+0x10a>
+    17ff:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1804:	be 7c 22 00 00       	mov    $0x227c,%esi
+    1809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1810:	89 f8                	mov    %edi,%eax
+          s++;
+    1812:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1815:	e8 76 fe ff ff       	call   1690 <putc>
+        while(*s != 0){
+    181a:	0f be 16             	movsbl (%esi),%edx
+    181d:	84 d2                	test   %dl,%dl
+    181f:	75 ef                	jne    1810 <vprintf.constprop.0+0x100>
+      state = 0;
+    1821:	31 f6                	xor    %esi,%esi
+    1823:	e9 16 ff ff ff       	jmp    173e <vprintf.constprop.0+0x2e>
+    1828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1830:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1833:	83 ec 0c             	sub    $0xc,%esp
+    1836:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    183b:	8b 16                	mov    (%esi),%edx
+    183d:	6a 01                	push   $0x1
+    183f:	eb 8e                	jmp    17cf <vprintf.constprop.0+0xbf>
+    1841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1848:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    184b:	89 f8                	mov    %edi,%eax
+    184d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1850:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1853:	e8 38 fe ff ff       	call   1690 <putc>
+        ap++;
+    1858:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    185b:	31 f6                	xor    %esi,%esi
+    185d:	e9 dc fe ff ff       	jmp    173e <vprintf.constprop.0+0x2e>
+    1862:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1868:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    186a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    186d:	85 d2                	test   %edx,%edx
+    186f:	74 1f                	je     1890 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1871:	52                   	push   %edx
+    1872:	50                   	push   %eax
+    1873:	6a 01                	push   $0x1
+    1875:	51                   	push   %ecx
+    1876:	e8 65 02 00 00       	call   1ae0 <fwrite>
+    187b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    187e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1885:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1888:	5b                   	pop    %ebx
+    1889:	5e                   	pop    %esi
+    188a:	5f                   	pop    %edi
+    188b:	5d                   	pop    %ebp
+    188c:	c3                   	ret
+    188d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1890:	83 ec 04             	sub    $0x4,%esp
+    1893:	50                   	push   %eax
+    1894:	51                   	push   %ecx
+    1895:	ff 77 04             	push   0x4(%edi)
+    1898:	e8 32 fb ff ff       	call   13cf <write>
+    189d:	83 c4 10             	add    $0x10,%esp
+    18a0:	eb dc                	jmp    187e <vprintf.constprop.0+0x16e>
+    18a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000018b0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18b9:	a1 84 29 00 00       	mov    0x2984,%eax
+{
+    18be:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18c1:	83 fa 01             	cmp    $0x1,%edx
+    18c4:	74 0c                	je     18d2 <printf+0x22>
+    18c6:	31 c0                	xor    %eax,%eax
+    18c8:	83 fa 02             	cmp    $0x2,%edx
+    18cb:	0f 44 05 80 29 00 00 	cmove  0x2980,%eax
+  o.fd = fd;
+    18d2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18db:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18de:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18e4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    18ea:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    18f1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18f4:	e8 17 fe ff ff       	call   1710 <vprintf.constprop.0>
+}
+    18f9:	c9                   	leave
+    18fa:	c3                   	ret
+    18fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18ff:	90                   	nop
+
+00001900 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1900:	55                   	push   %ebp
+    1901:	89 e5                	mov    %esp,%ebp
+    1903:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1909:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    190c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    190f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1912:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1919:	ff ff ff 
+  o.n = 0;
+    191c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1923:	00 00 00 
+  o.f = f;
+    1926:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    192c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1932:	e8 d9 fd ff ff       	call   1710 <vprintf.constprop.0>
+}
+    1937:	c9                   	leave
+    1938:	c3                   	ret
+    1939:	66 90                	xchg   %ax,%ax
+    193b:	66 90                	xchg   %ax,%ax
+    193d:	66 90                	xchg   %ax,%ax
+    193f:	90                   	nop
+
+00001940 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1940:	55                   	push   %ebp
+    1941:	89 e5                	mov    %esp,%ebp
+    1943:	53                   	push   %ebx
+    1944:	89 c3                	mov    %eax,%ebx
+    1946:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1949:	8b 40 0c             	mov    0xc(%eax),%eax
+    194c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    194f:	74 17                	je     1968 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1951:	83 f8 02             	cmp    $0x2,%eax
+    1954:	74 07                	je     195d <setmode+0x1d>
+    1956:	8b 43 18             	mov    0x18(%ebx),%eax
+    1959:	85 c0                	test   %eax,%eax
+    195b:	74 38                	je     1995 <setmode+0x55>
+    f->mode = IONBF;
+}
+    195d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1960:	c9                   	leave
+    1961:	c3                   	ret
+    1962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1968:	83 ec 08             	sub    $0x8,%esp
+    196b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    196e:	50                   	push   %eax
+    196f:	ff 33                	push   (%ebx)
+    1971:	e8 c2 fa ff ff       	call   1438 <fstat>
+    1976:	83 c4 10             	add    $0x10,%esp
+    1979:	89 c2                	mov    %eax,%edx
+    197b:	31 c0                	xor    %eax,%eax
+    197d:	85 d2                	test   %edx,%edx
+    197f:	75 0a                	jne    198b <setmode+0x4b>
+    1981:	31 c0                	xor    %eax,%eax
+    1983:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1988:	0f 94 c0             	sete   %al
+    198b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    198e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1991:	85 c0                	test   %eax,%eax
+    1993:	75 c8                	jne    195d <setmode+0x1d>
+    1995:	83 ec 0c             	sub    $0xc,%esp
+    1998:	68 00 04 00 00       	push   $0x400
+    199d:	e8 de 07 00 00       	call   2180 <malloc>
+    19a2:	83 c4 10             	add    $0x10,%esp
+    19a5:	89 43 18             	mov    %eax,0x18(%ebx)
+    19a8:	85 c0                	test   %eax,%eax
+    19aa:	75 b1                	jne    195d <setmode+0x1d>
+    f->mode = IONBF;
+    19ac:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    19b3:	eb a8                	jmp    195d <setmode+0x1d>
+    19b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000019c0 <drain>:
+{
+    19c0:	55                   	push   %ebp
+    19c1:	89 e5                	mov    %esp,%ebp
+    19c3:	57                   	push   %edi
+    19c4:	56                   	push   %esi
+    19c5:	53                   	push   %ebx
+    19c6:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    19c9:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    19cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    19cf:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19d6:	85 ff                	test   %edi,%edi
+    19d8:	7f 0e                	jg     19e8 <drain+0x28>
+  return 0;
+    19da:	31 c0                	xor    %eax,%eax
+}
+    19dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19df:	5b                   	pop    %ebx
+    19e0:	5e                   	pop    %esi
+    19e1:	5f                   	pop    %edi
+    19e2:	5d                   	pop    %ebp
+    19e3:	c3                   	ret
+    19e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19eb:	8b 58 18             	mov    0x18(%eax),%ebx
+    19ee:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    19f0:	eb 0e                	jmp    1a00 <drain+0x40>
+    19f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    19f8:	29 c7                	sub    %eax,%edi
+    19fa:	01 c3                	add    %eax,%ebx
+    19fc:	85 ff                	test   %edi,%edi
+    19fe:	7e da                	jle    19da <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1a00:	83 ec 04             	sub    $0x4,%esp
+    1a03:	57                   	push   %edi
+    1a04:	53                   	push   %ebx
+    1a05:	56                   	push   %esi
+    1a06:	e8 c4 f9 ff ff       	call   13cf <write>
+    1a0b:	83 c4 10             	add    $0x10,%esp
+    1a0e:	85 c0                	test   %eax,%eax
+    1a10:	7f e6                	jg     19f8 <drain+0x38>
+    f->err = 1;
+    1a12:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a15:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1a1c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a21:	eb b9                	jmp    19dc <drain+0x1c>
+    1a23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001a30 <flushall>:
+
+static void
+flushall(void)
+{
+    1a30:	55                   	push   %ebp
+    1a31:	89 e5                	mov    %esp,%ebp
+    1a33:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a34:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+{
+    1a39:	83 ec 04             	sub    $0x4,%esp
+    1a3c:	eb 0d                	jmp    1a4b <flushall+0x1b>
+    1a3e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a40:	83 c3 24             	add    $0x24,%ebx
+    1a43:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1a49:	74 19                	je     1a64 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1a4b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1a4e:	85 c0                	test   %eax,%eax
+    1a50:	74 ee                	je     1a40 <flushall+0x10>
+    1a52:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a54:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1a57:	e8 64 ff ff ff       	call   19c0 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a5c:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1a62:	75 e7                	jne    1a4b <flushall+0x1b>
+}
+    1a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a67:	c9                   	leave
+    1a68:	c3                   	ret
+    1a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a70 <fflush>:
+{
+    1a70:	55                   	push   %ebp
+    1a71:	89 e5                	mov    %esp,%ebp
+    1a73:	57                   	push   %edi
+    1a74:	56                   	push   %esi
+    1a75:	53                   	push   %ebx
+    1a76:	83 ec 0c             	sub    $0xc,%esp
+    1a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1a7c:	85 c0                	test   %eax,%eax
+    1a7e:	74 28                	je     1aa8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1a80:	8b 70 08             	mov    0x8(%eax),%esi
+    1a83:	85 f6                	test   %esi,%esi
+    1a85:	75 11                	jne    1a98 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1a87:	83 c4 0c             	add    $0xc,%esp
+    1a8a:	89 f0                	mov    %esi,%eax
+    1a8c:	5b                   	pop    %ebx
+    1a8d:	5e                   	pop    %esi
+    1a8e:	5f                   	pop    %edi
+    1a8f:	5d                   	pop    %ebp
+    1a90:	c3                   	ret
+    1a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a98:	83 c4 0c             	add    $0xc,%esp
+    1a9b:	5b                   	pop    %ebx
+    1a9c:	5e                   	pop    %esi
+    1a9d:	5f                   	pop    %edi
+    1a9e:	5d                   	pop    %ebp
+  return drain(f);
+    1a9f:	e9 1c ff ff ff       	jmp    19c0 <drain>
+    1aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1aa8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1aaa:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+        r = -1;
+    1aaf:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1ab4:	eb 15                	jmp    1acb <fflush+0x5b>
+    1ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1abd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ac0:	83 c3 24             	add    $0x24,%ebx
+    1ac3:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1ac9:	74 bc                	je     1a87 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1acb:	8b 43 08             	mov    0x8(%ebx),%eax
+    1ace:	85 c0                	test   %eax,%eax
+    1ad0:	74 ee                	je     1ac0 <fflush+0x50>
+    1ad2:	89 d8                	mov    %ebx,%eax
+    1ad4:	e8 e7 fe ff ff       	call   19c0 <drain>
+        r = -1;
+    1ad9:	85 c0                	test   %eax,%eax
+    1adb:	0f 48 f7             	cmovs  %edi,%esi
+    1ade:	eb e0                	jmp    1ac0 <fflush+0x50>
+
+00001ae0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1ae0:	55                   	push   %ebp
+    1ae1:	89 e5                	mov    %esp,%ebp
+    1ae3:	57                   	push   %edi
+    1ae4:	56                   	push   %esi
+    1ae5:	53                   	push   %ebx
+    1ae6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1ae9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1aec:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1af0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1af3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1af6:	85 d2                	test   %edx,%edx
+    1af8:	0f 8e 26 01 00 00    	jle    1c24 <fwrite+0x144>
+  if(!f->writable){
+    1afe:	8b 46 08             	mov    0x8(%esi),%eax
+    1b01:	85 c0                	test   %eax,%eax
+    1b03:	0f 84 14 01 00 00    	je     1c1d <fwrite+0x13d>
+  setmode(f);
+    1b09:	89 f0                	mov    %esi,%eax
+    1b0b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1b0e:	e8 2d fe ff ff       	call   1940 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b13:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1b17:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1b1a:	c7 05 e0 2b 00 00 30 	movl   $0x1a30,0x2be0
+    1b21:	1a 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b24:	0f 84 b6 00 00 00    	je     1be0 <fwrite+0x100>
+    1b2a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1b30:	0f 8f aa 00 00 00    	jg     1be0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b36:	8b 46 20             	mov    0x20(%esi),%eax
+    1b39:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1b3c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b3e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b43:	74 6c                	je     1bb1 <fwrite+0xd1>
+    1b45:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1b48:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1b4b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1b50:	29 c2                	sub    %eax,%edx
+    1b52:	39 ca                	cmp    %ecx,%edx
+    1b54:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1b57:	85 d2                	test   %edx,%edx
+    1b59:	0f 8e d1 00 00 00    	jle    1c30 <fwrite+0x150>
+    1b5f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1b62:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1b65:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b6f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1b70:	8d 50 01             	lea    0x1(%eax),%edx
+    1b73:	83 c3 01             	add    $0x1,%ebx
+    1b76:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1b79:	89 56 20             	mov    %edx,0x20(%esi)
+    1b7c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1b80:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1b83:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1b86:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b8b:	80 fa 0a             	cmp    $0xa,%dl
+    1b8e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1b91:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1b94:	39 cb                	cmp    %ecx,%ebx
+    1b96:	75 d8                	jne    1b70 <fwrite+0x90>
+    1b98:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1b9b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1b9e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1ba1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1ba4:	85 db                	test   %ebx,%ebx
+    1ba6:	7e 19                	jle    1bc1 <fwrite+0xe1>
+    n -= k;
+    1ba8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1baa:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1baf:	75 97                	jne    1b48 <fwrite+0x68>
+    1bb1:	89 f0                	mov    %esi,%eax
+    1bb3:	e8 08 fe ff ff       	call   19c0 <drain>
+    1bb8:	85 c0                	test   %eax,%eax
+    1bba:	78 68                	js     1c24 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1bbc:	8b 46 20             	mov    0x20(%esi),%eax
+    1bbf:	eb 87                	jmp    1b48 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1bc1:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1bc6:	74 74                	je     1c3c <fwrite+0x15c>
+    1bc8:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1bcc:	75 04                	jne    1bd2 <fwrite+0xf2>
+    1bce:	85 ff                	test   %edi,%edi
+    1bd0:	75 6a                	jne    1c3c <fwrite+0x15c>
+    return nmemb;
+    1bd2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1bd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bd8:	5b                   	pop    %ebx
+    1bd9:	5e                   	pop    %esi
+    1bda:	5f                   	pop    %edi
+    1bdb:	5d                   	pop    %ebp
+    1bdc:	c3                   	ret
+    1bdd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1be0:	89 f0                	mov    %esi,%eax
+    1be2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1be5:	e8 d6 fd ff ff       	call   19c0 <drain>
+    1bea:	85 c0                	test   %eax,%eax
+    1bec:	78 2f                	js     1c1d <fwrite+0x13d>
+    1bee:	89 75 14             	mov    %esi,0x14(%ebp)
+    1bf1:	8b 3e                	mov    (%esi),%edi
+    1bf3:	89 de                	mov    %ebx,%esi
+    1bf5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1bf8:	eb 0e                	jmp    1c08 <fwrite+0x128>
+    1bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1c00:	29 c3                	sub    %eax,%ebx
+    1c02:	01 c6                	add    %eax,%esi
+    1c04:	85 db                	test   %ebx,%ebx
+    1c06:	7e ca                	jle    1bd2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1c08:	83 ec 04             	sub    $0x4,%esp
+    1c0b:	53                   	push   %ebx
+    1c0c:	56                   	push   %esi
+    1c0d:	57                   	push   %edi
+    1c0e:	e8 bc f7 ff ff       	call   13cf <write>
+    1c13:	83 c4 10             	add    $0x10,%esp
+    1c16:	85 c0                	test   %eax,%eax
+    1c18:	7f e6                	jg     1c00 <fwrite+0x120>
+    1c1a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1c1d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1c24:	31 c0                	xor    %eax,%eax
+}
+    1c26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c29:	5b                   	pop    %ebx
+    1c2a:	5e                   	pop    %esi
+    1c2b:	5f                   	pop    %edi
+    1c2c:	5d                   	pop    %ebp
+    1c2d:	c3                   	ret
+    1c2e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1c30:	89 d9                	mov    %ebx,%ecx
+    1c32:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1c35:	89 cb                	mov    %ecx,%ebx
+    1c37:	e9 6e ff ff ff       	jmp    1baa <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c3c:	89 f0                	mov    %esi,%eax
+    1c3e:	e8 7d fd ff ff       	call   19c0 <drain>
+    1c43:	85 c0                	test   %eax,%eax
+    1c45:	79 8b                	jns    1bd2 <fwrite+0xf2>
+    return 0;
+    1c47:	31 c0                	xor    %eax,%eax
+    1c49:	eb db                	jmp    1c26 <fwrite+0x146>
+    1c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c4f:	90                   	nop
+
+00001c50 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1c50:	55                   	push   %ebp
+    1c51:	89 e5                	mov    %esp,%ebp
+    1c53:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1c56:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c59:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c5c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1c5f:	ff 75 0c             	push   0xc(%ebp)
+    1c62:	6a 01                	push   $0x1
+    1c64:	6a 01                	push   $0x1
+    1c66:	50                   	push   %eax
+    1c67:	e8 74 fe ff ff       	call   1ae0 <fwrite>
+    1c6c:	83 c4 10             	add    $0x10,%esp
+    1c6f:	83 f8 01             	cmp    $0x1,%eax
+    1c72:	75 0c                	jne    1c80 <fputc+0x30>
+    1c74:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1c78:	c9                   	leave
+    1c79:	c3                   	ret
+    1c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1c80:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c81:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1c86:	c3                   	ret
+    1c87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8e:	66 90                	xchg   %ax,%ax
+
+00001c90 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	57                   	push   %edi
+    1c94:	56                   	push   %esi
+    1c95:	53                   	push   %ebx
+    1c96:	83 ec 1c             	sub    $0x1c,%esp
+    1c99:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1c9c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1c9f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1ca2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1ca5:	85 d2                	test   %edx,%edx
+    1ca7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1caa:	7e 12                	jle    1cbe <fread+0x2e>
+    1cac:	85 ff                	test   %edi,%edi
+    1cae:	7e 0e                	jle    1cbe <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1cb0:	8b 43 04             	mov    0x4(%ebx),%eax
+    1cb3:	85 c0                	test   %eax,%eax
+    1cb5:	75 19                	jne    1cd0 <fread+0x40>
+    f->err = 1;
+    1cb7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1cbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1cc1:	31 c0                	xor    %eax,%eax
+}
+    1cc3:	5b                   	pop    %ebx
+    1cc4:	5e                   	pop    %esi
+    1cc5:	5f                   	pop    %edi
+    1cc6:	5d                   	pop    %ebp
+    1cc7:	c3                   	ret
+    1cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ccf:	90                   	nop
+  setmode(f);
+    1cd0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1cd2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1cd4:	e8 67 fc ff ff       	call   1940 <setmode>
+  for(n = 0; n < want; n += k){
+    1cd9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1cdc:	89 f7                	mov    %esi,%edi
+    1cde:	eb 31                	jmp    1d11 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1ce0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1ce4:	74 08                	je     1cee <fread+0x5e>
+    1ce6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1cec:	7e 62                	jle    1d50 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1cee:	83 ec 04             	sub    $0x4,%esp
+    1cf1:	56                   	push   %esi
+    1cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+    1cf5:	01 f8                	add    %edi,%eax
+    1cf7:	50                   	push   %eax
+    1cf8:	ff 33                	push   (%ebx)
+    1cfa:	e8 c1 f6 ff ff       	call   13c0 <read>
+    1cff:	83 c4 10             	add    $0x10,%esp
+    1d02:	85 c0                	test   %eax,%eax
+    1d04:	0f 8e ce 00 00 00    	jle    1dd8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1d0a:	01 c7                	add    %eax,%edi
+    1d0c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d0f:	7e 36                	jle    1d47 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d11:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1d14:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1d17:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d1a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1d1c:	39 c1                	cmp    %eax,%ecx
+    1d1e:	7d c0                	jge    1ce0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d20:	29 c8                	sub    %ecx,%eax
+    1d22:	39 f0                	cmp    %esi,%eax
+    1d24:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1d27:	83 ec 04             	sub    $0x4,%esp
+    1d2a:	56                   	push   %esi
+    1d2b:	03 4b 18             	add    0x18(%ebx),%ecx
+    1d2e:	51                   	push   %ecx
+    1d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d32:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1d34:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1d36:	50                   	push   %eax
+    1d37:	e8 34 f5 ff ff       	call   1270 <memmove>
+      f->r += k;
+    1d3c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1d3f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1d42:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d45:	7f ca                	jg     1d11 <fread+0x81>
+    1d47:	89 fe                	mov    %edi,%esi
+    1d49:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d4c:	eb 3f                	jmp    1d8d <fread+0xfd>
+    1d4e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1d50:	3b 1d 88 29 00 00    	cmp    0x2988,%ebx
+    1d56:	74 68                	je     1dc0 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d58:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1d5b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1d62:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d69:	68 00 04 00 00       	push   $0x400
+    1d6e:	ff 73 18             	push   0x18(%ebx)
+    1d71:	ff 33                	push   (%ebx)
+    1d73:	e8 48 f6 ff ff       	call   13c0 <read>
+    1d78:	83 c4 10             	add    $0x10,%esp
+    1d7b:	85 c0                	test   %eax,%eax
+    1d7d:	78 21                	js     1da0 <fread+0x110>
+  else if(n == 0)
+    1d7f:	75 2f                	jne    1db0 <fread+0x120>
+    f->eof = 1;
+    1d81:	89 fe                	mov    %edi,%esi
+    1d83:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d86:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1d8d:	89 f0                	mov    %esi,%eax
+}
+    1d8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1d92:	99                   	cltd
+}
+    1d93:	5b                   	pop    %ebx
+    1d94:	5e                   	pop    %esi
+  return n / size;
+    1d95:	f7 ff                	idiv   %edi
+}
+    1d97:	5f                   	pop    %edi
+    1d98:	5d                   	pop    %ebp
+    1d99:	c3                   	ret
+    1d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1da0:	89 fe                	mov    %edi,%esi
+    1da2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1da5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1dac:	eb df                	jmp    1d8d <fread+0xfd>
+    1dae:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1db0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1db3:	e9 54 ff ff ff       	jmp    1d0c <fread+0x7c>
+    1db8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dbf:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1dc0:	83 ec 0c             	sub    $0xc,%esp
+    1dc3:	ff 35 84 29 00 00    	push   0x2984
+    1dc9:	e8 a2 fc ff ff       	call   1a70 <fflush>
+    1dce:	83 c4 10             	add    $0x10,%esp
+    1dd1:	eb 85                	jmp    1d58 <fread+0xc8>
+    1dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1dd7:	90                   	nop
+        if(k < 0)
+    1dd8:	89 fe                	mov    %edi,%esi
+    1dda:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1ddd:	74 a7                	je     1d86 <fread+0xf6>
+    1ddf:	eb c4                	jmp    1da5 <fread+0x115>
+    1de1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1def:	90                   	nop
+
+00001df0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1df0:	55                   	push   %ebp
+    1df1:	89 e5                	mov    %esp,%ebp
+    1df3:	53                   	push   %ebx
+    1df4:	83 ec 14             	sub    $0x14,%esp
+    1df7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1dfa:	8b 50 04             	mov    0x4(%eax),%edx
+    1dfd:	85 d2                	test   %edx,%edx
+    1dff:	74 08                	je     1e09 <fgetc+0x19>
+    1e01:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1e04:	3b 50 20             	cmp    0x20(%eax),%edx
+    1e07:	7c 27                	jl     1e30 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e09:	50                   	push   %eax
+    1e0a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1e0d:	6a 01                	push   $0x1
+    1e0f:	6a 01                	push   $0x1
+    1e11:	50                   	push   %eax
+    1e12:	e8 79 fe ff ff       	call   1c90 <fread>
+    1e17:	83 c4 10             	add    $0x10,%esp
+    1e1a:	83 f8 01             	cmp    $0x1,%eax
+    1e1d:	75 29                	jne    1e48 <fgetc+0x58>
+    1e1f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1e23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e26:	c9                   	leave
+    1e27:	c3                   	ret
+    1e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e2f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1e30:	8b 48 18             	mov    0x18(%eax),%ecx
+    1e33:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1e36:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1e39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1e3c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1e40:	c9                   	leave
+    1e41:	c3                   	ret
+    1e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e48:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e4d:	eb d4                	jmp    1e23 <fgetc+0x33>
+    1e4f:	90                   	nop
+
+00001e50 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1e50:	55                   	push   %ebp
+    1e51:	89 e5                	mov    %esp,%ebp
+    1e53:	57                   	push   %edi
+    1e54:	56                   	push   %esi
+    1e55:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1e56:	31 db                	xor    %ebx,%ebx
+{
+    1e58:	83 ec 1c             	sub    $0x1c,%esp
+    1e5b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1e5e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1e60:	eb 2e                	jmp    1e90 <fgets+0x40>
+    1e62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e68:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1e6b:	57                   	push   %edi
+    1e6c:	6a 01                	push   $0x1
+    1e6e:	6a 01                	push   $0x1
+    1e70:	50                   	push   %eax
+    1e71:	e8 1a fe ff ff       	call   1c90 <fread>
+    1e76:	83 c4 10             	add    $0x10,%esp
+    1e79:	83 f8 01             	cmp    $0x1,%eax
+    1e7c:	75 62                	jne    1ee0 <fgets+0x90>
+    1e7e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1e82:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e85:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1e87:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1e8b:	83 f9 0a             	cmp    $0xa,%ecx
+    1e8e:	74 34                	je     1ec4 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1e90:	89 de                	mov    %ebx,%esi
+    1e92:	83 c3 01             	add    $0x1,%ebx
+    1e95:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1e98:	7d 46                	jge    1ee0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1e9a:	8b 47 04             	mov    0x4(%edi),%eax
+    1e9d:	85 c0                	test   %eax,%eax
+    1e9f:	74 c7                	je     1e68 <fgets+0x18>
+    1ea1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1ea4:	3b 47 20             	cmp    0x20(%edi),%eax
+    1ea7:	7d bf                	jge    1e68 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1ea9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1eac:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1eb2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1eb5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1eb9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1ebb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1ebf:	83 f9 0a             	cmp    $0xa,%ecx
+    1ec2:	75 cc                	jne    1e90 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1ec4:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ec7:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1ecb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ed1:	5b                   	pop    %ebx
+    1ed2:	5e                   	pop    %esi
+    1ed3:	5f                   	pop    %edi
+    1ed4:	5d                   	pop    %ebp
+    1ed5:	c3                   	ret
+    1ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1edd:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    1ee0:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ee3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    1ee7:	31 c0                	xor    %eax,%eax
+    1ee9:	85 f6                	test   %esi,%esi
+    1eeb:	74 e1                	je     1ece <fgets+0x7e>
+    1eed:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ef0:	eb dc                	jmp    1ece <fgets+0x7e>
+    1ef2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ef9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001f00 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    1f00:	55                   	push   %ebp
+    1f01:	89 e5                	mov    %esp,%ebp
+    1f03:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f04:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+{
+    1f09:	83 ec 04             	sub    $0x4,%esp
+    1f0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    1f10:	8b 53 04             	mov    0x4(%ebx),%edx
+    1f13:	85 d2                	test   %edx,%edx
+    1f15:	75 07                	jne    1f1e <fdopen+0x1e>
+    1f17:	8b 43 08             	mov    0x8(%ebx),%eax
+    1f1a:	85 c0                	test   %eax,%eax
+    1f1c:	74 1a                	je     1f38 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f1e:	83 c3 24             	add    $0x24,%ebx
+    1f21:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1f27:	75 e7                	jne    1f10 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    1f29:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    1f2b:	89 d8                	mov    %ebx,%eax
+    1f2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f30:	c9                   	leave
+    1f31:	c3                   	ret
+    1f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    1f38:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1f3e:	74 e9                	je     1f29 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    1f40:	83 ec 04             	sub    $0x4,%esp
+    1f43:	6a 24                	push   $0x24
+    1f45:	6a 00                	push   $0x0
+    1f47:	53                   	push   %ebx
+    1f48:	e8 d3 f1 ff ff       	call   1120 <memset>
+  f->fd = fd;
+    1f4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    1f50:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    1f57:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    1f5a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    1f5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1f5f:	80 38 72             	cmpb   $0x72,(%eax)
+    1f62:	74 14                	je     1f78 <fdopen+0x78>
+    f->writable = 1;
+    1f64:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    1f6b:	89 d8                	mov    %ebx,%eax
+    1f6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f70:	c9                   	leave
+    1f71:	c3                   	ret
+    1f72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    1f78:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    1f7f:	89 d8                	mov    %ebx,%eax
+    1f81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f84:	c9                   	leave
+    1f85:	c3                   	ret
+    1f86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001f90 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	56                   	push   %esi
+    1f94:	53                   	push   %ebx
+    1f95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    1f98:	0f b6 06             	movzbl (%esi),%eax
+    1f9b:	3c 72                	cmp    $0x72,%al
+    1f9d:	74 61                	je     2000 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    1f9f:	3c 77                	cmp    $0x77,%al
+    1fa1:	74 7d                	je     2020 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    1fa3:	3c 61                	cmp    $0x61,%al
+    1fa5:	75 49                	jne    1ff0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    1fa7:	83 ec 08             	sub    $0x8,%esp
+    1faa:	68 01 02 00 00       	push   $0x201
+    1faf:	ff 75 08             	push   0x8(%ebp)
+    1fb2:	e8 54 f4 ff ff       	call   140b <open>
+    1fb7:	83 c4 10             	add    $0x10,%esp
+    1fba:	89 c3                	mov    %eax,%ebx
+    1fbc:	85 c0                	test   %eax,%eax
+    1fbe:	78 30                	js     1ff0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    1fc0:	83 ec 04             	sub    $0x4,%esp
+    1fc3:	6a 02                	push   $0x2
+    1fc5:	6a 00                	push   $0x0
+    1fc7:	50                   	push   %eax
+    1fc8:	e8 4c f5 ff ff       	call   1519 <lseek>
+    1fcd:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    1fd0:	83 ec 08             	sub    $0x8,%esp
+    1fd3:	56                   	push   %esi
+    1fd4:	53                   	push   %ebx
+    1fd5:	e8 26 ff ff ff       	call   1f00 <fdopen>
+    1fda:	83 c4 10             	add    $0x10,%esp
+    1fdd:	85 c0                	test   %eax,%eax
+    1fdf:	75 11                	jne    1ff2 <fopen+0x62>
+    close(fd);
+    1fe1:	83 ec 0c             	sub    $0xc,%esp
+    1fe4:	53                   	push   %ebx
+    1fe5:	e8 f4 f3 ff ff       	call   13de <close>
+    1fea:	83 c4 10             	add    $0x10,%esp
+    1fed:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    1ff0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    1ff2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1ff5:	5b                   	pop    %ebx
+    1ff6:	5e                   	pop    %esi
+    1ff7:	5d                   	pop    %ebp
+    1ff8:	c3                   	ret
+    1ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2000:	83 ec 08             	sub    $0x8,%esp
+    2003:	6a 00                	push   $0x0
+    2005:	ff 75 08             	push   0x8(%ebp)
+    2008:	e8 fe f3 ff ff       	call   140b <open>
+    200d:	83 c4 10             	add    $0x10,%esp
+    2010:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2012:	85 db                	test   %ebx,%ebx
+    2014:	78 da                	js     1ff0 <fopen+0x60>
+    2016:	eb b8                	jmp    1fd0 <fopen+0x40>
+    2018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    201f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2020:	83 ec 08             	sub    $0x8,%esp
+    2023:	68 01 06 00 00       	push   $0x601
+    2028:	ff 75 08             	push   0x8(%ebp)
+    202b:	e8 db f3 ff ff       	call   140b <open>
+    2030:	83 c4 10             	add    $0x10,%esp
+    2033:	89 c3                	mov    %eax,%ebx
+    2035:	eb db                	jmp    2012 <fopen+0x82>
+    2037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    203e:	66 90                	xchg   %ax,%ax
+
+00002040 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2040:	55                   	push   %ebp
+    2041:	89 e5                	mov    %esp,%ebp
+    2043:	56                   	push   %esi
+    2044:	53                   	push   %ebx
+    2045:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2048:	83 ec 0c             	sub    $0xc,%esp
+    204b:	53                   	push   %ebx
+    204c:	e8 1f fa ff ff       	call   1a70 <fflush>
+    2051:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2053:	58                   	pop    %eax
+    2054:	ff 33                	push   (%ebx)
+    2056:	e8 83 f3 ff ff       	call   13de <close>
+    205b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    205e:	85 c0                	test   %eax,%eax
+    2060:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2065:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2068:	8b 43 18             	mov    0x18(%ebx),%eax
+    206b:	85 c0                	test   %eax,%eax
+    206d:	0f 95 c1             	setne  %cl
+    2070:	3d 00 30 00 00       	cmp    $0x3000,%eax
+    2075:	0f 95 c2             	setne  %dl
+    2078:	84 d1                	test   %dl,%cl
+    207a:	74 07                	je     2083 <fclose+0x43>
+    207c:	3d 00 2c 00 00       	cmp    $0x2c00,%eax
+    2081:	75 25                	jne    20a8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2083:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    208a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    208c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2093:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    209a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    209d:	5b                   	pop    %ebx
+    209e:	5e                   	pop    %esi
+    209f:	5d                   	pop    %ebp
+    20a0:	c3                   	ret
+    20a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    20a8:	83 ec 0c             	sub    $0xc,%esp
+    20ab:	50                   	push   %eax
+    20ac:	e8 3f 00 00 00       	call   20f0 <free>
+    20b1:	83 c4 10             	add    $0x10,%esp
+    20b4:	eb cd                	jmp    2083 <fclose+0x43>
+    20b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020c0 <feof>:
+
+int
+feof(FILE *f)
+{
+    20c0:	55                   	push   %ebp
+    20c1:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    20c3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20c6:	5d                   	pop    %ebp
+  return f->eof;
+    20c7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    20ca:	c3                   	ret
+    20cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20cf:	90                   	nop
+
+000020d0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    20d0:	55                   	push   %ebp
+    20d1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    20d3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20d6:	5d                   	pop    %ebp
+  return f->err;
+    20d7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    20da:	c3                   	ret
+    20db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20df:	90                   	nop
+
+000020e0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    20e0:	55                   	push   %ebp
+    20e1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    20e3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20e6:	5d                   	pop    %ebp
+  return f->fd;
+    20e7:	8b 00                	mov    (%eax),%eax
+}
+    20e9:	c3                   	ret
+    20ea:	66 90                	xchg   %ax,%ax
+    20ec:	66 90                	xchg   %ax,%ax
+    20ee:	66 90                	xchg   %ax,%ax
+
+000020f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    20f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    20f1:	a1 00 34 00 00       	mov    0x3400,%eax
+{
+    20f6:	89 e5                	mov    %esp,%ebp
+    20f8:	57                   	push   %edi
+    20f9:	56                   	push   %esi
+    20fa:	53                   	push   %ebx
+    20fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    20fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2108:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    210a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    210c:	39 ca                	cmp    %ecx,%edx
+    210e:	73 30                	jae    2140 <free+0x50>
+    2110:	39 c1                	cmp    %eax,%ecx
+    2112:	72 04                	jb     2118 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2114:	39 c2                	cmp    %eax,%edx
+    2116:	72 f0                	jb     2108 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2118:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    211b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    211e:	39 f8                	cmp    %edi,%eax
+    2120:	74 2e                	je     2150 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2122:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2125:	8b 42 04             	mov    0x4(%edx),%eax
+    2128:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    212b:	39 f1                	cmp    %esi,%ecx
+    212d:	74 38                	je     2167 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    212f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2131:	5b                   	pop    %ebx
+  freep = p;
+    2132:	89 15 00 34 00 00    	mov    %edx,0x3400
+}
+    2138:	5e                   	pop    %esi
+    2139:	5f                   	pop    %edi
+    213a:	5d                   	pop    %ebp
+    213b:	c3                   	ret
+    213c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2140:	39 c1                	cmp    %eax,%ecx
+    2142:	72 d0                	jb     2114 <free+0x24>
+    2144:	eb c2                	jmp    2108 <free+0x18>
+    2146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    214d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2150:	03 70 04             	add    0x4(%eax),%esi
+    2153:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2156:	8b 02                	mov    (%edx),%eax
+    2158:	8b 00                	mov    (%eax),%eax
+    215a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    215d:	8b 42 04             	mov    0x4(%edx),%eax
+    2160:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2163:	39 f1                	cmp    %esi,%ecx
+    2165:	75 c8                	jne    212f <free+0x3f>
+    p->s.size += bp->s.size;
+    2167:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    216a:	89 15 00 34 00 00    	mov    %edx,0x3400
+    p->s.size += bp->s.size;
+    2170:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2173:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2176:	89 0a                	mov    %ecx,(%edx)
+}
+    2178:	5b                   	pop    %ebx
+    2179:	5e                   	pop    %esi
+    217a:	5f                   	pop    %edi
+    217b:	5d                   	pop    %ebp
+    217c:	c3                   	ret
+    217d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002180 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2180:	55                   	push   %ebp
+    2181:	89 e5                	mov    %esp,%ebp
+    2183:	57                   	push   %edi
+    2184:	56                   	push   %esi
+    2185:	53                   	push   %ebx
+    2186:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2189:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    218c:	8b 15 00 34 00 00    	mov    0x3400,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2192:	8d 78 07             	lea    0x7(%eax),%edi
+    2195:	c1 ef 03             	shr    $0x3,%edi
+    2198:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    219b:	85 d2                	test   %edx,%edx
+    219d:	0f 84 8d 00 00 00    	je     2230 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    21a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    21a5:	8b 48 04             	mov    0x4(%eax),%ecx
+    21a8:	39 f9                	cmp    %edi,%ecx
+    21aa:	73 64                	jae    2210 <malloc+0x90>
+  if(nu < 4096)
+    21ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    21b1:	39 df                	cmp    %ebx,%edi
+    21b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    21b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    21bd:	eb 0a                	jmp    21c9 <malloc+0x49>
+    21bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    21c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    21c2:	8b 48 04             	mov    0x4(%eax),%ecx
+    21c5:	39 f9                	cmp    %edi,%ecx
+    21c7:	73 47                	jae    2210 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    21c9:	89 c2                	mov    %eax,%edx
+    21cb:	39 05 00 34 00 00    	cmp    %eax,0x3400
+    21d1:	75 ed                	jne    21c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    21d3:	83 ec 0c             	sub    $0xc,%esp
+    21d6:	56                   	push   %esi
+    21d7:	e8 b6 f2 ff ff       	call   1492 <sbrk>
+  if(p == (char*)-1)
+    21dc:	83 c4 10             	add    $0x10,%esp
+    21df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    21e2:	74 1c                	je     2200 <malloc+0x80>
+  hp->s.size = nu;
+    21e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    21e7:	83 ec 0c             	sub    $0xc,%esp
+    21ea:	83 c0 08             	add    $0x8,%eax
+    21ed:	50                   	push   %eax
+    21ee:	e8 fd fe ff ff       	call   20f0 <free>
+  return freep;
+    21f3:	8b 15 00 34 00 00    	mov    0x3400,%edx
+      if((p = morecore(nunits)) == 0)
+    21f9:	83 c4 10             	add    $0x10,%esp
+    21fc:	85 d2                	test   %edx,%edx
+    21fe:	75 c0                	jne    21c0 <malloc+0x40>
+        return 0;
+  }
+}
+    2200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2203:	31 c0                	xor    %eax,%eax
+}
+    2205:	5b                   	pop    %ebx
+    2206:	5e                   	pop    %esi
+    2207:	5f                   	pop    %edi
+    2208:	5d                   	pop    %ebp
+    2209:	c3                   	ret
+    220a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2210:	39 cf                	cmp    %ecx,%edi
+    2212:	74 4c                	je     2260 <malloc+0xe0>
+        p->s.size -= nunits;
+    2214:	29 f9                	sub    %edi,%ecx
+    2216:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2219:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    221c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    221f:	89 15 00 34 00 00    	mov    %edx,0x3400
+}
+    2225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2228:	83 c0 08             	add    $0x8,%eax
+}
+    222b:	5b                   	pop    %ebx
+    222c:	5e                   	pop    %esi
+    222d:	5f                   	pop    %edi
+    222e:	5d                   	pop    %ebp
+    222f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2230:	c7 05 00 34 00 00 04 	movl   $0x3404,0x3400
+    2237:	34 00 00 
+    base.s.size = 0;
+    223a:	b8 04 34 00 00       	mov    $0x3404,%eax
+    base.s.ptr = freep = prevp = &base;
+    223f:	c7 05 04 34 00 00 04 	movl   $0x3404,0x3404
+    2246:	34 00 00 
+    base.s.size = 0;
+    2249:	c7 05 08 34 00 00 00 	movl   $0x0,0x3408
+    2250:	00 00 00 
+    if(p->s.size >= nunits){
+    2253:	e9 54 ff ff ff       	jmp    21ac <malloc+0x2c>
+    2258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    225f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2260:	8b 08                	mov    (%eax),%ecx
+    2262:	89 0a                	mov    %ecx,(%edx)
+    2264:	eb b9                	jmp    221f <malloc+0x9f>
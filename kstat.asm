@@ -0,0 +1,2974 @@
+
+_kstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+  struct kstat before, after;
+  struct field *f;
+  uint v, n;
+
+  memset(&before, 0, sizeof(before));
+    100f:	8d b5 e0 fe ff ff    	lea    -0x120(%ebp),%esi
+{
+    1015:	53                   	push   %ebx
+    1016:	51                   	push   %ecx
+    1017:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+    101d:	8b 19                	mov    (%ecx),%ebx
+    101f:	8b 79 04             	mov    0x4(%ecx),%edi
+  memset(&before, 0, sizeof(before));
+    1022:	68 84 00 00 00       	push   $0x84
+    1027:	6a 00                	push   $0x0
+    1029:	56                   	push   %esi
+    102a:	e8 51 03 00 00       	call   1380 <memset>
+  if(argc > 1){
+    102f:	83 c4 10             	add    $0x10,%esp
+    1032:	83 fb 01             	cmp    $0x1,%ebx
+    1035:	7e 47                	jle    107e <main+0x7e>
+    if(kstat(&before) < 0){
+    1037:	83 ec 0c             	sub    $0xc,%esp
+    103a:	56                   	push   %esi
+    103b:	e8 fd 06 00 00       	call   173d <kstat>
+    1040:	83 c4 10             	add    $0x10,%esp
+    1043:	85 c0                	test   %eax,%eax
+    1045:	0f 88 03 01 00 00    	js     114e <main+0x14e>
+      printf(2, "kstat: kstat failed\n");
+      exit();
+    }
+    if(fork() == 0){
+    104b:	e8 20 05 00 00       	call   1570 <fork>
+    1050:	85 c0                	test   %eax,%eax
+    1052:	75 25                	jne    1079 <main+0x79>
+      exec(argv[1], argv+1);
+    1054:	8d 47 04             	lea    0x4(%edi),%eax
+    1057:	53                   	push   %ebx
+    1058:	53                   	push   %ebx
+    1059:	50                   	push   %eax
+    105a:	ff 77 04             	push   0x4(%edi)
+    105d:	e8 5e 05 00 00       	call   15c0 <exec>
+      printf(2, "kstat: exec %s failed\n", argv[1]);
+    1062:	83 c4 0c             	add    $0xc,%esp
+    1065:	ff 77 04             	push   0x4(%edi)
+    1068:	68 dd 24 00 00       	push   $0x24dd
+    106d:	6a 02                	push   $0x2
+    106f:	e8 9c 0a 00 00       	call   1b10 <printf>
+      exit();
+    1074:	e8 27 05 00 00       	call   15a0 <exit>
+    }
+    wait();
+    1079:	e8 84 05 00 00       	call   1602 <wait>
+  }
+  if(kstat(&after) < 0){
+    107e:	83 ec 0c             	sub    $0xc,%esp
+    1081:	8d bd 64 ff ff ff    	lea    -0x9c(%ebp),%edi
+    1087:	57                   	push   %edi
+    1088:	e8 b0 06 00 00       	call   173d <kstat>
+    108d:	83 c4 10             	add    $0x10,%esp
+    1090:	85 c0                	test   %eax,%eax
+    1092:	0f 88 b6 00 00 00    	js     114e <main+0x14e>
+    printf(2, "kstat: kstat failed\n");
+    exit();
+  }
+
+  for(f = fields; f < &fields[sizeof(fields)/sizeof(fields[0])]; f++){
+    1098:	bb 00 2e 00 00       	mov    $0x2e00,%ebx
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+    v = *(uint*)((char*)&after + f->off);
+    10a0:	8b 53 04             	mov    0x4(%ebx),%edx
+    if(f->kind == COUNTER)
+    10a3:	8b 4b 08             	mov    0x8(%ebx),%ecx
+    v = *(uint*)((char*)&after + f->off);
+    10a6:	8b 84 15 64 ff ff ff 	mov    -0x9c(%ebp,%edx,1),%eax
+    if(f->kind == COUNTER)
+    10ad:	85 c9                	test   %ecx,%ecx
+    10af:	75 07                	jne    10b8 <main+0xb8>
+      v -= *(uint*)((char*)&before + f->off);
+    10b1:	2b 84 15 e0 fe ff ff 	sub    -0x120(%ebp,%edx,1),%eax
+    printf(1, "%s %d\n", f->name, v);
+    10b8:	50                   	push   %eax
+  for(f = fields; f < &fields[sizeof(fields)/sizeof(fields[0])]; f++){
+    10b9:	83 c3 0c             	add    $0xc,%ebx
+    printf(1, "%s %d\n", f->name, v);
+    10bc:	ff 73 f4             	push   -0xc(%ebx)
+    10bf:	68 f4 24 00 00       	push   $0x24f4
+    10c4:	6a 01                	push   $0x1
+    10c6:	e8 45 0a 00 00       	call   1b10 <printf>
+  for(f = fields; f < &fields[sizeof(fields)/sizeof(fields[0])]; f++){
+    10cb:	83 c4 10             	add    $0x10,%esp
+    10ce:	81 fb 8c 2f 00 00    	cmp    $0x2f8c,%ebx
+    10d4:	75 ca                	jne    10a0 <main+0xa0>
+  }
+
+  // Averages over the requests counted above.
+  n = get(&after, "disk_reqs") - get(&before, "disk_reqs");
+    10d6:	51                   	push   %ecx
+    10d7:	51                   	push   %ecx
+    10d8:	68 fb 24 00 00       	push   $0x24fb
+    10dd:	57                   	push   %edi
+    10de:	e8 8d 01 00 00       	call   1270 <get>
+    10e3:	89 c3                	mov    %eax,%ebx
+    10e5:	58                   	pop    %eax
+    10e6:	5a                   	pop    %edx
+    10e7:	68 fb 24 00 00       	push   $0x24fb
+    10ec:	56                   	push   %esi
+    10ed:	e8 7e 01 00 00       	call   1270 <get>
+  if(n > 0){
+    10f2:	83 c4 10             	add    $0x10,%esp
+    10f5:	29 c3                	sub    %eax,%ebx
+    10f7:	0f 85 e8 00 00 00    	jne    11e5 <main+0x1e5>
+    printf(1, "disk_avgq %d\n",
+      (get(&after, "disk_qsum") - get(&before, "disk_qsum")) / n);
+    printf(1, "disk_avglat %d\n",
+      (get(&after, "disk_lat") - get(&before, "disk_lat")) / n);
+  }
+  n = get(&after, "log_waits") - get(&before, "log_waits");
+    10fd:	51                   	push   %ecx
+    10fe:	51                   	push   %ecx
+    10ff:	68 36 25 00 00       	push   $0x2536
+    1104:	57                   	push   %edi
+    1105:	e8 66 01 00 00       	call   1270 <get>
+    110a:	89 c3                	mov    %eax,%ebx
+    110c:	58                   	pop    %eax
+    110d:	5a                   	pop    %edx
+    110e:	68 36 25 00 00       	push   $0x2536
+    1113:	56                   	push   %esi
+    1114:	e8 57 01 00 00       	call   1270 <get>
+  if(n > 0)
+    1119:	83 c4 10             	add    $0x10,%esp
+    111c:	29 c3                	sub    %eax,%ebx
+    111e:	75 7f                	jne    119f <main+0x19f>
+    printf(1, "log_avgwait %d\n",
+      (get(&after, "log_waitcyc") - get(&before, "log_waitcyc")) / n);
+  n = get(&after, "disk_sectors") - get(&before, "disk_sectors");
+    1120:	53                   	push   %ebx
+    1121:	53                   	push   %ebx
+    1122:	68 5c 25 00 00       	push   $0x255c
+    1127:	57                   	push   %edi
+    1128:	e8 43 01 00 00       	call   1270 <get>
+    112d:	89 c3                	mov    %eax,%ebx
+    112f:	58                   	pop    %eax
+    1130:	5a                   	pop    %edx
+    1131:	68 5c 25 00 00       	push   $0x255c
+    1136:	56                   	push   %esi
+    1137:	e8 34 01 00 00       	call   1270 <get>
+  if(n >= 2048)
+    113c:	83 c4 10             	add    $0x10,%esp
+  n = get(&after, "disk_sectors") - get(&before, "disk_sectors");
+    113f:	29 c3                	sub    %eax,%ebx
+  if(n >= 2048)
+    1141:	81 fb ff 07 00 00    	cmp    $0x7ff,%ebx
+    1147:	77 18                	ja     1161 <main+0x161>
+    printf(1, "disk_cpu_per_mb %d\n",
+      (get(&after, "disk_cpu") - get(&before, "disk_cpu")) / (n / 2048));
+  exit();
+    1149:	e8 52 04 00 00       	call   15a0 <exit>
+      printf(2, "kstat: kstat failed\n");
+    114e:	56                   	push   %esi
+    114f:	56                   	push   %esi
+    1150:	68 c8 24 00 00       	push   $0x24c8
+    1155:	6a 02                	push   $0x2
+    1157:	e8 b4 09 00 00       	call   1b10 <printf>
+      exit();
+    115c:	e8 3f 04 00 00       	call   15a0 <exit>
+      (get(&after, "disk_cpu") - get(&before, "disk_cpu")) / (n / 2048));
+    1161:	50                   	push   %eax
+    1162:	c1 eb 0b             	shr    $0xb,%ebx
+    1165:	50                   	push   %eax
+    1166:	68 69 25 00 00       	push   $0x2569
+    116b:	57                   	push   %edi
+    116c:	e8 ff 00 00 00       	call   1270 <get>
+    1171:	5a                   	pop    %edx
+    1172:	59                   	pop    %ecx
+    1173:	68 69 25 00 00       	push   $0x2569
+    1178:	56                   	push   %esi
+    1179:	89 c7                	mov    %eax,%edi
+    117b:	e8 f0 00 00 00       	call   1270 <get>
+    printf(1, "disk_cpu_per_mb %d\n",
+    1180:	83 c4 0c             	add    $0xc,%esp
+      (get(&after, "disk_cpu") - get(&before, "disk_cpu")) / (n / 2048));
+    1183:	89 c2                	mov    %eax,%edx
+    1185:	89 f8                	mov    %edi,%eax
+    1187:	29 d0                	sub    %edx,%eax
+    printf(1, "disk_cpu_per_mb %d\n",
+    1189:	31 d2                	xor    %edx,%edx
+    118b:	f7 f3                	div    %ebx
+    118d:	50                   	push   %eax
+    118e:	68 72 25 00 00       	push   $0x2572
+    1193:	6a 01                	push   $0x1
+    1195:	e8 76 09 00 00       	call   1b10 <printf>
+    119a:	83 c4 10             	add    $0x10,%esp
+    119d:	eb aa                	jmp    1149 <main+0x149>
+      (get(&after, "log_waitcyc") - get(&before, "log_waitcyc")) / n);
+    119f:	51                   	push   %ecx
+    11a0:	51                   	push   %ecx
+    11a1:	68 40 25 00 00       	push   $0x2540
+    11a6:	57                   	push   %edi
+    11a7:	e8 c4 00 00 00       	call   1270 <get>
+    11ac:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+    11b2:	58                   	pop    %eax
+    11b3:	5a                   	pop    %edx
+    11b4:	68 40 25 00 00       	push   $0x2540
+    11b9:	56                   	push   %esi
+    11ba:	e8 b1 00 00 00       	call   1270 <get>
+    printf(1, "log_avgwait %d\n",
+    11bf:	83 c4 0c             	add    $0xc,%esp
+      (get(&after, "log_waitcyc") - get(&before, "log_waitcyc")) / n);
+    11c2:	89 c2                	mov    %eax,%edx
+    11c4:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+    11ca:	29 d0                	sub    %edx,%eax
+    printf(1, "log_avgwait %d\n",
+    11cc:	31 d2                	xor    %edx,%edx
+    11ce:	f7 f3                	div    %ebx
+    11d0:	50                   	push   %eax
+    11d1:	68 4c 25 00 00       	push   $0x254c
+    11d6:	6a 01                	push   $0x1
+    11d8:	e8 33 09 00 00       	call   1b10 <printf>
+    11dd:	83 c4 10             	add    $0x10,%esp
+    11e0:	e9 3b ff ff ff       	jmp    1120 <main+0x120>
+      (get(&after, "disk_qsum") - get(&before, "disk_qsum")) / n);
+    11e5:	51                   	push   %ecx
+    11e6:	51                   	push   %ecx
+    11e7:	68 05 25 00 00       	push   $0x2505
+    11ec:	57                   	push   %edi
+    11ed:	e8 7e 00 00 00       	call   1270 <get>
+    11f2:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+    11f8:	58                   	pop    %eax
+    11f9:	5a                   	pop    %edx
+    11fa:	68 05 25 00 00       	push   $0x2505
+    11ff:	56                   	push   %esi
+    1200:	e8 6b 00 00 00       	call   1270 <get>
+    printf(1, "disk_avgq %d\n",
+    1205:	83 c4 0c             	add    $0xc,%esp
+      (get(&after, "disk_qsum") - get(&before, "disk_qsum")) / n);
+    1208:	89 c2                	mov    %eax,%edx
+    120a:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+    1210:	29 d0                	sub    %edx,%eax
+    printf(1, "disk_avgq %d\n",
+    1212:	31 d2                	xor    %edx,%edx
+    1214:	f7 f3                	div    %ebx
+    1216:	50                   	push   %eax
+    1217:	68 0f 25 00 00       	push   $0x250f
+    121c:	6a 01                	push   $0x1
+    121e:	e8 ed 08 00 00       	call   1b10 <printf>
+      (get(&after, "disk_lat") - get(&before, "disk_lat")) / n);
+    1223:	59                   	pop    %ecx
+    1224:	58                   	pop    %eax
+    1225:	68 1d 25 00 00       	push   $0x251d
+    122a:	57                   	push   %edi
+    122b:	e8 40 00 00 00       	call   1270 <get>
+    1230:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+    1236:	58                   	pop    %eax
+    1237:	5a                   	pop    %edx
+    1238:	68 1d 25 00 00       	push   $0x251d
+    123d:	56                   	push   %esi
+    123e:	e8 2d 00 00 00       	call   1270 <get>
+    printf(1, "disk_avglat %d\n",
+    1243:	83 c4 0c             	add    $0xc,%esp
+      (get(&after, "disk_lat") - get(&before, "disk_lat")) / n);
+    1246:	89 c2                	mov    %eax,%edx
+    1248:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+    124e:	29 d0                	sub    %edx,%eax
+    printf(1, "disk_avglat %d\n",
+    1250:	31 d2                	xor    %edx,%edx
+    1252:	f7 f3                	div    %ebx
+    1254:	50                   	push   %eax
+    1255:	68 26 25 00 00       	push   $0x2526
+    125a:	6a 01                	push   $0x1
+    125c:	e8 af 08 00 00       	call   1b10 <printf>
+    1261:	83 c4 10             	add    $0x10,%esp
+    1264:	e9 94 fe ff ff       	jmp    10fd <main+0xfd>
+    1269:	66 90                	xchg   %ax,%ax
+    126b:	66 90                	xchg   %ax,%ax
+    126d:	66 90                	xchg   %ax,%ax
+    126f:	90                   	nop
+
+00001270 <get>:
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	56                   	push   %esi
+    1274:	53                   	push   %ebx
+  for(f = fields; f < &fields[sizeof(fields)/sizeof(fields[0])]; f++)
+    1275:	bb 00 2e 00 00       	mov    $0x2e00,%ebx
+{
+    127a:	8b 75 0c             	mov    0xc(%ebp),%esi
+    127d:	eb 0c                	jmp    128b <get+0x1b>
+    127f:	90                   	nop
+  for(f = fields; f < &fields[sizeof(fields)/sizeof(fields[0])]; f++)
+    1280:	83 c3 0c             	add    $0xc,%ebx
+    1283:	81 fb 8c 2f 00 00    	cmp    $0x2f8c,%ebx
+    1289:	74 25                	je     12b0 <get+0x40>
+    if(strcmp(f->name, name) == 0)
+    128b:	83 ec 08             	sub    $0x8,%esp
+    128e:	56                   	push   %esi
+    128f:	ff 33                	push   (%ebx)
+    1291:	e8 5a 00 00 00       	call   12f0 <strcmp>
+    1296:	83 c4 10             	add    $0x10,%esp
+    1299:	85 c0                	test   %eax,%eax
+    129b:	75 e3                	jne    1280 <get+0x10>
+      return *(uint*)((char*)st + f->off);
+    129d:	8b 43 04             	mov    0x4(%ebx),%eax
+    12a0:	8b 55 08             	mov    0x8(%ebp),%edx
+    12a3:	8b 04 02             	mov    (%edx,%eax,1),%eax
+}
+    12a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12a9:	5b                   	pop    %ebx
+    12aa:	5e                   	pop    %esi
+    12ab:	5d                   	pop    %ebp
+    12ac:	c3                   	ret
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+    12b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return 0;
+    12b3:	31 c0                	xor    %eax,%eax
+}
+    12b5:	5b                   	pop    %ebx
+    12b6:	5e                   	pop    %esi
+    12b7:	5d                   	pop    %ebp
+    12b8:	c3                   	ret
+    12b9:	66 90                	xchg   %ax,%ax
+    12bb:	66 90                	xchg   %ax,%ax
+    12bd:	66 90                	xchg   %ax,%ax
+    12bf:	90                   	nop
+
+000012c0 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    12c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    12c1:	31 c0                	xor    %eax,%eax
+{
+    12c3:	89 e5                	mov    %esp,%ebp
+    12c5:	53                   	push   %ebx
+    12c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    12c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    12cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    12d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    12d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    12d7:	83 c0 01             	add    $0x1,%eax
+    12da:	84 d2                	test   %dl,%dl
+    12dc:	75 f2                	jne    12d0 <strcpy+0x10>
+    ;
+  return os;
+}
+    12de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12e1:	89 c8                	mov    %ecx,%eax
+    12e3:	c9                   	leave
+    12e4:	c3                   	ret
+    12e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	53                   	push   %ebx
+    12f4:	8b 55 08             	mov    0x8(%ebp),%edx
+    12f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    12fa:	0f b6 02             	movzbl (%edx),%eax
+    12fd:	84 c0                	test   %al,%al
+    12ff:	75 17                	jne    1318 <strcmp+0x28>
+    1301:	eb 3a                	jmp    133d <strcmp+0x4d>
+    1303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1307:	90                   	nop
+    1308:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    130c:	83 c2 01             	add    $0x1,%edx
+    130f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1312:	84 c0                	test   %al,%al
+    1314:	74 1a                	je     1330 <strcmp+0x40>
+    p++, q++;
+    1316:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1318:	0f b6 19             	movzbl (%ecx),%ebx
+    131b:	38 c3                	cmp    %al,%bl
+    131d:	74 e9                	je     1308 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    131f:	29 d8                	sub    %ebx,%eax
+}
+    1321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1324:	c9                   	leave
+    1325:	c3                   	ret
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1330:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1334:	31 c0                	xor    %eax,%eax
+    1336:	29 d8                	sub    %ebx,%eax
+}
+    1338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    133b:	c9                   	leave
+    133c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    133d:	0f b6 19             	movzbl (%ecx),%ebx
+    1340:	31 c0                	xor    %eax,%eax
+    1342:	eb db                	jmp    131f <strcmp+0x2f>
+    1344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    134f:	90                   	nop
+
+00001350 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1356:	80 3a 00             	cmpb   $0x0,(%edx)
+    1359:	74 15                	je     1370 <strlen+0x20>
+    135b:	31 c0                	xor    %eax,%eax
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+    1360:	83 c0 01             	add    $0x1,%eax
+    1363:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1367:	89 c1                	mov    %eax,%ecx
+    1369:	75 f5                	jne    1360 <strlen+0x10>
+    ;
+  return n;
+}
+    136b:	89 c8                	mov    %ecx,%eax
+    136d:	5d                   	pop    %ebp
+    136e:	c3                   	ret
+    136f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1370:	31 c9                	xor    %ecx,%ecx
+}
+    1372:	5d                   	pop    %ebp
+    1373:	89 c8                	mov    %ecx,%eax
+    1375:	c3                   	ret
+    1376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001380 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	57                   	push   %edi
+    1384:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1387:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    138a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    138d:	89 d7                	mov    %edx,%edi
+    138f:	fc                   	cld
+    1390:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1392:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1395:	89 d0                	mov    %edx,%eax
+    1397:	c9                   	leave
+    1398:	c3                   	ret
+    1399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000013a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    13a0:	55                   	push   %ebp
+    13a1:	89 e5                	mov    %esp,%ebp
+    13a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    13a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    13aa:	0f b6 10             	movzbl (%eax),%edx
+    13ad:	84 d2                	test   %dl,%dl
+    13af:	75 12                	jne    13c3 <strchr+0x23>
+    13b1:	eb 1d                	jmp    13d0 <strchr+0x30>
+    13b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13b7:	90                   	nop
+    13b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    13bc:	83 c0 01             	add    $0x1,%eax
+    13bf:	84 d2                	test   %dl,%dl
+    13c1:	74 0d                	je     13d0 <strchr+0x30>
+    if(*s == c)
+    13c3:	38 d1                	cmp    %dl,%cl
+    13c5:	75 f1                	jne    13b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    13c7:	5d                   	pop    %ebp
+    13c8:	c3                   	ret
+    13c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    13d0:	31 c0                	xor    %eax,%eax
+}
+    13d2:	5d                   	pop    %ebp
+    13d3:	c3                   	ret
+    13d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13df:	90                   	nop
+
+000013e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    13e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    13e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    13e9:	31 db                	xor    %ebx,%ebx
+{
+    13eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    13ee:	eb 27                	jmp    1417 <gets+0x37>
+    cc = read(0, &c, 1);
+    13f0:	83 ec 04             	sub    $0x4,%esp
+    13f3:	6a 01                	push   $0x1
+    13f5:	56                   	push   %esi
+    13f6:	6a 00                	push   $0x0
+    13f8:	e8 23 02 00 00       	call   1620 <read>
+    if(cc < 1)
+    13fd:	83 c4 10             	add    $0x10,%esp
+    1400:	85 c0                	test   %eax,%eax
+    1402:	7e 1d                	jle    1421 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1404:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1408:	8b 55 08             	mov    0x8(%ebp),%edx
+    140b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    140f:	3c 0a                	cmp    $0xa,%al
+    1411:	74 10                	je     1423 <gets+0x43>
+    1413:	3c 0d                	cmp    $0xd,%al
+    1415:	74 0c                	je     1423 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1417:	89 df                	mov    %ebx,%edi
+    1419:	83 c3 01             	add    $0x1,%ebx
+    141c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    141f:	7c cf                	jl     13f0 <gets+0x10>
+    1421:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1423:	8b 45 08             	mov    0x8(%ebp),%eax
+    1426:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    142a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    142d:	5b                   	pop    %ebx
+    142e:	5e                   	pop    %esi
+    142f:	5f                   	pop    %edi
+    1430:	5d                   	pop    %ebp
+    1431:	c3                   	ret
+    1432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001440 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	56                   	push   %esi
+    1444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1445:	83 ec 08             	sub    $0x8,%esp
+    1448:	6a 00                	push   $0x0
+    144a:	ff 75 08             	push   0x8(%ebp)
+    144d:	e8 19 02 00 00       	call   166b <open>
+  if(fd < 0)
+    1452:	83 c4 10             	add    $0x10,%esp
+    1455:	85 c0                	test   %eax,%eax
+    1457:	78 27                	js     1480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1459:	83 ec 08             	sub    $0x8,%esp
+    145c:	ff 75 0c             	push   0xc(%ebp)
+    145f:	89 c3                	mov    %eax,%ebx
+    1461:	50                   	push   %eax
+    1462:	e8 31 02 00 00       	call   1698 <fstat>
+  close(fd);
+    1467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    146a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    146c:	e8 cd 01 00 00       	call   163e <close>
+  return r;
+    1471:	83 c4 10             	add    $0x10,%esp
+}
+    1474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1477:	89 f0                	mov    %esi,%eax
+    1479:	5b                   	pop    %ebx
+    147a:	5e                   	pop    %esi
+    147b:	5d                   	pop    %ebp
+    147c:	c3                   	ret
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1485:	eb ed                	jmp    1474 <stat+0x34>
+    1487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148e:	66 90                	xchg   %ax,%ax
+
+00001490 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	53                   	push   %ebx
+    1494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1497:	0f be 02             	movsbl (%edx),%eax
+    149a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    149d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    14a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    14a5:	77 1e                	ja     14c5 <atoi+0x35>
+    14a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    14b0:	83 c2 01             	add    $0x1,%edx
+    14b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    14b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    14ba:	0f be 02             	movsbl (%edx),%eax
+    14bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    14c0:	80 fb 09             	cmp    $0x9,%bl
+    14c3:	76 eb                	jbe    14b0 <atoi+0x20>
+  return n;
+}
+    14c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    14c8:	89 c8                	mov    %ecx,%eax
+    14ca:	c9                   	leave
+    14cb:	c3                   	ret
+    14cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 e5                	mov    %esp,%ebp
+    14d3:	57                   	push   %edi
+    14d4:	56                   	push   %esi
+    14d5:	8b 45 10             	mov    0x10(%ebp),%eax
+    14d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    14db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    14de:	85 c0                	test   %eax,%eax
+    14e0:	7e 13                	jle    14f5 <memmove+0x25>
+    14e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    14e4:	89 d7                	mov    %edx,%edi
+    14e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    14f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    14f1:	39 f8                	cmp    %edi,%eax
+    14f3:	75 fb                	jne    14f0 <memmove+0x20>
+  return vdst;
+}
+    14f5:	5e                   	pop    %esi
+    14f6:	89 d0                	mov    %edx,%eax
+    14f8:	5f                   	pop    %edi
+    14f9:	5d                   	pop    %ebp
+    14fa:	c3                   	ret
+    14fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14ff:	90                   	nop
+
+00001500 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1500:	55                   	push   %ebp
+    1501:	89 e5                	mov    %esp,%ebp
+    1503:	56                   	push   %esi
+    1504:	53                   	push   %ebx
+    1505:	8b 75 10             	mov    0x10(%ebp),%esi
+    1508:	8b 55 08             	mov    0x8(%ebp),%edx
+    150b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    150e:	85 f6                	test   %esi,%esi
+    1510:	74 2e                	je     1540 <memcmp+0x40>
+    1512:	01 c6                	add    %eax,%esi
+    1514:	eb 14                	jmp    152a <memcmp+0x2a>
+    1516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    151d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1520:	83 c0 01             	add    $0x1,%eax
+    1523:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1526:	39 f0                	cmp    %esi,%eax
+    1528:	74 16                	je     1540 <memcmp+0x40>
+    if(*s1 != *s2)
+    152a:	0f b6 0a             	movzbl (%edx),%ecx
+    152d:	0f b6 18             	movzbl (%eax),%ebx
+    1530:	38 d9                	cmp    %bl,%cl
+    1532:	74 ec                	je     1520 <memcmp+0x20>
+      return *s1 - *s2;
+    1534:	0f b6 c1             	movzbl %cl,%eax
+    1537:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1539:	5b                   	pop    %ebx
+    153a:	5e                   	pop    %esi
+    153b:	5d                   	pop    %ebp
+    153c:	c3                   	ret
+    153d:	8d 76 00             	lea    0x0(%esi),%esi
+    1540:	5b                   	pop    %ebx
+  return 0;
+    1541:	31 c0                	xor    %eax,%eax
+}
+    1543:	5e                   	pop    %esi
+    1544:	5d                   	pop    %ebp
+    1545:	c3                   	ret
+    1546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    154d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001550 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1550:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1555:	c3                   	ret
+    1556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    155d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001560 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1560:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1565:	c3                   	ret
+    1566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001570 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1570:	a1 00 32 00 00       	mov    0x3200,%eax
+    1575:	85 c0                	test   %eax,%eax
+    1577:	74 17                	je     1590 <fork+0x20>
+{
+    1579:	55                   	push   %ebp
+    157a:	89 e5                	mov    %esp,%ebp
+    157c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    157f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1581:	c9                   	leave
+  return _fork();
+    1582:	e9 5d 00 00 00       	jmp    15e4 <_fork>
+    1587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158e:	66 90                	xchg   %ax,%ax
+    1590:	e9 4f 00 00 00       	jmp    15e4 <_fork>
+    1595:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015a0 <exit>:
+
+int
+exit(void)
+{
+    15a0:	55                   	push   %ebp
+    15a1:	89 e5                	mov    %esp,%ebp
+    15a3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    15a6:	a1 00 32 00 00       	mov    0x3200,%eax
+    15ab:	85 c0                	test   %eax,%eax
+    15ad:	74 02                	je     15b1 <exit+0x11>
+    flushhook();
+    15af:	ff d0                	call   *%eax
+  _exit();
+    15b1:	e8 3d 00 00 00       	call   15f3 <_exit>
+    15b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000015c0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    15c0:	55                   	push   %ebp
+  if(flushhook)
+    15c1:	a1 00 32 00 00       	mov    0x3200,%eax
+{
+    15c6:	89 e5                	mov    %esp,%ebp
+    15c8:	56                   	push   %esi
+    15c9:	53                   	push   %ebx
+    15ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    15cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    15d0:	85 c0                	test   %eax,%eax
+    15d2:	74 02                	je     15d6 <exec+0x16>
+    flushhook();
+    15d4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    15d6:	89 75 0c             	mov    %esi,0xc(%ebp)
+    15d9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    15dc:	5b                   	pop    %ebx
+    15dd:	5e                   	pop    %esi
+    15de:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    15df:	e9 78 00 00 00       	jmp    165c <_exec>
+
+000015e4 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    15e4:	b8 01 00 00 00       	mov    $0x1,%eax
+    15e9:	89 e1                	mov    %esp,%ecx
+    15eb:	ba f2 15 00 00       	mov    $0x15f2,%edx
+    15f0:	0f 34                	sysenter
+    15f2:	c3                   	ret
+
+000015f3 <_exit>:
+RAWSYSCALL(exit)
+    15f3:	b8 02 00 00 00       	mov    $0x2,%eax
+    15f8:	89 e1                	mov    %esp,%ecx
+    15fa:	ba 01 16 00 00       	mov    $0x1601,%edx
+    15ff:	0f 34                	sysenter
+    1601:	c3                   	ret
+
+00001602 <wait>:
+SYSCALL(wait)
+    1602:	b8 03 00 00 00       	mov    $0x3,%eax
+    1607:	89 e1                	mov    %esp,%ecx
+    1609:	ba 10 16 00 00       	mov    $0x1610,%edx
+    160e:	0f 34                	sysenter
+    1610:	c3                   	ret
+
+00001611 <pipe>:
+SYSCALL(pipe)
+    1611:	b8 04 00 00 00       	mov    $0x4,%eax
+    1616:	89 e1                	mov    %esp,%ecx
+    1618:	ba 1f 16 00 00       	mov    $0x161f,%edx
+    161d:	0f 34                	sysenter
+    161f:	c3                   	ret
+
+00001620 <read>:
+SYSCALL(read)
+    1620:	b8 05 00 00 00       	mov    $0x5,%eax
+    1625:	89 e1                	mov    %esp,%ecx
+    1627:	ba 2e 16 00 00       	mov    $0x162e,%edx
+    162c:	0f 34                	sysenter
+    162e:	c3                   	ret
+
+0000162f <write>:
+SYSCALL(write)
+    162f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1634:	89 e1                	mov    %esp,%ecx
+    1636:	ba 3d 16 00 00       	mov    $0x163d,%edx
+    163b:	0f 34                	sysenter
+    163d:	c3                   	ret
+
+0000163e <close>:
+SYSCALL(close)
+    163e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1643:	89 e1                	mov    %esp,%ecx
+    1645:	ba 4c 16 00 00       	mov    $0x164c,%edx
+    164a:	0f 34                	sysenter
+    164c:	c3                   	ret
+
+0000164d <kill>:
+SYSCALL(kill)
+    164d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1652:	89 e1                	mov    %esp,%ecx
+    1654:	ba 5b 16 00 00       	mov    $0x165b,%edx
+    1659:	0f 34                	sysenter
+    165b:	c3                   	ret
+
+0000165c <_exec>:
+RAWSYSCALL(exec)
+    165c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1661:	89 e1                	mov    %esp,%ecx
+    1663:	ba 6a 16 00 00       	mov    $0x166a,%edx
+    1668:	0f 34                	sysenter
+    166a:	c3                   	ret
+
+0000166b <open>:
+SYSCALL(open)
+    166b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1670:	89 e1                	mov    %esp,%ecx
+    1672:	ba 79 16 00 00       	mov    $0x1679,%edx
+    1677:	0f 34                	sysenter
+    1679:	c3                   	ret
+
+0000167a <mknod>:
+SYSCALL(mknod)
+    167a:	b8 11 00 00 00       	mov    $0x11,%eax
+    167f:	89 e1                	mov    %esp,%ecx
+    1681:	ba 88 16 00 00       	mov    $0x1688,%edx
+    1686:	0f 34                	sysenter
+    1688:	c3                   	ret
+
+00001689 <unlink>:
+SYSCALL(unlink)
+    1689:	b8 12 00 00 00       	mov    $0x12,%eax
+    168e:	89 e1                	mov    %esp,%ecx
+    1690:	ba 97 16 00 00       	mov    $0x1697,%edx
+    1695:	0f 34                	sysenter
+    1697:	c3                   	ret
+
+00001698 <fstat>:
+SYSCALL(fstat)
+    1698:	b8 08 00 00 00       	mov    $0x8,%eax
+    169d:	89 e1                	mov    %esp,%ecx
+    169f:	ba a6 16 00 00       	mov    $0x16a6,%edx
+    16a4:	0f 34                	sysenter
+    16a6:	c3                   	ret
+
+000016a7 <link>:
+SYSCALL(link)
+    16a7:	b8 13 00 00 00       	mov    $0x13,%eax
+    16ac:	89 e1                	mov    %esp,%ecx
+    16ae:	ba b5 16 00 00       	mov    $0x16b5,%edx
+    16b3:	0f 34                	sysenter
+    16b5:	c3                   	ret
+
+000016b6 <mkdir>:
+SYSCALL(mkdir)
+    16b6:	b8 14 00 00 00       	mov    $0x14,%eax
+    16bb:	89 e1                	mov    %esp,%ecx
+    16bd:	ba c4 16 00 00       	mov    $0x16c4,%edx
+    16c2:	0f 34                	sysenter
+    16c4:	c3                   	ret
+
+000016c5 <chdir>:
+SYSCALL(chdir)
+    16c5:	b8 09 00 00 00       	mov    $0x9,%eax
+    16ca:	89 e1                	mov    %esp,%ecx
+    16cc:	ba d3 16 00 00       	mov    $0x16d3,%edx
+    16d1:	0f 34                	sysenter
+    16d3:	c3                   	ret
+
+000016d4 <dup>:
+SYSCALL(dup)
+    16d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    16d9:	89 e1                	mov    %esp,%ecx
+    16db:	ba e2 16 00 00       	mov    $0x16e2,%edx
+    16e0:	0f 34                	sysenter
+    16e2:	c3                   	ret
+
+000016e3 <getpid>:
+SYSCALL(getpid)
+    16e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    16e8:	89 e1                	mov    %esp,%ecx
+    16ea:	ba f1 16 00 00       	mov    $0x16f1,%edx
+    16ef:	0f 34                	sysenter
+    16f1:	c3                   	ret
+
+000016f2 <sbrk>:
+SYSCALL(sbrk)
+    16f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    16f7:	89 e1                	mov    %esp,%ecx
+    16f9:	ba 00 17 00 00       	mov    $0x1700,%edx
+    16fe:	0f 34                	sysenter
+    1700:	c3                   	ret
+
+00001701 <sleep>:
+SYSCALL(sleep)
+    1701:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1706:	89 e1                	mov    %esp,%ecx
+    1708:	ba 0f 17 00 00       	mov    $0x170f,%edx
+    170d:	0f 34                	sysenter
+    170f:	c3                   	ret
+
+00001710 <uptime>:
+SYSCALL(uptime)
+    1710:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1715:	89 e1                	mov    %esp,%ecx
+    1717:	ba 1e 17 00 00       	mov    $0x171e,%edx
+    171c:	0f 34                	sysenter
+    171e:	c3                   	ret
+
+0000171f <mprotect>:
+SYSCALL(mprotect)
+    171f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1724:	89 e1                	mov    %esp,%ecx
+    1726:	ba 2d 17 00 00       	mov    $0x172d,%edx
+    172b:	0f 34                	sysenter
+    172d:	c3                   	ret
+
+0000172e <munprotect>:
+SYSCALL(munprotect)
+    172e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1733:	89 e1                	mov    %esp,%ecx
+    1735:	ba 3c 17 00 00       	mov    $0x173c,%edx
+    173a:	0f 34                	sysenter
+    173c:	c3                   	ret
+
+0000173d <kstat>:
+SYSCALL(kstat)
+    173d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1742:	89 e1                	mov    %esp,%ecx
+    1744:	ba 4b 17 00 00       	mov    $0x174b,%edx
+    1749:	0f 34                	sysenter
+    174b:	c3                   	ret
+
+0000174c <fcntl>:
+SYSCALL(fcntl)
+    174c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1751:	89 e1                	mov    %esp,%ecx
+    1753:	ba 5a 17 00 00       	mov    $0x175a,%edx
+    1758:	0f 34                	sysenter
+    175a:	c3                   	ret
+
+0000175b <splice>:
+SYSCALL(splice)
+    175b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1760:	89 e1                	mov    %esp,%ecx
+    1762:	ba 69 17 00 00       	mov    $0x1769,%edx
+    1767:	0f 34                	sysenter
+    1769:	c3                   	ret
+
+0000176a <sendfile>:
+SYSCALL(sendfile)
+    176a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    176f:	89 e1                	mov    %esp,%ecx
+    1771:	ba 78 17 00 00       	mov    $0x1778,%edx
+    1776:	0f 34                	sysenter
+    1778:	c3                   	ret
+
+00001779 <lseek>:
+SYSCALL(lseek)
+    1779:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    177e:	89 e1                	mov    %esp,%ecx
+    1780:	ba 87 17 00 00       	mov    $0x1787,%edx
+    1785:	0f 34                	sysenter
+    1787:	c3                   	ret
+
+00001788 <pread>:
+SYSCALL(pread)
+    1788:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    178d:	89 e1                	mov    %esp,%ecx
+    178f:	ba 96 17 00 00       	mov    $0x1796,%edx
+    1794:	0f 34                	sysenter
+    1796:	c3                   	ret
+
+00001797 <pwrite>:
+SYSCALL(pwrite)
+    1797:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    179c:	89 e1                	mov    %esp,%ecx
+    179e:	ba a5 17 00 00       	mov    $0x17a5,%edx
+    17a3:	0f 34                	sysenter
+    17a5:	c3                   	ret
+
+000017a6 <readv>:
+SYSCALL(readv)
+    17a6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    17ab:	89 e1                	mov    %esp,%ecx
+    17ad:	ba b4 17 00 00       	mov    $0x17b4,%edx
+    17b2:	0f 34                	sysenter
+    17b4:	c3                   	ret
+
+000017b5 <writev>:
+SYSCALL(writev)
+    17b5:	b8 20 00 00 00       	mov    $0x20,%eax
+    17ba:	89 e1                	mov    %esp,%ecx
+    17bc:	ba c3 17 00 00       	mov    $0x17c3,%edx
+    17c1:	0f 34                	sysenter
+    17c3:	c3                   	ret
+
+000017c4 <ringsetup>:
+SYSCALL(ringsetup)
+    17c4:	b8 21 00 00 00       	mov    $0x21,%eax
+    17c9:	89 e1                	mov    %esp,%ecx
+    17cb:	ba d2 17 00 00       	mov    $0x17d2,%edx
+    17d0:	0f 34                	sysenter
+    17d2:	c3                   	ret
+
+000017d3 <ringenter>:
+SYSCALL(ringenter)
+    17d3:	b8 22 00 00 00       	mov    $0x22,%eax
+    17d8:	89 e1                	mov    %esp,%ecx
+    17da:	ba e1 17 00 00       	mov    $0x17e1,%edx
+    17df:	0f 34                	sysenter
+    17e1:	c3                   	ret
+
+000017e2 <intgetpid>:
+INTSYSCALL(getpid)
+    17e2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    17e7:	cd 40                	int    $0x40
+    17e9:	c3                   	ret
+    17ea:	66 90                	xchg   %ax,%ax
+    17ec:	66 90                	xchg   %ax,%ax
+    17ee:	66 90                	xchg   %ax,%ax
+
+000017f0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 e5                	mov    %esp,%ebp
+    17f3:	57                   	push   %edi
+    17f4:	56                   	push   %esi
+    17f5:	53                   	push   %ebx
+    17f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    17f8:	89 d1                	mov    %edx,%ecx
+{
+    17fa:	83 ec 2c             	sub    $0x2c,%esp
+    17fd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1800:	85 d2                	test   %edx,%edx
+    1802:	0f 89 c0 00 00 00    	jns    18c8 <printint+0xd8>
+    1808:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    180c:	0f 84 b6 00 00 00    	je     18c8 <printint+0xd8>
+    x = -xx;
+    1812:	f7 d9                	neg    %ecx
+    neg = 1;
+    1814:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1819:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    181c:	31 f6                	xor    %esi,%esi
+    181e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1820:	89 c8                	mov    %ecx,%eax
+    1822:	31 d2                	xor    %edx,%edx
+    1824:	89 f7                	mov    %esi,%edi
+    1826:	f7 f3                	div    %ebx
+    1828:	8d 76 01             	lea    0x1(%esi),%esi
+    182b:	0f b6 92 1c 27 00 00 	movzbl 0x271c(%edx),%edx
+    1832:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1836:	89 ca                	mov    %ecx,%edx
+    1838:	89 c1                	mov    %eax,%ecx
+    183a:	39 da                	cmp    %ebx,%edx
+    183c:	73 e2                	jae    1820 <printint+0x30>
+  if(neg)
+    183e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1841:	85 c0                	test   %eax,%eax
+    1843:	74 07                	je     184c <printint+0x5c>
+    buf[i++] = '-';
+    1845:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    184a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    184c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    184f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1852:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1854:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1857:	8b 41 08             	mov    0x8(%ecx),%eax
+    185a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    185d:	89 ce                	mov    %ecx,%esi
+    185f:	eb 1c                	jmp    187d <printint+0x8d>
+    1861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1868:	89 c1                	mov    %eax,%ecx
+    186a:	83 c0 01             	add    $0x1,%eax
+    186d:	89 46 08             	mov    %eax,0x8(%esi)
+    1870:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1874:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1877:	39 df                	cmp    %ebx,%edi
+    1879:	74 41                	je     18bc <printint+0xcc>
+    187b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    187d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1880:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1885:	75 e1                	jne    1868 <printint+0x78>
+  if(o->f)
+    1887:	8b 06                	mov    (%esi),%eax
+    1889:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    188c:	85 c0                	test   %eax,%eax
+    188e:	74 40                	je     18d0 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1890:	50                   	push   %eax
+    1891:	68 80 00 00 00       	push   $0x80
+    1896:	6a 01                	push   $0x1
+    1898:	ff 75 d4             	push   -0x2c(%ebp)
+    189b:	e8 a0 04 00 00       	call   1d40 <fwrite>
+    18a0:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    18a4:	83 c4 10             	add    $0x10,%esp
+}
+    18a7:	b8 01 00 00 00       	mov    $0x1,%eax
+    18ac:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    18ae:	89 46 08             	mov    %eax,0x8(%esi)
+    18b1:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    18b5:	8d 57 ff             	lea    -0x1(%edi),%edx
+    18b8:	39 df                	cmp    %ebx,%edi
+    18ba:	75 bf                	jne    187b <printint+0x8b>
+}
+    18bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18bf:	5b                   	pop    %ebx
+    18c0:	5e                   	pop    %esi
+    18c1:	5f                   	pop    %edi
+    18c2:	5d                   	pop    %ebp
+    18c3:	c3                   	ret
+    18c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    18c8:	31 c0                	xor    %eax,%eax
+    18ca:	e9 4a ff ff ff       	jmp    1819 <printint+0x29>
+    18cf:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    18d0:	83 ec 04             	sub    $0x4,%esp
+    18d3:	68 80 00 00 00       	push   $0x80
+    18d8:	ff 75 d4             	push   -0x2c(%ebp)
+    18db:	ff 76 04             	push   0x4(%esi)
+    18de:	e8 4c fd ff ff       	call   162f <write>
+    18e3:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    18e7:	83 c4 10             	add    $0x10,%esp
+    18ea:	eb bb                	jmp    18a7 <printint+0xb7>
+    18ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000018f0 <putc>:
+{
+    18f0:	55                   	push   %ebp
+    18f1:	89 e5                	mov    %esp,%ebp
+    18f3:	56                   	push   %esi
+    18f4:	89 d6                	mov    %edx,%esi
+    18f6:	53                   	push   %ebx
+    18f7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    18f9:	8b 40 08             	mov    0x8(%eax),%eax
+    18fc:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1901:	74 1d                	je     1920 <putc+0x30>
+  o->buf[o->n++] = c;
+    1903:	89 f1                	mov    %esi,%ecx
+    1905:	8d 50 01             	lea    0x1(%eax),%edx
+    1908:	89 53 08             	mov    %edx,0x8(%ebx)
+    190b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    190f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1912:	5b                   	pop    %ebx
+    1913:	5e                   	pop    %esi
+    1914:	5d                   	pop    %ebp
+    1915:	c3                   	ret
+    1916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1920:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1922:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1925:	85 c0                	test   %eax,%eax
+    1927:	74 2f                	je     1958 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1929:	50                   	push   %eax
+    192a:	68 80 00 00 00       	push   $0x80
+    192f:	6a 01                	push   $0x1
+    1931:	52                   	push   %edx
+    1932:	e8 09 04 00 00       	call   1d40 <fwrite>
+    1937:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    193a:	89 f1                	mov    %esi,%ecx
+}
+    193c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1941:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1943:	89 53 08             	mov    %edx,0x8(%ebx)
+    1946:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    194a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    194d:	5b                   	pop    %ebx
+    194e:	5e                   	pop    %esi
+    194f:	5d                   	pop    %ebp
+    1950:	c3                   	ret
+    1951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1958:	83 ec 04             	sub    $0x4,%esp
+    195b:	68 80 00 00 00       	push   $0x80
+    1960:	52                   	push   %edx
+    1961:	ff 73 04             	push   0x4(%ebx)
+    1964:	e8 c6 fc ff ff       	call   162f <write>
+    1969:	83 c4 10             	add    $0x10,%esp
+    196c:	eb cc                	jmp    193a <putc+0x4a>
+    196e:	66 90                	xchg   %ax,%ax
+
+00001970 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1970:	55                   	push   %ebp
+    1971:	89 e5                	mov    %esp,%ebp
+    1973:	57                   	push   %edi
+    1974:	89 c7                	mov    %eax,%edi
+    1976:	56                   	push   %esi
+    1977:	31 f6                	xor    %esi,%esi
+    1979:	53                   	push   %ebx
+    197a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    197d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1980:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1983:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1986:	84 c0                	test   %al,%al
+    1988:	75 1e                	jne    19a8 <vprintf.constprop.0+0x38>
+    198a:	eb 53                	jmp    19df <vprintf.constprop.0+0x6f>
+    198c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1990:	83 f8 25             	cmp    $0x25,%eax
+    1993:	74 3b                	je     19d0 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1995:	89 ca                	mov    %ecx,%edx
+    1997:	89 f8                	mov    %edi,%eax
+    1999:	e8 52 ff ff ff       	call   18f0 <putc>
+  for(i = 0; fmt[i]; i++){
+    199e:	0f b6 03             	movzbl (%ebx),%eax
+    19a1:	83 c3 01             	add    $0x1,%ebx
+    19a4:	84 c0                	test   %al,%al
+    19a6:	74 37                	je     19df <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    19a8:	0f be c8             	movsbl %al,%ecx
+    19ab:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    19ae:	85 f6                	test   %esi,%esi
+    19b0:	74 de                	je     1990 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    19b2:	83 fe 25             	cmp    $0x25,%esi
+    19b5:	75 e7                	jne    199e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    19b7:	83 f8 25             	cmp    $0x25,%eax
+    19ba:	74 4e                	je     1a0a <vprintf.constprop.0+0x9a>
+    19bc:	83 e8 63             	sub    $0x63,%eax
+    19bf:	83 f8 15             	cmp    $0x15,%eax
+    19c2:	77 34                	ja     19f8 <vprintf.constprop.0+0x88>
+    19c4:	ff 24 85 c4 26 00 00 	jmp    *0x26c4(,%eax,4)
+    19cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19cf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    19d0:	0f b6 03             	movzbl (%ebx),%eax
+    19d3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    19d6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    19db:	84 c0                	test   %al,%al
+    19dd:	75 c9                	jne    19a8 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    19df:	8b 47 08             	mov    0x8(%edi),%eax
+    19e2:	85 c0                	test   %eax,%eax
+    19e4:	0f 8f de 00 00 00    	jg     1ac8 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    19ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19ed:	5b                   	pop    %ebx
+    19ee:	5e                   	pop    %esi
+    19ef:	5f                   	pop    %edi
+    19f0:	5d                   	pop    %ebp
+    19f1:	c3                   	ret
+    19f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    19f8:	ba 25 00 00 00       	mov    $0x25,%edx
+    19fd:	89 f8                	mov    %edi,%eax
+    19ff:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1a02:	e8 e9 fe ff ff       	call   18f0 <putc>
+        putc(o, c);
+    1a07:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1a0a:	89 ca                	mov    %ecx,%edx
+    1a0c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    1a0e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1a10:	e8 db fe ff ff       	call   18f0 <putc>
+    1a15:	eb 87                	jmp    199e <vprintf.constprop.0+0x2e>
+    1a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a1e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1a20:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1a23:	83 ec 0c             	sub    $0xc,%esp
+    1a26:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1a2b:	8b 16                	mov    (%esi),%edx
+    1a2d:	6a 00                	push   $0x0
+        ap++;
+    1a2f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1a32:	89 f8                	mov    %edi,%eax
+    1a34:	e8 b7 fd ff ff       	call   17f0 <printint>
+        ap++;
+    1a39:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    1a3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1a3f:	31 f6                	xor    %esi,%esi
+    1a41:	e9 58 ff ff ff       	jmp    199e <vprintf.constprop.0+0x2e>
+    1a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1a50:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a53:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1a55:	83 c0 04             	add    $0x4,%eax
+    1a58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    1a5b:	85 f6                	test   %esi,%esi
+    1a5d:	75 1b                	jne    1a7a <vprintf.constprop.0+0x10a>
+    1a5f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1a64:	be bb 26 00 00       	mov    $0x26bb,%esi
+    1a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1a70:	89 f8                	mov    %edi,%eax
+          s++;
+    1a72:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1a75:	e8 76 fe ff ff       	call   18f0 <putc>
+        while(*s != 0){
+    1a7a:	0f be 16             	movsbl (%esi),%edx
+    1a7d:	84 d2                	test   %dl,%dl
+    1a7f:	75 ef                	jne    1a70 <vprintf.constprop.0+0x100>
+      state = 0;
+    1a81:	31 f6                	xor    %esi,%esi
+    1a83:	e9 16 ff ff ff       	jmp    199e <vprintf.constprop.0+0x2e>
+    1a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a8f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1a90:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1a93:	83 ec 0c             	sub    $0xc,%esp
+    1a96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1a9b:	8b 16                	mov    (%esi),%edx
+    1a9d:	6a 01                	push   $0x1
+    1a9f:	eb 8e                	jmp    1a2f <vprintf.constprop.0+0xbf>
+    1aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1aa8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1aab:	89 f8                	mov    %edi,%eax
+    1aad:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1ab0:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1ab3:	e8 38 fe ff ff       	call   18f0 <putc>
+        ap++;
+    1ab8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    1abb:	31 f6                	xor    %esi,%esi
+    1abd:	e9 dc fe ff ff       	jmp    199e <vprintf.constprop.0+0x2e>
+    1ac2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1ac8:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    1aca:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    1acd:	85 d2                	test   %edx,%edx
+    1acf:	74 1f                	je     1af0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1ad1:	52                   	push   %edx
+    1ad2:	50                   	push   %eax
+    1ad3:	6a 01                	push   $0x1
+    1ad5:	51                   	push   %ecx
+    1ad6:	e8 65 02 00 00       	call   1d40 <fwrite>
+    1adb:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1ade:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ae8:	5b                   	pop    %ebx
+    1ae9:	5e                   	pop    %esi
+    1aea:	5f                   	pop    %edi
+    1aeb:	5d                   	pop    %ebp
+    1aec:	c3                   	ret
+    1aed:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1af0:	83 ec 04             	sub    $0x4,%esp
+    1af3:	50                   	push   %eax
+    1af4:	51                   	push   %ecx
+    1af5:	ff 77 04             	push   0x4(%edi)
+    1af8:	e8 32 fb ff ff       	call   162f <write>
+    1afd:	83 c4 10             	add    $0x10,%esp
+    1b00:	eb dc                	jmp    1ade <vprintf.constprop.0+0x16e>
+    1b02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b10 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1b10:	55                   	push   %ebp
+    1b11:	89 e5                	mov    %esp,%ebp
+    1b13:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1b19:	a1 a4 2f 00 00       	mov    0x2fa4,%eax
+{
+    1b1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1b21:	83 fa 01             	cmp    $0x1,%edx
+    1b24:	74 0c                	je     1b32 <printf+0x22>
+    1b26:	31 c0                	xor    %eax,%eax
+    1b28:	83 fa 02             	cmp    $0x2,%edx
+    1b2b:	0f 44 05 a0 2f 00 00 	cmove  0x2fa0,%eax
+  o.fd = fd;
+    1b32:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1b38:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1b3b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1b3e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1b44:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1b4a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1b51:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1b54:	e8 17 fe ff ff       	call   1970 <vprintf.constprop.0>
+}
+    1b59:	c9                   	leave
+    1b5a:	c3                   	ret
+    1b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b5f:	90                   	nop
+
+00001b60 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1b60:	55                   	push   %ebp
+    1b61:	89 e5                	mov    %esp,%ebp
+    1b63:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1b6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1b6f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1b72:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1b79:	ff ff ff 
+  o.n = 0;
+    1b7c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1b83:	00 00 00 
+  o.f = f;
+    1b86:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1b8c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1b92:	e8 d9 fd ff ff       	call   1970 <vprintf.constprop.0>
+}
+    1b97:	c9                   	leave
+    1b98:	c3                   	ret
+    1b99:	66 90                	xchg   %ax,%ax
+    1b9b:	66 90                	xchg   %ax,%ax
+    1b9d:	66 90                	xchg   %ax,%ax
+    1b9f:	90                   	nop
+
+00001ba0 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1ba0:	55                   	push   %ebp
+    1ba1:	89 e5                	mov    %esp,%ebp
+    1ba3:	53                   	push   %ebx
+    1ba4:	89 c3                	mov    %eax,%ebx
+    1ba6:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1ba9:	8b 40 0c             	mov    0xc(%eax),%eax
+    1bac:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1baf:	74 17                	je     1bc8 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1bb1:	83 f8 02             	cmp    $0x2,%eax
+    1bb4:	74 07                	je     1bbd <setmode+0x1d>
+    1bb6:	8b 43 18             	mov    0x18(%ebx),%eax
+    1bb9:	85 c0                	test   %eax,%eax
+    1bbb:	74 38                	je     1bf5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1bbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1bc0:	c9                   	leave
+    1bc1:	c3                   	ret
+    1bc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1bc8:	83 ec 08             	sub    $0x8,%esp
+    1bcb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1bce:	50                   	push   %eax
+    1bcf:	ff 33                	push   (%ebx)
+    1bd1:	e8 c2 fa ff ff       	call   1698 <fstat>
+    1bd6:	83 c4 10             	add    $0x10,%esp
+    1bd9:	89 c2                	mov    %eax,%edx
+    1bdb:	31 c0                	xor    %eax,%eax
+    1bdd:	85 d2                	test   %edx,%edx
+    1bdf:	75 0a                	jne    1beb <setmode+0x4b>
+    1be1:	31 c0                	xor    %eax,%eax
+    1be3:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1be8:	0f 94 c0             	sete   %al
+    1beb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1bee:	8b 43 18             	mov    0x18(%ebx),%eax
+    1bf1:	85 c0                	test   %eax,%eax
+    1bf3:	75 c8                	jne    1bbd <setmode+0x1d>
+    1bf5:	83 ec 0c             	sub    $0xc,%esp
+    1bf8:	68 00 04 00 00       	push   $0x400
+    1bfd:	e8 de 07 00 00       	call   23e0 <malloc>
+    1c02:	83 c4 10             	add    $0x10,%esp
+    1c05:	89 43 18             	mov    %eax,0x18(%ebx)
+    1c08:	85 c0                	test   %eax,%eax
+    1c0a:	75 b1                	jne    1bbd <setmode+0x1d>
+    f->mode = IONBF;
+    1c0c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1c13:	eb a8                	jmp    1bbd <setmode+0x1d>
+    1c15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c20 <drain>:
+{
+    1c20:	55                   	push   %ebp
+    1c21:	89 e5                	mov    %esp,%ebp
+    1c23:	57                   	push   %edi
+    1c24:	56                   	push   %esi
+    1c25:	53                   	push   %ebx
+    1c26:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1c29:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1c2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1c2f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1c36:	85 ff                	test   %edi,%edi
+    1c38:	7f 0e                	jg     1c48 <drain+0x28>
+  return 0;
+    1c3a:	31 c0                	xor    %eax,%eax
+}
+    1c3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c3f:	5b                   	pop    %ebx
+    1c40:	5e                   	pop    %esi
+    1c41:	5f                   	pop    %edi
+    1c42:	5d                   	pop    %ebp
+    1c43:	c3                   	ret
+    1c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1c48:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c4b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1c4e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1c50:	eb 0e                	jmp    1c60 <drain+0x40>
+    1c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1c58:	29 c7                	sub    %eax,%edi
+    1c5a:	01 c3                	add    %eax,%ebx
+    1c5c:	85 ff                	test   %edi,%edi
+    1c5e:	7e da                	jle    1c3a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1c60:	83 ec 04             	sub    $0x4,%esp
+    1c63:	57                   	push   %edi
+    1c64:	53                   	push   %ebx
+    1c65:	56                   	push   %esi
+    1c66:	e8 c4 f9 ff ff       	call   162f <write>
+    1c6b:	83 c4 10             	add    $0x10,%esp
+    1c6e:	85 c0                	test   %eax,%eax
+    1c70:	7f e6                	jg     1c58 <drain+0x38>
+    f->err = 1;
+    1c72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c75:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1c7c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1c81:	eb b9                	jmp    1c3c <drain+0x1c>
+    1c83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001c90 <flushall>:
+
+static void
+flushall(void)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c94:	bb c0 2f 00 00       	mov    $0x2fc0,%ebx
+{
+    1c99:	83 ec 04             	sub    $0x4,%esp
+    1c9c:	eb 0d                	jmp    1cab <flushall+0x1b>
+    1c9e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ca0:	83 c3 24             	add    $0x24,%ebx
+    1ca3:	81 fb 00 32 00 00    	cmp    $0x3200,%ebx
+    1ca9:	74 19                	je     1cc4 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1cab:	8b 43 08             	mov    0x8(%ebx),%eax
+    1cae:	85 c0                	test   %eax,%eax
+    1cb0:	74 ee                	je     1ca0 <flushall+0x10>
+    1cb2:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1cb4:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1cb7:	e8 64 ff ff ff       	call   1c20 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1cbc:	81 fb 00 32 00 00    	cmp    $0x3200,%ebx
+    1cc2:	75 e7                	jne    1cab <flushall+0x1b>
+}
+    1cc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1cc7:	c9                   	leave
+    1cc8:	c3                   	ret
+    1cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cd0 <fflush>:
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	57                   	push   %edi
+    1cd4:	56                   	push   %esi
+    1cd5:	53                   	push   %ebx
+    1cd6:	83 ec 0c             	sub    $0xc,%esp
+    1cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1cdc:	85 c0                	test   %eax,%eax
+    1cde:	74 28                	je     1d08 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1ce0:	8b 70 08             	mov    0x8(%eax),%esi
+    1ce3:	85 f6                	test   %esi,%esi
+    1ce5:	75 11                	jne    1cf8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1ce7:	83 c4 0c             	add    $0xc,%esp
+    1cea:	89 f0                	mov    %esi,%eax
+    1cec:	5b                   	pop    %ebx
+    1ced:	5e                   	pop    %esi
+    1cee:	5f                   	pop    %edi
+    1cef:	5d                   	pop    %ebp
+    1cf0:	c3                   	ret
+    1cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cf8:	83 c4 0c             	add    $0xc,%esp
+    1cfb:	5b                   	pop    %ebx
+    1cfc:	5e                   	pop    %esi
+    1cfd:	5f                   	pop    %edi
+    1cfe:	5d                   	pop    %ebp
+  return drain(f);
+    1cff:	e9 1c ff ff ff       	jmp    1c20 <drain>
+    1d04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1d08:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d0a:	bb c0 2f 00 00       	mov    $0x2fc0,%ebx
+        r = -1;
+    1d0f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1d14:	eb 15                	jmp    1d2b <fflush+0x5b>
+    1d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d20:	83 c3 24             	add    $0x24,%ebx
+    1d23:	81 fb 00 32 00 00    	cmp    $0x3200,%ebx
+    1d29:	74 bc                	je     1ce7 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1d2b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1d2e:	85 c0                	test   %eax,%eax
+    1d30:	74 ee                	je     1d20 <fflush+0x50>
+    1d32:	89 d8                	mov    %ebx,%eax
+    1d34:	e8 e7 fe ff ff       	call   1c20 <drain>
+        r = -1;
+    1d39:	85 c0                	test   %eax,%eax
+    1d3b:	0f 48 f7             	cmovs  %edi,%esi
+    1d3e:	eb e0                	jmp    1d20 <fflush+0x50>
+
+00001d40 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1d40:	55                   	push   %ebp
+    1d41:	89 e5                	mov    %esp,%ebp
+    1d43:	57                   	push   %edi
+    1d44:	56                   	push   %esi
+    1d45:	53                   	push   %ebx
+    1d46:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1d49:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1d4c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1d50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1d53:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1d56:	85 d2                	test   %edx,%edx
+    1d58:	0f 8e 26 01 00 00    	jle    1e84 <fwrite+0x144>
+  if(!f->writable){
+    1d5e:	8b 46 08             	mov    0x8(%esi),%eax
+    1d61:	85 c0                	test   %eax,%eax
+    1d63:	0f 84 14 01 00 00    	je     1e7d <fwrite+0x13d>
+  setmode(f);
+    1d69:	89 f0                	mov    %esi,%eax
+    1d6b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1d6e:	e8 2d fe ff ff       	call   1ba0 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1d73:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1d77:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1d7a:	c7 05 00 32 00 00 90 	movl   $0x1c90,0x3200
+    1d81:	1c 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1d84:	0f 84 b6 00 00 00    	je     1e40 <fwrite+0x100>
+    1d8a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1d90:	0f 8f aa 00 00 00    	jg     1e40 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1d96:	8b 46 20             	mov    0x20(%esi),%eax
+    1d99:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1d9c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1d9e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1da3:	74 6c                	je     1e11 <fwrite+0xd1>
+    1da5:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1da8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1dab:	ba 00 04 00 00       	mov    $0x400,%edx
+    1db0:	29 c2                	sub    %eax,%edx
+    1db2:	39 ca                	cmp    %ecx,%edx
+    1db4:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1db7:	85 d2                	test   %edx,%edx
+    1db9:	0f 8e d1 00 00 00    	jle    1e90 <fwrite+0x150>
+    1dbf:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1dc2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1dc5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dcf:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1dd0:	8d 50 01             	lea    0x1(%eax),%edx
+    1dd3:	83 c3 01             	add    $0x1,%ebx
+    1dd6:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1dd9:	89 56 20             	mov    %edx,0x20(%esi)
+    1ddc:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1de0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1de3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1de6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1deb:	80 fa 0a             	cmp    $0xa,%dl
+    1dee:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1df1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1df4:	39 cb                	cmp    %ecx,%ebx
+    1df6:	75 d8                	jne    1dd0 <fwrite+0x90>
+    1df8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1dfb:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1dfe:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1e01:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1e04:	85 db                	test   %ebx,%ebx
+    1e06:	7e 19                	jle    1e21 <fwrite+0xe1>
+    n -= k;
+    1e08:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1e0a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1e0f:	75 97                	jne    1da8 <fwrite+0x68>
+    1e11:	89 f0                	mov    %esi,%eax
+    1e13:	e8 08 fe ff ff       	call   1c20 <drain>
+    1e18:	85 c0                	test   %eax,%eax
+    1e1a:	78 68                	js     1e84 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1e1c:	8b 46 20             	mov    0x20(%esi),%eax
+    1e1f:	eb 87                	jmp    1da8 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1e21:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1e26:	74 74                	je     1e9c <fwrite+0x15c>
+    1e28:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1e2c:	75 04                	jne    1e32 <fwrite+0xf2>
+    1e2e:	85 ff                	test   %edi,%edi
+    1e30:	75 6a                	jne    1e9c <fwrite+0x15c>
+    return nmemb;
+    1e32:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e38:	5b                   	pop    %ebx
+    1e39:	5e                   	pop    %esi
+    1e3a:	5f                   	pop    %edi
+    1e3b:	5d                   	pop    %ebp
+    1e3c:	c3                   	ret
+    1e3d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1e40:	89 f0                	mov    %esi,%eax
+    1e42:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1e45:	e8 d6 fd ff ff       	call   1c20 <drain>
+    1e4a:	85 c0                	test   %eax,%eax
+    1e4c:	78 2f                	js     1e7d <fwrite+0x13d>
+    1e4e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1e51:	8b 3e                	mov    (%esi),%edi
+    1e53:	89 de                	mov    %ebx,%esi
+    1e55:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1e58:	eb 0e                	jmp    1e68 <fwrite+0x128>
+    1e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1e60:	29 c3                	sub    %eax,%ebx
+    1e62:	01 c6                	add    %eax,%esi
+    1e64:	85 db                	test   %ebx,%ebx
+    1e66:	7e ca                	jle    1e32 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1e68:	83 ec 04             	sub    $0x4,%esp
+    1e6b:	53                   	push   %ebx
+    1e6c:	56                   	push   %esi
+    1e6d:	57                   	push   %edi
+    1e6e:	e8 bc f7 ff ff       	call   162f <write>
+    1e73:	83 c4 10             	add    $0x10,%esp
+    1e76:	85 c0                	test   %eax,%eax
+    1e78:	7f e6                	jg     1e60 <fwrite+0x120>
+    1e7a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1e7d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1e84:	31 c0                	xor    %eax,%eax
+}
+    1e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e89:	5b                   	pop    %ebx
+    1e8a:	5e                   	pop    %esi
+    1e8b:	5f                   	pop    %edi
+    1e8c:	5d                   	pop    %ebp
+    1e8d:	c3                   	ret
+    1e8e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1e90:	89 d9                	mov    %ebx,%ecx
+    1e92:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1e95:	89 cb                	mov    %ecx,%ebx
+    1e97:	e9 6e ff ff ff       	jmp    1e0a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1e9c:	89 f0                	mov    %esi,%eax
+    1e9e:	e8 7d fd ff ff       	call   1c20 <drain>
+    1ea3:	85 c0                	test   %eax,%eax
+    1ea5:	79 8b                	jns    1e32 <fwrite+0xf2>
+    return 0;
+    1ea7:	31 c0                	xor    %eax,%eax
+    1ea9:	eb db                	jmp    1e86 <fwrite+0x146>
+    1eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1eaf:	90                   	nop
+
+00001eb0 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1eb0:	55                   	push   %ebp
+    1eb1:	89 e5                	mov    %esp,%ebp
+    1eb3:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1eb6:	8b 45 08             	mov    0x8(%ebp),%eax
+    1eb9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1ebc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1ebf:	ff 75 0c             	push   0xc(%ebp)
+    1ec2:	6a 01                	push   $0x1
+    1ec4:	6a 01                	push   $0x1
+    1ec6:	50                   	push   %eax
+    1ec7:	e8 74 fe ff ff       	call   1d40 <fwrite>
+    1ecc:	83 c4 10             	add    $0x10,%esp
+    1ecf:	83 f8 01             	cmp    $0x1,%eax
+    1ed2:	75 0c                	jne    1ee0 <fputc+0x30>
+    1ed4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1ed8:	c9                   	leave
+    1ed9:	c3                   	ret
+    1eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1ee0:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1ee1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1ee6:	c3                   	ret
+    1ee7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1eee:	66 90                	xchg   %ax,%ax
+
+00001ef0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1ef0:	55                   	push   %ebp
+    1ef1:	89 e5                	mov    %esp,%ebp
+    1ef3:	57                   	push   %edi
+    1ef4:	56                   	push   %esi
+    1ef5:	53                   	push   %ebx
+    1ef6:	83 ec 1c             	sub    $0x1c,%esp
+    1ef9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1efc:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1eff:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1f02:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1f05:	85 d2                	test   %edx,%edx
+    1f07:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1f0a:	7e 12                	jle    1f1e <fread+0x2e>
+    1f0c:	85 ff                	test   %edi,%edi
+    1f0e:	7e 0e                	jle    1f1e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1f10:	8b 43 04             	mov    0x4(%ebx),%eax
+    1f13:	85 c0                	test   %eax,%eax
+    1f15:	75 19                	jne    1f30 <fread+0x40>
+    f->err = 1;
+    1f17:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1f1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1f21:	31 c0                	xor    %eax,%eax
+}
+    1f23:	5b                   	pop    %ebx
+    1f24:	5e                   	pop    %esi
+    1f25:	5f                   	pop    %edi
+    1f26:	5d                   	pop    %ebp
+    1f27:	c3                   	ret
+    1f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f2f:	90                   	nop
+  setmode(f);
+    1f30:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1f32:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1f34:	e8 67 fc ff ff       	call   1ba0 <setmode>
+  for(n = 0; n < want; n += k){
+    1f39:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1f3c:	89 f7                	mov    %esi,%edi
+    1f3e:	eb 31                	jmp    1f71 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1f40:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1f44:	74 08                	je     1f4e <fread+0x5e>
+    1f46:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1f4c:	7e 62                	jle    1fb0 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1f4e:	83 ec 04             	sub    $0x4,%esp
+    1f51:	56                   	push   %esi
+    1f52:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f55:	01 f8                	add    %edi,%eax
+    1f57:	50                   	push   %eax
+    1f58:	ff 33                	push   (%ebx)
+    1f5a:	e8 c1 f6 ff ff       	call   1620 <read>
+    1f5f:	83 c4 10             	add    $0x10,%esp
+    1f62:	85 c0                	test   %eax,%eax
+    1f64:	0f 8e ce 00 00 00    	jle    2038 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1f6a:	01 c7                	add    %eax,%edi
+    1f6c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1f6f:	7e 36                	jle    1fa7 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1f71:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1f74:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1f77:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1f7a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1f7c:	39 c1                	cmp    %eax,%ecx
+    1f7e:	7d c0                	jge    1f40 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1f80:	29 c8                	sub    %ecx,%eax
+    1f82:	39 f0                	cmp    %esi,%eax
+    1f84:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1f87:	83 ec 04             	sub    $0x4,%esp
+    1f8a:	56                   	push   %esi
+    1f8b:	03 4b 18             	add    0x18(%ebx),%ecx
+    1f8e:	51                   	push   %ecx
+    1f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f92:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1f94:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1f96:	50                   	push   %eax
+    1f97:	e8 34 f5 ff ff       	call   14d0 <memmove>
+      f->r += k;
+    1f9c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1f9f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1fa2:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1fa5:	7f ca                	jg     1f71 <fread+0x81>
+    1fa7:	89 fe                	mov    %edi,%esi
+    1fa9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1fac:	eb 3f                	jmp    1fed <fread+0xfd>
+    1fae:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1fb0:	3b 1d a8 2f 00 00    	cmp    0x2fa8,%ebx
+    1fb6:	74 68                	je     2020 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1fb8:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1fbb:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1fc2:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1fc9:	68 00 04 00 00       	push   $0x400
+    1fce:	ff 73 18             	push   0x18(%ebx)
+    1fd1:	ff 33                	push   (%ebx)
+    1fd3:	e8 48 f6 ff ff       	call   1620 <read>
+    1fd8:	83 c4 10             	add    $0x10,%esp
+    1fdb:	85 c0                	test   %eax,%eax
+    1fdd:	78 21                	js     2000 <fread+0x110>
+  else if(n == 0)
+    1fdf:	75 2f                	jne    2010 <fread+0x120>
+    f->eof = 1;
+    1fe1:	89 fe                	mov    %edi,%esi
+    1fe3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1fe6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1fed:	89 f0                	mov    %esi,%eax
+}
+    1fef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1ff2:	99                   	cltd
+}
+    1ff3:	5b                   	pop    %ebx
+    1ff4:	5e                   	pop    %esi
+  return n / size;
+    1ff5:	f7 ff                	idiv   %edi
+}
+    1ff7:	5f                   	pop    %edi
+    1ff8:	5d                   	pop    %ebp
+    1ff9:	c3                   	ret
+    1ffa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    2000:	89 fe                	mov    %edi,%esi
+    2002:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2005:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    200c:	eb df                	jmp    1fed <fread+0xfd>
+    200e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    2010:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    2013:	e9 54 ff ff ff       	jmp    1f6c <fread+0x7c>
+    2018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    201f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    2020:	83 ec 0c             	sub    $0xc,%esp
+    2023:	ff 35 a4 2f 00 00    	push   0x2fa4
+    2029:	e8 a2 fc ff ff       	call   1cd0 <fflush>
+    202e:	83 c4 10             	add    $0x10,%esp
+    2031:	eb 85                	jmp    1fb8 <fread+0xc8>
+    2033:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2037:	90                   	nop
+        if(k < 0)
+    2038:	89 fe                	mov    %edi,%esi
+    203a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    203d:	74 a7                	je     1fe6 <fread+0xf6>
+    203f:	eb c4                	jmp    2005 <fread+0x115>
+    2041:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2048:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    204f:	90                   	nop
+
+00002050 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    2050:	55                   	push   %ebp
+    2051:	89 e5                	mov    %esp,%ebp
+    2053:	53                   	push   %ebx
+    2054:	83 ec 14             	sub    $0x14,%esp
+    2057:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    205a:	8b 50 04             	mov    0x4(%eax),%edx
+    205d:	85 d2                	test   %edx,%edx
+    205f:	74 08                	je     2069 <fgetc+0x19>
+    2061:	8b 50 1c             	mov    0x1c(%eax),%edx
+    2064:	3b 50 20             	cmp    0x20(%eax),%edx
+    2067:	7c 27                	jl     2090 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2069:	50                   	push   %eax
+    206a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    206d:	6a 01                	push   $0x1
+    206f:	6a 01                	push   $0x1
+    2071:	50                   	push   %eax
+    2072:	e8 79 fe ff ff       	call   1ef0 <fread>
+    2077:	83 c4 10             	add    $0x10,%esp
+    207a:	83 f8 01             	cmp    $0x1,%eax
+    207d:	75 29                	jne    20a8 <fgetc+0x58>
+    207f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2083:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2086:	c9                   	leave
+    2087:	c3                   	ret
+    2088:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    208f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    2090:	8b 48 18             	mov    0x18(%eax),%ecx
+    2093:	8d 5a 01             	lea    0x1(%edx),%ebx
+    2096:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    2099:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    209c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    20a0:	c9                   	leave
+    20a1:	c3                   	ret
+    20a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    20a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    20ad:	eb d4                	jmp    2083 <fgetc+0x33>
+    20af:	90                   	nop
+
+000020b0 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    20b0:	55                   	push   %ebp
+    20b1:	89 e5                	mov    %esp,%ebp
+    20b3:	57                   	push   %edi
+    20b4:	56                   	push   %esi
+    20b5:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    20b6:	31 db                	xor    %ebx,%ebx
+{
+    20b8:	83 ec 1c             	sub    $0x1c,%esp
+    20bb:	8b 75 10             	mov    0x10(%ebp),%esi
+    20be:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    20c0:	eb 2e                	jmp    20f0 <fgets+0x40>
+    20c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    20c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    20cb:	57                   	push   %edi
+    20cc:	6a 01                	push   $0x1
+    20ce:	6a 01                	push   $0x1
+    20d0:	50                   	push   %eax
+    20d1:	e8 1a fe ff ff       	call   1ef0 <fread>
+    20d6:	83 c4 10             	add    $0x10,%esp
+    20d9:	83 f8 01             	cmp    $0x1,%eax
+    20dc:	75 62                	jne    2140 <fgets+0x90>
+    20de:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    20e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    20e5:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    20e7:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    20eb:	83 f9 0a             	cmp    $0xa,%ecx
+    20ee:	74 34                	je     2124 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    20f0:	89 de                	mov    %ebx,%esi
+    20f2:	83 c3 01             	add    $0x1,%ebx
+    20f5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    20f8:	7d 46                	jge    2140 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    20fa:	8b 47 04             	mov    0x4(%edi),%eax
+    20fd:	85 c0                	test   %eax,%eax
+    20ff:	74 c7                	je     20c8 <fgets+0x18>
+    2101:	8b 47 1c             	mov    0x1c(%edi),%eax
+    2104:	3b 47 20             	cmp    0x20(%edi),%eax
+    2107:	7d bf                	jge    20c8 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    2109:	8b 4f 18             	mov    0x18(%edi),%ecx
+    210c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    210f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    2112:	89 77 1c             	mov    %esi,0x1c(%edi)
+    2115:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    2119:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    211b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    211f:	83 f9 0a             	cmp    $0xa,%ecx
+    2122:	75 cc                	jne    20f0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2124:	8b 45 08             	mov    0x8(%ebp),%eax
+    2127:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    212b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    212e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2131:	5b                   	pop    %ebx
+    2132:	5e                   	pop    %esi
+    2133:	5f                   	pop    %edi
+    2134:	5d                   	pop    %ebp
+    2135:	c3                   	ret
+    2136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    213d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2140:	8b 45 08             	mov    0x8(%ebp),%eax
+    2143:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2147:	31 c0                	xor    %eax,%eax
+    2149:	85 f6                	test   %esi,%esi
+    214b:	74 e1                	je     212e <fgets+0x7e>
+    214d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2150:	eb dc                	jmp    212e <fgets+0x7e>
+    2152:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002160 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    2160:	55                   	push   %ebp
+    2161:	89 e5                	mov    %esp,%ebp
+    2163:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2164:	bb c0 2f 00 00       	mov    $0x2fc0,%ebx
+{
+    2169:	83 ec 04             	sub    $0x4,%esp
+    216c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    2170:	8b 53 04             	mov    0x4(%ebx),%edx
+    2173:	85 d2                	test   %edx,%edx
+    2175:	75 07                	jne    217e <fdopen+0x1e>
+    2177:	8b 43 08             	mov    0x8(%ebx),%eax
+    217a:	85 c0                	test   %eax,%eax
+    217c:	74 1a                	je     2198 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    217e:	83 c3 24             	add    $0x24,%ebx
+    2181:	81 fb 00 32 00 00    	cmp    $0x3200,%ebx
+    2187:	75 e7                	jne    2170 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2189:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    218b:	89 d8                	mov    %ebx,%eax
+    218d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2190:	c9                   	leave
+    2191:	c3                   	ret
+    2192:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2198:	81 fb 00 32 00 00    	cmp    $0x3200,%ebx
+    219e:	74 e9                	je     2189 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    21a0:	83 ec 04             	sub    $0x4,%esp
+    21a3:	6a 24                	push   $0x24
+    21a5:	6a 00                	push   $0x0
+    21a7:	53                   	push   %ebx
+    21a8:	e8 d3 f1 ff ff       	call   1380 <memset>
+  f->fd = fd;
+    21ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    21b0:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    21b7:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    21ba:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    21bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+    21bf:	80 38 72             	cmpb   $0x72,(%eax)
+    21c2:	74 14                	je     21d8 <fdopen+0x78>
+    f->writable = 1;
+    21c4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    21cb:	89 d8                	mov    %ebx,%eax
+    21cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    21d0:	c9                   	leave
+    21d1:	c3                   	ret
+    21d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    21d8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    21df:	89 d8                	mov    %ebx,%eax
+    21e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    21e4:	c9                   	leave
+    21e5:	c3                   	ret
+    21e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000021f0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    21f0:	55                   	push   %ebp
+    21f1:	89 e5                	mov    %esp,%ebp
+    21f3:	56                   	push   %esi
+    21f4:	53                   	push   %ebx
+    21f5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    21f8:	0f b6 06             	movzbl (%esi),%eax
+    21fb:	3c 72                	cmp    $0x72,%al
+    21fd:	74 61                	je     2260 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    21ff:	3c 77                	cmp    $0x77,%al
+    2201:	74 7d                	je     2280 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2203:	3c 61                	cmp    $0x61,%al
+    2205:	75 49                	jne    2250 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2207:	83 ec 08             	sub    $0x8,%esp
+    220a:	68 01 02 00 00       	push   $0x201
+    220f:	ff 75 08             	push   0x8(%ebp)
+    2212:	e8 54 f4 ff ff       	call   166b <open>
+    2217:	83 c4 10             	add    $0x10,%esp
+    221a:	89 c3                	mov    %eax,%ebx
+    221c:	85 c0                	test   %eax,%eax
+    221e:	78 30                	js     2250 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2220:	83 ec 04             	sub    $0x4,%esp
+    2223:	6a 02                	push   $0x2
+    2225:	6a 00                	push   $0x0
+    2227:	50                   	push   %eax
+    2228:	e8 4c f5 ff ff       	call   1779 <lseek>
+    222d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2230:	83 ec 08             	sub    $0x8,%esp
+    2233:	56                   	push   %esi
+    2234:	53                   	push   %ebx
+    2235:	e8 26 ff ff ff       	call   2160 <fdopen>
+    223a:	83 c4 10             	add    $0x10,%esp
+    223d:	85 c0                	test   %eax,%eax
+    223f:	75 11                	jne    2252 <fopen+0x62>
+    close(fd);
+    2241:	83 ec 0c             	sub    $0xc,%esp
+    2244:	53                   	push   %ebx
+    2245:	e8 f4 f3 ff ff       	call   163e <close>
+    224a:	83 c4 10             	add    $0x10,%esp
+    224d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2250:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2252:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2255:	5b                   	pop    %ebx
+    2256:	5e                   	pop    %esi
+    2257:	5d                   	pop    %ebp
+    2258:	c3                   	ret
+    2259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2260:	83 ec 08             	sub    $0x8,%esp
+    2263:	6a 00                	push   $0x0
+    2265:	ff 75 08             	push   0x8(%ebp)
+    2268:	e8 fe f3 ff ff       	call   166b <open>
+    226d:	83 c4 10             	add    $0x10,%esp
+    2270:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2272:	85 db                	test   %ebx,%ebx
+    2274:	78 da                	js     2250 <fopen+0x60>
+    2276:	eb b8                	jmp    2230 <fopen+0x40>
+    2278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    227f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2280:	83 ec 08             	sub    $0x8,%esp
+    2283:	68 01 06 00 00       	push   $0x601
+    2288:	ff 75 08             	push   0x8(%ebp)
+    228b:	e8 db f3 ff ff       	call   166b <open>
+    2290:	83 c4 10             	add    $0x10,%esp
+    2293:	89 c3                	mov    %eax,%ebx
+    2295:	eb db                	jmp    2272 <fopen+0x82>
+    2297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    229e:	66 90                	xchg   %ax,%ax
+
+000022a0 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    22a0:	55                   	push   %ebp
+    22a1:	89 e5                	mov    %esp,%ebp
+    22a3:	56                   	push   %esi
+    22a4:	53                   	push   %ebx
+    22a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    22a8:	83 ec 0c             	sub    $0xc,%esp
+    22ab:	53                   	push   %ebx
+    22ac:	e8 1f fa ff ff       	call   1cd0 <fflush>
+    22b1:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    22b3:	58                   	pop    %eax
+    22b4:	ff 33                	push   (%ebx)
+    22b6:	e8 83 f3 ff ff       	call   163e <close>
+    22bb:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    22be:	85 c0                	test   %eax,%eax
+    22c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    22c5:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    22c8:	8b 43 18             	mov    0x18(%ebx),%eax
+    22cb:	85 c0                	test   %eax,%eax
+    22cd:	0f 95 c1             	setne  %cl
+    22d0:	3d 20 36 00 00       	cmp    $0x3620,%eax
+    22d5:	0f 95 c2             	setne  %dl
+    22d8:	84 d1                	test   %dl,%cl
+    22da:	74 07                	je     22e3 <fclose+0x43>
+    22dc:	3d 20 32 00 00       	cmp    $0x3220,%eax
+    22e1:	75 25                	jne    2308 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    22e3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    22ea:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    22ec:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    22f3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    22fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    22fd:	5b                   	pop    %ebx
+    22fe:	5e                   	pop    %esi
+    22ff:	5d                   	pop    %ebp
+    2300:	c3                   	ret
+    2301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2308:	83 ec 0c             	sub    $0xc,%esp
+    230b:	50                   	push   %eax
+    230c:	e8 3f 00 00 00       	call   2350 <free>
+    2311:	83 c4 10             	add    $0x10,%esp
+    2314:	eb cd                	jmp    22e3 <fclose+0x43>
+    2316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    231d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002320 <feof>:
+
+int
+feof(FILE *f)
+{
+    2320:	55                   	push   %ebp
+    2321:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2323:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2326:	5d                   	pop    %ebp
+  return f->eof;
+    2327:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    232a:	c3                   	ret
+    232b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    232f:	90                   	nop
+
+00002330 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2330:	55                   	push   %ebp
+    2331:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2333:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2336:	5d                   	pop    %ebp
+  return f->err;
+    2337:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    233a:	c3                   	ret
+    233b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    233f:	90                   	nop
+
+00002340 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2340:	55                   	push   %ebp
+    2341:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2343:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2346:	5d                   	pop    %ebp
+  return f->fd;
+    2347:	8b 00                	mov    (%eax),%eax
+}
+    2349:	c3                   	ret
+    234a:	66 90                	xchg   %ax,%ax
+    234c:	66 90                	xchg   %ax,%ax
+    234e:	66 90                	xchg   %ax,%ax
+
+00002350 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2350:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2351:	a1 20 3a 00 00       	mov    0x3a20,%eax
+{
+    2356:	89 e5                	mov    %esp,%ebp
+    2358:	57                   	push   %edi
+    2359:	56                   	push   %esi
+    235a:	53                   	push   %ebx
+    235b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    235e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2361:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2368:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    236a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    236c:	39 ca                	cmp    %ecx,%edx
+    236e:	73 30                	jae    23a0 <free+0x50>
+    2370:	39 c1                	cmp    %eax,%ecx
+    2372:	72 04                	jb     2378 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2374:	39 c2                	cmp    %eax,%edx
+    2376:	72 f0                	jb     2368 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2378:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    237b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    237e:	39 f8                	cmp    %edi,%eax
+    2380:	74 2e                	je     23b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2382:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2385:	8b 42 04             	mov    0x4(%edx),%eax
+    2388:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    238b:	39 f1                	cmp    %esi,%ecx
+    238d:	74 38                	je     23c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    238f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2391:	5b                   	pop    %ebx
+  freep = p;
+    2392:	89 15 20 3a 00 00    	mov    %edx,0x3a20
+}
+    2398:	5e                   	pop    %esi
+    2399:	5f                   	pop    %edi
+    239a:	5d                   	pop    %ebp
+    239b:	c3                   	ret
+    239c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    23a0:	39 c1                	cmp    %eax,%ecx
+    23a2:	72 d0                	jb     2374 <free+0x24>
+    23a4:	eb c2                	jmp    2368 <free+0x18>
+    23a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    23b0:	03 70 04             	add    0x4(%eax),%esi
+    23b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    23b6:	8b 02                	mov    (%edx),%eax
+    23b8:	8b 00                	mov    (%eax),%eax
+    23ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    23bd:	8b 42 04             	mov    0x4(%edx),%eax
+    23c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    23c3:	39 f1                	cmp    %esi,%ecx
+    23c5:	75 c8                	jne    238f <free+0x3f>
+    p->s.size += bp->s.size;
+    23c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    23ca:	89 15 20 3a 00 00    	mov    %edx,0x3a20
+    p->s.size += bp->s.size;
+    23d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    23d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    23d6:	89 0a                	mov    %ecx,(%edx)
+}
+    23d8:	5b                   	pop    %ebx
+    23d9:	5e                   	pop    %esi
+    23da:	5f                   	pop    %edi
+    23db:	5d                   	pop    %ebp
+    23dc:	c3                   	ret
+    23dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000023e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    23e0:	55                   	push   %ebp
+    23e1:	89 e5                	mov    %esp,%ebp
+    23e3:	57                   	push   %edi
+    23e4:	56                   	push   %esi
+    23e5:	53                   	push   %ebx
+    23e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    23e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    23ec:	8b 15 20 3a 00 00    	mov    0x3a20,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    23f2:	8d 78 07             	lea    0x7(%eax),%edi
+    23f5:	c1 ef 03             	shr    $0x3,%edi
+    23f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    23fb:	85 d2                	test   %edx,%edx
+    23fd:	0f 84 8d 00 00 00    	je     2490 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2403:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2405:	8b 48 04             	mov    0x4(%eax),%ecx
+    2408:	39 f9                	cmp    %edi,%ecx
+    240a:	73 64                	jae    2470 <malloc+0x90>
+  if(nu < 4096)
+    240c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2411:	39 df                	cmp    %ebx,%edi
+    2413:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2416:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    241d:	eb 0a                	jmp    2429 <malloc+0x49>
+    241f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2420:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2422:	8b 48 04             	mov    0x4(%eax),%ecx
+    2425:	39 f9                	cmp    %edi,%ecx
+    2427:	73 47                	jae    2470 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2429:	89 c2                	mov    %eax,%edx
+    242b:	39 05 20 3a 00 00    	cmp    %eax,0x3a20
+    2431:	75 ed                	jne    2420 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2433:	83 ec 0c             	sub    $0xc,%esp
+    2436:	56                   	push   %esi
+    2437:	e8 b6 f2 ff ff       	call   16f2 <sbrk>
+  if(p == (char*)-1)
+    243c:	83 c4 10             	add    $0x10,%esp
+    243f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2442:	74 1c                	je     2460 <malloc+0x80>
+  hp->s.size = nu;
+    2444:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2447:	83 ec 0c             	sub    $0xc,%esp
+    244a:	83 c0 08             	add    $0x8,%eax
+    244d:	50                   	push   %eax
+    244e:	e8 fd fe ff ff       	call   2350 <free>
+  return freep;
+    2453:	8b 15 20 3a 00 00    	mov    0x3a20,%edx
+      if((p = morecore(nunits)) == 0)
+    2459:	83 c4 10             	add    $0x10,%esp
+    245c:	85 d2                	test   %edx,%edx
+    245e:	75 c0                	jne    2420 <malloc+0x40>
+        return 0;
+  }
+}
+    2460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2463:	31 c0                	xor    %eax,%eax
+}
+    2465:	5b                   	pop    %ebx
+    2466:	5e                   	pop    %esi
+    2467:	5f                   	pop    %edi
+    2468:	5d                   	pop    %ebp
+    2469:	c3                   	ret
+    246a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2470:	39 cf                	cmp    %ecx,%edi
+    2472:	74 4c                	je     24c0 <malloc+0xe0>
+        p->s.size -= nunits;
+    2474:	29 f9                	sub    %edi,%ecx
+    2476:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2479:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    247c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    247f:	89 15 20 3a 00 00    	mov    %edx,0x3a20
+}
+    2485:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2488:	83 c0 08             	add    $0x8,%eax
+}
+    248b:	5b                   	pop    %ebx
+    248c:	5e                   	pop    %esi
+    248d:	5f                   	pop    %edi
+    248e:	5d                   	pop    %ebp
+    248f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2490:	c7 05 20 3a 00 00 24 	movl   $0x3a24,0x3a20
+    2497:	3a 00 00 
+    base.s.size = 0;
+    249a:	b8 24 3a 00 00       	mov    $0x3a24,%eax
+    base.s.ptr = freep = prevp = &base;
+    249f:	c7 05 24 3a 00 00 24 	movl   $0x3a24,0x3a24
+    24a6:	3a 00 00 
+    base.s.size = 0;
+    24a9:	c7 05 28 3a 00 00 00 	movl   $0x0,0x3a28
+    24b0:	00 00 00 
+    if(p->s.size >= nunits){
+    24b3:	e9 54 ff ff ff       	jmp    240c <malloc+0x2c>
+    24b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    24c0:	8b 08                	mov    (%eax),%ecx
+    24c2:	89 0a                	mov    %ecx,(%edx)
+    24c4:	eb b9                	jmp    247f <malloc+0x9f>
@@ -0,0 +1,117 @@
+// Print kernel statistics.
+//   kstat            print every counter
+//   kstat cmd args   run cmd, then print how much each counter moved
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "kstat.h"
+
+#define OFF(f) ((uint)&((struct kstat*)0)->f)
+
+// A counter reports its change while a command runs;
+// a gauge always reports its current value.
+#define COUNTER 0
+#define GAUGE   1
+
+struct field {
+  char *name;
+  uint off;
+  int kind;
+} fields[] = {
+  { "disk_reqs",     OFF(disk_reqs),     COUNTER },
+  { "disk_cmds",     OFF(disk_cmds),     COUNTER },
+  { "disk_merged",   OFF(disk_merged),   COUNTER },
+  { "disk_expired",  OFF(disk_expired),  COUNTER },
+  { "disk_qdepth",   OFF(disk_qdepth),   GAUGE },
+  { "disk_qmax",     OFF(disk_qmax),     GAUGE },
+  { "disk_qsum",     OFF(disk_qsum),     COUNTER },
+  { "disk_lat",      OFF(disk_lat),      COUNTER },
+  { "disk_latmax",   OFF(disk_latmax),   GAUGE },
+  { "disk_dma",      OFF(disk_dma),      GAUGE },
+  { "disk_sectors",  OFF(disk_sectors),  COUNTER },
+  { "disk_cpu",      OFF(disk_cpu),      COUNTER },
+  { "log_commits",   OFF(log_commits),   COUNTER },
+  { "log_blocks",    OFF(log_blocks),    COUNTER },
+  { "log_absorbed",  OFF(log_absorbed),  COUNTER },
+  { "log_waits",     OFF(log_waits),     COUNTER },
+  { "log_waitcyc",   OFF(log_waitcyc),   COUNTER },
+  { "log_size",      OFF(log_size),      GAUGE },
+  { "fs_zeroed",     OFF(fs_zeroed),     COUNTER },
+  { "fs_nozero",     OFF(fs_nozero),     COUNTER },
+  { "icache_hits",   OFF(icache_hits),   COUNTER },
+  { "icache_misses", OFF(icache_misses), COUNTER },
+  { "icache_size",   OFF(icache_size),   GAUGE },
+  { "dcache_hits",   OFF(dcache_hits),   COUNTER },
+  { "dcache_neghits", OFF(dcache_neghits), COUNTER },
+  { "dcache_misses", OFF(dcache_misses), COUNTER },
+  { "pipe_spliced",  OFF(pipe_spliced),  COUNTER },
+  { "pipe_pagemoves", OFF(pipe_pagemoves), COUNTER },
+  { "uart_tx",       OFF(uart_tx),       COUNTER },
+  { "uart_txpolled", OFF(uart_txpolled), COUNTER },
+  { "uart_txwaits",  OFF(uart_txwaits),  COUNTER },
+  { "syscalls",      OFF(syscalls),      COUNTER },
+  { "sched_switches", OFF(sched_switches), COUNTER },
+};
+
+uint
+get(struct kstat *st, char *name)
+{
+  struct field *f;
+
+  for(f = fields; f < &fields[sizeof(fields)/sizeof(fields[0])]; f++)
+    if(strcmp(f->name, name) == 0)
+      return *(uint*)((char*)st + f->off);
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct kstat before, after;
+  struct field *f;
+  uint v, n;
+
+  memset(&before, 0, sizeof(before));
+  if(argc > 1){
+    if(kstat(&before) < 0){
+      printf(2, "kstat: kstat failed\n");
+      exit();
+    }
+    if(fork() == 0){
+      exec(argv[1], argv+1);
+      printf(2, "kstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    wait();
+  }
+  if(kstat(&after) < 0){
+    printf(2, "kstat: kstat failed\n");
+    exit();
+  }
+
+  for(f = fields; f < &fields[sizeof(fields)/sizeof(fields[0])]; f++){
+    v = *(uint*)((char*)&after + f->off);
+    if(f->kind == COUNTER)
+      v -= *(uint*)((char*)&before + f->off);
+    printf(1, "%s %d\n", f->name, v);
+  }
+
+  // Averages over the requests counted above.
+  n = get(&after, "disk_reqs") - get(&before, "disk_reqs");
+  if(n > 0){
+    printf(1, "disk_avgq %d\n",
+      (get(&after, "disk_qsum") - get(&before, "disk_qsum")) / n);
+    printf(1, "disk_avglat %d\n",
+      (get(&after, "disk_lat") - get(&before, "disk_lat")) / n);
+  }
+  n = get(&after, "log_waits") - get(&before, "log_waits");
+  if(n > 0)
+    printf(1, "log_avgwait %d\n",
+      (get(&after, "log_waitcyc") - get(&before, "log_waitcyc")) / n);
+  n = get(&after, "disk_sectors") - get(&before, "disk_sectors");
+  if(n >= 2048)
+    printf(1, "disk_cpu_per_mb %d\n",
+      (get(&after, "disk_cpu") - get(&before, "disk_cpu")) / (n / 2048));
+  exit();
+}
@@ -0,0 +1,60 @@
+// Kernel statistics, returned by the kstat system call.
+// Both the kernel and user programs use this header file.
+//
+// Cycle counts are TSC cycles shifted right by KSTAT_CYCSHIFT,
+// since user programs have no 64-bit division.
+
+#define KSTAT_CYCSHIFT 10
+
+struct kstat {
+  // IDE request queue (ide.c)
+  uint disk_reqs;      // block requests completed
+  uint disk_cmds;      // disk commands issued
+  uint disk_merged;    // requests merged into another request's command
+  uint disk_expired;   // requests dispatched because their deadline passed
+  uint disk_qdepth;    // requests queued or in flight right now
+  uint disk_qmax;      // deepest the queue has been
+  uint disk_qsum;      // sum of queue depths seen by arriving requests
+  uint disk_lat;       // total request latency, in shifted cycles
+  uint disk_latmax;    // worst request latency, in shifted cycles
+  uint disk_dma;       // 1 if the driver uses bus-master DMA
+  uint disk_sectors;   // 512-byte sectors transferred
+  uint disk_cpu;       // CPU time the driver spent on them, shifted cycles
+
+  // Log (log.c)
+  uint log_commits;    // transactions committed
+  uint log_blocks;     // blocks written to the log
+  uint log_absorbed;   // log_write()s of a block already in the transaction
+  uint log_waits;      // begin_op()s that had to wait
+  uint log_waitcyc;    // time they waited, in shifted cycles
+  uint log_size;       // most blocks a transaction can hold
+
+  // Block allocation (fs.c)
+  uint fs_zeroed;      // new blocks zeroed through the log
+  uint fs_nozero;      // new blocks not zeroed, since a write covers them
+
+  // Inode cache (fs.c)
+  uint icache_hits;    // iget() found the inode cached
+  uint icache_misses;  // iget() had to recycle an entry
+  uint icache_size;    // entries allocated
+
+  // Directory name cache (dcache.c)
+  uint dcache_hits;    // lookups answered with an inode
+  uint dcache_neghits; // lookups answered "no such name"
+  uint dcache_misses;  // lookups that had to read the directory
+
+  // Pipes (pipe.c)
+  uint pipe_spliced;   // bytes moved by splice()
+  uint pipe_pagemoves; // pages of them moved without copying
+
+  // Serial port (uart.c)
+  uint uart_tx;        // bytes sent
+  uint uart_txpolled;  // of them, polled out because the ring was full
+  uint uart_txwaits;   // console writes that slept for room in the ring
+
+  // System calls (syscall.c)
+  uint syscalls;       // system calls made
+
+  // Scheduler (proc.c)
+  uint sched_switches; // context switches to a process
+};
@@ -1,10 +1,15 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "x86.h"
+#include "kstat.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
 // Simple logging that allows concurrent FS system calls.
 //
@@ -21,119 +26,291 @@
 // sleeps until the last outstanding end_op() commits.
 //
 // The log is a physical re-do log containing disk blocks.
-// The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+// It is double-buffered: the on-disk log holds two regions,
+// and successive transactions alternate between them.  A
+// commit first copies the transaction's blocks aside, which
+// is quick, and then new system calls can fill the next
+// transaction while it writes the copies to its region.  The
+// commit is done once the header is on disk; installing the
+// blocks to their home locations is left to the loginstall
+// kernel process, which then erases the header so that the
+// region can be reused.  Until then the blocks stay pinned in
+// the cache, and recovery replays the region.  A block that a
+// later transaction has changed again is installed from the
+// log, not from the cache.
+//
+// The on-disk format of each region, whose size mkfs chooses:
+//   header block, containing a sequence number and
+//     block #s for block A, B, C, ...
+//   descriptor blocks, with the block #s the header
+//     has no room for, if any
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// Log appends are synchronous, and the header goes last.
 
-// Contents of the header block, used for both the on-disk header block
-// and to keep track in memory of logged block# before commit.
+// Contents of the header block.
 struct logheader {
+  uint magic;      // LOGMAGIC, else the region is empty
+  int n;
+  uint seq;        // commit order, for recovery
+  int block[(BSIZE - 3*sizeof(int)) / sizeof(int)];
+};
+#define LOGMAGIC 0x4c4f4732
+#define LOGNHDR (sizeof(((struct logheader*)0)->block) / sizeof(int))
+#define LOGNDESC (BSIZE / sizeof(int))
+
+// Most blocks a transaction can hold, so that the block
+// numbers of each in-memory transaction fit in a page.
+#define LOGMAX ((int)(PGSIZE / sizeof(int)))
+
+// Descriptor blocks needed for a transaction of n blocks.
+#define NDESC(n) ((n) > LOGNHDR ? ((n) - LOGNHDR + LOGNDESC - 1) / LOGNDESC : 0)
+
+// A transaction, in memory: the blocks logged so far.
+struct logtrans {
   int n;
-  int block[LOGSIZE];
+  uint seq;
+  int *block;      // log.cap of them
 };
 
 struct log {
   struct spinlock lock;
   int start;
-  int size;
+  int size;        // blocks in each region
+  int cap;         // most blocks a transaction can hold
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int committing;  // a commit is in progress
+  int copying;     // commit() is copying blocks aside; please wait.
   int dev;
-  struct logheader lh;
+  struct logtrans lh;     // the transaction being filled
+  struct logtrans reg[2]; // the one in each region, until installed
+  int committed[2];       // reg[] is committed, awaiting install
+  char **copy;            // copies of the blocks being committed
+  int region;      // region the next commit writes
+  uint seq;
+  uint ncommit;    // statistics, for kstat
+  uint nlogged;
+  uint nabsorbed;
+  uint nwait;
+  uint waitcyc;
 };
 struct log log;
 
 static void recover_from_log(void);
 static void commit();
+static void installer(void);
 
+// Allocate the in-memory log to fit the on-disk one.
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
+  char *mem;
+  int i;
+
+  if (sizeof(struct logheader) != BSIZE)
+    panic("initlog: logheader size");
+
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
-  log.size = sb.nlog;
+  log.size = sb.nlog / 2;
   log.dev = dev;
+
+  // A transaction fills the region after its header and
+  // descriptors.  The buffer cache has room to pin three
+  // transactions of LOGSIZE blocks; grow it for larger ones.
+  for(log.cap = log.size - 1; log.cap > 0; log.cap--)
+    if(1 + NDESC(log.cap) + log.cap <= log.size)
+      break;
+  if(log.cap > LOGMAX)
+    log.cap = LOGMAX;
+  if(log.cap < MAXOPBLOCKS)
+    panic("initlog: log too small");
+  if(log.cap > LOGSIZE && bgrow(3*(log.cap - LOGSIZE)) < 0)
+    panic("initlog: bgrow");
+
+  if((log.lh.block = (int*)kalloc()) == 0 ||
+     (log.reg[0].block = (int*)kalloc()) == 0 ||
+     (log.reg[1].block = (int*)kalloc()) == 0 ||
+     (log.copy = (char**)kalloc()) == 0)
+    panic("initlog: kalloc");
+  mem = 0;
+  for(i = 0; i < log.cap; i++){
+    if(i % (PGSIZE/BSIZE) == 0 && (mem = kalloc()) == 0)
+      panic("initlog: kalloc");
+    log.copy[i] = mem + i % (PGSIZE/BSIZE) * BSIZE;
+  }
   recover_from_log();
+  kproc("loginstall", installer);
+}
+
+// Is block b in the transaction being filled, or in the one in
+// region r?  Caller holds log.lock.
+static int
+logged(int b, int r)
+{
+  int i;
+
+  for(i = 0; i < log.lh.n; i++)
+    if(log.lh.block[i] == b)
+      return 1;
+  for(i = 0; i < log.reg[r].n; i++)
+    if(log.reg[r].block[i] == b)
+      return 1;
+  return 0;
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks of the region at start from log to
+// their home location.  In recovery, r is -1.  Otherwise the
+// transaction in region r is the next one, if any, and the
+// cache holds every block of this one, pinned.
 static void
-install_trans(void)
+install_trans(int start, struct logtrans *lh, int r)
 {
-  int tail;
+  int tail, later;
+  struct buf *dbuf, *lbuf;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
+  for (tail = 0; tail < lh->n; tail++) {
+    dbuf = bread(log.dev, lh->block[tail]); // read dst
+    if(r >= 0){
+      // Unless a later transaction has changed the cached
+      // block since, which log_write() would have noted before
+      // anyone could unlock the buffer, it holds the contents
+      // to install, and it is no longer pinned.
+      acquire(&log.lock);
+      later = logged(lh->block[tail], r);
+      release(&log.lock);
+      if(!later){
+        bwrite(dbuf);  // write dst to disk
+        brelse(dbuf);
+        continue;
+      }
+    }
+    lbuf = bread(log.dev, start+1+NDESC(lh->n)+tail); // read log block
+    if(r >= 0)
+      bwritethrough(dbuf, lbuf->data);  // leave the newer cached copy
+    else {
+      memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+      bwrite(dbuf);  // write dst to disk
+    }
     brelse(lbuf);
     brelse(dbuf);
   }
 }
 
-// Read the log header from disk into the in-memory log header
+// Read the log header of the region at start from disk,
+// with its descriptors.
 static void
-read_head(void)
+read_head(int start, struct logtrans *lh)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  struct buf *buf = bread(log.dev, start);
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i, d;
+  lh->n = hb->n;
+  lh->seq = hb->seq;
+  if(hb->magic != LOGMAGIC)
+    lh->n = 0;
+  else if(lh->n < 0 || lh->n > log.cap)
+    panic("read_head: committed log too large");
+  for (i = 0; i < lh->n && i < LOGNHDR; i++) {
+    lh->block[i] = hb->block[i];
   }
   brelse(buf);
+  for (d = 0; i < lh->n; d++) {
+    buf = bread(log.dev, start+1+d);
+    memmove(&lh->block[i], buf->data, min(lh->n - i, LOGNDESC) * sizeof(int));
+    i += LOGNDESC;
+    brelse(buf);
+  }
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Write a log header to the region at start, after any
+// descriptors it needs.  This is the true point at which the
+// transaction commits.
 static void
-write_head(void)
+write_head(int start, struct logtrans *lh)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  struct buf *buf;
+  struct logheader *hb;
+  int i, d;
+  for (d = 0, i = LOGNHDR; i < lh->n; d++, i += LOGNDESC) {
+    buf = bnew(log.dev, start+1+d);
+    memset(buf->data, 0, BSIZE);
+    memmove(buf->data, &lh->block[i], min(lh->n - i, LOGNDESC) * sizeof(int));
+    bwrite(buf);
+    brelse(buf);
+  }
+  buf = bnew(log.dev, start);
+  hb = (struct logheader *) (buf->data);
+  memset(buf->data, 0, BSIZE);
+  hb->magic = LOGMAGIC;
+  hb->n = lh->n;
+  hb->seq = lh->seq;
+  for (i = 0; i < lh->n && i < LOGNHDR; i++) {
+    hb->block[i] = lh->block[i];
   }
   bwrite(buf);
   brelse(buf);
 }
 
+// Erase the header of the region at start, emptying it.
+static void
+erase_head(int start)
+{
+  struct buf *buf = bnew(log.dev, start);
+  memset(buf->data, 0, BSIZE);
+  bwrite(buf);
+  brelse(buf);
+}
+
+// Replay whatever the two regions hold, older first.
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  struct logtrans *lh0, *lh1, *t;
+  int start0, start1, ts;
+
+  lh0 = &log.reg[0];
+  lh1 = &log.reg[1];
+  start0 = log.start;
+  start1 = log.start + log.size;
+  read_head(start0, lh0);
+  read_head(start1, lh1);
+  if(lh0->n > 0 && lh1->n > 0 && (int)(lh1->seq - lh0->seq) < 0){
+    t = lh0, lh0 = lh1, lh1 = t;
+    ts = start0, start0 = start1, start1 = ts;
+  }
+  install_trans(start0, lh0, -1); // if committed, copy from log to disk
+  install_trans(start1, lh1, -1);
+  log.seq = (int)(lh1->seq - lh0->seq) > 0 ? lh1->seq : lh0->seq;
+  log.reg[0].n = log.reg[1].n = 0;
+  erase_head(log.start); // clear the log
+  erase_head(log.start + log.size);
 }
 
 // called at the start of each FS system call.
 void
 begin_op(void)
 {
+  uint64 t0 = 0;
+
   acquire(&log.lock);
   while(1){
-    if(log.committing){
-      sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    if(log.copying || log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > log.cap){
+      // commit() is copying, or this op might exhaust
+      // log space; wait for commit.
+      if(t0 == 0){
+        t0 = rdtsc();
+        log.nwait++;
+      }
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      if(t0)
+        log.waitcyc += (rdtsc() - t0) >> KSTAT_CYCSHIFT;
       release(&log.lock);
       break;
     }
@@ -141,7 +318,9 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// commits if this was the last outstanding operation,
+// unless a commit is already running; that one then
+// goes on to commit this transaction as well.
 void
 end_op(void)
 {
@@ -149,9 +328,9 @@ end_op(void)
 
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
+  if(log.copying)
+    panic("log.copying");
+  if(log.outstanding == 0 && !log.committing){
     do_commit = 1;
     log.committing = 1;
   } else {
@@ -166,38 +345,103 @@ end_op(void)
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
     commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Copy the blocks of the transaction being committed
+// from the copies to its region of the log.
 static void
-write_log(void)
+write_log(int start, struct logtrans *lh)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
+  for (tail = 0; tail < lh->n; tail++) {
+    struct buf *to = bnew(log.dev, start+1+NDESC(lh->n)+tail); // log block
+    memmove(to->data, log.copy[tail], BSIZE);
     bwrite(to);  // write the log
-    brelse(from);
     brelse(to);
   }
 }
 
+// Commit transactions until there is none ready: one is
+// ready when no FS system call is executing and it has
+// blocks.  Called with log.committing set; clears it.
+// Installing is left to installer().
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+  int tail, r, *t;
+  struct buf *b;
+
+  acquire(&log.lock);
+  while(log.outstanding == 0 && log.lh.n > 0){
+    // The next region must be installed and empty.
+    r = log.region;
+    if(log.reg[r].n > 0){
+      sleep(&log, &log.lock);
+      continue;
+    }
+
+    // Close the transaction and copy its blocks aside, while
+    // begin_op() waits, so no one changes them meanwhile.
+    log.copying = 1;
+    t = log.reg[r].block;
+    log.reg[r] = log.lh;
+    log.reg[r].seq = ++log.seq;
+    log.lh.block = t;
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    release(&log.lock);
+    for (tail = 0; tail < log.reg[r].n; tail++) {
+      b = bread(log.dev, log.reg[r].block[tail]); // cache block
+      memmove(log.copy[tail], b->data, BSIZE);
+      brelse(b);
+    }
+    acquire(&log.lock);
+    log.copying = 0;
+    wakeup(&log);
+    release(&log.lock);
+
+    write_log(log.start + r*log.size, &log.reg[r]);  // Write copies to log
+    write_head(log.start + r*log.size, &log.reg[r]); // Write header to disk -- the real commit
+
+    acquire(&log.lock);
+    log.ncommit++;
+    log.nlogged += log.reg[r].n;
+    log.committed[r] = 1;
+    log.region = r ^ 1;
+    wakeup(log.committed);
+  }
+  log.committing = 0;
+  wakeup(&log);
+  release(&log.lock);
+}
+
+// The loginstall kernel process.  Installs committed
+// transactions, oldest first, then erases their regions
+// for reuse.  Until then recovery would replay them.
+static void
+installer(void)
+{
+  int r;
+
+  acquire(&log.lock);
+  for(;;){
+    r = log.region;  // the older one, if both are committed
+    if(!log.committed[r])
+      r ^= 1;
+    if(!log.committed[r]){
+      sleep(log.committed, &log.lock);
+      continue;
+    }
+    release(&log.lock);
+
+    install_trans(log.start + r*log.size, &log.reg[r], r ^ 1);
+    erase_head(log.start + r*log.size);
+
+    acquire(&log.lock);
+    log.committed[r] = 0;
+    log.reg[r].n = 0;
+    wakeup(&log);
   }
 }
 
@@ -215,7 +459,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.cap)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -228,7 +472,22 @@ log_write(struct buf *b)
   log.lh.block[i] = b->blockno;
   if (i == log.lh.n)
     log.lh.n++;
+  else
+    log.nabsorbed++;
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
 
+// Report log statistics.
+void
+logstat(struct kstat *st)
+{
+  acquire(&log.lock);
+  st->log_commits = log.ncommit;
+  st->log_blocks = log.nlogged;
+  st->log_absorbed = log.nabsorbed;
+  st->log_waits = log.nwait;
+  st->log_waitcyc = log.waitcyc;
+  st->log_size = log.cap;
+  release(&log.lock);
+}
@@ -0,0 +1,2972 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 08             	sub    $0x8,%esp
+    1019:	8b 31                	mov    (%ecx),%esi
+    101b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+    101e:	83 fe 01             	cmp    $0x1,%esi
+    1021:	7e 1f                	jle    1042 <main+0x42>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+    1028:	83 ec 0c             	sub    $0xc,%esp
+    102b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+    102e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+    1031:	e8 ca 00 00 00       	call   1100 <ls>
+  for(i=1; i<argc; i++)
+    1036:	83 c4 10             	add    $0x10,%esp
+    1039:	39 de                	cmp    %ebx,%esi
+    103b:	75 eb                	jne    1028 <main+0x28>
+  exit();
+    103d:	e8 de 05 00 00       	call   1620 <exit>
+    ls(".");
+    1042:	83 ec 0c             	sub    $0xc,%esp
+    1045:	68 90 25 00 00       	push   $0x2590
+    104a:	e8 b1 00 00 00       	call   1100 <ls>
+    exit();
+    104f:	e8 cc 05 00 00       	call   1620 <exit>
+    1054:	66 90                	xchg   %ax,%ax
+    1056:	66 90                	xchg   %ax,%ax
+    1058:	66 90                	xchg   %ax,%ax
+    105a:	66 90                	xchg   %ax,%ax
+    105c:	66 90                	xchg   %ax,%ax
+    105e:	66 90                	xchg   %ax,%ax
+
+00001060 <fmtname>:
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	56                   	push   %esi
+    1064:	53                   	push   %ebx
+    1065:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+    1068:	83 ec 0c             	sub    $0xc,%esp
+    106b:	56                   	push   %esi
+    106c:	e8 5f 03 00 00       	call   13d0 <strlen>
+    1071:	83 c4 10             	add    $0x10,%esp
+    1074:	01 f0                	add    %esi,%eax
+    1076:	89 c3                	mov    %eax,%ebx
+    1078:	73 0f                	jae    1089 <fmtname+0x29>
+    107a:	eb 12                	jmp    108e <fmtname+0x2e>
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1080:	8d 43 ff             	lea    -0x1(%ebx),%eax
+    1083:	39 f0                	cmp    %esi,%eax
+    1085:	72 0a                	jb     1091 <fmtname+0x31>
+    1087:	89 c3                	mov    %eax,%ebx
+    1089:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+    108c:	75 f2                	jne    1080 <fmtname+0x20>
+  p++;
+    108e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+    1091:	83 ec 0c             	sub    $0xc,%esp
+    1094:	53                   	push   %ebx
+    1095:	e8 36 03 00 00       	call   13d0 <strlen>
+    109a:	83 c4 10             	add    $0x10,%esp
+    109d:	83 f8 0d             	cmp    $0xd,%eax
+    10a0:	77 4a                	ja     10ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+    10a2:	83 ec 0c             	sub    $0xc,%esp
+    10a5:	53                   	push   %ebx
+    10a6:	e8 25 03 00 00       	call   13d0 <strlen>
+    10ab:	83 c4 0c             	add    $0xc,%esp
+    10ae:	50                   	push   %eax
+    10af:	53                   	push   %ebx
+    10b0:	68 80 2f 00 00       	push   $0x2f80
+    10b5:	e8 96 04 00 00       	call   1550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+    10ba:	89 1c 24             	mov    %ebx,(%esp)
+    10bd:	e8 0e 03 00 00       	call   13d0 <strlen>
+    10c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+    10c5:	bb 80 2f 00 00       	mov    $0x2f80,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+    10ca:	89 c6                	mov    %eax,%esi
+    10cc:	e8 ff 02 00 00       	call   13d0 <strlen>
+    10d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+    10d6:	83 c4 0c             	add    $0xc,%esp
+    10d9:	29 f2                	sub    %esi,%edx
+    10db:	05 80 2f 00 00       	add    $0x2f80,%eax
+    10e0:	52                   	push   %edx
+    10e1:	6a 20                	push   $0x20
+    10e3:	50                   	push   %eax
+    10e4:	e8 17 03 00 00       	call   1400 <memset>
+  return buf;
+    10e9:	83 c4 10             	add    $0x10,%esp
+}
+    10ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10ef:	89 d8                	mov    %ebx,%eax
+    10f1:	5b                   	pop    %ebx
+    10f2:	5e                   	pop    %esi
+    10f3:	5d                   	pop    %ebp
+    10f4:	c3                   	ret
+    10f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001100 <ls>:
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	56                   	push   %esi
+    1105:	53                   	push   %ebx
+    1106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+    110c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+    110f:	6a 00                	push   $0x0
+    1111:	57                   	push   %edi
+    1112:	e8 d4 05 00 00       	call   16eb <open>
+    1117:	83 c4 10             	add    $0x10,%esp
+    111a:	85 c0                	test   %eax,%eax
+    111c:	0f 88 9e 01 00 00    	js     12c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+    1122:	83 ec 08             	sub    $0x8,%esp
+    1125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+    112b:	89 c3                	mov    %eax,%ebx
+    112d:	56                   	push   %esi
+    112e:	50                   	push   %eax
+    112f:	e8 e4 05 00 00       	call   1718 <fstat>
+    1134:	83 c4 10             	add    $0x10,%esp
+    1137:	85 c0                	test   %eax,%eax
+    1139:	0f 88 c1 01 00 00    	js     1300 <ls+0x200>
+  switch(st.type){
+    113f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+    1146:	66 83 f8 01          	cmp    $0x1,%ax
+    114a:	74 64                	je     11b0 <ls+0xb0>
+    114c:	66 83 f8 02          	cmp    $0x2,%ax
+    1150:	74 1e                	je     1170 <ls+0x70>
+  close(fd);
+    1152:	83 ec 0c             	sub    $0xc,%esp
+    1155:	53                   	push   %ebx
+    1156:	e8 63 05 00 00       	call   16be <close>
+    115b:	83 c4 10             	add    $0x10,%esp
+}
+    115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1161:	5b                   	pop    %ebx
+    1162:	5e                   	pop    %esi
+    1163:	5f                   	pop    %edi
+    1164:	5d                   	pop    %ebp
+    1165:	c3                   	ret
+    1166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+    1170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+    1176:	83 ec 0c             	sub    $0xc,%esp
+    1179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+    117f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+    1185:	57                   	push   %edi
+    1186:	e8 d5 fe ff ff       	call   1060 <fmtname>
+    118b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+    1191:	59                   	pop    %ecx
+    1192:	5f                   	pop    %edi
+    1193:	52                   	push   %edx
+    1194:	56                   	push   %esi
+    1195:	6a 02                	push   $0x2
+    1197:	50                   	push   %eax
+    1198:	68 70 25 00 00       	push   $0x2570
+    119d:	6a 01                	push   $0x1
+    119f:	e8 ec 09 00 00       	call   1b90 <printf>
+    break;
+    11a4:	83 c4 20             	add    $0x20,%esp
+    11a7:	eb a9                	jmp    1152 <ls+0x52>
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+    11b0:	83 ec 0c             	sub    $0xc,%esp
+    11b3:	57                   	push   %edi
+    11b4:	e8 17 02 00 00       	call   13d0 <strlen>
+    11b9:	83 c4 10             	add    $0x10,%esp
+    11bc:	83 c0 10             	add    $0x10,%eax
+    11bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+    11c4:	0f 87 16 01 00 00    	ja     12e0 <ls+0x1e0>
+    strcpy(buf, path);
+    11ca:	83 ec 08             	sub    $0x8,%esp
+    11cd:	57                   	push   %edi
+    11ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+    11d4:	57                   	push   %edi
+    11d5:	e8 66 01 00 00       	call   1340 <strcpy>
+    p = buf+strlen(buf);
+    11da:	89 3c 24             	mov    %edi,(%esp)
+    11dd:	e8 ee 01 00 00       	call   13d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+    11e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+    11e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+    11e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+    11ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+    11f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+    11f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1200:	83 ec 04             	sub    $0x4,%esp
+    1203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+    1209:	6a 10                	push   $0x10
+    120b:	50                   	push   %eax
+    120c:	53                   	push   %ebx
+    120d:	e8 8e 04 00 00       	call   16a0 <read>
+    1212:	83 c4 10             	add    $0x10,%esp
+    1215:	83 f8 10             	cmp    $0x10,%eax
+    1218:	0f 85 34 ff ff ff    	jne    1152 <ls+0x52>
+      if(de.inum == 0)
+    121e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+    1225:	00 
+    1226:	74 d8                	je     1200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+    1228:	83 ec 04             	sub    $0x4,%esp
+    122b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+    1231:	6a 0e                	push   $0xe
+    1233:	50                   	push   %eax
+    1234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+    123a:	e8 11 03 00 00       	call   1550 <memmove>
+      p[DIRSIZ] = 0;
+    123f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+    1245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+    1249:	58                   	pop    %eax
+    124a:	5a                   	pop    %edx
+    124b:	56                   	push   %esi
+    124c:	57                   	push   %edi
+    124d:	e8 6e 02 00 00       	call   14c0 <stat>
+    1252:	83 c4 10             	add    $0x10,%esp
+    1255:	85 c0                	test   %eax,%eax
+    1257:	0f 88 cb 00 00 00    	js     1328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+    125d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+    1263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+    1269:	83 ec 0c             	sub    $0xc,%esp
+    126c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+    1273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+    1279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+    127f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+    1285:	57                   	push   %edi
+    1286:	e8 d5 fd ff ff       	call   1060 <fmtname>
+    128b:	5a                   	pop    %edx
+    128c:	59                   	pop    %ecx
+    128d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+    1293:	51                   	push   %ecx
+    1294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+    129a:	52                   	push   %edx
+    129b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+    12a1:	50                   	push   %eax
+    12a2:	68 70 25 00 00       	push   $0x2570
+    12a7:	6a 01                	push   $0x1
+    12a9:	e8 e2 08 00 00       	call   1b90 <printf>
+    12ae:	83 c4 20             	add    $0x20,%esp
+    12b1:	e9 4a ff ff ff       	jmp    1200 <ls+0x100>
+    12b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+    12c0:	83 ec 04             	sub    $0x4,%esp
+    12c3:	57                   	push   %edi
+    12c4:	68 48 25 00 00       	push   $0x2548
+    12c9:	6a 02                	push   $0x2
+    12cb:	e8 c0 08 00 00       	call   1b90 <printf>
+    return;
+    12d0:	83 c4 10             	add    $0x10,%esp
+}
+    12d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12d6:	5b                   	pop    %ebx
+    12d7:	5e                   	pop    %esi
+    12d8:	5f                   	pop    %edi
+    12d9:	5d                   	pop    %ebp
+    12da:	c3                   	ret
+    12db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12df:	90                   	nop
+      printf(1, "ls: path too long\n");
+    12e0:	83 ec 08             	sub    $0x8,%esp
+    12e3:	68 7d 25 00 00       	push   $0x257d
+    12e8:	6a 01                	push   $0x1
+    12ea:	e8 a1 08 00 00       	call   1b90 <printf>
+      break;
+    12ef:	83 c4 10             	add    $0x10,%esp
+    12f2:	e9 5b fe ff ff       	jmp    1152 <ls+0x52>
+    12f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+    1300:	83 ec 04             	sub    $0x4,%esp
+    1303:	57                   	push   %edi
+    1304:	68 5c 25 00 00       	push   $0x255c
+    1309:	6a 02                	push   $0x2
+    130b:	e8 80 08 00 00       	call   1b90 <printf>
+    close(fd);
+    1310:	89 1c 24             	mov    %ebx,(%esp)
+    1313:	e8 a6 03 00 00       	call   16be <close>
+    return;
+    1318:	83 c4 10             	add    $0x10,%esp
+}
+    131b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    131e:	5b                   	pop    %ebx
+    131f:	5e                   	pop    %esi
+    1320:	5f                   	pop    %edi
+    1321:	5d                   	pop    %ebp
+    1322:	c3                   	ret
+    1323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+    1328:	83 ec 04             	sub    $0x4,%esp
+    132b:	57                   	push   %edi
+    132c:	68 5c 25 00 00       	push   $0x255c
+    1331:	6a 01                	push   $0x1
+    1333:	e8 58 08 00 00       	call   1b90 <printf>
+        continue;
+    1338:	83 c4 10             	add    $0x10,%esp
+    133b:	e9 c0 fe ff ff       	jmp    1200 <ls+0x100>
+
+00001340 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1341:	31 c0                	xor    %eax,%eax
+{
+    1343:	89 e5                	mov    %esp,%ebp
+    1345:	53                   	push   %ebx
+    1346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    134c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1357:	83 c0 01             	add    $0x1,%eax
+    135a:	84 d2                	test   %dl,%dl
+    135c:	75 f2                	jne    1350 <strcpy+0x10>
+    ;
+  return os;
+}
+    135e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1361:	89 c8                	mov    %ecx,%eax
+    1363:	c9                   	leave
+    1364:	c3                   	ret
+    1365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	53                   	push   %ebx
+    1374:	8b 55 08             	mov    0x8(%ebp),%edx
+    1377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    137a:	0f b6 02             	movzbl (%edx),%eax
+    137d:	84 c0                	test   %al,%al
+    137f:	75 17                	jne    1398 <strcmp+0x28>
+    1381:	eb 3a                	jmp    13bd <strcmp+0x4d>
+    1383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1387:	90                   	nop
+    1388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    138c:	83 c2 01             	add    $0x1,%edx
+    138f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1392:	84 c0                	test   %al,%al
+    1394:	74 1a                	je     13b0 <strcmp+0x40>
+    p++, q++;
+    1396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1398:	0f b6 19             	movzbl (%ecx),%ebx
+    139b:	38 c3                	cmp    %al,%bl
+    139d:	74 e9                	je     1388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    139f:	29 d8                	sub    %ebx,%eax
+}
+    13a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13a4:	c9                   	leave
+    13a5:	c3                   	ret
+    13a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    13b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    13b4:	31 c0                	xor    %eax,%eax
+    13b6:	29 d8                	sub    %ebx,%eax
+}
+    13b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13bb:	c9                   	leave
+    13bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    13bd:	0f b6 19             	movzbl (%ecx),%ebx
+    13c0:	31 c0                	xor    %eax,%eax
+    13c2:	eb db                	jmp    139f <strcmp+0x2f>
+    13c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13cf:	90                   	nop
+
+000013d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    13d6:	80 3a 00             	cmpb   $0x0,(%edx)
+    13d9:	74 15                	je     13f0 <strlen+0x20>
+    13db:	31 c0                	xor    %eax,%eax
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+    13e0:	83 c0 01             	add    $0x1,%eax
+    13e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    13e7:	89 c1                	mov    %eax,%ecx
+    13e9:	75 f5                	jne    13e0 <strlen+0x10>
+    ;
+  return n;
+}
+    13eb:	89 c8                	mov    %ecx,%eax
+    13ed:	5d                   	pop    %ebp
+    13ee:	c3                   	ret
+    13ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+    13f0:	31 c9                	xor    %ecx,%ecx
+}
+    13f2:	5d                   	pop    %ebp
+    13f3:	89 c8                	mov    %ecx,%eax
+    13f5:	c3                   	ret
+    13f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	57                   	push   %edi
+    1404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    140a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    140d:	89 d7                	mov    %edx,%edi
+    140f:	fc                   	cld
+    1410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1415:	89 d0                	mov    %edx,%eax
+    1417:	c9                   	leave
+    1418:	c3                   	ret
+    1419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	8b 45 08             	mov    0x8(%ebp),%eax
+    1426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    142a:	0f b6 10             	movzbl (%eax),%edx
+    142d:	84 d2                	test   %dl,%dl
+    142f:	75 12                	jne    1443 <strchr+0x23>
+    1431:	eb 1d                	jmp    1450 <strchr+0x30>
+    1433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1437:	90                   	nop
+    1438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    143c:	83 c0 01             	add    $0x1,%eax
+    143f:	84 d2                	test   %dl,%dl
+    1441:	74 0d                	je     1450 <strchr+0x30>
+    if(*s == c)
+    1443:	38 d1                	cmp    %dl,%cl
+    1445:	75 f1                	jne    1438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1447:	5d                   	pop    %ebp
+    1448:	c3                   	ret
+    1449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1450:	31 c0                	xor    %eax,%eax
+}
+    1452:	5d                   	pop    %ebp
+    1453:	c3                   	ret
+    1454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    145f:	90                   	nop
+
+00001460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1469:	31 db                	xor    %ebx,%ebx
+{
+    146b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    146e:	eb 27                	jmp    1497 <gets+0x37>
+    cc = read(0, &c, 1);
+    1470:	83 ec 04             	sub    $0x4,%esp
+    1473:	6a 01                	push   $0x1
+    1475:	56                   	push   %esi
+    1476:	6a 00                	push   $0x0
+    1478:	e8 23 02 00 00       	call   16a0 <read>
+    if(cc < 1)
+    147d:	83 c4 10             	add    $0x10,%esp
+    1480:	85 c0                	test   %eax,%eax
+    1482:	7e 1d                	jle    14a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1488:	8b 55 08             	mov    0x8(%ebp),%edx
+    148b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    148f:	3c 0a                	cmp    $0xa,%al
+    1491:	74 10                	je     14a3 <gets+0x43>
+    1493:	3c 0d                	cmp    $0xd,%al
+    1495:	74 0c                	je     14a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1497:	89 df                	mov    %ebx,%edi
+    1499:	83 c3 01             	add    $0x1,%ebx
+    149c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    149f:	7c cf                	jl     1470 <gets+0x10>
+    14a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    14a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    14a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    14aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14ad:	5b                   	pop    %ebx
+    14ae:	5e                   	pop    %esi
+    14af:	5f                   	pop    %edi
+    14b0:	5d                   	pop    %ebp
+    14b1:	c3                   	ret
+    14b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000014c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	56                   	push   %esi
+    14c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    14c5:	83 ec 08             	sub    $0x8,%esp
+    14c8:	6a 00                	push   $0x0
+    14ca:	ff 75 08             	push   0x8(%ebp)
+    14cd:	e8 19 02 00 00       	call   16eb <open>
+  if(fd < 0)
+    14d2:	83 c4 10             	add    $0x10,%esp
+    14d5:	85 c0                	test   %eax,%eax
+    14d7:	78 27                	js     1500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    14d9:	83 ec 08             	sub    $0x8,%esp
+    14dc:	ff 75 0c             	push   0xc(%ebp)
+    14df:	89 c3                	mov    %eax,%ebx
+    14e1:	50                   	push   %eax
+    14e2:	e8 31 02 00 00       	call   1718 <fstat>
+  close(fd);
+    14e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    14ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+    14ec:	e8 cd 01 00 00       	call   16be <close>
+  return r;
+    14f1:	83 c4 10             	add    $0x10,%esp
+}
+    14f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14f7:	89 f0                	mov    %esi,%eax
+    14f9:	5b                   	pop    %ebx
+    14fa:	5e                   	pop    %esi
+    14fb:	5d                   	pop    %ebp
+    14fc:	c3                   	ret
+    14fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1505:	eb ed                	jmp    14f4 <stat+0x34>
+    1507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150e:	66 90                	xchg   %ax,%ax
+
+00001510 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	53                   	push   %ebx
+    1514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1517:	0f be 02             	movsbl (%edx),%eax
+    151a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    151d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1525:	77 1e                	ja     1545 <atoi+0x35>
+    1527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1530:	83 c2 01             	add    $0x1,%edx
+    1533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    153a:	0f be 02             	movsbl (%edx),%eax
+    153d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1540:	80 fb 09             	cmp    $0x9,%bl
+    1543:	76 eb                	jbe    1530 <atoi+0x20>
+  return n;
+}
+    1545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1548:	89 c8                	mov    %ecx,%eax
+    154a:	c9                   	leave
+    154b:	c3                   	ret
+    154c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1550:	55                   	push   %ebp
+    1551:	89 e5                	mov    %esp,%ebp
+    1553:	57                   	push   %edi
+    1554:	56                   	push   %esi
+    1555:	8b 45 10             	mov    0x10(%ebp),%eax
+    1558:	8b 55 08             	mov    0x8(%ebp),%edx
+    155b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    155e:	85 c0                	test   %eax,%eax
+    1560:	7e 13                	jle    1575 <memmove+0x25>
+    1562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1564:	89 d7                	mov    %edx,%edi
+    1566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1571:	39 f8                	cmp    %edi,%eax
+    1573:	75 fb                	jne    1570 <memmove+0x20>
+  return vdst;
+}
+    1575:	5e                   	pop    %esi
+    1576:	89 d0                	mov    %edx,%eax
+    1578:	5f                   	pop    %edi
+    1579:	5d                   	pop    %ebp
+    157a:	c3                   	ret
+    157b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    157f:	90                   	nop
+
+00001580 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1580:	55                   	push   %ebp
+    1581:	89 e5                	mov    %esp,%ebp
+    1583:	56                   	push   %esi
+    1584:	53                   	push   %ebx
+    1585:	8b 75 10             	mov    0x10(%ebp),%esi
+    1588:	8b 55 08             	mov    0x8(%ebp),%edx
+    158b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    158e:	85 f6                	test   %esi,%esi
+    1590:	74 2e                	je     15c0 <memcmp+0x40>
+    1592:	01 c6                	add    %eax,%esi
+    1594:	eb 14                	jmp    15aa <memcmp+0x2a>
+    1596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    15a0:	83 c0 01             	add    $0x1,%eax
+    15a3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    15a6:	39 f0                	cmp    %esi,%eax
+    15a8:	74 16                	je     15c0 <memcmp+0x40>
+    if(*s1 != *s2)
+    15aa:	0f b6 0a             	movzbl (%edx),%ecx
+    15ad:	0f b6 18             	movzbl (%eax),%ebx
+    15b0:	38 d9                	cmp    %bl,%cl
+    15b2:	74 ec                	je     15a0 <memcmp+0x20>
+      return *s1 - *s2;
+    15b4:	0f b6 c1             	movzbl %cl,%eax
+    15b7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    15b9:	5b                   	pop    %ebx
+    15ba:	5e                   	pop    %esi
+    15bb:	5d                   	pop    %ebp
+    15bc:	c3                   	ret
+    15bd:	8d 76 00             	lea    0x0(%esi),%esi
+    15c0:	5b                   	pop    %ebx
+  return 0;
+    15c1:	31 c0                	xor    %eax,%eax
+}
+    15c3:	5e                   	pop    %esi
+    15c4:	5d                   	pop    %ebp
+    15c5:	c3                   	ret
+    15c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000015d0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    15d0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    15d5:	c3                   	ret
+    15d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000015e0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    15e0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    15e5:	c3                   	ret
+    15e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000015f0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    15f0:	a1 90 2f 00 00       	mov    0x2f90,%eax
+    15f5:	85 c0                	test   %eax,%eax
+    15f7:	74 17                	je     1610 <fork+0x20>
+{
+    15f9:	55                   	push   %ebp
+    15fa:	89 e5                	mov    %esp,%ebp
+    15fc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    15ff:	ff d0                	call   *%eax
+  return _fork();
+}
+    1601:	c9                   	leave
+  return _fork();
+    1602:	e9 5d 00 00 00       	jmp    1664 <_fork>
+    1607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    160e:	66 90                	xchg   %ax,%ax
+    1610:	e9 4f 00 00 00       	jmp    1664 <_fork>
+    1615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    161c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001620 <exit>:
+
+int
+exit(void)
+{
+    1620:	55                   	push   %ebp
+    1621:	89 e5                	mov    %esp,%ebp
+    1623:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1626:	a1 90 2f 00 00       	mov    0x2f90,%eax
+    162b:	85 c0                	test   %eax,%eax
+    162d:	74 02                	je     1631 <exit+0x11>
+    flushhook();
+    162f:	ff d0                	call   *%eax
+  _exit();
+    1631:	e8 3d 00 00 00       	call   1673 <_exit>
+    1636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001640 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1640:	55                   	push   %ebp
+  if(flushhook)
+    1641:	a1 90 2f 00 00       	mov    0x2f90,%eax
+{
+    1646:	89 e5                	mov    %esp,%ebp
+    1648:	56                   	push   %esi
+    1649:	53                   	push   %ebx
+    164a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    164d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1650:	85 c0                	test   %eax,%eax
+    1652:	74 02                	je     1656 <exec+0x16>
+    flushhook();
+    1654:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1656:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1659:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    165c:	5b                   	pop    %ebx
+    165d:	5e                   	pop    %esi
+    165e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    165f:	e9 78 00 00 00       	jmp    16dc <_exec>
+
+00001664 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1664:	b8 01 00 00 00       	mov    $0x1,%eax
+    1669:	89 e1                	mov    %esp,%ecx
+    166b:	ba 72 16 00 00       	mov    $0x1672,%edx
+    1670:	0f 34                	sysenter
+    1672:	c3                   	ret
+
+00001673 <_exit>:
+RAWSYSCALL(exit)
+    1673:	b8 02 00 00 00       	mov    $0x2,%eax
+    1678:	89 e1                	mov    %esp,%ecx
+    167a:	ba 81 16 00 00       	mov    $0x1681,%edx
+    167f:	0f 34                	sysenter
+    1681:	c3                   	ret
+
+00001682 <wait>:
+SYSCALL(wait)
+    1682:	b8 03 00 00 00       	mov    $0x3,%eax
+    1687:	89 e1                	mov    %esp,%ecx
+    1689:	ba 90 16 00 00       	mov    $0x1690,%edx
+    168e:	0f 34                	sysenter
+    1690:	c3                   	ret
+
+00001691 <pipe>:
+SYSCALL(pipe)
+    1691:	b8 04 00 00 00       	mov    $0x4,%eax
+    1696:	89 e1                	mov    %esp,%ecx
+    1698:	ba 9f 16 00 00       	mov    $0x169f,%edx
+    169d:	0f 34                	sysenter
+    169f:	c3                   	ret
+
+000016a0 <read>:
+SYSCALL(read)
+    16a0:	b8 05 00 00 00       	mov    $0x5,%eax
+    16a5:	89 e1                	mov    %esp,%ecx
+    16a7:	ba ae 16 00 00       	mov    $0x16ae,%edx
+    16ac:	0f 34                	sysenter
+    16ae:	c3                   	ret
+
+000016af <write>:
+SYSCALL(write)
+    16af:	b8 10 00 00 00       	mov    $0x10,%eax
+    16b4:	89 e1                	mov    %esp,%ecx
+    16b6:	ba bd 16 00 00       	mov    $0x16bd,%edx
+    16bb:	0f 34                	sysenter
+    16bd:	c3                   	ret
+
+000016be <close>:
+SYSCALL(close)
+    16be:	b8 15 00 00 00       	mov    $0x15,%eax
+    16c3:	89 e1                	mov    %esp,%ecx
+    16c5:	ba cc 16 00 00       	mov    $0x16cc,%edx
+    16ca:	0f 34                	sysenter
+    16cc:	c3                   	ret
+
+000016cd <kill>:
+SYSCALL(kill)
+    16cd:	b8 06 00 00 00       	mov    $0x6,%eax
+    16d2:	89 e1                	mov    %esp,%ecx
+    16d4:	ba db 16 00 00       	mov    $0x16db,%edx
+    16d9:	0f 34                	sysenter
+    16db:	c3                   	ret
+
+000016dc <_exec>:
+RAWSYSCALL(exec)
+    16dc:	b8 07 00 00 00       	mov    $0x7,%eax
+    16e1:	89 e1                	mov    %esp,%ecx
+    16e3:	ba ea 16 00 00       	mov    $0x16ea,%edx
+    16e8:	0f 34                	sysenter
+    16ea:	c3                   	ret
+
+000016eb <open>:
+SYSCALL(open)
+    16eb:	b8 0f 00 00 00       	mov    $0xf,%eax
+    16f0:	89 e1                	mov    %esp,%ecx
+    16f2:	ba f9 16 00 00       	mov    $0x16f9,%edx
+    16f7:	0f 34                	sysenter
+    16f9:	c3                   	ret
+
+000016fa <mknod>:
+SYSCALL(mknod)
+    16fa:	b8 11 00 00 00       	mov    $0x11,%eax
+    16ff:	89 e1                	mov    %esp,%ecx
+    1701:	ba 08 17 00 00       	mov    $0x1708,%edx
+    1706:	0f 34                	sysenter
+    1708:	c3                   	ret
+
+00001709 <unlink>:
+SYSCALL(unlink)
+    1709:	b8 12 00 00 00       	mov    $0x12,%eax
+    170e:	89 e1                	mov    %esp,%ecx
+    1710:	ba 17 17 00 00       	mov    $0x1717,%edx
+    1715:	0f 34                	sysenter
+    1717:	c3                   	ret
+
+00001718 <fstat>:
+SYSCALL(fstat)
+    1718:	b8 08 00 00 00       	mov    $0x8,%eax
+    171d:	89 e1                	mov    %esp,%ecx
+    171f:	ba 26 17 00 00       	mov    $0x1726,%edx
+    1724:	0f 34                	sysenter
+    1726:	c3                   	ret
+
+00001727 <link>:
+SYSCALL(link)
+    1727:	b8 13 00 00 00       	mov    $0x13,%eax
+    172c:	89 e1                	mov    %esp,%ecx
+    172e:	ba 35 17 00 00       	mov    $0x1735,%edx
+    1733:	0f 34                	sysenter
+    1735:	c3                   	ret
+
+00001736 <mkdir>:
+SYSCALL(mkdir)
+    1736:	b8 14 00 00 00       	mov    $0x14,%eax
+    173b:	89 e1                	mov    %esp,%ecx
+    173d:	ba 44 17 00 00       	mov    $0x1744,%edx
+    1742:	0f 34                	sysenter
+    1744:	c3                   	ret
+
+00001745 <chdir>:
+SYSCALL(chdir)
+    1745:	b8 09 00 00 00       	mov    $0x9,%eax
+    174a:	89 e1                	mov    %esp,%ecx
+    174c:	ba 53 17 00 00       	mov    $0x1753,%edx
+    1751:	0f 34                	sysenter
+    1753:	c3                   	ret
+
+00001754 <dup>:
+SYSCALL(dup)
+    1754:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1759:	89 e1                	mov    %esp,%ecx
+    175b:	ba 62 17 00 00       	mov    $0x1762,%edx
+    1760:	0f 34                	sysenter
+    1762:	c3                   	ret
+
+00001763 <getpid>:
+SYSCALL(getpid)
+    1763:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1768:	89 e1                	mov    %esp,%ecx
+    176a:	ba 71 17 00 00       	mov    $0x1771,%edx
+    176f:	0f 34                	sysenter
+    1771:	c3                   	ret
+
+00001772 <sbrk>:
+SYSCALL(sbrk)
+    1772:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1777:	89 e1                	mov    %esp,%ecx
+    1779:	ba 80 17 00 00       	mov    $0x1780,%edx
+    177e:	0f 34                	sysenter
+    1780:	c3                   	ret
+
+00001781 <sleep>:
+SYSCALL(sleep)
+    1781:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1786:	89 e1                	mov    %esp,%ecx
+    1788:	ba 8f 17 00 00       	mov    $0x178f,%edx
+    178d:	0f 34                	sysenter
+    178f:	c3                   	ret
+
+00001790 <uptime>:
+SYSCALL(uptime)
+    1790:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1795:	89 e1                	mov    %esp,%ecx
+    1797:	ba 9e 17 00 00       	mov    $0x179e,%edx
+    179c:	0f 34                	sysenter
+    179e:	c3                   	ret
+
+0000179f <mprotect>:
+SYSCALL(mprotect)
+    179f:	b8 16 00 00 00       	mov    $0x16,%eax
+    17a4:	89 e1                	mov    %esp,%ecx
+    17a6:	ba ad 17 00 00       	mov    $0x17ad,%edx
+    17ab:	0f 34                	sysenter
+    17ad:	c3                   	ret
+
+000017ae <munprotect>:
+SYSCALL(munprotect)
+    17ae:	b8 17 00 00 00       	mov    $0x17,%eax
+    17b3:	89 e1                	mov    %esp,%ecx
+    17b5:	ba bc 17 00 00       	mov    $0x17bc,%edx
+    17ba:	0f 34                	sysenter
+    17bc:	c3                   	ret
+
+000017bd <kstat>:
+SYSCALL(kstat)
+    17bd:	b8 18 00 00 00       	mov    $0x18,%eax
+    17c2:	89 e1                	mov    %esp,%ecx
+    17c4:	ba cb 17 00 00       	mov    $0x17cb,%edx
+    17c9:	0f 34                	sysenter
+    17cb:	c3                   	ret
+
+000017cc <fcntl>:
+SYSCALL(fcntl)
+    17cc:	b8 19 00 00 00       	mov    $0x19,%eax
+    17d1:	89 e1                	mov    %esp,%ecx
+    17d3:	ba da 17 00 00       	mov    $0x17da,%edx
+    17d8:	0f 34                	sysenter
+    17da:	c3                   	ret
+
+000017db <splice>:
+SYSCALL(splice)
+    17db:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    17e0:	89 e1                	mov    %esp,%ecx
+    17e2:	ba e9 17 00 00       	mov    $0x17e9,%edx
+    17e7:	0f 34                	sysenter
+    17e9:	c3                   	ret
+
+000017ea <sendfile>:
+SYSCALL(sendfile)
+    17ea:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    17ef:	89 e1                	mov    %esp,%ecx
+    17f1:	ba f8 17 00 00       	mov    $0x17f8,%edx
+    17f6:	0f 34                	sysenter
+    17f8:	c3                   	ret
+
+000017f9 <lseek>:
+SYSCALL(lseek)
+    17f9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    17fe:	89 e1                	mov    %esp,%ecx
+    1800:	ba 07 18 00 00       	mov    $0x1807,%edx
+    1805:	0f 34                	sysenter
+    1807:	c3                   	ret
+
+00001808 <pread>:
+SYSCALL(pread)
+    1808:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    180d:	89 e1                	mov    %esp,%ecx
+    180f:	ba 16 18 00 00       	mov    $0x1816,%edx
+    1814:	0f 34                	sysenter
+    1816:	c3                   	ret
+
+00001817 <pwrite>:
+SYSCALL(pwrite)
+    1817:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    181c:	89 e1                	mov    %esp,%ecx
+    181e:	ba 25 18 00 00       	mov    $0x1825,%edx
+    1823:	0f 34                	sysenter
+    1825:	c3                   	ret
+
+00001826 <readv>:
+SYSCALL(readv)
+    1826:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    182b:	89 e1                	mov    %esp,%ecx
+    182d:	ba 34 18 00 00       	mov    $0x1834,%edx
+    1832:	0f 34                	sysenter
+    1834:	c3                   	ret
+
+00001835 <writev>:
+SYSCALL(writev)
+    1835:	b8 20 00 00 00       	mov    $0x20,%eax
+    183a:	89 e1                	mov    %esp,%ecx
+    183c:	ba 43 18 00 00       	mov    $0x1843,%edx
+    1841:	0f 34                	sysenter
+    1843:	c3                   	ret
+
+00001844 <ringsetup>:
+SYSCALL(ringsetup)
+    1844:	b8 21 00 00 00       	mov    $0x21,%eax
+    1849:	89 e1                	mov    %esp,%ecx
+    184b:	ba 52 18 00 00       	mov    $0x1852,%edx
+    1850:	0f 34                	sysenter
+    1852:	c3                   	ret
+
+00001853 <ringenter>:
+SYSCALL(ringenter)
+    1853:	b8 22 00 00 00       	mov    $0x22,%eax
+    1858:	89 e1                	mov    %esp,%ecx
+    185a:	ba 61 18 00 00       	mov    $0x1861,%edx
+    185f:	0f 34                	sysenter
+    1861:	c3                   	ret
+
+00001862 <intgetpid>:
+INTSYSCALL(getpid)
+    1862:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1867:	cd 40                	int    $0x40
+    1869:	c3                   	ret
+    186a:	66 90                	xchg   %ax,%ax
+    186c:	66 90                	xchg   %ax,%ax
+    186e:	66 90                	xchg   %ax,%ax
+
+00001870 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1870:	55                   	push   %ebp
+    1871:	89 e5                	mov    %esp,%ebp
+    1873:	57                   	push   %edi
+    1874:	56                   	push   %esi
+    1875:	53                   	push   %ebx
+    1876:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1878:	89 d1                	mov    %edx,%ecx
+{
+    187a:	83 ec 2c             	sub    $0x2c,%esp
+    187d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1880:	85 d2                	test   %edx,%edx
+    1882:	0f 89 c0 00 00 00    	jns    1948 <printint+0xd8>
+    1888:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    188c:	0f 84 b6 00 00 00    	je     1948 <printint+0xd8>
+    x = -xx;
+    1892:	f7 d9                	neg    %ecx
+    neg = 1;
+    1894:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1899:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    189c:	31 f6                	xor    %esi,%esi
+    189e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    18a0:	89 c8                	mov    %ecx,%eax
+    18a2:	31 d2                	xor    %edx,%edx
+    18a4:	89 f7                	mov    %esi,%edi
+    18a6:	f7 f3                	div    %ebx
+    18a8:	8d 76 01             	lea    0x1(%esi),%esi
+    18ab:	0f b6 92 f4 25 00 00 	movzbl 0x25f4(%edx),%edx
+    18b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    18b6:	89 ca                	mov    %ecx,%edx
+    18b8:	89 c1                	mov    %eax,%ecx
+    18ba:	39 da                	cmp    %ebx,%edx
+    18bc:	73 e2                	jae    18a0 <printint+0x30>
+  if(neg)
+    18be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    18c1:	85 c0                	test   %eax,%eax
+    18c3:	74 07                	je     18cc <printint+0x5c>
+    buf[i++] = '-';
+    18c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    18ca:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    18cc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    18cf:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    18d2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    18d4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    18d7:	8b 41 08             	mov    0x8(%ecx),%eax
+    18da:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    18dd:	89 ce                	mov    %ecx,%esi
+    18df:	eb 1c                	jmp    18fd <printint+0x8d>
+    18e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    18e8:	89 c1                	mov    %eax,%ecx
+    18ea:	83 c0 01             	add    $0x1,%eax
+    18ed:	89 46 08             	mov    %eax,0x8(%esi)
+    18f0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    18f4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    18f7:	39 df                	cmp    %ebx,%edi
+    18f9:	74 41                	je     193c <printint+0xcc>
+    18fb:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    18fd:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1900:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1905:	75 e1                	jne    18e8 <printint+0x78>
+  if(o->f)
+    1907:	8b 06                	mov    (%esi),%eax
+    1909:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    190c:	85 c0                	test   %eax,%eax
+    190e:	74 40                	je     1950 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1910:	50                   	push   %eax
+    1911:	68 80 00 00 00       	push   $0x80
+    1916:	6a 01                	push   $0x1
+    1918:	ff 75 d4             	push   -0x2c(%ebp)
+    191b:	e8 a0 04 00 00       	call   1dc0 <fwrite>
+    1920:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1924:	83 c4 10             	add    $0x10,%esp
+}
+    1927:	b8 01 00 00 00       	mov    $0x1,%eax
+    192c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    192e:	89 46 08             	mov    %eax,0x8(%esi)
+    1931:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1935:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1938:	39 df                	cmp    %ebx,%edi
+    193a:	75 bf                	jne    18fb <printint+0x8b>
+}
+    193c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    193f:	5b                   	pop    %ebx
+    1940:	5e                   	pop    %esi
+    1941:	5f                   	pop    %edi
+    1942:	5d                   	pop    %ebp
+    1943:	c3                   	ret
+    1944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1948:	31 c0                	xor    %eax,%eax
+    194a:	e9 4a ff ff ff       	jmp    1899 <printint+0x29>
+    194f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1950:	83 ec 04             	sub    $0x4,%esp
+    1953:	68 80 00 00 00       	push   $0x80
+    1958:	ff 75 d4             	push   -0x2c(%ebp)
+    195b:	ff 76 04             	push   0x4(%esi)
+    195e:	e8 4c fd ff ff       	call   16af <write>
+    1963:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1967:	83 c4 10             	add    $0x10,%esp
+    196a:	eb bb                	jmp    1927 <printint+0xb7>
+    196c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001970 <putc>:
+{
+    1970:	55                   	push   %ebp
+    1971:	89 e5                	mov    %esp,%ebp
+    1973:	56                   	push   %esi
+    1974:	89 d6                	mov    %edx,%esi
+    1976:	53                   	push   %ebx
+    1977:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1979:	8b 40 08             	mov    0x8(%eax),%eax
+    197c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1981:	74 1d                	je     19a0 <putc+0x30>
+  o->buf[o->n++] = c;
+    1983:	89 f1                	mov    %esi,%ecx
+    1985:	8d 50 01             	lea    0x1(%eax),%edx
+    1988:	89 53 08             	mov    %edx,0x8(%ebx)
+    198b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    198f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1992:	5b                   	pop    %ebx
+    1993:	5e                   	pop    %esi
+    1994:	5d                   	pop    %ebp
+    1995:	c3                   	ret
+    1996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    199d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    19a0:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    19a2:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    19a5:	85 c0                	test   %eax,%eax
+    19a7:	74 2f                	je     19d8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    19a9:	50                   	push   %eax
+    19aa:	68 80 00 00 00       	push   $0x80
+    19af:	6a 01                	push   $0x1
+    19b1:	52                   	push   %edx
+    19b2:	e8 09 04 00 00       	call   1dc0 <fwrite>
+    19b7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    19ba:	89 f1                	mov    %esi,%ecx
+}
+    19bc:	ba 01 00 00 00       	mov    $0x1,%edx
+    19c1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    19c3:	89 53 08             	mov    %edx,0x8(%ebx)
+    19c6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    19ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    19cd:	5b                   	pop    %ebx
+    19ce:	5e                   	pop    %esi
+    19cf:	5d                   	pop    %ebp
+    19d0:	c3                   	ret
+    19d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    19d8:	83 ec 04             	sub    $0x4,%esp
+    19db:	68 80 00 00 00       	push   $0x80
+    19e0:	52                   	push   %edx
+    19e1:	ff 73 04             	push   0x4(%ebx)
+    19e4:	e8 c6 fc ff ff       	call   16af <write>
+    19e9:	83 c4 10             	add    $0x10,%esp
+    19ec:	eb cc                	jmp    19ba <putc+0x4a>
+    19ee:	66 90                	xchg   %ax,%ax
+
+000019f0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    19f0:	55                   	push   %ebp
+    19f1:	89 e5                	mov    %esp,%ebp
+    19f3:	57                   	push   %edi
+    19f4:	89 c7                	mov    %eax,%edi
+    19f6:	56                   	push   %esi
+    19f7:	31 f6                	xor    %esi,%esi
+    19f9:	53                   	push   %ebx
+    19fa:	8d 5a 01             	lea    0x1(%edx),%ebx
+    19fd:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1a00:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1a03:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1a06:	84 c0                	test   %al,%al
+    1a08:	75 1e                	jne    1a28 <vprintf.constprop.0+0x38>
+    1a0a:	eb 53                	jmp    1a5f <vprintf.constprop.0+0x6f>
+    1a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1a10:	83 f8 25             	cmp    $0x25,%eax
+    1a13:	74 3b                	je     1a50 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1a15:	89 ca                	mov    %ecx,%edx
+    1a17:	89 f8                	mov    %edi,%eax
+    1a19:	e8 52 ff ff ff       	call   1970 <putc>
+  for(i = 0; fmt[i]; i++){
+    1a1e:	0f b6 03             	movzbl (%ebx),%eax
+    1a21:	83 c3 01             	add    $0x1,%ebx
+    1a24:	84 c0                	test   %al,%al
+    1a26:	74 37                	je     1a5f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1a28:	0f be c8             	movsbl %al,%ecx
+    1a2b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    1a2e:	85 f6                	test   %esi,%esi
+    1a30:	74 de                	je     1a10 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1a32:	83 fe 25             	cmp    $0x25,%esi
+    1a35:	75 e7                	jne    1a1e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1a37:	83 f8 25             	cmp    $0x25,%eax
+    1a3a:	74 4e                	je     1a8a <vprintf.constprop.0+0x9a>
+    1a3c:	83 e8 63             	sub    $0x63,%eax
+    1a3f:	83 f8 15             	cmp    $0x15,%eax
+    1a42:	77 34                	ja     1a78 <vprintf.constprop.0+0x88>
+    1a44:	ff 24 85 9c 25 00 00 	jmp    *0x259c(,%eax,4)
+    1a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a4f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1a50:	0f b6 03             	movzbl (%ebx),%eax
+    1a53:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1a56:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    1a5b:	84 c0                	test   %al,%al
+    1a5d:	75 c9                	jne    1a28 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    1a5f:	8b 47 08             	mov    0x8(%edi),%eax
+    1a62:	85 c0                	test   %eax,%eax
+    1a64:	0f 8f de 00 00 00    	jg     1b48 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    1a6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a6d:	5b                   	pop    %ebx
+    1a6e:	5e                   	pop    %esi
+    1a6f:	5f                   	pop    %edi
+    1a70:	5d                   	pop    %ebp
+    1a71:	c3                   	ret
+    1a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1a78:	ba 25 00 00 00       	mov    $0x25,%edx
+    1a7d:	89 f8                	mov    %edi,%eax
+    1a7f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1a82:	e8 e9 fe ff ff       	call   1970 <putc>
+        putc(o, c);
+    1a87:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1a8a:	89 ca                	mov    %ecx,%edx
+    1a8c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    1a8e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1a90:	e8 db fe ff ff       	call   1970 <putc>
+    1a95:	eb 87                	jmp    1a1e <vprintf.constprop.0+0x2e>
+    1a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a9e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1aa0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1aa3:	83 ec 0c             	sub    $0xc,%esp
+    1aa6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1aab:	8b 16                	mov    (%esi),%edx
+    1aad:	6a 00                	push   $0x0
+        ap++;
+    1aaf:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1ab2:	89 f8                	mov    %edi,%eax
+    1ab4:	e8 b7 fd ff ff       	call   1870 <printint>
+        ap++;
+    1ab9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    1abc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1abf:	31 f6                	xor    %esi,%esi
+    1ac1:	e9 58 ff ff ff       	jmp    1a1e <vprintf.constprop.0+0x2e>
+    1ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1acd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1ad0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1ad3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1ad5:	83 c0 04             	add    $0x4,%eax
+    1ad8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    1adb:	85 f6                	test   %esi,%esi
+    1add:	75 1b                	jne    1afa <vprintf.constprop.0+0x10a>
+    1adf:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1ae4:	be 92 25 00 00       	mov    $0x2592,%esi
+    1ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1af0:	89 f8                	mov    %edi,%eax
+          s++;
+    1af2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1af5:	e8 76 fe ff ff       	call   1970 <putc>
+        while(*s != 0){
+    1afa:	0f be 16             	movsbl (%esi),%edx
+    1afd:	84 d2                	test   %dl,%dl
+    1aff:	75 ef                	jne    1af0 <vprintf.constprop.0+0x100>
+      state = 0;
+    1b01:	31 f6                	xor    %esi,%esi
+    1b03:	e9 16 ff ff ff       	jmp    1a1e <vprintf.constprop.0+0x2e>
+    1b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b0f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1b10:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b13:	83 ec 0c             	sub    $0xc,%esp
+    1b16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1b1b:	8b 16                	mov    (%esi),%edx
+    1b1d:	6a 01                	push   $0x1
+    1b1f:	eb 8e                	jmp    1aaf <vprintf.constprop.0+0xbf>
+    1b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1b28:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1b2b:	89 f8                	mov    %edi,%eax
+    1b2d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1b30:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1b33:	e8 38 fe ff ff       	call   1970 <putc>
+        ap++;
+    1b38:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    1b3b:	31 f6                	xor    %esi,%esi
+    1b3d:	e9 dc fe ff ff       	jmp    1a1e <vprintf.constprop.0+0x2e>
+    1b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1b48:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    1b4a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    1b4d:	85 d2                	test   %edx,%edx
+    1b4f:	74 1f                	je     1b70 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1b51:	52                   	push   %edx
+    1b52:	50                   	push   %eax
+    1b53:	6a 01                	push   $0x1
+    1b55:	51                   	push   %ecx
+    1b56:	e8 65 02 00 00       	call   1dc0 <fwrite>
+    1b5b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1b5e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1b65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b68:	5b                   	pop    %ebx
+    1b69:	5e                   	pop    %esi
+    1b6a:	5f                   	pop    %edi
+    1b6b:	5d                   	pop    %ebp
+    1b6c:	c3                   	ret
+    1b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1b70:	83 ec 04             	sub    $0x4,%esp
+    1b73:	50                   	push   %eax
+    1b74:	51                   	push   %ecx
+    1b75:	ff 77 04             	push   0x4(%edi)
+    1b78:	e8 32 fb ff ff       	call   16af <write>
+    1b7d:	83 c4 10             	add    $0x10,%esp
+    1b80:	eb dc                	jmp    1b5e <vprintf.constprop.0+0x16e>
+    1b82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b90 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1b90:	55                   	push   %ebp
+    1b91:	89 e5                	mov    %esp,%ebp
+    1b93:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1b99:	a1 24 2d 00 00       	mov    0x2d24,%eax
+{
+    1b9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1ba1:	83 fa 01             	cmp    $0x1,%edx
+    1ba4:	74 0c                	je     1bb2 <printf+0x22>
+    1ba6:	31 c0                	xor    %eax,%eax
+    1ba8:	83 fa 02             	cmp    $0x2,%edx
+    1bab:	0f 44 05 20 2d 00 00 	cmove  0x2d20,%eax
+  o.fd = fd;
+    1bb2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1bb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1bbb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1bbe:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1bc4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1bca:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1bd1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1bd4:	e8 17 fe ff ff       	call   19f0 <vprintf.constprop.0>
+}
+    1bd9:	c9                   	leave
+    1bda:	c3                   	ret
+    1bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bdf:	90                   	nop
+
+00001be0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1be0:	55                   	push   %ebp
+    1be1:	89 e5                	mov    %esp,%ebp
+    1be3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1be9:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1bec:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1bef:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1bf2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1bf9:	ff ff ff 
+  o.n = 0;
+    1bfc:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1c03:	00 00 00 
+  o.f = f;
+    1c06:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1c0c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1c12:	e8 d9 fd ff ff       	call   19f0 <vprintf.constprop.0>
+}
+    1c17:	c9                   	leave
+    1c18:	c3                   	ret
+    1c19:	66 90                	xchg   %ax,%ax
+    1c1b:	66 90                	xchg   %ax,%ax
+    1c1d:	66 90                	xchg   %ax,%ax
+    1c1f:	90                   	nop
+
+00001c20 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1c20:	55                   	push   %ebp
+    1c21:	89 e5                	mov    %esp,%ebp
+    1c23:	53                   	push   %ebx
+    1c24:	89 c3                	mov    %eax,%ebx
+    1c26:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1c29:	8b 40 0c             	mov    0xc(%eax),%eax
+    1c2c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c2f:	74 17                	je     1c48 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1c31:	83 f8 02             	cmp    $0x2,%eax
+    1c34:	74 07                	je     1c3d <setmode+0x1d>
+    1c36:	8b 43 18             	mov    0x18(%ebx),%eax
+    1c39:	85 c0                	test   %eax,%eax
+    1c3b:	74 38                	je     1c75 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1c3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c40:	c9                   	leave
+    1c41:	c3                   	ret
+    1c42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1c48:	83 ec 08             	sub    $0x8,%esp
+    1c4b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1c4e:	50                   	push   %eax
+    1c4f:	ff 33                	push   (%ebx)
+    1c51:	e8 c2 fa ff ff       	call   1718 <fstat>
+    1c56:	83 c4 10             	add    $0x10,%esp
+    1c59:	89 c2                	mov    %eax,%edx
+    1c5b:	31 c0                	xor    %eax,%eax
+    1c5d:	85 d2                	test   %edx,%edx
+    1c5f:	75 0a                	jne    1c6b <setmode+0x4b>
+    1c61:	31 c0                	xor    %eax,%eax
+    1c63:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1c68:	0f 94 c0             	sete   %al
+    1c6b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1c6e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1c71:	85 c0                	test   %eax,%eax
+    1c73:	75 c8                	jne    1c3d <setmode+0x1d>
+    1c75:	83 ec 0c             	sub    $0xc,%esp
+    1c78:	68 00 04 00 00       	push   $0x400
+    1c7d:	e8 de 07 00 00       	call   2460 <malloc>
+    1c82:	83 c4 10             	add    $0x10,%esp
+    1c85:	89 43 18             	mov    %eax,0x18(%ebx)
+    1c88:	85 c0                	test   %eax,%eax
+    1c8a:	75 b1                	jne    1c3d <setmode+0x1d>
+    f->mode = IONBF;
+    1c8c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1c93:	eb a8                	jmp    1c3d <setmode+0x1d>
+    1c95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ca0 <drain>:
+{
+    1ca0:	55                   	push   %ebp
+    1ca1:	89 e5                	mov    %esp,%ebp
+    1ca3:	57                   	push   %edi
+    1ca4:	56                   	push   %esi
+    1ca5:	53                   	push   %ebx
+    1ca6:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1ca9:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1cac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1caf:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1cb6:	85 ff                	test   %edi,%edi
+    1cb8:	7f 0e                	jg     1cc8 <drain+0x28>
+  return 0;
+    1cba:	31 c0                	xor    %eax,%eax
+}
+    1cbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cbf:	5b                   	pop    %ebx
+    1cc0:	5e                   	pop    %esi
+    1cc1:	5f                   	pop    %edi
+    1cc2:	5d                   	pop    %ebp
+    1cc3:	c3                   	ret
+    1cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1cc8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1ccb:	8b 58 18             	mov    0x18(%eax),%ebx
+    1cce:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1cd0:	eb 0e                	jmp    1ce0 <drain+0x40>
+    1cd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1cd8:	29 c7                	sub    %eax,%edi
+    1cda:	01 c3                	add    %eax,%ebx
+    1cdc:	85 ff                	test   %edi,%edi
+    1cde:	7e da                	jle    1cba <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1ce0:	83 ec 04             	sub    $0x4,%esp
+    1ce3:	57                   	push   %edi
+    1ce4:	53                   	push   %ebx
+    1ce5:	56                   	push   %esi
+    1ce6:	e8 c4 f9 ff ff       	call   16af <write>
+    1ceb:	83 c4 10             	add    $0x10,%esp
+    1cee:	85 c0                	test   %eax,%eax
+    1cf0:	7f e6                	jg     1cd8 <drain+0x38>
+    f->err = 1;
+    1cf2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1cf5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1cfc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d01:	eb b9                	jmp    1cbc <drain+0x1c>
+    1d03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001d10 <flushall>:
+
+static void
+flushall(void)
+{
+    1d10:	55                   	push   %ebp
+    1d11:	89 e5                	mov    %esp,%ebp
+    1d13:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d14:	bb 40 2d 00 00       	mov    $0x2d40,%ebx
+{
+    1d19:	83 ec 04             	sub    $0x4,%esp
+    1d1c:	eb 0d                	jmp    1d2b <flushall+0x1b>
+    1d1e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d20:	83 c3 24             	add    $0x24,%ebx
+    1d23:	81 fb 80 2f 00 00    	cmp    $0x2f80,%ebx
+    1d29:	74 19                	je     1d44 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1d2b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1d2e:	85 c0                	test   %eax,%eax
+    1d30:	74 ee                	je     1d20 <flushall+0x10>
+    1d32:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d34:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1d37:	e8 64 ff ff ff       	call   1ca0 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d3c:	81 fb 80 2f 00 00    	cmp    $0x2f80,%ebx
+    1d42:	75 e7                	jne    1d2b <flushall+0x1b>
+}
+    1d44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d47:	c9                   	leave
+    1d48:	c3                   	ret
+    1d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001d50 <fflush>:
+{
+    1d50:	55                   	push   %ebp
+    1d51:	89 e5                	mov    %esp,%ebp
+    1d53:	57                   	push   %edi
+    1d54:	56                   	push   %esi
+    1d55:	53                   	push   %ebx
+    1d56:	83 ec 0c             	sub    $0xc,%esp
+    1d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1d5c:	85 c0                	test   %eax,%eax
+    1d5e:	74 28                	je     1d88 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1d60:	8b 70 08             	mov    0x8(%eax),%esi
+    1d63:	85 f6                	test   %esi,%esi
+    1d65:	75 11                	jne    1d78 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1d67:	83 c4 0c             	add    $0xc,%esp
+    1d6a:	89 f0                	mov    %esi,%eax
+    1d6c:	5b                   	pop    %ebx
+    1d6d:	5e                   	pop    %esi
+    1d6e:	5f                   	pop    %edi
+    1d6f:	5d                   	pop    %ebp
+    1d70:	c3                   	ret
+    1d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d78:	83 c4 0c             	add    $0xc,%esp
+    1d7b:	5b                   	pop    %ebx
+    1d7c:	5e                   	pop    %esi
+    1d7d:	5f                   	pop    %edi
+    1d7e:	5d                   	pop    %ebp
+  return drain(f);
+    1d7f:	e9 1c ff ff ff       	jmp    1ca0 <drain>
+    1d84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1d88:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1d8a:	bb 40 2d 00 00       	mov    $0x2d40,%ebx
+        r = -1;
+    1d8f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1d94:	eb 15                	jmp    1dab <fflush+0x5b>
+    1d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d9d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1da0:	83 c3 24             	add    $0x24,%ebx
+    1da3:	81 fb 80 2f 00 00    	cmp    $0x2f80,%ebx
+    1da9:	74 bc                	je     1d67 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1dab:	8b 43 08             	mov    0x8(%ebx),%eax
+    1dae:	85 c0                	test   %eax,%eax
+    1db0:	74 ee                	je     1da0 <fflush+0x50>
+    1db2:	89 d8                	mov    %ebx,%eax
+    1db4:	e8 e7 fe ff ff       	call   1ca0 <drain>
+        r = -1;
+    1db9:	85 c0                	test   %eax,%eax
+    1dbb:	0f 48 f7             	cmovs  %edi,%esi
+    1dbe:	eb e0                	jmp    1da0 <fflush+0x50>
+
+00001dc0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1dc0:	55                   	push   %ebp
+    1dc1:	89 e5                	mov    %esp,%ebp
+    1dc3:	57                   	push   %edi
+    1dc4:	56                   	push   %esi
+    1dc5:	53                   	push   %ebx
+    1dc6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1dc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1dcc:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1dd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1dd3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1dd6:	85 d2                	test   %edx,%edx
+    1dd8:	0f 8e 26 01 00 00    	jle    1f04 <fwrite+0x144>
+  if(!f->writable){
+    1dde:	8b 46 08             	mov    0x8(%esi),%eax
+    1de1:	85 c0                	test   %eax,%eax
+    1de3:	0f 84 14 01 00 00    	je     1efd <fwrite+0x13d>
+  setmode(f);
+    1de9:	89 f0                	mov    %esi,%eax
+    1deb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1dee:	e8 2d fe ff ff       	call   1c20 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1df3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1df7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1dfa:	c7 05 90 2f 00 00 10 	movl   $0x1d10,0x2f90
+    1e01:	1d 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1e04:	0f 84 b6 00 00 00    	je     1ec0 <fwrite+0x100>
+    1e0a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1e10:	0f 8f aa 00 00 00    	jg     1ec0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1e16:	8b 46 20             	mov    0x20(%esi),%eax
+    1e19:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1e1c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1e1e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1e23:	74 6c                	je     1e91 <fwrite+0xd1>
+    1e25:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1e28:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1e2b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1e30:	29 c2                	sub    %eax,%edx
+    1e32:	39 ca                	cmp    %ecx,%edx
+    1e34:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1e37:	85 d2                	test   %edx,%edx
+    1e39:	0f 8e d1 00 00 00    	jle    1f10 <fwrite+0x150>
+    1e3f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1e42:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1e45:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1e48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e4f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1e50:	8d 50 01             	lea    0x1(%eax),%edx
+    1e53:	83 c3 01             	add    $0x1,%ebx
+    1e56:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1e59:	89 56 20             	mov    %edx,0x20(%esi)
+    1e5c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1e60:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1e63:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1e66:	b8 01 00 00 00       	mov    $0x1,%eax
+    1e6b:	80 fa 0a             	cmp    $0xa,%dl
+    1e6e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1e71:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1e74:	39 cb                	cmp    %ecx,%ebx
+    1e76:	75 d8                	jne    1e50 <fwrite+0x90>
+    1e78:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1e7b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1e7e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1e81:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1e84:	85 db                	test   %ebx,%ebx
+    1e86:	7e 19                	jle    1ea1 <fwrite+0xe1>
+    n -= k;
+    1e88:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1e8a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1e8f:	75 97                	jne    1e28 <fwrite+0x68>
+    1e91:	89 f0                	mov    %esi,%eax
+    1e93:	e8 08 fe ff ff       	call   1ca0 <drain>
+    1e98:	85 c0                	test   %eax,%eax
+    1e9a:	78 68                	js     1f04 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1e9c:	8b 46 20             	mov    0x20(%esi),%eax
+    1e9f:	eb 87                	jmp    1e28 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1ea1:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1ea6:	74 74                	je     1f1c <fwrite+0x15c>
+    1ea8:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1eac:	75 04                	jne    1eb2 <fwrite+0xf2>
+    1eae:	85 ff                	test   %edi,%edi
+    1eb0:	75 6a                	jne    1f1c <fwrite+0x15c>
+    return nmemb;
+    1eb2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1eb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1eb8:	5b                   	pop    %ebx
+    1eb9:	5e                   	pop    %esi
+    1eba:	5f                   	pop    %edi
+    1ebb:	5d                   	pop    %ebp
+    1ebc:	c3                   	ret
+    1ebd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1ec0:	89 f0                	mov    %esi,%eax
+    1ec2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1ec5:	e8 d6 fd ff ff       	call   1ca0 <drain>
+    1eca:	85 c0                	test   %eax,%eax
+    1ecc:	78 2f                	js     1efd <fwrite+0x13d>
+    1ece:	89 75 14             	mov    %esi,0x14(%ebp)
+    1ed1:	8b 3e                	mov    (%esi),%edi
+    1ed3:	89 de                	mov    %ebx,%esi
+    1ed5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1ed8:	eb 0e                	jmp    1ee8 <fwrite+0x128>
+    1eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1ee0:	29 c3                	sub    %eax,%ebx
+    1ee2:	01 c6                	add    %eax,%esi
+    1ee4:	85 db                	test   %ebx,%ebx
+    1ee6:	7e ca                	jle    1eb2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1ee8:	83 ec 04             	sub    $0x4,%esp
+    1eeb:	53                   	push   %ebx
+    1eec:	56                   	push   %esi
+    1eed:	57                   	push   %edi
+    1eee:	e8 bc f7 ff ff       	call   16af <write>
+    1ef3:	83 c4 10             	add    $0x10,%esp
+    1ef6:	85 c0                	test   %eax,%eax
+    1ef8:	7f e6                	jg     1ee0 <fwrite+0x120>
+    1efa:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1efd:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1f04:	31 c0                	xor    %eax,%eax
+}
+    1f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f09:	5b                   	pop    %ebx
+    1f0a:	5e                   	pop    %esi
+    1f0b:	5f                   	pop    %edi
+    1f0c:	5d                   	pop    %ebp
+    1f0d:	c3                   	ret
+    1f0e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1f10:	89 d9                	mov    %ebx,%ecx
+    1f12:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1f15:	89 cb                	mov    %ecx,%ebx
+    1f17:	e9 6e ff ff ff       	jmp    1e8a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1f1c:	89 f0                	mov    %esi,%eax
+    1f1e:	e8 7d fd ff ff       	call   1ca0 <drain>
+    1f23:	85 c0                	test   %eax,%eax
+    1f25:	79 8b                	jns    1eb2 <fwrite+0xf2>
+    return 0;
+    1f27:	31 c0                	xor    %eax,%eax
+    1f29:	eb db                	jmp    1f06 <fwrite+0x146>
+    1f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f2f:	90                   	nop
+
+00001f30 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1f30:	55                   	push   %ebp
+    1f31:	89 e5                	mov    %esp,%ebp
+    1f33:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1f36:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f39:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1f3c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1f3f:	ff 75 0c             	push   0xc(%ebp)
+    1f42:	6a 01                	push   $0x1
+    1f44:	6a 01                	push   $0x1
+    1f46:	50                   	push   %eax
+    1f47:	e8 74 fe ff ff       	call   1dc0 <fwrite>
+    1f4c:	83 c4 10             	add    $0x10,%esp
+    1f4f:	83 f8 01             	cmp    $0x1,%eax
+    1f52:	75 0c                	jne    1f60 <fputc+0x30>
+    1f54:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1f58:	c9                   	leave
+    1f59:	c3                   	ret
+    1f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1f60:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1f61:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1f66:	c3                   	ret
+    1f67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f6e:	66 90                	xchg   %ax,%ax
+
+00001f70 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1f70:	55                   	push   %ebp
+    1f71:	89 e5                	mov    %esp,%ebp
+    1f73:	57                   	push   %edi
+    1f74:	56                   	push   %esi
+    1f75:	53                   	push   %ebx
+    1f76:	83 ec 1c             	sub    $0x1c,%esp
+    1f79:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1f7c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1f7f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1f82:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1f85:	85 d2                	test   %edx,%edx
+    1f87:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1f8a:	7e 12                	jle    1f9e <fread+0x2e>
+    1f8c:	85 ff                	test   %edi,%edi
+    1f8e:	7e 0e                	jle    1f9e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1f90:	8b 43 04             	mov    0x4(%ebx),%eax
+    1f93:	85 c0                	test   %eax,%eax
+    1f95:	75 19                	jne    1fb0 <fread+0x40>
+    f->err = 1;
+    1f97:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1f9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1fa1:	31 c0                	xor    %eax,%eax
+}
+    1fa3:	5b                   	pop    %ebx
+    1fa4:	5e                   	pop    %esi
+    1fa5:	5f                   	pop    %edi
+    1fa6:	5d                   	pop    %ebp
+    1fa7:	c3                   	ret
+    1fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1faf:	90                   	nop
+  setmode(f);
+    1fb0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1fb2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1fb4:	e8 67 fc ff ff       	call   1c20 <setmode>
+  for(n = 0; n < want; n += k){
+    1fb9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1fbc:	89 f7                	mov    %esi,%edi
+    1fbe:	eb 31                	jmp    1ff1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1fc0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1fc4:	74 08                	je     1fce <fread+0x5e>
+    1fc6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1fcc:	7e 62                	jle    2030 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1fce:	83 ec 04             	sub    $0x4,%esp
+    1fd1:	56                   	push   %esi
+    1fd2:	8b 45 08             	mov    0x8(%ebp),%eax
+    1fd5:	01 f8                	add    %edi,%eax
+    1fd7:	50                   	push   %eax
+    1fd8:	ff 33                	push   (%ebx)
+    1fda:	e8 c1 f6 ff ff       	call   16a0 <read>
+    1fdf:	83 c4 10             	add    $0x10,%esp
+    1fe2:	85 c0                	test   %eax,%eax
+    1fe4:	0f 8e ce 00 00 00    	jle    20b8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1fea:	01 c7                	add    %eax,%edi
+    1fec:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1fef:	7e 36                	jle    2027 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1ff1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1ff4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1ff7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1ffa:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1ffc:	39 c1                	cmp    %eax,%ecx
+    1ffe:	7d c0                	jge    1fc0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2000:	29 c8                	sub    %ecx,%eax
+    2002:	39 f0                	cmp    %esi,%eax
+    2004:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    2007:	83 ec 04             	sub    $0x4,%esp
+    200a:	56                   	push   %esi
+    200b:	03 4b 18             	add    0x18(%ebx),%ecx
+    200e:	51                   	push   %ecx
+    200f:	8b 45 08             	mov    0x8(%ebp),%eax
+    2012:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    2014:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    2016:	50                   	push   %eax
+    2017:	e8 34 f5 ff ff       	call   1550 <memmove>
+      f->r += k;
+    201c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    201f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    2022:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    2025:	7f ca                	jg     1ff1 <fread+0x81>
+    2027:	89 fe                	mov    %edi,%esi
+    2029:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    202c:	eb 3f                	jmp    206d <fread+0xfd>
+    202e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    2030:	3b 1d 28 2d 00 00    	cmp    0x2d28,%ebx
+    2036:	74 68                	je     20a0 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    2038:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    203b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    2042:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    2049:	68 00 04 00 00       	push   $0x400
+    204e:	ff 73 18             	push   0x18(%ebx)
+    2051:	ff 33                	push   (%ebx)
+    2053:	e8 48 f6 ff ff       	call   16a0 <read>
+    2058:	83 c4 10             	add    $0x10,%esp
+    205b:	85 c0                	test   %eax,%eax
+    205d:	78 21                	js     2080 <fread+0x110>
+  else if(n == 0)
+    205f:	75 2f                	jne    2090 <fread+0x120>
+    f->eof = 1;
+    2061:	89 fe                	mov    %edi,%esi
+    2063:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2066:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    206d:	89 f0                	mov    %esi,%eax
+}
+    206f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    2072:	99                   	cltd
+}
+    2073:	5b                   	pop    %ebx
+    2074:	5e                   	pop    %esi
+  return n / size;
+    2075:	f7 ff                	idiv   %edi
+}
+    2077:	5f                   	pop    %edi
+    2078:	5d                   	pop    %ebp
+    2079:	c3                   	ret
+    207a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    2080:	89 fe                	mov    %edi,%esi
+    2082:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2085:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    208c:	eb df                	jmp    206d <fread+0xfd>
+    208e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    2090:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    2093:	e9 54 ff ff ff       	jmp    1fec <fread+0x7c>
+    2098:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    209f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    20a0:	83 ec 0c             	sub    $0xc,%esp
+    20a3:	ff 35 24 2d 00 00    	push   0x2d24
+    20a9:	e8 a2 fc ff ff       	call   1d50 <fflush>
+    20ae:	83 c4 10             	add    $0x10,%esp
+    20b1:	eb 85                	jmp    2038 <fread+0xc8>
+    20b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20b7:	90                   	nop
+        if(k < 0)
+    20b8:	89 fe                	mov    %edi,%esi
+    20ba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    20bd:	74 a7                	je     2066 <fread+0xf6>
+    20bf:	eb c4                	jmp    2085 <fread+0x115>
+    20c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20cf:	90                   	nop
+
+000020d0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    20d0:	55                   	push   %ebp
+    20d1:	89 e5                	mov    %esp,%ebp
+    20d3:	53                   	push   %ebx
+    20d4:	83 ec 14             	sub    $0x14,%esp
+    20d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    20da:	8b 50 04             	mov    0x4(%eax),%edx
+    20dd:	85 d2                	test   %edx,%edx
+    20df:	74 08                	je     20e9 <fgetc+0x19>
+    20e1:	8b 50 1c             	mov    0x1c(%eax),%edx
+    20e4:	3b 50 20             	cmp    0x20(%eax),%edx
+    20e7:	7c 27                	jl     2110 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    20e9:	50                   	push   %eax
+    20ea:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    20ed:	6a 01                	push   $0x1
+    20ef:	6a 01                	push   $0x1
+    20f1:	50                   	push   %eax
+    20f2:	e8 79 fe ff ff       	call   1f70 <fread>
+    20f7:	83 c4 10             	add    $0x10,%esp
+    20fa:	83 f8 01             	cmp    $0x1,%eax
+    20fd:	75 29                	jne    2128 <fgetc+0x58>
+    20ff:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2103:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2106:	c9                   	leave
+    2107:	c3                   	ret
+    2108:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    210f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    2110:	8b 48 18             	mov    0x18(%eax),%ecx
+    2113:	8d 5a 01             	lea    0x1(%edx),%ebx
+    2116:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    2119:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    211c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    2120:	c9                   	leave
+    2121:	c3                   	ret
+    2122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2128:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    212d:	eb d4                	jmp    2103 <fgetc+0x33>
+    212f:	90                   	nop
+
+00002130 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    2130:	55                   	push   %ebp
+    2131:	89 e5                	mov    %esp,%ebp
+    2133:	57                   	push   %edi
+    2134:	56                   	push   %esi
+    2135:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    2136:	31 db                	xor    %ebx,%ebx
+{
+    2138:	83 ec 1c             	sub    $0x1c,%esp
+    213b:	8b 75 10             	mov    0x10(%ebp),%esi
+    213e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    2140:	eb 2e                	jmp    2170 <fgets+0x40>
+    2142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2148:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    214b:	57                   	push   %edi
+    214c:	6a 01                	push   $0x1
+    214e:	6a 01                	push   $0x1
+    2150:	50                   	push   %eax
+    2151:	e8 1a fe ff ff       	call   1f70 <fread>
+    2156:	83 c4 10             	add    $0x10,%esp
+    2159:	83 f8 01             	cmp    $0x1,%eax
+    215c:	75 62                	jne    21c0 <fgets+0x90>
+    215e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    2162:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2165:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    2167:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    216b:	83 f9 0a             	cmp    $0xa,%ecx
+    216e:	74 34                	je     21a4 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    2170:	89 de                	mov    %ebx,%esi
+    2172:	83 c3 01             	add    $0x1,%ebx
+    2175:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    2178:	7d 46                	jge    21c0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    217a:	8b 47 04             	mov    0x4(%edi),%eax
+    217d:	85 c0                	test   %eax,%eax
+    217f:	74 c7                	je     2148 <fgets+0x18>
+    2181:	8b 47 1c             	mov    0x1c(%edi),%eax
+    2184:	3b 47 20             	cmp    0x20(%edi),%eax
+    2187:	7d bf                	jge    2148 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    2189:	8b 4f 18             	mov    0x18(%edi),%ecx
+    218c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    218f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    2192:	89 77 1c             	mov    %esi,0x1c(%edi)
+    2195:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    2199:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    219b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    219f:	83 f9 0a             	cmp    $0xa,%ecx
+    21a2:	75 cc                	jne    2170 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    21a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    21a7:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    21ab:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    21ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21b1:	5b                   	pop    %ebx
+    21b2:	5e                   	pop    %esi
+    21b3:	5f                   	pop    %edi
+    21b4:	5d                   	pop    %ebp
+    21b5:	c3                   	ret
+    21b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21bd:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    21c0:	8b 45 08             	mov    0x8(%ebp),%eax
+    21c3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    21c7:	31 c0                	xor    %eax,%eax
+    21c9:	85 f6                	test   %esi,%esi
+    21cb:	74 e1                	je     21ae <fgets+0x7e>
+    21cd:	8b 45 08             	mov    0x8(%ebp),%eax
+    21d0:	eb dc                	jmp    21ae <fgets+0x7e>
+    21d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000021e0 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    21e0:	55                   	push   %ebp
+    21e1:	89 e5                	mov    %esp,%ebp
+    21e3:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    21e4:	bb 40 2d 00 00       	mov    $0x2d40,%ebx
+{
+    21e9:	83 ec 04             	sub    $0x4,%esp
+    21ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    21f0:	8b 53 04             	mov    0x4(%ebx),%edx
+    21f3:	85 d2                	test   %edx,%edx
+    21f5:	75 07                	jne    21fe <fdopen+0x1e>
+    21f7:	8b 43 08             	mov    0x8(%ebx),%eax
+    21fa:	85 c0                	test   %eax,%eax
+    21fc:	74 1a                	je     2218 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    21fe:	83 c3 24             	add    $0x24,%ebx
+    2201:	81 fb 80 2f 00 00    	cmp    $0x2f80,%ebx
+    2207:	75 e7                	jne    21f0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2209:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    220b:	89 d8                	mov    %ebx,%eax
+    220d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2210:	c9                   	leave
+    2211:	c3                   	ret
+    2212:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2218:	81 fb 80 2f 00 00    	cmp    $0x2f80,%ebx
+    221e:	74 e9                	je     2209 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2220:	83 ec 04             	sub    $0x4,%esp
+    2223:	6a 24                	push   $0x24
+    2225:	6a 00                	push   $0x0
+    2227:	53                   	push   %ebx
+    2228:	e8 d3 f1 ff ff       	call   1400 <memset>
+  f->fd = fd;
+    222d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2230:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2237:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    223a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    223c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    223f:	80 38 72             	cmpb   $0x72,(%eax)
+    2242:	74 14                	je     2258 <fdopen+0x78>
+    f->writable = 1;
+    2244:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    224b:	89 d8                	mov    %ebx,%eax
+    224d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2250:	c9                   	leave
+    2251:	c3                   	ret
+    2252:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2258:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    225f:	89 d8                	mov    %ebx,%eax
+    2261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2264:	c9                   	leave
+    2265:	c3                   	ret
+    2266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    226d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002270 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2270:	55                   	push   %ebp
+    2271:	89 e5                	mov    %esp,%ebp
+    2273:	56                   	push   %esi
+    2274:	53                   	push   %ebx
+    2275:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2278:	0f b6 06             	movzbl (%esi),%eax
+    227b:	3c 72                	cmp    $0x72,%al
+    227d:	74 61                	je     22e0 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    227f:	3c 77                	cmp    $0x77,%al
+    2281:	74 7d                	je     2300 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2283:	3c 61                	cmp    $0x61,%al
+    2285:	75 49                	jne    22d0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2287:	83 ec 08             	sub    $0x8,%esp
+    228a:	68 01 02 00 00       	push   $0x201
+    228f:	ff 75 08             	push   0x8(%ebp)
+    2292:	e8 54 f4 ff ff       	call   16eb <open>
+    2297:	83 c4 10             	add    $0x10,%esp
+    229a:	89 c3                	mov    %eax,%ebx
+    229c:	85 c0                	test   %eax,%eax
+    229e:	78 30                	js     22d0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    22a0:	83 ec 04             	sub    $0x4,%esp
+    22a3:	6a 02                	push   $0x2
+    22a5:	6a 00                	push   $0x0
+    22a7:	50                   	push   %eax
+    22a8:	e8 4c f5 ff ff       	call   17f9 <lseek>
+    22ad:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    22b0:	83 ec 08             	sub    $0x8,%esp
+    22b3:	56                   	push   %esi
+    22b4:	53                   	push   %ebx
+    22b5:	e8 26 ff ff ff       	call   21e0 <fdopen>
+    22ba:	83 c4 10             	add    $0x10,%esp
+    22bd:	85 c0                	test   %eax,%eax
+    22bf:	75 11                	jne    22d2 <fopen+0x62>
+    close(fd);
+    22c1:	83 ec 0c             	sub    $0xc,%esp
+    22c4:	53                   	push   %ebx
+    22c5:	e8 f4 f3 ff ff       	call   16be <close>
+    22ca:	83 c4 10             	add    $0x10,%esp
+    22cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    22d0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    22d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    22d5:	5b                   	pop    %ebx
+    22d6:	5e                   	pop    %esi
+    22d7:	5d                   	pop    %ebp
+    22d8:	c3                   	ret
+    22d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    22e0:	83 ec 08             	sub    $0x8,%esp
+    22e3:	6a 00                	push   $0x0
+    22e5:	ff 75 08             	push   0x8(%ebp)
+    22e8:	e8 fe f3 ff ff       	call   16eb <open>
+    22ed:	83 c4 10             	add    $0x10,%esp
+    22f0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    22f2:	85 db                	test   %ebx,%ebx
+    22f4:	78 da                	js     22d0 <fopen+0x60>
+    22f6:	eb b8                	jmp    22b0 <fopen+0x40>
+    22f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22ff:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2300:	83 ec 08             	sub    $0x8,%esp
+    2303:	68 01 06 00 00       	push   $0x601
+    2308:	ff 75 08             	push   0x8(%ebp)
+    230b:	e8 db f3 ff ff       	call   16eb <open>
+    2310:	83 c4 10             	add    $0x10,%esp
+    2313:	89 c3                	mov    %eax,%ebx
+    2315:	eb db                	jmp    22f2 <fopen+0x82>
+    2317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    231e:	66 90                	xchg   %ax,%ax
+
+00002320 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2320:	55                   	push   %ebp
+    2321:	89 e5                	mov    %esp,%ebp
+    2323:	56                   	push   %esi
+    2324:	53                   	push   %ebx
+    2325:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2328:	83 ec 0c             	sub    $0xc,%esp
+    232b:	53                   	push   %ebx
+    232c:	e8 1f fa ff ff       	call   1d50 <fflush>
+    2331:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2333:	58                   	pop    %eax
+    2334:	ff 33                	push   (%ebx)
+    2336:	e8 83 f3 ff ff       	call   16be <close>
+    233b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    233e:	85 c0                	test   %eax,%eax
+    2340:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2345:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2348:	8b 43 18             	mov    0x18(%ebx),%eax
+    234b:	85 c0                	test   %eax,%eax
+    234d:	0f 95 c1             	setne  %cl
+    2350:	3d a0 33 00 00       	cmp    $0x33a0,%eax
+    2355:	0f 95 c2             	setne  %dl
+    2358:	84 d1                	test   %dl,%cl
+    235a:	74 07                	je     2363 <fclose+0x43>
+    235c:	3d a0 2f 00 00       	cmp    $0x2fa0,%eax
+    2361:	75 25                	jne    2388 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2363:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    236a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    236c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2373:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    237a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    237d:	5b                   	pop    %ebx
+    237e:	5e                   	pop    %esi
+    237f:	5d                   	pop    %ebp
+    2380:	c3                   	ret
+    2381:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2388:	83 ec 0c             	sub    $0xc,%esp
+    238b:	50                   	push   %eax
+    238c:	e8 3f 00 00 00       	call   23d0 <free>
+    2391:	83 c4 10             	add    $0x10,%esp
+    2394:	eb cd                	jmp    2363 <fclose+0x43>
+    2396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    239d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000023a0 <feof>:
+
+int
+feof(FILE *f)
+{
+    23a0:	55                   	push   %ebp
+    23a1:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    23a3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    23a6:	5d                   	pop    %ebp
+  return f->eof;
+    23a7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    23aa:	c3                   	ret
+    23ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    23af:	90                   	nop
+
+000023b0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    23b0:	55                   	push   %ebp
+    23b1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    23b3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    23b6:	5d                   	pop    %ebp
+  return f->err;
+    23b7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    23ba:	c3                   	ret
+    23bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    23bf:	90                   	nop
+
+000023c0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    23c0:	55                   	push   %ebp
+    23c1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    23c3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    23c6:	5d                   	pop    %ebp
+  return f->fd;
+    23c7:	8b 00                	mov    (%eax),%eax
+}
+    23c9:	c3                   	ret
+    23ca:	66 90                	xchg   %ax,%ax
+    23cc:	66 90                	xchg   %ax,%ax
+    23ce:	66 90                	xchg   %ax,%ax
+
+000023d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    23d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    23d1:	a1 a0 37 00 00       	mov    0x37a0,%eax
+{
+    23d6:	89 e5                	mov    %esp,%ebp
+    23d8:	57                   	push   %edi
+    23d9:	56                   	push   %esi
+    23da:	53                   	push   %ebx
+    23db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    23de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    23e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    23ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    23ec:	39 ca                	cmp    %ecx,%edx
+    23ee:	73 30                	jae    2420 <free+0x50>
+    23f0:	39 c1                	cmp    %eax,%ecx
+    23f2:	72 04                	jb     23f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    23f4:	39 c2                	cmp    %eax,%edx
+    23f6:	72 f0                	jb     23e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    23f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    23fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    23fe:	39 f8                	cmp    %edi,%eax
+    2400:	74 2e                	je     2430 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2402:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2405:	8b 42 04             	mov    0x4(%edx),%eax
+    2408:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    240b:	39 f1                	cmp    %esi,%ecx
+    240d:	74 38                	je     2447 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    240f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2411:	5b                   	pop    %ebx
+  freep = p;
+    2412:	89 15 a0 37 00 00    	mov    %edx,0x37a0
+}
+    2418:	5e                   	pop    %esi
+    2419:	5f                   	pop    %edi
+    241a:	5d                   	pop    %ebp
+    241b:	c3                   	ret
+    241c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2420:	39 c1                	cmp    %eax,%ecx
+    2422:	72 d0                	jb     23f4 <free+0x24>
+    2424:	eb c2                	jmp    23e8 <free+0x18>
+    2426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    242d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2430:	03 70 04             	add    0x4(%eax),%esi
+    2433:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2436:	8b 02                	mov    (%edx),%eax
+    2438:	8b 00                	mov    (%eax),%eax
+    243a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    243d:	8b 42 04             	mov    0x4(%edx),%eax
+    2440:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2443:	39 f1                	cmp    %esi,%ecx
+    2445:	75 c8                	jne    240f <free+0x3f>
+    p->s.size += bp->s.size;
+    2447:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    244a:	89 15 a0 37 00 00    	mov    %edx,0x37a0
+    p->s.size += bp->s.size;
+    2450:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2453:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2456:	89 0a                	mov    %ecx,(%edx)
+}
+    2458:	5b                   	pop    %ebx
+    2459:	5e                   	pop    %esi
+    245a:	5f                   	pop    %edi
+    245b:	5d                   	pop    %ebp
+    245c:	c3                   	ret
+    245d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002460 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2460:	55                   	push   %ebp
+    2461:	89 e5                	mov    %esp,%ebp
+    2463:	57                   	push   %edi
+    2464:	56                   	push   %esi
+    2465:	53                   	push   %ebx
+    2466:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2469:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    246c:	8b 15 a0 37 00 00    	mov    0x37a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2472:	8d 78 07             	lea    0x7(%eax),%edi
+    2475:	c1 ef 03             	shr    $0x3,%edi
+    2478:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    247b:	85 d2                	test   %edx,%edx
+    247d:	0f 84 8d 00 00 00    	je     2510 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2483:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2485:	8b 48 04             	mov    0x4(%eax),%ecx
+    2488:	39 f9                	cmp    %edi,%ecx
+    248a:	73 64                	jae    24f0 <malloc+0x90>
+  if(nu < 4096)
+    248c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2491:	39 df                	cmp    %ebx,%edi
+    2493:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2496:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    249d:	eb 0a                	jmp    24a9 <malloc+0x49>
+    249f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    24a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    24a2:	8b 48 04             	mov    0x4(%eax),%ecx
+    24a5:	39 f9                	cmp    %edi,%ecx
+    24a7:	73 47                	jae    24f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    24a9:	89 c2                	mov    %eax,%edx
+    24ab:	39 05 a0 37 00 00    	cmp    %eax,0x37a0
+    24b1:	75 ed                	jne    24a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    24b3:	83 ec 0c             	sub    $0xc,%esp
+    24b6:	56                   	push   %esi
+    24b7:	e8 b6 f2 ff ff       	call   1772 <sbrk>
+  if(p == (char*)-1)
+    24bc:	83 c4 10             	add    $0x10,%esp
+    24bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    24c2:	74 1c                	je     24e0 <malloc+0x80>
+  hp->s.size = nu;
+    24c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    24c7:	83 ec 0c             	sub    $0xc,%esp
+    24ca:	83 c0 08             	add    $0x8,%eax
+    24cd:	50                   	push   %eax
+    24ce:	e8 fd fe ff ff       	call   23d0 <free>
+  return freep;
+    24d3:	8b 15 a0 37 00 00    	mov    0x37a0,%edx
+      if((p = morecore(nunits)) == 0)
+    24d9:	83 c4 10             	add    $0x10,%esp
+    24dc:	85 d2                	test   %edx,%edx
+    24de:	75 c0                	jne    24a0 <malloc+0x40>
+        return 0;
+  }
+}
+    24e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    24e3:	31 c0                	xor    %eax,%eax
+}
+    24e5:	5b                   	pop    %ebx
+    24e6:	5e                   	pop    %esi
+    24e7:	5f                   	pop    %edi
+    24e8:	5d                   	pop    %ebp
+    24e9:	c3                   	ret
+    24ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    24f0:	39 cf                	cmp    %ecx,%edi
+    24f2:	74 4c                	je     2540 <malloc+0xe0>
+        p->s.size -= nunits;
+    24f4:	29 f9                	sub    %edi,%ecx
+    24f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    24f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    24fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    24ff:	89 15 a0 37 00 00    	mov    %edx,0x37a0
+}
+    2505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2508:	83 c0 08             	add    $0x8,%eax
+}
+    250b:	5b                   	pop    %ebx
+    250c:	5e                   	pop    %esi
+    250d:	5f                   	pop    %edi
+    250e:	5d                   	pop    %ebp
+    250f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2510:	c7 05 a0 37 00 00 a4 	movl   $0x37a4,0x37a0
+    2517:	37 00 00 
+    base.s.size = 0;
+    251a:	b8 a4 37 00 00       	mov    $0x37a4,%eax
+    base.s.ptr = freep = prevp = &base;
+    251f:	c7 05 a4 37 00 00 a4 	movl   $0x37a4,0x37a4
+    2526:	37 00 00 
+    base.s.size = 0;
+    2529:	c7 05 a8 37 00 00 00 	movl   $0x0,0x37a8
+    2530:	00 00 00 
+    if(p->s.size >= nunits){
+    2533:	e9 54 ff ff ff       	jmp    248c <malloc+0x2c>
+    2538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    253f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2540:	8b 08                	mov    (%eax),%ecx
+    2542:	89 0a                	mov    %ecx,(%edx)
+    2544:	eb b9                	jmp    24ff <malloc+0x9f>
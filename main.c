@@ -29,7 +29,11 @@ main(void)
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
+  icacheinit();    // inode cache
+  dcinit();        // directory name cache
   fileinit();      // file table
+  pipeinit();      // pipe statistics
+  pciinit();       // PCI devices
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
@@ -12,17 +12,25 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "kstat.h"
 
-extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
+extern uchar _binary_memfs_img_start[], _binary_memfs_img_size[];
 
 static int disksize;
 static uchar *memdisk;
 
+// Each request is a command of its own, done at once.
+static struct spinlock statlock;
+static uint nreqs;
+
+int ideirq = IRQ_IDE;
+
 void
 ideinit(void)
 {
-  memdisk = _binary_fs_img_start;
-  disksize = (uint)_binary_fs_img_size/BSIZE;
+  initlock(&statlock, "memide");
+  memdisk = _binary_memfs_img_start;
+  disksize = (uint)_binary_memfs_img_size/BSIZE;
 }
 
 // Interrupt handler.
@@ -57,4 +65,27 @@ iderw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  acquire(&statlock);
+  nreqs++;
+  release(&statlock);
+}
+
+// There is no queue, so only the request counts mean anything.
+void
+idestat(struct kstat *st)
+{
+  acquire(&statlock);
+  st->disk_reqs = nreqs;
+  st->disk_cmds = nreqs;
+  st->disk_sectors = nreqs * (BSIZE/512);
+  release(&statlock);
+}
+
+// Size of disk dev, in blocks.
+uint
+idesize(int dev)
+{
+  if(dev != 1)
+    return 0;
+  return disksize;
 }
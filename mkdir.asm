@@ -0,0 +1,2707 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	bf 01 00 00 00       	mov    $0x1,%edi
+    1013:	56                   	push   %esi
+    1014:	53                   	push   %ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 08             	sub    $0x8,%esp
+    1019:	8b 59 04             	mov    0x4(%ecx),%ebx
+    101c:	8b 31                	mov    (%ecx),%esi
+    101e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+    1021:	83 fe 01             	cmp    $0x1,%esi
+    1024:	7f 14                	jg     103a <main+0x3a>
+    1026:	eb 3a                	jmp    1062 <main+0x62>
+    1028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+    1030:	83 c7 01             	add    $0x1,%edi
+    1033:	83 c3 04             	add    $0x4,%ebx
+    1036:	39 fe                	cmp    %edi,%esi
+    1038:	74 23                	je     105d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+    103a:	83 ec 0c             	sub    $0xc,%esp
+    103d:	ff 33                	push   (%ebx)
+    103f:	e8 32 04 00 00       	call   1476 <mkdir>
+    1044:	83 c4 10             	add    $0x10,%esp
+    1047:	85 c0                	test   %eax,%eax
+    1049:	79 e5                	jns    1030 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+    104b:	50                   	push   %eax
+    104c:	ff 33                	push   (%ebx)
+    104e:	68 9f 22 00 00       	push   $0x229f
+    1053:	6a 02                	push   $0x2
+    1055:	e8 76 08 00 00       	call   18d0 <printf>
+      break;
+    105a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+    105d:	e8 fe 02 00 00       	call   1360 <exit>
+    printf(2, "Usage: mkdir files...\n");
+    1062:	52                   	push   %edx
+    1063:	52                   	push   %edx
+    1064:	68 88 22 00 00       	push   $0x2288
+    1069:	6a 02                	push   $0x2
+    106b:	e8 60 08 00 00       	call   18d0 <printf>
+    exit();
+    1070:	e8 eb 02 00 00       	call   1360 <exit>
+    1075:	66 90                	xchg   %ax,%ax
+    1077:	66 90                	xchg   %ax,%ax
+    1079:	66 90                	xchg   %ax,%ax
+    107b:	66 90                	xchg   %ax,%ax
+    107d:	66 90                	xchg   %ax,%ax
+    107f:	90                   	nop
+
+00001080 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1080:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1081:	31 c0                	xor    %eax,%eax
+{
+    1083:	89 e5                	mov    %esp,%ebp
+    1085:	53                   	push   %ebx
+    1086:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1089:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    108c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1090:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1094:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1097:	83 c0 01             	add    $0x1,%eax
+    109a:	84 d2                	test   %dl,%dl
+    109c:	75 f2                	jne    1090 <strcpy+0x10>
+    ;
+  return os;
+}
+    109e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10a1:	89 c8                	mov    %ecx,%eax
+    10a3:	c9                   	leave
+    10a4:	c3                   	ret
+    10a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	53                   	push   %ebx
+    10b4:	8b 55 08             	mov    0x8(%ebp),%edx
+    10b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    10ba:	0f b6 02             	movzbl (%edx),%eax
+    10bd:	84 c0                	test   %al,%al
+    10bf:	75 17                	jne    10d8 <strcmp+0x28>
+    10c1:	eb 3a                	jmp    10fd <strcmp+0x4d>
+    10c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10c7:	90                   	nop
+    10c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    10cc:	83 c2 01             	add    $0x1,%edx
+    10cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    10d2:	84 c0                	test   %al,%al
+    10d4:	74 1a                	je     10f0 <strcmp+0x40>
+    p++, q++;
+    10d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    10d8:	0f b6 19             	movzbl (%ecx),%ebx
+    10db:	38 c3                	cmp    %al,%bl
+    10dd:	74 e9                	je     10c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    10df:	29 d8                	sub    %ebx,%eax
+}
+    10e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10e4:	c9                   	leave
+    10e5:	c3                   	ret
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10f4:	31 c0                	xor    %eax,%eax
+    10f6:	29 d8                	sub    %ebx,%eax
+}
+    10f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10fb:	c9                   	leave
+    10fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10fd:	0f b6 19             	movzbl (%ecx),%ebx
+    1100:	31 c0                	xor    %eax,%eax
+    1102:	eb db                	jmp    10df <strcmp+0x2f>
+    1104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    110f:	90                   	nop
+
+00001110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1116:	80 3a 00             	cmpb   $0x0,(%edx)
+    1119:	74 15                	je     1130 <strlen+0x20>
+    111b:	31 c0                	xor    %eax,%eax
+    111d:	8d 76 00             	lea    0x0(%esi),%esi
+    1120:	83 c0 01             	add    $0x1,%eax
+    1123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1127:	89 c1                	mov    %eax,%ecx
+    1129:	75 f5                	jne    1120 <strlen+0x10>
+    ;
+  return n;
+}
+    112b:	89 c8                	mov    %ecx,%eax
+    112d:	5d                   	pop    %ebp
+    112e:	c3                   	ret
+    112f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1130:	31 c9                	xor    %ecx,%ecx
+}
+    1132:	5d                   	pop    %ebp
+    1133:	89 c8                	mov    %ecx,%eax
+    1135:	c3                   	ret
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    114a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    114d:	89 d7                	mov    %edx,%edi
+    114f:	fc                   	cld
+    1150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1155:	89 d0                	mov    %edx,%eax
+    1157:	c9                   	leave
+    1158:	c3                   	ret
+    1159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	8b 45 08             	mov    0x8(%ebp),%eax
+    1166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    116a:	0f b6 10             	movzbl (%eax),%edx
+    116d:	84 d2                	test   %dl,%dl
+    116f:	75 12                	jne    1183 <strchr+0x23>
+    1171:	eb 1d                	jmp    1190 <strchr+0x30>
+    1173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1177:	90                   	nop
+    1178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    117c:	83 c0 01             	add    $0x1,%eax
+    117f:	84 d2                	test   %dl,%dl
+    1181:	74 0d                	je     1190 <strchr+0x30>
+    if(*s == c)
+    1183:	38 d1                	cmp    %dl,%cl
+    1185:	75 f1                	jne    1178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1187:	5d                   	pop    %ebp
+    1188:	c3                   	ret
+    1189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1190:	31 c0                	xor    %eax,%eax
+}
+    1192:	5d                   	pop    %ebp
+    1193:	c3                   	ret
+    1194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+
+000011a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	57                   	push   %edi
+    11a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    11a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    11a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    11a9:	31 db                	xor    %ebx,%ebx
+{
+    11ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    11ae:	eb 27                	jmp    11d7 <gets+0x37>
+    cc = read(0, &c, 1);
+    11b0:	83 ec 04             	sub    $0x4,%esp
+    11b3:	6a 01                	push   $0x1
+    11b5:	56                   	push   %esi
+    11b6:	6a 00                	push   $0x0
+    11b8:	e8 23 02 00 00       	call   13e0 <read>
+    if(cc < 1)
+    11bd:	83 c4 10             	add    $0x10,%esp
+    11c0:	85 c0                	test   %eax,%eax
+    11c2:	7e 1d                	jle    11e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    11c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    11c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    11cf:	3c 0a                	cmp    $0xa,%al
+    11d1:	74 10                	je     11e3 <gets+0x43>
+    11d3:	3c 0d                	cmp    $0xd,%al
+    11d5:	74 0c                	je     11e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    11d7:	89 df                	mov    %ebx,%edi
+    11d9:	83 c3 01             	add    $0x1,%ebx
+    11dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    11df:	7c cf                	jl     11b0 <gets+0x10>
+    11e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    11e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    11ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11ed:	5b                   	pop    %ebx
+    11ee:	5e                   	pop    %esi
+    11ef:	5f                   	pop    %edi
+    11f0:	5d                   	pop    %ebp
+    11f1:	c3                   	ret
+    11f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	56                   	push   %esi
+    1204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1205:	83 ec 08             	sub    $0x8,%esp
+    1208:	6a 00                	push   $0x0
+    120a:	ff 75 08             	push   0x8(%ebp)
+    120d:	e8 19 02 00 00       	call   142b <open>
+  if(fd < 0)
+    1212:	83 c4 10             	add    $0x10,%esp
+    1215:	85 c0                	test   %eax,%eax
+    1217:	78 27                	js     1240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1219:	83 ec 08             	sub    $0x8,%esp
+    121c:	ff 75 0c             	push   0xc(%ebp)
+    121f:	89 c3                	mov    %eax,%ebx
+    1221:	50                   	push   %eax
+    1222:	e8 31 02 00 00       	call   1458 <fstat>
+  close(fd);
+    1227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    122a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    122c:	e8 cd 01 00 00       	call   13fe <close>
+  return r;
+    1231:	83 c4 10             	add    $0x10,%esp
+}
+    1234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1237:	89 f0                	mov    %esi,%eax
+    1239:	5b                   	pop    %ebx
+    123a:	5e                   	pop    %esi
+    123b:	5d                   	pop    %ebp
+    123c:	c3                   	ret
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1245:	eb ed                	jmp    1234 <stat+0x34>
+    1247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124e:	66 90                	xchg   %ax,%ax
+
+00001250 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	53                   	push   %ebx
+    1254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1257:	0f be 02             	movsbl (%edx),%eax
+    125a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    125d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1265:	77 1e                	ja     1285 <atoi+0x35>
+    1267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1270:	83 c2 01             	add    $0x1,%edx
+    1273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    127a:	0f be 02             	movsbl (%edx),%eax
+    127d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1280:	80 fb 09             	cmp    $0x9,%bl
+    1283:	76 eb                	jbe    1270 <atoi+0x20>
+  return n;
+}
+    1285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1288:	89 c8                	mov    %ecx,%eax
+    128a:	c9                   	leave
+    128b:	c3                   	ret
+    128c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	57                   	push   %edi
+    1294:	56                   	push   %esi
+    1295:	8b 45 10             	mov    0x10(%ebp),%eax
+    1298:	8b 55 08             	mov    0x8(%ebp),%edx
+    129b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    129e:	85 c0                	test   %eax,%eax
+    12a0:	7e 13                	jle    12b5 <memmove+0x25>
+    12a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    12a4:	89 d7                	mov    %edx,%edi
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    12b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    12b1:	39 f8                	cmp    %edi,%eax
+    12b3:	75 fb                	jne    12b0 <memmove+0x20>
+  return vdst;
+}
+    12b5:	5e                   	pop    %esi
+    12b6:	89 d0                	mov    %edx,%eax
+    12b8:	5f                   	pop    %edi
+    12b9:	5d                   	pop    %ebp
+    12ba:	c3                   	ret
+    12bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+
+000012c0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	56                   	push   %esi
+    12c4:	53                   	push   %ebx
+    12c5:	8b 75 10             	mov    0x10(%ebp),%esi
+    12c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    12ce:	85 f6                	test   %esi,%esi
+    12d0:	74 2e                	je     1300 <memcmp+0x40>
+    12d2:	01 c6                	add    %eax,%esi
+    12d4:	eb 14                	jmp    12ea <memcmp+0x2a>
+    12d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    12e0:	83 c0 01             	add    $0x1,%eax
+    12e3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    12e6:	39 f0                	cmp    %esi,%eax
+    12e8:	74 16                	je     1300 <memcmp+0x40>
+    if(*s1 != *s2)
+    12ea:	0f b6 0a             	movzbl (%edx),%ecx
+    12ed:	0f b6 18             	movzbl (%eax),%ebx
+    12f0:	38 d9                	cmp    %bl,%cl
+    12f2:	74 ec                	je     12e0 <memcmp+0x20>
+      return *s1 - *s2;
+    12f4:	0f b6 c1             	movzbl %cl,%eax
+    12f7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    12f9:	5b                   	pop    %ebx
+    12fa:	5e                   	pop    %esi
+    12fb:	5d                   	pop    %ebp
+    12fc:	c3                   	ret
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+    1300:	5b                   	pop    %ebx
+  return 0;
+    1301:	31 c0                	xor    %eax,%eax
+}
+    1303:	5e                   	pop    %esi
+    1304:	5d                   	pop    %ebp
+    1305:	c3                   	ret
+    1306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001310 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1310:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1315:	c3                   	ret
+    1316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    131d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001320 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1320:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1325:	c3                   	ret
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001330 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1330:	a1 20 2c 00 00       	mov    0x2c20,%eax
+    1335:	85 c0                	test   %eax,%eax
+    1337:	74 17                	je     1350 <fork+0x20>
+{
+    1339:	55                   	push   %ebp
+    133a:	89 e5                	mov    %esp,%ebp
+    133c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    133f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1341:	c9                   	leave
+  return _fork();
+    1342:	e9 5d 00 00 00       	jmp    13a4 <_fork>
+    1347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134e:	66 90                	xchg   %ax,%ax
+    1350:	e9 4f 00 00 00       	jmp    13a4 <_fork>
+    1355:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001360 <exit>:
+
+int
+exit(void)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1366:	a1 20 2c 00 00       	mov    0x2c20,%eax
+    136b:	85 c0                	test   %eax,%eax
+    136d:	74 02                	je     1371 <exit+0x11>
+    flushhook();
+    136f:	ff d0                	call   *%eax
+  _exit();
+    1371:	e8 3d 00 00 00       	call   13b3 <_exit>
+    1376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001380 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1380:	55                   	push   %ebp
+  if(flushhook)
+    1381:	a1 20 2c 00 00       	mov    0x2c20,%eax
+{
+    1386:	89 e5                	mov    %esp,%ebp
+    1388:	56                   	push   %esi
+    1389:	53                   	push   %ebx
+    138a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    138d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1390:	85 c0                	test   %eax,%eax
+    1392:	74 02                	je     1396 <exec+0x16>
+    flushhook();
+    1394:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1396:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1399:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    139c:	5b                   	pop    %ebx
+    139d:	5e                   	pop    %esi
+    139e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    139f:	e9 78 00 00 00       	jmp    141c <_exec>
+
+000013a4 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    13a4:	b8 01 00 00 00       	mov    $0x1,%eax
+    13a9:	89 e1                	mov    %esp,%ecx
+    13ab:	ba b2 13 00 00       	mov    $0x13b2,%edx
+    13b0:	0f 34                	sysenter
+    13b2:	c3                   	ret
+
+000013b3 <_exit>:
+RAWSYSCALL(exit)
+    13b3:	b8 02 00 00 00       	mov    $0x2,%eax
+    13b8:	89 e1                	mov    %esp,%ecx
+    13ba:	ba c1 13 00 00       	mov    $0x13c1,%edx
+    13bf:	0f 34                	sysenter
+    13c1:	c3                   	ret
+
+000013c2 <wait>:
+SYSCALL(wait)
+    13c2:	b8 03 00 00 00       	mov    $0x3,%eax
+    13c7:	89 e1                	mov    %esp,%ecx
+    13c9:	ba d0 13 00 00       	mov    $0x13d0,%edx
+    13ce:	0f 34                	sysenter
+    13d0:	c3                   	ret
+
+000013d1 <pipe>:
+SYSCALL(pipe)
+    13d1:	b8 04 00 00 00       	mov    $0x4,%eax
+    13d6:	89 e1                	mov    %esp,%ecx
+    13d8:	ba df 13 00 00       	mov    $0x13df,%edx
+    13dd:	0f 34                	sysenter
+    13df:	c3                   	ret
+
+000013e0 <read>:
+SYSCALL(read)
+    13e0:	b8 05 00 00 00       	mov    $0x5,%eax
+    13e5:	89 e1                	mov    %esp,%ecx
+    13e7:	ba ee 13 00 00       	mov    $0x13ee,%edx
+    13ec:	0f 34                	sysenter
+    13ee:	c3                   	ret
+
+000013ef <write>:
+SYSCALL(write)
+    13ef:	b8 10 00 00 00       	mov    $0x10,%eax
+    13f4:	89 e1                	mov    %esp,%ecx
+    13f6:	ba fd 13 00 00       	mov    $0x13fd,%edx
+    13fb:	0f 34                	sysenter
+    13fd:	c3                   	ret
+
+000013fe <close>:
+SYSCALL(close)
+    13fe:	b8 15 00 00 00       	mov    $0x15,%eax
+    1403:	89 e1                	mov    %esp,%ecx
+    1405:	ba 0c 14 00 00       	mov    $0x140c,%edx
+    140a:	0f 34                	sysenter
+    140c:	c3                   	ret
+
+0000140d <kill>:
+SYSCALL(kill)
+    140d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1412:	89 e1                	mov    %esp,%ecx
+    1414:	ba 1b 14 00 00       	mov    $0x141b,%edx
+    1419:	0f 34                	sysenter
+    141b:	c3                   	ret
+
+0000141c <_exec>:
+RAWSYSCALL(exec)
+    141c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1421:	89 e1                	mov    %esp,%ecx
+    1423:	ba 2a 14 00 00       	mov    $0x142a,%edx
+    1428:	0f 34                	sysenter
+    142a:	c3                   	ret
+
+0000142b <open>:
+SYSCALL(open)
+    142b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1430:	89 e1                	mov    %esp,%ecx
+    1432:	ba 39 14 00 00       	mov    $0x1439,%edx
+    1437:	0f 34                	sysenter
+    1439:	c3                   	ret
+
+0000143a <mknod>:
+SYSCALL(mknod)
+    143a:	b8 11 00 00 00       	mov    $0x11,%eax
+    143f:	89 e1                	mov    %esp,%ecx
+    1441:	ba 48 14 00 00       	mov    $0x1448,%edx
+    1446:	0f 34                	sysenter
+    1448:	c3                   	ret
+
+00001449 <unlink>:
+SYSCALL(unlink)
+    1449:	b8 12 00 00 00       	mov    $0x12,%eax
+    144e:	89 e1                	mov    %esp,%ecx
+    1450:	ba 57 14 00 00       	mov    $0x1457,%edx
+    1455:	0f 34                	sysenter
+    1457:	c3                   	ret
+
+00001458 <fstat>:
+SYSCALL(fstat)
+    1458:	b8 08 00 00 00       	mov    $0x8,%eax
+    145d:	89 e1                	mov    %esp,%ecx
+    145f:	ba 66 14 00 00       	mov    $0x1466,%edx
+    1464:	0f 34                	sysenter
+    1466:	c3                   	ret
+
+00001467 <link>:
+SYSCALL(link)
+    1467:	b8 13 00 00 00       	mov    $0x13,%eax
+    146c:	89 e1                	mov    %esp,%ecx
+    146e:	ba 75 14 00 00       	mov    $0x1475,%edx
+    1473:	0f 34                	sysenter
+    1475:	c3                   	ret
+
+00001476 <mkdir>:
+SYSCALL(mkdir)
+    1476:	b8 14 00 00 00       	mov    $0x14,%eax
+    147b:	89 e1                	mov    %esp,%ecx
+    147d:	ba 84 14 00 00       	mov    $0x1484,%edx
+    1482:	0f 34                	sysenter
+    1484:	c3                   	ret
+
+00001485 <chdir>:
+SYSCALL(chdir)
+    1485:	b8 09 00 00 00       	mov    $0x9,%eax
+    148a:	89 e1                	mov    %esp,%ecx
+    148c:	ba 93 14 00 00       	mov    $0x1493,%edx
+    1491:	0f 34                	sysenter
+    1493:	c3                   	ret
+
+00001494 <dup>:
+SYSCALL(dup)
+    1494:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1499:	89 e1                	mov    %esp,%ecx
+    149b:	ba a2 14 00 00       	mov    $0x14a2,%edx
+    14a0:	0f 34                	sysenter
+    14a2:	c3                   	ret
+
+000014a3 <getpid>:
+SYSCALL(getpid)
+    14a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14a8:	89 e1                	mov    %esp,%ecx
+    14aa:	ba b1 14 00 00       	mov    $0x14b1,%edx
+    14af:	0f 34                	sysenter
+    14b1:	c3                   	ret
+
+000014b2 <sbrk>:
+SYSCALL(sbrk)
+    14b2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14b7:	89 e1                	mov    %esp,%ecx
+    14b9:	ba c0 14 00 00       	mov    $0x14c0,%edx
+    14be:	0f 34                	sysenter
+    14c0:	c3                   	ret
+
+000014c1 <sleep>:
+SYSCALL(sleep)
+    14c1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14c6:	89 e1                	mov    %esp,%ecx
+    14c8:	ba cf 14 00 00       	mov    $0x14cf,%edx
+    14cd:	0f 34                	sysenter
+    14cf:	c3                   	ret
+
+000014d0 <uptime>:
+SYSCALL(uptime)
+    14d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14d5:	89 e1                	mov    %esp,%ecx
+    14d7:	ba de 14 00 00       	mov    $0x14de,%edx
+    14dc:	0f 34                	sysenter
+    14de:	c3                   	ret
+
+000014df <mprotect>:
+SYSCALL(mprotect)
+    14df:	b8 16 00 00 00       	mov    $0x16,%eax
+    14e4:	89 e1                	mov    %esp,%ecx
+    14e6:	ba ed 14 00 00       	mov    $0x14ed,%edx
+    14eb:	0f 34                	sysenter
+    14ed:	c3                   	ret
+
+000014ee <munprotect>:
+SYSCALL(munprotect)
+    14ee:	b8 17 00 00 00       	mov    $0x17,%eax
+    14f3:	89 e1                	mov    %esp,%ecx
+    14f5:	ba fc 14 00 00       	mov    $0x14fc,%edx
+    14fa:	0f 34                	sysenter
+    14fc:	c3                   	ret
+
+000014fd <kstat>:
+SYSCALL(kstat)
+    14fd:	b8 18 00 00 00       	mov    $0x18,%eax
+    1502:	89 e1                	mov    %esp,%ecx
+    1504:	ba 0b 15 00 00       	mov    $0x150b,%edx
+    1509:	0f 34                	sysenter
+    150b:	c3                   	ret
+
+0000150c <fcntl>:
+SYSCALL(fcntl)
+    150c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1511:	89 e1                	mov    %esp,%ecx
+    1513:	ba 1a 15 00 00       	mov    $0x151a,%edx
+    1518:	0f 34                	sysenter
+    151a:	c3                   	ret
+
+0000151b <splice>:
+SYSCALL(splice)
+    151b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1520:	89 e1                	mov    %esp,%ecx
+    1522:	ba 29 15 00 00       	mov    $0x1529,%edx
+    1527:	0f 34                	sysenter
+    1529:	c3                   	ret
+
+0000152a <sendfile>:
+SYSCALL(sendfile)
+    152a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    152f:	89 e1                	mov    %esp,%ecx
+    1531:	ba 38 15 00 00       	mov    $0x1538,%edx
+    1536:	0f 34                	sysenter
+    1538:	c3                   	ret
+
+00001539 <lseek>:
+SYSCALL(lseek)
+    1539:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    153e:	89 e1                	mov    %esp,%ecx
+    1540:	ba 47 15 00 00       	mov    $0x1547,%edx
+    1545:	0f 34                	sysenter
+    1547:	c3                   	ret
+
+00001548 <pread>:
+SYSCALL(pread)
+    1548:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    154d:	89 e1                	mov    %esp,%ecx
+    154f:	ba 56 15 00 00       	mov    $0x1556,%edx
+    1554:	0f 34                	sysenter
+    1556:	c3                   	ret
+
+00001557 <pwrite>:
+SYSCALL(pwrite)
+    1557:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    155c:	89 e1                	mov    %esp,%ecx
+    155e:	ba 65 15 00 00       	mov    $0x1565,%edx
+    1563:	0f 34                	sysenter
+    1565:	c3                   	ret
+
+00001566 <readv>:
+SYSCALL(readv)
+    1566:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    156b:	89 e1                	mov    %esp,%ecx
+    156d:	ba 74 15 00 00       	mov    $0x1574,%edx
+    1572:	0f 34                	sysenter
+    1574:	c3                   	ret
+
+00001575 <writev>:
+SYSCALL(writev)
+    1575:	b8 20 00 00 00       	mov    $0x20,%eax
+    157a:	89 e1                	mov    %esp,%ecx
+    157c:	ba 83 15 00 00       	mov    $0x1583,%edx
+    1581:	0f 34                	sysenter
+    1583:	c3                   	ret
+
+00001584 <ringsetup>:
+SYSCALL(ringsetup)
+    1584:	b8 21 00 00 00       	mov    $0x21,%eax
+    1589:	89 e1                	mov    %esp,%ecx
+    158b:	ba 92 15 00 00       	mov    $0x1592,%edx
+    1590:	0f 34                	sysenter
+    1592:	c3                   	ret
+
+00001593 <ringenter>:
+SYSCALL(ringenter)
+    1593:	b8 22 00 00 00       	mov    $0x22,%eax
+    1598:	89 e1                	mov    %esp,%ecx
+    159a:	ba a1 15 00 00       	mov    $0x15a1,%edx
+    159f:	0f 34                	sysenter
+    15a1:	c3                   	ret
+
+000015a2 <intgetpid>:
+INTSYSCALL(getpid)
+    15a2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    15a7:	cd 40                	int    $0x40
+    15a9:	c3                   	ret
+    15aa:	66 90                	xchg   %ax,%ax
+    15ac:	66 90                	xchg   %ax,%ax
+    15ae:	66 90                	xchg   %ax,%ax
+
+000015b0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    15b0:	55                   	push   %ebp
+    15b1:	89 e5                	mov    %esp,%ebp
+    15b3:	57                   	push   %edi
+    15b4:	56                   	push   %esi
+    15b5:	53                   	push   %ebx
+    15b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    15b8:	89 d1                	mov    %edx,%ecx
+{
+    15ba:	83 ec 2c             	sub    $0x2c,%esp
+    15bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    15c0:	85 d2                	test   %edx,%edx
+    15c2:	0f 89 c0 00 00 00    	jns    1688 <printint+0xd8>
+    15c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    15cc:	0f 84 b6 00 00 00    	je     1688 <printint+0xd8>
+    x = -xx;
+    15d2:	f7 d9                	neg    %ecx
+    neg = 1;
+    15d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    15d9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    15dc:	31 f6                	xor    %esi,%esi
+    15de:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    15e0:	89 c8                	mov    %ecx,%eax
+    15e2:	31 d2                	xor    %edx,%edx
+    15e4:	89 f7                	mov    %esi,%edi
+    15e6:	f7 f3                	div    %ebx
+    15e8:	8d 76 01             	lea    0x1(%esi),%esi
+    15eb:	0f b6 92 1c 23 00 00 	movzbl 0x231c(%edx),%edx
+    15f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    15f6:	89 ca                	mov    %ecx,%edx
+    15f8:	89 c1                	mov    %eax,%ecx
+    15fa:	39 da                	cmp    %ebx,%edx
+    15fc:	73 e2                	jae    15e0 <printint+0x30>
+  if(neg)
+    15fe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1601:	85 c0                	test   %eax,%eax
+    1603:	74 07                	je     160c <printint+0x5c>
+    buf[i++] = '-';
+    1605:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    160a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    160c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    160f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1612:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1614:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1617:	8b 41 08             	mov    0x8(%ecx),%eax
+    161a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    161d:	89 ce                	mov    %ecx,%esi
+    161f:	eb 1c                	jmp    163d <printint+0x8d>
+    1621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1628:	89 c1                	mov    %eax,%ecx
+    162a:	83 c0 01             	add    $0x1,%eax
+    162d:	89 46 08             	mov    %eax,0x8(%esi)
+    1630:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1634:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1637:	39 df                	cmp    %ebx,%edi
+    1639:	74 41                	je     167c <printint+0xcc>
+    163b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    163d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1640:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1645:	75 e1                	jne    1628 <printint+0x78>
+  if(o->f)
+    1647:	8b 06                	mov    (%esi),%eax
+    1649:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    164c:	85 c0                	test   %eax,%eax
+    164e:	74 40                	je     1690 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1650:	50                   	push   %eax
+    1651:	68 80 00 00 00       	push   $0x80
+    1656:	6a 01                	push   $0x1
+    1658:	ff 75 d4             	push   -0x2c(%ebp)
+    165b:	e8 a0 04 00 00       	call   1b00 <fwrite>
+    1660:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1664:	83 c4 10             	add    $0x10,%esp
+}
+    1667:	b8 01 00 00 00       	mov    $0x1,%eax
+    166c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    166e:	89 46 08             	mov    %eax,0x8(%esi)
+    1671:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1675:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1678:	39 df                	cmp    %ebx,%edi
+    167a:	75 bf                	jne    163b <printint+0x8b>
+}
+    167c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    167f:	5b                   	pop    %ebx
+    1680:	5e                   	pop    %esi
+    1681:	5f                   	pop    %edi
+    1682:	5d                   	pop    %ebp
+    1683:	c3                   	ret
+    1684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1688:	31 c0                	xor    %eax,%eax
+    168a:	e9 4a ff ff ff       	jmp    15d9 <printint+0x29>
+    168f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1690:	83 ec 04             	sub    $0x4,%esp
+    1693:	68 80 00 00 00       	push   $0x80
+    1698:	ff 75 d4             	push   -0x2c(%ebp)
+    169b:	ff 76 04             	push   0x4(%esi)
+    169e:	e8 4c fd ff ff       	call   13ef <write>
+    16a3:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    16a7:	83 c4 10             	add    $0x10,%esp
+    16aa:	eb bb                	jmp    1667 <printint+0xb7>
+    16ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000016b0 <putc>:
+{
+    16b0:	55                   	push   %ebp
+    16b1:	89 e5                	mov    %esp,%ebp
+    16b3:	56                   	push   %esi
+    16b4:	89 d6                	mov    %edx,%esi
+    16b6:	53                   	push   %ebx
+    16b7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    16b9:	8b 40 08             	mov    0x8(%eax),%eax
+    16bc:	3d 80 00 00 00       	cmp    $0x80,%eax
+    16c1:	74 1d                	je     16e0 <putc+0x30>
+  o->buf[o->n++] = c;
+    16c3:	89 f1                	mov    %esi,%ecx
+    16c5:	8d 50 01             	lea    0x1(%eax),%edx
+    16c8:	89 53 08             	mov    %edx,0x8(%ebx)
+    16cb:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    16cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16d2:	5b                   	pop    %ebx
+    16d3:	5e                   	pop    %esi
+    16d4:	5d                   	pop    %ebp
+    16d5:	c3                   	ret
+    16d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16dd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    16e0:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    16e2:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    16e5:	85 c0                	test   %eax,%eax
+    16e7:	74 2f                	je     1718 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    16e9:	50                   	push   %eax
+    16ea:	68 80 00 00 00       	push   $0x80
+    16ef:	6a 01                	push   $0x1
+    16f1:	52                   	push   %edx
+    16f2:	e8 09 04 00 00       	call   1b00 <fwrite>
+    16f7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    16fa:	89 f1                	mov    %esi,%ecx
+}
+    16fc:	ba 01 00 00 00       	mov    $0x1,%edx
+    1701:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1703:	89 53 08             	mov    %edx,0x8(%ebx)
+    1706:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    170a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    170d:	5b                   	pop    %ebx
+    170e:	5e                   	pop    %esi
+    170f:	5d                   	pop    %ebp
+    1710:	c3                   	ret
+    1711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1718:	83 ec 04             	sub    $0x4,%esp
+    171b:	68 80 00 00 00       	push   $0x80
+    1720:	52                   	push   %edx
+    1721:	ff 73 04             	push   0x4(%ebx)
+    1724:	e8 c6 fc ff ff       	call   13ef <write>
+    1729:	83 c4 10             	add    $0x10,%esp
+    172c:	eb cc                	jmp    16fa <putc+0x4a>
+    172e:	66 90                	xchg   %ax,%ax
+
+00001730 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1730:	55                   	push   %ebp
+    1731:	89 e5                	mov    %esp,%ebp
+    1733:	57                   	push   %edi
+    1734:	89 c7                	mov    %eax,%edi
+    1736:	56                   	push   %esi
+    1737:	31 f6                	xor    %esi,%esi
+    1739:	53                   	push   %ebx
+    173a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    173d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1740:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1743:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1746:	84 c0                	test   %al,%al
+    1748:	75 1e                	jne    1768 <vprintf.constprop.0+0x38>
+    174a:	eb 53                	jmp    179f <vprintf.constprop.0+0x6f>
+    174c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1750:	83 f8 25             	cmp    $0x25,%eax
+    1753:	74 3b                	je     1790 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1755:	89 ca                	mov    %ecx,%edx
+    1757:	89 f8                	mov    %edi,%eax
+    1759:	e8 52 ff ff ff       	call   16b0 <putc>
+  for(i = 0; fmt[i]; i++){
+    175e:	0f b6 03             	movzbl (%ebx),%eax
+    1761:	83 c3 01             	add    $0x1,%ebx
+    1764:	84 c0                	test   %al,%al
+    1766:	74 37                	je     179f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1768:	0f be c8             	movsbl %al,%ecx
+    176b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    176e:	85 f6                	test   %esi,%esi
+    1770:	74 de                	je     1750 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1772:	83 fe 25             	cmp    $0x25,%esi
+    1775:	75 e7                	jne    175e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1777:	83 f8 25             	cmp    $0x25,%eax
+    177a:	74 4e                	je     17ca <vprintf.constprop.0+0x9a>
+    177c:	83 e8 63             	sub    $0x63,%eax
+    177f:	83 f8 15             	cmp    $0x15,%eax
+    1782:	77 34                	ja     17b8 <vprintf.constprop.0+0x88>
+    1784:	ff 24 85 c4 22 00 00 	jmp    *0x22c4(,%eax,4)
+    178b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    178f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1790:	0f b6 03             	movzbl (%ebx),%eax
+    1793:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1796:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    179b:	84 c0                	test   %al,%al
+    179d:	75 c9                	jne    1768 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    179f:	8b 47 08             	mov    0x8(%edi),%eax
+    17a2:	85 c0                	test   %eax,%eax
+    17a4:	0f 8f de 00 00 00    	jg     1888 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    17aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17ad:	5b                   	pop    %ebx
+    17ae:	5e                   	pop    %esi
+    17af:	5f                   	pop    %edi
+    17b0:	5d                   	pop    %ebp
+    17b1:	c3                   	ret
+    17b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    17b8:	ba 25 00 00 00       	mov    $0x25,%edx
+    17bd:	89 f8                	mov    %edi,%eax
+    17bf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    17c2:	e8 e9 fe ff ff       	call   16b0 <putc>
+        putc(o, c);
+    17c7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    17ca:	89 ca                	mov    %ecx,%edx
+    17cc:	89 f8                	mov    %edi,%eax
+      state = 0;
+    17ce:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    17d0:	e8 db fe ff ff       	call   16b0 <putc>
+    17d5:	eb 87                	jmp    175e <vprintf.constprop.0+0x2e>
+    17d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17de:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    17e0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    17e3:	83 ec 0c             	sub    $0xc,%esp
+    17e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    17eb:	8b 16                	mov    (%esi),%edx
+    17ed:	6a 00                	push   $0x0
+        ap++;
+    17ef:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    17f2:	89 f8                	mov    %edi,%eax
+    17f4:	e8 b7 fd ff ff       	call   15b0 <printint>
+        ap++;
+    17f9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    17fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17ff:	31 f6                	xor    %esi,%esi
+    1801:	e9 58 ff ff ff       	jmp    175e <vprintf.constprop.0+0x2e>
+    1806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1810:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1813:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1815:	83 c0 04             	add    $0x4,%eax
+    1818:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    181b:	85 f6                	test   %esi,%esi
+    181d:	75 1b                	jne    183a <vprintf.constprop.0+0x10a>
+    181f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1824:	be bb 22 00 00       	mov    $0x22bb,%esi
+    1829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1830:	89 f8                	mov    %edi,%eax
+          s++;
+    1832:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1835:	e8 76 fe ff ff       	call   16b0 <putc>
+        while(*s != 0){
+    183a:	0f be 16             	movsbl (%esi),%edx
+    183d:	84 d2                	test   %dl,%dl
+    183f:	75 ef                	jne    1830 <vprintf.constprop.0+0x100>
+      state = 0;
+    1841:	31 f6                	xor    %esi,%esi
+    1843:	e9 16 ff ff ff       	jmp    175e <vprintf.constprop.0+0x2e>
+    1848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1850:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1853:	83 ec 0c             	sub    $0xc,%esp
+    1856:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    185b:	8b 16                	mov    (%esi),%edx
+    185d:	6a 01                	push   $0x1
+    185f:	eb 8e                	jmp    17ef <vprintf.constprop.0+0xbf>
+    1861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1868:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    186b:	89 f8                	mov    %edi,%eax
+    186d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1870:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1873:	e8 38 fe ff ff       	call   16b0 <putc>
+        ap++;
+    1878:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    187b:	31 f6                	xor    %esi,%esi
+    187d:	e9 dc fe ff ff       	jmp    175e <vprintf.constprop.0+0x2e>
+    1882:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1888:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    188a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    188d:	85 d2                	test   %edx,%edx
+    188f:	74 1f                	je     18b0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1891:	52                   	push   %edx
+    1892:	50                   	push   %eax
+    1893:	6a 01                	push   $0x1
+    1895:	51                   	push   %ecx
+    1896:	e8 65 02 00 00       	call   1b00 <fwrite>
+    189b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    189e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    18a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18a8:	5b                   	pop    %ebx
+    18a9:	5e                   	pop    %esi
+    18aa:	5f                   	pop    %edi
+    18ab:	5d                   	pop    %ebp
+    18ac:	c3                   	ret
+    18ad:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    18b0:	83 ec 04             	sub    $0x4,%esp
+    18b3:	50                   	push   %eax
+    18b4:	51                   	push   %ecx
+    18b5:	ff 77 04             	push   0x4(%edi)
+    18b8:	e8 32 fb ff ff       	call   13ef <write>
+    18bd:	83 c4 10             	add    $0x10,%esp
+    18c0:	eb dc                	jmp    189e <vprintf.constprop.0+0x16e>
+    18c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000018d0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    18d0:	55                   	push   %ebp
+    18d1:	89 e5                	mov    %esp,%ebp
+    18d3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18d9:	a1 c4 29 00 00       	mov    0x29c4,%eax
+{
+    18de:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18e1:	83 fa 01             	cmp    $0x1,%edx
+    18e4:	74 0c                	je     18f2 <printf+0x22>
+    18e6:	31 c0                	xor    %eax,%eax
+    18e8:	83 fa 02             	cmp    $0x2,%edx
+    18eb:	0f 44 05 c0 29 00 00 	cmove  0x29c0,%eax
+  o.fd = fd;
+    18f2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18fb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18fe:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1904:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    190a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1911:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1914:	e8 17 fe ff ff       	call   1730 <vprintf.constprop.0>
+}
+    1919:	c9                   	leave
+    191a:	c3                   	ret
+    191b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    191f:	90                   	nop
+
+00001920 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1920:	55                   	push   %ebp
+    1921:	89 e5                	mov    %esp,%ebp
+    1923:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1929:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    192c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    192f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1932:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1939:	ff ff ff 
+  o.n = 0;
+    193c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1943:	00 00 00 
+  o.f = f;
+    1946:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    194c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1952:	e8 d9 fd ff ff       	call   1730 <vprintf.constprop.0>
+}
+    1957:	c9                   	leave
+    1958:	c3                   	ret
+    1959:	66 90                	xchg   %ax,%ax
+    195b:	66 90                	xchg   %ax,%ax
+    195d:	66 90                	xchg   %ax,%ax
+    195f:	90                   	nop
+
+00001960 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1960:	55                   	push   %ebp
+    1961:	89 e5                	mov    %esp,%ebp
+    1963:	53                   	push   %ebx
+    1964:	89 c3                	mov    %eax,%ebx
+    1966:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1969:	8b 40 0c             	mov    0xc(%eax),%eax
+    196c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    196f:	74 17                	je     1988 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1971:	83 f8 02             	cmp    $0x2,%eax
+    1974:	74 07                	je     197d <setmode+0x1d>
+    1976:	8b 43 18             	mov    0x18(%ebx),%eax
+    1979:	85 c0                	test   %eax,%eax
+    197b:	74 38                	je     19b5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    197d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1980:	c9                   	leave
+    1981:	c3                   	ret
+    1982:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1988:	83 ec 08             	sub    $0x8,%esp
+    198b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    198e:	50                   	push   %eax
+    198f:	ff 33                	push   (%ebx)
+    1991:	e8 c2 fa ff ff       	call   1458 <fstat>
+    1996:	83 c4 10             	add    $0x10,%esp
+    1999:	89 c2                	mov    %eax,%edx
+    199b:	31 c0                	xor    %eax,%eax
+    199d:	85 d2                	test   %edx,%edx
+    199f:	75 0a                	jne    19ab <setmode+0x4b>
+    19a1:	31 c0                	xor    %eax,%eax
+    19a3:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    19a8:	0f 94 c0             	sete   %al
+    19ab:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    19ae:	8b 43 18             	mov    0x18(%ebx),%eax
+    19b1:	85 c0                	test   %eax,%eax
+    19b3:	75 c8                	jne    197d <setmode+0x1d>
+    19b5:	83 ec 0c             	sub    $0xc,%esp
+    19b8:	68 00 04 00 00       	push   $0x400
+    19bd:	e8 de 07 00 00       	call   21a0 <malloc>
+    19c2:	83 c4 10             	add    $0x10,%esp
+    19c5:	89 43 18             	mov    %eax,0x18(%ebx)
+    19c8:	85 c0                	test   %eax,%eax
+    19ca:	75 b1                	jne    197d <setmode+0x1d>
+    f->mode = IONBF;
+    19cc:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    19d3:	eb a8                	jmp    197d <setmode+0x1d>
+    19d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000019e0 <drain>:
+{
+    19e0:	55                   	push   %ebp
+    19e1:	89 e5                	mov    %esp,%ebp
+    19e3:	57                   	push   %edi
+    19e4:	56                   	push   %esi
+    19e5:	53                   	push   %ebx
+    19e6:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    19e9:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    19ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    19ef:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19f6:	85 ff                	test   %edi,%edi
+    19f8:	7f 0e                	jg     1a08 <drain+0x28>
+  return 0;
+    19fa:	31 c0                	xor    %eax,%eax
+}
+    19fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19ff:	5b                   	pop    %ebx
+    1a00:	5e                   	pop    %esi
+    1a01:	5f                   	pop    %edi
+    1a02:	5d                   	pop    %ebp
+    1a03:	c3                   	ret
+    1a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1a08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a0b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1a0e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1a10:	eb 0e                	jmp    1a20 <drain+0x40>
+    1a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1a18:	29 c7                	sub    %eax,%edi
+    1a1a:	01 c3                	add    %eax,%ebx
+    1a1c:	85 ff                	test   %edi,%edi
+    1a1e:	7e da                	jle    19fa <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1a20:	83 ec 04             	sub    $0x4,%esp
+    1a23:	57                   	push   %edi
+    1a24:	53                   	push   %ebx
+    1a25:	56                   	push   %esi
+    1a26:	e8 c4 f9 ff ff       	call   13ef <write>
+    1a2b:	83 c4 10             	add    $0x10,%esp
+    1a2e:	85 c0                	test   %eax,%eax
+    1a30:	7f e6                	jg     1a18 <drain+0x38>
+    f->err = 1;
+    1a32:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a35:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1a3c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a41:	eb b9                	jmp    19fc <drain+0x1c>
+    1a43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001a50 <flushall>:
+
+static void
+flushall(void)
+{
+    1a50:	55                   	push   %ebp
+    1a51:	89 e5                	mov    %esp,%ebp
+    1a53:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a54:	bb e0 29 00 00       	mov    $0x29e0,%ebx
+{
+    1a59:	83 ec 04             	sub    $0x4,%esp
+    1a5c:	eb 0d                	jmp    1a6b <flushall+0x1b>
+    1a5e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a60:	83 c3 24             	add    $0x24,%ebx
+    1a63:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1a69:	74 19                	je     1a84 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1a6b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1a6e:	85 c0                	test   %eax,%eax
+    1a70:	74 ee                	je     1a60 <flushall+0x10>
+    1a72:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a74:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1a77:	e8 64 ff ff ff       	call   19e0 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a7c:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1a82:	75 e7                	jne    1a6b <flushall+0x1b>
+}
+    1a84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a87:	c9                   	leave
+    1a88:	c3                   	ret
+    1a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a90 <fflush>:
+{
+    1a90:	55                   	push   %ebp
+    1a91:	89 e5                	mov    %esp,%ebp
+    1a93:	57                   	push   %edi
+    1a94:	56                   	push   %esi
+    1a95:	53                   	push   %ebx
+    1a96:	83 ec 0c             	sub    $0xc,%esp
+    1a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1a9c:	85 c0                	test   %eax,%eax
+    1a9e:	74 28                	je     1ac8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1aa0:	8b 70 08             	mov    0x8(%eax),%esi
+    1aa3:	85 f6                	test   %esi,%esi
+    1aa5:	75 11                	jne    1ab8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1aa7:	83 c4 0c             	add    $0xc,%esp
+    1aaa:	89 f0                	mov    %esi,%eax
+    1aac:	5b                   	pop    %ebx
+    1aad:	5e                   	pop    %esi
+    1aae:	5f                   	pop    %edi
+    1aaf:	5d                   	pop    %ebp
+    1ab0:	c3                   	ret
+    1ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ab8:	83 c4 0c             	add    $0xc,%esp
+    1abb:	5b                   	pop    %ebx
+    1abc:	5e                   	pop    %esi
+    1abd:	5f                   	pop    %edi
+    1abe:	5d                   	pop    %ebp
+  return drain(f);
+    1abf:	e9 1c ff ff ff       	jmp    19e0 <drain>
+    1ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1ac8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1aca:	bb e0 29 00 00       	mov    $0x29e0,%ebx
+        r = -1;
+    1acf:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1ad4:	eb 15                	jmp    1aeb <fflush+0x5b>
+    1ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1add:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ae0:	83 c3 24             	add    $0x24,%ebx
+    1ae3:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1ae9:	74 bc                	je     1aa7 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1aeb:	8b 43 08             	mov    0x8(%ebx),%eax
+    1aee:	85 c0                	test   %eax,%eax
+    1af0:	74 ee                	je     1ae0 <fflush+0x50>
+    1af2:	89 d8                	mov    %ebx,%eax
+    1af4:	e8 e7 fe ff ff       	call   19e0 <drain>
+        r = -1;
+    1af9:	85 c0                	test   %eax,%eax
+    1afb:	0f 48 f7             	cmovs  %edi,%esi
+    1afe:	eb e0                	jmp    1ae0 <fflush+0x50>
+
+00001b00 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1b00:	55                   	push   %ebp
+    1b01:	89 e5                	mov    %esp,%ebp
+    1b03:	57                   	push   %edi
+    1b04:	56                   	push   %esi
+    1b05:	53                   	push   %ebx
+    1b06:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1b09:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1b0c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1b10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1b13:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1b16:	85 d2                	test   %edx,%edx
+    1b18:	0f 8e 26 01 00 00    	jle    1c44 <fwrite+0x144>
+  if(!f->writable){
+    1b1e:	8b 46 08             	mov    0x8(%esi),%eax
+    1b21:	85 c0                	test   %eax,%eax
+    1b23:	0f 84 14 01 00 00    	je     1c3d <fwrite+0x13d>
+  setmode(f);
+    1b29:	89 f0                	mov    %esi,%eax
+    1b2b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1b2e:	e8 2d fe ff ff       	call   1960 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b33:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1b37:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1b3a:	c7 05 20 2c 00 00 50 	movl   $0x1a50,0x2c20
+    1b41:	1a 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b44:	0f 84 b6 00 00 00    	je     1c00 <fwrite+0x100>
+    1b4a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1b50:	0f 8f aa 00 00 00    	jg     1c00 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b56:	8b 46 20             	mov    0x20(%esi),%eax
+    1b59:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1b5c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b5e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b63:	74 6c                	je     1bd1 <fwrite+0xd1>
+    1b65:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1b68:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1b6b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1b70:	29 c2                	sub    %eax,%edx
+    1b72:	39 ca                	cmp    %ecx,%edx
+    1b74:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1b77:	85 d2                	test   %edx,%edx
+    1b79:	0f 8e d1 00 00 00    	jle    1c50 <fwrite+0x150>
+    1b7f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1b82:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1b85:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b8f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1b90:	8d 50 01             	lea    0x1(%eax),%edx
+    1b93:	83 c3 01             	add    $0x1,%ebx
+    1b96:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1b99:	89 56 20             	mov    %edx,0x20(%esi)
+    1b9c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1ba0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1ba3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1ba6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1bab:	80 fa 0a             	cmp    $0xa,%dl
+    1bae:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1bb1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1bb4:	39 cb                	cmp    %ecx,%ebx
+    1bb6:	75 d8                	jne    1b90 <fwrite+0x90>
+    1bb8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1bbb:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1bbe:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1bc1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1bc4:	85 db                	test   %ebx,%ebx
+    1bc6:	7e 19                	jle    1be1 <fwrite+0xe1>
+    n -= k;
+    1bc8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1bca:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1bcf:	75 97                	jne    1b68 <fwrite+0x68>
+    1bd1:	89 f0                	mov    %esi,%eax
+    1bd3:	e8 08 fe ff ff       	call   19e0 <drain>
+    1bd8:	85 c0                	test   %eax,%eax
+    1bda:	78 68                	js     1c44 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1bdc:	8b 46 20             	mov    0x20(%esi),%eax
+    1bdf:	eb 87                	jmp    1b68 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1be1:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1be6:	74 74                	je     1c5c <fwrite+0x15c>
+    1be8:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1bec:	75 04                	jne    1bf2 <fwrite+0xf2>
+    1bee:	85 ff                	test   %edi,%edi
+    1bf0:	75 6a                	jne    1c5c <fwrite+0x15c>
+    return nmemb;
+    1bf2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1bf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bf8:	5b                   	pop    %ebx
+    1bf9:	5e                   	pop    %esi
+    1bfa:	5f                   	pop    %edi
+    1bfb:	5d                   	pop    %ebp
+    1bfc:	c3                   	ret
+    1bfd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1c00:	89 f0                	mov    %esi,%eax
+    1c02:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c05:	e8 d6 fd ff ff       	call   19e0 <drain>
+    1c0a:	85 c0                	test   %eax,%eax
+    1c0c:	78 2f                	js     1c3d <fwrite+0x13d>
+    1c0e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1c11:	8b 3e                	mov    (%esi),%edi
+    1c13:	89 de                	mov    %ebx,%esi
+    1c15:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1c18:	eb 0e                	jmp    1c28 <fwrite+0x128>
+    1c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1c20:	29 c3                	sub    %eax,%ebx
+    1c22:	01 c6                	add    %eax,%esi
+    1c24:	85 db                	test   %ebx,%ebx
+    1c26:	7e ca                	jle    1bf2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1c28:	83 ec 04             	sub    $0x4,%esp
+    1c2b:	53                   	push   %ebx
+    1c2c:	56                   	push   %esi
+    1c2d:	57                   	push   %edi
+    1c2e:	e8 bc f7 ff ff       	call   13ef <write>
+    1c33:	83 c4 10             	add    $0x10,%esp
+    1c36:	85 c0                	test   %eax,%eax
+    1c38:	7f e6                	jg     1c20 <fwrite+0x120>
+    1c3a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1c3d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1c44:	31 c0                	xor    %eax,%eax
+}
+    1c46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c49:	5b                   	pop    %ebx
+    1c4a:	5e                   	pop    %esi
+    1c4b:	5f                   	pop    %edi
+    1c4c:	5d                   	pop    %ebp
+    1c4d:	c3                   	ret
+    1c4e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1c50:	89 d9                	mov    %ebx,%ecx
+    1c52:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1c55:	89 cb                	mov    %ecx,%ebx
+    1c57:	e9 6e ff ff ff       	jmp    1bca <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c5c:	89 f0                	mov    %esi,%eax
+    1c5e:	e8 7d fd ff ff       	call   19e0 <drain>
+    1c63:	85 c0                	test   %eax,%eax
+    1c65:	79 8b                	jns    1bf2 <fwrite+0xf2>
+    return 0;
+    1c67:	31 c0                	xor    %eax,%eax
+    1c69:	eb db                	jmp    1c46 <fwrite+0x146>
+    1c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c6f:	90                   	nop
+
+00001c70 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1c70:	55                   	push   %ebp
+    1c71:	89 e5                	mov    %esp,%ebp
+    1c73:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1c76:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c79:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c7c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1c7f:	ff 75 0c             	push   0xc(%ebp)
+    1c82:	6a 01                	push   $0x1
+    1c84:	6a 01                	push   $0x1
+    1c86:	50                   	push   %eax
+    1c87:	e8 74 fe ff ff       	call   1b00 <fwrite>
+    1c8c:	83 c4 10             	add    $0x10,%esp
+    1c8f:	83 f8 01             	cmp    $0x1,%eax
+    1c92:	75 0c                	jne    1ca0 <fputc+0x30>
+    1c94:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1c98:	c9                   	leave
+    1c99:	c3                   	ret
+    1c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1ca0:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1ca1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1ca6:	c3                   	ret
+    1ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cae:	66 90                	xchg   %ax,%ax
+
+00001cb0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1cb0:	55                   	push   %ebp
+    1cb1:	89 e5                	mov    %esp,%ebp
+    1cb3:	57                   	push   %edi
+    1cb4:	56                   	push   %esi
+    1cb5:	53                   	push   %ebx
+    1cb6:	83 ec 1c             	sub    $0x1c,%esp
+    1cb9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1cbc:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1cbf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1cc2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1cc5:	85 d2                	test   %edx,%edx
+    1cc7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1cca:	7e 12                	jle    1cde <fread+0x2e>
+    1ccc:	85 ff                	test   %edi,%edi
+    1cce:	7e 0e                	jle    1cde <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1cd0:	8b 43 04             	mov    0x4(%ebx),%eax
+    1cd3:	85 c0                	test   %eax,%eax
+    1cd5:	75 19                	jne    1cf0 <fread+0x40>
+    f->err = 1;
+    1cd7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1cde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1ce1:	31 c0                	xor    %eax,%eax
+}
+    1ce3:	5b                   	pop    %ebx
+    1ce4:	5e                   	pop    %esi
+    1ce5:	5f                   	pop    %edi
+    1ce6:	5d                   	pop    %ebp
+    1ce7:	c3                   	ret
+    1ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cef:	90                   	nop
+  setmode(f);
+    1cf0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1cf2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1cf4:	e8 67 fc ff ff       	call   1960 <setmode>
+  for(n = 0; n < want; n += k){
+    1cf9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1cfc:	89 f7                	mov    %esi,%edi
+    1cfe:	eb 31                	jmp    1d31 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1d00:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1d04:	74 08                	je     1d0e <fread+0x5e>
+    1d06:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1d0c:	7e 62                	jle    1d70 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1d0e:	83 ec 04             	sub    $0x4,%esp
+    1d11:	56                   	push   %esi
+    1d12:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d15:	01 f8                	add    %edi,%eax
+    1d17:	50                   	push   %eax
+    1d18:	ff 33                	push   (%ebx)
+    1d1a:	e8 c1 f6 ff ff       	call   13e0 <read>
+    1d1f:	83 c4 10             	add    $0x10,%esp
+    1d22:	85 c0                	test   %eax,%eax
+    1d24:	0f 8e ce 00 00 00    	jle    1df8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1d2a:	01 c7                	add    %eax,%edi
+    1d2c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d2f:	7e 36                	jle    1d67 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d31:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1d34:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1d37:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d3a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1d3c:	39 c1                	cmp    %eax,%ecx
+    1d3e:	7d c0                	jge    1d00 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d40:	29 c8                	sub    %ecx,%eax
+    1d42:	39 f0                	cmp    %esi,%eax
+    1d44:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1d47:	83 ec 04             	sub    $0x4,%esp
+    1d4a:	56                   	push   %esi
+    1d4b:	03 4b 18             	add    0x18(%ebx),%ecx
+    1d4e:	51                   	push   %ecx
+    1d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d52:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1d54:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1d56:	50                   	push   %eax
+    1d57:	e8 34 f5 ff ff       	call   1290 <memmove>
+      f->r += k;
+    1d5c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1d5f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1d62:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d65:	7f ca                	jg     1d31 <fread+0x81>
+    1d67:	89 fe                	mov    %edi,%esi
+    1d69:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d6c:	eb 3f                	jmp    1dad <fread+0xfd>
+    1d6e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1d70:	3b 1d c8 29 00 00    	cmp    0x29c8,%ebx
+    1d76:	74 68                	je     1de0 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d78:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1d7b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1d82:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d89:	68 00 04 00 00       	push   $0x400
+    1d8e:	ff 73 18             	push   0x18(%ebx)
+    1d91:	ff 33                	push   (%ebx)
+    1d93:	e8 48 f6 ff ff       	call   13e0 <read>
+    1d98:	83 c4 10             	add    $0x10,%esp
+    1d9b:	85 c0                	test   %eax,%eax
+    1d9d:	78 21                	js     1dc0 <fread+0x110>
+  else if(n == 0)
+    1d9f:	75 2f                	jne    1dd0 <fread+0x120>
+    f->eof = 1;
+    1da1:	89 fe                	mov    %edi,%esi
+    1da3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1da6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1dad:	89 f0                	mov    %esi,%eax
+}
+    1daf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1db2:	99                   	cltd
+}
+    1db3:	5b                   	pop    %ebx
+    1db4:	5e                   	pop    %esi
+  return n / size;
+    1db5:	f7 ff                	idiv   %edi
+}
+    1db7:	5f                   	pop    %edi
+    1db8:	5d                   	pop    %ebp
+    1db9:	c3                   	ret
+    1dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1dc0:	89 fe                	mov    %edi,%esi
+    1dc2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1dc5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1dcc:	eb df                	jmp    1dad <fread+0xfd>
+    1dce:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1dd0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1dd3:	e9 54 ff ff ff       	jmp    1d2c <fread+0x7c>
+    1dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ddf:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1de0:	83 ec 0c             	sub    $0xc,%esp
+    1de3:	ff 35 c4 29 00 00    	push   0x29c4
+    1de9:	e8 a2 fc ff ff       	call   1a90 <fflush>
+    1dee:	83 c4 10             	add    $0x10,%esp
+    1df1:	eb 85                	jmp    1d78 <fread+0xc8>
+    1df3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1df7:	90                   	nop
+        if(k < 0)
+    1df8:	89 fe                	mov    %edi,%esi
+    1dfa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1dfd:	74 a7                	je     1da6 <fread+0xf6>
+    1dff:	eb c4                	jmp    1dc5 <fread+0x115>
+    1e01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e0f:	90                   	nop
+
+00001e10 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1e10:	55                   	push   %ebp
+    1e11:	89 e5                	mov    %esp,%ebp
+    1e13:	53                   	push   %ebx
+    1e14:	83 ec 14             	sub    $0x14,%esp
+    1e17:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1e1a:	8b 50 04             	mov    0x4(%eax),%edx
+    1e1d:	85 d2                	test   %edx,%edx
+    1e1f:	74 08                	je     1e29 <fgetc+0x19>
+    1e21:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1e24:	3b 50 20             	cmp    0x20(%eax),%edx
+    1e27:	7c 27                	jl     1e50 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e29:	50                   	push   %eax
+    1e2a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1e2d:	6a 01                	push   $0x1
+    1e2f:	6a 01                	push   $0x1
+    1e31:	50                   	push   %eax
+    1e32:	e8 79 fe ff ff       	call   1cb0 <fread>
+    1e37:	83 c4 10             	add    $0x10,%esp
+    1e3a:	83 f8 01             	cmp    $0x1,%eax
+    1e3d:	75 29                	jne    1e68 <fgetc+0x58>
+    1e3f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1e43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e46:	c9                   	leave
+    1e47:	c3                   	ret
+    1e48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e4f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1e50:	8b 48 18             	mov    0x18(%eax),%ecx
+    1e53:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1e56:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1e59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1e5c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1e60:	c9                   	leave
+    1e61:	c3                   	ret
+    1e62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e6d:	eb d4                	jmp    1e43 <fgetc+0x33>
+    1e6f:	90                   	nop
+
+00001e70 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1e70:	55                   	push   %ebp
+    1e71:	89 e5                	mov    %esp,%ebp
+    1e73:	57                   	push   %edi
+    1e74:	56                   	push   %esi
+    1e75:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1e76:	31 db                	xor    %ebx,%ebx
+{
+    1e78:	83 ec 1c             	sub    $0x1c,%esp
+    1e7b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1e7e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1e80:	eb 2e                	jmp    1eb0 <fgets+0x40>
+    1e82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e88:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1e8b:	57                   	push   %edi
+    1e8c:	6a 01                	push   $0x1
+    1e8e:	6a 01                	push   $0x1
+    1e90:	50                   	push   %eax
+    1e91:	e8 1a fe ff ff       	call   1cb0 <fread>
+    1e96:	83 c4 10             	add    $0x10,%esp
+    1e99:	83 f8 01             	cmp    $0x1,%eax
+    1e9c:	75 62                	jne    1f00 <fgets+0x90>
+    1e9e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1ea5:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1ea7:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1eab:	83 f9 0a             	cmp    $0xa,%ecx
+    1eae:	74 34                	je     1ee4 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1eb0:	89 de                	mov    %ebx,%esi
+    1eb2:	83 c3 01             	add    $0x1,%ebx
+    1eb5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1eb8:	7d 46                	jge    1f00 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1eba:	8b 47 04             	mov    0x4(%edi),%eax
+    1ebd:	85 c0                	test   %eax,%eax
+    1ebf:	74 c7                	je     1e88 <fgets+0x18>
+    1ec1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1ec4:	3b 47 20             	cmp    0x20(%edi),%eax
+    1ec7:	7d bf                	jge    1e88 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1ec9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1ecc:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1ed2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1ed5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1ed9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1edb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1edf:	83 f9 0a             	cmp    $0xa,%ecx
+    1ee2:	75 cc                	jne    1eb0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1ee4:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ee7:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1eeb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1eee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ef1:	5b                   	pop    %ebx
+    1ef2:	5e                   	pop    %esi
+    1ef3:	5f                   	pop    %edi
+    1ef4:	5d                   	pop    %ebp
+    1ef5:	c3                   	ret
+    1ef6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1efd:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    1f00:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f03:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    1f07:	31 c0                	xor    %eax,%eax
+    1f09:	85 f6                	test   %esi,%esi
+    1f0b:	74 e1                	je     1eee <fgets+0x7e>
+    1f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f10:	eb dc                	jmp    1eee <fgets+0x7e>
+    1f12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001f20 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    1f20:	55                   	push   %ebp
+    1f21:	89 e5                	mov    %esp,%ebp
+    1f23:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f24:	bb e0 29 00 00       	mov    $0x29e0,%ebx
+{
+    1f29:	83 ec 04             	sub    $0x4,%esp
+    1f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    1f30:	8b 53 04             	mov    0x4(%ebx),%edx
+    1f33:	85 d2                	test   %edx,%edx
+    1f35:	75 07                	jne    1f3e <fdopen+0x1e>
+    1f37:	8b 43 08             	mov    0x8(%ebx),%eax
+    1f3a:	85 c0                	test   %eax,%eax
+    1f3c:	74 1a                	je     1f58 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f3e:	83 c3 24             	add    $0x24,%ebx
+    1f41:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1f47:	75 e7                	jne    1f30 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    1f49:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    1f4b:	89 d8                	mov    %ebx,%eax
+    1f4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f50:	c9                   	leave
+    1f51:	c3                   	ret
+    1f52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    1f58:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1f5e:	74 e9                	je     1f49 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    1f60:	83 ec 04             	sub    $0x4,%esp
+    1f63:	6a 24                	push   $0x24
+    1f65:	6a 00                	push   $0x0
+    1f67:	53                   	push   %ebx
+    1f68:	e8 d3 f1 ff ff       	call   1140 <memset>
+  f->fd = fd;
+    1f6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    1f70:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    1f77:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    1f7a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    1f7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1f7f:	80 38 72             	cmpb   $0x72,(%eax)
+    1f82:	74 14                	je     1f98 <fdopen+0x78>
+    f->writable = 1;
+    1f84:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    1f8b:	89 d8                	mov    %ebx,%eax
+    1f8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f90:	c9                   	leave
+    1f91:	c3                   	ret
+    1f92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    1f98:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    1f9f:	89 d8                	mov    %ebx,%eax
+    1fa1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fa4:	c9                   	leave
+    1fa5:	c3                   	ret
+    1fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001fb0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    1fb0:	55                   	push   %ebp
+    1fb1:	89 e5                	mov    %esp,%ebp
+    1fb3:	56                   	push   %esi
+    1fb4:	53                   	push   %ebx
+    1fb5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    1fb8:	0f b6 06             	movzbl (%esi),%eax
+    1fbb:	3c 72                	cmp    $0x72,%al
+    1fbd:	74 61                	je     2020 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    1fbf:	3c 77                	cmp    $0x77,%al
+    1fc1:	74 7d                	je     2040 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    1fc3:	3c 61                	cmp    $0x61,%al
+    1fc5:	75 49                	jne    2010 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    1fc7:	83 ec 08             	sub    $0x8,%esp
+    1fca:	68 01 02 00 00       	push   $0x201
+    1fcf:	ff 75 08             	push   0x8(%ebp)
+    1fd2:	e8 54 f4 ff ff       	call   142b <open>
+    1fd7:	83 c4 10             	add    $0x10,%esp
+    1fda:	89 c3                	mov    %eax,%ebx
+    1fdc:	85 c0                	test   %eax,%eax
+    1fde:	78 30                	js     2010 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    1fe0:	83 ec 04             	sub    $0x4,%esp
+    1fe3:	6a 02                	push   $0x2
+    1fe5:	6a 00                	push   $0x0
+    1fe7:	50                   	push   %eax
+    1fe8:	e8 4c f5 ff ff       	call   1539 <lseek>
+    1fed:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    1ff0:	83 ec 08             	sub    $0x8,%esp
+    1ff3:	56                   	push   %esi
+    1ff4:	53                   	push   %ebx
+    1ff5:	e8 26 ff ff ff       	call   1f20 <fdopen>
+    1ffa:	83 c4 10             	add    $0x10,%esp
+    1ffd:	85 c0                	test   %eax,%eax
+    1fff:	75 11                	jne    2012 <fopen+0x62>
+    close(fd);
+    2001:	83 ec 0c             	sub    $0xc,%esp
+    2004:	53                   	push   %ebx
+    2005:	e8 f4 f3 ff ff       	call   13fe <close>
+    200a:	83 c4 10             	add    $0x10,%esp
+    200d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2010:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2012:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2015:	5b                   	pop    %ebx
+    2016:	5e                   	pop    %esi
+    2017:	5d                   	pop    %ebp
+    2018:	c3                   	ret
+    2019:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2020:	83 ec 08             	sub    $0x8,%esp
+    2023:	6a 00                	push   $0x0
+    2025:	ff 75 08             	push   0x8(%ebp)
+    2028:	e8 fe f3 ff ff       	call   142b <open>
+    202d:	83 c4 10             	add    $0x10,%esp
+    2030:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2032:	85 db                	test   %ebx,%ebx
+    2034:	78 da                	js     2010 <fopen+0x60>
+    2036:	eb b8                	jmp    1ff0 <fopen+0x40>
+    2038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    203f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2040:	83 ec 08             	sub    $0x8,%esp
+    2043:	68 01 06 00 00       	push   $0x601
+    2048:	ff 75 08             	push   0x8(%ebp)
+    204b:	e8 db f3 ff ff       	call   142b <open>
+    2050:	83 c4 10             	add    $0x10,%esp
+    2053:	89 c3                	mov    %eax,%ebx
+    2055:	eb db                	jmp    2032 <fopen+0x82>
+    2057:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    205e:	66 90                	xchg   %ax,%ax
+
+00002060 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2060:	55                   	push   %ebp
+    2061:	89 e5                	mov    %esp,%ebp
+    2063:	56                   	push   %esi
+    2064:	53                   	push   %ebx
+    2065:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2068:	83 ec 0c             	sub    $0xc,%esp
+    206b:	53                   	push   %ebx
+    206c:	e8 1f fa ff ff       	call   1a90 <fflush>
+    2071:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2073:	58                   	pop    %eax
+    2074:	ff 33                	push   (%ebx)
+    2076:	e8 83 f3 ff ff       	call   13fe <close>
+    207b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    207e:	85 c0                	test   %eax,%eax
+    2080:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2085:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2088:	8b 43 18             	mov    0x18(%ebx),%eax
+    208b:	85 c0                	test   %eax,%eax
+    208d:	0f 95 c1             	setne  %cl
+    2090:	3d 40 30 00 00       	cmp    $0x3040,%eax
+    2095:	0f 95 c2             	setne  %dl
+    2098:	84 d1                	test   %dl,%cl
+    209a:	74 07                	je     20a3 <fclose+0x43>
+    209c:	3d 40 2c 00 00       	cmp    $0x2c40,%eax
+    20a1:	75 25                	jne    20c8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    20a3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    20aa:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    20ac:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    20b3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    20ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    20bd:	5b                   	pop    %ebx
+    20be:	5e                   	pop    %esi
+    20bf:	5d                   	pop    %ebp
+    20c0:	c3                   	ret
+    20c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    20c8:	83 ec 0c             	sub    $0xc,%esp
+    20cb:	50                   	push   %eax
+    20cc:	e8 3f 00 00 00       	call   2110 <free>
+    20d1:	83 c4 10             	add    $0x10,%esp
+    20d4:	eb cd                	jmp    20a3 <fclose+0x43>
+    20d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020e0 <feof>:
+
+int
+feof(FILE *f)
+{
+    20e0:	55                   	push   %ebp
+    20e1:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    20e3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20e6:	5d                   	pop    %ebp
+  return f->eof;
+    20e7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    20ea:	c3                   	ret
+    20eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20ef:	90                   	nop
+
+000020f0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    20f0:	55                   	push   %ebp
+    20f1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    20f3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20f6:	5d                   	pop    %ebp
+  return f->err;
+    20f7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    20fa:	c3                   	ret
+    20fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20ff:	90                   	nop
+
+00002100 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2100:	55                   	push   %ebp
+    2101:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2103:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2106:	5d                   	pop    %ebp
+  return f->fd;
+    2107:	8b 00                	mov    (%eax),%eax
+}
+    2109:	c3                   	ret
+    210a:	66 90                	xchg   %ax,%ax
+    210c:	66 90                	xchg   %ax,%ax
+    210e:	66 90                	xchg   %ax,%ax
+
+00002110 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2110:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2111:	a1 40 34 00 00       	mov    0x3440,%eax
+{
+    2116:	89 e5                	mov    %esp,%ebp
+    2118:	57                   	push   %edi
+    2119:	56                   	push   %esi
+    211a:	53                   	push   %ebx
+    211b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    211e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2121:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2128:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    212a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    212c:	39 ca                	cmp    %ecx,%edx
+    212e:	73 30                	jae    2160 <free+0x50>
+    2130:	39 c1                	cmp    %eax,%ecx
+    2132:	72 04                	jb     2138 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2134:	39 c2                	cmp    %eax,%edx
+    2136:	72 f0                	jb     2128 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2138:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    213b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    213e:	39 f8                	cmp    %edi,%eax
+    2140:	74 2e                	je     2170 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2142:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2145:	8b 42 04             	mov    0x4(%edx),%eax
+    2148:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    214b:	39 f1                	cmp    %esi,%ecx
+    214d:	74 38                	je     2187 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    214f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2151:	5b                   	pop    %ebx
+  freep = p;
+    2152:	89 15 40 34 00 00    	mov    %edx,0x3440
+}
+    2158:	5e                   	pop    %esi
+    2159:	5f                   	pop    %edi
+    215a:	5d                   	pop    %ebp
+    215b:	c3                   	ret
+    215c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2160:	39 c1                	cmp    %eax,%ecx
+    2162:	72 d0                	jb     2134 <free+0x24>
+    2164:	eb c2                	jmp    2128 <free+0x18>
+    2166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    216d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2170:	03 70 04             	add    0x4(%eax),%esi
+    2173:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2176:	8b 02                	mov    (%edx),%eax
+    2178:	8b 00                	mov    (%eax),%eax
+    217a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    217d:	8b 42 04             	mov    0x4(%edx),%eax
+    2180:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2183:	39 f1                	cmp    %esi,%ecx
+    2185:	75 c8                	jne    214f <free+0x3f>
+    p->s.size += bp->s.size;
+    2187:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    218a:	89 15 40 34 00 00    	mov    %edx,0x3440
+    p->s.size += bp->s.size;
+    2190:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2193:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2196:	89 0a                	mov    %ecx,(%edx)
+}
+    2198:	5b                   	pop    %ebx
+    2199:	5e                   	pop    %esi
+    219a:	5f                   	pop    %edi
+    219b:	5d                   	pop    %ebp
+    219c:	c3                   	ret
+    219d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000021a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    21a0:	55                   	push   %ebp
+    21a1:	89 e5                	mov    %esp,%ebp
+    21a3:	57                   	push   %edi
+    21a4:	56                   	push   %esi
+    21a5:	53                   	push   %ebx
+    21a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    21a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    21ac:	8b 15 40 34 00 00    	mov    0x3440,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    21b2:	8d 78 07             	lea    0x7(%eax),%edi
+    21b5:	c1 ef 03             	shr    $0x3,%edi
+    21b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    21bb:	85 d2                	test   %edx,%edx
+    21bd:	0f 84 8d 00 00 00    	je     2250 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    21c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    21c5:	8b 48 04             	mov    0x4(%eax),%ecx
+    21c8:	39 f9                	cmp    %edi,%ecx
+    21ca:	73 64                	jae    2230 <malloc+0x90>
+  if(nu < 4096)
+    21cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    21d1:	39 df                	cmp    %ebx,%edi
+    21d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    21d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    21dd:	eb 0a                	jmp    21e9 <malloc+0x49>
+    21df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    21e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    21e2:	8b 48 04             	mov    0x4(%eax),%ecx
+    21e5:	39 f9                	cmp    %edi,%ecx
+    21e7:	73 47                	jae    2230 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    21e9:	89 c2                	mov    %eax,%edx
+    21eb:	39 05 40 34 00 00    	cmp    %eax,0x3440
+    21f1:	75 ed                	jne    21e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    21f3:	83 ec 0c             	sub    $0xc,%esp
+    21f6:	56                   	push   %esi
+    21f7:	e8 b6 f2 ff ff       	call   14b2 <sbrk>
+  if(p == (char*)-1)
+    21fc:	83 c4 10             	add    $0x10,%esp
+    21ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2202:	74 1c                	je     2220 <malloc+0x80>
+  hp->s.size = nu;
+    2204:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2207:	83 ec 0c             	sub    $0xc,%esp
+    220a:	83 c0 08             	add    $0x8,%eax
+    220d:	50                   	push   %eax
+    220e:	e8 fd fe ff ff       	call   2110 <free>
+  return freep;
+    2213:	8b 15 40 34 00 00    	mov    0x3440,%edx
+      if((p = morecore(nunits)) == 0)
+    2219:	83 c4 10             	add    $0x10,%esp
+    221c:	85 d2                	test   %edx,%edx
+    221e:	75 c0                	jne    21e0 <malloc+0x40>
+        return 0;
+  }
+}
+    2220:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2223:	31 c0                	xor    %eax,%eax
+}
+    2225:	5b                   	pop    %ebx
+    2226:	5e                   	pop    %esi
+    2227:	5f                   	pop    %edi
+    2228:	5d                   	pop    %ebp
+    2229:	c3                   	ret
+    222a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2230:	39 cf                	cmp    %ecx,%edi
+    2232:	74 4c                	je     2280 <malloc+0xe0>
+        p->s.size -= nunits;
+    2234:	29 f9                	sub    %edi,%ecx
+    2236:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2239:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    223c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    223f:	89 15 40 34 00 00    	mov    %edx,0x3440
+}
+    2245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2248:	83 c0 08             	add    $0x8,%eax
+}
+    224b:	5b                   	pop    %ebx
+    224c:	5e                   	pop    %esi
+    224d:	5f                   	pop    %edi
+    224e:	5d                   	pop    %ebp
+    224f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2250:	c7 05 40 34 00 00 44 	movl   $0x3444,0x3440
+    2257:	34 00 00 
+    base.s.size = 0;
+    225a:	b8 44 34 00 00       	mov    $0x3444,%eax
+    base.s.ptr = freep = prevp = &base;
+    225f:	c7 05 44 34 00 00 44 	movl   $0x3444,0x3444
+    2266:	34 00 00 
+    base.s.size = 0;
+    2269:	c7 05 48 34 00 00 00 	movl   $0x0,0x3448
+    2270:	00 00 00 
+    if(p->s.size >= nunits){
+    2273:	e9 54 ff ff ff       	jmp    21cc <malloc+0x2c>
+    2278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    227f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2280:	8b 08                	mov    (%eax),%ecx
+    2282:	89 0a                	mov    %ecx,(%edx)
+    2284:	eb b9                	jmp    223f <malloc+0x9f>
@@ -20,15 +20,17 @@
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
 
-int nbitmap = FSSIZE/(BSIZE*8) + 1;
-int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+uint fssize = FSSIZE;    // Size of file system image (blocks), -s
+uint ninodes = NINODES;  // Number of inodes, -i
+uint fsflags;            // FS_* features, -e and -d
+int nbitmap;
+int ninodeblocks;
+int nlog;     // Number of log blocks, two regions, -l
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
 int fsfd;
 struct superblock sb;
-char zeroes[BSIZE];
 uint freeinode = 1;
 uint freeblock;
 
@@ -40,6 +42,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void dxbuild(uint inum, struct dirent *de, int n);
 
 // convert to intel byte order
 ushort
@@ -64,51 +67,116 @@ xint(uint x)
   return y;
 }
 
+// Parse a size for -s: blocks, or bytes with a K, M or G suffix.
+uint
+parsesize(char *s)
+{
+  char *end;
+  unsigned long long n;
+
+  n = strtoull(s, &end, 0);
+  switch(*end){
+  case 'K': case 'k': n = n * 1024 / BSIZE; end++; break;
+  case 'M': case 'm': n = n * 1024 * 1024 / BSIZE; end++; break;
+  case 'G': case 'g': n = n * 1024 * 1024 * 1024 / BSIZE; end++; break;
+  }
+  if(*end != 0 || n == 0 || n > 0xffffffffULL){
+    fprintf(stderr, "mkfs: bad size %s\n", s);
+    exit(1);
+  }
+  return n;
+}
+
+void
+usage(void)
+{
+  fprintf(stderr, "Usage: mkfs [-e] [-d] [-s size[K|M|G]] [-i ninodes] [-l nlog] fs.img files...\n");
+  exit(1);
+}
+
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
+  int i, cc, fd, argi, nroot;
   uint rootino, inum, off;
-  struct dirent de;
+  struct dirent de, *rootde;
   char buf[BSIZE];
   struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
-  if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+  for(argi = 1; argi < argc && argv[argi][0] == '-'; argi++){
+    if(strcmp(argv[argi], "-e") == 0){
+      fsflags |= FS_EXTENTS;
+      continue;
+    }
+    if(strcmp(argv[argi], "-d") == 0){
+      fsflags |= FS_HTREE;
+      continue;
+    }
+    if(argi + 1 >= argc)
+      usage();
+    if(strcmp(argv[argi], "-s") == 0)
+      fssize = parsesize(argv[++argi]);
+    else if(strcmp(argv[argi], "-i") == 0)
+      ninodes = atoi(argv[++argi]);
+    else if(strcmp(argv[argi], "-l") == 0)
+      nlog = atoi(argv[++argi]);
+    else
+      usage();
+  }
+  if(argi >= argc || ninodes < 2)
+    usage();
+
+  // By default, room in each log region for a header, a
+  // descriptor block and LOGSIZE blocks.  The kernel wants
+  // at least MAXOPBLOCKS blocks in each.
+  if(nlog == 0)
+    nlog = 2*(LOGSIZE+2);
+  if(nlog < 2*(MAXOPBLOCKS+2)){
+    fprintf(stderr, "mkfs: log of %d blocks is too small\n", nlog);
     exit(1);
   }
 
   assert((BSIZE % sizeof(struct dinode)) == 0);
   assert((BSIZE % sizeof(struct dirent)) == 0);
 
-  fsfd = open(argv[1], O_RDWR|O_CREAT|O_TRUNC, 0666);
+  fsfd = open(argv[argi], O_RDWR|O_CREAT|O_TRUNC, 0666);
   if(fsfd < 0){
-    perror(argv[1]);
+    perror(argv[argi]);
     exit(1);
   }
 
-  // 1 fs block = 1 disk sector
+  nbitmap = fssize/BPB + 1;
+  ninodeblocks = ninodes / IPB + 1;
   nmeta = 2 + nlog + ninodeblocks + nbitmap;
-  nblocks = FSSIZE - nmeta;
+  if(fssize <= nmeta){
+    fprintf(stderr, "mkfs: %u blocks is too small\n", fssize);
+    exit(1);
+  }
+  nblocks = fssize - nmeta;
 
-  sb.size = xint(FSSIZE);
+  sb.size = xint(fssize);
   sb.nblocks = xint(nblocks);
-  sb.ninodes = xint(NINODES);
+  sb.ninodes = xint(ninodes);
   sb.nlog = xint(nlog);
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.bsize = xint(BSIZE);
+  sb.flags = xint(fsflags);
 
-  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d bsize %d\n",
+         nmeta, nlog, ninodeblocks, nbitmap, nblocks, fssize, BSIZE);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
-  for(i = 0; i < FSSIZE; i++)
-    wsect(i, zeroes);
+  // Extending the empty file reads back as zeroes.
+  if(ftruncate(fsfd, (off_t)fssize * BSIZE) < 0){
+    perror("ftruncate");
+    exit(1);
+  }
 
   memset(buf, 0, sizeof(buf));
   memmove(buf, &sb, sizeof(sb));
@@ -127,7 +195,10 @@ main(int argc, char *argv[])
   strcpy(de.name, "..");
   iappend(rootino, &de, sizeof(de));
 
-  for(i = 2; i < argc; i++){
+  // Collect the root's entries, to lay them out at the end.
+  rootde = calloc(argc, sizeof(*rootde));
+  nroot = 0;
+  for(i = argi+1; i < argc; i++){
     assert(index(argv[i], '/') == 0);
 
     if((fd = open(argv[i], 0)) < 0){
@@ -144,10 +215,10 @@ main(int argc, char *argv[])
 
     inum = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
+    de = rootde[nroot++];
     de.inum = xshort(inum);
     strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    rootde[nroot-1] = de;
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,12 +226,19 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  if((fsflags & FS_HTREE) && (2 + nroot)*sizeof(de) > BSIZE)
+    dxbuild(rootino, rootde, nroot);
+  else {
+    for(i = 0; i < nroot; i++)
+      iappend(rootino, &rootde[i], sizeof(de));
+
+    // fix size of root inode dir
+    rinode(rootino, &din);
+    off = xint(din.size);
+    off = ((off/BSIZE) + 1) * BSIZE;
+    din.size = xint(off);
+    winode(rootino, &din);
+  }
 
   balloc(freeblock);
 
@@ -170,7 +248,7 @@ main(int argc, char *argv[])
 void
 wsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+  if(lseek(fsfd, (off_t)sec * BSIZE, 0) != (off_t)sec * BSIZE){
     perror("lseek");
     exit(1);
   }
@@ -210,7 +288,7 @@ rinode(uint inum, struct dinode *ip)
 void
 rsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+  if(lseek(fsfd, (off_t)sec * BSIZE, 0) != (off_t)sec * BSIZE){
     perror("lseek");
     exit(1);
   }
@@ -226,6 +304,7 @@ ialloc(ushort type)
   uint inum = freeinode++;
   struct dinode din;
 
+  assert(inum < ninodes);
   bzero(&din, sizeof(din));
   din.type = xshort(type);
   din.nlink = xshort(1);
@@ -238,20 +317,120 @@ void
 balloc(int used)
 {
   uchar buf[BSIZE];
-  int i;
+  int i, b;
 
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
-  bzero(buf, BSIZE);
-  for(i = 0; i < used; i++){
-    buf[i/8] = buf[i/8] | (0x1 << (i%8));
+  if(used > fssize){
+    fprintf(stderr, "mkfs: files need %d blocks, file system has %u\n", used, fssize);
+    exit(1);
+  }
+  for(b = 0; b < used; b += BPB){
+    bzero(buf, BSIZE);
+    for(i = 0; i < BPB && b + i < used; i++){
+      buf[i/8] = buf[i/8] | (0x1 << (i%8));
+    }
+    printf("balloc: write bitmap block at sector %d\n", sb.bmapstart + b/BPB);
+    wsect(sb.bmapstart + b/BPB, buf);
   }
-  printf("balloc: write bitmap block at sector %d\n", sb.bmapstart);
-  wsect(sb.bmapstart, buf);
 }
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the block holding block fbn of the file,
+// allocating it and any indirect blocks on the way.
+uint
+ibmap(struct dinode *din, uint fbn)
+{
+  uint indirect[NINDIRECT];
+  uint level, n, i, x;
+
+  if(fbn < NDIRECT){
+    if(xint(din->addrs[fbn]) == 0){
+      din->addrs[fbn] = xint(freeblock++);
+    }
+    return xint(din->addrs[fbn]);
+  }
+  fbn -= NDIRECT;
+
+  n = NINDIRECT;
+  for(level = 0; level < 3 && fbn >= n; level++){
+    fbn -= n;
+    n *= NINDIRECT;
+  }
+  assert(level < 3);
+
+  if(xint(din->addrs[NDIRECT+level]) == 0){
+    din->addrs[NDIRECT+level] = xint(freeblock++);
+  }
+  x = xint(din->addrs[NDIRECT+level]);
+  do {
+    n /= NINDIRECT;
+    i = fbn / n;
+    fbn %= n;
+    rsect(x, (char*)indirect);
+    if(indirect[i] == 0){
+      indirect[i] = xint(freeblock++);
+      wsect(x, (char*)indirect);
+    }
+    x = xint(indirect[i]);
+  } while(n > 1);
+  return x;
+}
+
+// Like ibmap, for an extent-mapped file.  Files are written
+// in order, so a new block goes at the end of the extents.
+uint
+ebmap(struct dinode *din, uint fbn)
+{
+  struct extblock eb;
+  struct extent *e;
+  uint i, n, sum, bn, next, x;
+
+  // Walk the extents, starting with those in the inode.
+  e = (struct extent*)din->addrs;
+  n = NEXTENT;
+  bn = 0;
+  sum = 0;
+  for(;;){
+    for(i = 0; i < n && xint(e[i].len) != 0; i++){
+      if(fbn < sum + xint(e[i].len))
+        return xint(e[i].start) + fbn - sum;
+      sum += xint(e[i].len);
+    }
+    next = bn ? xint(eb.next) : xint(din->addrs[EXTBLOCK]);
+    if(i < n || next == 0)
+      break;
+    bn = next;
+    rsect(bn, (char*)&eb);
+    e = eb.e;
+    n = NEXTENTB;
+  }
+  assert(fbn == sum);
+
+  x = freeblock++;
+  if(i > 0 && xint(e[i-1].start) + xint(e[i-1].len) == x){
+    e[i-1].len = xint(xint(e[i-1].len) + 1);
+  } else if(i < n){
+    e[i].start = xint(x);
+    e[i].len = xint(1);
+  } else {
+    // Chain a new extent block, and start over in it.
+    if(bn){
+      eb.next = xint(x);
+      wsect(bn, (char*)&eb);
+    } else
+      din->addrs[EXTBLOCK] = xint(x);
+    bn = x;
+    bzero(&eb, sizeof(eb));
+    x = freeblock++;
+    eb.e[0].start = xint(x);
+    eb.e[0].len = xint(1);
+  }
+  if(bn)
+    wsect(bn, (char*)&eb);
+  return x;
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,7 +438,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -268,22 +446,10 @@ iappend(uint inum, void *xp, int n)
   while(n > 0){
     fbn = off / BSIZE;
     assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
+    if(fsflags & FS_EXTENTS)
+      x = ebmap(&din, fbn);
+    else
+      x = ibmap(&din, fbn);
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
     bcopy(p, buf + off - (fbn * BSIZE), n1);
@@ -295,3 +461,65 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Hash of a name; must match dxhash() in fs.c.
+uint
+dxhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+int
+dxcmp(const void *a, const void *b)
+{
+  uint ha, hb;
+
+  ha = dxhash(((struct dirent*)a)->name);
+  hb = dxhash(((struct dirent*)b)->name);
+  return ha < hb ? -1 : ha > hb;
+}
+
+// Append n dirents to directory inum, which holds only . and ..,
+// as a hashed directory (see fs.h): sorted by hash into leaves
+// filled three quarters full, and indexed from block 0.
+void
+dxbuild(uint inum, struct dirent *de, int n)
+{
+  char blk0[BSIZE], leaf[BSIZE];
+  struct dxhead *h;
+  struct dxentry *e;
+  int i, j, nleaf, start[DPB];
+
+  qsort(de, n, sizeof(de[0]), dxcmp);
+  memset(blk0, 0, sizeof(blk0));
+  h = (struct dxhead*)blk0 + DXROOT;
+  e = (struct dxentry*)(h+1);
+  nleaf = 0;
+  for(i = 0; i < n; i = j){
+    // Keep names with the same hash in one leaf.
+    j = i + DPB*3/4 < n ? i + DPB*3/4 : n;
+    while(j < n && dxhash(de[j].name) == dxhash(de[j-1].name))
+      j++;
+    assert(j - i <= DPB && nleaf < DPB - DXROOT - 1);
+    e[nleaf].hash = xint(i == 0 ? 0 : dxhash(de[i].name));
+    e[nleaf].block = xint(1 + nleaf);
+    start[nleaf++] = i;
+  }
+  start[nleaf] = n;
+  h->magic = xshort(DX_MAGIC);
+  h->levels = xint(1);
+  h->count = xint(nleaf);
+  iappend(inum, blk0 + 2*sizeof(*de), BSIZE - 2*sizeof(*de));
+
+  for(i = 0; i < nleaf; i++){
+    memset(leaf, 0, sizeof(leaf));
+    memmove(leaf, &de[start[i]], (start[i+1] - start[i])*sizeof(*de));
+    iappend(inum, leaf, BSIZE);
+  }
+}
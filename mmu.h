@@ -18,6 +18,13 @@
 #define SEG_UDATA 4  // user data+stack
 #define SEG_TSS   5  // this process's task state
 
+// sysenter/sysexit rely on this order: KDATA follows KCODE,
+// and UCODE and UDATA come next.
+#define MSR_SYSENTER_CS  0x174
+#define MSR_SYSENTER_ESP 0x175
+#define MSR_SYSENTER_EIP 0x176
+#define CPUID_SEP        (1<<11)  // cpuinfo(1) %edx: has sysenter
+
 // cpu->gdt[NSEGS] holds the above segments.
 #define NSEGS     6
 
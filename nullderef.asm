@@ -0,0 +1,2666 @@
+
+_nullderef:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+
+int *zeroptr;
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	51                   	push   %ecx
+    100e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "About to read from address 0...\n");
+    1011:	68 48 22 00 00       	push   $0x2248
+    1016:	6a 01                	push   $0x1
+    1018:	e8 73 08 00 00       	call   1890 <printf>
+  printf(1, "Got: %d\n", *zeroptr);
+    101d:	a1 e0 2b 00 00       	mov    0x2be0,%eax
+    1022:	83 c4 0c             	add    $0xc,%esp
+    1025:	ff 30                	push   (%eax)
+    1027:	68 69 22 00 00       	push   $0x2269
+    102c:	6a 01                	push   $0x1
+    102e:	e8 5d 08 00 00       	call   1890 <printf>
+  exit();
+    1033:	e8 e8 02 00 00       	call   1320 <exit>
+    1038:	66 90                	xchg   %ax,%ax
+    103a:	66 90                	xchg   %ax,%ax
+    103c:	66 90                	xchg   %ax,%ax
+    103e:	66 90                	xchg   %ax,%ax
+
+00001040 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1040:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1041:	31 c0                	xor    %eax,%eax
+{
+    1043:	89 e5                	mov    %esp,%ebp
+    1045:	53                   	push   %ebx
+    1046:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1049:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    104c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1050:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1054:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1057:	83 c0 01             	add    $0x1,%eax
+    105a:	84 d2                	test   %dl,%dl
+    105c:	75 f2                	jne    1050 <strcpy+0x10>
+    ;
+  return os;
+}
+    105e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1061:	89 c8                	mov    %ecx,%eax
+    1063:	c9                   	leave
+    1064:	c3                   	ret
+    1065:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001070 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	53                   	push   %ebx
+    1074:	8b 55 08             	mov    0x8(%ebp),%edx
+    1077:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    107a:	0f b6 02             	movzbl (%edx),%eax
+    107d:	84 c0                	test   %al,%al
+    107f:	75 17                	jne    1098 <strcmp+0x28>
+    1081:	eb 3a                	jmp    10bd <strcmp+0x4d>
+    1083:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1087:	90                   	nop
+    1088:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    108c:	83 c2 01             	add    $0x1,%edx
+    108f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1092:	84 c0                	test   %al,%al
+    1094:	74 1a                	je     10b0 <strcmp+0x40>
+    p++, q++;
+    1096:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1098:	0f b6 19             	movzbl (%ecx),%ebx
+    109b:	38 c3                	cmp    %al,%bl
+    109d:	74 e9                	je     1088 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    109f:	29 d8                	sub    %ebx,%eax
+}
+    10a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10a4:	c9                   	leave
+    10a5:	c3                   	ret
+    10a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10b4:	31 c0                	xor    %eax,%eax
+    10b6:	29 d8                	sub    %ebx,%eax
+}
+    10b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10bb:	c9                   	leave
+    10bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10bd:	0f b6 19             	movzbl (%ecx),%ebx
+    10c0:	31 c0                	xor    %eax,%eax
+    10c2:	eb db                	jmp    109f <strcmp+0x2f>
+    10c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10cf:	90                   	nop
+
+000010d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    10d6:	80 3a 00             	cmpb   $0x0,(%edx)
+    10d9:	74 15                	je     10f0 <strlen+0x20>
+    10db:	31 c0                	xor    %eax,%eax
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+    10e0:	83 c0 01             	add    $0x1,%eax
+    10e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    10e7:	89 c1                	mov    %eax,%ecx
+    10e9:	75 f5                	jne    10e0 <strlen+0x10>
+    ;
+  return n;
+}
+    10eb:	89 c8                	mov    %ecx,%eax
+    10ed:	5d                   	pop    %ebp
+    10ee:	c3                   	ret
+    10ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+    10f0:	31 c9                	xor    %ecx,%ecx
+}
+    10f2:	5d                   	pop    %ebp
+    10f3:	89 c8                	mov    %ecx,%eax
+    10f5:	c3                   	ret
+    10f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001100 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1107:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    110a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    110d:	89 d7                	mov    %edx,%edi
+    110f:	fc                   	cld
+    1110:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1112:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1115:	89 d0                	mov    %edx,%eax
+    1117:	c9                   	leave
+    1118:	c3                   	ret
+    1119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001120 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	8b 45 08             	mov    0x8(%ebp),%eax
+    1126:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    112a:	0f b6 10             	movzbl (%eax),%edx
+    112d:	84 d2                	test   %dl,%dl
+    112f:	75 12                	jne    1143 <strchr+0x23>
+    1131:	eb 1d                	jmp    1150 <strchr+0x30>
+    1133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1137:	90                   	nop
+    1138:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    113c:	83 c0 01             	add    $0x1,%eax
+    113f:	84 d2                	test   %dl,%dl
+    1141:	74 0d                	je     1150 <strchr+0x30>
+    if(*s == c)
+    1143:	38 d1                	cmp    %dl,%cl
+    1145:	75 f1                	jne    1138 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1147:	5d                   	pop    %ebp
+    1148:	c3                   	ret
+    1149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1150:	31 c0                	xor    %eax,%eax
+}
+    1152:	5d                   	pop    %ebp
+    1153:	c3                   	ret
+    1154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+
+00001160 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	57                   	push   %edi
+    1164:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1165:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1168:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1169:	31 db                	xor    %ebx,%ebx
+{
+    116b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    116e:	eb 27                	jmp    1197 <gets+0x37>
+    cc = read(0, &c, 1);
+    1170:	83 ec 04             	sub    $0x4,%esp
+    1173:	6a 01                	push   $0x1
+    1175:	56                   	push   %esi
+    1176:	6a 00                	push   $0x0
+    1178:	e8 23 02 00 00       	call   13a0 <read>
+    if(cc < 1)
+    117d:	83 c4 10             	add    $0x10,%esp
+    1180:	85 c0                	test   %eax,%eax
+    1182:	7e 1d                	jle    11a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1184:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1188:	8b 55 08             	mov    0x8(%ebp),%edx
+    118b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    118f:	3c 0a                	cmp    $0xa,%al
+    1191:	74 10                	je     11a3 <gets+0x43>
+    1193:	3c 0d                	cmp    $0xd,%al
+    1195:	74 0c                	je     11a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1197:	89 df                	mov    %ebx,%edi
+    1199:	83 c3 01             	add    $0x1,%ebx
+    119c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    119f:	7c cf                	jl     1170 <gets+0x10>
+    11a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    11a3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    11aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11ad:	5b                   	pop    %ebx
+    11ae:	5e                   	pop    %esi
+    11af:	5f                   	pop    %edi
+    11b0:	5d                   	pop    %ebp
+    11b1:	c3                   	ret
+    11b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	56                   	push   %esi
+    11c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11c5:	83 ec 08             	sub    $0x8,%esp
+    11c8:	6a 00                	push   $0x0
+    11ca:	ff 75 08             	push   0x8(%ebp)
+    11cd:	e8 19 02 00 00       	call   13eb <open>
+  if(fd < 0)
+    11d2:	83 c4 10             	add    $0x10,%esp
+    11d5:	85 c0                	test   %eax,%eax
+    11d7:	78 27                	js     1200 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    11d9:	83 ec 08             	sub    $0x8,%esp
+    11dc:	ff 75 0c             	push   0xc(%ebp)
+    11df:	89 c3                	mov    %eax,%ebx
+    11e1:	50                   	push   %eax
+    11e2:	e8 31 02 00 00       	call   1418 <fstat>
+  close(fd);
+    11e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    11ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+    11ec:	e8 cd 01 00 00       	call   13be <close>
+  return r;
+    11f1:	83 c4 10             	add    $0x10,%esp
+}
+    11f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11f7:	89 f0                	mov    %esi,%eax
+    11f9:	5b                   	pop    %ebx
+    11fa:	5e                   	pop    %esi
+    11fb:	5d                   	pop    %ebp
+    11fc:	c3                   	ret
+    11fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1200:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1205:	eb ed                	jmp    11f4 <stat+0x34>
+    1207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120e:	66 90                	xchg   %ax,%ax
+
+00001210 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	53                   	push   %ebx
+    1214:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1217:	0f be 02             	movsbl (%edx),%eax
+    121a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    121d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1220:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1225:	77 1e                	ja     1245 <atoi+0x35>
+    1227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1230:	83 c2 01             	add    $0x1,%edx
+    1233:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1236:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    123a:	0f be 02             	movsbl (%edx),%eax
+    123d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1240:	80 fb 09             	cmp    $0x9,%bl
+    1243:	76 eb                	jbe    1230 <atoi+0x20>
+  return n;
+}
+    1245:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1248:	89 c8                	mov    %ecx,%eax
+    124a:	c9                   	leave
+    124b:	c3                   	ret
+    124c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001250 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	57                   	push   %edi
+    1254:	56                   	push   %esi
+    1255:	8b 45 10             	mov    0x10(%ebp),%eax
+    1258:	8b 55 08             	mov    0x8(%ebp),%edx
+    125b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    125e:	85 c0                	test   %eax,%eax
+    1260:	7e 13                	jle    1275 <memmove+0x25>
+    1262:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1264:	89 d7                	mov    %edx,%edi
+    1266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1270:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1271:	39 f8                	cmp    %edi,%eax
+    1273:	75 fb                	jne    1270 <memmove+0x20>
+  return vdst;
+}
+    1275:	5e                   	pop    %esi
+    1276:	89 d0                	mov    %edx,%eax
+    1278:	5f                   	pop    %edi
+    1279:	5d                   	pop    %ebp
+    127a:	c3                   	ret
+    127b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    127f:	90                   	nop
+
+00001280 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	56                   	push   %esi
+    1284:	53                   	push   %ebx
+    1285:	8b 75 10             	mov    0x10(%ebp),%esi
+    1288:	8b 55 08             	mov    0x8(%ebp),%edx
+    128b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    128e:	85 f6                	test   %esi,%esi
+    1290:	74 2e                	je     12c0 <memcmp+0x40>
+    1292:	01 c6                	add    %eax,%esi
+    1294:	eb 14                	jmp    12aa <memcmp+0x2a>
+    1296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    12a0:	83 c0 01             	add    $0x1,%eax
+    12a3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    12a6:	39 f0                	cmp    %esi,%eax
+    12a8:	74 16                	je     12c0 <memcmp+0x40>
+    if(*s1 != *s2)
+    12aa:	0f b6 0a             	movzbl (%edx),%ecx
+    12ad:	0f b6 18             	movzbl (%eax),%ebx
+    12b0:	38 d9                	cmp    %bl,%cl
+    12b2:	74 ec                	je     12a0 <memcmp+0x20>
+      return *s1 - *s2;
+    12b4:	0f b6 c1             	movzbl %cl,%eax
+    12b7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    12b9:	5b                   	pop    %ebx
+    12ba:	5e                   	pop    %esi
+    12bb:	5d                   	pop    %ebp
+    12bc:	c3                   	ret
+    12bd:	8d 76 00             	lea    0x0(%esi),%esi
+    12c0:	5b                   	pop    %ebx
+  return 0;
+    12c1:	31 c0                	xor    %eax,%eax
+}
+    12c3:	5e                   	pop    %esi
+    12c4:	5d                   	pop    %ebp
+    12c5:	c3                   	ret
+    12c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012d0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    12d0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    12d5:	c3                   	ret
+    12d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012e0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    12e0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    12e5:	c3                   	ret
+    12e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012f0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    12f0:	a1 e4 2b 00 00       	mov    0x2be4,%eax
+    12f5:	85 c0                	test   %eax,%eax
+    12f7:	74 17                	je     1310 <fork+0x20>
+{
+    12f9:	55                   	push   %ebp
+    12fa:	89 e5                	mov    %esp,%ebp
+    12fc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    12ff:	ff d0                	call   *%eax
+  return _fork();
+}
+    1301:	c9                   	leave
+  return _fork();
+    1302:	e9 5d 00 00 00       	jmp    1364 <_fork>
+    1307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130e:	66 90                	xchg   %ax,%ax
+    1310:	e9 4f 00 00 00       	jmp    1364 <_fork>
+    1315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <exit>:
+
+int
+exit(void)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1326:	a1 e4 2b 00 00       	mov    0x2be4,%eax
+    132b:	85 c0                	test   %eax,%eax
+    132d:	74 02                	je     1331 <exit+0x11>
+    flushhook();
+    132f:	ff d0                	call   *%eax
+  _exit();
+    1331:	e8 3d 00 00 00       	call   1373 <_exit>
+    1336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001340 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1340:	55                   	push   %ebp
+  if(flushhook)
+    1341:	a1 e4 2b 00 00       	mov    0x2be4,%eax
+{
+    1346:	89 e5                	mov    %esp,%ebp
+    1348:	56                   	push   %esi
+    1349:	53                   	push   %ebx
+    134a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    134d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1350:	85 c0                	test   %eax,%eax
+    1352:	74 02                	je     1356 <exec+0x16>
+    flushhook();
+    1354:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1356:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1359:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    135c:	5b                   	pop    %ebx
+    135d:	5e                   	pop    %esi
+    135e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    135f:	e9 78 00 00 00       	jmp    13dc <_exec>
+
+00001364 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1364:	b8 01 00 00 00       	mov    $0x1,%eax
+    1369:	89 e1                	mov    %esp,%ecx
+    136b:	ba 72 13 00 00       	mov    $0x1372,%edx
+    1370:	0f 34                	sysenter
+    1372:	c3                   	ret
+
+00001373 <_exit>:
+RAWSYSCALL(exit)
+    1373:	b8 02 00 00 00       	mov    $0x2,%eax
+    1378:	89 e1                	mov    %esp,%ecx
+    137a:	ba 81 13 00 00       	mov    $0x1381,%edx
+    137f:	0f 34                	sysenter
+    1381:	c3                   	ret
+
+00001382 <wait>:
+SYSCALL(wait)
+    1382:	b8 03 00 00 00       	mov    $0x3,%eax
+    1387:	89 e1                	mov    %esp,%ecx
+    1389:	ba 90 13 00 00       	mov    $0x1390,%edx
+    138e:	0f 34                	sysenter
+    1390:	c3                   	ret
+
+00001391 <pipe>:
+SYSCALL(pipe)
+    1391:	b8 04 00 00 00       	mov    $0x4,%eax
+    1396:	89 e1                	mov    %esp,%ecx
+    1398:	ba 9f 13 00 00       	mov    $0x139f,%edx
+    139d:	0f 34                	sysenter
+    139f:	c3                   	ret
+
+000013a0 <read>:
+SYSCALL(read)
+    13a0:	b8 05 00 00 00       	mov    $0x5,%eax
+    13a5:	89 e1                	mov    %esp,%ecx
+    13a7:	ba ae 13 00 00       	mov    $0x13ae,%edx
+    13ac:	0f 34                	sysenter
+    13ae:	c3                   	ret
+
+000013af <write>:
+SYSCALL(write)
+    13af:	b8 10 00 00 00       	mov    $0x10,%eax
+    13b4:	89 e1                	mov    %esp,%ecx
+    13b6:	ba bd 13 00 00       	mov    $0x13bd,%edx
+    13bb:	0f 34                	sysenter
+    13bd:	c3                   	ret
+
+000013be <close>:
+SYSCALL(close)
+    13be:	b8 15 00 00 00       	mov    $0x15,%eax
+    13c3:	89 e1                	mov    %esp,%ecx
+    13c5:	ba cc 13 00 00       	mov    $0x13cc,%edx
+    13ca:	0f 34                	sysenter
+    13cc:	c3                   	ret
+
+000013cd <kill>:
+SYSCALL(kill)
+    13cd:	b8 06 00 00 00       	mov    $0x6,%eax
+    13d2:	89 e1                	mov    %esp,%ecx
+    13d4:	ba db 13 00 00       	mov    $0x13db,%edx
+    13d9:	0f 34                	sysenter
+    13db:	c3                   	ret
+
+000013dc <_exec>:
+RAWSYSCALL(exec)
+    13dc:	b8 07 00 00 00       	mov    $0x7,%eax
+    13e1:	89 e1                	mov    %esp,%ecx
+    13e3:	ba ea 13 00 00       	mov    $0x13ea,%edx
+    13e8:	0f 34                	sysenter
+    13ea:	c3                   	ret
+
+000013eb <open>:
+SYSCALL(open)
+    13eb:	b8 0f 00 00 00       	mov    $0xf,%eax
+    13f0:	89 e1                	mov    %esp,%ecx
+    13f2:	ba f9 13 00 00       	mov    $0x13f9,%edx
+    13f7:	0f 34                	sysenter
+    13f9:	c3                   	ret
+
+000013fa <mknod>:
+SYSCALL(mknod)
+    13fa:	b8 11 00 00 00       	mov    $0x11,%eax
+    13ff:	89 e1                	mov    %esp,%ecx
+    1401:	ba 08 14 00 00       	mov    $0x1408,%edx
+    1406:	0f 34                	sysenter
+    1408:	c3                   	ret
+
+00001409 <unlink>:
+SYSCALL(unlink)
+    1409:	b8 12 00 00 00       	mov    $0x12,%eax
+    140e:	89 e1                	mov    %esp,%ecx
+    1410:	ba 17 14 00 00       	mov    $0x1417,%edx
+    1415:	0f 34                	sysenter
+    1417:	c3                   	ret
+
+00001418 <fstat>:
+SYSCALL(fstat)
+    1418:	b8 08 00 00 00       	mov    $0x8,%eax
+    141d:	89 e1                	mov    %esp,%ecx
+    141f:	ba 26 14 00 00       	mov    $0x1426,%edx
+    1424:	0f 34                	sysenter
+    1426:	c3                   	ret
+
+00001427 <link>:
+SYSCALL(link)
+    1427:	b8 13 00 00 00       	mov    $0x13,%eax
+    142c:	89 e1                	mov    %esp,%ecx
+    142e:	ba 35 14 00 00       	mov    $0x1435,%edx
+    1433:	0f 34                	sysenter
+    1435:	c3                   	ret
+
+00001436 <mkdir>:
+SYSCALL(mkdir)
+    1436:	b8 14 00 00 00       	mov    $0x14,%eax
+    143b:	89 e1                	mov    %esp,%ecx
+    143d:	ba 44 14 00 00       	mov    $0x1444,%edx
+    1442:	0f 34                	sysenter
+    1444:	c3                   	ret
+
+00001445 <chdir>:
+SYSCALL(chdir)
+    1445:	b8 09 00 00 00       	mov    $0x9,%eax
+    144a:	89 e1                	mov    %esp,%ecx
+    144c:	ba 53 14 00 00       	mov    $0x1453,%edx
+    1451:	0f 34                	sysenter
+    1453:	c3                   	ret
+
+00001454 <dup>:
+SYSCALL(dup)
+    1454:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1459:	89 e1                	mov    %esp,%ecx
+    145b:	ba 62 14 00 00       	mov    $0x1462,%edx
+    1460:	0f 34                	sysenter
+    1462:	c3                   	ret
+
+00001463 <getpid>:
+SYSCALL(getpid)
+    1463:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1468:	89 e1                	mov    %esp,%ecx
+    146a:	ba 71 14 00 00       	mov    $0x1471,%edx
+    146f:	0f 34                	sysenter
+    1471:	c3                   	ret
+
+00001472 <sbrk>:
+SYSCALL(sbrk)
+    1472:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1477:	89 e1                	mov    %esp,%ecx
+    1479:	ba 80 14 00 00       	mov    $0x1480,%edx
+    147e:	0f 34                	sysenter
+    1480:	c3                   	ret
+
+00001481 <sleep>:
+SYSCALL(sleep)
+    1481:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1486:	89 e1                	mov    %esp,%ecx
+    1488:	ba 8f 14 00 00       	mov    $0x148f,%edx
+    148d:	0f 34                	sysenter
+    148f:	c3                   	ret
+
+00001490 <uptime>:
+SYSCALL(uptime)
+    1490:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1495:	89 e1                	mov    %esp,%ecx
+    1497:	ba 9e 14 00 00       	mov    $0x149e,%edx
+    149c:	0f 34                	sysenter
+    149e:	c3                   	ret
+
+0000149f <mprotect>:
+SYSCALL(mprotect)
+    149f:	b8 16 00 00 00       	mov    $0x16,%eax
+    14a4:	89 e1                	mov    %esp,%ecx
+    14a6:	ba ad 14 00 00       	mov    $0x14ad,%edx
+    14ab:	0f 34                	sysenter
+    14ad:	c3                   	ret
+
+000014ae <munprotect>:
+SYSCALL(munprotect)
+    14ae:	b8 17 00 00 00       	mov    $0x17,%eax
+    14b3:	89 e1                	mov    %esp,%ecx
+    14b5:	ba bc 14 00 00       	mov    $0x14bc,%edx
+    14ba:	0f 34                	sysenter
+    14bc:	c3                   	ret
+
+000014bd <kstat>:
+SYSCALL(kstat)
+    14bd:	b8 18 00 00 00       	mov    $0x18,%eax
+    14c2:	89 e1                	mov    %esp,%ecx
+    14c4:	ba cb 14 00 00       	mov    $0x14cb,%edx
+    14c9:	0f 34                	sysenter
+    14cb:	c3                   	ret
+
+000014cc <fcntl>:
+SYSCALL(fcntl)
+    14cc:	b8 19 00 00 00       	mov    $0x19,%eax
+    14d1:	89 e1                	mov    %esp,%ecx
+    14d3:	ba da 14 00 00       	mov    $0x14da,%edx
+    14d8:	0f 34                	sysenter
+    14da:	c3                   	ret
+
+000014db <splice>:
+SYSCALL(splice)
+    14db:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14e0:	89 e1                	mov    %esp,%ecx
+    14e2:	ba e9 14 00 00       	mov    $0x14e9,%edx
+    14e7:	0f 34                	sysenter
+    14e9:	c3                   	ret
+
+000014ea <sendfile>:
+SYSCALL(sendfile)
+    14ea:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    14ef:	89 e1                	mov    %esp,%ecx
+    14f1:	ba f8 14 00 00       	mov    $0x14f8,%edx
+    14f6:	0f 34                	sysenter
+    14f8:	c3                   	ret
+
+000014f9 <lseek>:
+SYSCALL(lseek)
+    14f9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    14fe:	89 e1                	mov    %esp,%ecx
+    1500:	ba 07 15 00 00       	mov    $0x1507,%edx
+    1505:	0f 34                	sysenter
+    1507:	c3                   	ret
+
+00001508 <pread>:
+SYSCALL(pread)
+    1508:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    150d:	89 e1                	mov    %esp,%ecx
+    150f:	ba 16 15 00 00       	mov    $0x1516,%edx
+    1514:	0f 34                	sysenter
+    1516:	c3                   	ret
+
+00001517 <pwrite>:
+SYSCALL(pwrite)
+    1517:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    151c:	89 e1                	mov    %esp,%ecx
+    151e:	ba 25 15 00 00       	mov    $0x1525,%edx
+    1523:	0f 34                	sysenter
+    1525:	c3                   	ret
+
+00001526 <readv>:
+SYSCALL(readv)
+    1526:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    152b:	89 e1                	mov    %esp,%ecx
+    152d:	ba 34 15 00 00       	mov    $0x1534,%edx
+    1532:	0f 34                	sysenter
+    1534:	c3                   	ret
+
+00001535 <writev>:
+SYSCALL(writev)
+    1535:	b8 20 00 00 00       	mov    $0x20,%eax
+    153a:	89 e1                	mov    %esp,%ecx
+    153c:	ba 43 15 00 00       	mov    $0x1543,%edx
+    1541:	0f 34                	sysenter
+    1543:	c3                   	ret
+
+00001544 <ringsetup>:
+SYSCALL(ringsetup)
+    1544:	b8 21 00 00 00       	mov    $0x21,%eax
+    1549:	89 e1                	mov    %esp,%ecx
+    154b:	ba 52 15 00 00       	mov    $0x1552,%edx
+    1550:	0f 34                	sysenter
+    1552:	c3                   	ret
+
+00001553 <ringenter>:
+SYSCALL(ringenter)
+    1553:	b8 22 00 00 00       	mov    $0x22,%eax
+    1558:	89 e1                	mov    %esp,%ecx
+    155a:	ba 61 15 00 00       	mov    $0x1561,%edx
+    155f:	0f 34                	sysenter
+    1561:	c3                   	ret
+
+00001562 <intgetpid>:
+INTSYSCALL(getpid)
+    1562:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1567:	cd 40                	int    $0x40
+    1569:	c3                   	ret
+    156a:	66 90                	xchg   %ax,%ax
+    156c:	66 90                	xchg   %ax,%ax
+    156e:	66 90                	xchg   %ax,%ax
+
+00001570 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+    1573:	57                   	push   %edi
+    1574:	56                   	push   %esi
+    1575:	53                   	push   %ebx
+    1576:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1578:	89 d1                	mov    %edx,%ecx
+{
+    157a:	83 ec 2c             	sub    $0x2c,%esp
+    157d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1580:	85 d2                	test   %edx,%edx
+    1582:	0f 89 c0 00 00 00    	jns    1648 <printint+0xd8>
+    1588:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    158c:	0f 84 b6 00 00 00    	je     1648 <printint+0xd8>
+    x = -xx;
+    1592:	f7 d9                	neg    %ecx
+    neg = 1;
+    1594:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1599:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    159c:	31 f6                	xor    %esi,%esi
+    159e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    15a0:	89 c8                	mov    %ecx,%eax
+    15a2:	31 d2                	xor    %edx,%edx
+    15a4:	89 f7                	mov    %esi,%edi
+    15a6:	f7 f3                	div    %ebx
+    15a8:	8d 76 01             	lea    0x1(%esi),%esi
+    15ab:	0f b6 92 d4 22 00 00 	movzbl 0x22d4(%edx),%edx
+    15b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    15b6:	89 ca                	mov    %ecx,%edx
+    15b8:	89 c1                	mov    %eax,%ecx
+    15ba:	39 da                	cmp    %ebx,%edx
+    15bc:	73 e2                	jae    15a0 <printint+0x30>
+  if(neg)
+    15be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    15c1:	85 c0                	test   %eax,%eax
+    15c3:	74 07                	je     15cc <printint+0x5c>
+    buf[i++] = '-';
+    15c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    15ca:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    15cc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    15cf:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    15d2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    15d4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    15d7:	8b 41 08             	mov    0x8(%ecx),%eax
+    15da:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    15dd:	89 ce                	mov    %ecx,%esi
+    15df:	eb 1c                	jmp    15fd <printint+0x8d>
+    15e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    15e8:	89 c1                	mov    %eax,%ecx
+    15ea:	83 c0 01             	add    $0x1,%eax
+    15ed:	89 46 08             	mov    %eax,0x8(%esi)
+    15f0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    15f4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    15f7:	39 df                	cmp    %ebx,%edi
+    15f9:	74 41                	je     163c <printint+0xcc>
+    15fb:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    15fd:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1600:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1605:	75 e1                	jne    15e8 <printint+0x78>
+  if(o->f)
+    1607:	8b 06                	mov    (%esi),%eax
+    1609:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    160c:	85 c0                	test   %eax,%eax
+    160e:	74 40                	je     1650 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1610:	50                   	push   %eax
+    1611:	68 80 00 00 00       	push   $0x80
+    1616:	6a 01                	push   $0x1
+    1618:	ff 75 d4             	push   -0x2c(%ebp)
+    161b:	e8 a0 04 00 00       	call   1ac0 <fwrite>
+    1620:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1624:	83 c4 10             	add    $0x10,%esp
+}
+    1627:	b8 01 00 00 00       	mov    $0x1,%eax
+    162c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    162e:	89 46 08             	mov    %eax,0x8(%esi)
+    1631:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1635:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1638:	39 df                	cmp    %ebx,%edi
+    163a:	75 bf                	jne    15fb <printint+0x8b>
+}
+    163c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    163f:	5b                   	pop    %ebx
+    1640:	5e                   	pop    %esi
+    1641:	5f                   	pop    %edi
+    1642:	5d                   	pop    %ebp
+    1643:	c3                   	ret
+    1644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1648:	31 c0                	xor    %eax,%eax
+    164a:	e9 4a ff ff ff       	jmp    1599 <printint+0x29>
+    164f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1650:	83 ec 04             	sub    $0x4,%esp
+    1653:	68 80 00 00 00       	push   $0x80
+    1658:	ff 75 d4             	push   -0x2c(%ebp)
+    165b:	ff 76 04             	push   0x4(%esi)
+    165e:	e8 4c fd ff ff       	call   13af <write>
+    1663:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1667:	83 c4 10             	add    $0x10,%esp
+    166a:	eb bb                	jmp    1627 <printint+0xb7>
+    166c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001670 <putc>:
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	56                   	push   %esi
+    1674:	89 d6                	mov    %edx,%esi
+    1676:	53                   	push   %ebx
+    1677:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1679:	8b 40 08             	mov    0x8(%eax),%eax
+    167c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1681:	74 1d                	je     16a0 <putc+0x30>
+  o->buf[o->n++] = c;
+    1683:	89 f1                	mov    %esi,%ecx
+    1685:	8d 50 01             	lea    0x1(%eax),%edx
+    1688:	89 53 08             	mov    %edx,0x8(%ebx)
+    168b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    168f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1692:	5b                   	pop    %ebx
+    1693:	5e                   	pop    %esi
+    1694:	5d                   	pop    %ebp
+    1695:	c3                   	ret
+    1696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    16a0:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    16a2:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    16a5:	85 c0                	test   %eax,%eax
+    16a7:	74 2f                	je     16d8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    16a9:	50                   	push   %eax
+    16aa:	68 80 00 00 00       	push   $0x80
+    16af:	6a 01                	push   $0x1
+    16b1:	52                   	push   %edx
+    16b2:	e8 09 04 00 00       	call   1ac0 <fwrite>
+    16b7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    16ba:	89 f1                	mov    %esi,%ecx
+}
+    16bc:	ba 01 00 00 00       	mov    $0x1,%edx
+    16c1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    16c3:	89 53 08             	mov    %edx,0x8(%ebx)
+    16c6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    16ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16cd:	5b                   	pop    %ebx
+    16ce:	5e                   	pop    %esi
+    16cf:	5d                   	pop    %ebp
+    16d0:	c3                   	ret
+    16d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    16d8:	83 ec 04             	sub    $0x4,%esp
+    16db:	68 80 00 00 00       	push   $0x80
+    16e0:	52                   	push   %edx
+    16e1:	ff 73 04             	push   0x4(%ebx)
+    16e4:	e8 c6 fc ff ff       	call   13af <write>
+    16e9:	83 c4 10             	add    $0x10,%esp
+    16ec:	eb cc                	jmp    16ba <putc+0x4a>
+    16ee:	66 90                	xchg   %ax,%ax
+
+000016f0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    16f0:	55                   	push   %ebp
+    16f1:	89 e5                	mov    %esp,%ebp
+    16f3:	57                   	push   %edi
+    16f4:	89 c7                	mov    %eax,%edi
+    16f6:	56                   	push   %esi
+    16f7:	31 f6                	xor    %esi,%esi
+    16f9:	53                   	push   %ebx
+    16fa:	8d 5a 01             	lea    0x1(%edx),%ebx
+    16fd:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1700:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1703:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1706:	84 c0                	test   %al,%al
+    1708:	75 1e                	jne    1728 <vprintf.constprop.0+0x38>
+    170a:	eb 53                	jmp    175f <vprintf.constprop.0+0x6f>
+    170c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1710:	83 f8 25             	cmp    $0x25,%eax
+    1713:	74 3b                	je     1750 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1715:	89 ca                	mov    %ecx,%edx
+    1717:	89 f8                	mov    %edi,%eax
+    1719:	e8 52 ff ff ff       	call   1670 <putc>
+  for(i = 0; fmt[i]; i++){
+    171e:	0f b6 03             	movzbl (%ebx),%eax
+    1721:	83 c3 01             	add    $0x1,%ebx
+    1724:	84 c0                	test   %al,%al
+    1726:	74 37                	je     175f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1728:	0f be c8             	movsbl %al,%ecx
+    172b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    172e:	85 f6                	test   %esi,%esi
+    1730:	74 de                	je     1710 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1732:	83 fe 25             	cmp    $0x25,%esi
+    1735:	75 e7                	jne    171e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1737:	83 f8 25             	cmp    $0x25,%eax
+    173a:	74 4e                	je     178a <vprintf.constprop.0+0x9a>
+    173c:	83 e8 63             	sub    $0x63,%eax
+    173f:	83 f8 15             	cmp    $0x15,%eax
+    1742:	77 34                	ja     1778 <vprintf.constprop.0+0x88>
+    1744:	ff 24 85 7c 22 00 00 	jmp    *0x227c(,%eax,4)
+    174b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    174f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1750:	0f b6 03             	movzbl (%ebx),%eax
+    1753:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1756:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    175b:	84 c0                	test   %al,%al
+    175d:	75 c9                	jne    1728 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    175f:	8b 47 08             	mov    0x8(%edi),%eax
+    1762:	85 c0                	test   %eax,%eax
+    1764:	0f 8f de 00 00 00    	jg     1848 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    176a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    176d:	5b                   	pop    %ebx
+    176e:	5e                   	pop    %esi
+    176f:	5f                   	pop    %edi
+    1770:	5d                   	pop    %ebp
+    1771:	c3                   	ret
+    1772:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1778:	ba 25 00 00 00       	mov    $0x25,%edx
+    177d:	89 f8                	mov    %edi,%eax
+    177f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1782:	e8 e9 fe ff ff       	call   1670 <putc>
+        putc(o, c);
+    1787:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    178a:	89 ca                	mov    %ecx,%edx
+    178c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    178e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1790:	e8 db fe ff ff       	call   1670 <putc>
+    1795:	eb 87                	jmp    171e <vprintf.constprop.0+0x2e>
+    1797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    179e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    17a0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    17a3:	83 ec 0c             	sub    $0xc,%esp
+    17a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    17ab:	8b 16                	mov    (%esi),%edx
+    17ad:	6a 00                	push   $0x0
+        ap++;
+    17af:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    17b2:	89 f8                	mov    %edi,%eax
+    17b4:	e8 b7 fd ff ff       	call   1570 <printint>
+        ap++;
+    17b9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    17bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17bf:	31 f6                	xor    %esi,%esi
+    17c1:	e9 58 ff ff ff       	jmp    171e <vprintf.constprop.0+0x2e>
+    17c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    17d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    17d3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    17d5:	83 c0 04             	add    $0x4,%eax
+    17d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    17db:	85 f6                	test   %esi,%esi
+    17dd:	75 1b                	jne    17fa <vprintf.constprop.0+0x10a>
+    17df:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    17e4:	be 72 22 00 00       	mov    $0x2272,%esi
+    17e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    17f0:	89 f8                	mov    %edi,%eax
+          s++;
+    17f2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    17f5:	e8 76 fe ff ff       	call   1670 <putc>
+        while(*s != 0){
+    17fa:	0f be 16             	movsbl (%esi),%edx
+    17fd:	84 d2                	test   %dl,%dl
+    17ff:	75 ef                	jne    17f0 <vprintf.constprop.0+0x100>
+      state = 0;
+    1801:	31 f6                	xor    %esi,%esi
+    1803:	e9 16 ff ff ff       	jmp    171e <vprintf.constprop.0+0x2e>
+    1808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1810:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1813:	83 ec 0c             	sub    $0xc,%esp
+    1816:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    181b:	8b 16                	mov    (%esi),%edx
+    181d:	6a 01                	push   $0x1
+    181f:	eb 8e                	jmp    17af <vprintf.constprop.0+0xbf>
+    1821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1828:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    182b:	89 f8                	mov    %edi,%eax
+    182d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1830:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1833:	e8 38 fe ff ff       	call   1670 <putc>
+        ap++;
+    1838:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    183b:	31 f6                	xor    %esi,%esi
+    183d:	e9 dc fe ff ff       	jmp    171e <vprintf.constprop.0+0x2e>
+    1842:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1848:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    184a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    184d:	85 d2                	test   %edx,%edx
+    184f:	74 1f                	je     1870 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1851:	52                   	push   %edx
+    1852:	50                   	push   %eax
+    1853:	6a 01                	push   $0x1
+    1855:	51                   	push   %ecx
+    1856:	e8 65 02 00 00       	call   1ac0 <fwrite>
+    185b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    185e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1868:	5b                   	pop    %ebx
+    1869:	5e                   	pop    %esi
+    186a:	5f                   	pop    %edi
+    186b:	5d                   	pop    %ebp
+    186c:	c3                   	ret
+    186d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1870:	83 ec 04             	sub    $0x4,%esp
+    1873:	50                   	push   %eax
+    1874:	51                   	push   %ecx
+    1875:	ff 77 04             	push   0x4(%edi)
+    1878:	e8 32 fb ff ff       	call   13af <write>
+    187d:	83 c4 10             	add    $0x10,%esp
+    1880:	eb dc                	jmp    185e <vprintf.constprop.0+0x16e>
+    1882:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001890 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1890:	55                   	push   %ebp
+    1891:	89 e5                	mov    %esp,%ebp
+    1893:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1899:	a1 84 29 00 00       	mov    0x2984,%eax
+{
+    189e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18a1:	83 fa 01             	cmp    $0x1,%edx
+    18a4:	74 0c                	je     18b2 <printf+0x22>
+    18a6:	31 c0                	xor    %eax,%eax
+    18a8:	83 fa 02             	cmp    $0x2,%edx
+    18ab:	0f 44 05 80 29 00 00 	cmove  0x2980,%eax
+  o.fd = fd;
+    18b2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18bb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18be:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18c4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    18ca:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    18d1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18d4:	e8 17 fe ff ff       	call   16f0 <vprintf.constprop.0>
+}
+    18d9:	c9                   	leave
+    18da:	c3                   	ret
+    18db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18df:	90                   	nop
+
+000018e0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    18e0:	55                   	push   %ebp
+    18e1:	89 e5                	mov    %esp,%ebp
+    18e3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    18e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18ef:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    18f2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    18f9:	ff ff ff 
+  o.n = 0;
+    18fc:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1903:	00 00 00 
+  o.f = f;
+    1906:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    190c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1912:	e8 d9 fd ff ff       	call   16f0 <vprintf.constprop.0>
+}
+    1917:	c9                   	leave
+    1918:	c3                   	ret
+    1919:	66 90                	xchg   %ax,%ax
+    191b:	66 90                	xchg   %ax,%ax
+    191d:	66 90                	xchg   %ax,%ax
+    191f:	90                   	nop
+
+00001920 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1920:	55                   	push   %ebp
+    1921:	89 e5                	mov    %esp,%ebp
+    1923:	53                   	push   %ebx
+    1924:	89 c3                	mov    %eax,%ebx
+    1926:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1929:	8b 40 0c             	mov    0xc(%eax),%eax
+    192c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    192f:	74 17                	je     1948 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1931:	83 f8 02             	cmp    $0x2,%eax
+    1934:	74 07                	je     193d <setmode+0x1d>
+    1936:	8b 43 18             	mov    0x18(%ebx),%eax
+    1939:	85 c0                	test   %eax,%eax
+    193b:	74 38                	je     1975 <setmode+0x55>
+    f->mode = IONBF;
+}
+    193d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1940:	c9                   	leave
+    1941:	c3                   	ret
+    1942:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1948:	83 ec 08             	sub    $0x8,%esp
+    194b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    194e:	50                   	push   %eax
+    194f:	ff 33                	push   (%ebx)
+    1951:	e8 c2 fa ff ff       	call   1418 <fstat>
+    1956:	83 c4 10             	add    $0x10,%esp
+    1959:	89 c2                	mov    %eax,%edx
+    195b:	31 c0                	xor    %eax,%eax
+    195d:	85 d2                	test   %edx,%edx
+    195f:	75 0a                	jne    196b <setmode+0x4b>
+    1961:	31 c0                	xor    %eax,%eax
+    1963:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1968:	0f 94 c0             	sete   %al
+    196b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    196e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1971:	85 c0                	test   %eax,%eax
+    1973:	75 c8                	jne    193d <setmode+0x1d>
+    1975:	83 ec 0c             	sub    $0xc,%esp
+    1978:	68 00 04 00 00       	push   $0x400
+    197d:	e8 de 07 00 00       	call   2160 <malloc>
+    1982:	83 c4 10             	add    $0x10,%esp
+    1985:	89 43 18             	mov    %eax,0x18(%ebx)
+    1988:	85 c0                	test   %eax,%eax
+    198a:	75 b1                	jne    193d <setmode+0x1d>
+    f->mode = IONBF;
+    198c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1993:	eb a8                	jmp    193d <setmode+0x1d>
+    1995:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    199c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000019a0 <drain>:
+{
+    19a0:	55                   	push   %ebp
+    19a1:	89 e5                	mov    %esp,%ebp
+    19a3:	57                   	push   %edi
+    19a4:	56                   	push   %esi
+    19a5:	53                   	push   %ebx
+    19a6:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    19a9:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    19ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    19af:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19b6:	85 ff                	test   %edi,%edi
+    19b8:	7f 0e                	jg     19c8 <drain+0x28>
+  return 0;
+    19ba:	31 c0                	xor    %eax,%eax
+}
+    19bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19bf:	5b                   	pop    %ebx
+    19c0:	5e                   	pop    %esi
+    19c1:	5f                   	pop    %edi
+    19c2:	5d                   	pop    %ebp
+    19c3:	c3                   	ret
+    19c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19cb:	8b 58 18             	mov    0x18(%eax),%ebx
+    19ce:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    19d0:	eb 0e                	jmp    19e0 <drain+0x40>
+    19d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    19d8:	29 c7                	sub    %eax,%edi
+    19da:	01 c3                	add    %eax,%ebx
+    19dc:	85 ff                	test   %edi,%edi
+    19de:	7e da                	jle    19ba <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    19e0:	83 ec 04             	sub    $0x4,%esp
+    19e3:	57                   	push   %edi
+    19e4:	53                   	push   %ebx
+    19e5:	56                   	push   %esi
+    19e6:	e8 c4 f9 ff ff       	call   13af <write>
+    19eb:	83 c4 10             	add    $0x10,%esp
+    19ee:	85 c0                	test   %eax,%eax
+    19f0:	7f e6                	jg     19d8 <drain+0x38>
+    f->err = 1;
+    19f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19f5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    19fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a01:	eb b9                	jmp    19bc <drain+0x1c>
+    1a03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001a10 <flushall>:
+
+static void
+flushall(void)
+{
+    1a10:	55                   	push   %ebp
+    1a11:	89 e5                	mov    %esp,%ebp
+    1a13:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a14:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+{
+    1a19:	83 ec 04             	sub    $0x4,%esp
+    1a1c:	eb 0d                	jmp    1a2b <flushall+0x1b>
+    1a1e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a20:	83 c3 24             	add    $0x24,%ebx
+    1a23:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1a29:	74 19                	je     1a44 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1a2b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1a2e:	85 c0                	test   %eax,%eax
+    1a30:	74 ee                	je     1a20 <flushall+0x10>
+    1a32:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a34:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1a37:	e8 64 ff ff ff       	call   19a0 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a3c:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1a42:	75 e7                	jne    1a2b <flushall+0x1b>
+}
+    1a44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a47:	c9                   	leave
+    1a48:	c3                   	ret
+    1a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a50 <fflush>:
+{
+    1a50:	55                   	push   %ebp
+    1a51:	89 e5                	mov    %esp,%ebp
+    1a53:	57                   	push   %edi
+    1a54:	56                   	push   %esi
+    1a55:	53                   	push   %ebx
+    1a56:	83 ec 0c             	sub    $0xc,%esp
+    1a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1a5c:	85 c0                	test   %eax,%eax
+    1a5e:	74 28                	je     1a88 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1a60:	8b 70 08             	mov    0x8(%eax),%esi
+    1a63:	85 f6                	test   %esi,%esi
+    1a65:	75 11                	jne    1a78 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1a67:	83 c4 0c             	add    $0xc,%esp
+    1a6a:	89 f0                	mov    %esi,%eax
+    1a6c:	5b                   	pop    %ebx
+    1a6d:	5e                   	pop    %esi
+    1a6e:	5f                   	pop    %edi
+    1a6f:	5d                   	pop    %ebp
+    1a70:	c3                   	ret
+    1a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a78:	83 c4 0c             	add    $0xc,%esp
+    1a7b:	5b                   	pop    %ebx
+    1a7c:	5e                   	pop    %esi
+    1a7d:	5f                   	pop    %edi
+    1a7e:	5d                   	pop    %ebp
+  return drain(f);
+    1a7f:	e9 1c ff ff ff       	jmp    19a0 <drain>
+    1a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1a88:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a8a:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+        r = -1;
+    1a8f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1a94:	eb 15                	jmp    1aab <fflush+0x5b>
+    1a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a9d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1aa0:	83 c3 24             	add    $0x24,%ebx
+    1aa3:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1aa9:	74 bc                	je     1a67 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1aab:	8b 43 08             	mov    0x8(%ebx),%eax
+    1aae:	85 c0                	test   %eax,%eax
+    1ab0:	74 ee                	je     1aa0 <fflush+0x50>
+    1ab2:	89 d8                	mov    %ebx,%eax
+    1ab4:	e8 e7 fe ff ff       	call   19a0 <drain>
+        r = -1;
+    1ab9:	85 c0                	test   %eax,%eax
+    1abb:	0f 48 f7             	cmovs  %edi,%esi
+    1abe:	eb e0                	jmp    1aa0 <fflush+0x50>
+
+00001ac0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	89 e5                	mov    %esp,%ebp
+    1ac3:	57                   	push   %edi
+    1ac4:	56                   	push   %esi
+    1ac5:	53                   	push   %ebx
+    1ac6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1ac9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1acc:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1ad0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1ad3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1ad6:	85 d2                	test   %edx,%edx
+    1ad8:	0f 8e 26 01 00 00    	jle    1c04 <fwrite+0x144>
+  if(!f->writable){
+    1ade:	8b 46 08             	mov    0x8(%esi),%eax
+    1ae1:	85 c0                	test   %eax,%eax
+    1ae3:	0f 84 14 01 00 00    	je     1bfd <fwrite+0x13d>
+  setmode(f);
+    1ae9:	89 f0                	mov    %esi,%eax
+    1aeb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1aee:	e8 2d fe ff ff       	call   1920 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1af3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1af7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1afa:	c7 05 e4 2b 00 00 10 	movl   $0x1a10,0x2be4
+    1b01:	1a 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b04:	0f 84 b6 00 00 00    	je     1bc0 <fwrite+0x100>
+    1b0a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1b10:	0f 8f aa 00 00 00    	jg     1bc0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b16:	8b 46 20             	mov    0x20(%esi),%eax
+    1b19:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1b1c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b1e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b23:	74 6c                	je     1b91 <fwrite+0xd1>
+    1b25:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1b28:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1b2b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1b30:	29 c2                	sub    %eax,%edx
+    1b32:	39 ca                	cmp    %ecx,%edx
+    1b34:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1b37:	85 d2                	test   %edx,%edx
+    1b39:	0f 8e d1 00 00 00    	jle    1c10 <fwrite+0x150>
+    1b3f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1b42:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1b45:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1b50:	8d 50 01             	lea    0x1(%eax),%edx
+    1b53:	83 c3 01             	add    $0x1,%ebx
+    1b56:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1b59:	89 56 20             	mov    %edx,0x20(%esi)
+    1b5c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1b60:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1b63:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1b66:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b6b:	80 fa 0a             	cmp    $0xa,%dl
+    1b6e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1b71:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1b74:	39 cb                	cmp    %ecx,%ebx
+    1b76:	75 d8                	jne    1b50 <fwrite+0x90>
+    1b78:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1b7b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1b7e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1b81:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1b84:	85 db                	test   %ebx,%ebx
+    1b86:	7e 19                	jle    1ba1 <fwrite+0xe1>
+    n -= k;
+    1b88:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b8a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b8f:	75 97                	jne    1b28 <fwrite+0x68>
+    1b91:	89 f0                	mov    %esi,%eax
+    1b93:	e8 08 fe ff ff       	call   19a0 <drain>
+    1b98:	85 c0                	test   %eax,%eax
+    1b9a:	78 68                	js     1c04 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1b9c:	8b 46 20             	mov    0x20(%esi),%eax
+    1b9f:	eb 87                	jmp    1b28 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1ba1:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1ba6:	74 74                	je     1c1c <fwrite+0x15c>
+    1ba8:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1bac:	75 04                	jne    1bb2 <fwrite+0xf2>
+    1bae:	85 ff                	test   %edi,%edi
+    1bb0:	75 6a                	jne    1c1c <fwrite+0x15c>
+    return nmemb;
+    1bb2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bb8:	5b                   	pop    %ebx
+    1bb9:	5e                   	pop    %esi
+    1bba:	5f                   	pop    %edi
+    1bbb:	5d                   	pop    %ebp
+    1bbc:	c3                   	ret
+    1bbd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1bc0:	89 f0                	mov    %esi,%eax
+    1bc2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1bc5:	e8 d6 fd ff ff       	call   19a0 <drain>
+    1bca:	85 c0                	test   %eax,%eax
+    1bcc:	78 2f                	js     1bfd <fwrite+0x13d>
+    1bce:	89 75 14             	mov    %esi,0x14(%ebp)
+    1bd1:	8b 3e                	mov    (%esi),%edi
+    1bd3:	89 de                	mov    %ebx,%esi
+    1bd5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1bd8:	eb 0e                	jmp    1be8 <fwrite+0x128>
+    1bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1be0:	29 c3                	sub    %eax,%ebx
+    1be2:	01 c6                	add    %eax,%esi
+    1be4:	85 db                	test   %ebx,%ebx
+    1be6:	7e ca                	jle    1bb2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1be8:	83 ec 04             	sub    $0x4,%esp
+    1beb:	53                   	push   %ebx
+    1bec:	56                   	push   %esi
+    1bed:	57                   	push   %edi
+    1bee:	e8 bc f7 ff ff       	call   13af <write>
+    1bf3:	83 c4 10             	add    $0x10,%esp
+    1bf6:	85 c0                	test   %eax,%eax
+    1bf8:	7f e6                	jg     1be0 <fwrite+0x120>
+    1bfa:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1bfd:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1c04:	31 c0                	xor    %eax,%eax
+}
+    1c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c09:	5b                   	pop    %ebx
+    1c0a:	5e                   	pop    %esi
+    1c0b:	5f                   	pop    %edi
+    1c0c:	5d                   	pop    %ebp
+    1c0d:	c3                   	ret
+    1c0e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1c10:	89 d9                	mov    %ebx,%ecx
+    1c12:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1c15:	89 cb                	mov    %ecx,%ebx
+    1c17:	e9 6e ff ff ff       	jmp    1b8a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c1c:	89 f0                	mov    %esi,%eax
+    1c1e:	e8 7d fd ff ff       	call   19a0 <drain>
+    1c23:	85 c0                	test   %eax,%eax
+    1c25:	79 8b                	jns    1bb2 <fwrite+0xf2>
+    return 0;
+    1c27:	31 c0                	xor    %eax,%eax
+    1c29:	eb db                	jmp    1c06 <fwrite+0x146>
+    1c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c2f:	90                   	nop
+
+00001c30 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1c30:	55                   	push   %ebp
+    1c31:	89 e5                	mov    %esp,%ebp
+    1c33:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1c36:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c39:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c3c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1c3f:	ff 75 0c             	push   0xc(%ebp)
+    1c42:	6a 01                	push   $0x1
+    1c44:	6a 01                	push   $0x1
+    1c46:	50                   	push   %eax
+    1c47:	e8 74 fe ff ff       	call   1ac0 <fwrite>
+    1c4c:	83 c4 10             	add    $0x10,%esp
+    1c4f:	83 f8 01             	cmp    $0x1,%eax
+    1c52:	75 0c                	jne    1c60 <fputc+0x30>
+    1c54:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1c58:	c9                   	leave
+    1c59:	c3                   	ret
+    1c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1c60:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c61:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1c66:	c3                   	ret
+    1c67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c6e:	66 90                	xchg   %ax,%ax
+
+00001c70 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1c70:	55                   	push   %ebp
+    1c71:	89 e5                	mov    %esp,%ebp
+    1c73:	57                   	push   %edi
+    1c74:	56                   	push   %esi
+    1c75:	53                   	push   %ebx
+    1c76:	83 ec 1c             	sub    $0x1c,%esp
+    1c79:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1c7c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1c7f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1c82:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1c85:	85 d2                	test   %edx,%edx
+    1c87:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c8a:	7e 12                	jle    1c9e <fread+0x2e>
+    1c8c:	85 ff                	test   %edi,%edi
+    1c8e:	7e 0e                	jle    1c9e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1c90:	8b 43 04             	mov    0x4(%ebx),%eax
+    1c93:	85 c0                	test   %eax,%eax
+    1c95:	75 19                	jne    1cb0 <fread+0x40>
+    f->err = 1;
+    1c97:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1c9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1ca1:	31 c0                	xor    %eax,%eax
+}
+    1ca3:	5b                   	pop    %ebx
+    1ca4:	5e                   	pop    %esi
+    1ca5:	5f                   	pop    %edi
+    1ca6:	5d                   	pop    %ebp
+    1ca7:	c3                   	ret
+    1ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1caf:	90                   	nop
+  setmode(f);
+    1cb0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1cb2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1cb4:	e8 67 fc ff ff       	call   1920 <setmode>
+  for(n = 0; n < want; n += k){
+    1cb9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1cbc:	89 f7                	mov    %esi,%edi
+    1cbe:	eb 31                	jmp    1cf1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1cc0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1cc4:	74 08                	je     1cce <fread+0x5e>
+    1cc6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1ccc:	7e 62                	jle    1d30 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1cce:	83 ec 04             	sub    $0x4,%esp
+    1cd1:	56                   	push   %esi
+    1cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+    1cd5:	01 f8                	add    %edi,%eax
+    1cd7:	50                   	push   %eax
+    1cd8:	ff 33                	push   (%ebx)
+    1cda:	e8 c1 f6 ff ff       	call   13a0 <read>
+    1cdf:	83 c4 10             	add    $0x10,%esp
+    1ce2:	85 c0                	test   %eax,%eax
+    1ce4:	0f 8e ce 00 00 00    	jle    1db8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1cea:	01 c7                	add    %eax,%edi
+    1cec:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1cef:	7e 36                	jle    1d27 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1cf1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1cf4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1cf7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1cfa:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1cfc:	39 c1                	cmp    %eax,%ecx
+    1cfe:	7d c0                	jge    1cc0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d00:	29 c8                	sub    %ecx,%eax
+    1d02:	39 f0                	cmp    %esi,%eax
+    1d04:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1d07:	83 ec 04             	sub    $0x4,%esp
+    1d0a:	56                   	push   %esi
+    1d0b:	03 4b 18             	add    0x18(%ebx),%ecx
+    1d0e:	51                   	push   %ecx
+    1d0f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d12:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1d14:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1d16:	50                   	push   %eax
+    1d17:	e8 34 f5 ff ff       	call   1250 <memmove>
+      f->r += k;
+    1d1c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1d1f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1d22:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d25:	7f ca                	jg     1cf1 <fread+0x81>
+    1d27:	89 fe                	mov    %edi,%esi
+    1d29:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d2c:	eb 3f                	jmp    1d6d <fread+0xfd>
+    1d2e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1d30:	3b 1d 88 29 00 00    	cmp    0x2988,%ebx
+    1d36:	74 68                	je     1da0 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d38:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1d3b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1d42:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d49:	68 00 04 00 00       	push   $0x400
+    1d4e:	ff 73 18             	push   0x18(%ebx)
+    1d51:	ff 33                	push   (%ebx)
+    1d53:	e8 48 f6 ff ff       	call   13a0 <read>
+    1d58:	83 c4 10             	add    $0x10,%esp
+    1d5b:	85 c0                	test   %eax,%eax
+    1d5d:	78 21                	js     1d80 <fread+0x110>
+  else if(n == 0)
+    1d5f:	75 2f                	jne    1d90 <fread+0x120>
+    f->eof = 1;
+    1d61:	89 fe                	mov    %edi,%esi
+    1d63:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d66:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1d6d:	89 f0                	mov    %esi,%eax
+}
+    1d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1d72:	99                   	cltd
+}
+    1d73:	5b                   	pop    %ebx
+    1d74:	5e                   	pop    %esi
+  return n / size;
+    1d75:	f7 ff                	idiv   %edi
+}
+    1d77:	5f                   	pop    %edi
+    1d78:	5d                   	pop    %ebp
+    1d79:	c3                   	ret
+    1d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1d80:	89 fe                	mov    %edi,%esi
+    1d82:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d85:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1d8c:	eb df                	jmp    1d6d <fread+0xfd>
+    1d8e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1d90:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1d93:	e9 54 ff ff ff       	jmp    1cec <fread+0x7c>
+    1d98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d9f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1da0:	83 ec 0c             	sub    $0xc,%esp
+    1da3:	ff 35 84 29 00 00    	push   0x2984
+    1da9:	e8 a2 fc ff ff       	call   1a50 <fflush>
+    1dae:	83 c4 10             	add    $0x10,%esp
+    1db1:	eb 85                	jmp    1d38 <fread+0xc8>
+    1db3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1db7:	90                   	nop
+        if(k < 0)
+    1db8:	89 fe                	mov    %edi,%esi
+    1dba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1dbd:	74 a7                	je     1d66 <fread+0xf6>
+    1dbf:	eb c4                	jmp    1d85 <fread+0x115>
+    1dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dcf:	90                   	nop
+
+00001dd0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1dd0:	55                   	push   %ebp
+    1dd1:	89 e5                	mov    %esp,%ebp
+    1dd3:	53                   	push   %ebx
+    1dd4:	83 ec 14             	sub    $0x14,%esp
+    1dd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1dda:	8b 50 04             	mov    0x4(%eax),%edx
+    1ddd:	85 d2                	test   %edx,%edx
+    1ddf:	74 08                	je     1de9 <fgetc+0x19>
+    1de1:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1de4:	3b 50 20             	cmp    0x20(%eax),%edx
+    1de7:	7c 27                	jl     1e10 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1de9:	50                   	push   %eax
+    1dea:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1ded:	6a 01                	push   $0x1
+    1def:	6a 01                	push   $0x1
+    1df1:	50                   	push   %eax
+    1df2:	e8 79 fe ff ff       	call   1c70 <fread>
+    1df7:	83 c4 10             	add    $0x10,%esp
+    1dfa:	83 f8 01             	cmp    $0x1,%eax
+    1dfd:	75 29                	jne    1e28 <fgetc+0x58>
+    1dff:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1e03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e06:	c9                   	leave
+    1e07:	c3                   	ret
+    1e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e0f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1e10:	8b 48 18             	mov    0x18(%eax),%ecx
+    1e13:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1e16:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1e19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1e1c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1e20:	c9                   	leave
+    1e21:	c3                   	ret
+    1e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e2d:	eb d4                	jmp    1e03 <fgetc+0x33>
+    1e2f:	90                   	nop
+
+00001e30 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1e30:	55                   	push   %ebp
+    1e31:	89 e5                	mov    %esp,%ebp
+    1e33:	57                   	push   %edi
+    1e34:	56                   	push   %esi
+    1e35:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1e36:	31 db                	xor    %ebx,%ebx
+{
+    1e38:	83 ec 1c             	sub    $0x1c,%esp
+    1e3b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1e3e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1e40:	eb 2e                	jmp    1e70 <fgets+0x40>
+    1e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e48:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1e4b:	57                   	push   %edi
+    1e4c:	6a 01                	push   $0x1
+    1e4e:	6a 01                	push   $0x1
+    1e50:	50                   	push   %eax
+    1e51:	e8 1a fe ff ff       	call   1c70 <fread>
+    1e56:	83 c4 10             	add    $0x10,%esp
+    1e59:	83 f8 01             	cmp    $0x1,%eax
+    1e5c:	75 62                	jne    1ec0 <fgets+0x90>
+    1e5e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1e62:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e65:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1e67:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1e6b:	83 f9 0a             	cmp    $0xa,%ecx
+    1e6e:	74 34                	je     1ea4 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1e70:	89 de                	mov    %ebx,%esi
+    1e72:	83 c3 01             	add    $0x1,%ebx
+    1e75:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1e78:	7d 46                	jge    1ec0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1e7a:	8b 47 04             	mov    0x4(%edi),%eax
+    1e7d:	85 c0                	test   %eax,%eax
+    1e7f:	74 c7                	je     1e48 <fgets+0x18>
+    1e81:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1e84:	3b 47 20             	cmp    0x20(%edi),%eax
+    1e87:	7d bf                	jge    1e48 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1e89:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1e8c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1e92:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1e95:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1e99:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1e9b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1e9f:	83 f9 0a             	cmp    $0xa,%ecx
+    1ea2:	75 cc                	jne    1e70 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ea7:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1eab:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1eb1:	5b                   	pop    %ebx
+    1eb2:	5e                   	pop    %esi
+    1eb3:	5f                   	pop    %edi
+    1eb4:	5d                   	pop    %ebp
+    1eb5:	c3                   	ret
+    1eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ebd:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    1ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ec3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    1ec7:	31 c0                	xor    %eax,%eax
+    1ec9:	85 f6                	test   %esi,%esi
+    1ecb:	74 e1                	je     1eae <fgets+0x7e>
+    1ecd:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ed0:	eb dc                	jmp    1eae <fgets+0x7e>
+    1ed2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ee0 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    1ee0:	55                   	push   %ebp
+    1ee1:	89 e5                	mov    %esp,%ebp
+    1ee3:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1ee4:	bb a0 29 00 00       	mov    $0x29a0,%ebx
+{
+    1ee9:	83 ec 04             	sub    $0x4,%esp
+    1eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    1ef0:	8b 53 04             	mov    0x4(%ebx),%edx
+    1ef3:	85 d2                	test   %edx,%edx
+    1ef5:	75 07                	jne    1efe <fdopen+0x1e>
+    1ef7:	8b 43 08             	mov    0x8(%ebx),%eax
+    1efa:	85 c0                	test   %eax,%eax
+    1efc:	74 1a                	je     1f18 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1efe:	83 c3 24             	add    $0x24,%ebx
+    1f01:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1f07:	75 e7                	jne    1ef0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    1f09:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    1f0b:	89 d8                	mov    %ebx,%eax
+    1f0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f10:	c9                   	leave
+    1f11:	c3                   	ret
+    1f12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    1f18:	81 fb e0 2b 00 00    	cmp    $0x2be0,%ebx
+    1f1e:	74 e9                	je     1f09 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    1f20:	83 ec 04             	sub    $0x4,%esp
+    1f23:	6a 24                	push   $0x24
+    1f25:	6a 00                	push   $0x0
+    1f27:	53                   	push   %ebx
+    1f28:	e8 d3 f1 ff ff       	call   1100 <memset>
+  f->fd = fd;
+    1f2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    1f30:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    1f37:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    1f3a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    1f3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1f3f:	80 38 72             	cmpb   $0x72,(%eax)
+    1f42:	74 14                	je     1f58 <fdopen+0x78>
+    f->writable = 1;
+    1f44:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    1f4b:	89 d8                	mov    %ebx,%eax
+    1f4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f50:	c9                   	leave
+    1f51:	c3                   	ret
+    1f52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    1f58:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    1f5f:	89 d8                	mov    %ebx,%eax
+    1f61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f64:	c9                   	leave
+    1f65:	c3                   	ret
+    1f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001f70 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    1f70:	55                   	push   %ebp
+    1f71:	89 e5                	mov    %esp,%ebp
+    1f73:	56                   	push   %esi
+    1f74:	53                   	push   %ebx
+    1f75:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    1f78:	0f b6 06             	movzbl (%esi),%eax
+    1f7b:	3c 72                	cmp    $0x72,%al
+    1f7d:	74 61                	je     1fe0 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    1f7f:	3c 77                	cmp    $0x77,%al
+    1f81:	74 7d                	je     2000 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    1f83:	3c 61                	cmp    $0x61,%al
+    1f85:	75 49                	jne    1fd0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    1f87:	83 ec 08             	sub    $0x8,%esp
+    1f8a:	68 01 02 00 00       	push   $0x201
+    1f8f:	ff 75 08             	push   0x8(%ebp)
+    1f92:	e8 54 f4 ff ff       	call   13eb <open>
+    1f97:	83 c4 10             	add    $0x10,%esp
+    1f9a:	89 c3                	mov    %eax,%ebx
+    1f9c:	85 c0                	test   %eax,%eax
+    1f9e:	78 30                	js     1fd0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    1fa0:	83 ec 04             	sub    $0x4,%esp
+    1fa3:	6a 02                	push   $0x2
+    1fa5:	6a 00                	push   $0x0
+    1fa7:	50                   	push   %eax
+    1fa8:	e8 4c f5 ff ff       	call   14f9 <lseek>
+    1fad:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    1fb0:	83 ec 08             	sub    $0x8,%esp
+    1fb3:	56                   	push   %esi
+    1fb4:	53                   	push   %ebx
+    1fb5:	e8 26 ff ff ff       	call   1ee0 <fdopen>
+    1fba:	83 c4 10             	add    $0x10,%esp
+    1fbd:	85 c0                	test   %eax,%eax
+    1fbf:	75 11                	jne    1fd2 <fopen+0x62>
+    close(fd);
+    1fc1:	83 ec 0c             	sub    $0xc,%esp
+    1fc4:	53                   	push   %ebx
+    1fc5:	e8 f4 f3 ff ff       	call   13be <close>
+    1fca:	83 c4 10             	add    $0x10,%esp
+    1fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    1fd0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    1fd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1fd5:	5b                   	pop    %ebx
+    1fd6:	5e                   	pop    %esi
+    1fd7:	5d                   	pop    %ebp
+    1fd8:	c3                   	ret
+    1fd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    1fe0:	83 ec 08             	sub    $0x8,%esp
+    1fe3:	6a 00                	push   $0x0
+    1fe5:	ff 75 08             	push   0x8(%ebp)
+    1fe8:	e8 fe f3 ff ff       	call   13eb <open>
+    1fed:	83 c4 10             	add    $0x10,%esp
+    1ff0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    1ff2:	85 db                	test   %ebx,%ebx
+    1ff4:	78 da                	js     1fd0 <fopen+0x60>
+    1ff6:	eb b8                	jmp    1fb0 <fopen+0x40>
+    1ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fff:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2000:	83 ec 08             	sub    $0x8,%esp
+    2003:	68 01 06 00 00       	push   $0x601
+    2008:	ff 75 08             	push   0x8(%ebp)
+    200b:	e8 db f3 ff ff       	call   13eb <open>
+    2010:	83 c4 10             	add    $0x10,%esp
+    2013:	89 c3                	mov    %eax,%ebx
+    2015:	eb db                	jmp    1ff2 <fopen+0x82>
+    2017:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    201e:	66 90                	xchg   %ax,%ax
+
+00002020 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2020:	55                   	push   %ebp
+    2021:	89 e5                	mov    %esp,%ebp
+    2023:	56                   	push   %esi
+    2024:	53                   	push   %ebx
+    2025:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2028:	83 ec 0c             	sub    $0xc,%esp
+    202b:	53                   	push   %ebx
+    202c:	e8 1f fa ff ff       	call   1a50 <fflush>
+    2031:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2033:	58                   	pop    %eax
+    2034:	ff 33                	push   (%ebx)
+    2036:	e8 83 f3 ff ff       	call   13be <close>
+    203b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    203e:	85 c0                	test   %eax,%eax
+    2040:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2045:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2048:	8b 43 18             	mov    0x18(%ebx),%eax
+    204b:	85 c0                	test   %eax,%eax
+    204d:	0f 95 c1             	setne  %cl
+    2050:	3d 00 30 00 00       	cmp    $0x3000,%eax
+    2055:	0f 95 c2             	setne  %dl
+    2058:	84 d1                	test   %dl,%cl
+    205a:	74 07                	je     2063 <fclose+0x43>
+    205c:	3d 00 2c 00 00       	cmp    $0x2c00,%eax
+    2061:	75 25                	jne    2088 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2063:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    206a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    206c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2073:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    207a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    207d:	5b                   	pop    %ebx
+    207e:	5e                   	pop    %esi
+    207f:	5d                   	pop    %ebp
+    2080:	c3                   	ret
+    2081:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2088:	83 ec 0c             	sub    $0xc,%esp
+    208b:	50                   	push   %eax
+    208c:	e8 3f 00 00 00       	call   20d0 <free>
+    2091:	83 c4 10             	add    $0x10,%esp
+    2094:	eb cd                	jmp    2063 <fclose+0x43>
+    2096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    209d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020a0 <feof>:
+
+int
+feof(FILE *f)
+{
+    20a0:	55                   	push   %ebp
+    20a1:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    20a3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20a6:	5d                   	pop    %ebp
+  return f->eof;
+    20a7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    20aa:	c3                   	ret
+    20ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20af:	90                   	nop
+
+000020b0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    20b0:	55                   	push   %ebp
+    20b1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    20b3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20b6:	5d                   	pop    %ebp
+  return f->err;
+    20b7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    20ba:	c3                   	ret
+    20bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20bf:	90                   	nop
+
+000020c0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    20c0:	55                   	push   %ebp
+    20c1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    20c3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20c6:	5d                   	pop    %ebp
+  return f->fd;
+    20c7:	8b 00                	mov    (%eax),%eax
+}
+    20c9:	c3                   	ret
+    20ca:	66 90                	xchg   %ax,%ax
+    20cc:	66 90                	xchg   %ax,%ax
+    20ce:	66 90                	xchg   %ax,%ax
+
+000020d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    20d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    20d1:	a1 00 34 00 00       	mov    0x3400,%eax
+{
+    20d6:	89 e5                	mov    %esp,%ebp
+    20d8:	57                   	push   %edi
+    20d9:	56                   	push   %esi
+    20da:	53                   	push   %ebx
+    20db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    20de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    20e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    20ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    20ec:	39 ca                	cmp    %ecx,%edx
+    20ee:	73 30                	jae    2120 <free+0x50>
+    20f0:	39 c1                	cmp    %eax,%ecx
+    20f2:	72 04                	jb     20f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    20f4:	39 c2                	cmp    %eax,%edx
+    20f6:	72 f0                	jb     20e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    20f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    20fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    20fe:	39 f8                	cmp    %edi,%eax
+    2100:	74 2e                	je     2130 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2102:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2105:	8b 42 04             	mov    0x4(%edx),%eax
+    2108:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    210b:	39 f1                	cmp    %esi,%ecx
+    210d:	74 38                	je     2147 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    210f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2111:	5b                   	pop    %ebx
+  freep = p;
+    2112:	89 15 00 34 00 00    	mov    %edx,0x3400
+}
+    2118:	5e                   	pop    %esi
+    2119:	5f                   	pop    %edi
+    211a:	5d                   	pop    %ebp
+    211b:	c3                   	ret
+    211c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2120:	39 c1                	cmp    %eax,%ecx
+    2122:	72 d0                	jb     20f4 <free+0x24>
+    2124:	eb c2                	jmp    20e8 <free+0x18>
+    2126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    212d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2130:	03 70 04             	add    0x4(%eax),%esi
+    2133:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2136:	8b 02                	mov    (%edx),%eax
+    2138:	8b 00                	mov    (%eax),%eax
+    213a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    213d:	8b 42 04             	mov    0x4(%edx),%eax
+    2140:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2143:	39 f1                	cmp    %esi,%ecx
+    2145:	75 c8                	jne    210f <free+0x3f>
+    p->s.size += bp->s.size;
+    2147:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    214a:	89 15 00 34 00 00    	mov    %edx,0x3400
+    p->s.size += bp->s.size;
+    2150:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2153:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2156:	89 0a                	mov    %ecx,(%edx)
+}
+    2158:	5b                   	pop    %ebx
+    2159:	5e                   	pop    %esi
+    215a:	5f                   	pop    %edi
+    215b:	5d                   	pop    %ebp
+    215c:	c3                   	ret
+    215d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002160 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2160:	55                   	push   %ebp
+    2161:	89 e5                	mov    %esp,%ebp
+    2163:	57                   	push   %edi
+    2164:	56                   	push   %esi
+    2165:	53                   	push   %ebx
+    2166:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2169:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    216c:	8b 15 00 34 00 00    	mov    0x3400,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2172:	8d 78 07             	lea    0x7(%eax),%edi
+    2175:	c1 ef 03             	shr    $0x3,%edi
+    2178:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    217b:	85 d2                	test   %edx,%edx
+    217d:	0f 84 8d 00 00 00    	je     2210 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2183:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2185:	8b 48 04             	mov    0x4(%eax),%ecx
+    2188:	39 f9                	cmp    %edi,%ecx
+    218a:	73 64                	jae    21f0 <malloc+0x90>
+  if(nu < 4096)
+    218c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2191:	39 df                	cmp    %ebx,%edi
+    2193:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2196:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    219d:	eb 0a                	jmp    21a9 <malloc+0x49>
+    219f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    21a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    21a2:	8b 48 04             	mov    0x4(%eax),%ecx
+    21a5:	39 f9                	cmp    %edi,%ecx
+    21a7:	73 47                	jae    21f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    21a9:	89 c2                	mov    %eax,%edx
+    21ab:	39 05 00 34 00 00    	cmp    %eax,0x3400
+    21b1:	75 ed                	jne    21a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    21b3:	83 ec 0c             	sub    $0xc,%esp
+    21b6:	56                   	push   %esi
+    21b7:	e8 b6 f2 ff ff       	call   1472 <sbrk>
+  if(p == (char*)-1)
+    21bc:	83 c4 10             	add    $0x10,%esp
+    21bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    21c2:	74 1c                	je     21e0 <malloc+0x80>
+  hp->s.size = nu;
+    21c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    21c7:	83 ec 0c             	sub    $0xc,%esp
+    21ca:	83 c0 08             	add    $0x8,%eax
+    21cd:	50                   	push   %eax
+    21ce:	e8 fd fe ff ff       	call   20d0 <free>
+  return freep;
+    21d3:	8b 15 00 34 00 00    	mov    0x3400,%edx
+      if((p = morecore(nunits)) == 0)
+    21d9:	83 c4 10             	add    $0x10,%esp
+    21dc:	85 d2                	test   %edx,%edx
+    21de:	75 c0                	jne    21a0 <malloc+0x40>
+        return 0;
+  }
+}
+    21e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    21e3:	31 c0                	xor    %eax,%eax
+}
+    21e5:	5b                   	pop    %ebx
+    21e6:	5e                   	pop    %esi
+    21e7:	5f                   	pop    %edi
+    21e8:	5d                   	pop    %ebp
+    21e9:	c3                   	ret
+    21ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    21f0:	39 cf                	cmp    %ecx,%edi
+    21f2:	74 4c                	je     2240 <malloc+0xe0>
+        p->s.size -= nunits;
+    21f4:	29 f9                	sub    %edi,%ecx
+    21f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    21f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    21fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    21ff:	89 15 00 34 00 00    	mov    %edx,0x3400
+}
+    2205:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2208:	83 c0 08             	add    $0x8,%eax
+}
+    220b:	5b                   	pop    %ebx
+    220c:	5e                   	pop    %esi
+    220d:	5f                   	pop    %edi
+    220e:	5d                   	pop    %ebp
+    220f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2210:	c7 05 00 34 00 00 04 	movl   $0x3404,0x3400
+    2217:	34 00 00 
+    base.s.size = 0;
+    221a:	b8 04 34 00 00       	mov    $0x3404,%eax
+    base.s.ptr = freep = prevp = &base;
+    221f:	c7 05 04 34 00 00 04 	movl   $0x3404,0x3404
+    2226:	34 00 00 
+    base.s.size = 0;
+    2229:	c7 05 08 34 00 00 00 	movl   $0x0,0x3408
+    2230:	00 00 00 
+    if(p->s.size >= nunits){
+    2233:	e9 54 ff ff ff       	jmp    218c <malloc+0x2c>
+    2238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    223f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2240:	8b 08                	mov    (%eax),%ecx
+    2242:	89 0a                	mov    %ecx,(%edx)
+    2244:	eb b9                	jmp    21ff <malloc+0x9f>
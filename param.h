@@ -2,13 +2,15 @@
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
+#define MAXIOV       32  // max buffers per readv/writev
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE     1000  // maximum number of cached i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define MAXPATH      128 // max length of an exec path
+#define MAXOPBLOCKS  64  // max # of blocks any FS op writes
+#define LOGSIZE      (MAXOPBLOCKS*3)  // default blocks in a transaction; mkfs -l sets the log's size
+#define NBUF         (LOGSIZE*3+MAXOPBLOCKS)  // size of disk block cache; log.c adds more for a larger log
+#define FSSIZE       (50*1024*1024/BSIZE)  // default mkfs size, in blocks
 
@@ -0,0 +1,111 @@
+// PCI bus enumeration through configuration mechanism #1:
+// write the bus/device/function/register to CONFIG_ADDR,
+// then read or write the register through CONFIG_DATA.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "pci.h"
+
+#define CONFIG_ADDR 0xcf8
+#define CONFIG_DATA 0xcfc
+
+#define NPCIDEV 32
+
+static struct pcidev pcidevs[NPCIDEV];
+static int npcidev;
+
+static uint
+confread(int bus, int dev, int func, int off)
+{
+  outl(CONFIG_ADDR, 0x80000000 | bus<<16 | dev<<11 | func<<8 | (off&0xfc));
+  return inl(CONFIG_DATA);
+}
+
+static void
+confwrite(int bus, int dev, int func, int off, uint v)
+{
+  outl(CONFIG_ADDR, 0x80000000 | bus<<16 | dev<<11 | func<<8 | (off&0xfc));
+  outl(CONFIG_DATA, v);
+}
+
+uint
+pciread(struct pcidev *d, int off)
+{
+  return confread(d->bus, d->dev, d->func, off);
+}
+
+void
+pciwrite(struct pcidev *d, int off, uint v)
+{
+  confwrite(d->bus, d->dev, d->func, off, v);
+}
+
+// Turn on I/O and memory decoding and bus mastering for d.
+void
+pcienable(struct pcidev *d)
+{
+  pciwrite(d, PCI_CMD, pciread(d, PCI_CMD) |
+           PCI_CMD_IO | PCI_CMD_MEM | PCI_CMD_MASTER);
+}
+
+// Record every function on every bus.
+void
+pciinit(void)
+{
+  int bus, dev, func, nfunc, i;
+  uint id, class;
+  struct pcidev *d;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      nfunc = 1;
+      for(func = 0; func < nfunc; func++){
+        id = confread(bus, dev, func, 0x00);
+        if((id & 0xffff) == 0xffff)
+          continue;
+        if(func == 0 && (confread(bus, dev, 0, 0x0c) & 0x00800000))
+          nfunc = 8;  // multi-function device
+        if(npcidev >= NPCIDEV)
+          return;
+        d = &pcidevs[npcidev++];
+        d->bus = bus;
+        d->dev = dev;
+        d->func = func;
+        d->vendor = id & 0xffff;
+        d->device = id >> 16;
+        class = confread(bus, dev, func, 0x08);
+        d->class = class >> 24;
+        d->subclass = class >> 16;
+        d->irq = confread(bus, dev, func, 0x3c);
+        for(i = 0; i < 6; i++)
+          d->bar[i] = confread(bus, dev, func, 0x10 + 4*i);
+      }
+    }
+  }
+}
+
+// Find a device by vendor and device id.
+struct pcidev*
+pcifind(int vendor, int device)
+{
+  struct pcidev *d;
+
+  for(d = pcidevs; d < &pcidevs[npcidev]; d++)
+    if(d->vendor == vendor && d->device == device)
+      return d;
+  return 0;
+}
+
+// Find a device by class and subclass.
+struct pcidev*
+pcifindclass(int class, int subclass)
+{
+  struct pcidev *d;
+
+  for(d = pcidevs; d < &pcidevs[npcidev]; d++)
+    if(d->class == class && d->subclass == subclass)
+      return d;
+  return 0;
+}
@@ -0,0 +1,20 @@
+// PCI device, as found by pciinit() on the configuration space.
+struct pcidev {
+  uchar bus;
+  uchar dev;
+  uchar func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uchar irq;         // interrupt line, as routed by the BIOS
+  uint bar[6];       // base address registers
+};
+
+#define PCI_CMD       0x04    // command register
+#define PCI_CMD_IO    0x0001  // respond to I/O space accesses
+#define PCI_CMD_MEM   0x0002  // respond to memory space accesses
+#define PCI_CMD_MASTER 0x0004 // may act as bus master (DMA)
+
+#define PCI_BAR_IO    0x1     // BAR maps I/O space, not memory
+#define PCI_BAR_IOMASK 0xfffffffc
@@ -7,18 +7,36 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "kstat.h"
 
-#define PIPESIZE 512
+// The ring is made of whole pages, a power-of-two number of
+// them, so that it can grow with fcntl(F_SETPIPE_SZ) without
+// needing contiguous memory.
+#define PIPEMAXPG 16  // largest ring, in pages
 
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *page[PIPEMAXPG];
+  uint size;      // ring size, in bytes
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  int splicing;   // a splice is copying to or from the ring
 };
 
+struct {
+  struct spinlock lock;
+  uint spliced;   // bytes moved by splice()
+  uint pagemoves; // pages of them moved without copying
+} pipestats;
+
+void
+pipeinit(void)
+{
+  initlock(&pipestats.lock, "pipestats");
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -30,6 +48,10 @@ pipealloc(struct file **f0, struct file **f1)
     goto bad;
   if((p = (struct pipe*)kalloc()) == 0)
     goto bad;
+  memset(p, 0, sizeof(*p));
+  if((p->page[0] = kalloc()) == 0)
+    goto bad;
+  p->size = PGSIZE;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
@@ -47,8 +69,11 @@ pipealloc(struct file **f0, struct file **f1)
 
 //PAGEBREAK: 20
  bad:
-  if(p)
+  if(p){
+    if(p->page[0])
+      kfree(p->page[0]);
     kfree((char*)p);
+  }
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -59,6 +84,8 @@ pipealloc(struct file **f0, struct file **f1)
 void
 pipeclose(struct pipe *p, int writable)
 {
+  int i;
+
   acquire(&p->lock);
   if(writable){
     p->writeopen = 0;
@@ -69,20 +96,47 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
+    for(i = 0; i < p->size / PGSIZE; i++)
+      kfree(p->page[i]);
     kfree((char*)p);
   } else
     release(&p->lock);
 }
 
+// Copy n bytes between addr and the ring, starting at ring
+// offset off; to the ring if toring is set, else from it.
+// Moves as much as each page holds at a time.  Returns -1 if
+// addr is user memory and a page of it is missing.
+static int
+ringcopy(struct pipe *p, uint off, char *addr, int n, int toring)
+{
+  uint o, m;
+  char *r;
+
+  while(n > 0){
+    o = off % p->size;
+    r = p->page[o / PGSIZE] + o % PGSIZE;
+    m = PGSIZE - o % PGSIZE;
+    if(m > n)
+      m = n;
+    if((toring ? ucopy(r, addr, m) : ucopy(addr, r, m)) < 0)
+      return -1;
+    off += m;
+    addr += m;
+    n -= m;
+  }
+  return 0;
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+  for(i = 0; i < n; i += m){
+    while(p->nwrite == p->nread + p->size || p->splicing){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
@@ -90,7 +144,14 @@ pipewrite(struct pipe *p, char *addr, int n)
       wakeup(&p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    m = p->nread + p->size - p->nwrite;
+    if(m > n - i)
+      m = n - i;
+    if(ringcopy(p, p->nwrite, addr + i, m, 1) < 0){
+      release(&p->lock);
+      return -1;
+    }
+    p->nwrite += m;
   }
   wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
@@ -100,22 +161,307 @@ pipewrite(struct pipe *p, char *addr, int n)
 int
 piperead(struct pipe *p, char *addr, int n)
 {
-  int i;
-
   acquire(&p->lock);
-  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+  while((p->nread == p->nwrite && p->writeopen) || p->splicing){  //DOC: pipe-empty
     if(myproc()->killed){
       release(&p->lock);
       return -1;
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  if(n > p->nwrite - p->nread)
+    n = p->nwrite - p->nread;
+  if(ringcopy(p, p->nread, addr, n, 0) < 0){  //DOC: piperead-copy
+    release(&p->lock);
+    return -1;
   }
+  p->nread += n;
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
+  return n;
+}
+
+// Return the size of p's ring, in bytes.
+int
+pipegetsize(struct pipe *p)
+{
+  int n;
+
+  acquire(&p->lock);
+  n = p->size;
+  release(&p->lock);
+  return n;
+}
+
+// Resize p's ring to hold at least n bytes, rounded up to a
+// power-of-two number of pages.  Fails if that is too big, or
+// too small for the bytes already in the pipe.
+// Returns the new size.
+int
+pipesetsize(struct pipe *p, int n)
+{
+  char *page[PIPEMAXPG];
+  int i, np, k, m;
+
+  for(np = 1; np*PGSIZE < n; np *= 2)
+    if(np == PIPEMAXPG)
+      return -1;
+  for(i = 0; i < np; i++){
+    if((page[i] = kalloc()) == 0){
+      while(--i >= 0)
+        kfree(page[i]);
+      return -1;
+    }
+  }
+
+  acquire(&p->lock);
+  while(p->splicing)
+    sleep(&p->nwrite, &p->lock);
+  if(p->nwrite - p->nread > np*PGSIZE){
+    release(&p->lock);
+    for(i = 0; i < np; i++)
+      kfree(page[i]);
+    return -1;
+  }
+  // Copy the buffered bytes to the start of the new ring.
+  n = p->nwrite - p->nread;
+  for(k = 0; k < n; k += m){
+    m = PGSIZE;
+    if(m > n - k)
+      m = n - k;
+    ringcopy(p, p->nread + k, page[k / PGSIZE], m, 0);
+  }
+  for(i = 0; i < p->size / PGSIZE; i++)
+    kfree(p->page[i]);
+  for(i = 0; i < np; i++)
+    p->page[i] = page[i];
+  p->size = np*PGSIZE;
+  p->nread = 0;
+  p->nwrite = n;
+  wakeup(&p->nwrite);
+  release(&p->lock);
+  return np*PGSIZE;
+}
+
+//PAGEBREAK!
+// Splicing moves data into or out of a ring without a copy
+// through user memory.  Between a file and a pipe, the file's
+// data is copied straight between the buffer cache and the
+// ring.  Since that may sleep, the splicer sets p->splicing
+// and drops p->lock meanwhile, and other readers and writers
+// wait for it.  Between two pipes, whole pages are moved from
+// one ring to the other by swapping them with empty ones,
+// when the data lines up; only the rest is copied.
+
+// Return the address of ring offset off, and in *m the
+// number of bytes from there to the end of its page.
+static char*
+ringaddr(struct pipe *p, uint off, int *m)
+{
+  off %= p->size;
+  *m = PGSIZE - off % PGSIZE;
+  return p->page[off / PGSIZE] + off % PGSIZE;
+}
+
+static void
+countsplice(int n, int pages)
+{
+  acquire(&pipestats.lock);
+  pipestats.spliced += n;
+  pipestats.pagemoves += pages;
+  release(&pipestats.lock);
+}
+
+// Move up to n bytes from file f into p, reading at *off if
+// off is set, else at f's offset.
+// Waits for room, but not for data from f.
+int
+pipesplicein(struct pipe *p, struct file *f, uint *off, int n)
+{
+  int i, m, r;
+  char *dst;
+
+  acquire(&p->lock);
+  for(i = 0; i < n; i += r){
+    while(p->nwrite == p->nread + p->size || p->splicing){
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+      sleep(&p->nwrite, &p->lock);
+    }
+    dst = ringaddr(p, p->nwrite, &m);
+    if(m > p->nread + p->size - p->nwrite)
+      m = p->nread + p->size - p->nwrite;
+    if(m > n - i)
+      m = n - i;
+    p->splicing = 1;
+    release(&p->lock);
+    if(off){
+      if((r = filepread(f, dst, m, *off)) > 0)
+        *off += r;
+    } else
+      r = fileread(f, dst, m);
+    acquire(&p->lock);
+    p->splicing = 0;
+    if(r > 0)
+      p->nwrite += r;
+    wakeup(&p->nread);
+    wakeup(&p->nwrite);
+    if(r < m){
+      if(r > 0)
+        i += r;
+      else if(r < 0 && i == 0)
+        i = -1;
+      break;
+    }
+  }
+  release(&p->lock);
+  if(i > 0)
+    countsplice(i, 0);
   return i;
 }
+
+// Move up to n bytes from p into file f.
+// Like piperead(), waits only if p is empty.
+int
+pipespliceout(struct pipe *p, struct file *f, int n)
+{
+  int i, m, r;
+  char *src;
+
+  acquire(&p->lock);
+  while((p->nread == p->nwrite && p->writeopen) || p->splicing){
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock);
+  }
+  for(i = 0; i < n && p->nread != p->nwrite; i += r){
+    src = ringaddr(p, p->nread, &m);
+    if(m > p->nwrite - p->nread)
+      m = p->nwrite - p->nread;
+    if(m > n - i)
+      m = n - i;
+    p->splicing = 1;
+    release(&p->lock);
+    r = filewrite(f, src, m);
+    acquire(&p->lock);
+    p->splicing = 0;
+    if(r > 0)
+      p->nread += r;
+    wakeup(&p->nread);
+    wakeup(&p->nwrite);
+    if(r < m){
+      if(r > 0)
+        i += r;
+      else if(i == 0)
+        i = -1;
+      break;
+    }
+  }
+  release(&p->lock);
+  if(i > 0)
+    countsplice(i, 0);
+  return i;
+}
+
+// Acquire the locks of two pipes, always in the same order.
+static void
+lock2(struct pipe *a, struct pipe *b)
+{
+  if(a < b){
+    acquire(&a->lock);
+    acquire(&b->lock);
+  } else {
+    acquire(&b->lock);
+    acquire(&a->lock);
+  }
+}
+
+// Move up to n bytes from pipe in to pipe out.
+// Waits for data as piperead() does, and for room.
+int
+pipesplice(struct pipe *in, struct pipe *out, int n)
+{
+  int i, m, mo, pages;
+  char *src, *dst, *t;
+
+  if(in == out)
+    return -1;
+  lock2(in, out);
+  for(i = pages = 0; i < n; i += m){
+    if((in->nread == in->nwrite && in->writeopen) || in->splicing){
+      if(i > 0)
+        break;
+      if(myproc()->killed){
+        i = -1;
+        break;
+      }
+      release(&out->lock);
+      sleep(&in->nread, &in->lock);
+      release(&in->lock);
+      lock2(in, out);
+      m = 0;
+      continue;
+    }
+    if(in->nread == in->nwrite)
+      break;
+    if(out->nwrite == out->nread + out->size || out->splicing){
+      if(out->readopen == 0 || myproc()->killed){
+        if(i == 0)
+          i = -1;
+        break;
+      }
+      wakeup(&out->nread);
+      release(&in->lock);
+      sleep(&out->nwrite, &out->lock);
+      release(&out->lock);
+      lock2(in, out);
+      m = 0;
+      continue;
+    }
+
+    src = ringaddr(in, in->nread, &m);
+    dst = ringaddr(out, out->nwrite, &mo);
+    if(m > in->nwrite - in->nread)
+      m = in->nwrite - in->nread;
+    if(mo > out->nread + out->size - out->nwrite)
+      mo = out->nread + out->size - out->nwrite;
+    if(m == PGSIZE && mo == PGSIZE && n - i >= PGSIZE){
+      // A full page of data, and an empty page to
+      // receive it: trade them.
+      t = in->page[in->nread % in->size / PGSIZE];
+      in->page[in->nread % in->size / PGSIZE] = out->page[out->nwrite % out->size / PGSIZE];
+      out->page[out->nwrite % out->size / PGSIZE] = t;
+      pages++;
+    } else {
+      if(m > mo)
+        m = mo;
+      if(m > n - i)
+        m = n - i;
+      memmove(dst, src, m);
+    }
+    in->nread += m;
+    out->nwrite += m;
+    wakeup(&in->nwrite);
+    wakeup(&out->nread);
+  }
+  release(&in->lock);
+  release(&out->lock);
+  if(i > 0)
+    countsplice(i, pages);
+  return i;
+}
+
+// Report splice statistics.
+void
+pipestat(struct kstat *st)
+{
+  acquire(&pipestats.lock);
+  st->pipe_spliced = pipestats.spliced;
+  st->pipe_pagemoves = pipestats.pagemoves;
+  release(&pipestats.lock);
+}
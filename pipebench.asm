@@ -0,0 +1,3460 @@
+
+_pipebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  unlink("pipebench.tmp");
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	56                   	push   %esi
+    100e:	53                   	push   %ebx
+    100f:	51                   	push   %ecx
+    1010:	83 ec 0c             	sub    $0xc,%esp
+    1013:	8b 19                	mov    (%ecx),%ebx
+    1015:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc > 1 && strcmp(argv[1], "splice") == 0)
+    1018:	83 fb 01             	cmp    $0x1,%ebx
+    101b:	7e 16                	jle    1033 <main+0x33>
+    101d:	50                   	push   %eax
+    101e:	50                   	push   %eax
+    101f:	68 95 2c 00 00       	push   $0x2c95
+    1024:	ff 76 04             	push   0x4(%esi)
+    1027:	e8 54 08 00 00       	call   1880 <strcmp>
+    102c:	83 c4 10             	add    $0x10,%esp
+    102f:	85 c0                	test   %eax,%eax
+    1031:	74 12                	je     1045 <main+0x45>
+    splicebench(argc > 2 ? atoi(argv[2]) : 4);
+  else
+    throughput(argc, argv);
+    1033:	83 ec 08             	sub    $0x8,%esp
+    1036:	56                   	push   %esi
+    1037:	53                   	push   %ebx
+    1038:	e8 33 00 00 00       	call   1070 <throughput>
+    103d:	83 c4 10             	add    $0x10,%esp
+  exit();
+    1040:	e8 eb 0a 00 00       	call   1b30 <exit>
+    splicebench(argc > 2 ? atoi(argv[2]) : 4);
+    1045:	b8 04 00 00 00       	mov    $0x4,%eax
+    104a:	83 fb 02             	cmp    $0x2,%ebx
+    104d:	75 0e                	jne    105d <main+0x5d>
+    104f:	83 ec 0c             	sub    $0xc,%esp
+    1052:	50                   	push   %eax
+    1053:	e8 f8 06 00 00       	call   1750 <splicebench>
+    1058:	83 c4 10             	add    $0x10,%esp
+    105b:	eb e3                	jmp    1040 <main+0x40>
+    105d:	83 ec 0c             	sub    $0xc,%esp
+    1060:	ff 76 08             	push   0x8(%esi)
+    1063:	e8 b8 09 00 00       	call   1a20 <atoi>
+    1068:	83 c4 10             	add    $0x10,%esp
+    106b:	eb e2                	jmp    104f <main+0x4f>
+    106d:	66 90                	xchg   %ax,%ax
+    106f:	90                   	nop
+
+00001070 <throughput>:
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	57                   	push   %edi
+    1074:	56                   	push   %esi
+    1075:	53                   	push   %ebx
+    1076:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+    107c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    107f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  mb = argc > 1 ? atoi(argv[1]) : 16;
+    1082:	c7 85 d0 fe ff ff 10 	movl   $0x10,-0x130(%ebp)
+    1089:	00 00 00 
+    108c:	83 fb 01             	cmp    $0x1,%ebx
+    108f:	0f 8f e5 01 00 00    	jg     127a <throughput+0x20a>
+  if(pipe(fds) < 0){
+    1095:	83 ec 0c             	sub    $0xc,%esp
+    1098:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+    109e:	50                   	push   %eax
+    109f:	e8 fd 0a 00 00       	call   1ba1 <pipe>
+    10a4:	83 c4 10             	add    $0x10,%esp
+    10a7:	85 c0                	test   %eax,%eax
+    10a9:	0f 88 c1 00 00 00    	js     1170 <throughput+0x100>
+    10af:	c7 85 d4 fe ff ff 00 	movl   $0x1000,-0x12c(%ebp)
+    10b6:	10 00 00 
+    10b9:	bf 00 10 00 00       	mov    $0x1000,%edi
+  sz = fcntl(fds[0], F_GETPIPE_SZ, 0);
+    10be:	83 ec 04             	sub    $0x4,%esp
+    10c1:	6a 00                	push   $0x0
+    10c3:	68 08 04 00 00       	push   $0x408
+    10c8:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    10ce:	e8 09 0c 00 00       	call   1cdc <fcntl>
+  want = mb * 1024 * 1024;
+    10d3:	8b 9d d0 fe ff ff    	mov    -0x130(%ebp),%ebx
+  sz = fcntl(fds[0], F_GETPIPE_SZ, 0);
+    10d9:	89 85 cc fe ff ff    	mov    %eax,-0x134(%ebp)
+  kstat(&before);
+    10df:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    10e5:	89 04 24             	mov    %eax,(%esp)
+  want = mb * 1024 * 1024;
+    10e8:	c1 e3 14             	shl    $0x14,%ebx
+  kstat(&before);
+    10eb:	e8 dd 0b 00 00       	call   1ccd <kstat>
+  start = uptime();
+    10f0:	e8 ab 0b 00 00       	call   1ca0 <uptime>
+    10f5:	89 85 c8 fe ff ff    	mov    %eax,-0x138(%ebp)
+  if(fork() == 0){
+    10fb:	e8 00 0a 00 00       	call   1b00 <fork>
+    1100:	83 c4 10             	add    $0x10,%esp
+    1103:	85 c0                	test   %eax,%eax
+    1105:	75 7d                	jne    1184 <throughput+0x114>
+    close(fds[0]);
+    1107:	83 ec 0c             	sub    $0xc,%esp
+    110a:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    for(total = 0; total < want; total += n){
+    1110:	31 f6                	xor    %esi,%esi
+    close(fds[0]);
+    1112:	e8 b7 0a 00 00       	call   1bce <close>
+    for(total = 0; total < want; total += n){
+    1117:	89 d8                	mov    %ebx,%eax
+    close(fds[0]);
+    1119:	83 c4 10             	add    $0x10,%esp
+    for(total = 0; total < want; total += n){
+    111c:	89 f3                	mov    %esi,%ebx
+    111e:	89 c6                	mov    %eax,%esi
+    1120:	eb 10                	jmp    1132 <throughput+0xc2>
+    1122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1128:	01 c3                	add    %eax,%ebx
+    112a:	39 f3                	cmp    %esi,%ebx
+    112c:	0f 83 f6 01 00 00    	jae    1328 <throughput+0x2b8>
+      n = want - total < chunk ? want - total : chunk;
+    1132:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+    1138:	89 f7                	mov    %esi,%edi
+    113a:	29 df                	sub    %ebx,%edi
+    113c:	39 c7                	cmp    %eax,%edi
+    113e:	0f 47 f8             	cmova  %eax,%edi
+      if(write(fds[1], buf, n) != n){
+    1141:	83 ec 04             	sub    $0x4,%esp
+    1144:	57                   	push   %edi
+    1145:	68 20 37 00 00       	push   $0x3720
+    114a:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+    1150:	e8 6a 0a 00 00       	call   1bbf <write>
+    1155:	83 c4 10             	add    $0x10,%esp
+    1158:	39 f8                	cmp    %edi,%eax
+    115a:	74 cc                	je     1128 <throughput+0xb8>
+        printf(2, "pipebench: write failed\n");
+    115c:	83 ec 08             	sub    $0x8,%esp
+    115f:	68 17 2c 00 00       	push   $0x2c17
+    1164:	6a 02                	push   $0x2
+    1166:	e8 35 0f 00 00       	call   20a0 <printf>
+        exit();
+    116b:	e8 c0 09 00 00       	call   1b30 <exit>
+    printf(2, "pipebench: pipe failed\n");
+    1170:	83 ec 08             	sub    $0x8,%esp
+    1173:	68 ff 2b 00 00       	push   $0x2bff
+    1178:	6a 02                	push   $0x2
+    117a:	e8 21 0f 00 00       	call   20a0 <printf>
+    exit();
+    117f:	e8 ac 09 00 00       	call   1b30 <exit>
+  close(fds[1]);
+    1184:	83 ec 0c             	sub    $0xc,%esp
+    1187:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+  for(total = 0; (n = read(fds[0], buf, chunk)) > 0; total += n)
+    118d:	31 f6                	xor    %esi,%esi
+  close(fds[1]);
+    118f:	e8 3a 0a 00 00       	call   1bce <close>
+  for(total = 0; (n = read(fds[0], buf, chunk)) > 0; total += n)
+    1194:	83 c4 10             	add    $0x10,%esp
+    1197:	eb 09                	jmp    11a2 <throughput+0x132>
+    1199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11a0:	01 c6                	add    %eax,%esi
+    11a2:	83 ec 04             	sub    $0x4,%esp
+    11a5:	57                   	push   %edi
+    11a6:	68 20 37 00 00       	push   $0x3720
+    11ab:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    11b1:	e8 fa 09 00 00       	call   1bb0 <read>
+    11b6:	83 c4 10             	add    $0x10,%esp
+    11b9:	85 c0                	test   %eax,%eax
+    11bb:	7f e3                	jg     11a0 <throughput+0x130>
+  wait();
+    11bd:	e8 d0 09 00 00       	call   1b92 <wait>
+  t = uptime() - start;
+    11c2:	e8 d9 0a 00 00       	call   1ca0 <uptime>
+    11c7:	8b 95 c8 fe ff ff    	mov    -0x138(%ebp),%edx
+  kstat(&after);
+    11cd:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - start;
+    11d0:	29 d0                	sub    %edx,%eax
+    11d2:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  kstat(&after);
+    11d8:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    11de:	50                   	push   %eax
+    11df:	e8 e9 0a 00 00       	call   1ccd <kstat>
+  close(fds[0]);
+    11e4:	58                   	pop    %eax
+    11e5:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    11eb:	e8 de 09 00 00       	call   1bce <close>
+  if(total != want){
+    11f0:	83 c4 10             	add    $0x10,%esp
+    11f3:	39 de                	cmp    %ebx,%esi
+    11f5:	0f 85 32 01 00 00    	jne    132d <throughput+0x2bd>
+  printf(1, "pipebench: %d MB in %d-byte chunks through a %d-byte pipe in %d ticks",
+    11fb:	8b b5 d4 fe ff ff    	mov    -0x12c(%ebp),%esi
+    1201:	83 ec 08             	sub    $0x8,%esp
+  sw = after.sched_switches - before.sched_switches;
+    1204:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1207:	2b 9d 60 ff ff ff    	sub    -0xa0(%ebp),%ebx
+  printf(1, "pipebench: %d MB in %d-byte chunks through a %d-byte pipe in %d ticks",
+    120d:	56                   	push   %esi
+    120e:	ff b5 cc fe ff ff    	push   -0x134(%ebp)
+    1214:	57                   	push   %edi
+    1215:	8b bd d0 fe ff ff    	mov    -0x130(%ebp),%edi
+    121b:	57                   	push   %edi
+    121c:	68 cc 2a 00 00       	push   $0x2acc
+    1221:	6a 01                	push   $0x1
+    1223:	e8 78 0e 00 00       	call   20a0 <printf>
+  if(t > 0)
+    1228:	83 c4 20             	add    $0x20,%esp
+    122b:	85 f6                	test   %esi,%esi
+    122d:	7e 1c                	jle    124b <throughput+0x1db>
+    printf(1, ", %d KB/s", mb*1024*100/t);
+    122f:	69 c7 00 90 01 00    	imul   $0x19000,%edi,%eax
+    1235:	83 ec 04             	sub    $0x4,%esp
+    1238:	99                   	cltd
+    1239:	f7 fe                	idiv   %esi
+    123b:	50                   	push   %eax
+    123c:	68 30 2c 00 00       	push   $0x2c30
+    1241:	6a 01                	push   $0x1
+    1243:	e8 58 0e 00 00       	call   20a0 <printf>
+    1248:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n");
+    124b:	83 ec 08             	sub    $0x8,%esp
+    124e:	68 15 2c 00 00       	push   $0x2c15
+    1253:	6a 01                	push   $0x1
+    1255:	e8 46 0e 00 00       	call   20a0 <printf>
+  printf(1, "pipebench: %d context switches, %d per MB\n", sw, sw / mb);
+    125a:	89 d8                	mov    %ebx,%eax
+    125c:	31 d2                	xor    %edx,%edx
+    125e:	f7 b5 d0 fe ff ff    	divl   -0x130(%ebp)
+    1264:	50                   	push   %eax
+    1265:	53                   	push   %ebx
+    1266:	68 14 2b 00 00       	push   $0x2b14
+    126b:	6a 01                	push   $0x1
+    126d:	e8 2e 0e 00 00       	call   20a0 <printf>
+}
+    1272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1275:	5b                   	pop    %ebx
+    1276:	5e                   	pop    %esi
+    1277:	5f                   	pop    %edi
+    1278:	5d                   	pop    %ebp
+    1279:	c3                   	ret
+  mb = argc > 1 ? atoi(argv[1]) : 16;
+    127a:	83 ec 0c             	sub    $0xc,%esp
+    127d:	ff 76 04             	push   0x4(%esi)
+    1280:	e8 9b 07 00 00       	call   1a20 <atoi>
+  chunk = argc > 2 ? atoi(argv[2]) : 4096;
+    1285:	83 c4 10             	add    $0x10,%esp
+  mb = argc > 1 ? atoi(argv[1]) : 16;
+    1288:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+  chunk = argc > 2 ? atoi(argv[2]) : 4096;
+    128e:	83 fb 02             	cmp    $0x2,%ebx
+    1291:	75 1d                	jne    12b0 <throughput+0x240>
+  if(mb <= 0 || chunk <= 0 || chunk > sizeof(buf)){
+    1293:	85 c0                	test   %eax,%eax
+    1295:	0f 8f fa fd ff ff    	jg     1095 <throughput+0x25>
+    printf(2, "usage: pipebench [mb [chunk [pipesz]]]\n");
+    129b:	83 ec 08             	sub    $0x8,%esp
+    129e:	68 58 2a 00 00       	push   $0x2a58
+    12a3:	6a 02                	push   $0x2
+    12a5:	e8 f6 0d 00 00       	call   20a0 <printf>
+    exit();
+    12aa:	e8 81 08 00 00       	call   1b30 <exit>
+    12af:	90                   	nop
+  chunk = argc > 2 ? atoi(argv[2]) : 4096;
+    12b0:	83 ec 0c             	sub    $0xc,%esp
+    12b3:	ff 76 08             	push   0x8(%esi)
+    12b6:	e8 65 07 00 00       	call   1a20 <atoi>
+  if(mb <= 0 || chunk <= 0 || chunk > sizeof(buf)){
+    12bb:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+    12c1:	83 c4 10             	add    $0x10,%esp
+  chunk = argc > 2 ? atoi(argv[2]) : 4096;
+    12c4:	89 c7                	mov    %eax,%edi
+  if(mb <= 0 || chunk <= 0 || chunk > sizeof(buf)){
+    12c6:	85 c9                	test   %ecx,%ecx
+    12c8:	7e d1                	jle    129b <throughput+0x22b>
+    12ca:	85 c0                	test   %eax,%eax
+    12cc:	7e cd                	jle    129b <throughput+0x22b>
+    12ce:	3d 00 00 01 00       	cmp    $0x10000,%eax
+    12d3:	7f c6                	jg     129b <throughput+0x22b>
+  if(pipe(fds) < 0){
+    12d5:	83 ec 0c             	sub    $0xc,%esp
+    12d8:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+    12de:	50                   	push   %eax
+    12df:	e8 bd 08 00 00       	call   1ba1 <pipe>
+    12e4:	83 c4 10             	add    $0x10,%esp
+    12e7:	85 c0                	test   %eax,%eax
+    12e9:	0f 88 81 fe ff ff    	js     1170 <throughput+0x100>
+  if(argc > 3 && fcntl(fds[1], F_SETPIPE_SZ, atoi(argv[3])) < 0){
+    12ef:	83 fb 03             	cmp    $0x3,%ebx
+    12f2:	74 26                	je     131a <throughput+0x2aa>
+    12f4:	83 ec 0c             	sub    $0xc,%esp
+    12f7:	ff 76 0c             	push   0xc(%esi)
+    12fa:	e8 21 07 00 00       	call   1a20 <atoi>
+    12ff:	83 c4 0c             	add    $0xc,%esp
+    1302:	50                   	push   %eax
+    1303:	68 07 04 00 00       	push   $0x407
+    1308:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+    130e:	e8 c9 09 00 00       	call   1cdc <fcntl>
+    1313:	83 c4 10             	add    $0x10,%esp
+    1316:	85 c0                	test   %eax,%eax
+    1318:	78 26                	js     1340 <throughput+0x2d0>
+  if(mb <= 0 || chunk <= 0 || chunk > sizeof(buf)){
+    131a:	89 bd d4 fe ff ff    	mov    %edi,-0x12c(%ebp)
+    1320:	e9 99 fd ff ff       	jmp    10be <throughput+0x4e>
+    1325:	8d 76 00             	lea    0x0(%esi),%esi
+    exit();
+    1328:	e8 03 08 00 00       	call   1b30 <exit>
+    printf(2, "pipebench: read %d bytes, want %d\n", total, want);
+    132d:	53                   	push   %ebx
+    132e:	56                   	push   %esi
+    132f:	68 a8 2a 00 00       	push   $0x2aa8
+    1334:	6a 02                	push   $0x2
+    1336:	e8 65 0d 00 00       	call   20a0 <printf>
+    exit();
+    133b:	e8 f0 07 00 00       	call   1b30 <exit>
+    printf(2, "pipebench: cannot resize pipe to %s\n", argv[3]);
+    1340:	52                   	push   %edx
+    1341:	ff 76 0c             	push   0xc(%esi)
+    1344:	68 80 2a 00 00       	push   $0x2a80
+    1349:	6a 02                	push   $0x2
+    134b:	e8 50 0d 00 00       	call   20a0 <printf>
+    exit();
+    1350:	e8 db 07 00 00       	call   1b30 <exit>
+    1355:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001360 <relay>:
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	57                   	push   %edi
+    1364:	56                   	push   %esi
+    1365:	53                   	push   %ebx
+    1366:	83 ec 0c             	sub    $0xc,%esp
+    if(splicing)
+    1369:	8b 45 10             	mov    0x10(%ebp),%eax
+{
+    136c:	8b 75 08             	mov    0x8(%ebp),%esi
+    136f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    if(splicing)
+    1372:	85 c0                	test   %eax,%eax
+    1374:	75 3c                	jne    13b2 <relay+0x52>
+    else if((n = read(in, buf, 4096)) > 0 && write(out, buf, n) != n)
+    1376:	83 ec 04             	sub    $0x4,%esp
+    1379:	68 00 10 00 00       	push   $0x1000
+    137e:	68 20 37 00 00       	push   $0x3720
+    1383:	56                   	push   %esi
+    1384:	e8 27 08 00 00       	call   1bb0 <read>
+    1389:	83 c4 10             	add    $0x10,%esp
+    138c:	89 c3                	mov    %eax,%ebx
+    138e:	85 c0                	test   %eax,%eax
+    1390:	7f 3e                	jg     13d0 <relay+0x70>
+    if(n == 0)
+    1392:	74 34                	je     13c8 <relay+0x68>
+      printf(2, "pipebench: %s failed\n", splicing ? "splice" : "read/write");
+    1394:	b8 7f 2c 00 00       	mov    $0x2c7f,%eax
+    1399:	83 ec 04             	sub    $0x4,%esp
+    139c:	50                   	push   %eax
+    139d:	68 3a 2c 00 00       	push   $0x2c3a
+    13a2:	6a 02                	push   $0x2
+    13a4:	e8 f7 0c 00 00       	call   20a0 <printf>
+      exit();
+    13a9:	e8 82 07 00 00       	call   1b30 <exit>
+    13ae:	66 90                	xchg   %ax,%ax
+    if(n < 0){
+    13b0:	78 36                	js     13e8 <relay+0x88>
+      n = splice(in, out, sizeof(buf));
+    13b2:	83 ec 04             	sub    $0x4,%esp
+    13b5:	68 00 00 01 00       	push   $0x10000
+    13ba:	57                   	push   %edi
+    13bb:	56                   	push   %esi
+    13bc:	e8 2a 09 00 00       	call   1ceb <splice>
+    if(n == 0)
+    13c1:	83 c4 10             	add    $0x10,%esp
+    13c4:	85 c0                	test   %eax,%eax
+    13c6:	75 e8                	jne    13b0 <relay+0x50>
+}
+    13c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13cb:	5b                   	pop    %ebx
+    13cc:	5e                   	pop    %esi
+    13cd:	5f                   	pop    %edi
+    13ce:	5d                   	pop    %ebp
+    13cf:	c3                   	ret
+    else if((n = read(in, buf, 4096)) > 0 && write(out, buf, n) != n)
+    13d0:	83 ec 04             	sub    $0x4,%esp
+    13d3:	50                   	push   %eax
+    13d4:	68 20 37 00 00       	push   $0x3720
+    13d9:	57                   	push   %edi
+    13da:	e8 e0 07 00 00       	call   1bbf <write>
+    13df:	83 c4 10             	add    $0x10,%esp
+    13e2:	39 c3                	cmp    %eax,%ebx
+    13e4:	75 ae                	jne    1394 <relay+0x34>
+    13e6:	eb 8e                	jmp    1376 <relay+0x16>
+      printf(2, "pipebench: %s failed\n", splicing ? "splice" : "read/write");
+    13e8:	b8 95 2c 00 00       	mov    $0x2c95,%eax
+    13ed:	eb aa                	jmp    1399 <relay+0x39>
+    13ef:	90                   	nop
+
+000013f0 <drain>:
+{
+    13f0:	55                   	push   %ebp
+    13f1:	89 e5                	mov    %esp,%ebp
+    13f3:	56                   	push   %esi
+    13f4:	53                   	push   %ebx
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n)
+    13f5:	31 db                	xor    %ebx,%ebx
+{
+    13f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n)
+    13fa:	eb 06                	jmp    1402 <drain+0x12>
+    13fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1400:	01 c3                	add    %eax,%ebx
+    1402:	83 ec 04             	sub    $0x4,%esp
+    1405:	68 00 00 01 00       	push   $0x10000
+    140a:	68 20 37 00 00       	push   $0x3720
+    140f:	56                   	push   %esi
+    1410:	e8 9b 07 00 00       	call   1bb0 <read>
+    1415:	83 c4 10             	add    $0x10,%esp
+    1418:	85 c0                	test   %eax,%eax
+    141a:	7f e4                	jg     1400 <drain+0x10>
+}
+    141c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    141f:	89 d8                	mov    %ebx,%eax
+    1421:	5b                   	pop    %ebx
+    1422:	5e                   	pop    %esi
+    1423:	5d                   	pop    %ebp
+    1424:	c3                   	ret
+    1425:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001430 <splicerun>:
+{
+    1430:	55                   	push   %ebp
+    1431:	89 e5                	mov    %esp,%ebp
+    1433:	57                   	push   %edi
+    1434:	56                   	push   %esi
+  kstat(&before);
+    1435:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+{
+    143b:	53                   	push   %ebx
+    143c:	81 ec 48 01 00 00    	sub    $0x148,%esp
+  want = mb * 1024 * 1024;
+    1442:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  kstat(&before);
+    1445:	50                   	push   %eax
+  want = mb * 1024 * 1024;
+    1446:	c1 e3 14             	shl    $0x14,%ebx
+  kstat(&before);
+    1449:	e8 7f 08 00 00       	call   1ccd <kstat>
+  start = uptime();
+    144e:	e8 4d 08 00 00       	call   1ca0 <uptime>
+    1453:	89 85 c4 fe ff ff    	mov    %eax,-0x13c(%ebp)
+  if(pipe(b) < 0 || (topipe && pipe(a) < 0)){
+    1459:	8d 85 d8 fe ff ff    	lea    -0x128(%ebp),%eax
+    145f:	89 04 24             	mov    %eax,(%esp)
+    1462:	e8 3a 07 00 00       	call   1ba1 <pipe>
+    1467:	83 c4 10             	add    $0x10,%esp
+    146a:	85 c0                	test   %eax,%eax
+    146c:	0f 88 a7 02 00 00    	js     1719 <splicerun+0x2e9>
+    1472:	8b 45 10             	mov    0x10(%ebp),%eax
+    1475:	85 c0                	test   %eax,%eax
+    1477:	74 57                	je     14d0 <splicerun+0xa0>
+    1479:	83 ec 0c             	sub    $0xc,%esp
+    147c:	8d 85 d0 fe ff ff    	lea    -0x130(%ebp),%eax
+    1482:	50                   	push   %eax
+    1483:	e8 19 07 00 00       	call   1ba1 <pipe>
+    1488:	83 c4 10             	add    $0x10,%esp
+    148b:	85 c0                	test   %eax,%eax
+    148d:	0f 88 86 02 00 00    	js     1719 <splicerun+0x2e9>
+  if(topipe && fork() == 0){
+    1493:	e8 68 06 00 00       	call   1b00 <fork>
+    1498:	85 c0                	test   %eax,%eax
+    149a:	0f 84 b2 01 00 00    	je     1652 <splicerun+0x222>
+  if(fork() == 0){
+    14a0:	e8 5b 06 00 00       	call   1b00 <fork>
+    14a5:	85 c0                	test   %eax,%eax
+    14a7:	0f 84 33 02 00 00    	je     16e0 <splicerun+0x2b0>
+    close(a[0]);
+    14ad:	83 ec 0c             	sub    $0xc,%esp
+    14b0:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+    14b6:	e8 13 07 00 00       	call   1bce <close>
+    close(a[1]);
+    14bb:	59                   	pop    %ecx
+    14bc:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+    14c2:	e8 07 07 00 00       	call   1bce <close>
+    14c7:	83 c4 10             	add    $0x10,%esp
+    14ca:	eb 11                	jmp    14dd <splicerun+0xad>
+    14cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(fork() == 0){
+    14d0:	e8 2b 06 00 00       	call   1b00 <fork>
+    14d5:	85 c0                	test   %eax,%eax
+    14d7:	0f 84 e4 00 00 00    	je     15c1 <splicerun+0x191>
+  close(b[1]);
+    14dd:	83 ec 0c             	sub    $0xc,%esp
+    14e0:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n)
+    14e6:	31 f6                	xor    %esi,%esi
+  close(b[1]);
+    14e8:	e8 e1 06 00 00       	call   1bce <close>
+  total = drain(b[0]);
+    14ed:	8b bd d8 fe ff ff    	mov    -0x128(%ebp),%edi
+    14f3:	83 c4 10             	add    $0x10,%esp
+    14f6:	eb 0a                	jmp    1502 <splicerun+0xd2>
+    14f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ff:	90                   	nop
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n)
+    1500:	01 c6                	add    %eax,%esi
+    1502:	83 ec 04             	sub    $0x4,%esp
+    1505:	68 00 00 01 00       	push   $0x10000
+    150a:	68 20 37 00 00       	push   $0x3720
+    150f:	57                   	push   %edi
+    1510:	e8 9b 06 00 00       	call   1bb0 <read>
+    1515:	83 c4 10             	add    $0x10,%esp
+    1518:	85 c0                	test   %eax,%eax
+    151a:	7f e4                	jg     1500 <splicerun+0xd0>
+  close(b[0]);
+    151c:	83 ec 0c             	sub    $0xc,%esp
+    151f:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    1525:	e8 a4 06 00 00       	call   1bce <close>
+  wait();
+    152a:	e8 63 06 00 00       	call   1b92 <wait>
+  if(topipe)
+    152f:	8b 55 10             	mov    0x10(%ebp),%edx
+    1532:	83 c4 10             	add    $0x10,%esp
+    1535:	85 d2                	test   %edx,%edx
+    1537:	0f 85 0b 01 00 00    	jne    1648 <splicerun+0x218>
+  t = uptime() - start;
+    153d:	e8 5e 07 00 00       	call   1ca0 <uptime>
+    1542:	8b 8d c4 fe ff ff    	mov    -0x13c(%ebp),%ecx
+  kstat(&after);
+    1548:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - start;
+    154b:	29 c8                	sub    %ecx,%eax
+    154d:	89 c7                	mov    %eax,%edi
+  kstat(&after);
+    154f:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    1555:	50                   	push   %eax
+    1556:	e8 72 07 00 00       	call   1ccd <kstat>
+  if(total != want){
+    155b:	83 c4 10             	add    $0x10,%esp
+    155e:	39 f3                	cmp    %esi,%ebx
+    1560:	0f 85 c6 01 00 00    	jne    172c <splicerun+0x2fc>
+  printf(1, "%s: %d MB in %d ticks", what, mb, t);
+    1566:	83 ec 0c             	sub    $0xc,%esp
+    1569:	57                   	push   %edi
+    156a:	ff 75 0c             	push   0xc(%ebp)
+    156d:	ff 75 08             	push   0x8(%ebp)
+    1570:	68 5e 2c 00 00       	push   $0x2c5e
+    1575:	6a 01                	push   $0x1
+    1577:	e8 24 0b 00 00       	call   20a0 <printf>
+  if(t > 0)
+    157c:	83 c4 20             	add    $0x20,%esp
+    157f:	85 ff                	test   %edi,%edi
+    1581:	7e 1d                	jle    15a0 <splicerun+0x170>
+    printf(1, ", %d KB/s", mb*1024*100/t);
+    1583:	69 45 0c 00 90 01 00 	imul   $0x19000,0xc(%ebp),%eax
+    158a:	83 ec 04             	sub    $0x4,%esp
+    158d:	99                   	cltd
+    158e:	f7 ff                	idiv   %edi
+    1590:	50                   	push   %eax
+    1591:	68 30 2c 00 00       	push   $0x2c30
+    1596:	6a 01                	push   $0x1
+    1598:	e8 03 0b 00 00       	call   20a0 <printf>
+    159d:	83 c4 10             	add    $0x10,%esp
+  if(splicing)
+    15a0:	8b 45 14             	mov    0x14(%ebp),%eax
+    15a3:	85 c0                	test   %eax,%eax
+    15a5:	75 71                	jne    1618 <splicerun+0x1e8>
+  printf(1, "\n");
+    15a7:	83 ec 08             	sub    $0x8,%esp
+    15aa:	68 15 2c 00 00       	push   $0x2c15
+    15af:	6a 01                	push   $0x1
+    15b1:	e8 ea 0a 00 00       	call   20a0 <printf>
+}
+    15b6:	83 c4 10             	add    $0x10,%esp
+    15b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15bc:	5b                   	pop    %ebx
+    15bd:	5e                   	pop    %esi
+    15be:	5f                   	pop    %edi
+    15bf:	5d                   	pop    %ebp
+    15c0:	c3                   	ret
+    close(b[0]);
+    15c1:	83 ec 0c             	sub    $0xc,%esp
+    15c4:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    15ca:	e8 ff 05 00 00       	call   1bce <close>
+      if((fd = open("pipebench.tmp", O_RDONLY)) < 0){
+    15cf:	5e                   	pop    %esi
+    15d0:	5f                   	pop    %edi
+    15d1:	6a 00                	push   $0x0
+    15d3:	68 50 2c 00 00       	push   $0x2c50
+    15d8:	e8 1e 06 00 00       	call   1bfb <open>
+    15dd:	83 c4 10             	add    $0x10,%esp
+    15e0:	85 c0                	test   %eax,%eax
+    15e2:	78 1a                	js     15fe <splicerun+0x1ce>
+      relay(fd, b[1], splicing);
+    15e4:	83 ec 04             	sub    $0x4,%esp
+    15e7:	ff 75 14             	push   0x14(%ebp)
+    15ea:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+    15f0:	50                   	push   %eax
+    15f1:	e8 6a fd ff ff       	call   1360 <relay>
+    15f6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    15f9:	e8 32 05 00 00       	call   1b30 <exit>
+        printf(2, "pipebench: open pipebench.tmp failed\n");
+    15fe:	83 ec 08             	sub    $0x8,%esp
+    1601:	68 40 2b 00 00       	push   $0x2b40
+    1606:	6a 02                	push   $0x2
+    1608:	e8 93 0a 00 00       	call   20a0 <printf>
+        exit();
+    160d:	e8 1e 05 00 00       	call   1b30 <exit>
+    1612:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, ", %d KB spliced, %d pages moved",
+    1618:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    161b:	2b 85 4c ff ff ff    	sub    -0xb4(%ebp),%eax
+    1621:	50                   	push   %eax
+      (after.pipe_spliced - before.pipe_spliced) / 1024,
+    1622:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    1625:	2b 85 48 ff ff ff    	sub    -0xb8(%ebp),%eax
+    printf(1, ", %d KB spliced, %d pages moved",
+    162b:	c1 e8 0a             	shr    $0xa,%eax
+    162e:	50                   	push   %eax
+    162f:	68 90 2b 00 00       	push   $0x2b90
+    1634:	6a 01                	push   $0x1
+    1636:	e8 65 0a 00 00       	call   20a0 <printf>
+    163b:	83 c4 10             	add    $0x10,%esp
+    163e:	e9 64 ff ff ff       	jmp    15a7 <splicerun+0x177>
+    1643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1647:	90                   	nop
+    wait();
+    1648:	e8 45 05 00 00       	call   1b92 <wait>
+    164d:	e9 eb fe ff ff       	jmp    153d <splicerun+0x10d>
+    close(a[0]);
+    1652:	83 ec 0c             	sub    $0xc,%esp
+    1655:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+    165b:	e8 6e 05 00 00       	call   1bce <close>
+    close(b[0]);
+    1660:	58                   	pop    %eax
+    1661:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    1667:	e8 62 05 00 00       	call   1bce <close>
+    close(b[1]);
+    166c:	58                   	pop    %eax
+    166d:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+    1673:	e8 56 05 00 00       	call   1bce <close>
+    for(total = 0; total < want; total += n){
+    1678:	83 c4 10             	add    $0x10,%esp
+    167b:	85 db                	test   %ebx,%ebx
+    167d:	0f 84 76 ff ff ff    	je     15f9 <splicerun+0x1c9>
+    1683:	31 ff                	xor    %edi,%edi
+    1685:	eb 13                	jmp    169a <splicerun+0x26a>
+    1687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    168e:	66 90                	xchg   %ax,%ax
+    1690:	01 c7                	add    %eax,%edi
+    1692:	39 df                	cmp    %ebx,%edi
+    1694:	0f 83 5f ff ff ff    	jae    15f9 <splicerun+0x1c9>
+      n = want - total < sizeof(buf) ? want - total : sizeof(buf);
+    169a:	89 de                	mov    %ebx,%esi
+    169c:	b8 00 00 01 00       	mov    $0x10000,%eax
+    16a1:	29 fe                	sub    %edi,%esi
+    16a3:	39 c6                	cmp    %eax,%esi
+    16a5:	0f 47 f0             	cmova  %eax,%esi
+      if(write(a[1], buf, n) != n){
+    16a8:	83 ec 04             	sub    $0x4,%esp
+    16ab:	56                   	push   %esi
+    16ac:	68 20 37 00 00       	push   $0x3720
+    16b1:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+    16b7:	e8 03 05 00 00       	call   1bbf <write>
+    16bc:	83 c4 10             	add    $0x10,%esp
+    16bf:	39 f0                	cmp    %esi,%eax
+    16c1:	74 cd                	je     1690 <splicerun+0x260>
+        printf(2, "pipebench: write failed\n");
+    16c3:	83 ec 08             	sub    $0x8,%esp
+    16c6:	68 17 2c 00 00       	push   $0x2c17
+    16cb:	6a 02                	push   $0x2
+    16cd:	e8 ce 09 00 00       	call   20a0 <printf>
+        exit();
+    16d2:	e8 59 04 00 00       	call   1b30 <exit>
+    16d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16de:	66 90                	xchg   %ax,%ax
+    close(b[0]);
+    16e0:	83 ec 0c             	sub    $0xc,%esp
+    16e3:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+    16e9:	e8 e0 04 00 00       	call   1bce <close>
+      close(a[1]);
+    16ee:	5b                   	pop    %ebx
+    16ef:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+    16f5:	e8 d4 04 00 00       	call   1bce <close>
+      relay(a[0], b[1], splicing);
+    16fa:	83 c4 0c             	add    $0xc,%esp
+    16fd:	ff 75 14             	push   0x14(%ebp)
+    1700:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+    1706:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+    170c:	e8 4f fc ff ff       	call   1360 <relay>
+    1711:	83 c4 10             	add    $0x10,%esp
+    1714:	e9 e0 fe ff ff       	jmp    15f9 <splicerun+0x1c9>
+    printf(2, "pipebench: pipe failed\n");
+    1719:	50                   	push   %eax
+    171a:	50                   	push   %eax
+    171b:	68 ff 2b 00 00       	push   $0x2bff
+    1720:	6a 02                	push   $0x2
+    1722:	e8 79 09 00 00       	call   20a0 <printf>
+    exit();
+    1727:	e8 04 04 00 00       	call   1b30 <exit>
+    printf(2, "pipebench: %s moved %d bytes, want %d\n", what, total, want);
+    172c:	83 ec 0c             	sub    $0xc,%esp
+    172f:	53                   	push   %ebx
+    1730:	56                   	push   %esi
+    1731:	ff 75 08             	push   0x8(%ebp)
+    1734:	68 68 2b 00 00       	push   $0x2b68
+    1739:	6a 02                	push   $0x2
+    173b:	e8 60 09 00 00       	call   20a0 <printf>
+    exit();
+    1740:	83 c4 20             	add    $0x20,%esp
+    1743:	e9 b1 fe ff ff       	jmp    15f9 <splicerun+0x1c9>
+    1748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174f:	90                   	nop
+
+00001750 <splicebench>:
+{
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	57                   	push   %edi
+    1754:	56                   	push   %esi
+    1755:	53                   	push   %ebx
+    1756:	83 ec 24             	sub    $0x24,%esp
+    1759:	8b 75 08             	mov    0x8(%ebp),%esi
+    175c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  if((fd = open("pipebench.tmp", O_CREATE|O_RDWR)) < 0){
+    175f:	68 02 02 00 00       	push   $0x202
+    1764:	68 50 2c 00 00       	push   $0x2c50
+    1769:	e8 8d 04 00 00       	call   1bfb <open>
+    176e:	83 c4 10             	add    $0x10,%esp
+    1771:	85 c0                	test   %eax,%eax
+    1773:	0f 88 b6 00 00 00    	js     182f <splicebench+0xdf>
+    1779:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < mb*1024*1024; i += sizeof(buf))
+    177b:	89 f0                	mov    %esi,%eax
+    177d:	31 ff                	xor    %edi,%edi
+    177f:	c1 e6 14             	shl    $0x14,%esi
+    1782:	85 c0                	test   %eax,%eax
+    1784:	7e 31                	jle    17b7 <splicebench+0x67>
+    1786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1790:	83 ec 04             	sub    $0x4,%esp
+    1793:	68 00 00 01 00       	push   $0x10000
+    1798:	68 20 37 00 00       	push   $0x3720
+    179d:	53                   	push   %ebx
+    179e:	e8 1c 04 00 00       	call   1bbf <write>
+    17a3:	83 c4 10             	add    $0x10,%esp
+    17a6:	3d 00 00 01 00       	cmp    $0x10000,%eax
+    17ab:	75 6e                	jne    181b <splicebench+0xcb>
+  for(i = 0; i < mb*1024*1024; i += sizeof(buf))
+    17ad:	81 c7 00 00 01 00    	add    $0x10000,%edi
+    17b3:	39 f7                	cmp    %esi,%edi
+    17b5:	7c d9                	jl     1790 <splicebench+0x40>
+  close(fd);
+    17b7:	83 ec 0c             	sub    $0xc,%esp
+    17ba:	53                   	push   %ebx
+    17bb:	e8 0e 04 00 00       	call   1bce <close>
+  splicerun("file->pipe read/write", mb, 0, 0);
+    17c0:	6a 00                	push   $0x0
+    17c2:	6a 00                	push   $0x0
+    17c4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    17c7:	53                   	push   %ebx
+    17c8:	68 74 2c 00 00       	push   $0x2c74
+    17cd:	e8 5e fc ff ff       	call   1430 <splicerun>
+  splicerun("file->pipe splice", mb, 0, 1);
+    17d2:	83 c4 20             	add    $0x20,%esp
+    17d5:	6a 01                	push   $0x1
+    17d7:	6a 00                	push   $0x0
+    17d9:	53                   	push   %ebx
+    17da:	68 8a 2c 00 00       	push   $0x2c8a
+    17df:	e8 4c fc ff ff       	call   1430 <splicerun>
+  splicerun("pipe->pipe read/write", mb, 1, 0);
+    17e4:	6a 00                	push   $0x0
+    17e6:	6a 01                	push   $0x1
+    17e8:	53                   	push   %ebx
+    17e9:	68 9c 2c 00 00       	push   $0x2c9c
+    17ee:	e8 3d fc ff ff       	call   1430 <splicerun>
+  splicerun("pipe->pipe splice", mb, 1, 1);
+    17f3:	83 c4 20             	add    $0x20,%esp
+    17f6:	6a 01                	push   $0x1
+    17f8:	6a 01                	push   $0x1
+    17fa:	53                   	push   %ebx
+    17fb:	68 b2 2c 00 00       	push   $0x2cb2
+    1800:	e8 2b fc ff ff       	call   1430 <splicerun>
+  unlink("pipebench.tmp");
+    1805:	c7 45 08 50 2c 00 00 	movl   $0x2c50,0x8(%ebp)
+    180c:	83 c4 10             	add    $0x10,%esp
+}
+    180f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1812:	5b                   	pop    %ebx
+    1813:	5e                   	pop    %esi
+    1814:	5f                   	pop    %edi
+    1815:	5d                   	pop    %ebp
+  unlink("pipebench.tmp");
+    1816:	e9 fe 03 00 00       	jmp    1c19 <unlink>
+      printf(2, "pipebench: write pipebench.tmp failed\n");
+    181b:	83 ec 08             	sub    $0x8,%esp
+    181e:	68 d8 2b 00 00       	push   $0x2bd8
+    1823:	6a 02                	push   $0x2
+    1825:	e8 76 08 00 00       	call   20a0 <printf>
+      exit();
+    182a:	e8 01 03 00 00       	call   1b30 <exit>
+    printf(2, "pipebench: create pipebench.tmp failed\n");
+    182f:	50                   	push   %eax
+    1830:	50                   	push   %eax
+    1831:	68 b0 2b 00 00       	push   $0x2bb0
+    1836:	6a 02                	push   $0x2
+    1838:	e8 63 08 00 00       	call   20a0 <printf>
+    exit();
+    183d:	e8 ee 02 00 00       	call   1b30 <exit>
+    1842:	66 90                	xchg   %ax,%ax
+    1844:	66 90                	xchg   %ax,%ax
+    1846:	66 90                	xchg   %ax,%ax
+    1848:	66 90                	xchg   %ax,%ax
+    184a:	66 90                	xchg   %ax,%ax
+    184c:	66 90                	xchg   %ax,%ax
+    184e:	66 90                	xchg   %ax,%ax
+
+00001850 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1850:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1851:	31 c0                	xor    %eax,%eax
+{
+    1853:	89 e5                	mov    %esp,%ebp
+    1855:	53                   	push   %ebx
+    1856:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1859:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    185c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1860:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1864:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1867:	83 c0 01             	add    $0x1,%eax
+    186a:	84 d2                	test   %dl,%dl
+    186c:	75 f2                	jne    1860 <strcpy+0x10>
+    ;
+  return os;
+}
+    186e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1871:	89 c8                	mov    %ecx,%eax
+    1873:	c9                   	leave
+    1874:	c3                   	ret
+    1875:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001880 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1880:	55                   	push   %ebp
+    1881:	89 e5                	mov    %esp,%ebp
+    1883:	53                   	push   %ebx
+    1884:	8b 55 08             	mov    0x8(%ebp),%edx
+    1887:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    188a:	0f b6 02             	movzbl (%edx),%eax
+    188d:	84 c0                	test   %al,%al
+    188f:	75 17                	jne    18a8 <strcmp+0x28>
+    1891:	eb 3a                	jmp    18cd <strcmp+0x4d>
+    1893:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1897:	90                   	nop
+    1898:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    189c:	83 c2 01             	add    $0x1,%edx
+    189f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    18a2:	84 c0                	test   %al,%al
+    18a4:	74 1a                	je     18c0 <strcmp+0x40>
+    p++, q++;
+    18a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    18a8:	0f b6 19             	movzbl (%ecx),%ebx
+    18ab:	38 c3                	cmp    %al,%bl
+    18ad:	74 e9                	je     1898 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    18af:	29 d8                	sub    %ebx,%eax
+}
+    18b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18b4:	c9                   	leave
+    18b5:	c3                   	ret
+    18b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    18c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    18c4:	31 c0                	xor    %eax,%eax
+    18c6:	29 d8                	sub    %ebx,%eax
+}
+    18c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18cb:	c9                   	leave
+    18cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    18cd:	0f b6 19             	movzbl (%ecx),%ebx
+    18d0:	31 c0                	xor    %eax,%eax
+    18d2:	eb db                	jmp    18af <strcmp+0x2f>
+    18d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18df:	90                   	nop
+
+000018e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    18e0:	55                   	push   %ebp
+    18e1:	89 e5                	mov    %esp,%ebp
+    18e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    18e6:	80 3a 00             	cmpb   $0x0,(%edx)
+    18e9:	74 15                	je     1900 <strlen+0x20>
+    18eb:	31 c0                	xor    %eax,%eax
+    18ed:	8d 76 00             	lea    0x0(%esi),%esi
+    18f0:	83 c0 01             	add    $0x1,%eax
+    18f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    18f7:	89 c1                	mov    %eax,%ecx
+    18f9:	75 f5                	jne    18f0 <strlen+0x10>
+    ;
+  return n;
+}
+    18fb:	89 c8                	mov    %ecx,%eax
+    18fd:	5d                   	pop    %ebp
+    18fe:	c3                   	ret
+    18ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1900:	31 c9                	xor    %ecx,%ecx
+}
+    1902:	5d                   	pop    %ebp
+    1903:	89 c8                	mov    %ecx,%eax
+    1905:	c3                   	ret
+    1906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    190d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001910 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1910:	55                   	push   %ebp
+    1911:	89 e5                	mov    %esp,%ebp
+    1913:	57                   	push   %edi
+    1914:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1917:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    191a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    191d:	89 d7                	mov    %edx,%edi
+    191f:	fc                   	cld
+    1920:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1922:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1925:	89 d0                	mov    %edx,%eax
+    1927:	c9                   	leave
+    1928:	c3                   	ret
+    1929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001930 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1930:	55                   	push   %ebp
+    1931:	89 e5                	mov    %esp,%ebp
+    1933:	8b 45 08             	mov    0x8(%ebp),%eax
+    1936:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    193a:	0f b6 10             	movzbl (%eax),%edx
+    193d:	84 d2                	test   %dl,%dl
+    193f:	75 12                	jne    1953 <strchr+0x23>
+    1941:	eb 1d                	jmp    1960 <strchr+0x30>
+    1943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1947:	90                   	nop
+    1948:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    194c:	83 c0 01             	add    $0x1,%eax
+    194f:	84 d2                	test   %dl,%dl
+    1951:	74 0d                	je     1960 <strchr+0x30>
+    if(*s == c)
+    1953:	38 d1                	cmp    %dl,%cl
+    1955:	75 f1                	jne    1948 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1957:	5d                   	pop    %ebp
+    1958:	c3                   	ret
+    1959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1960:	31 c0                	xor    %eax,%eax
+}
+    1962:	5d                   	pop    %ebp
+    1963:	c3                   	ret
+    1964:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    196f:	90                   	nop
+
+00001970 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1970:	55                   	push   %ebp
+    1971:	89 e5                	mov    %esp,%ebp
+    1973:	57                   	push   %edi
+    1974:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1975:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1978:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1979:	31 db                	xor    %ebx,%ebx
+{
+    197b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    197e:	eb 27                	jmp    19a7 <gets+0x37>
+    cc = read(0, &c, 1);
+    1980:	83 ec 04             	sub    $0x4,%esp
+    1983:	6a 01                	push   $0x1
+    1985:	56                   	push   %esi
+    1986:	6a 00                	push   $0x0
+    1988:	e8 23 02 00 00       	call   1bb0 <read>
+    if(cc < 1)
+    198d:	83 c4 10             	add    $0x10,%esp
+    1990:	85 c0                	test   %eax,%eax
+    1992:	7e 1d                	jle    19b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1994:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1998:	8b 55 08             	mov    0x8(%ebp),%edx
+    199b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    199f:	3c 0a                	cmp    $0xa,%al
+    19a1:	74 10                	je     19b3 <gets+0x43>
+    19a3:	3c 0d                	cmp    $0xd,%al
+    19a5:	74 0c                	je     19b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    19a7:	89 df                	mov    %ebx,%edi
+    19a9:	83 c3 01             	add    $0x1,%ebx
+    19ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    19af:	7c cf                	jl     1980 <gets+0x10>
+    19b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    19b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    19b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    19ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19bd:	5b                   	pop    %ebx
+    19be:	5e                   	pop    %esi
+    19bf:	5f                   	pop    %edi
+    19c0:	5d                   	pop    %ebp
+    19c1:	c3                   	ret
+    19c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000019d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    19d0:	55                   	push   %ebp
+    19d1:	89 e5                	mov    %esp,%ebp
+    19d3:	56                   	push   %esi
+    19d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    19d5:	83 ec 08             	sub    $0x8,%esp
+    19d8:	6a 00                	push   $0x0
+    19da:	ff 75 08             	push   0x8(%ebp)
+    19dd:	e8 19 02 00 00       	call   1bfb <open>
+  if(fd < 0)
+    19e2:	83 c4 10             	add    $0x10,%esp
+    19e5:	85 c0                	test   %eax,%eax
+    19e7:	78 27                	js     1a10 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    19e9:	83 ec 08             	sub    $0x8,%esp
+    19ec:	ff 75 0c             	push   0xc(%ebp)
+    19ef:	89 c3                	mov    %eax,%ebx
+    19f1:	50                   	push   %eax
+    19f2:	e8 31 02 00 00       	call   1c28 <fstat>
+  close(fd);
+    19f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    19fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+    19fc:	e8 cd 01 00 00       	call   1bce <close>
+  return r;
+    1a01:	83 c4 10             	add    $0x10,%esp
+}
+    1a04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1a07:	89 f0                	mov    %esi,%eax
+    1a09:	5b                   	pop    %ebx
+    1a0a:	5e                   	pop    %esi
+    1a0b:	5d                   	pop    %ebp
+    1a0c:	c3                   	ret
+    1a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1a10:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1a15:	eb ed                	jmp    1a04 <stat+0x34>
+    1a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a1e:	66 90                	xchg   %ax,%ax
+
+00001a20 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1a20:	55                   	push   %ebp
+    1a21:	89 e5                	mov    %esp,%ebp
+    1a23:	53                   	push   %ebx
+    1a24:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1a27:	0f be 02             	movsbl (%edx),%eax
+    1a2a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    1a2d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1a30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1a35:	77 1e                	ja     1a55 <atoi+0x35>
+    1a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a3e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1a40:	83 c2 01             	add    $0x1,%edx
+    1a43:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1a46:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    1a4a:	0f be 02             	movsbl (%edx),%eax
+    1a4d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1a50:	80 fb 09             	cmp    $0x9,%bl
+    1a53:	76 eb                	jbe    1a40 <atoi+0x20>
+  return n;
+}
+    1a55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a58:	89 c8                	mov    %ecx,%eax
+    1a5a:	c9                   	leave
+    1a5b:	c3                   	ret
+    1a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001a60 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1a60:	55                   	push   %ebp
+    1a61:	89 e5                	mov    %esp,%ebp
+    1a63:	57                   	push   %edi
+    1a64:	56                   	push   %esi
+    1a65:	8b 45 10             	mov    0x10(%ebp),%eax
+    1a68:	8b 55 08             	mov    0x8(%ebp),%edx
+    1a6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    1a6e:	85 c0                	test   %eax,%eax
+    1a70:	7e 13                	jle    1a85 <memmove+0x25>
+    1a72:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1a74:	89 d7                	mov    %edx,%edi
+    1a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1a80:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1a81:	39 f8                	cmp    %edi,%eax
+    1a83:	75 fb                	jne    1a80 <memmove+0x20>
+  return vdst;
+}
+    1a85:	5e                   	pop    %esi
+    1a86:	89 d0                	mov    %edx,%eax
+    1a88:	5f                   	pop    %edi
+    1a89:	5d                   	pop    %ebp
+    1a8a:	c3                   	ret
+    1a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a8f:	90                   	nop
+
+00001a90 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1a90:	55                   	push   %ebp
+    1a91:	89 e5                	mov    %esp,%ebp
+    1a93:	56                   	push   %esi
+    1a94:	53                   	push   %ebx
+    1a95:	8b 75 10             	mov    0x10(%ebp),%esi
+    1a98:	8b 55 08             	mov    0x8(%ebp),%edx
+    1a9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    1a9e:	85 f6                	test   %esi,%esi
+    1aa0:	74 2e                	je     1ad0 <memcmp+0x40>
+    1aa2:	01 c6                	add    %eax,%esi
+    1aa4:	eb 14                	jmp    1aba <memcmp+0x2a>
+    1aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1ab0:	83 c0 01             	add    $0x1,%eax
+    1ab3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1ab6:	39 f0                	cmp    %esi,%eax
+    1ab8:	74 16                	je     1ad0 <memcmp+0x40>
+    if(*s1 != *s2)
+    1aba:	0f b6 0a             	movzbl (%edx),%ecx
+    1abd:	0f b6 18             	movzbl (%eax),%ebx
+    1ac0:	38 d9                	cmp    %bl,%cl
+    1ac2:	74 ec                	je     1ab0 <memcmp+0x20>
+      return *s1 - *s2;
+    1ac4:	0f b6 c1             	movzbl %cl,%eax
+    1ac7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1ac9:	5b                   	pop    %ebx
+    1aca:	5e                   	pop    %esi
+    1acb:	5d                   	pop    %ebp
+    1acc:	c3                   	ret
+    1acd:	8d 76 00             	lea    0x0(%esi),%esi
+    1ad0:	5b                   	pop    %ebx
+  return 0;
+    1ad1:	31 c0                	xor    %eax,%eax
+}
+    1ad3:	5e                   	pop    %esi
+    1ad4:	5d                   	pop    %ebp
+    1ad5:	c3                   	ret
+    1ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1add:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001ae0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1ae0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1ae5:	c3                   	ret
+    1ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001af0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1af0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1af5:	c3                   	ret
+    1af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001b00 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1b00:	a1 20 37 01 00       	mov    0x13720,%eax
+    1b05:	85 c0                	test   %eax,%eax
+    1b07:	74 17                	je     1b20 <fork+0x20>
+{
+    1b09:	55                   	push   %ebp
+    1b0a:	89 e5                	mov    %esp,%ebp
+    1b0c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    1b0f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1b11:	c9                   	leave
+  return _fork();
+    1b12:	e9 5d 00 00 00       	jmp    1b74 <_fork>
+    1b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b1e:	66 90                	xchg   %ax,%ax
+    1b20:	e9 4f 00 00 00       	jmp    1b74 <_fork>
+    1b25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b30 <exit>:
+
+int
+exit(void)
+{
+    1b30:	55                   	push   %ebp
+    1b31:	89 e5                	mov    %esp,%ebp
+    1b33:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1b36:	a1 20 37 01 00       	mov    0x13720,%eax
+    1b3b:	85 c0                	test   %eax,%eax
+    1b3d:	74 02                	je     1b41 <exit+0x11>
+    flushhook();
+    1b3f:	ff d0                	call   *%eax
+  _exit();
+    1b41:	e8 3d 00 00 00       	call   1b83 <_exit>
+    1b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001b50 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1b50:	55                   	push   %ebp
+  if(flushhook)
+    1b51:	a1 20 37 01 00       	mov    0x13720,%eax
+{
+    1b56:	89 e5                	mov    %esp,%ebp
+    1b58:	56                   	push   %esi
+    1b59:	53                   	push   %ebx
+    1b5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1b5d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1b60:	85 c0                	test   %eax,%eax
+    1b62:	74 02                	je     1b66 <exec+0x16>
+    flushhook();
+    1b64:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1b66:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1b69:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1b6c:	5b                   	pop    %ebx
+    1b6d:	5e                   	pop    %esi
+    1b6e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    1b6f:	e9 78 00 00 00       	jmp    1bec <_exec>
+
+00001b74 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1b74:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b79:	89 e1                	mov    %esp,%ecx
+    1b7b:	ba 82 1b 00 00       	mov    $0x1b82,%edx
+    1b80:	0f 34                	sysenter
+    1b82:	c3                   	ret
+
+00001b83 <_exit>:
+RAWSYSCALL(exit)
+    1b83:	b8 02 00 00 00       	mov    $0x2,%eax
+    1b88:	89 e1                	mov    %esp,%ecx
+    1b8a:	ba 91 1b 00 00       	mov    $0x1b91,%edx
+    1b8f:	0f 34                	sysenter
+    1b91:	c3                   	ret
+
+00001b92 <wait>:
+SYSCALL(wait)
+    1b92:	b8 03 00 00 00       	mov    $0x3,%eax
+    1b97:	89 e1                	mov    %esp,%ecx
+    1b99:	ba a0 1b 00 00       	mov    $0x1ba0,%edx
+    1b9e:	0f 34                	sysenter
+    1ba0:	c3                   	ret
+
+00001ba1 <pipe>:
+SYSCALL(pipe)
+    1ba1:	b8 04 00 00 00       	mov    $0x4,%eax
+    1ba6:	89 e1                	mov    %esp,%ecx
+    1ba8:	ba af 1b 00 00       	mov    $0x1baf,%edx
+    1bad:	0f 34                	sysenter
+    1baf:	c3                   	ret
+
+00001bb0 <read>:
+SYSCALL(read)
+    1bb0:	b8 05 00 00 00       	mov    $0x5,%eax
+    1bb5:	89 e1                	mov    %esp,%ecx
+    1bb7:	ba be 1b 00 00       	mov    $0x1bbe,%edx
+    1bbc:	0f 34                	sysenter
+    1bbe:	c3                   	ret
+
+00001bbf <write>:
+SYSCALL(write)
+    1bbf:	b8 10 00 00 00       	mov    $0x10,%eax
+    1bc4:	89 e1                	mov    %esp,%ecx
+    1bc6:	ba cd 1b 00 00       	mov    $0x1bcd,%edx
+    1bcb:	0f 34                	sysenter
+    1bcd:	c3                   	ret
+
+00001bce <close>:
+SYSCALL(close)
+    1bce:	b8 15 00 00 00       	mov    $0x15,%eax
+    1bd3:	89 e1                	mov    %esp,%ecx
+    1bd5:	ba dc 1b 00 00       	mov    $0x1bdc,%edx
+    1bda:	0f 34                	sysenter
+    1bdc:	c3                   	ret
+
+00001bdd <kill>:
+SYSCALL(kill)
+    1bdd:	b8 06 00 00 00       	mov    $0x6,%eax
+    1be2:	89 e1                	mov    %esp,%ecx
+    1be4:	ba eb 1b 00 00       	mov    $0x1beb,%edx
+    1be9:	0f 34                	sysenter
+    1beb:	c3                   	ret
+
+00001bec <_exec>:
+RAWSYSCALL(exec)
+    1bec:	b8 07 00 00 00       	mov    $0x7,%eax
+    1bf1:	89 e1                	mov    %esp,%ecx
+    1bf3:	ba fa 1b 00 00       	mov    $0x1bfa,%edx
+    1bf8:	0f 34                	sysenter
+    1bfa:	c3                   	ret
+
+00001bfb <open>:
+SYSCALL(open)
+    1bfb:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1c00:	89 e1                	mov    %esp,%ecx
+    1c02:	ba 09 1c 00 00       	mov    $0x1c09,%edx
+    1c07:	0f 34                	sysenter
+    1c09:	c3                   	ret
+
+00001c0a <mknod>:
+SYSCALL(mknod)
+    1c0a:	b8 11 00 00 00       	mov    $0x11,%eax
+    1c0f:	89 e1                	mov    %esp,%ecx
+    1c11:	ba 18 1c 00 00       	mov    $0x1c18,%edx
+    1c16:	0f 34                	sysenter
+    1c18:	c3                   	ret
+
+00001c19 <unlink>:
+SYSCALL(unlink)
+    1c19:	b8 12 00 00 00       	mov    $0x12,%eax
+    1c1e:	89 e1                	mov    %esp,%ecx
+    1c20:	ba 27 1c 00 00       	mov    $0x1c27,%edx
+    1c25:	0f 34                	sysenter
+    1c27:	c3                   	ret
+
+00001c28 <fstat>:
+SYSCALL(fstat)
+    1c28:	b8 08 00 00 00       	mov    $0x8,%eax
+    1c2d:	89 e1                	mov    %esp,%ecx
+    1c2f:	ba 36 1c 00 00       	mov    $0x1c36,%edx
+    1c34:	0f 34                	sysenter
+    1c36:	c3                   	ret
+
+00001c37 <link>:
+SYSCALL(link)
+    1c37:	b8 13 00 00 00       	mov    $0x13,%eax
+    1c3c:	89 e1                	mov    %esp,%ecx
+    1c3e:	ba 45 1c 00 00       	mov    $0x1c45,%edx
+    1c43:	0f 34                	sysenter
+    1c45:	c3                   	ret
+
+00001c46 <mkdir>:
+SYSCALL(mkdir)
+    1c46:	b8 14 00 00 00       	mov    $0x14,%eax
+    1c4b:	89 e1                	mov    %esp,%ecx
+    1c4d:	ba 54 1c 00 00       	mov    $0x1c54,%edx
+    1c52:	0f 34                	sysenter
+    1c54:	c3                   	ret
+
+00001c55 <chdir>:
+SYSCALL(chdir)
+    1c55:	b8 09 00 00 00       	mov    $0x9,%eax
+    1c5a:	89 e1                	mov    %esp,%ecx
+    1c5c:	ba 63 1c 00 00       	mov    $0x1c63,%edx
+    1c61:	0f 34                	sysenter
+    1c63:	c3                   	ret
+
+00001c64 <dup>:
+SYSCALL(dup)
+    1c64:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1c69:	89 e1                	mov    %esp,%ecx
+    1c6b:	ba 72 1c 00 00       	mov    $0x1c72,%edx
+    1c70:	0f 34                	sysenter
+    1c72:	c3                   	ret
+
+00001c73 <getpid>:
+SYSCALL(getpid)
+    1c73:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1c78:	89 e1                	mov    %esp,%ecx
+    1c7a:	ba 81 1c 00 00       	mov    $0x1c81,%edx
+    1c7f:	0f 34                	sysenter
+    1c81:	c3                   	ret
+
+00001c82 <sbrk>:
+SYSCALL(sbrk)
+    1c82:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1c87:	89 e1                	mov    %esp,%ecx
+    1c89:	ba 90 1c 00 00       	mov    $0x1c90,%edx
+    1c8e:	0f 34                	sysenter
+    1c90:	c3                   	ret
+
+00001c91 <sleep>:
+SYSCALL(sleep)
+    1c91:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1c96:	89 e1                	mov    %esp,%ecx
+    1c98:	ba 9f 1c 00 00       	mov    $0x1c9f,%edx
+    1c9d:	0f 34                	sysenter
+    1c9f:	c3                   	ret
+
+00001ca0 <uptime>:
+SYSCALL(uptime)
+    1ca0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1ca5:	89 e1                	mov    %esp,%ecx
+    1ca7:	ba ae 1c 00 00       	mov    $0x1cae,%edx
+    1cac:	0f 34                	sysenter
+    1cae:	c3                   	ret
+
+00001caf <mprotect>:
+SYSCALL(mprotect)
+    1caf:	b8 16 00 00 00       	mov    $0x16,%eax
+    1cb4:	89 e1                	mov    %esp,%ecx
+    1cb6:	ba bd 1c 00 00       	mov    $0x1cbd,%edx
+    1cbb:	0f 34                	sysenter
+    1cbd:	c3                   	ret
+
+00001cbe <munprotect>:
+SYSCALL(munprotect)
+    1cbe:	b8 17 00 00 00       	mov    $0x17,%eax
+    1cc3:	89 e1                	mov    %esp,%ecx
+    1cc5:	ba cc 1c 00 00       	mov    $0x1ccc,%edx
+    1cca:	0f 34                	sysenter
+    1ccc:	c3                   	ret
+
+00001ccd <kstat>:
+SYSCALL(kstat)
+    1ccd:	b8 18 00 00 00       	mov    $0x18,%eax
+    1cd2:	89 e1                	mov    %esp,%ecx
+    1cd4:	ba db 1c 00 00       	mov    $0x1cdb,%edx
+    1cd9:	0f 34                	sysenter
+    1cdb:	c3                   	ret
+
+00001cdc <fcntl>:
+SYSCALL(fcntl)
+    1cdc:	b8 19 00 00 00       	mov    $0x19,%eax
+    1ce1:	89 e1                	mov    %esp,%ecx
+    1ce3:	ba ea 1c 00 00       	mov    $0x1cea,%edx
+    1ce8:	0f 34                	sysenter
+    1cea:	c3                   	ret
+
+00001ceb <splice>:
+SYSCALL(splice)
+    1ceb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1cf0:	89 e1                	mov    %esp,%ecx
+    1cf2:	ba f9 1c 00 00       	mov    $0x1cf9,%edx
+    1cf7:	0f 34                	sysenter
+    1cf9:	c3                   	ret
+
+00001cfa <sendfile>:
+SYSCALL(sendfile)
+    1cfa:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1cff:	89 e1                	mov    %esp,%ecx
+    1d01:	ba 08 1d 00 00       	mov    $0x1d08,%edx
+    1d06:	0f 34                	sysenter
+    1d08:	c3                   	ret
+
+00001d09 <lseek>:
+SYSCALL(lseek)
+    1d09:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1d0e:	89 e1                	mov    %esp,%ecx
+    1d10:	ba 17 1d 00 00       	mov    $0x1d17,%edx
+    1d15:	0f 34                	sysenter
+    1d17:	c3                   	ret
+
+00001d18 <pread>:
+SYSCALL(pread)
+    1d18:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1d1d:	89 e1                	mov    %esp,%ecx
+    1d1f:	ba 26 1d 00 00       	mov    $0x1d26,%edx
+    1d24:	0f 34                	sysenter
+    1d26:	c3                   	ret
+
+00001d27 <pwrite>:
+SYSCALL(pwrite)
+    1d27:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1d2c:	89 e1                	mov    %esp,%ecx
+    1d2e:	ba 35 1d 00 00       	mov    $0x1d35,%edx
+    1d33:	0f 34                	sysenter
+    1d35:	c3                   	ret
+
+00001d36 <readv>:
+SYSCALL(readv)
+    1d36:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1d3b:	89 e1                	mov    %esp,%ecx
+    1d3d:	ba 44 1d 00 00       	mov    $0x1d44,%edx
+    1d42:	0f 34                	sysenter
+    1d44:	c3                   	ret
+
+00001d45 <writev>:
+SYSCALL(writev)
+    1d45:	b8 20 00 00 00       	mov    $0x20,%eax
+    1d4a:	89 e1                	mov    %esp,%ecx
+    1d4c:	ba 53 1d 00 00       	mov    $0x1d53,%edx
+    1d51:	0f 34                	sysenter
+    1d53:	c3                   	ret
+
+00001d54 <ringsetup>:
+SYSCALL(ringsetup)
+    1d54:	b8 21 00 00 00       	mov    $0x21,%eax
+    1d59:	89 e1                	mov    %esp,%ecx
+    1d5b:	ba 62 1d 00 00       	mov    $0x1d62,%edx
+    1d60:	0f 34                	sysenter
+    1d62:	c3                   	ret
+
+00001d63 <ringenter>:
+SYSCALL(ringenter)
+    1d63:	b8 22 00 00 00       	mov    $0x22,%eax
+    1d68:	89 e1                	mov    %esp,%ecx
+    1d6a:	ba 71 1d 00 00       	mov    $0x1d71,%edx
+    1d6f:	0f 34                	sysenter
+    1d71:	c3                   	ret
+
+00001d72 <intgetpid>:
+INTSYSCALL(getpid)
+    1d72:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1d77:	cd 40                	int    $0x40
+    1d79:	c3                   	ret
+    1d7a:	66 90                	xchg   %ax,%ax
+    1d7c:	66 90                	xchg   %ax,%ax
+    1d7e:	66 90                	xchg   %ax,%ax
+
+00001d80 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1d80:	55                   	push   %ebp
+    1d81:	89 e5                	mov    %esp,%ebp
+    1d83:	57                   	push   %edi
+    1d84:	56                   	push   %esi
+    1d85:	53                   	push   %ebx
+    1d86:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1d88:	89 d1                	mov    %edx,%ecx
+{
+    1d8a:	83 ec 2c             	sub    $0x2c,%esp
+    1d8d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1d90:	85 d2                	test   %edx,%edx
+    1d92:	0f 89 c0 00 00 00    	jns    1e58 <printint+0xd8>
+    1d98:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    1d9c:	0f 84 b6 00 00 00    	je     1e58 <printint+0xd8>
+    x = -xx;
+    1da2:	f7 d9                	neg    %ecx
+    neg = 1;
+    1da4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1da9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1dac:	31 f6                	xor    %esi,%esi
+    1dae:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1db0:	89 c8                	mov    %ecx,%eax
+    1db2:	31 d2                	xor    %edx,%edx
+    1db4:	89 f7                	mov    %esi,%edi
+    1db6:	f7 f3                	div    %ebx
+    1db8:	8d 76 01             	lea    0x1(%esi),%esi
+    1dbb:	0f b6 92 24 2d 00 00 	movzbl 0x2d24(%edx),%edx
+    1dc2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1dc6:	89 ca                	mov    %ecx,%edx
+    1dc8:	89 c1                	mov    %eax,%ecx
+    1dca:	39 da                	cmp    %ebx,%edx
+    1dcc:	73 e2                	jae    1db0 <printint+0x30>
+  if(neg)
+    1dce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1dd1:	85 c0                	test   %eax,%eax
+    1dd3:	74 07                	je     1ddc <printint+0x5c>
+    buf[i++] = '-';
+    1dd5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    1dda:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    1ddc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    1ddf:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1de2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1de4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1de7:	8b 41 08             	mov    0x8(%ecx),%eax
+    1dea:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1ded:	89 ce                	mov    %ecx,%esi
+    1def:	eb 1c                	jmp    1e0d <printint+0x8d>
+    1df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1df8:	89 c1                	mov    %eax,%ecx
+    1dfa:	83 c0 01             	add    $0x1,%eax
+    1dfd:	89 46 08             	mov    %eax,0x8(%esi)
+    1e00:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1e04:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1e07:	39 df                	cmp    %ebx,%edi
+    1e09:	74 41                	je     1e4c <printint+0xcc>
+    1e0b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    1e0d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1e10:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1e15:	75 e1                	jne    1df8 <printint+0x78>
+  if(o->f)
+    1e17:	8b 06                	mov    (%esi),%eax
+    1e19:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    1e1c:	85 c0                	test   %eax,%eax
+    1e1e:	74 40                	je     1e60 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1e20:	50                   	push   %eax
+    1e21:	68 80 00 00 00       	push   $0x80
+    1e26:	6a 01                	push   $0x1
+    1e28:	ff 75 d4             	push   -0x2c(%ebp)
+    1e2b:	e8 a0 04 00 00       	call   22d0 <fwrite>
+    1e30:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1e34:	83 c4 10             	add    $0x10,%esp
+}
+    1e37:	b8 01 00 00 00       	mov    $0x1,%eax
+    1e3c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    1e3e:	89 46 08             	mov    %eax,0x8(%esi)
+    1e41:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1e45:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1e48:	39 df                	cmp    %ebx,%edi
+    1e4a:	75 bf                	jne    1e0b <printint+0x8b>
+}
+    1e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e4f:	5b                   	pop    %ebx
+    1e50:	5e                   	pop    %esi
+    1e51:	5f                   	pop    %edi
+    1e52:	5d                   	pop    %ebp
+    1e53:	c3                   	ret
+    1e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1e58:	31 c0                	xor    %eax,%eax
+    1e5a:	e9 4a ff ff ff       	jmp    1da9 <printint+0x29>
+    1e5f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1e60:	83 ec 04             	sub    $0x4,%esp
+    1e63:	68 80 00 00 00       	push   $0x80
+    1e68:	ff 75 d4             	push   -0x2c(%ebp)
+    1e6b:	ff 76 04             	push   0x4(%esi)
+    1e6e:	e8 4c fd ff ff       	call   1bbf <write>
+    1e73:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1e77:	83 c4 10             	add    $0x10,%esp
+    1e7a:	eb bb                	jmp    1e37 <printint+0xb7>
+    1e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001e80 <putc>:
+{
+    1e80:	55                   	push   %ebp
+    1e81:	89 e5                	mov    %esp,%ebp
+    1e83:	56                   	push   %esi
+    1e84:	89 d6                	mov    %edx,%esi
+    1e86:	53                   	push   %ebx
+    1e87:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1e89:	8b 40 08             	mov    0x8(%eax),%eax
+    1e8c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1e91:	74 1d                	je     1eb0 <putc+0x30>
+  o->buf[o->n++] = c;
+    1e93:	89 f1                	mov    %esi,%ecx
+    1e95:	8d 50 01             	lea    0x1(%eax),%edx
+    1e98:	89 53 08             	mov    %edx,0x8(%ebx)
+    1e9b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    1e9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1ea2:	5b                   	pop    %ebx
+    1ea3:	5e                   	pop    %esi
+    1ea4:	5d                   	pop    %ebp
+    1ea5:	c3                   	ret
+    1ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ead:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1eb0:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1eb2:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1eb5:	85 c0                	test   %eax,%eax
+    1eb7:	74 2f                	je     1ee8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1eb9:	50                   	push   %eax
+    1eba:	68 80 00 00 00       	push   $0x80
+    1ebf:	6a 01                	push   $0x1
+    1ec1:	52                   	push   %edx
+    1ec2:	e8 09 04 00 00       	call   22d0 <fwrite>
+    1ec7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    1eca:	89 f1                	mov    %esi,%ecx
+}
+    1ecc:	ba 01 00 00 00       	mov    $0x1,%edx
+    1ed1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1ed3:	89 53 08             	mov    %edx,0x8(%ebx)
+    1ed6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    1eda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1edd:	5b                   	pop    %ebx
+    1ede:	5e                   	pop    %esi
+    1edf:	5d                   	pop    %ebp
+    1ee0:	c3                   	ret
+    1ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1ee8:	83 ec 04             	sub    $0x4,%esp
+    1eeb:	68 80 00 00 00       	push   $0x80
+    1ef0:	52                   	push   %edx
+    1ef1:	ff 73 04             	push   0x4(%ebx)
+    1ef4:	e8 c6 fc ff ff       	call   1bbf <write>
+    1ef9:	83 c4 10             	add    $0x10,%esp
+    1efc:	eb cc                	jmp    1eca <putc+0x4a>
+    1efe:	66 90                	xchg   %ax,%ax
+
+00001f00 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1f00:	55                   	push   %ebp
+    1f01:	89 e5                	mov    %esp,%ebp
+    1f03:	57                   	push   %edi
+    1f04:	89 c7                	mov    %eax,%edi
+    1f06:	56                   	push   %esi
+    1f07:	31 f6                	xor    %esi,%esi
+    1f09:	53                   	push   %ebx
+    1f0a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1f0d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1f10:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1f13:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1f16:	84 c0                	test   %al,%al
+    1f18:	75 1e                	jne    1f38 <vprintf.constprop.0+0x38>
+    1f1a:	eb 53                	jmp    1f6f <vprintf.constprop.0+0x6f>
+    1f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1f20:	83 f8 25             	cmp    $0x25,%eax
+    1f23:	74 3b                	je     1f60 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1f25:	89 ca                	mov    %ecx,%edx
+    1f27:	89 f8                	mov    %edi,%eax
+    1f29:	e8 52 ff ff ff       	call   1e80 <putc>
+  for(i = 0; fmt[i]; i++){
+    1f2e:	0f b6 03             	movzbl (%ebx),%eax
+    1f31:	83 c3 01             	add    $0x1,%ebx
+    1f34:	84 c0                	test   %al,%al
+    1f36:	74 37                	je     1f6f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1f38:	0f be c8             	movsbl %al,%ecx
+    1f3b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    1f3e:	85 f6                	test   %esi,%esi
+    1f40:	74 de                	je     1f20 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1f42:	83 fe 25             	cmp    $0x25,%esi
+    1f45:	75 e7                	jne    1f2e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1f47:	83 f8 25             	cmp    $0x25,%eax
+    1f4a:	74 4e                	je     1f9a <vprintf.constprop.0+0x9a>
+    1f4c:	83 e8 63             	sub    $0x63,%eax
+    1f4f:	83 f8 15             	cmp    $0x15,%eax
+    1f52:	77 34                	ja     1f88 <vprintf.constprop.0+0x88>
+    1f54:	ff 24 85 cc 2c 00 00 	jmp    *0x2ccc(,%eax,4)
+    1f5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f5f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1f60:	0f b6 03             	movzbl (%ebx),%eax
+    1f63:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1f66:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    1f6b:	84 c0                	test   %al,%al
+    1f6d:	75 c9                	jne    1f38 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    1f6f:	8b 47 08             	mov    0x8(%edi),%eax
+    1f72:	85 c0                	test   %eax,%eax
+    1f74:	0f 8f de 00 00 00    	jg     2058 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    1f7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f7d:	5b                   	pop    %ebx
+    1f7e:	5e                   	pop    %esi
+    1f7f:	5f                   	pop    %edi
+    1f80:	5d                   	pop    %ebp
+    1f81:	c3                   	ret
+    1f82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1f88:	ba 25 00 00 00       	mov    $0x25,%edx
+    1f8d:	89 f8                	mov    %edi,%eax
+    1f8f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1f92:	e8 e9 fe ff ff       	call   1e80 <putc>
+        putc(o, c);
+    1f97:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1f9a:	89 ca                	mov    %ecx,%edx
+    1f9c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    1f9e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1fa0:	e8 db fe ff ff       	call   1e80 <putc>
+    1fa5:	eb 87                	jmp    1f2e <vprintf.constprop.0+0x2e>
+    1fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fae:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1fb0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1fb3:	83 ec 0c             	sub    $0xc,%esp
+    1fb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1fbb:	8b 16                	mov    (%esi),%edx
+    1fbd:	6a 00                	push   $0x0
+        ap++;
+    1fbf:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1fc2:	89 f8                	mov    %edi,%eax
+    1fc4:	e8 b7 fd ff ff       	call   1d80 <printint>
+        ap++;
+    1fc9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    1fcc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1fcf:	31 f6                	xor    %esi,%esi
+    1fd1:	e9 58 ff ff ff       	jmp    1f2e <vprintf.constprop.0+0x2e>
+    1fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fdd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1fe0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1fe3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1fe5:	83 c0 04             	add    $0x4,%eax
+    1fe8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    1feb:	85 f6                	test   %esi,%esi
+    1fed:	75 1b                	jne    200a <vprintf.constprop.0+0x10a>
+    1fef:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1ff4:	be c4 2c 00 00       	mov    $0x2cc4,%esi
+    1ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    2000:	89 f8                	mov    %edi,%eax
+          s++;
+    2002:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    2005:	e8 76 fe ff ff       	call   1e80 <putc>
+        while(*s != 0){
+    200a:	0f be 16             	movsbl (%esi),%edx
+    200d:	84 d2                	test   %dl,%dl
+    200f:	75 ef                	jne    2000 <vprintf.constprop.0+0x100>
+      state = 0;
+    2011:	31 f6                	xor    %esi,%esi
+    2013:	e9 16 ff ff ff       	jmp    1f2e <vprintf.constprop.0+0x2e>
+    2018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    201f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    2020:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    2023:	83 ec 0c             	sub    $0xc,%esp
+    2026:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    202b:	8b 16                	mov    (%esi),%edx
+    202d:	6a 01                	push   $0x1
+    202f:	eb 8e                	jmp    1fbf <vprintf.constprop.0+0xbf>
+    2031:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    2038:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    203b:	89 f8                	mov    %edi,%eax
+    203d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    2040:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    2043:	e8 38 fe ff ff       	call   1e80 <putc>
+        ap++;
+    2048:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    204b:	31 f6                	xor    %esi,%esi
+    204d:	e9 dc fe ff ff       	jmp    1f2e <vprintf.constprop.0+0x2e>
+    2052:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    2058:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    205a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    205d:	85 d2                	test   %edx,%edx
+    205f:	74 1f                	je     2080 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    2061:	52                   	push   %edx
+    2062:	50                   	push   %eax
+    2063:	6a 01                	push   $0x1
+    2065:	51                   	push   %ecx
+    2066:	e8 65 02 00 00       	call   22d0 <fwrite>
+    206b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    206e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    2075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2078:	5b                   	pop    %ebx
+    2079:	5e                   	pop    %esi
+    207a:	5f                   	pop    %edi
+    207b:	5d                   	pop    %ebp
+    207c:	c3                   	ret
+    207d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    2080:	83 ec 04             	sub    $0x4,%esp
+    2083:	50                   	push   %eax
+    2084:	51                   	push   %ecx
+    2085:	ff 77 04             	push   0x4(%edi)
+    2088:	e8 32 fb ff ff       	call   1bbf <write>
+    208d:	83 c4 10             	add    $0x10,%esp
+    2090:	eb dc                	jmp    206e <vprintf.constprop.0+0x16e>
+    2092:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2099:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000020a0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    20a0:	55                   	push   %ebp
+    20a1:	89 e5                	mov    %esp,%ebp
+    20a3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    20a9:	a1 c4 34 00 00       	mov    0x34c4,%eax
+{
+    20ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    20b1:	83 fa 01             	cmp    $0x1,%edx
+    20b4:	74 0c                	je     20c2 <printf+0x22>
+    20b6:	31 c0                	xor    %eax,%eax
+    20b8:	83 fa 02             	cmp    $0x2,%edx
+    20bb:	0f 44 05 c0 34 00 00 	cmove  0x34c0,%eax
+  o.fd = fd;
+    20c2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    20c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    20cb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    20ce:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    20d4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    20da:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    20e1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    20e4:	e8 17 fe ff ff       	call   1f00 <vprintf.constprop.0>
+}
+    20e9:	c9                   	leave
+    20ea:	c3                   	ret
+    20eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20ef:	90                   	nop
+
+000020f0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    20f0:	55                   	push   %ebp
+    20f1:	89 e5                	mov    %esp,%ebp
+    20f3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    20f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    20fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    20ff:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    2102:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    2109:	ff ff ff 
+  o.n = 0;
+    210c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    2113:	00 00 00 
+  o.f = f;
+    2116:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    211c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    2122:	e8 d9 fd ff ff       	call   1f00 <vprintf.constprop.0>
+}
+    2127:	c9                   	leave
+    2128:	c3                   	ret
+    2129:	66 90                	xchg   %ax,%ax
+    212b:	66 90                	xchg   %ax,%ax
+    212d:	66 90                	xchg   %ax,%ax
+    212f:	90                   	nop
+
+00002130 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    2130:	55                   	push   %ebp
+    2131:	89 e5                	mov    %esp,%ebp
+    2133:	53                   	push   %ebx
+    2134:	89 c3                	mov    %eax,%ebx
+    2136:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    2139:	8b 40 0c             	mov    0xc(%eax),%eax
+    213c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    213f:	74 17                	je     2158 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    2141:	83 f8 02             	cmp    $0x2,%eax
+    2144:	74 07                	je     214d <setmode+0x1d>
+    2146:	8b 43 18             	mov    0x18(%ebx),%eax
+    2149:	85 c0                	test   %eax,%eax
+    214b:	74 38                	je     2185 <setmode+0x55>
+    f->mode = IONBF;
+}
+    214d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2150:	c9                   	leave
+    2151:	c3                   	ret
+    2152:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    2158:	83 ec 08             	sub    $0x8,%esp
+    215b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    215e:	50                   	push   %eax
+    215f:	ff 33                	push   (%ebx)
+    2161:	e8 c2 fa ff ff       	call   1c28 <fstat>
+    2166:	83 c4 10             	add    $0x10,%esp
+    2169:	89 c2                	mov    %eax,%edx
+    216b:	31 c0                	xor    %eax,%eax
+    216d:	85 d2                	test   %edx,%edx
+    216f:	75 0a                	jne    217b <setmode+0x4b>
+    2171:	31 c0                	xor    %eax,%eax
+    2173:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    2178:	0f 94 c0             	sete   %al
+    217b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    217e:	8b 43 18             	mov    0x18(%ebx),%eax
+    2181:	85 c0                	test   %eax,%eax
+    2183:	75 c8                	jne    214d <setmode+0x1d>
+    2185:	83 ec 0c             	sub    $0xc,%esp
+    2188:	68 00 04 00 00       	push   $0x400
+    218d:	e8 de 07 00 00       	call   2970 <malloc>
+    2192:	83 c4 10             	add    $0x10,%esp
+    2195:	89 43 18             	mov    %eax,0x18(%ebx)
+    2198:	85 c0                	test   %eax,%eax
+    219a:	75 b1                	jne    214d <setmode+0x1d>
+    f->mode = IONBF;
+    219c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    21a3:	eb a8                	jmp    214d <setmode+0x1d>
+    21a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000021b0 <drain>:
+{
+    21b0:	55                   	push   %ebp
+    21b1:	89 e5                	mov    %esp,%ebp
+    21b3:	57                   	push   %edi
+    21b4:	56                   	push   %esi
+    21b5:	53                   	push   %ebx
+    21b6:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    21b9:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    21bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    21bf:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    21c6:	85 ff                	test   %edi,%edi
+    21c8:	7f 0e                	jg     21d8 <drain+0x28>
+  return 0;
+    21ca:	31 c0                	xor    %eax,%eax
+}
+    21cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21cf:	5b                   	pop    %ebx
+    21d0:	5e                   	pop    %esi
+    21d1:	5f                   	pop    %edi
+    21d2:	5d                   	pop    %ebp
+    21d3:	c3                   	ret
+    21d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    21d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    21db:	8b 58 18             	mov    0x18(%eax),%ebx
+    21de:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    21e0:	eb 0e                	jmp    21f0 <drain+0x40>
+    21e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    21e8:	29 c7                	sub    %eax,%edi
+    21ea:	01 c3                	add    %eax,%ebx
+    21ec:	85 ff                	test   %edi,%edi
+    21ee:	7e da                	jle    21ca <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    21f0:	83 ec 04             	sub    $0x4,%esp
+    21f3:	57                   	push   %edi
+    21f4:	53                   	push   %ebx
+    21f5:	56                   	push   %esi
+    21f6:	e8 c4 f9 ff ff       	call   1bbf <write>
+    21fb:	83 c4 10             	add    $0x10,%esp
+    21fe:	85 c0                	test   %eax,%eax
+    2200:	7f e6                	jg     21e8 <drain+0x38>
+    f->err = 1;
+    2202:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2205:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    220c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2211:	eb b9                	jmp    21cc <drain+0x1c>
+    2213:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    221a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002220 <flushall>:
+
+static void
+flushall(void)
+{
+    2220:	55                   	push   %ebp
+    2221:	89 e5                	mov    %esp,%ebp
+    2223:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    2224:	bb e0 34 00 00       	mov    $0x34e0,%ebx
+{
+    2229:	83 ec 04             	sub    $0x4,%esp
+    222c:	eb 0d                	jmp    223b <flushall+0x1b>
+    222e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    2230:	83 c3 24             	add    $0x24,%ebx
+    2233:	81 fb 20 37 00 00    	cmp    $0x3720,%ebx
+    2239:	74 19                	je     2254 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    223b:	8b 43 08             	mov    0x8(%ebx),%eax
+    223e:	85 c0                	test   %eax,%eax
+    2240:	74 ee                	je     2230 <flushall+0x10>
+    2242:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    2244:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    2247:	e8 64 ff ff ff       	call   21b0 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    224c:	81 fb 20 37 00 00    	cmp    $0x3720,%ebx
+    2252:	75 e7                	jne    223b <flushall+0x1b>
+}
+    2254:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2257:	c9                   	leave
+    2258:	c3                   	ret
+    2259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002260 <fflush>:
+{
+    2260:	55                   	push   %ebp
+    2261:	89 e5                	mov    %esp,%ebp
+    2263:	57                   	push   %edi
+    2264:	56                   	push   %esi
+    2265:	53                   	push   %ebx
+    2266:	83 ec 0c             	sub    $0xc,%esp
+    2269:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    226c:	85 c0                	test   %eax,%eax
+    226e:	74 28                	je     2298 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    2270:	8b 70 08             	mov    0x8(%eax),%esi
+    2273:	85 f6                	test   %esi,%esi
+    2275:	75 11                	jne    2288 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    2277:	83 c4 0c             	add    $0xc,%esp
+    227a:	89 f0                	mov    %esi,%eax
+    227c:	5b                   	pop    %ebx
+    227d:	5e                   	pop    %esi
+    227e:	5f                   	pop    %edi
+    227f:	5d                   	pop    %ebp
+    2280:	c3                   	ret
+    2281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2288:	83 c4 0c             	add    $0xc,%esp
+    228b:	5b                   	pop    %ebx
+    228c:	5e                   	pop    %esi
+    228d:	5f                   	pop    %edi
+    228e:	5d                   	pop    %ebp
+  return drain(f);
+    228f:	e9 1c ff ff ff       	jmp    21b0 <drain>
+    2294:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    2298:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    229a:	bb e0 34 00 00       	mov    $0x34e0,%ebx
+        r = -1;
+    229f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    22a4:	eb 15                	jmp    22bb <fflush+0x5b>
+    22a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22ad:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    22b0:	83 c3 24             	add    $0x24,%ebx
+    22b3:	81 fb 20 37 00 00    	cmp    $0x3720,%ebx
+    22b9:	74 bc                	je     2277 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    22bb:	8b 43 08             	mov    0x8(%ebx),%eax
+    22be:	85 c0                	test   %eax,%eax
+    22c0:	74 ee                	je     22b0 <fflush+0x50>
+    22c2:	89 d8                	mov    %ebx,%eax
+    22c4:	e8 e7 fe ff ff       	call   21b0 <drain>
+        r = -1;
+    22c9:	85 c0                	test   %eax,%eax
+    22cb:	0f 48 f7             	cmovs  %edi,%esi
+    22ce:	eb e0                	jmp    22b0 <fflush+0x50>
+
+000022d0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    22d0:	55                   	push   %ebp
+    22d1:	89 e5                	mov    %esp,%ebp
+    22d3:	57                   	push   %edi
+    22d4:	56                   	push   %esi
+    22d5:	53                   	push   %ebx
+    22d6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    22d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    22dc:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    22e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    22e3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    22e6:	85 d2                	test   %edx,%edx
+    22e8:	0f 8e 26 01 00 00    	jle    2414 <fwrite+0x144>
+  if(!f->writable){
+    22ee:	8b 46 08             	mov    0x8(%esi),%eax
+    22f1:	85 c0                	test   %eax,%eax
+    22f3:	0f 84 14 01 00 00    	je     240d <fwrite+0x13d>
+  setmode(f);
+    22f9:	89 f0                	mov    %esi,%eax
+    22fb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    22fe:	e8 2d fe ff ff       	call   2130 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    2303:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    2307:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    230a:	c7 05 20 37 01 00 20 	movl   $0x2220,0x13720
+    2311:	22 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    2314:	0f 84 b6 00 00 00    	je     23d0 <fwrite+0x100>
+    231a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    2320:	0f 8f aa 00 00 00    	jg     23d0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    2326:	8b 46 20             	mov    0x20(%esi),%eax
+    2329:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    232c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    232e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    2333:	74 6c                	je     23a1 <fwrite+0xd1>
+    2335:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    2338:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    233b:	ba 00 04 00 00       	mov    $0x400,%edx
+    2340:	29 c2                	sub    %eax,%edx
+    2342:	39 ca                	cmp    %ecx,%edx
+    2344:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    2347:	85 d2                	test   %edx,%edx
+    2349:	0f 8e d1 00 00 00    	jle    2420 <fwrite+0x150>
+    234f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    2352:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    2355:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    2358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    235f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    2360:	8d 50 01             	lea    0x1(%eax),%edx
+    2363:	83 c3 01             	add    $0x1,%ebx
+    2366:	8b 4e 18             	mov    0x18(%esi),%ecx
+    2369:	89 56 20             	mov    %edx,0x20(%esi)
+    236c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    2370:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    2373:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    2376:	b8 01 00 00 00       	mov    $0x1,%eax
+    237b:	80 fa 0a             	cmp    $0xa,%dl
+    237e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    2381:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    2384:	39 cb                	cmp    %ecx,%ebx
+    2386:	75 d8                	jne    2360 <fwrite+0x90>
+    2388:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    238b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    238e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    2391:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    2394:	85 db                	test   %ebx,%ebx
+    2396:	7e 19                	jle    23b1 <fwrite+0xe1>
+    n -= k;
+    2398:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    239a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    239f:	75 97                	jne    2338 <fwrite+0x68>
+    23a1:	89 f0                	mov    %esi,%eax
+    23a3:	e8 08 fe ff ff       	call   21b0 <drain>
+    23a8:	85 c0                	test   %eax,%eax
+    23aa:	78 68                	js     2414 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    23ac:	8b 46 20             	mov    0x20(%esi),%eax
+    23af:	eb 87                	jmp    2338 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    23b1:	3d 00 04 00 00       	cmp    $0x400,%eax
+    23b6:	74 74                	je     242c <fwrite+0x15c>
+    23b8:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    23bc:	75 04                	jne    23c2 <fwrite+0xf2>
+    23be:	85 ff                	test   %edi,%edi
+    23c0:	75 6a                	jne    242c <fwrite+0x15c>
+    return nmemb;
+    23c2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    23c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23c8:	5b                   	pop    %ebx
+    23c9:	5e                   	pop    %esi
+    23ca:	5f                   	pop    %edi
+    23cb:	5d                   	pop    %ebp
+    23cc:	c3                   	ret
+    23cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    23d0:	89 f0                	mov    %esi,%eax
+    23d2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    23d5:	e8 d6 fd ff ff       	call   21b0 <drain>
+    23da:	85 c0                	test   %eax,%eax
+    23dc:	78 2f                	js     240d <fwrite+0x13d>
+    23de:	89 75 14             	mov    %esi,0x14(%ebp)
+    23e1:	8b 3e                	mov    (%esi),%edi
+    23e3:	89 de                	mov    %ebx,%esi
+    23e5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    23e8:	eb 0e                	jmp    23f8 <fwrite+0x128>
+    23ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    23f0:	29 c3                	sub    %eax,%ebx
+    23f2:	01 c6                	add    %eax,%esi
+    23f4:	85 db                	test   %ebx,%ebx
+    23f6:	7e ca                	jle    23c2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    23f8:	83 ec 04             	sub    $0x4,%esp
+    23fb:	53                   	push   %ebx
+    23fc:	56                   	push   %esi
+    23fd:	57                   	push   %edi
+    23fe:	e8 bc f7 ff ff       	call   1bbf <write>
+    2403:	83 c4 10             	add    $0x10,%esp
+    2406:	85 c0                	test   %eax,%eax
+    2408:	7f e6                	jg     23f0 <fwrite+0x120>
+    240a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    240d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    2414:	31 c0                	xor    %eax,%eax
+}
+    2416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2419:	5b                   	pop    %ebx
+    241a:	5e                   	pop    %esi
+    241b:	5f                   	pop    %edi
+    241c:	5d                   	pop    %ebp
+    241d:	c3                   	ret
+    241e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    2420:	89 d9                	mov    %ebx,%ecx
+    2422:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    2425:	89 cb                	mov    %ecx,%ebx
+    2427:	e9 6e ff ff ff       	jmp    239a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    242c:	89 f0                	mov    %esi,%eax
+    242e:	e8 7d fd ff ff       	call   21b0 <drain>
+    2433:	85 c0                	test   %eax,%eax
+    2435:	79 8b                	jns    23c2 <fwrite+0xf2>
+    return 0;
+    2437:	31 c0                	xor    %eax,%eax
+    2439:	eb db                	jmp    2416 <fwrite+0x146>
+    243b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    243f:	90                   	nop
+
+00002440 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    2440:	55                   	push   %ebp
+    2441:	89 e5                	mov    %esp,%ebp
+    2443:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    2446:	8b 45 08             	mov    0x8(%ebp),%eax
+    2449:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    244c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    244f:	ff 75 0c             	push   0xc(%ebp)
+    2452:	6a 01                	push   $0x1
+    2454:	6a 01                	push   $0x1
+    2456:	50                   	push   %eax
+    2457:	e8 74 fe ff ff       	call   22d0 <fwrite>
+    245c:	83 c4 10             	add    $0x10,%esp
+    245f:	83 f8 01             	cmp    $0x1,%eax
+    2462:	75 0c                	jne    2470 <fputc+0x30>
+    2464:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2468:	c9                   	leave
+    2469:	c3                   	ret
+    246a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    2470:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    2471:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    2476:	c3                   	ret
+    2477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    247e:	66 90                	xchg   %ax,%ax
+
+00002480 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    2480:	55                   	push   %ebp
+    2481:	89 e5                	mov    %esp,%ebp
+    2483:	57                   	push   %edi
+    2484:	56                   	push   %esi
+    2485:	53                   	push   %ebx
+    2486:	83 ec 1c             	sub    $0x1c,%esp
+    2489:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    248c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    248f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    2492:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    2495:	85 d2                	test   %edx,%edx
+    2497:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    249a:	7e 12                	jle    24ae <fread+0x2e>
+    249c:	85 ff                	test   %edi,%edi
+    249e:	7e 0e                	jle    24ae <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    24a0:	8b 43 04             	mov    0x4(%ebx),%eax
+    24a3:	85 c0                	test   %eax,%eax
+    24a5:	75 19                	jne    24c0 <fread+0x40>
+    f->err = 1;
+    24a7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    24ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    24b1:	31 c0                	xor    %eax,%eax
+}
+    24b3:	5b                   	pop    %ebx
+    24b4:	5e                   	pop    %esi
+    24b5:	5f                   	pop    %edi
+    24b6:	5d                   	pop    %ebp
+    24b7:	c3                   	ret
+    24b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24bf:	90                   	nop
+  setmode(f);
+    24c0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    24c2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    24c4:	e8 67 fc ff ff       	call   2130 <setmode>
+  for(n = 0; n < want; n += k){
+    24c9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    24cc:	89 f7                	mov    %esi,%edi
+    24ce:	eb 31                	jmp    2501 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    24d0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    24d4:	74 08                	je     24de <fread+0x5e>
+    24d6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    24dc:	7e 62                	jle    2540 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    24de:	83 ec 04             	sub    $0x4,%esp
+    24e1:	56                   	push   %esi
+    24e2:	8b 45 08             	mov    0x8(%ebp),%eax
+    24e5:	01 f8                	add    %edi,%eax
+    24e7:	50                   	push   %eax
+    24e8:	ff 33                	push   (%ebx)
+    24ea:	e8 c1 f6 ff ff       	call   1bb0 <read>
+    24ef:	83 c4 10             	add    $0x10,%esp
+    24f2:	85 c0                	test   %eax,%eax
+    24f4:	0f 8e ce 00 00 00    	jle    25c8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    24fa:	01 c7                	add    %eax,%edi
+    24fc:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    24ff:	7e 36                	jle    2537 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2501:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    2504:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    2507:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    250a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    250c:	39 c1                	cmp    %eax,%ecx
+    250e:	7d c0                	jge    24d0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2510:	29 c8                	sub    %ecx,%eax
+    2512:	39 f0                	cmp    %esi,%eax
+    2514:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    2517:	83 ec 04             	sub    $0x4,%esp
+    251a:	56                   	push   %esi
+    251b:	03 4b 18             	add    0x18(%ebx),%ecx
+    251e:	51                   	push   %ecx
+    251f:	8b 45 08             	mov    0x8(%ebp),%eax
+    2522:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    2524:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    2526:	50                   	push   %eax
+    2527:	e8 34 f5 ff ff       	call   1a60 <memmove>
+      f->r += k;
+    252c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    252f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    2532:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    2535:	7f ca                	jg     2501 <fread+0x81>
+    2537:	89 fe                	mov    %edi,%esi
+    2539:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    253c:	eb 3f                	jmp    257d <fread+0xfd>
+    253e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    2540:	3b 1d c8 34 00 00    	cmp    0x34c8,%ebx
+    2546:	74 68                	je     25b0 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    2548:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    254b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    2552:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    2559:	68 00 04 00 00       	push   $0x400
+    255e:	ff 73 18             	push   0x18(%ebx)
+    2561:	ff 33                	push   (%ebx)
+    2563:	e8 48 f6 ff ff       	call   1bb0 <read>
+    2568:	83 c4 10             	add    $0x10,%esp
+    256b:	85 c0                	test   %eax,%eax
+    256d:	78 21                	js     2590 <fread+0x110>
+  else if(n == 0)
+    256f:	75 2f                	jne    25a0 <fread+0x120>
+    f->eof = 1;
+    2571:	89 fe                	mov    %edi,%esi
+    2573:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2576:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    257d:	89 f0                	mov    %esi,%eax
+}
+    257f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    2582:	99                   	cltd
+}
+    2583:	5b                   	pop    %ebx
+    2584:	5e                   	pop    %esi
+  return n / size;
+    2585:	f7 ff                	idiv   %edi
+}
+    2587:	5f                   	pop    %edi
+    2588:	5d                   	pop    %ebp
+    2589:	c3                   	ret
+    258a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    2590:	89 fe                	mov    %edi,%esi
+    2592:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2595:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    259c:	eb df                	jmp    257d <fread+0xfd>
+    259e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    25a0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    25a3:	e9 54 ff ff ff       	jmp    24fc <fread+0x7c>
+    25a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25af:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    25b0:	83 ec 0c             	sub    $0xc,%esp
+    25b3:	ff 35 c4 34 00 00    	push   0x34c4
+    25b9:	e8 a2 fc ff ff       	call   2260 <fflush>
+    25be:	83 c4 10             	add    $0x10,%esp
+    25c1:	eb 85                	jmp    2548 <fread+0xc8>
+    25c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    25c7:	90                   	nop
+        if(k < 0)
+    25c8:	89 fe                	mov    %edi,%esi
+    25ca:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    25cd:	74 a7                	je     2576 <fread+0xf6>
+    25cf:	eb c4                	jmp    2595 <fread+0x115>
+    25d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25df:	90                   	nop
+
+000025e0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    25e0:	55                   	push   %ebp
+    25e1:	89 e5                	mov    %esp,%ebp
+    25e3:	53                   	push   %ebx
+    25e4:	83 ec 14             	sub    $0x14,%esp
+    25e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    25ea:	8b 50 04             	mov    0x4(%eax),%edx
+    25ed:	85 d2                	test   %edx,%edx
+    25ef:	74 08                	je     25f9 <fgetc+0x19>
+    25f1:	8b 50 1c             	mov    0x1c(%eax),%edx
+    25f4:	3b 50 20             	cmp    0x20(%eax),%edx
+    25f7:	7c 27                	jl     2620 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    25f9:	50                   	push   %eax
+    25fa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    25fd:	6a 01                	push   $0x1
+    25ff:	6a 01                	push   $0x1
+    2601:	50                   	push   %eax
+    2602:	e8 79 fe ff ff       	call   2480 <fread>
+    2607:	83 c4 10             	add    $0x10,%esp
+    260a:	83 f8 01             	cmp    $0x1,%eax
+    260d:	75 29                	jne    2638 <fgetc+0x58>
+    260f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2613:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2616:	c9                   	leave
+    2617:	c3                   	ret
+    2618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    261f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    2620:	8b 48 18             	mov    0x18(%eax),%ecx
+    2623:	8d 5a 01             	lea    0x1(%edx),%ebx
+    2626:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    2629:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    262c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    2630:	c9                   	leave
+    2631:	c3                   	ret
+    2632:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2638:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    263d:	eb d4                	jmp    2613 <fgetc+0x33>
+    263f:	90                   	nop
+
+00002640 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    2640:	55                   	push   %ebp
+    2641:	89 e5                	mov    %esp,%ebp
+    2643:	57                   	push   %edi
+    2644:	56                   	push   %esi
+    2645:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    2646:	31 db                	xor    %ebx,%ebx
+{
+    2648:	83 ec 1c             	sub    $0x1c,%esp
+    264b:	8b 75 10             	mov    0x10(%ebp),%esi
+    264e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    2650:	eb 2e                	jmp    2680 <fgets+0x40>
+    2652:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2658:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    265b:	57                   	push   %edi
+    265c:	6a 01                	push   $0x1
+    265e:	6a 01                	push   $0x1
+    2660:	50                   	push   %eax
+    2661:	e8 1a fe ff ff       	call   2480 <fread>
+    2666:	83 c4 10             	add    $0x10,%esp
+    2669:	83 f8 01             	cmp    $0x1,%eax
+    266c:	75 62                	jne    26d0 <fgets+0x90>
+    266e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    2672:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2675:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    2677:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    267b:	83 f9 0a             	cmp    $0xa,%ecx
+    267e:	74 34                	je     26b4 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    2680:	89 de                	mov    %ebx,%esi
+    2682:	83 c3 01             	add    $0x1,%ebx
+    2685:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    2688:	7d 46                	jge    26d0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    268a:	8b 47 04             	mov    0x4(%edi),%eax
+    268d:	85 c0                	test   %eax,%eax
+    268f:	74 c7                	je     2658 <fgets+0x18>
+    2691:	8b 47 1c             	mov    0x1c(%edi),%eax
+    2694:	3b 47 20             	cmp    0x20(%edi),%eax
+    2697:	7d bf                	jge    2658 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    2699:	8b 4f 18             	mov    0x18(%edi),%ecx
+    269c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    269f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    26a2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    26a5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    26a9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    26ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    26af:	83 f9 0a             	cmp    $0xa,%ecx
+    26b2:	75 cc                	jne    2680 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    26b4:	8b 45 08             	mov    0x8(%ebp),%eax
+    26b7:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    26bb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    26be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    26c1:	5b                   	pop    %ebx
+    26c2:	5e                   	pop    %esi
+    26c3:	5f                   	pop    %edi
+    26c4:	5d                   	pop    %ebp
+    26c5:	c3                   	ret
+    26c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26cd:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    26d0:	8b 45 08             	mov    0x8(%ebp),%eax
+    26d3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    26d7:	31 c0                	xor    %eax,%eax
+    26d9:	85 f6                	test   %esi,%esi
+    26db:	74 e1                	je     26be <fgets+0x7e>
+    26dd:	8b 45 08             	mov    0x8(%ebp),%eax
+    26e0:	eb dc                	jmp    26be <fgets+0x7e>
+    26e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000026f0 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    26f0:	55                   	push   %ebp
+    26f1:	89 e5                	mov    %esp,%ebp
+    26f3:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    26f4:	bb e0 34 00 00       	mov    $0x34e0,%ebx
+{
+    26f9:	83 ec 04             	sub    $0x4,%esp
+    26fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    2700:	8b 53 04             	mov    0x4(%ebx),%edx
+    2703:	85 d2                	test   %edx,%edx
+    2705:	75 07                	jne    270e <fdopen+0x1e>
+    2707:	8b 43 08             	mov    0x8(%ebx),%eax
+    270a:	85 c0                	test   %eax,%eax
+    270c:	74 1a                	je     2728 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    270e:	83 c3 24             	add    $0x24,%ebx
+    2711:	81 fb 20 37 00 00    	cmp    $0x3720,%ebx
+    2717:	75 e7                	jne    2700 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2719:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    271b:	89 d8                	mov    %ebx,%eax
+    271d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2720:	c9                   	leave
+    2721:	c3                   	ret
+    2722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2728:	81 fb 20 37 00 00    	cmp    $0x3720,%ebx
+    272e:	74 e9                	je     2719 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2730:	83 ec 04             	sub    $0x4,%esp
+    2733:	6a 24                	push   $0x24
+    2735:	6a 00                	push   $0x0
+    2737:	53                   	push   %ebx
+    2738:	e8 d3 f1 ff ff       	call   1910 <memset>
+  f->fd = fd;
+    273d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2740:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2747:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    274a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    274c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    274f:	80 38 72             	cmpb   $0x72,(%eax)
+    2752:	74 14                	je     2768 <fdopen+0x78>
+    f->writable = 1;
+    2754:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    275b:	89 d8                	mov    %ebx,%eax
+    275d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2760:	c9                   	leave
+    2761:	c3                   	ret
+    2762:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2768:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    276f:	89 d8                	mov    %ebx,%eax
+    2771:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2774:	c9                   	leave
+    2775:	c3                   	ret
+    2776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    277d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002780 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2780:	55                   	push   %ebp
+    2781:	89 e5                	mov    %esp,%ebp
+    2783:	56                   	push   %esi
+    2784:	53                   	push   %ebx
+    2785:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2788:	0f b6 06             	movzbl (%esi),%eax
+    278b:	3c 72                	cmp    $0x72,%al
+    278d:	74 61                	je     27f0 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    278f:	3c 77                	cmp    $0x77,%al
+    2791:	74 7d                	je     2810 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2793:	3c 61                	cmp    $0x61,%al
+    2795:	75 49                	jne    27e0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2797:	83 ec 08             	sub    $0x8,%esp
+    279a:	68 01 02 00 00       	push   $0x201
+    279f:	ff 75 08             	push   0x8(%ebp)
+    27a2:	e8 54 f4 ff ff       	call   1bfb <open>
+    27a7:	83 c4 10             	add    $0x10,%esp
+    27aa:	89 c3                	mov    %eax,%ebx
+    27ac:	85 c0                	test   %eax,%eax
+    27ae:	78 30                	js     27e0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    27b0:	83 ec 04             	sub    $0x4,%esp
+    27b3:	6a 02                	push   $0x2
+    27b5:	6a 00                	push   $0x0
+    27b7:	50                   	push   %eax
+    27b8:	e8 4c f5 ff ff       	call   1d09 <lseek>
+    27bd:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    27c0:	83 ec 08             	sub    $0x8,%esp
+    27c3:	56                   	push   %esi
+    27c4:	53                   	push   %ebx
+    27c5:	e8 26 ff ff ff       	call   26f0 <fdopen>
+    27ca:	83 c4 10             	add    $0x10,%esp
+    27cd:	85 c0                	test   %eax,%eax
+    27cf:	75 11                	jne    27e2 <fopen+0x62>
+    close(fd);
+    27d1:	83 ec 0c             	sub    $0xc,%esp
+    27d4:	53                   	push   %ebx
+    27d5:	e8 f4 f3 ff ff       	call   1bce <close>
+    27da:	83 c4 10             	add    $0x10,%esp
+    27dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    27e0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    27e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    27e5:	5b                   	pop    %ebx
+    27e6:	5e                   	pop    %esi
+    27e7:	5d                   	pop    %ebp
+    27e8:	c3                   	ret
+    27e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    27f0:	83 ec 08             	sub    $0x8,%esp
+    27f3:	6a 00                	push   $0x0
+    27f5:	ff 75 08             	push   0x8(%ebp)
+    27f8:	e8 fe f3 ff ff       	call   1bfb <open>
+    27fd:	83 c4 10             	add    $0x10,%esp
+    2800:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2802:	85 db                	test   %ebx,%ebx
+    2804:	78 da                	js     27e0 <fopen+0x60>
+    2806:	eb b8                	jmp    27c0 <fopen+0x40>
+    2808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    280f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2810:	83 ec 08             	sub    $0x8,%esp
+    2813:	68 01 06 00 00       	push   $0x601
+    2818:	ff 75 08             	push   0x8(%ebp)
+    281b:	e8 db f3 ff ff       	call   1bfb <open>
+    2820:	83 c4 10             	add    $0x10,%esp
+    2823:	89 c3                	mov    %eax,%ebx
+    2825:	eb db                	jmp    2802 <fopen+0x82>
+    2827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    282e:	66 90                	xchg   %ax,%ax
+
+00002830 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2830:	55                   	push   %ebp
+    2831:	89 e5                	mov    %esp,%ebp
+    2833:	56                   	push   %esi
+    2834:	53                   	push   %ebx
+    2835:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2838:	83 ec 0c             	sub    $0xc,%esp
+    283b:	53                   	push   %ebx
+    283c:	e8 1f fa ff ff       	call   2260 <fflush>
+    2841:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2843:	58                   	pop    %eax
+    2844:	ff 33                	push   (%ebx)
+    2846:	e8 83 f3 ff ff       	call   1bce <close>
+    284b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    284e:	85 c0                	test   %eax,%eax
+    2850:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2855:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2858:	8b 43 18             	mov    0x18(%ebx),%eax
+    285b:	85 c0                	test   %eax,%eax
+    285d:	0f 95 c1             	setne  %cl
+    2860:	3d 40 3b 01 00       	cmp    $0x13b40,%eax
+    2865:	0f 95 c2             	setne  %dl
+    2868:	84 d1                	test   %dl,%cl
+    286a:	74 07                	je     2873 <fclose+0x43>
+    286c:	3d 40 37 01 00       	cmp    $0x13740,%eax
+    2871:	75 25                	jne    2898 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2873:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    287a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    287c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2883:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    288a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    288d:	5b                   	pop    %ebx
+    288e:	5e                   	pop    %esi
+    288f:	5d                   	pop    %ebp
+    2890:	c3                   	ret
+    2891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2898:	83 ec 0c             	sub    $0xc,%esp
+    289b:	50                   	push   %eax
+    289c:	e8 3f 00 00 00       	call   28e0 <free>
+    28a1:	83 c4 10             	add    $0x10,%esp
+    28a4:	eb cd                	jmp    2873 <fclose+0x43>
+    28a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000028b0 <feof>:
+
+int
+feof(FILE *f)
+{
+    28b0:	55                   	push   %ebp
+    28b1:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    28b3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    28b6:	5d                   	pop    %ebp
+  return f->eof;
+    28b7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    28ba:	c3                   	ret
+    28bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    28bf:	90                   	nop
+
+000028c0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    28c0:	55                   	push   %ebp
+    28c1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    28c3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    28c6:	5d                   	pop    %ebp
+  return f->err;
+    28c7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    28ca:	c3                   	ret
+    28cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    28cf:	90                   	nop
+
+000028d0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    28d0:	55                   	push   %ebp
+    28d1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    28d3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    28d6:	5d                   	pop    %ebp
+  return f->fd;
+    28d7:	8b 00                	mov    (%eax),%eax
+}
+    28d9:	c3                   	ret
+    28da:	66 90                	xchg   %ax,%ax
+    28dc:	66 90                	xchg   %ax,%ax
+    28de:	66 90                	xchg   %ax,%ax
+
+000028e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    28e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    28e1:	a1 40 3f 01 00       	mov    0x13f40,%eax
+{
+    28e6:	89 e5                	mov    %esp,%ebp
+    28e8:	57                   	push   %edi
+    28e9:	56                   	push   %esi
+    28ea:	53                   	push   %ebx
+    28eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    28ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    28f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    28fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    28fc:	39 ca                	cmp    %ecx,%edx
+    28fe:	73 30                	jae    2930 <free+0x50>
+    2900:	39 c1                	cmp    %eax,%ecx
+    2902:	72 04                	jb     2908 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2904:	39 c2                	cmp    %eax,%edx
+    2906:	72 f0                	jb     28f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2908:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    290b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    290e:	39 f8                	cmp    %edi,%eax
+    2910:	74 2e                	je     2940 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2912:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2915:	8b 42 04             	mov    0x4(%edx),%eax
+    2918:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    291b:	39 f1                	cmp    %esi,%ecx
+    291d:	74 38                	je     2957 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    291f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2921:	5b                   	pop    %ebx
+  freep = p;
+    2922:	89 15 40 3f 01 00    	mov    %edx,0x13f40
+}
+    2928:	5e                   	pop    %esi
+    2929:	5f                   	pop    %edi
+    292a:	5d                   	pop    %ebp
+    292b:	c3                   	ret
+    292c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2930:	39 c1                	cmp    %eax,%ecx
+    2932:	72 d0                	jb     2904 <free+0x24>
+    2934:	eb c2                	jmp    28f8 <free+0x18>
+    2936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    293d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2940:	03 70 04             	add    0x4(%eax),%esi
+    2943:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2946:	8b 02                	mov    (%edx),%eax
+    2948:	8b 00                	mov    (%eax),%eax
+    294a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    294d:	8b 42 04             	mov    0x4(%edx),%eax
+    2950:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2953:	39 f1                	cmp    %esi,%ecx
+    2955:	75 c8                	jne    291f <free+0x3f>
+    p->s.size += bp->s.size;
+    2957:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    295a:	89 15 40 3f 01 00    	mov    %edx,0x13f40
+    p->s.size += bp->s.size;
+    2960:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2963:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2966:	89 0a                	mov    %ecx,(%edx)
+}
+    2968:	5b                   	pop    %ebx
+    2969:	5e                   	pop    %esi
+    296a:	5f                   	pop    %edi
+    296b:	5d                   	pop    %ebp
+    296c:	c3                   	ret
+    296d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002970 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2970:	55                   	push   %ebp
+    2971:	89 e5                	mov    %esp,%ebp
+    2973:	57                   	push   %edi
+    2974:	56                   	push   %esi
+    2975:	53                   	push   %ebx
+    2976:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2979:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    297c:	8b 15 40 3f 01 00    	mov    0x13f40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2982:	8d 78 07             	lea    0x7(%eax),%edi
+    2985:	c1 ef 03             	shr    $0x3,%edi
+    2988:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    298b:	85 d2                	test   %edx,%edx
+    298d:	0f 84 8d 00 00 00    	je     2a20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2993:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2995:	8b 48 04             	mov    0x4(%eax),%ecx
+    2998:	39 f9                	cmp    %edi,%ecx
+    299a:	73 64                	jae    2a00 <malloc+0x90>
+  if(nu < 4096)
+    299c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    29a1:	39 df                	cmp    %ebx,%edi
+    29a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    29a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    29ad:	eb 0a                	jmp    29b9 <malloc+0x49>
+    29af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    29b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    29b2:	8b 48 04             	mov    0x4(%eax),%ecx
+    29b5:	39 f9                	cmp    %edi,%ecx
+    29b7:	73 47                	jae    2a00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    29b9:	89 c2                	mov    %eax,%edx
+    29bb:	39 05 40 3f 01 00    	cmp    %eax,0x13f40
+    29c1:	75 ed                	jne    29b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    29c3:	83 ec 0c             	sub    $0xc,%esp
+    29c6:	56                   	push   %esi
+    29c7:	e8 b6 f2 ff ff       	call   1c82 <sbrk>
+  if(p == (char*)-1)
+    29cc:	83 c4 10             	add    $0x10,%esp
+    29cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    29d2:	74 1c                	je     29f0 <malloc+0x80>
+  hp->s.size = nu;
+    29d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    29d7:	83 ec 0c             	sub    $0xc,%esp
+    29da:	83 c0 08             	add    $0x8,%eax
+    29dd:	50                   	push   %eax
+    29de:	e8 fd fe ff ff       	call   28e0 <free>
+  return freep;
+    29e3:	8b 15 40 3f 01 00    	mov    0x13f40,%edx
+      if((p = morecore(nunits)) == 0)
+    29e9:	83 c4 10             	add    $0x10,%esp
+    29ec:	85 d2                	test   %edx,%edx
+    29ee:	75 c0                	jne    29b0 <malloc+0x40>
+        return 0;
+  }
+}
+    29f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    29f3:	31 c0                	xor    %eax,%eax
+}
+    29f5:	5b                   	pop    %ebx
+    29f6:	5e                   	pop    %esi
+    29f7:	5f                   	pop    %edi
+    29f8:	5d                   	pop    %ebp
+    29f9:	c3                   	ret
+    29fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2a00:	39 cf                	cmp    %ecx,%edi
+    2a02:	74 4c                	je     2a50 <malloc+0xe0>
+        p->s.size -= nunits;
+    2a04:	29 f9                	sub    %edi,%ecx
+    2a06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2a09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    2a0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    2a0f:	89 15 40 3f 01 00    	mov    %edx,0x13f40
+}
+    2a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2a18:	83 c0 08             	add    $0x8,%eax
+}
+    2a1b:	5b                   	pop    %ebx
+    2a1c:	5e                   	pop    %esi
+    2a1d:	5f                   	pop    %edi
+    2a1e:	5d                   	pop    %ebp
+    2a1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2a20:	c7 05 40 3f 01 00 44 	movl   $0x13f44,0x13f40
+    2a27:	3f 01 00 
+    base.s.size = 0;
+    2a2a:	b8 44 3f 01 00       	mov    $0x13f44,%eax
+    base.s.ptr = freep = prevp = &base;
+    2a2f:	c7 05 44 3f 01 00 44 	movl   $0x13f44,0x13f44
+    2a36:	3f 01 00 
+    base.s.size = 0;
+    2a39:	c7 05 48 3f 01 00 00 	movl   $0x0,0x13f48
+    2a40:	00 00 00 
+    if(p->s.size >= nunits){
+    2a43:	e9 54 ff ff ff       	jmp    299c <malloc+0x2c>
+    2a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2a50:	8b 08                	mov    (%eax),%ecx
+    2a52:	89 0a                	mov    %ecx,(%edx)
+    2a54:	eb b9                	jmp    2a0f <malloc+0x9f>
@@ -0,0 +1,215 @@
+// Pipe throughput benchmark.
+//   pipebench [mb [chunk [pipesz]]]
+// A child writes mb MB (default 16) into a pipe in chunk-byte
+// writes (default 4096), and the parent reads it back in the
+// same size, printing the rate and how many context switches
+// it took.  If pipesz is given, the pipe's buffer is resized
+// to it first with fcntl(F_SETPIPE_SZ).
+//   pipebench splice [mb]
+// Moves mb MB (default 4) from a file into a pipe, and from one
+// pipe to another through a relay process, first with a
+// read/write loop and then with splice(), printing the rate of
+// each and how much splice() moved without copying.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "kstat.h"
+
+char buf[65536];
+
+void
+throughput(int argc, char *argv[])
+{
+  int fds[2], mb, chunk, n, t, start, sz;
+  uint total, want, sw;
+  struct kstat before, after;
+
+  mb = argc > 1 ? atoi(argv[1]) : 16;
+  chunk = argc > 2 ? atoi(argv[2]) : 4096;
+  if(mb <= 0 || chunk <= 0 || chunk > sizeof(buf)){
+    printf(2, "usage: pipebench [mb [chunk [pipesz]]]\n");
+    exit();
+  }
+  if(pipe(fds) < 0){
+    printf(2, "pipebench: pipe failed\n");
+    exit();
+  }
+  if(argc > 3 && fcntl(fds[1], F_SETPIPE_SZ, atoi(argv[3])) < 0){
+    printf(2, "pipebench: cannot resize pipe to %s\n", argv[3]);
+    exit();
+  }
+  sz = fcntl(fds[0], F_GETPIPE_SZ, 0);
+  want = mb * 1024 * 1024;
+
+  kstat(&before);
+  start = uptime();
+  if(fork() == 0){
+    close(fds[0]);
+    for(total = 0; total < want; total += n){
+      n = want - total < chunk ? want - total : chunk;
+      if(write(fds[1], buf, n) != n){
+        printf(2, "pipebench: write failed\n");
+        exit();
+      }
+    }
+    exit();
+  }
+  close(fds[1]);
+  for(total = 0; (n = read(fds[0], buf, chunk)) > 0; total += n)
+    ;
+  wait();
+  t = uptime() - start;
+  kstat(&after);
+  close(fds[0]);
+
+  if(total != want){
+    printf(2, "pipebench: read %d bytes, want %d\n", total, want);
+    exit();
+  }
+  sw = after.sched_switches - before.sched_switches;
+  printf(1, "pipebench: %d MB in %d-byte chunks through a %d-byte pipe in %d ticks",
+    mb, chunk, sz, t);
+  if(t > 0)
+    printf(1, ", %d KB/s", mb*1024*100/t);
+  printf(1, "\n");
+  printf(1, "pipebench: %d context switches, %d per MB\n", sw, sw / mb);
+}
+
+// Copy from in to out until in runs dry, with
+// splice() or with a read/write loop.
+void
+relay(int in, int out, int splicing)
+{
+  int n;
+
+  for(;;){
+    if(splicing)
+      n = splice(in, out, sizeof(buf));
+    else if((n = read(in, buf, 4096)) > 0 && write(out, buf, n) != n)
+      n = -1;
+    if(n == 0)
+      break;
+    if(n < 0){
+      printf(2, "pipebench: %s failed\n", splicing ? "splice" : "read/write");
+      exit();
+    }
+  }
+}
+
+// Read fd to the end, returning how many bytes it held.
+uint
+drain(int fd)
+{
+  int n;
+  uint total;
+
+  for(total = 0; (n = read(fd, buf, sizeof(buf))) > 0; total += n)
+    ;
+  return total;
+}
+
+// Time moving mb MB from a file into a pipe (topipe == 0)
+// or from one pipe to another, as relay() does it.
+void
+splicerun(char *what, int mb, int topipe, int splicing)
+{
+  int a[2], b[2], fd, n, t, start;
+  uint total, want;
+  struct kstat before, after;
+
+  want = mb * 1024 * 1024;
+  kstat(&before);
+  start = uptime();
+  if(pipe(b) < 0 || (topipe && pipe(a) < 0)){
+    printf(2, "pipebench: pipe failed\n");
+    exit();
+  }
+  if(topipe && fork() == 0){
+    // Writer, feeding the relay.
+    close(a[0]);
+    close(b[0]);
+    close(b[1]);
+    for(total = 0; total < want; total += n){
+      n = want - total < sizeof(buf) ? want - total : sizeof(buf);
+      if(write(a[1], buf, n) != n){
+        printf(2, "pipebench: write failed\n");
+        exit();
+      }
+    }
+    exit();
+  }
+  if(fork() == 0){
+    close(b[0]);
+    if(topipe){
+      close(a[1]);
+      relay(a[0], b[1], splicing);
+    } else {
+      if((fd = open("pipebench.tmp", O_RDONLY)) < 0){
+        printf(2, "pipebench: open pipebench.tmp failed\n");
+        exit();
+      }
+      relay(fd, b[1], splicing);
+    }
+    exit();
+  }
+  if(topipe){
+    close(a[0]);
+    close(a[1]);
+  }
+  close(b[1]);
+  total = drain(b[0]);
+  close(b[0]);
+  wait();
+  if(topipe)
+    wait();
+  t = uptime() - start;
+  kstat(&after);
+
+  if(total != want){
+    printf(2, "pipebench: %s moved %d bytes, want %d\n", what, total, want);
+    exit();
+  }
+  printf(1, "%s: %d MB in %d ticks", what, mb, t);
+  if(t > 0)
+    printf(1, ", %d KB/s", mb*1024*100/t);
+  if(splicing)
+    printf(1, ", %d KB spliced, %d pages moved",
+      (after.pipe_spliced - before.pipe_spliced) / 1024,
+      after.pipe_pagemoves - before.pipe_pagemoves);
+  printf(1, "\n");
+}
+
+void
+splicebench(int mb)
+{
+  int fd, i;
+
+  if((fd = open("pipebench.tmp", O_CREATE|O_RDWR)) < 0){
+    printf(2, "pipebench: create pipebench.tmp failed\n");
+    exit();
+  }
+  for(i = 0; i < mb*1024*1024; i += sizeof(buf))
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "pipebench: write pipebench.tmp failed\n");
+      exit();
+    }
+  close(fd);
+
+  splicerun("file->pipe read/write", mb, 0, 0);
+  splicerun("file->pipe splice", mb, 0, 1);
+  splicerun("pipe->pipe read/write", mb, 1, 0);
+  splicerun("pipe->pipe splice", mb, 1, 1);
+  unlink("pipebench.tmp");
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc > 1 && strcmp(argv[1], "splice") == 0)
+    splicebench(argc > 2 ? atoi(argv[2]) : 4);
+  else
+    throughput(argc, argv);
+  exit();
+}
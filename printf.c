@@ -2,14 +2,36 @@
 #include "stat.h"
 #include "user.h"
 
+// Output is gathered here and handed on a piece at a time,
+// so that a printf() costs one write() rather than one per
+// character, even to an unbuffered stream.
+struct out {
+  FILE *f;      // stream to write to, or if 0,
+  int fd;       // the file descriptor
+  int n;
+  char buf[128];
+};
+
+static void
+emit(struct out *o)
+{
+  if(o->f)
+    fwrite(o->buf, 1, o->n, o->f);
+  else
+    write(o->fd, o->buf, o->n);
+  o->n = 0;
+}
+
 static void
-putc(int fd, char c)
+putc(struct out *o, char c)
 {
-  write(fd, &c, 1);
+  if(o->n == sizeof(o->buf))
+    emit(o);
+  o->buf[o->n++] = c;
 }
 
 static void
-printint(int fd, int xx, int base, int sgn)
+printint(struct out *o, int xx, int base, int sgn)
 {
   static char digits[] = "0123456789ABCDEF";
   char buf[16];
@@ -32,33 +54,31 @@ printint(int fd, int xx, int base, int sgn)
     buf[i++] = '-';
 
   while(--i >= 0)
-    putc(fd, buf[i]);
+    putc(o, buf[i]);
 }
 
-// Print to the given fd. Only understands %d, %x, %p, %s.
-void
-printf(int fd, const char *fmt, ...)
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
 {
   char *s;
   int c, i, state;
-  uint *ap;
 
   state = 0;
-  ap = (uint*)(void*)&fmt + 1;
   for(i = 0; fmt[i]; i++){
     c = fmt[i] & 0xff;
     if(state == 0){
       if(c == '%'){
         state = '%';
       } else {
-        putc(fd, c);
+        putc(o, c);
       }
     } else if(state == '%'){
       if(c == 'd'){
-        printint(fd, *ap, 10, 1);
+        printint(o, *ap, 10, 1);
         ap++;
       } else if(c == 'x' || c == 'p'){
-        printint(fd, *ap, 16, 0);
+        printint(o, *ap, 16, 0);
         ap++;
       } else if(c == 's'){
         s = (char*)*ap;
@@ -66,20 +86,45 @@ printf(int fd, const char *fmt, ...)
         if(s == 0)
           s = "(null)";
         while(*s != 0){
-          putc(fd, *s);
+          putc(o, *s);
           s++;
         }
       } else if(c == 'c'){
-        putc(fd, *ap);
+        putc(o, *ap);
         ap++;
       } else if(c == '%'){
-        putc(fd, c);
+        putc(o, c);
       } else {
         // Unknown % sequence.  Print it to draw attention.
-        putc(fd, '%');
-        putc(fd, c);
+        putc(o, '%');
+        putc(o, c);
       }
       state = 0;
     }
   }
+  if(o->n > 0)
+    emit(o);
+}
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+  o.fd = fd;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+}
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+  struct out o;
+
+  o.f = f;
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
 }
@@ -6,10 +6,13 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "kstat.h"
+#include "upage.h"
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  uint nswitch;    // context switches, for kstat
 } ptable;
 
 static struct proc *initproc;
@@ -88,14 +91,24 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->ring = 0;
 
   release(&ptable.lock);
 
-  // Allocate kernel stack.
+  // Allocate kernel stack, and the page of process state
+  // that the process can read.
   if((p->kstack = kalloc()) == 0){
     p->state = UNUSED;
     return 0;
   }
+  if((p->uproc = kalloc()) == 0){
+    kfree(p->kstack);
+    p->kstack = 0;
+    p->state = UNUSED;
+    return 0;
+  }
+  memset(p->uproc, 0, PGSIZE);
+  ((struct uproc*)p->uproc)->pid = p->pid;
   sp = p->kstack + KSTACKSIZE;
 
   // Leave room for trap frame.
@@ -126,7 +139,7 @@ userinit(void)
   p = allocproc();
 
   initproc = p;
-  if((p->pgdir = setupkvm()) == 0)
+  if((p->pgdir = setupkvm()) == 0 || mapupages(p->pgdir, p->uproc) < 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->vbase = PGSIZE;
@@ -154,6 +167,24 @@ userinit(void)
   release(&ptable.lock);
 }
 
+// Start a kernel process that runs fn, which must not return.
+// It has no user memory; forkret returns into fn instead of
+// into trapret.
+void
+kproc(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kproc");
+  *(uint*)((char*)p->context + sizeof(*p->context)) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -191,9 +222,14 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->vbase, curproc->vlimit)) == 0){
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->vbase, curproc->vlimit)) == 0 ||
+     mapupages(np->pgdir, np->uproc) < 0){
+    if(np->pgdir)
+      freevm(np->pgdir);
     kfree(np->kstack);
     np->kstack = 0;
+    kfree(np->uproc);
+    np->uproc = 0;
     np->state = UNUSED;
     return -1;
   }
@@ -209,6 +245,7 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  np->ring = curproc->ring;
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -291,6 +328,8 @@ wait(void)
         pid = p->pid;
         kfree(p->kstack);
         p->kstack = 0;
+        kfree(p->uproc);
+        p->uproc = 0;
         freevm(p->pgdir);
         p->pid = 0;
         p->parent = 0;
@@ -344,6 +383,7 @@ scheduler(void)
       c->proc = p;
       switchuvm(p);
       p->state = RUNNING;
+      ptable.nswitch++;
 
       swtch(&(c->scheduler), p->context);
       switchkvm();
@@ -498,6 +538,15 @@ kill(int pid)
   return -1;
 }
 
+// Report scheduler statistics.
+void
+procstat(struct kstat *st)
+{
+  acquire(&ptable.lock);
+  st->sched_switches = ptable.nswitch;
+  release(&ptable.lock);
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -8,6 +8,7 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  uint nsyscall;               // System calls made on this cpu
 };
 
 extern struct cpu cpus[NCPU];
@@ -49,6 +50,8 @@ struct proc {
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct ring *ring;           // Submission ring in user memory, or 0
+  char *uproc;                 // Page mapped at UPROC (upage.h)
   char name[16];               // Process name (debugging)
 };
 
@@ -0,0 +1,40 @@
+// Submission ring, for batching system calls.
+// Both the kernel and user programs use this header file.
+//
+// A program puts a struct ring in its own memory and registers
+// it with ringsetup().  It then queues requests in sq, advancing
+// sqtail, and calls ringenter(n) to have the kernel carry out up
+// to n of them in order, advancing sqhead.  Each result goes in
+// cq at cqtail, and the program consumes them, advancing cqhead.
+// The indexes only grow; entry i is at i % RINGSIZE.
+
+#define RINGSIZE 64
+
+// Requests
+#define RING_READ  1  // read(fd, buf, n)
+#define RING_WRITE 2  // write(fd, buf, n)
+#define RING_OPEN  3  // open(buf, n), buf a path and n the mode
+#define RING_CLOSE 4  // close(fd)
+#define RING_FSTAT 5  // fstat(fd, buf)
+
+struct sqe {
+  int op;
+  int fd;
+  void *buf;
+  int n;
+  uint user;        // copied to the completion
+};
+
+struct cqe {
+  uint user;
+  int res;          // what the system call would return
+};
+
+struct ring {
+  uint sqhead;      // advanced by the kernel
+  uint sqtail;      // advanced by the program
+  uint cqhead;      // advanced by the program
+  uint cqtail;      // advanced by the kernel
+  struct sqe sq[RINGSIZE];
+  struct cqe cq[RINGSIZE];
+};
@@ -0,0 +1,3299 @@
+
+_ringbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	83 ec 18             	sub    $0x18,%esp
+  int n, i, j, fd, start;
+
+  n = argc > 1 ? atoi(argv[1]) : 100000;
+    1014:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+    1017:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 100000;
+    101a:	0f 8e 96 00 00 00    	jle    10b6 <main+0xb6>
+    1020:	83 ec 0c             	sub    $0xc,%esp
+    1023:	ff 70 04             	push   0x4(%eax)
+    1026:	e8 55 07 00 00       	call   1780 <atoi>
+  if(n < RINGSIZE){
+    102b:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : 100000;
+    102e:	89 c3                	mov    %eax,%ebx
+  if(n < RINGSIZE){
+    1030:	83 f8 3f             	cmp    $0x3f,%eax
+    1033:	0f 8e 87 00 00 00    	jle    10c0 <main+0xc0>
+    printf(2, "usage: ringbench [n], n at least %d\n", RINGSIZE);
+    exit();
+  }
+  n -= n % RINGSIZE;
+  if(ringsetup(&ring) < 0)
+    1039:	83 ec 0c             	sub    $0xc,%esp
+    103c:	68 c0 3c 00 00       	push   $0x3cc0
+    1041:	e8 6e 0a 00 00       	call   1ab4 <ringsetup>
+    1046:	83 c4 10             	add    $0x10,%esp
+    1049:	85 c0                	test   %eax,%eax
+    104b:	78 5c                	js     10a9 <main+0xa9>
+    fail("ringsetup");
+
+  // A file to read from, CHUNK bytes per op.
+  if((fd = open("ringbench.tmp", O_CREATE|O_RDWR)) < 0)
+    104d:	52                   	push   %edx
+    104e:	52                   	push   %edx
+    104f:	68 02 02 00 00       	push   $0x202
+    1054:	68 18 28 00 00       	push   $0x2818
+    1059:	e8 fd 08 00 00       	call   195b <open>
+    105e:	83 c4 10             	add    $0x10,%esp
+    1061:	89 c6                	mov    %eax,%esi
+    1063:	85 c0                	test   %eax,%eax
+    1065:	0f 88 9e 00 00 00    	js     1109 <main+0x109>
+    106b:	83 e3 c0             	and    $0xffffffc0,%ebx
+    fail("create ringbench.tmp");
+  for(i = 0; i < n; i += RINGSIZE)
+    106e:	31 ff                	xor    %edi,%edi
+    1070:	eb 0d                	jmp    107f <main+0x7f>
+    1072:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1078:	83 c7 40             	add    $0x40,%edi
+    107b:	39 fb                	cmp    %edi,%ebx
+    107d:	7e 55                	jle    10d4 <main+0xd4>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+    107f:	83 ec 04             	sub    $0x4,%esp
+    1082:	68 00 04 00 00       	push   $0x400
+    1087:	68 c0 38 00 00       	push   $0x38c0
+    108c:	56                   	push   %esi
+    108d:	e8 8d 08 00 00       	call   191f <write>
+    1092:	83 c4 10             	add    $0x10,%esp
+    1095:	3d 00 04 00 00       	cmp    $0x400,%eax
+    109a:	74 dc                	je     1078 <main+0x78>
+      fail("write ringbench.tmp");
+    109c:	83 ec 0c             	sub    $0xc,%esp
+    109f:	68 26 28 00 00       	push   $0x2826
+    10a4:	e8 d7 03 00 00       	call   1480 <fail>
+    fail("ringsetup");
+    10a9:	83 ec 0c             	sub    $0xc,%esp
+    10ac:	68 07 28 00 00       	push   $0x2807
+    10b1:	e8 ca 03 00 00       	call   1480 <fail>
+  n = argc > 1 ? atoi(argv[1]) : 100000;
+    10b6:	bb a0 86 01 00       	mov    $0x186a0,%ebx
+    10bb:	e9 79 ff ff ff       	jmp    1039 <main+0x39>
+    printf(2, "usage: ringbench [n], n at least %d\n", RINGSIZE);
+    10c0:	51                   	push   %ecx
+    10c1:	6a 40                	push   $0x40
+    10c3:	68 a0 28 00 00       	push   $0x28a0
+    10c8:	6a 02                	push   $0x2
+    10ca:	e8 31 0d 00 00       	call   1e00 <printf>
+    exit();
+    10cf:	e8 bc 07 00 00       	call   1890 <exit>
+
+  start = uptime();
+    10d4:	e8 27 09 00 00       	call   1a00 <uptime>
+  for(i = 0; i < n; i++)
+    10d9:	31 ff                	xor    %edi,%edi
+    10db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    10de:	eb 07                	jmp    10e7 <main+0xe7>
+    10e0:	83 c7 01             	add    $0x1,%edi
+    10e3:	39 fb                	cmp    %edi,%ebx
+    10e5:	74 2f                	je     1116 <main+0x116>
+    if(fstat(fd, &st[0]) < 0)
+    10e7:	83 ec 08             	sub    $0x8,%esp
+    10ea:	68 c0 33 00 00       	push   $0x33c0
+    10ef:	56                   	push   %esi
+    10f0:	e8 93 08 00 00       	call   1988 <fstat>
+    10f5:	83 c4 10             	add    $0x10,%esp
+    10f8:	85 c0                	test   %eax,%eax
+    10fa:	79 e4                	jns    10e0 <main+0xe0>
+      fail("fstat");
+    10fc:	83 ec 0c             	sub    $0xc,%esp
+    10ff:	68 3a 28 00 00       	push   $0x283a
+    1104:	e8 77 03 00 00       	call   1480 <fail>
+    fail("create ringbench.tmp");
+    1109:	83 ec 0c             	sub    $0xc,%esp
+    110c:	68 11 28 00 00       	push   $0x2811
+    1111:	e8 6a 03 00 00       	call   1480 <fail>
+  report("fstat syscalls", n, start);
+    1116:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1119:	50                   	push   %eax
+    111a:	52                   	push   %edx
+    111b:	53                   	push   %ebx
+    111c:	68 40 28 00 00       	push   $0x2840
+    1121:	e8 ea 02 00 00       	call   1410 <report>
+  start = uptime();
+    1126:	e8 d5 08 00 00       	call   1a00 <uptime>
+  for(i = 0; i < n; i += RINGSIZE){
+    112b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  start = uptime();
+    112e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i += RINGSIZE){
+    1131:	31 d2                	xor    %edx,%edx
+    1133:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(j = 0; j < RINGSIZE; j++)
+    1140:	8b 3d c4 3c 00 00    	mov    0x3cc4,%edi
+    1146:	31 c0                	xor    %eax,%eax
+    1148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+  e = &ring.sq[ring.sqtail % RINGSIZE];
+    1150:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+      submit(RING_FSTAT, fd, &st[j], 0, j);
+    1153:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  e = &ring.sq[ring.sqtail % RINGSIZE];
+    1156:	83 e1 3f             	and    $0x3f,%ecx
+      submit(RING_FSTAT, fd, &st[j], 0, j);
+    1159:	8d 1c 9d c0 33 00 00 	lea    0x33c0(,%ebx,4),%ebx
+  e->op = op;
+    1160:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1163:	8d 0c 8d c0 3c 00 00 	lea    0x3cc0(,%ecx,4),%ecx
+  e->user = user;
+    116a:	89 41 20             	mov    %eax,0x20(%ecx)
+    for(j = 0; j < RINGSIZE; j++)
+    116d:	83 c0 01             	add    $0x1,%eax
+  e->op = op;
+    1170:	c7 41 10 05 00 00 00 	movl   $0x5,0x10(%ecx)
+  e->fd = fd;
+    1177:	89 71 14             	mov    %esi,0x14(%ecx)
+      submit(RING_FSTAT, fd, &st[j], 0, j);
+    117a:	89 59 18             	mov    %ebx,0x18(%ecx)
+  e->n = n;
+    117d:	c7 41 1c 00 00 00 00 	movl   $0x0,0x1c(%ecx)
+    for(j = 0; j < RINGSIZE; j++)
+    1184:	83 f8 40             	cmp    $0x40,%eax
+    1187:	75 c7                	jne    1150 <main+0x150>
+    flush(0);
+    1189:	83 ec 0c             	sub    $0xc,%esp
+  ring.sqtail++;
+    118c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    118f:	83 c7 40             	add    $0x40,%edi
+    flush(0);
+    1192:	6a 00                	push   $0x0
+  ring.sqtail++;
+    1194:	89 3d c4 3c 00 00    	mov    %edi,0x3cc4
+    flush(0);
+    119a:	e8 51 03 00 00       	call   14f0 <flush>
+  for(i = 0; i < n; i += RINGSIZE){
+    119f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    11a2:	83 c4 10             	add    $0x10,%esp
+    11a5:	83 c2 40             	add    $0x40,%edx
+    11a8:	39 55 e0             	cmp    %edx,-0x20(%ebp)
+    11ab:	7f 93                	jg     1140 <main+0x140>
+  }
+  report("fstat ring", n, start);
+    11ad:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11b0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    11b3:	50                   	push   %eax
+    11b4:	57                   	push   %edi
+
+  lseek(fd, 0, SEEK_SET);
+  start = uptime();
+  for(i = 0; i < n; i++)
+    11b5:	31 ff                	xor    %edi,%edi
+  report("fstat ring", n, start);
+    11b7:	53                   	push   %ebx
+    11b8:	68 4f 28 00 00       	push   $0x284f
+    11bd:	e8 4e 02 00 00       	call   1410 <report>
+  lseek(fd, 0, SEEK_SET);
+    11c2:	83 c4 0c             	add    $0xc,%esp
+    11c5:	6a 00                	push   $0x0
+    11c7:	6a 00                	push   $0x0
+    11c9:	56                   	push   %esi
+    11ca:	e8 9a 08 00 00       	call   1a69 <lseek>
+  start = uptime();
+    11cf:	e8 2c 08 00 00       	call   1a00 <uptime>
+    11d4:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+    11d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    11da:	eb 0b                	jmp    11e7 <main+0x1e7>
+    11dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e0:	83 c7 01             	add    $0x1,%edi
+    11e3:	39 fb                	cmp    %edi,%ebx
+    11e5:	74 25                	je     120c <main+0x20c>
+    if(read(fd, buf[0], CHUNK) != CHUNK)
+    11e7:	83 ec 04             	sub    $0x4,%esp
+    11ea:	6a 10                	push   $0x10
+    11ec:	68 c0 38 00 00       	push   $0x38c0
+    11f1:	56                   	push   %esi
+    11f2:	e8 19 07 00 00       	call   1910 <read>
+    11f7:	83 c4 10             	add    $0x10,%esp
+    11fa:	83 f8 10             	cmp    $0x10,%eax
+    11fd:	74 e1                	je     11e0 <main+0x1e0>
+      fail("read");
+    11ff:	83 ec 0c             	sub    $0xc,%esp
+    1202:	68 5a 28 00 00       	push   $0x285a
+    1207:	e8 74 02 00 00       	call   1480 <fail>
+  report("read syscalls", n, start);
+    120c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    120f:	50                   	push   %eax
+    1210:	52                   	push   %edx
+    1211:	53                   	push   %ebx
+    1212:	68 5f 28 00 00       	push   $0x285f
+    1217:	e8 f4 01 00 00       	call   1410 <report>
+  lseek(fd, 0, SEEK_SET);
+    121c:	83 c4 0c             	add    $0xc,%esp
+    121f:	6a 00                	push   $0x0
+    1221:	6a 00                	push   $0x0
+    1223:	56                   	push   %esi
+    1224:	e8 40 08 00 00       	call   1a69 <lseek>
+  start = uptime();
+    1229:	e8 d2 07 00 00       	call   1a00 <uptime>
+  for(i = 0; i < n; i += RINGSIZE){
+    122e:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  start = uptime();
+    1231:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i += RINGSIZE){
+    1234:	31 d2                	xor    %edx,%edx
+    1236:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for(j = 0; j < RINGSIZE; j++)
+    1239:	8b 3d c4 3c 00 00    	mov    0x3cc4,%edi
+    123f:	31 c0                	xor    %eax,%eax
+    1241:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  e = &ring.sq[ring.sqtail % RINGSIZE];
+    1248:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+      submit(RING_READ, fd, buf[j], CHUNK, j);
+    124b:	89 c3                	mov    %eax,%ebx
+  e = &ring.sq[ring.sqtail % RINGSIZE];
+    124d:	83 e1 3f             	and    $0x3f,%ecx
+      submit(RING_READ, fd, buf[j], CHUNK, j);
+    1250:	c1 e3 04             	shl    $0x4,%ebx
+  e->op = op;
+    1253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+      submit(RING_READ, fd, buf[j], CHUNK, j);
+    1256:	81 c3 c0 38 00 00    	add    $0x38c0,%ebx
+  e->op = op;
+    125c:	8d 0c 8d c0 3c 00 00 	lea    0x3cc0(,%ecx,4),%ecx
+  e->user = user;
+    1263:	89 41 20             	mov    %eax,0x20(%ecx)
+    for(j = 0; j < RINGSIZE; j++)
+    1266:	83 c0 01             	add    $0x1,%eax
+  e->op = op;
+    1269:	c7 41 10 01 00 00 00 	movl   $0x1,0x10(%ecx)
+  e->fd = fd;
+    1270:	89 71 14             	mov    %esi,0x14(%ecx)
+      submit(RING_READ, fd, buf[j], CHUNK, j);
+    1273:	89 59 18             	mov    %ebx,0x18(%ecx)
+  e->n = n;
+    1276:	c7 41 1c 10 00 00 00 	movl   $0x10,0x1c(%ecx)
+    for(j = 0; j < RINGSIZE; j++)
+    127d:	83 f8 40             	cmp    $0x40,%eax
+    1280:	75 c6                	jne    1248 <main+0x248>
+    flush(CHUNK);
+    1282:	83 ec 0c             	sub    $0xc,%esp
+  ring.sqtail++;
+    1285:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1288:	83 c7 40             	add    $0x40,%edi
+    flush(CHUNK);
+    128b:	6a 10                	push   $0x10
+  ring.sqtail++;
+    128d:	89 3d c4 3c 00 00    	mov    %edi,0x3cc4
+    flush(CHUNK);
+    1293:	e8 58 02 00 00       	call   14f0 <flush>
+  for(i = 0; i < n; i += RINGSIZE){
+    1298:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    129b:	83 c4 10             	add    $0x10,%esp
+    129e:	83 c2 40             	add    $0x40,%edx
+    12a1:	39 55 e0             	cmp    %edx,-0x20(%ebp)
+    12a4:	7f 93                	jg     1239 <main+0x239>
+  }
+  report("read ring", n, start);
+    12a6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    12a9:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    12ac:	50                   	push   %eax
+    12ad:	57                   	push   %edi
+    12ae:	53                   	push   %ebx
+    12af:	68 6d 28 00 00       	push   $0x286d
+    12b4:	e8 57 01 00 00       	call   1410 <report>
+  close(fd);
+    12b9:	89 34 24             	mov    %esi,(%esp)
+
+  start = uptime();
+  for(i = 0; i < n/10; i++){
+    12bc:	be 0a 00 00 00       	mov    $0xa,%esi
+  close(fd);
+    12c1:	e8 68 06 00 00       	call   192e <close>
+  start = uptime();
+    12c6:	e8 35 07 00 00       	call   1a00 <uptime>
+  for(i = 0; i < n/10; i++){
+    12cb:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+    12ce:	89 c1                	mov    %eax,%ecx
+  for(i = 0; i < n/10; i++){
+    12d0:	89 d8                	mov    %ebx,%eax
+    12d2:	99                   	cltd
+    12d3:	89 cf                	mov    %ecx,%edi
+    12d5:	f7 fe                	idiv   %esi
+    12d7:	31 f6                	xor    %esi,%esi
+    12d9:	89 c3                	mov    %eax,%ebx
+    12db:	eb 13                	jmp    12f0 <main+0x2f0>
+    if((fd = open("ringbench.tmp", O_RDONLY)) < 0)
+      fail("open");
+    close(fd);
+    12dd:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n/10; i++){
+    12e0:	83 c6 01             	add    $0x1,%esi
+    close(fd);
+    12e3:	50                   	push   %eax
+    12e4:	e8 45 06 00 00       	call   192e <close>
+  for(i = 0; i < n/10; i++){
+    12e9:	83 c4 10             	add    $0x10,%esp
+    12ec:	39 de                	cmp    %ebx,%esi
+    12ee:	74 22                	je     1312 <main+0x312>
+    if((fd = open("ringbench.tmp", O_RDONLY)) < 0)
+    12f0:	50                   	push   %eax
+    12f1:	50                   	push   %eax
+    12f2:	6a 00                	push   $0x0
+    12f4:	68 18 28 00 00       	push   $0x2818
+    12f9:	e8 5d 06 00 00       	call   195b <open>
+    12fe:	83 c4 10             	add    $0x10,%esp
+    1301:	85 c0                	test   %eax,%eax
+    1303:	79 d8                	jns    12dd <main+0x2dd>
+      fail("open");
+    1305:	83 ec 0c             	sub    $0xc,%esp
+    1308:	68 77 28 00 00       	push   $0x2877
+    130d:	e8 6e 01 00 00       	call   1480 <fail>
+  }
+  report("open/close syscalls", n/10*2, start);
+    1312:	89 f9                	mov    %edi,%ecx
+    1314:	8d 3c 1b             	lea    (%ebx,%ebx,1),%edi
+    1317:	56                   	push   %esi
+  start = uptime();
+  for(i = 0; i < n/10; i += NOPEN){
+    1318:	31 f6                	xor    %esi,%esi
+  report("open/close syscalls", n/10*2, start);
+    131a:	51                   	push   %ecx
+    131b:	57                   	push   %edi
+    131c:	68 7c 28 00 00       	push   $0x287c
+    1321:	e8 ea 00 00 00       	call   1410 <report>
+  start = uptime();
+    1326:	e8 d5 06 00 00       	call   1a00 <uptime>
+  for(i = 0; i < n/10; i += NOPEN){
+    132b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  start = uptime();
+    132e:	83 c4 10             	add    $0x10,%esp
+    1331:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1334:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+    1337:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    133a:	31 db                	xor    %ebx,%ebx
+    133c:	89 c7                	mov    %eax,%edi
+    133e:	29 f7                	sub    %esi,%edi
+    1340:	39 f0                	cmp    %esi,%eax
+    1342:	7f 10                	jg     1354 <main+0x354>
+    1344:	e9 ab 00 00 00       	jmp    13f4 <main+0x3f4>
+    1349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1350:	39 df                	cmp    %ebx,%edi
+    1352:	74 1f                	je     1373 <main+0x373>
+      submit(RING_OPEN, 0, "ringbench.tmp", O_RDONLY, j);
+    1354:	83 ec 0c             	sub    $0xc,%esp
+    1357:	53                   	push   %ebx
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+    1358:	83 c3 01             	add    $0x1,%ebx
+      submit(RING_OPEN, 0, "ringbench.tmp", O_RDONLY, j);
+    135b:	6a 00                	push   $0x0
+    135d:	68 18 28 00 00       	push   $0x2818
+    1362:	6a 00                	push   $0x0
+    1364:	6a 03                	push   $0x3
+    1366:	e8 35 01 00 00       	call   14a0 <submit>
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+    136b:	83 c4 20             	add    $0x20,%esp
+    136e:	83 fb 08             	cmp    $0x8,%ebx
+    1371:	75 dd                	jne    1350 <main+0x350>
+    flush(0);
+    1373:	83 ec 0c             	sub    $0xc,%esp
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+    1376:	31 db                	xor    %ebx,%ebx
+    flush(0);
+    1378:	6a 00                	push   $0x0
+    137a:	e8 71 01 00 00       	call   14f0 <flush>
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+    137f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    flush(0);
+    1382:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+    1385:	29 f7                	sub    %esi,%edi
+    1387:	eb 0b                	jmp    1394 <main+0x394>
+    1389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1390:	39 fb                	cmp    %edi,%ebx
+    1392:	74 21                	je     13b5 <main+0x3b5>
+      submit(RING_CLOSE, fds[j], 0, 0, j);
+    1394:	83 ec 0c             	sub    $0xc,%esp
+    1397:	53                   	push   %ebx
+    1398:	6a 00                	push   $0x0
+    139a:	6a 00                	push   $0x0
+    139c:	ff 34 9d c0 32 00 00 	push   0x32c0(,%ebx,4)
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+    13a3:	83 c3 01             	add    $0x1,%ebx
+      submit(RING_CLOSE, fds[j], 0, 0, j);
+    13a6:	6a 04                	push   $0x4
+    13a8:	e8 f3 00 00 00       	call   14a0 <submit>
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+    13ad:	83 c4 20             	add    $0x20,%esp
+    13b0:	83 fb 08             	cmp    $0x8,%ebx
+    13b3:	75 db                	jne    1390 <main+0x390>
+    flush(0);
+    13b5:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n/10; i += NOPEN){
+    13b8:	83 c6 08             	add    $0x8,%esi
+    flush(0);
+    13bb:	6a 00                	push   $0x0
+    13bd:	e8 2e 01 00 00       	call   14f0 <flush>
+  for(i = 0; i < n/10; i += NOPEN){
+    13c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    13c5:	83 c4 10             	add    $0x10,%esp
+    13c8:	39 c6                	cmp    %eax,%esi
+    13ca:	0f 8c 67 ff ff ff    	jl     1337 <main+0x337>
+  }
+  report("open/close ring", n/10*2, start);
+    13d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    13d3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    13d6:	52                   	push   %edx
+    13d7:	50                   	push   %eax
+    13d8:	57                   	push   %edi
+    13d9:	68 90 28 00 00       	push   $0x2890
+    13de:	e8 2d 00 00 00       	call   1410 <report>
+
+  unlink("ringbench.tmp");
+    13e3:	c7 04 24 18 28 00 00 	movl   $0x2818,(%esp)
+    13ea:	e8 8a 05 00 00       	call   1979 <unlink>
+  exit();
+    13ef:	e8 9c 04 00 00       	call   1890 <exit>
+    flush(0);
+    13f4:	83 ec 0c             	sub    $0xc,%esp
+    13f7:	6a 00                	push   $0x0
+    13f9:	e8 f2 00 00 00       	call   14f0 <flush>
+    13fe:	83 c4 10             	add    $0x10,%esp
+    1401:	eb b2                	jmp    13b5 <main+0x3b5>
+    1403:	66 90                	xchg   %ax,%ax
+    1405:	66 90                	xchg   %ax,%ax
+    1407:	66 90                	xchg   %ax,%ax
+    1409:	66 90                	xchg   %ax,%ax
+    140b:	66 90                	xchg   %ax,%ax
+    140d:	66 90                	xchg   %ax,%ax
+    140f:	90                   	nop
+
+00001410 <report>:
+{
+    1410:	55                   	push   %ebp
+    1411:	89 e5                	mov    %esp,%ebp
+    1413:	57                   	push   %edi
+    1414:	56                   	push   %esi
+    1415:	53                   	push   %ebx
+    1416:	83 ec 1c             	sub    $0x1c,%esp
+    1419:	8b 55 10             	mov    0x10(%ebp),%edx
+    141c:	8b 7d 08             	mov    0x8(%ebp),%edi
+    141f:	8b 75 0c             	mov    0xc(%ebp),%esi
+    1422:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  t = uptime() - start;
+    1425:	e8 d6 05 00 00       	call   1a00 <uptime>
+    142a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  printf(1, "%s: %d ops in %d ticks", what, n, t);
+    142d:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - start;
+    1430:	29 d0                	sub    %edx,%eax
+  printf(1, "%s: %d ops in %d ticks", what, n, t);
+    1432:	50                   	push   %eax
+  t = uptime() - start;
+    1433:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s: %d ops in %d ticks", what, n, t);
+    1435:	56                   	push   %esi
+    1436:	57                   	push   %edi
+    1437:	68 b8 27 00 00       	push   $0x27b8
+    143c:	6a 01                	push   $0x1
+    143e:	e8 bd 09 00 00       	call   1e00 <printf>
+  if(t > 0)
+    1443:	83 c4 20             	add    $0x20,%esp
+    1446:	85 db                	test   %ebx,%ebx
+    1448:	7e 19                	jle    1463 <report+0x53>
+    printf(1, ", %d ops/s", n*100/t);
+    144a:	6b c6 64             	imul   $0x64,%esi,%eax
+    144d:	83 ec 04             	sub    $0x4,%esp
+    1450:	99                   	cltd
+    1451:	f7 fb                	idiv   %ebx
+    1453:	50                   	push   %eax
+    1454:	68 cf 27 00 00       	push   $0x27cf
+    1459:	6a 01                	push   $0x1
+    145b:	e8 a0 09 00 00       	call   1e00 <printf>
+    1460:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n");
+    1463:	c7 45 0c ee 27 00 00 	movl   $0x27ee,0xc(%ebp)
+    146a:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+    1471:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1474:	5b                   	pop    %ebx
+    1475:	5e                   	pop    %esi
+    1476:	5f                   	pop    %edi
+    1477:	5d                   	pop    %ebp
+  printf(1, "\n");
+    1478:	e9 83 09 00 00       	jmp    1e00 <printf>
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001480 <fail>:
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "ringbench: %s failed\n", what);
+    1486:	ff 75 08             	push   0x8(%ebp)
+    1489:	68 da 27 00 00       	push   $0x27da
+    148e:	6a 02                	push   $0x2
+    1490:	e8 6b 09 00 00       	call   1e00 <printf>
+  exit();
+    1495:	e8 f6 03 00 00       	call   1890 <exit>
+    149a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000014a0 <submit>:
+{
+    14a0:	55                   	push   %ebp
+  e = &ring.sq[ring.sqtail % RINGSIZE];
+    14a1:	8b 15 c4 3c 00 00    	mov    0x3cc4,%edx
+    14a7:	89 d0                	mov    %edx,%eax
+  ring.sqtail++;
+    14a9:	83 c2 01             	add    $0x1,%edx
+{
+    14ac:	89 e5                	mov    %esp,%ebp
+  e = &ring.sq[ring.sqtail % RINGSIZE];
+    14ae:	83 e0 3f             	and    $0x3f,%eax
+  ring.sqtail++;
+    14b1:	89 15 c4 3c 00 00    	mov    %edx,0x3cc4
+  e->op = op;
+    14b7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    14ba:	8d 04 80             	lea    (%eax,%eax,4),%eax
+    14bd:	8d 04 85 c0 3c 00 00 	lea    0x3cc0(,%eax,4),%eax
+    14c4:	89 48 10             	mov    %ecx,0x10(%eax)
+  e->fd = fd;
+    14c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    14ca:	89 48 14             	mov    %ecx,0x14(%eax)
+  e->buf = buf;
+    14cd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    14d0:	89 48 18             	mov    %ecx,0x18(%eax)
+  e->n = n;
+    14d3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+    14d6:	89 48 1c             	mov    %ecx,0x1c(%eax)
+  e->user = user;
+    14d9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+    14dc:	89 48 20             	mov    %ecx,0x20(%eax)
+}
+    14df:	5d                   	pop    %ebp
+    14e0:	c3                   	ret
+    14e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ef:	90                   	nop
+
+000014f0 <flush>:
+{
+    14f0:	55                   	push   %ebp
+    14f1:	89 e5                	mov    %esp,%ebp
+    14f3:	57                   	push   %edi
+    14f4:	56                   	push   %esi
+    14f5:	53                   	push   %ebx
+    14f6:	83 ec 1c             	sub    $0x1c,%esp
+    14f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  while(ring.sqhead != ring.sqtail){
+    14fc:	a1 c4 3c 00 00       	mov    0x3cc4,%eax
+    1501:	39 05 c0 3c 00 00    	cmp    %eax,0x3cc0
+    1507:	74 74                	je     157d <flush+0x8d>
+    1509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ringenter(RINGSIZE) < 0)
+    1510:	83 ec 0c             	sub    $0xc,%esp
+    1513:	6a 40                	push   $0x40
+    1515:	e8 a9 05 00 00       	call   1ac3 <ringenter>
+    151a:	83 c4 10             	add    $0x10,%esp
+    151d:	85 c0                	test   %eax,%eax
+    151f:	78 7f                	js     15a0 <flush+0xb0>
+    for(; ring.cqhead != ring.cqtail; ring.cqhead++){
+    1521:	a1 c8 3c 00 00       	mov    0x3cc8,%eax
+    1526:	8b 1d cc 3c 00 00    	mov    0x3ccc,%ebx
+    152c:	31 ff                	xor    %edi,%edi
+    152e:	39 d8                	cmp    %ebx,%eax
+    1530:	75 09                	jne    153b <flush+0x4b>
+    1532:	eb c8                	jmp    14fc <flush+0xc>
+    1534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1538:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      c = &ring.cq[ring.cqhead % RINGSIZE];
+    153b:	89 c2                	mov    %eax,%edx
+    153d:	83 e2 3f             	and    $0x3f,%edx
+      if(c->res < min)
+    1540:	81 c2 a2 00 00 00    	add    $0xa2,%edx
+    1546:	8b 0c d5 c4 3c 00 00 	mov    0x3cc4(,%edx,8),%ecx
+    154d:	39 f1                	cmp    %esi,%ecx
+    154f:	7c 34                	jl     1585 <flush+0x95>
+      fds[c->user] = c->res;
+    1551:	8b 14 d5 c0 3c 00 00 	mov    0x3cc0(,%edx,8),%edx
+    for(; ring.cqhead != ring.cqtail; ring.cqhead++){
+    1558:	83 c0 01             	add    $0x1,%eax
+    155b:	bf 01 00 00 00       	mov    $0x1,%edi
+      fds[c->user] = c->res;
+    1560:	89 0c 95 c0 32 00 00 	mov    %ecx,0x32c0(,%edx,4)
+    for(; ring.cqhead != ring.cqtail; ring.cqhead++){
+    1567:	39 d8                	cmp    %ebx,%eax
+    1569:	75 cd                	jne    1538 <flush+0x48>
+    156b:	a3 c8 3c 00 00       	mov    %eax,0x3cc8
+  while(ring.sqhead != ring.sqtail){
+    1570:	a1 c4 3c 00 00       	mov    0x3cc4,%eax
+    1575:	39 05 c0 3c 00 00    	cmp    %eax,0x3cc0
+    157b:	75 93                	jne    1510 <flush+0x20>
+}
+    157d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1580:	5b                   	pop    %ebx
+    1581:	5e                   	pop    %esi
+    1582:	5f                   	pop    %edi
+    1583:	5d                   	pop    %ebp
+    1584:	c3                   	ret
+    1585:	89 f8                	mov    %edi,%eax
+    1587:	84 c0                	test   %al,%al
+    1589:	74 08                	je     1593 <flush+0xa3>
+    158b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    158e:	a3 c8 3c 00 00       	mov    %eax,0x3cc8
+        fail("ring request");
+    1593:	83 ec 0c             	sub    $0xc,%esp
+    1596:	68 fa 27 00 00       	push   $0x27fa
+    159b:	e8 e0 fe ff ff       	call   1480 <fail>
+      fail("ringenter");
+    15a0:	83 ec 0c             	sub    $0xc,%esp
+    15a3:	68 f0 27 00 00       	push   $0x27f0
+    15a8:	e8 d3 fe ff ff       	call   1480 <fail>
+    15ad:	66 90                	xchg   %ax,%ax
+    15af:	90                   	nop
+
+000015b0 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    15b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    15b1:	31 c0                	xor    %eax,%eax
+{
+    15b3:	89 e5                	mov    %esp,%ebp
+    15b5:	53                   	push   %ebx
+    15b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    15b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    15bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    15c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    15c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    15c7:	83 c0 01             	add    $0x1,%eax
+    15ca:	84 d2                	test   %dl,%dl
+    15cc:	75 f2                	jne    15c0 <strcpy+0x10>
+    ;
+  return os;
+}
+    15ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    15d1:	89 c8                	mov    %ecx,%eax
+    15d3:	c9                   	leave
+    15d4:	c3                   	ret
+    15d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    15e0:	55                   	push   %ebp
+    15e1:	89 e5                	mov    %esp,%ebp
+    15e3:	53                   	push   %ebx
+    15e4:	8b 55 08             	mov    0x8(%ebp),%edx
+    15e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    15ea:	0f b6 02             	movzbl (%edx),%eax
+    15ed:	84 c0                	test   %al,%al
+    15ef:	75 17                	jne    1608 <strcmp+0x28>
+    15f1:	eb 3a                	jmp    162d <strcmp+0x4d>
+    15f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15f7:	90                   	nop
+    15f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    15fc:	83 c2 01             	add    $0x1,%edx
+    15ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1602:	84 c0                	test   %al,%al
+    1604:	74 1a                	je     1620 <strcmp+0x40>
+    p++, q++;
+    1606:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1608:	0f b6 19             	movzbl (%ecx),%ebx
+    160b:	38 c3                	cmp    %al,%bl
+    160d:	74 e9                	je     15f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    160f:	29 d8                	sub    %ebx,%eax
+}
+    1611:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1614:	c9                   	leave
+    1615:	c3                   	ret
+    1616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    161d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1620:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1624:	31 c0                	xor    %eax,%eax
+    1626:	29 d8                	sub    %ebx,%eax
+}
+    1628:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    162b:	c9                   	leave
+    162c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    162d:	0f b6 19             	movzbl (%ecx),%ebx
+    1630:	31 c0                	xor    %eax,%eax
+    1632:	eb db                	jmp    160f <strcmp+0x2f>
+    1634:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    163f:	90                   	nop
+
+00001640 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1646:	80 3a 00             	cmpb   $0x0,(%edx)
+    1649:	74 15                	je     1660 <strlen+0x20>
+    164b:	31 c0                	xor    %eax,%eax
+    164d:	8d 76 00             	lea    0x0(%esi),%esi
+    1650:	83 c0 01             	add    $0x1,%eax
+    1653:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1657:	89 c1                	mov    %eax,%ecx
+    1659:	75 f5                	jne    1650 <strlen+0x10>
+    ;
+  return n;
+}
+    165b:	89 c8                	mov    %ecx,%eax
+    165d:	5d                   	pop    %ebp
+    165e:	c3                   	ret
+    165f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1660:	31 c9                	xor    %ecx,%ecx
+}
+    1662:	5d                   	pop    %ebp
+    1663:	89 c8                	mov    %ecx,%eax
+    1665:	c3                   	ret
+    1666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001670 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	57                   	push   %edi
+    1674:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1677:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    167a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    167d:	89 d7                	mov    %edx,%edi
+    167f:	fc                   	cld
+    1680:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1682:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1685:	89 d0                	mov    %edx,%eax
+    1687:	c9                   	leave
+    1688:	c3                   	ret
+    1689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001690 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1690:	55                   	push   %ebp
+    1691:	89 e5                	mov    %esp,%ebp
+    1693:	8b 45 08             	mov    0x8(%ebp),%eax
+    1696:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    169a:	0f b6 10             	movzbl (%eax),%edx
+    169d:	84 d2                	test   %dl,%dl
+    169f:	75 12                	jne    16b3 <strchr+0x23>
+    16a1:	eb 1d                	jmp    16c0 <strchr+0x30>
+    16a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16a7:	90                   	nop
+    16a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    16ac:	83 c0 01             	add    $0x1,%eax
+    16af:	84 d2                	test   %dl,%dl
+    16b1:	74 0d                	je     16c0 <strchr+0x30>
+    if(*s == c)
+    16b3:	38 d1                	cmp    %dl,%cl
+    16b5:	75 f1                	jne    16a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    16b7:	5d                   	pop    %ebp
+    16b8:	c3                   	ret
+    16b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    16c0:	31 c0                	xor    %eax,%eax
+}
+    16c2:	5d                   	pop    %ebp
+    16c3:	c3                   	ret
+    16c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16cf:	90                   	nop
+
+000016d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	57                   	push   %edi
+    16d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    16d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    16d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    16d9:	31 db                	xor    %ebx,%ebx
+{
+    16db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    16de:	eb 27                	jmp    1707 <gets+0x37>
+    cc = read(0, &c, 1);
+    16e0:	83 ec 04             	sub    $0x4,%esp
+    16e3:	6a 01                	push   $0x1
+    16e5:	56                   	push   %esi
+    16e6:	6a 00                	push   $0x0
+    16e8:	e8 23 02 00 00       	call   1910 <read>
+    if(cc < 1)
+    16ed:	83 c4 10             	add    $0x10,%esp
+    16f0:	85 c0                	test   %eax,%eax
+    16f2:	7e 1d                	jle    1711 <gets+0x41>
+      break;
+    buf[i++] = c;
+    16f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    16f8:	8b 55 08             	mov    0x8(%ebp),%edx
+    16fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    16ff:	3c 0a                	cmp    $0xa,%al
+    1701:	74 10                	je     1713 <gets+0x43>
+    1703:	3c 0d                	cmp    $0xd,%al
+    1705:	74 0c                	je     1713 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1707:	89 df                	mov    %ebx,%edi
+    1709:	83 c3 01             	add    $0x1,%ebx
+    170c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    170f:	7c cf                	jl     16e0 <gets+0x10>
+    1711:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1713:	8b 45 08             	mov    0x8(%ebp),%eax
+    1716:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    171a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    171d:	5b                   	pop    %ebx
+    171e:	5e                   	pop    %esi
+    171f:	5f                   	pop    %edi
+    1720:	5d                   	pop    %ebp
+    1721:	c3                   	ret
+    1722:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001730 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1730:	55                   	push   %ebp
+    1731:	89 e5                	mov    %esp,%ebp
+    1733:	56                   	push   %esi
+    1734:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1735:	83 ec 08             	sub    $0x8,%esp
+    1738:	6a 00                	push   $0x0
+    173a:	ff 75 08             	push   0x8(%ebp)
+    173d:	e8 19 02 00 00       	call   195b <open>
+  if(fd < 0)
+    1742:	83 c4 10             	add    $0x10,%esp
+    1745:	85 c0                	test   %eax,%eax
+    1747:	78 27                	js     1770 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1749:	83 ec 08             	sub    $0x8,%esp
+    174c:	ff 75 0c             	push   0xc(%ebp)
+    174f:	89 c3                	mov    %eax,%ebx
+    1751:	50                   	push   %eax
+    1752:	e8 31 02 00 00       	call   1988 <fstat>
+  close(fd);
+    1757:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    175a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    175c:	e8 cd 01 00 00       	call   192e <close>
+  return r;
+    1761:	83 c4 10             	add    $0x10,%esp
+}
+    1764:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1767:	89 f0                	mov    %esi,%eax
+    1769:	5b                   	pop    %ebx
+    176a:	5e                   	pop    %esi
+    176b:	5d                   	pop    %ebp
+    176c:	c3                   	ret
+    176d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1770:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1775:	eb ed                	jmp    1764 <stat+0x34>
+    1777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177e:	66 90                	xchg   %ax,%ax
+
+00001780 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1780:	55                   	push   %ebp
+    1781:	89 e5                	mov    %esp,%ebp
+    1783:	53                   	push   %ebx
+    1784:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1787:	0f be 02             	movsbl (%edx),%eax
+    178a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    178d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1790:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1795:	77 1e                	ja     17b5 <atoi+0x35>
+    1797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    179e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    17a0:	83 c2 01             	add    $0x1,%edx
+    17a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    17a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    17aa:	0f be 02             	movsbl (%edx),%eax
+    17ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    17b0:	80 fb 09             	cmp    $0x9,%bl
+    17b3:	76 eb                	jbe    17a0 <atoi+0x20>
+  return n;
+}
+    17b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    17b8:	89 c8                	mov    %ecx,%eax
+    17ba:	c9                   	leave
+    17bb:	c3                   	ret
+    17bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000017c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	57                   	push   %edi
+    17c4:	56                   	push   %esi
+    17c5:	8b 45 10             	mov    0x10(%ebp),%eax
+    17c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    17cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    17ce:	85 c0                	test   %eax,%eax
+    17d0:	7e 13                	jle    17e5 <memmove+0x25>
+    17d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    17d4:	89 d7                	mov    %edx,%edi
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    17e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    17e1:	39 f8                	cmp    %edi,%eax
+    17e3:	75 fb                	jne    17e0 <memmove+0x20>
+  return vdst;
+}
+    17e5:	5e                   	pop    %esi
+    17e6:	89 d0                	mov    %edx,%eax
+    17e8:	5f                   	pop    %edi
+    17e9:	5d                   	pop    %ebp
+    17ea:	c3                   	ret
+    17eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17ef:	90                   	nop
+
+000017f0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 e5                	mov    %esp,%ebp
+    17f3:	56                   	push   %esi
+    17f4:	53                   	push   %ebx
+    17f5:	8b 75 10             	mov    0x10(%ebp),%esi
+    17f8:	8b 55 08             	mov    0x8(%ebp),%edx
+    17fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    17fe:	85 f6                	test   %esi,%esi
+    1800:	74 2e                	je     1830 <memcmp+0x40>
+    1802:	01 c6                	add    %eax,%esi
+    1804:	eb 14                	jmp    181a <memcmp+0x2a>
+    1806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1810:	83 c0 01             	add    $0x1,%eax
+    1813:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1816:	39 f0                	cmp    %esi,%eax
+    1818:	74 16                	je     1830 <memcmp+0x40>
+    if(*s1 != *s2)
+    181a:	0f b6 0a             	movzbl (%edx),%ecx
+    181d:	0f b6 18             	movzbl (%eax),%ebx
+    1820:	38 d9                	cmp    %bl,%cl
+    1822:	74 ec                	je     1810 <memcmp+0x20>
+      return *s1 - *s2;
+    1824:	0f b6 c1             	movzbl %cl,%eax
+    1827:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1829:	5b                   	pop    %ebx
+    182a:	5e                   	pop    %esi
+    182b:	5d                   	pop    %ebp
+    182c:	c3                   	ret
+    182d:	8d 76 00             	lea    0x0(%esi),%esi
+    1830:	5b                   	pop    %ebx
+  return 0;
+    1831:	31 c0                	xor    %eax,%eax
+}
+    1833:	5e                   	pop    %esi
+    1834:	5d                   	pop    %ebp
+    1835:	c3                   	ret
+    1836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    183d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001840 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1840:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1845:	c3                   	ret
+    1846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001850 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1850:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1855:	c3                   	ret
+    1856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    185d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001860 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1860:	a1 d0 43 00 00       	mov    0x43d0,%eax
+    1865:	85 c0                	test   %eax,%eax
+    1867:	74 17                	je     1880 <fork+0x20>
+{
+    1869:	55                   	push   %ebp
+    186a:	89 e5                	mov    %esp,%ebp
+    186c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    186f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1871:	c9                   	leave
+  return _fork();
+    1872:	e9 5d 00 00 00       	jmp    18d4 <_fork>
+    1877:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187e:	66 90                	xchg   %ax,%ax
+    1880:	e9 4f 00 00 00       	jmp    18d4 <_fork>
+    1885:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    188c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001890 <exit>:
+
+int
+exit(void)
+{
+    1890:	55                   	push   %ebp
+    1891:	89 e5                	mov    %esp,%ebp
+    1893:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1896:	a1 d0 43 00 00       	mov    0x43d0,%eax
+    189b:	85 c0                	test   %eax,%eax
+    189d:	74 02                	je     18a1 <exit+0x11>
+    flushhook();
+    189f:	ff d0                	call   *%eax
+  _exit();
+    18a1:	e8 3d 00 00 00       	call   18e3 <_exit>
+    18a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000018b0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    18b0:	55                   	push   %ebp
+  if(flushhook)
+    18b1:	a1 d0 43 00 00       	mov    0x43d0,%eax
+{
+    18b6:	89 e5                	mov    %esp,%ebp
+    18b8:	56                   	push   %esi
+    18b9:	53                   	push   %ebx
+    18ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    18bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    18c0:	85 c0                	test   %eax,%eax
+    18c2:	74 02                	je     18c6 <exec+0x16>
+    flushhook();
+    18c4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    18c6:	89 75 0c             	mov    %esi,0xc(%ebp)
+    18c9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    18cc:	5b                   	pop    %ebx
+    18cd:	5e                   	pop    %esi
+    18ce:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    18cf:	e9 78 00 00 00       	jmp    194c <_exec>
+
+000018d4 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    18d4:	b8 01 00 00 00       	mov    $0x1,%eax
+    18d9:	89 e1                	mov    %esp,%ecx
+    18db:	ba e2 18 00 00       	mov    $0x18e2,%edx
+    18e0:	0f 34                	sysenter
+    18e2:	c3                   	ret
+
+000018e3 <_exit>:
+RAWSYSCALL(exit)
+    18e3:	b8 02 00 00 00       	mov    $0x2,%eax
+    18e8:	89 e1                	mov    %esp,%ecx
+    18ea:	ba f1 18 00 00       	mov    $0x18f1,%edx
+    18ef:	0f 34                	sysenter
+    18f1:	c3                   	ret
+
+000018f2 <wait>:
+SYSCALL(wait)
+    18f2:	b8 03 00 00 00       	mov    $0x3,%eax
+    18f7:	89 e1                	mov    %esp,%ecx
+    18f9:	ba 00 19 00 00       	mov    $0x1900,%edx
+    18fe:	0f 34                	sysenter
+    1900:	c3                   	ret
+
+00001901 <pipe>:
+SYSCALL(pipe)
+    1901:	b8 04 00 00 00       	mov    $0x4,%eax
+    1906:	89 e1                	mov    %esp,%ecx
+    1908:	ba 0f 19 00 00       	mov    $0x190f,%edx
+    190d:	0f 34                	sysenter
+    190f:	c3                   	ret
+
+00001910 <read>:
+SYSCALL(read)
+    1910:	b8 05 00 00 00       	mov    $0x5,%eax
+    1915:	89 e1                	mov    %esp,%ecx
+    1917:	ba 1e 19 00 00       	mov    $0x191e,%edx
+    191c:	0f 34                	sysenter
+    191e:	c3                   	ret
+
+0000191f <write>:
+SYSCALL(write)
+    191f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1924:	89 e1                	mov    %esp,%ecx
+    1926:	ba 2d 19 00 00       	mov    $0x192d,%edx
+    192b:	0f 34                	sysenter
+    192d:	c3                   	ret
+
+0000192e <close>:
+SYSCALL(close)
+    192e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1933:	89 e1                	mov    %esp,%ecx
+    1935:	ba 3c 19 00 00       	mov    $0x193c,%edx
+    193a:	0f 34                	sysenter
+    193c:	c3                   	ret
+
+0000193d <kill>:
+SYSCALL(kill)
+    193d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1942:	89 e1                	mov    %esp,%ecx
+    1944:	ba 4b 19 00 00       	mov    $0x194b,%edx
+    1949:	0f 34                	sysenter
+    194b:	c3                   	ret
+
+0000194c <_exec>:
+RAWSYSCALL(exec)
+    194c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1951:	89 e1                	mov    %esp,%ecx
+    1953:	ba 5a 19 00 00       	mov    $0x195a,%edx
+    1958:	0f 34                	sysenter
+    195a:	c3                   	ret
+
+0000195b <open>:
+SYSCALL(open)
+    195b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1960:	89 e1                	mov    %esp,%ecx
+    1962:	ba 69 19 00 00       	mov    $0x1969,%edx
+    1967:	0f 34                	sysenter
+    1969:	c3                   	ret
+
+0000196a <mknod>:
+SYSCALL(mknod)
+    196a:	b8 11 00 00 00       	mov    $0x11,%eax
+    196f:	89 e1                	mov    %esp,%ecx
+    1971:	ba 78 19 00 00       	mov    $0x1978,%edx
+    1976:	0f 34                	sysenter
+    1978:	c3                   	ret
+
+00001979 <unlink>:
+SYSCALL(unlink)
+    1979:	b8 12 00 00 00       	mov    $0x12,%eax
+    197e:	89 e1                	mov    %esp,%ecx
+    1980:	ba 87 19 00 00       	mov    $0x1987,%edx
+    1985:	0f 34                	sysenter
+    1987:	c3                   	ret
+
+00001988 <fstat>:
+SYSCALL(fstat)
+    1988:	b8 08 00 00 00       	mov    $0x8,%eax
+    198d:	89 e1                	mov    %esp,%ecx
+    198f:	ba 96 19 00 00       	mov    $0x1996,%edx
+    1994:	0f 34                	sysenter
+    1996:	c3                   	ret
+
+00001997 <link>:
+SYSCALL(link)
+    1997:	b8 13 00 00 00       	mov    $0x13,%eax
+    199c:	89 e1                	mov    %esp,%ecx
+    199e:	ba a5 19 00 00       	mov    $0x19a5,%edx
+    19a3:	0f 34                	sysenter
+    19a5:	c3                   	ret
+
+000019a6 <mkdir>:
+SYSCALL(mkdir)
+    19a6:	b8 14 00 00 00       	mov    $0x14,%eax
+    19ab:	89 e1                	mov    %esp,%ecx
+    19ad:	ba b4 19 00 00       	mov    $0x19b4,%edx
+    19b2:	0f 34                	sysenter
+    19b4:	c3                   	ret
+
+000019b5 <chdir>:
+SYSCALL(chdir)
+    19b5:	b8 09 00 00 00       	mov    $0x9,%eax
+    19ba:	89 e1                	mov    %esp,%ecx
+    19bc:	ba c3 19 00 00       	mov    $0x19c3,%edx
+    19c1:	0f 34                	sysenter
+    19c3:	c3                   	ret
+
+000019c4 <dup>:
+SYSCALL(dup)
+    19c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    19c9:	89 e1                	mov    %esp,%ecx
+    19cb:	ba d2 19 00 00       	mov    $0x19d2,%edx
+    19d0:	0f 34                	sysenter
+    19d2:	c3                   	ret
+
+000019d3 <getpid>:
+SYSCALL(getpid)
+    19d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    19d8:	89 e1                	mov    %esp,%ecx
+    19da:	ba e1 19 00 00       	mov    $0x19e1,%edx
+    19df:	0f 34                	sysenter
+    19e1:	c3                   	ret
+
+000019e2 <sbrk>:
+SYSCALL(sbrk)
+    19e2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    19e7:	89 e1                	mov    %esp,%ecx
+    19e9:	ba f0 19 00 00       	mov    $0x19f0,%edx
+    19ee:	0f 34                	sysenter
+    19f0:	c3                   	ret
+
+000019f1 <sleep>:
+SYSCALL(sleep)
+    19f1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    19f6:	89 e1                	mov    %esp,%ecx
+    19f8:	ba ff 19 00 00       	mov    $0x19ff,%edx
+    19fd:	0f 34                	sysenter
+    19ff:	c3                   	ret
+
+00001a00 <uptime>:
+SYSCALL(uptime)
+    1a00:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1a05:	89 e1                	mov    %esp,%ecx
+    1a07:	ba 0e 1a 00 00       	mov    $0x1a0e,%edx
+    1a0c:	0f 34                	sysenter
+    1a0e:	c3                   	ret
+
+00001a0f <mprotect>:
+SYSCALL(mprotect)
+    1a0f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1a14:	89 e1                	mov    %esp,%ecx
+    1a16:	ba 1d 1a 00 00       	mov    $0x1a1d,%edx
+    1a1b:	0f 34                	sysenter
+    1a1d:	c3                   	ret
+
+00001a1e <munprotect>:
+SYSCALL(munprotect)
+    1a1e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1a23:	89 e1                	mov    %esp,%ecx
+    1a25:	ba 2c 1a 00 00       	mov    $0x1a2c,%edx
+    1a2a:	0f 34                	sysenter
+    1a2c:	c3                   	ret
+
+00001a2d <kstat>:
+SYSCALL(kstat)
+    1a2d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1a32:	89 e1                	mov    %esp,%ecx
+    1a34:	ba 3b 1a 00 00       	mov    $0x1a3b,%edx
+    1a39:	0f 34                	sysenter
+    1a3b:	c3                   	ret
+
+00001a3c <fcntl>:
+SYSCALL(fcntl)
+    1a3c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1a41:	89 e1                	mov    %esp,%ecx
+    1a43:	ba 4a 1a 00 00       	mov    $0x1a4a,%edx
+    1a48:	0f 34                	sysenter
+    1a4a:	c3                   	ret
+
+00001a4b <splice>:
+SYSCALL(splice)
+    1a4b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1a50:	89 e1                	mov    %esp,%ecx
+    1a52:	ba 59 1a 00 00       	mov    $0x1a59,%edx
+    1a57:	0f 34                	sysenter
+    1a59:	c3                   	ret
+
+00001a5a <sendfile>:
+SYSCALL(sendfile)
+    1a5a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1a5f:	89 e1                	mov    %esp,%ecx
+    1a61:	ba 68 1a 00 00       	mov    $0x1a68,%edx
+    1a66:	0f 34                	sysenter
+    1a68:	c3                   	ret
+
+00001a69 <lseek>:
+SYSCALL(lseek)
+    1a69:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1a6e:	89 e1                	mov    %esp,%ecx
+    1a70:	ba 77 1a 00 00       	mov    $0x1a77,%edx
+    1a75:	0f 34                	sysenter
+    1a77:	c3                   	ret
+
+00001a78 <pread>:
+SYSCALL(pread)
+    1a78:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1a7d:	89 e1                	mov    %esp,%ecx
+    1a7f:	ba 86 1a 00 00       	mov    $0x1a86,%edx
+    1a84:	0f 34                	sysenter
+    1a86:	c3                   	ret
+
+00001a87 <pwrite>:
+SYSCALL(pwrite)
+    1a87:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1a8c:	89 e1                	mov    %esp,%ecx
+    1a8e:	ba 95 1a 00 00       	mov    $0x1a95,%edx
+    1a93:	0f 34                	sysenter
+    1a95:	c3                   	ret
+
+00001a96 <readv>:
+SYSCALL(readv)
+    1a96:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1a9b:	89 e1                	mov    %esp,%ecx
+    1a9d:	ba a4 1a 00 00       	mov    $0x1aa4,%edx
+    1aa2:	0f 34                	sysenter
+    1aa4:	c3                   	ret
+
+00001aa5 <writev>:
+SYSCALL(writev)
+    1aa5:	b8 20 00 00 00       	mov    $0x20,%eax
+    1aaa:	89 e1                	mov    %esp,%ecx
+    1aac:	ba b3 1a 00 00       	mov    $0x1ab3,%edx
+    1ab1:	0f 34                	sysenter
+    1ab3:	c3                   	ret
+
+00001ab4 <ringsetup>:
+SYSCALL(ringsetup)
+    1ab4:	b8 21 00 00 00       	mov    $0x21,%eax
+    1ab9:	89 e1                	mov    %esp,%ecx
+    1abb:	ba c2 1a 00 00       	mov    $0x1ac2,%edx
+    1ac0:	0f 34                	sysenter
+    1ac2:	c3                   	ret
+
+00001ac3 <ringenter>:
+SYSCALL(ringenter)
+    1ac3:	b8 22 00 00 00       	mov    $0x22,%eax
+    1ac8:	89 e1                	mov    %esp,%ecx
+    1aca:	ba d1 1a 00 00       	mov    $0x1ad1,%edx
+    1acf:	0f 34                	sysenter
+    1ad1:	c3                   	ret
+
+00001ad2 <intgetpid>:
+INTSYSCALL(getpid)
+    1ad2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1ad7:	cd 40                	int    $0x40
+    1ad9:	c3                   	ret
+    1ada:	66 90                	xchg   %ax,%ax
+    1adc:	66 90                	xchg   %ax,%ax
+    1ade:	66 90                	xchg   %ax,%ax
+
+00001ae0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1ae0:	55                   	push   %ebp
+    1ae1:	89 e5                	mov    %esp,%ebp
+    1ae3:	57                   	push   %edi
+    1ae4:	56                   	push   %esi
+    1ae5:	53                   	push   %ebx
+    1ae6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1ae8:	89 d1                	mov    %edx,%ecx
+{
+    1aea:	83 ec 2c             	sub    $0x2c,%esp
+    1aed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1af0:	85 d2                	test   %edx,%edx
+    1af2:	0f 89 c0 00 00 00    	jns    1bb8 <printint+0xd8>
+    1af8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    1afc:	0f 84 b6 00 00 00    	je     1bb8 <printint+0xd8>
+    x = -xx;
+    1b02:	f7 d9                	neg    %ecx
+    neg = 1;
+    1b04:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1b09:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1b0c:	31 f6                	xor    %esi,%esi
+    1b0e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1b10:	89 c8                	mov    %ecx,%eax
+    1b12:	31 d2                	xor    %edx,%edx
+    1b14:	89 f7                	mov    %esi,%edi
+    1b16:	f7 f3                	div    %ebx
+    1b18:	8d 76 01             	lea    0x1(%esi),%esi
+    1b1b:	0f b6 92 24 29 00 00 	movzbl 0x2924(%edx),%edx
+    1b22:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1b26:	89 ca                	mov    %ecx,%edx
+    1b28:	89 c1                	mov    %eax,%ecx
+    1b2a:	39 da                	cmp    %ebx,%edx
+    1b2c:	73 e2                	jae    1b10 <printint+0x30>
+  if(neg)
+    1b2e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1b31:	85 c0                	test   %eax,%eax
+    1b33:	74 07                	je     1b3c <printint+0x5c>
+    buf[i++] = '-';
+    1b35:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    1b3a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    1b3c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    1b3f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1b42:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1b44:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1b47:	8b 41 08             	mov    0x8(%ecx),%eax
+    1b4a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1b4d:	89 ce                	mov    %ecx,%esi
+    1b4f:	eb 1c                	jmp    1b6d <printint+0x8d>
+    1b51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1b58:	89 c1                	mov    %eax,%ecx
+    1b5a:	83 c0 01             	add    $0x1,%eax
+    1b5d:	89 46 08             	mov    %eax,0x8(%esi)
+    1b60:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1b64:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1b67:	39 df                	cmp    %ebx,%edi
+    1b69:	74 41                	je     1bac <printint+0xcc>
+    1b6b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    1b6d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1b70:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1b75:	75 e1                	jne    1b58 <printint+0x78>
+  if(o->f)
+    1b77:	8b 06                	mov    (%esi),%eax
+    1b79:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    1b7c:	85 c0                	test   %eax,%eax
+    1b7e:	74 40                	je     1bc0 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1b80:	50                   	push   %eax
+    1b81:	68 80 00 00 00       	push   $0x80
+    1b86:	6a 01                	push   $0x1
+    1b88:	ff 75 d4             	push   -0x2c(%ebp)
+    1b8b:	e8 a0 04 00 00       	call   2030 <fwrite>
+    1b90:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1b94:	83 c4 10             	add    $0x10,%esp
+}
+    1b97:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b9c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    1b9e:	89 46 08             	mov    %eax,0x8(%esi)
+    1ba1:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1ba5:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1ba8:	39 df                	cmp    %ebx,%edi
+    1baa:	75 bf                	jne    1b6b <printint+0x8b>
+}
+    1bac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1baf:	5b                   	pop    %ebx
+    1bb0:	5e                   	pop    %esi
+    1bb1:	5f                   	pop    %edi
+    1bb2:	5d                   	pop    %ebp
+    1bb3:	c3                   	ret
+    1bb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1bb8:	31 c0                	xor    %eax,%eax
+    1bba:	e9 4a ff ff ff       	jmp    1b09 <printint+0x29>
+    1bbf:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1bc0:	83 ec 04             	sub    $0x4,%esp
+    1bc3:	68 80 00 00 00       	push   $0x80
+    1bc8:	ff 75 d4             	push   -0x2c(%ebp)
+    1bcb:	ff 76 04             	push   0x4(%esi)
+    1bce:	e8 4c fd ff ff       	call   191f <write>
+    1bd3:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1bd7:	83 c4 10             	add    $0x10,%esp
+    1bda:	eb bb                	jmp    1b97 <printint+0xb7>
+    1bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001be0 <putc>:
+{
+    1be0:	55                   	push   %ebp
+    1be1:	89 e5                	mov    %esp,%ebp
+    1be3:	56                   	push   %esi
+    1be4:	89 d6                	mov    %edx,%esi
+    1be6:	53                   	push   %ebx
+    1be7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1be9:	8b 40 08             	mov    0x8(%eax),%eax
+    1bec:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1bf1:	74 1d                	je     1c10 <putc+0x30>
+  o->buf[o->n++] = c;
+    1bf3:	89 f1                	mov    %esi,%ecx
+    1bf5:	8d 50 01             	lea    0x1(%eax),%edx
+    1bf8:	89 53 08             	mov    %edx,0x8(%ebx)
+    1bfb:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    1bff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1c02:	5b                   	pop    %ebx
+    1c03:	5e                   	pop    %esi
+    1c04:	5d                   	pop    %ebp
+    1c05:	c3                   	ret
+    1c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1c10:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1c12:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1c15:	85 c0                	test   %eax,%eax
+    1c17:	74 2f                	je     1c48 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1c19:	50                   	push   %eax
+    1c1a:	68 80 00 00 00       	push   $0x80
+    1c1f:	6a 01                	push   $0x1
+    1c21:	52                   	push   %edx
+    1c22:	e8 09 04 00 00       	call   2030 <fwrite>
+    1c27:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    1c2a:	89 f1                	mov    %esi,%ecx
+}
+    1c2c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1c31:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1c33:	89 53 08             	mov    %edx,0x8(%ebx)
+    1c36:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    1c3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1c3d:	5b                   	pop    %ebx
+    1c3e:	5e                   	pop    %esi
+    1c3f:	5d                   	pop    %ebp
+    1c40:	c3                   	ret
+    1c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1c48:	83 ec 04             	sub    $0x4,%esp
+    1c4b:	68 80 00 00 00       	push   $0x80
+    1c50:	52                   	push   %edx
+    1c51:	ff 73 04             	push   0x4(%ebx)
+    1c54:	e8 c6 fc ff ff       	call   191f <write>
+    1c59:	83 c4 10             	add    $0x10,%esp
+    1c5c:	eb cc                	jmp    1c2a <putc+0x4a>
+    1c5e:	66 90                	xchg   %ax,%ax
+
+00001c60 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	57                   	push   %edi
+    1c64:	89 c7                	mov    %eax,%edi
+    1c66:	56                   	push   %esi
+    1c67:	31 f6                	xor    %esi,%esi
+    1c69:	53                   	push   %ebx
+    1c6a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1c6d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1c70:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1c73:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1c76:	84 c0                	test   %al,%al
+    1c78:	75 1e                	jne    1c98 <vprintf.constprop.0+0x38>
+    1c7a:	eb 53                	jmp    1ccf <vprintf.constprop.0+0x6f>
+    1c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1c80:	83 f8 25             	cmp    $0x25,%eax
+    1c83:	74 3b                	je     1cc0 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1c85:	89 ca                	mov    %ecx,%edx
+    1c87:	89 f8                	mov    %edi,%eax
+    1c89:	e8 52 ff ff ff       	call   1be0 <putc>
+  for(i = 0; fmt[i]; i++){
+    1c8e:	0f b6 03             	movzbl (%ebx),%eax
+    1c91:	83 c3 01             	add    $0x1,%ebx
+    1c94:	84 c0                	test   %al,%al
+    1c96:	74 37                	je     1ccf <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1c98:	0f be c8             	movsbl %al,%ecx
+    1c9b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    1c9e:	85 f6                	test   %esi,%esi
+    1ca0:	74 de                	je     1c80 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1ca2:	83 fe 25             	cmp    $0x25,%esi
+    1ca5:	75 e7                	jne    1c8e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1ca7:	83 f8 25             	cmp    $0x25,%eax
+    1caa:	74 4e                	je     1cfa <vprintf.constprop.0+0x9a>
+    1cac:	83 e8 63             	sub    $0x63,%eax
+    1caf:	83 f8 15             	cmp    $0x15,%eax
+    1cb2:	77 34                	ja     1ce8 <vprintf.constprop.0+0x88>
+    1cb4:	ff 24 85 cc 28 00 00 	jmp    *0x28cc(,%eax,4)
+    1cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cbf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1cc0:	0f b6 03             	movzbl (%ebx),%eax
+    1cc3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1cc6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    1ccb:	84 c0                	test   %al,%al
+    1ccd:	75 c9                	jne    1c98 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    1ccf:	8b 47 08             	mov    0x8(%edi),%eax
+    1cd2:	85 c0                	test   %eax,%eax
+    1cd4:	0f 8f de 00 00 00    	jg     1db8 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    1cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cdd:	5b                   	pop    %ebx
+    1cde:	5e                   	pop    %esi
+    1cdf:	5f                   	pop    %edi
+    1ce0:	5d                   	pop    %ebp
+    1ce1:	c3                   	ret
+    1ce2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1ce8:	ba 25 00 00 00       	mov    $0x25,%edx
+    1ced:	89 f8                	mov    %edi,%eax
+    1cef:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1cf2:	e8 e9 fe ff ff       	call   1be0 <putc>
+        putc(o, c);
+    1cf7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1cfa:	89 ca                	mov    %ecx,%edx
+    1cfc:	89 f8                	mov    %edi,%eax
+      state = 0;
+    1cfe:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1d00:	e8 db fe ff ff       	call   1be0 <putc>
+    1d05:	eb 87                	jmp    1c8e <vprintf.constprop.0+0x2e>
+    1d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d0e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1d10:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1d13:	83 ec 0c             	sub    $0xc,%esp
+    1d16:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1d1b:	8b 16                	mov    (%esi),%edx
+    1d1d:	6a 00                	push   $0x0
+        ap++;
+    1d1f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1d22:	89 f8                	mov    %edi,%eax
+    1d24:	e8 b7 fd ff ff       	call   1ae0 <printint>
+        ap++;
+    1d29:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    1d2c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1d2f:	31 f6                	xor    %esi,%esi
+    1d31:	e9 58 ff ff ff       	jmp    1c8e <vprintf.constprop.0+0x2e>
+    1d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d3d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1d40:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1d43:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1d45:	83 c0 04             	add    $0x4,%eax
+    1d48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    1d4b:	85 f6                	test   %esi,%esi
+    1d4d:	75 1b                	jne    1d6a <vprintf.constprop.0+0x10a>
+    1d4f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1d54:	be c5 28 00 00       	mov    $0x28c5,%esi
+    1d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1d60:	89 f8                	mov    %edi,%eax
+          s++;
+    1d62:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1d65:	e8 76 fe ff ff       	call   1be0 <putc>
+        while(*s != 0){
+    1d6a:	0f be 16             	movsbl (%esi),%edx
+    1d6d:	84 d2                	test   %dl,%dl
+    1d6f:	75 ef                	jne    1d60 <vprintf.constprop.0+0x100>
+      state = 0;
+    1d71:	31 f6                	xor    %esi,%esi
+    1d73:	e9 16 ff ff ff       	jmp    1c8e <vprintf.constprop.0+0x2e>
+    1d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d7f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1d80:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1d83:	83 ec 0c             	sub    $0xc,%esp
+    1d86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1d8b:	8b 16                	mov    (%esi),%edx
+    1d8d:	6a 01                	push   $0x1
+    1d8f:	eb 8e                	jmp    1d1f <vprintf.constprop.0+0xbf>
+    1d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1d98:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1d9b:	89 f8                	mov    %edi,%eax
+    1d9d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1da0:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1da3:	e8 38 fe ff ff       	call   1be0 <putc>
+        ap++;
+    1da8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    1dab:	31 f6                	xor    %esi,%esi
+    1dad:	e9 dc fe ff ff       	jmp    1c8e <vprintf.constprop.0+0x2e>
+    1db2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1db8:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    1dba:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    1dbd:	85 d2                	test   %edx,%edx
+    1dbf:	74 1f                	je     1de0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1dc1:	52                   	push   %edx
+    1dc2:	50                   	push   %eax
+    1dc3:	6a 01                	push   $0x1
+    1dc5:	51                   	push   %ecx
+    1dc6:	e8 65 02 00 00       	call   2030 <fwrite>
+    1dcb:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1dce:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1dd8:	5b                   	pop    %ebx
+    1dd9:	5e                   	pop    %esi
+    1dda:	5f                   	pop    %edi
+    1ddb:	5d                   	pop    %ebp
+    1ddc:	c3                   	ret
+    1ddd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1de0:	83 ec 04             	sub    $0x4,%esp
+    1de3:	50                   	push   %eax
+    1de4:	51                   	push   %ecx
+    1de5:	ff 77 04             	push   0x4(%edi)
+    1de8:	e8 32 fb ff ff       	call   191f <write>
+    1ded:	83 c4 10             	add    $0x10,%esp
+    1df0:	eb dc                	jmp    1dce <vprintf.constprop.0+0x16e>
+    1df2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001e00 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1e00:	55                   	push   %ebp
+    1e01:	89 e5                	mov    %esp,%ebp
+    1e03:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1e09:	a1 64 30 00 00       	mov    0x3064,%eax
+{
+    1e0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1e11:	83 fa 01             	cmp    $0x1,%edx
+    1e14:	74 0c                	je     1e22 <printf+0x22>
+    1e16:	31 c0                	xor    %eax,%eax
+    1e18:	83 fa 02             	cmp    $0x2,%edx
+    1e1b:	0f 44 05 60 30 00 00 	cmove  0x3060,%eax
+  o.fd = fd;
+    1e22:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1e28:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1e2b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1e2e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1e34:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1e3a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1e41:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1e44:	e8 17 fe ff ff       	call   1c60 <vprintf.constprop.0>
+}
+    1e49:	c9                   	leave
+    1e4a:	c3                   	ret
+    1e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e4f:	90                   	nop
+
+00001e50 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1e50:	55                   	push   %ebp
+    1e51:	89 e5                	mov    %esp,%ebp
+    1e53:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1e59:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1e5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1e5f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1e62:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1e69:	ff ff ff 
+  o.n = 0;
+    1e6c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1e73:	00 00 00 
+  o.f = f;
+    1e76:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1e7c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1e82:	e8 d9 fd ff ff       	call   1c60 <vprintf.constprop.0>
+}
+    1e87:	c9                   	leave
+    1e88:	c3                   	ret
+    1e89:	66 90                	xchg   %ax,%ax
+    1e8b:	66 90                	xchg   %ax,%ax
+    1e8d:	66 90                	xchg   %ax,%ax
+    1e8f:	90                   	nop
+
+00001e90 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1e90:	55                   	push   %ebp
+    1e91:	89 e5                	mov    %esp,%ebp
+    1e93:	53                   	push   %ebx
+    1e94:	89 c3                	mov    %eax,%ebx
+    1e96:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1e99:	8b 40 0c             	mov    0xc(%eax),%eax
+    1e9c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1e9f:	74 17                	je     1eb8 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1ea1:	83 f8 02             	cmp    $0x2,%eax
+    1ea4:	74 07                	je     1ead <setmode+0x1d>
+    1ea6:	8b 43 18             	mov    0x18(%ebx),%eax
+    1ea9:	85 c0                	test   %eax,%eax
+    1eab:	74 38                	je     1ee5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1ead:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1eb0:	c9                   	leave
+    1eb1:	c3                   	ret
+    1eb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1eb8:	83 ec 08             	sub    $0x8,%esp
+    1ebb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1ebe:	50                   	push   %eax
+    1ebf:	ff 33                	push   (%ebx)
+    1ec1:	e8 c2 fa ff ff       	call   1988 <fstat>
+    1ec6:	83 c4 10             	add    $0x10,%esp
+    1ec9:	89 c2                	mov    %eax,%edx
+    1ecb:	31 c0                	xor    %eax,%eax
+    1ecd:	85 d2                	test   %edx,%edx
+    1ecf:	75 0a                	jne    1edb <setmode+0x4b>
+    1ed1:	31 c0                	xor    %eax,%eax
+    1ed3:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1ed8:	0f 94 c0             	sete   %al
+    1edb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1ede:	8b 43 18             	mov    0x18(%ebx),%eax
+    1ee1:	85 c0                	test   %eax,%eax
+    1ee3:	75 c8                	jne    1ead <setmode+0x1d>
+    1ee5:	83 ec 0c             	sub    $0xc,%esp
+    1ee8:	68 00 04 00 00       	push   $0x400
+    1eed:	e8 de 07 00 00       	call   26d0 <malloc>
+    1ef2:	83 c4 10             	add    $0x10,%esp
+    1ef5:	89 43 18             	mov    %eax,0x18(%ebx)
+    1ef8:	85 c0                	test   %eax,%eax
+    1efa:	75 b1                	jne    1ead <setmode+0x1d>
+    f->mode = IONBF;
+    1efc:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1f03:	eb a8                	jmp    1ead <setmode+0x1d>
+    1f05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001f10 <drain>:
+{
+    1f10:	55                   	push   %ebp
+    1f11:	89 e5                	mov    %esp,%ebp
+    1f13:	57                   	push   %edi
+    1f14:	56                   	push   %esi
+    1f15:	53                   	push   %ebx
+    1f16:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1f19:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1f1c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1f1f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1f26:	85 ff                	test   %edi,%edi
+    1f28:	7f 0e                	jg     1f38 <drain+0x28>
+  return 0;
+    1f2a:	31 c0                	xor    %eax,%eax
+}
+    1f2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f2f:	5b                   	pop    %ebx
+    1f30:	5e                   	pop    %esi
+    1f31:	5f                   	pop    %edi
+    1f32:	5d                   	pop    %ebp
+    1f33:	c3                   	ret
+    1f34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1f38:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1f3b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1f3e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1f40:	eb 0e                	jmp    1f50 <drain+0x40>
+    1f42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1f48:	29 c7                	sub    %eax,%edi
+    1f4a:	01 c3                	add    %eax,%ebx
+    1f4c:	85 ff                	test   %edi,%edi
+    1f4e:	7e da                	jle    1f2a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1f50:	83 ec 04             	sub    $0x4,%esp
+    1f53:	57                   	push   %edi
+    1f54:	53                   	push   %ebx
+    1f55:	56                   	push   %esi
+    1f56:	e8 c4 f9 ff ff       	call   191f <write>
+    1f5b:	83 c4 10             	add    $0x10,%esp
+    1f5e:	85 c0                	test   %eax,%eax
+    1f60:	7f e6                	jg     1f48 <drain+0x38>
+    f->err = 1;
+    1f62:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1f65:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1f6c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1f71:	eb b9                	jmp    1f2c <drain+0x1c>
+    1f73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001f80 <flushall>:
+
+static void
+flushall(void)
+{
+    1f80:	55                   	push   %ebp
+    1f81:	89 e5                	mov    %esp,%ebp
+    1f83:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1f84:	bb 80 30 00 00       	mov    $0x3080,%ebx
+{
+    1f89:	83 ec 04             	sub    $0x4,%esp
+    1f8c:	eb 0d                	jmp    1f9b <flushall+0x1b>
+    1f8e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1f90:	83 c3 24             	add    $0x24,%ebx
+    1f93:	81 fb c0 32 00 00    	cmp    $0x32c0,%ebx
+    1f99:	74 19                	je     1fb4 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1f9b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1f9e:	85 c0                	test   %eax,%eax
+    1fa0:	74 ee                	je     1f90 <flushall+0x10>
+    1fa2:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1fa4:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1fa7:	e8 64 ff ff ff       	call   1f10 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1fac:	81 fb c0 32 00 00    	cmp    $0x32c0,%ebx
+    1fb2:	75 e7                	jne    1f9b <flushall+0x1b>
+}
+    1fb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fb7:	c9                   	leave
+    1fb8:	c3                   	ret
+    1fb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001fc0 <fflush>:
+{
+    1fc0:	55                   	push   %ebp
+    1fc1:	89 e5                	mov    %esp,%ebp
+    1fc3:	57                   	push   %edi
+    1fc4:	56                   	push   %esi
+    1fc5:	53                   	push   %ebx
+    1fc6:	83 ec 0c             	sub    $0xc,%esp
+    1fc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1fcc:	85 c0                	test   %eax,%eax
+    1fce:	74 28                	je     1ff8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1fd0:	8b 70 08             	mov    0x8(%eax),%esi
+    1fd3:	85 f6                	test   %esi,%esi
+    1fd5:	75 11                	jne    1fe8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1fd7:	83 c4 0c             	add    $0xc,%esp
+    1fda:	89 f0                	mov    %esi,%eax
+    1fdc:	5b                   	pop    %ebx
+    1fdd:	5e                   	pop    %esi
+    1fde:	5f                   	pop    %edi
+    1fdf:	5d                   	pop    %ebp
+    1fe0:	c3                   	ret
+    1fe1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fe8:	83 c4 0c             	add    $0xc,%esp
+    1feb:	5b                   	pop    %ebx
+    1fec:	5e                   	pop    %esi
+    1fed:	5f                   	pop    %edi
+    1fee:	5d                   	pop    %ebp
+  return drain(f);
+    1fef:	e9 1c ff ff ff       	jmp    1f10 <drain>
+    1ff4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1ff8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1ffa:	bb 80 30 00 00       	mov    $0x3080,%ebx
+        r = -1;
+    1fff:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    2004:	eb 15                	jmp    201b <fflush+0x5b>
+    2006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    200d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    2010:	83 c3 24             	add    $0x24,%ebx
+    2013:	81 fb c0 32 00 00    	cmp    $0x32c0,%ebx
+    2019:	74 bc                	je     1fd7 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    201b:	8b 43 08             	mov    0x8(%ebx),%eax
+    201e:	85 c0                	test   %eax,%eax
+    2020:	74 ee                	je     2010 <fflush+0x50>
+    2022:	89 d8                	mov    %ebx,%eax
+    2024:	e8 e7 fe ff ff       	call   1f10 <drain>
+        r = -1;
+    2029:	85 c0                	test   %eax,%eax
+    202b:	0f 48 f7             	cmovs  %edi,%esi
+    202e:	eb e0                	jmp    2010 <fflush+0x50>
+
+00002030 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    2030:	55                   	push   %ebp
+    2031:	89 e5                	mov    %esp,%ebp
+    2033:	57                   	push   %edi
+    2034:	56                   	push   %esi
+    2035:	53                   	push   %ebx
+    2036:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    2039:	8b 55 0c             	mov    0xc(%ebp),%edx
+    203c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    2040:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    2043:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    2046:	85 d2                	test   %edx,%edx
+    2048:	0f 8e 26 01 00 00    	jle    2174 <fwrite+0x144>
+  if(!f->writable){
+    204e:	8b 46 08             	mov    0x8(%esi),%eax
+    2051:	85 c0                	test   %eax,%eax
+    2053:	0f 84 14 01 00 00    	je     216d <fwrite+0x13d>
+  setmode(f);
+    2059:	89 f0                	mov    %esi,%eax
+    205b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    205e:	e8 2d fe ff ff       	call   1e90 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    2063:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    2067:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    206a:	c7 05 d0 43 00 00 80 	movl   $0x1f80,0x43d0
+    2071:	1f 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    2074:	0f 84 b6 00 00 00    	je     2130 <fwrite+0x100>
+    207a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    2080:	0f 8f aa 00 00 00    	jg     2130 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    2086:	8b 46 20             	mov    0x20(%esi),%eax
+    2089:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    208c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    208e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    2093:	74 6c                	je     2101 <fwrite+0xd1>
+    2095:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    2098:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    209b:	ba 00 04 00 00       	mov    $0x400,%edx
+    20a0:	29 c2                	sub    %eax,%edx
+    20a2:	39 ca                	cmp    %ecx,%edx
+    20a4:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    20a7:	85 d2                	test   %edx,%edx
+    20a9:	0f 8e d1 00 00 00    	jle    2180 <fwrite+0x150>
+    20af:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    20b2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    20b5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    20b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20bf:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    20c0:	8d 50 01             	lea    0x1(%eax),%edx
+    20c3:	83 c3 01             	add    $0x1,%ebx
+    20c6:	8b 4e 18             	mov    0x18(%esi),%ecx
+    20c9:	89 56 20             	mov    %edx,0x20(%esi)
+    20cc:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    20d0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    20d3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    20d6:	b8 01 00 00 00       	mov    $0x1,%eax
+    20db:	80 fa 0a             	cmp    $0xa,%dl
+    20de:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    20e1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    20e4:	39 cb                	cmp    %ecx,%ebx
+    20e6:	75 d8                	jne    20c0 <fwrite+0x90>
+    20e8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    20eb:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    20ee:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    20f1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    20f4:	85 db                	test   %ebx,%ebx
+    20f6:	7e 19                	jle    2111 <fwrite+0xe1>
+    n -= k;
+    20f8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    20fa:	3d 00 04 00 00       	cmp    $0x400,%eax
+    20ff:	75 97                	jne    2098 <fwrite+0x68>
+    2101:	89 f0                	mov    %esi,%eax
+    2103:	e8 08 fe ff ff       	call   1f10 <drain>
+    2108:	85 c0                	test   %eax,%eax
+    210a:	78 68                	js     2174 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    210c:	8b 46 20             	mov    0x20(%esi),%eax
+    210f:	eb 87                	jmp    2098 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    2111:	3d 00 04 00 00       	cmp    $0x400,%eax
+    2116:	74 74                	je     218c <fwrite+0x15c>
+    2118:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    211c:	75 04                	jne    2122 <fwrite+0xf2>
+    211e:	85 ff                	test   %edi,%edi
+    2120:	75 6a                	jne    218c <fwrite+0x15c>
+    return nmemb;
+    2122:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    2125:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2128:	5b                   	pop    %ebx
+    2129:	5e                   	pop    %esi
+    212a:	5f                   	pop    %edi
+    212b:	5d                   	pop    %ebp
+    212c:	c3                   	ret
+    212d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    2130:	89 f0                	mov    %esi,%eax
+    2132:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    2135:	e8 d6 fd ff ff       	call   1f10 <drain>
+    213a:	85 c0                	test   %eax,%eax
+    213c:	78 2f                	js     216d <fwrite+0x13d>
+    213e:	89 75 14             	mov    %esi,0x14(%ebp)
+    2141:	8b 3e                	mov    (%esi),%edi
+    2143:	89 de                	mov    %ebx,%esi
+    2145:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    2148:	eb 0e                	jmp    2158 <fwrite+0x128>
+    214a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    2150:	29 c3                	sub    %eax,%ebx
+    2152:	01 c6                	add    %eax,%esi
+    2154:	85 db                	test   %ebx,%ebx
+    2156:	7e ca                	jle    2122 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    2158:	83 ec 04             	sub    $0x4,%esp
+    215b:	53                   	push   %ebx
+    215c:	56                   	push   %esi
+    215d:	57                   	push   %edi
+    215e:	e8 bc f7 ff ff       	call   191f <write>
+    2163:	83 c4 10             	add    $0x10,%esp
+    2166:	85 c0                	test   %eax,%eax
+    2168:	7f e6                	jg     2150 <fwrite+0x120>
+    216a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    216d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    2174:	31 c0                	xor    %eax,%eax
+}
+    2176:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2179:	5b                   	pop    %ebx
+    217a:	5e                   	pop    %esi
+    217b:	5f                   	pop    %edi
+    217c:	5d                   	pop    %ebp
+    217d:	c3                   	ret
+    217e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    2180:	89 d9                	mov    %ebx,%ecx
+    2182:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    2185:	89 cb                	mov    %ecx,%ebx
+    2187:	e9 6e ff ff ff       	jmp    20fa <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    218c:	89 f0                	mov    %esi,%eax
+    218e:	e8 7d fd ff ff       	call   1f10 <drain>
+    2193:	85 c0                	test   %eax,%eax
+    2195:	79 8b                	jns    2122 <fwrite+0xf2>
+    return 0;
+    2197:	31 c0                	xor    %eax,%eax
+    2199:	eb db                	jmp    2176 <fwrite+0x146>
+    219b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    219f:	90                   	nop
+
+000021a0 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    21a0:	55                   	push   %ebp
+    21a1:	89 e5                	mov    %esp,%ebp
+    21a3:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    21a6:	8b 45 08             	mov    0x8(%ebp),%eax
+    21a9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    21ac:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    21af:	ff 75 0c             	push   0xc(%ebp)
+    21b2:	6a 01                	push   $0x1
+    21b4:	6a 01                	push   $0x1
+    21b6:	50                   	push   %eax
+    21b7:	e8 74 fe ff ff       	call   2030 <fwrite>
+    21bc:	83 c4 10             	add    $0x10,%esp
+    21bf:	83 f8 01             	cmp    $0x1,%eax
+    21c2:	75 0c                	jne    21d0 <fputc+0x30>
+    21c4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    21c8:	c9                   	leave
+    21c9:	c3                   	ret
+    21ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    21d0:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    21d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    21d6:	c3                   	ret
+    21d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21de:	66 90                	xchg   %ax,%ax
+
+000021e0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    21e0:	55                   	push   %ebp
+    21e1:	89 e5                	mov    %esp,%ebp
+    21e3:	57                   	push   %edi
+    21e4:	56                   	push   %esi
+    21e5:	53                   	push   %ebx
+    21e6:	83 ec 1c             	sub    $0x1c,%esp
+    21e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    21ec:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    21ef:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    21f2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    21f5:	85 d2                	test   %edx,%edx
+    21f7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    21fa:	7e 12                	jle    220e <fread+0x2e>
+    21fc:	85 ff                	test   %edi,%edi
+    21fe:	7e 0e                	jle    220e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    2200:	8b 43 04             	mov    0x4(%ebx),%eax
+    2203:	85 c0                	test   %eax,%eax
+    2205:	75 19                	jne    2220 <fread+0x40>
+    f->err = 1;
+    2207:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    220e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    2211:	31 c0                	xor    %eax,%eax
+}
+    2213:	5b                   	pop    %ebx
+    2214:	5e                   	pop    %esi
+    2215:	5f                   	pop    %edi
+    2216:	5d                   	pop    %ebp
+    2217:	c3                   	ret
+    2218:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    221f:	90                   	nop
+  setmode(f);
+    2220:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    2222:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    2224:	e8 67 fc ff ff       	call   1e90 <setmode>
+  for(n = 0; n < want; n += k){
+    2229:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    222c:	89 f7                	mov    %esi,%edi
+    222e:	eb 31                	jmp    2261 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    2230:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    2234:	74 08                	je     223e <fread+0x5e>
+    2236:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    223c:	7e 62                	jle    22a0 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    223e:	83 ec 04             	sub    $0x4,%esp
+    2241:	56                   	push   %esi
+    2242:	8b 45 08             	mov    0x8(%ebp),%eax
+    2245:	01 f8                	add    %edi,%eax
+    2247:	50                   	push   %eax
+    2248:	ff 33                	push   (%ebx)
+    224a:	e8 c1 f6 ff ff       	call   1910 <read>
+    224f:	83 c4 10             	add    $0x10,%esp
+    2252:	85 c0                	test   %eax,%eax
+    2254:	0f 8e ce 00 00 00    	jle    2328 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    225a:	01 c7                	add    %eax,%edi
+    225c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    225f:	7e 36                	jle    2297 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2261:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    2264:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    2267:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    226a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    226c:	39 c1                	cmp    %eax,%ecx
+    226e:	7d c0                	jge    2230 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2270:	29 c8                	sub    %ecx,%eax
+    2272:	39 f0                	cmp    %esi,%eax
+    2274:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    2277:	83 ec 04             	sub    $0x4,%esp
+    227a:	56                   	push   %esi
+    227b:	03 4b 18             	add    0x18(%ebx),%ecx
+    227e:	51                   	push   %ecx
+    227f:	8b 45 08             	mov    0x8(%ebp),%eax
+    2282:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    2284:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    2286:	50                   	push   %eax
+    2287:	e8 34 f5 ff ff       	call   17c0 <memmove>
+      f->r += k;
+    228c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    228f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    2292:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    2295:	7f ca                	jg     2261 <fread+0x81>
+    2297:	89 fe                	mov    %edi,%esi
+    2299:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    229c:	eb 3f                	jmp    22dd <fread+0xfd>
+    229e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    22a0:	3b 1d 68 30 00 00    	cmp    0x3068,%ebx
+    22a6:	74 68                	je     2310 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    22a8:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    22ab:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    22b2:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    22b9:	68 00 04 00 00       	push   $0x400
+    22be:	ff 73 18             	push   0x18(%ebx)
+    22c1:	ff 33                	push   (%ebx)
+    22c3:	e8 48 f6 ff ff       	call   1910 <read>
+    22c8:	83 c4 10             	add    $0x10,%esp
+    22cb:	85 c0                	test   %eax,%eax
+    22cd:	78 21                	js     22f0 <fread+0x110>
+  else if(n == 0)
+    22cf:	75 2f                	jne    2300 <fread+0x120>
+    f->eof = 1;
+    22d1:	89 fe                	mov    %edi,%esi
+    22d3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    22d6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    22dd:	89 f0                	mov    %esi,%eax
+}
+    22df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    22e2:	99                   	cltd
+}
+    22e3:	5b                   	pop    %ebx
+    22e4:	5e                   	pop    %esi
+  return n / size;
+    22e5:	f7 ff                	idiv   %edi
+}
+    22e7:	5f                   	pop    %edi
+    22e8:	5d                   	pop    %ebp
+    22e9:	c3                   	ret
+    22ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    22f0:	89 fe                	mov    %edi,%esi
+    22f2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    22f5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    22fc:	eb df                	jmp    22dd <fread+0xfd>
+    22fe:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    2300:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    2303:	e9 54 ff ff ff       	jmp    225c <fread+0x7c>
+    2308:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    230f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    2310:	83 ec 0c             	sub    $0xc,%esp
+    2313:	ff 35 64 30 00 00    	push   0x3064
+    2319:	e8 a2 fc ff ff       	call   1fc0 <fflush>
+    231e:	83 c4 10             	add    $0x10,%esp
+    2321:	eb 85                	jmp    22a8 <fread+0xc8>
+    2323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2327:	90                   	nop
+        if(k < 0)
+    2328:	89 fe                	mov    %edi,%esi
+    232a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    232d:	74 a7                	je     22d6 <fread+0xf6>
+    232f:	eb c4                	jmp    22f5 <fread+0x115>
+    2331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    233f:	90                   	nop
+
+00002340 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    2340:	55                   	push   %ebp
+    2341:	89 e5                	mov    %esp,%ebp
+    2343:	53                   	push   %ebx
+    2344:	83 ec 14             	sub    $0x14,%esp
+    2347:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    234a:	8b 50 04             	mov    0x4(%eax),%edx
+    234d:	85 d2                	test   %edx,%edx
+    234f:	74 08                	je     2359 <fgetc+0x19>
+    2351:	8b 50 1c             	mov    0x1c(%eax),%edx
+    2354:	3b 50 20             	cmp    0x20(%eax),%edx
+    2357:	7c 27                	jl     2380 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2359:	50                   	push   %eax
+    235a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    235d:	6a 01                	push   $0x1
+    235f:	6a 01                	push   $0x1
+    2361:	50                   	push   %eax
+    2362:	e8 79 fe ff ff       	call   21e0 <fread>
+    2367:	83 c4 10             	add    $0x10,%esp
+    236a:	83 f8 01             	cmp    $0x1,%eax
+    236d:	75 29                	jne    2398 <fgetc+0x58>
+    236f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2373:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2376:	c9                   	leave
+    2377:	c3                   	ret
+    2378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    237f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    2380:	8b 48 18             	mov    0x18(%eax),%ecx
+    2383:	8d 5a 01             	lea    0x1(%edx),%ebx
+    2386:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    2389:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    238c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    2390:	c9                   	leave
+    2391:	c3                   	ret
+    2392:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2398:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    239d:	eb d4                	jmp    2373 <fgetc+0x33>
+    239f:	90                   	nop
+
+000023a0 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    23a0:	55                   	push   %ebp
+    23a1:	89 e5                	mov    %esp,%ebp
+    23a3:	57                   	push   %edi
+    23a4:	56                   	push   %esi
+    23a5:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    23a6:	31 db                	xor    %ebx,%ebx
+{
+    23a8:	83 ec 1c             	sub    $0x1c,%esp
+    23ab:	8b 75 10             	mov    0x10(%ebp),%esi
+    23ae:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    23b0:	eb 2e                	jmp    23e0 <fgets+0x40>
+    23b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    23b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    23bb:	57                   	push   %edi
+    23bc:	6a 01                	push   $0x1
+    23be:	6a 01                	push   $0x1
+    23c0:	50                   	push   %eax
+    23c1:	e8 1a fe ff ff       	call   21e0 <fread>
+    23c6:	83 c4 10             	add    $0x10,%esp
+    23c9:	83 f8 01             	cmp    $0x1,%eax
+    23cc:	75 62                	jne    2430 <fgets+0x90>
+    23ce:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    23d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    23d5:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    23d7:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    23db:	83 f9 0a             	cmp    $0xa,%ecx
+    23de:	74 34                	je     2414 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    23e0:	89 de                	mov    %ebx,%esi
+    23e2:	83 c3 01             	add    $0x1,%ebx
+    23e5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    23e8:	7d 46                	jge    2430 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    23ea:	8b 47 04             	mov    0x4(%edi),%eax
+    23ed:	85 c0                	test   %eax,%eax
+    23ef:	74 c7                	je     23b8 <fgets+0x18>
+    23f1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    23f4:	3b 47 20             	cmp    0x20(%edi),%eax
+    23f7:	7d bf                	jge    23b8 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    23f9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    23fc:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    23ff:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    2402:	89 77 1c             	mov    %esi,0x1c(%edi)
+    2405:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    2409:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    240b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    240f:	83 f9 0a             	cmp    $0xa,%ecx
+    2412:	75 cc                	jne    23e0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2414:	8b 45 08             	mov    0x8(%ebp),%eax
+    2417:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    241b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    241e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2421:	5b                   	pop    %ebx
+    2422:	5e                   	pop    %esi
+    2423:	5f                   	pop    %edi
+    2424:	5d                   	pop    %ebp
+    2425:	c3                   	ret
+    2426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    242d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2430:	8b 45 08             	mov    0x8(%ebp),%eax
+    2433:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2437:	31 c0                	xor    %eax,%eax
+    2439:	85 f6                	test   %esi,%esi
+    243b:	74 e1                	je     241e <fgets+0x7e>
+    243d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2440:	eb dc                	jmp    241e <fgets+0x7e>
+    2442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002450 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    2450:	55                   	push   %ebp
+    2451:	89 e5                	mov    %esp,%ebp
+    2453:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2454:	bb 80 30 00 00       	mov    $0x3080,%ebx
+{
+    2459:	83 ec 04             	sub    $0x4,%esp
+    245c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    2460:	8b 53 04             	mov    0x4(%ebx),%edx
+    2463:	85 d2                	test   %edx,%edx
+    2465:	75 07                	jne    246e <fdopen+0x1e>
+    2467:	8b 43 08             	mov    0x8(%ebx),%eax
+    246a:	85 c0                	test   %eax,%eax
+    246c:	74 1a                	je     2488 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    246e:	83 c3 24             	add    $0x24,%ebx
+    2471:	81 fb c0 32 00 00    	cmp    $0x32c0,%ebx
+    2477:	75 e7                	jne    2460 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2479:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    247b:	89 d8                	mov    %ebx,%eax
+    247d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2480:	c9                   	leave
+    2481:	c3                   	ret
+    2482:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2488:	81 fb c0 32 00 00    	cmp    $0x32c0,%ebx
+    248e:	74 e9                	je     2479 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2490:	83 ec 04             	sub    $0x4,%esp
+    2493:	6a 24                	push   $0x24
+    2495:	6a 00                	push   $0x0
+    2497:	53                   	push   %ebx
+    2498:	e8 d3 f1 ff ff       	call   1670 <memset>
+  f->fd = fd;
+    249d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    24a0:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    24a7:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    24aa:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    24ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+    24af:	80 38 72             	cmpb   $0x72,(%eax)
+    24b2:	74 14                	je     24c8 <fdopen+0x78>
+    f->writable = 1;
+    24b4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    24bb:	89 d8                	mov    %ebx,%eax
+    24bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    24c0:	c9                   	leave
+    24c1:	c3                   	ret
+    24c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    24c8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    24cf:	89 d8                	mov    %ebx,%eax
+    24d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    24d4:	c9                   	leave
+    24d5:	c3                   	ret
+    24d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000024e0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    24e0:	55                   	push   %ebp
+    24e1:	89 e5                	mov    %esp,%ebp
+    24e3:	56                   	push   %esi
+    24e4:	53                   	push   %ebx
+    24e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    24e8:	0f b6 06             	movzbl (%esi),%eax
+    24eb:	3c 72                	cmp    $0x72,%al
+    24ed:	74 61                	je     2550 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    24ef:	3c 77                	cmp    $0x77,%al
+    24f1:	74 7d                	je     2570 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    24f3:	3c 61                	cmp    $0x61,%al
+    24f5:	75 49                	jne    2540 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    24f7:	83 ec 08             	sub    $0x8,%esp
+    24fa:	68 01 02 00 00       	push   $0x201
+    24ff:	ff 75 08             	push   0x8(%ebp)
+    2502:	e8 54 f4 ff ff       	call   195b <open>
+    2507:	83 c4 10             	add    $0x10,%esp
+    250a:	89 c3                	mov    %eax,%ebx
+    250c:	85 c0                	test   %eax,%eax
+    250e:	78 30                	js     2540 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2510:	83 ec 04             	sub    $0x4,%esp
+    2513:	6a 02                	push   $0x2
+    2515:	6a 00                	push   $0x0
+    2517:	50                   	push   %eax
+    2518:	e8 4c f5 ff ff       	call   1a69 <lseek>
+    251d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2520:	83 ec 08             	sub    $0x8,%esp
+    2523:	56                   	push   %esi
+    2524:	53                   	push   %ebx
+    2525:	e8 26 ff ff ff       	call   2450 <fdopen>
+    252a:	83 c4 10             	add    $0x10,%esp
+    252d:	85 c0                	test   %eax,%eax
+    252f:	75 11                	jne    2542 <fopen+0x62>
+    close(fd);
+    2531:	83 ec 0c             	sub    $0xc,%esp
+    2534:	53                   	push   %ebx
+    2535:	e8 f4 f3 ff ff       	call   192e <close>
+    253a:	83 c4 10             	add    $0x10,%esp
+    253d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2540:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2542:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2545:	5b                   	pop    %ebx
+    2546:	5e                   	pop    %esi
+    2547:	5d                   	pop    %ebp
+    2548:	c3                   	ret
+    2549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2550:	83 ec 08             	sub    $0x8,%esp
+    2553:	6a 00                	push   $0x0
+    2555:	ff 75 08             	push   0x8(%ebp)
+    2558:	e8 fe f3 ff ff       	call   195b <open>
+    255d:	83 c4 10             	add    $0x10,%esp
+    2560:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2562:	85 db                	test   %ebx,%ebx
+    2564:	78 da                	js     2540 <fopen+0x60>
+    2566:	eb b8                	jmp    2520 <fopen+0x40>
+    2568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    256f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2570:	83 ec 08             	sub    $0x8,%esp
+    2573:	68 01 06 00 00       	push   $0x601
+    2578:	ff 75 08             	push   0x8(%ebp)
+    257b:	e8 db f3 ff ff       	call   195b <open>
+    2580:	83 c4 10             	add    $0x10,%esp
+    2583:	89 c3                	mov    %eax,%ebx
+    2585:	eb db                	jmp    2562 <fopen+0x82>
+    2587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    258e:	66 90                	xchg   %ax,%ax
+
+00002590 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2590:	55                   	push   %ebp
+    2591:	89 e5                	mov    %esp,%ebp
+    2593:	56                   	push   %esi
+    2594:	53                   	push   %ebx
+    2595:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2598:	83 ec 0c             	sub    $0xc,%esp
+    259b:	53                   	push   %ebx
+    259c:	e8 1f fa ff ff       	call   1fc0 <fflush>
+    25a1:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    25a3:	58                   	pop    %eax
+    25a4:	ff 33                	push   (%ebx)
+    25a6:	e8 83 f3 ff ff       	call   192e <close>
+    25ab:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    25ae:	85 c0                	test   %eax,%eax
+    25b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    25b5:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    25b8:	8b 43 18             	mov    0x18(%ebx),%eax
+    25bb:	85 c0                	test   %eax,%eax
+    25bd:	0f 95 c1             	setne  %cl
+    25c0:	3d e0 47 00 00       	cmp    $0x47e0,%eax
+    25c5:	0f 95 c2             	setne  %dl
+    25c8:	84 d1                	test   %dl,%cl
+    25ca:	74 07                	je     25d3 <fclose+0x43>
+    25cc:	3d e0 43 00 00       	cmp    $0x43e0,%eax
+    25d1:	75 25                	jne    25f8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    25d3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    25da:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    25dc:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    25e3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    25ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    25ed:	5b                   	pop    %ebx
+    25ee:	5e                   	pop    %esi
+    25ef:	5d                   	pop    %ebp
+    25f0:	c3                   	ret
+    25f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    25f8:	83 ec 0c             	sub    $0xc,%esp
+    25fb:	50                   	push   %eax
+    25fc:	e8 3f 00 00 00       	call   2640 <free>
+    2601:	83 c4 10             	add    $0x10,%esp
+    2604:	eb cd                	jmp    25d3 <fclose+0x43>
+    2606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    260d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002610 <feof>:
+
+int
+feof(FILE *f)
+{
+    2610:	55                   	push   %ebp
+    2611:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2613:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2616:	5d                   	pop    %ebp
+  return f->eof;
+    2617:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    261a:	c3                   	ret
+    261b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    261f:	90                   	nop
+
+00002620 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2620:	55                   	push   %ebp
+    2621:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2623:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2626:	5d                   	pop    %ebp
+  return f->err;
+    2627:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    262a:	c3                   	ret
+    262b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    262f:	90                   	nop
+
+00002630 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2630:	55                   	push   %ebp
+    2631:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2633:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2636:	5d                   	pop    %ebp
+  return f->fd;
+    2637:	8b 00                	mov    (%eax),%eax
+}
+    2639:	c3                   	ret
+    263a:	66 90                	xchg   %ax,%ax
+    263c:	66 90                	xchg   %ax,%ax
+    263e:	66 90                	xchg   %ax,%ax
+
+00002640 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2640:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2641:	a1 e0 4b 00 00       	mov    0x4be0,%eax
+{
+    2646:	89 e5                	mov    %esp,%ebp
+    2648:	57                   	push   %edi
+    2649:	56                   	push   %esi
+    264a:	53                   	push   %ebx
+    264b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    264e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2658:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    265a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    265c:	39 ca                	cmp    %ecx,%edx
+    265e:	73 30                	jae    2690 <free+0x50>
+    2660:	39 c1                	cmp    %eax,%ecx
+    2662:	72 04                	jb     2668 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2664:	39 c2                	cmp    %eax,%edx
+    2666:	72 f0                	jb     2658 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2668:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    266b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    266e:	39 f8                	cmp    %edi,%eax
+    2670:	74 2e                	je     26a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2672:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2675:	8b 42 04             	mov    0x4(%edx),%eax
+    2678:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    267b:	39 f1                	cmp    %esi,%ecx
+    267d:	74 38                	je     26b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    267f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2681:	5b                   	pop    %ebx
+  freep = p;
+    2682:	89 15 e0 4b 00 00    	mov    %edx,0x4be0
+}
+    2688:	5e                   	pop    %esi
+    2689:	5f                   	pop    %edi
+    268a:	5d                   	pop    %ebp
+    268b:	c3                   	ret
+    268c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2690:	39 c1                	cmp    %eax,%ecx
+    2692:	72 d0                	jb     2664 <free+0x24>
+    2694:	eb c2                	jmp    2658 <free+0x18>
+    2696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    269d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    26a0:	03 70 04             	add    0x4(%eax),%esi
+    26a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    26a6:	8b 02                	mov    (%edx),%eax
+    26a8:	8b 00                	mov    (%eax),%eax
+    26aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    26ad:	8b 42 04             	mov    0x4(%edx),%eax
+    26b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    26b3:	39 f1                	cmp    %esi,%ecx
+    26b5:	75 c8                	jne    267f <free+0x3f>
+    p->s.size += bp->s.size;
+    26b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    26ba:	89 15 e0 4b 00 00    	mov    %edx,0x4be0
+    p->s.size += bp->s.size;
+    26c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    26c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    26c6:	89 0a                	mov    %ecx,(%edx)
+}
+    26c8:	5b                   	pop    %ebx
+    26c9:	5e                   	pop    %esi
+    26ca:	5f                   	pop    %edi
+    26cb:	5d                   	pop    %ebp
+    26cc:	c3                   	ret
+    26cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000026d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    26d0:	55                   	push   %ebp
+    26d1:	89 e5                	mov    %esp,%ebp
+    26d3:	57                   	push   %edi
+    26d4:	56                   	push   %esi
+    26d5:	53                   	push   %ebx
+    26d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    26d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    26dc:	8b 15 e0 4b 00 00    	mov    0x4be0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    26e2:	8d 78 07             	lea    0x7(%eax),%edi
+    26e5:	c1 ef 03             	shr    $0x3,%edi
+    26e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    26eb:	85 d2                	test   %edx,%edx
+    26ed:	0f 84 8d 00 00 00    	je     2780 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    26f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    26f5:	8b 48 04             	mov    0x4(%eax),%ecx
+    26f8:	39 f9                	cmp    %edi,%ecx
+    26fa:	73 64                	jae    2760 <malloc+0x90>
+  if(nu < 4096)
+    26fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2701:	39 df                	cmp    %ebx,%edi
+    2703:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2706:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    270d:	eb 0a                	jmp    2719 <malloc+0x49>
+    270f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2710:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2712:	8b 48 04             	mov    0x4(%eax),%ecx
+    2715:	39 f9                	cmp    %edi,%ecx
+    2717:	73 47                	jae    2760 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2719:	89 c2                	mov    %eax,%edx
+    271b:	39 05 e0 4b 00 00    	cmp    %eax,0x4be0
+    2721:	75 ed                	jne    2710 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2723:	83 ec 0c             	sub    $0xc,%esp
+    2726:	56                   	push   %esi
+    2727:	e8 b6 f2 ff ff       	call   19e2 <sbrk>
+  if(p == (char*)-1)
+    272c:	83 c4 10             	add    $0x10,%esp
+    272f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2732:	74 1c                	je     2750 <malloc+0x80>
+  hp->s.size = nu;
+    2734:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2737:	83 ec 0c             	sub    $0xc,%esp
+    273a:	83 c0 08             	add    $0x8,%eax
+    273d:	50                   	push   %eax
+    273e:	e8 fd fe ff ff       	call   2640 <free>
+  return freep;
+    2743:	8b 15 e0 4b 00 00    	mov    0x4be0,%edx
+      if((p = morecore(nunits)) == 0)
+    2749:	83 c4 10             	add    $0x10,%esp
+    274c:	85 d2                	test   %edx,%edx
+    274e:	75 c0                	jne    2710 <malloc+0x40>
+        return 0;
+  }
+}
+    2750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2753:	31 c0                	xor    %eax,%eax
+}
+    2755:	5b                   	pop    %ebx
+    2756:	5e                   	pop    %esi
+    2757:	5f                   	pop    %edi
+    2758:	5d                   	pop    %ebp
+    2759:	c3                   	ret
+    275a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2760:	39 cf                	cmp    %ecx,%edi
+    2762:	74 4c                	je     27b0 <malloc+0xe0>
+        p->s.size -= nunits;
+    2764:	29 f9                	sub    %edi,%ecx
+    2766:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2769:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    276c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    276f:	89 15 e0 4b 00 00    	mov    %edx,0x4be0
+}
+    2775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2778:	83 c0 08             	add    $0x8,%eax
+}
+    277b:	5b                   	pop    %ebx
+    277c:	5e                   	pop    %esi
+    277d:	5f                   	pop    %edi
+    277e:	5d                   	pop    %ebp
+    277f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2780:	c7 05 e0 4b 00 00 e4 	movl   $0x4be4,0x4be0
+    2787:	4b 00 00 
+    base.s.size = 0;
+    278a:	b8 e4 4b 00 00       	mov    $0x4be4,%eax
+    base.s.ptr = freep = prevp = &base;
+    278f:	c7 05 e4 4b 00 00 e4 	movl   $0x4be4,0x4be4
+    2796:	4b 00 00 
+    base.s.size = 0;
+    2799:	c7 05 e8 4b 00 00 00 	movl   $0x0,0x4be8
+    27a0:	00 00 00 
+    if(p->s.size >= nunits){
+    27a3:	e9 54 ff ff ff       	jmp    26fc <malloc+0x2c>
+    27a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    27b0:	8b 08                	mov    (%eax),%ecx
+    27b2:	89 0a                	mov    %ecx,(%edx)
+    27b4:	eb b9                	jmp    276f <malloc+0x9f>
@@ -0,0 +1,147 @@
+// Submission ring benchmark.
+//   ringbench [n]
+// Carries out n (default 100000) fstat()s, n 16-byte read()s,
+// and n/10 open()/close() pairs, first as plain system calls
+// and then through a submission ring, RINGSIZE at a time
+// (NOPEN at a time for opens), printing the time each took.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "ring.h"
+
+#define CHUNK 16
+#define NOPEN 8   // opens per batch, well within NOFILE
+
+struct ring ring;
+char buf[RINGSIZE][CHUNK];
+struct stat st[RINGSIZE];
+int fds[RINGSIZE];
+
+// Print the time taken for n ops since start.
+void
+report(char *what, int n, int start)
+{
+  int t;
+
+  t = uptime() - start;
+  printf(1, "%s: %d ops in %d ticks", what, n, t);
+  if(t > 0)
+    printf(1, ", %d ops/s", n*100/t);
+  printf(1, "\n");
+}
+
+void
+fail(char *what)
+{
+  printf(2, "ringbench: %s failed\n", what);
+  exit();
+}
+
+// Queue a request; user is its index in the batch.
+void
+submit(int op, int fd, void *buf, int n, int user)
+{
+  struct sqe *e;
+
+  e = &ring.sq[ring.sqtail % RINGSIZE];
+  e->op = op;
+  e->fd = fd;
+  e->buf = buf;
+  e->n = n;
+  e->user = user;
+  ring.sqtail++;
+}
+
+// Have the kernel carry out everything queued, and check
+// that each result is at least min.  Saves the results of
+// opens in fds[].
+void
+flush(int min)
+{
+  struct cqe *c;
+
+  while(ring.sqhead != ring.sqtail){
+    if(ringenter(RINGSIZE) < 0)
+      fail("ringenter");
+    for(; ring.cqhead != ring.cqtail; ring.cqhead++){
+      c = &ring.cq[ring.cqhead % RINGSIZE];
+      if(c->res < min)
+        fail("ring request");
+      fds[c->user] = c->res;
+    }
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, i, j, fd, start;
+
+  n = argc > 1 ? atoi(argv[1]) : 100000;
+  if(n < RINGSIZE){
+    printf(2, "usage: ringbench [n], n at least %d\n", RINGSIZE);
+    exit();
+  }
+  n -= n % RINGSIZE;
+  if(ringsetup(&ring) < 0)
+    fail("ringsetup");
+
+  // A file to read from, CHUNK bytes per op.
+  if((fd = open("ringbench.tmp", O_CREATE|O_RDWR)) < 0)
+    fail("create ringbench.tmp");
+  for(i = 0; i < n; i += RINGSIZE)
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+      fail("write ringbench.tmp");
+
+  start = uptime();
+  for(i = 0; i < n; i++)
+    if(fstat(fd, &st[0]) < 0)
+      fail("fstat");
+  report("fstat syscalls", n, start);
+  start = uptime();
+  for(i = 0; i < n; i += RINGSIZE){
+    for(j = 0; j < RINGSIZE; j++)
+      submit(RING_FSTAT, fd, &st[j], 0, j);
+    flush(0);
+  }
+  report("fstat ring", n, start);
+
+  lseek(fd, 0, SEEK_SET);
+  start = uptime();
+  for(i = 0; i < n; i++)
+    if(read(fd, buf[0], CHUNK) != CHUNK)
+      fail("read");
+  report("read syscalls", n, start);
+  lseek(fd, 0, SEEK_SET);
+  start = uptime();
+  for(i = 0; i < n; i += RINGSIZE){
+    for(j = 0; j < RINGSIZE; j++)
+      submit(RING_READ, fd, buf[j], CHUNK, j);
+    flush(CHUNK);
+  }
+  report("read ring", n, start);
+  close(fd);
+
+  start = uptime();
+  for(i = 0; i < n/10; i++){
+    if((fd = open("ringbench.tmp", O_RDONLY)) < 0)
+      fail("open");
+    close(fd);
+  }
+  report("open/close syscalls", n/10*2, start);
+  start = uptime();
+  for(i = 0; i < n/10; i += NOPEN){
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+      submit(RING_OPEN, 0, "ringbench.tmp", O_RDONLY, j);
+    flush(0);
+    for(j = 0; j < NOPEN && i + j < n/10; j++)
+      submit(RING_CLOSE, fds[j], 0, 0, j);
+    flush(0);
+  }
+  report("open/close ring", n/10*2, start);
+
+  unlink("ringbench.tmp");
+  exit();
+}
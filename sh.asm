@@ -0,0 +1,4222 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	51                   	push   %ecx
+    100e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+    1011:	eb 0e                	jmp    1021 <main+0x21>
+    1013:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1017:	90                   	nop
+    if(fd >= 3){
+    1018:	83 f8 02             	cmp    $0x2,%eax
+    101b:	0f 8f 96 00 00 00    	jg     10b7 <main+0xb7>
+  while((fd = open("console", O_RDWR)) >= 0){
+    1021:	83 ec 08             	sub    $0x8,%esp
+    1024:	6a 02                	push   $0x2
+    1026:	68 79 2e 00 00       	push   $0x2e79
+    102b:	e8 4b 0f 00 00       	call   1f7b <open>
+    1030:	83 c4 10             	add    $0x10,%esp
+    1033:	85 c0                	test   %eax,%eax
+    1035:	79 e1                	jns    1018 <main+0x18>
+    1037:	eb 2e                	jmp    1067 <main+0x67>
+    1039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+    1040:	80 3d 62 3b 00 00 20 	cmpb   $0x20,0x3b62
+    1047:	0f 84 8d 00 00 00    	je     10da <main+0xda>
+    104d:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+    1050:	e8 2b 0e 00 00       	call   1e80 <fork>
+  if(pid == -1)
+    1055:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1058:	0f 84 c1 00 00 00    	je     111f <main+0x11f>
+    if(fork1() == 0)
+    105e:	85 c0                	test   %eax,%eax
+    1060:	74 63                	je     10c5 <main+0xc5>
+    wait();
+    1062:	e8 ab 0e 00 00       	call   1f12 <wait>
+  printf(2, "$ ");
+    1067:	83 ec 08             	sub    $0x8,%esp
+    106a:	68 d8 2d 00 00       	push   $0x2dd8
+    106f:	6a 02                	push   $0x2
+    1071:	e8 aa 13 00 00       	call   2420 <printf>
+  memset(buf, 0, nbuf);
+    1076:	83 c4 0c             	add    $0xc,%esp
+    1079:	6a 64                	push   $0x64
+    107b:	6a 00                	push   $0x0
+    107d:	68 60 3b 00 00       	push   $0x3b60
+    1082:	e8 09 0c 00 00       	call   1c90 <memset>
+  gets(buf, nbuf);
+    1087:	58                   	pop    %eax
+    1088:	5a                   	pop    %edx
+    1089:	6a 64                	push   $0x64
+    108b:	68 60 3b 00 00       	push   $0x3b60
+    1090:	e8 5b 0c 00 00       	call   1cf0 <gets>
+  if(buf[0] == 0) // EOF
+    1095:	0f b6 05 60 3b 00 00 	movzbl 0x3b60,%eax
+    109c:	83 c4 10             	add    $0x10,%esp
+    109f:	84 c0                	test   %al,%al
+    10a1:	74 0f                	je     10b2 <main+0xb2>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+    10a3:	3c 63                	cmp    $0x63,%al
+    10a5:	75 a9                	jne    1050 <main+0x50>
+    10a7:	80 3d 61 3b 00 00 64 	cmpb   $0x64,0x3b61
+    10ae:	75 a0                	jne    1050 <main+0x50>
+    10b0:	eb 8e                	jmp    1040 <main+0x40>
+  exit();
+    10b2:	e8 f9 0d 00 00       	call   1eb0 <exit>
+      close(fd);
+    10b7:	83 ec 0c             	sub    $0xc,%esp
+    10ba:	50                   	push   %eax
+    10bb:	e8 8e 0e 00 00       	call   1f4e <close>
+      break;
+    10c0:	83 c4 10             	add    $0x10,%esp
+    10c3:	eb a2                	jmp    1067 <main+0x67>
+      runcmd(parsecmd(buf));
+    10c5:	83 ec 0c             	sub    $0xc,%esp
+    10c8:	68 60 3b 00 00       	push   $0x3b60
+    10cd:	e8 8e 0a 00 00       	call   1b60 <parsecmd>
+    10d2:	89 04 24             	mov    %eax,(%esp)
+    10d5:	e8 d6 00 00 00       	call   11b0 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+    10da:	83 ec 0c             	sub    $0xc,%esp
+    10dd:	68 60 3b 00 00       	push   $0x3b60
+    10e2:	e8 79 0b 00 00       	call   1c60 <strlen>
+      if(chdir(buf+3) < 0)
+    10e7:	c7 04 24 63 3b 00 00 	movl   $0x3b63,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+    10ee:	c6 80 5f 3b 00 00 00 	movb   $0x0,0x3b5f(%eax)
+      if(chdir(buf+3) < 0)
+    10f5:	e8 db 0e 00 00       	call   1fd5 <chdir>
+    10fa:	83 c4 10             	add    $0x10,%esp
+    10fd:	85 c0                	test   %eax,%eax
+    10ff:	0f 89 62 ff ff ff    	jns    1067 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+    1105:	51                   	push   %ecx
+    1106:	68 63 3b 00 00       	push   $0x3b63
+    110b:	68 81 2e 00 00       	push   $0x2e81
+    1110:	6a 02                	push   $0x2
+    1112:	e8 09 13 00 00       	call   2420 <printf>
+    1117:	83 c4 10             	add    $0x10,%esp
+    111a:	e9 48 ff ff ff       	jmp    1067 <main+0x67>
+    panic("fork");
+    111f:	83 ec 0c             	sub    $0xc,%esp
+    1122:	68 db 2d 00 00       	push   $0x2ddb
+    1127:	e8 44 00 00 00       	call   1170 <panic>
+    112c:	66 90                	xchg   %ax,%ax
+    112e:	66 90                	xchg   %ax,%ax
+
+00001130 <getcmd>:
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	56                   	push   %esi
+    1134:	53                   	push   %ebx
+    1135:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1138:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+    113b:	83 ec 08             	sub    $0x8,%esp
+    113e:	68 d8 2d 00 00       	push   $0x2dd8
+    1143:	6a 02                	push   $0x2
+    1145:	e8 d6 12 00 00       	call   2420 <printf>
+  memset(buf, 0, nbuf);
+    114a:	83 c4 0c             	add    $0xc,%esp
+    114d:	56                   	push   %esi
+    114e:	6a 00                	push   $0x0
+    1150:	53                   	push   %ebx
+    1151:	e8 3a 0b 00 00       	call   1c90 <memset>
+  gets(buf, nbuf);
+    1156:	58                   	pop    %eax
+    1157:	5a                   	pop    %edx
+    1158:	56                   	push   %esi
+    1159:	53                   	push   %ebx
+    115a:	e8 91 0b 00 00       	call   1cf0 <gets>
+  if(buf[0] == 0) // EOF
+    115f:	83 c4 10             	add    $0x10,%esp
+    1162:	80 3b 01             	cmpb   $0x1,(%ebx)
+    1165:	19 c0                	sbb    %eax,%eax
+}
+    1167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    116a:	5b                   	pop    %ebx
+    116b:	5e                   	pop    %esi
+    116c:	5d                   	pop    %ebp
+    116d:	c3                   	ret
+    116e:	66 90                	xchg   %ax,%ax
+
+00001170 <panic>:
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+    1176:	ff 75 08             	push   0x8(%ebp)
+    1179:	68 75 2e 00 00       	push   $0x2e75
+    117e:	6a 02                	push   $0x2
+    1180:	e8 9b 12 00 00       	call   2420 <printf>
+  exit();
+    1185:	e8 26 0d 00 00       	call   1eb0 <exit>
+    118a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001190 <fork1>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+    1196:	e8 e5 0c 00 00       	call   1e80 <fork>
+  if(pid == -1)
+    119b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    119e:	74 02                	je     11a2 <fork1+0x12>
+  return pid;
+}
+    11a0:	c9                   	leave
+    11a1:	c3                   	ret
+    panic("fork");
+    11a2:	83 ec 0c             	sub    $0xc,%esp
+    11a5:	68 db 2d 00 00       	push   $0x2ddb
+    11aa:	e8 c1 ff ff ff       	call   1170 <panic>
+    11af:	90                   	nop
+
+000011b0 <runcmd>:
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	53                   	push   %ebx
+    11b4:	83 ec 14             	sub    $0x14,%esp
+    11b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+    11ba:	85 db                	test   %ebx,%ebx
+    11bc:	74 42                	je     1200 <runcmd+0x50>
+  switch(cmd->type){
+    11be:	83 3b 05             	cmpl   $0x5,(%ebx)
+    11c1:	0f 87 e3 00 00 00    	ja     12aa <runcmd+0xfa>
+    11c7:	8b 03                	mov    (%ebx),%eax
+    11c9:	ff 24 85 90 2e 00 00 	jmp    *0x2e90(,%eax,4)
+    if(ecmd->argv[0] == 0)
+    11d0:	8b 43 04             	mov    0x4(%ebx),%eax
+    11d3:	85 c0                	test   %eax,%eax
+    11d5:	74 29                	je     1200 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+    11d7:	8d 53 04             	lea    0x4(%ebx),%edx
+    11da:	51                   	push   %ecx
+    11db:	51                   	push   %ecx
+    11dc:	52                   	push   %edx
+    11dd:	50                   	push   %eax
+    11de:	e8 ed 0c 00 00       	call   1ed0 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+    11e3:	83 c4 0c             	add    $0xc,%esp
+    11e6:	ff 73 04             	push   0x4(%ebx)
+    11e9:	68 e7 2d 00 00       	push   $0x2de7
+    11ee:	6a 02                	push   $0x2
+    11f0:	e8 2b 12 00 00       	call   2420 <printf>
+    break;
+    11f5:	83 c4 10             	add    $0x10,%esp
+    11f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ff:	90                   	nop
+    exit();
+    1200:	e8 ab 0c 00 00       	call   1eb0 <exit>
+    if(fork1() == 0)
+    1205:	e8 86 ff ff ff       	call   1190 <fork1>
+    120a:	85 c0                	test   %eax,%eax
+    120c:	75 f2                	jne    1200 <runcmd+0x50>
+    120e:	e9 8c 00 00 00       	jmp    129f <runcmd+0xef>
+    if(pipe(p) < 0)
+    1213:	83 ec 0c             	sub    $0xc,%esp
+    1216:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1219:	50                   	push   %eax
+    121a:	e8 02 0d 00 00       	call   1f21 <pipe>
+    121f:	83 c4 10             	add    $0x10,%esp
+    1222:	85 c0                	test   %eax,%eax
+    1224:	0f 88 a2 00 00 00    	js     12cc <runcmd+0x11c>
+    if(fork1() == 0){
+    122a:	e8 61 ff ff ff       	call   1190 <fork1>
+    122f:	85 c0                	test   %eax,%eax
+    1231:	0f 84 a2 00 00 00    	je     12d9 <runcmd+0x129>
+    if(fork1() == 0){
+    1237:	e8 54 ff ff ff       	call   1190 <fork1>
+    123c:	85 c0                	test   %eax,%eax
+    123e:	0f 84 c3 00 00 00    	je     1307 <runcmd+0x157>
+    close(p[0]);
+    1244:	83 ec 0c             	sub    $0xc,%esp
+    1247:	ff 75 f0             	push   -0x10(%ebp)
+    124a:	e8 ff 0c 00 00       	call   1f4e <close>
+    close(p[1]);
+    124f:	58                   	pop    %eax
+    1250:	ff 75 f4             	push   -0xc(%ebp)
+    1253:	e8 f6 0c 00 00       	call   1f4e <close>
+    wait();
+    1258:	e8 b5 0c 00 00       	call   1f12 <wait>
+    wait();
+    125d:	e8 b0 0c 00 00       	call   1f12 <wait>
+    break;
+    1262:	83 c4 10             	add    $0x10,%esp
+    1265:	eb 99                	jmp    1200 <runcmd+0x50>
+    if(fork1() == 0)
+    1267:	e8 24 ff ff ff       	call   1190 <fork1>
+    126c:	85 c0                	test   %eax,%eax
+    126e:	74 2f                	je     129f <runcmd+0xef>
+    wait();
+    1270:	e8 9d 0c 00 00       	call   1f12 <wait>
+    runcmd(lcmd->right);
+    1275:	83 ec 0c             	sub    $0xc,%esp
+    1278:	ff 73 08             	push   0x8(%ebx)
+    127b:	e8 30 ff ff ff       	call   11b0 <runcmd>
+    close(rcmd->fd);
+    1280:	83 ec 0c             	sub    $0xc,%esp
+    1283:	ff 73 14             	push   0x14(%ebx)
+    1286:	e8 c3 0c 00 00       	call   1f4e <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+    128b:	58                   	pop    %eax
+    128c:	5a                   	pop    %edx
+    128d:	ff 73 10             	push   0x10(%ebx)
+    1290:	ff 73 08             	push   0x8(%ebx)
+    1293:	e8 e3 0c 00 00       	call   1f7b <open>
+    1298:	83 c4 10             	add    $0x10,%esp
+    129b:	85 c0                	test   %eax,%eax
+    129d:	78 18                	js     12b7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+    129f:	83 ec 0c             	sub    $0xc,%esp
+    12a2:	ff 73 04             	push   0x4(%ebx)
+    12a5:	e8 06 ff ff ff       	call   11b0 <runcmd>
+    panic("runcmd");
+    12aa:	83 ec 0c             	sub    $0xc,%esp
+    12ad:	68 e0 2d 00 00       	push   $0x2de0
+    12b2:	e8 b9 fe ff ff       	call   1170 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+    12b7:	51                   	push   %ecx
+    12b8:	ff 73 08             	push   0x8(%ebx)
+    12bb:	68 f7 2d 00 00       	push   $0x2df7
+    12c0:	6a 02                	push   $0x2
+    12c2:	e8 59 11 00 00       	call   2420 <printf>
+      exit();
+    12c7:	e8 e4 0b 00 00       	call   1eb0 <exit>
+      panic("pipe");
+    12cc:	83 ec 0c             	sub    $0xc,%esp
+    12cf:	68 07 2e 00 00       	push   $0x2e07
+    12d4:	e8 97 fe ff ff       	call   1170 <panic>
+      close(1);
+    12d9:	83 ec 0c             	sub    $0xc,%esp
+    12dc:	6a 01                	push   $0x1
+    12de:	e8 6b 0c 00 00       	call   1f4e <close>
+      dup(p[1]);
+    12e3:	58                   	pop    %eax
+    12e4:	ff 75 f4             	push   -0xc(%ebp)
+    12e7:	e8 f8 0c 00 00       	call   1fe4 <dup>
+      close(p[0]);
+    12ec:	58                   	pop    %eax
+    12ed:	ff 75 f0             	push   -0x10(%ebp)
+    12f0:	e8 59 0c 00 00       	call   1f4e <close>
+      close(p[1]);
+    12f5:	58                   	pop    %eax
+    12f6:	ff 75 f4             	push   -0xc(%ebp)
+    12f9:	e8 50 0c 00 00       	call   1f4e <close>
+      runcmd(pcmd->left);
+    12fe:	5a                   	pop    %edx
+    12ff:	ff 73 04             	push   0x4(%ebx)
+    1302:	e8 a9 fe ff ff       	call   11b0 <runcmd>
+      close(0);
+    1307:	83 ec 0c             	sub    $0xc,%esp
+    130a:	6a 00                	push   $0x0
+    130c:	e8 3d 0c 00 00       	call   1f4e <close>
+      dup(p[0]);
+    1311:	5a                   	pop    %edx
+    1312:	ff 75 f0             	push   -0x10(%ebp)
+    1315:	e8 ca 0c 00 00       	call   1fe4 <dup>
+      close(p[0]);
+    131a:	59                   	pop    %ecx
+    131b:	ff 75 f0             	push   -0x10(%ebp)
+    131e:	e8 2b 0c 00 00       	call   1f4e <close>
+      close(p[1]);
+    1323:	58                   	pop    %eax
+    1324:	ff 75 f4             	push   -0xc(%ebp)
+    1327:	e8 22 0c 00 00       	call   1f4e <close>
+      runcmd(pcmd->right);
+    132c:	58                   	pop    %eax
+    132d:	ff 73 08             	push   0x8(%ebx)
+    1330:	e8 7b fe ff ff       	call   11b0 <runcmd>
+    1335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001340 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	53                   	push   %ebx
+    1344:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    1347:	6a 54                	push   $0x54
+    1349:	e8 a2 19 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    134e:	83 c4 0c             	add    $0xc,%esp
+    1351:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+    1353:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    1355:	6a 00                	push   $0x0
+    1357:	50                   	push   %eax
+    1358:	e8 33 09 00 00       	call   1c90 <memset>
+  cmd->type = EXEC;
+    135d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+    1363:	89 d8                	mov    %ebx,%eax
+    1365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1368:	c9                   	leave
+    1369:	c3                   	ret
+    136a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001370 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	53                   	push   %ebx
+    1374:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    1377:	6a 18                	push   $0x18
+    1379:	e8 72 19 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    137e:	83 c4 0c             	add    $0xc,%esp
+    1381:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+    1383:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    1385:	6a 00                	push   $0x0
+    1387:	50                   	push   %eax
+    1388:	e8 03 09 00 00       	call   1c90 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+    138d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+    1390:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+    1396:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+    1399:	8b 45 0c             	mov    0xc(%ebp),%eax
+    139c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+    139f:	8b 45 10             	mov    0x10(%ebp),%eax
+    13a2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+    13a5:	8b 45 14             	mov    0x14(%ebp),%eax
+    13a8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+    13ab:	8b 45 18             	mov    0x18(%ebp),%eax
+    13ae:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+    13b1:	89 d8                	mov    %ebx,%eax
+    13b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13b6:	c9                   	leave
+    13b7:	c3                   	ret
+    13b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13bf:	90                   	nop
+
+000013c0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	53                   	push   %ebx
+    13c4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    13c7:	6a 0c                	push   $0xc
+    13c9:	e8 22 19 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    13ce:	83 c4 0c             	add    $0xc,%esp
+    13d1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    13d3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    13d5:	6a 00                	push   $0x0
+    13d7:	50                   	push   %eax
+    13d8:	e8 b3 08 00 00       	call   1c90 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+    13dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+    13e0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+    13e6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+    13e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    13ec:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+    13ef:	89 d8                	mov    %ebx,%eax
+    13f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13f4:	c9                   	leave
+    13f5:	c3                   	ret
+    13f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001400 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+    1400:	55                   	push   %ebp
+    1401:	89 e5                	mov    %esp,%ebp
+    1403:	53                   	push   %ebx
+    1404:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    1407:	6a 0c                	push   $0xc
+    1409:	e8 e2 18 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    140e:	83 c4 0c             	add    $0xc,%esp
+    1411:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    1413:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    1415:	6a 00                	push   $0x0
+    1417:	50                   	push   %eax
+    1418:	e8 73 08 00 00       	call   1c90 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+    141d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+    1420:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+    1426:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+    1429:	8b 45 0c             	mov    0xc(%ebp),%eax
+    142c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+    142f:	89 d8                	mov    %ebx,%eax
+    1431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1434:	c9                   	leave
+    1435:	c3                   	ret
+    1436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001440 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	53                   	push   %ebx
+    1444:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    1447:	6a 08                	push   $0x8
+    1449:	e8 a2 18 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    144e:	83 c4 0c             	add    $0xc,%esp
+    1451:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+    1453:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+    1455:	6a 00                	push   $0x0
+    1457:	50                   	push   %eax
+    1458:	e8 33 08 00 00       	call   1c90 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+    145d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+    1460:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+    1466:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+    1469:	89 d8                	mov    %ebx,%eax
+    146b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    146e:	c9                   	leave
+    146f:	c3                   	ret
+
+00001470 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+    1470:	55                   	push   %ebp
+    1471:	89 e5                	mov    %esp,%ebp
+    1473:	57                   	push   %edi
+    1474:	56                   	push   %esi
+    1475:	53                   	push   %ebx
+    1476:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+    1479:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+    147c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    147f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+    1482:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+    1484:	39 df                	cmp    %ebx,%edi
+    1486:	72 0f                	jb     1497 <gettoken+0x27>
+    1488:	eb 25                	jmp    14af <gettoken+0x3f>
+    148a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+    1490:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+    1493:	39 fb                	cmp    %edi,%ebx
+    1495:	74 18                	je     14af <gettoken+0x3f>
+    1497:	0f be 07             	movsbl (%edi),%eax
+    149a:	83 ec 08             	sub    $0x8,%esp
+    149d:	50                   	push   %eax
+    149e:	68 e8 38 00 00       	push   $0x38e8
+    14a3:	e8 08 08 00 00       	call   1cb0 <strchr>
+    14a8:	83 c4 10             	add    $0x10,%esp
+    14ab:	85 c0                	test   %eax,%eax
+    14ad:	75 e1                	jne    1490 <gettoken+0x20>
+  if(q)
+    14af:	85 f6                	test   %esi,%esi
+    14b1:	74 02                	je     14b5 <gettoken+0x45>
+    *q = s;
+    14b3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+    14b5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+    14b8:	3c 3c                	cmp    $0x3c,%al
+    14ba:	0f 8f d0 00 00 00    	jg     1590 <gettoken+0x120>
+    14c0:	3c 3a                	cmp    $0x3a,%al
+    14c2:	0f 8f bc 00 00 00    	jg     1584 <gettoken+0x114>
+    14c8:	84 c0                	test   %al,%al
+    14ca:	75 44                	jne    1510 <gettoken+0xa0>
+    14cc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+    14ce:	8b 4d 14             	mov    0x14(%ebp),%ecx
+    14d1:	85 c9                	test   %ecx,%ecx
+    14d3:	74 05                	je     14da <gettoken+0x6a>
+    *eq = s;
+    14d5:	8b 45 14             	mov    0x14(%ebp),%eax
+    14d8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+    14da:	39 df                	cmp    %ebx,%edi
+    14dc:	72 09                	jb     14e7 <gettoken+0x77>
+    14de:	eb 1f                	jmp    14ff <gettoken+0x8f>
+    s++;
+    14e0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+    14e3:	39 fb                	cmp    %edi,%ebx
+    14e5:	74 18                	je     14ff <gettoken+0x8f>
+    14e7:	0f be 07             	movsbl (%edi),%eax
+    14ea:	83 ec 08             	sub    $0x8,%esp
+    14ed:	50                   	push   %eax
+    14ee:	68 e8 38 00 00       	push   $0x38e8
+    14f3:	e8 b8 07 00 00       	call   1cb0 <strchr>
+    14f8:	83 c4 10             	add    $0x10,%esp
+    14fb:	85 c0                	test   %eax,%eax
+    14fd:	75 e1                	jne    14e0 <gettoken+0x70>
+  *ps = s;
+    14ff:	8b 45 08             	mov    0x8(%ebp),%eax
+    1502:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+    1504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1507:	89 f0                	mov    %esi,%eax
+    1509:	5b                   	pop    %ebx
+    150a:	5e                   	pop    %esi
+    150b:	5f                   	pop    %edi
+    150c:	5d                   	pop    %ebp
+    150d:	c3                   	ret
+    150e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+    1510:	79 66                	jns    1578 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+    1512:	39 df                	cmp    %ebx,%edi
+    1514:	72 39                	jb     154f <gettoken+0xdf>
+  if(eq)
+    1516:	8b 55 14             	mov    0x14(%ebp),%edx
+    1519:	85 d2                	test   %edx,%edx
+    151b:	0f 84 b3 00 00 00    	je     15d4 <gettoken+0x164>
+    *eq = s;
+    1521:	8b 45 14             	mov    0x14(%ebp),%eax
+    1524:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+    1526:	e9 a9 00 00 00       	jmp    15d4 <gettoken+0x164>
+    152b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    152f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+    1530:	0f be 07             	movsbl (%edi),%eax
+    1533:	83 ec 08             	sub    $0x8,%esp
+    1536:	50                   	push   %eax
+    1537:	68 e0 38 00 00       	push   $0x38e0
+    153c:	e8 6f 07 00 00       	call   1cb0 <strchr>
+    1541:	83 c4 10             	add    $0x10,%esp
+    1544:	85 c0                	test   %eax,%eax
+    1546:	75 1f                	jne    1567 <gettoken+0xf7>
+      s++;
+    1548:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+    154b:	39 fb                	cmp    %edi,%ebx
+    154d:	74 77                	je     15c6 <gettoken+0x156>
+    154f:	0f be 07             	movsbl (%edi),%eax
+    1552:	83 ec 08             	sub    $0x8,%esp
+    1555:	50                   	push   %eax
+    1556:	68 e8 38 00 00       	push   $0x38e8
+    155b:	e8 50 07 00 00       	call   1cb0 <strchr>
+    1560:	83 c4 10             	add    $0x10,%esp
+    1563:	85 c0                	test   %eax,%eax
+    1565:	74 c9                	je     1530 <gettoken+0xc0>
+    ret = 'a';
+    1567:	be 61 00 00 00       	mov    $0x61,%esi
+    156c:	e9 5d ff ff ff       	jmp    14ce <gettoken+0x5e>
+    1571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+    1578:	3c 26                	cmp    $0x26,%al
+    157a:	74 08                	je     1584 <gettoken+0x114>
+    157c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+    157f:	80 f9 01             	cmp    $0x1,%cl
+    1582:	77 8e                	ja     1512 <gettoken+0xa2>
+  ret = *s;
+    1584:	0f be f0             	movsbl %al,%esi
+    s++;
+    1587:	83 c7 01             	add    $0x1,%edi
+    break;
+    158a:	e9 3f ff ff ff       	jmp    14ce <gettoken+0x5e>
+    158f:	90                   	nop
+  switch(*s){
+    1590:	3c 3e                	cmp    $0x3e,%al
+    1592:	75 1c                	jne    15b0 <gettoken+0x140>
+    if(*s == '>'){
+    1594:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+    1598:	74 1f                	je     15b9 <gettoken+0x149>
+    s++;
+    159a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+    159d:	be 3e 00 00 00       	mov    $0x3e,%esi
+    15a2:	e9 27 ff ff ff       	jmp    14ce <gettoken+0x5e>
+    15a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ae:	66 90                	xchg   %ax,%ax
+  switch(*s){
+    15b0:	3c 7c                	cmp    $0x7c,%al
+    15b2:	74 d0                	je     1584 <gettoken+0x114>
+    15b4:	e9 59 ff ff ff       	jmp    1512 <gettoken+0xa2>
+      s++;
+    15b9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+    15bc:	be 2b 00 00 00       	mov    $0x2b,%esi
+    15c1:	e9 08 ff ff ff       	jmp    14ce <gettoken+0x5e>
+  if(eq)
+    15c6:	8b 45 14             	mov    0x14(%ebp),%eax
+    15c9:	85 c0                	test   %eax,%eax
+    15cb:	74 05                	je     15d2 <gettoken+0x162>
+    *eq = s;
+    15cd:	8b 45 14             	mov    0x14(%ebp),%eax
+    15d0:	89 18                	mov    %ebx,(%eax)
+      s++;
+    15d2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+    15d4:	be 61 00 00 00       	mov    $0x61,%esi
+    15d9:	e9 21 ff ff ff       	jmp    14ff <gettoken+0x8f>
+    15de:	66 90                	xchg   %ax,%ax
+
+000015e0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+    15e0:	55                   	push   %ebp
+    15e1:	89 e5                	mov    %esp,%ebp
+    15e3:	57                   	push   %edi
+    15e4:	56                   	push   %esi
+    15e5:	53                   	push   %ebx
+    15e6:	83 ec 0c             	sub    $0xc,%esp
+    15e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+    15ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+    15ef:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+    15f1:	39 f3                	cmp    %esi,%ebx
+    15f3:	72 12                	jb     1607 <peek+0x27>
+    15f5:	eb 28                	jmp    161f <peek+0x3f>
+    15f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15fe:	66 90                	xchg   %ax,%ax
+    s++;
+    1600:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+    1603:	39 de                	cmp    %ebx,%esi
+    1605:	74 18                	je     161f <peek+0x3f>
+    1607:	0f be 03             	movsbl (%ebx),%eax
+    160a:	83 ec 08             	sub    $0x8,%esp
+    160d:	50                   	push   %eax
+    160e:	68 e8 38 00 00       	push   $0x38e8
+    1613:	e8 98 06 00 00       	call   1cb0 <strchr>
+    1618:	83 c4 10             	add    $0x10,%esp
+    161b:	85 c0                	test   %eax,%eax
+    161d:	75 e1                	jne    1600 <peek+0x20>
+  *ps = s;
+    161f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+    1621:	0f be 03             	movsbl (%ebx),%eax
+    1624:	31 d2                	xor    %edx,%edx
+    1626:	84 c0                	test   %al,%al
+    1628:	75 0e                	jne    1638 <peek+0x58>
+}
+    162a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    162d:	89 d0                	mov    %edx,%eax
+    162f:	5b                   	pop    %ebx
+    1630:	5e                   	pop    %esi
+    1631:	5f                   	pop    %edi
+    1632:	5d                   	pop    %ebp
+    1633:	c3                   	ret
+    1634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+    1638:	83 ec 08             	sub    $0x8,%esp
+    163b:	50                   	push   %eax
+    163c:	ff 75 10             	push   0x10(%ebp)
+    163f:	e8 6c 06 00 00       	call   1cb0 <strchr>
+    1644:	83 c4 10             	add    $0x10,%esp
+    1647:	31 d2                	xor    %edx,%edx
+    1649:	85 c0                	test   %eax,%eax
+    164b:	0f 95 c2             	setne  %dl
+}
+    164e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1651:	5b                   	pop    %ebx
+    1652:	89 d0                	mov    %edx,%eax
+    1654:	5e                   	pop    %esi
+    1655:	5f                   	pop    %edi
+    1656:	5d                   	pop    %ebp
+    1657:	c3                   	ret
+    1658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    165f:	90                   	nop
+
+00001660 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	57                   	push   %edi
+    1664:	56                   	push   %esi
+    1665:	53                   	push   %ebx
+    1666:	83 ec 2c             	sub    $0x2c,%esp
+    1669:	8b 75 0c             	mov    0xc(%ebp),%esi
+    166c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+    166f:	90                   	nop
+    1670:	83 ec 04             	sub    $0x4,%esp
+    1673:	68 29 2e 00 00       	push   $0x2e29
+    1678:	53                   	push   %ebx
+    1679:	56                   	push   %esi
+    167a:	e8 61 ff ff ff       	call   15e0 <peek>
+    167f:	83 c4 10             	add    $0x10,%esp
+    1682:	85 c0                	test   %eax,%eax
+    1684:	0f 84 f6 00 00 00    	je     1780 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+    168a:	6a 00                	push   $0x0
+    168c:	6a 00                	push   $0x0
+    168e:	53                   	push   %ebx
+    168f:	56                   	push   %esi
+    1690:	e8 db fd ff ff       	call   1470 <gettoken>
+    1695:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+    1697:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    169a:	50                   	push   %eax
+    169b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    169e:	50                   	push   %eax
+    169f:	53                   	push   %ebx
+    16a0:	56                   	push   %esi
+    16a1:	e8 ca fd ff ff       	call   1470 <gettoken>
+    16a6:	83 c4 20             	add    $0x20,%esp
+    16a9:	83 f8 61             	cmp    $0x61,%eax
+    16ac:	0f 85 d9 00 00 00    	jne    178b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+    16b2:	83 ff 3c             	cmp    $0x3c,%edi
+    16b5:	74 69                	je     1720 <parseredirs+0xc0>
+    16b7:	83 ff 3e             	cmp    $0x3e,%edi
+    16ba:	74 05                	je     16c1 <parseredirs+0x61>
+    16bc:	83 ff 2b             	cmp    $0x2b,%edi
+    16bf:	75 af                	jne    1670 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+    16c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    16c4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+    16c7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+    16ca:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    16cd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+    16d0:	6a 18                	push   $0x18
+    16d2:	e8 19 16 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    16d7:	83 c4 0c             	add    $0xc,%esp
+    16da:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+    16dc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+    16de:	6a 00                	push   $0x0
+    16e0:	50                   	push   %eax
+    16e1:	e8 aa 05 00 00       	call   1c90 <memset>
+  cmd->type = REDIR;
+    16e6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+    16ec:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+    16ef:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+    16f2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+    16f5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    16f8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+    16fb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+    16fe:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+    1705:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+    1708:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+    170f:	89 7d 08             	mov    %edi,0x8(%ebp)
+    1712:	e9 59 ff ff ff       	jmp    1670 <parseredirs+0x10>
+    1717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+    1720:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1723:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+    1726:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+    1729:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    172c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+    172f:	6a 18                	push   $0x18
+    1731:	e8 ba 15 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1736:	83 c4 0c             	add    $0xc,%esp
+    1739:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+    173b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+    173d:	6a 00                	push   $0x0
+    173f:	50                   	push   %eax
+    1740:	e8 4b 05 00 00       	call   1c90 <memset>
+  cmd->cmd = subcmd;
+    1745:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+    1748:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+    174b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+    174e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+    1751:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+    1757:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+    175a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+    175d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+    1760:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+    1763:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+    176a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+    1771:	e9 fa fe ff ff       	jmp    1670 <parseredirs+0x10>
+    1776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+    1780:	8b 45 08             	mov    0x8(%ebp),%eax
+    1783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1786:	5b                   	pop    %ebx
+    1787:	5e                   	pop    %esi
+    1788:	5f                   	pop    %edi
+    1789:	5d                   	pop    %ebp
+    178a:	c3                   	ret
+      panic("missing file for redirection");
+    178b:	83 ec 0c             	sub    $0xc,%esp
+    178e:	68 0c 2e 00 00       	push   $0x2e0c
+    1793:	e8 d8 f9 ff ff       	call   1170 <panic>
+    1798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    179f:	90                   	nop
+
+000017a0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+    17a0:	55                   	push   %ebp
+    17a1:	89 e5                	mov    %esp,%ebp
+    17a3:	57                   	push   %edi
+    17a4:	56                   	push   %esi
+    17a5:	53                   	push   %ebx
+    17a6:	83 ec 30             	sub    $0x30,%esp
+    17a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    17ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+    17af:	68 2c 2e 00 00       	push   $0x2e2c
+    17b4:	56                   	push   %esi
+    17b5:	53                   	push   %ebx
+    17b6:	e8 25 fe ff ff       	call   15e0 <peek>
+    17bb:	83 c4 10             	add    $0x10,%esp
+    17be:	85 c0                	test   %eax,%eax
+    17c0:	0f 85 aa 00 00 00    	jne    1870 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+    17c6:	83 ec 0c             	sub    $0xc,%esp
+    17c9:	89 c7                	mov    %eax,%edi
+    17cb:	6a 54                	push   $0x54
+    17cd:	e8 1e 15 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    17d2:	83 c4 0c             	add    $0xc,%esp
+    17d5:	6a 54                	push   $0x54
+    17d7:	6a 00                	push   $0x0
+    17d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    17dc:	50                   	push   %eax
+    17dd:	e8 ae 04 00 00       	call   1c90 <memset>
+  cmd->type = EXEC;
+    17e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+    17e5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+    17e8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+    17ee:	56                   	push   %esi
+    17ef:	53                   	push   %ebx
+    17f0:	50                   	push   %eax
+    17f1:	e8 6a fe ff ff       	call   1660 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+    17f6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+    17f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+    17fc:	eb 15                	jmp    1813 <parseexec+0x73>
+    17fe:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+    1800:	83 ec 04             	sub    $0x4,%esp
+    1803:	56                   	push   %esi
+    1804:	53                   	push   %ebx
+    1805:	ff 75 d4             	push   -0x2c(%ebp)
+    1808:	e8 53 fe ff ff       	call   1660 <parseredirs>
+    180d:	83 c4 10             	add    $0x10,%esp
+    1810:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+    1813:	83 ec 04             	sub    $0x4,%esp
+    1816:	68 43 2e 00 00       	push   $0x2e43
+    181b:	56                   	push   %esi
+    181c:	53                   	push   %ebx
+    181d:	e8 be fd ff ff       	call   15e0 <peek>
+    1822:	83 c4 10             	add    $0x10,%esp
+    1825:	85 c0                	test   %eax,%eax
+    1827:	75 5f                	jne    1888 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+    1829:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    182c:	50                   	push   %eax
+    182d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1830:	50                   	push   %eax
+    1831:	56                   	push   %esi
+    1832:	53                   	push   %ebx
+    1833:	e8 38 fc ff ff       	call   1470 <gettoken>
+    1838:	83 c4 10             	add    $0x10,%esp
+    183b:	85 c0                	test   %eax,%eax
+    183d:	74 49                	je     1888 <parseexec+0xe8>
+    if(tok != 'a')
+    183f:	83 f8 61             	cmp    $0x61,%eax
+    1842:	75 62                	jne    18a6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+    1844:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1847:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    184a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+    184e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1851:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+    1855:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+    1858:	83 ff 0a             	cmp    $0xa,%edi
+    185b:	75 a3                	jne    1800 <parseexec+0x60>
+      panic("too many args");
+    185d:	83 ec 0c             	sub    $0xc,%esp
+    1860:	68 35 2e 00 00       	push   $0x2e35
+    1865:	e8 06 f9 ff ff       	call   1170 <panic>
+    186a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+    1870:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1873:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+    1876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1879:	5b                   	pop    %ebx
+    187a:	5e                   	pop    %esi
+    187b:	5f                   	pop    %edi
+    187c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+    187d:	e9 ae 01 00 00       	jmp    1a30 <parseblock>
+    1882:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+    1888:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    188b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+    1892:	00 
+  cmd->eargv[argc] = 0;
+    1893:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+    189a:	00 
+}
+    189b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    189e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18a1:	5b                   	pop    %ebx
+    18a2:	5e                   	pop    %esi
+    18a3:	5f                   	pop    %edi
+    18a4:	5d                   	pop    %ebp
+    18a5:	c3                   	ret
+      panic("syntax");
+    18a6:	83 ec 0c             	sub    $0xc,%esp
+    18a9:	68 2e 2e 00 00       	push   $0x2e2e
+    18ae:	e8 bd f8 ff ff       	call   1170 <panic>
+    18b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000018c0 <parsepipe>:
+{
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	57                   	push   %edi
+    18c4:	56                   	push   %esi
+    18c5:	53                   	push   %ebx
+    18c6:	83 ec 14             	sub    $0x14,%esp
+    18c9:	8b 75 08             	mov    0x8(%ebp),%esi
+    18cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+    18cf:	57                   	push   %edi
+    18d0:	56                   	push   %esi
+    18d1:	e8 ca fe ff ff       	call   17a0 <parseexec>
+  if(peek(ps, es, "|")){
+    18d6:	83 c4 0c             	add    $0xc,%esp
+    18d9:	68 48 2e 00 00       	push   $0x2e48
+  cmd = parseexec(ps, es);
+    18de:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+    18e0:	57                   	push   %edi
+    18e1:	56                   	push   %esi
+    18e2:	e8 f9 fc ff ff       	call   15e0 <peek>
+    18e7:	83 c4 10             	add    $0x10,%esp
+    18ea:	85 c0                	test   %eax,%eax
+    18ec:	75 12                	jne    1900 <parsepipe+0x40>
+}
+    18ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18f1:	89 d8                	mov    %ebx,%eax
+    18f3:	5b                   	pop    %ebx
+    18f4:	5e                   	pop    %esi
+    18f5:	5f                   	pop    %edi
+    18f6:	5d                   	pop    %ebp
+    18f7:	c3                   	ret
+    18f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ff:	90                   	nop
+    gettoken(ps, es, 0, 0);
+    1900:	6a 00                	push   $0x0
+    1902:	6a 00                	push   $0x0
+    1904:	57                   	push   %edi
+    1905:	56                   	push   %esi
+    1906:	e8 65 fb ff ff       	call   1470 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+    190b:	58                   	pop    %eax
+    190c:	5a                   	pop    %edx
+    190d:	57                   	push   %edi
+    190e:	56                   	push   %esi
+    190f:	e8 ac ff ff ff       	call   18c0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+    1914:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+    191b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+    191d:	e8 ce 13 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1922:	83 c4 0c             	add    $0xc,%esp
+    1925:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    1927:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+    1929:	6a 00                	push   $0x0
+    192b:	50                   	push   %eax
+    192c:	e8 5f 03 00 00       	call   1c90 <memset>
+  cmd->left = left;
+    1931:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+    1934:	83 c4 10             	add    $0x10,%esp
+    1937:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+    1939:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+    193f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+    1941:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+    1944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1947:	5b                   	pop    %ebx
+    1948:	5e                   	pop    %esi
+    1949:	5f                   	pop    %edi
+    194a:	5d                   	pop    %ebp
+    194b:	c3                   	ret
+    194c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001950 <parseline>:
+{
+    1950:	55                   	push   %ebp
+    1951:	89 e5                	mov    %esp,%ebp
+    1953:	57                   	push   %edi
+    1954:	56                   	push   %esi
+    1955:	53                   	push   %ebx
+    1956:	83 ec 24             	sub    $0x24,%esp
+    1959:	8b 75 08             	mov    0x8(%ebp),%esi
+    195c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+    195f:	57                   	push   %edi
+    1960:	56                   	push   %esi
+    1961:	e8 5a ff ff ff       	call   18c0 <parsepipe>
+  while(peek(ps, es, "&")){
+    1966:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+    1969:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+    196b:	eb 3b                	jmp    19a8 <parseline+0x58>
+    196d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+    1970:	6a 00                	push   $0x0
+    1972:	6a 00                	push   $0x0
+    1974:	57                   	push   %edi
+    1975:	56                   	push   %esi
+    1976:	e8 f5 fa ff ff       	call   1470 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+    197b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+    1982:	e8 69 13 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1987:	83 c4 0c             	add    $0xc,%esp
+    198a:	6a 08                	push   $0x8
+    198c:	6a 00                	push   $0x0
+    198e:	50                   	push   %eax
+    198f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1992:	e8 f9 02 00 00       	call   1c90 <memset>
+  cmd->type = BACK;
+    1997:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+    199a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+    199d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+    19a3:	89 5a 04             	mov    %ebx,0x4(%edx)
+    19a6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+    19a8:	83 ec 04             	sub    $0x4,%esp
+    19ab:	68 4a 2e 00 00       	push   $0x2e4a
+    19b0:	57                   	push   %edi
+    19b1:	56                   	push   %esi
+    19b2:	e8 29 fc ff ff       	call   15e0 <peek>
+    19b7:	83 c4 10             	add    $0x10,%esp
+    19ba:	85 c0                	test   %eax,%eax
+    19bc:	75 b2                	jne    1970 <parseline+0x20>
+  if(peek(ps, es, ";")){
+    19be:	83 ec 04             	sub    $0x4,%esp
+    19c1:	68 46 2e 00 00       	push   $0x2e46
+    19c6:	57                   	push   %edi
+    19c7:	56                   	push   %esi
+    19c8:	e8 13 fc ff ff       	call   15e0 <peek>
+    19cd:	83 c4 10             	add    $0x10,%esp
+    19d0:	85 c0                	test   %eax,%eax
+    19d2:	75 0c                	jne    19e0 <parseline+0x90>
+}
+    19d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19d7:	89 d8                	mov    %ebx,%eax
+    19d9:	5b                   	pop    %ebx
+    19da:	5e                   	pop    %esi
+    19db:	5f                   	pop    %edi
+    19dc:	5d                   	pop    %ebp
+    19dd:	c3                   	ret
+    19de:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+    19e0:	6a 00                	push   $0x0
+    19e2:	6a 00                	push   $0x0
+    19e4:	57                   	push   %edi
+    19e5:	56                   	push   %esi
+    19e6:	e8 85 fa ff ff       	call   1470 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+    19eb:	58                   	pop    %eax
+    19ec:	5a                   	pop    %edx
+    19ed:	57                   	push   %edi
+    19ee:	56                   	push   %esi
+    19ef:	e8 5c ff ff ff       	call   1950 <parseline>
+  cmd = malloc(sizeof(*cmd));
+    19f4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+    19fb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+    19fd:	e8 ee 12 00 00       	call   2cf0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1a02:	83 c4 0c             	add    $0xc,%esp
+    1a05:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    1a07:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+    1a09:	6a 00                	push   $0x0
+    1a0b:	50                   	push   %eax
+    1a0c:	e8 7f 02 00 00       	call   1c90 <memset>
+  cmd->left = left;
+    1a11:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+    1a14:	83 c4 10             	add    $0x10,%esp
+    1a17:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+    1a19:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+    1a1f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+    1a21:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+    1a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a27:	5b                   	pop    %ebx
+    1a28:	5e                   	pop    %esi
+    1a29:	5f                   	pop    %edi
+    1a2a:	5d                   	pop    %ebp
+    1a2b:	c3                   	ret
+    1a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001a30 <parseblock>:
+{
+    1a30:	55                   	push   %ebp
+    1a31:	89 e5                	mov    %esp,%ebp
+    1a33:	57                   	push   %edi
+    1a34:	56                   	push   %esi
+    1a35:	53                   	push   %ebx
+    1a36:	83 ec 10             	sub    $0x10,%esp
+    1a39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1a3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+    1a3f:	68 2c 2e 00 00       	push   $0x2e2c
+    1a44:	56                   	push   %esi
+    1a45:	53                   	push   %ebx
+    1a46:	e8 95 fb ff ff       	call   15e0 <peek>
+    1a4b:	83 c4 10             	add    $0x10,%esp
+    1a4e:	85 c0                	test   %eax,%eax
+    1a50:	74 4a                	je     1a9c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+    1a52:	6a 00                	push   $0x0
+    1a54:	6a 00                	push   $0x0
+    1a56:	56                   	push   %esi
+    1a57:	53                   	push   %ebx
+    1a58:	e8 13 fa ff ff       	call   1470 <gettoken>
+  cmd = parseline(ps, es);
+    1a5d:	58                   	pop    %eax
+    1a5e:	5a                   	pop    %edx
+    1a5f:	56                   	push   %esi
+    1a60:	53                   	push   %ebx
+    1a61:	e8 ea fe ff ff       	call   1950 <parseline>
+  if(!peek(ps, es, ")"))
+    1a66:	83 c4 0c             	add    $0xc,%esp
+    1a69:	68 68 2e 00 00       	push   $0x2e68
+  cmd = parseline(ps, es);
+    1a6e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+    1a70:	56                   	push   %esi
+    1a71:	53                   	push   %ebx
+    1a72:	e8 69 fb ff ff       	call   15e0 <peek>
+    1a77:	83 c4 10             	add    $0x10,%esp
+    1a7a:	85 c0                	test   %eax,%eax
+    1a7c:	74 2b                	je     1aa9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+    1a7e:	6a 00                	push   $0x0
+    1a80:	6a 00                	push   $0x0
+    1a82:	56                   	push   %esi
+    1a83:	53                   	push   %ebx
+    1a84:	e8 e7 f9 ff ff       	call   1470 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+    1a89:	83 c4 0c             	add    $0xc,%esp
+    1a8c:	56                   	push   %esi
+    1a8d:	53                   	push   %ebx
+    1a8e:	57                   	push   %edi
+    1a8f:	e8 cc fb ff ff       	call   1660 <parseredirs>
+}
+    1a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a97:	5b                   	pop    %ebx
+    1a98:	5e                   	pop    %esi
+    1a99:	5f                   	pop    %edi
+    1a9a:	5d                   	pop    %ebp
+    1a9b:	c3                   	ret
+    panic("parseblock");
+    1a9c:	83 ec 0c             	sub    $0xc,%esp
+    1a9f:	68 4c 2e 00 00       	push   $0x2e4c
+    1aa4:	e8 c7 f6 ff ff       	call   1170 <panic>
+    panic("syntax - missing )");
+    1aa9:	83 ec 0c             	sub    $0xc,%esp
+    1aac:	68 57 2e 00 00       	push   $0x2e57
+    1ab1:	e8 ba f6 ff ff       	call   1170 <panic>
+    1ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001ac0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	89 e5                	mov    %esp,%ebp
+    1ac3:	53                   	push   %ebx
+    1ac4:	83 ec 04             	sub    $0x4,%esp
+    1ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    1aca:	85 db                	test   %ebx,%ebx
+    1acc:	0f 84 7e 00 00 00    	je     1b50 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+    1ad2:	83 3b 05             	cmpl   $0x5,(%ebx)
+    1ad5:	77 20                	ja     1af7 <nulterminate+0x37>
+    1ad7:	8b 03                	mov    (%ebx),%eax
+    1ad9:	ff 24 85 a8 2e 00 00 	jmp    *0x2ea8(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+    1ae0:	83 ec 0c             	sub    $0xc,%esp
+    1ae3:	ff 73 04             	push   0x4(%ebx)
+    1ae6:	e8 d5 ff ff ff       	call   1ac0 <nulterminate>
+    nulterminate(lcmd->right);
+    1aeb:	58                   	pop    %eax
+    1aec:	ff 73 08             	push   0x8(%ebx)
+    1aef:	e8 cc ff ff ff       	call   1ac0 <nulterminate>
+    break;
+    1af4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+    1af7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+    1af9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1afc:	c9                   	leave
+    1afd:	c3                   	ret
+    1afe:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+    1b00:	83 ec 0c             	sub    $0xc,%esp
+    1b03:	ff 73 04             	push   0x4(%ebx)
+    1b06:	e8 b5 ff ff ff       	call   1ac0 <nulterminate>
+    break;
+    1b0b:	83 c4 10             	add    $0x10,%esp
+    1b0e:	eb e7                	jmp    1af7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+    1b10:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    1b13:	8d 43 08             	lea    0x8(%ebx),%eax
+    1b16:	85 c9                	test   %ecx,%ecx
+    1b18:	74 dd                	je     1af7 <nulterminate+0x37>
+    1b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+    1b20:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+    1b23:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+    1b26:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+    1b29:	8b 50 fc             	mov    -0x4(%eax),%edx
+    1b2c:	85 d2                	test   %edx,%edx
+    1b2e:	75 f0                	jne    1b20 <nulterminate+0x60>
+    1b30:	eb c5                	jmp    1af7 <nulterminate+0x37>
+    1b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+    1b38:	83 ec 0c             	sub    $0xc,%esp
+    1b3b:	ff 73 04             	push   0x4(%ebx)
+    1b3e:	e8 7d ff ff ff       	call   1ac0 <nulterminate>
+    *rcmd->efile = 0;
+    1b43:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+    1b46:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+    1b49:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+    1b4c:	eb a9                	jmp    1af7 <nulterminate+0x37>
+    1b4e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1b50:	31 c0                	xor    %eax,%eax
+    1b52:	eb a5                	jmp    1af9 <nulterminate+0x39>
+    1b54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b5f:	90                   	nop
+
+00001b60 <parsecmd>:
+{
+    1b60:	55                   	push   %ebp
+    1b61:	89 e5                	mov    %esp,%ebp
+    1b63:	57                   	push   %edi
+    1b64:	56                   	push   %esi
+  cmd = parseline(&s, es);
+    1b65:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+    1b68:	53                   	push   %ebx
+    1b69:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+    1b6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1b6f:	53                   	push   %ebx
+    1b70:	e8 eb 00 00 00       	call   1c60 <strlen>
+  cmd = parseline(&s, es);
+    1b75:	59                   	pop    %ecx
+    1b76:	5e                   	pop    %esi
+  es = s + strlen(s);
+    1b77:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+    1b79:	53                   	push   %ebx
+    1b7a:	57                   	push   %edi
+    1b7b:	e8 d0 fd ff ff       	call   1950 <parseline>
+  peek(&s, es, "");
+    1b80:	83 c4 0c             	add    $0xc,%esp
+    1b83:	68 f6 2d 00 00       	push   $0x2df6
+  cmd = parseline(&s, es);
+    1b88:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+    1b8a:	53                   	push   %ebx
+    1b8b:	57                   	push   %edi
+    1b8c:	e8 4f fa ff ff       	call   15e0 <peek>
+  if(s != es){
+    1b91:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b94:	83 c4 10             	add    $0x10,%esp
+    1b97:	39 d8                	cmp    %ebx,%eax
+    1b99:	75 13                	jne    1bae <parsecmd+0x4e>
+  nulterminate(cmd);
+    1b9b:	83 ec 0c             	sub    $0xc,%esp
+    1b9e:	56                   	push   %esi
+    1b9f:	e8 1c ff ff ff       	call   1ac0 <nulterminate>
+}
+    1ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ba7:	89 f0                	mov    %esi,%eax
+    1ba9:	5b                   	pop    %ebx
+    1baa:	5e                   	pop    %esi
+    1bab:	5f                   	pop    %edi
+    1bac:	5d                   	pop    %ebp
+    1bad:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+    1bae:	52                   	push   %edx
+    1baf:	50                   	push   %eax
+    1bb0:	68 6a 2e 00 00       	push   $0x2e6a
+    1bb5:	6a 02                	push   $0x2
+    1bb7:	e8 64 08 00 00       	call   2420 <printf>
+    panic("syntax");
+    1bbc:	c7 04 24 2e 2e 00 00 	movl   $0x2e2e,(%esp)
+    1bc3:	e8 a8 f5 ff ff       	call   1170 <panic>
+    1bc8:	66 90                	xchg   %ax,%ax
+    1bca:	66 90                	xchg   %ax,%ax
+    1bcc:	66 90                	xchg   %ax,%ax
+    1bce:	66 90                	xchg   %ax,%ax
+
+00001bd0 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1bd0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1bd1:	31 c0                	xor    %eax,%eax
+{
+    1bd3:	89 e5                	mov    %esp,%ebp
+    1bd5:	53                   	push   %ebx
+    1bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1bd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1be0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1be4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1be7:	83 c0 01             	add    $0x1,%eax
+    1bea:	84 d2                	test   %dl,%dl
+    1bec:	75 f2                	jne    1be0 <strcpy+0x10>
+    ;
+  return os;
+}
+    1bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1bf1:	89 c8                	mov    %ecx,%eax
+    1bf3:	c9                   	leave
+    1bf4:	c3                   	ret
+    1bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001c00 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1c00:	55                   	push   %ebp
+    1c01:	89 e5                	mov    %esp,%ebp
+    1c03:	53                   	push   %ebx
+    1c04:	8b 55 08             	mov    0x8(%ebp),%edx
+    1c07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    1c0a:	0f b6 02             	movzbl (%edx),%eax
+    1c0d:	84 c0                	test   %al,%al
+    1c0f:	75 17                	jne    1c28 <strcmp+0x28>
+    1c11:	eb 3a                	jmp    1c4d <strcmp+0x4d>
+    1c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c17:	90                   	nop
+    1c18:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    1c1c:	83 c2 01             	add    $0x1,%edx
+    1c1f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1c22:	84 c0                	test   %al,%al
+    1c24:	74 1a                	je     1c40 <strcmp+0x40>
+    p++, q++;
+    1c26:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1c28:	0f b6 19             	movzbl (%ecx),%ebx
+    1c2b:	38 c3                	cmp    %al,%bl
+    1c2d:	74 e9                	je     1c18 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    1c2f:	29 d8                	sub    %ebx,%eax
+}
+    1c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c34:	c9                   	leave
+    1c35:	c3                   	ret
+    1c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c3d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1c40:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1c44:	31 c0                	xor    %eax,%eax
+    1c46:	29 d8                	sub    %ebx,%eax
+}
+    1c48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c4b:	c9                   	leave
+    1c4c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    1c4d:	0f b6 19             	movzbl (%ecx),%ebx
+    1c50:	31 c0                	xor    %eax,%eax
+    1c52:	eb db                	jmp    1c2f <strcmp+0x2f>
+    1c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c5f:	90                   	nop
+
+00001c60 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1c66:	80 3a 00             	cmpb   $0x0,(%edx)
+    1c69:	74 15                	je     1c80 <strlen+0x20>
+    1c6b:	31 c0                	xor    %eax,%eax
+    1c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    1c70:	83 c0 01             	add    $0x1,%eax
+    1c73:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1c77:	89 c1                	mov    %eax,%ecx
+    1c79:	75 f5                	jne    1c70 <strlen+0x10>
+    ;
+  return n;
+}
+    1c7b:	89 c8                	mov    %ecx,%eax
+    1c7d:	5d                   	pop    %ebp
+    1c7e:	c3                   	ret
+    1c7f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1c80:	31 c9                	xor    %ecx,%ecx
+}
+    1c82:	5d                   	pop    %ebp
+    1c83:	89 c8                	mov    %ecx,%eax
+    1c85:	c3                   	ret
+    1c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001c90 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	57                   	push   %edi
+    1c94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1c97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1c9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1c9d:	89 d7                	mov    %edx,%edi
+    1c9f:	fc                   	cld
+    1ca0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1ca2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1ca5:	89 d0                	mov    %edx,%eax
+    1ca7:	c9                   	leave
+    1ca8:	c3                   	ret
+    1ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cb0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1cb0:	55                   	push   %ebp
+    1cb1:	89 e5                	mov    %esp,%ebp
+    1cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+    1cb6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    1cba:	0f b6 10             	movzbl (%eax),%edx
+    1cbd:	84 d2                	test   %dl,%dl
+    1cbf:	75 12                	jne    1cd3 <strchr+0x23>
+    1cc1:	eb 1d                	jmp    1ce0 <strchr+0x30>
+    1cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cc7:	90                   	nop
+    1cc8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    1ccc:	83 c0 01             	add    $0x1,%eax
+    1ccf:	84 d2                	test   %dl,%dl
+    1cd1:	74 0d                	je     1ce0 <strchr+0x30>
+    if(*s == c)
+    1cd3:	38 d1                	cmp    %dl,%cl
+    1cd5:	75 f1                	jne    1cc8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1cd7:	5d                   	pop    %ebp
+    1cd8:	c3                   	ret
+    1cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1ce0:	31 c0                	xor    %eax,%eax
+}
+    1ce2:	5d                   	pop    %ebp
+    1ce3:	c3                   	ret
+    1ce4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cef:	90                   	nop
+
+00001cf0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1cf0:	55                   	push   %ebp
+    1cf1:	89 e5                	mov    %esp,%ebp
+    1cf3:	57                   	push   %edi
+    1cf4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1cf5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1cf8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1cf9:	31 db                	xor    %ebx,%ebx
+{
+    1cfb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    1cfe:	eb 27                	jmp    1d27 <gets+0x37>
+    cc = read(0, &c, 1);
+    1d00:	83 ec 04             	sub    $0x4,%esp
+    1d03:	6a 01                	push   $0x1
+    1d05:	56                   	push   %esi
+    1d06:	6a 00                	push   $0x0
+    1d08:	e8 23 02 00 00       	call   1f30 <read>
+    if(cc < 1)
+    1d0d:	83 c4 10             	add    $0x10,%esp
+    1d10:	85 c0                	test   %eax,%eax
+    1d12:	7e 1d                	jle    1d31 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1d14:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1d18:	8b 55 08             	mov    0x8(%ebp),%edx
+    1d1b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    1d1f:	3c 0a                	cmp    $0xa,%al
+    1d21:	74 10                	je     1d33 <gets+0x43>
+    1d23:	3c 0d                	cmp    $0xd,%al
+    1d25:	74 0c                	je     1d33 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1d27:	89 df                	mov    %ebx,%edi
+    1d29:	83 c3 01             	add    $0x1,%ebx
+    1d2c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1d2f:	7c cf                	jl     1d00 <gets+0x10>
+    1d31:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1d33:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d36:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    1d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d3d:	5b                   	pop    %ebx
+    1d3e:	5e                   	pop    %esi
+    1d3f:	5f                   	pop    %edi
+    1d40:	5d                   	pop    %ebp
+    1d41:	c3                   	ret
+    1d42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001d50 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1d50:	55                   	push   %ebp
+    1d51:	89 e5                	mov    %esp,%ebp
+    1d53:	56                   	push   %esi
+    1d54:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1d55:	83 ec 08             	sub    $0x8,%esp
+    1d58:	6a 00                	push   $0x0
+    1d5a:	ff 75 08             	push   0x8(%ebp)
+    1d5d:	e8 19 02 00 00       	call   1f7b <open>
+  if(fd < 0)
+    1d62:	83 c4 10             	add    $0x10,%esp
+    1d65:	85 c0                	test   %eax,%eax
+    1d67:	78 27                	js     1d90 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1d69:	83 ec 08             	sub    $0x8,%esp
+    1d6c:	ff 75 0c             	push   0xc(%ebp)
+    1d6f:	89 c3                	mov    %eax,%ebx
+    1d71:	50                   	push   %eax
+    1d72:	e8 31 02 00 00       	call   1fa8 <fstat>
+  close(fd);
+    1d77:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    1d7a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    1d7c:	e8 cd 01 00 00       	call   1f4e <close>
+  return r;
+    1d81:	83 c4 10             	add    $0x10,%esp
+}
+    1d84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1d87:	89 f0                	mov    %esi,%eax
+    1d89:	5b                   	pop    %ebx
+    1d8a:	5e                   	pop    %esi
+    1d8b:	5d                   	pop    %ebp
+    1d8c:	c3                   	ret
+    1d8d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1d90:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1d95:	eb ed                	jmp    1d84 <stat+0x34>
+    1d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d9e:	66 90                	xchg   %ax,%ax
+
+00001da0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	53                   	push   %ebx
+    1da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1da7:	0f be 02             	movsbl (%edx),%eax
+    1daa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    1dad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1db5:	77 1e                	ja     1dd5 <atoi+0x35>
+    1db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dbe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1dc0:	83 c2 01             	add    $0x1,%edx
+    1dc3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1dc6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    1dca:	0f be 02             	movsbl (%edx),%eax
+    1dcd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1dd0:	80 fb 09             	cmp    $0x9,%bl
+    1dd3:	76 eb                	jbe    1dc0 <atoi+0x20>
+  return n;
+}
+    1dd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1dd8:	89 c8                	mov    %ecx,%eax
+    1dda:	c9                   	leave
+    1ddb:	c3                   	ret
+    1ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001de0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1de0:	55                   	push   %ebp
+    1de1:	89 e5                	mov    %esp,%ebp
+    1de3:	57                   	push   %edi
+    1de4:	56                   	push   %esi
+    1de5:	8b 45 10             	mov    0x10(%ebp),%eax
+    1de8:	8b 55 08             	mov    0x8(%ebp),%edx
+    1deb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    1dee:	85 c0                	test   %eax,%eax
+    1df0:	7e 13                	jle    1e05 <memmove+0x25>
+    1df2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1df4:	89 d7                	mov    %edx,%edi
+    1df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1e00:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1e01:	39 f8                	cmp    %edi,%eax
+    1e03:	75 fb                	jne    1e00 <memmove+0x20>
+  return vdst;
+}
+    1e05:	5e                   	pop    %esi
+    1e06:	89 d0                	mov    %edx,%eax
+    1e08:	5f                   	pop    %edi
+    1e09:	5d                   	pop    %ebp
+    1e0a:	c3                   	ret
+    1e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e0f:	90                   	nop
+
+00001e10 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1e10:	55                   	push   %ebp
+    1e11:	89 e5                	mov    %esp,%ebp
+    1e13:	56                   	push   %esi
+    1e14:	53                   	push   %ebx
+    1e15:	8b 75 10             	mov    0x10(%ebp),%esi
+    1e18:	8b 55 08             	mov    0x8(%ebp),%edx
+    1e1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    1e1e:	85 f6                	test   %esi,%esi
+    1e20:	74 2e                	je     1e50 <memcmp+0x40>
+    1e22:	01 c6                	add    %eax,%esi
+    1e24:	eb 14                	jmp    1e3a <memcmp+0x2a>
+    1e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e2d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1e30:	83 c0 01             	add    $0x1,%eax
+    1e33:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1e36:	39 f0                	cmp    %esi,%eax
+    1e38:	74 16                	je     1e50 <memcmp+0x40>
+    if(*s1 != *s2)
+    1e3a:	0f b6 0a             	movzbl (%edx),%ecx
+    1e3d:	0f b6 18             	movzbl (%eax),%ebx
+    1e40:	38 d9                	cmp    %bl,%cl
+    1e42:	74 ec                	je     1e30 <memcmp+0x20>
+      return *s1 - *s2;
+    1e44:	0f b6 c1             	movzbl %cl,%eax
+    1e47:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1e49:	5b                   	pop    %ebx
+    1e4a:	5e                   	pop    %esi
+    1e4b:	5d                   	pop    %ebp
+    1e4c:	c3                   	ret
+    1e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    1e50:	5b                   	pop    %ebx
+  return 0;
+    1e51:	31 c0                	xor    %eax,%eax
+}
+    1e53:	5e                   	pop    %esi
+    1e54:	5d                   	pop    %ebp
+    1e55:	c3                   	ret
+    1e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001e60 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1e60:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1e65:	c3                   	ret
+    1e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001e70 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1e70:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1e75:	c3                   	ret
+    1e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001e80 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1e80:	a1 c4 3b 00 00       	mov    0x3bc4,%eax
+    1e85:	85 c0                	test   %eax,%eax
+    1e87:	74 17                	je     1ea0 <fork+0x20>
+{
+    1e89:	55                   	push   %ebp
+    1e8a:	89 e5                	mov    %esp,%ebp
+    1e8c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    1e8f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1e91:	c9                   	leave
+  return _fork();
+    1e92:	e9 5d 00 00 00       	jmp    1ef4 <_fork>
+    1e97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e9e:	66 90                	xchg   %ax,%ax
+    1ea0:	e9 4f 00 00 00       	jmp    1ef4 <_fork>
+    1ea5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001eb0 <exit>:
+
+int
+exit(void)
+{
+    1eb0:	55                   	push   %ebp
+    1eb1:	89 e5                	mov    %esp,%ebp
+    1eb3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1eb6:	a1 c4 3b 00 00       	mov    0x3bc4,%eax
+    1ebb:	85 c0                	test   %eax,%eax
+    1ebd:	74 02                	je     1ec1 <exit+0x11>
+    flushhook();
+    1ebf:	ff d0                	call   *%eax
+  _exit();
+    1ec1:	e8 3d 00 00 00       	call   1f03 <_exit>
+    1ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001ed0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1ed0:	55                   	push   %ebp
+  if(flushhook)
+    1ed1:	a1 c4 3b 00 00       	mov    0x3bc4,%eax
+{
+    1ed6:	89 e5                	mov    %esp,%ebp
+    1ed8:	56                   	push   %esi
+    1ed9:	53                   	push   %ebx
+    1eda:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1edd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1ee0:	85 c0                	test   %eax,%eax
+    1ee2:	74 02                	je     1ee6 <exec+0x16>
+    flushhook();
+    1ee4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1ee6:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1ee9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1eec:	5b                   	pop    %ebx
+    1eed:	5e                   	pop    %esi
+    1eee:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    1eef:	e9 78 00 00 00       	jmp    1f6c <_exec>
+
+00001ef4 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1ef4:	b8 01 00 00 00       	mov    $0x1,%eax
+    1ef9:	89 e1                	mov    %esp,%ecx
+    1efb:	ba 02 1f 00 00       	mov    $0x1f02,%edx
+    1f00:	0f 34                	sysenter
+    1f02:	c3                   	ret
+
+00001f03 <_exit>:
+RAWSYSCALL(exit)
+    1f03:	b8 02 00 00 00       	mov    $0x2,%eax
+    1f08:	89 e1                	mov    %esp,%ecx
+    1f0a:	ba 11 1f 00 00       	mov    $0x1f11,%edx
+    1f0f:	0f 34                	sysenter
+    1f11:	c3                   	ret
+
+00001f12 <wait>:
+SYSCALL(wait)
+    1f12:	b8 03 00 00 00       	mov    $0x3,%eax
+    1f17:	89 e1                	mov    %esp,%ecx
+    1f19:	ba 20 1f 00 00       	mov    $0x1f20,%edx
+    1f1e:	0f 34                	sysenter
+    1f20:	c3                   	ret
+
+00001f21 <pipe>:
+SYSCALL(pipe)
+    1f21:	b8 04 00 00 00       	mov    $0x4,%eax
+    1f26:	89 e1                	mov    %esp,%ecx
+    1f28:	ba 2f 1f 00 00       	mov    $0x1f2f,%edx
+    1f2d:	0f 34                	sysenter
+    1f2f:	c3                   	ret
+
+00001f30 <read>:
+SYSCALL(read)
+    1f30:	b8 05 00 00 00       	mov    $0x5,%eax
+    1f35:	89 e1                	mov    %esp,%ecx
+    1f37:	ba 3e 1f 00 00       	mov    $0x1f3e,%edx
+    1f3c:	0f 34                	sysenter
+    1f3e:	c3                   	ret
+
+00001f3f <write>:
+SYSCALL(write)
+    1f3f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1f44:	89 e1                	mov    %esp,%ecx
+    1f46:	ba 4d 1f 00 00       	mov    $0x1f4d,%edx
+    1f4b:	0f 34                	sysenter
+    1f4d:	c3                   	ret
+
+00001f4e <close>:
+SYSCALL(close)
+    1f4e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1f53:	89 e1                	mov    %esp,%ecx
+    1f55:	ba 5c 1f 00 00       	mov    $0x1f5c,%edx
+    1f5a:	0f 34                	sysenter
+    1f5c:	c3                   	ret
+
+00001f5d <kill>:
+SYSCALL(kill)
+    1f5d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1f62:	89 e1                	mov    %esp,%ecx
+    1f64:	ba 6b 1f 00 00       	mov    $0x1f6b,%edx
+    1f69:	0f 34                	sysenter
+    1f6b:	c3                   	ret
+
+00001f6c <_exec>:
+RAWSYSCALL(exec)
+    1f6c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1f71:	89 e1                	mov    %esp,%ecx
+    1f73:	ba 7a 1f 00 00       	mov    $0x1f7a,%edx
+    1f78:	0f 34                	sysenter
+    1f7a:	c3                   	ret
+
+00001f7b <open>:
+SYSCALL(open)
+    1f7b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1f80:	89 e1                	mov    %esp,%ecx
+    1f82:	ba 89 1f 00 00       	mov    $0x1f89,%edx
+    1f87:	0f 34                	sysenter
+    1f89:	c3                   	ret
+
+00001f8a <mknod>:
+SYSCALL(mknod)
+    1f8a:	b8 11 00 00 00       	mov    $0x11,%eax
+    1f8f:	89 e1                	mov    %esp,%ecx
+    1f91:	ba 98 1f 00 00       	mov    $0x1f98,%edx
+    1f96:	0f 34                	sysenter
+    1f98:	c3                   	ret
+
+00001f99 <unlink>:
+SYSCALL(unlink)
+    1f99:	b8 12 00 00 00       	mov    $0x12,%eax
+    1f9e:	89 e1                	mov    %esp,%ecx
+    1fa0:	ba a7 1f 00 00       	mov    $0x1fa7,%edx
+    1fa5:	0f 34                	sysenter
+    1fa7:	c3                   	ret
+
+00001fa8 <fstat>:
+SYSCALL(fstat)
+    1fa8:	b8 08 00 00 00       	mov    $0x8,%eax
+    1fad:	89 e1                	mov    %esp,%ecx
+    1faf:	ba b6 1f 00 00       	mov    $0x1fb6,%edx
+    1fb4:	0f 34                	sysenter
+    1fb6:	c3                   	ret
+
+00001fb7 <link>:
+SYSCALL(link)
+    1fb7:	b8 13 00 00 00       	mov    $0x13,%eax
+    1fbc:	89 e1                	mov    %esp,%ecx
+    1fbe:	ba c5 1f 00 00       	mov    $0x1fc5,%edx
+    1fc3:	0f 34                	sysenter
+    1fc5:	c3                   	ret
+
+00001fc6 <mkdir>:
+SYSCALL(mkdir)
+    1fc6:	b8 14 00 00 00       	mov    $0x14,%eax
+    1fcb:	89 e1                	mov    %esp,%ecx
+    1fcd:	ba d4 1f 00 00       	mov    $0x1fd4,%edx
+    1fd2:	0f 34                	sysenter
+    1fd4:	c3                   	ret
+
+00001fd5 <chdir>:
+SYSCALL(chdir)
+    1fd5:	b8 09 00 00 00       	mov    $0x9,%eax
+    1fda:	89 e1                	mov    %esp,%ecx
+    1fdc:	ba e3 1f 00 00       	mov    $0x1fe3,%edx
+    1fe1:	0f 34                	sysenter
+    1fe3:	c3                   	ret
+
+00001fe4 <dup>:
+SYSCALL(dup)
+    1fe4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1fe9:	89 e1                	mov    %esp,%ecx
+    1feb:	ba f2 1f 00 00       	mov    $0x1ff2,%edx
+    1ff0:	0f 34                	sysenter
+    1ff2:	c3                   	ret
+
+00001ff3 <getpid>:
+SYSCALL(getpid)
+    1ff3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1ff8:	89 e1                	mov    %esp,%ecx
+    1ffa:	ba 01 20 00 00       	mov    $0x2001,%edx
+    1fff:	0f 34                	sysenter
+    2001:	c3                   	ret
+
+00002002 <sbrk>:
+SYSCALL(sbrk)
+    2002:	b8 0c 00 00 00       	mov    $0xc,%eax
+    2007:	89 e1                	mov    %esp,%ecx
+    2009:	ba 10 20 00 00       	mov    $0x2010,%edx
+    200e:	0f 34                	sysenter
+    2010:	c3                   	ret
+
+00002011 <sleep>:
+SYSCALL(sleep)
+    2011:	b8 0d 00 00 00       	mov    $0xd,%eax
+    2016:	89 e1                	mov    %esp,%ecx
+    2018:	ba 1f 20 00 00       	mov    $0x201f,%edx
+    201d:	0f 34                	sysenter
+    201f:	c3                   	ret
+
+00002020 <uptime>:
+SYSCALL(uptime)
+    2020:	b8 0e 00 00 00       	mov    $0xe,%eax
+    2025:	89 e1                	mov    %esp,%ecx
+    2027:	ba 2e 20 00 00       	mov    $0x202e,%edx
+    202c:	0f 34                	sysenter
+    202e:	c3                   	ret
+
+0000202f <mprotect>:
+SYSCALL(mprotect)
+    202f:	b8 16 00 00 00       	mov    $0x16,%eax
+    2034:	89 e1                	mov    %esp,%ecx
+    2036:	ba 3d 20 00 00       	mov    $0x203d,%edx
+    203b:	0f 34                	sysenter
+    203d:	c3                   	ret
+
+0000203e <munprotect>:
+SYSCALL(munprotect)
+    203e:	b8 17 00 00 00       	mov    $0x17,%eax
+    2043:	89 e1                	mov    %esp,%ecx
+    2045:	ba 4c 20 00 00       	mov    $0x204c,%edx
+    204a:	0f 34                	sysenter
+    204c:	c3                   	ret
+
+0000204d <kstat>:
+SYSCALL(kstat)
+    204d:	b8 18 00 00 00       	mov    $0x18,%eax
+    2052:	89 e1                	mov    %esp,%ecx
+    2054:	ba 5b 20 00 00       	mov    $0x205b,%edx
+    2059:	0f 34                	sysenter
+    205b:	c3                   	ret
+
+0000205c <fcntl>:
+SYSCALL(fcntl)
+    205c:	b8 19 00 00 00       	mov    $0x19,%eax
+    2061:	89 e1                	mov    %esp,%ecx
+    2063:	ba 6a 20 00 00       	mov    $0x206a,%edx
+    2068:	0f 34                	sysenter
+    206a:	c3                   	ret
+
+0000206b <splice>:
+SYSCALL(splice)
+    206b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    2070:	89 e1                	mov    %esp,%ecx
+    2072:	ba 79 20 00 00       	mov    $0x2079,%edx
+    2077:	0f 34                	sysenter
+    2079:	c3                   	ret
+
+0000207a <sendfile>:
+SYSCALL(sendfile)
+    207a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    207f:	89 e1                	mov    %esp,%ecx
+    2081:	ba 88 20 00 00       	mov    $0x2088,%edx
+    2086:	0f 34                	sysenter
+    2088:	c3                   	ret
+
+00002089 <lseek>:
+SYSCALL(lseek)
+    2089:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    208e:	89 e1                	mov    %esp,%ecx
+    2090:	ba 97 20 00 00       	mov    $0x2097,%edx
+    2095:	0f 34                	sysenter
+    2097:	c3                   	ret
+
+00002098 <pread>:
+SYSCALL(pread)
+    2098:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    209d:	89 e1                	mov    %esp,%ecx
+    209f:	ba a6 20 00 00       	mov    $0x20a6,%edx
+    20a4:	0f 34                	sysenter
+    20a6:	c3                   	ret
+
+000020a7 <pwrite>:
+SYSCALL(pwrite)
+    20a7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    20ac:	89 e1                	mov    %esp,%ecx
+    20ae:	ba b5 20 00 00       	mov    $0x20b5,%edx
+    20b3:	0f 34                	sysenter
+    20b5:	c3                   	ret
+
+000020b6 <readv>:
+SYSCALL(readv)
+    20b6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    20bb:	89 e1                	mov    %esp,%ecx
+    20bd:	ba c4 20 00 00       	mov    $0x20c4,%edx
+    20c2:	0f 34                	sysenter
+    20c4:	c3                   	ret
+
+000020c5 <writev>:
+SYSCALL(writev)
+    20c5:	b8 20 00 00 00       	mov    $0x20,%eax
+    20ca:	89 e1                	mov    %esp,%ecx
+    20cc:	ba d3 20 00 00       	mov    $0x20d3,%edx
+    20d1:	0f 34                	sysenter
+    20d3:	c3                   	ret
+
+000020d4 <ringsetup>:
+SYSCALL(ringsetup)
+    20d4:	b8 21 00 00 00       	mov    $0x21,%eax
+    20d9:	89 e1                	mov    %esp,%ecx
+    20db:	ba e2 20 00 00       	mov    $0x20e2,%edx
+    20e0:	0f 34                	sysenter
+    20e2:	c3                   	ret
+
+000020e3 <ringenter>:
+SYSCALL(ringenter)
+    20e3:	b8 22 00 00 00       	mov    $0x22,%eax
+    20e8:	89 e1                	mov    %esp,%ecx
+    20ea:	ba f1 20 00 00       	mov    $0x20f1,%edx
+    20ef:	0f 34                	sysenter
+    20f1:	c3                   	ret
+
+000020f2 <intgetpid>:
+INTSYSCALL(getpid)
+    20f2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    20f7:	cd 40                	int    $0x40
+    20f9:	c3                   	ret
+    20fa:	66 90                	xchg   %ax,%ax
+    20fc:	66 90                	xchg   %ax,%ax
+    20fe:	66 90                	xchg   %ax,%ax
+
+00002100 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    2100:	55                   	push   %ebp
+    2101:	89 e5                	mov    %esp,%ebp
+    2103:	57                   	push   %edi
+    2104:	56                   	push   %esi
+    2105:	53                   	push   %ebx
+    2106:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    2108:	89 d1                	mov    %edx,%ecx
+{
+    210a:	83 ec 2c             	sub    $0x2c,%esp
+    210d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    2110:	85 d2                	test   %edx,%edx
+    2112:	0f 89 c0 00 00 00    	jns    21d8 <printint+0xd8>
+    2118:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    211c:	0f 84 b6 00 00 00    	je     21d8 <printint+0xd8>
+    x = -xx;
+    2122:	f7 d9                	neg    %ecx
+    neg = 1;
+    2124:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    2129:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    212c:	31 f6                	xor    %esi,%esi
+    212e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    2130:	89 c8                	mov    %ecx,%eax
+    2132:	31 d2                	xor    %edx,%edx
+    2134:	89 f7                	mov    %esi,%edi
+    2136:	f7 f3                	div    %ebx
+    2138:	8d 76 01             	lea    0x1(%esi),%esi
+    213b:	0f b6 92 20 2f 00 00 	movzbl 0x2f20(%edx),%edx
+    2142:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    2146:	89 ca                	mov    %ecx,%edx
+    2148:	89 c1                	mov    %eax,%ecx
+    214a:	39 da                	cmp    %ebx,%edx
+    214c:	73 e2                	jae    2130 <printint+0x30>
+  if(neg)
+    214e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    2151:	85 c0                	test   %eax,%eax
+    2153:	74 07                	je     215c <printint+0x5c>
+    buf[i++] = '-';
+    2155:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    215a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    215c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    215f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    2162:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    2164:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    2167:	8b 41 08             	mov    0x8(%ecx),%eax
+    216a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    216d:	89 ce                	mov    %ecx,%esi
+    216f:	eb 1c                	jmp    218d <printint+0x8d>
+    2171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    2178:	89 c1                	mov    %eax,%ecx
+    217a:	83 c0 01             	add    $0x1,%eax
+    217d:	89 46 08             	mov    %eax,0x8(%esi)
+    2180:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    2184:	8d 57 ff             	lea    -0x1(%edi),%edx
+    2187:	39 df                	cmp    %ebx,%edi
+    2189:	74 41                	je     21cc <printint+0xcc>
+    218b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    218d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    2190:	3d 80 00 00 00       	cmp    $0x80,%eax
+    2195:	75 e1                	jne    2178 <printint+0x78>
+  if(o->f)
+    2197:	8b 06                	mov    (%esi),%eax
+    2199:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    219c:	85 c0                	test   %eax,%eax
+    219e:	74 40                	je     21e0 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    21a0:	50                   	push   %eax
+    21a1:	68 80 00 00 00       	push   $0x80
+    21a6:	6a 01                	push   $0x1
+    21a8:	ff 75 d4             	push   -0x2c(%ebp)
+    21ab:	e8 a0 04 00 00       	call   2650 <fwrite>
+    21b0:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    21b4:	83 c4 10             	add    $0x10,%esp
+}
+    21b7:	b8 01 00 00 00       	mov    $0x1,%eax
+    21bc:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    21be:	89 46 08             	mov    %eax,0x8(%esi)
+    21c1:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    21c5:	8d 57 ff             	lea    -0x1(%edi),%edx
+    21c8:	39 df                	cmp    %ebx,%edi
+    21ca:	75 bf                	jne    218b <printint+0x8b>
+}
+    21cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21cf:	5b                   	pop    %ebx
+    21d0:	5e                   	pop    %esi
+    21d1:	5f                   	pop    %edi
+    21d2:	5d                   	pop    %ebp
+    21d3:	c3                   	ret
+    21d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    21d8:	31 c0                	xor    %eax,%eax
+    21da:	e9 4a ff ff ff       	jmp    2129 <printint+0x29>
+    21df:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    21e0:	83 ec 04             	sub    $0x4,%esp
+    21e3:	68 80 00 00 00       	push   $0x80
+    21e8:	ff 75 d4             	push   -0x2c(%ebp)
+    21eb:	ff 76 04             	push   0x4(%esi)
+    21ee:	e8 4c fd ff ff       	call   1f3f <write>
+    21f3:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    21f7:	83 c4 10             	add    $0x10,%esp
+    21fa:	eb bb                	jmp    21b7 <printint+0xb7>
+    21fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002200 <putc>:
+{
+    2200:	55                   	push   %ebp
+    2201:	89 e5                	mov    %esp,%ebp
+    2203:	56                   	push   %esi
+    2204:	89 d6                	mov    %edx,%esi
+    2206:	53                   	push   %ebx
+    2207:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    2209:	8b 40 08             	mov    0x8(%eax),%eax
+    220c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    2211:	74 1d                	je     2230 <putc+0x30>
+  o->buf[o->n++] = c;
+    2213:	89 f1                	mov    %esi,%ecx
+    2215:	8d 50 01             	lea    0x1(%eax),%edx
+    2218:	89 53 08             	mov    %edx,0x8(%ebx)
+    221b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    221f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2222:	5b                   	pop    %ebx
+    2223:	5e                   	pop    %esi
+    2224:	5d                   	pop    %ebp
+    2225:	c3                   	ret
+    2226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    222d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    2230:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    2232:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    2235:	85 c0                	test   %eax,%eax
+    2237:	74 2f                	je     2268 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    2239:	50                   	push   %eax
+    223a:	68 80 00 00 00       	push   $0x80
+    223f:	6a 01                	push   $0x1
+    2241:	52                   	push   %edx
+    2242:	e8 09 04 00 00       	call   2650 <fwrite>
+    2247:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    224a:	89 f1                	mov    %esi,%ecx
+}
+    224c:	ba 01 00 00 00       	mov    $0x1,%edx
+    2251:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    2253:	89 53 08             	mov    %edx,0x8(%ebx)
+    2256:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    225a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    225d:	5b                   	pop    %ebx
+    225e:	5e                   	pop    %esi
+    225f:	5d                   	pop    %ebp
+    2260:	c3                   	ret
+    2261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    2268:	83 ec 04             	sub    $0x4,%esp
+    226b:	68 80 00 00 00       	push   $0x80
+    2270:	52                   	push   %edx
+    2271:	ff 73 04             	push   0x4(%ebx)
+    2274:	e8 c6 fc ff ff       	call   1f3f <write>
+    2279:	83 c4 10             	add    $0x10,%esp
+    227c:	eb cc                	jmp    224a <putc+0x4a>
+    227e:	66 90                	xchg   %ax,%ax
+
+00002280 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    2280:	55                   	push   %ebp
+    2281:	89 e5                	mov    %esp,%ebp
+    2283:	57                   	push   %edi
+    2284:	89 c7                	mov    %eax,%edi
+    2286:	56                   	push   %esi
+    2287:	31 f6                	xor    %esi,%esi
+    2289:	53                   	push   %ebx
+    228a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    228d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    2290:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    2293:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    2296:	84 c0                	test   %al,%al
+    2298:	75 1e                	jne    22b8 <vprintf.constprop.0+0x38>
+    229a:	eb 53                	jmp    22ef <vprintf.constprop.0+0x6f>
+    229c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    22a0:	83 f8 25             	cmp    $0x25,%eax
+    22a3:	74 3b                	je     22e0 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    22a5:	89 ca                	mov    %ecx,%edx
+    22a7:	89 f8                	mov    %edi,%eax
+    22a9:	e8 52 ff ff ff       	call   2200 <putc>
+  for(i = 0; fmt[i]; i++){
+    22ae:	0f b6 03             	movzbl (%ebx),%eax
+    22b1:	83 c3 01             	add    $0x1,%ebx
+    22b4:	84 c0                	test   %al,%al
+    22b6:	74 37                	je     22ef <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    22b8:	0f be c8             	movsbl %al,%ecx
+    22bb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    22be:	85 f6                	test   %esi,%esi
+    22c0:	74 de                	je     22a0 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    22c2:	83 fe 25             	cmp    $0x25,%esi
+    22c5:	75 e7                	jne    22ae <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    22c7:	83 f8 25             	cmp    $0x25,%eax
+    22ca:	74 4e                	je     231a <vprintf.constprop.0+0x9a>
+    22cc:	83 e8 63             	sub    $0x63,%eax
+    22cf:	83 f8 15             	cmp    $0x15,%eax
+    22d2:	77 34                	ja     2308 <vprintf.constprop.0+0x88>
+    22d4:	ff 24 85 c8 2e 00 00 	jmp    *0x2ec8(,%eax,4)
+    22db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22df:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    22e0:	0f b6 03             	movzbl (%ebx),%eax
+    22e3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    22e6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    22eb:	84 c0                	test   %al,%al
+    22ed:	75 c9                	jne    22b8 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    22ef:	8b 47 08             	mov    0x8(%edi),%eax
+    22f2:	85 c0                	test   %eax,%eax
+    22f4:	0f 8f de 00 00 00    	jg     23d8 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    22fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22fd:	5b                   	pop    %ebx
+    22fe:	5e                   	pop    %esi
+    22ff:	5f                   	pop    %edi
+    2300:	5d                   	pop    %ebp
+    2301:	c3                   	ret
+    2302:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    2308:	ba 25 00 00 00       	mov    $0x25,%edx
+    230d:	89 f8                	mov    %edi,%eax
+    230f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    2312:	e8 e9 fe ff ff       	call   2200 <putc>
+        putc(o, c);
+    2317:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    231a:	89 ca                	mov    %ecx,%edx
+    231c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    231e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    2320:	e8 db fe ff ff       	call   2200 <putc>
+    2325:	eb 87                	jmp    22ae <vprintf.constprop.0+0x2e>
+    2327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    232e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    2330:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    2333:	83 ec 0c             	sub    $0xc,%esp
+    2336:	b9 10 00 00 00       	mov    $0x10,%ecx
+    233b:	8b 16                	mov    (%esi),%edx
+    233d:	6a 00                	push   $0x0
+        ap++;
+    233f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    2342:	89 f8                	mov    %edi,%eax
+    2344:	e8 b7 fd ff ff       	call   2100 <printint>
+        ap++;
+    2349:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    234c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    234f:	31 f6                	xor    %esi,%esi
+    2351:	e9 58 ff ff ff       	jmp    22ae <vprintf.constprop.0+0x2e>
+    2356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    235d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    2360:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2363:	8b 30                	mov    (%eax),%esi
+        ap++;
+    2365:	83 c0 04             	add    $0x4,%eax
+    2368:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    236b:	85 f6                	test   %esi,%esi
+    236d:	75 1b                	jne    238a <vprintf.constprop.0+0x10a>
+    236f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    2374:	be c0 2e 00 00       	mov    $0x2ec0,%esi
+    2379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    2380:	89 f8                	mov    %edi,%eax
+          s++;
+    2382:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    2385:	e8 76 fe ff ff       	call   2200 <putc>
+        while(*s != 0){
+    238a:	0f be 16             	movsbl (%esi),%edx
+    238d:	84 d2                	test   %dl,%dl
+    238f:	75 ef                	jne    2380 <vprintf.constprop.0+0x100>
+      state = 0;
+    2391:	31 f6                	xor    %esi,%esi
+    2393:	e9 16 ff ff ff       	jmp    22ae <vprintf.constprop.0+0x2e>
+    2398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    239f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    23a0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    23a3:	83 ec 0c             	sub    $0xc,%esp
+    23a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    23ab:	8b 16                	mov    (%esi),%edx
+    23ad:	6a 01                	push   $0x1
+    23af:	eb 8e                	jmp    233f <vprintf.constprop.0+0xbf>
+    23b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    23b8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    23bb:	89 f8                	mov    %edi,%eax
+    23bd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    23c0:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    23c3:	e8 38 fe ff ff       	call   2200 <putc>
+        ap++;
+    23c8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    23cb:	31 f6                	xor    %esi,%esi
+    23cd:	e9 dc fe ff ff       	jmp    22ae <vprintf.constprop.0+0x2e>
+    23d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    23d8:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    23da:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    23dd:	85 d2                	test   %edx,%edx
+    23df:	74 1f                	je     2400 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    23e1:	52                   	push   %edx
+    23e2:	50                   	push   %eax
+    23e3:	6a 01                	push   $0x1
+    23e5:	51                   	push   %ecx
+    23e6:	e8 65 02 00 00       	call   2650 <fwrite>
+    23eb:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    23ee:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    23f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23f8:	5b                   	pop    %ebx
+    23f9:	5e                   	pop    %esi
+    23fa:	5f                   	pop    %edi
+    23fb:	5d                   	pop    %ebp
+    23fc:	c3                   	ret
+    23fd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    2400:	83 ec 04             	sub    $0x4,%esp
+    2403:	50                   	push   %eax
+    2404:	51                   	push   %ecx
+    2405:	ff 77 04             	push   0x4(%edi)
+    2408:	e8 32 fb ff ff       	call   1f3f <write>
+    240d:	83 c4 10             	add    $0x10,%esp
+    2410:	eb dc                	jmp    23ee <vprintf.constprop.0+0x16e>
+    2412:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002420 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    2420:	55                   	push   %ebp
+    2421:	89 e5                	mov    %esp,%ebp
+    2423:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    2429:	a1 04 39 00 00       	mov    0x3904,%eax
+{
+    242e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    2431:	83 fa 01             	cmp    $0x1,%edx
+    2434:	74 0c                	je     2442 <printf+0x22>
+    2436:	31 c0                	xor    %eax,%eax
+    2438:	83 fa 02             	cmp    $0x2,%edx
+    243b:	0f 44 05 00 39 00 00 	cmove  0x3900,%eax
+  o.fd = fd;
+    2442:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    2448:	8b 55 0c             	mov    0xc(%ebp),%edx
+    244b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    244e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    2454:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    245a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    2461:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    2464:	e8 17 fe ff ff       	call   2280 <vprintf.constprop.0>
+}
+    2469:	c9                   	leave
+    246a:	c3                   	ret
+    246b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    246f:	90                   	nop
+
+00002470 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    2470:	55                   	push   %ebp
+    2471:	89 e5                	mov    %esp,%ebp
+    2473:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    2479:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    247c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    247f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    2482:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    2489:	ff ff ff 
+  o.n = 0;
+    248c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    2493:	00 00 00 
+  o.f = f;
+    2496:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    249c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    24a2:	e8 d9 fd ff ff       	call   2280 <vprintf.constprop.0>
+}
+    24a7:	c9                   	leave
+    24a8:	c3                   	ret
+    24a9:	66 90                	xchg   %ax,%ax
+    24ab:	66 90                	xchg   %ax,%ax
+    24ad:	66 90                	xchg   %ax,%ax
+    24af:	90                   	nop
+
+000024b0 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    24b0:	55                   	push   %ebp
+    24b1:	89 e5                	mov    %esp,%ebp
+    24b3:	53                   	push   %ebx
+    24b4:	89 c3                	mov    %eax,%ebx
+    24b6:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    24b9:	8b 40 0c             	mov    0xc(%eax),%eax
+    24bc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    24bf:	74 17                	je     24d8 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    24c1:	83 f8 02             	cmp    $0x2,%eax
+    24c4:	74 07                	je     24cd <setmode+0x1d>
+    24c6:	8b 43 18             	mov    0x18(%ebx),%eax
+    24c9:	85 c0                	test   %eax,%eax
+    24cb:	74 38                	je     2505 <setmode+0x55>
+    f->mode = IONBF;
+}
+    24cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    24d0:	c9                   	leave
+    24d1:	c3                   	ret
+    24d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    24d8:	83 ec 08             	sub    $0x8,%esp
+    24db:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    24de:	50                   	push   %eax
+    24df:	ff 33                	push   (%ebx)
+    24e1:	e8 c2 fa ff ff       	call   1fa8 <fstat>
+    24e6:	83 c4 10             	add    $0x10,%esp
+    24e9:	89 c2                	mov    %eax,%edx
+    24eb:	31 c0                	xor    %eax,%eax
+    24ed:	85 d2                	test   %edx,%edx
+    24ef:	75 0a                	jne    24fb <setmode+0x4b>
+    24f1:	31 c0                	xor    %eax,%eax
+    24f3:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    24f8:	0f 94 c0             	sete   %al
+    24fb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    24fe:	8b 43 18             	mov    0x18(%ebx),%eax
+    2501:	85 c0                	test   %eax,%eax
+    2503:	75 c8                	jne    24cd <setmode+0x1d>
+    2505:	83 ec 0c             	sub    $0xc,%esp
+    2508:	68 00 04 00 00       	push   $0x400
+    250d:	e8 de 07 00 00       	call   2cf0 <malloc>
+    2512:	83 c4 10             	add    $0x10,%esp
+    2515:	89 43 18             	mov    %eax,0x18(%ebx)
+    2518:	85 c0                	test   %eax,%eax
+    251a:	75 b1                	jne    24cd <setmode+0x1d>
+    f->mode = IONBF;
+    251c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    2523:	eb a8                	jmp    24cd <setmode+0x1d>
+    2525:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    252c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002530 <drain>:
+{
+    2530:	55                   	push   %ebp
+    2531:	89 e5                	mov    %esp,%ebp
+    2533:	57                   	push   %edi
+    2534:	56                   	push   %esi
+    2535:	53                   	push   %ebx
+    2536:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    2539:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    253c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    253f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    2546:	85 ff                	test   %edi,%edi
+    2548:	7f 0e                	jg     2558 <drain+0x28>
+  return 0;
+    254a:	31 c0                	xor    %eax,%eax
+}
+    254c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    254f:	5b                   	pop    %ebx
+    2550:	5e                   	pop    %esi
+    2551:	5f                   	pop    %edi
+    2552:	5d                   	pop    %ebp
+    2553:	c3                   	ret
+    2554:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    2558:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    255b:	8b 58 18             	mov    0x18(%eax),%ebx
+    255e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    2560:	eb 0e                	jmp    2570 <drain+0x40>
+    2562:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    2568:	29 c7                	sub    %eax,%edi
+    256a:	01 c3                	add    %eax,%ebx
+    256c:	85 ff                	test   %edi,%edi
+    256e:	7e da                	jle    254a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    2570:	83 ec 04             	sub    $0x4,%esp
+    2573:	57                   	push   %edi
+    2574:	53                   	push   %ebx
+    2575:	56                   	push   %esi
+    2576:	e8 c4 f9 ff ff       	call   1f3f <write>
+    257b:	83 c4 10             	add    $0x10,%esp
+    257e:	85 c0                	test   %eax,%eax
+    2580:	7f e6                	jg     2568 <drain+0x38>
+    f->err = 1;
+    2582:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2585:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    258c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2591:	eb b9                	jmp    254c <drain+0x1c>
+    2593:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    259a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000025a0 <flushall>:
+
+static void
+flushall(void)
+{
+    25a0:	55                   	push   %ebp
+    25a1:	89 e5                	mov    %esp,%ebp
+    25a3:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    25a4:	bb 20 39 00 00       	mov    $0x3920,%ebx
+{
+    25a9:	83 ec 04             	sub    $0x4,%esp
+    25ac:	eb 0d                	jmp    25bb <flushall+0x1b>
+    25ae:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    25b0:	83 c3 24             	add    $0x24,%ebx
+    25b3:	81 fb 60 3b 00 00    	cmp    $0x3b60,%ebx
+    25b9:	74 19                	je     25d4 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    25bb:	8b 43 08             	mov    0x8(%ebx),%eax
+    25be:	85 c0                	test   %eax,%eax
+    25c0:	74 ee                	je     25b0 <flushall+0x10>
+    25c2:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    25c4:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    25c7:	e8 64 ff ff ff       	call   2530 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    25cc:	81 fb 60 3b 00 00    	cmp    $0x3b60,%ebx
+    25d2:	75 e7                	jne    25bb <flushall+0x1b>
+}
+    25d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    25d7:	c9                   	leave
+    25d8:	c3                   	ret
+    25d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000025e0 <fflush>:
+{
+    25e0:	55                   	push   %ebp
+    25e1:	89 e5                	mov    %esp,%ebp
+    25e3:	57                   	push   %edi
+    25e4:	56                   	push   %esi
+    25e5:	53                   	push   %ebx
+    25e6:	83 ec 0c             	sub    $0xc,%esp
+    25e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    25ec:	85 c0                	test   %eax,%eax
+    25ee:	74 28                	je     2618 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    25f0:	8b 70 08             	mov    0x8(%eax),%esi
+    25f3:	85 f6                	test   %esi,%esi
+    25f5:	75 11                	jne    2608 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    25f7:	83 c4 0c             	add    $0xc,%esp
+    25fa:	89 f0                	mov    %esi,%eax
+    25fc:	5b                   	pop    %ebx
+    25fd:	5e                   	pop    %esi
+    25fe:	5f                   	pop    %edi
+    25ff:	5d                   	pop    %ebp
+    2600:	c3                   	ret
+    2601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2608:	83 c4 0c             	add    $0xc,%esp
+    260b:	5b                   	pop    %ebx
+    260c:	5e                   	pop    %esi
+    260d:	5f                   	pop    %edi
+    260e:	5d                   	pop    %ebp
+  return drain(f);
+    260f:	e9 1c ff ff ff       	jmp    2530 <drain>
+    2614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    2618:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    261a:	bb 20 39 00 00       	mov    $0x3920,%ebx
+        r = -1;
+    261f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    2624:	eb 15                	jmp    263b <fflush+0x5b>
+    2626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    262d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    2630:	83 c3 24             	add    $0x24,%ebx
+    2633:	81 fb 60 3b 00 00    	cmp    $0x3b60,%ebx
+    2639:	74 bc                	je     25f7 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    263b:	8b 43 08             	mov    0x8(%ebx),%eax
+    263e:	85 c0                	test   %eax,%eax
+    2640:	74 ee                	je     2630 <fflush+0x50>
+    2642:	89 d8                	mov    %ebx,%eax
+    2644:	e8 e7 fe ff ff       	call   2530 <drain>
+        r = -1;
+    2649:	85 c0                	test   %eax,%eax
+    264b:	0f 48 f7             	cmovs  %edi,%esi
+    264e:	eb e0                	jmp    2630 <fflush+0x50>
+
+00002650 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    2650:	55                   	push   %ebp
+    2651:	89 e5                	mov    %esp,%ebp
+    2653:	57                   	push   %edi
+    2654:	56                   	push   %esi
+    2655:	53                   	push   %ebx
+    2656:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    2659:	8b 55 0c             	mov    0xc(%ebp),%edx
+    265c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    2660:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    2663:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    2666:	85 d2                	test   %edx,%edx
+    2668:	0f 8e 26 01 00 00    	jle    2794 <fwrite+0x144>
+  if(!f->writable){
+    266e:	8b 46 08             	mov    0x8(%esi),%eax
+    2671:	85 c0                	test   %eax,%eax
+    2673:	0f 84 14 01 00 00    	je     278d <fwrite+0x13d>
+  setmode(f);
+    2679:	89 f0                	mov    %esi,%eax
+    267b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    267e:	e8 2d fe ff ff       	call   24b0 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    2683:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    2687:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    268a:	c7 05 c4 3b 00 00 a0 	movl   $0x25a0,0x3bc4
+    2691:	25 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    2694:	0f 84 b6 00 00 00    	je     2750 <fwrite+0x100>
+    269a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    26a0:	0f 8f aa 00 00 00    	jg     2750 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    26a6:	8b 46 20             	mov    0x20(%esi),%eax
+    26a9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    26ac:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    26ae:	3d 00 04 00 00       	cmp    $0x400,%eax
+    26b3:	74 6c                	je     2721 <fwrite+0xd1>
+    26b5:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    26b8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    26bb:	ba 00 04 00 00       	mov    $0x400,%edx
+    26c0:	29 c2                	sub    %eax,%edx
+    26c2:	39 ca                	cmp    %ecx,%edx
+    26c4:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    26c7:	85 d2                	test   %edx,%edx
+    26c9:	0f 8e d1 00 00 00    	jle    27a0 <fwrite+0x150>
+    26cf:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    26d2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    26d5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    26d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26df:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    26e0:	8d 50 01             	lea    0x1(%eax),%edx
+    26e3:	83 c3 01             	add    $0x1,%ebx
+    26e6:	8b 4e 18             	mov    0x18(%esi),%ecx
+    26e9:	89 56 20             	mov    %edx,0x20(%esi)
+    26ec:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    26f0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    26f3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    26f6:	b8 01 00 00 00       	mov    $0x1,%eax
+    26fb:	80 fa 0a             	cmp    $0xa,%dl
+    26fe:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    2701:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    2704:	39 cb                	cmp    %ecx,%ebx
+    2706:	75 d8                	jne    26e0 <fwrite+0x90>
+    2708:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    270b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    270e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    2711:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    2714:	85 db                	test   %ebx,%ebx
+    2716:	7e 19                	jle    2731 <fwrite+0xe1>
+    n -= k;
+    2718:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    271a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    271f:	75 97                	jne    26b8 <fwrite+0x68>
+    2721:	89 f0                	mov    %esi,%eax
+    2723:	e8 08 fe ff ff       	call   2530 <drain>
+    2728:	85 c0                	test   %eax,%eax
+    272a:	78 68                	js     2794 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    272c:	8b 46 20             	mov    0x20(%esi),%eax
+    272f:	eb 87                	jmp    26b8 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    2731:	3d 00 04 00 00       	cmp    $0x400,%eax
+    2736:	74 74                	je     27ac <fwrite+0x15c>
+    2738:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    273c:	75 04                	jne    2742 <fwrite+0xf2>
+    273e:	85 ff                	test   %edi,%edi
+    2740:	75 6a                	jne    27ac <fwrite+0x15c>
+    return nmemb;
+    2742:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    2745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2748:	5b                   	pop    %ebx
+    2749:	5e                   	pop    %esi
+    274a:	5f                   	pop    %edi
+    274b:	5d                   	pop    %ebp
+    274c:	c3                   	ret
+    274d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    2750:	89 f0                	mov    %esi,%eax
+    2752:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    2755:	e8 d6 fd ff ff       	call   2530 <drain>
+    275a:	85 c0                	test   %eax,%eax
+    275c:	78 2f                	js     278d <fwrite+0x13d>
+    275e:	89 75 14             	mov    %esi,0x14(%ebp)
+    2761:	8b 3e                	mov    (%esi),%edi
+    2763:	89 de                	mov    %ebx,%esi
+    2765:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    2768:	eb 0e                	jmp    2778 <fwrite+0x128>
+    276a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    2770:	29 c3                	sub    %eax,%ebx
+    2772:	01 c6                	add    %eax,%esi
+    2774:	85 db                	test   %ebx,%ebx
+    2776:	7e ca                	jle    2742 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    2778:	83 ec 04             	sub    $0x4,%esp
+    277b:	53                   	push   %ebx
+    277c:	56                   	push   %esi
+    277d:	57                   	push   %edi
+    277e:	e8 bc f7 ff ff       	call   1f3f <write>
+    2783:	83 c4 10             	add    $0x10,%esp
+    2786:	85 c0                	test   %eax,%eax
+    2788:	7f e6                	jg     2770 <fwrite+0x120>
+    278a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    278d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    2794:	31 c0                	xor    %eax,%eax
+}
+    2796:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2799:	5b                   	pop    %ebx
+    279a:	5e                   	pop    %esi
+    279b:	5f                   	pop    %edi
+    279c:	5d                   	pop    %ebp
+    279d:	c3                   	ret
+    279e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    27a0:	89 d9                	mov    %ebx,%ecx
+    27a2:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    27a5:	89 cb                	mov    %ecx,%ebx
+    27a7:	e9 6e ff ff ff       	jmp    271a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    27ac:	89 f0                	mov    %esi,%eax
+    27ae:	e8 7d fd ff ff       	call   2530 <drain>
+    27b3:	85 c0                	test   %eax,%eax
+    27b5:	79 8b                	jns    2742 <fwrite+0xf2>
+    return 0;
+    27b7:	31 c0                	xor    %eax,%eax
+    27b9:	eb db                	jmp    2796 <fwrite+0x146>
+    27bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    27bf:	90                   	nop
+
+000027c0 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    27c0:	55                   	push   %ebp
+    27c1:	89 e5                	mov    %esp,%ebp
+    27c3:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    27c6:	8b 45 08             	mov    0x8(%ebp),%eax
+    27c9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    27cc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    27cf:	ff 75 0c             	push   0xc(%ebp)
+    27d2:	6a 01                	push   $0x1
+    27d4:	6a 01                	push   $0x1
+    27d6:	50                   	push   %eax
+    27d7:	e8 74 fe ff ff       	call   2650 <fwrite>
+    27dc:	83 c4 10             	add    $0x10,%esp
+    27df:	83 f8 01             	cmp    $0x1,%eax
+    27e2:	75 0c                	jne    27f0 <fputc+0x30>
+    27e4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    27e8:	c9                   	leave
+    27e9:	c3                   	ret
+    27ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    27f0:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    27f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    27f6:	c3                   	ret
+    27f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27fe:	66 90                	xchg   %ax,%ax
+
+00002800 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    2800:	55                   	push   %ebp
+    2801:	89 e5                	mov    %esp,%ebp
+    2803:	57                   	push   %edi
+    2804:	56                   	push   %esi
+    2805:	53                   	push   %ebx
+    2806:	83 ec 1c             	sub    $0x1c,%esp
+    2809:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    280c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    280f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    2812:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    2815:	85 d2                	test   %edx,%edx
+    2817:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    281a:	7e 12                	jle    282e <fread+0x2e>
+    281c:	85 ff                	test   %edi,%edi
+    281e:	7e 0e                	jle    282e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    2820:	8b 43 04             	mov    0x4(%ebx),%eax
+    2823:	85 c0                	test   %eax,%eax
+    2825:	75 19                	jne    2840 <fread+0x40>
+    f->err = 1;
+    2827:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    282e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    2831:	31 c0                	xor    %eax,%eax
+}
+    2833:	5b                   	pop    %ebx
+    2834:	5e                   	pop    %esi
+    2835:	5f                   	pop    %edi
+    2836:	5d                   	pop    %ebp
+    2837:	c3                   	ret
+    2838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    283f:	90                   	nop
+  setmode(f);
+    2840:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    2842:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    2844:	e8 67 fc ff ff       	call   24b0 <setmode>
+  for(n = 0; n < want; n += k){
+    2849:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    284c:	89 f7                	mov    %esi,%edi
+    284e:	eb 31                	jmp    2881 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    2850:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    2854:	74 08                	je     285e <fread+0x5e>
+    2856:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    285c:	7e 62                	jle    28c0 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    285e:	83 ec 04             	sub    $0x4,%esp
+    2861:	56                   	push   %esi
+    2862:	8b 45 08             	mov    0x8(%ebp),%eax
+    2865:	01 f8                	add    %edi,%eax
+    2867:	50                   	push   %eax
+    2868:	ff 33                	push   (%ebx)
+    286a:	e8 c1 f6 ff ff       	call   1f30 <read>
+    286f:	83 c4 10             	add    $0x10,%esp
+    2872:	85 c0                	test   %eax,%eax
+    2874:	0f 8e ce 00 00 00    	jle    2948 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    287a:	01 c7                	add    %eax,%edi
+    287c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    287f:	7e 36                	jle    28b7 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2881:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    2884:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    2887:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    288a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    288c:	39 c1                	cmp    %eax,%ecx
+    288e:	7d c0                	jge    2850 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    2890:	29 c8                	sub    %ecx,%eax
+    2892:	39 f0                	cmp    %esi,%eax
+    2894:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    2897:	83 ec 04             	sub    $0x4,%esp
+    289a:	56                   	push   %esi
+    289b:	03 4b 18             	add    0x18(%ebx),%ecx
+    289e:	51                   	push   %ecx
+    289f:	8b 45 08             	mov    0x8(%ebp),%eax
+    28a2:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    28a4:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    28a6:	50                   	push   %eax
+    28a7:	e8 34 f5 ff ff       	call   1de0 <memmove>
+      f->r += k;
+    28ac:	01 73 1c             	add    %esi,0x1c(%ebx)
+    28af:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    28b2:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    28b5:	7f ca                	jg     2881 <fread+0x81>
+    28b7:	89 fe                	mov    %edi,%esi
+    28b9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    28bc:	eb 3f                	jmp    28fd <fread+0xfd>
+    28be:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    28c0:	3b 1d 08 39 00 00    	cmp    0x3908,%ebx
+    28c6:	74 68                	je     2930 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    28c8:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    28cb:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    28d2:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    28d9:	68 00 04 00 00       	push   $0x400
+    28de:	ff 73 18             	push   0x18(%ebx)
+    28e1:	ff 33                	push   (%ebx)
+    28e3:	e8 48 f6 ff ff       	call   1f30 <read>
+    28e8:	83 c4 10             	add    $0x10,%esp
+    28eb:	85 c0                	test   %eax,%eax
+    28ed:	78 21                	js     2910 <fread+0x110>
+  else if(n == 0)
+    28ef:	75 2f                	jne    2920 <fread+0x120>
+    f->eof = 1;
+    28f1:	89 fe                	mov    %edi,%esi
+    28f3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    28f6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    28fd:	89 f0                	mov    %esi,%eax
+}
+    28ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    2902:	99                   	cltd
+}
+    2903:	5b                   	pop    %ebx
+    2904:	5e                   	pop    %esi
+  return n / size;
+    2905:	f7 ff                	idiv   %edi
+}
+    2907:	5f                   	pop    %edi
+    2908:	5d                   	pop    %ebp
+    2909:	c3                   	ret
+    290a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    2910:	89 fe                	mov    %edi,%esi
+    2912:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    2915:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    291c:	eb df                	jmp    28fd <fread+0xfd>
+    291e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    2920:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    2923:	e9 54 ff ff ff       	jmp    287c <fread+0x7c>
+    2928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    292f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    2930:	83 ec 0c             	sub    $0xc,%esp
+    2933:	ff 35 04 39 00 00    	push   0x3904
+    2939:	e8 a2 fc ff ff       	call   25e0 <fflush>
+    293e:	83 c4 10             	add    $0x10,%esp
+    2941:	eb 85                	jmp    28c8 <fread+0xc8>
+    2943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2947:	90                   	nop
+        if(k < 0)
+    2948:	89 fe                	mov    %edi,%esi
+    294a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    294d:	74 a7                	je     28f6 <fread+0xf6>
+    294f:	eb c4                	jmp    2915 <fread+0x115>
+    2951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    295f:	90                   	nop
+
+00002960 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    2960:	55                   	push   %ebp
+    2961:	89 e5                	mov    %esp,%ebp
+    2963:	53                   	push   %ebx
+    2964:	83 ec 14             	sub    $0x14,%esp
+    2967:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    296a:	8b 50 04             	mov    0x4(%eax),%edx
+    296d:	85 d2                	test   %edx,%edx
+    296f:	74 08                	je     2979 <fgetc+0x19>
+    2971:	8b 50 1c             	mov    0x1c(%eax),%edx
+    2974:	3b 50 20             	cmp    0x20(%eax),%edx
+    2977:	7c 27                	jl     29a0 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2979:	50                   	push   %eax
+    297a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    297d:	6a 01                	push   $0x1
+    297f:	6a 01                	push   $0x1
+    2981:	50                   	push   %eax
+    2982:	e8 79 fe ff ff       	call   2800 <fread>
+    2987:	83 c4 10             	add    $0x10,%esp
+    298a:	83 f8 01             	cmp    $0x1,%eax
+    298d:	75 29                	jne    29b8 <fgetc+0x58>
+    298f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    2993:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2996:	c9                   	leave
+    2997:	c3                   	ret
+    2998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    299f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    29a0:	8b 48 18             	mov    0x18(%eax),%ecx
+    29a3:	8d 5a 01             	lea    0x1(%edx),%ebx
+    29a6:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    29a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    29ac:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    29b0:	c9                   	leave
+    29b1:	c3                   	ret
+    29b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    29b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    29bd:	eb d4                	jmp    2993 <fgetc+0x33>
+    29bf:	90                   	nop
+
+000029c0 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    29c0:	55                   	push   %ebp
+    29c1:	89 e5                	mov    %esp,%ebp
+    29c3:	57                   	push   %edi
+    29c4:	56                   	push   %esi
+    29c5:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    29c6:	31 db                	xor    %ebx,%ebx
+{
+    29c8:	83 ec 1c             	sub    $0x1c,%esp
+    29cb:	8b 75 10             	mov    0x10(%ebp),%esi
+    29ce:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    29d0:	eb 2e                	jmp    2a00 <fgets+0x40>
+    29d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    29d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    29db:	57                   	push   %edi
+    29dc:	6a 01                	push   $0x1
+    29de:	6a 01                	push   $0x1
+    29e0:	50                   	push   %eax
+    29e1:	e8 1a fe ff ff       	call   2800 <fread>
+    29e6:	83 c4 10             	add    $0x10,%esp
+    29e9:	83 f8 01             	cmp    $0x1,%eax
+    29ec:	75 62                	jne    2a50 <fgets+0x90>
+    29ee:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    29f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    29f5:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    29f7:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    29fb:	83 f9 0a             	cmp    $0xa,%ecx
+    29fe:	74 34                	je     2a34 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    2a00:	89 de                	mov    %ebx,%esi
+    2a02:	83 c3 01             	add    $0x1,%ebx
+    2a05:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    2a08:	7d 46                	jge    2a50 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    2a0a:	8b 47 04             	mov    0x4(%edi),%eax
+    2a0d:	85 c0                	test   %eax,%eax
+    2a0f:	74 c7                	je     29d8 <fgets+0x18>
+    2a11:	8b 47 1c             	mov    0x1c(%edi),%eax
+    2a14:	3b 47 20             	cmp    0x20(%edi),%eax
+    2a17:	7d bf                	jge    29d8 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    2a19:	8b 4f 18             	mov    0x18(%edi),%ecx
+    2a1c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    2a1f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    2a22:	89 77 1c             	mov    %esi,0x1c(%edi)
+    2a25:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    2a29:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    2a2b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    2a2f:	83 f9 0a             	cmp    $0xa,%ecx
+    2a32:	75 cc                	jne    2a00 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2a34:	8b 45 08             	mov    0x8(%ebp),%eax
+    2a37:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    2a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2a3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2a41:	5b                   	pop    %ebx
+    2a42:	5e                   	pop    %esi
+    2a43:	5f                   	pop    %edi
+    2a44:	5d                   	pop    %ebp
+    2a45:	c3                   	ret
+    2a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a4d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2a50:	8b 45 08             	mov    0x8(%ebp),%eax
+    2a53:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2a57:	31 c0                	xor    %eax,%eax
+    2a59:	85 f6                	test   %esi,%esi
+    2a5b:	74 e1                	je     2a3e <fgets+0x7e>
+    2a5d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2a60:	eb dc                	jmp    2a3e <fgets+0x7e>
+    2a62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002a70 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    2a70:	55                   	push   %ebp
+    2a71:	89 e5                	mov    %esp,%ebp
+    2a73:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2a74:	bb 20 39 00 00       	mov    $0x3920,%ebx
+{
+    2a79:	83 ec 04             	sub    $0x4,%esp
+    2a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    2a80:	8b 53 04             	mov    0x4(%ebx),%edx
+    2a83:	85 d2                	test   %edx,%edx
+    2a85:	75 07                	jne    2a8e <fdopen+0x1e>
+    2a87:	8b 43 08             	mov    0x8(%ebx),%eax
+    2a8a:	85 c0                	test   %eax,%eax
+    2a8c:	74 1a                	je     2aa8 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2a8e:	83 c3 24             	add    $0x24,%ebx
+    2a91:	81 fb 60 3b 00 00    	cmp    $0x3b60,%ebx
+    2a97:	75 e7                	jne    2a80 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2a99:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    2a9b:	89 d8                	mov    %ebx,%eax
+    2a9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2aa0:	c9                   	leave
+    2aa1:	c3                   	ret
+    2aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2aa8:	81 fb 60 3b 00 00    	cmp    $0x3b60,%ebx
+    2aae:	74 e9                	je     2a99 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2ab0:	83 ec 04             	sub    $0x4,%esp
+    2ab3:	6a 24                	push   $0x24
+    2ab5:	6a 00                	push   $0x0
+    2ab7:	53                   	push   %ebx
+    2ab8:	e8 d3 f1 ff ff       	call   1c90 <memset>
+  f->fd = fd;
+    2abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2ac0:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2ac7:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    2aca:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    2acc:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2acf:	80 38 72             	cmpb   $0x72,(%eax)
+    2ad2:	74 14                	je     2ae8 <fdopen+0x78>
+    f->writable = 1;
+    2ad4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    2adb:	89 d8                	mov    %ebx,%eax
+    2add:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ae0:	c9                   	leave
+    2ae1:	c3                   	ret
+    2ae2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2ae8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    2aef:	89 d8                	mov    %ebx,%eax
+    2af1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2af4:	c9                   	leave
+    2af5:	c3                   	ret
+    2af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2afd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002b00 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2b00:	55                   	push   %ebp
+    2b01:	89 e5                	mov    %esp,%ebp
+    2b03:	56                   	push   %esi
+    2b04:	53                   	push   %ebx
+    2b05:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2b08:	0f b6 06             	movzbl (%esi),%eax
+    2b0b:	3c 72                	cmp    $0x72,%al
+    2b0d:	74 61                	je     2b70 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    2b0f:	3c 77                	cmp    $0x77,%al
+    2b11:	74 7d                	je     2b90 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2b13:	3c 61                	cmp    $0x61,%al
+    2b15:	75 49                	jne    2b60 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2b17:	83 ec 08             	sub    $0x8,%esp
+    2b1a:	68 01 02 00 00       	push   $0x201
+    2b1f:	ff 75 08             	push   0x8(%ebp)
+    2b22:	e8 54 f4 ff ff       	call   1f7b <open>
+    2b27:	83 c4 10             	add    $0x10,%esp
+    2b2a:	89 c3                	mov    %eax,%ebx
+    2b2c:	85 c0                	test   %eax,%eax
+    2b2e:	78 30                	js     2b60 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2b30:	83 ec 04             	sub    $0x4,%esp
+    2b33:	6a 02                	push   $0x2
+    2b35:	6a 00                	push   $0x0
+    2b37:	50                   	push   %eax
+    2b38:	e8 4c f5 ff ff       	call   2089 <lseek>
+    2b3d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2b40:	83 ec 08             	sub    $0x8,%esp
+    2b43:	56                   	push   %esi
+    2b44:	53                   	push   %ebx
+    2b45:	e8 26 ff ff ff       	call   2a70 <fdopen>
+    2b4a:	83 c4 10             	add    $0x10,%esp
+    2b4d:	85 c0                	test   %eax,%eax
+    2b4f:	75 11                	jne    2b62 <fopen+0x62>
+    close(fd);
+    2b51:	83 ec 0c             	sub    $0xc,%esp
+    2b54:	53                   	push   %ebx
+    2b55:	e8 f4 f3 ff ff       	call   1f4e <close>
+    2b5a:	83 c4 10             	add    $0x10,%esp
+    2b5d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2b60:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2b62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2b65:	5b                   	pop    %ebx
+    2b66:	5e                   	pop    %esi
+    2b67:	5d                   	pop    %ebp
+    2b68:	c3                   	ret
+    2b69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2b70:	83 ec 08             	sub    $0x8,%esp
+    2b73:	6a 00                	push   $0x0
+    2b75:	ff 75 08             	push   0x8(%ebp)
+    2b78:	e8 fe f3 ff ff       	call   1f7b <open>
+    2b7d:	83 c4 10             	add    $0x10,%esp
+    2b80:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2b82:	85 db                	test   %ebx,%ebx
+    2b84:	78 da                	js     2b60 <fopen+0x60>
+    2b86:	eb b8                	jmp    2b40 <fopen+0x40>
+    2b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b8f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2b90:	83 ec 08             	sub    $0x8,%esp
+    2b93:	68 01 06 00 00       	push   $0x601
+    2b98:	ff 75 08             	push   0x8(%ebp)
+    2b9b:	e8 db f3 ff ff       	call   1f7b <open>
+    2ba0:	83 c4 10             	add    $0x10,%esp
+    2ba3:	89 c3                	mov    %eax,%ebx
+    2ba5:	eb db                	jmp    2b82 <fopen+0x82>
+    2ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bae:	66 90                	xchg   %ax,%ax
+
+00002bb0 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2bb0:	55                   	push   %ebp
+    2bb1:	89 e5                	mov    %esp,%ebp
+    2bb3:	56                   	push   %esi
+    2bb4:	53                   	push   %ebx
+    2bb5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2bb8:	83 ec 0c             	sub    $0xc,%esp
+    2bbb:	53                   	push   %ebx
+    2bbc:	e8 1f fa ff ff       	call   25e0 <fflush>
+    2bc1:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2bc3:	58                   	pop    %eax
+    2bc4:	ff 33                	push   (%ebx)
+    2bc6:	e8 83 f3 ff ff       	call   1f4e <close>
+    2bcb:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    2bce:	85 c0                	test   %eax,%eax
+    2bd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2bd5:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2bd8:	8b 43 18             	mov    0x18(%ebx),%eax
+    2bdb:	85 c0                	test   %eax,%eax
+    2bdd:	0f 95 c1             	setne  %cl
+    2be0:	3d e0 3f 00 00       	cmp    $0x3fe0,%eax
+    2be5:	0f 95 c2             	setne  %dl
+    2be8:	84 d1                	test   %dl,%cl
+    2bea:	74 07                	je     2bf3 <fclose+0x43>
+    2bec:	3d e0 3b 00 00       	cmp    $0x3be0,%eax
+    2bf1:	75 25                	jne    2c18 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2bf3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    2bfa:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    2bfc:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2c03:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    2c0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2c0d:	5b                   	pop    %ebx
+    2c0e:	5e                   	pop    %esi
+    2c0f:	5d                   	pop    %ebp
+    2c10:	c3                   	ret
+    2c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2c18:	83 ec 0c             	sub    $0xc,%esp
+    2c1b:	50                   	push   %eax
+    2c1c:	e8 3f 00 00 00       	call   2c60 <free>
+    2c21:	83 c4 10             	add    $0x10,%esp
+    2c24:	eb cd                	jmp    2bf3 <fclose+0x43>
+    2c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002c30 <feof>:
+
+int
+feof(FILE *f)
+{
+    2c30:	55                   	push   %ebp
+    2c31:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2c33:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2c36:	5d                   	pop    %ebp
+  return f->eof;
+    2c37:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    2c3a:	c3                   	ret
+    2c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c3f:	90                   	nop
+
+00002c40 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2c40:	55                   	push   %ebp
+    2c41:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2c43:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2c46:	5d                   	pop    %ebp
+  return f->err;
+    2c47:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    2c4a:	c3                   	ret
+    2c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c4f:	90                   	nop
+
+00002c50 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2c50:	55                   	push   %ebp
+    2c51:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2c53:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2c56:	5d                   	pop    %ebp
+  return f->fd;
+    2c57:	8b 00                	mov    (%eax),%eax
+}
+    2c59:	c3                   	ret
+    2c5a:	66 90                	xchg   %ax,%ax
+    2c5c:	66 90                	xchg   %ax,%ax
+    2c5e:	66 90                	xchg   %ax,%ax
+
+00002c60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2c60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2c61:	a1 e0 43 00 00       	mov    0x43e0,%eax
+{
+    2c66:	89 e5                	mov    %esp,%ebp
+    2c68:	57                   	push   %edi
+    2c69:	56                   	push   %esi
+    2c6a:	53                   	push   %ebx
+    2c6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    2c6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2c7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2c7c:	39 ca                	cmp    %ecx,%edx
+    2c7e:	73 30                	jae    2cb0 <free+0x50>
+    2c80:	39 c1                	cmp    %eax,%ecx
+    2c82:	72 04                	jb     2c88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2c84:	39 c2                	cmp    %eax,%edx
+    2c86:	72 f0                	jb     2c78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2c88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    2c8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    2c8e:	39 f8                	cmp    %edi,%eax
+    2c90:	74 2e                	je     2cc0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2c92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2c95:	8b 42 04             	mov    0x4(%edx),%eax
+    2c98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2c9b:	39 f1                	cmp    %esi,%ecx
+    2c9d:	74 38                	je     2cd7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    2c9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2ca1:	5b                   	pop    %ebx
+  freep = p;
+    2ca2:	89 15 e0 43 00 00    	mov    %edx,0x43e0
+}
+    2ca8:	5e                   	pop    %esi
+    2ca9:	5f                   	pop    %edi
+    2caa:	5d                   	pop    %ebp
+    2cab:	c3                   	ret
+    2cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2cb0:	39 c1                	cmp    %eax,%ecx
+    2cb2:	72 d0                	jb     2c84 <free+0x24>
+    2cb4:	eb c2                	jmp    2c78 <free+0x18>
+    2cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2cbd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2cc0:	03 70 04             	add    0x4(%eax),%esi
+    2cc3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2cc6:	8b 02                	mov    (%edx),%eax
+    2cc8:	8b 00                	mov    (%eax),%eax
+    2cca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    2ccd:	8b 42 04             	mov    0x4(%edx),%eax
+    2cd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2cd3:	39 f1                	cmp    %esi,%ecx
+    2cd5:	75 c8                	jne    2c9f <free+0x3f>
+    p->s.size += bp->s.size;
+    2cd7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    2cda:	89 15 e0 43 00 00    	mov    %edx,0x43e0
+    p->s.size += bp->s.size;
+    2ce0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2ce3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2ce6:	89 0a                	mov    %ecx,(%edx)
+}
+    2ce8:	5b                   	pop    %ebx
+    2ce9:	5e                   	pop    %esi
+    2cea:	5f                   	pop    %edi
+    2ceb:	5d                   	pop    %ebp
+    2cec:	c3                   	ret
+    2ced:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002cf0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2cf0:	55                   	push   %ebp
+    2cf1:	89 e5                	mov    %esp,%ebp
+    2cf3:	57                   	push   %edi
+    2cf4:	56                   	push   %esi
+    2cf5:	53                   	push   %ebx
+    2cf6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    2cfc:	8b 15 e0 43 00 00    	mov    0x43e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2d02:	8d 78 07             	lea    0x7(%eax),%edi
+    2d05:	c1 ef 03             	shr    $0x3,%edi
+    2d08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    2d0b:	85 d2                	test   %edx,%edx
+    2d0d:	0f 84 8d 00 00 00    	je     2da0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2d13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2d15:	8b 48 04             	mov    0x4(%eax),%ecx
+    2d18:	39 f9                	cmp    %edi,%ecx
+    2d1a:	73 64                	jae    2d80 <malloc+0x90>
+  if(nu < 4096)
+    2d1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2d21:	39 df                	cmp    %ebx,%edi
+    2d23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2d26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    2d2d:	eb 0a                	jmp    2d39 <malloc+0x49>
+    2d2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2d30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2d32:	8b 48 04             	mov    0x4(%eax),%ecx
+    2d35:	39 f9                	cmp    %edi,%ecx
+    2d37:	73 47                	jae    2d80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2d39:	89 c2                	mov    %eax,%edx
+    2d3b:	39 05 e0 43 00 00    	cmp    %eax,0x43e0
+    2d41:	75 ed                	jne    2d30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2d43:	83 ec 0c             	sub    $0xc,%esp
+    2d46:	56                   	push   %esi
+    2d47:	e8 b6 f2 ff ff       	call   2002 <sbrk>
+  if(p == (char*)-1)
+    2d4c:	83 c4 10             	add    $0x10,%esp
+    2d4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2d52:	74 1c                	je     2d70 <malloc+0x80>
+  hp->s.size = nu;
+    2d54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2d57:	83 ec 0c             	sub    $0xc,%esp
+    2d5a:	83 c0 08             	add    $0x8,%eax
+    2d5d:	50                   	push   %eax
+    2d5e:	e8 fd fe ff ff       	call   2c60 <free>
+  return freep;
+    2d63:	8b 15 e0 43 00 00    	mov    0x43e0,%edx
+      if((p = morecore(nunits)) == 0)
+    2d69:	83 c4 10             	add    $0x10,%esp
+    2d6c:	85 d2                	test   %edx,%edx
+    2d6e:	75 c0                	jne    2d30 <malloc+0x40>
+        return 0;
+  }
+}
+    2d70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2d73:	31 c0                	xor    %eax,%eax
+}
+    2d75:	5b                   	pop    %ebx
+    2d76:	5e                   	pop    %esi
+    2d77:	5f                   	pop    %edi
+    2d78:	5d                   	pop    %ebp
+    2d79:	c3                   	ret
+    2d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2d80:	39 cf                	cmp    %ecx,%edi
+    2d82:	74 4c                	je     2dd0 <malloc+0xe0>
+        p->s.size -= nunits;
+    2d84:	29 f9                	sub    %edi,%ecx
+    2d86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2d89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    2d8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    2d8f:	89 15 e0 43 00 00    	mov    %edx,0x43e0
+}
+    2d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2d98:	83 c0 08             	add    $0x8,%eax
+}
+    2d9b:	5b                   	pop    %ebx
+    2d9c:	5e                   	pop    %esi
+    2d9d:	5f                   	pop    %edi
+    2d9e:	5d                   	pop    %ebp
+    2d9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2da0:	c7 05 e0 43 00 00 e4 	movl   $0x43e4,0x43e0
+    2da7:	43 00 00 
+    base.s.size = 0;
+    2daa:	b8 e4 43 00 00       	mov    $0x43e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    2daf:	c7 05 e4 43 00 00 e4 	movl   $0x43e4,0x43e4
+    2db6:	43 00 00 
+    base.s.size = 0;
+    2db9:	c7 05 e8 43 00 00 00 	movl   $0x0,0x43e8
+    2dc0:	00 00 00 
+    if(p->s.size >= nunits){
+    2dc3:	e9 54 ff ff ff       	jmp    2d1c <malloc+0x2c>
+    2dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2dcf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2dd0:	8b 08                	mov    (%eax),%ecx
+    2dd2:	89 0a                	mov    %ecx,(%edx)
+    2dd4:	eb b9                	jmp    2d8f <malloc+0x9f>
@@ -0,0 +1,321 @@
+// Buffered streams over file descriptors.
+//
+// Output to the console is line buffered and output to files
+// and pipes fully buffered; stderr is unbuffered, but printf()
+// and fwrite() still hand it each call's bytes in one write().
+// exit(), fork() and exec() flush every stream first.
+
+#include "types.h"
+#include "stat.h"
+#include "fcntl.h"
+#include "user.h"
+
+#define BUFSIZ  1024
+#define NSTREAM 16    // open streams, as NOFILE
+
+// Buffering modes.
+#define IOFBF  0      // write when the buffer fills
+#define IOLBF  1      // write at the end of each line
+#define IONBF  2      // write at the end of each call
+#define IOWAIT (-1)   // decide on first use, with fstat()
+
+struct iobuf {
+  int fd;
+  int readable;
+  int writable;
+  int mode;
+  int eof;
+  int err;
+  char *buf;
+  int r;        // next byte to read from buf
+  int n;        // bytes in buf, read ahead or waiting to be written
+};
+
+static char stdinbuf[BUFSIZ], stdoutbuf[BUFSIZ];
+
+static struct iobuf streams[NSTREAM] = {
+  { 0, 1, 0, IOWAIT, 0, 0, stdinbuf },
+  { 1, 0, 1, IOWAIT, 0, 0, stdoutbuf },
+  { 2, 0, 1, IONBF },
+};
+
+FILE *stdin = &streams[0];
+FILE *stdout = &streams[1];
+FILE *stderr = &streams[2];
+
+// Write n bytes from p to fd, however many write()s it takes.
+static int
+writeall(int fd, const char *p, int n)
+{
+  int k;
+
+  for(; n > 0; p += k, n -= k)
+    if((k = write(fd, p, n)) <= 0)
+      return -1;
+  return 0;
+}
+
+// Write out f's buffer.
+static int
+drain(FILE *f)
+{
+  int n;
+
+  n = f->n;
+  f->n = 0;
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    f->err = 1;
+    return -1;
+  }
+  return 0;
+}
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    f->mode = IONBF;
+}
+
+static void
+flushall(void)
+{
+  fflush(0);
+}
+
+// Get f ready to take output.
+static int
+wsetup(FILE *f)
+{
+  if(!f->writable){
+    f->err = 1;
+    return -1;
+  }
+  setmode(f);
+  flushhook = flushall;
+  return 0;
+}
+
+int
+fflush(FILE *f)
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+      if(f->writable && drain(f) < 0)
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    return 0;
+  return drain(f);
+}
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+  if(n <= 0 || wsetup(f) < 0)
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    // Too big to be worth copying.
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+      f->err = 1;
+      return 0;
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    for(i = 0; i < k; i++)
+      if((f->buf[f->n++] = *p++) == '\n')
+        nl = 1;
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    return 0;
+  return nmemb;
+}
+
+int
+fputc(int c, FILE *f)
+{
+  char ch;
+
+  ch = c;
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+}
+
+// Read more into f's buffer; returns how much.
+static int
+fill(FILE *f)
+{
+  int n;
+
+  if(f == stdin)
+    fflush(stdout);  // show any prompt first
+  f->r = f->n = 0;
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    f->err = 1;
+  else if(n == 0)
+    f->eof = 1;
+  else
+    f->n = n;
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+  if(want <= 0 || size <= 0)
+    return 0;
+  if(!f->readable){
+    f->err = 1;
+    return 0;
+  }
+  setmode(f);
+  for(n = 0; n < want; n += k){
+    if(f->r < f->n){
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+      memmove(p + n, f->buf + f->r, k);
+      f->r += k;
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+      // Big enough to read in place.
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+        if(k < 0)
+          f->err = 1;
+        else
+          f->eof = 1;
+        break;
+      }
+    } else if((k = fill(f)) <= 0)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+
+int
+fgetc(FILE *f)
+{
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+}
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    if(c == '\n')
+      break;
+  }
+  buf[i] = '\0';
+  return i > 0 ? buf : 0;
+}
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    if(!f->readable && !f->writable)
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+  memset(f, 0, sizeof(*f));
+  f->fd = fd;
+  f->mode = IOWAIT;
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+      lseek(fd, 0, SEEK_END);
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    close(fd);
+  return f;
+}
+
+int
+fclose(FILE *f)
+{
+  int r;
+
+  r = fflush(f);
+  if(close(f->fd) < 0)
+    r = -1;
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    free(f->buf);
+  f->buf = 0;
+  f->readable = f->writable = 0;
+  return r;
+}
+
+int
+feof(FILE *f)
+{
+  return f->eof;
+}
+
+int
+ferror(FILE *f)
+{
+  return f->err;
+}
+
+int
+fileno(FILE *f)
+{
+  return f->fd;
+}
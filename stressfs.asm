@@ -0,0 +1,2875 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i, n, start;
+  char path[] = "stressfs0";
+    1007:	ba 30 00 00 00       	mov    $0x30,%edx
+{
+    100c:	ff 71 fc             	push   -0x4(%ecx)
+    100f:	55                   	push   %ebp
+    1010:	89 e5                	mov    %esp,%ebp
+    1012:	57                   	push   %edi
+    1013:	56                   	push   %esi
+    1014:	53                   	push   %ebx
+    1015:	51                   	push   %ecx
+    1016:	81 ec 28 02 00 00    	sub    $0x228,%esp
+  char data[512];
+
+  n = 20;
+  if(argc > 1)
+    101c:	83 39 01             	cmpl   $0x1,(%ecx)
+  char path[] = "stressfs0";
+    101f:	66 89 95 e6 fd ff ff 	mov    %dx,-0x21a(%ebp)
+    1026:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+    102d:	74 72 65 
+{
+    1030:	8b 41 04             	mov    0x4(%ecx),%eax
+  char path[] = "stressfs0";
+    1033:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+    103a:	73 66 73 
+  n = 20;
+    103d:	c7 85 d4 fd ff ff 14 	movl   $0x14,-0x22c(%ebp)
+    1044:	00 00 00 
+  if(argc > 1)
+    1047:	7e 14                	jle    105d <main+0x5d>
+    n = atoi(argv[1]);
+    1049:	83 ec 0c             	sub    $0xc,%esp
+    104c:	ff 70 04             	push   0x4(%eax)
+    104f:	e8 8c 03 00 00       	call   13e0 <atoi>
+    1054:	83 c4 10             	add    $0x10,%esp
+    1057:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+
+  printf(1, "stressfs starting\n");
+    105d:	83 ec 08             	sub    $0x8,%esp
+  memset(data, 'a', sizeof(data));
+    1060:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+  start = uptime();
+
+  for(i = 0; i < 4; i++)
+    1066:	31 db                	xor    %ebx,%ebx
+  printf(1, "stressfs starting\n");
+    1068:	68 18 24 00 00       	push   $0x2418
+    106d:	6a 01                	push   $0x1
+    106f:	e8 ec 09 00 00       	call   1a60 <printf>
+  memset(data, 'a', sizeof(data));
+    1074:	83 c4 0c             	add    $0xc,%esp
+    1077:	68 00 02 00 00       	push   $0x200
+    107c:	6a 61                	push   $0x61
+    107e:	56                   	push   %esi
+    107f:	e8 4c 02 00 00       	call   12d0 <memset>
+  start = uptime();
+    1084:	e8 d7 05 00 00       	call   1660 <uptime>
+    1089:	83 c4 10             	add    $0x10,%esp
+    108c:	89 85 cc fd ff ff    	mov    %eax,-0x234(%ebp)
+    if(fork() > 0)
+    1092:	e8 29 04 00 00       	call   14c0 <fork>
+    1097:	85 c0                	test   %eax,%eax
+    1099:	7f 08                	jg     10a3 <main+0xa3>
+  for(i = 0; i < 4; i++)
+    109b:	83 c3 01             	add    $0x1,%ebx
+    109e:	83 fb 04             	cmp    $0x4,%ebx
+    10a1:	75 ef                	jne    1092 <main+0x92>
+      break;
+
+  printf(1, "write %d\n", i);
+    10a3:	83 ec 04             	sub    $0x4,%esp
+    10a6:	53                   	push   %ebx
+    10a7:	68 2b 24 00 00       	push   $0x242b
+    10ac:	6a 01                	push   $0x1
+    10ae:	e8 ad 09 00 00       	call   1a60 <printf>
+
+  path[8] += i;
+    10b3:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+    10b9:	5f                   	pop    %edi
+    10ba:	58                   	pop    %eax
+    10bb:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+    10c1:	68 02 02 00 00       	push   $0x202
+    10c6:	50                   	push   %eax
+    10c7:	e8 ef 04 00 00       	call   15bb <open>
+  for(i = 0; i < n; i++)
+    10cc:	83 c4 10             	add    $0x10,%esp
+  fd = open(path, O_CREATE | O_RDWR);
+    10cf:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+    10d1:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+    10d7:	85 c0                	test   %eax,%eax
+    10d9:	0f 8e ff 00 00 00    	jle    11de <main+0x1de>
+    10df:	31 db                	xor    %ebx,%ebx
+    10e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+    10e8:	83 ec 04             	sub    $0x4,%esp
+    10eb:	68 00 02 00 00       	push   $0x200
+    10f0:	56                   	push   %esi
+    10f1:	57                   	push   %edi
+    10f2:	e8 88 04 00 00       	call   157f <write>
+  for(i = 0; i < n; i++)
+    10f7:	89 da                	mov    %ebx,%edx
+    10f9:	83 c4 10             	add    $0x10,%esp
+    10fc:	8d 5b 01             	lea    0x1(%ebx),%ebx
+    10ff:	39 9d d4 fd ff ff    	cmp    %ebx,-0x22c(%ebp)
+    1105:	75 e1                	jne    10e8 <main+0xe8>
+  close(fd);
+    1107:	83 ec 0c             	sub    $0xc,%esp
+    110a:	89 95 d0 fd ff ff    	mov    %edx,-0x230(%ebp)
+    1110:	57                   	push   %edi
+    1111:	e8 78 04 00 00       	call   158e <close>
+
+  printf(1, "read\n");
+    1116:	58                   	pop    %eax
+    1117:	5a                   	pop    %edx
+    1118:	68 35 24 00 00       	push   $0x2435
+    111d:	6a 01                	push   $0x1
+    111f:	e8 3c 09 00 00       	call   1a60 <printf>
+
+  fd = open(path, O_RDONLY);
+    1124:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+    112a:	59                   	pop    %ecx
+    112b:	5b                   	pop    %ebx
+    112c:	6a 00                	push   $0x0
+  for (i = 0; i < n; i++)
+    112e:	31 db                	xor    %ebx,%ebx
+  fd = open(path, O_RDONLY);
+    1130:	50                   	push   %eax
+    1131:	e8 85 04 00 00       	call   15bb <open>
+    1136:	83 c4 10             	add    $0x10,%esp
+    1139:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < n; i++)
+    113b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    113f:	90                   	nop
+    read(fd, data, sizeof(data));
+    1140:	83 ec 04             	sub    $0x4,%esp
+    1143:	68 00 02 00 00       	push   $0x200
+    1148:	56                   	push   %esi
+    1149:	57                   	push   %edi
+    114a:	e8 21 04 00 00       	call   1570 <read>
+  for (i = 0; i < n; i++)
+    114f:	89 d8                	mov    %ebx,%eax
+    1151:	83 c4 10             	add    $0x10,%esp
+    1154:	83 c3 01             	add    $0x1,%ebx
+    1157:	39 85 d0 fd ff ff    	cmp    %eax,-0x230(%ebp)
+    115d:	75 e1                	jne    1140 <main+0x140>
+  close(fd);
+    115f:	83 ec 0c             	sub    $0xc,%esp
+    1162:	57                   	push   %edi
+    1163:	e8 26 04 00 00       	call   158e <close>
+
+  // The first process waits for the whole chain of children.
+  if(wait() >= 0 && path[8] == '0'){
+    1168:	e8 e5 03 00 00       	call   1552 <wait>
+    116d:	83 c4 10             	add    $0x10,%esp
+    1170:	85 c0                	test   %eax,%eax
+    1172:	78 09                	js     117d <main+0x17d>
+    1174:	80 bd e6 fd ff ff 30 	cmpb   $0x30,-0x21a(%ebp)
+    117b:	74 05                	je     1182 <main+0x182>
+    if(i > 0)
+      printf(1, ", %d KB/s", 5*2*n*sizeof(data)/1024*100/i);
+    printf(1, "\n");
+  }
+
+  exit();
+    117d:	e8 6e 03 00 00       	call   14f0 <exit>
+    i = uptime() - start;
+    1182:	e8 d9 04 00 00       	call   1660 <uptime>
+    1187:	8b b5 cc fd ff ff    	mov    -0x234(%ebp),%esi
+    printf(1, "stressfs: %d KB in %d ticks", 5*2*n*sizeof(data)/1024, i);
+    118d:	69 bd d4 fd ff ff 00 	imul   $0x1400,-0x22c(%ebp),%edi
+    1194:	14 00 00 
+    i = uptime() - start;
+    1197:	29 f0                	sub    %esi,%eax
+    printf(1, "stressfs: %d KB in %d ticks", 5*2*n*sizeof(data)/1024, i);
+    1199:	c1 ef 0a             	shr    $0xa,%edi
+    119c:	50                   	push   %eax
+    i = uptime() - start;
+    119d:	89 c3                	mov    %eax,%ebx
+    printf(1, "stressfs: %d KB in %d ticks", 5*2*n*sizeof(data)/1024, i);
+    119f:	57                   	push   %edi
+    11a0:	68 3b 24 00 00       	push   $0x243b
+    11a5:	6a 01                	push   $0x1
+    11a7:	e8 b4 08 00 00       	call   1a60 <printf>
+    if(i > 0)
+    11ac:	83 c4 10             	add    $0x10,%esp
+    11af:	85 db                	test   %ebx,%ebx
+    11b1:	7e 18                	jle    11cb <main+0x1cb>
+      printf(1, ", %d KB/s", 5*2*n*sizeof(data)/1024*100/i);
+    11b3:	50                   	push   %eax
+    11b4:	6b c7 64             	imul   $0x64,%edi,%eax
+    11b7:	31 d2                	xor    %edx,%edx
+    11b9:	f7 f3                	div    %ebx
+    11bb:	50                   	push   %eax
+    11bc:	68 57 24 00 00       	push   $0x2457
+    11c1:	6a 01                	push   $0x1
+    11c3:	e8 98 08 00 00       	call   1a60 <printf>
+    11c8:	83 c4 10             	add    $0x10,%esp
+    printf(1, "\n");
+    11cb:	56                   	push   %esi
+    11cc:	56                   	push   %esi
+    11cd:	68 33 24 00 00       	push   $0x2433
+    11d2:	6a 01                	push   $0x1
+    11d4:	e8 87 08 00 00       	call   1a60 <printf>
+    11d9:	83 c4 10             	add    $0x10,%esp
+    11dc:	eb 9f                	jmp    117d <main+0x17d>
+  close(fd);
+    11de:	83 ec 0c             	sub    $0xc,%esp
+    11e1:	57                   	push   %edi
+    11e2:	e8 a7 03 00 00       	call   158e <close>
+  printf(1, "read\n");
+    11e7:	58                   	pop    %eax
+    11e8:	5a                   	pop    %edx
+    11e9:	68 35 24 00 00       	push   $0x2435
+    11ee:	6a 01                	push   $0x1
+    11f0:	e8 6b 08 00 00       	call   1a60 <printf>
+  fd = open(path, O_RDONLY);
+    11f5:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+    11fb:	59                   	pop    %ecx
+    11fc:	5b                   	pop    %ebx
+    11fd:	6a 00                	push   $0x0
+    11ff:	50                   	push   %eax
+    1200:	e8 b6 03 00 00       	call   15bb <open>
+    1205:	83 c4 10             	add    $0x10,%esp
+    1208:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < n; i++)
+    120a:	e9 50 ff ff ff       	jmp    115f <main+0x15f>
+    120f:	90                   	nop
+
+00001210 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1210:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1211:	31 c0                	xor    %eax,%eax
+{
+    1213:	89 e5                	mov    %esp,%ebp
+    1215:	53                   	push   %ebx
+    1216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    121c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1220:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1224:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1227:	83 c0 01             	add    $0x1,%eax
+    122a:	84 d2                	test   %dl,%dl
+    122c:	75 f2                	jne    1220 <strcpy+0x10>
+    ;
+  return os;
+}
+    122e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1231:	89 c8                	mov    %ecx,%eax
+    1233:	c9                   	leave
+    1234:	c3                   	ret
+    1235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001240 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	53                   	push   %ebx
+    1244:	8b 55 08             	mov    0x8(%ebp),%edx
+    1247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    124a:	0f b6 02             	movzbl (%edx),%eax
+    124d:	84 c0                	test   %al,%al
+    124f:	75 17                	jne    1268 <strcmp+0x28>
+    1251:	eb 3a                	jmp    128d <strcmp+0x4d>
+    1253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1257:	90                   	nop
+    1258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    125c:	83 c2 01             	add    $0x1,%edx
+    125f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1262:	84 c0                	test   %al,%al
+    1264:	74 1a                	je     1280 <strcmp+0x40>
+    p++, q++;
+    1266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1268:	0f b6 19             	movzbl (%ecx),%ebx
+    126b:	38 c3                	cmp    %al,%bl
+    126d:	74 e9                	je     1258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    126f:	29 d8                	sub    %ebx,%eax
+}
+    1271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1274:	c9                   	leave
+    1275:	c3                   	ret
+    1276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    127d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1284:	31 c0                	xor    %eax,%eax
+    1286:	29 d8                	sub    %ebx,%eax
+}
+    1288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    128b:	c9                   	leave
+    128c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    128d:	0f b6 19             	movzbl (%ecx),%ebx
+    1290:	31 c0                	xor    %eax,%eax
+    1292:	eb db                	jmp    126f <strcmp+0x2f>
+    1294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+
+000012a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    12a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    12a9:	74 15                	je     12c0 <strlen+0x20>
+    12ab:	31 c0                	xor    %eax,%eax
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+    12b0:	83 c0 01             	add    $0x1,%eax
+    12b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    12b7:	89 c1                	mov    %eax,%ecx
+    12b9:	75 f5                	jne    12b0 <strlen+0x10>
+    ;
+  return n;
+}
+    12bb:	89 c8                	mov    %ecx,%eax
+    12bd:	5d                   	pop    %ebp
+    12be:	c3                   	ret
+    12bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    12c0:	31 c9                	xor    %ecx,%ecx
+}
+    12c2:	5d                   	pop    %ebp
+    12c3:	89 c8                	mov    %ecx,%eax
+    12c5:	c3                   	ret
+    12c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    12d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    12da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12dd:	89 d7                	mov    %edx,%edi
+    12df:	fc                   	cld
+    12e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    12e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    12e5:	89 d0                	mov    %edx,%eax
+    12e7:	c9                   	leave
+    12e8:	c3                   	ret
+    12e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    12f0:	55                   	push   %ebp
+    12f1:	89 e5                	mov    %esp,%ebp
+    12f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    12fa:	0f b6 10             	movzbl (%eax),%edx
+    12fd:	84 d2                	test   %dl,%dl
+    12ff:	75 12                	jne    1313 <strchr+0x23>
+    1301:	eb 1d                	jmp    1320 <strchr+0x30>
+    1303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1307:	90                   	nop
+    1308:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    130c:	83 c0 01             	add    $0x1,%eax
+    130f:	84 d2                	test   %dl,%dl
+    1311:	74 0d                	je     1320 <strchr+0x30>
+    if(*s == c)
+    1313:	38 d1                	cmp    %dl,%cl
+    1315:	75 f1                	jne    1308 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1317:	5d                   	pop    %ebp
+    1318:	c3                   	ret
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1320:	31 c0                	xor    %eax,%eax
+}
+    1322:	5d                   	pop    %ebp
+    1323:	c3                   	ret
+    1324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    132f:	90                   	nop
+
+00001330 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	57                   	push   %edi
+    1334:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1335:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1338:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1339:	31 db                	xor    %ebx,%ebx
+{
+    133b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    133e:	eb 27                	jmp    1367 <gets+0x37>
+    cc = read(0, &c, 1);
+    1340:	83 ec 04             	sub    $0x4,%esp
+    1343:	6a 01                	push   $0x1
+    1345:	56                   	push   %esi
+    1346:	6a 00                	push   $0x0
+    1348:	e8 23 02 00 00       	call   1570 <read>
+    if(cc < 1)
+    134d:	83 c4 10             	add    $0x10,%esp
+    1350:	85 c0                	test   %eax,%eax
+    1352:	7e 1d                	jle    1371 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1354:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1358:	8b 55 08             	mov    0x8(%ebp),%edx
+    135b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    135f:	3c 0a                	cmp    $0xa,%al
+    1361:	74 10                	je     1373 <gets+0x43>
+    1363:	3c 0d                	cmp    $0xd,%al
+    1365:	74 0c                	je     1373 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1367:	89 df                	mov    %ebx,%edi
+    1369:	83 c3 01             	add    $0x1,%ebx
+    136c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    136f:	7c cf                	jl     1340 <gets+0x10>
+    1371:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1373:	8b 45 08             	mov    0x8(%ebp),%eax
+    1376:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    137a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    137d:	5b                   	pop    %ebx
+    137e:	5e                   	pop    %esi
+    137f:	5f                   	pop    %edi
+    1380:	5d                   	pop    %ebp
+    1381:	c3                   	ret
+    1382:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001390 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1390:	55                   	push   %ebp
+    1391:	89 e5                	mov    %esp,%ebp
+    1393:	56                   	push   %esi
+    1394:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1395:	83 ec 08             	sub    $0x8,%esp
+    1398:	6a 00                	push   $0x0
+    139a:	ff 75 08             	push   0x8(%ebp)
+    139d:	e8 19 02 00 00       	call   15bb <open>
+  if(fd < 0)
+    13a2:	83 c4 10             	add    $0x10,%esp
+    13a5:	85 c0                	test   %eax,%eax
+    13a7:	78 27                	js     13d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    13a9:	83 ec 08             	sub    $0x8,%esp
+    13ac:	ff 75 0c             	push   0xc(%ebp)
+    13af:	89 c3                	mov    %eax,%ebx
+    13b1:	50                   	push   %eax
+    13b2:	e8 31 02 00 00       	call   15e8 <fstat>
+  close(fd);
+    13b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    13ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    13bc:	e8 cd 01 00 00       	call   158e <close>
+  return r;
+    13c1:	83 c4 10             	add    $0x10,%esp
+}
+    13c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13c7:	89 f0                	mov    %esi,%eax
+    13c9:	5b                   	pop    %ebx
+    13ca:	5e                   	pop    %esi
+    13cb:	5d                   	pop    %ebp
+    13cc:	c3                   	ret
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    13d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13d5:	eb ed                	jmp    13c4 <stat+0x34>
+    13d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13de:	66 90                	xchg   %ax,%ax
+
+000013e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	53                   	push   %ebx
+    13e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    13e7:	0f be 02             	movsbl (%edx),%eax
+    13ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    13ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    13f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    13f5:	77 1e                	ja     1415 <atoi+0x35>
+    13f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1400:	83 c2 01             	add    $0x1,%edx
+    1403:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1406:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    140a:	0f be 02             	movsbl (%edx),%eax
+    140d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1410:	80 fb 09             	cmp    $0x9,%bl
+    1413:	76 eb                	jbe    1400 <atoi+0x20>
+  return n;
+}
+    1415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1418:	89 c8                	mov    %ecx,%eax
+    141a:	c9                   	leave
+    141b:	c3                   	ret
+    141c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001420 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	57                   	push   %edi
+    1424:	56                   	push   %esi
+    1425:	8b 45 10             	mov    0x10(%ebp),%eax
+    1428:	8b 55 08             	mov    0x8(%ebp),%edx
+    142b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    142e:	85 c0                	test   %eax,%eax
+    1430:	7e 13                	jle    1445 <memmove+0x25>
+    1432:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1434:	89 d7                	mov    %edx,%edi
+    1436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1440:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1441:	39 f8                	cmp    %edi,%eax
+    1443:	75 fb                	jne    1440 <memmove+0x20>
+  return vdst;
+}
+    1445:	5e                   	pop    %esi
+    1446:	89 d0                	mov    %edx,%eax
+    1448:	5f                   	pop    %edi
+    1449:	5d                   	pop    %ebp
+    144a:	c3                   	ret
+    144b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    144f:	90                   	nop
+
+00001450 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1450:	55                   	push   %ebp
+    1451:	89 e5                	mov    %esp,%ebp
+    1453:	56                   	push   %esi
+    1454:	53                   	push   %ebx
+    1455:	8b 75 10             	mov    0x10(%ebp),%esi
+    1458:	8b 55 08             	mov    0x8(%ebp),%edx
+    145b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    145e:	85 f6                	test   %esi,%esi
+    1460:	74 2e                	je     1490 <memcmp+0x40>
+    1462:	01 c6                	add    %eax,%esi
+    1464:	eb 14                	jmp    147a <memcmp+0x2a>
+    1466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    146d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1470:	83 c0 01             	add    $0x1,%eax
+    1473:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1476:	39 f0                	cmp    %esi,%eax
+    1478:	74 16                	je     1490 <memcmp+0x40>
+    if(*s1 != *s2)
+    147a:	0f b6 0a             	movzbl (%edx),%ecx
+    147d:	0f b6 18             	movzbl (%eax),%ebx
+    1480:	38 d9                	cmp    %bl,%cl
+    1482:	74 ec                	je     1470 <memcmp+0x20>
+      return *s1 - *s2;
+    1484:	0f b6 c1             	movzbl %cl,%eax
+    1487:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1489:	5b                   	pop    %ebx
+    148a:	5e                   	pop    %esi
+    148b:	5d                   	pop    %ebp
+    148c:	c3                   	ret
+    148d:	8d 76 00             	lea    0x0(%esi),%esi
+    1490:	5b                   	pop    %ebx
+  return 0;
+    1491:	31 c0                	xor    %eax,%eax
+}
+    1493:	5e                   	pop    %esi
+    1494:	5d                   	pop    %ebp
+    1495:	c3                   	ret
+    1496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    149d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014a0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    14a0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    14a5:	c3                   	ret
+    14a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014b0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    14b0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    14b5:	c3                   	ret
+    14b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014c0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    14c0:	a1 c0 2d 00 00       	mov    0x2dc0,%eax
+    14c5:	85 c0                	test   %eax,%eax
+    14c7:	74 17                	je     14e0 <fork+0x20>
+{
+    14c9:	55                   	push   %ebp
+    14ca:	89 e5                	mov    %esp,%ebp
+    14cc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    14cf:	ff d0                	call   *%eax
+  return _fork();
+}
+    14d1:	c9                   	leave
+  return _fork();
+    14d2:	e9 5d 00 00 00       	jmp    1534 <_fork>
+    14d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14de:	66 90                	xchg   %ax,%ax
+    14e0:	e9 4f 00 00 00       	jmp    1534 <_fork>
+    14e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014f0 <exit>:
+
+int
+exit(void)
+{
+    14f0:	55                   	push   %ebp
+    14f1:	89 e5                	mov    %esp,%ebp
+    14f3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    14f6:	a1 c0 2d 00 00       	mov    0x2dc0,%eax
+    14fb:	85 c0                	test   %eax,%eax
+    14fd:	74 02                	je     1501 <exit+0x11>
+    flushhook();
+    14ff:	ff d0                	call   *%eax
+  _exit();
+    1501:	e8 3d 00 00 00       	call   1543 <_exit>
+    1506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001510 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1510:	55                   	push   %ebp
+  if(flushhook)
+    1511:	a1 c0 2d 00 00       	mov    0x2dc0,%eax
+{
+    1516:	89 e5                	mov    %esp,%ebp
+    1518:	56                   	push   %esi
+    1519:	53                   	push   %ebx
+    151a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    151d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1520:	85 c0                	test   %eax,%eax
+    1522:	74 02                	je     1526 <exec+0x16>
+    flushhook();
+    1524:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1526:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1529:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    152c:	5b                   	pop    %ebx
+    152d:	5e                   	pop    %esi
+    152e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    152f:	e9 78 00 00 00       	jmp    15ac <_exec>
+
+00001534 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1534:	b8 01 00 00 00       	mov    $0x1,%eax
+    1539:	89 e1                	mov    %esp,%ecx
+    153b:	ba 42 15 00 00       	mov    $0x1542,%edx
+    1540:	0f 34                	sysenter
+    1542:	c3                   	ret
+
+00001543 <_exit>:
+RAWSYSCALL(exit)
+    1543:	b8 02 00 00 00       	mov    $0x2,%eax
+    1548:	89 e1                	mov    %esp,%ecx
+    154a:	ba 51 15 00 00       	mov    $0x1551,%edx
+    154f:	0f 34                	sysenter
+    1551:	c3                   	ret
+
+00001552 <wait>:
+SYSCALL(wait)
+    1552:	b8 03 00 00 00       	mov    $0x3,%eax
+    1557:	89 e1                	mov    %esp,%ecx
+    1559:	ba 60 15 00 00       	mov    $0x1560,%edx
+    155e:	0f 34                	sysenter
+    1560:	c3                   	ret
+
+00001561 <pipe>:
+SYSCALL(pipe)
+    1561:	b8 04 00 00 00       	mov    $0x4,%eax
+    1566:	89 e1                	mov    %esp,%ecx
+    1568:	ba 6f 15 00 00       	mov    $0x156f,%edx
+    156d:	0f 34                	sysenter
+    156f:	c3                   	ret
+
+00001570 <read>:
+SYSCALL(read)
+    1570:	b8 05 00 00 00       	mov    $0x5,%eax
+    1575:	89 e1                	mov    %esp,%ecx
+    1577:	ba 7e 15 00 00       	mov    $0x157e,%edx
+    157c:	0f 34                	sysenter
+    157e:	c3                   	ret
+
+0000157f <write>:
+SYSCALL(write)
+    157f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1584:	89 e1                	mov    %esp,%ecx
+    1586:	ba 8d 15 00 00       	mov    $0x158d,%edx
+    158b:	0f 34                	sysenter
+    158d:	c3                   	ret
+
+0000158e <close>:
+SYSCALL(close)
+    158e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1593:	89 e1                	mov    %esp,%ecx
+    1595:	ba 9c 15 00 00       	mov    $0x159c,%edx
+    159a:	0f 34                	sysenter
+    159c:	c3                   	ret
+
+0000159d <kill>:
+SYSCALL(kill)
+    159d:	b8 06 00 00 00       	mov    $0x6,%eax
+    15a2:	89 e1                	mov    %esp,%ecx
+    15a4:	ba ab 15 00 00       	mov    $0x15ab,%edx
+    15a9:	0f 34                	sysenter
+    15ab:	c3                   	ret
+
+000015ac <_exec>:
+RAWSYSCALL(exec)
+    15ac:	b8 07 00 00 00       	mov    $0x7,%eax
+    15b1:	89 e1                	mov    %esp,%ecx
+    15b3:	ba ba 15 00 00       	mov    $0x15ba,%edx
+    15b8:	0f 34                	sysenter
+    15ba:	c3                   	ret
+
+000015bb <open>:
+SYSCALL(open)
+    15bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+    15c0:	89 e1                	mov    %esp,%ecx
+    15c2:	ba c9 15 00 00       	mov    $0x15c9,%edx
+    15c7:	0f 34                	sysenter
+    15c9:	c3                   	ret
+
+000015ca <mknod>:
+SYSCALL(mknod)
+    15ca:	b8 11 00 00 00       	mov    $0x11,%eax
+    15cf:	89 e1                	mov    %esp,%ecx
+    15d1:	ba d8 15 00 00       	mov    $0x15d8,%edx
+    15d6:	0f 34                	sysenter
+    15d8:	c3                   	ret
+
+000015d9 <unlink>:
+SYSCALL(unlink)
+    15d9:	b8 12 00 00 00       	mov    $0x12,%eax
+    15de:	89 e1                	mov    %esp,%ecx
+    15e0:	ba e7 15 00 00       	mov    $0x15e7,%edx
+    15e5:	0f 34                	sysenter
+    15e7:	c3                   	ret
+
+000015e8 <fstat>:
+SYSCALL(fstat)
+    15e8:	b8 08 00 00 00       	mov    $0x8,%eax
+    15ed:	89 e1                	mov    %esp,%ecx
+    15ef:	ba f6 15 00 00       	mov    $0x15f6,%edx
+    15f4:	0f 34                	sysenter
+    15f6:	c3                   	ret
+
+000015f7 <link>:
+SYSCALL(link)
+    15f7:	b8 13 00 00 00       	mov    $0x13,%eax
+    15fc:	89 e1                	mov    %esp,%ecx
+    15fe:	ba 05 16 00 00       	mov    $0x1605,%edx
+    1603:	0f 34                	sysenter
+    1605:	c3                   	ret
+
+00001606 <mkdir>:
+SYSCALL(mkdir)
+    1606:	b8 14 00 00 00       	mov    $0x14,%eax
+    160b:	89 e1                	mov    %esp,%ecx
+    160d:	ba 14 16 00 00       	mov    $0x1614,%edx
+    1612:	0f 34                	sysenter
+    1614:	c3                   	ret
+
+00001615 <chdir>:
+SYSCALL(chdir)
+    1615:	b8 09 00 00 00       	mov    $0x9,%eax
+    161a:	89 e1                	mov    %esp,%ecx
+    161c:	ba 23 16 00 00       	mov    $0x1623,%edx
+    1621:	0f 34                	sysenter
+    1623:	c3                   	ret
+
+00001624 <dup>:
+SYSCALL(dup)
+    1624:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1629:	89 e1                	mov    %esp,%ecx
+    162b:	ba 32 16 00 00       	mov    $0x1632,%edx
+    1630:	0f 34                	sysenter
+    1632:	c3                   	ret
+
+00001633 <getpid>:
+SYSCALL(getpid)
+    1633:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1638:	89 e1                	mov    %esp,%ecx
+    163a:	ba 41 16 00 00       	mov    $0x1641,%edx
+    163f:	0f 34                	sysenter
+    1641:	c3                   	ret
+
+00001642 <sbrk>:
+SYSCALL(sbrk)
+    1642:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1647:	89 e1                	mov    %esp,%ecx
+    1649:	ba 50 16 00 00       	mov    $0x1650,%edx
+    164e:	0f 34                	sysenter
+    1650:	c3                   	ret
+
+00001651 <sleep>:
+SYSCALL(sleep)
+    1651:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1656:	89 e1                	mov    %esp,%ecx
+    1658:	ba 5f 16 00 00       	mov    $0x165f,%edx
+    165d:	0f 34                	sysenter
+    165f:	c3                   	ret
+
+00001660 <uptime>:
+SYSCALL(uptime)
+    1660:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1665:	89 e1                	mov    %esp,%ecx
+    1667:	ba 6e 16 00 00       	mov    $0x166e,%edx
+    166c:	0f 34                	sysenter
+    166e:	c3                   	ret
+
+0000166f <mprotect>:
+SYSCALL(mprotect)
+    166f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1674:	89 e1                	mov    %esp,%ecx
+    1676:	ba 7d 16 00 00       	mov    $0x167d,%edx
+    167b:	0f 34                	sysenter
+    167d:	c3                   	ret
+
+0000167e <munprotect>:
+SYSCALL(munprotect)
+    167e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1683:	89 e1                	mov    %esp,%ecx
+    1685:	ba 8c 16 00 00       	mov    $0x168c,%edx
+    168a:	0f 34                	sysenter
+    168c:	c3                   	ret
+
+0000168d <kstat>:
+SYSCALL(kstat)
+    168d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1692:	89 e1                	mov    %esp,%ecx
+    1694:	ba 9b 16 00 00       	mov    $0x169b,%edx
+    1699:	0f 34                	sysenter
+    169b:	c3                   	ret
+
+0000169c <fcntl>:
+SYSCALL(fcntl)
+    169c:	b8 19 00 00 00       	mov    $0x19,%eax
+    16a1:	89 e1                	mov    %esp,%ecx
+    16a3:	ba aa 16 00 00       	mov    $0x16aa,%edx
+    16a8:	0f 34                	sysenter
+    16aa:	c3                   	ret
+
+000016ab <splice>:
+SYSCALL(splice)
+    16ab:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    16b0:	89 e1                	mov    %esp,%ecx
+    16b2:	ba b9 16 00 00       	mov    $0x16b9,%edx
+    16b7:	0f 34                	sysenter
+    16b9:	c3                   	ret
+
+000016ba <sendfile>:
+SYSCALL(sendfile)
+    16ba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    16bf:	89 e1                	mov    %esp,%ecx
+    16c1:	ba c8 16 00 00       	mov    $0x16c8,%edx
+    16c6:	0f 34                	sysenter
+    16c8:	c3                   	ret
+
+000016c9 <lseek>:
+SYSCALL(lseek)
+    16c9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    16ce:	89 e1                	mov    %esp,%ecx
+    16d0:	ba d7 16 00 00       	mov    $0x16d7,%edx
+    16d5:	0f 34                	sysenter
+    16d7:	c3                   	ret
+
+000016d8 <pread>:
+SYSCALL(pread)
+    16d8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    16dd:	89 e1                	mov    %esp,%ecx
+    16df:	ba e6 16 00 00       	mov    $0x16e6,%edx
+    16e4:	0f 34                	sysenter
+    16e6:	c3                   	ret
+
+000016e7 <pwrite>:
+SYSCALL(pwrite)
+    16e7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    16ec:	89 e1                	mov    %esp,%ecx
+    16ee:	ba f5 16 00 00       	mov    $0x16f5,%edx
+    16f3:	0f 34                	sysenter
+    16f5:	c3                   	ret
+
+000016f6 <readv>:
+SYSCALL(readv)
+    16f6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    16fb:	89 e1                	mov    %esp,%ecx
+    16fd:	ba 04 17 00 00       	mov    $0x1704,%edx
+    1702:	0f 34                	sysenter
+    1704:	c3                   	ret
+
+00001705 <writev>:
+SYSCALL(writev)
+    1705:	b8 20 00 00 00       	mov    $0x20,%eax
+    170a:	89 e1                	mov    %esp,%ecx
+    170c:	ba 13 17 00 00       	mov    $0x1713,%edx
+    1711:	0f 34                	sysenter
+    1713:	c3                   	ret
+
+00001714 <ringsetup>:
+SYSCALL(ringsetup)
+    1714:	b8 21 00 00 00       	mov    $0x21,%eax
+    1719:	89 e1                	mov    %esp,%ecx
+    171b:	ba 22 17 00 00       	mov    $0x1722,%edx
+    1720:	0f 34                	sysenter
+    1722:	c3                   	ret
+
+00001723 <ringenter>:
+SYSCALL(ringenter)
+    1723:	b8 22 00 00 00       	mov    $0x22,%eax
+    1728:	89 e1                	mov    %esp,%ecx
+    172a:	ba 31 17 00 00       	mov    $0x1731,%edx
+    172f:	0f 34                	sysenter
+    1731:	c3                   	ret
+
+00001732 <intgetpid>:
+INTSYSCALL(getpid)
+    1732:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1737:	cd 40                	int    $0x40
+    1739:	c3                   	ret
+    173a:	66 90                	xchg   %ax,%ax
+    173c:	66 90                	xchg   %ax,%ax
+    173e:	66 90                	xchg   %ax,%ax
+
+00001740 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1740:	55                   	push   %ebp
+    1741:	89 e5                	mov    %esp,%ebp
+    1743:	57                   	push   %edi
+    1744:	56                   	push   %esi
+    1745:	53                   	push   %ebx
+    1746:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1748:	89 d1                	mov    %edx,%ecx
+{
+    174a:	83 ec 2c             	sub    $0x2c,%esp
+    174d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1750:	85 d2                	test   %edx,%edx
+    1752:	0f 89 c0 00 00 00    	jns    1818 <printint+0xd8>
+    1758:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    175c:	0f 84 b6 00 00 00    	je     1818 <printint+0xd8>
+    x = -xx;
+    1762:	f7 d9                	neg    %ecx
+    neg = 1;
+    1764:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1769:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    176c:	31 f6                	xor    %esi,%esi
+    176e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1770:	89 c8                	mov    %ecx,%eax
+    1772:	31 d2                	xor    %edx,%edx
+    1774:	89 f7                	mov    %esi,%edi
+    1776:	f7 f3                	div    %ebx
+    1778:	8d 76 01             	lea    0x1(%esi),%esi
+    177b:	0f b6 92 c0 24 00 00 	movzbl 0x24c0(%edx),%edx
+    1782:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1786:	89 ca                	mov    %ecx,%edx
+    1788:	89 c1                	mov    %eax,%ecx
+    178a:	39 da                	cmp    %ebx,%edx
+    178c:	73 e2                	jae    1770 <printint+0x30>
+  if(neg)
+    178e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1791:	85 c0                	test   %eax,%eax
+    1793:	74 07                	je     179c <printint+0x5c>
+    buf[i++] = '-';
+    1795:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    179a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    179c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    179f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    17a2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    17a4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    17a7:	8b 41 08             	mov    0x8(%ecx),%eax
+    17aa:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    17ad:	89 ce                	mov    %ecx,%esi
+    17af:	eb 1c                	jmp    17cd <printint+0x8d>
+    17b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    17b8:	89 c1                	mov    %eax,%ecx
+    17ba:	83 c0 01             	add    $0x1,%eax
+    17bd:	89 46 08             	mov    %eax,0x8(%esi)
+    17c0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    17c4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    17c7:	39 df                	cmp    %ebx,%edi
+    17c9:	74 41                	je     180c <printint+0xcc>
+    17cb:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    17cd:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    17d0:	3d 80 00 00 00       	cmp    $0x80,%eax
+    17d5:	75 e1                	jne    17b8 <printint+0x78>
+  if(o->f)
+    17d7:	8b 06                	mov    (%esi),%eax
+    17d9:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    17dc:	85 c0                	test   %eax,%eax
+    17de:	74 40                	je     1820 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    17e0:	50                   	push   %eax
+    17e1:	68 80 00 00 00       	push   $0x80
+    17e6:	6a 01                	push   $0x1
+    17e8:	ff 75 d4             	push   -0x2c(%ebp)
+    17eb:	e8 a0 04 00 00       	call   1c90 <fwrite>
+    17f0:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    17f4:	83 c4 10             	add    $0x10,%esp
+}
+    17f7:	b8 01 00 00 00       	mov    $0x1,%eax
+    17fc:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    17fe:	89 46 08             	mov    %eax,0x8(%esi)
+    1801:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1805:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1808:	39 df                	cmp    %ebx,%edi
+    180a:	75 bf                	jne    17cb <printint+0x8b>
+}
+    180c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    180f:	5b                   	pop    %ebx
+    1810:	5e                   	pop    %esi
+    1811:	5f                   	pop    %edi
+    1812:	5d                   	pop    %ebp
+    1813:	c3                   	ret
+    1814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1818:	31 c0                	xor    %eax,%eax
+    181a:	e9 4a ff ff ff       	jmp    1769 <printint+0x29>
+    181f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1820:	83 ec 04             	sub    $0x4,%esp
+    1823:	68 80 00 00 00       	push   $0x80
+    1828:	ff 75 d4             	push   -0x2c(%ebp)
+    182b:	ff 76 04             	push   0x4(%esi)
+    182e:	e8 4c fd ff ff       	call   157f <write>
+    1833:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1837:	83 c4 10             	add    $0x10,%esp
+    183a:	eb bb                	jmp    17f7 <printint+0xb7>
+    183c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001840 <putc>:
+{
+    1840:	55                   	push   %ebp
+    1841:	89 e5                	mov    %esp,%ebp
+    1843:	56                   	push   %esi
+    1844:	89 d6                	mov    %edx,%esi
+    1846:	53                   	push   %ebx
+    1847:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1849:	8b 40 08             	mov    0x8(%eax),%eax
+    184c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1851:	74 1d                	je     1870 <putc+0x30>
+  o->buf[o->n++] = c;
+    1853:	89 f1                	mov    %esi,%ecx
+    1855:	8d 50 01             	lea    0x1(%eax),%edx
+    1858:	89 53 08             	mov    %edx,0x8(%ebx)
+    185b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    185f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1862:	5b                   	pop    %ebx
+    1863:	5e                   	pop    %esi
+    1864:	5d                   	pop    %ebp
+    1865:	c3                   	ret
+    1866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1870:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1872:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1875:	85 c0                	test   %eax,%eax
+    1877:	74 2f                	je     18a8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1879:	50                   	push   %eax
+    187a:	68 80 00 00 00       	push   $0x80
+    187f:	6a 01                	push   $0x1
+    1881:	52                   	push   %edx
+    1882:	e8 09 04 00 00       	call   1c90 <fwrite>
+    1887:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    188a:	89 f1                	mov    %esi,%ecx
+}
+    188c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1891:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1893:	89 53 08             	mov    %edx,0x8(%ebx)
+    1896:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    189a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    189d:	5b                   	pop    %ebx
+    189e:	5e                   	pop    %esi
+    189f:	5d                   	pop    %ebp
+    18a0:	c3                   	ret
+    18a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    18a8:	83 ec 04             	sub    $0x4,%esp
+    18ab:	68 80 00 00 00       	push   $0x80
+    18b0:	52                   	push   %edx
+    18b1:	ff 73 04             	push   0x4(%ebx)
+    18b4:	e8 c6 fc ff ff       	call   157f <write>
+    18b9:	83 c4 10             	add    $0x10,%esp
+    18bc:	eb cc                	jmp    188a <putc+0x4a>
+    18be:	66 90                	xchg   %ax,%ax
+
+000018c0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    18c0:	55                   	push   %ebp
+    18c1:	89 e5                	mov    %esp,%ebp
+    18c3:	57                   	push   %edi
+    18c4:	89 c7                	mov    %eax,%edi
+    18c6:	56                   	push   %esi
+    18c7:	31 f6                	xor    %esi,%esi
+    18c9:	53                   	push   %ebx
+    18ca:	8d 5a 01             	lea    0x1(%edx),%ebx
+    18cd:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    18d0:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    18d3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    18d6:	84 c0                	test   %al,%al
+    18d8:	75 1e                	jne    18f8 <vprintf.constprop.0+0x38>
+    18da:	eb 53                	jmp    192f <vprintf.constprop.0+0x6f>
+    18dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    18e0:	83 f8 25             	cmp    $0x25,%eax
+    18e3:	74 3b                	je     1920 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    18e5:	89 ca                	mov    %ecx,%edx
+    18e7:	89 f8                	mov    %edi,%eax
+    18e9:	e8 52 ff ff ff       	call   1840 <putc>
+  for(i = 0; fmt[i]; i++){
+    18ee:	0f b6 03             	movzbl (%ebx),%eax
+    18f1:	83 c3 01             	add    $0x1,%ebx
+    18f4:	84 c0                	test   %al,%al
+    18f6:	74 37                	je     192f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    18f8:	0f be c8             	movsbl %al,%ecx
+    18fb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    18fe:	85 f6                	test   %esi,%esi
+    1900:	74 de                	je     18e0 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1902:	83 fe 25             	cmp    $0x25,%esi
+    1905:	75 e7                	jne    18ee <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1907:	83 f8 25             	cmp    $0x25,%eax
+    190a:	74 4e                	je     195a <vprintf.constprop.0+0x9a>
+    190c:	83 e8 63             	sub    $0x63,%eax
+    190f:	83 f8 15             	cmp    $0x15,%eax
+    1912:	77 34                	ja     1948 <vprintf.constprop.0+0x88>
+    1914:	ff 24 85 68 24 00 00 	jmp    *0x2468(,%eax,4)
+    191b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    191f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1920:	0f b6 03             	movzbl (%ebx),%eax
+    1923:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1926:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    192b:	84 c0                	test   %al,%al
+    192d:	75 c9                	jne    18f8 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    192f:	8b 47 08             	mov    0x8(%edi),%eax
+    1932:	85 c0                	test   %eax,%eax
+    1934:	0f 8f de 00 00 00    	jg     1a18 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    193a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    193d:	5b                   	pop    %ebx
+    193e:	5e                   	pop    %esi
+    193f:	5f                   	pop    %edi
+    1940:	5d                   	pop    %ebp
+    1941:	c3                   	ret
+    1942:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1948:	ba 25 00 00 00       	mov    $0x25,%edx
+    194d:	89 f8                	mov    %edi,%eax
+    194f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1952:	e8 e9 fe ff ff       	call   1840 <putc>
+        putc(o, c);
+    1957:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    195a:	89 ca                	mov    %ecx,%edx
+    195c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    195e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1960:	e8 db fe ff ff       	call   1840 <putc>
+    1965:	eb 87                	jmp    18ee <vprintf.constprop.0+0x2e>
+    1967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1970:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1973:	83 ec 0c             	sub    $0xc,%esp
+    1976:	b9 10 00 00 00       	mov    $0x10,%ecx
+    197b:	8b 16                	mov    (%esi),%edx
+    197d:	6a 00                	push   $0x0
+        ap++;
+    197f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1982:	89 f8                	mov    %edi,%eax
+    1984:	e8 b7 fd ff ff       	call   1740 <printint>
+        ap++;
+    1989:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    198c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    198f:	31 f6                	xor    %esi,%esi
+    1991:	e9 58 ff ff ff       	jmp    18ee <vprintf.constprop.0+0x2e>
+    1996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    199d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    19a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19a3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    19a5:	83 c0 04             	add    $0x4,%eax
+    19a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    19ab:	85 f6                	test   %esi,%esi
+    19ad:	75 1b                	jne    19ca <vprintf.constprop.0+0x10a>
+    19af:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    19b4:	be 61 24 00 00       	mov    $0x2461,%esi
+    19b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    19c0:	89 f8                	mov    %edi,%eax
+          s++;
+    19c2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    19c5:	e8 76 fe ff ff       	call   1840 <putc>
+        while(*s != 0){
+    19ca:	0f be 16             	movsbl (%esi),%edx
+    19cd:	84 d2                	test   %dl,%dl
+    19cf:	75 ef                	jne    19c0 <vprintf.constprop.0+0x100>
+      state = 0;
+    19d1:	31 f6                	xor    %esi,%esi
+    19d3:	e9 16 ff ff ff       	jmp    18ee <vprintf.constprop.0+0x2e>
+    19d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19df:	90                   	nop
+        printint(o, *ap, 10, 1);
+    19e0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    19e3:	83 ec 0c             	sub    $0xc,%esp
+    19e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    19eb:	8b 16                	mov    (%esi),%edx
+    19ed:	6a 01                	push   $0x1
+    19ef:	eb 8e                	jmp    197f <vprintf.constprop.0+0xbf>
+    19f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    19f8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    19fb:	89 f8                	mov    %edi,%eax
+    19fd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1a00:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1a03:	e8 38 fe ff ff       	call   1840 <putc>
+        ap++;
+    1a08:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    1a0b:	31 f6                	xor    %esi,%esi
+    1a0d:	e9 dc fe ff ff       	jmp    18ee <vprintf.constprop.0+0x2e>
+    1a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1a18:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    1a1a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    1a1d:	85 d2                	test   %edx,%edx
+    1a1f:	74 1f                	je     1a40 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1a21:	52                   	push   %edx
+    1a22:	50                   	push   %eax
+    1a23:	6a 01                	push   $0x1
+    1a25:	51                   	push   %ecx
+    1a26:	e8 65 02 00 00       	call   1c90 <fwrite>
+    1a2b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    1a2e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a38:	5b                   	pop    %ebx
+    1a39:	5e                   	pop    %esi
+    1a3a:	5f                   	pop    %edi
+    1a3b:	5d                   	pop    %ebp
+    1a3c:	c3                   	ret
+    1a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1a40:	83 ec 04             	sub    $0x4,%esp
+    1a43:	50                   	push   %eax
+    1a44:	51                   	push   %ecx
+    1a45:	ff 77 04             	push   0x4(%edi)
+    1a48:	e8 32 fb ff ff       	call   157f <write>
+    1a4d:	83 c4 10             	add    $0x10,%esp
+    1a50:	eb dc                	jmp    1a2e <vprintf.constprop.0+0x16e>
+    1a52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a60 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1a60:	55                   	push   %ebp
+    1a61:	89 e5                	mov    %esp,%ebp
+    1a63:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a69:	a1 64 2b 00 00       	mov    0x2b64,%eax
+{
+    1a6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a71:	83 fa 01             	cmp    $0x1,%edx
+    1a74:	74 0c                	je     1a82 <printf+0x22>
+    1a76:	31 c0                	xor    %eax,%eax
+    1a78:	83 fa 02             	cmp    $0x2,%edx
+    1a7b:	0f 44 05 60 2b 00 00 	cmove  0x2b60,%eax
+  o.fd = fd;
+    1a82:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a88:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1a8b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a8e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a94:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1a9a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1aa1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1aa4:	e8 17 fe ff ff       	call   18c0 <vprintf.constprop.0>
+}
+    1aa9:	c9                   	leave
+    1aaa:	c3                   	ret
+    1aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1aaf:	90                   	nop
+
+00001ab0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1ab0:	55                   	push   %ebp
+    1ab1:	89 e5                	mov    %esp,%ebp
+    1ab3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1abc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1abf:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1ac2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1ac9:	ff ff ff 
+  o.n = 0;
+    1acc:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1ad3:	00 00 00 
+  o.f = f;
+    1ad6:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1adc:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1ae2:	e8 d9 fd ff ff       	call   18c0 <vprintf.constprop.0>
+}
+    1ae7:	c9                   	leave
+    1ae8:	c3                   	ret
+    1ae9:	66 90                	xchg   %ax,%ax
+    1aeb:	66 90                	xchg   %ax,%ax
+    1aed:	66 90                	xchg   %ax,%ax
+    1aef:	90                   	nop
+
+00001af0 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1af0:	55                   	push   %ebp
+    1af1:	89 e5                	mov    %esp,%ebp
+    1af3:	53                   	push   %ebx
+    1af4:	89 c3                	mov    %eax,%ebx
+    1af6:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1af9:	8b 40 0c             	mov    0xc(%eax),%eax
+    1afc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1aff:	74 17                	je     1b18 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1b01:	83 f8 02             	cmp    $0x2,%eax
+    1b04:	74 07                	je     1b0d <setmode+0x1d>
+    1b06:	8b 43 18             	mov    0x18(%ebx),%eax
+    1b09:	85 c0                	test   %eax,%eax
+    1b0b:	74 38                	je     1b45 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1b0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1b10:	c9                   	leave
+    1b11:	c3                   	ret
+    1b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1b18:	83 ec 08             	sub    $0x8,%esp
+    1b1b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1b1e:	50                   	push   %eax
+    1b1f:	ff 33                	push   (%ebx)
+    1b21:	e8 c2 fa ff ff       	call   15e8 <fstat>
+    1b26:	83 c4 10             	add    $0x10,%esp
+    1b29:	89 c2                	mov    %eax,%edx
+    1b2b:	31 c0                	xor    %eax,%eax
+    1b2d:	85 d2                	test   %edx,%edx
+    1b2f:	75 0a                	jne    1b3b <setmode+0x4b>
+    1b31:	31 c0                	xor    %eax,%eax
+    1b33:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1b38:	0f 94 c0             	sete   %al
+    1b3b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1b3e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1b41:	85 c0                	test   %eax,%eax
+    1b43:	75 c8                	jne    1b0d <setmode+0x1d>
+    1b45:	83 ec 0c             	sub    $0xc,%esp
+    1b48:	68 00 04 00 00       	push   $0x400
+    1b4d:	e8 de 07 00 00       	call   2330 <malloc>
+    1b52:	83 c4 10             	add    $0x10,%esp
+    1b55:	89 43 18             	mov    %eax,0x18(%ebx)
+    1b58:	85 c0                	test   %eax,%eax
+    1b5a:	75 b1                	jne    1b0d <setmode+0x1d>
+    f->mode = IONBF;
+    1b5c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1b63:	eb a8                	jmp    1b0d <setmode+0x1d>
+    1b65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b70 <drain>:
+{
+    1b70:	55                   	push   %ebp
+    1b71:	89 e5                	mov    %esp,%ebp
+    1b73:	57                   	push   %edi
+    1b74:	56                   	push   %esi
+    1b75:	53                   	push   %ebx
+    1b76:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1b79:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1b7c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1b7f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1b86:	85 ff                	test   %edi,%edi
+    1b88:	7f 0e                	jg     1b98 <drain+0x28>
+  return 0;
+    1b8a:	31 c0                	xor    %eax,%eax
+}
+    1b8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b8f:	5b                   	pop    %ebx
+    1b90:	5e                   	pop    %esi
+    1b91:	5f                   	pop    %edi
+    1b92:	5d                   	pop    %ebp
+    1b93:	c3                   	ret
+    1b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1b98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b9b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1b9e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1ba0:	eb 0e                	jmp    1bb0 <drain+0x40>
+    1ba2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1ba8:	29 c7                	sub    %eax,%edi
+    1baa:	01 c3                	add    %eax,%ebx
+    1bac:	85 ff                	test   %edi,%edi
+    1bae:	7e da                	jle    1b8a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1bb0:	83 ec 04             	sub    $0x4,%esp
+    1bb3:	57                   	push   %edi
+    1bb4:	53                   	push   %ebx
+    1bb5:	56                   	push   %esi
+    1bb6:	e8 c4 f9 ff ff       	call   157f <write>
+    1bbb:	83 c4 10             	add    $0x10,%esp
+    1bbe:	85 c0                	test   %eax,%eax
+    1bc0:	7f e6                	jg     1ba8 <drain+0x38>
+    f->err = 1;
+    1bc2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bc5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1bcc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1bd1:	eb b9                	jmp    1b8c <drain+0x1c>
+    1bd3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001be0 <flushall>:
+
+static void
+flushall(void)
+{
+    1be0:	55                   	push   %ebp
+    1be1:	89 e5                	mov    %esp,%ebp
+    1be3:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1be4:	bb 80 2b 00 00       	mov    $0x2b80,%ebx
+{
+    1be9:	83 ec 04             	sub    $0x4,%esp
+    1bec:	eb 0d                	jmp    1bfb <flushall+0x1b>
+    1bee:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1bf0:	83 c3 24             	add    $0x24,%ebx
+    1bf3:	81 fb c0 2d 00 00    	cmp    $0x2dc0,%ebx
+    1bf9:	74 19                	je     1c14 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1bfb:	8b 43 08             	mov    0x8(%ebx),%eax
+    1bfe:	85 c0                	test   %eax,%eax
+    1c00:	74 ee                	je     1bf0 <flushall+0x10>
+    1c02:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c04:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1c07:	e8 64 ff ff ff       	call   1b70 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c0c:	81 fb c0 2d 00 00    	cmp    $0x2dc0,%ebx
+    1c12:	75 e7                	jne    1bfb <flushall+0x1b>
+}
+    1c14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c17:	c9                   	leave
+    1c18:	c3                   	ret
+    1c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c20 <fflush>:
+{
+    1c20:	55                   	push   %ebp
+    1c21:	89 e5                	mov    %esp,%ebp
+    1c23:	57                   	push   %edi
+    1c24:	56                   	push   %esi
+    1c25:	53                   	push   %ebx
+    1c26:	83 ec 0c             	sub    $0xc,%esp
+    1c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1c2c:	85 c0                	test   %eax,%eax
+    1c2e:	74 28                	je     1c58 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1c30:	8b 70 08             	mov    0x8(%eax),%esi
+    1c33:	85 f6                	test   %esi,%esi
+    1c35:	75 11                	jne    1c48 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1c37:	83 c4 0c             	add    $0xc,%esp
+    1c3a:	89 f0                	mov    %esi,%eax
+    1c3c:	5b                   	pop    %ebx
+    1c3d:	5e                   	pop    %esi
+    1c3e:	5f                   	pop    %edi
+    1c3f:	5d                   	pop    %ebp
+    1c40:	c3                   	ret
+    1c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c48:	83 c4 0c             	add    $0xc,%esp
+    1c4b:	5b                   	pop    %ebx
+    1c4c:	5e                   	pop    %esi
+    1c4d:	5f                   	pop    %edi
+    1c4e:	5d                   	pop    %ebp
+  return drain(f);
+    1c4f:	e9 1c ff ff ff       	jmp    1b70 <drain>
+    1c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1c58:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c5a:	bb 80 2b 00 00       	mov    $0x2b80,%ebx
+        r = -1;
+    1c5f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1c64:	eb 15                	jmp    1c7b <fflush+0x5b>
+    1c66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c70:	83 c3 24             	add    $0x24,%ebx
+    1c73:	81 fb c0 2d 00 00    	cmp    $0x2dc0,%ebx
+    1c79:	74 bc                	je     1c37 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1c7b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1c7e:	85 c0                	test   %eax,%eax
+    1c80:	74 ee                	je     1c70 <fflush+0x50>
+    1c82:	89 d8                	mov    %ebx,%eax
+    1c84:	e8 e7 fe ff ff       	call   1b70 <drain>
+        r = -1;
+    1c89:	85 c0                	test   %eax,%eax
+    1c8b:	0f 48 f7             	cmovs  %edi,%esi
+    1c8e:	eb e0                	jmp    1c70 <fflush+0x50>
+
+00001c90 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	57                   	push   %edi
+    1c94:	56                   	push   %esi
+    1c95:	53                   	push   %ebx
+    1c96:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1c99:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1c9c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1ca0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1ca3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1ca6:	85 d2                	test   %edx,%edx
+    1ca8:	0f 8e 26 01 00 00    	jle    1dd4 <fwrite+0x144>
+  if(!f->writable){
+    1cae:	8b 46 08             	mov    0x8(%esi),%eax
+    1cb1:	85 c0                	test   %eax,%eax
+    1cb3:	0f 84 14 01 00 00    	je     1dcd <fwrite+0x13d>
+  setmode(f);
+    1cb9:	89 f0                	mov    %esi,%eax
+    1cbb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1cbe:	e8 2d fe ff ff       	call   1af0 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1cc3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1cc7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1cca:	c7 05 c0 2d 00 00 e0 	movl   $0x1be0,0x2dc0
+    1cd1:	1b 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1cd4:	0f 84 b6 00 00 00    	je     1d90 <fwrite+0x100>
+    1cda:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1ce0:	0f 8f aa 00 00 00    	jg     1d90 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1ce6:	8b 46 20             	mov    0x20(%esi),%eax
+    1ce9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1cec:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1cee:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1cf3:	74 6c                	je     1d61 <fwrite+0xd1>
+    1cf5:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1cf8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1cfb:	ba 00 04 00 00       	mov    $0x400,%edx
+    1d00:	29 c2                	sub    %eax,%edx
+    1d02:	39 ca                	cmp    %ecx,%edx
+    1d04:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1d07:	85 d2                	test   %edx,%edx
+    1d09:	0f 8e d1 00 00 00    	jle    1de0 <fwrite+0x150>
+    1d0f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1d12:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1d15:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d1f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1d20:	8d 50 01             	lea    0x1(%eax),%edx
+    1d23:	83 c3 01             	add    $0x1,%ebx
+    1d26:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1d29:	89 56 20             	mov    %edx,0x20(%esi)
+    1d2c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1d30:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1d33:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1d36:	b8 01 00 00 00       	mov    $0x1,%eax
+    1d3b:	80 fa 0a             	cmp    $0xa,%dl
+    1d3e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d41:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1d44:	39 cb                	cmp    %ecx,%ebx
+    1d46:	75 d8                	jne    1d20 <fwrite+0x90>
+    1d48:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1d4b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1d4e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1d51:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1d54:	85 db                	test   %ebx,%ebx
+    1d56:	7e 19                	jle    1d71 <fwrite+0xe1>
+    n -= k;
+    1d58:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1d5a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1d5f:	75 97                	jne    1cf8 <fwrite+0x68>
+    1d61:	89 f0                	mov    %esi,%eax
+    1d63:	e8 08 fe ff ff       	call   1b70 <drain>
+    1d68:	85 c0                	test   %eax,%eax
+    1d6a:	78 68                	js     1dd4 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1d6c:	8b 46 20             	mov    0x20(%esi),%eax
+    1d6f:	eb 87                	jmp    1cf8 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d71:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1d76:	74 74                	je     1dec <fwrite+0x15c>
+    1d78:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1d7c:	75 04                	jne    1d82 <fwrite+0xf2>
+    1d7e:	85 ff                	test   %edi,%edi
+    1d80:	75 6a                	jne    1dec <fwrite+0x15c>
+    return nmemb;
+    1d82:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d88:	5b                   	pop    %ebx
+    1d89:	5e                   	pop    %esi
+    1d8a:	5f                   	pop    %edi
+    1d8b:	5d                   	pop    %ebp
+    1d8c:	c3                   	ret
+    1d8d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1d90:	89 f0                	mov    %esi,%eax
+    1d92:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1d95:	e8 d6 fd ff ff       	call   1b70 <drain>
+    1d9a:	85 c0                	test   %eax,%eax
+    1d9c:	78 2f                	js     1dcd <fwrite+0x13d>
+    1d9e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1da1:	8b 3e                	mov    (%esi),%edi
+    1da3:	89 de                	mov    %ebx,%esi
+    1da5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1da8:	eb 0e                	jmp    1db8 <fwrite+0x128>
+    1daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1db0:	29 c3                	sub    %eax,%ebx
+    1db2:	01 c6                	add    %eax,%esi
+    1db4:	85 db                	test   %ebx,%ebx
+    1db6:	7e ca                	jle    1d82 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1db8:	83 ec 04             	sub    $0x4,%esp
+    1dbb:	53                   	push   %ebx
+    1dbc:	56                   	push   %esi
+    1dbd:	57                   	push   %edi
+    1dbe:	e8 bc f7 ff ff       	call   157f <write>
+    1dc3:	83 c4 10             	add    $0x10,%esp
+    1dc6:	85 c0                	test   %eax,%eax
+    1dc8:	7f e6                	jg     1db0 <fwrite+0x120>
+    1dca:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1dcd:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1dd4:	31 c0                	xor    %eax,%eax
+}
+    1dd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1dd9:	5b                   	pop    %ebx
+    1dda:	5e                   	pop    %esi
+    1ddb:	5f                   	pop    %edi
+    1ddc:	5d                   	pop    %ebp
+    1ddd:	c3                   	ret
+    1dde:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1de0:	89 d9                	mov    %ebx,%ecx
+    1de2:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1de5:	89 cb                	mov    %ecx,%ebx
+    1de7:	e9 6e ff ff ff       	jmp    1d5a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1dec:	89 f0                	mov    %esi,%eax
+    1dee:	e8 7d fd ff ff       	call   1b70 <drain>
+    1df3:	85 c0                	test   %eax,%eax
+    1df5:	79 8b                	jns    1d82 <fwrite+0xf2>
+    return 0;
+    1df7:	31 c0                	xor    %eax,%eax
+    1df9:	eb db                	jmp    1dd6 <fwrite+0x146>
+    1dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1dff:	90                   	nop
+
+00001e00 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1e00:	55                   	push   %ebp
+    1e01:	89 e5                	mov    %esp,%ebp
+    1e03:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1e06:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e09:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1e0c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1e0f:	ff 75 0c             	push   0xc(%ebp)
+    1e12:	6a 01                	push   $0x1
+    1e14:	6a 01                	push   $0x1
+    1e16:	50                   	push   %eax
+    1e17:	e8 74 fe ff ff       	call   1c90 <fwrite>
+    1e1c:	83 c4 10             	add    $0x10,%esp
+    1e1f:	83 f8 01             	cmp    $0x1,%eax
+    1e22:	75 0c                	jne    1e30 <fputc+0x30>
+    1e24:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1e28:	c9                   	leave
+    1e29:	c3                   	ret
+    1e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1e30:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1e31:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1e36:	c3                   	ret
+    1e37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e3e:	66 90                	xchg   %ax,%ax
+
+00001e40 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1e40:	55                   	push   %ebp
+    1e41:	89 e5                	mov    %esp,%ebp
+    1e43:	57                   	push   %edi
+    1e44:	56                   	push   %esi
+    1e45:	53                   	push   %ebx
+    1e46:	83 ec 1c             	sub    $0x1c,%esp
+    1e49:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1e4c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1e4f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1e52:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1e55:	85 d2                	test   %edx,%edx
+    1e57:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1e5a:	7e 12                	jle    1e6e <fread+0x2e>
+    1e5c:	85 ff                	test   %edi,%edi
+    1e5e:	7e 0e                	jle    1e6e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1e60:	8b 43 04             	mov    0x4(%ebx),%eax
+    1e63:	85 c0                	test   %eax,%eax
+    1e65:	75 19                	jne    1e80 <fread+0x40>
+    f->err = 1;
+    1e67:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1e6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1e71:	31 c0                	xor    %eax,%eax
+}
+    1e73:	5b                   	pop    %ebx
+    1e74:	5e                   	pop    %esi
+    1e75:	5f                   	pop    %edi
+    1e76:	5d                   	pop    %ebp
+    1e77:	c3                   	ret
+    1e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e7f:	90                   	nop
+  setmode(f);
+    1e80:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1e82:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1e84:	e8 67 fc ff ff       	call   1af0 <setmode>
+  for(n = 0; n < want; n += k){
+    1e89:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1e8c:	89 f7                	mov    %esi,%edi
+    1e8e:	eb 31                	jmp    1ec1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1e90:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1e94:	74 08                	je     1e9e <fread+0x5e>
+    1e96:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1e9c:	7e 62                	jle    1f00 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1e9e:	83 ec 04             	sub    $0x4,%esp
+    1ea1:	56                   	push   %esi
+    1ea2:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ea5:	01 f8                	add    %edi,%eax
+    1ea7:	50                   	push   %eax
+    1ea8:	ff 33                	push   (%ebx)
+    1eaa:	e8 c1 f6 ff ff       	call   1570 <read>
+    1eaf:	83 c4 10             	add    $0x10,%esp
+    1eb2:	85 c0                	test   %eax,%eax
+    1eb4:	0f 8e ce 00 00 00    	jle    1f88 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1eba:	01 c7                	add    %eax,%edi
+    1ebc:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1ebf:	7e 36                	jle    1ef7 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1ec1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1ec4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1ec7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1eca:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1ecc:	39 c1                	cmp    %eax,%ecx
+    1ece:	7d c0                	jge    1e90 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1ed0:	29 c8                	sub    %ecx,%eax
+    1ed2:	39 f0                	cmp    %esi,%eax
+    1ed4:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1ed7:	83 ec 04             	sub    $0x4,%esp
+    1eda:	56                   	push   %esi
+    1edb:	03 4b 18             	add    0x18(%ebx),%ecx
+    1ede:	51                   	push   %ecx
+    1edf:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ee2:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1ee4:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1ee6:	50                   	push   %eax
+    1ee7:	e8 34 f5 ff ff       	call   1420 <memmove>
+      f->r += k;
+    1eec:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1eef:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1ef2:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1ef5:	7f ca                	jg     1ec1 <fread+0x81>
+    1ef7:	89 fe                	mov    %edi,%esi
+    1ef9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1efc:	eb 3f                	jmp    1f3d <fread+0xfd>
+    1efe:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1f00:	3b 1d 68 2b 00 00    	cmp    0x2b68,%ebx
+    1f06:	74 68                	je     1f70 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1f08:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1f0b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1f12:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1f19:	68 00 04 00 00       	push   $0x400
+    1f1e:	ff 73 18             	push   0x18(%ebx)
+    1f21:	ff 33                	push   (%ebx)
+    1f23:	e8 48 f6 ff ff       	call   1570 <read>
+    1f28:	83 c4 10             	add    $0x10,%esp
+    1f2b:	85 c0                	test   %eax,%eax
+    1f2d:	78 21                	js     1f50 <fread+0x110>
+  else if(n == 0)
+    1f2f:	75 2f                	jne    1f60 <fread+0x120>
+    f->eof = 1;
+    1f31:	89 fe                	mov    %edi,%esi
+    1f33:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f36:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1f3d:	89 f0                	mov    %esi,%eax
+}
+    1f3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1f42:	99                   	cltd
+}
+    1f43:	5b                   	pop    %ebx
+    1f44:	5e                   	pop    %esi
+  return n / size;
+    1f45:	f7 ff                	idiv   %edi
+}
+    1f47:	5f                   	pop    %edi
+    1f48:	5d                   	pop    %ebp
+    1f49:	c3                   	ret
+    1f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1f50:	89 fe                	mov    %edi,%esi
+    1f52:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f55:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1f5c:	eb df                	jmp    1f3d <fread+0xfd>
+    1f5e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1f60:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1f63:	e9 54 ff ff ff       	jmp    1ebc <fread+0x7c>
+    1f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f6f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1f70:	83 ec 0c             	sub    $0xc,%esp
+    1f73:	ff 35 64 2b 00 00    	push   0x2b64
+    1f79:	e8 a2 fc ff ff       	call   1c20 <fflush>
+    1f7e:	83 c4 10             	add    $0x10,%esp
+    1f81:	eb 85                	jmp    1f08 <fread+0xc8>
+    1f83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f87:	90                   	nop
+        if(k < 0)
+    1f88:	89 fe                	mov    %edi,%esi
+    1f8a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f8d:	74 a7                	je     1f36 <fread+0xf6>
+    1f8f:	eb c4                	jmp    1f55 <fread+0x115>
+    1f91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f9f:	90                   	nop
+
+00001fa0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1fa0:	55                   	push   %ebp
+    1fa1:	89 e5                	mov    %esp,%ebp
+    1fa3:	53                   	push   %ebx
+    1fa4:	83 ec 14             	sub    $0x14,%esp
+    1fa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1faa:	8b 50 04             	mov    0x4(%eax),%edx
+    1fad:	85 d2                	test   %edx,%edx
+    1faf:	74 08                	je     1fb9 <fgetc+0x19>
+    1fb1:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1fb4:	3b 50 20             	cmp    0x20(%eax),%edx
+    1fb7:	7c 27                	jl     1fe0 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1fb9:	50                   	push   %eax
+    1fba:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1fbd:	6a 01                	push   $0x1
+    1fbf:	6a 01                	push   $0x1
+    1fc1:	50                   	push   %eax
+    1fc2:	e8 79 fe ff ff       	call   1e40 <fread>
+    1fc7:	83 c4 10             	add    $0x10,%esp
+    1fca:	83 f8 01             	cmp    $0x1,%eax
+    1fcd:	75 29                	jne    1ff8 <fgetc+0x58>
+    1fcf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1fd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fd6:	c9                   	leave
+    1fd7:	c3                   	ret
+    1fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fdf:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1fe0:	8b 48 18             	mov    0x18(%eax),%ecx
+    1fe3:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1fe6:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1fe9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1fec:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1ff0:	c9                   	leave
+    1ff1:	c3                   	ret
+    1ff2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1ff8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ffd:	eb d4                	jmp    1fd3 <fgetc+0x33>
+    1fff:	90                   	nop
+
+00002000 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    2000:	55                   	push   %ebp
+    2001:	89 e5                	mov    %esp,%ebp
+    2003:	57                   	push   %edi
+    2004:	56                   	push   %esi
+    2005:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    2006:	31 db                	xor    %ebx,%ebx
+{
+    2008:	83 ec 1c             	sub    $0x1c,%esp
+    200b:	8b 75 10             	mov    0x10(%ebp),%esi
+    200e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    2010:	eb 2e                	jmp    2040 <fgets+0x40>
+    2012:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2018:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    201b:	57                   	push   %edi
+    201c:	6a 01                	push   $0x1
+    201e:	6a 01                	push   $0x1
+    2020:	50                   	push   %eax
+    2021:	e8 1a fe ff ff       	call   1e40 <fread>
+    2026:	83 c4 10             	add    $0x10,%esp
+    2029:	83 f8 01             	cmp    $0x1,%eax
+    202c:	75 62                	jne    2090 <fgets+0x90>
+    202e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    2032:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    2035:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    2037:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    203b:	83 f9 0a             	cmp    $0xa,%ecx
+    203e:	74 34                	je     2074 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    2040:	89 de                	mov    %ebx,%esi
+    2042:	83 c3 01             	add    $0x1,%ebx
+    2045:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    2048:	7d 46                	jge    2090 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    204a:	8b 47 04             	mov    0x4(%edi),%eax
+    204d:	85 c0                	test   %eax,%eax
+    204f:	74 c7                	je     2018 <fgets+0x18>
+    2051:	8b 47 1c             	mov    0x1c(%edi),%eax
+    2054:	3b 47 20             	cmp    0x20(%edi),%eax
+    2057:	7d bf                	jge    2018 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    2059:	8b 4f 18             	mov    0x18(%edi),%ecx
+    205c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    205f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    2062:	89 77 1c             	mov    %esi,0x1c(%edi)
+    2065:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    2069:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    206b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    206f:	83 f9 0a             	cmp    $0xa,%ecx
+    2072:	75 cc                	jne    2040 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2074:	8b 45 08             	mov    0x8(%ebp),%eax
+    2077:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    207b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    207e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2081:	5b                   	pop    %ebx
+    2082:	5e                   	pop    %esi
+    2083:	5f                   	pop    %edi
+    2084:	5d                   	pop    %ebp
+    2085:	c3                   	ret
+    2086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    208d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2090:	8b 45 08             	mov    0x8(%ebp),%eax
+    2093:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2097:	31 c0                	xor    %eax,%eax
+    2099:	85 f6                	test   %esi,%esi
+    209b:	74 e1                	je     207e <fgets+0x7e>
+    209d:	8b 45 08             	mov    0x8(%ebp),%eax
+    20a0:	eb dc                	jmp    207e <fgets+0x7e>
+    20a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000020b0 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    20b0:	55                   	push   %ebp
+    20b1:	89 e5                	mov    %esp,%ebp
+    20b3:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    20b4:	bb 80 2b 00 00       	mov    $0x2b80,%ebx
+{
+    20b9:	83 ec 04             	sub    $0x4,%esp
+    20bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    20c0:	8b 53 04             	mov    0x4(%ebx),%edx
+    20c3:	85 d2                	test   %edx,%edx
+    20c5:	75 07                	jne    20ce <fdopen+0x1e>
+    20c7:	8b 43 08             	mov    0x8(%ebx),%eax
+    20ca:	85 c0                	test   %eax,%eax
+    20cc:	74 1a                	je     20e8 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    20ce:	83 c3 24             	add    $0x24,%ebx
+    20d1:	81 fb c0 2d 00 00    	cmp    $0x2dc0,%ebx
+    20d7:	75 e7                	jne    20c0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    20d9:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    20db:	89 d8                	mov    %ebx,%eax
+    20dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    20e0:	c9                   	leave
+    20e1:	c3                   	ret
+    20e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    20e8:	81 fb c0 2d 00 00    	cmp    $0x2dc0,%ebx
+    20ee:	74 e9                	je     20d9 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    20f0:	83 ec 04             	sub    $0x4,%esp
+    20f3:	6a 24                	push   $0x24
+    20f5:	6a 00                	push   $0x0
+    20f7:	53                   	push   %ebx
+    20f8:	e8 d3 f1 ff ff       	call   12d0 <memset>
+  f->fd = fd;
+    20fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2100:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2107:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    210a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    210c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    210f:	80 38 72             	cmpb   $0x72,(%eax)
+    2112:	74 14                	je     2128 <fdopen+0x78>
+    f->writable = 1;
+    2114:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    211b:	89 d8                	mov    %ebx,%eax
+    211d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2120:	c9                   	leave
+    2121:	c3                   	ret
+    2122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2128:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    212f:	89 d8                	mov    %ebx,%eax
+    2131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2134:	c9                   	leave
+    2135:	c3                   	ret
+    2136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    213d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002140 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    2140:	55                   	push   %ebp
+    2141:	89 e5                	mov    %esp,%ebp
+    2143:	56                   	push   %esi
+    2144:	53                   	push   %ebx
+    2145:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    2148:	0f b6 06             	movzbl (%esi),%eax
+    214b:	3c 72                	cmp    $0x72,%al
+    214d:	74 61                	je     21b0 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    214f:	3c 77                	cmp    $0x77,%al
+    2151:	74 7d                	je     21d0 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    2153:	3c 61                	cmp    $0x61,%al
+    2155:	75 49                	jne    21a0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    2157:	83 ec 08             	sub    $0x8,%esp
+    215a:	68 01 02 00 00       	push   $0x201
+    215f:	ff 75 08             	push   0x8(%ebp)
+    2162:	e8 54 f4 ff ff       	call   15bb <open>
+    2167:	83 c4 10             	add    $0x10,%esp
+    216a:	89 c3                	mov    %eax,%ebx
+    216c:	85 c0                	test   %eax,%eax
+    216e:	78 30                	js     21a0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2170:	83 ec 04             	sub    $0x4,%esp
+    2173:	6a 02                	push   $0x2
+    2175:	6a 00                	push   $0x0
+    2177:	50                   	push   %eax
+    2178:	e8 4c f5 ff ff       	call   16c9 <lseek>
+    217d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2180:	83 ec 08             	sub    $0x8,%esp
+    2183:	56                   	push   %esi
+    2184:	53                   	push   %ebx
+    2185:	e8 26 ff ff ff       	call   20b0 <fdopen>
+    218a:	83 c4 10             	add    $0x10,%esp
+    218d:	85 c0                	test   %eax,%eax
+    218f:	75 11                	jne    21a2 <fopen+0x62>
+    close(fd);
+    2191:	83 ec 0c             	sub    $0xc,%esp
+    2194:	53                   	push   %ebx
+    2195:	e8 f4 f3 ff ff       	call   158e <close>
+    219a:	83 c4 10             	add    $0x10,%esp
+    219d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    21a0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    21a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    21a5:	5b                   	pop    %ebx
+    21a6:	5e                   	pop    %esi
+    21a7:	5d                   	pop    %ebp
+    21a8:	c3                   	ret
+    21a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    21b0:	83 ec 08             	sub    $0x8,%esp
+    21b3:	6a 00                	push   $0x0
+    21b5:	ff 75 08             	push   0x8(%ebp)
+    21b8:	e8 fe f3 ff ff       	call   15bb <open>
+    21bd:	83 c4 10             	add    $0x10,%esp
+    21c0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    21c2:	85 db                	test   %ebx,%ebx
+    21c4:	78 da                	js     21a0 <fopen+0x60>
+    21c6:	eb b8                	jmp    2180 <fopen+0x40>
+    21c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21cf:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    21d0:	83 ec 08             	sub    $0x8,%esp
+    21d3:	68 01 06 00 00       	push   $0x601
+    21d8:	ff 75 08             	push   0x8(%ebp)
+    21db:	e8 db f3 ff ff       	call   15bb <open>
+    21e0:	83 c4 10             	add    $0x10,%esp
+    21e3:	89 c3                	mov    %eax,%ebx
+    21e5:	eb db                	jmp    21c2 <fopen+0x82>
+    21e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21ee:	66 90                	xchg   %ax,%ax
+
+000021f0 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    21f0:	55                   	push   %ebp
+    21f1:	89 e5                	mov    %esp,%ebp
+    21f3:	56                   	push   %esi
+    21f4:	53                   	push   %ebx
+    21f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    21f8:	83 ec 0c             	sub    $0xc,%esp
+    21fb:	53                   	push   %ebx
+    21fc:	e8 1f fa ff ff       	call   1c20 <fflush>
+    2201:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2203:	58                   	pop    %eax
+    2204:	ff 33                	push   (%ebx)
+    2206:	e8 83 f3 ff ff       	call   158e <close>
+    220b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    220e:	85 c0                	test   %eax,%eax
+    2210:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2215:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2218:	8b 43 18             	mov    0x18(%ebx),%eax
+    221b:	85 c0                	test   %eax,%eax
+    221d:	0f 95 c1             	setne  %cl
+    2220:	3d e0 31 00 00       	cmp    $0x31e0,%eax
+    2225:	0f 95 c2             	setne  %dl
+    2228:	84 d1                	test   %dl,%cl
+    222a:	74 07                	je     2233 <fclose+0x43>
+    222c:	3d e0 2d 00 00       	cmp    $0x2de0,%eax
+    2231:	75 25                	jne    2258 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2233:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    223a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    223c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2243:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    224a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    224d:	5b                   	pop    %ebx
+    224e:	5e                   	pop    %esi
+    224f:	5d                   	pop    %ebp
+    2250:	c3                   	ret
+    2251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2258:	83 ec 0c             	sub    $0xc,%esp
+    225b:	50                   	push   %eax
+    225c:	e8 3f 00 00 00       	call   22a0 <free>
+    2261:	83 c4 10             	add    $0x10,%esp
+    2264:	eb cd                	jmp    2233 <fclose+0x43>
+    2266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    226d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002270 <feof>:
+
+int
+feof(FILE *f)
+{
+    2270:	55                   	push   %ebp
+    2271:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2273:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2276:	5d                   	pop    %ebp
+  return f->eof;
+    2277:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    227a:	c3                   	ret
+    227b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    227f:	90                   	nop
+
+00002280 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2280:	55                   	push   %ebp
+    2281:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2283:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2286:	5d                   	pop    %ebp
+  return f->err;
+    2287:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    228a:	c3                   	ret
+    228b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    228f:	90                   	nop
+
+00002290 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2290:	55                   	push   %ebp
+    2291:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2293:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2296:	5d                   	pop    %ebp
+  return f->fd;
+    2297:	8b 00                	mov    (%eax),%eax
+}
+    2299:	c3                   	ret
+    229a:	66 90                	xchg   %ax,%ax
+    229c:	66 90                	xchg   %ax,%ax
+    229e:	66 90                	xchg   %ax,%ax
+
+000022a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    22a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    22a1:	a1 e0 35 00 00       	mov    0x35e0,%eax
+{
+    22a6:	89 e5                	mov    %esp,%ebp
+    22a8:	57                   	push   %edi
+    22a9:	56                   	push   %esi
+    22aa:	53                   	push   %ebx
+    22ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    22ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    22b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    22ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    22bc:	39 ca                	cmp    %ecx,%edx
+    22be:	73 30                	jae    22f0 <free+0x50>
+    22c0:	39 c1                	cmp    %eax,%ecx
+    22c2:	72 04                	jb     22c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    22c4:	39 c2                	cmp    %eax,%edx
+    22c6:	72 f0                	jb     22b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    22c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    22cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    22ce:	39 f8                	cmp    %edi,%eax
+    22d0:	74 2e                	je     2300 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    22d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    22d5:	8b 42 04             	mov    0x4(%edx),%eax
+    22d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    22db:	39 f1                	cmp    %esi,%ecx
+    22dd:	74 38                	je     2317 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    22df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    22e1:	5b                   	pop    %ebx
+  freep = p;
+    22e2:	89 15 e0 35 00 00    	mov    %edx,0x35e0
+}
+    22e8:	5e                   	pop    %esi
+    22e9:	5f                   	pop    %edi
+    22ea:	5d                   	pop    %ebp
+    22eb:	c3                   	ret
+    22ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    22f0:	39 c1                	cmp    %eax,%ecx
+    22f2:	72 d0                	jb     22c4 <free+0x24>
+    22f4:	eb c2                	jmp    22b8 <free+0x18>
+    22f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2300:	03 70 04             	add    0x4(%eax),%esi
+    2303:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2306:	8b 02                	mov    (%edx),%eax
+    2308:	8b 00                	mov    (%eax),%eax
+    230a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    230d:	8b 42 04             	mov    0x4(%edx),%eax
+    2310:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2313:	39 f1                	cmp    %esi,%ecx
+    2315:	75 c8                	jne    22df <free+0x3f>
+    p->s.size += bp->s.size;
+    2317:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    231a:	89 15 e0 35 00 00    	mov    %edx,0x35e0
+    p->s.size += bp->s.size;
+    2320:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2323:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2326:	89 0a                	mov    %ecx,(%edx)
+}
+    2328:	5b                   	pop    %ebx
+    2329:	5e                   	pop    %esi
+    232a:	5f                   	pop    %edi
+    232b:	5d                   	pop    %ebp
+    232c:	c3                   	ret
+    232d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002330 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2330:	55                   	push   %ebp
+    2331:	89 e5                	mov    %esp,%ebp
+    2333:	57                   	push   %edi
+    2334:	56                   	push   %esi
+    2335:	53                   	push   %ebx
+    2336:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2339:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    233c:	8b 15 e0 35 00 00    	mov    0x35e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2342:	8d 78 07             	lea    0x7(%eax),%edi
+    2345:	c1 ef 03             	shr    $0x3,%edi
+    2348:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    234b:	85 d2                	test   %edx,%edx
+    234d:	0f 84 8d 00 00 00    	je     23e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2353:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2355:	8b 48 04             	mov    0x4(%eax),%ecx
+    2358:	39 f9                	cmp    %edi,%ecx
+    235a:	73 64                	jae    23c0 <malloc+0x90>
+  if(nu < 4096)
+    235c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2361:	39 df                	cmp    %ebx,%edi
+    2363:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2366:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    236d:	eb 0a                	jmp    2379 <malloc+0x49>
+    236f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2370:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2372:	8b 48 04             	mov    0x4(%eax),%ecx
+    2375:	39 f9                	cmp    %edi,%ecx
+    2377:	73 47                	jae    23c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2379:	89 c2                	mov    %eax,%edx
+    237b:	39 05 e0 35 00 00    	cmp    %eax,0x35e0
+    2381:	75 ed                	jne    2370 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2383:	83 ec 0c             	sub    $0xc,%esp
+    2386:	56                   	push   %esi
+    2387:	e8 b6 f2 ff ff       	call   1642 <sbrk>
+  if(p == (char*)-1)
+    238c:	83 c4 10             	add    $0x10,%esp
+    238f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2392:	74 1c                	je     23b0 <malloc+0x80>
+  hp->s.size = nu;
+    2394:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2397:	83 ec 0c             	sub    $0xc,%esp
+    239a:	83 c0 08             	add    $0x8,%eax
+    239d:	50                   	push   %eax
+    239e:	e8 fd fe ff ff       	call   22a0 <free>
+  return freep;
+    23a3:	8b 15 e0 35 00 00    	mov    0x35e0,%edx
+      if((p = morecore(nunits)) == 0)
+    23a9:	83 c4 10             	add    $0x10,%esp
+    23ac:	85 d2                	test   %edx,%edx
+    23ae:	75 c0                	jne    2370 <malloc+0x40>
+        return 0;
+  }
+}
+    23b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    23b3:	31 c0                	xor    %eax,%eax
+}
+    23b5:	5b                   	pop    %ebx
+    23b6:	5e                   	pop    %esi
+    23b7:	5f                   	pop    %edi
+    23b8:	5d                   	pop    %ebp
+    23b9:	c3                   	ret
+    23ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    23c0:	39 cf                	cmp    %ecx,%edi
+    23c2:	74 4c                	je     2410 <malloc+0xe0>
+        p->s.size -= nunits;
+    23c4:	29 f9                	sub    %edi,%ecx
+    23c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    23c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    23cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    23cf:	89 15 e0 35 00 00    	mov    %edx,0x35e0
+}
+    23d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    23d8:	83 c0 08             	add    $0x8,%eax
+}
+    23db:	5b                   	pop    %ebx
+    23dc:	5e                   	pop    %esi
+    23dd:	5f                   	pop    %edi
+    23de:	5d                   	pop    %ebp
+    23df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    23e0:	c7 05 e0 35 00 00 e4 	movl   $0x35e4,0x35e0
+    23e7:	35 00 00 
+    base.s.size = 0;
+    23ea:	b8 e4 35 00 00       	mov    $0x35e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    23ef:	c7 05 e4 35 00 00 e4 	movl   $0x35e4,0x35e4
+    23f6:	35 00 00 
+    base.s.size = 0;
+    23f9:	c7 05 e8 35 00 00 00 	movl   $0x0,0x35e8
+    2400:	00 00 00 
+    if(p->s.size >= nunits){
+    2403:	e9 54 ff ff ff       	jmp    235c <malloc+0x2c>
+    2408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    240f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2410:	8b 08                	mov    (%eax),%ecx
+    2412:	89 0a                	mov    %ecx,(%edx)
+    2414:	eb b9                	jmp    23cf <malloc+0x9f>
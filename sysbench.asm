@@ -0,0 +1,2841 @@
+
+_sysbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	53                   	push   %ebx
+    1010:	51                   	push   %ecx
+    1011:	83 ec 08             	sub    $0x8,%esp
+  int n, i, start;
+
+  n = argc > 1 ? atoi(argv[1]) : 1000000;
+    1014:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+    1017:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 1000000;
+    101a:	0f 8f 90 00 00 00    	jg     10b0 <main+0xb0>
+
+  start = uptime();
+    1020:	e8 cb 05 00 00       	call   15f0 <uptime>
+  n = argc > 1 ? atoi(argv[1]) : 1000000;
+    1025:	bb 40 42 0f 00       	mov    $0xf4240,%ebx
+  start = uptime();
+    102a:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+    102c:	31 f6                	xor    %esi,%esi
+    102e:	66 90                	xchg   %ax,%ax
+    getpid();
+    1030:	e8 8e 05 00 00       	call   15c3 <getpid>
+  for(i = 0; i < n; i++)
+    1035:	83 c6 01             	add    $0x1,%esi
+    1038:	39 de                	cmp    %ebx,%esi
+    103a:	7c f4                	jl     1030 <main+0x30>
+  report("sysenter", n, start);
+    103c:	83 ec 04             	sub    $0x4,%esp
+
+  start = uptime();
+  for(i = 0; i < n; i++)
+    103f:	31 f6                	xor    %esi,%esi
+  report("sysenter", n, start);
+    1041:	57                   	push   %edi
+    1042:	53                   	push   %ebx
+    1043:	68 d0 23 00 00       	push   $0x23d0
+    1048:	e8 b3 00 00 00       	call   1100 <report>
+  start = uptime();
+    104d:	e8 9e 05 00 00       	call   15f0 <uptime>
+    1052:	83 c4 10             	add    $0x10,%esp
+    1055:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+    1057:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105e:	66 90                	xchg   %ax,%ax
+    intgetpid();
+    1060:	e8 5d 06 00 00       	call   16c2 <intgetpid>
+  for(i = 0; i < n; i++)
+    1065:	83 c6 01             	add    $0x1,%esi
+    1068:	39 de                	cmp    %ebx,%esi
+    106a:	75 f4                	jne    1060 <main+0x60>
+  report("int", n, start);
+    106c:	83 ec 04             	sub    $0x4,%esp
+
+  start = uptime();
+  for(i = 0; i < n; i++)
+    106f:	31 f6                	xor    %esi,%esi
+  report("int", n, start);
+    1071:	57                   	push   %edi
+    1072:	53                   	push   %ebx
+    1073:	68 d9 23 00 00       	push   $0x23d9
+    1078:	e8 83 00 00 00       	call   1100 <report>
+  start = uptime();
+    107d:	e8 6e 05 00 00       	call   15f0 <uptime>
+    1082:	83 c4 10             	add    $0x10,%esp
+    1085:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+    1087:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108e:	66 90                	xchg   %ax,%ax
+    ugetpid();
+    1090:	e8 9b 03 00 00       	call   1430 <ugetpid>
+  for(i = 0; i < n; i++)
+    1095:	83 c6 01             	add    $0x1,%esi
+    1098:	39 de                	cmp    %ebx,%esi
+    109a:	75 f4                	jne    1090 <main+0x90>
+  report("ugetpid", n, start);
+    109c:	83 ec 04             	sub    $0x4,%esp
+    109f:	57                   	push   %edi
+    10a0:	53                   	push   %ebx
+    10a1:	68 dd 23 00 00       	push   $0x23dd
+    10a6:	e8 55 00 00 00       	call   1100 <report>
+  exit();
+    10ab:	e8 d0 03 00 00       	call   1480 <exit>
+  n = argc > 1 ? atoi(argv[1]) : 1000000;
+    10b0:	83 ec 0c             	sub    $0xc,%esp
+    10b3:	ff 70 04             	push   0x4(%eax)
+    10b6:	e8 b5 02 00 00       	call   1370 <atoi>
+    10bb:	89 c3                	mov    %eax,%ebx
+  start = uptime();
+    10bd:	e8 2e 05 00 00       	call   15f0 <uptime>
+  for(i = 0; i < n; i++)
+    10c2:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+    10c5:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+    10c7:	85 db                	test   %ebx,%ebx
+    10c9:	0f 8f 5d ff ff ff    	jg     102c <main+0x2c>
+  report("sysenter", n, start);
+    10cf:	50                   	push   %eax
+    10d0:	57                   	push   %edi
+    10d1:	53                   	push   %ebx
+    10d2:	68 d0 23 00 00       	push   $0x23d0
+    10d7:	e8 24 00 00 00       	call   1100 <report>
+  start = uptime();
+    10dc:	e8 0f 05 00 00       	call   15f0 <uptime>
+  report("int", n, start);
+    10e1:	83 c4 0c             	add    $0xc,%esp
+    10e4:	50                   	push   %eax
+    10e5:	53                   	push   %ebx
+    10e6:	68 d9 23 00 00       	push   $0x23d9
+    10eb:	e8 10 00 00 00       	call   1100 <report>
+  start = uptime();
+    10f0:	e8 fb 04 00 00       	call   15f0 <uptime>
+    10f5:	83 c4 10             	add    $0x10,%esp
+    10f8:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+    10fa:	eb a0                	jmp    109c <main+0x9c>
+    10fc:	66 90                	xchg   %ax,%ax
+    10fe:	66 90                	xchg   %ax,%ax
+
+00001100 <report>:
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	56                   	push   %esi
+    1105:	53                   	push   %ebx
+    1106:	83 ec 1c             	sub    $0x1c,%esp
+    1109:	8b 55 10             	mov    0x10(%ebp),%edx
+    110c:	8b 7d 08             	mov    0x8(%ebp),%edi
+    110f:	8b 75 0c             	mov    0xc(%ebp),%esi
+    1112:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  t = uptime() - start;
+    1115:	e8 d6 04 00 00       	call   15f0 <uptime>
+    111a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  printf(1, "%s: %d calls in %d ticks", what, n, t);
+    111d:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - start;
+    1120:	29 d0                	sub    %edx,%eax
+  printf(1, "%s: %d calls in %d ticks", what, n, t);
+    1122:	50                   	push   %eax
+  t = uptime() - start;
+    1123:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s: %d calls in %d ticks", what, n, t);
+    1125:	56                   	push   %esi
+    1126:	57                   	push   %edi
+    1127:	68 a8 23 00 00       	push   $0x23a8
+    112c:	6a 01                	push   $0x1
+    112e:	e8 bd 08 00 00       	call   19f0 <printf>
+  if(n >= 1000)
+    1133:	83 c4 20             	add    $0x20,%esp
+    1136:	81 fe e7 03 00 00    	cmp    $0x3e7,%esi
+    113c:	7f 22                	jg     1160 <report+0x60>
+  printf(1, "\n");
+    113e:	c7 45 0c ce 23 00 00 	movl   $0x23ce,0xc(%ebp)
+    1145:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+    114c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    114f:	5b                   	pop    %ebx
+    1150:	5e                   	pop    %esi
+    1151:	5f                   	pop    %edi
+    1152:	5d                   	pop    %ebp
+  printf(1, "\n");
+    1153:	e9 98 08 00 00       	jmp    19f0 <printf>
+    1158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+    printf(1, ", %d ns/call", t * 10000 / (n / 1000));
+    1160:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    1165:	69 db 10 27 00 00    	imul   $0x2710,%ebx,%ebx
+    116b:	83 ec 04             	sub    $0x4,%esp
+    116e:	f7 ee                	imul   %esi
+    1170:	c1 fe 1f             	sar    $0x1f,%esi
+    1173:	89 d8                	mov    %ebx,%eax
+    1175:	c1 fa 06             	sar    $0x6,%edx
+    1178:	89 d1                	mov    %edx,%ecx
+    117a:	99                   	cltd
+    117b:	29 f1                	sub    %esi,%ecx
+    117d:	f7 f9                	idiv   %ecx
+    117f:	50                   	push   %eax
+    1180:	68 c1 23 00 00       	push   $0x23c1
+    1185:	6a 01                	push   $0x1
+    1187:	e8 64 08 00 00       	call   19f0 <printf>
+    118c:	83 c4 10             	add    $0x10,%esp
+    118f:	eb ad                	jmp    113e <report+0x3e>
+    1191:	66 90                	xchg   %ax,%ax
+    1193:	66 90                	xchg   %ax,%ax
+    1195:	66 90                	xchg   %ax,%ax
+    1197:	66 90                	xchg   %ax,%ax
+    1199:	66 90                	xchg   %ax,%ax
+    119b:	66 90                	xchg   %ax,%ax
+    119d:	66 90                	xchg   %ax,%ax
+    119f:	90                   	nop
+
+000011a0 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    11a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11a1:	31 c0                	xor    %eax,%eax
+{
+    11a3:	89 e5                	mov    %esp,%ebp
+    11a5:	53                   	push   %ebx
+    11a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    11b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    11b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    11b7:	83 c0 01             	add    $0x1,%eax
+    11ba:	84 d2                	test   %dl,%dl
+    11bc:	75 f2                	jne    11b0 <strcpy+0x10>
+    ;
+  return os;
+}
+    11be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11c1:	89 c8                	mov    %ecx,%eax
+    11c3:	c9                   	leave
+    11c4:	c3                   	ret
+    11c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	53                   	push   %ebx
+    11d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    11d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    11da:	0f b6 02             	movzbl (%edx),%eax
+    11dd:	84 c0                	test   %al,%al
+    11df:	75 17                	jne    11f8 <strcmp+0x28>
+    11e1:	eb 3a                	jmp    121d <strcmp+0x4d>
+    11e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e7:	90                   	nop
+    11e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    11ec:	83 c2 01             	add    $0x1,%edx
+    11ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    11f2:	84 c0                	test   %al,%al
+    11f4:	74 1a                	je     1210 <strcmp+0x40>
+    p++, q++;
+    11f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    11f8:	0f b6 19             	movzbl (%ecx),%ebx
+    11fb:	38 c3                	cmp    %al,%bl
+    11fd:	74 e9                	je     11e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    11ff:	29 d8                	sub    %ebx,%eax
+}
+    1201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1204:	c9                   	leave
+    1205:	c3                   	ret
+    1206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1214:	31 c0                	xor    %eax,%eax
+    1216:	29 d8                	sub    %ebx,%eax
+}
+    1218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    121b:	c9                   	leave
+    121c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    121d:	0f b6 19             	movzbl (%ecx),%ebx
+    1220:	31 c0                	xor    %eax,%eax
+    1222:	eb db                	jmp    11ff <strcmp+0x2f>
+    1224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    122f:	90                   	nop
+
+00001230 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1236:	80 3a 00             	cmpb   $0x0,(%edx)
+    1239:	74 15                	je     1250 <strlen+0x20>
+    123b:	31 c0                	xor    %eax,%eax
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+    1240:	83 c0 01             	add    $0x1,%eax
+    1243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1247:	89 c1                	mov    %eax,%ecx
+    1249:	75 f5                	jne    1240 <strlen+0x10>
+    ;
+  return n;
+}
+    124b:	89 c8                	mov    %ecx,%eax
+    124d:	5d                   	pop    %ebp
+    124e:	c3                   	ret
+    124f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1250:	31 c9                	xor    %ecx,%ecx
+}
+    1252:	5d                   	pop    %ebp
+    1253:	89 c8                	mov    %ecx,%eax
+    1255:	c3                   	ret
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    126a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    126d:	89 d7                	mov    %edx,%edi
+    126f:	fc                   	cld
+    1270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1275:	89 d0                	mov    %edx,%eax
+    1277:	c9                   	leave
+    1278:	c3                   	ret
+    1279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	8b 45 08             	mov    0x8(%ebp),%eax
+    1286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    128a:	0f b6 10             	movzbl (%eax),%edx
+    128d:	84 d2                	test   %dl,%dl
+    128f:	75 12                	jne    12a3 <strchr+0x23>
+    1291:	eb 1d                	jmp    12b0 <strchr+0x30>
+    1293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1297:	90                   	nop
+    1298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    129c:	83 c0 01             	add    $0x1,%eax
+    129f:	84 d2                	test   %dl,%dl
+    12a1:	74 0d                	je     12b0 <strchr+0x30>
+    if(*s == c)
+    12a3:	38 d1                	cmp    %dl,%cl
+    12a5:	75 f1                	jne    1298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    12a7:	5d                   	pop    %ebp
+    12a8:	c3                   	ret
+    12a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    12b0:	31 c0                	xor    %eax,%eax
+}
+    12b2:	5d                   	pop    %ebp
+    12b3:	c3                   	ret
+    12b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+
+000012c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	57                   	push   %edi
+    12c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    12c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    12c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    12c9:	31 db                	xor    %ebx,%ebx
+{
+    12cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    12ce:	eb 27                	jmp    12f7 <gets+0x37>
+    cc = read(0, &c, 1);
+    12d0:	83 ec 04             	sub    $0x4,%esp
+    12d3:	6a 01                	push   $0x1
+    12d5:	56                   	push   %esi
+    12d6:	6a 00                	push   $0x0
+    12d8:	e8 23 02 00 00       	call   1500 <read>
+    if(cc < 1)
+    12dd:	83 c4 10             	add    $0x10,%esp
+    12e0:	85 c0                	test   %eax,%eax
+    12e2:	7e 1d                	jle    1301 <gets+0x41>
+      break;
+    buf[i++] = c;
+    12e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    12e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    12ef:	3c 0a                	cmp    $0xa,%al
+    12f1:	74 10                	je     1303 <gets+0x43>
+    12f3:	3c 0d                	cmp    $0xd,%al
+    12f5:	74 0c                	je     1303 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    12f7:	89 df                	mov    %ebx,%edi
+    12f9:	83 c3 01             	add    $0x1,%ebx
+    12fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    12ff:	7c cf                	jl     12d0 <gets+0x10>
+    1301:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1303:	8b 45 08             	mov    0x8(%ebp),%eax
+    1306:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    130a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    130d:	5b                   	pop    %ebx
+    130e:	5e                   	pop    %esi
+    130f:	5f                   	pop    %edi
+    1310:	5d                   	pop    %ebp
+    1311:	c3                   	ret
+    1312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	56                   	push   %esi
+    1324:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1325:	83 ec 08             	sub    $0x8,%esp
+    1328:	6a 00                	push   $0x0
+    132a:	ff 75 08             	push   0x8(%ebp)
+    132d:	e8 19 02 00 00       	call   154b <open>
+  if(fd < 0)
+    1332:	83 c4 10             	add    $0x10,%esp
+    1335:	85 c0                	test   %eax,%eax
+    1337:	78 27                	js     1360 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1339:	83 ec 08             	sub    $0x8,%esp
+    133c:	ff 75 0c             	push   0xc(%ebp)
+    133f:	89 c3                	mov    %eax,%ebx
+    1341:	50                   	push   %eax
+    1342:	e8 31 02 00 00       	call   1578 <fstat>
+  close(fd);
+    1347:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    134a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    134c:	e8 cd 01 00 00       	call   151e <close>
+  return r;
+    1351:	83 c4 10             	add    $0x10,%esp
+}
+    1354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1357:	89 f0                	mov    %esi,%eax
+    1359:	5b                   	pop    %ebx
+    135a:	5e                   	pop    %esi
+    135b:	5d                   	pop    %ebp
+    135c:	c3                   	ret
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1365:	eb ed                	jmp    1354 <stat+0x34>
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+
+00001370 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	53                   	push   %ebx
+    1374:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1377:	0f be 02             	movsbl (%edx),%eax
+    137a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    137d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1385:	77 1e                	ja     13a5 <atoi+0x35>
+    1387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1390:	83 c2 01             	add    $0x1,%edx
+    1393:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1396:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    139a:	0f be 02             	movsbl (%edx),%eax
+    139d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    13a0:	80 fb 09             	cmp    $0x9,%bl
+    13a3:	76 eb                	jbe    1390 <atoi+0x20>
+  return n;
+}
+    13a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13a8:	89 c8                	mov    %ecx,%eax
+    13aa:	c9                   	leave
+    13ab:	c3                   	ret
+    13ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000013b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    13b0:	55                   	push   %ebp
+    13b1:	89 e5                	mov    %esp,%ebp
+    13b3:	57                   	push   %edi
+    13b4:	56                   	push   %esi
+    13b5:	8b 45 10             	mov    0x10(%ebp),%eax
+    13b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    13bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    13be:	85 c0                	test   %eax,%eax
+    13c0:	7e 13                	jle    13d5 <memmove+0x25>
+    13c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    13c4:	89 d7                	mov    %edx,%edi
+    13c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    13d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    13d1:	39 f8                	cmp    %edi,%eax
+    13d3:	75 fb                	jne    13d0 <memmove+0x20>
+  return vdst;
+}
+    13d5:	5e                   	pop    %esi
+    13d6:	89 d0                	mov    %edx,%eax
+    13d8:	5f                   	pop    %edi
+    13d9:	5d                   	pop    %ebp
+    13da:	c3                   	ret
+    13db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13df:	90                   	nop
+
+000013e0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	56                   	push   %esi
+    13e4:	53                   	push   %ebx
+    13e5:	8b 75 10             	mov    0x10(%ebp),%esi
+    13e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    13eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    13ee:	85 f6                	test   %esi,%esi
+    13f0:	74 2e                	je     1420 <memcmp+0x40>
+    13f2:	01 c6                	add    %eax,%esi
+    13f4:	eb 14                	jmp    140a <memcmp+0x2a>
+    13f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1400:	83 c0 01             	add    $0x1,%eax
+    1403:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1406:	39 f0                	cmp    %esi,%eax
+    1408:	74 16                	je     1420 <memcmp+0x40>
+    if(*s1 != *s2)
+    140a:	0f b6 0a             	movzbl (%edx),%ecx
+    140d:	0f b6 18             	movzbl (%eax),%ebx
+    1410:	38 d9                	cmp    %bl,%cl
+    1412:	74 ec                	je     1400 <memcmp+0x20>
+      return *s1 - *s2;
+    1414:	0f b6 c1             	movzbl %cl,%eax
+    1417:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1419:	5b                   	pop    %ebx
+    141a:	5e                   	pop    %esi
+    141b:	5d                   	pop    %ebp
+    141c:	c3                   	ret
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+    1420:	5b                   	pop    %ebx
+  return 0;
+    1421:	31 c0                	xor    %eax,%eax
+}
+    1423:	5e                   	pop    %esi
+    1424:	5d                   	pop    %ebp
+    1425:	c3                   	ret
+    1426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001430 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1430:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1435:	c3                   	ret
+    1436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001440 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1440:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1445:	c3                   	ret
+    1446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001450 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1450:	a1 80 2d 00 00       	mov    0x2d80,%eax
+    1455:	85 c0                	test   %eax,%eax
+    1457:	74 17                	je     1470 <fork+0x20>
+{
+    1459:	55                   	push   %ebp
+    145a:	89 e5                	mov    %esp,%ebp
+    145c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    145f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1461:	c9                   	leave
+  return _fork();
+    1462:	e9 5d 00 00 00       	jmp    14c4 <_fork>
+    1467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    146e:	66 90                	xchg   %ax,%ax
+    1470:	e9 4f 00 00 00       	jmp    14c4 <_fork>
+    1475:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    147c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001480 <exit>:
+
+int
+exit(void)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1486:	a1 80 2d 00 00       	mov    0x2d80,%eax
+    148b:	85 c0                	test   %eax,%eax
+    148d:	74 02                	je     1491 <exit+0x11>
+    flushhook();
+    148f:	ff d0                	call   *%eax
+  _exit();
+    1491:	e8 3d 00 00 00       	call   14d3 <_exit>
+    1496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    149d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014a0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    14a0:	55                   	push   %ebp
+  if(flushhook)
+    14a1:	a1 80 2d 00 00       	mov    0x2d80,%eax
+{
+    14a6:	89 e5                	mov    %esp,%ebp
+    14a8:	56                   	push   %esi
+    14a9:	53                   	push   %ebx
+    14aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    14ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    14b0:	85 c0                	test   %eax,%eax
+    14b2:	74 02                	je     14b6 <exec+0x16>
+    flushhook();
+    14b4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    14b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+    14b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    14bc:	5b                   	pop    %ebx
+    14bd:	5e                   	pop    %esi
+    14be:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    14bf:	e9 78 00 00 00       	jmp    153c <_exec>
+
+000014c4 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    14c4:	b8 01 00 00 00       	mov    $0x1,%eax
+    14c9:	89 e1                	mov    %esp,%ecx
+    14cb:	ba d2 14 00 00       	mov    $0x14d2,%edx
+    14d0:	0f 34                	sysenter
+    14d2:	c3                   	ret
+
+000014d3 <_exit>:
+RAWSYSCALL(exit)
+    14d3:	b8 02 00 00 00       	mov    $0x2,%eax
+    14d8:	89 e1                	mov    %esp,%ecx
+    14da:	ba e1 14 00 00       	mov    $0x14e1,%edx
+    14df:	0f 34                	sysenter
+    14e1:	c3                   	ret
+
+000014e2 <wait>:
+SYSCALL(wait)
+    14e2:	b8 03 00 00 00       	mov    $0x3,%eax
+    14e7:	89 e1                	mov    %esp,%ecx
+    14e9:	ba f0 14 00 00       	mov    $0x14f0,%edx
+    14ee:	0f 34                	sysenter
+    14f0:	c3                   	ret
+
+000014f1 <pipe>:
+SYSCALL(pipe)
+    14f1:	b8 04 00 00 00       	mov    $0x4,%eax
+    14f6:	89 e1                	mov    %esp,%ecx
+    14f8:	ba ff 14 00 00       	mov    $0x14ff,%edx
+    14fd:	0f 34                	sysenter
+    14ff:	c3                   	ret
+
+00001500 <read>:
+SYSCALL(read)
+    1500:	b8 05 00 00 00       	mov    $0x5,%eax
+    1505:	89 e1                	mov    %esp,%ecx
+    1507:	ba 0e 15 00 00       	mov    $0x150e,%edx
+    150c:	0f 34                	sysenter
+    150e:	c3                   	ret
+
+0000150f <write>:
+SYSCALL(write)
+    150f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1514:	89 e1                	mov    %esp,%ecx
+    1516:	ba 1d 15 00 00       	mov    $0x151d,%edx
+    151b:	0f 34                	sysenter
+    151d:	c3                   	ret
+
+0000151e <close>:
+SYSCALL(close)
+    151e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1523:	89 e1                	mov    %esp,%ecx
+    1525:	ba 2c 15 00 00       	mov    $0x152c,%edx
+    152a:	0f 34                	sysenter
+    152c:	c3                   	ret
+
+0000152d <kill>:
+SYSCALL(kill)
+    152d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1532:	89 e1                	mov    %esp,%ecx
+    1534:	ba 3b 15 00 00       	mov    $0x153b,%edx
+    1539:	0f 34                	sysenter
+    153b:	c3                   	ret
+
+0000153c <_exec>:
+RAWSYSCALL(exec)
+    153c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1541:	89 e1                	mov    %esp,%ecx
+    1543:	ba 4a 15 00 00       	mov    $0x154a,%edx
+    1548:	0f 34                	sysenter
+    154a:	c3                   	ret
+
+0000154b <open>:
+SYSCALL(open)
+    154b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1550:	89 e1                	mov    %esp,%ecx
+    1552:	ba 59 15 00 00       	mov    $0x1559,%edx
+    1557:	0f 34                	sysenter
+    1559:	c3                   	ret
+
+0000155a <mknod>:
+SYSCALL(mknod)
+    155a:	b8 11 00 00 00       	mov    $0x11,%eax
+    155f:	89 e1                	mov    %esp,%ecx
+    1561:	ba 68 15 00 00       	mov    $0x1568,%edx
+    1566:	0f 34                	sysenter
+    1568:	c3                   	ret
+
+00001569 <unlink>:
+SYSCALL(unlink)
+    1569:	b8 12 00 00 00       	mov    $0x12,%eax
+    156e:	89 e1                	mov    %esp,%ecx
+    1570:	ba 77 15 00 00       	mov    $0x1577,%edx
+    1575:	0f 34                	sysenter
+    1577:	c3                   	ret
+
+00001578 <fstat>:
+SYSCALL(fstat)
+    1578:	b8 08 00 00 00       	mov    $0x8,%eax
+    157d:	89 e1                	mov    %esp,%ecx
+    157f:	ba 86 15 00 00       	mov    $0x1586,%edx
+    1584:	0f 34                	sysenter
+    1586:	c3                   	ret
+
+00001587 <link>:
+SYSCALL(link)
+    1587:	b8 13 00 00 00       	mov    $0x13,%eax
+    158c:	89 e1                	mov    %esp,%ecx
+    158e:	ba 95 15 00 00       	mov    $0x1595,%edx
+    1593:	0f 34                	sysenter
+    1595:	c3                   	ret
+
+00001596 <mkdir>:
+SYSCALL(mkdir)
+    1596:	b8 14 00 00 00       	mov    $0x14,%eax
+    159b:	89 e1                	mov    %esp,%ecx
+    159d:	ba a4 15 00 00       	mov    $0x15a4,%edx
+    15a2:	0f 34                	sysenter
+    15a4:	c3                   	ret
+
+000015a5 <chdir>:
+SYSCALL(chdir)
+    15a5:	b8 09 00 00 00       	mov    $0x9,%eax
+    15aa:	89 e1                	mov    %esp,%ecx
+    15ac:	ba b3 15 00 00       	mov    $0x15b3,%edx
+    15b1:	0f 34                	sysenter
+    15b3:	c3                   	ret
+
+000015b4 <dup>:
+SYSCALL(dup)
+    15b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    15b9:	89 e1                	mov    %esp,%ecx
+    15bb:	ba c2 15 00 00       	mov    $0x15c2,%edx
+    15c0:	0f 34                	sysenter
+    15c2:	c3                   	ret
+
+000015c3 <getpid>:
+SYSCALL(getpid)
+    15c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    15c8:	89 e1                	mov    %esp,%ecx
+    15ca:	ba d1 15 00 00       	mov    $0x15d1,%edx
+    15cf:	0f 34                	sysenter
+    15d1:	c3                   	ret
+
+000015d2 <sbrk>:
+SYSCALL(sbrk)
+    15d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    15d7:	89 e1                	mov    %esp,%ecx
+    15d9:	ba e0 15 00 00       	mov    $0x15e0,%edx
+    15de:	0f 34                	sysenter
+    15e0:	c3                   	ret
+
+000015e1 <sleep>:
+SYSCALL(sleep)
+    15e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    15e6:	89 e1                	mov    %esp,%ecx
+    15e8:	ba ef 15 00 00       	mov    $0x15ef,%edx
+    15ed:	0f 34                	sysenter
+    15ef:	c3                   	ret
+
+000015f0 <uptime>:
+SYSCALL(uptime)
+    15f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    15f5:	89 e1                	mov    %esp,%ecx
+    15f7:	ba fe 15 00 00       	mov    $0x15fe,%edx
+    15fc:	0f 34                	sysenter
+    15fe:	c3                   	ret
+
+000015ff <mprotect>:
+SYSCALL(mprotect)
+    15ff:	b8 16 00 00 00       	mov    $0x16,%eax
+    1604:	89 e1                	mov    %esp,%ecx
+    1606:	ba 0d 16 00 00       	mov    $0x160d,%edx
+    160b:	0f 34                	sysenter
+    160d:	c3                   	ret
+
+0000160e <munprotect>:
+SYSCALL(munprotect)
+    160e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1613:	89 e1                	mov    %esp,%ecx
+    1615:	ba 1c 16 00 00       	mov    $0x161c,%edx
+    161a:	0f 34                	sysenter
+    161c:	c3                   	ret
+
+0000161d <kstat>:
+SYSCALL(kstat)
+    161d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1622:	89 e1                	mov    %esp,%ecx
+    1624:	ba 2b 16 00 00       	mov    $0x162b,%edx
+    1629:	0f 34                	sysenter
+    162b:	c3                   	ret
+
+0000162c <fcntl>:
+SYSCALL(fcntl)
+    162c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1631:	89 e1                	mov    %esp,%ecx
+    1633:	ba 3a 16 00 00       	mov    $0x163a,%edx
+    1638:	0f 34                	sysenter
+    163a:	c3                   	ret
+
+0000163b <splice>:
+SYSCALL(splice)
+    163b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1640:	89 e1                	mov    %esp,%ecx
+    1642:	ba 49 16 00 00       	mov    $0x1649,%edx
+    1647:	0f 34                	sysenter
+    1649:	c3                   	ret
+
+0000164a <sendfile>:
+SYSCALL(sendfile)
+    164a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    164f:	89 e1                	mov    %esp,%ecx
+    1651:	ba 58 16 00 00       	mov    $0x1658,%edx
+    1656:	0f 34                	sysenter
+    1658:	c3                   	ret
+
+00001659 <lseek>:
+SYSCALL(lseek)
+    1659:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    165e:	89 e1                	mov    %esp,%ecx
+    1660:	ba 67 16 00 00       	mov    $0x1667,%edx
+    1665:	0f 34                	sysenter
+    1667:	c3                   	ret
+
+00001668 <pread>:
+SYSCALL(pread)
+    1668:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    166d:	89 e1                	mov    %esp,%ecx
+    166f:	ba 76 16 00 00       	mov    $0x1676,%edx
+    1674:	0f 34                	sysenter
+    1676:	c3                   	ret
+
+00001677 <pwrite>:
+SYSCALL(pwrite)
+    1677:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    167c:	89 e1                	mov    %esp,%ecx
+    167e:	ba 85 16 00 00       	mov    $0x1685,%edx
+    1683:	0f 34                	sysenter
+    1685:	c3                   	ret
+
+00001686 <readv>:
+SYSCALL(readv)
+    1686:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    168b:	89 e1                	mov    %esp,%ecx
+    168d:	ba 94 16 00 00       	mov    $0x1694,%edx
+    1692:	0f 34                	sysenter
+    1694:	c3                   	ret
+
+00001695 <writev>:
+SYSCALL(writev)
+    1695:	b8 20 00 00 00       	mov    $0x20,%eax
+    169a:	89 e1                	mov    %esp,%ecx
+    169c:	ba a3 16 00 00       	mov    $0x16a3,%edx
+    16a1:	0f 34                	sysenter
+    16a3:	c3                   	ret
+
+000016a4 <ringsetup>:
+SYSCALL(ringsetup)
+    16a4:	b8 21 00 00 00       	mov    $0x21,%eax
+    16a9:	89 e1                	mov    %esp,%ecx
+    16ab:	ba b2 16 00 00       	mov    $0x16b2,%edx
+    16b0:	0f 34                	sysenter
+    16b2:	c3                   	ret
+
+000016b3 <ringenter>:
+SYSCALL(ringenter)
+    16b3:	b8 22 00 00 00       	mov    $0x22,%eax
+    16b8:	89 e1                	mov    %esp,%ecx
+    16ba:	ba c1 16 00 00       	mov    $0x16c1,%edx
+    16bf:	0f 34                	sysenter
+    16c1:	c3                   	ret
+
+000016c2 <intgetpid>:
+INTSYSCALL(getpid)
+    16c2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    16c7:	cd 40                	int    $0x40
+    16c9:	c3                   	ret
+    16ca:	66 90                	xchg   %ax,%ax
+    16cc:	66 90                	xchg   %ax,%ax
+    16ce:	66 90                	xchg   %ax,%ax
+
+000016d0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	57                   	push   %edi
+    16d4:	56                   	push   %esi
+    16d5:	53                   	push   %ebx
+    16d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    16d8:	89 d1                	mov    %edx,%ecx
+{
+    16da:	83 ec 2c             	sub    $0x2c,%esp
+    16dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    16e0:	85 d2                	test   %edx,%edx
+    16e2:	0f 89 c0 00 00 00    	jns    17a8 <printint+0xd8>
+    16e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    16ec:	0f 84 b6 00 00 00    	je     17a8 <printint+0xd8>
+    x = -xx;
+    16f2:	f7 d9                	neg    %ecx
+    neg = 1;
+    16f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    16f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    16fc:	31 f6                	xor    %esi,%esi
+    16fe:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1700:	89 c8                	mov    %ecx,%eax
+    1702:	31 d2                	xor    %edx,%edx
+    1704:	89 f7                	mov    %esi,%edi
+    1706:	f7 f3                	div    %ebx
+    1708:	8d 76 01             	lea    0x1(%esi),%esi
+    170b:	0f b6 92 44 24 00 00 	movzbl 0x2444(%edx),%edx
+    1712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1716:	89 ca                	mov    %ecx,%edx
+    1718:	89 c1                	mov    %eax,%ecx
+    171a:	39 da                	cmp    %ebx,%edx
+    171c:	73 e2                	jae    1700 <printint+0x30>
+  if(neg)
+    171e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1721:	85 c0                	test   %eax,%eax
+    1723:	74 07                	je     172c <printint+0x5c>
+    buf[i++] = '-';
+    1725:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    172a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    172c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    172f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1732:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1734:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1737:	8b 41 08             	mov    0x8(%ecx),%eax
+    173a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    173d:	89 ce                	mov    %ecx,%esi
+    173f:	eb 1c                	jmp    175d <printint+0x8d>
+    1741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1748:	89 c1                	mov    %eax,%ecx
+    174a:	83 c0 01             	add    $0x1,%eax
+    174d:	89 46 08             	mov    %eax,0x8(%esi)
+    1750:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1754:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1757:	39 df                	cmp    %ebx,%edi
+    1759:	74 41                	je     179c <printint+0xcc>
+    175b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    175d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1760:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1765:	75 e1                	jne    1748 <printint+0x78>
+  if(o->f)
+    1767:	8b 06                	mov    (%esi),%eax
+    1769:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    176c:	85 c0                	test   %eax,%eax
+    176e:	74 40                	je     17b0 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1770:	50                   	push   %eax
+    1771:	68 80 00 00 00       	push   $0x80
+    1776:	6a 01                	push   $0x1
+    1778:	ff 75 d4             	push   -0x2c(%ebp)
+    177b:	e8 a0 04 00 00       	call   1c20 <fwrite>
+    1780:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1784:	83 c4 10             	add    $0x10,%esp
+}
+    1787:	b8 01 00 00 00       	mov    $0x1,%eax
+    178c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    178e:	89 46 08             	mov    %eax,0x8(%esi)
+    1791:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1795:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1798:	39 df                	cmp    %ebx,%edi
+    179a:	75 bf                	jne    175b <printint+0x8b>
+}
+    179c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    179f:	5b                   	pop    %ebx
+    17a0:	5e                   	pop    %esi
+    17a1:	5f                   	pop    %edi
+    17a2:	5d                   	pop    %ebp
+    17a3:	c3                   	ret
+    17a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    17a8:	31 c0                	xor    %eax,%eax
+    17aa:	e9 4a ff ff ff       	jmp    16f9 <printint+0x29>
+    17af:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    17b0:	83 ec 04             	sub    $0x4,%esp
+    17b3:	68 80 00 00 00       	push   $0x80
+    17b8:	ff 75 d4             	push   -0x2c(%ebp)
+    17bb:	ff 76 04             	push   0x4(%esi)
+    17be:	e8 4c fd ff ff       	call   150f <write>
+    17c3:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    17c7:	83 c4 10             	add    $0x10,%esp
+    17ca:	eb bb                	jmp    1787 <printint+0xb7>
+    17cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000017d0 <putc>:
+{
+    17d0:	55                   	push   %ebp
+    17d1:	89 e5                	mov    %esp,%ebp
+    17d3:	56                   	push   %esi
+    17d4:	89 d6                	mov    %edx,%esi
+    17d6:	53                   	push   %ebx
+    17d7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    17d9:	8b 40 08             	mov    0x8(%eax),%eax
+    17dc:	3d 80 00 00 00       	cmp    $0x80,%eax
+    17e1:	74 1d                	je     1800 <putc+0x30>
+  o->buf[o->n++] = c;
+    17e3:	89 f1                	mov    %esi,%ecx
+    17e5:	8d 50 01             	lea    0x1(%eax),%edx
+    17e8:	89 53 08             	mov    %edx,0x8(%ebx)
+    17eb:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    17ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    17f2:	5b                   	pop    %ebx
+    17f3:	5e                   	pop    %esi
+    17f4:	5d                   	pop    %ebp
+    17f5:	c3                   	ret
+    17f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1800:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1802:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1805:	85 c0                	test   %eax,%eax
+    1807:	74 2f                	je     1838 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1809:	50                   	push   %eax
+    180a:	68 80 00 00 00       	push   $0x80
+    180f:	6a 01                	push   $0x1
+    1811:	52                   	push   %edx
+    1812:	e8 09 04 00 00       	call   1c20 <fwrite>
+    1817:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    181a:	89 f1                	mov    %esi,%ecx
+}
+    181c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1821:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1823:	89 53 08             	mov    %edx,0x8(%ebx)
+    1826:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    182a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    182d:	5b                   	pop    %ebx
+    182e:	5e                   	pop    %esi
+    182f:	5d                   	pop    %ebp
+    1830:	c3                   	ret
+    1831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1838:	83 ec 04             	sub    $0x4,%esp
+    183b:	68 80 00 00 00       	push   $0x80
+    1840:	52                   	push   %edx
+    1841:	ff 73 04             	push   0x4(%ebx)
+    1844:	e8 c6 fc ff ff       	call   150f <write>
+    1849:	83 c4 10             	add    $0x10,%esp
+    184c:	eb cc                	jmp    181a <putc+0x4a>
+    184e:	66 90                	xchg   %ax,%ax
+
+00001850 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1850:	55                   	push   %ebp
+    1851:	89 e5                	mov    %esp,%ebp
+    1853:	57                   	push   %edi
+    1854:	89 c7                	mov    %eax,%edi
+    1856:	56                   	push   %esi
+    1857:	31 f6                	xor    %esi,%esi
+    1859:	53                   	push   %ebx
+    185a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    185d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1860:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1863:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1866:	84 c0                	test   %al,%al
+    1868:	75 1e                	jne    1888 <vprintf.constprop.0+0x38>
+    186a:	eb 53                	jmp    18bf <vprintf.constprop.0+0x6f>
+    186c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1870:	83 f8 25             	cmp    $0x25,%eax
+    1873:	74 3b                	je     18b0 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1875:	89 ca                	mov    %ecx,%edx
+    1877:	89 f8                	mov    %edi,%eax
+    1879:	e8 52 ff ff ff       	call   17d0 <putc>
+  for(i = 0; fmt[i]; i++){
+    187e:	0f b6 03             	movzbl (%ebx),%eax
+    1881:	83 c3 01             	add    $0x1,%ebx
+    1884:	84 c0                	test   %al,%al
+    1886:	74 37                	je     18bf <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1888:	0f be c8             	movsbl %al,%ecx
+    188b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    188e:	85 f6                	test   %esi,%esi
+    1890:	74 de                	je     1870 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1892:	83 fe 25             	cmp    $0x25,%esi
+    1895:	75 e7                	jne    187e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1897:	83 f8 25             	cmp    $0x25,%eax
+    189a:	74 4e                	je     18ea <vprintf.constprop.0+0x9a>
+    189c:	83 e8 63             	sub    $0x63,%eax
+    189f:	83 f8 15             	cmp    $0x15,%eax
+    18a2:	77 34                	ja     18d8 <vprintf.constprop.0+0x88>
+    18a4:	ff 24 85 ec 23 00 00 	jmp    *0x23ec(,%eax,4)
+    18ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18af:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    18b0:	0f b6 03             	movzbl (%ebx),%eax
+    18b3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    18b6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    18bb:	84 c0                	test   %al,%al
+    18bd:	75 c9                	jne    1888 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    18bf:	8b 47 08             	mov    0x8(%edi),%eax
+    18c2:	85 c0                	test   %eax,%eax
+    18c4:	0f 8f de 00 00 00    	jg     19a8 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    18ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18cd:	5b                   	pop    %ebx
+    18ce:	5e                   	pop    %esi
+    18cf:	5f                   	pop    %edi
+    18d0:	5d                   	pop    %ebp
+    18d1:	c3                   	ret
+    18d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    18d8:	ba 25 00 00 00       	mov    $0x25,%edx
+    18dd:	89 f8                	mov    %edi,%eax
+    18df:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    18e2:	e8 e9 fe ff ff       	call   17d0 <putc>
+        putc(o, c);
+    18e7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    18ea:	89 ca                	mov    %ecx,%edx
+    18ec:	89 f8                	mov    %edi,%eax
+      state = 0;
+    18ee:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    18f0:	e8 db fe ff ff       	call   17d0 <putc>
+    18f5:	eb 87                	jmp    187e <vprintf.constprop.0+0x2e>
+    18f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18fe:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1900:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1903:	83 ec 0c             	sub    $0xc,%esp
+    1906:	b9 10 00 00 00       	mov    $0x10,%ecx
+    190b:	8b 16                	mov    (%esi),%edx
+    190d:	6a 00                	push   $0x0
+        ap++;
+    190f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1912:	89 f8                	mov    %edi,%eax
+    1914:	e8 b7 fd ff ff       	call   16d0 <printint>
+        ap++;
+    1919:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    191c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    191f:	31 f6                	xor    %esi,%esi
+    1921:	e9 58 ff ff ff       	jmp    187e <vprintf.constprop.0+0x2e>
+    1926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    192d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1930:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1933:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1935:	83 c0 04             	add    $0x4,%eax
+    1938:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    193b:	85 f6                	test   %esi,%esi
+    193d:	75 1b                	jne    195a <vprintf.constprop.0+0x10a>
+    193f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1944:	be e5 23 00 00       	mov    $0x23e5,%esi
+    1949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1950:	89 f8                	mov    %edi,%eax
+          s++;
+    1952:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1955:	e8 76 fe ff ff       	call   17d0 <putc>
+        while(*s != 0){
+    195a:	0f be 16             	movsbl (%esi),%edx
+    195d:	84 d2                	test   %dl,%dl
+    195f:	75 ef                	jne    1950 <vprintf.constprop.0+0x100>
+      state = 0;
+    1961:	31 f6                	xor    %esi,%esi
+    1963:	e9 16 ff ff ff       	jmp    187e <vprintf.constprop.0+0x2e>
+    1968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1970:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1973:	83 ec 0c             	sub    $0xc,%esp
+    1976:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    197b:	8b 16                	mov    (%esi),%edx
+    197d:	6a 01                	push   $0x1
+    197f:	eb 8e                	jmp    190f <vprintf.constprop.0+0xbf>
+    1981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1988:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    198b:	89 f8                	mov    %edi,%eax
+    198d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1990:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1993:	e8 38 fe ff ff       	call   17d0 <putc>
+        ap++;
+    1998:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    199b:	31 f6                	xor    %esi,%esi
+    199d:	e9 dc fe ff ff       	jmp    187e <vprintf.constprop.0+0x2e>
+    19a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    19a8:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    19aa:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    19ad:	85 d2                	test   %edx,%edx
+    19af:	74 1f                	je     19d0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    19b1:	52                   	push   %edx
+    19b2:	50                   	push   %eax
+    19b3:	6a 01                	push   $0x1
+    19b5:	51                   	push   %ecx
+    19b6:	e8 65 02 00 00       	call   1c20 <fwrite>
+    19bb:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    19be:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    19c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19c8:	5b                   	pop    %ebx
+    19c9:	5e                   	pop    %esi
+    19ca:	5f                   	pop    %edi
+    19cb:	5d                   	pop    %ebp
+    19cc:	c3                   	ret
+    19cd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    19d0:	83 ec 04             	sub    $0x4,%esp
+    19d3:	50                   	push   %eax
+    19d4:	51                   	push   %ecx
+    19d5:	ff 77 04             	push   0x4(%edi)
+    19d8:	e8 32 fb ff ff       	call   150f <write>
+    19dd:	83 c4 10             	add    $0x10,%esp
+    19e0:	eb dc                	jmp    19be <vprintf.constprop.0+0x16e>
+    19e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000019f0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    19f0:	55                   	push   %ebp
+    19f1:	89 e5                	mov    %esp,%ebp
+    19f3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    19f9:	a1 24 2b 00 00       	mov    0x2b24,%eax
+{
+    19fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a01:	83 fa 01             	cmp    $0x1,%edx
+    1a04:	74 0c                	je     1a12 <printf+0x22>
+    1a06:	31 c0                	xor    %eax,%eax
+    1a08:	83 fa 02             	cmp    $0x2,%edx
+    1a0b:	0f 44 05 20 2b 00 00 	cmove  0x2b20,%eax
+  o.fd = fd;
+    1a12:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a18:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1a1b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1a1e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a24:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1a2a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1a31:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a34:	e8 17 fe ff ff       	call   1850 <vprintf.constprop.0>
+}
+    1a39:	c9                   	leave
+    1a3a:	c3                   	ret
+    1a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a3f:	90                   	nop
+
+00001a40 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1a40:	55                   	push   %ebp
+    1a41:	89 e5                	mov    %esp,%ebp
+    1a43:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1a4f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1a52:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1a59:	ff ff ff 
+  o.n = 0;
+    1a5c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1a63:	00 00 00 
+  o.f = f;
+    1a66:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a6c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1a72:	e8 d9 fd ff ff       	call   1850 <vprintf.constprop.0>
+}
+    1a77:	c9                   	leave
+    1a78:	c3                   	ret
+    1a79:	66 90                	xchg   %ax,%ax
+    1a7b:	66 90                	xchg   %ax,%ax
+    1a7d:	66 90                	xchg   %ax,%ax
+    1a7f:	90                   	nop
+
+00001a80 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1a80:	55                   	push   %ebp
+    1a81:	89 e5                	mov    %esp,%ebp
+    1a83:	53                   	push   %ebx
+    1a84:	89 c3                	mov    %eax,%ebx
+    1a86:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1a89:	8b 40 0c             	mov    0xc(%eax),%eax
+    1a8c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a8f:	74 17                	je     1aa8 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1a91:	83 f8 02             	cmp    $0x2,%eax
+    1a94:	74 07                	je     1a9d <setmode+0x1d>
+    1a96:	8b 43 18             	mov    0x18(%ebx),%eax
+    1a99:	85 c0                	test   %eax,%eax
+    1a9b:	74 38                	je     1ad5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1a9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1aa0:	c9                   	leave
+    1aa1:	c3                   	ret
+    1aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1aa8:	83 ec 08             	sub    $0x8,%esp
+    1aab:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1aae:	50                   	push   %eax
+    1aaf:	ff 33                	push   (%ebx)
+    1ab1:	e8 c2 fa ff ff       	call   1578 <fstat>
+    1ab6:	83 c4 10             	add    $0x10,%esp
+    1ab9:	89 c2                	mov    %eax,%edx
+    1abb:	31 c0                	xor    %eax,%eax
+    1abd:	85 d2                	test   %edx,%edx
+    1abf:	75 0a                	jne    1acb <setmode+0x4b>
+    1ac1:	31 c0                	xor    %eax,%eax
+    1ac3:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1ac8:	0f 94 c0             	sete   %al
+    1acb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1ace:	8b 43 18             	mov    0x18(%ebx),%eax
+    1ad1:	85 c0                	test   %eax,%eax
+    1ad3:	75 c8                	jne    1a9d <setmode+0x1d>
+    1ad5:	83 ec 0c             	sub    $0xc,%esp
+    1ad8:	68 00 04 00 00       	push   $0x400
+    1add:	e8 de 07 00 00       	call   22c0 <malloc>
+    1ae2:	83 c4 10             	add    $0x10,%esp
+    1ae5:	89 43 18             	mov    %eax,0x18(%ebx)
+    1ae8:	85 c0                	test   %eax,%eax
+    1aea:	75 b1                	jne    1a9d <setmode+0x1d>
+    f->mode = IONBF;
+    1aec:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1af3:	eb a8                	jmp    1a9d <setmode+0x1d>
+    1af5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001b00 <drain>:
+{
+    1b00:	55                   	push   %ebp
+    1b01:	89 e5                	mov    %esp,%ebp
+    1b03:	57                   	push   %edi
+    1b04:	56                   	push   %esi
+    1b05:	53                   	push   %ebx
+    1b06:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1b09:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1b0c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1b0f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1b16:	85 ff                	test   %edi,%edi
+    1b18:	7f 0e                	jg     1b28 <drain+0x28>
+  return 0;
+    1b1a:	31 c0                	xor    %eax,%eax
+}
+    1b1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b1f:	5b                   	pop    %ebx
+    1b20:	5e                   	pop    %esi
+    1b21:	5f                   	pop    %edi
+    1b22:	5d                   	pop    %ebp
+    1b23:	c3                   	ret
+    1b24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1b28:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b2b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1b2e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1b30:	eb 0e                	jmp    1b40 <drain+0x40>
+    1b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1b38:	29 c7                	sub    %eax,%edi
+    1b3a:	01 c3                	add    %eax,%ebx
+    1b3c:	85 ff                	test   %edi,%edi
+    1b3e:	7e da                	jle    1b1a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1b40:	83 ec 04             	sub    $0x4,%esp
+    1b43:	57                   	push   %edi
+    1b44:	53                   	push   %ebx
+    1b45:	56                   	push   %esi
+    1b46:	e8 c4 f9 ff ff       	call   150f <write>
+    1b4b:	83 c4 10             	add    $0x10,%esp
+    1b4e:	85 c0                	test   %eax,%eax
+    1b50:	7f e6                	jg     1b38 <drain+0x38>
+    f->err = 1;
+    1b52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b55:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1b5c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b61:	eb b9                	jmp    1b1c <drain+0x1c>
+    1b63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001b70 <flushall>:
+
+static void
+flushall(void)
+{
+    1b70:	55                   	push   %ebp
+    1b71:	89 e5                	mov    %esp,%ebp
+    1b73:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b74:	bb 40 2b 00 00       	mov    $0x2b40,%ebx
+{
+    1b79:	83 ec 04             	sub    $0x4,%esp
+    1b7c:	eb 0d                	jmp    1b8b <flushall+0x1b>
+    1b7e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b80:	83 c3 24             	add    $0x24,%ebx
+    1b83:	81 fb 80 2d 00 00    	cmp    $0x2d80,%ebx
+    1b89:	74 19                	je     1ba4 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1b8b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1b8e:	85 c0                	test   %eax,%eax
+    1b90:	74 ee                	je     1b80 <flushall+0x10>
+    1b92:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b94:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1b97:	e8 64 ff ff ff       	call   1b00 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b9c:	81 fb 80 2d 00 00    	cmp    $0x2d80,%ebx
+    1ba2:	75 e7                	jne    1b8b <flushall+0x1b>
+}
+    1ba4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1ba7:	c9                   	leave
+    1ba8:	c3                   	ret
+    1ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001bb0 <fflush>:
+{
+    1bb0:	55                   	push   %ebp
+    1bb1:	89 e5                	mov    %esp,%ebp
+    1bb3:	57                   	push   %edi
+    1bb4:	56                   	push   %esi
+    1bb5:	53                   	push   %ebx
+    1bb6:	83 ec 0c             	sub    $0xc,%esp
+    1bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1bbc:	85 c0                	test   %eax,%eax
+    1bbe:	74 28                	je     1be8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1bc0:	8b 70 08             	mov    0x8(%eax),%esi
+    1bc3:	85 f6                	test   %esi,%esi
+    1bc5:	75 11                	jne    1bd8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1bc7:	83 c4 0c             	add    $0xc,%esp
+    1bca:	89 f0                	mov    %esi,%eax
+    1bcc:	5b                   	pop    %ebx
+    1bcd:	5e                   	pop    %esi
+    1bce:	5f                   	pop    %edi
+    1bcf:	5d                   	pop    %ebp
+    1bd0:	c3                   	ret
+    1bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bd8:	83 c4 0c             	add    $0xc,%esp
+    1bdb:	5b                   	pop    %ebx
+    1bdc:	5e                   	pop    %esi
+    1bdd:	5f                   	pop    %edi
+    1bde:	5d                   	pop    %ebp
+  return drain(f);
+    1bdf:	e9 1c ff ff ff       	jmp    1b00 <drain>
+    1be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1be8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1bea:	bb 40 2b 00 00       	mov    $0x2b40,%ebx
+        r = -1;
+    1bef:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1bf4:	eb 15                	jmp    1c0b <fflush+0x5b>
+    1bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bfd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1c00:	83 c3 24             	add    $0x24,%ebx
+    1c03:	81 fb 80 2d 00 00    	cmp    $0x2d80,%ebx
+    1c09:	74 bc                	je     1bc7 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1c0b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1c0e:	85 c0                	test   %eax,%eax
+    1c10:	74 ee                	je     1c00 <fflush+0x50>
+    1c12:	89 d8                	mov    %ebx,%eax
+    1c14:	e8 e7 fe ff ff       	call   1b00 <drain>
+        r = -1;
+    1c19:	85 c0                	test   %eax,%eax
+    1c1b:	0f 48 f7             	cmovs  %edi,%esi
+    1c1e:	eb e0                	jmp    1c00 <fflush+0x50>
+
+00001c20 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1c20:	55                   	push   %ebp
+    1c21:	89 e5                	mov    %esp,%ebp
+    1c23:	57                   	push   %edi
+    1c24:	56                   	push   %esi
+    1c25:	53                   	push   %ebx
+    1c26:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1c29:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1c2c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1c30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1c33:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1c36:	85 d2                	test   %edx,%edx
+    1c38:	0f 8e 26 01 00 00    	jle    1d64 <fwrite+0x144>
+  if(!f->writable){
+    1c3e:	8b 46 08             	mov    0x8(%esi),%eax
+    1c41:	85 c0                	test   %eax,%eax
+    1c43:	0f 84 14 01 00 00    	je     1d5d <fwrite+0x13d>
+  setmode(f);
+    1c49:	89 f0                	mov    %esi,%eax
+    1c4b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c4e:	e8 2d fe ff ff       	call   1a80 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1c53:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1c57:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1c5a:	c7 05 80 2d 00 00 70 	movl   $0x1b70,0x2d80
+    1c61:	1b 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1c64:	0f 84 b6 00 00 00    	je     1d20 <fwrite+0x100>
+    1c6a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1c70:	0f 8f aa 00 00 00    	jg     1d20 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1c76:	8b 46 20             	mov    0x20(%esi),%eax
+    1c79:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1c7c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1c7e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1c83:	74 6c                	je     1cf1 <fwrite+0xd1>
+    1c85:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1c88:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1c8b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1c90:	29 c2                	sub    %eax,%edx
+    1c92:	39 ca                	cmp    %ecx,%edx
+    1c94:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1c97:	85 d2                	test   %edx,%edx
+    1c99:	0f 8e d1 00 00 00    	jle    1d70 <fwrite+0x150>
+    1c9f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1ca2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1ca5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1caf:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1cb0:	8d 50 01             	lea    0x1(%eax),%edx
+    1cb3:	83 c3 01             	add    $0x1,%ebx
+    1cb6:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1cb9:	89 56 20             	mov    %edx,0x20(%esi)
+    1cbc:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1cc0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1cc3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1cc6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1ccb:	80 fa 0a             	cmp    $0xa,%dl
+    1cce:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1cd1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1cd4:	39 cb                	cmp    %ecx,%ebx
+    1cd6:	75 d8                	jne    1cb0 <fwrite+0x90>
+    1cd8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1cdb:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1cde:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1ce1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1ce4:	85 db                	test   %ebx,%ebx
+    1ce6:	7e 19                	jle    1d01 <fwrite+0xe1>
+    n -= k;
+    1ce8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1cea:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1cef:	75 97                	jne    1c88 <fwrite+0x68>
+    1cf1:	89 f0                	mov    %esi,%eax
+    1cf3:	e8 08 fe ff ff       	call   1b00 <drain>
+    1cf8:	85 c0                	test   %eax,%eax
+    1cfa:	78 68                	js     1d64 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1cfc:	8b 46 20             	mov    0x20(%esi),%eax
+    1cff:	eb 87                	jmp    1c88 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d01:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1d06:	74 74                	je     1d7c <fwrite+0x15c>
+    1d08:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1d0c:	75 04                	jne    1d12 <fwrite+0xf2>
+    1d0e:	85 ff                	test   %edi,%edi
+    1d10:	75 6a                	jne    1d7c <fwrite+0x15c>
+    return nmemb;
+    1d12:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1d15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d18:	5b                   	pop    %ebx
+    1d19:	5e                   	pop    %esi
+    1d1a:	5f                   	pop    %edi
+    1d1b:	5d                   	pop    %ebp
+    1d1c:	c3                   	ret
+    1d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1d20:	89 f0                	mov    %esi,%eax
+    1d22:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1d25:	e8 d6 fd ff ff       	call   1b00 <drain>
+    1d2a:	85 c0                	test   %eax,%eax
+    1d2c:	78 2f                	js     1d5d <fwrite+0x13d>
+    1d2e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1d31:	8b 3e                	mov    (%esi),%edi
+    1d33:	89 de                	mov    %ebx,%esi
+    1d35:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1d38:	eb 0e                	jmp    1d48 <fwrite+0x128>
+    1d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1d40:	29 c3                	sub    %eax,%ebx
+    1d42:	01 c6                	add    %eax,%esi
+    1d44:	85 db                	test   %ebx,%ebx
+    1d46:	7e ca                	jle    1d12 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1d48:	83 ec 04             	sub    $0x4,%esp
+    1d4b:	53                   	push   %ebx
+    1d4c:	56                   	push   %esi
+    1d4d:	57                   	push   %edi
+    1d4e:	e8 bc f7 ff ff       	call   150f <write>
+    1d53:	83 c4 10             	add    $0x10,%esp
+    1d56:	85 c0                	test   %eax,%eax
+    1d58:	7f e6                	jg     1d40 <fwrite+0x120>
+    1d5a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1d5d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1d64:	31 c0                	xor    %eax,%eax
+}
+    1d66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d69:	5b                   	pop    %ebx
+    1d6a:	5e                   	pop    %esi
+    1d6b:	5f                   	pop    %edi
+    1d6c:	5d                   	pop    %ebp
+    1d6d:	c3                   	ret
+    1d6e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1d70:	89 d9                	mov    %ebx,%ecx
+    1d72:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1d75:	89 cb                	mov    %ecx,%ebx
+    1d77:	e9 6e ff ff ff       	jmp    1cea <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d7c:	89 f0                	mov    %esi,%eax
+    1d7e:	e8 7d fd ff ff       	call   1b00 <drain>
+    1d83:	85 c0                	test   %eax,%eax
+    1d85:	79 8b                	jns    1d12 <fwrite+0xf2>
+    return 0;
+    1d87:	31 c0                	xor    %eax,%eax
+    1d89:	eb db                	jmp    1d66 <fwrite+0x146>
+    1d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d8f:	90                   	nop
+
+00001d90 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1d90:	55                   	push   %ebp
+    1d91:	89 e5                	mov    %esp,%ebp
+    1d93:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1d96:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d99:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1d9c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1d9f:	ff 75 0c             	push   0xc(%ebp)
+    1da2:	6a 01                	push   $0x1
+    1da4:	6a 01                	push   $0x1
+    1da6:	50                   	push   %eax
+    1da7:	e8 74 fe ff ff       	call   1c20 <fwrite>
+    1dac:	83 c4 10             	add    $0x10,%esp
+    1daf:	83 f8 01             	cmp    $0x1,%eax
+    1db2:	75 0c                	jne    1dc0 <fputc+0x30>
+    1db4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1db8:	c9                   	leave
+    1db9:	c3                   	ret
+    1dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1dc0:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1dc1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1dc6:	c3                   	ret
+    1dc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dce:	66 90                	xchg   %ax,%ax
+
+00001dd0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1dd0:	55                   	push   %ebp
+    1dd1:	89 e5                	mov    %esp,%ebp
+    1dd3:	57                   	push   %edi
+    1dd4:	56                   	push   %esi
+    1dd5:	53                   	push   %ebx
+    1dd6:	83 ec 1c             	sub    $0x1c,%esp
+    1dd9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1ddc:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1ddf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1de2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1de5:	85 d2                	test   %edx,%edx
+    1de7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1dea:	7e 12                	jle    1dfe <fread+0x2e>
+    1dec:	85 ff                	test   %edi,%edi
+    1dee:	7e 0e                	jle    1dfe <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1df0:	8b 43 04             	mov    0x4(%ebx),%eax
+    1df3:	85 c0                	test   %eax,%eax
+    1df5:	75 19                	jne    1e10 <fread+0x40>
+    f->err = 1;
+    1df7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1dfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1e01:	31 c0                	xor    %eax,%eax
+}
+    1e03:	5b                   	pop    %ebx
+    1e04:	5e                   	pop    %esi
+    1e05:	5f                   	pop    %edi
+    1e06:	5d                   	pop    %ebp
+    1e07:	c3                   	ret
+    1e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e0f:	90                   	nop
+  setmode(f);
+    1e10:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1e12:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1e14:	e8 67 fc ff ff       	call   1a80 <setmode>
+  for(n = 0; n < want; n += k){
+    1e19:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1e1c:	89 f7                	mov    %esi,%edi
+    1e1e:	eb 31                	jmp    1e51 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1e20:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1e24:	74 08                	je     1e2e <fread+0x5e>
+    1e26:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1e2c:	7e 62                	jle    1e90 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1e2e:	83 ec 04             	sub    $0x4,%esp
+    1e31:	56                   	push   %esi
+    1e32:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e35:	01 f8                	add    %edi,%eax
+    1e37:	50                   	push   %eax
+    1e38:	ff 33                	push   (%ebx)
+    1e3a:	e8 c1 f6 ff ff       	call   1500 <read>
+    1e3f:	83 c4 10             	add    $0x10,%esp
+    1e42:	85 c0                	test   %eax,%eax
+    1e44:	0f 8e ce 00 00 00    	jle    1f18 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1e4a:	01 c7                	add    %eax,%edi
+    1e4c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1e4f:	7e 36                	jle    1e87 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1e51:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1e54:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1e57:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1e5a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1e5c:	39 c1                	cmp    %eax,%ecx
+    1e5e:	7d c0                	jge    1e20 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1e60:	29 c8                	sub    %ecx,%eax
+    1e62:	39 f0                	cmp    %esi,%eax
+    1e64:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1e67:	83 ec 04             	sub    $0x4,%esp
+    1e6a:	56                   	push   %esi
+    1e6b:	03 4b 18             	add    0x18(%ebx),%ecx
+    1e6e:	51                   	push   %ecx
+    1e6f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e72:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1e74:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1e76:	50                   	push   %eax
+    1e77:	e8 34 f5 ff ff       	call   13b0 <memmove>
+      f->r += k;
+    1e7c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1e7f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1e82:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1e85:	7f ca                	jg     1e51 <fread+0x81>
+    1e87:	89 fe                	mov    %edi,%esi
+    1e89:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e8c:	eb 3f                	jmp    1ecd <fread+0xfd>
+    1e8e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1e90:	3b 1d 28 2b 00 00    	cmp    0x2b28,%ebx
+    1e96:	74 68                	je     1f00 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1e98:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1e9b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1ea2:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1ea9:	68 00 04 00 00       	push   $0x400
+    1eae:	ff 73 18             	push   0x18(%ebx)
+    1eb1:	ff 33                	push   (%ebx)
+    1eb3:	e8 48 f6 ff ff       	call   1500 <read>
+    1eb8:	83 c4 10             	add    $0x10,%esp
+    1ebb:	85 c0                	test   %eax,%eax
+    1ebd:	78 21                	js     1ee0 <fread+0x110>
+  else if(n == 0)
+    1ebf:	75 2f                	jne    1ef0 <fread+0x120>
+    f->eof = 1;
+    1ec1:	89 fe                	mov    %edi,%esi
+    1ec3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1ec6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1ecd:	89 f0                	mov    %esi,%eax
+}
+    1ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1ed2:	99                   	cltd
+}
+    1ed3:	5b                   	pop    %ebx
+    1ed4:	5e                   	pop    %esi
+  return n / size;
+    1ed5:	f7 ff                	idiv   %edi
+}
+    1ed7:	5f                   	pop    %edi
+    1ed8:	5d                   	pop    %ebp
+    1ed9:	c3                   	ret
+    1eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1ee0:	89 fe                	mov    %edi,%esi
+    1ee2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1ee5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1eec:	eb df                	jmp    1ecd <fread+0xfd>
+    1eee:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1ef0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1ef3:	e9 54 ff ff ff       	jmp    1e4c <fread+0x7c>
+    1ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1eff:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1f00:	83 ec 0c             	sub    $0xc,%esp
+    1f03:	ff 35 24 2b 00 00    	push   0x2b24
+    1f09:	e8 a2 fc ff ff       	call   1bb0 <fflush>
+    1f0e:	83 c4 10             	add    $0x10,%esp
+    1f11:	eb 85                	jmp    1e98 <fread+0xc8>
+    1f13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1f17:	90                   	nop
+        if(k < 0)
+    1f18:	89 fe                	mov    %edi,%esi
+    1f1a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1f1d:	74 a7                	je     1ec6 <fread+0xf6>
+    1f1f:	eb c4                	jmp    1ee5 <fread+0x115>
+    1f21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f2f:	90                   	nop
+
+00001f30 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1f30:	55                   	push   %ebp
+    1f31:	89 e5                	mov    %esp,%ebp
+    1f33:	53                   	push   %ebx
+    1f34:	83 ec 14             	sub    $0x14,%esp
+    1f37:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1f3a:	8b 50 04             	mov    0x4(%eax),%edx
+    1f3d:	85 d2                	test   %edx,%edx
+    1f3f:	74 08                	je     1f49 <fgetc+0x19>
+    1f41:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1f44:	3b 50 20             	cmp    0x20(%eax),%edx
+    1f47:	7c 27                	jl     1f70 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f49:	50                   	push   %eax
+    1f4a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1f4d:	6a 01                	push   $0x1
+    1f4f:	6a 01                	push   $0x1
+    1f51:	50                   	push   %eax
+    1f52:	e8 79 fe ff ff       	call   1dd0 <fread>
+    1f57:	83 c4 10             	add    $0x10,%esp
+    1f5a:	83 f8 01             	cmp    $0x1,%eax
+    1f5d:	75 29                	jne    1f88 <fgetc+0x58>
+    1f5f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1f63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f66:	c9                   	leave
+    1f67:	c3                   	ret
+    1f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f6f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1f70:	8b 48 18             	mov    0x18(%eax),%ecx
+    1f73:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1f76:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1f79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1f7c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1f80:	c9                   	leave
+    1f81:	c3                   	ret
+    1f82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1f8d:	eb d4                	jmp    1f63 <fgetc+0x33>
+    1f8f:	90                   	nop
+
+00001f90 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	57                   	push   %edi
+    1f94:	56                   	push   %esi
+    1f95:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1f96:	31 db                	xor    %ebx,%ebx
+{
+    1f98:	83 ec 1c             	sub    $0x1c,%esp
+    1f9b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1f9e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1fa0:	eb 2e                	jmp    1fd0 <fgets+0x40>
+    1fa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1fa8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1fab:	57                   	push   %edi
+    1fac:	6a 01                	push   $0x1
+    1fae:	6a 01                	push   $0x1
+    1fb0:	50                   	push   %eax
+    1fb1:	e8 1a fe ff ff       	call   1dd0 <fread>
+    1fb6:	83 c4 10             	add    $0x10,%esp
+    1fb9:	83 f8 01             	cmp    $0x1,%eax
+    1fbc:	75 62                	jne    2020 <fgets+0x90>
+    1fbe:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1fc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1fc5:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1fc7:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1fcb:	83 f9 0a             	cmp    $0xa,%ecx
+    1fce:	74 34                	je     2004 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1fd0:	89 de                	mov    %ebx,%esi
+    1fd2:	83 c3 01             	add    $0x1,%ebx
+    1fd5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1fd8:	7d 46                	jge    2020 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1fda:	8b 47 04             	mov    0x4(%edi),%eax
+    1fdd:	85 c0                	test   %eax,%eax
+    1fdf:	74 c7                	je     1fa8 <fgets+0x18>
+    1fe1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1fe4:	3b 47 20             	cmp    0x20(%edi),%eax
+    1fe7:	7d bf                	jge    1fa8 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1fe9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1fec:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1fef:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1ff2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1ff5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1ff9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1ffb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1fff:	83 f9 0a             	cmp    $0xa,%ecx
+    2002:	75 cc                	jne    1fd0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    2004:	8b 45 08             	mov    0x8(%ebp),%eax
+    2007:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    200b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    200e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2011:	5b                   	pop    %ebx
+    2012:	5e                   	pop    %esi
+    2013:	5f                   	pop    %edi
+    2014:	5d                   	pop    %ebp
+    2015:	c3                   	ret
+    2016:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    201d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2020:	8b 45 08             	mov    0x8(%ebp),%eax
+    2023:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2027:	31 c0                	xor    %eax,%eax
+    2029:	85 f6                	test   %esi,%esi
+    202b:	74 e1                	je     200e <fgets+0x7e>
+    202d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2030:	eb dc                	jmp    200e <fgets+0x7e>
+    2032:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002040 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    2040:	55                   	push   %ebp
+    2041:	89 e5                	mov    %esp,%ebp
+    2043:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2044:	bb 40 2b 00 00       	mov    $0x2b40,%ebx
+{
+    2049:	83 ec 04             	sub    $0x4,%esp
+    204c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    2050:	8b 53 04             	mov    0x4(%ebx),%edx
+    2053:	85 d2                	test   %edx,%edx
+    2055:	75 07                	jne    205e <fdopen+0x1e>
+    2057:	8b 43 08             	mov    0x8(%ebx),%eax
+    205a:	85 c0                	test   %eax,%eax
+    205c:	74 1a                	je     2078 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    205e:	83 c3 24             	add    $0x24,%ebx
+    2061:	81 fb 80 2d 00 00    	cmp    $0x2d80,%ebx
+    2067:	75 e7                	jne    2050 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2069:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    206b:	89 d8                	mov    %ebx,%eax
+    206d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2070:	c9                   	leave
+    2071:	c3                   	ret
+    2072:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2078:	81 fb 80 2d 00 00    	cmp    $0x2d80,%ebx
+    207e:	74 e9                	je     2069 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2080:	83 ec 04             	sub    $0x4,%esp
+    2083:	6a 24                	push   $0x24
+    2085:	6a 00                	push   $0x0
+    2087:	53                   	push   %ebx
+    2088:	e8 d3 f1 ff ff       	call   1260 <memset>
+  f->fd = fd;
+    208d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2090:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2097:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    209a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    209c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    209f:	80 38 72             	cmpb   $0x72,(%eax)
+    20a2:	74 14                	je     20b8 <fdopen+0x78>
+    f->writable = 1;
+    20a4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    20ab:	89 d8                	mov    %ebx,%eax
+    20ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    20b0:	c9                   	leave
+    20b1:	c3                   	ret
+    20b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    20b8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    20bf:	89 d8                	mov    %ebx,%eax
+    20c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    20c4:	c9                   	leave
+    20c5:	c3                   	ret
+    20c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020d0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    20d0:	55                   	push   %ebp
+    20d1:	89 e5                	mov    %esp,%ebp
+    20d3:	56                   	push   %esi
+    20d4:	53                   	push   %ebx
+    20d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    20d8:	0f b6 06             	movzbl (%esi),%eax
+    20db:	3c 72                	cmp    $0x72,%al
+    20dd:	74 61                	je     2140 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    20df:	3c 77                	cmp    $0x77,%al
+    20e1:	74 7d                	je     2160 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    20e3:	3c 61                	cmp    $0x61,%al
+    20e5:	75 49                	jne    2130 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    20e7:	83 ec 08             	sub    $0x8,%esp
+    20ea:	68 01 02 00 00       	push   $0x201
+    20ef:	ff 75 08             	push   0x8(%ebp)
+    20f2:	e8 54 f4 ff ff       	call   154b <open>
+    20f7:	83 c4 10             	add    $0x10,%esp
+    20fa:	89 c3                	mov    %eax,%ebx
+    20fc:	85 c0                	test   %eax,%eax
+    20fe:	78 30                	js     2130 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2100:	83 ec 04             	sub    $0x4,%esp
+    2103:	6a 02                	push   $0x2
+    2105:	6a 00                	push   $0x0
+    2107:	50                   	push   %eax
+    2108:	e8 4c f5 ff ff       	call   1659 <lseek>
+    210d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2110:	83 ec 08             	sub    $0x8,%esp
+    2113:	56                   	push   %esi
+    2114:	53                   	push   %ebx
+    2115:	e8 26 ff ff ff       	call   2040 <fdopen>
+    211a:	83 c4 10             	add    $0x10,%esp
+    211d:	85 c0                	test   %eax,%eax
+    211f:	75 11                	jne    2132 <fopen+0x62>
+    close(fd);
+    2121:	83 ec 0c             	sub    $0xc,%esp
+    2124:	53                   	push   %ebx
+    2125:	e8 f4 f3 ff ff       	call   151e <close>
+    212a:	83 c4 10             	add    $0x10,%esp
+    212d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2130:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2132:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2135:	5b                   	pop    %ebx
+    2136:	5e                   	pop    %esi
+    2137:	5d                   	pop    %ebp
+    2138:	c3                   	ret
+    2139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2140:	83 ec 08             	sub    $0x8,%esp
+    2143:	6a 00                	push   $0x0
+    2145:	ff 75 08             	push   0x8(%ebp)
+    2148:	e8 fe f3 ff ff       	call   154b <open>
+    214d:	83 c4 10             	add    $0x10,%esp
+    2150:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2152:	85 db                	test   %ebx,%ebx
+    2154:	78 da                	js     2130 <fopen+0x60>
+    2156:	eb b8                	jmp    2110 <fopen+0x40>
+    2158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    215f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2160:	83 ec 08             	sub    $0x8,%esp
+    2163:	68 01 06 00 00       	push   $0x601
+    2168:	ff 75 08             	push   0x8(%ebp)
+    216b:	e8 db f3 ff ff       	call   154b <open>
+    2170:	83 c4 10             	add    $0x10,%esp
+    2173:	89 c3                	mov    %eax,%ebx
+    2175:	eb db                	jmp    2152 <fopen+0x82>
+    2177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    217e:	66 90                	xchg   %ax,%ax
+
+00002180 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2180:	55                   	push   %ebp
+    2181:	89 e5                	mov    %esp,%ebp
+    2183:	56                   	push   %esi
+    2184:	53                   	push   %ebx
+    2185:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2188:	83 ec 0c             	sub    $0xc,%esp
+    218b:	53                   	push   %ebx
+    218c:	e8 1f fa ff ff       	call   1bb0 <fflush>
+    2191:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2193:	58                   	pop    %eax
+    2194:	ff 33                	push   (%ebx)
+    2196:	e8 83 f3 ff ff       	call   151e <close>
+    219b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    219e:	85 c0                	test   %eax,%eax
+    21a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    21a5:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    21a8:	8b 43 18             	mov    0x18(%ebx),%eax
+    21ab:	85 c0                	test   %eax,%eax
+    21ad:	0f 95 c1             	setne  %cl
+    21b0:	3d a0 31 00 00       	cmp    $0x31a0,%eax
+    21b5:	0f 95 c2             	setne  %dl
+    21b8:	84 d1                	test   %dl,%cl
+    21ba:	74 07                	je     21c3 <fclose+0x43>
+    21bc:	3d a0 2d 00 00       	cmp    $0x2da0,%eax
+    21c1:	75 25                	jne    21e8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    21c3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    21ca:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    21cc:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    21d3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    21da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    21dd:	5b                   	pop    %ebx
+    21de:	5e                   	pop    %esi
+    21df:	5d                   	pop    %ebp
+    21e0:	c3                   	ret
+    21e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    21e8:	83 ec 0c             	sub    $0xc,%esp
+    21eb:	50                   	push   %eax
+    21ec:	e8 3f 00 00 00       	call   2230 <free>
+    21f1:	83 c4 10             	add    $0x10,%esp
+    21f4:	eb cd                	jmp    21c3 <fclose+0x43>
+    21f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002200 <feof>:
+
+int
+feof(FILE *f)
+{
+    2200:	55                   	push   %ebp
+    2201:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2206:	5d                   	pop    %ebp
+  return f->eof;
+    2207:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    220a:	c3                   	ret
+    220b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    220f:	90                   	nop
+
+00002210 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2210:	55                   	push   %ebp
+    2211:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2213:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2216:	5d                   	pop    %ebp
+  return f->err;
+    2217:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    221a:	c3                   	ret
+    221b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    221f:	90                   	nop
+
+00002220 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2220:	55                   	push   %ebp
+    2221:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2226:	5d                   	pop    %ebp
+  return f->fd;
+    2227:	8b 00                	mov    (%eax),%eax
+}
+    2229:	c3                   	ret
+    222a:	66 90                	xchg   %ax,%ax
+    222c:	66 90                	xchg   %ax,%ax
+    222e:	66 90                	xchg   %ax,%ax
+
+00002230 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2230:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2231:	a1 a0 35 00 00       	mov    0x35a0,%eax
+{
+    2236:	89 e5                	mov    %esp,%ebp
+    2238:	57                   	push   %edi
+    2239:	56                   	push   %esi
+    223a:	53                   	push   %ebx
+    223b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    223e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2241:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2248:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    224a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    224c:	39 ca                	cmp    %ecx,%edx
+    224e:	73 30                	jae    2280 <free+0x50>
+    2250:	39 c1                	cmp    %eax,%ecx
+    2252:	72 04                	jb     2258 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2254:	39 c2                	cmp    %eax,%edx
+    2256:	72 f0                	jb     2248 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2258:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    225b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    225e:	39 f8                	cmp    %edi,%eax
+    2260:	74 2e                	je     2290 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2262:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2265:	8b 42 04             	mov    0x4(%edx),%eax
+    2268:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    226b:	39 f1                	cmp    %esi,%ecx
+    226d:	74 38                	je     22a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    226f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2271:	5b                   	pop    %ebx
+  freep = p;
+    2272:	89 15 a0 35 00 00    	mov    %edx,0x35a0
+}
+    2278:	5e                   	pop    %esi
+    2279:	5f                   	pop    %edi
+    227a:	5d                   	pop    %ebp
+    227b:	c3                   	ret
+    227c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2280:	39 c1                	cmp    %eax,%ecx
+    2282:	72 d0                	jb     2254 <free+0x24>
+    2284:	eb c2                	jmp    2248 <free+0x18>
+    2286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    228d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2290:	03 70 04             	add    0x4(%eax),%esi
+    2293:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2296:	8b 02                	mov    (%edx),%eax
+    2298:	8b 00                	mov    (%eax),%eax
+    229a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    229d:	8b 42 04             	mov    0x4(%edx),%eax
+    22a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    22a3:	39 f1                	cmp    %esi,%ecx
+    22a5:	75 c8                	jne    226f <free+0x3f>
+    p->s.size += bp->s.size;
+    22a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    22aa:	89 15 a0 35 00 00    	mov    %edx,0x35a0
+    p->s.size += bp->s.size;
+    22b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    22b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    22b6:	89 0a                	mov    %ecx,(%edx)
+}
+    22b8:	5b                   	pop    %ebx
+    22b9:	5e                   	pop    %esi
+    22ba:	5f                   	pop    %edi
+    22bb:	5d                   	pop    %ebp
+    22bc:	c3                   	ret
+    22bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000022c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    22c0:	55                   	push   %ebp
+    22c1:	89 e5                	mov    %esp,%ebp
+    22c3:	57                   	push   %edi
+    22c4:	56                   	push   %esi
+    22c5:	53                   	push   %ebx
+    22c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    22c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    22cc:	8b 15 a0 35 00 00    	mov    0x35a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    22d2:	8d 78 07             	lea    0x7(%eax),%edi
+    22d5:	c1 ef 03             	shr    $0x3,%edi
+    22d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    22db:	85 d2                	test   %edx,%edx
+    22dd:	0f 84 8d 00 00 00    	je     2370 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    22e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    22e5:	8b 48 04             	mov    0x4(%eax),%ecx
+    22e8:	39 f9                	cmp    %edi,%ecx
+    22ea:	73 64                	jae    2350 <malloc+0x90>
+  if(nu < 4096)
+    22ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    22f1:	39 df                	cmp    %ebx,%edi
+    22f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    22f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    22fd:	eb 0a                	jmp    2309 <malloc+0x49>
+    22ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2300:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2302:	8b 48 04             	mov    0x4(%eax),%ecx
+    2305:	39 f9                	cmp    %edi,%ecx
+    2307:	73 47                	jae    2350 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2309:	89 c2                	mov    %eax,%edx
+    230b:	39 05 a0 35 00 00    	cmp    %eax,0x35a0
+    2311:	75 ed                	jne    2300 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2313:	83 ec 0c             	sub    $0xc,%esp
+    2316:	56                   	push   %esi
+    2317:	e8 b6 f2 ff ff       	call   15d2 <sbrk>
+  if(p == (char*)-1)
+    231c:	83 c4 10             	add    $0x10,%esp
+    231f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2322:	74 1c                	je     2340 <malloc+0x80>
+  hp->s.size = nu;
+    2324:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2327:	83 ec 0c             	sub    $0xc,%esp
+    232a:	83 c0 08             	add    $0x8,%eax
+    232d:	50                   	push   %eax
+    232e:	e8 fd fe ff ff       	call   2230 <free>
+  return freep;
+    2333:	8b 15 a0 35 00 00    	mov    0x35a0,%edx
+      if((p = morecore(nunits)) == 0)
+    2339:	83 c4 10             	add    $0x10,%esp
+    233c:	85 d2                	test   %edx,%edx
+    233e:	75 c0                	jne    2300 <malloc+0x40>
+        return 0;
+  }
+}
+    2340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2343:	31 c0                	xor    %eax,%eax
+}
+    2345:	5b                   	pop    %ebx
+    2346:	5e                   	pop    %esi
+    2347:	5f                   	pop    %edi
+    2348:	5d                   	pop    %ebp
+    2349:	c3                   	ret
+    234a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2350:	39 cf                	cmp    %ecx,%edi
+    2352:	74 4c                	je     23a0 <malloc+0xe0>
+        p->s.size -= nunits;
+    2354:	29 f9                	sub    %edi,%ecx
+    2356:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2359:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    235c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    235f:	89 15 a0 35 00 00    	mov    %edx,0x35a0
+}
+    2365:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2368:	83 c0 08             	add    $0x8,%eax
+}
+    236b:	5b                   	pop    %ebx
+    236c:	5e                   	pop    %esi
+    236d:	5f                   	pop    %edi
+    236e:	5d                   	pop    %ebp
+    236f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2370:	c7 05 a0 35 00 00 a4 	movl   $0x35a4,0x35a0
+    2377:	35 00 00 
+    base.s.size = 0;
+    237a:	b8 a4 35 00 00       	mov    $0x35a4,%eax
+    base.s.ptr = freep = prevp = &base;
+    237f:	c7 05 a4 35 00 00 a4 	movl   $0x35a4,0x35a4
+    2386:	35 00 00 
+    base.s.size = 0;
+    2389:	c7 05 a8 35 00 00 00 	movl   $0x0,0x35a8
+    2390:	00 00 00 
+    if(p->s.size >= nunits){
+    2393:	e9 54 ff ff ff       	jmp    22ec <malloc+0x2c>
+    2398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    239f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    23a0:	8b 08                	mov    (%eax),%ecx
+    23a2:	89 0a                	mov    %ecx,(%edx)
+    23a4:	eb b9                	jmp    235f <malloc+0x9f>
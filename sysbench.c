@@ -0,0 +1,49 @@
+// Null system call benchmark.
+//   sysbench [n]
+// Calls getpid() n times (default 1000000) through sysenter,
+// as every system call stub in usys.S now enters, and then
+// through the int $T_SYSCALL gate, printing the time per call.
+// For comparison, it also times ugetpid(), which reads the pid
+// from a page mapped into the process and makes no system call.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Print the time taken for n calls since start.
+void
+report(char *what, int n, int start)
+{
+  int t;
+
+  t = uptime() - start;
+  printf(1, "%s: %d calls in %d ticks", what, n, t);
+  // A tick is 10ms.
+  if(n >= 1000)
+    printf(1, ", %d ns/call", t * 10000 / (n / 1000));
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, i, start;
+
+  n = argc > 1 ? atoi(argv[1]) : 1000000;
+
+  start = uptime();
+  for(i = 0; i < n; i++)
+    getpid();
+  report("sysenter", n, start);
+
+  start = uptime();
+  for(i = 0; i < n; i++)
+    intgetpid();
+  report("int", n, start);
+
+  start = uptime();
+  for(i = 0; i < n; i++)
+    ugetpid();
+  report("ugetpid", n, start);
+  exit();
+}
@@ -6,6 +6,7 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "kstat.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -17,13 +18,7 @@
 int
 fetchint(uint addr, int *ip)
 {
-  struct proc *curproc = myproc();
-
-  if(addr >= curproc->vlimit || addr+4 > curproc->vlimit
-    || addr < curproc->vbase || addr+4 <= curproc->vbase)
-    return -1;
-  *ip = *(int*)(addr);
-  return 0;
+  return copyin(ip, addr, sizeof(*ip));
 }
 
 // Fetch the nul-terminated string at addr from the current process.
@@ -53,6 +48,17 @@ argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
 }
 
+// Check that the size bytes at addr lie within the process
+// address space, and set *pp to point at them.
+int
+fetchptr(uint addr, char **pp, int size)
+{
+  if(size < 0 || !uvalid(addr, size))
+    return -1;
+  *pp = (char*)addr;
+  return 0;
+}
+
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
 // lies within the process address space.
@@ -60,15 +66,10 @@ int
 argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
 
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->vlimit || (uint)i+size > curproc->vlimit
-    || (uint)i < curproc->vbase || (uint)i+size <= curproc->vbase)
-    return -1;
-  *pp = (char*)i;
-  return 0;
+  return fetchptr(i, pp, size);
 }
 
 // Fetch the nth word-sized system call argument as a string pointer.
@@ -107,6 +108,17 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_mprotect(void);
 extern int sys_munprotect(void);
+extern int sys_kstat(void);
+extern int sys_fcntl(void);
+extern int sys_splice(void);
+extern int sys_sendfile(void);
+extern int sys_lseek(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_ringsetup(void);
+extern int sys_ringenter(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -132,6 +144,17 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_mprotect] sys_mprotect,
 [SYS_munprotect] sys_munprotect,
+[SYS_kstat]   sys_kstat,
+[SYS_fcntl]   sys_fcntl,
+[SYS_splice]  sys_splice,
+[SYS_sendfile] sys_sendfile,
+[SYS_lseek]   sys_lseek,
+[SYS_pread]   sys_pread,
+[SYS_pwrite]  sys_pwrite,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_ringsetup] sys_ringsetup,
+[SYS_ringenter] sys_ringenter,
 };
 
 void
@@ -140,6 +163,9 @@ syscall(void)
   int num;
   struct proc *curproc = myproc();
 
+  pushcli();
+  mycpu()->nsyscall++;
+  popcli();
   num = curproc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     curproc->tf->eax = syscalls[num]();
@@ -149,3 +175,12 @@ syscall(void)
     curproc->tf->eax = -1;
   }
 }
+
+void
+syscallstat(struct kstat *st)
+{
+  int i;
+
+  for(i = 0; i < ncpu; i++)
+    st->syscalls += cpus[i].nsyscall;
+}
@@ -22,3 +22,14 @@
 #define SYS_close   21
 #define SYS_mprotect 22
 #define SYS_munprotect 23
+#define SYS_kstat  24
+#define SYS_fcntl  25
+#define SYS_splice 26
+#define SYS_sendfile 27
+#define SYS_lseek  28
+#define SYS_pread  29
+#define SYS_pwrite 30
+#define SYS_readv  31
+#define SYS_writev 32
+#define SYS_ringsetup 33
+#define SYS_ringenter 34
@@ -15,6 +15,20 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "ring.h"
+
+// Look up file descriptor fd of the current process.
+static int
+fdfile(int fd, struct file **pf)
+{
+  struct file *f;
+
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+    return -1;
+  if(pf)
+    *pf = f;
+  return 0;
+}
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -22,16 +36,11 @@ static int
 argfd(int n, int *pfd, struct file **pf)
 {
   int fd;
-  struct file *f;
 
-  if(argint(n, &fd) < 0)
-    return -1;
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  if(argint(n, &fd) < 0 || fdfile(fd, pf) < 0)
     return -1;
   if(pfd)
     *pfd = fd;
-  if(pf)
-    *pf = f;
   return 0;
 }
 
@@ -52,6 +61,19 @@ fdalloc(struct file *f)
   return -1;
 }
 
+// Close file descriptor fd.
+static int
+fdclose(int fd)
+{
+  struct file *f;
+
+  if(fdfile(fd, &f) < 0)
+    return -1;
+  myproc()->ofile[fd] = 0;
+  fileclose(f);
+  return 0;
+}
+
 int
 sys_dup(void)
 {
@@ -91,27 +113,112 @@ sys_write(void)
 }
 
 int
-sys_close(void)
+sys_lseek(void)
 {
-  int fd;
   struct file *f;
+  int off, whence;
 
-  if(argfd(0, &fd, &f) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &whence) < 0)
     return -1;
-  myproc()->ofile[fd] = 0;
-  fileclose(f);
+  return fileseek(f, off, whence);
+}
+
+int
+sys_pread(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepread(f, p, n, off);
+}
+
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepwrite(f, p, n, off);
+}
+
+// Fetch the iovec array of cnt entries that is the nth
+// argument into iov, checking each buffer.
+static int
+argiov(int n, int cnt, struct iovec *iov)
+{
+  struct iovec *uiov;
+  char *p;
+  int i, tot;
+
+  if(cnt < 0 || cnt > MAXIOV || argptr(n, (void*)&uiov, cnt*sizeof(*uiov)) < 0)
+    return -1;
+  tot = 0;
+  for(i = 0; i < cnt; i++){
+    iov[i] = uiov[i];
+    if(fetchptr((uint)iov[i].iov_base, &p, iov[i].iov_len) < 0)
+      return -1;
+    // The total must fit the int that readv and writev return.
+    if(iov[i].iov_len > 0x7fffffff - tot)
+      return -1;
+    tot += iov[i].iov_len;
+  }
   return 0;
 }
 
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec iov[MAXIOV];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, iov) < 0)
+    return -1;
+  return filereadv(f, iov, cnt);
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[MAXIOV];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, iov) < 0)
+    return -1;
+  return filewritev(f, iov, cnt);
+}
+
+int
+sys_close(void)
+{
+  int fd;
+
+  if(argint(0, &fd) < 0)
+    return -1;
+  return fdclose(fd);
+}
+
 int
 sys_fstat(void)
 {
   struct file *f;
-  struct stat *st;
+  struct stat st;
+  uint addr;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(1, (int*)&addr) < 0)
+    return -1;
+  if(filestat(f, &st) < 0)
     return -1;
-  return filestat(f, st);
+  return copyout(addr, &st, sizeof(st));
 }
 
 // Create the path new as a link to the same inode as old.
@@ -218,6 +325,7 @@ sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  dcforget(dp->dev, dp->inum, name);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -274,24 +382,44 @@ create(char *path, short type, short major, short minor)
       panic("create dots");
   }
 
-  if(dirlink(dp, name, ip->inum) < 0)
-    panic("create: dirlink");
+  if(dirlink(dp, name, ip->inum) < 0){
+    // dp's index is full, or memory ran out; give the new inode back.
+    if(type == T_DIR){
+      dp->nlink--;
+      iupdate(dp);
+    }
+    iunlockput(dp);
+    ip->nlink = 0;
+    iupdate(ip);
+    iunlockput(ip);
+    return 0;
+  }
 
   iunlockput(dp);
 
   return ip;
 }
 
+static int openpath(char*, int);
+
 int
 sys_open(void)
 {
   char *path;
-  int fd, omode;
-  struct file *f;
-  struct inode *ip;
+  int omode;
 
   if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
     return -1;
+  return openpath(path, omode);
+}
+
+// Open path with mode omode, returning a new file descriptor.
+static int
+openpath(char *path, int omode)
+{
+  int fd;
+  struct file *f;
+  struct inode *ip;
 
   begin_op();
 
@@ -321,6 +449,9 @@ sys_open(void)
     end_op();
     return -1;
   }
+  if((omode & O_TRUNC) && ip->type == T_FILE &&
+     ((omode & O_WRONLY) || (omode & O_RDWR)))
+    itrunc(ip);
   iunlock(ip);
   end_op();
 
@@ -396,24 +527,28 @@ sys_chdir(void)
 int
 sys_exec(void)
 {
-  char *path, *argv[MAXARG];
-  int i;
-  uint uargv, uarg;
+  char path[MAXPATH], *argv[MAXARG];
+  int i, n;
+  uint addr, uargv[MAXARG];
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argint(0, (int*)&addr) < 0 || copystr(path, addr, sizeof(path)) < 0 ||
+     argint(1, (int*)&addr) < 0 || !uvalid(addr, 4))
+    return -1;
+  // Fetch as much of the argv array as there can be, at once.
+  n = (myproc()->vlimit - addr) / 4;
+  if(n > MAXARG)
+    n = MAXARG;
+  if(copyin(uargv, addr, n*4) < 0)
     return -1;
-  }
   memset(argv, 0, sizeof(argv));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
-      return -1;
-    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+    if(i >= n)
       return -1;
-    if(uarg == 0){
+    if(uargv[i] == 0){
       argv[i] = 0;
       break;
     }
-    if(fetchstr(uarg, &argv[i]) < 0)
+    if(fetchstr(uargv[i], &argv[i]) < 0)
       return -1;
   }
   return exec(path, argv);
@@ -422,23 +557,170 @@ sys_exec(void)
 int
 sys_pipe(void)
 {
-  int *fd;
+  int fd[2];
   struct file *rf, *wf;
-  int fd0, fd1;
+  uint addr;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argint(0, (int*)&addr) < 0 || !uvalid(addr, sizeof(fd)))
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
-  fd0 = -1;
-  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
-    if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
+  fd[0] = fd[1] = -1;
+  if((fd[0] = fdalloc(rf)) < 0 || (fd[1] = fdalloc(wf)) < 0 ||
+     copyout(addr, fd, sizeof(fd)) < 0){
+    if(fd[0] >= 0)
+      myproc()->ofile[fd[0]] = 0;
+    if(fd[1] >= 0)
+      myproc()->ofile[fd[1]] = 0;
     fileclose(rf);
     fileclose(wf);
     return -1;
   }
-  fd[0] = fd0;
-  fd[1] = fd1;
   return 0;
 }
+
+// Pipe buffer control: F_GETPIPE_SZ returns the size of a
+// pipe's buffer, and F_SETPIPE_SZ resizes it to hold at least
+// arg bytes, returning the new size.
+int
+sys_fcntl(void)
+{
+  struct file *f;
+  int cmd, arg;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &cmd) < 0 || argint(2, &arg) < 0)
+    return -1;
+  if(f->type != FD_PIPE)
+    return -1;
+  switch(cmd){
+  case F_GETPIPE_SZ:
+    return pipegetsize(f->pipe);
+  case F_SETPIPE_SZ:
+    return pipesetsize(f->pipe, arg);
+  }
+  return -1;
+}
+
+// Move up to n bytes from fd_in to fd_out, one of which
+// must be a pipe, without copying them to user space.
+int
+sys_splice(void)
+{
+  struct file *fin, *fout;
+  int n;
+
+  if(argfd(0, 0, &fin) < 0 || argfd(1, 0, &fout) < 0 || argint(2, &n) < 0)
+    return -1;
+  if(n < 0)
+    return -1;
+  return filesplice(fin, fout, n);
+}
+
+// Copy up to n bytes from in_fd, at offset off, or at its own
+// offset if off is -1, to out_fd, a file or pipe, without
+// copying them to user space.
+int
+sys_sendfile(void)
+{
+  struct file *fout, *fin;
+  int off, n;
+
+  if(argfd(0, 0, &fout) < 0 || argfd(1, 0, &fin) < 0 ||
+     argint(2, &off) < 0 || argint(3, &n) < 0)
+    return -1;
+  if(n < 0 || off < -1)
+    return -1;
+  return filesendfile(fout, fin, off, n);
+}
+
+//PAGEBREAK!
+// Submission rings (see ring.h) let a program have many
+// system calls carried out with one trap.  The ring lives in
+// the program's memory, so the kernel checks it, and every
+// buffer a request names, each time it uses them.
+
+// Register the calling process's ring.
+int
+sys_ringsetup(void)
+{
+  struct ring *r;
+  uint zero[4];
+
+  if(argptr(0, (void*)&r, sizeof(*r)) < 0)
+    return -1;
+  // sqhead, sqtail, cqhead and cqtail.
+  memset(zero, 0, sizeof(zero));
+  if(copyout((uint)r, zero, sizeof(zero)) < 0)
+    return -1;
+  myproc()->ring = r;
+  return 0;
+}
+
+// Carry out one request.
+static int
+ringop(struct sqe *e)
+{
+  struct file *f;
+  struct stat st;
+  char *p;
+
+  switch(e->op){
+  case RING_READ:
+    if(fdfile(e->fd, &f) < 0 || fetchptr((uint)e->buf, &p, e->n) < 0)
+      return -1;
+    return fileread(f, p, e->n);
+  case RING_WRITE:
+    if(fdfile(e->fd, &f) < 0 || fetchptr((uint)e->buf, &p, e->n) < 0)
+      return -1;
+    return filewrite(f, p, e->n);
+  case RING_OPEN:
+    if(fetchstr((uint)e->buf, &p) < 0)
+      return -1;
+    return openpath(p, e->n);
+  case RING_CLOSE:
+    return fdclose(e->fd);
+  case RING_FSTAT:
+    if(fdfile(e->fd, &f) < 0 || filestat(f, &st) < 0)
+      return -1;
+    return copyout((uint)e->buf, &st, sizeof(st));
+  }
+  return -1;
+}
+
+// Carry out up to n queued requests, in order, stopping early
+// if the completion queue fills.  Returns how many were done.
+int
+sys_ringenter(void)
+{
+  struct proc *curproc = myproc();
+  struct ring *r;
+  struct sqe e;
+  struct cqe c;
+  uint head[4];  // sqhead, sqtail, cqhead, cqtail
+  int n, done;
+
+  if(argint(0, &n) < 0 || (r = curproc->ring) == 0 ||
+     copyin(head, (uint)r, sizeof(head)) < 0)
+    return -1;
+  for(done = 0; done < n && head[0] != head[1]; done++){
+    if(head[3] - head[2] >= RINGSIZE || curproc->killed)
+      break;
+    // A copy the program can't change.
+    if(copyin(&e, (uint)&r->sq[head[0] % RINGSIZE], sizeof(e)) < 0)
+      return -1;
+    c.user = e.user;
+    c.res = ringop(&e);
+    head[0]++;
+    if(copyout((uint)&r->cq[head[3] % RINGSIZE], &c, sizeof(c)) < 0 ||
+       copyout((uint)&r->sqhead, &head[0], sizeof(head[0])) < 0)
+      return -1;
+    head[3]++;
+    if(copyout((uint)&r->cqtail, &head[3], sizeof(head[3])) < 0)
+      return -1;
+    // The program may have queued more meanwhile.
+    if(copyin(&head[1], (uint)&r->sqtail, sizeof(head[1])) < 0 ||
+       copyin(&head[2], (uint)&r->cqhead, sizeof(head[2])) < 0)
+      return -1;
+  }
+  return done;
+}
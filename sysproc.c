@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "kstat.h"
 
 int
 sys_fork(void)
@@ -111,3 +112,24 @@ sys_munprotect(void)
   }
   return munprotect((void *)addr,len);
 }
+
+// Copy kernel statistics out to the user.
+int
+sys_kstat(void)
+{
+  struct kstat st;
+  uint addr;
+
+  if(argint(0, (int*)&addr) < 0)
+    return -1;
+  memset(&st, 0, sizeof(st));
+  idestat(&st);
+  logstat(&st);
+  fsstat(&st);
+  dcstat(&st);
+  procstat(&st);
+  pipestat(&st);
+  uartstat(&st);
+  syscallstat(&st);
+  return copyout(addr, &st, sizeof(st));
+}
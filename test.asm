@@ -0,0 +1,2724 @@
+
+_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+#include "mmu.h"
+
+int
+main(int argc, char*argv[]){
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	53                   	push   %ebx
+    100e:	51                   	push   %ecx
+  char * addr = sbrk(0);
+    100f:	83 ec 0c             	sub    $0xc,%esp
+    1012:	6a 00                	push   $0x0
+    1014:	e8 b9 04 00 00       	call   14d2 <sbrk>
+  sbrk(PGSIZE);
+    1019:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  char * addr = sbrk(0);
+    1020:	89 c3                	mov    %eax,%ebx
+  sbrk(PGSIZE);
+    1022:	e8 ab 04 00 00       	call   14d2 <sbrk>
+  *addr = 100;
+    1027:	c6 03 64             	movb   $0x64,(%ebx)
+  mprotect(addr,1);
+    102a:	58                   	pop    %eax
+    102b:	5a                   	pop    %edx
+    102c:	6a 01                	push   $0x1
+    102e:	53                   	push   %ebx
+    102f:	e8 cb 04 00 00       	call   14ff <mprotect>
+  int z = fork();
+    1034:	e8 17 03 00 00       	call   1350 <fork>
+  if(z == 0){
+    1039:	83 c4 10             	add    $0x10,%esp
+    103c:	85 c0                	test   %eax,%eax
+    103e:	74 22                	je     1062 <main+0x62>
+    munprotect(addr, 1);
+    *addr = 10;
+    printf(1,"unprotect: %d \n", *addr);
+    exit();
+  }
+  else if(z>0){
+    1040:	7e 1b                	jle    105d <main+0x5d>
+    wait();
+    1042:	e8 9b 03 00 00       	call   13e2 <wait>
+    printf(1,"trap \n");
+    1047:	50                   	push   %eax
+    1048:	50                   	push   %eax
+    1049:	68 b8 22 00 00       	push   $0x22b8
+    104e:	6a 01                	push   $0x1
+    1050:	e8 9b 08 00 00       	call   18f0 <printf>
+    *addr = 10;
+    1055:	c6 03 0a             	movb   $0xa,(%ebx)
+    exit();
+    1058:	e8 23 03 00 00       	call   1380 <exit>
+  }
+  exit();
+    105d:	e8 1e 03 00 00       	call   1380 <exit>
+    printf(1,"protect: %d \n", *addr);
+    1062:	52                   	push   %edx
+    1063:	0f be 03             	movsbl (%ebx),%eax
+    1066:	50                   	push   %eax
+    1067:	68 aa 22 00 00       	push   $0x22aa
+    106c:	6a 01                	push   $0x1
+    106e:	e8 7d 08 00 00       	call   18f0 <printf>
+    munprotect(addr, 1);
+    1073:	59                   	pop    %ecx
+    1074:	58                   	pop    %eax
+    1075:	6a 01                	push   $0x1
+    1077:	53                   	push   %ebx
+    1078:	e8 91 04 00 00       	call   150e <munprotect>
+    printf(1,"unprotect: %d \n", *addr);
+    107d:	83 c4 0c             	add    $0xc,%esp
+    *addr = 10;
+    1080:	c6 03 0a             	movb   $0xa,(%ebx)
+    printf(1,"unprotect: %d \n", *addr);
+    1083:	6a 0a                	push   $0xa
+    1085:	68 a8 22 00 00       	push   $0x22a8
+    108a:	6a 01                	push   $0x1
+    108c:	e8 5f 08 00 00       	call   18f0 <printf>
+    exit();
+    1091:	e8 ea 02 00 00       	call   1380 <exit>
+    1096:	66 90                	xchg   %ax,%ax
+    1098:	66 90                	xchg   %ax,%ax
+    109a:	66 90                	xchg   %ax,%ax
+    109c:	66 90                	xchg   %ax,%ax
+    109e:	66 90                	xchg   %ax,%ax
+
+000010a0 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    10a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    10a1:	31 c0                	xor    %eax,%eax
+{
+    10a3:	89 e5                	mov    %esp,%ebp
+    10a5:	53                   	push   %ebx
+    10a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    10a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    10ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    10b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    10b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    10b7:	83 c0 01             	add    $0x1,%eax
+    10ba:	84 d2                	test   %dl,%dl
+    10bc:	75 f2                	jne    10b0 <strcpy+0x10>
+    ;
+  return os;
+}
+    10be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10c1:	89 c8                	mov    %ecx,%eax
+    10c3:	c9                   	leave
+    10c4:	c3                   	ret
+    10c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    10d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    10da:	0f b6 02             	movzbl (%edx),%eax
+    10dd:	84 c0                	test   %al,%al
+    10df:	75 17                	jne    10f8 <strcmp+0x28>
+    10e1:	eb 3a                	jmp    111d <strcmp+0x4d>
+    10e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10e7:	90                   	nop
+    10e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    10ec:	83 c2 01             	add    $0x1,%edx
+    10ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    10f2:	84 c0                	test   %al,%al
+    10f4:	74 1a                	je     1110 <strcmp+0x40>
+    p++, q++;
+    10f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    10f8:	0f b6 19             	movzbl (%ecx),%ebx
+    10fb:	38 c3                	cmp    %al,%bl
+    10fd:	74 e9                	je     10e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    10ff:	29 d8                	sub    %ebx,%eax
+}
+    1101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1104:	c9                   	leave
+    1105:	c3                   	ret
+    1106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1110:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1114:	31 c0                	xor    %eax,%eax
+    1116:	29 d8                	sub    %ebx,%eax
+}
+    1118:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    111b:	c9                   	leave
+    111c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    111d:	0f b6 19             	movzbl (%ecx),%ebx
+    1120:	31 c0                	xor    %eax,%eax
+    1122:	eb db                	jmp    10ff <strcmp+0x2f>
+    1124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+
+00001130 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1136:	80 3a 00             	cmpb   $0x0,(%edx)
+    1139:	74 15                	je     1150 <strlen+0x20>
+    113b:	31 c0                	xor    %eax,%eax
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+    1140:	83 c0 01             	add    $0x1,%eax
+    1143:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1147:	89 c1                	mov    %eax,%ecx
+    1149:	75 f5                	jne    1140 <strlen+0x10>
+    ;
+  return n;
+}
+    114b:	89 c8                	mov    %ecx,%eax
+    114d:	5d                   	pop    %ebp
+    114e:	c3                   	ret
+    114f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1150:	31 c9                	xor    %ecx,%ecx
+}
+    1152:	5d                   	pop    %ebp
+    1153:	89 c8                	mov    %ecx,%eax
+    1155:	c3                   	ret
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001160 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	57                   	push   %edi
+    1164:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1167:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    116a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    116d:	89 d7                	mov    %edx,%edi
+    116f:	fc                   	cld
+    1170:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1172:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1175:	89 d0                	mov    %edx,%eax
+    1177:	c9                   	leave
+    1178:	c3                   	ret
+    1179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001180 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	8b 45 08             	mov    0x8(%ebp),%eax
+    1186:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    118a:	0f b6 10             	movzbl (%eax),%edx
+    118d:	84 d2                	test   %dl,%dl
+    118f:	75 12                	jne    11a3 <strchr+0x23>
+    1191:	eb 1d                	jmp    11b0 <strchr+0x30>
+    1193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1197:	90                   	nop
+    1198:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    119c:	83 c0 01             	add    $0x1,%eax
+    119f:	84 d2                	test   %dl,%dl
+    11a1:	74 0d                	je     11b0 <strchr+0x30>
+    if(*s == c)
+    11a3:	38 d1                	cmp    %dl,%cl
+    11a5:	75 f1                	jne    1198 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    11a7:	5d                   	pop    %ebp
+    11a8:	c3                   	ret
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    11b0:	31 c0                	xor    %eax,%eax
+}
+    11b2:	5d                   	pop    %ebp
+    11b3:	c3                   	ret
+    11b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+
+000011c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	57                   	push   %edi
+    11c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    11c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    11c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    11c9:	31 db                	xor    %ebx,%ebx
+{
+    11cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    11ce:	eb 27                	jmp    11f7 <gets+0x37>
+    cc = read(0, &c, 1);
+    11d0:	83 ec 04             	sub    $0x4,%esp
+    11d3:	6a 01                	push   $0x1
+    11d5:	56                   	push   %esi
+    11d6:	6a 00                	push   $0x0
+    11d8:	e8 23 02 00 00       	call   1400 <read>
+    if(cc < 1)
+    11dd:	83 c4 10             	add    $0x10,%esp
+    11e0:	85 c0                	test   %eax,%eax
+    11e2:	7e 1d                	jle    1201 <gets+0x41>
+      break;
+    buf[i++] = c;
+    11e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    11e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    11ef:	3c 0a                	cmp    $0xa,%al
+    11f1:	74 10                	je     1203 <gets+0x43>
+    11f3:	3c 0d                	cmp    $0xd,%al
+    11f5:	74 0c                	je     1203 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    11f7:	89 df                	mov    %ebx,%edi
+    11f9:	83 c3 01             	add    $0x1,%ebx
+    11fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    11ff:	7c cf                	jl     11d0 <gets+0x10>
+    1201:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1203:	8b 45 08             	mov    0x8(%ebp),%eax
+    1206:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    120a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    120d:	5b                   	pop    %ebx
+    120e:	5e                   	pop    %esi
+    120f:	5f                   	pop    %edi
+    1210:	5d                   	pop    %ebp
+    1211:	c3                   	ret
+    1212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001220 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	56                   	push   %esi
+    1224:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1225:	83 ec 08             	sub    $0x8,%esp
+    1228:	6a 00                	push   $0x0
+    122a:	ff 75 08             	push   0x8(%ebp)
+    122d:	e8 19 02 00 00       	call   144b <open>
+  if(fd < 0)
+    1232:	83 c4 10             	add    $0x10,%esp
+    1235:	85 c0                	test   %eax,%eax
+    1237:	78 27                	js     1260 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1239:	83 ec 08             	sub    $0x8,%esp
+    123c:	ff 75 0c             	push   0xc(%ebp)
+    123f:	89 c3                	mov    %eax,%ebx
+    1241:	50                   	push   %eax
+    1242:	e8 31 02 00 00       	call   1478 <fstat>
+  close(fd);
+    1247:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    124a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    124c:	e8 cd 01 00 00       	call   141e <close>
+  return r;
+    1251:	83 c4 10             	add    $0x10,%esp
+}
+    1254:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1257:	89 f0                	mov    %esi,%eax
+    1259:	5b                   	pop    %ebx
+    125a:	5e                   	pop    %esi
+    125b:	5d                   	pop    %ebp
+    125c:	c3                   	ret
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1265:	eb ed                	jmp    1254 <stat+0x34>
+    1267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126e:	66 90                	xchg   %ax,%ax
+
+00001270 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	53                   	push   %ebx
+    1274:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1277:	0f be 02             	movsbl (%edx),%eax
+    127a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    127d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1280:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1285:	77 1e                	ja     12a5 <atoi+0x35>
+    1287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1290:	83 c2 01             	add    $0x1,%edx
+    1293:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1296:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    129a:	0f be 02             	movsbl (%edx),%eax
+    129d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    12a0:	80 fb 09             	cmp    $0x9,%bl
+    12a3:	76 eb                	jbe    1290 <atoi+0x20>
+  return n;
+}
+    12a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12a8:	89 c8                	mov    %ecx,%eax
+    12aa:	c9                   	leave
+    12ab:	c3                   	ret
+    12ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	57                   	push   %edi
+    12b4:	56                   	push   %esi
+    12b5:	8b 45 10             	mov    0x10(%ebp),%eax
+    12b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    12be:	85 c0                	test   %eax,%eax
+    12c0:	7e 13                	jle    12d5 <memmove+0x25>
+    12c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    12c4:	89 d7                	mov    %edx,%edi
+    12c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    12d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    12d1:	39 f8                	cmp    %edi,%eax
+    12d3:	75 fb                	jne    12d0 <memmove+0x20>
+  return vdst;
+}
+    12d5:	5e                   	pop    %esi
+    12d6:	89 d0                	mov    %edx,%eax
+    12d8:	5f                   	pop    %edi
+    12d9:	5d                   	pop    %ebp
+    12da:	c3                   	ret
+    12db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12df:	90                   	nop
+
+000012e0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	56                   	push   %esi
+    12e4:	53                   	push   %ebx
+    12e5:	8b 75 10             	mov    0x10(%ebp),%esi
+    12e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    12ee:	85 f6                	test   %esi,%esi
+    12f0:	74 2e                	je     1320 <memcmp+0x40>
+    12f2:	01 c6                	add    %eax,%esi
+    12f4:	eb 14                	jmp    130a <memcmp+0x2a>
+    12f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1300:	83 c0 01             	add    $0x1,%eax
+    1303:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1306:	39 f0                	cmp    %esi,%eax
+    1308:	74 16                	je     1320 <memcmp+0x40>
+    if(*s1 != *s2)
+    130a:	0f b6 0a             	movzbl (%edx),%ecx
+    130d:	0f b6 18             	movzbl (%eax),%ebx
+    1310:	38 d9                	cmp    %bl,%cl
+    1312:	74 ec                	je     1300 <memcmp+0x20>
+      return *s1 - *s2;
+    1314:	0f b6 c1             	movzbl %cl,%eax
+    1317:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    1319:	5b                   	pop    %ebx
+    131a:	5e                   	pop    %esi
+    131b:	5d                   	pop    %ebp
+    131c:	c3                   	ret
+    131d:	8d 76 00             	lea    0x0(%esi),%esi
+    1320:	5b                   	pop    %ebx
+  return 0;
+    1321:	31 c0                	xor    %eax,%eax
+}
+    1323:	5e                   	pop    %esi
+    1324:	5d                   	pop    %ebp
+    1325:	c3                   	ret
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001330 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1330:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1335:	c3                   	ret
+    1336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001340 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1340:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1345:	c3                   	ret
+    1346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001350 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1350:	a1 20 2c 00 00       	mov    0x2c20,%eax
+    1355:	85 c0                	test   %eax,%eax
+    1357:	74 17                	je     1370 <fork+0x20>
+{
+    1359:	55                   	push   %ebp
+    135a:	89 e5                	mov    %esp,%ebp
+    135c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    135f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1361:	c9                   	leave
+  return _fork();
+    1362:	e9 5d 00 00 00       	jmp    13c4 <_fork>
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+    1370:	e9 4f 00 00 00       	jmp    13c4 <_fork>
+    1375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001380 <exit>:
+
+int
+exit(void)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1386:	a1 20 2c 00 00       	mov    0x2c20,%eax
+    138b:	85 c0                	test   %eax,%eax
+    138d:	74 02                	je     1391 <exit+0x11>
+    flushhook();
+    138f:	ff d0                	call   *%eax
+  _exit();
+    1391:	e8 3d 00 00 00       	call   13d3 <_exit>
+    1396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    139d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013a0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    13a0:	55                   	push   %ebp
+  if(flushhook)
+    13a1:	a1 20 2c 00 00       	mov    0x2c20,%eax
+{
+    13a6:	89 e5                	mov    %esp,%ebp
+    13a8:	56                   	push   %esi
+    13a9:	53                   	push   %ebx
+    13aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    13ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    13b0:	85 c0                	test   %eax,%eax
+    13b2:	74 02                	je     13b6 <exec+0x16>
+    flushhook();
+    13b4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    13b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+    13b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    13bc:	5b                   	pop    %ebx
+    13bd:	5e                   	pop    %esi
+    13be:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    13bf:	e9 78 00 00 00       	jmp    143c <_exec>
+
+000013c4 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    13c4:	b8 01 00 00 00       	mov    $0x1,%eax
+    13c9:	89 e1                	mov    %esp,%ecx
+    13cb:	ba d2 13 00 00       	mov    $0x13d2,%edx
+    13d0:	0f 34                	sysenter
+    13d2:	c3                   	ret
+
+000013d3 <_exit>:
+RAWSYSCALL(exit)
+    13d3:	b8 02 00 00 00       	mov    $0x2,%eax
+    13d8:	89 e1                	mov    %esp,%ecx
+    13da:	ba e1 13 00 00       	mov    $0x13e1,%edx
+    13df:	0f 34                	sysenter
+    13e1:	c3                   	ret
+
+000013e2 <wait>:
+SYSCALL(wait)
+    13e2:	b8 03 00 00 00       	mov    $0x3,%eax
+    13e7:	89 e1                	mov    %esp,%ecx
+    13e9:	ba f0 13 00 00       	mov    $0x13f0,%edx
+    13ee:	0f 34                	sysenter
+    13f0:	c3                   	ret
+
+000013f1 <pipe>:
+SYSCALL(pipe)
+    13f1:	b8 04 00 00 00       	mov    $0x4,%eax
+    13f6:	89 e1                	mov    %esp,%ecx
+    13f8:	ba ff 13 00 00       	mov    $0x13ff,%edx
+    13fd:	0f 34                	sysenter
+    13ff:	c3                   	ret
+
+00001400 <read>:
+SYSCALL(read)
+    1400:	b8 05 00 00 00       	mov    $0x5,%eax
+    1405:	89 e1                	mov    %esp,%ecx
+    1407:	ba 0e 14 00 00       	mov    $0x140e,%edx
+    140c:	0f 34                	sysenter
+    140e:	c3                   	ret
+
+0000140f <write>:
+SYSCALL(write)
+    140f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1414:	89 e1                	mov    %esp,%ecx
+    1416:	ba 1d 14 00 00       	mov    $0x141d,%edx
+    141b:	0f 34                	sysenter
+    141d:	c3                   	ret
+
+0000141e <close>:
+SYSCALL(close)
+    141e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1423:	89 e1                	mov    %esp,%ecx
+    1425:	ba 2c 14 00 00       	mov    $0x142c,%edx
+    142a:	0f 34                	sysenter
+    142c:	c3                   	ret
+
+0000142d <kill>:
+SYSCALL(kill)
+    142d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1432:	89 e1                	mov    %esp,%ecx
+    1434:	ba 3b 14 00 00       	mov    $0x143b,%edx
+    1439:	0f 34                	sysenter
+    143b:	c3                   	ret
+
+0000143c <_exec>:
+RAWSYSCALL(exec)
+    143c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1441:	89 e1                	mov    %esp,%ecx
+    1443:	ba 4a 14 00 00       	mov    $0x144a,%edx
+    1448:	0f 34                	sysenter
+    144a:	c3                   	ret
+
+0000144b <open>:
+SYSCALL(open)
+    144b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1450:	89 e1                	mov    %esp,%ecx
+    1452:	ba 59 14 00 00       	mov    $0x1459,%edx
+    1457:	0f 34                	sysenter
+    1459:	c3                   	ret
+
+0000145a <mknod>:
+SYSCALL(mknod)
+    145a:	b8 11 00 00 00       	mov    $0x11,%eax
+    145f:	89 e1                	mov    %esp,%ecx
+    1461:	ba 68 14 00 00       	mov    $0x1468,%edx
+    1466:	0f 34                	sysenter
+    1468:	c3                   	ret
+
+00001469 <unlink>:
+SYSCALL(unlink)
+    1469:	b8 12 00 00 00       	mov    $0x12,%eax
+    146e:	89 e1                	mov    %esp,%ecx
+    1470:	ba 77 14 00 00       	mov    $0x1477,%edx
+    1475:	0f 34                	sysenter
+    1477:	c3                   	ret
+
+00001478 <fstat>:
+SYSCALL(fstat)
+    1478:	b8 08 00 00 00       	mov    $0x8,%eax
+    147d:	89 e1                	mov    %esp,%ecx
+    147f:	ba 86 14 00 00       	mov    $0x1486,%edx
+    1484:	0f 34                	sysenter
+    1486:	c3                   	ret
+
+00001487 <link>:
+SYSCALL(link)
+    1487:	b8 13 00 00 00       	mov    $0x13,%eax
+    148c:	89 e1                	mov    %esp,%ecx
+    148e:	ba 95 14 00 00       	mov    $0x1495,%edx
+    1493:	0f 34                	sysenter
+    1495:	c3                   	ret
+
+00001496 <mkdir>:
+SYSCALL(mkdir)
+    1496:	b8 14 00 00 00       	mov    $0x14,%eax
+    149b:	89 e1                	mov    %esp,%ecx
+    149d:	ba a4 14 00 00       	mov    $0x14a4,%edx
+    14a2:	0f 34                	sysenter
+    14a4:	c3                   	ret
+
+000014a5 <chdir>:
+SYSCALL(chdir)
+    14a5:	b8 09 00 00 00       	mov    $0x9,%eax
+    14aa:	89 e1                	mov    %esp,%ecx
+    14ac:	ba b3 14 00 00       	mov    $0x14b3,%edx
+    14b1:	0f 34                	sysenter
+    14b3:	c3                   	ret
+
+000014b4 <dup>:
+SYSCALL(dup)
+    14b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14b9:	89 e1                	mov    %esp,%ecx
+    14bb:	ba c2 14 00 00       	mov    $0x14c2,%edx
+    14c0:	0f 34                	sysenter
+    14c2:	c3                   	ret
+
+000014c3 <getpid>:
+SYSCALL(getpid)
+    14c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14c8:	89 e1                	mov    %esp,%ecx
+    14ca:	ba d1 14 00 00       	mov    $0x14d1,%edx
+    14cf:	0f 34                	sysenter
+    14d1:	c3                   	ret
+
+000014d2 <sbrk>:
+SYSCALL(sbrk)
+    14d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14d7:	89 e1                	mov    %esp,%ecx
+    14d9:	ba e0 14 00 00       	mov    $0x14e0,%edx
+    14de:	0f 34                	sysenter
+    14e0:	c3                   	ret
+
+000014e1 <sleep>:
+SYSCALL(sleep)
+    14e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14e6:	89 e1                	mov    %esp,%ecx
+    14e8:	ba ef 14 00 00       	mov    $0x14ef,%edx
+    14ed:	0f 34                	sysenter
+    14ef:	c3                   	ret
+
+000014f0 <uptime>:
+SYSCALL(uptime)
+    14f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14f5:	89 e1                	mov    %esp,%ecx
+    14f7:	ba fe 14 00 00       	mov    $0x14fe,%edx
+    14fc:	0f 34                	sysenter
+    14fe:	c3                   	ret
+
+000014ff <mprotect>:
+SYSCALL(mprotect)
+    14ff:	b8 16 00 00 00       	mov    $0x16,%eax
+    1504:	89 e1                	mov    %esp,%ecx
+    1506:	ba 0d 15 00 00       	mov    $0x150d,%edx
+    150b:	0f 34                	sysenter
+    150d:	c3                   	ret
+
+0000150e <munprotect>:
+SYSCALL(munprotect)
+    150e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1513:	89 e1                	mov    %esp,%ecx
+    1515:	ba 1c 15 00 00       	mov    $0x151c,%edx
+    151a:	0f 34                	sysenter
+    151c:	c3                   	ret
+
+0000151d <kstat>:
+SYSCALL(kstat)
+    151d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1522:	89 e1                	mov    %esp,%ecx
+    1524:	ba 2b 15 00 00       	mov    $0x152b,%edx
+    1529:	0f 34                	sysenter
+    152b:	c3                   	ret
+
+0000152c <fcntl>:
+SYSCALL(fcntl)
+    152c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1531:	89 e1                	mov    %esp,%ecx
+    1533:	ba 3a 15 00 00       	mov    $0x153a,%edx
+    1538:	0f 34                	sysenter
+    153a:	c3                   	ret
+
+0000153b <splice>:
+SYSCALL(splice)
+    153b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1540:	89 e1                	mov    %esp,%ecx
+    1542:	ba 49 15 00 00       	mov    $0x1549,%edx
+    1547:	0f 34                	sysenter
+    1549:	c3                   	ret
+
+0000154a <sendfile>:
+SYSCALL(sendfile)
+    154a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    154f:	89 e1                	mov    %esp,%ecx
+    1551:	ba 58 15 00 00       	mov    $0x1558,%edx
+    1556:	0f 34                	sysenter
+    1558:	c3                   	ret
+
+00001559 <lseek>:
+SYSCALL(lseek)
+    1559:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    155e:	89 e1                	mov    %esp,%ecx
+    1560:	ba 67 15 00 00       	mov    $0x1567,%edx
+    1565:	0f 34                	sysenter
+    1567:	c3                   	ret
+
+00001568 <pread>:
+SYSCALL(pread)
+    1568:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    156d:	89 e1                	mov    %esp,%ecx
+    156f:	ba 76 15 00 00       	mov    $0x1576,%edx
+    1574:	0f 34                	sysenter
+    1576:	c3                   	ret
+
+00001577 <pwrite>:
+SYSCALL(pwrite)
+    1577:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    157c:	89 e1                	mov    %esp,%ecx
+    157e:	ba 85 15 00 00       	mov    $0x1585,%edx
+    1583:	0f 34                	sysenter
+    1585:	c3                   	ret
+
+00001586 <readv>:
+SYSCALL(readv)
+    1586:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    158b:	89 e1                	mov    %esp,%ecx
+    158d:	ba 94 15 00 00       	mov    $0x1594,%edx
+    1592:	0f 34                	sysenter
+    1594:	c3                   	ret
+
+00001595 <writev>:
+SYSCALL(writev)
+    1595:	b8 20 00 00 00       	mov    $0x20,%eax
+    159a:	89 e1                	mov    %esp,%ecx
+    159c:	ba a3 15 00 00       	mov    $0x15a3,%edx
+    15a1:	0f 34                	sysenter
+    15a3:	c3                   	ret
+
+000015a4 <ringsetup>:
+SYSCALL(ringsetup)
+    15a4:	b8 21 00 00 00       	mov    $0x21,%eax
+    15a9:	89 e1                	mov    %esp,%ecx
+    15ab:	ba b2 15 00 00       	mov    $0x15b2,%edx
+    15b0:	0f 34                	sysenter
+    15b2:	c3                   	ret
+
+000015b3 <ringenter>:
+SYSCALL(ringenter)
+    15b3:	b8 22 00 00 00       	mov    $0x22,%eax
+    15b8:	89 e1                	mov    %esp,%ecx
+    15ba:	ba c1 15 00 00       	mov    $0x15c1,%edx
+    15bf:	0f 34                	sysenter
+    15c1:	c3                   	ret
+
+000015c2 <intgetpid>:
+INTSYSCALL(getpid)
+    15c2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    15c7:	cd 40                	int    $0x40
+    15c9:	c3                   	ret
+    15ca:	66 90                	xchg   %ax,%ax
+    15cc:	66 90                	xchg   %ax,%ax
+    15ce:	66 90                	xchg   %ax,%ax
+
+000015d0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	57                   	push   %edi
+    15d4:	56                   	push   %esi
+    15d5:	53                   	push   %ebx
+    15d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    15d8:	89 d1                	mov    %edx,%ecx
+{
+    15da:	83 ec 2c             	sub    $0x2c,%esp
+    15dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    15e0:	85 d2                	test   %edx,%edx
+    15e2:	0f 89 c0 00 00 00    	jns    16a8 <printint+0xd8>
+    15e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    15ec:	0f 84 b6 00 00 00    	je     16a8 <printint+0xd8>
+    x = -xx;
+    15f2:	f7 d9                	neg    %ecx
+    neg = 1;
+    15f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    15f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    15fc:	31 f6                	xor    %esi,%esi
+    15fe:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1600:	89 c8                	mov    %ecx,%eax
+    1602:	31 d2                	xor    %edx,%edx
+    1604:	89 f7                	mov    %esi,%edi
+    1606:	f7 f3                	div    %ebx
+    1608:	8d 76 01             	lea    0x1(%esi),%esi
+    160b:	0f b6 92 20 23 00 00 	movzbl 0x2320(%edx),%edx
+    1612:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1616:	89 ca                	mov    %ecx,%edx
+    1618:	89 c1                	mov    %eax,%ecx
+    161a:	39 da                	cmp    %ebx,%edx
+    161c:	73 e2                	jae    1600 <printint+0x30>
+  if(neg)
+    161e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1621:	85 c0                	test   %eax,%eax
+    1623:	74 07                	je     162c <printint+0x5c>
+    buf[i++] = '-';
+    1625:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    162a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    162c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    162f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1632:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1634:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1637:	8b 41 08             	mov    0x8(%ecx),%eax
+    163a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    163d:	89 ce                	mov    %ecx,%esi
+    163f:	eb 1c                	jmp    165d <printint+0x8d>
+    1641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1648:	89 c1                	mov    %eax,%ecx
+    164a:	83 c0 01             	add    $0x1,%eax
+    164d:	89 46 08             	mov    %eax,0x8(%esi)
+    1650:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1654:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1657:	39 df                	cmp    %ebx,%edi
+    1659:	74 41                	je     169c <printint+0xcc>
+    165b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    165d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1660:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1665:	75 e1                	jne    1648 <printint+0x78>
+  if(o->f)
+    1667:	8b 06                	mov    (%esi),%eax
+    1669:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    166c:	85 c0                	test   %eax,%eax
+    166e:	74 40                	je     16b0 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1670:	50                   	push   %eax
+    1671:	68 80 00 00 00       	push   $0x80
+    1676:	6a 01                	push   $0x1
+    1678:	ff 75 d4             	push   -0x2c(%ebp)
+    167b:	e8 a0 04 00 00       	call   1b20 <fwrite>
+    1680:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1684:	83 c4 10             	add    $0x10,%esp
+}
+    1687:	b8 01 00 00 00       	mov    $0x1,%eax
+    168c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    168e:	89 46 08             	mov    %eax,0x8(%esi)
+    1691:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1695:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1698:	39 df                	cmp    %ebx,%edi
+    169a:	75 bf                	jne    165b <printint+0x8b>
+}
+    169c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    169f:	5b                   	pop    %ebx
+    16a0:	5e                   	pop    %esi
+    16a1:	5f                   	pop    %edi
+    16a2:	5d                   	pop    %ebp
+    16a3:	c3                   	ret
+    16a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    16a8:	31 c0                	xor    %eax,%eax
+    16aa:	e9 4a ff ff ff       	jmp    15f9 <printint+0x29>
+    16af:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    16b0:	83 ec 04             	sub    $0x4,%esp
+    16b3:	68 80 00 00 00       	push   $0x80
+    16b8:	ff 75 d4             	push   -0x2c(%ebp)
+    16bb:	ff 76 04             	push   0x4(%esi)
+    16be:	e8 4c fd ff ff       	call   140f <write>
+    16c3:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    16c7:	83 c4 10             	add    $0x10,%esp
+    16ca:	eb bb                	jmp    1687 <printint+0xb7>
+    16cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000016d0 <putc>:
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	56                   	push   %esi
+    16d4:	89 d6                	mov    %edx,%esi
+    16d6:	53                   	push   %ebx
+    16d7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    16d9:	8b 40 08             	mov    0x8(%eax),%eax
+    16dc:	3d 80 00 00 00       	cmp    $0x80,%eax
+    16e1:	74 1d                	je     1700 <putc+0x30>
+  o->buf[o->n++] = c;
+    16e3:	89 f1                	mov    %esi,%ecx
+    16e5:	8d 50 01             	lea    0x1(%eax),%edx
+    16e8:	89 53 08             	mov    %edx,0x8(%ebx)
+    16eb:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    16ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16f2:	5b                   	pop    %ebx
+    16f3:	5e                   	pop    %esi
+    16f4:	5d                   	pop    %ebp
+    16f5:	c3                   	ret
+    16f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16fd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1700:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1702:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1705:	85 c0                	test   %eax,%eax
+    1707:	74 2f                	je     1738 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1709:	50                   	push   %eax
+    170a:	68 80 00 00 00       	push   $0x80
+    170f:	6a 01                	push   $0x1
+    1711:	52                   	push   %edx
+    1712:	e8 09 04 00 00       	call   1b20 <fwrite>
+    1717:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    171a:	89 f1                	mov    %esi,%ecx
+}
+    171c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1721:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1723:	89 53 08             	mov    %edx,0x8(%ebx)
+    1726:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    172a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    172d:	5b                   	pop    %ebx
+    172e:	5e                   	pop    %esi
+    172f:	5d                   	pop    %ebp
+    1730:	c3                   	ret
+    1731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1738:	83 ec 04             	sub    $0x4,%esp
+    173b:	68 80 00 00 00       	push   $0x80
+    1740:	52                   	push   %edx
+    1741:	ff 73 04             	push   0x4(%ebx)
+    1744:	e8 c6 fc ff ff       	call   140f <write>
+    1749:	83 c4 10             	add    $0x10,%esp
+    174c:	eb cc                	jmp    171a <putc+0x4a>
+    174e:	66 90                	xchg   %ax,%ax
+
+00001750 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	57                   	push   %edi
+    1754:	89 c7                	mov    %eax,%edi
+    1756:	56                   	push   %esi
+    1757:	31 f6                	xor    %esi,%esi
+    1759:	53                   	push   %ebx
+    175a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    175d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1760:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1763:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1766:	84 c0                	test   %al,%al
+    1768:	75 1e                	jne    1788 <vprintf.constprop.0+0x38>
+    176a:	eb 53                	jmp    17bf <vprintf.constprop.0+0x6f>
+    176c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1770:	83 f8 25             	cmp    $0x25,%eax
+    1773:	74 3b                	je     17b0 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1775:	89 ca                	mov    %ecx,%edx
+    1777:	89 f8                	mov    %edi,%eax
+    1779:	e8 52 ff ff ff       	call   16d0 <putc>
+  for(i = 0; fmt[i]; i++){
+    177e:	0f b6 03             	movzbl (%ebx),%eax
+    1781:	83 c3 01             	add    $0x1,%ebx
+    1784:	84 c0                	test   %al,%al
+    1786:	74 37                	je     17bf <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1788:	0f be c8             	movsbl %al,%ecx
+    178b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    178e:	85 f6                	test   %esi,%esi
+    1790:	74 de                	je     1770 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1792:	83 fe 25             	cmp    $0x25,%esi
+    1795:	75 e7                	jne    177e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1797:	83 f8 25             	cmp    $0x25,%eax
+    179a:	74 4e                	je     17ea <vprintf.constprop.0+0x9a>
+    179c:	83 e8 63             	sub    $0x63,%eax
+    179f:	83 f8 15             	cmp    $0x15,%eax
+    17a2:	77 34                	ja     17d8 <vprintf.constprop.0+0x88>
+    17a4:	ff 24 85 c8 22 00 00 	jmp    *0x22c8(,%eax,4)
+    17ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17af:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    17b0:	0f b6 03             	movzbl (%ebx),%eax
+    17b3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    17b6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    17bb:	84 c0                	test   %al,%al
+    17bd:	75 c9                	jne    1788 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    17bf:	8b 47 08             	mov    0x8(%edi),%eax
+    17c2:	85 c0                	test   %eax,%eax
+    17c4:	0f 8f de 00 00 00    	jg     18a8 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    17ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17cd:	5b                   	pop    %ebx
+    17ce:	5e                   	pop    %esi
+    17cf:	5f                   	pop    %edi
+    17d0:	5d                   	pop    %ebp
+    17d1:	c3                   	ret
+    17d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    17d8:	ba 25 00 00 00       	mov    $0x25,%edx
+    17dd:	89 f8                	mov    %edi,%eax
+    17df:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    17e2:	e8 e9 fe ff ff       	call   16d0 <putc>
+        putc(o, c);
+    17e7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    17ea:	89 ca                	mov    %ecx,%edx
+    17ec:	89 f8                	mov    %edi,%eax
+      state = 0;
+    17ee:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    17f0:	e8 db fe ff ff       	call   16d0 <putc>
+    17f5:	eb 87                	jmp    177e <vprintf.constprop.0+0x2e>
+    17f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fe:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1800:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1803:	83 ec 0c             	sub    $0xc,%esp
+    1806:	b9 10 00 00 00       	mov    $0x10,%ecx
+    180b:	8b 16                	mov    (%esi),%edx
+    180d:	6a 00                	push   $0x0
+        ap++;
+    180f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    1812:	89 f8                	mov    %edi,%eax
+    1814:	e8 b7 fd ff ff       	call   15d0 <printint>
+        ap++;
+    1819:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    181c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    181f:	31 f6                	xor    %esi,%esi
+    1821:	e9 58 ff ff ff       	jmp    177e <vprintf.constprop.0+0x2e>
+    1826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1830:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1833:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1835:	83 c0 04             	add    $0x4,%eax
+    1838:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    183b:	85 f6                	test   %esi,%esi
+    183d:	75 1b                	jne    185a <vprintf.constprop.0+0x10a>
+    183f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1844:	be bf 22 00 00       	mov    $0x22bf,%esi
+    1849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1850:	89 f8                	mov    %edi,%eax
+          s++;
+    1852:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1855:	e8 76 fe ff ff       	call   16d0 <putc>
+        while(*s != 0){
+    185a:	0f be 16             	movsbl (%esi),%edx
+    185d:	84 d2                	test   %dl,%dl
+    185f:	75 ef                	jne    1850 <vprintf.constprop.0+0x100>
+      state = 0;
+    1861:	31 f6                	xor    %esi,%esi
+    1863:	e9 16 ff ff ff       	jmp    177e <vprintf.constprop.0+0x2e>
+    1868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1870:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1873:	83 ec 0c             	sub    $0xc,%esp
+    1876:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    187b:	8b 16                	mov    (%esi),%edx
+    187d:	6a 01                	push   $0x1
+    187f:	eb 8e                	jmp    180f <vprintf.constprop.0+0xbf>
+    1881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1888:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    188b:	89 f8                	mov    %edi,%eax
+    188d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1890:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1893:	e8 38 fe ff ff       	call   16d0 <putc>
+        ap++;
+    1898:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    189b:	31 f6                	xor    %esi,%esi
+    189d:	e9 dc fe ff ff       	jmp    177e <vprintf.constprop.0+0x2e>
+    18a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    18a8:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    18aa:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    18ad:	85 d2                	test   %edx,%edx
+    18af:	74 1f                	je     18d0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    18b1:	52                   	push   %edx
+    18b2:	50                   	push   %eax
+    18b3:	6a 01                	push   $0x1
+    18b5:	51                   	push   %ecx
+    18b6:	e8 65 02 00 00       	call   1b20 <fwrite>
+    18bb:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    18be:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    18c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18c8:	5b                   	pop    %ebx
+    18c9:	5e                   	pop    %esi
+    18ca:	5f                   	pop    %edi
+    18cb:	5d                   	pop    %ebp
+    18cc:	c3                   	ret
+    18cd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    18d0:	83 ec 04             	sub    $0x4,%esp
+    18d3:	50                   	push   %eax
+    18d4:	51                   	push   %ecx
+    18d5:	ff 77 04             	push   0x4(%edi)
+    18d8:	e8 32 fb ff ff       	call   140f <write>
+    18dd:	83 c4 10             	add    $0x10,%esp
+    18e0:	eb dc                	jmp    18be <vprintf.constprop.0+0x16e>
+    18e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000018f0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    18f0:	55                   	push   %ebp
+    18f1:	89 e5                	mov    %esp,%ebp
+    18f3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18f9:	a1 c4 29 00 00       	mov    0x29c4,%eax
+{
+    18fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1901:	83 fa 01             	cmp    $0x1,%edx
+    1904:	74 0c                	je     1912 <printf+0x22>
+    1906:	31 c0                	xor    %eax,%eax
+    1908:	83 fa 02             	cmp    $0x2,%edx
+    190b:	0f 44 05 c0 29 00 00 	cmove  0x29c0,%eax
+  o.fd = fd;
+    1912:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1918:	8b 55 0c             	mov    0xc(%ebp),%edx
+    191b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    191e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1924:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    192a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1931:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1934:	e8 17 fe ff ff       	call   1750 <vprintf.constprop.0>
+}
+    1939:	c9                   	leave
+    193a:	c3                   	ret
+    193b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    193f:	90                   	nop
+
+00001940 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1940:	55                   	push   %ebp
+    1941:	89 e5                	mov    %esp,%ebp
+    1943:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1949:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    194c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    194f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1952:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1959:	ff ff ff 
+  o.n = 0;
+    195c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1963:	00 00 00 
+  o.f = f;
+    1966:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    196c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1972:	e8 d9 fd ff ff       	call   1750 <vprintf.constprop.0>
+}
+    1977:	c9                   	leave
+    1978:	c3                   	ret
+    1979:	66 90                	xchg   %ax,%ax
+    197b:	66 90                	xchg   %ax,%ax
+    197d:	66 90                	xchg   %ax,%ax
+    197f:	90                   	nop
+
+00001980 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1980:	55                   	push   %ebp
+    1981:	89 e5                	mov    %esp,%ebp
+    1983:	53                   	push   %ebx
+    1984:	89 c3                	mov    %eax,%ebx
+    1986:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1989:	8b 40 0c             	mov    0xc(%eax),%eax
+    198c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    198f:	74 17                	je     19a8 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1991:	83 f8 02             	cmp    $0x2,%eax
+    1994:	74 07                	je     199d <setmode+0x1d>
+    1996:	8b 43 18             	mov    0x18(%ebx),%eax
+    1999:	85 c0                	test   %eax,%eax
+    199b:	74 38                	je     19d5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    199d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    19a0:	c9                   	leave
+    19a1:	c3                   	ret
+    19a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    19a8:	83 ec 08             	sub    $0x8,%esp
+    19ab:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    19ae:	50                   	push   %eax
+    19af:	ff 33                	push   (%ebx)
+    19b1:	e8 c2 fa ff ff       	call   1478 <fstat>
+    19b6:	83 c4 10             	add    $0x10,%esp
+    19b9:	89 c2                	mov    %eax,%edx
+    19bb:	31 c0                	xor    %eax,%eax
+    19bd:	85 d2                	test   %edx,%edx
+    19bf:	75 0a                	jne    19cb <setmode+0x4b>
+    19c1:	31 c0                	xor    %eax,%eax
+    19c3:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    19c8:	0f 94 c0             	sete   %al
+    19cb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    19ce:	8b 43 18             	mov    0x18(%ebx),%eax
+    19d1:	85 c0                	test   %eax,%eax
+    19d3:	75 c8                	jne    199d <setmode+0x1d>
+    19d5:	83 ec 0c             	sub    $0xc,%esp
+    19d8:	68 00 04 00 00       	push   $0x400
+    19dd:	e8 de 07 00 00       	call   21c0 <malloc>
+    19e2:	83 c4 10             	add    $0x10,%esp
+    19e5:	89 43 18             	mov    %eax,0x18(%ebx)
+    19e8:	85 c0                	test   %eax,%eax
+    19ea:	75 b1                	jne    199d <setmode+0x1d>
+    f->mode = IONBF;
+    19ec:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    19f3:	eb a8                	jmp    199d <setmode+0x1d>
+    19f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001a00 <drain>:
+{
+    1a00:	55                   	push   %ebp
+    1a01:	89 e5                	mov    %esp,%ebp
+    1a03:	57                   	push   %edi
+    1a04:	56                   	push   %esi
+    1a05:	53                   	push   %ebx
+    1a06:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1a09:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1a0c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1a0f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1a16:	85 ff                	test   %edi,%edi
+    1a18:	7f 0e                	jg     1a28 <drain+0x28>
+  return 0;
+    1a1a:	31 c0                	xor    %eax,%eax
+}
+    1a1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a1f:	5b                   	pop    %ebx
+    1a20:	5e                   	pop    %esi
+    1a21:	5f                   	pop    %edi
+    1a22:	5d                   	pop    %ebp
+    1a23:	c3                   	ret
+    1a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1a28:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a2b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1a2e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1a30:	eb 0e                	jmp    1a40 <drain+0x40>
+    1a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1a38:	29 c7                	sub    %eax,%edi
+    1a3a:	01 c3                	add    %eax,%ebx
+    1a3c:	85 ff                	test   %edi,%edi
+    1a3e:	7e da                	jle    1a1a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1a40:	83 ec 04             	sub    $0x4,%esp
+    1a43:	57                   	push   %edi
+    1a44:	53                   	push   %ebx
+    1a45:	56                   	push   %esi
+    1a46:	e8 c4 f9 ff ff       	call   140f <write>
+    1a4b:	83 c4 10             	add    $0x10,%esp
+    1a4e:	85 c0                	test   %eax,%eax
+    1a50:	7f e6                	jg     1a38 <drain+0x38>
+    f->err = 1;
+    1a52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a55:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1a5c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a61:	eb b9                	jmp    1a1c <drain+0x1c>
+    1a63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001a70 <flushall>:
+
+static void
+flushall(void)
+{
+    1a70:	55                   	push   %ebp
+    1a71:	89 e5                	mov    %esp,%ebp
+    1a73:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a74:	bb e0 29 00 00       	mov    $0x29e0,%ebx
+{
+    1a79:	83 ec 04             	sub    $0x4,%esp
+    1a7c:	eb 0d                	jmp    1a8b <flushall+0x1b>
+    1a7e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a80:	83 c3 24             	add    $0x24,%ebx
+    1a83:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1a89:	74 19                	je     1aa4 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1a8b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1a8e:	85 c0                	test   %eax,%eax
+    1a90:	74 ee                	je     1a80 <flushall+0x10>
+    1a92:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a94:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1a97:	e8 64 ff ff ff       	call   1a00 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a9c:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1aa2:	75 e7                	jne    1a8b <flushall+0x1b>
+}
+    1aa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1aa7:	c9                   	leave
+    1aa8:	c3                   	ret
+    1aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ab0 <fflush>:
+{
+    1ab0:	55                   	push   %ebp
+    1ab1:	89 e5                	mov    %esp,%ebp
+    1ab3:	57                   	push   %edi
+    1ab4:	56                   	push   %esi
+    1ab5:	53                   	push   %ebx
+    1ab6:	83 ec 0c             	sub    $0xc,%esp
+    1ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1abc:	85 c0                	test   %eax,%eax
+    1abe:	74 28                	je     1ae8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1ac0:	8b 70 08             	mov    0x8(%eax),%esi
+    1ac3:	85 f6                	test   %esi,%esi
+    1ac5:	75 11                	jne    1ad8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1ac7:	83 c4 0c             	add    $0xc,%esp
+    1aca:	89 f0                	mov    %esi,%eax
+    1acc:	5b                   	pop    %ebx
+    1acd:	5e                   	pop    %esi
+    1ace:	5f                   	pop    %edi
+    1acf:	5d                   	pop    %ebp
+    1ad0:	c3                   	ret
+    1ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ad8:	83 c4 0c             	add    $0xc,%esp
+    1adb:	5b                   	pop    %ebx
+    1adc:	5e                   	pop    %esi
+    1add:	5f                   	pop    %edi
+    1ade:	5d                   	pop    %ebp
+  return drain(f);
+    1adf:	e9 1c ff ff ff       	jmp    1a00 <drain>
+    1ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1ae8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1aea:	bb e0 29 00 00       	mov    $0x29e0,%ebx
+        r = -1;
+    1aef:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1af4:	eb 15                	jmp    1b0b <fflush+0x5b>
+    1af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b00:	83 c3 24             	add    $0x24,%ebx
+    1b03:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1b09:	74 bc                	je     1ac7 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1b0b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1b0e:	85 c0                	test   %eax,%eax
+    1b10:	74 ee                	je     1b00 <fflush+0x50>
+    1b12:	89 d8                	mov    %ebx,%eax
+    1b14:	e8 e7 fe ff ff       	call   1a00 <drain>
+        r = -1;
+    1b19:	85 c0                	test   %eax,%eax
+    1b1b:	0f 48 f7             	cmovs  %edi,%esi
+    1b1e:	eb e0                	jmp    1b00 <fflush+0x50>
+
+00001b20 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1b20:	55                   	push   %ebp
+    1b21:	89 e5                	mov    %esp,%ebp
+    1b23:	57                   	push   %edi
+    1b24:	56                   	push   %esi
+    1b25:	53                   	push   %ebx
+    1b26:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1b29:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1b2c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1b30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1b33:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1b36:	85 d2                	test   %edx,%edx
+    1b38:	0f 8e 26 01 00 00    	jle    1c64 <fwrite+0x144>
+  if(!f->writable){
+    1b3e:	8b 46 08             	mov    0x8(%esi),%eax
+    1b41:	85 c0                	test   %eax,%eax
+    1b43:	0f 84 14 01 00 00    	je     1c5d <fwrite+0x13d>
+  setmode(f);
+    1b49:	89 f0                	mov    %esi,%eax
+    1b4b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1b4e:	e8 2d fe ff ff       	call   1980 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b53:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1b57:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1b5a:	c7 05 20 2c 00 00 70 	movl   $0x1a70,0x2c20
+    1b61:	1a 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1b64:	0f 84 b6 00 00 00    	je     1c20 <fwrite+0x100>
+    1b6a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1b70:	0f 8f aa 00 00 00    	jg     1c20 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b76:	8b 46 20             	mov    0x20(%esi),%eax
+    1b79:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1b7c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b7e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b83:	74 6c                	je     1bf1 <fwrite+0xd1>
+    1b85:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1b88:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1b8b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1b90:	29 c2                	sub    %eax,%edx
+    1b92:	39 ca                	cmp    %ecx,%edx
+    1b94:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1b97:	85 d2                	test   %edx,%edx
+    1b99:	0f 8e d1 00 00 00    	jle    1c70 <fwrite+0x150>
+    1b9f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1ba2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1ba5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1baf:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1bb0:	8d 50 01             	lea    0x1(%eax),%edx
+    1bb3:	83 c3 01             	add    $0x1,%ebx
+    1bb6:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1bb9:	89 56 20             	mov    %edx,0x20(%esi)
+    1bbc:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1bc0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1bc3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1bc6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1bcb:	80 fa 0a             	cmp    $0xa,%dl
+    1bce:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1bd1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1bd4:	39 cb                	cmp    %ecx,%ebx
+    1bd6:	75 d8                	jne    1bb0 <fwrite+0x90>
+    1bd8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1bdb:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1bde:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1be1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1be4:	85 db                	test   %ebx,%ebx
+    1be6:	7e 19                	jle    1c01 <fwrite+0xe1>
+    n -= k;
+    1be8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1bea:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1bef:	75 97                	jne    1b88 <fwrite+0x68>
+    1bf1:	89 f0                	mov    %esi,%eax
+    1bf3:	e8 08 fe ff ff       	call   1a00 <drain>
+    1bf8:	85 c0                	test   %eax,%eax
+    1bfa:	78 68                	js     1c64 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1bfc:	8b 46 20             	mov    0x20(%esi),%eax
+    1bff:	eb 87                	jmp    1b88 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c01:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1c06:	74 74                	je     1c7c <fwrite+0x15c>
+    1c08:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1c0c:	75 04                	jne    1c12 <fwrite+0xf2>
+    1c0e:	85 ff                	test   %edi,%edi
+    1c10:	75 6a                	jne    1c7c <fwrite+0x15c>
+    return nmemb;
+    1c12:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1c15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c18:	5b                   	pop    %ebx
+    1c19:	5e                   	pop    %esi
+    1c1a:	5f                   	pop    %edi
+    1c1b:	5d                   	pop    %ebp
+    1c1c:	c3                   	ret
+    1c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1c20:	89 f0                	mov    %esi,%eax
+    1c22:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c25:	e8 d6 fd ff ff       	call   1a00 <drain>
+    1c2a:	85 c0                	test   %eax,%eax
+    1c2c:	78 2f                	js     1c5d <fwrite+0x13d>
+    1c2e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1c31:	8b 3e                	mov    (%esi),%edi
+    1c33:	89 de                	mov    %ebx,%esi
+    1c35:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1c38:	eb 0e                	jmp    1c48 <fwrite+0x128>
+    1c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1c40:	29 c3                	sub    %eax,%ebx
+    1c42:	01 c6                	add    %eax,%esi
+    1c44:	85 db                	test   %ebx,%ebx
+    1c46:	7e ca                	jle    1c12 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1c48:	83 ec 04             	sub    $0x4,%esp
+    1c4b:	53                   	push   %ebx
+    1c4c:	56                   	push   %esi
+    1c4d:	57                   	push   %edi
+    1c4e:	e8 bc f7 ff ff       	call   140f <write>
+    1c53:	83 c4 10             	add    $0x10,%esp
+    1c56:	85 c0                	test   %eax,%eax
+    1c58:	7f e6                	jg     1c40 <fwrite+0x120>
+    1c5a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1c5d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1c64:	31 c0                	xor    %eax,%eax
+}
+    1c66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c69:	5b                   	pop    %ebx
+    1c6a:	5e                   	pop    %esi
+    1c6b:	5f                   	pop    %edi
+    1c6c:	5d                   	pop    %ebp
+    1c6d:	c3                   	ret
+    1c6e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1c70:	89 d9                	mov    %ebx,%ecx
+    1c72:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1c75:	89 cb                	mov    %ecx,%ebx
+    1c77:	e9 6e ff ff ff       	jmp    1bea <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c7c:	89 f0                	mov    %esi,%eax
+    1c7e:	e8 7d fd ff ff       	call   1a00 <drain>
+    1c83:	85 c0                	test   %eax,%eax
+    1c85:	79 8b                	jns    1c12 <fwrite+0xf2>
+    return 0;
+    1c87:	31 c0                	xor    %eax,%eax
+    1c89:	eb db                	jmp    1c66 <fwrite+0x146>
+    1c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c8f:	90                   	nop
+
+00001c90 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1c90:	55                   	push   %ebp
+    1c91:	89 e5                	mov    %esp,%ebp
+    1c93:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1c96:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c99:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c9c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1c9f:	ff 75 0c             	push   0xc(%ebp)
+    1ca2:	6a 01                	push   $0x1
+    1ca4:	6a 01                	push   $0x1
+    1ca6:	50                   	push   %eax
+    1ca7:	e8 74 fe ff ff       	call   1b20 <fwrite>
+    1cac:	83 c4 10             	add    $0x10,%esp
+    1caf:	83 f8 01             	cmp    $0x1,%eax
+    1cb2:	75 0c                	jne    1cc0 <fputc+0x30>
+    1cb4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1cb8:	c9                   	leave
+    1cb9:	c3                   	ret
+    1cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1cc0:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1cc1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1cc6:	c3                   	ret
+    1cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cce:	66 90                	xchg   %ax,%ax
+
+00001cd0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	57                   	push   %edi
+    1cd4:	56                   	push   %esi
+    1cd5:	53                   	push   %ebx
+    1cd6:	83 ec 1c             	sub    $0x1c,%esp
+    1cd9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1cdc:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1cdf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1ce2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1ce5:	85 d2                	test   %edx,%edx
+    1ce7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1cea:	7e 12                	jle    1cfe <fread+0x2e>
+    1cec:	85 ff                	test   %edi,%edi
+    1cee:	7e 0e                	jle    1cfe <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1cf0:	8b 43 04             	mov    0x4(%ebx),%eax
+    1cf3:	85 c0                	test   %eax,%eax
+    1cf5:	75 19                	jne    1d10 <fread+0x40>
+    f->err = 1;
+    1cf7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1cfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1d01:	31 c0                	xor    %eax,%eax
+}
+    1d03:	5b                   	pop    %ebx
+    1d04:	5e                   	pop    %esi
+    1d05:	5f                   	pop    %edi
+    1d06:	5d                   	pop    %ebp
+    1d07:	c3                   	ret
+    1d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d0f:	90                   	nop
+  setmode(f);
+    1d10:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1d12:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1d14:	e8 67 fc ff ff       	call   1980 <setmode>
+  for(n = 0; n < want; n += k){
+    1d19:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1d1c:	89 f7                	mov    %esi,%edi
+    1d1e:	eb 31                	jmp    1d51 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1d20:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1d24:	74 08                	je     1d2e <fread+0x5e>
+    1d26:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1d2c:	7e 62                	jle    1d90 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1d2e:	83 ec 04             	sub    $0x4,%esp
+    1d31:	56                   	push   %esi
+    1d32:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d35:	01 f8                	add    %edi,%eax
+    1d37:	50                   	push   %eax
+    1d38:	ff 33                	push   (%ebx)
+    1d3a:	e8 c1 f6 ff ff       	call   1400 <read>
+    1d3f:	83 c4 10             	add    $0x10,%esp
+    1d42:	85 c0                	test   %eax,%eax
+    1d44:	0f 8e ce 00 00 00    	jle    1e18 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1d4a:	01 c7                	add    %eax,%edi
+    1d4c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d4f:	7e 36                	jle    1d87 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d51:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1d54:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1d57:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d5a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1d5c:	39 c1                	cmp    %eax,%ecx
+    1d5e:	7d c0                	jge    1d20 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1d60:	29 c8                	sub    %ecx,%eax
+    1d62:	39 f0                	cmp    %esi,%eax
+    1d64:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1d67:	83 ec 04             	sub    $0x4,%esp
+    1d6a:	56                   	push   %esi
+    1d6b:	03 4b 18             	add    0x18(%ebx),%ecx
+    1d6e:	51                   	push   %ecx
+    1d6f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d72:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1d74:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1d76:	50                   	push   %eax
+    1d77:	e8 34 f5 ff ff       	call   12b0 <memmove>
+      f->r += k;
+    1d7c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1d7f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1d82:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d85:	7f ca                	jg     1d51 <fread+0x81>
+    1d87:	89 fe                	mov    %edi,%esi
+    1d89:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d8c:	eb 3f                	jmp    1dcd <fread+0xfd>
+    1d8e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1d90:	3b 1d c8 29 00 00    	cmp    0x29c8,%ebx
+    1d96:	74 68                	je     1e00 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d98:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1d9b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1da2:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1da9:	68 00 04 00 00       	push   $0x400
+    1dae:	ff 73 18             	push   0x18(%ebx)
+    1db1:	ff 33                	push   (%ebx)
+    1db3:	e8 48 f6 ff ff       	call   1400 <read>
+    1db8:	83 c4 10             	add    $0x10,%esp
+    1dbb:	85 c0                	test   %eax,%eax
+    1dbd:	78 21                	js     1de0 <fread+0x110>
+  else if(n == 0)
+    1dbf:	75 2f                	jne    1df0 <fread+0x120>
+    f->eof = 1;
+    1dc1:	89 fe                	mov    %edi,%esi
+    1dc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1dc6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1dcd:	89 f0                	mov    %esi,%eax
+}
+    1dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1dd2:	99                   	cltd
+}
+    1dd3:	5b                   	pop    %ebx
+    1dd4:	5e                   	pop    %esi
+  return n / size;
+    1dd5:	f7 ff                	idiv   %edi
+}
+    1dd7:	5f                   	pop    %edi
+    1dd8:	5d                   	pop    %ebp
+    1dd9:	c3                   	ret
+    1dda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1de0:	89 fe                	mov    %edi,%esi
+    1de2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1de5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1dec:	eb df                	jmp    1dcd <fread+0xfd>
+    1dee:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1df0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1df3:	e9 54 ff ff ff       	jmp    1d4c <fread+0x7c>
+    1df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dff:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1e00:	83 ec 0c             	sub    $0xc,%esp
+    1e03:	ff 35 c4 29 00 00    	push   0x29c4
+    1e09:	e8 a2 fc ff ff       	call   1ab0 <fflush>
+    1e0e:	83 c4 10             	add    $0x10,%esp
+    1e11:	eb 85                	jmp    1d98 <fread+0xc8>
+    1e13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e17:	90                   	nop
+        if(k < 0)
+    1e18:	89 fe                	mov    %edi,%esi
+    1e1a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e1d:	74 a7                	je     1dc6 <fread+0xf6>
+    1e1f:	eb c4                	jmp    1de5 <fread+0x115>
+    1e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e2f:	90                   	nop
+
+00001e30 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1e30:	55                   	push   %ebp
+    1e31:	89 e5                	mov    %esp,%ebp
+    1e33:	53                   	push   %ebx
+    1e34:	83 ec 14             	sub    $0x14,%esp
+    1e37:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1e3a:	8b 50 04             	mov    0x4(%eax),%edx
+    1e3d:	85 d2                	test   %edx,%edx
+    1e3f:	74 08                	je     1e49 <fgetc+0x19>
+    1e41:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1e44:	3b 50 20             	cmp    0x20(%eax),%edx
+    1e47:	7c 27                	jl     1e70 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e49:	50                   	push   %eax
+    1e4a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1e4d:	6a 01                	push   $0x1
+    1e4f:	6a 01                	push   $0x1
+    1e51:	50                   	push   %eax
+    1e52:	e8 79 fe ff ff       	call   1cd0 <fread>
+    1e57:	83 c4 10             	add    $0x10,%esp
+    1e5a:	83 f8 01             	cmp    $0x1,%eax
+    1e5d:	75 29                	jne    1e88 <fgetc+0x58>
+    1e5f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1e63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e66:	c9                   	leave
+    1e67:	c3                   	ret
+    1e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e6f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1e70:	8b 48 18             	mov    0x18(%eax),%ecx
+    1e73:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1e76:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1e79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1e7c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1e80:	c9                   	leave
+    1e81:	c3                   	ret
+    1e82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e8d:	eb d4                	jmp    1e63 <fgetc+0x33>
+    1e8f:	90                   	nop
+
+00001e90 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1e90:	55                   	push   %ebp
+    1e91:	89 e5                	mov    %esp,%ebp
+    1e93:	57                   	push   %edi
+    1e94:	56                   	push   %esi
+    1e95:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1e96:	31 db                	xor    %ebx,%ebx
+{
+    1e98:	83 ec 1c             	sub    $0x1c,%esp
+    1e9b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1e9e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1ea0:	eb 2e                	jmp    1ed0 <fgets+0x40>
+    1ea2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1ea8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1eab:	57                   	push   %edi
+    1eac:	6a 01                	push   $0x1
+    1eae:	6a 01                	push   $0x1
+    1eb0:	50                   	push   %eax
+    1eb1:	e8 1a fe ff ff       	call   1cd0 <fread>
+    1eb6:	83 c4 10             	add    $0x10,%esp
+    1eb9:	83 f8 01             	cmp    $0x1,%eax
+    1ebc:	75 62                	jne    1f20 <fgets+0x90>
+    1ebe:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1ec2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1ec5:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1ec7:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1ecb:	83 f9 0a             	cmp    $0xa,%ecx
+    1ece:	74 34                	je     1f04 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1ed0:	89 de                	mov    %ebx,%esi
+    1ed2:	83 c3 01             	add    $0x1,%ebx
+    1ed5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1ed8:	7d 46                	jge    1f20 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1eda:	8b 47 04             	mov    0x4(%edi),%eax
+    1edd:	85 c0                	test   %eax,%eax
+    1edf:	74 c7                	je     1ea8 <fgets+0x18>
+    1ee1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1ee4:	3b 47 20             	cmp    0x20(%edi),%eax
+    1ee7:	7d bf                	jge    1ea8 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1ee9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1eec:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1eef:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1ef2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1ef5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1ef9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1efb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1eff:	83 f9 0a             	cmp    $0xa,%ecx
+    1f02:	75 cc                	jne    1ed0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1f04:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f07:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1f0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f11:	5b                   	pop    %ebx
+    1f12:	5e                   	pop    %esi
+    1f13:	5f                   	pop    %edi
+    1f14:	5d                   	pop    %ebp
+    1f15:	c3                   	ret
+    1f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f1d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    1f20:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f23:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    1f27:	31 c0                	xor    %eax,%eax
+    1f29:	85 f6                	test   %esi,%esi
+    1f2b:	74 e1                	je     1f0e <fgets+0x7e>
+    1f2d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1f30:	eb dc                	jmp    1f0e <fgets+0x7e>
+    1f32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001f40 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    1f40:	55                   	push   %ebp
+    1f41:	89 e5                	mov    %esp,%ebp
+    1f43:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f44:	bb e0 29 00 00       	mov    $0x29e0,%ebx
+{
+    1f49:	83 ec 04             	sub    $0x4,%esp
+    1f4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    1f50:	8b 53 04             	mov    0x4(%ebx),%edx
+    1f53:	85 d2                	test   %edx,%edx
+    1f55:	75 07                	jne    1f5e <fdopen+0x1e>
+    1f57:	8b 43 08             	mov    0x8(%ebx),%eax
+    1f5a:	85 c0                	test   %eax,%eax
+    1f5c:	74 1a                	je     1f78 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1f5e:	83 c3 24             	add    $0x24,%ebx
+    1f61:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1f67:	75 e7                	jne    1f50 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    1f69:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    1f6b:	89 d8                	mov    %ebx,%eax
+    1f6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f70:	c9                   	leave
+    1f71:	c3                   	ret
+    1f72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    1f78:	81 fb 20 2c 00 00    	cmp    $0x2c20,%ebx
+    1f7e:	74 e9                	je     1f69 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    1f80:	83 ec 04             	sub    $0x4,%esp
+    1f83:	6a 24                	push   $0x24
+    1f85:	6a 00                	push   $0x0
+    1f87:	53                   	push   %ebx
+    1f88:	e8 d3 f1 ff ff       	call   1160 <memset>
+  f->fd = fd;
+    1f8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    1f90:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    1f97:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    1f9a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    1f9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1f9f:	80 38 72             	cmpb   $0x72,(%eax)
+    1fa2:	74 14                	je     1fb8 <fdopen+0x78>
+    f->writable = 1;
+    1fa4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    1fab:	89 d8                	mov    %ebx,%eax
+    1fad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fb0:	c9                   	leave
+    1fb1:	c3                   	ret
+    1fb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    1fb8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    1fbf:	89 d8                	mov    %ebx,%eax
+    1fc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fc4:	c9                   	leave
+    1fc5:	c3                   	ret
+    1fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001fd0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    1fd0:	55                   	push   %ebp
+    1fd1:	89 e5                	mov    %esp,%ebp
+    1fd3:	56                   	push   %esi
+    1fd4:	53                   	push   %ebx
+    1fd5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    1fd8:	0f b6 06             	movzbl (%esi),%eax
+    1fdb:	3c 72                	cmp    $0x72,%al
+    1fdd:	74 61                	je     2040 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    1fdf:	3c 77                	cmp    $0x77,%al
+    1fe1:	74 7d                	je     2060 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    1fe3:	3c 61                	cmp    $0x61,%al
+    1fe5:	75 49                	jne    2030 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    1fe7:	83 ec 08             	sub    $0x8,%esp
+    1fea:	68 01 02 00 00       	push   $0x201
+    1fef:	ff 75 08             	push   0x8(%ebp)
+    1ff2:	e8 54 f4 ff ff       	call   144b <open>
+    1ff7:	83 c4 10             	add    $0x10,%esp
+    1ffa:	89 c3                	mov    %eax,%ebx
+    1ffc:	85 c0                	test   %eax,%eax
+    1ffe:	78 30                	js     2030 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    2000:	83 ec 04             	sub    $0x4,%esp
+    2003:	6a 02                	push   $0x2
+    2005:	6a 00                	push   $0x0
+    2007:	50                   	push   %eax
+    2008:	e8 4c f5 ff ff       	call   1559 <lseek>
+    200d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    2010:	83 ec 08             	sub    $0x8,%esp
+    2013:	56                   	push   %esi
+    2014:	53                   	push   %ebx
+    2015:	e8 26 ff ff ff       	call   1f40 <fdopen>
+    201a:	83 c4 10             	add    $0x10,%esp
+    201d:	85 c0                	test   %eax,%eax
+    201f:	75 11                	jne    2032 <fopen+0x62>
+    close(fd);
+    2021:	83 ec 0c             	sub    $0xc,%esp
+    2024:	53                   	push   %ebx
+    2025:	e8 f4 f3 ff ff       	call   141e <close>
+    202a:	83 c4 10             	add    $0x10,%esp
+    202d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2030:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2032:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2035:	5b                   	pop    %ebx
+    2036:	5e                   	pop    %esi
+    2037:	5d                   	pop    %ebp
+    2038:	c3                   	ret
+    2039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2040:	83 ec 08             	sub    $0x8,%esp
+    2043:	6a 00                	push   $0x0
+    2045:	ff 75 08             	push   0x8(%ebp)
+    2048:	e8 fe f3 ff ff       	call   144b <open>
+    204d:	83 c4 10             	add    $0x10,%esp
+    2050:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2052:	85 db                	test   %ebx,%ebx
+    2054:	78 da                	js     2030 <fopen+0x60>
+    2056:	eb b8                	jmp    2010 <fopen+0x40>
+    2058:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    205f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2060:	83 ec 08             	sub    $0x8,%esp
+    2063:	68 01 06 00 00       	push   $0x601
+    2068:	ff 75 08             	push   0x8(%ebp)
+    206b:	e8 db f3 ff ff       	call   144b <open>
+    2070:	83 c4 10             	add    $0x10,%esp
+    2073:	89 c3                	mov    %eax,%ebx
+    2075:	eb db                	jmp    2052 <fopen+0x82>
+    2077:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    207e:	66 90                	xchg   %ax,%ax
+
+00002080 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2080:	55                   	push   %ebp
+    2081:	89 e5                	mov    %esp,%ebp
+    2083:	56                   	push   %esi
+    2084:	53                   	push   %ebx
+    2085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2088:	83 ec 0c             	sub    $0xc,%esp
+    208b:	53                   	push   %ebx
+    208c:	e8 1f fa ff ff       	call   1ab0 <fflush>
+    2091:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2093:	58                   	pop    %eax
+    2094:	ff 33                	push   (%ebx)
+    2096:	e8 83 f3 ff ff       	call   141e <close>
+    209b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    209e:	85 c0                	test   %eax,%eax
+    20a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    20a5:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    20a8:	8b 43 18             	mov    0x18(%ebx),%eax
+    20ab:	85 c0                	test   %eax,%eax
+    20ad:	0f 95 c1             	setne  %cl
+    20b0:	3d 40 30 00 00       	cmp    $0x3040,%eax
+    20b5:	0f 95 c2             	setne  %dl
+    20b8:	84 d1                	test   %dl,%cl
+    20ba:	74 07                	je     20c3 <fclose+0x43>
+    20bc:	3d 40 2c 00 00       	cmp    $0x2c40,%eax
+    20c1:	75 25                	jne    20e8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    20c3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    20ca:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    20cc:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    20d3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    20da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    20dd:	5b                   	pop    %ebx
+    20de:	5e                   	pop    %esi
+    20df:	5d                   	pop    %ebp
+    20e0:	c3                   	ret
+    20e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    20e8:	83 ec 0c             	sub    $0xc,%esp
+    20eb:	50                   	push   %eax
+    20ec:	e8 3f 00 00 00       	call   2130 <free>
+    20f1:	83 c4 10             	add    $0x10,%esp
+    20f4:	eb cd                	jmp    20c3 <fclose+0x43>
+    20f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002100 <feof>:
+
+int
+feof(FILE *f)
+{
+    2100:	55                   	push   %ebp
+    2101:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2103:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2106:	5d                   	pop    %ebp
+  return f->eof;
+    2107:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    210a:	c3                   	ret
+    210b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    210f:	90                   	nop
+
+00002110 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    2110:	55                   	push   %ebp
+    2111:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    2113:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2116:	5d                   	pop    %ebp
+  return f->err;
+    2117:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    211a:	c3                   	ret
+    211b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    211f:	90                   	nop
+
+00002120 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2120:	55                   	push   %ebp
+    2121:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2123:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2126:	5d                   	pop    %ebp
+  return f->fd;
+    2127:	8b 00                	mov    (%eax),%eax
+}
+    2129:	c3                   	ret
+    212a:	66 90                	xchg   %ax,%ax
+    212c:	66 90                	xchg   %ax,%ax
+    212e:	66 90                	xchg   %ax,%ax
+
+00002130 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2130:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2131:	a1 40 34 00 00       	mov    0x3440,%eax
+{
+    2136:	89 e5                	mov    %esp,%ebp
+    2138:	57                   	push   %edi
+    2139:	56                   	push   %esi
+    213a:	53                   	push   %ebx
+    213b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    213e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2141:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2148:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    214a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    214c:	39 ca                	cmp    %ecx,%edx
+    214e:	73 30                	jae    2180 <free+0x50>
+    2150:	39 c1                	cmp    %eax,%ecx
+    2152:	72 04                	jb     2158 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2154:	39 c2                	cmp    %eax,%edx
+    2156:	72 f0                	jb     2148 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2158:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    215b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    215e:	39 f8                	cmp    %edi,%eax
+    2160:	74 2e                	je     2190 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2162:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2165:	8b 42 04             	mov    0x4(%edx),%eax
+    2168:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    216b:	39 f1                	cmp    %esi,%ecx
+    216d:	74 38                	je     21a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    216f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2171:	5b                   	pop    %ebx
+  freep = p;
+    2172:	89 15 40 34 00 00    	mov    %edx,0x3440
+}
+    2178:	5e                   	pop    %esi
+    2179:	5f                   	pop    %edi
+    217a:	5d                   	pop    %ebp
+    217b:	c3                   	ret
+    217c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2180:	39 c1                	cmp    %eax,%ecx
+    2182:	72 d0                	jb     2154 <free+0x24>
+    2184:	eb c2                	jmp    2148 <free+0x18>
+    2186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    218d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2190:	03 70 04             	add    0x4(%eax),%esi
+    2193:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2196:	8b 02                	mov    (%edx),%eax
+    2198:	8b 00                	mov    (%eax),%eax
+    219a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    219d:	8b 42 04             	mov    0x4(%edx),%eax
+    21a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    21a3:	39 f1                	cmp    %esi,%ecx
+    21a5:	75 c8                	jne    216f <free+0x3f>
+    p->s.size += bp->s.size;
+    21a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    21aa:	89 15 40 34 00 00    	mov    %edx,0x3440
+    p->s.size += bp->s.size;
+    21b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    21b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    21b6:	89 0a                	mov    %ecx,(%edx)
+}
+    21b8:	5b                   	pop    %ebx
+    21b9:	5e                   	pop    %esi
+    21ba:	5f                   	pop    %edi
+    21bb:	5d                   	pop    %ebp
+    21bc:	c3                   	ret
+    21bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000021c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    21c0:	55                   	push   %ebp
+    21c1:	89 e5                	mov    %esp,%ebp
+    21c3:	57                   	push   %edi
+    21c4:	56                   	push   %esi
+    21c5:	53                   	push   %ebx
+    21c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    21c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    21cc:	8b 15 40 34 00 00    	mov    0x3440,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    21d2:	8d 78 07             	lea    0x7(%eax),%edi
+    21d5:	c1 ef 03             	shr    $0x3,%edi
+    21d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    21db:	85 d2                	test   %edx,%edx
+    21dd:	0f 84 8d 00 00 00    	je     2270 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    21e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    21e5:	8b 48 04             	mov    0x4(%eax),%ecx
+    21e8:	39 f9                	cmp    %edi,%ecx
+    21ea:	73 64                	jae    2250 <malloc+0x90>
+  if(nu < 4096)
+    21ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    21f1:	39 df                	cmp    %ebx,%edi
+    21f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    21f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    21fd:	eb 0a                	jmp    2209 <malloc+0x49>
+    21ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2200:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2202:	8b 48 04             	mov    0x4(%eax),%ecx
+    2205:	39 f9                	cmp    %edi,%ecx
+    2207:	73 47                	jae    2250 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2209:	89 c2                	mov    %eax,%edx
+    220b:	39 05 40 34 00 00    	cmp    %eax,0x3440
+    2211:	75 ed                	jne    2200 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2213:	83 ec 0c             	sub    $0xc,%esp
+    2216:	56                   	push   %esi
+    2217:	e8 b6 f2 ff ff       	call   14d2 <sbrk>
+  if(p == (char*)-1)
+    221c:	83 c4 10             	add    $0x10,%esp
+    221f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2222:	74 1c                	je     2240 <malloc+0x80>
+  hp->s.size = nu;
+    2224:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2227:	83 ec 0c             	sub    $0xc,%esp
+    222a:	83 c0 08             	add    $0x8,%eax
+    222d:	50                   	push   %eax
+    222e:	e8 fd fe ff ff       	call   2130 <free>
+  return freep;
+    2233:	8b 15 40 34 00 00    	mov    0x3440,%edx
+      if((p = morecore(nunits)) == 0)
+    2239:	83 c4 10             	add    $0x10,%esp
+    223c:	85 d2                	test   %edx,%edx
+    223e:	75 c0                	jne    2200 <malloc+0x40>
+        return 0;
+  }
+}
+    2240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2243:	31 c0                	xor    %eax,%eax
+}
+    2245:	5b                   	pop    %ebx
+    2246:	5e                   	pop    %esi
+    2247:	5f                   	pop    %edi
+    2248:	5d                   	pop    %ebp
+    2249:	c3                   	ret
+    224a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2250:	39 cf                	cmp    %ecx,%edi
+    2252:	74 4c                	je     22a0 <malloc+0xe0>
+        p->s.size -= nunits;
+    2254:	29 f9                	sub    %edi,%ecx
+    2256:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2259:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    225c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    225f:	89 15 40 34 00 00    	mov    %edx,0x3440
+}
+    2265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2268:	83 c0 08             	add    $0x8,%eax
+}
+    226b:	5b                   	pop    %ebx
+    226c:	5e                   	pop    %esi
+    226d:	5f                   	pop    %edi
+    226e:	5d                   	pop    %ebp
+    226f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2270:	c7 05 40 34 00 00 44 	movl   $0x3444,0x3440
+    2277:	34 00 00 
+    base.s.size = 0;
+    227a:	b8 44 34 00 00       	mov    $0x3444,%eax
+    base.s.ptr = freep = prevp = &base;
+    227f:	c7 05 44 34 00 00 44 	movl   $0x3444,0x3444
+    2286:	34 00 00 
+    base.s.size = 0;
+    2289:	c7 05 48 34 00 00 00 	movl   $0x0,0x3448
+    2290:	00 00 00 
+    if(p->s.size >= nunits){
+    2293:	e9 54 ff ff ff       	jmp    21ec <malloc+0x2c>
+    2298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    229f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    22a0:	8b 08                	mov    (%eax),%ecx
+    22a2:	89 0a                	mov    %ecx,(%edx)
+    22a4:	eb b9                	jmp    225f <malloc+0x9f>
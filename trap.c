@@ -7,12 +7,14 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "upage.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
+struct uticks *uticks;  // mapped into every process at UTICKS
 
 void
 tvinit(void)
@@ -24,6 +26,9 @@ tvinit(void)
   SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
 
   initlock(&tickslock, "time");
+  if((uticks = (struct uticks*)kalloc()) == 0)
+    panic("tvinit");
+  memset(uticks, 0, PGSIZE);
 }
 
 void
@@ -32,10 +37,44 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Where to resume after a fault at eip, if it is one of the
+// instructions in copy.S that touch user memory.
+static uint
+copyfixup(uint eip)
+{
+  extern uint copyfixups[];
+  uint *f;
+
+  for(f = copyfixups; f[0]; f += 2)
+    if(f[0] == eip)
+      return f[1];
+  return 0;
+}
+
+// Did the user process trap on a sysenter instruction?
+static int
+issysenter(struct trapframe *tf)
+{
+  struct proc *p = myproc();
+
+  return p != 0 && (tf->cs&3) == DPL_USER &&
+    tf->eip >= p->vbase && tf->eip + 2 <= p->vlimit &&
+    *(ushort*)tf->eip == 0x340f;
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 {
+  uint tsc, fix;
+
+  // A CPU without sysenter faults on it: make it int $T_SYSCALL.
+  if((tf->trapno == T_ILLOP || tf->trapno == T_GPFLT) && issysenter(tf)){
+    tf->eip = tf->edx;
+    tf->esp = tf->ecx;
+    tf->trapno = T_SYSCALL;
+  }
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit();
@@ -51,6 +90,11 @@ trap(struct trapframe *tf)
     if(cpuid() == 0){
       acquire(&tickslock);
       ticks++;
+      tsc = rdtsc();
+      if(uticks->tsc)
+        uticks->tsctick = tsc - uticks->tsc;
+      uticks->tsc = tsc;
+      uticks->ticks = ticks;
       wakeup(&ticks);
       release(&tickslock);
     }
@@ -80,6 +124,19 @@ trap(struct trapframe *tf)
 
   //PAGEBREAK: 13
   default:
+    if(tf->trapno == T_IRQ0 + ideirq){
+      // Disk on a PCI interrupt line, such as virtio.
+      ideintr();
+      lapiceoi();
+      break;
+    }
+    if(tf->trapno == T_PGFLT && (tf->cs&3) == 0 &&
+       (fix = copyfixup(tf->eip)) != 0){
+      // A user page missing or read-only under ucopy();
+      // it returns -1.  Any other trap there is still a bug.
+      tf->eip = fix;
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
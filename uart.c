@@ -12,17 +12,35 @@
 #include "proc.h"
 #include "x86.h"
 
+#include "kstat.h"
+
 #define COM1    0x3f8
+#define TXBUF   1024  // bytes queued for the transmitter
 
 static int uart;    // is there a uart?
+static int txfifo;  // bytes the transmitter takes at once
+
+// Output waits here until the transmit-empty interrupt
+// hands it to the port, so writers need not poll the line.
+static struct {
+  struct spinlock lock;
+  char buf[TXBUF];
+  uint r;       // next byte to send
+  uint w;       // next free slot
+  int sync;     // panicking: write straight to the port
+  uint sent;    // bytes sent
+  uint polled;  // of them, sent by polling because the ring was full
+  uint waits;   // uartwrite()s that slept for room
+} tx;
 
 void
 uartinit(void)
 {
   char *p;
 
-  // Turn off the FIFO
-  outb(COM1+2, 0);
+  // Turn on the FIFO, if there is one, so that each
+  // transmit interrupt can take 16 bytes, and clear it.
+  outb(COM1+2, 0x07);
 
   // 9600 baud, 8 data bits, 1 stop bit, parity off.
   outb(COM1+3, 0x80);    // Unlock divisor
@@ -30,16 +48,18 @@ uartinit(void)
   outb(COM1+1, 0);
   outb(COM1+3, 0x03);    // Lock divisor, 8 data bits.
   outb(COM1+4, 0);
-  outb(COM1+1, 0x01);    // Enable receive interrupts.
+  outb(COM1+1, 0x03);    // Enable receive and transmit-empty interrupts.
 
   // If status is 0xFF, no serial port.
   if(inb(COM1+5) == 0xFF)
     return;
+  initlock(&tx.lock, "uart");
   uart = 1;
 
   // Acknowledge pre-existing interrupt conditions;
-  // enable interrupts.
-  inb(COM1+2);
+  // enable interrupts.  An 8250 without a FIFO leaves
+  // the top bits of IIR clear.
+  txfifo = (inb(COM1+2) & 0xC0) == 0xC0 ? 16 : 1;
   inb(COM1+0);
   ioapicenable(IRQ_COM1, 0);
 
@@ -48,16 +68,106 @@ uartinit(void)
     uartputc(*p);
 }
 
+// Wait, for a while, until the transmitter is empty.
+static void
+uartwait(void)
+{
+  int i;
+
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+    microdelay(10);
+}
+
+// Hand queued bytes to the transmitter if it is empty,
+// as many as it takes.  Caller holds tx.lock.
+static void
+uartstart(void)
+{
+  int i;
+
+  if(!(inb(COM1+5) & 0x20))
+    return;
+  for(i = 0; i < txfifo && tx.r != tx.w; i++)
+    outb(COM1+0, tx.buf[tx.r++ % TXBUF]);
+  if(i > 0){
+    tx.sent += i;
+    wakeup(&tx.r);
+  }
+}
+
+// Make room in a full ring by polling the transmitter,
+// as the driver used to for every byte.  Caller holds tx.lock.
+static void
+uartpoll(void)
+{
+  int i;
+
+  uartwait();
+  for(i = 0; i < txfifo && tx.r != tx.w; i++)
+    outb(COM1+0, tx.buf[tx.r++ % TXBUF]);
+  tx.sent += i;
+  tx.polled += i;
+}
+
+// Queue c for the transmitter.  Never sleeps, so that cprintf()
+// and echo can use it with locks held: if the ring is full,
+// it polls the oldest bytes out itself.
 void
 uartputc(int c)
+{
+  if(!uart)
+    return;
+  if(tx.sync){
+    uartwait();
+    outb(COM1+0, c);
+    return;
+  }
+  acquire(&tx.lock);
+  while(tx.w - tx.r == TXBUF)
+    uartpoll();
+  tx.buf[tx.w++ % TXBUF] = c;
+  uartstart();
+  release(&tx.lock);
+}
+
+// Queue n bytes from buf, sleeping while the ring is full.
+// Returns how many were queued, fewer only if the
+// process was killed.
+int
+uartwrite(char *buf, int n)
 {
   int i;
 
+  if(!uart || tx.sync)
+    return n;
+  acquire(&tx.lock);
+  for(i = 0; i < n; i++){
+    if(tx.w - tx.r == TXBUF){
+      tx.waits++;
+      uartstart();
+      while(tx.w - tx.r == TXBUF && !myproc()->killed)
+        sleep(&tx.r, &tx.lock);
+      if(myproc()->killed)
+        break;
+    }
+    tx.buf[tx.w++ % TXBUF] = buf[i];
+  }
+  uartstart();
+  release(&tx.lock);
+  return i;
+}
+
+// For panic(): push out what is queued by polling, and
+// from now on write straight to the port, without the lock,
+// which this CPU may hold.
+void
+uartsync(void)
+{
   if(!uart)
     return;
-  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
-    microdelay(10);
-  outb(COM1+0, c);
+  tx.sync = 1;
+  while(tx.r != tx.w)
+    uartpoll();
 }
 
 static int
@@ -73,5 +183,25 @@ uartgetc(void)
 void
 uartintr(void)
 {
-  consoleintr(uartgetc);
+  // Reading IIR acknowledges a transmit-empty interrupt.
+  // Go on until nothing is pending, so that the
+  // edge-triggered line drops and can rise again.
+  while(!(inb(COM1+2) & 0x01)){
+    consoleintr(uartgetc);
+    acquire(&tx.lock);
+    uartstart();
+    release(&tx.lock);
+  }
+}
+
+void
+uartstat(struct kstat *st)
+{
+  if(!uart)
+    return;
+  acquire(&tx.lock);
+  st->uart_tx = tx.sent;
+  st->uart_txpolled = tx.polled;
+  st->uart_txwaits = tx.waits;
+  release(&tx.lock);
 }
@@ -3,6 +3,7 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
+#include "upage.h"
 
 char*
 strcpy(char *s, const char *t)
@@ -104,3 +105,62 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+  }
+  return 0;
+}
+
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+}
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+}
+
+// Set by stdio.c once a stream holds output, so that it is
+// written out before the process exits, forks (or the child
+// would write it again) or execs, without linking stdio into
+// programs that never use it.
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    flushhook();
+  return _fork();
+}
+
+int
+exit(void)
+{
+  if(flushhook)
+    flushhook();
+  _exit();
+}
+
+int
+exec(char *path, char **argv)
+{
+  if(flushhook)
+    flushhook();
+  return _exec(path, argv);
+}
@@ -0,0 +1,18 @@
+// Pages that the kernel maps read-only into every process,
+// just below KERNBASE, so that programs can read a little
+// kernel state without a system call.
+// Both the kernel and user programs use this header file.
+
+#define UPROC  0x7FFFE000  // struct uproc: this process's own
+#define UTICKS 0x7FFFF000  // struct uticks: the same for all
+
+struct uproc {
+  int pid;
+};
+
+// Updated on every clock tick.
+struct uticks {
+  uint ticks;    // what uptime() returns
+  uint tsc;      // low bits of the TSC at that tick
+  uint tsctick;  // TSC cycles between the last two ticks
+};
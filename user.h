@@ -1,5 +1,8 @@
 struct stat;
 struct rtcdate;
+struct kstat;
+struct iovec;
+struct ring;
 
 // system calls
 int fork(void);
@@ -25,17 +28,55 @@ int sleep(int);
 int uptime(void);
 int mprotect(void*,int);
 int munprotect(void*,int);
+int kstat(struct kstat*);
+int fcntl(int, int, int);
+int splice(int, int, int);
+int sendfile(int, int, int, int);
+int lseek(int, int, int);
+int pread(int, void*, int, int);
+int pwrite(int, const void*, int, int);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
+int ringsetup(struct ring*);
+int ringenter(int);
+int intgetpid(void);
+int _fork(void);
+int _exit(void) __attribute__((noreturn));
+int _exec(char*, char**);
 
 // ulib.c
 int stat(const char*, struct stat*);
 char* strcpy(char*, const char*);
 void *memmove(void*, const void*, int);
+int memcmp(const void*, const void*, uint);
+int ugetpid(void);
+uint uuptime(void);
 char* strchr(const char*, char c);
 int strcmp(const char*, const char*);
-void printf(int, const char*, ...);
 char* gets(char*, int max);
 uint strlen(const char*);
 void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+extern void (*flushhook)(void);
+
+// printf.c
+void printf(int, const char*, ...);
+
+// stdio.c
+typedef struct iobuf FILE;
+extern FILE *stdin, *stdout, *stderr;
+FILE* fopen(const char*, const char*);
+FILE* fdopen(int, const char*);
+int fclose(FILE*);
+int fflush(FILE*);
+int fread(void*, int, int, FILE*);
+int fwrite(const void*, int, int, FILE*);
+int fgetc(FILE*);
+int fputc(int, FILE*);
+char* fgets(char*, int, FILE*);
+int feof(FILE*);
+int ferror(FILE*);
+int fileno(FILE*);
+void fprintf(FILE*, const char*, ...);
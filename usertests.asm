@@ -0,0 +1,10270 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	56                   	push   %esi
+    100e:	53                   	push   %ebx
+    100f:	51                   	push   %ecx
+    1010:	83 ec 14             	sub    $0x14,%esp
+    1013:	8b 19                	mov    (%ecx),%ebx
+    1015:	8b 71 04             	mov    0x4(%ecx),%esi
+  printf(1, "usertests starting\n");
+    1018:	68 27 83 00 00       	push   $0x8327
+    101d:	6a 01                	push   $0x1
+    101f:	e8 4c 54 00 00       	call   6470 <printf>
+
+  // "usertests bigfile" runs only the slow large-file tests,
+  // which go through double- and triple-indirect blocks.
+  if(argc > 1 && strcmp(argv[1], "bigfile") == 0){
+    1024:	83 c4 10             	add    $0x10,%esp
+    1027:	83 fb 01             	cmp    $0x1,%ebx
+    102a:	7e 1a                	jle    1046 <main+0x46>
+    102c:	51                   	push   %ecx
+    102d:	51                   	push   %ecx
+    102e:	68 e6 7c 00 00       	push   $0x7ce6
+    1033:	ff 76 04             	push   0x4(%esi)
+    1036:	e8 15 4c 00 00       	call   5c50 <strcmp>
+    103b:	83 c4 10             	add    $0x10,%esp
+    103e:	85 c0                	test   %eax,%eax
+    1040:	0f 84 23 01 00 00    	je     1169 <main+0x169>
+    bigfilemb(10);
+    bigfilemb(40);
+    exit();
+  }
+
+  if(open("usertests.ran", 0) >= 0){
+    1046:	83 ec 08             	sub    $0x8,%esp
+    1049:	6a 00                	push   $0x0
+    104b:	68 3b 83 00 00       	push   $0x833b
+    1050:	e8 76 4f 00 00       	call   5fcb <open>
+    1055:	83 c4 10             	add    $0x10,%esp
+    1058:	85 c0                	test   %eax,%eax
+    105a:	78 13                	js     106f <main+0x6f>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    105c:	52                   	push   %edx
+    105d:	52                   	push   %edx
+    105e:	68 d0 8c 00 00       	push   $0x8cd0
+    1063:	6a 01                	push   $0x1
+    1065:	e8 06 54 00 00       	call   6470 <printf>
+    exit();
+    106a:	e8 91 4e 00 00       	call   5f00 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    106f:	50                   	push   %eax
+    1070:	50                   	push   %eax
+    1071:	68 00 02 00 00       	push   $0x200
+    1076:	68 3b 83 00 00       	push   $0x833b
+    107b:	e8 4b 4f 00 00       	call   5fcb <open>
+    1080:	89 04 24             	mov    %eax,(%esp)
+    1083:	e8 16 4f 00 00       	call   5f9e <close>
+
+  argptest();
+    1088:	e8 c3 49 00 00       	call   5a50 <argptest>
+  createdelete();
+    108d:	e8 8e 23 00 00       	call   3420 <createdelete>
+  linkunlink();
+    1092:	e8 29 2c 00 00       	call   3cc0 <linkunlink>
+  concreate();
+    1097:	e8 24 29 00 00       	call   39c0 <concreate>
+  fourfiles();
+    109c:	e8 7f 21 00 00       	call   3220 <fourfiles>
+  sharedfd();
+    10a1:	e8 ba 1f 00 00       	call   3060 <sharedfd>
+
+  bigargtest();
+    10a6:	e8 75 46 00 00       	call   5720 <bigargtest>
+  bigwrite();
+    10ab:	e8 30 35 00 00       	call   45e0 <bigwrite>
+  bigargtest();
+    10b0:	e8 6b 46 00 00       	call   5720 <bigargtest>
+  bsstest();
+    10b5:	e8 06 46 00 00       	call   56c0 <bsstest>
+  sbrktest();
+    10ba:	e8 41 41 00 00       	call   5200 <sbrktest>
+  validatetest();
+    10bf:	e8 4c 45 00 00       	call   5610 <validatetest>
+
+  opentest();
+    10c4:	e8 57 03 00 00       	call   1420 <opentest>
+  writetest();
+    10c9:	e8 d2 03 00 00       	call   14a0 <writetest>
+  writetest1();
+    10ce:	e8 7d 05 00 00       	call   1650 <writetest1>
+  createtest();
+    10d3:	e8 18 07 00 00       	call   17f0 <createtest>
+
+  openiputtest();
+    10d8:	e8 63 02 00 00       	call   1340 <openiputtest>
+  exitiputtest();
+    10dd:	e8 7e 01 00 00       	call   1260 <exitiputtest>
+  iputtest();
+    10e2:	e8 a9 00 00 00       	call   1190 <iputtest>
+
+  mem();
+    10e7:	e8 a4 1e 00 00       	call   2f90 <mem>
+  pipe1();
+    10ec:	e8 bf 08 00 00       	call   19b0 <pipe1>
+  pipesize();
+    10f1:	e8 5a 0a 00 00       	call   1b50 <pipesize>
+  splicetest();
+    10f6:	e8 f5 0c 00 00       	call   1df0 <splicetest>
+  sendfiletest();
+    10fb:	e8 b0 0f 00 00       	call   20b0 <sendfiletest>
+  vectorio();
+    1100:	e8 3b 12 00 00       	call   2340 <vectorio>
+  ringtest();
+    1105:	e8 a6 14 00 00       	call   25b0 <ringtest>
+  upagetest();
+    110a:	e8 e1 16 00 00       	call   27f0 <upagetest>
+  rocopyout();
+    110f:	e8 bc 17 00 00       	call   28d0 <rocopyout>
+  stdiotest();
+    1114:	e8 07 19 00 00       	call   2a20 <stdiotest>
+  preempt();
+    1119:	e8 92 1c 00 00       	call   2db0 <preempt>
+  exitwait();
+    111e:	e8 ed 1d 00 00       	call   2f10 <exitwait>
+
+  rmdot();
+    1123:	e8 88 3b 00 00       	call   4cb0 <rmdot>
+  fourteen();
+    1128:	e8 43 3a 00 00       	call   4b70 <fourteen>
+  bigfile();
+    112d:	e8 8e 35 00 00       	call   46c0 <bigfile>
+  subdir();
+    1132:	e8 c9 2d 00 00       	call   3f00 <subdir>
+  linktest();
+    1137:	e8 74 26 00 00       	call   37b0 <linktest>
+  unlinkread();
+    113c:	e8 df 24 00 00       	call   3620 <unlinkread>
+  dirfile();
+    1141:	e8 ea 3c 00 00       	call   4e30 <dirfile>
+  iref();
+    1146:	e8 e5 3e 00 00       	call   5030 <iref>
+  forktest();
+    114b:	e8 00 40 00 00       	call   5150 <forktest>
+  bigdir(); // slow
+    1150:	e8 7b 2c 00 00       	call   3dd0 <bigdir>
+
+  uio();
+    1155:	e8 86 48 00 00       	call   59e0 <uio>
+  kstattest();
+    115a:	e8 61 49 00 00       	call   5ac0 <kstattest>
+
+  exectest();
+    115f:	e8 0c 08 00 00       	call   1970 <exectest>
+
+  exit();
+    1164:	e8 97 4d 00 00       	call   5f00 <exit>
+    bigfilemb(1);
+    1169:	83 ec 0c             	sub    $0xc,%esp
+    116c:	6a 01                	push   $0x1
+    116e:	e8 1d 37 00 00       	call   4890 <bigfilemb>
+    bigfilemb(10);
+    1173:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+    117a:	e8 11 37 00 00       	call   4890 <bigfilemb>
+    bigfilemb(40);
+    117f:	c7 04 24 28 00 00 00 	movl   $0x28,(%esp)
+    1186:	e8 05 37 00 00       	call   4890 <bigfilemb>
+    exit();
+    118b:	e8 70 4d 00 00       	call   5f00 <exit>
+
+00001190 <iputtest>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "iput test\n");
+    1196:	68 bc 6e 00 00       	push   $0x6ebc
+    119b:	6a 01                	push   $0x1
+    119d:	e8 ce 52 00 00       	call   6470 <printf>
+  if(mkdir("iputdir") < 0){
+    11a2:	c7 04 24 4f 6e 00 00 	movl   $0x6e4f,(%esp)
+    11a9:	e8 68 4e 00 00       	call   6016 <mkdir>
+    11ae:	83 c4 10             	add    $0x10,%esp
+    11b1:	85 c0                	test   %eax,%eax
+    11b3:	78 50                	js     1205 <iputtest+0x75>
+  if(chdir("iputdir") < 0){
+    11b5:	83 ec 0c             	sub    $0xc,%esp
+    11b8:	68 4f 6e 00 00       	push   $0x6e4f
+    11bd:	e8 63 4e 00 00       	call   6025 <chdir>
+    11c2:	83 c4 10             	add    $0x10,%esp
+    11c5:	85 c0                	test   %eax,%eax
+    11c7:	78 75                	js     123e <iputtest+0xae>
+  if(unlink("../iputdir") < 0){
+    11c9:	83 ec 0c             	sub    $0xc,%esp
+    11cc:	68 4c 6e 00 00       	push   $0x6e4c
+    11d1:	e8 13 4e 00 00       	call   5fe9 <unlink>
+    11d6:	83 c4 10             	add    $0x10,%esp
+    11d9:	85 c0                	test   %eax,%eax
+    11db:	78 4e                	js     122b <iputtest+0x9b>
+  if(chdir("/") < 0){
+    11dd:	83 ec 0c             	sub    $0xc,%esp
+    11e0:	68 71 6e 00 00       	push   $0x6e71
+    11e5:	e8 3b 4e 00 00       	call   6025 <chdir>
+    11ea:	83 c4 10             	add    $0x10,%esp
+    11ed:	85 c0                	test   %eax,%eax
+    11ef:	78 27                	js     1218 <iputtest+0x88>
+  printf(1, "iput test ok\n");
+    11f1:	83 ec 08             	sub    $0x8,%esp
+    11f4:	68 f4 6e 00 00       	push   $0x6ef4
+    11f9:	6a 01                	push   $0x1
+    11fb:	e8 70 52 00 00       	call   6470 <printf>
+}
+    1200:	83 c4 10             	add    $0x10,%esp
+    1203:	c9                   	leave
+    1204:	c3                   	ret
+    printf(1, "mkdir failed\n");
+    1205:	50                   	push   %eax
+    1206:	50                   	push   %eax
+    1207:	68 28 6e 00 00       	push   $0x6e28
+    120c:	6a 01                	push   $0x1
+    120e:	e8 5d 52 00 00       	call   6470 <printf>
+    exit();
+    1213:	e8 e8 4c 00 00       	call   5f00 <exit>
+    printf(1, "chdir / failed\n");
+    1218:	50                   	push   %eax
+    1219:	50                   	push   %eax
+    121a:	68 73 6e 00 00       	push   $0x6e73
+    121f:	6a 01                	push   $0x1
+    1221:	e8 4a 52 00 00       	call   6470 <printf>
+    exit();
+    1226:	e8 d5 4c 00 00       	call   5f00 <exit>
+    printf(1, "unlink ../iputdir failed\n");
+    122b:	52                   	push   %edx
+    122c:	52                   	push   %edx
+    122d:	68 57 6e 00 00       	push   $0x6e57
+    1232:	6a 01                	push   $0x1
+    1234:	e8 37 52 00 00       	call   6470 <printf>
+    exit();
+    1239:	e8 c2 4c 00 00       	call   5f00 <exit>
+    printf(1, "chdir iputdir failed\n");
+    123e:	51                   	push   %ecx
+    123f:	51                   	push   %ecx
+    1240:	68 36 6e 00 00       	push   $0x6e36
+    1245:	6a 01                	push   $0x1
+    1247:	e8 24 52 00 00       	call   6470 <printf>
+    exit();
+    124c:	e8 af 4c 00 00       	call   5f00 <exit>
+    1251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125f:	90                   	nop
+
+00001260 <exitiputtest>:
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "exitiput test\n");
+    1266:	68 83 6e 00 00       	push   $0x6e83
+    126b:	6a 01                	push   $0x1
+    126d:	e8 fe 51 00 00       	call   6470 <printf>
+  pid = fork();
+    1272:	e8 59 4c 00 00       	call   5ed0 <fork>
+  if(pid < 0){
+    1277:	83 c4 10             	add    $0x10,%esp
+    127a:	85 c0                	test   %eax,%eax
+    127c:	78 7e                	js     12fc <exitiputtest+0x9c>
+  if(pid == 0){
+    127e:	75 48                	jne    12c8 <exitiputtest+0x68>
+    if(mkdir("iputdir") < 0){
+    1280:	83 ec 0c             	sub    $0xc,%esp
+    1283:	68 4f 6e 00 00       	push   $0x6e4f
+    1288:	e8 89 4d 00 00       	call   6016 <mkdir>
+    128d:	83 c4 10             	add    $0x10,%esp
+    1290:	85 c0                	test   %eax,%eax
+    1292:	78 7b                	js     130f <exitiputtest+0xaf>
+    if(chdir("iputdir") < 0){
+    1294:	83 ec 0c             	sub    $0xc,%esp
+    1297:	68 4f 6e 00 00       	push   $0x6e4f
+    129c:	e8 84 4d 00 00       	call   6025 <chdir>
+    12a1:	83 c4 10             	add    $0x10,%esp
+    12a4:	85 c0                	test   %eax,%eax
+    12a6:	78 7a                	js     1322 <exitiputtest+0xc2>
+    if(unlink("../iputdir") < 0){
+    12a8:	83 ec 0c             	sub    $0xc,%esp
+    12ab:	68 4c 6e 00 00       	push   $0x6e4c
+    12b0:	e8 34 4d 00 00       	call   5fe9 <unlink>
+    12b5:	83 c4 10             	add    $0x10,%esp
+    12b8:	85 c0                	test   %eax,%eax
+    12ba:	78 2c                	js     12e8 <exitiputtest+0x88>
+    exit();
+    12bc:	e8 3f 4c 00 00       	call   5f00 <exit>
+    12c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+    12c8:	e8 95 4c 00 00       	call   5f62 <wait>
+  printf(1, "exitiput test ok\n");
+    12cd:	83 ec 08             	sub    $0x8,%esp
+    12d0:	68 a6 6e 00 00       	push   $0x6ea6
+    12d5:	6a 01                	push   $0x1
+    12d7:	e8 94 51 00 00       	call   6470 <printf>
+}
+    12dc:	83 c4 10             	add    $0x10,%esp
+    12df:	c9                   	leave
+    12e0:	c3                   	ret
+    12e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "unlink ../iputdir failed\n");
+    12e8:	83 ec 08             	sub    $0x8,%esp
+    12eb:	68 57 6e 00 00       	push   $0x6e57
+    12f0:	6a 01                	push   $0x1
+    12f2:	e8 79 51 00 00       	call   6470 <printf>
+      exit();
+    12f7:	e8 04 4c 00 00       	call   5f00 <exit>
+    printf(1, "fork failed\n");
+    12fc:	51                   	push   %ecx
+    12fd:	51                   	push   %ecx
+    12fe:	68 0b 82 00 00       	push   $0x820b
+    1303:	6a 01                	push   $0x1
+    1305:	e8 66 51 00 00       	call   6470 <printf>
+    exit();
+    130a:	e8 f1 4b 00 00       	call   5f00 <exit>
+      printf(1, "mkdir failed\n");
+    130f:	52                   	push   %edx
+    1310:	52                   	push   %edx
+    1311:	68 28 6e 00 00       	push   $0x6e28
+    1316:	6a 01                	push   $0x1
+    1318:	e8 53 51 00 00       	call   6470 <printf>
+      exit();
+    131d:	e8 de 4b 00 00       	call   5f00 <exit>
+      printf(1, "child chdir failed\n");
+    1322:	50                   	push   %eax
+    1323:	50                   	push   %eax
+    1324:	68 92 6e 00 00       	push   $0x6e92
+    1329:	6a 01                	push   $0x1
+    132b:	e8 40 51 00 00       	call   6470 <printf>
+      exit();
+    1330:	e8 cb 4b 00 00       	call   5f00 <exit>
+    1335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001340 <openiputtest>:
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "openiput test\n");
+    1346:	68 b8 6e 00 00       	push   $0x6eb8
+    134b:	6a 01                	push   $0x1
+    134d:	e8 1e 51 00 00       	call   6470 <printf>
+  if(mkdir("oidir") < 0){
+    1352:	c7 04 24 c7 6e 00 00 	movl   $0x6ec7,(%esp)
+    1359:	e8 b8 4c 00 00       	call   6016 <mkdir>
+    135e:	83 c4 10             	add    $0x10,%esp
+    1361:	85 c0                	test   %eax,%eax
+    1363:	0f 88 8f 00 00 00    	js     13f8 <openiputtest+0xb8>
+  pid = fork();
+    1369:	e8 62 4b 00 00       	call   5ed0 <fork>
+  if(pid < 0){
+    136e:	85 c0                	test   %eax,%eax
+    1370:	78 73                	js     13e5 <openiputtest+0xa5>
+  if(pid == 0){
+    1372:	75 2c                	jne    13a0 <openiputtest+0x60>
+    int fd = open("oidir", O_RDWR);
+    1374:	83 ec 08             	sub    $0x8,%esp
+    1377:	6a 02                	push   $0x2
+    1379:	68 c7 6e 00 00       	push   $0x6ec7
+    137e:	e8 48 4c 00 00       	call   5fcb <open>
+    if(fd >= 0){
+    1383:	83 c4 10             	add    $0x10,%esp
+    1386:	85 c0                	test   %eax,%eax
+    1388:	78 56                	js     13e0 <openiputtest+0xa0>
+      printf(1, "open directory for write succeeded\n");
+    138a:	83 ec 08             	sub    $0x8,%esp
+    138d:	68 5c 83 00 00       	push   $0x835c
+    1392:	6a 01                	push   $0x1
+    1394:	e8 d7 50 00 00       	call   6470 <printf>
+      exit();
+    1399:	e8 62 4b 00 00       	call   5f00 <exit>
+    139e:	66 90                	xchg   %ax,%ax
+  sleep(1);
+    13a0:	83 ec 0c             	sub    $0xc,%esp
+    13a3:	6a 01                	push   $0x1
+    13a5:	e8 b7 4c 00 00       	call   6061 <sleep>
+  if(unlink("oidir") != 0){
+    13aa:	c7 04 24 c7 6e 00 00 	movl   $0x6ec7,(%esp)
+    13b1:	e8 33 4c 00 00       	call   5fe9 <unlink>
+    13b6:	83 c4 10             	add    $0x10,%esp
+    13b9:	85 c0                	test   %eax,%eax
+    13bb:	75 4e                	jne    140b <openiputtest+0xcb>
+  wait();
+    13bd:	e8 a0 4b 00 00       	call   5f62 <wait>
+  printf(1, "openiput test ok\n");
+    13c2:	83 ec 08             	sub    $0x8,%esp
+    13c5:	68 f0 6e 00 00       	push   $0x6ef0
+    13ca:	6a 01                	push   $0x1
+    13cc:	e8 9f 50 00 00       	call   6470 <printf>
+}
+    13d1:	83 c4 10             	add    $0x10,%esp
+    13d4:	c9                   	leave
+    13d5:	c3                   	ret
+    13d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+    exit();
+    13e0:	e8 1b 4b 00 00       	call   5f00 <exit>
+    printf(1, "fork failed\n");
+    13e5:	52                   	push   %edx
+    13e6:	52                   	push   %edx
+    13e7:	68 0b 82 00 00       	push   $0x820b
+    13ec:	6a 01                	push   $0x1
+    13ee:	e8 7d 50 00 00       	call   6470 <printf>
+    exit();
+    13f3:	e8 08 4b 00 00       	call   5f00 <exit>
+    printf(1, "mkdir oidir failed\n");
+    13f8:	51                   	push   %ecx
+    13f9:	51                   	push   %ecx
+    13fa:	68 cd 6e 00 00       	push   $0x6ecd
+    13ff:	6a 01                	push   $0x1
+    1401:	e8 6a 50 00 00       	call   6470 <printf>
+    exit();
+    1406:	e8 f5 4a 00 00       	call   5f00 <exit>
+    printf(1, "unlink failed\n");
+    140b:	50                   	push   %eax
+    140c:	50                   	push   %eax
+    140d:	68 e1 6e 00 00       	push   $0x6ee1
+    1412:	6a 01                	push   $0x1
+    1414:	e8 57 50 00 00       	call   6470 <printf>
+    exit();
+    1419:	e8 e2 4a 00 00       	call   5f00 <exit>
+    141e:	66 90                	xchg   %ax,%ax
+
+00001420 <opentest>:
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "open test\n");
+    1426:	68 02 6f 00 00       	push   $0x6f02
+    142b:	6a 01                	push   $0x1
+    142d:	e8 3e 50 00 00       	call   6470 <printf>
+  fd = open("echo", 0);
+    1432:	58                   	pop    %eax
+    1433:	5a                   	pop    %edx
+    1434:	6a 00                	push   $0x0
+    1436:	68 0d 6f 00 00       	push   $0x6f0d
+    143b:	e8 8b 4b 00 00       	call   5fcb <open>
+  if(fd < 0){
+    1440:	83 c4 10             	add    $0x10,%esp
+    1443:	85 c0                	test   %eax,%eax
+    1445:	78 32                	js     1479 <opentest+0x59>
+  close(fd);
+    1447:	83 ec 0c             	sub    $0xc,%esp
+    144a:	50                   	push   %eax
+    144b:	e8 4e 4b 00 00       	call   5f9e <close>
+  fd = open("doesnotexist", 0);
+    1450:	5a                   	pop    %edx
+    1451:	59                   	pop    %ecx
+    1452:	6a 00                	push   $0x0
+    1454:	68 25 6f 00 00       	push   $0x6f25
+    1459:	e8 6d 4b 00 00       	call   5fcb <open>
+  if(fd >= 0){
+    145e:	83 c4 10             	add    $0x10,%esp
+    1461:	85 c0                	test   %eax,%eax
+    1463:	79 27                	jns    148c <opentest+0x6c>
+  printf(1, "open test ok\n");
+    1465:	83 ec 08             	sub    $0x8,%esp
+    1468:	68 50 6f 00 00       	push   $0x6f50
+    146d:	6a 01                	push   $0x1
+    146f:	e8 fc 4f 00 00       	call   6470 <printf>
+}
+    1474:	83 c4 10             	add    $0x10,%esp
+    1477:	c9                   	leave
+    1478:	c3                   	ret
+    printf(1, "open echo failed!\n");
+    1479:	50                   	push   %eax
+    147a:	50                   	push   %eax
+    147b:	68 12 6f 00 00       	push   $0x6f12
+    1480:	6a 01                	push   $0x1
+    1482:	e8 e9 4f 00 00       	call   6470 <printf>
+    exit();
+    1487:	e8 74 4a 00 00       	call   5f00 <exit>
+    printf(1, "open doesnotexist succeeded!\n");
+    148c:	50                   	push   %eax
+    148d:	50                   	push   %eax
+    148e:	68 32 6f 00 00       	push   $0x6f32
+    1493:	6a 01                	push   $0x1
+    1495:	e8 d6 4f 00 00       	call   6470 <printf>
+    exit();
+    149a:	e8 61 4a 00 00       	call   5f00 <exit>
+    149f:	90                   	nop
+
+000014a0 <writetest>:
+{
+    14a0:	55                   	push   %ebp
+    14a1:	89 e5                	mov    %esp,%ebp
+    14a3:	56                   	push   %esi
+    14a4:	53                   	push   %ebx
+  printf(1, "small file test\n");
+    14a5:	83 ec 08             	sub    $0x8,%esp
+    14a8:	68 5e 6f 00 00       	push   $0x6f5e
+    14ad:	6a 01                	push   $0x1
+    14af:	e8 bc 4f 00 00       	call   6470 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+    14b4:	58                   	pop    %eax
+    14b5:	5a                   	pop    %edx
+    14b6:	68 02 02 00 00       	push   $0x202
+    14bb:	68 6f 6f 00 00       	push   $0x6f6f
+    14c0:	e8 06 4b 00 00       	call   5fcb <open>
+  if(fd >= 0){
+    14c5:	83 c4 10             	add    $0x10,%esp
+    14c8:	85 c0                	test   %eax,%eax
+    14ca:	0f 88 68 01 00 00    	js     1638 <writetest+0x198>
+    printf(1, "creat small succeeded; ok\n");
+    14d0:	83 ec 08             	sub    $0x8,%esp
+    14d3:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+    14d5:	31 db                	xor    %ebx,%ebx
+    printf(1, "creat small succeeded; ok\n");
+    14d7:	68 75 6f 00 00       	push   $0x6f75
+    14dc:	6a 01                	push   $0x1
+    14de:	e8 8d 4f 00 00       	call   6470 <printf>
+    14e3:	83 c4 10             	add    $0x10,%esp
+    14e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+    14f0:	83 ec 04             	sub    $0x4,%esp
+    14f3:	6a 0a                	push   $0xa
+    14f5:	68 ac 6f 00 00       	push   $0x6fac
+    14fa:	56                   	push   %esi
+    14fb:	e8 8f 4a 00 00       	call   5f8f <write>
+    1500:	83 c4 10             	add    $0x10,%esp
+    1503:	83 f8 0a             	cmp    $0xa,%eax
+    1506:	0f 85 c9 00 00 00    	jne    15d5 <writetest+0x135>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+    150c:	83 ec 04             	sub    $0x4,%esp
+    150f:	6a 0a                	push   $0xa
+    1511:	68 b7 6f 00 00       	push   $0x6fb7
+    1516:	56                   	push   %esi
+    1517:	e8 73 4a 00 00       	call   5f8f <write>
+    151c:	83 c4 10             	add    $0x10,%esp
+    151f:	83 f8 0a             	cmp    $0xa,%eax
+    1522:	0f 85 c2 00 00 00    	jne    15ea <writetest+0x14a>
+  for(i = 0; i < 100; i++){
+    1528:	83 c3 01             	add    $0x1,%ebx
+    152b:	83 fb 64             	cmp    $0x64,%ebx
+    152e:	75 c0                	jne    14f0 <writetest+0x50>
+  printf(1, "writes ok\n");
+    1530:	83 ec 08             	sub    $0x8,%esp
+    1533:	68 c2 6f 00 00       	push   $0x6fc2
+    1538:	6a 01                	push   $0x1
+    153a:	e8 31 4f 00 00       	call   6470 <printf>
+  close(fd);
+    153f:	89 34 24             	mov    %esi,(%esp)
+    1542:	e8 57 4a 00 00       	call   5f9e <close>
+  fd = open("small", O_RDONLY);
+    1547:	5b                   	pop    %ebx
+    1548:	5e                   	pop    %esi
+    1549:	6a 00                	push   $0x0
+    154b:	68 6f 6f 00 00       	push   $0x6f6f
+    1550:	e8 76 4a 00 00       	call   5fcb <open>
+  if(fd >= 0){
+    1555:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+    1558:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+    155a:	85 c0                	test   %eax,%eax
+    155c:	0f 88 9d 00 00 00    	js     15ff <writetest+0x15f>
+    printf(1, "open small succeeded ok\n");
+    1562:	83 ec 08             	sub    $0x8,%esp
+    1565:	68 cd 6f 00 00       	push   $0x6fcd
+    156a:	6a 01                	push   $0x1
+    156c:	e8 ff 4e 00 00       	call   6470 <printf>
+  i = read(fd, buf, 2000);
+    1571:	83 c4 0c             	add    $0xc,%esp
+    1574:	68 d0 07 00 00       	push   $0x7d0
+    1579:	68 c0 cc 00 00       	push   $0xccc0
+    157e:	53                   	push   %ebx
+    157f:	e8 fc 49 00 00       	call   5f80 <read>
+  if(i == 2000){
+    1584:	83 c4 10             	add    $0x10,%esp
+    1587:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+    158c:	0f 85 80 00 00 00    	jne    1612 <writetest+0x172>
+    printf(1, "read succeeded ok\n");
+    1592:	83 ec 08             	sub    $0x8,%esp
+    1595:	68 01 70 00 00       	push   $0x7001
+    159a:	6a 01                	push   $0x1
+    159c:	e8 cf 4e 00 00       	call   6470 <printf>
+  close(fd);
+    15a1:	89 1c 24             	mov    %ebx,(%esp)
+    15a4:	e8 f5 49 00 00       	call   5f9e <close>
+  if(unlink("small") < 0){
+    15a9:	c7 04 24 6f 6f 00 00 	movl   $0x6f6f,(%esp)
+    15b0:	e8 34 4a 00 00       	call   5fe9 <unlink>
+    15b5:	83 c4 10             	add    $0x10,%esp
+    15b8:	85 c0                	test   %eax,%eax
+    15ba:	78 69                	js     1625 <writetest+0x185>
+  printf(1, "small file test ok\n");
+    15bc:	83 ec 08             	sub    $0x8,%esp
+    15bf:	68 29 70 00 00       	push   $0x7029
+    15c4:	6a 01                	push   $0x1
+    15c6:	e8 a5 4e 00 00       	call   6470 <printf>
+}
+    15cb:	83 c4 10             	add    $0x10,%esp
+    15ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    15d1:	5b                   	pop    %ebx
+    15d2:	5e                   	pop    %esi
+    15d3:	5d                   	pop    %ebp
+    15d4:	c3                   	ret
+      printf(1, "error: write aa %d new file failed\n", i);
+    15d5:	83 ec 04             	sub    $0x4,%esp
+    15d8:	53                   	push   %ebx
+    15d9:	68 80 83 00 00       	push   $0x8380
+    15de:	6a 01                	push   $0x1
+    15e0:	e8 8b 4e 00 00       	call   6470 <printf>
+      exit();
+    15e5:	e8 16 49 00 00       	call   5f00 <exit>
+      printf(1, "error: write bb %d new file failed\n", i);
+    15ea:	83 ec 04             	sub    $0x4,%esp
+    15ed:	53                   	push   %ebx
+    15ee:	68 a4 83 00 00       	push   $0x83a4
+    15f3:	6a 01                	push   $0x1
+    15f5:	e8 76 4e 00 00       	call   6470 <printf>
+      exit();
+    15fa:	e8 01 49 00 00       	call   5f00 <exit>
+    printf(1, "error: open small failed!\n");
+    15ff:	51                   	push   %ecx
+    1600:	51                   	push   %ecx
+    1601:	68 e6 6f 00 00       	push   $0x6fe6
+    1606:	6a 01                	push   $0x1
+    1608:	e8 63 4e 00 00       	call   6470 <printf>
+    exit();
+    160d:	e8 ee 48 00 00       	call   5f00 <exit>
+    printf(1, "read failed\n");
+    1612:	52                   	push   %edx
+    1613:	52                   	push   %edx
+    1614:	68 fc 71 00 00       	push   $0x71fc
+    1619:	6a 01                	push   $0x1
+    161b:	e8 50 4e 00 00       	call   6470 <printf>
+    exit();
+    1620:	e8 db 48 00 00       	call   5f00 <exit>
+    printf(1, "unlink small failed\n");
+    1625:	50                   	push   %eax
+    1626:	50                   	push   %eax
+    1627:	68 14 70 00 00       	push   $0x7014
+    162c:	6a 01                	push   $0x1
+    162e:	e8 3d 4e 00 00       	call   6470 <printf>
+    exit();
+    1633:	e8 c8 48 00 00       	call   5f00 <exit>
+    printf(1, "error: creat small failed!\n");
+    1638:	50                   	push   %eax
+    1639:	50                   	push   %eax
+    163a:	68 90 6f 00 00       	push   $0x6f90
+    163f:	6a 01                	push   $0x1
+    1641:	e8 2a 4e 00 00       	call   6470 <printf>
+    exit();
+    1646:	e8 b5 48 00 00       	call   5f00 <exit>
+    164b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    164f:	90                   	nop
+
+00001650 <writetest1>:
+{
+    1650:	55                   	push   %ebp
+    1651:	89 e5                	mov    %esp,%ebp
+    1653:	56                   	push   %esi
+    1654:	53                   	push   %ebx
+  printf(1, "big files test\n");
+    1655:	83 ec 08             	sub    $0x8,%esp
+    1658:	68 3d 70 00 00       	push   $0x703d
+    165d:	6a 01                	push   $0x1
+    165f:	e8 0c 4e 00 00       	call   6470 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+    1664:	58                   	pop    %eax
+    1665:	5a                   	pop    %edx
+    1666:	68 02 02 00 00       	push   $0x202
+    166b:	68 b7 70 00 00       	push   $0x70b7
+    1670:	e8 56 49 00 00       	call   5fcb <open>
+  if(fd < 0){
+    1675:	83 c4 10             	add    $0x10,%esp
+    1678:	85 c0                	test   %eax,%eax
+    167a:	0f 88 3d 01 00 00    	js     17bd <writetest1+0x16d>
+    1680:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+    1682:	31 db                	xor    %ebx,%ebx
+    1684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(write(fd, buf, BSIZE) != BSIZE){
+    1688:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+    168b:	89 1d c0 cc 00 00    	mov    %ebx,0xccc0
+    if(write(fd, buf, BSIZE) != BSIZE){
+    1691:	68 00 02 00 00       	push   $0x200
+    1696:	68 c0 cc 00 00       	push   $0xccc0
+    169b:	56                   	push   %esi
+    169c:	e8 ee 48 00 00       	call   5f8f <write>
+    16a1:	83 c4 10             	add    $0x10,%esp
+    16a4:	3d 00 02 00 00       	cmp    $0x200,%eax
+    16a9:	0f 85 ab 00 00 00    	jne    175a <writetest1+0x10a>
+  for(i = 0; i < BIGBLOCKS; i++){
+    16af:	83 c3 01             	add    $0x1,%ebx
+    16b2:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+    16b8:	75 ce                	jne    1688 <writetest1+0x38>
+  close(fd);
+    16ba:	83 ec 0c             	sub    $0xc,%esp
+    16bd:	56                   	push   %esi
+    16be:	e8 db 48 00 00       	call   5f9e <close>
+  fd = open("big", O_RDONLY);
+    16c3:	5b                   	pop    %ebx
+    16c4:	5e                   	pop    %esi
+    16c5:	6a 00                	push   $0x0
+    16c7:	68 b7 70 00 00       	push   $0x70b7
+    16cc:	e8 fa 48 00 00       	call   5fcb <open>
+  if(fd < 0){
+    16d1:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+    16d4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    16d6:	85 c0                	test   %eax,%eax
+    16d8:	0f 88 cc 00 00 00    	js     17aa <writetest1+0x15a>
+  n = 0;
+    16de:	31 f6                	xor    %esi,%esi
+    16e0:	eb 1d                	jmp    16ff <writetest1+0xaf>
+    16e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != BSIZE){
+    16e8:	3d 00 02 00 00       	cmp    $0x200,%eax
+    16ed:	0f 85 8f 00 00 00    	jne    1782 <writetest1+0x132>
+    if(((int*)buf)[0] != n){
+    16f3:	a1 c0 cc 00 00       	mov    0xccc0,%eax
+    16f8:	39 f0                	cmp    %esi,%eax
+    16fa:	75 73                	jne    176f <writetest1+0x11f>
+    n++;
+    16fc:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, BSIZE);
+    16ff:	83 ec 04             	sub    $0x4,%esp
+    1702:	68 00 02 00 00       	push   $0x200
+    1707:	68 c0 cc 00 00       	push   $0xccc0
+    170c:	53                   	push   %ebx
+    170d:	e8 6e 48 00 00       	call   5f80 <read>
+    if(i == 0){
+    1712:	83 c4 10             	add    $0x10,%esp
+    1715:	85 c0                	test   %eax,%eax
+    1717:	75 cf                	jne    16e8 <writetest1+0x98>
+      if(n != BIGBLOCKS){
+    1719:	81 fe 8c 00 00 00    	cmp    $0x8c,%esi
+    171f:	75 76                	jne    1797 <writetest1+0x147>
+  close(fd);
+    1721:	83 ec 0c             	sub    $0xc,%esp
+    1724:	53                   	push   %ebx
+    1725:	e8 74 48 00 00       	call   5f9e <close>
+  if(unlink("big") < 0){
+    172a:	c7 04 24 b7 70 00 00 	movl   $0x70b7,(%esp)
+    1731:	e8 b3 48 00 00       	call   5fe9 <unlink>
+    1736:	83 c4 10             	add    $0x10,%esp
+    1739:	85 c0                	test   %eax,%eax
+    173b:	0f 88 8f 00 00 00    	js     17d0 <writetest1+0x180>
+  printf(1, "big files ok\n");
+    1741:	83 ec 08             	sub    $0x8,%esp
+    1744:	68 de 70 00 00       	push   $0x70de
+    1749:	6a 01                	push   $0x1
+    174b:	e8 20 4d 00 00       	call   6470 <printf>
+}
+    1750:	83 c4 10             	add    $0x10,%esp
+    1753:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1756:	5b                   	pop    %ebx
+    1757:	5e                   	pop    %esi
+    1758:	5d                   	pop    %ebp
+    1759:	c3                   	ret
+      printf(1, "error: write big file failed\n", i);
+    175a:	83 ec 04             	sub    $0x4,%esp
+    175d:	53                   	push   %ebx
+    175e:	68 67 70 00 00       	push   $0x7067
+    1763:	6a 01                	push   $0x1
+    1765:	e8 06 4d 00 00       	call   6470 <printf>
+      exit();
+    176a:	e8 91 47 00 00       	call   5f00 <exit>
+      printf(1, "read content of block %d is %d\n",
+    176f:	50                   	push   %eax
+    1770:	56                   	push   %esi
+    1771:	68 c8 83 00 00       	push   $0x83c8
+    1776:	6a 01                	push   $0x1
+    1778:	e8 f3 4c 00 00       	call   6470 <printf>
+      exit();
+    177d:	e8 7e 47 00 00       	call   5f00 <exit>
+      printf(1, "read failed %d\n", i);
+    1782:	83 ec 04             	sub    $0x4,%esp
+    1785:	50                   	push   %eax
+    1786:	68 bb 70 00 00       	push   $0x70bb
+    178b:	6a 01                	push   $0x1
+    178d:	e8 de 4c 00 00       	call   6470 <printf>
+      exit();
+    1792:	e8 69 47 00 00       	call   5f00 <exit>
+        printf(1, "read only %d blocks from big", n);
+    1797:	52                   	push   %edx
+    1798:	56                   	push   %esi
+    1799:	68 9e 70 00 00       	push   $0x709e
+    179e:	6a 01                	push   $0x1
+    17a0:	e8 cb 4c 00 00       	call   6470 <printf>
+        exit();
+    17a5:	e8 56 47 00 00       	call   5f00 <exit>
+    printf(1, "error: open big failed!\n");
+    17aa:	51                   	push   %ecx
+    17ab:	51                   	push   %ecx
+    17ac:	68 85 70 00 00       	push   $0x7085
+    17b1:	6a 01                	push   $0x1
+    17b3:	e8 b8 4c 00 00       	call   6470 <printf>
+    exit();
+    17b8:	e8 43 47 00 00       	call   5f00 <exit>
+    printf(1, "error: creat big failed!\n");
+    17bd:	50                   	push   %eax
+    17be:	50                   	push   %eax
+    17bf:	68 4d 70 00 00       	push   $0x704d
+    17c4:	6a 01                	push   $0x1
+    17c6:	e8 a5 4c 00 00       	call   6470 <printf>
+    exit();
+    17cb:	e8 30 47 00 00       	call   5f00 <exit>
+    printf(1, "unlink big failed\n");
+    17d0:	50                   	push   %eax
+    17d1:	50                   	push   %eax
+    17d2:	68 cb 70 00 00       	push   $0x70cb
+    17d7:	6a 01                	push   $0x1
+    17d9:	e8 92 4c 00 00       	call   6470 <printf>
+    exit();
+    17de:	e8 1d 47 00 00       	call   5f00 <exit>
+    17e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000017f0 <createtest>:
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 e5                	mov    %esp,%ebp
+    17f3:	53                   	push   %ebx
+  name[2] = '\0';
+    17f4:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+    17f9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "many creates, followed by unlink test\n");
+    17fc:	68 e8 83 00 00       	push   $0x83e8
+    1801:	6a 01                	push   $0x1
+    1803:	e8 68 4c 00 00       	call   6470 <printf>
+  name[0] = 'a';
+    1808:	c6 05 b0 cc 00 00 61 	movb   $0x61,0xccb0
+  name[2] = '\0';
+    180f:	83 c4 10             	add    $0x10,%esp
+    1812:	c6 05 b2 cc 00 00 00 	movb   $0x0,0xccb2
+  for(i = 0; i < 52; i++){
+    1819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+    1820:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+    1823:	88 1d b1 cc 00 00    	mov    %bl,0xccb1
+  for(i = 0; i < 52; i++){
+    1829:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+    182c:	68 02 02 00 00       	push   $0x202
+    1831:	68 b0 cc 00 00       	push   $0xccb0
+    1836:	e8 90 47 00 00       	call   5fcb <open>
+    close(fd);
+    183b:	89 04 24             	mov    %eax,(%esp)
+    183e:	e8 5b 47 00 00       	call   5f9e <close>
+  for(i = 0; i < 52; i++){
+    1843:	83 c4 10             	add    $0x10,%esp
+    1846:	80 fb 64             	cmp    $0x64,%bl
+    1849:	75 d5                	jne    1820 <createtest+0x30>
+  name[0] = 'a';
+    184b:	c6 05 b0 cc 00 00 61 	movb   $0x61,0xccb0
+  name[2] = '\0';
+    1852:	bb 30 00 00 00       	mov    $0x30,%ebx
+    1857:	c6 05 b2 cc 00 00 00 	movb   $0x0,0xccb2
+  for(i = 0; i < 52; i++){
+    185e:	66 90                	xchg   %ax,%ax
+    unlink(name);
+    1860:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+    1863:	88 1d b1 cc 00 00    	mov    %bl,0xccb1
+  for(i = 0; i < 52; i++){
+    1869:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+    186c:	68 b0 cc 00 00       	push   $0xccb0
+    1871:	e8 73 47 00 00       	call   5fe9 <unlink>
+  for(i = 0; i < 52; i++){
+    1876:	83 c4 10             	add    $0x10,%esp
+    1879:	80 fb 64             	cmp    $0x64,%bl
+    187c:	75 e2                	jne    1860 <createtest+0x70>
+  printf(1, "many creates, followed by unlink; ok\n");
+    187e:	83 ec 08             	sub    $0x8,%esp
+    1881:	68 10 84 00 00       	push   $0x8410
+    1886:	6a 01                	push   $0x1
+    1888:	e8 e3 4b 00 00       	call   6470 <printf>
+}
+    188d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1890:	83 c4 10             	add    $0x10,%esp
+    1893:	c9                   	leave
+    1894:	c3                   	ret
+    1895:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    189c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000018a0 <dirtest>:
+{
+    18a0:	55                   	push   %ebp
+    18a1:	89 e5                	mov    %esp,%ebp
+    18a3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "mkdir test\n");
+    18a6:	68 ec 70 00 00       	push   $0x70ec
+    18ab:	6a 01                	push   $0x1
+    18ad:	e8 be 4b 00 00       	call   6470 <printf>
+  if(mkdir("dir0") < 0){
+    18b2:	c7 04 24 f8 70 00 00 	movl   $0x70f8,(%esp)
+    18b9:	e8 58 47 00 00       	call   6016 <mkdir>
+    18be:	83 c4 10             	add    $0x10,%esp
+    18c1:	85 c0                	test   %eax,%eax
+    18c3:	78 50                	js     1915 <dirtest+0x75>
+  if(chdir("dir0") < 0){
+    18c5:	83 ec 0c             	sub    $0xc,%esp
+    18c8:	68 f8 70 00 00       	push   $0x70f8
+    18cd:	e8 53 47 00 00       	call   6025 <chdir>
+    18d2:	83 c4 10             	add    $0x10,%esp
+    18d5:	85 c0                	test   %eax,%eax
+    18d7:	78 75                	js     194e <dirtest+0xae>
+  if(chdir("..") < 0){
+    18d9:	83 ec 0c             	sub    $0xc,%esp
+    18dc:	68 93 7a 00 00       	push   $0x7a93
+    18e1:	e8 3f 47 00 00       	call   6025 <chdir>
+    18e6:	83 c4 10             	add    $0x10,%esp
+    18e9:	85 c0                	test   %eax,%eax
+    18eb:	78 4e                	js     193b <dirtest+0x9b>
+  if(unlink("dir0") < 0){
+    18ed:	83 ec 0c             	sub    $0xc,%esp
+    18f0:	68 f8 70 00 00       	push   $0x70f8
+    18f5:	e8 ef 46 00 00       	call   5fe9 <unlink>
+    18fa:	83 c4 10             	add    $0x10,%esp
+    18fd:	85 c0                	test   %eax,%eax
+    18ff:	78 27                	js     1928 <dirtest+0x88>
+  printf(1, "mkdir test ok\n");
+    1901:	83 ec 08             	sub    $0x8,%esp
+    1904:	68 35 71 00 00       	push   $0x7135
+    1909:	6a 01                	push   $0x1
+    190b:	e8 60 4b 00 00       	call   6470 <printf>
+}
+    1910:	83 c4 10             	add    $0x10,%esp
+    1913:	c9                   	leave
+    1914:	c3                   	ret
+    printf(1, "mkdir failed\n");
+    1915:	50                   	push   %eax
+    1916:	50                   	push   %eax
+    1917:	68 28 6e 00 00       	push   $0x6e28
+    191c:	6a 01                	push   $0x1
+    191e:	e8 4d 4b 00 00       	call   6470 <printf>
+    exit();
+    1923:	e8 d8 45 00 00       	call   5f00 <exit>
+    printf(1, "unlink dir0 failed\n");
+    1928:	50                   	push   %eax
+    1929:	50                   	push   %eax
+    192a:	68 21 71 00 00       	push   $0x7121
+    192f:	6a 01                	push   $0x1
+    1931:	e8 3a 4b 00 00       	call   6470 <printf>
+    exit();
+    1936:	e8 c5 45 00 00       	call   5f00 <exit>
+    printf(1, "chdir .. failed\n");
+    193b:	52                   	push   %edx
+    193c:	52                   	push   %edx
+    193d:	68 10 71 00 00       	push   $0x7110
+    1942:	6a 01                	push   $0x1
+    1944:	e8 27 4b 00 00       	call   6470 <printf>
+    exit();
+    1949:	e8 b2 45 00 00       	call   5f00 <exit>
+    printf(1, "chdir dir0 failed\n");
+    194e:	51                   	push   %ecx
+    194f:	51                   	push   %ecx
+    1950:	68 fd 70 00 00       	push   $0x70fd
+    1955:	6a 01                	push   $0x1
+    1957:	e8 14 4b 00 00       	call   6470 <printf>
+    exit();
+    195c:	e8 9f 45 00 00       	call   5f00 <exit>
+    1961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196f:	90                   	nop
+
+00001970 <exectest>:
+{
+    1970:	55                   	push   %ebp
+    1971:	89 e5                	mov    %esp,%ebp
+    1973:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "exec test\n");
+    1976:	68 44 71 00 00       	push   $0x7144
+    197b:	6a 01                	push   $0x1
+    197d:	e8 ee 4a 00 00       	call   6470 <printf>
+  if(exec("echo", echoargv) < 0){
+    1982:	5a                   	pop    %edx
+    1983:	59                   	pop    %ecx
+    1984:	68 04 9c 00 00       	push   $0x9c04
+    1989:	68 0d 6f 00 00       	push   $0x6f0d
+    198e:	e8 8d 45 00 00       	call   5f20 <exec>
+    1993:	83 c4 10             	add    $0x10,%esp
+    1996:	85 c0                	test   %eax,%eax
+    1998:	78 02                	js     199c <exectest+0x2c>
+}
+    199a:	c9                   	leave
+    199b:	c3                   	ret
+    printf(1, "exec echo failed\n");
+    199c:	50                   	push   %eax
+    199d:	50                   	push   %eax
+    199e:	68 4f 71 00 00       	push   $0x714f
+    19a3:	6a 01                	push   $0x1
+    19a5:	e8 c6 4a 00 00       	call   6470 <printf>
+    exit();
+    19aa:	e8 51 45 00 00       	call   5f00 <exit>
+    19af:	90                   	nop
+
+000019b0 <pipe1>:
+{
+    19b0:	55                   	push   %ebp
+    19b1:	89 e5                	mov    %esp,%ebp
+    19b3:	57                   	push   %edi
+    19b4:	56                   	push   %esi
+  if(pipe(fds) != 0){
+    19b5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+    19b8:	53                   	push   %ebx
+    19b9:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+    19bc:	50                   	push   %eax
+    19bd:	e8 af 45 00 00       	call   5f71 <pipe>
+    19c2:	83 c4 10             	add    $0x10,%esp
+    19c5:	85 c0                	test   %eax,%eax
+    19c7:	0f 85 41 01 00 00    	jne    1b0e <pipe1+0x15e>
+    19cd:	89 c6                	mov    %eax,%esi
+  pid = fork();
+    19cf:	e8 fc 44 00 00       	call   5ed0 <fork>
+  if(pid == 0){
+    19d4:	85 c0                	test   %eax,%eax
+    19d6:	0f 84 92 00 00 00    	je     1a6e <pipe1+0xbe>
+  } else if(pid > 0){
+    19dc:	0f 8e 3f 01 00 00    	jle    1b21 <pipe1+0x171>
+    close(fds[1]);
+    19e2:	83 ec 0c             	sub    $0xc,%esp
+    19e5:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+    19e8:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+    19ea:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+    19ef:	e8 aa 45 00 00       	call   5f9e <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+    19f4:	83 c4 10             	add    $0x10,%esp
+    19f7:	83 ec 04             	sub    $0x4,%esp
+    19fa:	57                   	push   %edi
+    19fb:	68 c0 cc 00 00       	push   $0xccc0
+    1a00:	ff 75 e0             	push   -0x20(%ebp)
+    1a03:	e8 78 45 00 00       	call   5f80 <read>
+    1a08:	83 c4 10             	add    $0x10,%esp
+    1a0b:	89 c1                	mov    %eax,%ecx
+    1a0d:	85 c0                	test   %eax,%eax
+    1a0f:	0f 8e b8 00 00 00    	jle    1acd <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+    1a15:	89 f0                	mov    %esi,%eax
+    1a17:	32 05 c0 cc 00 00    	xor    0xccc0,%al
+    1a1d:	0f b6 c0             	movzbl %al,%eax
+    1a20:	85 c0                	test   %eax,%eax
+    1a22:	75 30                	jne    1a54 <pipe1+0xa4>
+    1a24:	83 c6 01             	add    $0x1,%esi
+    1a27:	eb 0f                	jmp    1a38 <pipe1+0x88>
+    1a29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a30:	38 90 c0 cc 00 00    	cmp    %dl,0xccc0(%eax)
+    1a36:	75 1c                	jne    1a54 <pipe1+0xa4>
+    1a38:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+    1a3b:	83 c0 01             	add    $0x1,%eax
+    1a3e:	39 c1                	cmp    %eax,%ecx
+    1a40:	75 ee                	jne    1a30 <pipe1+0x80>
+      cc = cc * 2;
+    1a42:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+    1a44:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+    1a49:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+    1a4b:	89 d6                	mov    %edx,%esi
+    1a4d:	39 c7                	cmp    %eax,%edi
+    1a4f:	0f 4f f8             	cmovg  %eax,%edi
+    1a52:	eb a3                	jmp    19f7 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+    1a54:	83 ec 08             	sub    $0x8,%esp
+    1a57:	68 7e 71 00 00       	push   $0x717e
+    1a5c:	6a 01                	push   $0x1
+    1a5e:	e8 0d 4a 00 00       	call   6470 <printf>
+    1a63:	83 c4 10             	add    $0x10,%esp
+}
+    1a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a69:	5b                   	pop    %ebx
+    1a6a:	5e                   	pop    %esi
+    1a6b:	5f                   	pop    %edi
+    1a6c:	5d                   	pop    %ebp
+    1a6d:	c3                   	ret
+    close(fds[0]);
+    1a6e:	83 ec 0c             	sub    $0xc,%esp
+    1a71:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+    1a74:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+    1a76:	e8 23 45 00 00       	call   5f9e <close>
+    1a7b:	83 c4 10             	add    $0x10,%esp
+    1a7e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+    1a80:	31 c0                	xor    %eax,%eax
+    1a82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+    1a88:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+    1a8b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+    1a8e:	88 90 bf cc 00 00    	mov    %dl,0xccbf(%eax)
+      for(i = 0; i < 1033; i++)
+    1a94:	3d 09 04 00 00       	cmp    $0x409,%eax
+    1a99:	75 ed                	jne    1a88 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+    1a9b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+    1a9e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+    1aa4:	68 09 04 00 00       	push   $0x409
+    1aa9:	68 c0 cc 00 00       	push   $0xccc0
+    1aae:	ff 75 e4             	push   -0x1c(%ebp)
+    1ab1:	e8 d9 44 00 00       	call   5f8f <write>
+    1ab6:	83 c4 10             	add    $0x10,%esp
+    1ab9:	3d 09 04 00 00       	cmp    $0x409,%eax
+    1abe:	75 74                	jne    1b34 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+    1ac0:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+    1ac6:	75 b8                	jne    1a80 <pipe1+0xd0>
+    exit();
+    1ac8:	e8 33 44 00 00       	call   5f00 <exit>
+    if(total != 5 * 1033){
+    1acd:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+    1ad3:	75 26                	jne    1afb <pipe1+0x14b>
+    close(fds[0]);
+    1ad5:	83 ec 0c             	sub    $0xc,%esp
+    1ad8:	ff 75 e0             	push   -0x20(%ebp)
+    1adb:	e8 be 44 00 00       	call   5f9e <close>
+    wait();
+    1ae0:	e8 7d 44 00 00       	call   5f62 <wait>
+  printf(1, "pipe1 ok\n");
+    1ae5:	5a                   	pop    %edx
+    1ae6:	59                   	pop    %ecx
+    1ae7:	68 a3 71 00 00       	push   $0x71a3
+    1aec:	6a 01                	push   $0x1
+    1aee:	e8 7d 49 00 00       	call   6470 <printf>
+    1af3:	83 c4 10             	add    $0x10,%esp
+    1af6:	e9 6b ff ff ff       	jmp    1a66 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+    1afb:	56                   	push   %esi
+    1afc:	53                   	push   %ebx
+    1afd:	68 8c 71 00 00       	push   $0x718c
+    1b02:	6a 01                	push   $0x1
+    1b04:	e8 67 49 00 00       	call   6470 <printf>
+      exit();
+    1b09:	e8 f2 43 00 00       	call   5f00 <exit>
+    printf(1, "pipe() failed\n");
+    1b0e:	50                   	push   %eax
+    1b0f:	50                   	push   %eax
+    1b10:	68 61 71 00 00       	push   $0x7161
+    1b15:	6a 01                	push   $0x1
+    1b17:	e8 54 49 00 00       	call   6470 <printf>
+    exit();
+    1b1c:	e8 df 43 00 00       	call   5f00 <exit>
+    printf(1, "fork() failed\n");
+    1b21:	50                   	push   %eax
+    1b22:	50                   	push   %eax
+    1b23:	68 ad 71 00 00       	push   $0x71ad
+    1b28:	6a 01                	push   $0x1
+    1b2a:	e8 41 49 00 00       	call   6470 <printf>
+    exit();
+    1b2f:	e8 cc 43 00 00       	call   5f00 <exit>
+        printf(1, "pipe1 oops 1\n");
+    1b34:	57                   	push   %edi
+    1b35:	57                   	push   %edi
+    1b36:	68 70 71 00 00       	push   $0x7170
+    1b3b:	6a 01                	push   $0x1
+    1b3d:	e8 2e 49 00 00       	call   6470 <printf>
+        exit();
+    1b42:	e8 b9 43 00 00       	call   5f00 <exit>
+    1b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4e:	66 90                	xchg   %ax,%ax
+
+00001b50 <pipesize>:
+{
+    1b50:	55                   	push   %ebp
+    1b51:	89 e5                	mov    %esp,%ebp
+    1b53:	53                   	push   %ebx
+  if(pipe(fds) != 0){
+    1b54:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+    1b57:	83 ec 20             	sub    $0x20,%esp
+  if(pipe(fds) != 0){
+    1b5a:	50                   	push   %eax
+    1b5b:	e8 11 44 00 00       	call   5f71 <pipe>
+    1b60:	83 c4 10             	add    $0x10,%esp
+    1b63:	85 c0                	test   %eax,%eax
+    1b65:	0f 85 0e 02 00 00    	jne    1d79 <pipesize+0x229>
+  if(fcntl(fds[0], F_GETPIPE_SZ, 0) != 4096 ||
+    1b6b:	83 ec 04             	sub    $0x4,%esp
+    1b6e:	89 c3                	mov    %eax,%ebx
+    1b70:	6a 00                	push   $0x0
+    1b72:	68 08 04 00 00       	push   $0x408
+    1b77:	ff 75 f0             	push   -0x10(%ebp)
+    1b7a:	e8 2d 45 00 00       	call   60ac <fcntl>
+    1b7f:	83 c4 10             	add    $0x10,%esp
+    1b82:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    1b87:	0f 85 4b 02 00 00    	jne    1dd8 <pipesize+0x288>
+     fcntl(fds[1], F_SETPIPE_SZ, 5000) != 8192){
+    1b8d:	83 ec 04             	sub    $0x4,%esp
+    1b90:	68 88 13 00 00       	push   $0x1388
+    1b95:	68 07 04 00 00       	push   $0x407
+    1b9a:	ff 75 f4             	push   -0xc(%ebp)
+    1b9d:	e8 0a 45 00 00       	call   60ac <fcntl>
+  if(fcntl(fds[0], F_GETPIPE_SZ, 0) != 4096 ||
+    1ba2:	83 c4 10             	add    $0x10,%esp
+    1ba5:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1baa:	0f 85 28 02 00 00    	jne    1dd8 <pipesize+0x288>
+    1bb0:	31 c0                	xor    %eax,%eax
+    1bb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    buf[i] = seq++;
+    1bb8:	88 80 c0 cc 00 00    	mov    %al,0xccc0(%eax)
+  for(i = 0; i < 8192; i++)
+    1bbe:	83 c0 01             	add    $0x1,%eax
+    1bc1:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1bc6:	75 f0                	jne    1bb8 <pipesize+0x68>
+  if(write(fds[1], buf, 8192) != 8192){
+    1bc8:	83 ec 04             	sub    $0x4,%esp
+    1bcb:	68 00 20 00 00       	push   $0x2000
+    1bd0:	68 c0 cc 00 00       	push   $0xccc0
+    1bd5:	ff 75 f4             	push   -0xc(%ebp)
+    1bd8:	e8 b2 43 00 00       	call   5f8f <write>
+    1bdd:	83 c4 10             	add    $0x10,%esp
+    1be0:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1be5:	0f 85 da 01 00 00    	jne    1dc5 <pipesize+0x275>
+  if(fcntl(fds[1], F_SETPIPE_SZ, 4096) != -1){
+    1beb:	83 ec 04             	sub    $0x4,%esp
+    1bee:	68 00 10 00 00       	push   $0x1000
+    1bf3:	68 07 04 00 00       	push   $0x407
+    1bf8:	ff 75 f4             	push   -0xc(%ebp)
+    1bfb:	e8 ac 44 00 00       	call   60ac <fcntl>
+    1c00:	83 c4 10             	add    $0x10,%esp
+    1c03:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c06:	0f 85 a6 01 00 00    	jne    1db2 <pipesize+0x262>
+  if(read(fds[0], buf, 3000) != 3000){
+    1c0c:	83 ec 04             	sub    $0x4,%esp
+    1c0f:	68 b8 0b 00 00       	push   $0xbb8
+    1c14:	68 c0 cc 00 00       	push   $0xccc0
+    1c19:	ff 75 f0             	push   -0x10(%ebp)
+    1c1c:	e8 5f 43 00 00       	call   5f80 <read>
+    1c21:	83 c4 10             	add    $0x10,%esp
+    1c24:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1c29:	0f 85 70 01 00 00    	jne    1d9f <pipesize+0x24f>
+    1c2f:	90                   	nop
+    if((buf[i] & 0xff) != (rseq++ & 0xff)){
+    1c30:	0f be 83 c0 cc 00 00 	movsbl 0xccc0(%ebx),%eax
+    1c37:	89 da                	mov    %ebx,%edx
+    1c39:	83 c3 01             	add    $0x1,%ebx
+    1c3c:	31 d0                	xor    %edx,%eax
+    1c3e:	25 ff 00 00 00       	and    $0xff,%eax
+    1c43:	0f 85 f4 00 00 00    	jne    1d3d <pipesize+0x1ed>
+  for(i = 0; i < 3000; i++)
+    1c49:	81 fb b8 0b 00 00    	cmp    $0xbb8,%ebx
+    1c4f:	75 df                	jne    1c30 <pipesize+0xe0>
+    1c51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    buf[i] = seq++;
+    1c58:	88 80 c0 cc 00 00    	mov    %al,0xccc0(%eax)
+  for(i = 0; i < 3000; i++)
+    1c5e:	83 c0 01             	add    $0x1,%eax
+    1c61:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1c66:	75 f0                	jne    1c58 <pipesize+0x108>
+  if(write(fds[1], buf, 3000) != 3000 ||
+    1c68:	83 ec 04             	sub    $0x4,%esp
+    1c6b:	68 b8 0b 00 00       	push   $0xbb8
+    1c70:	68 c0 cc 00 00       	push   $0xccc0
+    1c75:	ff 75 f4             	push   -0xc(%ebp)
+    1c78:	e8 12 43 00 00       	call   5f8f <write>
+    1c7d:	83 c4 10             	add    $0x10,%esp
+    1c80:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1c85:	0f 85 da 00 00 00    	jne    1d65 <pipesize+0x215>
+     fcntl(fds[1], F_SETPIPE_SZ, 16384) != 16384 ||
+    1c8b:	83 ec 04             	sub    $0x4,%esp
+    1c8e:	68 00 40 00 00       	push   $0x4000
+    1c93:	68 07 04 00 00       	push   $0x407
+    1c98:	ff 75 f4             	push   -0xc(%ebp)
+    1c9b:	e8 0c 44 00 00       	call   60ac <fcntl>
+  if(write(fds[1], buf, 3000) != 3000 ||
+    1ca0:	83 c4 10             	add    $0x10,%esp
+    1ca3:	3d 00 40 00 00       	cmp    $0x4000,%eax
+    1ca8:	0f 85 b7 00 00 00    	jne    1d65 <pipesize+0x215>
+     read(fds[0], buf, sizeof(buf)) != 8192){
+    1cae:	83 ec 04             	sub    $0x4,%esp
+    1cb1:	68 00 20 00 00       	push   $0x2000
+    1cb6:	68 c0 cc 00 00       	push   $0xccc0
+    1cbb:	ff 75 f0             	push   -0x10(%ebp)
+    1cbe:	e8 bd 42 00 00       	call   5f80 <read>
+     fcntl(fds[1], F_SETPIPE_SZ, 16384) != 16384 ||
+    1cc3:	83 c4 10             	add    $0x10,%esp
+    1cc6:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1ccb:	0f 85 94 00 00 00    	jne    1d65 <pipesize+0x215>
+    if((buf[i] & 0xff) != (rseq++ & 0xff)){
+    1cd1:	80 3d c0 cc 00 00 b8 	cmpb   $0xb8,0xccc0
+    1cd8:	75 77                	jne    1d51 <pipesize+0x201>
+    1cda:	b8 b9 0b 00 00       	mov    $0xbb9,%eax
+    1cdf:	90                   	nop
+    1ce0:	0f be 90 08 c1 00 00 	movsbl 0xc108(%eax),%edx
+    1ce7:	89 c1                	mov    %eax,%ecx
+    1ce9:	83 c0 01             	add    $0x1,%eax
+    1cec:	31 ca                	xor    %ecx,%edx
+    1cee:	84 d2                	test   %dl,%dl
+    1cf0:	75 5f                	jne    1d51 <pipesize+0x201>
+  for(i = 0; i < 8192; i++)
+    1cf2:	3d b8 2b 00 00       	cmp    $0x2bb8,%eax
+    1cf7:	75 e7                	jne    1ce0 <pipesize+0x190>
+  close(fds[0]);
+    1cf9:	83 ec 0c             	sub    $0xc,%esp
+    1cfc:	ff 75 f0             	push   -0x10(%ebp)
+    1cff:	e8 9a 42 00 00       	call   5f9e <close>
+  close(fds[1]);
+    1d04:	5a                   	pop    %edx
+    1d05:	ff 75 f4             	push   -0xc(%ebp)
+    1d08:	e8 91 42 00 00       	call   5f9e <close>
+  if(fcntl(1, F_GETPIPE_SZ, 0) != -1){
+    1d0d:	83 c4 0c             	add    $0xc,%esp
+    1d10:	6a 00                	push   $0x0
+    1d12:	68 08 04 00 00       	push   $0x408
+    1d17:	6a 01                	push   $0x1
+    1d19:	e8 8e 43 00 00       	call   60ac <fcntl>
+    1d1e:	83 c4 10             	add    $0x10,%esp
+    1d21:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1d24:	75 66                	jne    1d8c <pipesize+0x23c>
+  printf(1, "pipesize ok\n");
+    1d26:	83 ec 08             	sub    $0x8,%esp
+    1d29:	68 1f 72 00 00       	push   $0x721f
+    1d2e:	6a 01                	push   $0x1
+    1d30:	e8 3b 47 00 00       	call   6470 <printf>
+}
+    1d35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d38:	83 c4 10             	add    $0x10,%esp
+    1d3b:	c9                   	leave
+    1d3c:	c3                   	ret
+      printf(1, "pipesize: wrong data\n");
+    1d3d:	83 ec 08             	sub    $0x8,%esp
+    1d40:	68 09 72 00 00       	push   $0x7209
+    1d45:	6a 01                	push   $0x1
+    1d47:	e8 24 47 00 00       	call   6470 <printf>
+      exit();
+    1d4c:	e8 af 41 00 00       	call   5f00 <exit>
+      printf(1, "pipesize: wrong data after grow\n");
+    1d51:	83 ec 08             	sub    $0x8,%esp
+    1d54:	68 78 84 00 00       	push   $0x8478
+    1d59:	6a 01                	push   $0x1
+    1d5b:	e8 10 47 00 00       	call   6470 <printf>
+      exit();
+    1d60:	e8 9b 41 00 00       	call   5f00 <exit>
+    printf(1, "pipesize: wrap or grow failed\n");
+    1d65:	83 ec 08             	sub    $0x8,%esp
+    1d68:	68 58 84 00 00       	push   $0x8458
+    1d6d:	6a 01                	push   $0x1
+    1d6f:	e8 fc 46 00 00       	call   6470 <printf>
+    exit();
+    1d74:	e8 87 41 00 00       	call   5f00 <exit>
+    printf(1, "pipe() failed\n");
+    1d79:	50                   	push   %eax
+    1d7a:	50                   	push   %eax
+    1d7b:	68 61 71 00 00       	push   $0x7161
+    1d80:	6a 01                	push   $0x1
+    1d82:	e8 e9 46 00 00       	call   6470 <printf>
+    exit();
+    1d87:	e8 74 41 00 00       	call   5f00 <exit>
+    printf(1, "pipesize: F_GETPIPE_SZ on a non-pipe\n");
+    1d8c:	50                   	push   %eax
+    1d8d:	50                   	push   %eax
+    1d8e:	68 9c 84 00 00       	push   $0x849c
+    1d93:	6a 01                	push   $0x1
+    1d95:	e8 d6 46 00 00       	call   6470 <printf>
+    exit();
+    1d9a:	e8 61 41 00 00       	call   5f00 <exit>
+    printf(1, "pipesize: read failed\n");
+    1d9f:	51                   	push   %ecx
+    1da0:	51                   	push   %ecx
+    1da1:	68 f2 71 00 00       	push   $0x71f2
+    1da6:	6a 01                	push   $0x1
+    1da8:	e8 c3 46 00 00       	call   6470 <printf>
+    exit();
+    1dad:	e8 4e 41 00 00       	call   5f00 <exit>
+    printf(1, "pipesize: shrank a full pipe\n");
+    1db2:	53                   	push   %ebx
+    1db3:	53                   	push   %ebx
+    1db4:	68 d4 71 00 00       	push   $0x71d4
+    1db9:	6a 01                	push   $0x1
+    1dbb:	e8 b0 46 00 00       	call   6470 <printf>
+    exit();
+    1dc0:	e8 3b 41 00 00       	call   5f00 <exit>
+    printf(1, "pipesize: write failed\n");
+    1dc5:	50                   	push   %eax
+    1dc6:	50                   	push   %eax
+    1dc7:	68 bc 71 00 00       	push   $0x71bc
+    1dcc:	6a 01                	push   $0x1
+    1dce:	e8 9d 46 00 00       	call   6470 <printf>
+    exit();
+    1dd3:	e8 28 41 00 00       	call   5f00 <exit>
+    printf(1, "pipesize: F_SETPIPE_SZ failed\n");
+    1dd8:	50                   	push   %eax
+    1dd9:	50                   	push   %eax
+    1dda:	68 38 84 00 00       	push   $0x8438
+    1ddf:	6a 01                	push   $0x1
+    1de1:	e8 8a 46 00 00       	call   6470 <printf>
+    exit();
+    1de6:	e8 15 41 00 00       	call   5f00 <exit>
+    1deb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1def:	90                   	nop
+
+00001df0 <splicetest>:
+{
+    1df0:	55                   	push   %ebp
+  for(i = 0; i < 3000; i++)
+    1df1:	31 c0                	xor    %eax,%eax
+{
+    1df3:	89 e5                	mov    %esp,%ebp
+    1df5:	53                   	push   %ebx
+    1df6:	83 ec 14             	sub    $0x14,%esp
+    1df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    buf[i] = i;
+    1e00:	88 80 c0 cc 00 00    	mov    %al,0xccc0(%eax)
+  for(i = 0; i < 3000; i++)
+    1e06:	83 c0 01             	add    $0x1,%eax
+    1e09:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1e0e:	75 f0                	jne    1e00 <splicetest+0x10>
+  fd = open("splice0", O_CREATE|O_RDWR);
+    1e10:	83 ec 08             	sub    $0x8,%esp
+    1e13:	68 02 02 00 00       	push   $0x202
+    1e18:	68 2c 72 00 00       	push   $0x722c
+    1e1d:	e8 a9 41 00 00       	call   5fcb <open>
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+    1e22:	83 c4 10             	add    $0x10,%esp
+  fd = open("splice0", O_CREATE|O_RDWR);
+    1e25:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+    1e27:	85 c0                	test   %eax,%eax
+    1e29:	0f 88 62 02 00 00    	js     2091 <splicetest+0x2a1>
+    1e2f:	83 ec 04             	sub    $0x4,%esp
+    1e32:	68 b8 0b 00 00       	push   $0xbb8
+    1e37:	68 c0 cc 00 00       	push   $0xccc0
+    1e3c:	50                   	push   %eax
+    1e3d:	e8 4d 41 00 00       	call   5f8f <write>
+    1e42:	83 c4 10             	add    $0x10,%esp
+    1e45:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1e4a:	0f 85 41 02 00 00    	jne    2091 <splicetest+0x2a1>
+  close(fd);
+    1e50:	83 ec 0c             	sub    $0xc,%esp
+    1e53:	53                   	push   %ebx
+    1e54:	e8 45 41 00 00       	call   5f9e <close>
+  if(pipe(a) != 0 || pipe(b) != 0){
+    1e59:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    1e5c:	89 04 24             	mov    %eax,(%esp)
+    1e5f:	e8 0d 41 00 00       	call   5f71 <pipe>
+    1e64:	83 c4 10             	add    $0x10,%esp
+    1e67:	85 c0                	test   %eax,%eax
+    1e69:	0f 85 0f 02 00 00    	jne    207e <splicetest+0x28e>
+    1e6f:	83 ec 0c             	sub    $0xc,%esp
+    1e72:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1e75:	50                   	push   %eax
+    1e76:	e8 f6 40 00 00       	call   5f71 <pipe>
+    1e7b:	83 c4 10             	add    $0x10,%esp
+    1e7e:	85 c0                	test   %eax,%eax
+    1e80:	0f 85 f8 01 00 00    	jne    207e <splicetest+0x28e>
+  fd = open("splice0", O_RDONLY);
+    1e86:	83 ec 08             	sub    $0x8,%esp
+    1e89:	6a 00                	push   $0x0
+    1e8b:	68 2c 72 00 00       	push   $0x722c
+    1e90:	e8 36 41 00 00       	call   5fcb <open>
+  if(splice(fd, a[1], 5000) != 3000 || splice(fd, a[1], 5000) != 0){
+    1e95:	83 c4 0c             	add    $0xc,%esp
+    1e98:	68 88 13 00 00       	push   $0x1388
+  fd = open("splice0", O_RDONLY);
+    1e9d:	89 c3                	mov    %eax,%ebx
+  if(splice(fd, a[1], 5000) != 3000 || splice(fd, a[1], 5000) != 0){
+    1e9f:	ff 75 ec             	push   -0x14(%ebp)
+    1ea2:	50                   	push   %eax
+    1ea3:	e8 13 42 00 00       	call   60bb <splice>
+    1ea8:	83 c4 10             	add    $0x10,%esp
+    1eab:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1eb0:	0f 85 b5 01 00 00    	jne    206b <splicetest+0x27b>
+    1eb6:	83 ec 04             	sub    $0x4,%esp
+    1eb9:	68 88 13 00 00       	push   $0x1388
+    1ebe:	ff 75 ec             	push   -0x14(%ebp)
+    1ec1:	53                   	push   %ebx
+    1ec2:	e8 f4 41 00 00       	call   60bb <splice>
+    1ec7:	83 c4 10             	add    $0x10,%esp
+    1eca:	85 c0                	test   %eax,%eax
+    1ecc:	0f 85 99 01 00 00    	jne    206b <splicetest+0x27b>
+  close(fd);
+    1ed2:	83 ec 0c             	sub    $0xc,%esp
+    1ed5:	53                   	push   %ebx
+    1ed6:	e8 c3 40 00 00       	call   5f9e <close>
+  if(splice(a[0], b[1], 5000) != 3000 || splice(a[0], a[1], 1) != -1){
+    1edb:	83 c4 0c             	add    $0xc,%esp
+    1ede:	68 88 13 00 00       	push   $0x1388
+    1ee3:	ff 75 f4             	push   -0xc(%ebp)
+    1ee6:	ff 75 e8             	push   -0x18(%ebp)
+    1ee9:	e8 cd 41 00 00       	call   60bb <splice>
+    1eee:	83 c4 10             	add    $0x10,%esp
+    1ef1:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1ef6:	0f 85 5c 01 00 00    	jne    2058 <splicetest+0x268>
+    1efc:	83 ec 04             	sub    $0x4,%esp
+    1eff:	6a 01                	push   $0x1
+    1f01:	ff 75 ec             	push   -0x14(%ebp)
+    1f04:	ff 75 e8             	push   -0x18(%ebp)
+    1f07:	e8 af 41 00 00       	call   60bb <splice>
+    1f0c:	83 c4 10             	add    $0x10,%esp
+    1f0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1f12:	0f 85 40 01 00 00    	jne    2058 <splicetest+0x268>
+  fd = open("splice1", O_CREATE|O_RDWR);
+    1f18:	83 ec 08             	sub    $0x8,%esp
+    1f1b:	68 02 02 00 00       	push   $0x202
+    1f20:	68 4f 72 00 00       	push   $0x724f
+    1f25:	e8 a1 40 00 00       	call   5fcb <open>
+  if(splice(b[0], fd, 5000) != 3000){
+    1f2a:	83 c4 0c             	add    $0xc,%esp
+    1f2d:	68 88 13 00 00       	push   $0x1388
+  fd = open("splice1", O_CREATE|O_RDWR);
+    1f32:	89 c3                	mov    %eax,%ebx
+  if(splice(b[0], fd, 5000) != 3000){
+    1f34:	50                   	push   %eax
+    1f35:	ff 75 f0             	push   -0x10(%ebp)
+    1f38:	e8 7e 41 00 00       	call   60bb <splice>
+    1f3d:	83 c4 10             	add    $0x10,%esp
+    1f40:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1f45:	0f 85 fa 00 00 00    	jne    2045 <splicetest+0x255>
+  close(fd);
+    1f4b:	83 ec 0c             	sub    $0xc,%esp
+    1f4e:	53                   	push   %ebx
+    1f4f:	e8 4a 40 00 00       	call   5f9e <close>
+  memset(buf, 0, 3000);
+    1f54:	83 c4 0c             	add    $0xc,%esp
+    1f57:	68 b8 0b 00 00       	push   $0xbb8
+    1f5c:	6a 00                	push   $0x0
+    1f5e:	68 c0 cc 00 00       	push   $0xccc0
+    1f63:	e8 78 3d 00 00       	call   5ce0 <memset>
+  fd = open("splice1", O_RDONLY);
+    1f68:	58                   	pop    %eax
+    1f69:	5a                   	pop    %edx
+    1f6a:	6a 00                	push   $0x0
+    1f6c:	68 4f 72 00 00       	push   $0x724f
+    1f71:	e8 55 40 00 00       	call   5fcb <open>
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    1f76:	83 c4 0c             	add    $0xc,%esp
+    1f79:	68 00 20 00 00       	push   $0x2000
+  fd = open("splice1", O_RDONLY);
+    1f7e:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    1f80:	68 c0 cc 00 00       	push   $0xccc0
+    1f85:	50                   	push   %eax
+    1f86:	e8 f5 3f 00 00       	call   5f80 <read>
+    1f8b:	83 c4 10             	add    $0x10,%esp
+    1f8e:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1f93:	0f 85 99 00 00 00    	jne    2032 <splicetest+0x242>
+  close(fd);
+    1f99:	83 ec 0c             	sub    $0xc,%esp
+    1f9c:	53                   	push   %ebx
+    1f9d:	e8 fc 3f 00 00       	call   5f9e <close>
+    if((buf[i] & 0xff) != (i & 0xff)){
+    1fa2:	0f b6 05 c0 cc 00 00 	movzbl 0xccc0,%eax
+    1fa9:	83 c4 10             	add    $0x10,%esp
+    1fac:	85 c0                	test   %eax,%eax
+    1fae:	74 10                	je     1fc0 <splicetest+0x1d0>
+    1fb0:	eb 6c                	jmp    201e <splicetest+0x22e>
+    1fb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1fb8:	38 80 c0 cc 00 00    	cmp    %al,0xccc0(%eax)
+    1fbe:	75 5e                	jne    201e <splicetest+0x22e>
+  for(i = 0; i < 3000; i++)
+    1fc0:	83 c0 01             	add    $0x1,%eax
+    1fc3:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    1fc8:	75 ee                	jne    1fb8 <splicetest+0x1c8>
+  close(a[0]);
+    1fca:	83 ec 0c             	sub    $0xc,%esp
+    1fcd:	ff 75 e8             	push   -0x18(%ebp)
+    1fd0:	e8 c9 3f 00 00       	call   5f9e <close>
+  close(a[1]);
+    1fd5:	58                   	pop    %eax
+    1fd6:	ff 75 ec             	push   -0x14(%ebp)
+    1fd9:	e8 c0 3f 00 00       	call   5f9e <close>
+  close(b[0]);
+    1fde:	5a                   	pop    %edx
+    1fdf:	ff 75 f0             	push   -0x10(%ebp)
+    1fe2:	e8 b7 3f 00 00       	call   5f9e <close>
+  close(b[1]);
+    1fe7:	59                   	pop    %ecx
+    1fe8:	ff 75 f4             	push   -0xc(%ebp)
+    1feb:	e8 ae 3f 00 00       	call   5f9e <close>
+  unlink("splice0");
+    1ff0:	c7 04 24 2c 72 00 00 	movl   $0x722c,(%esp)
+    1ff7:	e8 ed 3f 00 00       	call   5fe9 <unlink>
+  unlink("splice1");
+    1ffc:	c7 04 24 4f 72 00 00 	movl   $0x724f,(%esp)
+    2003:	e8 e1 3f 00 00       	call   5fe9 <unlink>
+  printf(1, "splicetest ok\n");
+    2008:	5b                   	pop    %ebx
+    2009:	58                   	pop    %eax
+    200a:	68 87 72 00 00       	push   $0x7287
+    200f:	6a 01                	push   $0x1
+    2011:	e8 5a 44 00 00       	call   6470 <printf>
+}
+    2016:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2019:	83 c4 10             	add    $0x10,%esp
+    201c:	c9                   	leave
+    201d:	c3                   	ret
+      printf(1, "splicetest: wrong data\n");
+    201e:	83 ec 08             	sub    $0x8,%esp
+    2021:	68 6f 72 00 00       	push   $0x726f
+    2026:	6a 01                	push   $0x1
+    2028:	e8 43 44 00 00       	call   6470 <printf>
+      exit();
+    202d:	e8 ce 3e 00 00       	call   5f00 <exit>
+    printf(1, "splicetest: short file\n");
+    2032:	50                   	push   %eax
+    2033:	50                   	push   %eax
+    2034:	68 57 72 00 00       	push   $0x7257
+    2039:	6a 01                	push   $0x1
+    203b:	e8 30 44 00 00       	call   6470 <printf>
+    exit();
+    2040:	e8 bb 3e 00 00       	call   5f00 <exit>
+    printf(1, "splicetest: pipe to file failed\n");
+    2045:	51                   	push   %ecx
+    2046:	51                   	push   %ecx
+    2047:	68 0c 85 00 00       	push   $0x850c
+    204c:	6a 01                	push   $0x1
+    204e:	e8 1d 44 00 00       	call   6470 <printf>
+    exit();
+    2053:	e8 a8 3e 00 00       	call   5f00 <exit>
+    printf(1, "splicetest: pipe to pipe failed\n");
+    2058:	53                   	push   %ebx
+    2059:	53                   	push   %ebx
+    205a:	68 e8 84 00 00       	push   $0x84e8
+    205f:	6a 01                	push   $0x1
+    2061:	e8 0a 44 00 00       	call   6470 <printf>
+    exit();
+    2066:	e8 95 3e 00 00       	call   5f00 <exit>
+    printf(1, "splicetest: file to pipe failed\n");
+    206b:	50                   	push   %eax
+    206c:	50                   	push   %eax
+    206d:	68 c4 84 00 00       	push   $0x84c4
+    2072:	6a 01                	push   $0x1
+    2074:	e8 f7 43 00 00       	call   6470 <printf>
+    exit();
+    2079:	e8 82 3e 00 00       	call   5f00 <exit>
+    printf(1, "pipe() failed\n");
+    207e:	50                   	push   %eax
+    207f:	50                   	push   %eax
+    2080:	68 61 71 00 00       	push   $0x7161
+    2085:	6a 01                	push   $0x1
+    2087:	e8 e4 43 00 00       	call   6470 <printf>
+    exit();
+    208c:	e8 6f 3e 00 00       	call   5f00 <exit>
+    printf(1, "splicetest: create failed\n");
+    2091:	50                   	push   %eax
+    2092:	50                   	push   %eax
+    2093:	68 34 72 00 00       	push   $0x7234
+    2098:	6a 01                	push   $0x1
+    209a:	e8 d1 43 00 00       	call   6470 <printf>
+    exit();
+    209f:	e8 5c 3e 00 00       	call   5f00 <exit>
+    20a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20af:	90                   	nop
+
+000020b0 <sendfiletest>:
+{
+    20b0:	55                   	push   %ebp
+  for(i = 0; i < 5000; i++)
+    20b1:	31 c0                	xor    %eax,%eax
+{
+    20b3:	89 e5                	mov    %esp,%ebp
+    20b5:	56                   	push   %esi
+    20b6:	53                   	push   %ebx
+    20b7:	83 ec 10             	sub    $0x10,%esp
+    20ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    buf[i] = i;
+    20c0:	88 80 c0 cc 00 00    	mov    %al,0xccc0(%eax)
+  for(i = 0; i < 5000; i++)
+    20c6:	83 c0 01             	add    $0x1,%eax
+    20c9:	3d 88 13 00 00       	cmp    $0x1388,%eax
+    20ce:	75 f0                	jne    20c0 <sendfiletest+0x10>
+  in = open("sendfile0", O_CREATE|O_RDWR);
+    20d0:	83 ec 08             	sub    $0x8,%esp
+    20d3:	68 02 02 00 00       	push   $0x202
+    20d8:	68 96 72 00 00       	push   $0x7296
+    20dd:	e8 e9 3e 00 00       	call   5fcb <open>
+  if(in < 0 || write(in, buf, 5000) != 5000){
+    20e2:	83 c4 10             	add    $0x10,%esp
+  in = open("sendfile0", O_CREATE|O_RDWR);
+    20e5:	89 c3                	mov    %eax,%ebx
+  if(in < 0 || write(in, buf, 5000) != 5000){
+    20e7:	85 c0                	test   %eax,%eax
+    20e9:	0f 88 09 02 00 00    	js     22f8 <sendfiletest+0x248>
+    20ef:	83 ec 04             	sub    $0x4,%esp
+    20f2:	68 88 13 00 00       	push   $0x1388
+    20f7:	68 c0 cc 00 00       	push   $0xccc0
+    20fc:	50                   	push   %eax
+    20fd:	e8 8d 3e 00 00       	call   5f8f <write>
+    2102:	83 c4 10             	add    $0x10,%esp
+    2105:	3d 88 13 00 00       	cmp    $0x1388,%eax
+    210a:	0f 85 e8 01 00 00    	jne    22f8 <sendfiletest+0x248>
+  out = open("sendfile1", O_CREATE|O_RDWR);
+    2110:	83 ec 08             	sub    $0x8,%esp
+    2113:	68 02 02 00 00       	push   $0x202
+    2118:	68 bd 72 00 00       	push   $0x72bd
+    211d:	e8 a9 3e 00 00       	call   5fcb <open>
+  if(sendfile(out, in, 100, 10000) != 4900 ||
+    2122:	68 10 27 00 00       	push   $0x2710
+    2127:	6a 64                	push   $0x64
+  out = open("sendfile1", O_CREATE|O_RDWR);
+    2129:	89 c6                	mov    %eax,%esi
+  if(sendfile(out, in, 100, 10000) != 4900 ||
+    212b:	53                   	push   %ebx
+    212c:	50                   	push   %eax
+    212d:	e8 98 3f 00 00       	call   60ca <sendfile>
+    2132:	83 c4 20             	add    $0x20,%esp
+    2135:	3d 24 13 00 00       	cmp    $0x1324,%eax
+    213a:	0f 85 a4 01 00 00    	jne    22e4 <sendfiletest+0x234>
+     sendfile(out, in, 5000, 10) != 0 || sendfile(in, in, -1, 10) != -1){
+    2140:	6a 0a                	push   $0xa
+    2142:	68 88 13 00 00       	push   $0x1388
+    2147:	53                   	push   %ebx
+    2148:	56                   	push   %esi
+    2149:	e8 7c 3f 00 00       	call   60ca <sendfile>
+  if(sendfile(out, in, 100, 10000) != 4900 ||
+    214e:	83 c4 10             	add    $0x10,%esp
+    2151:	85 c0                	test   %eax,%eax
+    2153:	0f 85 8b 01 00 00    	jne    22e4 <sendfiletest+0x234>
+     sendfile(out, in, 5000, 10) != 0 || sendfile(in, in, -1, 10) != -1){
+    2159:	6a 0a                	push   $0xa
+    215b:	6a ff                	push   $0xffffffff
+    215d:	53                   	push   %ebx
+    215e:	53                   	push   %ebx
+    215f:	e8 66 3f 00 00       	call   60ca <sendfile>
+    2164:	83 c4 10             	add    $0x10,%esp
+    2167:	83 f8 ff             	cmp    $0xffffffff,%eax
+    216a:	0f 85 74 01 00 00    	jne    22e4 <sendfiletest+0x234>
+  close(out);
+    2170:	83 ec 0c             	sub    $0xc,%esp
+    2173:	56                   	push   %esi
+    2174:	e8 25 3e 00 00       	call   5f9e <close>
+  memset(buf, 0, 5000);
+    2179:	83 c4 0c             	add    $0xc,%esp
+    217c:	68 88 13 00 00       	push   $0x1388
+    2181:	6a 00                	push   $0x0
+    2183:	68 c0 cc 00 00       	push   $0xccc0
+    2188:	e8 53 3b 00 00       	call   5ce0 <memset>
+  out = open("sendfile1", O_RDONLY);
+    218d:	58                   	pop    %eax
+    218e:	5a                   	pop    %edx
+    218f:	6a 00                	push   $0x0
+    2191:	68 bd 72 00 00       	push   $0x72bd
+    2196:	e8 30 3e 00 00       	call   5fcb <open>
+  if(read(out, buf, sizeof(buf)) != 4900){
+    219b:	83 c4 0c             	add    $0xc,%esp
+    219e:	68 00 20 00 00       	push   $0x2000
+  out = open("sendfile1", O_RDONLY);
+    21a3:	89 c6                	mov    %eax,%esi
+  if(read(out, buf, sizeof(buf)) != 4900){
+    21a5:	68 c0 cc 00 00       	push   $0xccc0
+    21aa:	50                   	push   %eax
+    21ab:	e8 d0 3d 00 00       	call   5f80 <read>
+    21b0:	83 c4 10             	add    $0x10,%esp
+    21b3:	3d 24 13 00 00       	cmp    $0x1324,%eax
+    21b8:	0f 85 13 01 00 00    	jne    22d1 <sendfiletest+0x221>
+  close(out);
+    21be:	83 ec 0c             	sub    $0xc,%esp
+    21c1:	56                   	push   %esi
+    21c2:	e8 d7 3d 00 00       	call   5f9e <close>
+    if((buf[i] & 0xff) != ((i+100) & 0xff)){
+    21c7:	83 c4 10             	add    $0x10,%esp
+    21ca:	80 3d c0 cc 00 00 64 	cmpb   $0x64,0xccc0
+    21d1:	0f 85 e6 00 00 00    	jne    22bd <sendfiletest+0x20d>
+    21d7:	b8 65 00 00 00       	mov    $0x65,%eax
+    21dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21e0:	0f b6 90 5c cc 00 00 	movzbl 0xcc5c(%eax),%edx
+    21e7:	31 c2                	xor    %eax,%edx
+    21e9:	83 c0 01             	add    $0x1,%eax
+    21ec:	84 d2                	test   %dl,%dl
+    21ee:	0f 85 c9 00 00 00    	jne    22bd <sendfiletest+0x20d>
+  for(i = 0; i < 4900; i++)
+    21f4:	3d 88 13 00 00       	cmp    $0x1388,%eax
+    21f9:	75 e5                	jne    21e0 <sendfiletest+0x130>
+  close(in);
+    21fb:	83 ec 0c             	sub    $0xc,%esp
+    21fe:	53                   	push   %ebx
+    21ff:	e8 9a 3d 00 00       	call   5f9e <close>
+  in = open("sendfile0", O_RDONLY);
+    2204:	5e                   	pop    %esi
+    2205:	58                   	pop    %eax
+    2206:	6a 00                	push   $0x0
+    2208:	68 96 72 00 00       	push   $0x7296
+    220d:	e8 b9 3d 00 00       	call   5fcb <open>
+    2212:	89 c3                	mov    %eax,%ebx
+  if(pipe(fds) != 0){
+    2214:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    2217:	89 04 24             	mov    %eax,(%esp)
+    221a:	e8 52 3d 00 00       	call   5f71 <pipe>
+    221f:	83 c4 10             	add    $0x10,%esp
+    2222:	85 c0                	test   %eax,%eax
+    2224:	0f 85 f5 00 00 00    	jne    231f <sendfiletest+0x26f>
+  if(sendfile(fds[1], in, -1, 3000) != 3000 ||
+    222a:	68 b8 0b 00 00       	push   $0xbb8
+    222f:	6a ff                	push   $0xffffffff
+    2231:	53                   	push   %ebx
+    2232:	ff 75 f4             	push   -0xc(%ebp)
+    2235:	e8 90 3e 00 00       	call   60ca <sendfile>
+    223a:	83 c4 10             	add    $0x10,%esp
+    223d:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    2242:	0f 85 c3 00 00 00    	jne    230b <sendfiletest+0x25b>
+     read(in, buf, 1) != 1 || (buf[0] & 0xff) != (3000 & 0xff)){
+    2248:	83 ec 04             	sub    $0x4,%esp
+    224b:	6a 01                	push   $0x1
+    224d:	68 c0 cc 00 00       	push   $0xccc0
+    2252:	53                   	push   %ebx
+    2253:	e8 28 3d 00 00       	call   5f80 <read>
+  if(sendfile(fds[1], in, -1, 3000) != 3000 ||
+    2258:	83 c4 10             	add    $0x10,%esp
+    225b:	83 f8 01             	cmp    $0x1,%eax
+    225e:	0f 85 a7 00 00 00    	jne    230b <sendfiletest+0x25b>
+     read(in, buf, 1) != 1 || (buf[0] & 0xff) != (3000 & 0xff)){
+    2264:	80 3d c0 cc 00 00 b8 	cmpb   $0xb8,0xccc0
+    226b:	0f 85 9a 00 00 00    	jne    230b <sendfiletest+0x25b>
+  close(fds[0]);
+    2271:	83 ec 0c             	sub    $0xc,%esp
+    2274:	ff 75 f0             	push   -0x10(%ebp)
+    2277:	e8 22 3d 00 00       	call   5f9e <close>
+  close(fds[1]);
+    227c:	58                   	pop    %eax
+    227d:	ff 75 f4             	push   -0xc(%ebp)
+    2280:	e8 19 3d 00 00       	call   5f9e <close>
+  close(in);
+    2285:	89 1c 24             	mov    %ebx,(%esp)
+    2288:	e8 11 3d 00 00       	call   5f9e <close>
+  unlink("sendfile0");
+    228d:	c7 04 24 96 72 00 00 	movl   $0x7296,(%esp)
+    2294:	e8 50 3d 00 00       	call   5fe9 <unlink>
+  unlink("sendfile1");
+    2299:	c7 04 24 bd 72 00 00 	movl   $0x72bd,(%esp)
+    22a0:	e8 44 3d 00 00       	call   5fe9 <unlink>
+  printf(1, "sendfiletest ok\n");
+    22a5:	5a                   	pop    %edx
+    22a6:	59                   	pop    %ecx
+    22a7:	68 fb 72 00 00       	push   $0x72fb
+    22ac:	6a 01                	push   $0x1
+    22ae:	e8 bd 41 00 00       	call   6470 <printf>
+}
+    22b3:	83 c4 10             	add    $0x10,%esp
+    22b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    22b9:	5b                   	pop    %ebx
+    22ba:	5e                   	pop    %esi
+    22bb:	5d                   	pop    %ebp
+    22bc:	c3                   	ret
+      printf(1, "sendfiletest: wrong data\n");
+    22bd:	83 ec 08             	sub    $0x8,%esp
+    22c0:	68 e1 72 00 00       	push   $0x72e1
+    22c5:	6a 01                	push   $0x1
+    22c7:	e8 a4 41 00 00       	call   6470 <printf>
+      exit();
+    22cc:	e8 2f 3c 00 00       	call   5f00 <exit>
+    printf(1, "sendfiletest: short file\n");
+    22d1:	50                   	push   %eax
+    22d2:	50                   	push   %eax
+    22d3:	68 c7 72 00 00       	push   $0x72c7
+    22d8:	6a 01                	push   $0x1
+    22da:	e8 91 41 00 00       	call   6470 <printf>
+    exit();
+    22df:	e8 1c 3c 00 00       	call   5f00 <exit>
+    printf(1, "sendfiletest: file to file failed\n");
+    22e4:	83 ec 08             	sub    $0x8,%esp
+    22e7:	68 30 85 00 00       	push   $0x8530
+    22ec:	6a 01                	push   $0x1
+    22ee:	e8 7d 41 00 00       	call   6470 <printf>
+    exit();
+    22f3:	e8 08 3c 00 00       	call   5f00 <exit>
+    printf(1, "sendfiletest: create failed\n");
+    22f8:	51                   	push   %ecx
+    22f9:	51                   	push   %ecx
+    22fa:	68 a0 72 00 00       	push   $0x72a0
+    22ff:	6a 01                	push   $0x1
+    2301:	e8 6a 41 00 00       	call   6470 <printf>
+    exit();
+    2306:	e8 f5 3b 00 00       	call   5f00 <exit>
+    printf(1, "sendfiletest: file to pipe failed\n");
+    230b:	83 ec 08             	sub    $0x8,%esp
+    230e:	68 54 85 00 00       	push   $0x8554
+    2313:	6a 01                	push   $0x1
+    2315:	e8 56 41 00 00       	call   6470 <printf>
+    exit();
+    231a:	e8 e1 3b 00 00       	call   5f00 <exit>
+    printf(1, "pipe() failed\n");
+    231f:	53                   	push   %ebx
+    2320:	53                   	push   %ebx
+    2321:	68 61 71 00 00       	push   $0x7161
+    2326:	6a 01                	push   $0x1
+    2328:	e8 43 41 00 00       	call   6470 <printf>
+    exit();
+    232d:	e8 ce 3b 00 00       	call   5f00 <exit>
+    2332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002340 <vectorio>:
+{
+    2340:	55                   	push   %ebp
+  for(i = 0; i < 3000; i++)
+    2341:	31 c9                	xor    %ecx,%ecx
+{
+    2343:	89 e5                	mov    %esp,%ebp
+    2345:	57                   	push   %edi
+    2346:	56                   	push   %esi
+    2347:	53                   	push   %ebx
+    buf[i] = 'a' + i % 26;
+    2348:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+{
+    234d:	83 ec 3c             	sub    $0x3c,%esp
+    buf[i] = 'a' + i % 26;
+    2350:	89 c8                	mov    %ecx,%eax
+    2352:	f7 e3                	mul    %ebx
+    2354:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < 3000; i++)
+    2356:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+    2359:	c1 ea 03             	shr    $0x3,%edx
+    235c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    235f:	29 d0                	sub    %edx,%eax
+    2361:	83 c0 61             	add    $0x61,%eax
+    2364:	88 81 bf cc 00 00    	mov    %al,0xccbf(%ecx)
+  for(i = 0; i < 3000; i++)
+    236a:	81 f9 b8 0b 00 00    	cmp    $0xbb8,%ecx
+    2370:	75 de                	jne    2350 <vectorio+0x10>
+  fd = open("vectorio", O_CREATE|O_RDWR);
+    2372:	83 ec 08             	sub    $0x8,%esp
+    2375:	68 02 02 00 00       	push   $0x202
+    237a:	68 0c 73 00 00       	push   $0x730c
+    237f:	e8 47 3c 00 00       	call   5fcb <open>
+  iov[0].iov_base = buf;
+    2384:	c7 45 d0 c0 cc 00 00 	movl   $0xccc0,-0x30(%ebp)
+  if(fd < 0 || writev(fd, iov, 3) != 3000){
+    238b:	83 c4 10             	add    $0x10,%esp
+  iov[0].iov_len = 10;
+    238e:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%ebp)
+  fd = open("vectorio", O_CREATE|O_RDWR);
+    2395:	89 c3                	mov    %eax,%ebx
+  iov[1].iov_base = buf + 10;
+    2397:	c7 45 d8 ca cc 00 00 	movl   $0xccca,-0x28(%ebp)
+  iov[1].iov_len = 0;
+    239e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  iov[2].iov_base = buf + 10;
+    23a5:	c7 45 e0 ca cc 00 00 	movl   $0xccca,-0x20(%ebp)
+  iov[2].iov_len = 2990;
+    23ac:	c7 45 e4 ae 0b 00 00 	movl   $0xbae,-0x1c(%ebp)
+  if(fd < 0 || writev(fd, iov, 3) != 3000){
+    23b3:	85 c0                	test   %eax,%eax
+    23b5:	0f 88 93 01 00 00    	js     254e <vectorio+0x20e>
+    23bb:	83 ec 04             	sub    $0x4,%esp
+    23be:	8d 7d d0             	lea    -0x30(%ebp),%edi
+    23c1:	6a 03                	push   $0x3
+    23c3:	57                   	push   %edi
+    23c4:	50                   	push   %eax
+    23c5:	e8 4b 3d 00 00       	call   6115 <writev>
+    23ca:	83 c4 10             	add    $0x10,%esp
+    23cd:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    23d2:	0f 85 76 01 00 00    	jne    254e <vectorio+0x20e>
+  if(lseek(fd, 0, SEEK_END) != 3000 || lseek(fd, 1, SEEK_END) != -1 ||
+    23d8:	83 ec 04             	sub    $0x4,%esp
+    23db:	6a 02                	push   $0x2
+    23dd:	6a 00                	push   $0x0
+    23df:	53                   	push   %ebx
+    23e0:	e8 f4 3c 00 00       	call   60d9 <lseek>
+    23e5:	83 c4 10             	add    $0x10,%esp
+    23e8:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    23ed:	0f 85 a9 01 00 00    	jne    259c <vectorio+0x25c>
+    23f3:	83 ec 04             	sub    $0x4,%esp
+    23f6:	6a 02                	push   $0x2
+    23f8:	6a 01                	push   $0x1
+    23fa:	53                   	push   %ebx
+    23fb:	e8 d9 3c 00 00       	call   60d9 <lseek>
+    2400:	83 c4 10             	add    $0x10,%esp
+    2403:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2406:	0f 85 90 01 00 00    	jne    259c <vectorio+0x25c>
+     lseek(fd, -2990, SEEK_CUR) != 10){
+    240c:	83 ec 04             	sub    $0x4,%esp
+    240f:	6a 01                	push   $0x1
+    2411:	68 52 f4 ff ff       	push   $0xfffff452
+    2416:	53                   	push   %ebx
+    2417:	e8 bd 3c 00 00       	call   60d9 <lseek>
+  if(lseek(fd, 0, SEEK_END) != 3000 || lseek(fd, 1, SEEK_END) != -1 ||
+    241c:	83 c4 10             	add    $0x10,%esp
+    241f:	83 f8 0a             	cmp    $0xa,%eax
+    2422:	0f 85 74 01 00 00    	jne    259c <vectorio+0x25c>
+  if(readv(fd, iov, 2) != 20 || memcmp(a, buf + 10, 10) != 0 ||
+    2428:	83 ec 04             	sub    $0x4,%esp
+  iov[1].iov_base = b;
+    242b:	8d 45 c6             	lea    -0x3a(%ebp),%eax
+  iov[0].iov_base = a;
+    242e:	8d 75 bc             	lea    -0x44(%ebp),%esi
+  iov[0].iov_len = 10;
+    2431:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%ebp)
+  iov[0].iov_base = a;
+    2438:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  iov[1].iov_base = b;
+    243b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  iov[1].iov_len = 10;
+    243e:	c7 45 dc 0a 00 00 00 	movl   $0xa,-0x24(%ebp)
+  if(readv(fd, iov, 2) != 20 || memcmp(a, buf + 10, 10) != 0 ||
+    2445:	6a 02                	push   $0x2
+    2447:	57                   	push   %edi
+    2448:	53                   	push   %ebx
+    2449:	e8 b8 3c 00 00       	call   6106 <readv>
+    244e:	83 c4 10             	add    $0x10,%esp
+    2451:	83 f8 14             	cmp    $0x14,%eax
+    2454:	0f 85 2e 01 00 00    	jne    2588 <vectorio+0x248>
+    245a:	83 ec 04             	sub    $0x4,%esp
+    245d:	6a 0a                	push   $0xa
+    245f:	68 ca cc 00 00       	push   $0xccca
+    2464:	56                   	push   %esi
+    2465:	e8 f6 39 00 00       	call   5e60 <memcmp>
+    246a:	83 c4 10             	add    $0x10,%esp
+    246d:	85 c0                	test   %eax,%eax
+    246f:	0f 85 13 01 00 00    	jne    2588 <vectorio+0x248>
+     memcmp(b, buf + 20, 10) != 0){
+    2475:	83 ec 04             	sub    $0x4,%esp
+    2478:	8d 45 c6             	lea    -0x3a(%ebp),%eax
+    247b:	6a 0a                	push   $0xa
+    247d:	68 d4 cc 00 00       	push   $0xccd4
+    2482:	50                   	push   %eax
+    2483:	e8 d8 39 00 00       	call   5e60 <memcmp>
+  if(readv(fd, iov, 2) != 20 || memcmp(a, buf + 10, 10) != 0 ||
+    2488:	83 c4 10             	add    $0x10,%esp
+    248b:	85 c0                	test   %eax,%eax
+    248d:	0f 85 f5 00 00 00    	jne    2588 <vectorio+0x248>
+  if(pwrite(fd, "XYZ", 3, 2998) != 3 || pread(fd, a, 10, 2995) != 6 ||
+    2493:	68 b6 0b 00 00       	push   $0xbb6
+    2498:	6a 03                	push   $0x3
+    249a:	68 5e 73 00 00       	push   $0x735e
+    249f:	53                   	push   %ebx
+    24a0:	e8 52 3c 00 00       	call   60f7 <pwrite>
+    24a5:	83 c4 10             	add    $0x10,%esp
+    24a8:	83 f8 03             	cmp    $0x3,%eax
+    24ab:	0f 85 c3 00 00 00    	jne    2574 <vectorio+0x234>
+    24b1:	68 b3 0b 00 00       	push   $0xbb3
+    24b6:	6a 0a                	push   $0xa
+    24b8:	56                   	push   %esi
+    24b9:	53                   	push   %ebx
+    24ba:	e8 29 3c 00 00       	call   60e8 <pread>
+    24bf:	83 c4 10             	add    $0x10,%esp
+    24c2:	83 f8 06             	cmp    $0x6,%eax
+    24c5:	0f 85 a9 00 00 00    	jne    2574 <vectorio+0x234>
+     memcmp(a, buf + 2995, 3) != 0 || memcmp(a + 3, "XYZ", 3) != 0){
+    24cb:	83 ec 04             	sub    $0x4,%esp
+    24ce:	6a 03                	push   $0x3
+    24d0:	68 73 d8 00 00       	push   $0xd873
+    24d5:	56                   	push   %esi
+    24d6:	e8 85 39 00 00       	call   5e60 <memcmp>
+  if(pwrite(fd, "XYZ", 3, 2998) != 3 || pread(fd, a, 10, 2995) != 6 ||
+    24db:	83 c4 10             	add    $0x10,%esp
+    24de:	85 c0                	test   %eax,%eax
+    24e0:	0f 85 8e 00 00 00    	jne    2574 <vectorio+0x234>
+     memcmp(a, buf + 2995, 3) != 0 || memcmp(a + 3, "XYZ", 3) != 0){
+    24e6:	83 ec 04             	sub    $0x4,%esp
+    24e9:	8d 45 bf             	lea    -0x41(%ebp),%eax
+    24ec:	6a 03                	push   $0x3
+    24ee:	68 5e 73 00 00       	push   $0x735e
+    24f3:	50                   	push   %eax
+    24f4:	e8 67 39 00 00       	call   5e60 <memcmp>
+    24f9:	83 c4 10             	add    $0x10,%esp
+    24fc:	85 c0                	test   %eax,%eax
+    24fe:	75 74                	jne    2574 <vectorio+0x234>
+  if(read(fd, a, 1) != 1 || a[0] != buf[30]){
+    2500:	83 ec 04             	sub    $0x4,%esp
+    2503:	6a 01                	push   $0x1
+    2505:	56                   	push   %esi
+    2506:	53                   	push   %ebx
+    2507:	e8 74 3a 00 00       	call   5f80 <read>
+    250c:	83 c4 10             	add    $0x10,%esp
+    250f:	83 f8 01             	cmp    $0x1,%eax
+    2512:	75 4d                	jne    2561 <vectorio+0x221>
+    2514:	0f b6 05 de cc 00 00 	movzbl 0xccde,%eax
+    251b:	38 45 bc             	cmp    %al,-0x44(%ebp)
+    251e:	75 41                	jne    2561 <vectorio+0x221>
+  close(fd);
+    2520:	83 ec 0c             	sub    $0xc,%esp
+    2523:	53                   	push   %ebx
+    2524:	e8 75 3a 00 00       	call   5f9e <close>
+  unlink("vectorio");
+    2529:	c7 04 24 0c 73 00 00 	movl   $0x730c,(%esp)
+    2530:	e8 b4 3a 00 00       	call   5fe9 <unlink>
+  printf(1, "vectorio ok\n");
+    2535:	58                   	pop    %eax
+    2536:	5a                   	pop    %edx
+    2537:	68 7a 73 00 00       	push   $0x737a
+    253c:	6a 01                	push   $0x1
+    253e:	e8 2d 3f 00 00       	call   6470 <printf>
+}
+    2543:	83 c4 10             	add    $0x10,%esp
+    2546:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2549:	5b                   	pop    %ebx
+    254a:	5e                   	pop    %esi
+    254b:	5f                   	pop    %edi
+    254c:	5d                   	pop    %ebp
+    254d:	c3                   	ret
+    printf(1, "vectorio: writev failed\n");
+    254e:	53                   	push   %ebx
+    254f:	53                   	push   %ebx
+    2550:	68 15 73 00 00       	push   $0x7315
+    2555:	6a 01                	push   $0x1
+    2557:	e8 14 3f 00 00       	call   6470 <printf>
+    exit();
+    255c:	e8 9f 39 00 00       	call   5f00 <exit>
+    printf(1, "vectorio: offset moved\n");
+    2561:	51                   	push   %ecx
+    2562:	51                   	push   %ecx
+    2563:	68 62 73 00 00       	push   $0x7362
+    2568:	6a 01                	push   $0x1
+    256a:	e8 01 3f 00 00       	call   6470 <printf>
+    exit();
+    256f:	e8 8c 39 00 00       	call   5f00 <exit>
+    printf(1, "vectorio: pread/pwrite failed\n");
+    2574:	83 ec 08             	sub    $0x8,%esp
+    2577:	68 78 85 00 00       	push   $0x8578
+    257c:	6a 01                	push   $0x1
+    257e:	e8 ed 3e 00 00       	call   6470 <printf>
+    exit();
+    2583:	e8 78 39 00 00       	call   5f00 <exit>
+    printf(1, "vectorio: readv failed\n");
+    2588:	83 ec 08             	sub    $0x8,%esp
+    258b:	68 46 73 00 00       	push   $0x7346
+    2590:	6a 01                	push   $0x1
+    2592:	e8 d9 3e 00 00       	call   6470 <printf>
+    exit();
+    2597:	e8 64 39 00 00       	call   5f00 <exit>
+    printf(1, "vectorio: lseek failed\n");
+    259c:	83 ec 08             	sub    $0x8,%esp
+    259f:	68 2e 73 00 00       	push   $0x732e
+    25a4:	6a 01                	push   $0x1
+    25a6:	e8 c5 3e 00 00       	call   6470 <printf>
+    exit();
+    25ab:	e8 50 39 00 00       	call   5f00 <exit>
+
+000025b0 <ringtest>:
+{
+    25b0:	55                   	push   %ebp
+    25b1:	89 e5                	mov    %esp,%ebp
+    25b3:	56                   	push   %esi
+    25b4:	53                   	push   %ebx
+    25b5:	83 ec 3c             	sub    $0x3c,%esp
+  if(ringenter(1) != -1 || ringsetup(&ring) < 0){
+    25b8:	6a 01                	push   $0x1
+    25ba:	e8 74 3b 00 00       	call   6133 <ringenter>
+    25bf:	83 c4 10             	add    $0x10,%esp
+    25c2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    25c5:	0f 85 08 02 00 00    	jne    27d3 <ringtest+0x223>
+    25cb:	83 ec 0c             	sub    $0xc,%esp
+    25ce:	68 a0 c5 00 00       	push   $0xc5a0
+    25d3:	e8 4c 3b 00 00       	call   6124 <ringsetup>
+    25d8:	83 c4 10             	add    $0x10,%esp
+    25db:	85 c0                	test   %eax,%eax
+    25dd:	0f 88 f0 01 00 00    	js     27d3 <ringtest+0x223>
+  e = &ring.sq[ring.sqtail++ % RINGSIZE];
+    25e3:	a1 a4 c5 00 00       	mov    0xc5a4,%eax
+  if(ringenter(8) != 1 || ring.cqtail != 1 || (fd = ring.cq[0].res) < 0){
+    25e8:	83 ec 0c             	sub    $0xc,%esp
+  e = &ring.sq[ring.sqtail++ % RINGSIZE];
+    25eb:	8d 50 01             	lea    0x1(%eax),%edx
+    25ee:	83 e0 3f             	and    $0x3f,%eax
+  e->op = RING_OPEN;
+    25f1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  e = &ring.sq[ring.sqtail++ % RINGSIZE];
+    25f4:	89 15 a4 c5 00 00    	mov    %edx,0xc5a4
+  e->op = RING_OPEN;
+    25fa:	8d 04 85 a0 c5 00 00 	lea    0xc5a0(,%eax,4),%eax
+    2601:	c7 40 10 03 00 00 00 	movl   $0x3,0x10(%eax)
+  e->buf = "ringtest";
+    2608:	c7 40 18 a3 73 00 00 	movl   $0x73a3,0x18(%eax)
+  e->n = O_CREATE|O_RDWR;
+    260f:	c7 40 1c 02 02 00 00 	movl   $0x202,0x1c(%eax)
+  e->user = 0;
+    2616:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(ringenter(8) != 1 || ring.cqtail != 1 || (fd = ring.cq[0].res) < 0){
+    261d:	6a 08                	push   $0x8
+    261f:	e8 0f 3b 00 00       	call   6133 <ringenter>
+    2624:	83 c4 10             	add    $0x10,%esp
+    2627:	83 f8 01             	cmp    $0x1,%eax
+    262a:	0f 85 8f 01 00 00    	jne    27bf <ringtest+0x20f>
+    2630:	83 3d ac c5 00 00 01 	cmpl   $0x1,0xc5ac
+    2637:	0f 85 82 01 00 00    	jne    27bf <ringtest+0x20f>
+    263d:	8b 35 b4 ca 00 00    	mov    0xcab4,%esi
+    2643:	85 f6                	test   %esi,%esi
+    2645:	0f 88 74 01 00 00    	js     27bf <ringtest+0x20f>
+  ring.cqhead++;
+    264b:	a1 a4 c5 00 00       	mov    0xc5a4,%eax
+  if(ringenter(8) != 3 || ring.sqhead != 4 || ring.cqtail != 4){
+    2650:	83 ec 0c             	sub    $0xc,%esp
+  ring.cqhead++;
+    2653:	83 05 a8 c5 00 00 01 	addl   $0x1,0xc5a8
+  ring.sq[1].op = RING_WRITE;
+    265a:	c7 05 c4 c5 00 00 02 	movl   $0x2,0xc5c4
+    2661:	00 00 00 
+  ring.sq[1].buf = "hello";
+    2664:	c7 05 cc c5 00 00 c3 	movl   $0x73c3,0xc5cc
+    266b:	73 00 00 
+    e = &ring.sq[ring.sqtail++ % RINGSIZE];
+    266e:	89 c2                	mov    %eax,%edx
+  ring.sq[1].n = 5;
+    2670:	c7 05 d0 c5 00 00 05 	movl   $0x5,0xc5d0
+    2677:	00 00 00 
+    e = &ring.sq[ring.sqtail++ % RINGSIZE];
+    267a:	83 e2 3f             	and    $0x3f,%edx
+  ring.sq[2].op = RING_FSTAT;
+    267d:	c7 05 d8 c5 00 00 05 	movl   $0x5,0xc5d8
+    2684:	00 00 00 
+    e->fd = fd;
+    2687:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    268a:	8d 14 95 a0 c5 00 00 	lea    0xc5a0(,%edx,4),%edx
+  ring.sq[3].op = 99;
+    2691:	c7 05 ec c5 00 00 63 	movl   $0x63,0xc5ec
+    2698:	00 00 00 
+    e->fd = fd;
+    269b:	89 72 14             	mov    %esi,0x14(%edx)
+    e->user = i;
+    269e:	c7 42 20 00 00 00 00 	movl   $0x0,0x20(%edx)
+    e = &ring.sq[ring.sqtail++ % RINGSIZE];
+    26a5:	8d 50 01             	lea    0x1(%eax),%edx
+    26a8:	83 e2 3f             	and    $0x3f,%edx
+    e->fd = fd;
+    26ab:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    26ae:	8d 14 95 a0 c5 00 00 	lea    0xc5a0(,%edx,4),%edx
+    26b5:	89 72 14             	mov    %esi,0x14(%edx)
+    e->user = i;
+    26b8:	c7 42 20 01 00 00 00 	movl   $0x1,0x20(%edx)
+    e = &ring.sq[ring.sqtail++ % RINGSIZE];
+    26bf:	8d 50 02             	lea    0x2(%eax),%edx
+    26c2:	83 c0 03             	add    $0x3,%eax
+    26c5:	83 e2 3f             	and    $0x3f,%edx
+    26c8:	a3 a4 c5 00 00       	mov    %eax,0xc5a4
+  ring.sq[2].buf = &st;
+    26cd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    e->fd = fd;
+    26d0:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  ring.sq[2].buf = &st;
+    26d3:	a3 e0 c5 00 00       	mov    %eax,0xc5e0
+    e->fd = fd;
+    26d8:	8d 14 95 a0 c5 00 00 	lea    0xc5a0(,%edx,4),%edx
+    26df:	89 72 14             	mov    %esi,0x14(%edx)
+    e->user = i;
+    26e2:	c7 42 20 02 00 00 00 	movl   $0x2,0x20(%edx)
+  if(ringenter(8) != 3 || ring.sqhead != 4 || ring.cqtail != 4){
+    26e9:	6a 08                	push   $0x8
+    26eb:	e8 43 3a 00 00       	call   6133 <ringenter>
+    26f0:	83 c4 10             	add    $0x10,%esp
+    26f3:	83 f8 03             	cmp    $0x3,%eax
+    26f6:	0f 85 af 00 00 00    	jne    27ab <ringtest+0x1fb>
+    26fc:	83 3d a0 c5 00 00 04 	cmpl   $0x4,0xc5a0
+    2703:	0f 85 a2 00 00 00    	jne    27ab <ringtest+0x1fb>
+    2709:	83 3d ac c5 00 00 04 	cmpl   $0x4,0xc5ac
+    2710:	0f 85 95 00 00 00    	jne    27ab <ringtest+0x1fb>
+  for(; ring.cqhead != ring.cqtail; ring.cqhead++)
+    2716:	8b 15 a8 c5 00 00    	mov    0xc5a8,%edx
+    271c:	bb c0 c5 00 00       	mov    $0xc5c0,%ebx
+    2721:	8d 04 d5 a0 c5 00 00 	lea    0xc5a0(,%edx,8),%eax
+    2728:	83 fa 04             	cmp    $0x4,%edx
+    272b:	74 24                	je     2751 <ringtest+0x1a1>
+    272d:	8d 76 00             	lea    0x0(%esi),%esi
+    res[ring.cq[ring.cqhead].user] = ring.cq[ring.cqhead].res;
+    2730:	8b 90 10 05 00 00    	mov    0x510(%eax),%edx
+    2736:	8b 88 14 05 00 00    	mov    0x514(%eax),%ecx
+  for(; ring.cqhead != ring.cqtail; ring.cqhead++)
+    273c:	83 c0 08             	add    $0x8,%eax
+    res[ring.cq[ring.cqhead].user] = ring.cq[ring.cqhead].res;
+    273f:	89 4c 95 d4          	mov    %ecx,-0x2c(%ebp,%edx,4)
+  for(; ring.cqhead != ring.cqtail; ring.cqhead++)
+    2743:	39 c3                	cmp    %eax,%ebx
+    2745:	75 e9                	jne    2730 <ringtest+0x180>
+    2747:	c7 05 a8 c5 00 00 04 	movl   $0x4,0xc5a8
+    274e:	00 00 00 
+  if(res[0] != 5 || res[1] != 0 || st.size != 5 || res[2] != -1){
+    2751:	83 7d d4 05          	cmpl   $0x5,-0x2c(%ebp)
+    2755:	75 40                	jne    2797 <ringtest+0x1e7>
+    2757:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    275a:	85 c9                	test   %ecx,%ecx
+    275c:	75 39                	jne    2797 <ringtest+0x1e7>
+    275e:	83 7d f4 05          	cmpl   $0x5,-0xc(%ebp)
+    2762:	75 33                	jne    2797 <ringtest+0x1e7>
+    2764:	83 7d dc ff          	cmpl   $0xffffffff,-0x24(%ebp)
+    2768:	75 2d                	jne    2797 <ringtest+0x1e7>
+  close(fd);
+    276a:	83 ec 0c             	sub    $0xc,%esp
+    276d:	56                   	push   %esi
+    276e:	e8 2b 38 00 00       	call   5f9e <close>
+  unlink("ringtest");
+    2773:	c7 04 24 a3 73 00 00 	movl   $0x73a3,(%esp)
+    277a:	e8 6a 38 00 00       	call   5fe9 <unlink>
+  printf(1, "ringtest ok\n");
+    277f:	58                   	pop    %eax
+    2780:	5a                   	pop    %edx
+    2781:	68 fe 73 00 00       	push   $0x73fe
+    2786:	6a 01                	push   $0x1
+    2788:	e8 e3 3c 00 00       	call   6470 <printf>
+}
+    278d:	83 c4 10             	add    $0x10,%esp
+    2790:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2793:	5b                   	pop    %ebx
+    2794:	5e                   	pop    %esi
+    2795:	5d                   	pop    %ebp
+    2796:	c3                   	ret
+    printf(1, "ringtest: wrong results\n");
+    2797:	83 ec 08             	sub    $0x8,%esp
+    279a:	68 e5 73 00 00       	push   $0x73e5
+    279f:	6a 01                	push   $0x1
+    27a1:	e8 ca 3c 00 00       	call   6470 <printf>
+    exit();
+    27a6:	e8 55 37 00 00       	call   5f00 <exit>
+    printf(1, "ringtest: ringenter failed\n");
+    27ab:	83 ec 08             	sub    $0x8,%esp
+    27ae:	68 c9 73 00 00       	push   $0x73c9
+    27b3:	6a 01                	push   $0x1
+    27b5:	e8 b6 3c 00 00       	call   6470 <printf>
+    exit();
+    27ba:	e8 41 37 00 00       	call   5f00 <exit>
+    printf(1, "ringtest: open failed\n");
+    27bf:	83 ec 08             	sub    $0x8,%esp
+    27c2:	68 ac 73 00 00       	push   $0x73ac
+    27c7:	6a 01                	push   $0x1
+    27c9:	e8 a2 3c 00 00       	call   6470 <printf>
+    exit();
+    27ce:	e8 2d 37 00 00       	call   5f00 <exit>
+    printf(1, "ringtest: ringsetup failed\n");
+    27d3:	53                   	push   %ebx
+    27d4:	53                   	push   %ebx
+    27d5:	68 87 73 00 00       	push   $0x7387
+    27da:	6a 01                	push   $0x1
+    27dc:	e8 8f 3c 00 00       	call   6470 <printf>
+    exit();
+    27e1:	e8 1a 37 00 00       	call   5f00 <exit>
+    27e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000027f0 <upagetest>:
+{
+    27f0:	55                   	push   %ebp
+    27f1:	89 e5                	mov    %esp,%ebp
+    27f3:	56                   	push   %esi
+    27f4:	53                   	push   %ebx
+  pid = fork();
+    27f5:	e8 d6 36 00 00       	call   5ed0 <fork>
+  if(pid == 0){
+    27fa:	85 c0                	test   %eax,%eax
+    27fc:	74 42                	je     2840 <upagetest+0x50>
+  if(pid < 0 || ugetpid() != getpid() || wait() != pid){
+    27fe:	0f 88 9a 00 00 00    	js     289e <upagetest+0xae>
+    2804:	89 c3                	mov    %eax,%ebx
+    2806:	e8 a5 36 00 00       	call   5eb0 <ugetpid>
+    280b:	89 c6                	mov    %eax,%esi
+    280d:	e8 31 38 00 00       	call   6043 <getpid>
+    2812:	39 c6                	cmp    %eax,%esi
+    2814:	0f 85 84 00 00 00    	jne    289e <upagetest+0xae>
+    281a:	e8 43 37 00 00       	call   5f62 <wait>
+    281f:	39 d8                	cmp    %ebx,%eax
+    2821:	75 7b                	jne    289e <upagetest+0xae>
+  printf(1, "upagetest ok\n");
+    2823:	83 ec 08             	sub    $0x8,%esp
+    2826:	68 63 74 00 00       	push   $0x7463
+    282b:	6a 01                	push   $0x1
+    282d:	e8 3e 3c 00 00       	call   6470 <printf>
+}
+    2832:	83 c4 10             	add    $0x10,%esp
+    2835:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2838:	5b                   	pop    %ebx
+    2839:	5e                   	pop    %esi
+    283a:	5d                   	pop    %ebp
+    283b:	c3                   	ret
+    283c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(ugetpid() != getpid()){
+    2840:	e8 6b 36 00 00       	call   5eb0 <ugetpid>
+    2845:	89 c3                	mov    %eax,%ebx
+    2847:	e8 f7 37 00 00       	call   6043 <getpid>
+    284c:	39 c3                	cmp    %eax,%ebx
+    284e:	75 61                	jne    28b1 <upagetest+0xc1>
+    t = uptime();
+    2850:	e8 1b 38 00 00       	call   6070 <uptime>
+    2855:	89 c3                	mov    %eax,%ebx
+    if(uuptime() < t || uuptime() > t + 1){
+    2857:	e8 64 36 00 00       	call   5ec0 <uuptime>
+    285c:	39 d8                	cmp    %ebx,%eax
+    285e:	72 0c                	jb     286c <upagetest+0x7c>
+    2860:	e8 5b 36 00 00       	call   5ec0 <uuptime>
+    2865:	83 c3 01             	add    $0x1,%ebx
+    2868:	39 c3                	cmp    %eax,%ebx
+    286a:	73 14                	jae    2880 <upagetest+0x90>
+      printf(1, "upagetest: wrong ticks\n");
+    286c:	83 ec 08             	sub    $0x8,%esp
+    286f:	68 21 74 00 00       	push   $0x7421
+    2874:	6a 01                	push   $0x1
+    2876:	e8 f5 3b 00 00       	call   6470 <printf>
+      exit();
+    287b:	e8 80 36 00 00       	call   5f00 <exit>
+    ((struct uproc*)UPROC)->pid = 0;
+    2880:	c7 05 00 e0 ff 7f 00 	movl   $0x0,0x7fffe000
+    2887:	00 00 00 
+    printf(1, "upagetest: wrote UPROC\n");
+    288a:	83 ec 08             	sub    $0x8,%esp
+    288d:	68 39 74 00 00       	push   $0x7439
+    2892:	6a 01                	push   $0x1
+    2894:	e8 d7 3b 00 00       	call   6470 <printf>
+    exit();
+    2899:	e8 62 36 00 00       	call   5f00 <exit>
+    printf(1, "upagetest failed\n");
+    289e:	50                   	push   %eax
+    289f:	50                   	push   %eax
+    28a0:	68 51 74 00 00       	push   $0x7451
+    28a5:	6a 01                	push   $0x1
+    28a7:	e8 c4 3b 00 00       	call   6470 <printf>
+    exit();
+    28ac:	e8 4f 36 00 00       	call   5f00 <exit>
+      printf(1, "upagetest: wrong pid\n");
+    28b1:	52                   	push   %edx
+    28b2:	52                   	push   %edx
+    28b3:	68 0b 74 00 00       	push   $0x740b
+    28b8:	6a 01                	push   $0x1
+    28ba:	e8 b1 3b 00 00       	call   6470 <printf>
+      exit();
+    28bf:	e8 3c 36 00 00       	call   5f00 <exit>
+    28c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    28cf:	90                   	nop
+
+000028d0 <rocopyout>:
+{
+    28d0:	55                   	push   %ebp
+    28d1:	89 e5                	mov    %esp,%ebp
+    28d3:	53                   	push   %ebx
+    28d4:	83 ec 20             	sub    $0x20,%esp
+  p = sbrk(2*4096);
+    28d7:	68 00 20 00 00       	push   $0x2000
+    28dc:	e8 71 37 00 00       	call   6052 <sbrk>
+  p = (char*)(((uint)p + 4095) & ~4095);
+    28e1:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+  if(pipe(fds) < 0 || mprotect(p, 1) < 0){
+    28e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    28ea:	89 04 24             	mov    %eax,(%esp)
+  p = (char*)(((uint)p + 4095) & ~4095);
+    28ed:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(pipe(fds) < 0 || mprotect(p, 1) < 0){
+    28f3:	e8 79 36 00 00       	call   5f71 <pipe>
+    28f8:	83 c4 10             	add    $0x10,%esp
+    28fb:	85 c0                	test   %eax,%eax
+    28fd:	0f 88 e8 00 00 00    	js     29eb <rocopyout+0x11b>
+    2903:	83 ec 08             	sub    $0x8,%esp
+    2906:	6a 01                	push   $0x1
+    2908:	53                   	push   %ebx
+    2909:	e8 71 37 00 00       	call   607f <mprotect>
+    290e:	83 c4 10             	add    $0x10,%esp
+    2911:	85 c0                	test   %eax,%eax
+    2913:	0f 88 d2 00 00 00    	js     29eb <rocopyout+0x11b>
+  write(fds[1], "x", 1);
+    2919:	83 ec 04             	sub    $0x4,%esp
+    291c:	6a 01                	push   $0x1
+    291e:	68 77 7b 00 00       	push   $0x7b77
+    2923:	ff 75 f4             	push   -0xc(%ebp)
+    2926:	e8 64 36 00 00       	call   5f8f <write>
+  if(fstat(0, (struct stat*)p) != -1 || pipe((int*)p) != -1 ||
+    292b:	58                   	pop    %eax
+    292c:	5a                   	pop    %edx
+    292d:	53                   	push   %ebx
+    292e:	6a 00                	push   $0x0
+    2930:	e8 c3 36 00 00       	call   5ff8 <fstat>
+    2935:	83 c4 10             	add    $0x10,%esp
+    2938:	83 f8 ff             	cmp    $0xffffffff,%eax
+    293b:	0f 85 96 00 00 00    	jne    29d7 <rocopyout+0x107>
+    2941:	83 ec 0c             	sub    $0xc,%esp
+    2944:	53                   	push   %ebx
+    2945:	e8 27 36 00 00       	call   5f71 <pipe>
+    294a:	83 c4 10             	add    $0x10,%esp
+    294d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2950:	0f 85 81 00 00 00    	jne    29d7 <rocopyout+0x107>
+     kstat((struct kstat*)p) != -1 || read(fds[0], p, 1) != -1){
+    2956:	83 ec 0c             	sub    $0xc,%esp
+    2959:	53                   	push   %ebx
+    295a:	e8 3e 37 00 00       	call   609d <kstat>
+  if(fstat(0, (struct stat*)p) != -1 || pipe((int*)p) != -1 ||
+    295f:	83 c4 10             	add    $0x10,%esp
+    2962:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2965:	75 70                	jne    29d7 <rocopyout+0x107>
+     kstat((struct kstat*)p) != -1 || read(fds[0], p, 1) != -1){
+    2967:	83 ec 04             	sub    $0x4,%esp
+    296a:	6a 01                	push   $0x1
+    296c:	53                   	push   %ebx
+    296d:	ff 75 f0             	push   -0x10(%ebp)
+    2970:	e8 0b 36 00 00       	call   5f80 <read>
+    2975:	83 c4 10             	add    $0x10,%esp
+    2978:	83 f8 ff             	cmp    $0xffffffff,%eax
+    297b:	75 5a                	jne    29d7 <rocopyout+0x107>
+  if(munprotect(p, 1) < 0 || fstat(0, (struct stat*)p) < 0){
+    297d:	83 ec 08             	sub    $0x8,%esp
+    2980:	6a 01                	push   $0x1
+    2982:	53                   	push   %ebx
+    2983:	e8 06 37 00 00       	call   608e <munprotect>
+    2988:	83 c4 10             	add    $0x10,%esp
+    298b:	85 c0                	test   %eax,%eax
+    298d:	78 6f                	js     29fe <rocopyout+0x12e>
+    298f:	83 ec 08             	sub    $0x8,%esp
+    2992:	53                   	push   %ebx
+    2993:	6a 00                	push   $0x0
+    2995:	e8 5e 36 00 00       	call   5ff8 <fstat>
+    299a:	83 c4 10             	add    $0x10,%esp
+    299d:	85 c0                	test   %eax,%eax
+    299f:	78 5d                	js     29fe <rocopyout+0x12e>
+  close(fds[0]);
+    29a1:	83 ec 0c             	sub    $0xc,%esp
+    29a4:	ff 75 f0             	push   -0x10(%ebp)
+    29a7:	e8 f2 35 00 00       	call   5f9e <close>
+  close(fds[1]);
+    29ac:	58                   	pop    %eax
+    29ad:	ff 75 f4             	push   -0xc(%ebp)
+    29b0:	e8 e9 35 00 00       	call   5f9e <close>
+  sbrk(-2*4096);
+    29b5:	c7 04 24 00 e0 ff ff 	movl   $0xffffe000,(%esp)
+    29bc:	e8 91 36 00 00       	call   6052 <sbrk>
+  printf(1, "rocopyout ok\n");
+    29c1:	5a                   	pop    %edx
+    29c2:	59                   	pop    %ecx
+    29c3:	68 a8 74 00 00       	push   $0x74a8
+    29c8:	6a 01                	push   $0x1
+    29ca:	e8 a1 3a 00 00       	call   6470 <printf>
+}
+    29cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    29d2:	83 c4 10             	add    $0x10,%esp
+    29d5:	c9                   	leave
+    29d6:	c3                   	ret
+    printf(1, "rocopyout: wrote a read-only page\n");
+    29d7:	83 ec 08             	sub    $0x8,%esp
+    29da:	68 98 85 00 00       	push   $0x8598
+    29df:	6a 01                	push   $0x1
+    29e1:	e8 8a 3a 00 00       	call   6470 <printf>
+    exit();
+    29e6:	e8 15 35 00 00       	call   5f00 <exit>
+    printf(1, "rocopyout: setup failed\n");
+    29eb:	51                   	push   %ecx
+    29ec:	51                   	push   %ecx
+    29ed:	68 71 74 00 00       	push   $0x7471
+    29f2:	6a 01                	push   $0x1
+    29f4:	e8 77 3a 00 00       	call   6470 <printf>
+    exit();
+    29f9:	e8 02 35 00 00       	call   5f00 <exit>
+    printf(1, "rocopyout: munprotect failed\n");
+    29fe:	53                   	push   %ebx
+    29ff:	53                   	push   %ebx
+    2a00:	68 8a 74 00 00       	push   $0x748a
+    2a05:	6a 01                	push   $0x1
+    2a07:	e8 64 3a 00 00       	call   6470 <printf>
+    exit();
+    2a0c:	e8 ef 34 00 00       	call   5f00 <exit>
+    2a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a1f:	90                   	nop
+
+00002a20 <stdiotest>:
+{
+    2a20:	55                   	push   %ebp
+    2a21:	89 e5                	mov    %esp,%ebp
+    2a23:	57                   	push   %edi
+    2a24:	56                   	push   %esi
+  kstat(&a);
+    2a25:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+{
+    2a2b:	53                   	push   %ebx
+    2a2c:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  kstat(&a);
+    2a32:	50                   	push   %eax
+    2a33:	e8 65 36 00 00       	call   609d <kstat>
+  if((f = fopen("stdiotest", "w")) == 0){
+    2a38:	5e                   	pop    %esi
+    2a39:	5f                   	pop    %edi
+    2a3a:	68 b6 74 00 00       	push   $0x74b6
+    2a3f:	68 b8 74 00 00       	push   $0x74b8
+    2a44:	e8 07 41 00 00       	call   6b50 <fopen>
+    2a49:	83 c4 10             	add    $0x10,%esp
+    2a4c:	85 c0                	test   %eax,%eax
+    2a4e:	0f 84 dc 02 00 00    	je     2d30 <stdiotest+0x310>
+    2a54:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 1000; i++)
+    2a56:	31 ff                	xor    %edi,%edi
+    fputc('a' + i%26, f);
+    2a58:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    2a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    2a60:	89 f8                	mov    %edi,%eax
+    2a62:	83 ec 08             	sub    $0x8,%esp
+    2a65:	f7 e6                	mul    %esi
+    2a67:	89 f8                	mov    %edi,%eax
+    2a69:	53                   	push   %ebx
+  for(i = 0; i < 1000; i++)
+    2a6a:	83 c7 01             	add    $0x1,%edi
+    fputc('a' + i%26, f);
+    2a6d:	c1 ea 03             	shr    $0x3,%edx
+    2a70:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2a73:	29 d0                	sub    %edx,%eax
+    2a75:	83 c0 61             	add    $0x61,%eax
+    2a78:	50                   	push   %eax
+    2a79:	e8 92 3d 00 00       	call   6810 <fputc>
+  for(i = 0; i < 1000; i++)
+    2a7e:	83 c4 10             	add    $0x10,%esp
+    2a81:	81 ff e8 03 00 00    	cmp    $0x3e8,%edi
+    2a87:	75 d7                	jne    2a60 <stdiotest+0x40>
+  fprintf(f, "end %d\n", 42);
+    2a89:	83 ec 04             	sub    $0x4,%esp
+    2a8c:	6a 2a                	push   $0x2a
+    2a8e:	68 db 74 00 00       	push   $0x74db
+    2a93:	53                   	push   %ebx
+    2a94:	e8 27 3a 00 00       	call   64c0 <fprintf>
+  if(fclose(f) < 0){
+    2a99:	89 1c 24             	mov    %ebx,(%esp)
+    2a9c:	e8 5f 41 00 00       	call   6c00 <fclose>
+    2aa1:	83 c4 10             	add    $0x10,%esp
+    2aa4:	85 c0                	test   %eax,%eax
+    2aa6:	0f 88 71 02 00 00    	js     2d1d <stdiotest+0x2fd>
+  kstat(&b);
+    2aac:	83 ec 0c             	sub    $0xc,%esp
+    2aaf:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    2ab5:	50                   	push   %eax
+    2ab6:	e8 e2 35 00 00       	call   609d <kstat>
+  if(b.syscalls - a.syscalls > 12){
+    2abb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    2abe:	2b 85 5c ff ff ff    	sub    -0xa4(%ebp),%eax
+    2ac4:	83 c4 10             	add    $0x10,%esp
+    2ac7:	83 f8 0c             	cmp    $0xc,%eax
+    2aca:	0f 87 3a 02 00 00    	ja     2d0a <stdiotest+0x2ea>
+  if((f = fopen("stdiotest", "r")) == 0 || fread(buf, 1, 1000, f) != 1000){
+    2ad0:	83 ec 08             	sub    $0x8,%esp
+    2ad3:	68 cb 6e 00 00       	push   $0x6ecb
+    2ad8:	68 b8 74 00 00       	push   $0x74b8
+    2add:	e8 6e 40 00 00       	call   6b50 <fopen>
+    2ae2:	83 c4 10             	add    $0x10,%esp
+    2ae5:	89 c6                	mov    %eax,%esi
+    2ae7:	85 c0                	test   %eax,%eax
+    2ae9:	0f 84 08 02 00 00    	je     2cf7 <stdiotest+0x2d7>
+    2aef:	50                   	push   %eax
+    2af0:	68 e8 03 00 00       	push   $0x3e8
+    2af5:	6a 01                	push   $0x1
+    2af7:	68 c0 cc 00 00       	push   $0xccc0
+    2afc:	e8 4f 3d 00 00       	call   6850 <fread>
+    2b01:	83 c4 10             	add    $0x10,%esp
+    2b04:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    2b09:	0f 85 e8 01 00 00    	jne    2cf7 <stdiotest+0x2d7>
+  for(i = 0; i < 1000; i++)
+    2b0f:	31 c9                	xor    %ecx,%ecx
+    if(buf[i] != 'a' + i%26){
+    2b11:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+    2b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    2b20:	89 c8                	mov    %ecx,%eax
+    2b22:	0f be 99 c0 cc 00 00 	movsbl 0xccc0(%ecx),%ebx
+    2b29:	f7 e7                	mul    %edi
+    2b2b:	89 c8                	mov    %ecx,%eax
+    2b2d:	c1 ea 03             	shr    $0x3,%edx
+    2b30:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2b33:	29 d0                	sub    %edx,%eax
+    2b35:	83 c0 61             	add    $0x61,%eax
+    2b38:	39 c3                	cmp    %eax,%ebx
+    2b3a:	0f 85 a3 01 00 00    	jne    2ce3 <stdiotest+0x2c3>
+  for(i = 0; i < 1000; i++)
+    2b40:	83 c1 01             	add    $0x1,%ecx
+    2b43:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+    2b49:	75 d5                	jne    2b20 <stdiotest+0x100>
+  if(fgets(buf, 100, f) == 0 || strcmp(buf, "end 42\n") != 0 ||
+    2b4b:	83 ec 04             	sub    $0x4,%esp
+    2b4e:	56                   	push   %esi
+    2b4f:	6a 64                	push   $0x64
+    2b51:	68 c0 cc 00 00       	push   $0xccc0
+    2b56:	e8 b5 3e 00 00       	call   6a10 <fgets>
+    2b5b:	83 c4 10             	add    $0x10,%esp
+    2b5e:	85 c0                	test   %eax,%eax
+    2b60:	0f 84 2e 02 00 00    	je     2d94 <stdiotest+0x374>
+    2b66:	83 ec 08             	sub    $0x8,%esp
+    2b69:	68 62 75 00 00       	push   $0x7562
+    2b6e:	68 c0 cc 00 00       	push   $0xccc0
+    2b73:	e8 d8 30 00 00       	call   5c50 <strcmp>
+    2b78:	83 c4 10             	add    $0x10,%esp
+    2b7b:	85 c0                	test   %eax,%eax
+    2b7d:	0f 85 11 02 00 00    	jne    2d94 <stdiotest+0x374>
+     fgetc(f) != -1 || !feof(f)){
+    2b83:	83 ec 0c             	sub    $0xc,%esp
+    2b86:	56                   	push   %esi
+    2b87:	e8 24 3e 00 00       	call   69b0 <fgetc>
+  if(fgets(buf, 100, f) == 0 || strcmp(buf, "end 42\n") != 0 ||
+    2b8c:	83 c4 10             	add    $0x10,%esp
+    2b8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2b92:	0f 85 fc 01 00 00    	jne    2d94 <stdiotest+0x374>
+     fgetc(f) != -1 || !feof(f)){
+    2b98:	83 ec 0c             	sub    $0xc,%esp
+    2b9b:	56                   	push   %esi
+    2b9c:	e8 df 40 00 00       	call   6c80 <feof>
+    2ba1:	83 c4 10             	add    $0x10,%esp
+    2ba4:	85 c0                	test   %eax,%eax
+    2ba6:	0f 84 e8 01 00 00    	je     2d94 <stdiotest+0x374>
+  fclose(f);
+    2bac:	83 ec 0c             	sub    $0xc,%esp
+    2baf:	56                   	push   %esi
+    2bb0:	e8 4b 40 00 00       	call   6c00 <fclose>
+  if((f = fopen("stdiotest", "w")) == 0){
+    2bb5:	5b                   	pop    %ebx
+    2bb6:	5e                   	pop    %esi
+    2bb7:	68 b6 74 00 00       	push   $0x74b6
+    2bbc:	68 b8 74 00 00       	push   $0x74b8
+    2bc1:	e8 8a 3f 00 00       	call   6b50 <fopen>
+    2bc6:	83 c4 10             	add    $0x10,%esp
+    2bc9:	89 c3                	mov    %eax,%ebx
+    2bcb:	85 c0                	test   %eax,%eax
+    2bcd:	0f 84 5d 01 00 00    	je     2d30 <stdiotest+0x310>
+  fprintf(f, "once");
+    2bd3:	83 ec 08             	sub    $0x8,%esp
+    2bd6:	68 6a 75 00 00       	push   $0x756a
+    2bdb:	50                   	push   %eax
+    2bdc:	e8 df 38 00 00       	call   64c0 <fprintf>
+  pid = fork();
+    2be1:	e8 ea 32 00 00       	call   5ed0 <fork>
+  if(pid == 0)
+    2be6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2be9:	89 c6                	mov    %eax,%esi
+  if(pid == 0)
+    2beb:	85 c0                	test   %eax,%eax
+    2bed:	0f 84 9c 01 00 00    	je     2d8f <stdiotest+0x36f>
+  if(pid < 0 || wait() != pid){
+    2bf3:	0f 88 83 01 00 00    	js     2d7c <stdiotest+0x35c>
+    2bf9:	e8 64 33 00 00       	call   5f62 <wait>
+    2bfe:	39 f0                	cmp    %esi,%eax
+    2c00:	0f 85 76 01 00 00    	jne    2d7c <stdiotest+0x35c>
+  fclose(f);
+    2c06:	83 ec 0c             	sub    $0xc,%esp
+  if(stat("stdiotest", &st) < 0 || st.size != 4){
+    2c09:	8d b5 cc fe ff ff    	lea    -0x134(%ebp),%esi
+  fclose(f);
+    2c0f:	53                   	push   %ebx
+    2c10:	e8 eb 3f 00 00       	call   6c00 <fclose>
+  if(stat("stdiotest", &st) < 0 || st.size != 4){
+    2c15:	58                   	pop    %eax
+    2c16:	5a                   	pop    %edx
+    2c17:	56                   	push   %esi
+    2c18:	68 b8 74 00 00       	push   $0x74b8
+    2c1d:	e8 7e 31 00 00       	call   5da0 <stat>
+    2c22:	83 c4 10             	add    $0x10,%esp
+    2c25:	85 c0                	test   %eax,%eax
+    2c27:	0f 88 3c 01 00 00    	js     2d69 <stdiotest+0x349>
+    2c2d:	83 bd dc fe ff ff 04 	cmpl   $0x4,-0x124(%ebp)
+    2c34:	0f 85 2f 01 00 00    	jne    2d69 <stdiotest+0x349>
+  if(link("stdiotest", "stdiotest1") < 0 ||
+    2c3a:	83 ec 08             	sub    $0x8,%esp
+    2c3d:	68 87 75 00 00       	push   $0x7587
+    2c42:	68 b8 74 00 00       	push   $0x74b8
+    2c47:	e8 bb 33 00 00       	call   6007 <link>
+    2c4c:	83 c4 10             	add    $0x10,%esp
+    2c4f:	85 c0                	test   %eax,%eax
+    2c51:	0f 88 ff 00 00 00    	js     2d56 <stdiotest+0x336>
+     (f = fopen("stdiotest1", "w")) == 0){
+    2c57:	83 ec 08             	sub    $0x8,%esp
+    2c5a:	68 b6 74 00 00       	push   $0x74b6
+    2c5f:	68 87 75 00 00       	push   $0x7587
+    2c64:	e8 e7 3e 00 00       	call   6b50 <fopen>
+  if(link("stdiotest", "stdiotest1") < 0 ||
+    2c69:	83 c4 10             	add    $0x10,%esp
+     (f = fopen("stdiotest1", "w")) == 0){
+    2c6c:	89 c3                	mov    %eax,%ebx
+  if(link("stdiotest", "stdiotest1") < 0 ||
+    2c6e:	85 c0                	test   %eax,%eax
+    2c70:	0f 84 e0 00 00 00    	je     2d56 <stdiotest+0x336>
+  fprintf(f, "x");
+    2c76:	83 ec 08             	sub    $0x8,%esp
+    2c79:	68 77 7b 00 00       	push   $0x7b77
+    2c7e:	50                   	push   %eax
+    2c7f:	e8 3c 38 00 00       	call   64c0 <fprintf>
+  fclose(f);
+    2c84:	89 1c 24             	mov    %ebx,(%esp)
+    2c87:	e8 74 3f 00 00       	call   6c00 <fclose>
+  if(stat("stdiotest", &st) < 0 || st.size != 1){
+    2c8c:	5b                   	pop    %ebx
+    2c8d:	5f                   	pop    %edi
+    2c8e:	56                   	push   %esi
+    2c8f:	68 b8 74 00 00       	push   $0x74b8
+    2c94:	e8 07 31 00 00       	call   5da0 <stat>
+    2c99:	83 c4 10             	add    $0x10,%esp
+    2c9c:	85 c0                	test   %eax,%eax
+    2c9e:	0f 88 9f 00 00 00    	js     2d43 <stdiotest+0x323>
+    2ca4:	83 bd dc fe ff ff 01 	cmpl   $0x1,-0x124(%ebp)
+    2cab:	0f 85 92 00 00 00    	jne    2d43 <stdiotest+0x323>
+  unlink("stdiotest1");
+    2cb1:	83 ec 0c             	sub    $0xc,%esp
+    2cb4:	68 87 75 00 00       	push   $0x7587
+    2cb9:	e8 2b 33 00 00       	call   5fe9 <unlink>
+  unlink("stdiotest");
+    2cbe:	c7 04 24 b8 74 00 00 	movl   $0x74b8,(%esp)
+    2cc5:	e8 1f 33 00 00       	call   5fe9 <unlink>
+  printf(1, "stdiotest ok\n");
+    2cca:	58                   	pop    %eax
+    2ccb:	5a                   	pop    %edx
+    2ccc:	68 aa 75 00 00       	push   $0x75aa
+    2cd1:	6a 01                	push   $0x1
+    2cd3:	e8 98 37 00 00       	call   6470 <printf>
+}
+    2cd8:	83 c4 10             	add    $0x10,%esp
+    2cdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2cde:	5b                   	pop    %ebx
+    2cdf:	5e                   	pop    %esi
+    2ce0:	5f                   	pop    %edi
+    2ce1:	5d                   	pop    %ebp
+    2ce2:	c3                   	ret
+      printf(1, "stdiotest: wrong data\n");
+    2ce3:	83 ec 08             	sub    $0x8,%esp
+    2ce6:	68 32 75 00 00       	push   $0x7532
+    2ceb:	6a 01                	push   $0x1
+    2ced:	e8 7e 37 00 00       	call   6470 <printf>
+      exit();
+    2cf2:	e8 09 32 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: fread failed\n");
+    2cf7:	57                   	push   %edi
+    2cf8:	57                   	push   %edi
+    2cf9:	68 19 75 00 00       	push   $0x7519
+    2cfe:	6a 01                	push   $0x1
+    2d00:	e8 6b 37 00 00       	call   6470 <printf>
+    exit();
+    2d05:	e8 f6 31 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: %d system calls\n", b.syscalls - a.syscalls);
+    2d0a:	52                   	push   %edx
+    2d0b:	50                   	push   %eax
+    2d0c:	68 fd 74 00 00       	push   $0x74fd
+    2d11:	6a 01                	push   $0x1
+    2d13:	e8 58 37 00 00       	call   6470 <printf>
+    exit();
+    2d18:	e8 e3 31 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: fclose failed\n");
+    2d1d:	51                   	push   %ecx
+    2d1e:	51                   	push   %ecx
+    2d1f:	68 e3 74 00 00       	push   $0x74e3
+    2d24:	6a 01                	push   $0x1
+    2d26:	e8 45 37 00 00       	call   6470 <printf>
+    exit();
+    2d2b:	e8 d0 31 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: fopen failed\n");
+    2d30:	53                   	push   %ebx
+    2d31:	53                   	push   %ebx
+    2d32:	68 c2 74 00 00       	push   $0x74c2
+    2d37:	6a 01                	push   $0x1
+    2d39:	e8 32 37 00 00       	call   6470 <printf>
+    exit();
+    2d3e:	e8 bd 31 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: fopen did not truncate\n");
+    2d43:	51                   	push   %ecx
+    2d44:	51                   	push   %ecx
+    2d45:	68 dc 85 00 00       	push   $0x85dc
+    2d4a:	6a 01                	push   $0x1
+    2d4c:	e8 1f 37 00 00       	call   6470 <printf>
+    exit();
+    2d51:	e8 aa 31 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: link failed\n");
+    2d56:	50                   	push   %eax
+    2d57:	50                   	push   %eax
+    2d58:	68 92 75 00 00       	push   $0x7592
+    2d5d:	6a 01                	push   $0x1
+    2d5f:	e8 0c 37 00 00       	call   6470 <printf>
+    exit();
+    2d64:	e8 97 31 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: fork doubled output\n");
+    2d69:	50                   	push   %eax
+    2d6a:	50                   	push   %eax
+    2d6b:	68 bc 85 00 00       	push   $0x85bc
+    2d70:	6a 01                	push   $0x1
+    2d72:	e8 f9 36 00 00       	call   6470 <printf>
+    exit();
+    2d77:	e8 84 31 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: fork failed\n");
+    2d7c:	51                   	push   %ecx
+    2d7d:	51                   	push   %ecx
+    2d7e:	68 6f 75 00 00       	push   $0x756f
+    2d83:	6a 01                	push   $0x1
+    2d85:	e8 e6 36 00 00       	call   6470 <printf>
+    exit();
+    2d8a:	e8 71 31 00 00       	call   5f00 <exit>
+    exit();
+    2d8f:	e8 6c 31 00 00       	call   5f00 <exit>
+    printf(1, "stdiotest: fgets failed\n");
+    2d94:	83 ec 08             	sub    $0x8,%esp
+    2d97:	68 49 75 00 00       	push   $0x7549
+    2d9c:	6a 01                	push   $0x1
+    2d9e:	e8 cd 36 00 00       	call   6470 <printf>
+    exit();
+    2da3:	e8 58 31 00 00       	call   5f00 <exit>
+    2da8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2daf:	90                   	nop
+
+00002db0 <preempt>:
+{
+    2db0:	55                   	push   %ebp
+    2db1:	89 e5                	mov    %esp,%ebp
+    2db3:	57                   	push   %edi
+    2db4:	56                   	push   %esi
+    2db5:	53                   	push   %ebx
+    2db6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    2db9:	68 b8 75 00 00       	push   $0x75b8
+    2dbe:	6a 01                	push   $0x1
+    2dc0:	e8 ab 36 00 00       	call   6470 <printf>
+  pid1 = fork();
+    2dc5:	e8 06 31 00 00       	call   5ed0 <fork>
+  if(pid1 == 0)
+    2dca:	83 c4 10             	add    $0x10,%esp
+    2dcd:	85 c0                	test   %eax,%eax
+    2dcf:	75 07                	jne    2dd8 <preempt+0x28>
+    for(;;)
+    2dd1:	eb fe                	jmp    2dd1 <preempt+0x21>
+    2dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2dd7:	90                   	nop
+    2dd8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    2dda:	e8 f1 30 00 00       	call   5ed0 <fork>
+    2ddf:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    2de1:	85 c0                	test   %eax,%eax
+    2de3:	75 0b                	jne    2df0 <preempt+0x40>
+    for(;;)
+    2de5:	eb fe                	jmp    2de5 <preempt+0x35>
+    2de7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2dee:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    2df0:	83 ec 0c             	sub    $0xc,%esp
+    2df3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2df6:	50                   	push   %eax
+    2df7:	e8 75 31 00 00       	call   5f71 <pipe>
+  pid3 = fork();
+    2dfc:	e8 cf 30 00 00       	call   5ed0 <fork>
+  if(pid3 == 0){
+    2e01:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    2e04:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    2e06:	85 c0                	test   %eax,%eax
+    2e08:	75 3e                	jne    2e48 <preempt+0x98>
+    close(pfds[0]);
+    2e0a:	83 ec 0c             	sub    $0xc,%esp
+    2e0d:	ff 75 e0             	push   -0x20(%ebp)
+    2e10:	e8 89 31 00 00       	call   5f9e <close>
+    if(write(pfds[1], "x", 1) != 1)
+    2e15:	83 c4 0c             	add    $0xc,%esp
+    2e18:	6a 01                	push   $0x1
+    2e1a:	68 77 7b 00 00       	push   $0x7b77
+    2e1f:	ff 75 e4             	push   -0x1c(%ebp)
+    2e22:	e8 68 31 00 00       	call   5f8f <write>
+    2e27:	83 c4 10             	add    $0x10,%esp
+    2e2a:	83 f8 01             	cmp    $0x1,%eax
+    2e2d:	0f 85 b8 00 00 00    	jne    2eeb <preempt+0x13b>
+    close(pfds[1]);
+    2e33:	83 ec 0c             	sub    $0xc,%esp
+    2e36:	ff 75 e4             	push   -0x1c(%ebp)
+    2e39:	e8 60 31 00 00       	call   5f9e <close>
+    2e3e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    2e41:	eb fe                	jmp    2e41 <preempt+0x91>
+    2e43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2e47:	90                   	nop
+  close(pfds[1]);
+    2e48:	83 ec 0c             	sub    $0xc,%esp
+    2e4b:	ff 75 e4             	push   -0x1c(%ebp)
+    2e4e:	e8 4b 31 00 00       	call   5f9e <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    2e53:	83 c4 0c             	add    $0xc,%esp
+    2e56:	68 00 20 00 00       	push   $0x2000
+    2e5b:	68 c0 cc 00 00       	push   $0xccc0
+    2e60:	ff 75 e0             	push   -0x20(%ebp)
+    2e63:	e8 18 31 00 00       	call   5f80 <read>
+    2e68:	83 c4 10             	add    $0x10,%esp
+    2e6b:	83 f8 01             	cmp    $0x1,%eax
+    2e6e:	75 67                	jne    2ed7 <preempt+0x127>
+  close(pfds[0]);
+    2e70:	83 ec 0c             	sub    $0xc,%esp
+    2e73:	ff 75 e0             	push   -0x20(%ebp)
+    2e76:	e8 23 31 00 00       	call   5f9e <close>
+  printf(1, "kill... ");
+    2e7b:	58                   	pop    %eax
+    2e7c:	5a                   	pop    %edx
+    2e7d:	68 e9 75 00 00       	push   $0x75e9
+    2e82:	6a 01                	push   $0x1
+    2e84:	e8 e7 35 00 00       	call   6470 <printf>
+  kill(pid1);
+    2e89:	89 1c 24             	mov    %ebx,(%esp)
+    2e8c:	e8 1c 31 00 00       	call   5fad <kill>
+  kill(pid2);
+    2e91:	89 34 24             	mov    %esi,(%esp)
+    2e94:	e8 14 31 00 00       	call   5fad <kill>
+  kill(pid3);
+    2e99:	89 3c 24             	mov    %edi,(%esp)
+    2e9c:	e8 0c 31 00 00       	call   5fad <kill>
+  printf(1, "wait... ");
+    2ea1:	59                   	pop    %ecx
+    2ea2:	5b                   	pop    %ebx
+    2ea3:	68 f2 75 00 00       	push   $0x75f2
+    2ea8:	6a 01                	push   $0x1
+    2eaa:	e8 c1 35 00 00       	call   6470 <printf>
+  wait();
+    2eaf:	e8 ae 30 00 00       	call   5f62 <wait>
+  wait();
+    2eb4:	e8 a9 30 00 00       	call   5f62 <wait>
+  wait();
+    2eb9:	e8 a4 30 00 00       	call   5f62 <wait>
+  printf(1, "preempt ok\n");
+    2ebe:	5e                   	pop    %esi
+    2ebf:	5f                   	pop    %edi
+    2ec0:	68 fb 75 00 00       	push   $0x75fb
+    2ec5:	6a 01                	push   $0x1
+    2ec7:	e8 a4 35 00 00       	call   6470 <printf>
+    2ecc:	83 c4 10             	add    $0x10,%esp
+}
+    2ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2ed2:	5b                   	pop    %ebx
+    2ed3:	5e                   	pop    %esi
+    2ed4:	5f                   	pop    %edi
+    2ed5:	5d                   	pop    %ebp
+    2ed6:	c3                   	ret
+    printf(1, "preempt read error");
+    2ed7:	83 ec 08             	sub    $0x8,%esp
+    2eda:	68 d6 75 00 00       	push   $0x75d6
+    2edf:	6a 01                	push   $0x1
+    2ee1:	e8 8a 35 00 00       	call   6470 <printf>
+    2ee6:	83 c4 10             	add    $0x10,%esp
+    2ee9:	eb e4                	jmp    2ecf <preempt+0x11f>
+      printf(1, "preempt write error");
+    2eeb:	83 ec 08             	sub    $0x8,%esp
+    2eee:	68 c2 75 00 00       	push   $0x75c2
+    2ef3:	6a 01                	push   $0x1
+    2ef5:	e8 76 35 00 00       	call   6470 <printf>
+    2efa:	83 c4 10             	add    $0x10,%esp
+    2efd:	e9 31 ff ff ff       	jmp    2e33 <preempt+0x83>
+    2f02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2f09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002f10 <exitwait>:
+{
+    2f10:	55                   	push   %ebp
+    2f11:	89 e5                	mov    %esp,%ebp
+    2f13:	56                   	push   %esi
+    2f14:	be 64 00 00 00       	mov    $0x64,%esi
+    2f19:	53                   	push   %ebx
+    2f1a:	eb 14                	jmp    2f30 <exitwait+0x20>
+    2f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    2f20:	74 68                	je     2f8a <exitwait+0x7a>
+      if(wait() != pid){
+    2f22:	e8 3b 30 00 00       	call   5f62 <wait>
+    2f27:	39 d8                	cmp    %ebx,%eax
+    2f29:	75 2d                	jne    2f58 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    2f2b:	83 ee 01             	sub    $0x1,%esi
+    2f2e:	74 41                	je     2f71 <exitwait+0x61>
+    pid = fork();
+    2f30:	e8 9b 2f 00 00       	call   5ed0 <fork>
+    2f35:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    2f37:	85 c0                	test   %eax,%eax
+    2f39:	79 e5                	jns    2f20 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    2f3b:	83 ec 08             	sub    $0x8,%esp
+    2f3e:	68 0b 82 00 00       	push   $0x820b
+    2f43:	6a 01                	push   $0x1
+    2f45:	e8 26 35 00 00       	call   6470 <printf>
+      return;
+    2f4a:	83 c4 10             	add    $0x10,%esp
+}
+    2f4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2f50:	5b                   	pop    %ebx
+    2f51:	5e                   	pop    %esi
+    2f52:	5d                   	pop    %ebp
+    2f53:	c3                   	ret
+    2f54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    2f58:	83 ec 08             	sub    $0x8,%esp
+    2f5b:	68 07 76 00 00       	push   $0x7607
+    2f60:	6a 01                	push   $0x1
+    2f62:	e8 09 35 00 00       	call   6470 <printf>
+        return;
+    2f67:	83 c4 10             	add    $0x10,%esp
+}
+    2f6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2f6d:	5b                   	pop    %ebx
+    2f6e:	5e                   	pop    %esi
+    2f6f:	5d                   	pop    %ebp
+    2f70:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    2f71:	83 ec 08             	sub    $0x8,%esp
+    2f74:	68 17 76 00 00       	push   $0x7617
+    2f79:	6a 01                	push   $0x1
+    2f7b:	e8 f0 34 00 00       	call   6470 <printf>
+    2f80:	83 c4 10             	add    $0x10,%esp
+}
+    2f83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2f86:	5b                   	pop    %ebx
+    2f87:	5e                   	pop    %esi
+    2f88:	5d                   	pop    %ebp
+    2f89:	c3                   	ret
+      exit();
+    2f8a:	e8 71 2f 00 00       	call   5f00 <exit>
+    2f8f:	90                   	nop
+
+00002f90 <mem>:
+{
+    2f90:	55                   	push   %ebp
+    2f91:	89 e5                	mov    %esp,%ebp
+    2f93:	56                   	push   %esi
+    2f94:	31 f6                	xor    %esi,%esi
+    2f96:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    2f97:	83 ec 08             	sub    $0x8,%esp
+    2f9a:	68 24 76 00 00       	push   $0x7624
+    2f9f:	6a 01                	push   $0x1
+    2fa1:	e8 ca 34 00 00       	call   6470 <printf>
+  ppid = getpid();
+    2fa6:	e8 98 30 00 00       	call   6043 <getpid>
+    2fab:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    2fad:	e8 1e 2f 00 00       	call   5ed0 <fork>
+    2fb2:	83 c4 10             	add    $0x10,%esp
+    2fb5:	85 c0                	test   %eax,%eax
+    2fb7:	74 0b                	je     2fc4 <mem+0x34>
+    2fb9:	e9 8a 00 00 00       	jmp    3048 <mem+0xb8>
+    2fbe:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    2fc0:	89 30                	mov    %esi,(%eax)
+    2fc2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    2fc4:	83 ec 0c             	sub    $0xc,%esp
+    2fc7:	68 11 27 00 00       	push   $0x2711
+    2fcc:	e8 6f 3d 00 00       	call   6d40 <malloc>
+    2fd1:	83 c4 10             	add    $0x10,%esp
+    2fd4:	85 c0                	test   %eax,%eax
+    2fd6:	75 e8                	jne    2fc0 <mem+0x30>
+    while(m1){
+    2fd8:	85 f6                	test   %esi,%esi
+    2fda:	74 18                	je     2ff4 <mem+0x64>
+    2fdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    2fe0:	89 f0                	mov    %esi,%eax
+      free(m1);
+    2fe2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    2fe5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    2fe7:	50                   	push   %eax
+    2fe8:	e8 c3 3c 00 00       	call   6cb0 <free>
+    while(m1){
+    2fed:	83 c4 10             	add    $0x10,%esp
+    2ff0:	85 f6                	test   %esi,%esi
+    2ff2:	75 ec                	jne    2fe0 <mem+0x50>
+    m1 = malloc(1024*20);
+    2ff4:	83 ec 0c             	sub    $0xc,%esp
+    2ff7:	68 00 50 00 00       	push   $0x5000
+    2ffc:	e8 3f 3d 00 00       	call   6d40 <malloc>
+    if(m1 == 0){
+    3001:	83 c4 10             	add    $0x10,%esp
+    3004:	85 c0                	test   %eax,%eax
+    3006:	74 20                	je     3028 <mem+0x98>
+    free(m1);
+    3008:	83 ec 0c             	sub    $0xc,%esp
+    300b:	50                   	push   %eax
+    300c:	e8 9f 3c 00 00       	call   6cb0 <free>
+    printf(1, "mem ok\n");
+    3011:	58                   	pop    %eax
+    3012:	5a                   	pop    %edx
+    3013:	68 48 76 00 00       	push   $0x7648
+    3018:	6a 01                	push   $0x1
+    301a:	e8 51 34 00 00       	call   6470 <printf>
+    exit();
+    301f:	e8 dc 2e 00 00       	call   5f00 <exit>
+    3024:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    3028:	83 ec 08             	sub    $0x8,%esp
+    302b:	68 2e 76 00 00       	push   $0x762e
+    3030:	6a 01                	push   $0x1
+    3032:	e8 39 34 00 00       	call   6470 <printf>
+      kill(ppid);
+    3037:	89 1c 24             	mov    %ebx,(%esp)
+    303a:	e8 6e 2f 00 00       	call   5fad <kill>
+      exit();
+    303f:	e8 bc 2e 00 00       	call   5f00 <exit>
+    3044:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    3048:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    304b:	5b                   	pop    %ebx
+    304c:	5e                   	pop    %esi
+    304d:	5d                   	pop    %ebp
+    wait();
+    304e:	e9 0f 2f 00 00       	jmp    5f62 <wait>
+    3053:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    305a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003060 <sharedfd>:
+{
+    3060:	55                   	push   %ebp
+    3061:	89 e5                	mov    %esp,%ebp
+    3063:	57                   	push   %edi
+    3064:	56                   	push   %esi
+    3065:	53                   	push   %ebx
+    3066:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    3069:	68 50 76 00 00       	push   $0x7650
+    306e:	6a 01                	push   $0x1
+    3070:	e8 fb 33 00 00       	call   6470 <printf>
+  unlink("sharedfd");
+    3075:	c7 04 24 5f 76 00 00 	movl   $0x765f,(%esp)
+    307c:	e8 68 2f 00 00       	call   5fe9 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    3081:	5b                   	pop    %ebx
+    3082:	5e                   	pop    %esi
+    3083:	68 02 02 00 00       	push   $0x202
+    3088:	68 5f 76 00 00       	push   $0x765f
+    308d:	e8 39 2f 00 00       	call   5fcb <open>
+  if(fd < 0){
+    3092:	83 c4 10             	add    $0x10,%esp
+    3095:	85 c0                	test   %eax,%eax
+    3097:	0f 88 2a 01 00 00    	js     31c7 <sharedfd+0x167>
+    309d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    309f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    30a2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    30a7:	e8 24 2e 00 00       	call   5ed0 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    30ac:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    30af:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    30b2:	19 c0                	sbb    %eax,%eax
+    30b4:	83 ec 04             	sub    $0x4,%esp
+    30b7:	83 e0 f3             	and    $0xfffffff3,%eax
+    30ba:	6a 0a                	push   $0xa
+    30bc:	83 c0 70             	add    $0x70,%eax
+    30bf:	50                   	push   %eax
+    30c0:	56                   	push   %esi
+    30c1:	e8 1a 2c 00 00       	call   5ce0 <memset>
+    30c6:	83 c4 10             	add    $0x10,%esp
+    30c9:	eb 0a                	jmp    30d5 <sharedfd+0x75>
+    30cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    30cf:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    30d0:	83 eb 01             	sub    $0x1,%ebx
+    30d3:	74 26                	je     30fb <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    30d5:	83 ec 04             	sub    $0x4,%esp
+    30d8:	6a 0a                	push   $0xa
+    30da:	56                   	push   %esi
+    30db:	57                   	push   %edi
+    30dc:	e8 ae 2e 00 00       	call   5f8f <write>
+    30e1:	83 c4 10             	add    $0x10,%esp
+    30e4:	83 f8 0a             	cmp    $0xa,%eax
+    30e7:	74 e7                	je     30d0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    30e9:	83 ec 08             	sub    $0x8,%esp
+    30ec:	68 2c 86 00 00       	push   $0x862c
+    30f1:	6a 01                	push   $0x1
+    30f3:	e8 78 33 00 00       	call   6470 <printf>
+      break;
+    30f8:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    30fb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    30fe:	85 c9                	test   %ecx,%ecx
+    3100:	0f 84 f5 00 00 00    	je     31fb <sharedfd+0x19b>
+    wait();
+    3106:	e8 57 2e 00 00       	call   5f62 <wait>
+  close(fd);
+    310b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    310e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    3110:	57                   	push   %edi
+    3111:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    3114:	e8 85 2e 00 00       	call   5f9e <close>
+  fd = open("sharedfd", 0);
+    3119:	58                   	pop    %eax
+    311a:	5a                   	pop    %edx
+    311b:	6a 00                	push   $0x0
+    311d:	68 5f 76 00 00       	push   $0x765f
+    3122:	e8 a4 2e 00 00       	call   5fcb <open>
+  if(fd < 0){
+    3127:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    312a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    312c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    312f:	85 c0                	test   %eax,%eax
+    3131:	0f 88 aa 00 00 00    	js     31e1 <sharedfd+0x181>
+    3137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    313e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    3140:	83 ec 04             	sub    $0x4,%esp
+    3143:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    3146:	6a 0a                	push   $0xa
+    3148:	56                   	push   %esi
+    3149:	ff 75 d0             	push   -0x30(%ebp)
+    314c:	e8 2f 2e 00 00       	call   5f80 <read>
+    3151:	83 c4 10             	add    $0x10,%esp
+    3154:	85 c0                	test   %eax,%eax
+    3156:	7e 28                	jle    3180 <sharedfd+0x120>
+    3158:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    315b:	89 f0                	mov    %esi,%eax
+    315d:	eb 13                	jmp    3172 <sharedfd+0x112>
+    315f:	90                   	nop
+        np++;
+    3160:	80 f9 70             	cmp    $0x70,%cl
+    3163:	0f 94 c1             	sete   %cl
+    3166:	0f b6 c9             	movzbl %cl,%ecx
+    3169:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    316b:	83 c0 01             	add    $0x1,%eax
+    316e:	39 f8                	cmp    %edi,%eax
+    3170:	74 ce                	je     3140 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    3172:	0f b6 08             	movzbl (%eax),%ecx
+    3175:	80 f9 63             	cmp    $0x63,%cl
+    3178:	75 e6                	jne    3160 <sharedfd+0x100>
+        nc++;
+    317a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    317d:	eb ec                	jmp    316b <sharedfd+0x10b>
+    317f:	90                   	nop
+  close(fd);
+    3180:	83 ec 0c             	sub    $0xc,%esp
+    3183:	ff 75 d0             	push   -0x30(%ebp)
+    3186:	e8 13 2e 00 00       	call   5f9e <close>
+  unlink("sharedfd");
+    318b:	c7 04 24 5f 76 00 00 	movl   $0x765f,(%esp)
+    3192:	e8 52 2e 00 00       	call   5fe9 <unlink>
+  if(nc == 10000 && np == 10000){
+    3197:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    319a:	83 c4 10             	add    $0x10,%esp
+    319d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    31a3:	75 5b                	jne    3200 <sharedfd+0x1a0>
+    31a5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    31ab:	75 53                	jne    3200 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    31ad:	83 ec 08             	sub    $0x8,%esp
+    31b0:	68 68 76 00 00       	push   $0x7668
+    31b5:	6a 01                	push   $0x1
+    31b7:	e8 b4 32 00 00       	call   6470 <printf>
+    31bc:	83 c4 10             	add    $0x10,%esp
+}
+    31bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    31c2:	5b                   	pop    %ebx
+    31c3:	5e                   	pop    %esi
+    31c4:	5f                   	pop    %edi
+    31c5:	5d                   	pop    %ebp
+    31c6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    31c7:	83 ec 08             	sub    $0x8,%esp
+    31ca:	68 00 86 00 00       	push   $0x8600
+    31cf:	6a 01                	push   $0x1
+    31d1:	e8 9a 32 00 00       	call   6470 <printf>
+    return;
+    31d6:	83 c4 10             	add    $0x10,%esp
+}
+    31d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    31dc:	5b                   	pop    %ebx
+    31dd:	5e                   	pop    %esi
+    31de:	5f                   	pop    %edi
+    31df:	5d                   	pop    %ebp
+    31e0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    31e1:	83 ec 08             	sub    $0x8,%esp
+    31e4:	68 4c 86 00 00       	push   $0x864c
+    31e9:	6a 01                	push   $0x1
+    31eb:	e8 80 32 00 00       	call   6470 <printf>
+    return;
+    31f0:	83 c4 10             	add    $0x10,%esp
+}
+    31f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    31f6:	5b                   	pop    %ebx
+    31f7:	5e                   	pop    %esi
+    31f8:	5f                   	pop    %edi
+    31f9:	5d                   	pop    %ebp
+    31fa:	c3                   	ret
+    exit();
+    31fb:	e8 00 2d 00 00       	call   5f00 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    3200:	53                   	push   %ebx
+    3201:	52                   	push   %edx
+    3202:	68 75 76 00 00       	push   $0x7675
+    3207:	6a 01                	push   $0x1
+    3209:	e8 62 32 00 00       	call   6470 <printf>
+    exit();
+    320e:	e8 ed 2c 00 00       	call   5f00 <exit>
+    3213:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    321a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003220 <fourfiles>:
+{
+    3220:	55                   	push   %ebp
+    3221:	89 e5                	mov    %esp,%ebp
+    3223:	57                   	push   %edi
+    3224:	56                   	push   %esi
+    3225:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    3226:	31 db                	xor    %ebx,%ebx
+{
+    3228:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    322b:	c7 45 d8 8a 76 00 00 	movl   $0x768a,-0x28(%ebp)
+    3232:	c7 45 dc cd 77 00 00 	movl   $0x77cd,-0x24(%ebp)
+    3239:	c7 45 e0 d1 77 00 00 	movl   $0x77d1,-0x20(%ebp)
+    3240:	c7 45 e4 8d 76 00 00 	movl   $0x768d,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    3247:	68 90 76 00 00       	push   $0x7690
+    324c:	6a 01                	push   $0x1
+    324e:	e8 1d 32 00 00       	call   6470 <printf>
+    3253:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    3256:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    325a:	83 ec 0c             	sub    $0xc,%esp
+    325d:	56                   	push   %esi
+    325e:	e8 86 2d 00 00       	call   5fe9 <unlink>
+    pid = fork();
+    3263:	e8 68 2c 00 00       	call   5ed0 <fork>
+    if(pid < 0){
+    3268:	83 c4 10             	add    $0x10,%esp
+    326b:	85 c0                	test   %eax,%eax
+    326d:	0f 88 65 01 00 00    	js     33d8 <fourfiles+0x1b8>
+    if(pid == 0){
+    3273:	0f 84 eb 00 00 00    	je     3364 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    3279:	83 c3 01             	add    $0x1,%ebx
+    327c:	83 fb 04             	cmp    $0x4,%ebx
+    327f:	75 d5                	jne    3256 <fourfiles+0x36>
+    wait();
+    3281:	e8 dc 2c 00 00       	call   5f62 <wait>
+  for(i = 0; i < 2; i++){
+    3286:	31 f6                	xor    %esi,%esi
+    wait();
+    3288:	e8 d5 2c 00 00       	call   5f62 <wait>
+    328d:	e8 d0 2c 00 00       	call   5f62 <wait>
+    3292:	e8 cb 2c 00 00       	call   5f62 <wait>
+    fname = names[i];
+    3297:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    329b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    329e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    32a0:	6a 00                	push   $0x0
+    32a2:	53                   	push   %ebx
+    32a3:	e8 23 2d 00 00       	call   5fcb <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    32a8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    32ab:	83 c4 10             	add    $0x10,%esp
+    32ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    32b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    32b8:	83 ec 04             	sub    $0x4,%esp
+    32bb:	68 00 20 00 00       	push   $0x2000
+    32c0:	68 c0 cc 00 00       	push   $0xccc0
+    32c5:	ff 75 d4             	push   -0x2c(%ebp)
+    32c8:	e8 b3 2c 00 00       	call   5f80 <read>
+    32cd:	83 c4 10             	add    $0x10,%esp
+    32d0:	89 c3                	mov    %eax,%ebx
+    32d2:	85 c0                	test   %eax,%eax
+    32d4:	7e 28                	jle    32fe <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    32d6:	31 c0                	xor    %eax,%eax
+    32d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    32df:	90                   	nop
+        if(buf[j] != '0'+i){
+    32e0:	83 fe 01             	cmp    $0x1,%esi
+    32e3:	0f be 88 c0 cc 00 00 	movsbl 0xccc0(%eax),%ecx
+    32ea:	19 d2                	sbb    %edx,%edx
+    32ec:	83 c2 31             	add    $0x31,%edx
+    32ef:	39 d1                	cmp    %edx,%ecx
+    32f1:	75 5d                	jne    3350 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    32f3:	83 c0 01             	add    $0x1,%eax
+    32f6:	39 c3                	cmp    %eax,%ebx
+    32f8:	75 e6                	jne    32e0 <fourfiles+0xc0>
+      total += n;
+    32fa:	01 df                	add    %ebx,%edi
+    32fc:	eb ba                	jmp    32b8 <fourfiles+0x98>
+    close(fd);
+    32fe:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    3301:	83 ec 0c             	sub    $0xc,%esp
+    3304:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3307:	51                   	push   %ecx
+    3308:	e8 91 2c 00 00       	call   5f9e <close>
+    if(total != 12*500){
+    330d:	83 c4 10             	add    $0x10,%esp
+    3310:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    3316:	0f 85 d0 00 00 00    	jne    33ec <fourfiles+0x1cc>
+    unlink(fname);
+    331c:	83 ec 0c             	sub    $0xc,%esp
+    331f:	53                   	push   %ebx
+    3320:	e8 c4 2c 00 00       	call   5fe9 <unlink>
+  for(i = 0; i < 2; i++){
+    3325:	83 c4 10             	add    $0x10,%esp
+    3328:	85 f6                	test   %esi,%esi
+    332a:	75 0a                	jne    3336 <fourfiles+0x116>
+    332c:	be 01 00 00 00       	mov    $0x1,%esi
+    3331:	e9 61 ff ff ff       	jmp    3297 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    3336:	83 ec 08             	sub    $0x8,%esp
+    3339:	68 ce 76 00 00       	push   $0x76ce
+    333e:	6a 01                	push   $0x1
+    3340:	e8 2b 31 00 00       	call   6470 <printf>
+}
+    3345:	83 c4 10             	add    $0x10,%esp
+    3348:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    334b:	5b                   	pop    %ebx
+    334c:	5e                   	pop    %esi
+    334d:	5f                   	pop    %edi
+    334e:	5d                   	pop    %ebp
+    334f:	c3                   	ret
+          printf(1, "wrong char\n");
+    3350:	83 ec 08             	sub    $0x8,%esp
+    3353:	68 b1 76 00 00       	push   $0x76b1
+    3358:	6a 01                	push   $0x1
+    335a:	e8 11 31 00 00       	call   6470 <printf>
+          exit();
+    335f:	e8 9c 2b 00 00       	call   5f00 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    3364:	83 ec 08             	sub    $0x8,%esp
+    3367:	68 02 02 00 00       	push   $0x202
+    336c:	56                   	push   %esi
+    336d:	e8 59 2c 00 00       	call   5fcb <open>
+      if(fd < 0){
+    3372:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    3375:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    3377:	85 c0                	test   %eax,%eax
+    3379:	78 45                	js     33c0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    337b:	83 ec 04             	sub    $0x4,%esp
+    337e:	83 c3 30             	add    $0x30,%ebx
+    3381:	68 00 02 00 00       	push   $0x200
+    3386:	53                   	push   %ebx
+    3387:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    338c:	68 c0 cc 00 00       	push   $0xccc0
+    3391:	e8 4a 29 00 00       	call   5ce0 <memset>
+    3396:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    3399:	83 ec 04             	sub    $0x4,%esp
+    339c:	68 f4 01 00 00       	push   $0x1f4
+    33a1:	68 c0 cc 00 00       	push   $0xccc0
+    33a6:	56                   	push   %esi
+    33a7:	e8 e3 2b 00 00       	call   5f8f <write>
+    33ac:	83 c4 10             	add    $0x10,%esp
+    33af:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    33b4:	75 49                	jne    33ff <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    33b6:	83 eb 01             	sub    $0x1,%ebx
+    33b9:	75 de                	jne    3399 <fourfiles+0x179>
+      exit();
+    33bb:	e8 40 2b 00 00       	call   5f00 <exit>
+        printf(1, "create failed\n");
+    33c0:	51                   	push   %ecx
+    33c1:	51                   	push   %ecx
+    33c2:	68 40 72 00 00       	push   $0x7240
+    33c7:	6a 01                	push   $0x1
+    33c9:	e8 a2 30 00 00       	call   6470 <printf>
+        exit();
+    33ce:	e8 2d 2b 00 00       	call   5f00 <exit>
+    33d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    33d7:	90                   	nop
+      printf(1, "fork failed\n");
+    33d8:	83 ec 08             	sub    $0x8,%esp
+    33db:	68 0b 82 00 00       	push   $0x820b
+    33e0:	6a 01                	push   $0x1
+    33e2:	e8 89 30 00 00       	call   6470 <printf>
+      exit();
+    33e7:	e8 14 2b 00 00       	call   5f00 <exit>
+      printf(1, "wrong length %d\n", total);
+    33ec:	50                   	push   %eax
+    33ed:	57                   	push   %edi
+    33ee:	68 bd 76 00 00       	push   $0x76bd
+    33f3:	6a 01                	push   $0x1
+    33f5:	e8 76 30 00 00       	call   6470 <printf>
+      exit();
+    33fa:	e8 01 2b 00 00       	call   5f00 <exit>
+          printf(1, "write failed %d\n", n);
+    33ff:	52                   	push   %edx
+    3400:	50                   	push   %eax
+    3401:	68 a0 76 00 00       	push   $0x76a0
+    3406:	6a 01                	push   $0x1
+    3408:	e8 63 30 00 00       	call   6470 <printf>
+          exit();
+    340d:	e8 ee 2a 00 00       	call   5f00 <exit>
+    3412:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003420 <createdelete>:
+{
+    3420:	55                   	push   %ebp
+    3421:	89 e5                	mov    %esp,%ebp
+    3423:	57                   	push   %edi
+    3424:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    3425:	31 f6                	xor    %esi,%esi
+{
+    3427:	53                   	push   %ebx
+    3428:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    342b:	68 dc 76 00 00       	push   $0x76dc
+    3430:	6a 01                	push   $0x1
+    3432:	e8 39 30 00 00       	call   6470 <printf>
+    3437:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    343a:	e8 91 2a 00 00       	call   5ed0 <fork>
+    343f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    3441:	85 c0                	test   %eax,%eax
+    3443:	0f 88 ac 01 00 00    	js     35f5 <createdelete+0x1d5>
+    if(pid == 0){
+    3449:	0f 84 01 01 00 00    	je     3550 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    344f:	83 c6 01             	add    $0x1,%esi
+    3452:	83 fe 04             	cmp    $0x4,%esi
+    3455:	75 e3                	jne    343a <createdelete+0x1a>
+    wait();
+    3457:	e8 06 2b 00 00       	call   5f62 <wait>
+  for(i = 0; i < N; i++){
+    345c:	31 ff                	xor    %edi,%edi
+    345e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    3461:	e8 fc 2a 00 00       	call   5f62 <wait>
+    3466:	e8 f7 2a 00 00       	call   5f62 <wait>
+    346b:	e8 f2 2a 00 00       	call   5f62 <wait>
+  name[0] = name[1] = name[2] = 0;
+    3470:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    3474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    3478:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    347a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    347d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    3482:	0f 94 c2             	sete   %dl
+    3485:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    3488:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    348b:	0f 9f c0             	setg   %al
+    348e:	09 c2                	or     %eax,%edx
+    3490:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    3493:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    3497:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    349a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    349d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    34a0:	6a 00                	push   $0x0
+    34a2:	56                   	push   %esi
+    34a3:	e8 23 2b 00 00       	call   5fcb <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    34a8:	83 c4 10             	add    $0x10,%esp
+    34ab:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    34af:	74 7f                	je     3530 <createdelete+0x110>
+    34b1:	85 c0                	test   %eax,%eax
+    34b3:	0f 88 27 01 00 00    	js     35e0 <createdelete+0x1c0>
+        close(fd);
+    34b9:	83 ec 0c             	sub    $0xc,%esp
+    34bc:	50                   	push   %eax
+    34bd:	e8 dc 2a 00 00       	call   5f9e <close>
+    34c2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    34c5:	83 c3 01             	add    $0x1,%ebx
+    34c8:	80 fb 74             	cmp    $0x74,%bl
+    34cb:	75 c6                	jne    3493 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    34cd:	83 c7 01             	add    $0x1,%edi
+    34d0:	83 ff 14             	cmp    $0x14,%edi
+    34d3:	75 a3                	jne    3478 <createdelete+0x58>
+    34d5:	bf 70 00 00 00       	mov    $0x70,%edi
+    34da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    34e0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    34e3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    34e8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    34eb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    34ed:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    34f0:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    34f3:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    34f7:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    34fa:	56                   	push   %esi
+    34fb:	e8 e9 2a 00 00       	call   5fe9 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    3500:	83 c4 10             	add    $0x10,%esp
+    3503:	83 eb 01             	sub    $0x1,%ebx
+    3506:	75 e3                	jne    34eb <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    3508:	83 c7 01             	add    $0x1,%edi
+    350b:	89 f8                	mov    %edi,%eax
+    350d:	3c 84                	cmp    $0x84,%al
+    350f:	75 cf                	jne    34e0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    3511:	83 ec 08             	sub    $0x8,%esp
+    3514:	68 ef 76 00 00       	push   $0x76ef
+    3519:	6a 01                	push   $0x1
+    351b:	e8 50 2f 00 00       	call   6470 <printf>
+}
+    3520:	83 c4 10             	add    $0x10,%esp
+    3523:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3526:	5b                   	pop    %ebx
+    3527:	5e                   	pop    %esi
+    3528:	5f                   	pop    %edi
+    3529:	5d                   	pop    %ebp
+    352a:	c3                   	ret
+    352b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    352f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    3530:	85 c0                	test   %eax,%eax
+    3532:	78 91                	js     34c5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    3534:	50                   	push   %eax
+    3535:	56                   	push   %esi
+    3536:	68 9c 86 00 00       	push   $0x869c
+    353b:	6a 01                	push   $0x1
+    353d:	e8 2e 2f 00 00       	call   6470 <printf>
+        exit();
+    3542:	e8 b9 29 00 00       	call   5f00 <exit>
+    3547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    354e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    3550:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    3553:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    3557:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    355a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    355d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    3560:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    3563:	8d 43 30             	lea    0x30(%ebx),%eax
+    3566:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    3569:	68 02 02 00 00       	push   $0x202
+    356e:	56                   	push   %esi
+    356f:	e8 57 2a 00 00       	call   5fcb <open>
+        if(fd < 0){
+    3574:	83 c4 10             	add    $0x10,%esp
+    3577:	85 c0                	test   %eax,%eax
+    3579:	0f 88 8a 00 00 00    	js     3609 <createdelete+0x1e9>
+        close(fd);
+    357f:	83 ec 0c             	sub    $0xc,%esp
+    3582:	50                   	push   %eax
+    3583:	e8 16 2a 00 00       	call   5f9e <close>
+        if(i > 0 && (i % 2 ) == 0){
+    3588:	83 c4 10             	add    $0x10,%esp
+    358b:	85 db                	test   %ebx,%ebx
+    358d:	74 19                	je     35a8 <createdelete+0x188>
+    358f:	f6 c3 01             	test   $0x1,%bl
+    3592:	74 1b                	je     35af <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    3594:	83 c3 01             	add    $0x1,%ebx
+    3597:	83 fb 14             	cmp    $0x14,%ebx
+    359a:	75 c4                	jne    3560 <createdelete+0x140>
+      exit();
+    359c:	e8 5f 29 00 00       	call   5f00 <exit>
+    35a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    35a8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    35ad:	eb b1                	jmp    3560 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    35af:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    35b1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    35b4:	d1 f8                	sar    %eax
+    35b6:	83 c0 30             	add    $0x30,%eax
+    35b9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    35bc:	56                   	push   %esi
+    35bd:	e8 27 2a 00 00       	call   5fe9 <unlink>
+    35c2:	83 c4 10             	add    $0x10,%esp
+    35c5:	85 c0                	test   %eax,%eax
+    35c7:	79 cb                	jns    3594 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    35c9:	52                   	push   %edx
+    35ca:	52                   	push   %edx
+    35cb:	68 e1 6e 00 00       	push   $0x6ee1
+    35d0:	6a 01                	push   $0x1
+    35d2:	e8 99 2e 00 00       	call   6470 <printf>
+            exit();
+    35d7:	e8 24 29 00 00       	call   5f00 <exit>
+    35dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    35e0:	83 ec 04             	sub    $0x4,%esp
+    35e3:	56                   	push   %esi
+    35e4:	68 78 86 00 00       	push   $0x8678
+    35e9:	6a 01                	push   $0x1
+    35eb:	e8 80 2e 00 00       	call   6470 <printf>
+        exit();
+    35f0:	e8 0b 29 00 00       	call   5f00 <exit>
+      printf(1, "fork failed\n");
+    35f5:	83 ec 08             	sub    $0x8,%esp
+    35f8:	68 0b 82 00 00       	push   $0x820b
+    35fd:	6a 01                	push   $0x1
+    35ff:	e8 6c 2e 00 00       	call   6470 <printf>
+      exit();
+    3604:	e8 f7 28 00 00       	call   5f00 <exit>
+          printf(1, "create failed\n");
+    3609:	83 ec 08             	sub    $0x8,%esp
+    360c:	68 40 72 00 00       	push   $0x7240
+    3611:	6a 01                	push   $0x1
+    3613:	e8 58 2e 00 00       	call   6470 <printf>
+          exit();
+    3618:	e8 e3 28 00 00       	call   5f00 <exit>
+    361d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003620 <unlinkread>:
+{
+    3620:	55                   	push   %ebp
+    3621:	89 e5                	mov    %esp,%ebp
+    3623:	56                   	push   %esi
+    3624:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    3625:	83 ec 08             	sub    $0x8,%esp
+    3628:	68 00 77 00 00       	push   $0x7700
+    362d:	6a 01                	push   $0x1
+    362f:	e8 3c 2e 00 00       	call   6470 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    3634:	5b                   	pop    %ebx
+    3635:	5e                   	pop    %esi
+    3636:	68 02 02 00 00       	push   $0x202
+    363b:	68 11 77 00 00       	push   $0x7711
+    3640:	e8 86 29 00 00       	call   5fcb <open>
+  if(fd < 0){
+    3645:	83 c4 10             	add    $0x10,%esp
+    3648:	85 c0                	test   %eax,%eax
+    364a:	0f 88 e6 00 00 00    	js     3736 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    3650:	83 ec 04             	sub    $0x4,%esp
+    3653:	89 c3                	mov    %eax,%ebx
+    3655:	6a 05                	push   $0x5
+    3657:	68 c3 73 00 00       	push   $0x73c3
+    365c:	50                   	push   %eax
+    365d:	e8 2d 29 00 00       	call   5f8f <write>
+  close(fd);
+    3662:	89 1c 24             	mov    %ebx,(%esp)
+    3665:	e8 34 29 00 00       	call   5f9e <close>
+  fd = open("unlinkread", O_RDWR);
+    366a:	58                   	pop    %eax
+    366b:	5a                   	pop    %edx
+    366c:	6a 02                	push   $0x2
+    366e:	68 11 77 00 00       	push   $0x7711
+    3673:	e8 53 29 00 00       	call   5fcb <open>
+  if(fd < 0){
+    3678:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    367b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    367d:	85 c0                	test   %eax,%eax
+    367f:	0f 88 10 01 00 00    	js     3795 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    3685:	83 ec 0c             	sub    $0xc,%esp
+    3688:	68 11 77 00 00       	push   $0x7711
+    368d:	e8 57 29 00 00       	call   5fe9 <unlink>
+    3692:	83 c4 10             	add    $0x10,%esp
+    3695:	85 c0                	test   %eax,%eax
+    3697:	0f 85 e5 00 00 00    	jne    3782 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    369d:	83 ec 08             	sub    $0x8,%esp
+    36a0:	68 02 02 00 00       	push   $0x202
+    36a5:	68 11 77 00 00       	push   $0x7711
+    36aa:	e8 1c 29 00 00       	call   5fcb <open>
+  write(fd1, "yyy", 3);
+    36af:	83 c4 0c             	add    $0xc,%esp
+    36b2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    36b4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    36b6:	68 68 77 00 00       	push   $0x7768
+    36bb:	50                   	push   %eax
+    36bc:	e8 ce 28 00 00       	call   5f8f <write>
+  close(fd1);
+    36c1:	89 34 24             	mov    %esi,(%esp)
+    36c4:	e8 d5 28 00 00       	call   5f9e <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    36c9:	83 c4 0c             	add    $0xc,%esp
+    36cc:	68 00 20 00 00       	push   $0x2000
+    36d1:	68 c0 cc 00 00       	push   $0xccc0
+    36d6:	53                   	push   %ebx
+    36d7:	e8 a4 28 00 00       	call   5f80 <read>
+    36dc:	83 c4 10             	add    $0x10,%esp
+    36df:	83 f8 05             	cmp    $0x5,%eax
+    36e2:	0f 85 87 00 00 00    	jne    376f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    36e8:	80 3d c0 cc 00 00 68 	cmpb   $0x68,0xccc0
+    36ef:	75 6b                	jne    375c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    36f1:	83 ec 04             	sub    $0x4,%esp
+    36f4:	6a 0a                	push   $0xa
+    36f6:	68 c0 cc 00 00       	push   $0xccc0
+    36fb:	53                   	push   %ebx
+    36fc:	e8 8e 28 00 00       	call   5f8f <write>
+    3701:	83 c4 10             	add    $0x10,%esp
+    3704:	83 f8 0a             	cmp    $0xa,%eax
+    3707:	75 40                	jne    3749 <unlinkread+0x129>
+  close(fd);
+    3709:	83 ec 0c             	sub    $0xc,%esp
+    370c:	53                   	push   %ebx
+    370d:	e8 8c 28 00 00       	call   5f9e <close>
+  unlink("unlinkread");
+    3712:	c7 04 24 11 77 00 00 	movl   $0x7711,(%esp)
+    3719:	e8 cb 28 00 00       	call   5fe9 <unlink>
+  printf(1, "unlinkread ok\n");
+    371e:	58                   	pop    %eax
+    371f:	5a                   	pop    %edx
+    3720:	68 b3 77 00 00       	push   $0x77b3
+    3725:	6a 01                	push   $0x1
+    3727:	e8 44 2d 00 00       	call   6470 <printf>
+}
+    372c:	83 c4 10             	add    $0x10,%esp
+    372f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3732:	5b                   	pop    %ebx
+    3733:	5e                   	pop    %esi
+    3734:	5d                   	pop    %ebp
+    3735:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    3736:	51                   	push   %ecx
+    3737:	51                   	push   %ecx
+    3738:	68 1c 77 00 00       	push   $0x771c
+    373d:	6a 01                	push   $0x1
+    373f:	e8 2c 2d 00 00       	call   6470 <printf>
+    exit();
+    3744:	e8 b7 27 00 00       	call   5f00 <exit>
+    printf(1, "unlinkread write failed\n");
+    3749:	51                   	push   %ecx
+    374a:	51                   	push   %ecx
+    374b:	68 9a 77 00 00       	push   $0x779a
+    3750:	6a 01                	push   $0x1
+    3752:	e8 19 2d 00 00       	call   6470 <printf>
+    exit();
+    3757:	e8 a4 27 00 00       	call   5f00 <exit>
+    printf(1, "unlinkread wrong data\n");
+    375c:	53                   	push   %ebx
+    375d:	53                   	push   %ebx
+    375e:	68 83 77 00 00       	push   $0x7783
+    3763:	6a 01                	push   $0x1
+    3765:	e8 06 2d 00 00       	call   6470 <printf>
+    exit();
+    376a:	e8 91 27 00 00       	call   5f00 <exit>
+    printf(1, "unlinkread read failed");
+    376f:	56                   	push   %esi
+    3770:	56                   	push   %esi
+    3771:	68 6c 77 00 00       	push   $0x776c
+    3776:	6a 01                	push   $0x1
+    3778:	e8 f3 2c 00 00       	call   6470 <printf>
+    exit();
+    377d:	e8 7e 27 00 00       	call   5f00 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    3782:	50                   	push   %eax
+    3783:	50                   	push   %eax
+    3784:	68 4e 77 00 00       	push   $0x774e
+    3789:	6a 01                	push   $0x1
+    378b:	e8 e0 2c 00 00       	call   6470 <printf>
+    exit();
+    3790:	e8 6b 27 00 00       	call   5f00 <exit>
+    printf(1, "open unlinkread failed\n");
+    3795:	50                   	push   %eax
+    3796:	50                   	push   %eax
+    3797:	68 36 77 00 00       	push   $0x7736
+    379c:	6a 01                	push   $0x1
+    379e:	e8 cd 2c 00 00       	call   6470 <printf>
+    exit();
+    37a3:	e8 58 27 00 00       	call   5f00 <exit>
+    37a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37af:	90                   	nop
+
+000037b0 <linktest>:
+{
+    37b0:	55                   	push   %ebp
+    37b1:	89 e5                	mov    %esp,%ebp
+    37b3:	53                   	push   %ebx
+    37b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    37b7:	68 c2 77 00 00       	push   $0x77c2
+    37bc:	6a 01                	push   $0x1
+    37be:	e8 ad 2c 00 00       	call   6470 <printf>
+  unlink("lf1");
+    37c3:	c7 04 24 cc 77 00 00 	movl   $0x77cc,(%esp)
+    37ca:	e8 1a 28 00 00       	call   5fe9 <unlink>
+  unlink("lf2");
+    37cf:	c7 04 24 d0 77 00 00 	movl   $0x77d0,(%esp)
+    37d6:	e8 0e 28 00 00       	call   5fe9 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    37db:	58                   	pop    %eax
+    37dc:	5a                   	pop    %edx
+    37dd:	68 02 02 00 00       	push   $0x202
+    37e2:	68 cc 77 00 00       	push   $0x77cc
+    37e7:	e8 df 27 00 00       	call   5fcb <open>
+  if(fd < 0){
+    37ec:	83 c4 10             	add    $0x10,%esp
+    37ef:	85 c0                	test   %eax,%eax
+    37f1:	0f 88 1e 01 00 00    	js     3915 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    37f7:	83 ec 04             	sub    $0x4,%esp
+    37fa:	89 c3                	mov    %eax,%ebx
+    37fc:	6a 05                	push   $0x5
+    37fe:	68 c3 73 00 00       	push   $0x73c3
+    3803:	50                   	push   %eax
+    3804:	e8 86 27 00 00       	call   5f8f <write>
+    3809:	83 c4 10             	add    $0x10,%esp
+    380c:	83 f8 05             	cmp    $0x5,%eax
+    380f:	0f 85 98 01 00 00    	jne    39ad <linktest+0x1fd>
+  close(fd);
+    3815:	83 ec 0c             	sub    $0xc,%esp
+    3818:	53                   	push   %ebx
+    3819:	e8 80 27 00 00       	call   5f9e <close>
+  if(link("lf1", "lf2") < 0){
+    381e:	5b                   	pop    %ebx
+    381f:	58                   	pop    %eax
+    3820:	68 d0 77 00 00       	push   $0x77d0
+    3825:	68 cc 77 00 00       	push   $0x77cc
+    382a:	e8 d8 27 00 00       	call   6007 <link>
+    382f:	83 c4 10             	add    $0x10,%esp
+    3832:	85 c0                	test   %eax,%eax
+    3834:	0f 88 60 01 00 00    	js     399a <linktest+0x1ea>
+  unlink("lf1");
+    383a:	83 ec 0c             	sub    $0xc,%esp
+    383d:	68 cc 77 00 00       	push   $0x77cc
+    3842:	e8 a2 27 00 00       	call   5fe9 <unlink>
+  if(open("lf1", 0) >= 0){
+    3847:	58                   	pop    %eax
+    3848:	5a                   	pop    %edx
+    3849:	6a 00                	push   $0x0
+    384b:	68 cc 77 00 00       	push   $0x77cc
+    3850:	e8 76 27 00 00       	call   5fcb <open>
+    3855:	83 c4 10             	add    $0x10,%esp
+    3858:	85 c0                	test   %eax,%eax
+    385a:	0f 89 27 01 00 00    	jns    3987 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    3860:	83 ec 08             	sub    $0x8,%esp
+    3863:	6a 00                	push   $0x0
+    3865:	68 d0 77 00 00       	push   $0x77d0
+    386a:	e8 5c 27 00 00       	call   5fcb <open>
+  if(fd < 0){
+    386f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    3872:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3874:	85 c0                	test   %eax,%eax
+    3876:	0f 88 f8 00 00 00    	js     3974 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    387c:	83 ec 04             	sub    $0x4,%esp
+    387f:	68 00 20 00 00       	push   $0x2000
+    3884:	68 c0 cc 00 00       	push   $0xccc0
+    3889:	50                   	push   %eax
+    388a:	e8 f1 26 00 00       	call   5f80 <read>
+    388f:	83 c4 10             	add    $0x10,%esp
+    3892:	83 f8 05             	cmp    $0x5,%eax
+    3895:	0f 85 c6 00 00 00    	jne    3961 <linktest+0x1b1>
+  close(fd);
+    389b:	83 ec 0c             	sub    $0xc,%esp
+    389e:	53                   	push   %ebx
+    389f:	e8 fa 26 00 00       	call   5f9e <close>
+  if(link("lf2", "lf2") >= 0){
+    38a4:	58                   	pop    %eax
+    38a5:	5a                   	pop    %edx
+    38a6:	68 d0 77 00 00       	push   $0x77d0
+    38ab:	68 d0 77 00 00       	push   $0x77d0
+    38b0:	e8 52 27 00 00       	call   6007 <link>
+    38b5:	83 c4 10             	add    $0x10,%esp
+    38b8:	85 c0                	test   %eax,%eax
+    38ba:	0f 89 8e 00 00 00    	jns    394e <linktest+0x19e>
+  unlink("lf2");
+    38c0:	83 ec 0c             	sub    $0xc,%esp
+    38c3:	68 d0 77 00 00       	push   $0x77d0
+    38c8:	e8 1c 27 00 00       	call   5fe9 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    38cd:	59                   	pop    %ecx
+    38ce:	5b                   	pop    %ebx
+    38cf:	68 cc 77 00 00       	push   $0x77cc
+    38d4:	68 d0 77 00 00       	push   $0x77d0
+    38d9:	e8 29 27 00 00       	call   6007 <link>
+    38de:	83 c4 10             	add    $0x10,%esp
+    38e1:	85 c0                	test   %eax,%eax
+    38e3:	79 56                	jns    393b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    38e5:	83 ec 08             	sub    $0x8,%esp
+    38e8:	68 cc 77 00 00       	push   $0x77cc
+    38ed:	68 94 7a 00 00       	push   $0x7a94
+    38f2:	e8 10 27 00 00       	call   6007 <link>
+    38f7:	83 c4 10             	add    $0x10,%esp
+    38fa:	85 c0                	test   %eax,%eax
+    38fc:	79 2a                	jns    3928 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    38fe:	83 ec 08             	sub    $0x8,%esp
+    3901:	68 6a 78 00 00       	push   $0x786a
+    3906:	6a 01                	push   $0x1
+    3908:	e8 63 2b 00 00       	call   6470 <printf>
+}
+    390d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3910:	83 c4 10             	add    $0x10,%esp
+    3913:	c9                   	leave
+    3914:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    3915:	50                   	push   %eax
+    3916:	50                   	push   %eax
+    3917:	68 d4 77 00 00       	push   $0x77d4
+    391c:	6a 01                	push   $0x1
+    391e:	e8 4d 2b 00 00       	call   6470 <printf>
+    exit();
+    3923:	e8 d8 25 00 00       	call   5f00 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    3928:	50                   	push   %eax
+    3929:	50                   	push   %eax
+    392a:	68 4e 78 00 00       	push   $0x784e
+    392f:	6a 01                	push   $0x1
+    3931:	e8 3a 2b 00 00       	call   6470 <printf>
+    exit();
+    3936:	e8 c5 25 00 00       	call   5f00 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    393b:	52                   	push   %edx
+    393c:	52                   	push   %edx
+    393d:	68 e4 86 00 00       	push   $0x86e4
+    3942:	6a 01                	push   $0x1
+    3944:	e8 27 2b 00 00       	call   6470 <printf>
+    exit();
+    3949:	e8 b2 25 00 00       	call   5f00 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    394e:	50                   	push   %eax
+    394f:	50                   	push   %eax
+    3950:	68 30 78 00 00       	push   $0x7830
+    3955:	6a 01                	push   $0x1
+    3957:	e8 14 2b 00 00       	call   6470 <printf>
+    exit();
+    395c:	e8 9f 25 00 00       	call   5f00 <exit>
+    printf(1, "read lf2 failed\n");
+    3961:	51                   	push   %ecx
+    3962:	51                   	push   %ecx
+    3963:	68 1f 78 00 00       	push   $0x781f
+    3968:	6a 01                	push   $0x1
+    396a:	e8 01 2b 00 00       	call   6470 <printf>
+    exit();
+    396f:	e8 8c 25 00 00       	call   5f00 <exit>
+    printf(1, "open lf2 failed\n");
+    3974:	53                   	push   %ebx
+    3975:	53                   	push   %ebx
+    3976:	68 0e 78 00 00       	push   $0x780e
+    397b:	6a 01                	push   $0x1
+    397d:	e8 ee 2a 00 00       	call   6470 <printf>
+    exit();
+    3982:	e8 79 25 00 00       	call   5f00 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    3987:	50                   	push   %eax
+    3988:	50                   	push   %eax
+    3989:	68 bc 86 00 00       	push   $0x86bc
+    398e:	6a 01                	push   $0x1
+    3990:	e8 db 2a 00 00       	call   6470 <printf>
+    exit();
+    3995:	e8 66 25 00 00       	call   5f00 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    399a:	51                   	push   %ecx
+    399b:	51                   	push   %ecx
+    399c:	68 f9 77 00 00       	push   $0x77f9
+    39a1:	6a 01                	push   $0x1
+    39a3:	e8 c8 2a 00 00       	call   6470 <printf>
+    exit();
+    39a8:	e8 53 25 00 00       	call   5f00 <exit>
+    printf(1, "write lf1 failed\n");
+    39ad:	50                   	push   %eax
+    39ae:	50                   	push   %eax
+    39af:	68 e7 77 00 00       	push   $0x77e7
+    39b4:	6a 01                	push   $0x1
+    39b6:	e8 b5 2a 00 00       	call   6470 <printf>
+    exit();
+    39bb:	e8 40 25 00 00       	call   5f00 <exit>
+
+000039c0 <concreate>:
+{
+    39c0:	55                   	push   %ebp
+    39c1:	89 e5                	mov    %esp,%ebp
+    39c3:	57                   	push   %edi
+    39c4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    39c5:	31 f6                	xor    %esi,%esi
+{
+    39c7:	53                   	push   %ebx
+    39c8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    39cb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    39ce:	68 77 78 00 00       	push   $0x7877
+    39d3:	6a 01                	push   $0x1
+    39d5:	e8 96 2a 00 00       	call   6470 <printf>
+  file[0] = 'C';
+    39da:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    39de:	83 c4 10             	add    $0x10,%esp
+    39e1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    39e5:	eb 4c                	jmp    3a33 <concreate+0x73>
+    39e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39ee:	66 90                	xchg   %ax,%ax
+    39f0:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    39f6:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    39fb:	0f 83 8f 00 00 00    	jae    3a90 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    3a01:	83 ec 08             	sub    $0x8,%esp
+    3a04:	68 02 02 00 00       	push   $0x202
+    3a09:	53                   	push   %ebx
+    3a0a:	e8 bc 25 00 00       	call   5fcb <open>
+      if(fd < 0){
+    3a0f:	83 c4 10             	add    $0x10,%esp
+    3a12:	85 c0                	test   %eax,%eax
+    3a14:	78 63                	js     3a79 <concreate+0xb9>
+      close(fd);
+    3a16:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    3a19:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    3a1c:	50                   	push   %eax
+    3a1d:	e8 7c 25 00 00       	call   5f9e <close>
+    3a22:	83 c4 10             	add    $0x10,%esp
+      wait();
+    3a25:	e8 38 25 00 00       	call   5f62 <wait>
+  for(i = 0; i < 40; i++){
+    3a2a:	83 fe 28             	cmp    $0x28,%esi
+    3a2d:	0f 84 7f 00 00 00    	je     3ab2 <concreate+0xf2>
+    unlink(file);
+    3a33:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    3a36:	8d 46 30             	lea    0x30(%esi),%eax
+    3a39:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    3a3c:	53                   	push   %ebx
+    3a3d:	e8 a7 25 00 00       	call   5fe9 <unlink>
+    pid = fork();
+    3a42:	e8 89 24 00 00       	call   5ed0 <fork>
+    if(pid && (i % 3) == 1){
+    3a47:	83 c4 10             	add    $0x10,%esp
+    3a4a:	85 c0                	test   %eax,%eax
+    3a4c:	75 a2                	jne    39f0 <concreate+0x30>
+      link("C0", file);
+    3a4e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    3a54:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    3a5a:	0f 83 d0 00 00 00    	jae    3b30 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    3a60:	83 ec 08             	sub    $0x8,%esp
+    3a63:	68 02 02 00 00       	push   $0x202
+    3a68:	53                   	push   %ebx
+    3a69:	e8 5d 25 00 00       	call   5fcb <open>
+      if(fd < 0){
+    3a6e:	83 c4 10             	add    $0x10,%esp
+    3a71:	85 c0                	test   %eax,%eax
+    3a73:	0f 89 ea 01 00 00    	jns    3c63 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    3a79:	83 ec 04             	sub    $0x4,%esp
+    3a7c:	53                   	push   %ebx
+    3a7d:	68 8a 78 00 00       	push   $0x788a
+    3a82:	6a 01                	push   $0x1
+    3a84:	e8 e7 29 00 00       	call   6470 <printf>
+        exit();
+    3a89:	e8 72 24 00 00       	call   5f00 <exit>
+    3a8e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    3a90:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    3a93:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    3a96:	53                   	push   %ebx
+    3a97:	68 87 78 00 00       	push   $0x7887
+    3a9c:	e8 66 25 00 00       	call   6007 <link>
+    3aa1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    3aa4:	e8 b9 24 00 00       	call   5f62 <wait>
+  for(i = 0; i < 40; i++){
+    3aa9:	83 fe 28             	cmp    $0x28,%esi
+    3aac:	0f 85 81 ff ff ff    	jne    3a33 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    3ab2:	83 ec 04             	sub    $0x4,%esp
+    3ab5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    3ab8:	6a 28                	push   $0x28
+    3aba:	6a 00                	push   $0x0
+    3abc:	50                   	push   %eax
+    3abd:	e8 1e 22 00 00       	call   5ce0 <memset>
+  fd = open(".", 0);
+    3ac2:	5e                   	pop    %esi
+    3ac3:	5f                   	pop    %edi
+    3ac4:	6a 00                	push   $0x0
+    3ac6:	68 94 7a 00 00       	push   $0x7a94
+    3acb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    3ace:	e8 f8 24 00 00       	call   5fcb <open>
+  n = 0;
+    3ad3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    3ada:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    3add:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    3adf:	90                   	nop
+    3ae0:	83 ec 04             	sub    $0x4,%esp
+    3ae3:	6a 10                	push   $0x10
+    3ae5:	57                   	push   %edi
+    3ae6:	56                   	push   %esi
+    3ae7:	e8 94 24 00 00       	call   5f80 <read>
+    3aec:	83 c4 10             	add    $0x10,%esp
+    3aef:	85 c0                	test   %eax,%eax
+    3af1:	7e 5d                	jle    3b50 <concreate+0x190>
+    if(de.inum == 0)
+    3af3:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    3af8:	74 e6                	je     3ae0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    3afa:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    3afe:	75 e0                	jne    3ae0 <concreate+0x120>
+    3b00:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    3b04:	75 da                	jne    3ae0 <concreate+0x120>
+      i = de.name[1] - '0';
+    3b06:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    3b0a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    3b0d:	83 f8 27             	cmp    $0x27,%eax
+    3b10:	0f 87 5e 01 00 00    	ja     3c74 <concreate+0x2b4>
+      if(fa[i]){
+    3b16:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    3b1b:	0f 85 7e 01 00 00    	jne    3c9f <concreate+0x2df>
+      n++;
+    3b21:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    3b25:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    3b2a:	eb b4                	jmp    3ae0 <concreate+0x120>
+    3b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    3b30:	83 ec 08             	sub    $0x8,%esp
+    3b33:	53                   	push   %ebx
+    3b34:	68 87 78 00 00       	push   $0x7887
+    3b39:	e8 c9 24 00 00       	call   6007 <link>
+    3b3e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b41:	e8 ba 23 00 00       	call   5f00 <exit>
+    3b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b4d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    3b50:	83 ec 0c             	sub    $0xc,%esp
+    3b53:	56                   	push   %esi
+    3b54:	e8 45 24 00 00       	call   5f9e <close>
+  if(n != 40){
+    3b59:	83 c4 10             	add    $0x10,%esp
+    3b5c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    3b60:	0f 85 26 01 00 00    	jne    3c8c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    3b66:	31 f6                	xor    %esi,%esi
+    3b68:	eb 48                	jmp    3bb2 <concreate+0x1f2>
+    3b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    3b70:	85 ff                	test   %edi,%edi
+    3b72:	74 05                	je     3b79 <concreate+0x1b9>
+    3b74:	83 f8 01             	cmp    $0x1,%eax
+    3b77:	74 68                	je     3be1 <concreate+0x221>
+      unlink(file);
+    3b79:	83 ec 0c             	sub    $0xc,%esp
+    3b7c:	53                   	push   %ebx
+    3b7d:	e8 67 24 00 00       	call   5fe9 <unlink>
+      unlink(file);
+    3b82:	89 1c 24             	mov    %ebx,(%esp)
+    3b85:	e8 5f 24 00 00       	call   5fe9 <unlink>
+      unlink(file);
+    3b8a:	89 1c 24             	mov    %ebx,(%esp)
+    3b8d:	e8 57 24 00 00       	call   5fe9 <unlink>
+      unlink(file);
+    3b92:	89 1c 24             	mov    %ebx,(%esp)
+    3b95:	e8 4f 24 00 00       	call   5fe9 <unlink>
+    3b9a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    3b9d:	85 ff                	test   %edi,%edi
+    3b9f:	74 a0                	je     3b41 <concreate+0x181>
+      wait();
+    3ba1:	e8 bc 23 00 00       	call   5f62 <wait>
+  for(i = 0; i < 40; i++){
+    3ba6:	83 c6 01             	add    $0x1,%esi
+    3ba9:	83 fe 28             	cmp    $0x28,%esi
+    3bac:	0f 84 86 00 00 00    	je     3c38 <concreate+0x278>
+    file[1] = '0' + i;
+    3bb2:	8d 46 30             	lea    0x30(%esi),%eax
+    3bb5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    3bb8:	e8 13 23 00 00       	call   5ed0 <fork>
+    3bbd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    3bbf:	85 c0                	test   %eax,%eax
+    3bc1:	0f 88 88 00 00 00    	js     3c4f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    3bc7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    3bcc:	f7 e6                	mul    %esi
+    3bce:	89 d0                	mov    %edx,%eax
+    3bd0:	83 e2 fe             	and    $0xfffffffe,%edx
+    3bd3:	d1 e8                	shr    %eax
+    3bd5:	01 c2                	add    %eax,%edx
+    3bd7:	89 f0                	mov    %esi,%eax
+    3bd9:	29 d0                	sub    %edx,%eax
+    3bdb:	89 c1                	mov    %eax,%ecx
+    3bdd:	09 f9                	or     %edi,%ecx
+    3bdf:	75 8f                	jne    3b70 <concreate+0x1b0>
+      close(open(file, 0));
+    3be1:	83 ec 08             	sub    $0x8,%esp
+    3be4:	6a 00                	push   $0x0
+    3be6:	53                   	push   %ebx
+    3be7:	e8 df 23 00 00       	call   5fcb <open>
+    3bec:	89 04 24             	mov    %eax,(%esp)
+    3bef:	e8 aa 23 00 00       	call   5f9e <close>
+      close(open(file, 0));
+    3bf4:	58                   	pop    %eax
+    3bf5:	5a                   	pop    %edx
+    3bf6:	6a 00                	push   $0x0
+    3bf8:	53                   	push   %ebx
+    3bf9:	e8 cd 23 00 00       	call   5fcb <open>
+    3bfe:	89 04 24             	mov    %eax,(%esp)
+    3c01:	e8 98 23 00 00       	call   5f9e <close>
+      close(open(file, 0));
+    3c06:	59                   	pop    %ecx
+    3c07:	58                   	pop    %eax
+    3c08:	6a 00                	push   $0x0
+    3c0a:	53                   	push   %ebx
+    3c0b:	e8 bb 23 00 00       	call   5fcb <open>
+    3c10:	89 04 24             	mov    %eax,(%esp)
+    3c13:	e8 86 23 00 00       	call   5f9e <close>
+      close(open(file, 0));
+    3c18:	58                   	pop    %eax
+    3c19:	5a                   	pop    %edx
+    3c1a:	6a 00                	push   $0x0
+    3c1c:	53                   	push   %ebx
+    3c1d:	e8 a9 23 00 00       	call   5fcb <open>
+    3c22:	89 04 24             	mov    %eax,(%esp)
+    3c25:	e8 74 23 00 00       	call   5f9e <close>
+    3c2a:	83 c4 10             	add    $0x10,%esp
+    3c2d:	e9 6b ff ff ff       	jmp    3b9d <concreate+0x1dd>
+    3c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    3c38:	83 ec 08             	sub    $0x8,%esp
+    3c3b:	68 dc 78 00 00       	push   $0x78dc
+    3c40:	6a 01                	push   $0x1
+    3c42:	e8 29 28 00 00       	call   6470 <printf>
+}
+    3c47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c4a:	5b                   	pop    %ebx
+    3c4b:	5e                   	pop    %esi
+    3c4c:	5f                   	pop    %edi
+    3c4d:	5d                   	pop    %ebp
+    3c4e:	c3                   	ret
+      printf(1, "fork failed\n");
+    3c4f:	83 ec 08             	sub    $0x8,%esp
+    3c52:	68 0b 82 00 00       	push   $0x820b
+    3c57:	6a 01                	push   $0x1
+    3c59:	e8 12 28 00 00       	call   6470 <printf>
+      exit();
+    3c5e:	e8 9d 22 00 00       	call   5f00 <exit>
+      close(fd);
+    3c63:	83 ec 0c             	sub    $0xc,%esp
+    3c66:	50                   	push   %eax
+    3c67:	e8 32 23 00 00       	call   5f9e <close>
+    3c6c:	83 c4 10             	add    $0x10,%esp
+    3c6f:	e9 cd fe ff ff       	jmp    3b41 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    3c74:	83 ec 04             	sub    $0x4,%esp
+    3c77:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    3c7a:	50                   	push   %eax
+    3c7b:	68 a6 78 00 00       	push   $0x78a6
+    3c80:	6a 01                	push   $0x1
+    3c82:	e8 e9 27 00 00       	call   6470 <printf>
+        exit();
+    3c87:	e8 74 22 00 00       	call   5f00 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    3c8c:	51                   	push   %ecx
+    3c8d:	51                   	push   %ecx
+    3c8e:	68 08 87 00 00       	push   $0x8708
+    3c93:	6a 01                	push   $0x1
+    3c95:	e8 d6 27 00 00       	call   6470 <printf>
+    exit();
+    3c9a:	e8 61 22 00 00       	call   5f00 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    3c9f:	83 ec 04             	sub    $0x4,%esp
+    3ca2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    3ca5:	50                   	push   %eax
+    3ca6:	68 bf 78 00 00       	push   $0x78bf
+    3cab:	6a 01                	push   $0x1
+    3cad:	e8 be 27 00 00       	call   6470 <printf>
+        exit();
+    3cb2:	e8 49 22 00 00       	call   5f00 <exit>
+    3cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cbe:	66 90                	xchg   %ax,%ax
+
+00003cc0 <linkunlink>:
+{
+    3cc0:	55                   	push   %ebp
+    3cc1:	89 e5                	mov    %esp,%ebp
+    3cc3:	57                   	push   %edi
+    3cc4:	56                   	push   %esi
+    3cc5:	53                   	push   %ebx
+    3cc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    3cc9:	68 ea 78 00 00       	push   $0x78ea
+    3cce:	6a 01                	push   $0x1
+    3cd0:	e8 9b 27 00 00       	call   6470 <printf>
+  unlink("x");
+    3cd5:	c7 04 24 77 7b 00 00 	movl   $0x7b77,(%esp)
+    3cdc:	e8 08 23 00 00       	call   5fe9 <unlink>
+  pid = fork();
+    3ce1:	e8 ea 21 00 00       	call   5ed0 <fork>
+  if(pid < 0){
+    3ce6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3ce9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    3cec:	85 c0                	test   %eax,%eax
+    3cee:	0f 88 b6 00 00 00    	js     3daa <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    3cf4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    3cf8:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    3cfd:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    3d02:	19 ff                	sbb    %edi,%edi
+    3d04:	83 e7 60             	and    $0x60,%edi
+    3d07:	83 c7 01             	add    $0x1,%edi
+    3d0a:	eb 1e                	jmp    3d2a <linkunlink+0x6a>
+    3d0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    3d10:	83 f8 01             	cmp    $0x1,%eax
+    3d13:	74 7b                	je     3d90 <linkunlink+0xd0>
+      unlink("x");
+    3d15:	83 ec 0c             	sub    $0xc,%esp
+    3d18:	68 77 7b 00 00       	push   $0x7b77
+    3d1d:	e8 c7 22 00 00       	call   5fe9 <unlink>
+    3d22:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    3d25:	83 eb 01             	sub    $0x1,%ebx
+    3d28:	74 41                	je     3d6b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    3d2a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    3d30:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    3d36:	89 f8                	mov    %edi,%eax
+    3d38:	f7 e6                	mul    %esi
+    3d3a:	89 d0                	mov    %edx,%eax
+    3d3c:	83 e2 fe             	and    $0xfffffffe,%edx
+    3d3f:	d1 e8                	shr    %eax
+    3d41:	01 c2                	add    %eax,%edx
+    3d43:	89 f8                	mov    %edi,%eax
+    3d45:	29 d0                	sub    %edx,%eax
+    3d47:	75 c7                	jne    3d10 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    3d49:	83 ec 08             	sub    $0x8,%esp
+    3d4c:	68 02 02 00 00       	push   $0x202
+    3d51:	68 77 7b 00 00       	push   $0x7b77
+    3d56:	e8 70 22 00 00       	call   5fcb <open>
+    3d5b:	89 04 24             	mov    %eax,(%esp)
+    3d5e:	e8 3b 22 00 00       	call   5f9e <close>
+    3d63:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    3d66:	83 eb 01             	sub    $0x1,%ebx
+    3d69:	75 bf                	jne    3d2a <linkunlink+0x6a>
+  if(pid)
+    3d6b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3d6e:	85 c0                	test   %eax,%eax
+    3d70:	74 4b                	je     3dbd <linkunlink+0xfd>
+    wait();
+    3d72:	e8 eb 21 00 00       	call   5f62 <wait>
+  printf(1, "linkunlink ok\n");
+    3d77:	83 ec 08             	sub    $0x8,%esp
+    3d7a:	68 ff 78 00 00       	push   $0x78ff
+    3d7f:	6a 01                	push   $0x1
+    3d81:	e8 ea 26 00 00       	call   6470 <printf>
+}
+    3d86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3d89:	5b                   	pop    %ebx
+    3d8a:	5e                   	pop    %esi
+    3d8b:	5f                   	pop    %edi
+    3d8c:	5d                   	pop    %ebp
+    3d8d:	c3                   	ret
+    3d8e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    3d90:	83 ec 08             	sub    $0x8,%esp
+    3d93:	68 77 7b 00 00       	push   $0x7b77
+    3d98:	68 fb 78 00 00       	push   $0x78fb
+    3d9d:	e8 65 22 00 00       	call   6007 <link>
+    3da2:	83 c4 10             	add    $0x10,%esp
+    3da5:	e9 7b ff ff ff       	jmp    3d25 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    3daa:	52                   	push   %edx
+    3dab:	52                   	push   %edx
+    3dac:	68 0b 82 00 00       	push   $0x820b
+    3db1:	6a 01                	push   $0x1
+    3db3:	e8 b8 26 00 00       	call   6470 <printf>
+    exit();
+    3db8:	e8 43 21 00 00       	call   5f00 <exit>
+    exit();
+    3dbd:	e8 3e 21 00 00       	call   5f00 <exit>
+    3dc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003dd0 <bigdir>:
+{
+    3dd0:	55                   	push   %ebp
+    3dd1:	89 e5                	mov    %esp,%ebp
+    3dd3:	57                   	push   %edi
+    3dd4:	56                   	push   %esi
+    3dd5:	53                   	push   %ebx
+    3dd6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    3dd9:	68 0e 79 00 00       	push   $0x790e
+    3dde:	6a 01                	push   $0x1
+    3de0:	e8 8b 26 00 00       	call   6470 <printf>
+  unlink("bd");
+    3de5:	c7 04 24 1b 79 00 00 	movl   $0x791b,(%esp)
+    3dec:	e8 f8 21 00 00       	call   5fe9 <unlink>
+  fd = open("bd", O_CREATE);
+    3df1:	5a                   	pop    %edx
+    3df2:	59                   	pop    %ecx
+    3df3:	68 00 02 00 00       	push   $0x200
+    3df8:	68 1b 79 00 00       	push   $0x791b
+    3dfd:	e8 c9 21 00 00       	call   5fcb <open>
+  if(fd < 0){
+    3e02:	83 c4 10             	add    $0x10,%esp
+    3e05:	85 c0                	test   %eax,%eax
+    3e07:	0f 88 de 00 00 00    	js     3eeb <bigdir+0x11b>
+  close(fd);
+    3e0d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    3e10:	31 f6                	xor    %esi,%esi
+    3e12:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    3e15:	50                   	push   %eax
+    3e16:	e8 83 21 00 00       	call   5f9e <close>
+    3e1b:	83 c4 10             	add    $0x10,%esp
+    3e1e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    3e20:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    3e22:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    3e25:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    3e29:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    3e2c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    3e30:	83 c0 30             	add    $0x30,%eax
+    3e33:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    3e36:	89 f0                	mov    %esi,%eax
+    3e38:	83 e0 3f             	and    $0x3f,%eax
+    3e3b:	83 c0 30             	add    $0x30,%eax
+    3e3e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    3e41:	57                   	push   %edi
+    3e42:	68 1b 79 00 00       	push   $0x791b
+    3e47:	e8 bb 21 00 00       	call   6007 <link>
+    3e4c:	83 c4 10             	add    $0x10,%esp
+    3e4f:	89 c3                	mov    %eax,%ebx
+    3e51:	85 c0                	test   %eax,%eax
+    3e53:	75 6e                	jne    3ec3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    3e55:	83 c6 01             	add    $0x1,%esi
+    3e58:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    3e5e:	75 c0                	jne    3e20 <bigdir+0x50>
+  unlink("bd");
+    3e60:	83 ec 0c             	sub    $0xc,%esp
+    3e63:	68 1b 79 00 00       	push   $0x791b
+    3e68:	e8 7c 21 00 00       	call   5fe9 <unlink>
+    3e6d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    3e70:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    3e72:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    3e75:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    3e79:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    3e7c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    3e80:	83 c0 30             	add    $0x30,%eax
+    3e83:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    3e86:	89 d8                	mov    %ebx,%eax
+    3e88:	83 e0 3f             	and    $0x3f,%eax
+    3e8b:	83 c0 30             	add    $0x30,%eax
+    3e8e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    3e91:	57                   	push   %edi
+    3e92:	e8 52 21 00 00       	call   5fe9 <unlink>
+    3e97:	83 c4 10             	add    $0x10,%esp
+    3e9a:	85 c0                	test   %eax,%eax
+    3e9c:	75 39                	jne    3ed7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    3e9e:	83 c3 01             	add    $0x1,%ebx
+    3ea1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    3ea7:	75 c7                	jne    3e70 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    3ea9:	83 ec 08             	sub    $0x8,%esp
+    3eac:	68 5d 79 00 00       	push   $0x795d
+    3eb1:	6a 01                	push   $0x1
+    3eb3:	e8 b8 25 00 00       	call   6470 <printf>
+    3eb8:	83 c4 10             	add    $0x10,%esp
+}
+    3ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3ebe:	5b                   	pop    %ebx
+    3ebf:	5e                   	pop    %esi
+    3ec0:	5f                   	pop    %edi
+    3ec1:	5d                   	pop    %ebp
+    3ec2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    3ec3:	83 ec 08             	sub    $0x8,%esp
+    3ec6:	68 34 79 00 00       	push   $0x7934
+    3ecb:	6a 01                	push   $0x1
+    3ecd:	e8 9e 25 00 00       	call   6470 <printf>
+      exit();
+    3ed2:	e8 29 20 00 00       	call   5f00 <exit>
+      printf(1, "bigdir unlink failed");
+    3ed7:	83 ec 08             	sub    $0x8,%esp
+    3eda:	68 48 79 00 00       	push   $0x7948
+    3edf:	6a 01                	push   $0x1
+    3ee1:	e8 8a 25 00 00       	call   6470 <printf>
+      exit();
+    3ee6:	e8 15 20 00 00       	call   5f00 <exit>
+    printf(1, "bigdir create failed\n");
+    3eeb:	50                   	push   %eax
+    3eec:	50                   	push   %eax
+    3eed:	68 1e 79 00 00       	push   $0x791e
+    3ef2:	6a 01                	push   $0x1
+    3ef4:	e8 77 25 00 00       	call   6470 <printf>
+    exit();
+    3ef9:	e8 02 20 00 00       	call   5f00 <exit>
+    3efe:	66 90                	xchg   %ax,%ax
+
+00003f00 <subdir>:
+{
+    3f00:	55                   	push   %ebp
+    3f01:	89 e5                	mov    %esp,%ebp
+    3f03:	53                   	push   %ebx
+    3f04:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    3f07:	68 68 79 00 00       	push   $0x7968
+    3f0c:	6a 01                	push   $0x1
+    3f0e:	e8 5d 25 00 00       	call   6470 <printf>
+  unlink("ff");
+    3f13:	c7 04 24 f1 79 00 00 	movl   $0x79f1,(%esp)
+    3f1a:	e8 ca 20 00 00       	call   5fe9 <unlink>
+  if(mkdir("dd") != 0){
+    3f1f:	c7 04 24 8e 7a 00 00 	movl   $0x7a8e,(%esp)
+    3f26:	e8 eb 20 00 00       	call   6016 <mkdir>
+    3f2b:	83 c4 10             	add    $0x10,%esp
+    3f2e:	85 c0                	test   %eax,%eax
+    3f30:	0f 85 b3 05 00 00    	jne    44e9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    3f36:	83 ec 08             	sub    $0x8,%esp
+    3f39:	68 02 02 00 00       	push   $0x202
+    3f3e:	68 c7 79 00 00       	push   $0x79c7
+    3f43:	e8 83 20 00 00       	call   5fcb <open>
+  if(fd < 0){
+    3f48:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    3f4b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3f4d:	85 c0                	test   %eax,%eax
+    3f4f:	0f 88 81 05 00 00    	js     44d6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    3f55:	83 ec 04             	sub    $0x4,%esp
+    3f58:	6a 02                	push   $0x2
+    3f5a:	68 f1 79 00 00       	push   $0x79f1
+    3f5f:	50                   	push   %eax
+    3f60:	e8 2a 20 00 00       	call   5f8f <write>
+  close(fd);
+    3f65:	89 1c 24             	mov    %ebx,(%esp)
+    3f68:	e8 31 20 00 00       	call   5f9e <close>
+  if(unlink("dd") >= 0){
+    3f6d:	c7 04 24 8e 7a 00 00 	movl   $0x7a8e,(%esp)
+    3f74:	e8 70 20 00 00       	call   5fe9 <unlink>
+    3f79:	83 c4 10             	add    $0x10,%esp
+    3f7c:	85 c0                	test   %eax,%eax
+    3f7e:	0f 89 3f 05 00 00    	jns    44c3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    3f84:	83 ec 0c             	sub    $0xc,%esp
+    3f87:	68 a2 79 00 00       	push   $0x79a2
+    3f8c:	e8 85 20 00 00       	call   6016 <mkdir>
+    3f91:	83 c4 10             	add    $0x10,%esp
+    3f94:	85 c0                	test   %eax,%eax
+    3f96:	0f 85 14 05 00 00    	jne    44b0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    3f9c:	83 ec 08             	sub    $0x8,%esp
+    3f9f:	68 02 02 00 00       	push   $0x202
+    3fa4:	68 c4 79 00 00       	push   $0x79c4
+    3fa9:	e8 1d 20 00 00       	call   5fcb <open>
+  if(fd < 0){
+    3fae:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    3fb1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3fb3:	85 c0                	test   %eax,%eax
+    3fb5:	0f 88 24 04 00 00    	js     43df <subdir+0x4df>
+  write(fd, "FF", 2);
+    3fbb:	83 ec 04             	sub    $0x4,%esp
+    3fbe:	6a 02                	push   $0x2
+    3fc0:	68 e5 79 00 00       	push   $0x79e5
+    3fc5:	50                   	push   %eax
+    3fc6:	e8 c4 1f 00 00       	call   5f8f <write>
+  close(fd);
+    3fcb:	89 1c 24             	mov    %ebx,(%esp)
+    3fce:	e8 cb 1f 00 00       	call   5f9e <close>
+  fd = open("dd/dd/../ff", 0);
+    3fd3:	58                   	pop    %eax
+    3fd4:	5a                   	pop    %edx
+    3fd5:	6a 00                	push   $0x0
+    3fd7:	68 e8 79 00 00       	push   $0x79e8
+    3fdc:	e8 ea 1f 00 00       	call   5fcb <open>
+  if(fd < 0){
+    3fe1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    3fe4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3fe6:	85 c0                	test   %eax,%eax
+    3fe8:	0f 88 de 03 00 00    	js     43cc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    3fee:	83 ec 04             	sub    $0x4,%esp
+    3ff1:	68 00 20 00 00       	push   $0x2000
+    3ff6:	68 c0 cc 00 00       	push   $0xccc0
+    3ffb:	50                   	push   %eax
+    3ffc:	e8 7f 1f 00 00       	call   5f80 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    4001:	83 c4 10             	add    $0x10,%esp
+    4004:	83 f8 02             	cmp    $0x2,%eax
+    4007:	0f 85 3a 03 00 00    	jne    4347 <subdir+0x447>
+    400d:	80 3d c0 cc 00 00 66 	cmpb   $0x66,0xccc0
+    4014:	0f 85 2d 03 00 00    	jne    4347 <subdir+0x447>
+  close(fd);
+    401a:	83 ec 0c             	sub    $0xc,%esp
+    401d:	53                   	push   %ebx
+    401e:	e8 7b 1f 00 00       	call   5f9e <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    4023:	59                   	pop    %ecx
+    4024:	5b                   	pop    %ebx
+    4025:	68 28 7a 00 00       	push   $0x7a28
+    402a:	68 c4 79 00 00       	push   $0x79c4
+    402f:	e8 d3 1f 00 00       	call   6007 <link>
+    4034:	83 c4 10             	add    $0x10,%esp
+    4037:	85 c0                	test   %eax,%eax
+    4039:	0f 85 c6 03 00 00    	jne    4405 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    403f:	83 ec 0c             	sub    $0xc,%esp
+    4042:	68 c4 79 00 00       	push   $0x79c4
+    4047:	e8 9d 1f 00 00       	call   5fe9 <unlink>
+    404c:	83 c4 10             	add    $0x10,%esp
+    404f:	85 c0                	test   %eax,%eax
+    4051:	0f 85 16 03 00 00    	jne    436d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    4057:	83 ec 08             	sub    $0x8,%esp
+    405a:	6a 00                	push   $0x0
+    405c:	68 c4 79 00 00       	push   $0x79c4
+    4061:	e8 65 1f 00 00       	call   5fcb <open>
+    4066:	83 c4 10             	add    $0x10,%esp
+    4069:	85 c0                	test   %eax,%eax
+    406b:	0f 89 2c 04 00 00    	jns    449d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    4071:	83 ec 0c             	sub    $0xc,%esp
+    4074:	68 8e 7a 00 00       	push   $0x7a8e
+    4079:	e8 a7 1f 00 00       	call   6025 <chdir>
+    407e:	83 c4 10             	add    $0x10,%esp
+    4081:	85 c0                	test   %eax,%eax
+    4083:	0f 85 01 04 00 00    	jne    448a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    4089:	83 ec 0c             	sub    $0xc,%esp
+    408c:	68 5c 7a 00 00       	push   $0x7a5c
+    4091:	e8 8f 1f 00 00       	call   6025 <chdir>
+    4096:	83 c4 10             	add    $0x10,%esp
+    4099:	85 c0                	test   %eax,%eax
+    409b:	0f 85 b9 02 00 00    	jne    435a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    40a1:	83 ec 0c             	sub    $0xc,%esp
+    40a4:	68 82 7a 00 00       	push   $0x7a82
+    40a9:	e8 77 1f 00 00       	call   6025 <chdir>
+    40ae:	83 c4 10             	add    $0x10,%esp
+    40b1:	85 c0                	test   %eax,%eax
+    40b3:	0f 85 a1 02 00 00    	jne    435a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    40b9:	83 ec 0c             	sub    $0xc,%esp
+    40bc:	68 91 7a 00 00       	push   $0x7a91
+    40c1:	e8 5f 1f 00 00       	call   6025 <chdir>
+    40c6:	83 c4 10             	add    $0x10,%esp
+    40c9:	85 c0                	test   %eax,%eax
+    40cb:	0f 85 21 03 00 00    	jne    43f2 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    40d1:	83 ec 08             	sub    $0x8,%esp
+    40d4:	6a 00                	push   $0x0
+    40d6:	68 28 7a 00 00       	push   $0x7a28
+    40db:	e8 eb 1e 00 00       	call   5fcb <open>
+  if(fd < 0){
+    40e0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    40e3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    40e5:	85 c0                	test   %eax,%eax
+    40e7:	0f 88 e0 04 00 00    	js     45cd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    40ed:	83 ec 04             	sub    $0x4,%esp
+    40f0:	68 00 20 00 00       	push   $0x2000
+    40f5:	68 c0 cc 00 00       	push   $0xccc0
+    40fa:	50                   	push   %eax
+    40fb:	e8 80 1e 00 00       	call   5f80 <read>
+    4100:	83 c4 10             	add    $0x10,%esp
+    4103:	83 f8 02             	cmp    $0x2,%eax
+    4106:	0f 85 ae 04 00 00    	jne    45ba <subdir+0x6ba>
+  close(fd);
+    410c:	83 ec 0c             	sub    $0xc,%esp
+    410f:	53                   	push   %ebx
+    4110:	e8 89 1e 00 00       	call   5f9e <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    4115:	58                   	pop    %eax
+    4116:	5a                   	pop    %edx
+    4117:	6a 00                	push   $0x0
+    4119:	68 c4 79 00 00       	push   $0x79c4
+    411e:	e8 a8 1e 00 00       	call   5fcb <open>
+    4123:	83 c4 10             	add    $0x10,%esp
+    4126:	85 c0                	test   %eax,%eax
+    4128:	0f 89 65 02 00 00    	jns    4393 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    412e:	83 ec 08             	sub    $0x8,%esp
+    4131:	68 02 02 00 00       	push   $0x202
+    4136:	68 dc 7a 00 00       	push   $0x7adc
+    413b:	e8 8b 1e 00 00       	call   5fcb <open>
+    4140:	83 c4 10             	add    $0x10,%esp
+    4143:	85 c0                	test   %eax,%eax
+    4145:	0f 89 35 02 00 00    	jns    4380 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    414b:	83 ec 08             	sub    $0x8,%esp
+    414e:	68 02 02 00 00       	push   $0x202
+    4153:	68 01 7b 00 00       	push   $0x7b01
+    4158:	e8 6e 1e 00 00       	call   5fcb <open>
+    415d:	83 c4 10             	add    $0x10,%esp
+    4160:	85 c0                	test   %eax,%eax
+    4162:	0f 89 0f 03 00 00    	jns    4477 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    4168:	83 ec 08             	sub    $0x8,%esp
+    416b:	68 00 02 00 00       	push   $0x200
+    4170:	68 8e 7a 00 00       	push   $0x7a8e
+    4175:	e8 51 1e 00 00       	call   5fcb <open>
+    417a:	83 c4 10             	add    $0x10,%esp
+    417d:	85 c0                	test   %eax,%eax
+    417f:	0f 89 df 02 00 00    	jns    4464 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    4185:	83 ec 08             	sub    $0x8,%esp
+    4188:	6a 02                	push   $0x2
+    418a:	68 8e 7a 00 00       	push   $0x7a8e
+    418f:	e8 37 1e 00 00       	call   5fcb <open>
+    4194:	83 c4 10             	add    $0x10,%esp
+    4197:	85 c0                	test   %eax,%eax
+    4199:	0f 89 b2 02 00 00    	jns    4451 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    419f:	83 ec 08             	sub    $0x8,%esp
+    41a2:	6a 01                	push   $0x1
+    41a4:	68 8e 7a 00 00       	push   $0x7a8e
+    41a9:	e8 1d 1e 00 00       	call   5fcb <open>
+    41ae:	83 c4 10             	add    $0x10,%esp
+    41b1:	85 c0                	test   %eax,%eax
+    41b3:	0f 89 85 02 00 00    	jns    443e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    41b9:	83 ec 08             	sub    $0x8,%esp
+    41bc:	68 70 7b 00 00       	push   $0x7b70
+    41c1:	68 dc 7a 00 00       	push   $0x7adc
+    41c6:	e8 3c 1e 00 00       	call   6007 <link>
+    41cb:	83 c4 10             	add    $0x10,%esp
+    41ce:	85 c0                	test   %eax,%eax
+    41d0:	0f 84 55 02 00 00    	je     442b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    41d6:	83 ec 08             	sub    $0x8,%esp
+    41d9:	68 70 7b 00 00       	push   $0x7b70
+    41de:	68 01 7b 00 00       	push   $0x7b01
+    41e3:	e8 1f 1e 00 00       	call   6007 <link>
+    41e8:	83 c4 10             	add    $0x10,%esp
+    41eb:	85 c0                	test   %eax,%eax
+    41ed:	0f 84 25 02 00 00    	je     4418 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    41f3:	83 ec 08             	sub    $0x8,%esp
+    41f6:	68 28 7a 00 00       	push   $0x7a28
+    41fb:	68 c7 79 00 00       	push   $0x79c7
+    4200:	e8 02 1e 00 00       	call   6007 <link>
+    4205:	83 c4 10             	add    $0x10,%esp
+    4208:	85 c0                	test   %eax,%eax
+    420a:	0f 84 a9 01 00 00    	je     43b9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    4210:	83 ec 0c             	sub    $0xc,%esp
+    4213:	68 dc 7a 00 00       	push   $0x7adc
+    4218:	e8 f9 1d 00 00       	call   6016 <mkdir>
+    421d:	83 c4 10             	add    $0x10,%esp
+    4220:	85 c0                	test   %eax,%eax
+    4222:	0f 84 7e 01 00 00    	je     43a6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    4228:	83 ec 0c             	sub    $0xc,%esp
+    422b:	68 01 7b 00 00       	push   $0x7b01
+    4230:	e8 e1 1d 00 00       	call   6016 <mkdir>
+    4235:	83 c4 10             	add    $0x10,%esp
+    4238:	85 c0                	test   %eax,%eax
+    423a:	0f 84 67 03 00 00    	je     45a7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    4240:	83 ec 0c             	sub    $0xc,%esp
+    4243:	68 28 7a 00 00       	push   $0x7a28
+    4248:	e8 c9 1d 00 00       	call   6016 <mkdir>
+    424d:	83 c4 10             	add    $0x10,%esp
+    4250:	85 c0                	test   %eax,%eax
+    4252:	0f 84 3c 03 00 00    	je     4594 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    4258:	83 ec 0c             	sub    $0xc,%esp
+    425b:	68 01 7b 00 00       	push   $0x7b01
+    4260:	e8 84 1d 00 00       	call   5fe9 <unlink>
+    4265:	83 c4 10             	add    $0x10,%esp
+    4268:	85 c0                	test   %eax,%eax
+    426a:	0f 84 11 03 00 00    	je     4581 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    4270:	83 ec 0c             	sub    $0xc,%esp
+    4273:	68 dc 7a 00 00       	push   $0x7adc
+    4278:	e8 6c 1d 00 00       	call   5fe9 <unlink>
+    427d:	83 c4 10             	add    $0x10,%esp
+    4280:	85 c0                	test   %eax,%eax
+    4282:	0f 84 e6 02 00 00    	je     456e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    4288:	83 ec 0c             	sub    $0xc,%esp
+    428b:	68 c7 79 00 00       	push   $0x79c7
+    4290:	e8 90 1d 00 00       	call   6025 <chdir>
+    4295:	83 c4 10             	add    $0x10,%esp
+    4298:	85 c0                	test   %eax,%eax
+    429a:	0f 84 bb 02 00 00    	je     455b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    42a0:	83 ec 0c             	sub    $0xc,%esp
+    42a3:	68 73 7b 00 00       	push   $0x7b73
+    42a8:	e8 78 1d 00 00       	call   6025 <chdir>
+    42ad:	83 c4 10             	add    $0x10,%esp
+    42b0:	85 c0                	test   %eax,%eax
+    42b2:	0f 84 90 02 00 00    	je     4548 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    42b8:	83 ec 0c             	sub    $0xc,%esp
+    42bb:	68 28 7a 00 00       	push   $0x7a28
+    42c0:	e8 24 1d 00 00       	call   5fe9 <unlink>
+    42c5:	83 c4 10             	add    $0x10,%esp
+    42c8:	85 c0                	test   %eax,%eax
+    42ca:	0f 85 9d 00 00 00    	jne    436d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    42d0:	83 ec 0c             	sub    $0xc,%esp
+    42d3:	68 c7 79 00 00       	push   $0x79c7
+    42d8:	e8 0c 1d 00 00       	call   5fe9 <unlink>
+    42dd:	83 c4 10             	add    $0x10,%esp
+    42e0:	85 c0                	test   %eax,%eax
+    42e2:	0f 85 4d 02 00 00    	jne    4535 <subdir+0x635>
+  if(unlink("dd") == 0){
+    42e8:	83 ec 0c             	sub    $0xc,%esp
+    42eb:	68 8e 7a 00 00       	push   $0x7a8e
+    42f0:	e8 f4 1c 00 00       	call   5fe9 <unlink>
+    42f5:	83 c4 10             	add    $0x10,%esp
+    42f8:	85 c0                	test   %eax,%eax
+    42fa:	0f 84 22 02 00 00    	je     4522 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    4300:	83 ec 0c             	sub    $0xc,%esp
+    4303:	68 a3 79 00 00       	push   $0x79a3
+    4308:	e8 dc 1c 00 00       	call   5fe9 <unlink>
+    430d:	83 c4 10             	add    $0x10,%esp
+    4310:	85 c0                	test   %eax,%eax
+    4312:	0f 88 f7 01 00 00    	js     450f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    4318:	83 ec 0c             	sub    $0xc,%esp
+    431b:	68 8e 7a 00 00       	push   $0x7a8e
+    4320:	e8 c4 1c 00 00       	call   5fe9 <unlink>
+    4325:	83 c4 10             	add    $0x10,%esp
+    4328:	85 c0                	test   %eax,%eax
+    432a:	0f 88 cc 01 00 00    	js     44fc <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    4330:	83 ec 08             	sub    $0x8,%esp
+    4333:	68 70 7c 00 00       	push   $0x7c70
+    4338:	6a 01                	push   $0x1
+    433a:	e8 31 21 00 00       	call   6470 <printf>
+}
+    433f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4342:	83 c4 10             	add    $0x10,%esp
+    4345:	c9                   	leave
+    4346:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    4347:	50                   	push   %eax
+    4348:	50                   	push   %eax
+    4349:	68 0d 7a 00 00       	push   $0x7a0d
+    434e:	6a 01                	push   $0x1
+    4350:	e8 1b 21 00 00       	call   6470 <printf>
+    exit();
+    4355:	e8 a6 1b 00 00       	call   5f00 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    435a:	50                   	push   %eax
+    435b:	50                   	push   %eax
+    435c:	68 68 7a 00 00       	push   $0x7a68
+    4361:	6a 01                	push   $0x1
+    4363:	e8 08 21 00 00       	call   6470 <printf>
+    exit();
+    4368:	e8 93 1b 00 00       	call   5f00 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    436d:	50                   	push   %eax
+    436e:	50                   	push   %eax
+    436f:	68 33 7a 00 00       	push   $0x7a33
+    4374:	6a 01                	push   $0x1
+    4376:	e8 f5 20 00 00       	call   6470 <printf>
+    exit();
+    437b:	e8 80 1b 00 00       	call   5f00 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    4380:	51                   	push   %ecx
+    4381:	51                   	push   %ecx
+    4382:	68 e5 7a 00 00       	push   $0x7ae5
+    4387:	6a 01                	push   $0x1
+    4389:	e8 e2 20 00 00       	call   6470 <printf>
+    exit();
+    438e:	e8 6d 1b 00 00       	call   5f00 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    4393:	53                   	push   %ebx
+    4394:	53                   	push   %ebx
+    4395:	68 ac 87 00 00       	push   $0x87ac
+    439a:	6a 01                	push   $0x1
+    439c:	e8 cf 20 00 00       	call   6470 <printf>
+    exit();
+    43a1:	e8 5a 1b 00 00       	call   5f00 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    43a6:	51                   	push   %ecx
+    43a7:	51                   	push   %ecx
+    43a8:	68 79 7b 00 00       	push   $0x7b79
+    43ad:	6a 01                	push   $0x1
+    43af:	e8 bc 20 00 00       	call   6470 <printf>
+    exit();
+    43b4:	e8 47 1b 00 00       	call   5f00 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    43b9:	53                   	push   %ebx
+    43ba:	53                   	push   %ebx
+    43bb:	68 1c 88 00 00       	push   $0x881c
+    43c0:	6a 01                	push   $0x1
+    43c2:	e8 a9 20 00 00       	call   6470 <printf>
+    exit();
+    43c7:	e8 34 1b 00 00       	call   5f00 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    43cc:	50                   	push   %eax
+    43cd:	50                   	push   %eax
+    43ce:	68 f4 79 00 00       	push   $0x79f4
+    43d3:	6a 01                	push   $0x1
+    43d5:	e8 96 20 00 00       	call   6470 <printf>
+    exit();
+    43da:	e8 21 1b 00 00       	call   5f00 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    43df:	51                   	push   %ecx
+    43e0:	51                   	push   %ecx
+    43e1:	68 cd 79 00 00       	push   $0x79cd
+    43e6:	6a 01                	push   $0x1
+    43e8:	e8 83 20 00 00       	call   6470 <printf>
+    exit();
+    43ed:	e8 0e 1b 00 00       	call   5f00 <exit>
+    printf(1, "chdir ./.. failed\n");
+    43f2:	50                   	push   %eax
+    43f3:	50                   	push   %eax
+    43f4:	68 96 7a 00 00       	push   $0x7a96
+    43f9:	6a 01                	push   $0x1
+    43fb:	e8 70 20 00 00       	call   6470 <printf>
+    exit();
+    4400:	e8 fb 1a 00 00       	call   5f00 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    4405:	52                   	push   %edx
+    4406:	52                   	push   %edx
+    4407:	68 64 87 00 00       	push   $0x8764
+    440c:	6a 01                	push   $0x1
+    440e:	e8 5d 20 00 00       	call   6470 <printf>
+    exit();
+    4413:	e8 e8 1a 00 00       	call   5f00 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    4418:	50                   	push   %eax
+    4419:	50                   	push   %eax
+    441a:	68 f8 87 00 00       	push   $0x87f8
+    441f:	6a 01                	push   $0x1
+    4421:	e8 4a 20 00 00       	call   6470 <printf>
+    exit();
+    4426:	e8 d5 1a 00 00       	call   5f00 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    442b:	50                   	push   %eax
+    442c:	50                   	push   %eax
+    442d:	68 d4 87 00 00       	push   $0x87d4
+    4432:	6a 01                	push   $0x1
+    4434:	e8 37 20 00 00       	call   6470 <printf>
+    exit();
+    4439:	e8 c2 1a 00 00       	call   5f00 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    443e:	50                   	push   %eax
+    443f:	50                   	push   %eax
+    4440:	68 55 7b 00 00       	push   $0x7b55
+    4445:	6a 01                	push   $0x1
+    4447:	e8 24 20 00 00       	call   6470 <printf>
+    exit();
+    444c:	e8 af 1a 00 00       	call   5f00 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    4451:	50                   	push   %eax
+    4452:	50                   	push   %eax
+    4453:	68 3c 7b 00 00       	push   $0x7b3c
+    4458:	6a 01                	push   $0x1
+    445a:	e8 11 20 00 00       	call   6470 <printf>
+    exit();
+    445f:	e8 9c 1a 00 00       	call   5f00 <exit>
+    printf(1, "create dd succeeded!\n");
+    4464:	50                   	push   %eax
+    4465:	50                   	push   %eax
+    4466:	68 26 7b 00 00       	push   $0x7b26
+    446b:	6a 01                	push   $0x1
+    446d:	e8 fe 1f 00 00       	call   6470 <printf>
+    exit();
+    4472:	e8 89 1a 00 00       	call   5f00 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    4477:	52                   	push   %edx
+    4478:	52                   	push   %edx
+    4479:	68 0a 7b 00 00       	push   $0x7b0a
+    447e:	6a 01                	push   $0x1
+    4480:	e8 eb 1f 00 00       	call   6470 <printf>
+    exit();
+    4485:	e8 76 1a 00 00       	call   5f00 <exit>
+    printf(1, "chdir dd failed\n");
+    448a:	50                   	push   %eax
+    448b:	50                   	push   %eax
+    448c:	68 4b 7a 00 00       	push   $0x7a4b
+    4491:	6a 01                	push   $0x1
+    4493:	e8 d8 1f 00 00       	call   6470 <printf>
+    exit();
+    4498:	e8 63 1a 00 00       	call   5f00 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    449d:	50                   	push   %eax
+    449e:	50                   	push   %eax
+    449f:	68 88 87 00 00       	push   $0x8788
+    44a4:	6a 01                	push   $0x1
+    44a6:	e8 c5 1f 00 00       	call   6470 <printf>
+    exit();
+    44ab:	e8 50 1a 00 00       	call   5f00 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    44b0:	53                   	push   %ebx
+    44b1:	53                   	push   %ebx
+    44b2:	68 a9 79 00 00       	push   $0x79a9
+    44b7:	6a 01                	push   $0x1
+    44b9:	e8 b2 1f 00 00       	call   6470 <printf>
+    exit();
+    44be:	e8 3d 1a 00 00       	call   5f00 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    44c3:	50                   	push   %eax
+    44c4:	50                   	push   %eax
+    44c5:	68 3c 87 00 00       	push   $0x873c
+    44ca:	6a 01                	push   $0x1
+    44cc:	e8 9f 1f 00 00       	call   6470 <printf>
+    exit();
+    44d1:	e8 2a 1a 00 00       	call   5f00 <exit>
+    printf(1, "create dd/ff failed\n");
+    44d6:	50                   	push   %eax
+    44d7:	50                   	push   %eax
+    44d8:	68 8d 79 00 00       	push   $0x798d
+    44dd:	6a 01                	push   $0x1
+    44df:	e8 8c 1f 00 00       	call   6470 <printf>
+    exit();
+    44e4:	e8 17 1a 00 00       	call   5f00 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    44e9:	50                   	push   %eax
+    44ea:	50                   	push   %eax
+    44eb:	68 75 79 00 00       	push   $0x7975
+    44f0:	6a 01                	push   $0x1
+    44f2:	e8 79 1f 00 00       	call   6470 <printf>
+    exit();
+    44f7:	e8 04 1a 00 00       	call   5f00 <exit>
+    printf(1, "unlink dd failed\n");
+    44fc:	50                   	push   %eax
+    44fd:	50                   	push   %eax
+    44fe:	68 5e 7c 00 00       	push   $0x7c5e
+    4503:	6a 01                	push   $0x1
+    4505:	e8 66 1f 00 00       	call   6470 <printf>
+    exit();
+    450a:	e8 f1 19 00 00       	call   5f00 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    450f:	52                   	push   %edx
+    4510:	52                   	push   %edx
+    4511:	68 49 7c 00 00       	push   $0x7c49
+    4516:	6a 01                	push   $0x1
+    4518:	e8 53 1f 00 00       	call   6470 <printf>
+    exit();
+    451d:	e8 de 19 00 00       	call   5f00 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    4522:	51                   	push   %ecx
+    4523:	51                   	push   %ecx
+    4524:	68 40 88 00 00       	push   $0x8840
+    4529:	6a 01                	push   $0x1
+    452b:	e8 40 1f 00 00       	call   6470 <printf>
+    exit();
+    4530:	e8 cb 19 00 00       	call   5f00 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    4535:	53                   	push   %ebx
+    4536:	53                   	push   %ebx
+    4537:	68 34 7c 00 00       	push   $0x7c34
+    453c:	6a 01                	push   $0x1
+    453e:	e8 2d 1f 00 00       	call   6470 <printf>
+    exit();
+    4543:	e8 b8 19 00 00       	call   5f00 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    4548:	50                   	push   %eax
+    4549:	50                   	push   %eax
+    454a:	68 1c 7c 00 00       	push   $0x7c1c
+    454f:	6a 01                	push   $0x1
+    4551:	e8 1a 1f 00 00       	call   6470 <printf>
+    exit();
+    4556:	e8 a5 19 00 00       	call   5f00 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    455b:	50                   	push   %eax
+    455c:	50                   	push   %eax
+    455d:	68 04 7c 00 00       	push   $0x7c04
+    4562:	6a 01                	push   $0x1
+    4564:	e8 07 1f 00 00       	call   6470 <printf>
+    exit();
+    4569:	e8 92 19 00 00       	call   5f00 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    456e:	50                   	push   %eax
+    456f:	50                   	push   %eax
+    4570:	68 e8 7b 00 00       	push   $0x7be8
+    4575:	6a 01                	push   $0x1
+    4577:	e8 f4 1e 00 00       	call   6470 <printf>
+    exit();
+    457c:	e8 7f 19 00 00       	call   5f00 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    4581:	50                   	push   %eax
+    4582:	50                   	push   %eax
+    4583:	68 cc 7b 00 00       	push   $0x7bcc
+    4588:	6a 01                	push   $0x1
+    458a:	e8 e1 1e 00 00       	call   6470 <printf>
+    exit();
+    458f:	e8 6c 19 00 00       	call   5f00 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    4594:	50                   	push   %eax
+    4595:	50                   	push   %eax
+    4596:	68 af 7b 00 00       	push   $0x7baf
+    459b:	6a 01                	push   $0x1
+    459d:	e8 ce 1e 00 00       	call   6470 <printf>
+    exit();
+    45a2:	e8 59 19 00 00       	call   5f00 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    45a7:	52                   	push   %edx
+    45a8:	52                   	push   %edx
+    45a9:	68 94 7b 00 00       	push   $0x7b94
+    45ae:	6a 01                	push   $0x1
+    45b0:	e8 bb 1e 00 00       	call   6470 <printf>
+    exit();
+    45b5:	e8 46 19 00 00       	call   5f00 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    45ba:	51                   	push   %ecx
+    45bb:	51                   	push   %ecx
+    45bc:	68 c1 7a 00 00       	push   $0x7ac1
+    45c1:	6a 01                	push   $0x1
+    45c3:	e8 a8 1e 00 00       	call   6470 <printf>
+    exit();
+    45c8:	e8 33 19 00 00       	call   5f00 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    45cd:	53                   	push   %ebx
+    45ce:	53                   	push   %ebx
+    45cf:	68 a9 7a 00 00       	push   $0x7aa9
+    45d4:	6a 01                	push   $0x1
+    45d6:	e8 95 1e 00 00       	call   6470 <printf>
+    exit();
+    45db:	e8 20 19 00 00       	call   5f00 <exit>
+
+000045e0 <bigwrite>:
+{
+    45e0:	55                   	push   %ebp
+    45e1:	89 e5                	mov    %esp,%ebp
+    45e3:	56                   	push   %esi
+    45e4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    45e5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    45ea:	83 ec 08             	sub    $0x8,%esp
+    45ed:	68 7b 7c 00 00       	push   $0x7c7b
+    45f2:	6a 01                	push   $0x1
+    45f4:	e8 77 1e 00 00       	call   6470 <printf>
+  unlink("bigwrite");
+    45f9:	c7 04 24 8a 7c 00 00 	movl   $0x7c8a,(%esp)
+    4600:	e8 e4 19 00 00       	call   5fe9 <unlink>
+    4605:	83 c4 10             	add    $0x10,%esp
+    4608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    460f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    4610:	83 ec 08             	sub    $0x8,%esp
+    4613:	68 02 02 00 00       	push   $0x202
+    4618:	68 8a 7c 00 00       	push   $0x7c8a
+    461d:	e8 a9 19 00 00       	call   5fcb <open>
+    if(fd < 0){
+    4622:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    4625:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    4627:	85 c0                	test   %eax,%eax
+    4629:	78 7e                	js     46a9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    462b:	83 ec 04             	sub    $0x4,%esp
+    462e:	53                   	push   %ebx
+    462f:	68 c0 cc 00 00       	push   $0xccc0
+    4634:	50                   	push   %eax
+    4635:	e8 55 19 00 00       	call   5f8f <write>
+      if(cc != sz){
+    463a:	83 c4 10             	add    $0x10,%esp
+    463d:	39 d8                	cmp    %ebx,%eax
+    463f:	75 55                	jne    4696 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    4641:	83 ec 04             	sub    $0x4,%esp
+    4644:	53                   	push   %ebx
+    4645:	68 c0 cc 00 00       	push   $0xccc0
+    464a:	56                   	push   %esi
+    464b:	e8 3f 19 00 00       	call   5f8f <write>
+      if(cc != sz){
+    4650:	83 c4 10             	add    $0x10,%esp
+    4653:	39 c3                	cmp    %eax,%ebx
+    4655:	75 3f                	jne    4696 <bigwrite+0xb6>
+    close(fd);
+    4657:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    465a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    4660:	56                   	push   %esi
+    4661:	e8 38 19 00 00       	call   5f9e <close>
+    unlink("bigwrite");
+    4666:	c7 04 24 8a 7c 00 00 	movl   $0x7c8a,(%esp)
+    466d:	e8 77 19 00 00       	call   5fe9 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    4672:	83 c4 10             	add    $0x10,%esp
+    4675:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    467b:	75 93                	jne    4610 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    467d:	83 ec 08             	sub    $0x8,%esp
+    4680:	68 bd 7c 00 00       	push   $0x7cbd
+    4685:	6a 01                	push   $0x1
+    4687:	e8 e4 1d 00 00       	call   6470 <printf>
+}
+    468c:	83 c4 10             	add    $0x10,%esp
+    468f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4692:	5b                   	pop    %ebx
+    4693:	5e                   	pop    %esi
+    4694:	5d                   	pop    %ebp
+    4695:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    4696:	50                   	push   %eax
+    4697:	53                   	push   %ebx
+    4698:	68 ab 7c 00 00       	push   $0x7cab
+    469d:	6a 01                	push   $0x1
+    469f:	e8 cc 1d 00 00       	call   6470 <printf>
+        exit();
+    46a4:	e8 57 18 00 00       	call   5f00 <exit>
+      printf(1, "cannot create bigwrite\n");
+    46a9:	83 ec 08             	sub    $0x8,%esp
+    46ac:	68 93 7c 00 00       	push   $0x7c93
+    46b1:	6a 01                	push   $0x1
+    46b3:	e8 b8 1d 00 00       	call   6470 <printf>
+      exit();
+    46b8:	e8 43 18 00 00       	call   5f00 <exit>
+    46bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000046c0 <bigfile>:
+{
+    46c0:	55                   	push   %ebp
+    46c1:	89 e5                	mov    %esp,%ebp
+    46c3:	57                   	push   %edi
+    46c4:	56                   	push   %esi
+    46c5:	53                   	push   %ebx
+    46c6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    46c9:	68 ca 7c 00 00       	push   $0x7cca
+    46ce:	6a 01                	push   $0x1
+    46d0:	e8 9b 1d 00 00       	call   6470 <printf>
+  unlink("bigfile");
+    46d5:	c7 04 24 e6 7c 00 00 	movl   $0x7ce6,(%esp)
+    46dc:	e8 08 19 00 00       	call   5fe9 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    46e1:	58                   	pop    %eax
+    46e2:	5a                   	pop    %edx
+    46e3:	68 02 02 00 00       	push   $0x202
+    46e8:	68 e6 7c 00 00       	push   $0x7ce6
+    46ed:	e8 d9 18 00 00       	call   5fcb <open>
+  if(fd < 0){
+    46f2:	83 c4 10             	add    $0x10,%esp
+    46f5:	85 c0                	test   %eax,%eax
+    46f7:	0f 88 5e 01 00 00    	js     485b <bigfile+0x19b>
+    46fd:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    46ff:	31 db                	xor    %ebx,%ebx
+    4701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    4708:	83 ec 04             	sub    $0x4,%esp
+    470b:	68 58 02 00 00       	push   $0x258
+    4710:	53                   	push   %ebx
+    4711:	68 c0 cc 00 00       	push   $0xccc0
+    4716:	e8 c5 15 00 00       	call   5ce0 <memset>
+    if(write(fd, buf, 600) != 600){
+    471b:	83 c4 0c             	add    $0xc,%esp
+    471e:	68 58 02 00 00       	push   $0x258
+    4723:	68 c0 cc 00 00       	push   $0xccc0
+    4728:	56                   	push   %esi
+    4729:	e8 61 18 00 00       	call   5f8f <write>
+    472e:	83 c4 10             	add    $0x10,%esp
+    4731:	3d 58 02 00 00       	cmp    $0x258,%eax
+    4736:	0f 85 f8 00 00 00    	jne    4834 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    473c:	83 c3 01             	add    $0x1,%ebx
+    473f:	83 fb 14             	cmp    $0x14,%ebx
+    4742:	75 c4                	jne    4708 <bigfile+0x48>
+  close(fd);
+    4744:	83 ec 0c             	sub    $0xc,%esp
+    4747:	56                   	push   %esi
+    4748:	e8 51 18 00 00       	call   5f9e <close>
+  fd = open("bigfile", 0);
+    474d:	5e                   	pop    %esi
+    474e:	5f                   	pop    %edi
+    474f:	6a 00                	push   $0x0
+    4751:	68 e6 7c 00 00       	push   $0x7ce6
+    4756:	e8 70 18 00 00       	call   5fcb <open>
+  if(fd < 0){
+    475b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    475e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    4760:	85 c0                	test   %eax,%eax
+    4762:	0f 88 e0 00 00 00    	js     4848 <bigfile+0x188>
+  total = 0;
+    4768:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    476a:	31 ff                	xor    %edi,%edi
+    476c:	eb 30                	jmp    479e <bigfile+0xde>
+    476e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    4770:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    4775:	0f 85 91 00 00 00    	jne    480c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    477b:	89 fa                	mov    %edi,%edx
+    477d:	0f be 05 c0 cc 00 00 	movsbl 0xccc0,%eax
+    4784:	d1 fa                	sar    %edx
+    4786:	39 d0                	cmp    %edx,%eax
+    4788:	75 6e                	jne    47f8 <bigfile+0x138>
+    478a:	0f be 15 eb cd 00 00 	movsbl 0xcdeb,%edx
+    4791:	39 d0                	cmp    %edx,%eax
+    4793:	75 63                	jne    47f8 <bigfile+0x138>
+    total += cc;
+    4795:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    479b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    479e:	83 ec 04             	sub    $0x4,%esp
+    47a1:	68 2c 01 00 00       	push   $0x12c
+    47a6:	68 c0 cc 00 00       	push   $0xccc0
+    47ab:	56                   	push   %esi
+    47ac:	e8 cf 17 00 00       	call   5f80 <read>
+    if(cc < 0){
+    47b1:	83 c4 10             	add    $0x10,%esp
+    47b4:	85 c0                	test   %eax,%eax
+    47b6:	78 68                	js     4820 <bigfile+0x160>
+    if(cc == 0)
+    47b8:	75 b6                	jne    4770 <bigfile+0xb0>
+  close(fd);
+    47ba:	83 ec 0c             	sub    $0xc,%esp
+    47bd:	56                   	push   %esi
+    47be:	e8 db 17 00 00       	call   5f9e <close>
+  if(total != 20*600){
+    47c3:	83 c4 10             	add    $0x10,%esp
+    47c6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    47cc:	0f 85 9c 00 00 00    	jne    486e <bigfile+0x1ae>
+  unlink("bigfile");
+    47d2:	83 ec 0c             	sub    $0xc,%esp
+    47d5:	68 e6 7c 00 00       	push   $0x7ce6
+    47da:	e8 0a 18 00 00       	call   5fe9 <unlink>
+  printf(1, "bigfile test ok\n");
+    47df:	58                   	pop    %eax
+    47e0:	5a                   	pop    %edx
+    47e1:	68 75 7d 00 00       	push   $0x7d75
+    47e6:	6a 01                	push   $0x1
+    47e8:	e8 83 1c 00 00       	call   6470 <printf>
+}
+    47ed:	83 c4 10             	add    $0x10,%esp
+    47f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    47f3:	5b                   	pop    %ebx
+    47f4:	5e                   	pop    %esi
+    47f5:	5f                   	pop    %edi
+    47f6:	5d                   	pop    %ebp
+    47f7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    47f8:	83 ec 08             	sub    $0x8,%esp
+    47fb:	68 42 7d 00 00       	push   $0x7d42
+    4800:	6a 01                	push   $0x1
+    4802:	e8 69 1c 00 00       	call   6470 <printf>
+      exit();
+    4807:	e8 f4 16 00 00       	call   5f00 <exit>
+      printf(1, "short read bigfile\n");
+    480c:	83 ec 08             	sub    $0x8,%esp
+    480f:	68 2e 7d 00 00       	push   $0x7d2e
+    4814:	6a 01                	push   $0x1
+    4816:	e8 55 1c 00 00       	call   6470 <printf>
+      exit();
+    481b:	e8 e0 16 00 00       	call   5f00 <exit>
+      printf(1, "read bigfile failed\n");
+    4820:	83 ec 08             	sub    $0x8,%esp
+    4823:	68 19 7d 00 00       	push   $0x7d19
+    4828:	6a 01                	push   $0x1
+    482a:	e8 41 1c 00 00       	call   6470 <printf>
+      exit();
+    482f:	e8 cc 16 00 00       	call   5f00 <exit>
+      printf(1, "write bigfile failed\n");
+    4834:	83 ec 08             	sub    $0x8,%esp
+    4837:	68 ee 7c 00 00       	push   $0x7cee
+    483c:	6a 01                	push   $0x1
+    483e:	e8 2d 1c 00 00       	call   6470 <printf>
+      exit();
+    4843:	e8 b8 16 00 00       	call   5f00 <exit>
+    printf(1, "cannot open bigfile\n");
+    4848:	53                   	push   %ebx
+    4849:	53                   	push   %ebx
+    484a:	68 04 7d 00 00       	push   $0x7d04
+    484f:	6a 01                	push   $0x1
+    4851:	e8 1a 1c 00 00       	call   6470 <printf>
+    exit();
+    4856:	e8 a5 16 00 00       	call   5f00 <exit>
+    printf(1, "cannot create bigfile");
+    485b:	50                   	push   %eax
+    485c:	50                   	push   %eax
+    485d:	68 d8 7c 00 00       	push   $0x7cd8
+    4862:	6a 01                	push   $0x1
+    4864:	e8 07 1c 00 00       	call   6470 <printf>
+    exit();
+    4869:	e8 92 16 00 00       	call   5f00 <exit>
+    printf(1, "read bigfile wrong total\n");
+    486e:	51                   	push   %ecx
+    486f:	51                   	push   %ecx
+    4870:	68 5b 7d 00 00       	push   $0x7d5b
+    4875:	6a 01                	push   $0x1
+    4877:	e8 f4 1b 00 00       	call   6470 <printf>
+    exit();
+    487c:	e8 7f 16 00 00       	call   5f00 <exit>
+    4881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    488f:	90                   	nop
+
+00004890 <bigfilemb>:
+{
+    4890:	55                   	push   %ebp
+    4891:	89 e5                	mov    %esp,%ebp
+    4893:	57                   	push   %edi
+    4894:	56                   	push   %esi
+    4895:	53                   	push   %ebx
+    4896:	83 ec 20             	sub    $0x20,%esp
+  printf(1, "bigfile %d MB test\n", mb);
+    4899:	ff 75 08             	push   0x8(%ebp)
+    489c:	68 86 7d 00 00       	push   $0x7d86
+    48a1:	6a 01                	push   $0x1
+    48a3:	e8 c8 1b 00 00       	call   6470 <printf>
+  n = mb * (1024*1024 / sizeof(buf));
+    48a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  unlink("bigfile");
+    48ab:	c7 04 24 e6 7c 00 00 	movl   $0x7ce6,(%esp)
+  n = mb * (1024*1024 / sizeof(buf));
+    48b2:	c1 e3 07             	shl    $0x7,%ebx
+  unlink("bigfile");
+    48b5:	e8 2f 17 00 00       	call   5fe9 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    48ba:	58                   	pop    %eax
+    48bb:	5a                   	pop    %edx
+    48bc:	68 02 02 00 00       	push   $0x202
+    48c1:	68 e6 7c 00 00       	push   $0x7ce6
+    48c6:	e8 00 17 00 00       	call   5fcb <open>
+  if(fd < 0){
+    48cb:	83 c4 10             	add    $0x10,%esp
+    48ce:	85 c0                	test   %eax,%eax
+    48d0:	0f 88 0b 02 00 00    	js     4ae1 <bigfilemb+0x251>
+    48d6:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++){
+    48d8:	31 ff                	xor    %edi,%edi
+  start = uptime();
+    48da:	e8 91 17 00 00       	call   6070 <uptime>
+    48df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < n; i++){
+    48e2:	85 db                	test   %ebx,%ebx
+    48e4:	7e 53                	jle    4939 <bigfilemb+0xa9>
+    48e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    48ed:	8d 76 00             	lea    0x0(%esi),%esi
+    for(j = 0; j < sizeof(buf)/512; j++)
+    48f0:	89 fa                	mov    %edi,%edx
+    48f2:	b8 c0 cc 00 00       	mov    $0xccc0,%eax
+    48f7:	c1 e2 04             	shl    $0x4,%edx
+    48fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      ((int*)buf)[j*512/4] = i*(sizeof(buf)/512) + j;
+    4900:	89 10                	mov    %edx,(%eax)
+    for(j = 0; j < sizeof(buf)/512; j++)
+    4902:	05 00 02 00 00       	add    $0x200,%eax
+    4907:	83 c2 01             	add    $0x1,%edx
+    490a:	3d c0 ec 00 00       	cmp    $0xecc0,%eax
+    490f:	75 ef                	jne    4900 <bigfilemb+0x70>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    4911:	83 ec 04             	sub    $0x4,%esp
+    4914:	68 00 20 00 00       	push   $0x2000
+    4919:	68 c0 cc 00 00       	push   $0xccc0
+    491e:	56                   	push   %esi
+    491f:	e8 6b 16 00 00       	call   5f8f <write>
+    4924:	83 c4 10             	add    $0x10,%esp
+    4927:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    492c:	0f 85 1e 02 00 00    	jne    4b50 <bigfilemb+0x2c0>
+  for(i = 0; i < n; i++){
+    4932:	83 c7 01             	add    $0x1,%edi
+    4935:	39 fb                	cmp    %edi,%ebx
+    4937:	75 b7                	jne    48f0 <bigfilemb+0x60>
+  close(fd);
+    4939:	83 ec 0c             	sub    $0xc,%esp
+    493c:	56                   	push   %esi
+    493d:	e8 5c 16 00 00       	call   5f9e <close>
+  t = uptime() - start;
+    4942:	e8 29 17 00 00       	call   6070 <uptime>
+    4947:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    494a:	29 f0                	sub    %esi,%eax
+    494c:	89 c6                	mov    %eax,%esi
+  printf(1, "bigfile write: %d KB in %d ticks", mb*1024, t);
+    494e:	8b 45 08             	mov    0x8(%ebp),%eax
+    4951:	c1 e0 0a             	shl    $0xa,%eax
+    4954:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    4957:	56                   	push   %esi
+    4958:	50                   	push   %eax
+    4959:	68 60 88 00 00       	push   $0x8860
+    495e:	6a 01                	push   $0x1
+    4960:	e8 0b 1b 00 00       	call   6470 <printf>
+  if(t > 0)
+    4965:	83 c4 20             	add    $0x20,%esp
+    4968:	85 f6                	test   %esi,%esi
+    496a:	7e 1d                	jle    4989 <bigfilemb+0xf9>
+    printf(1, ", %d KB/s", mb*1024*100/t);
+    496c:	69 45 08 00 90 01 00 	imul   $0x19000,0x8(%ebp),%eax
+    4973:	83 ec 04             	sub    $0x4,%esp
+    4976:	99                   	cltd
+    4977:	f7 fe                	idiv   %esi
+    4979:	50                   	push   %eax
+    497a:	68 cd 7d 00 00       	push   $0x7dcd
+    497f:	6a 01                	push   $0x1
+    4981:	e8 ea 1a 00 00       	call   6470 <printf>
+    4986:	83 c4 10             	add    $0x10,%esp
+  printf(1, "\n");
+    4989:	83 ec 08             	sub    $0x8,%esp
+    498c:	68 46 76 00 00       	push   $0x7646
+    4991:	6a 01                	push   $0x1
+    4993:	e8 d8 1a 00 00       	call   6470 <printf>
+  fd = open("bigfile", 0);
+    4998:	5e                   	pop    %esi
+    4999:	5f                   	pop    %edi
+    499a:	6a 00                	push   $0x0
+    499c:	68 e6 7c 00 00       	push   $0x7ce6
+    49a1:	e8 25 16 00 00       	call   5fcb <open>
+  if(fd < 0){
+    49a6:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    49a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(fd < 0){
+    49ac:	85 c0                	test   %eax,%eax
+    49ae:	0f 88 71 01 00 00    	js     4b25 <bigfilemb+0x295>
+  start = uptime();
+    49b4:	e8 b7 16 00 00       	call   6070 <uptime>
+    49b9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for(i = 0; i < n; i++){
+    49bc:	85 db                	test   %ebx,%ebx
+    49be:	7e 5c                	jle    4a1c <bigfilemb+0x18c>
+    49c0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    49c3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    49c6:	31 f6                	xor    %esi,%esi
+    49c8:	bf c0 ec 00 00       	mov    $0xecc0,%edi
+    49cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf)){
+    49d0:	83 ec 04             	sub    $0x4,%esp
+    49d3:	68 00 20 00 00       	push   $0x2000
+    49d8:	68 c0 cc 00 00       	push   $0xccc0
+    49dd:	53                   	push   %ebx
+    49de:	e8 9d 15 00 00       	call   5f80 <read>
+    49e3:	83 c4 10             	add    $0x10,%esp
+    49e6:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    49eb:	0f 85 1f 01 00 00    	jne    4b10 <bigfilemb+0x280>
+    49f1:	89 f1                	mov    %esi,%ecx
+    49f3:	b8 c0 cc 00 00       	mov    $0xccc0,%eax
+    49f8:	c1 e1 04             	shl    $0x4,%ecx
+    49fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    49ff:	90                   	nop
+      if(((int*)buf)[j*512/4] != i*(sizeof(buf)/512) + j){
+    4a00:	3b 08                	cmp    (%eax),%ecx
+    4a02:	0f 85 c4 00 00 00    	jne    4acc <bigfilemb+0x23c>
+    for(j = 0; j < sizeof(buf)/512; j++)
+    4a08:	05 00 02 00 00       	add    $0x200,%eax
+    4a0d:	83 c1 01             	add    $0x1,%ecx
+    4a10:	39 c7                	cmp    %eax,%edi
+    4a12:	75 ec                	jne    4a00 <bigfilemb+0x170>
+  for(i = 0; i < n; i++){
+    4a14:	83 c6 01             	add    $0x1,%esi
+    4a17:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+    4a1a:	75 b4                	jne    49d0 <bigfilemb+0x140>
+  if(read(fd, buf, sizeof(buf)) != 0){
+    4a1c:	83 ec 04             	sub    $0x4,%esp
+    4a1f:	68 00 20 00 00       	push   $0x2000
+    4a24:	68 c0 cc 00 00       	push   $0xccc0
+    4a29:	ff 75 e0             	push   -0x20(%ebp)
+    4a2c:	e8 4f 15 00 00       	call   5f80 <read>
+    4a31:	83 c4 10             	add    $0x10,%esp
+    4a34:	85 c0                	test   %eax,%eax
+    4a36:	0f 85 b8 00 00 00    	jne    4af4 <bigfilemb+0x264>
+  close(fd);
+    4a3c:	83 ec 0c             	sub    $0xc,%esp
+    4a3f:	ff 75 e0             	push   -0x20(%ebp)
+    4a42:	e8 57 15 00 00       	call   5f9e <close>
+  t = uptime() - start;
+    4a47:	e8 24 16 00 00       	call   6070 <uptime>
+    4a4c:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+    4a4f:	29 d8                	sub    %ebx,%eax
+  printf(1, "bigfile read: %d KB in %d ticks", mb*1024, t);
+    4a51:	50                   	push   %eax
+  t = uptime() - start;
+    4a52:	89 c3                	mov    %eax,%ebx
+  printf(1, "bigfile read: %d KB in %d ticks", mb*1024, t);
+    4a54:	ff 75 dc             	push   -0x24(%ebp)
+    4a57:	68 a4 88 00 00       	push   $0x88a4
+    4a5c:	6a 01                	push   $0x1
+    4a5e:	e8 0d 1a 00 00       	call   6470 <printf>
+  if(t > 0)
+    4a63:	83 c4 20             	add    $0x20,%esp
+    4a66:	85 db                	test   %ebx,%ebx
+    4a68:	7f 43                	jg     4aad <bigfilemb+0x21d>
+  printf(1, "\n");
+    4a6a:	83 ec 08             	sub    $0x8,%esp
+    4a6d:	68 46 76 00 00       	push   $0x7646
+    4a72:	6a 01                	push   $0x1
+    4a74:	e8 f7 19 00 00       	call   6470 <printf>
+  if(unlink("bigfile") < 0){
+    4a79:	c7 04 24 e6 7c 00 00 	movl   $0x7ce6,(%esp)
+    4a80:	e8 64 15 00 00       	call   5fe9 <unlink>
+    4a85:	83 c4 10             	add    $0x10,%esp
+    4a88:	85 c0                	test   %eax,%eax
+    4a8a:	0f 88 a8 00 00 00    	js     4b38 <bigfilemb+0x2a8>
+  printf(1, "bigfile %d MB test ok\n", mb);
+    4a90:	83 ec 04             	sub    $0x4,%esp
+    4a93:	ff 75 08             	push   0x8(%ebp)
+    4a96:	68 1b 7e 00 00       	push   $0x7e1b
+    4a9b:	6a 01                	push   $0x1
+    4a9d:	e8 ce 19 00 00       	call   6470 <printf>
+}
+    4aa2:	83 c4 10             	add    $0x10,%esp
+    4aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4aa8:	5b                   	pop    %ebx
+    4aa9:	5e                   	pop    %esi
+    4aaa:	5f                   	pop    %edi
+    4aab:	5d                   	pop    %ebp
+    4aac:	c3                   	ret
+    printf(1, ", %d KB/s", mb*1024*100/t);
+    4aad:	69 45 08 00 90 01 00 	imul   $0x19000,0x8(%ebp),%eax
+    4ab4:	83 ec 04             	sub    $0x4,%esp
+    4ab7:	99                   	cltd
+    4ab8:	f7 fb                	idiv   %ebx
+    4aba:	50                   	push   %eax
+    4abb:	68 cd 7d 00 00       	push   $0x7dcd
+    4ac0:	6a 01                	push   $0x1
+    4ac2:	e8 a9 19 00 00       	call   6470 <printf>
+    4ac7:	83 c4 10             	add    $0x10,%esp
+    4aca:	eb 9e                	jmp    4a6a <bigfilemb+0x1da>
+        printf(1, "read bigfile wrong data at %d\n", i);
+    4acc:	83 ec 04             	sub    $0x4,%esp
+    4acf:	56                   	push   %esi
+    4ad0:	68 84 88 00 00       	push   $0x8884
+    4ad5:	6a 01                	push   $0x1
+    4ad7:	e8 94 19 00 00       	call   6470 <printf>
+        exit();
+    4adc:	e8 1f 14 00 00       	call   5f00 <exit>
+    printf(1, "cannot create bigfile\n");
+    4ae1:	50                   	push   %eax
+    4ae2:	50                   	push   %eax
+    4ae3:	68 9a 7d 00 00       	push   $0x7d9a
+    4ae8:	6a 01                	push   $0x1
+    4aea:	e8 81 19 00 00       	call   6470 <printf>
+    exit();
+    4aef:	e8 0c 14 00 00       	call   5f00 <exit>
+    printf(1, "bigfile too long\n");
+    4af4:	52                   	push   %edx
+    4af5:	52                   	push   %edx
+    4af6:	68 f2 7d 00 00       	push   $0x7df2
+    4afb:	6a 01                	push   $0x1
+    4afd:	e8 6e 19 00 00       	call   6470 <printf>
+    exit();
+    4b02:	e8 f9 13 00 00       	call   5f00 <exit>
+    4b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b0e:	66 90                	xchg   %ax,%ax
+      printf(1, "read bigfile failed at %d\n", i);
+    4b10:	83 ec 04             	sub    $0x4,%esp
+    4b13:	56                   	push   %esi
+    4b14:	68 d7 7d 00 00       	push   $0x7dd7
+    4b19:	6a 01                	push   $0x1
+    4b1b:	e8 50 19 00 00       	call   6470 <printf>
+      exit();
+    4b20:	e8 db 13 00 00       	call   5f00 <exit>
+    printf(1, "cannot open bigfile\n");
+    4b25:	51                   	push   %ecx
+    4b26:	51                   	push   %ecx
+    4b27:	68 04 7d 00 00       	push   $0x7d04
+    4b2c:	6a 01                	push   $0x1
+    4b2e:	e8 3d 19 00 00       	call   6470 <printf>
+    exit();
+    4b33:	e8 c8 13 00 00       	call   5f00 <exit>
+    printf(1, "unlink bigfile failed\n");
+    4b38:	50                   	push   %eax
+    4b39:	50                   	push   %eax
+    4b3a:	68 04 7e 00 00       	push   $0x7e04
+    4b3f:	6a 01                	push   $0x1
+    4b41:	e8 2a 19 00 00       	call   6470 <printf>
+    exit();
+    4b46:	e8 b5 13 00 00       	call   5f00 <exit>
+    4b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4b4f:	90                   	nop
+      printf(1, "write bigfile failed at %d\n", i);
+    4b50:	83 ec 04             	sub    $0x4,%esp
+    4b53:	57                   	push   %edi
+    4b54:	68 b1 7d 00 00       	push   $0x7db1
+    4b59:	6a 01                	push   $0x1
+    4b5b:	e8 10 19 00 00       	call   6470 <printf>
+      exit();
+    4b60:	e8 9b 13 00 00       	call   5f00 <exit>
+    4b65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004b70 <fourteen>:
+{
+    4b70:	55                   	push   %ebp
+    4b71:	89 e5                	mov    %esp,%ebp
+    4b73:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    4b76:	68 32 7e 00 00       	push   $0x7e32
+    4b7b:	6a 01                	push   $0x1
+    4b7d:	e8 ee 18 00 00       	call   6470 <printf>
+  if(mkdir("12345678901234") != 0){
+    4b82:	c7 04 24 6d 7e 00 00 	movl   $0x7e6d,(%esp)
+    4b89:	e8 88 14 00 00       	call   6016 <mkdir>
+    4b8e:	83 c4 10             	add    $0x10,%esp
+    4b91:	85 c0                	test   %eax,%eax
+    4b93:	0f 85 97 00 00 00    	jne    4c30 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    4b99:	83 ec 0c             	sub    $0xc,%esp
+    4b9c:	68 c4 88 00 00       	push   $0x88c4
+    4ba1:	e8 70 14 00 00       	call   6016 <mkdir>
+    4ba6:	83 c4 10             	add    $0x10,%esp
+    4ba9:	85 c0                	test   %eax,%eax
+    4bab:	0f 85 de 00 00 00    	jne    4c8f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    4bb1:	83 ec 08             	sub    $0x8,%esp
+    4bb4:	68 00 02 00 00       	push   $0x200
+    4bb9:	68 14 89 00 00       	push   $0x8914
+    4bbe:	e8 08 14 00 00       	call   5fcb <open>
+  if(fd < 0){
+    4bc3:	83 c4 10             	add    $0x10,%esp
+    4bc6:	85 c0                	test   %eax,%eax
+    4bc8:	0f 88 ae 00 00 00    	js     4c7c <fourteen+0x10c>
+  close(fd);
+    4bce:	83 ec 0c             	sub    $0xc,%esp
+    4bd1:	50                   	push   %eax
+    4bd2:	e8 c7 13 00 00       	call   5f9e <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    4bd7:	58                   	pop    %eax
+    4bd8:	5a                   	pop    %edx
+    4bd9:	6a 00                	push   $0x0
+    4bdb:	68 84 89 00 00       	push   $0x8984
+    4be0:	e8 e6 13 00 00       	call   5fcb <open>
+  if(fd < 0){
+    4be5:	83 c4 10             	add    $0x10,%esp
+    4be8:	85 c0                	test   %eax,%eax
+    4bea:	78 7d                	js     4c69 <fourteen+0xf9>
+  close(fd);
+    4bec:	83 ec 0c             	sub    $0xc,%esp
+    4bef:	50                   	push   %eax
+    4bf0:	e8 a9 13 00 00       	call   5f9e <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    4bf5:	c7 04 24 5e 7e 00 00 	movl   $0x7e5e,(%esp)
+    4bfc:	e8 15 14 00 00       	call   6016 <mkdir>
+    4c01:	83 c4 10             	add    $0x10,%esp
+    4c04:	85 c0                	test   %eax,%eax
+    4c06:	74 4e                	je     4c56 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    4c08:	83 ec 0c             	sub    $0xc,%esp
+    4c0b:	68 20 8a 00 00       	push   $0x8a20
+    4c10:	e8 01 14 00 00       	call   6016 <mkdir>
+    4c15:	83 c4 10             	add    $0x10,%esp
+    4c18:	85 c0                	test   %eax,%eax
+    4c1a:	74 27                	je     4c43 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    4c1c:	83 ec 08             	sub    $0x8,%esp
+    4c1f:	68 7c 7e 00 00       	push   $0x7e7c
+    4c24:	6a 01                	push   $0x1
+    4c26:	e8 45 18 00 00       	call   6470 <printf>
+}
+    4c2b:	83 c4 10             	add    $0x10,%esp
+    4c2e:	c9                   	leave
+    4c2f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    4c30:	50                   	push   %eax
+    4c31:	50                   	push   %eax
+    4c32:	68 41 7e 00 00       	push   $0x7e41
+    4c37:	6a 01                	push   $0x1
+    4c39:	e8 32 18 00 00       	call   6470 <printf>
+    exit();
+    4c3e:	e8 bd 12 00 00       	call   5f00 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    4c43:	50                   	push   %eax
+    4c44:	50                   	push   %eax
+    4c45:	68 40 8a 00 00       	push   $0x8a40
+    4c4a:	6a 01                	push   $0x1
+    4c4c:	e8 1f 18 00 00       	call   6470 <printf>
+    exit();
+    4c51:	e8 aa 12 00 00       	call   5f00 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    4c56:	52                   	push   %edx
+    4c57:	52                   	push   %edx
+    4c58:	68 f0 89 00 00       	push   $0x89f0
+    4c5d:	6a 01                	push   $0x1
+    4c5f:	e8 0c 18 00 00       	call   6470 <printf>
+    exit();
+    4c64:	e8 97 12 00 00       	call   5f00 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    4c69:	51                   	push   %ecx
+    4c6a:	51                   	push   %ecx
+    4c6b:	68 b4 89 00 00       	push   $0x89b4
+    4c70:	6a 01                	push   $0x1
+    4c72:	e8 f9 17 00 00       	call   6470 <printf>
+    exit();
+    4c77:	e8 84 12 00 00       	call   5f00 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    4c7c:	51                   	push   %ecx
+    4c7d:	51                   	push   %ecx
+    4c7e:	68 44 89 00 00       	push   $0x8944
+    4c83:	6a 01                	push   $0x1
+    4c85:	e8 e6 17 00 00       	call   6470 <printf>
+    exit();
+    4c8a:	e8 71 12 00 00       	call   5f00 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    4c8f:	50                   	push   %eax
+    4c90:	50                   	push   %eax
+    4c91:	68 e4 88 00 00       	push   $0x88e4
+    4c96:	6a 01                	push   $0x1
+    4c98:	e8 d3 17 00 00       	call   6470 <printf>
+    exit();
+    4c9d:	e8 5e 12 00 00       	call   5f00 <exit>
+    4ca2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004cb0 <rmdot>:
+{
+    4cb0:	55                   	push   %ebp
+    4cb1:	89 e5                	mov    %esp,%ebp
+    4cb3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    4cb6:	68 89 7e 00 00       	push   $0x7e89
+    4cbb:	6a 01                	push   $0x1
+    4cbd:	e8 ae 17 00 00       	call   6470 <printf>
+  if(mkdir("dots") != 0){
+    4cc2:	c7 04 24 95 7e 00 00 	movl   $0x7e95,(%esp)
+    4cc9:	e8 48 13 00 00       	call   6016 <mkdir>
+    4cce:	83 c4 10             	add    $0x10,%esp
+    4cd1:	85 c0                	test   %eax,%eax
+    4cd3:	0f 85 b0 00 00 00    	jne    4d89 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    4cd9:	83 ec 0c             	sub    $0xc,%esp
+    4cdc:	68 95 7e 00 00       	push   $0x7e95
+    4ce1:	e8 3f 13 00 00       	call   6025 <chdir>
+    4ce6:	83 c4 10             	add    $0x10,%esp
+    4ce9:	85 c0                	test   %eax,%eax
+    4ceb:	0f 85 1d 01 00 00    	jne    4e0e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    4cf1:	83 ec 0c             	sub    $0xc,%esp
+    4cf4:	68 94 7a 00 00       	push   $0x7a94
+    4cf9:	e8 eb 12 00 00       	call   5fe9 <unlink>
+    4cfe:	83 c4 10             	add    $0x10,%esp
+    4d01:	85 c0                	test   %eax,%eax
+    4d03:	0f 84 f2 00 00 00    	je     4dfb <rmdot+0x14b>
+  if(unlink("..") == 0){
+    4d09:	83 ec 0c             	sub    $0xc,%esp
+    4d0c:	68 93 7a 00 00       	push   $0x7a93
+    4d11:	e8 d3 12 00 00       	call   5fe9 <unlink>
+    4d16:	83 c4 10             	add    $0x10,%esp
+    4d19:	85 c0                	test   %eax,%eax
+    4d1b:	0f 84 c7 00 00 00    	je     4de8 <rmdot+0x138>
+  if(chdir("/") != 0){
+    4d21:	83 ec 0c             	sub    $0xc,%esp
+    4d24:	68 71 6e 00 00       	push   $0x6e71
+    4d29:	e8 f7 12 00 00       	call   6025 <chdir>
+    4d2e:	83 c4 10             	add    $0x10,%esp
+    4d31:	85 c0                	test   %eax,%eax
+    4d33:	0f 85 9c 00 00 00    	jne    4dd5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    4d39:	83 ec 0c             	sub    $0xc,%esp
+    4d3c:	68 dd 7e 00 00       	push   $0x7edd
+    4d41:	e8 a3 12 00 00       	call   5fe9 <unlink>
+    4d46:	83 c4 10             	add    $0x10,%esp
+    4d49:	85 c0                	test   %eax,%eax
+    4d4b:	74 75                	je     4dc2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    4d4d:	83 ec 0c             	sub    $0xc,%esp
+    4d50:	68 fb 7e 00 00       	push   $0x7efb
+    4d55:	e8 8f 12 00 00       	call   5fe9 <unlink>
+    4d5a:	83 c4 10             	add    $0x10,%esp
+    4d5d:	85 c0                	test   %eax,%eax
+    4d5f:	74 4e                	je     4daf <rmdot+0xff>
+  if(unlink("dots") != 0){
+    4d61:	83 ec 0c             	sub    $0xc,%esp
+    4d64:	68 95 7e 00 00       	push   $0x7e95
+    4d69:	e8 7b 12 00 00       	call   5fe9 <unlink>
+    4d6e:	83 c4 10             	add    $0x10,%esp
+    4d71:	85 c0                	test   %eax,%eax
+    4d73:	75 27                	jne    4d9c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    4d75:	83 ec 08             	sub    $0x8,%esp
+    4d78:	68 30 7f 00 00       	push   $0x7f30
+    4d7d:	6a 01                	push   $0x1
+    4d7f:	e8 ec 16 00 00       	call   6470 <printf>
+}
+    4d84:	83 c4 10             	add    $0x10,%esp
+    4d87:	c9                   	leave
+    4d88:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    4d89:	50                   	push   %eax
+    4d8a:	50                   	push   %eax
+    4d8b:	68 9a 7e 00 00       	push   $0x7e9a
+    4d90:	6a 01                	push   $0x1
+    4d92:	e8 d9 16 00 00       	call   6470 <printf>
+    exit();
+    4d97:	e8 64 11 00 00       	call   5f00 <exit>
+    printf(1, "unlink dots failed!\n");
+    4d9c:	50                   	push   %eax
+    4d9d:	50                   	push   %eax
+    4d9e:	68 1b 7f 00 00       	push   $0x7f1b
+    4da3:	6a 01                	push   $0x1
+    4da5:	e8 c6 16 00 00       	call   6470 <printf>
+    exit();
+    4daa:	e8 51 11 00 00       	call   5f00 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    4daf:	52                   	push   %edx
+    4db0:	52                   	push   %edx
+    4db1:	68 03 7f 00 00       	push   $0x7f03
+    4db6:	6a 01                	push   $0x1
+    4db8:	e8 b3 16 00 00       	call   6470 <printf>
+    exit();
+    4dbd:	e8 3e 11 00 00       	call   5f00 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    4dc2:	51                   	push   %ecx
+    4dc3:	51                   	push   %ecx
+    4dc4:	68 e4 7e 00 00       	push   $0x7ee4
+    4dc9:	6a 01                	push   $0x1
+    4dcb:	e8 a0 16 00 00       	call   6470 <printf>
+    exit();
+    4dd0:	e8 2b 11 00 00       	call   5f00 <exit>
+    printf(1, "chdir / failed\n");
+    4dd5:	50                   	push   %eax
+    4dd6:	50                   	push   %eax
+    4dd7:	68 73 6e 00 00       	push   $0x6e73
+    4ddc:	6a 01                	push   $0x1
+    4dde:	e8 8d 16 00 00       	call   6470 <printf>
+    exit();
+    4de3:	e8 18 11 00 00       	call   5f00 <exit>
+    printf(1, "rm .. worked!\n");
+    4de8:	50                   	push   %eax
+    4de9:	50                   	push   %eax
+    4dea:	68 ce 7e 00 00       	push   $0x7ece
+    4def:	6a 01                	push   $0x1
+    4df1:	e8 7a 16 00 00       	call   6470 <printf>
+    exit();
+    4df6:	e8 05 11 00 00       	call   5f00 <exit>
+    printf(1, "rm . worked!\n");
+    4dfb:	50                   	push   %eax
+    4dfc:	50                   	push   %eax
+    4dfd:	68 c0 7e 00 00       	push   $0x7ec0
+    4e02:	6a 01                	push   $0x1
+    4e04:	e8 67 16 00 00       	call   6470 <printf>
+    exit();
+    4e09:	e8 f2 10 00 00       	call   5f00 <exit>
+    printf(1, "chdir dots failed\n");
+    4e0e:	50                   	push   %eax
+    4e0f:	50                   	push   %eax
+    4e10:	68 ad 7e 00 00       	push   $0x7ead
+    4e15:	6a 01                	push   $0x1
+    4e17:	e8 54 16 00 00       	call   6470 <printf>
+    exit();
+    4e1c:	e8 df 10 00 00       	call   5f00 <exit>
+    4e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4e2f:	90                   	nop
+
+00004e30 <dirfile>:
+{
+    4e30:	55                   	push   %ebp
+    4e31:	89 e5                	mov    %esp,%ebp
+    4e33:	53                   	push   %ebx
+    4e34:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    4e37:	68 3a 7f 00 00       	push   $0x7f3a
+    4e3c:	6a 01                	push   $0x1
+    4e3e:	e8 2d 16 00 00       	call   6470 <printf>
+  fd = open("dirfile", O_CREATE);
+    4e43:	5b                   	pop    %ebx
+    4e44:	58                   	pop    %eax
+    4e45:	68 00 02 00 00       	push   $0x200
+    4e4a:	68 47 7f 00 00       	push   $0x7f47
+    4e4f:	e8 77 11 00 00       	call   5fcb <open>
+  if(fd < 0){
+    4e54:	83 c4 10             	add    $0x10,%esp
+    4e57:	85 c0                	test   %eax,%eax
+    4e59:	0f 88 43 01 00 00    	js     4fa2 <dirfile+0x172>
+  close(fd);
+    4e5f:	83 ec 0c             	sub    $0xc,%esp
+    4e62:	50                   	push   %eax
+    4e63:	e8 36 11 00 00       	call   5f9e <close>
+  if(chdir("dirfile") == 0){
+    4e68:	c7 04 24 47 7f 00 00 	movl   $0x7f47,(%esp)
+    4e6f:	e8 b1 11 00 00       	call   6025 <chdir>
+    4e74:	83 c4 10             	add    $0x10,%esp
+    4e77:	85 c0                	test   %eax,%eax
+    4e79:	0f 84 10 01 00 00    	je     4f8f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    4e7f:	83 ec 08             	sub    $0x8,%esp
+    4e82:	6a 00                	push   $0x0
+    4e84:	68 80 7f 00 00       	push   $0x7f80
+    4e89:	e8 3d 11 00 00       	call   5fcb <open>
+  if(fd >= 0){
+    4e8e:	83 c4 10             	add    $0x10,%esp
+    4e91:	85 c0                	test   %eax,%eax
+    4e93:	0f 89 e3 00 00 00    	jns    4f7c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    4e99:	83 ec 08             	sub    $0x8,%esp
+    4e9c:	68 00 02 00 00       	push   $0x200
+    4ea1:	68 80 7f 00 00       	push   $0x7f80
+    4ea6:	e8 20 11 00 00       	call   5fcb <open>
+  if(fd >= 0){
+    4eab:	83 c4 10             	add    $0x10,%esp
+    4eae:	85 c0                	test   %eax,%eax
+    4eb0:	0f 89 c6 00 00 00    	jns    4f7c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    4eb6:	83 ec 0c             	sub    $0xc,%esp
+    4eb9:	68 80 7f 00 00       	push   $0x7f80
+    4ebe:	e8 53 11 00 00       	call   6016 <mkdir>
+    4ec3:	83 c4 10             	add    $0x10,%esp
+    4ec6:	85 c0                	test   %eax,%eax
+    4ec8:	0f 84 46 01 00 00    	je     5014 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    4ece:	83 ec 0c             	sub    $0xc,%esp
+    4ed1:	68 80 7f 00 00       	push   $0x7f80
+    4ed6:	e8 0e 11 00 00       	call   5fe9 <unlink>
+    4edb:	83 c4 10             	add    $0x10,%esp
+    4ede:	85 c0                	test   %eax,%eax
+    4ee0:	0f 84 1b 01 00 00    	je     5001 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    4ee6:	83 ec 08             	sub    $0x8,%esp
+    4ee9:	68 80 7f 00 00       	push   $0x7f80
+    4eee:	68 e4 7f 00 00       	push   $0x7fe4
+    4ef3:	e8 0f 11 00 00       	call   6007 <link>
+    4ef8:	83 c4 10             	add    $0x10,%esp
+    4efb:	85 c0                	test   %eax,%eax
+    4efd:	0f 84 eb 00 00 00    	je     4fee <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    4f03:	83 ec 0c             	sub    $0xc,%esp
+    4f06:	68 47 7f 00 00       	push   $0x7f47
+    4f0b:	e8 d9 10 00 00       	call   5fe9 <unlink>
+    4f10:	83 c4 10             	add    $0x10,%esp
+    4f13:	85 c0                	test   %eax,%eax
+    4f15:	0f 85 c0 00 00 00    	jne    4fdb <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    4f1b:	83 ec 08             	sub    $0x8,%esp
+    4f1e:	6a 02                	push   $0x2
+    4f20:	68 94 7a 00 00       	push   $0x7a94
+    4f25:	e8 a1 10 00 00       	call   5fcb <open>
+  if(fd >= 0){
+    4f2a:	83 c4 10             	add    $0x10,%esp
+    4f2d:	85 c0                	test   %eax,%eax
+    4f2f:	0f 89 93 00 00 00    	jns    4fc8 <dirfile+0x198>
+  fd = open(".", 0);
+    4f35:	83 ec 08             	sub    $0x8,%esp
+    4f38:	6a 00                	push   $0x0
+    4f3a:	68 94 7a 00 00       	push   $0x7a94
+    4f3f:	e8 87 10 00 00       	call   5fcb <open>
+  if(write(fd, "x", 1) > 0){
+    4f44:	83 c4 0c             	add    $0xc,%esp
+    4f47:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    4f49:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    4f4b:	68 77 7b 00 00       	push   $0x7b77
+    4f50:	50                   	push   %eax
+    4f51:	e8 39 10 00 00       	call   5f8f <write>
+    4f56:	83 c4 10             	add    $0x10,%esp
+    4f59:	85 c0                	test   %eax,%eax
+    4f5b:	7f 58                	jg     4fb5 <dirfile+0x185>
+  close(fd);
+    4f5d:	83 ec 0c             	sub    $0xc,%esp
+    4f60:	53                   	push   %ebx
+    4f61:	e8 38 10 00 00       	call   5f9e <close>
+  printf(1, "dir vs file OK\n");
+    4f66:	58                   	pop    %eax
+    4f67:	5a                   	pop    %edx
+    4f68:	68 17 80 00 00       	push   $0x8017
+    4f6d:	6a 01                	push   $0x1
+    4f6f:	e8 fc 14 00 00       	call   6470 <printf>
+}
+    4f74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4f77:	83 c4 10             	add    $0x10,%esp
+    4f7a:	c9                   	leave
+    4f7b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    4f7c:	50                   	push   %eax
+    4f7d:	50                   	push   %eax
+    4f7e:	68 8b 7f 00 00       	push   $0x7f8b
+    4f83:	6a 01                	push   $0x1
+    4f85:	e8 e6 14 00 00       	call   6470 <printf>
+    exit();
+    4f8a:	e8 71 0f 00 00       	call   5f00 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    4f8f:	52                   	push   %edx
+    4f90:	52                   	push   %edx
+    4f91:	68 66 7f 00 00       	push   $0x7f66
+    4f96:	6a 01                	push   $0x1
+    4f98:	e8 d3 14 00 00       	call   6470 <printf>
+    exit();
+    4f9d:	e8 5e 0f 00 00       	call   5f00 <exit>
+    printf(1, "create dirfile failed\n");
+    4fa2:	51                   	push   %ecx
+    4fa3:	51                   	push   %ecx
+    4fa4:	68 4f 7f 00 00       	push   $0x7f4f
+    4fa9:	6a 01                	push   $0x1
+    4fab:	e8 c0 14 00 00       	call   6470 <printf>
+    exit();
+    4fb0:	e8 4b 0f 00 00       	call   5f00 <exit>
+    printf(1, "write . succeeded!\n");
+    4fb5:	51                   	push   %ecx
+    4fb6:	51                   	push   %ecx
+    4fb7:	68 03 80 00 00       	push   $0x8003
+    4fbc:	6a 01                	push   $0x1
+    4fbe:	e8 ad 14 00 00       	call   6470 <printf>
+    exit();
+    4fc3:	e8 38 0f 00 00       	call   5f00 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    4fc8:	53                   	push   %ebx
+    4fc9:	53                   	push   %ebx
+    4fca:	68 94 8a 00 00       	push   $0x8a94
+    4fcf:	6a 01                	push   $0x1
+    4fd1:	e8 9a 14 00 00       	call   6470 <printf>
+    exit();
+    4fd6:	e8 25 0f 00 00       	call   5f00 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    4fdb:	50                   	push   %eax
+    4fdc:	50                   	push   %eax
+    4fdd:	68 eb 7f 00 00       	push   $0x7feb
+    4fe2:	6a 01                	push   $0x1
+    4fe4:	e8 87 14 00 00       	call   6470 <printf>
+    exit();
+    4fe9:	e8 12 0f 00 00       	call   5f00 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    4fee:	50                   	push   %eax
+    4fef:	50                   	push   %eax
+    4ff0:	68 74 8a 00 00       	push   $0x8a74
+    4ff5:	6a 01                	push   $0x1
+    4ff7:	e8 74 14 00 00       	call   6470 <printf>
+    exit();
+    4ffc:	e8 ff 0e 00 00       	call   5f00 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    5001:	50                   	push   %eax
+    5002:	50                   	push   %eax
+    5003:	68 c6 7f 00 00       	push   $0x7fc6
+    5008:	6a 01                	push   $0x1
+    500a:	e8 61 14 00 00       	call   6470 <printf>
+    exit();
+    500f:	e8 ec 0e 00 00       	call   5f00 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    5014:	50                   	push   %eax
+    5015:	50                   	push   %eax
+    5016:	68 a9 7f 00 00       	push   $0x7fa9
+    501b:	6a 01                	push   $0x1
+    501d:	e8 4e 14 00 00       	call   6470 <printf>
+    exit();
+    5022:	e8 d9 0e 00 00       	call   5f00 <exit>
+    5027:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    502e:	66 90                	xchg   %ax,%ax
+
+00005030 <iref>:
+{
+    5030:	55                   	push   %ebp
+    5031:	89 e5                	mov    %esp,%ebp
+    5033:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    5034:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    5039:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    503c:	68 27 80 00 00       	push   $0x8027
+    5041:	6a 01                	push   $0x1
+    5043:	e8 28 14 00 00       	call   6470 <printf>
+    5048:	83 c4 10             	add    $0x10,%esp
+    504b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    504f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    5050:	83 ec 0c             	sub    $0xc,%esp
+    5053:	68 38 80 00 00       	push   $0x8038
+    5058:	e8 b9 0f 00 00       	call   6016 <mkdir>
+    505d:	83 c4 10             	add    $0x10,%esp
+    5060:	85 c0                	test   %eax,%eax
+    5062:	0f 85 bb 00 00 00    	jne    5123 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    5068:	83 ec 0c             	sub    $0xc,%esp
+    506b:	68 38 80 00 00       	push   $0x8038
+    5070:	e8 b0 0f 00 00       	call   6025 <chdir>
+    5075:	83 c4 10             	add    $0x10,%esp
+    5078:	85 c0                	test   %eax,%eax
+    507a:	0f 85 b7 00 00 00    	jne    5137 <iref+0x107>
+    mkdir("");
+    5080:	83 ec 0c             	sub    $0xc,%esp
+    5083:	68 47 76 00 00       	push   $0x7647
+    5088:	e8 89 0f 00 00       	call   6016 <mkdir>
+    link("README", "");
+    508d:	59                   	pop    %ecx
+    508e:	58                   	pop    %eax
+    508f:	68 47 76 00 00       	push   $0x7647
+    5094:	68 e4 7f 00 00       	push   $0x7fe4
+    5099:	e8 69 0f 00 00       	call   6007 <link>
+    fd = open("", O_CREATE);
+    509e:	58                   	pop    %eax
+    509f:	5a                   	pop    %edx
+    50a0:	68 00 02 00 00       	push   $0x200
+    50a5:	68 47 76 00 00       	push   $0x7647
+    50aa:	e8 1c 0f 00 00       	call   5fcb <open>
+    if(fd >= 0)
+    50af:	83 c4 10             	add    $0x10,%esp
+    50b2:	85 c0                	test   %eax,%eax
+    50b4:	78 0c                	js     50c2 <iref+0x92>
+      close(fd);
+    50b6:	83 ec 0c             	sub    $0xc,%esp
+    50b9:	50                   	push   %eax
+    50ba:	e8 df 0e 00 00       	call   5f9e <close>
+    50bf:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    50c2:	83 ec 08             	sub    $0x8,%esp
+    50c5:	68 00 02 00 00       	push   $0x200
+    50ca:	68 76 7b 00 00       	push   $0x7b76
+    50cf:	e8 f7 0e 00 00       	call   5fcb <open>
+    if(fd >= 0)
+    50d4:	83 c4 10             	add    $0x10,%esp
+    50d7:	85 c0                	test   %eax,%eax
+    50d9:	78 0c                	js     50e7 <iref+0xb7>
+      close(fd);
+    50db:	83 ec 0c             	sub    $0xc,%esp
+    50de:	50                   	push   %eax
+    50df:	e8 ba 0e 00 00       	call   5f9e <close>
+    50e4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    50e7:	83 ec 0c             	sub    $0xc,%esp
+    50ea:	68 76 7b 00 00       	push   $0x7b76
+    50ef:	e8 f5 0e 00 00       	call   5fe9 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    50f4:	83 c4 10             	add    $0x10,%esp
+    50f7:	83 eb 01             	sub    $0x1,%ebx
+    50fa:	0f 85 50 ff ff ff    	jne    5050 <iref+0x20>
+  chdir("/");
+    5100:	83 ec 0c             	sub    $0xc,%esp
+    5103:	68 71 6e 00 00       	push   $0x6e71
+    5108:	e8 18 0f 00 00       	call   6025 <chdir>
+  printf(1, "empty file name OK\n");
+    510d:	58                   	pop    %eax
+    510e:	5a                   	pop    %edx
+    510f:	68 66 80 00 00       	push   $0x8066
+    5114:	6a 01                	push   $0x1
+    5116:	e8 55 13 00 00       	call   6470 <printf>
+}
+    511b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    511e:	83 c4 10             	add    $0x10,%esp
+    5121:	c9                   	leave
+    5122:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    5123:	83 ec 08             	sub    $0x8,%esp
+    5126:	68 3e 80 00 00       	push   $0x803e
+    512b:	6a 01                	push   $0x1
+    512d:	e8 3e 13 00 00       	call   6470 <printf>
+      exit();
+    5132:	e8 c9 0d 00 00       	call   5f00 <exit>
+      printf(1, "chdir irefd failed\n");
+    5137:	83 ec 08             	sub    $0x8,%esp
+    513a:	68 52 80 00 00       	push   $0x8052
+    513f:	6a 01                	push   $0x1
+    5141:	e8 2a 13 00 00       	call   6470 <printf>
+      exit();
+    5146:	e8 b5 0d 00 00       	call   5f00 <exit>
+    514b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    514f:	90                   	nop
+
+00005150 <forktest>:
+{
+    5150:	55                   	push   %ebp
+    5151:	89 e5                	mov    %esp,%ebp
+    5153:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    5154:	31 db                	xor    %ebx,%ebx
+{
+    5156:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    5159:	68 7a 80 00 00       	push   $0x807a
+    515e:	6a 01                	push   $0x1
+    5160:	e8 0b 13 00 00       	call   6470 <printf>
+    5165:	83 c4 10             	add    $0x10,%esp
+    5168:	eb 13                	jmp    517d <forktest+0x2d>
+    516a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    5170:	74 4d                	je     51bf <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    5172:	83 c3 01             	add    $0x1,%ebx
+    5175:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    517b:	74 6e                	je     51eb <forktest+0x9b>
+    pid = fork();
+    517d:	e8 4e 0d 00 00       	call   5ed0 <fork>
+    if(pid < 0)
+    5182:	85 c0                	test   %eax,%eax
+    5184:	79 ea                	jns    5170 <forktest+0x20>
+  for(; n > 0; n--){
+    5186:	85 db                	test   %ebx,%ebx
+    5188:	74 14                	je     519e <forktest+0x4e>
+    518a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    5190:	e8 cd 0d 00 00       	call   5f62 <wait>
+    5195:	85 c0                	test   %eax,%eax
+    5197:	78 2b                	js     51c4 <forktest+0x74>
+  for(; n > 0; n--){
+    5199:	83 eb 01             	sub    $0x1,%ebx
+    519c:	75 f2                	jne    5190 <forktest+0x40>
+  if(wait() != -1){
+    519e:	e8 bf 0d 00 00       	call   5f62 <wait>
+    51a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    51a6:	75 30                	jne    51d8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    51a8:	83 ec 08             	sub    $0x8,%esp
+    51ab:	68 ac 80 00 00       	push   $0x80ac
+    51b0:	6a 01                	push   $0x1
+    51b2:	e8 b9 12 00 00       	call   6470 <printf>
+}
+    51b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    51ba:	83 c4 10             	add    $0x10,%esp
+    51bd:	c9                   	leave
+    51be:	c3                   	ret
+      exit();
+    51bf:	e8 3c 0d 00 00       	call   5f00 <exit>
+      printf(1, "wait stopped early\n");
+    51c4:	83 ec 08             	sub    $0x8,%esp
+    51c7:	68 85 80 00 00       	push   $0x8085
+    51cc:	6a 01                	push   $0x1
+    51ce:	e8 9d 12 00 00       	call   6470 <printf>
+      exit();
+    51d3:	e8 28 0d 00 00       	call   5f00 <exit>
+    printf(1, "wait got too many\n");
+    51d8:	50                   	push   %eax
+    51d9:	50                   	push   %eax
+    51da:	68 99 80 00 00       	push   $0x8099
+    51df:	6a 01                	push   $0x1
+    51e1:	e8 8a 12 00 00       	call   6470 <printf>
+    exit();
+    51e6:	e8 15 0d 00 00       	call   5f00 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    51eb:	52                   	push   %edx
+    51ec:	52                   	push   %edx
+    51ed:	68 b4 8a 00 00       	push   $0x8ab4
+    51f2:	6a 01                	push   $0x1
+    51f4:	e8 77 12 00 00       	call   6470 <printf>
+    exit();
+    51f9:	e8 02 0d 00 00       	call   5f00 <exit>
+    51fe:	66 90                	xchg   %ax,%ax
+
+00005200 <sbrktest>:
+{
+    5200:	55                   	push   %ebp
+    5201:	89 e5                	mov    %esp,%ebp
+    5203:	57                   	push   %edi
+    5204:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    5205:	31 f6                	xor    %esi,%esi
+{
+    5207:	53                   	push   %ebx
+    5208:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "sbrk test\n");
+    520b:	68 ba 80 00 00       	push   $0x80ba
+    5210:	6a 01                	push   $0x1
+    5212:	e8 59 12 00 00       	call   6470 <printf>
+  oldbrk = sbrk(0);
+    5217:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    521e:	e8 2f 0e 00 00       	call   6052 <sbrk>
+    5223:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    5226:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    522d:	e8 20 0e 00 00       	call   6052 <sbrk>
+    5232:	83 c4 10             	add    $0x10,%esp
+    5235:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    5237:	eb 09                	jmp    5242 <sbrktest+0x42>
+    5239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    a = b + 1;
+    5240:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    5242:	83 ec 0c             	sub    $0xc,%esp
+    5245:	6a 01                	push   $0x1
+    5247:	e8 06 0e 00 00       	call   6052 <sbrk>
+    if(b != a){
+    524c:	83 c4 10             	add    $0x10,%esp
+    524f:	39 d8                	cmp    %ebx,%eax
+    5251:	0f 85 99 02 00 00    	jne    54f0 <sbrktest+0x2f0>
+  for(i = 0; i < 5000; i++){
+    5257:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    525a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    525d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    5260:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    5266:	75 d8                	jne    5240 <sbrktest+0x40>
+  pid = fork();
+    5268:	e8 63 0c 00 00       	call   5ed0 <fork>
+    526d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    526f:	85 c0                	test   %eax,%eax
+    5271:	0f 88 eb 02 00 00    	js     5562 <sbrktest+0x362>
+  c = sbrk(1);
+    5277:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    527a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    527d:	6a 01                	push   $0x1
+    527f:	e8 ce 0d 00 00       	call   6052 <sbrk>
+  c = sbrk(1);
+    5284:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    528b:	e8 c2 0d 00 00       	call   6052 <sbrk>
+  if(c != a + 1){
+    5290:	83 c4 10             	add    $0x10,%esp
+    5293:	39 c3                	cmp    %eax,%ebx
+    5295:	0f 85 18 03 00 00    	jne    55b3 <sbrktest+0x3b3>
+  if(pid == 0)
+    529b:	85 f6                	test   %esi,%esi
+    529d:	0f 84 0b 03 00 00    	je     55ae <sbrktest+0x3ae>
+  wait();
+    52a3:	e8 ba 0c 00 00       	call   5f62 <wait>
+  a = sbrk(0);
+    52a8:	83 ec 0c             	sub    $0xc,%esp
+    52ab:	6a 00                	push   $0x0
+    52ad:	e8 a0 0d 00 00       	call   6052 <sbrk>
+    52b2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    52b4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    52b9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    52bb:	89 04 24             	mov    %eax,(%esp)
+    52be:	e8 8f 0d 00 00       	call   6052 <sbrk>
+  if (p != a) {
+    52c3:	83 c4 10             	add    $0x10,%esp
+    52c6:	39 c3                	cmp    %eax,%ebx
+    52c8:	0f 85 81 02 00 00    	jne    554f <sbrktest+0x34f>
+  a = sbrk(0);
+    52ce:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    52d1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    52d8:	6a 00                	push   $0x0
+    52da:	e8 73 0d 00 00       	call   6052 <sbrk>
+  c = sbrk(-4096);
+    52df:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    52e6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    52e8:	e8 65 0d 00 00       	call   6052 <sbrk>
+  if(c == (char*)0xffffffff){
+    52ed:	83 c4 10             	add    $0x10,%esp
+    52f0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    52f3:	0f 84 f3 02 00 00    	je     55ec <sbrktest+0x3ec>
+  c = sbrk(0);
+    52f9:	83 ec 0c             	sub    $0xc,%esp
+    52fc:	6a 00                	push   $0x0
+    52fe:	e8 4f 0d 00 00       	call   6052 <sbrk>
+  if(c != a - 4096){
+    5303:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    5309:	83 c4 10             	add    $0x10,%esp
+    530c:	39 d0                	cmp    %edx,%eax
+    530e:	0f 85 c5 02 00 00    	jne    55d9 <sbrktest+0x3d9>
+  a = sbrk(0);
+    5314:	83 ec 0c             	sub    $0xc,%esp
+    5317:	6a 00                	push   $0x0
+    5319:	e8 34 0d 00 00       	call   6052 <sbrk>
+  c = sbrk(4096);
+    531e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    5325:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    5327:	e8 26 0d 00 00       	call   6052 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    532c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    532f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    5331:	39 c3                	cmp    %eax,%ebx
+    5333:	0f 85 8d 02 00 00    	jne    55c6 <sbrktest+0x3c6>
+    5339:	83 ec 0c             	sub    $0xc,%esp
+    533c:	6a 00                	push   $0x0
+    533e:	e8 0f 0d 00 00       	call   6052 <sbrk>
+    5343:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    5349:	83 c4 10             	add    $0x10,%esp
+    534c:	39 c2                	cmp    %eax,%edx
+    534e:	0f 85 72 02 00 00    	jne    55c6 <sbrktest+0x3c6>
+  if(*lastaddr == 99){
+    5354:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    535b:	0f 84 14 02 00 00    	je     5575 <sbrktest+0x375>
+  a = sbrk(0);
+    5361:	83 ec 0c             	sub    $0xc,%esp
+    5364:	6a 00                	push   $0x0
+    5366:	e8 e7 0c 00 00       	call   6052 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    536b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    5372:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    5374:	e8 d9 0c 00 00       	call   6052 <sbrk>
+    5379:	89 c2                	mov    %eax,%edx
+    537b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    537e:	29 d0                	sub    %edx,%eax
+    5380:	89 04 24             	mov    %eax,(%esp)
+    5383:	e8 ca 0c 00 00       	call   6052 <sbrk>
+  if(c != a){
+    5388:	83 c4 10             	add    $0x10,%esp
+    538b:	39 c3                	cmp    %eax,%ebx
+    538d:	0f 85 a9 01 00 00    	jne    553c <sbrktest+0x33c>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    5393:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    5398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    539f:	90                   	nop
+    ppid = getpid();
+    53a0:	e8 9e 0c 00 00       	call   6043 <getpid>
+    53a5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    53a7:	e8 24 0b 00 00       	call   5ed0 <fork>
+    if(pid < 0){
+    53ac:	85 c0                	test   %eax,%eax
+    53ae:	0f 88 56 01 00 00    	js     550a <sbrktest+0x30a>
+    if(pid == 0){
+    53b4:	0f 84 64 01 00 00    	je     551e <sbrktest+0x31e>
+    wait();
+    53ba:	e8 a3 0b 00 00       	call   5f62 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    53bf:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    53c5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    53cb:	75 d3                	jne    53a0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    53cd:	83 ec 0c             	sub    $0xc,%esp
+    53d0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    53d3:	50                   	push   %eax
+    53d4:	e8 98 0b 00 00       	call   5f71 <pipe>
+    53d9:	83 c4 10             	add    $0x10,%esp
+    53dc:	85 c0                	test   %eax,%eax
+    53de:	0f 85 b7 01 00 00    	jne    559b <sbrktest+0x39b>
+    53e4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    53e7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    53ea:	89 df                	mov    %ebx,%edi
+    53ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    53f0:	e8 db 0a 00 00       	call   5ed0 <fork>
+    53f5:	89 07                	mov    %eax,(%edi)
+    53f7:	85 c0                	test   %eax,%eax
+    53f9:	0f 84 8d 00 00 00    	je     548c <sbrktest+0x28c>
+    if(pids[i] != -1)
+    53ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5402:	74 14                	je     5418 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    5404:	83 ec 04             	sub    $0x4,%esp
+    5407:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    540a:	6a 01                	push   $0x1
+    540c:	50                   	push   %eax
+    540d:	ff 75 b8             	push   -0x48(%ebp)
+    5410:	e8 6b 0b 00 00       	call   5f80 <read>
+    5415:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5418:	83 c7 04             	add    $0x4,%edi
+    541b:	39 f7                	cmp    %esi,%edi
+    541d:	75 d1                	jne    53f0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    541f:	83 ec 0c             	sub    $0xc,%esp
+    5422:	68 00 10 00 00       	push   $0x1000
+    5427:	e8 26 0c 00 00       	call   6052 <sbrk>
+    542c:	83 c4 10             	add    $0x10,%esp
+    542f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    5438:	8b 03                	mov    (%ebx),%eax
+    543a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    543d:	74 11                	je     5450 <sbrktest+0x250>
+    kill(pids[i]);
+    543f:	83 ec 0c             	sub    $0xc,%esp
+    5442:	50                   	push   %eax
+    5443:	e8 65 0b 00 00       	call   5fad <kill>
+    wait();
+    5448:	e8 15 0b 00 00       	call   5f62 <wait>
+    544d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5450:	83 c3 04             	add    $0x4,%ebx
+    5453:	39 f3                	cmp    %esi,%ebx
+    5455:	75 e1                	jne    5438 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    5457:	83 ff ff             	cmp    $0xffffffff,%edi
+    545a:	0f 84 28 01 00 00    	je     5588 <sbrktest+0x388>
+  if(sbrk(0) > oldbrk)
+    5460:	83 ec 0c             	sub    $0xc,%esp
+    5463:	6a 00                	push   $0x0
+    5465:	e8 e8 0b 00 00       	call   6052 <sbrk>
+    546a:	83 c4 10             	add    $0x10,%esp
+    546d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    5470:	72 60                	jb     54d2 <sbrktest+0x2d2>
+  printf(1, "sbrk test OK\n");
+    5472:	83 ec 08             	sub    $0x8,%esp
+    5475:	68 62 81 00 00       	push   $0x8162
+    547a:	6a 01                	push   $0x1
+    547c:	e8 ef 0f 00 00       	call   6470 <printf>
+}
+    5481:	83 c4 10             	add    $0x10,%esp
+    5484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5487:	5b                   	pop    %ebx
+    5488:	5e                   	pop    %esi
+    5489:	5f                   	pop    %edi
+    548a:	5d                   	pop    %ebp
+    548b:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    548c:	83 ec 0c             	sub    $0xc,%esp
+    548f:	6a 00                	push   $0x0
+    5491:	e8 bc 0b 00 00       	call   6052 <sbrk>
+    5496:	89 c2                	mov    %eax,%edx
+    5498:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    549d:	29 d0                	sub    %edx,%eax
+    549f:	89 04 24             	mov    %eax,(%esp)
+    54a2:	e8 ab 0b 00 00       	call   6052 <sbrk>
+      write(fds[1], "x", 1);
+    54a7:	83 c4 0c             	add    $0xc,%esp
+    54aa:	6a 01                	push   $0x1
+    54ac:	68 77 7b 00 00       	push   $0x7b77
+    54b1:	ff 75 bc             	push   -0x44(%ebp)
+    54b4:	e8 d6 0a 00 00       	call   5f8f <write>
+    54b9:	83 c4 10             	add    $0x10,%esp
+    54bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      for(;;) sleep(1000);
+    54c0:	83 ec 0c             	sub    $0xc,%esp
+    54c3:	68 e8 03 00 00       	push   $0x3e8
+    54c8:	e8 94 0b 00 00       	call   6061 <sleep>
+    54cd:	83 c4 10             	add    $0x10,%esp
+    54d0:	eb ee                	jmp    54c0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    54d2:	83 ec 0c             	sub    $0xc,%esp
+    54d5:	6a 00                	push   $0x0
+    54d7:	e8 76 0b 00 00       	call   6052 <sbrk>
+    54dc:	89 c2                	mov    %eax,%edx
+    54de:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    54e1:	29 d0                	sub    %edx,%eax
+    54e3:	89 04 24             	mov    %eax,(%esp)
+    54e6:	e8 67 0b 00 00       	call   6052 <sbrk>
+    54eb:	83 c4 10             	add    $0x10,%esp
+    54ee:	eb 82                	jmp    5472 <sbrktest+0x272>
+      printf(1, "sbrk test failed %d %x %x\n", i, a, b);
+    54f0:	83 ec 0c             	sub    $0xc,%esp
+    54f3:	50                   	push   %eax
+    54f4:	53                   	push   %ebx
+    54f5:	56                   	push   %esi
+    54f6:	68 c5 80 00 00       	push   $0x80c5
+    54fb:	6a 01                	push   $0x1
+    54fd:	e8 6e 0f 00 00       	call   6470 <printf>
+      exit();
+    5502:	83 c4 20             	add    $0x20,%esp
+    5505:	e8 f6 09 00 00       	call   5f00 <exit>
+      printf(1, "fork failed\n");
+    550a:	83 ec 08             	sub    $0x8,%esp
+    550d:	68 0b 82 00 00       	push   $0x820b
+    5512:	6a 01                	push   $0x1
+    5514:	e8 57 0f 00 00       	call   6470 <printf>
+      exit();
+    5519:	e8 e2 09 00 00       	call   5f00 <exit>
+      printf(1, "oops could read %x = %x\n", a, *a);
+    551e:	0f be 03             	movsbl (%ebx),%eax
+    5521:	50                   	push   %eax
+    5522:	53                   	push   %ebx
+    5523:	68 2e 81 00 00       	push   $0x812e
+    5528:	6a 01                	push   $0x1
+    552a:	e8 41 0f 00 00       	call   6470 <printf>
+      kill(ppid);
+    552f:	89 34 24             	mov    %esi,(%esp)
+    5532:	e8 76 0a 00 00       	call   5fad <kill>
+      exit();
+    5537:	e8 c4 09 00 00       	call   5f00 <exit>
+    printf(1, "sbrk downsize failed, a %x c %x\n", a, c);
+    553c:	50                   	push   %eax
+    553d:	53                   	push   %ebx
+    553e:	68 a8 8b 00 00       	push   $0x8ba8
+    5543:	6a 01                	push   $0x1
+    5545:	e8 26 0f 00 00       	call   6470 <printf>
+    exit();
+    554a:	e8 b1 09 00 00       	call   5f00 <exit>
+    printf(1, "sbrk test failed to grow big address space; enough phys mem?\n");
+    554f:	56                   	push   %esi
+    5550:	56                   	push   %esi
+    5551:	68 d8 8a 00 00       	push   $0x8ad8
+    5556:	6a 01                	push   $0x1
+    5558:	e8 13 0f 00 00       	call   6470 <printf>
+    exit();
+    555d:	e8 9e 09 00 00       	call   5f00 <exit>
+    printf(1, "sbrk test fork failed\n");
+    5562:	50                   	push   %eax
+    5563:	50                   	push   %eax
+    5564:	68 e0 80 00 00       	push   $0x80e0
+    5569:	6a 01                	push   $0x1
+    556b:	e8 00 0f 00 00       	call   6470 <printf>
+    exit();
+    5570:	e8 8b 09 00 00       	call   5f00 <exit>
+    printf(1, "sbrk de-allocation didn't really deallocate\n");
+    5575:	51                   	push   %ecx
+    5576:	51                   	push   %ecx
+    5577:	68 78 8b 00 00       	push   $0x8b78
+    557c:	6a 01                	push   $0x1
+    557e:	e8 ed 0e 00 00       	call   6470 <printf>
+    exit();
+    5583:	e8 78 09 00 00       	call   5f00 <exit>
+    printf(1, "failed sbrk leaked memory\n");
+    5588:	50                   	push   %eax
+    5589:	50                   	push   %eax
+    558a:	68 47 81 00 00       	push   $0x8147
+    558f:	6a 01                	push   $0x1
+    5591:	e8 da 0e 00 00       	call   6470 <printf>
+    exit();
+    5596:	e8 65 09 00 00       	call   5f00 <exit>
+    printf(1, "pipe() failed\n");
+    559b:	52                   	push   %edx
+    559c:	52                   	push   %edx
+    559d:	68 61 71 00 00       	push   $0x7161
+    55a2:	6a 01                	push   $0x1
+    55a4:	e8 c7 0e 00 00       	call   6470 <printf>
+    exit();
+    55a9:	e8 52 09 00 00       	call   5f00 <exit>
+    exit();
+    55ae:	e8 4d 09 00 00       	call   5f00 <exit>
+    printf(1, "sbrk test failed post-fork\n");
+    55b3:	57                   	push   %edi
+    55b4:	57                   	push   %edi
+    55b5:	68 f7 80 00 00       	push   $0x80f7
+    55ba:	6a 01                	push   $0x1
+    55bc:	e8 af 0e 00 00       	call   6470 <printf>
+    exit();
+    55c1:	e8 3a 09 00 00       	call   5f00 <exit>
+    printf(1, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    55c6:	56                   	push   %esi
+    55c7:	53                   	push   %ebx
+    55c8:	68 50 8b 00 00       	push   $0x8b50
+    55cd:	6a 01                	push   $0x1
+    55cf:	e8 9c 0e 00 00       	call   6470 <printf>
+    exit();
+    55d4:	e8 27 09 00 00       	call   5f00 <exit>
+    printf(1, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    55d9:	50                   	push   %eax
+    55da:	53                   	push   %ebx
+    55db:	68 18 8b 00 00       	push   $0x8b18
+    55e0:	6a 01                	push   $0x1
+    55e2:	e8 89 0e 00 00       	call   6470 <printf>
+    exit();
+    55e7:	e8 14 09 00 00       	call   5f00 <exit>
+    printf(1, "sbrk could not deallocate\n");
+    55ec:	53                   	push   %ebx
+    55ed:	53                   	push   %ebx
+    55ee:	68 13 81 00 00       	push   $0x8113
+    55f3:	6a 01                	push   $0x1
+    55f5:	e8 76 0e 00 00       	call   6470 <printf>
+    exit();
+    55fa:	e8 01 09 00 00       	call   5f00 <exit>
+    55ff:	90                   	nop
+
+00005600 <validateint>:
+}
+    5600:	c3                   	ret
+    5601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    560f:	90                   	nop
+
+00005610 <validatetest>:
+{
+    5610:	55                   	push   %ebp
+    5611:	89 e5                	mov    %esp,%ebp
+    5613:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    5614:	31 f6                	xor    %esi,%esi
+{
+    5616:	53                   	push   %ebx
+  printf(1, "validate test\n");
+    5617:	83 ec 08             	sub    $0x8,%esp
+    561a:	68 70 81 00 00       	push   $0x8170
+    561f:	6a 01                	push   $0x1
+    5621:	e8 4a 0e 00 00       	call   6470 <printf>
+    5626:	83 c4 10             	add    $0x10,%esp
+    5629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((pid = fork()) == 0){
+    5630:	e8 9b 08 00 00       	call   5ed0 <fork>
+    5635:	89 c3                	mov    %eax,%ebx
+    5637:	85 c0                	test   %eax,%eax
+    5639:	74 5f                	je     569a <validatetest+0x8a>
+    sleep(0);
+    563b:	83 ec 0c             	sub    $0xc,%esp
+    563e:	6a 00                	push   $0x0
+    5640:	e8 1c 0a 00 00       	call   6061 <sleep>
+    sleep(0);
+    5645:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    564c:	e8 10 0a 00 00       	call   6061 <sleep>
+    kill(pid);
+    5651:	89 1c 24             	mov    %ebx,(%esp)
+    5654:	e8 54 09 00 00       	call   5fad <kill>
+    wait();
+    5659:	e8 04 09 00 00       	call   5f62 <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    565e:	58                   	pop    %eax
+    565f:	5a                   	pop    %edx
+    5660:	56                   	push   %esi
+    5661:	68 7f 81 00 00       	push   $0x817f
+    5666:	e8 9c 09 00 00       	call   6007 <link>
+    566b:	83 c4 10             	add    $0x10,%esp
+    566e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5671:	75 2c                	jne    569f <validatetest+0x8f>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    5673:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    5679:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    567f:	75 af                	jne    5630 <validatetest+0x20>
+  printf(1, "validate ok\n");
+    5681:	83 ec 08             	sub    $0x8,%esp
+    5684:	68 a3 81 00 00       	push   $0x81a3
+    5689:	6a 01                	push   $0x1
+    568b:	e8 e0 0d 00 00       	call   6470 <printf>
+}
+    5690:	83 c4 10             	add    $0x10,%esp
+    5693:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5696:	5b                   	pop    %ebx
+    5697:	5e                   	pop    %esi
+    5698:	5d                   	pop    %ebp
+    5699:	c3                   	ret
+      exit();
+    569a:	e8 61 08 00 00       	call   5f00 <exit>
+      printf(1, "link should not succeed\n");
+    569f:	83 ec 08             	sub    $0x8,%esp
+    56a2:	68 8a 81 00 00       	push   $0x818a
+    56a7:	6a 01                	push   $0x1
+    56a9:	e8 c2 0d 00 00       	call   6470 <printf>
+      exit();
+    56ae:	e8 4d 08 00 00       	call   5f00 <exit>
+    56b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    56ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000056c0 <bsstest>:
+{
+    56c0:	55                   	push   %ebp
+    56c1:	89 e5                	mov    %esp,%ebp
+    56c3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "bss test\n");
+    56c6:	68 b0 81 00 00       	push   $0x81b0
+    56cb:	6a 01                	push   $0x1
+    56cd:	e8 9e 0d 00 00       	call   6470 <printf>
+    56d2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    56d5:	31 c0                	xor    %eax,%eax
+    56d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    56de:	66 90                	xchg   %ax,%ax
+    if(uninit[i] != '\0'){
+    56e0:	80 b8 80 9e 00 00 00 	cmpb   $0x0,0x9e80(%eax)
+    56e7:	75 1e                	jne    5707 <bsstest+0x47>
+  for(i = 0; i < sizeof(uninit); i++){
+    56e9:	83 c0 01             	add    $0x1,%eax
+    56ec:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    56f1:	75 ed                	jne    56e0 <bsstest+0x20>
+  printf(1, "bss test ok\n");
+    56f3:	83 ec 08             	sub    $0x8,%esp
+    56f6:	68 cb 81 00 00       	push   $0x81cb
+    56fb:	6a 01                	push   $0x1
+    56fd:	e8 6e 0d 00 00       	call   6470 <printf>
+}
+    5702:	83 c4 10             	add    $0x10,%esp
+    5705:	c9                   	leave
+    5706:	c3                   	ret
+      printf(1, "bss test failed\n");
+    5707:	83 ec 08             	sub    $0x8,%esp
+    570a:	68 ba 81 00 00       	push   $0x81ba
+    570f:	6a 01                	push   $0x1
+    5711:	e8 5a 0d 00 00       	call   6470 <printf>
+      exit();
+    5716:	e8 e5 07 00 00       	call   5f00 <exit>
+    571b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    571f:	90                   	nop
+
+00005720 <bigargtest>:
+{
+    5720:	55                   	push   %ebp
+    5721:	89 e5                	mov    %esp,%ebp
+    5723:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    5726:	68 d8 81 00 00       	push   $0x81d8
+    572b:	e8 b9 08 00 00       	call   5fe9 <unlink>
+  pid = fork();
+    5730:	e8 9b 07 00 00       	call   5ed0 <fork>
+  if(pid == 0){
+    5735:	83 c4 10             	add    $0x10,%esp
+    5738:	85 c0                	test   %eax,%eax
+    573a:	74 44                	je     5780 <bigargtest+0x60>
+  } else if(pid < 0){
+    573c:	0f 88 b7 00 00 00    	js     57f9 <bigargtest+0xd9>
+  wait();
+    5742:	e8 1b 08 00 00       	call   5f62 <wait>
+  fd = open("bigarg-ok", 0);
+    5747:	83 ec 08             	sub    $0x8,%esp
+    574a:	6a 00                	push   $0x0
+    574c:	68 d8 81 00 00       	push   $0x81d8
+    5751:	e8 75 08 00 00       	call   5fcb <open>
+  if(fd < 0){
+    5756:	83 c4 10             	add    $0x10,%esp
+    5759:	85 c0                	test   %eax,%eax
+    575b:	0f 88 85 00 00 00    	js     57e6 <bigargtest+0xc6>
+  close(fd);
+    5761:	83 ec 0c             	sub    $0xc,%esp
+    5764:	50                   	push   %eax
+    5765:	e8 34 08 00 00       	call   5f9e <close>
+  unlink("bigarg-ok");
+    576a:	c7 04 24 d8 81 00 00 	movl   $0x81d8,(%esp)
+    5771:	e8 73 08 00 00       	call   5fe9 <unlink>
+}
+    5776:	83 c4 10             	add    $0x10,%esp
+    5779:	c9                   	leave
+    577a:	c3                   	ret
+    577b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    577f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    5780:	c7 04 85 c0 ec 00 00 	movl   $0x8bcc,0xecc0(,%eax,4)
+    5787:	cc 8b 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    578b:	83 c0 01             	add    $0x1,%eax
+    578e:	83 f8 1f             	cmp    $0x1f,%eax
+    5791:	75 ed                	jne    5780 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    5793:	31 c9                	xor    %ecx,%ecx
+    5795:	89 0d 3c ed 00 00    	mov    %ecx,0xed3c
+    printf(1, "bigarg test\n");
+    579b:	50                   	push   %eax
+    579c:	50                   	push   %eax
+    579d:	68 e2 81 00 00       	push   $0x81e2
+    57a2:	6a 01                	push   $0x1
+    57a4:	e8 c7 0c 00 00       	call   6470 <printf>
+    exec("echo", args);
+    57a9:	58                   	pop    %eax
+    57aa:	5a                   	pop    %edx
+    57ab:	68 c0 ec 00 00       	push   $0xecc0
+    57b0:	68 0d 6f 00 00       	push   $0x6f0d
+    57b5:	e8 66 07 00 00       	call   5f20 <exec>
+    printf(1, "bigarg test ok\n");
+    57ba:	59                   	pop    %ecx
+    57bb:	58                   	pop    %eax
+    57bc:	68 ef 81 00 00       	push   $0x81ef
+    57c1:	6a 01                	push   $0x1
+    57c3:	e8 a8 0c 00 00       	call   6470 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    57c8:	58                   	pop    %eax
+    57c9:	5a                   	pop    %edx
+    57ca:	68 00 02 00 00       	push   $0x200
+    57cf:	68 d8 81 00 00       	push   $0x81d8
+    57d4:	e8 f2 07 00 00       	call   5fcb <open>
+    close(fd);
+    57d9:	89 04 24             	mov    %eax,(%esp)
+    57dc:	e8 bd 07 00 00       	call   5f9e <close>
+    exit();
+    57e1:	e8 1a 07 00 00       	call   5f00 <exit>
+    printf(1, "bigarg test failed!\n");
+    57e6:	50                   	push   %eax
+    57e7:	50                   	push   %eax
+    57e8:	68 18 82 00 00       	push   $0x8218
+    57ed:	6a 01                	push   $0x1
+    57ef:	e8 7c 0c 00 00       	call   6470 <printf>
+    exit();
+    57f4:	e8 07 07 00 00       	call   5f00 <exit>
+    printf(1, "bigargtest: fork failed\n");
+    57f9:	52                   	push   %edx
+    57fa:	52                   	push   %edx
+    57fb:	68 ff 81 00 00       	push   $0x81ff
+    5800:	6a 01                	push   $0x1
+    5802:	e8 69 0c 00 00       	call   6470 <printf>
+    exit();
+    5807:	e8 f4 06 00 00       	call   5f00 <exit>
+    580c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005810 <fsfull>:
+{
+    5810:	55                   	push   %ebp
+    5811:	89 e5                	mov    %esp,%ebp
+    5813:	57                   	push   %edi
+    5814:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    5815:	31 f6                	xor    %esi,%esi
+{
+    5817:	53                   	push   %ebx
+    5818:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    581b:	68 2d 82 00 00       	push   $0x822d
+    5820:	6a 01                	push   $0x1
+    5822:	e8 49 0c 00 00       	call   6470 <printf>
+    5827:	83 c4 10             	add    $0x10,%esp
+    582a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    5830:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    5835:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    583a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    583d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5841:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    5843:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5847:	c1 ea 06             	shr    $0x6,%edx
+    584a:	8d 42 30             	lea    0x30(%edx),%eax
+    584d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5850:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    5856:	89 f2                	mov    %esi,%edx
+    5858:	29 c2                	sub    %eax,%edx
+    585a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    585f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    5861:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5866:	c1 ea 05             	shr    $0x5,%edx
+    5869:	83 c2 30             	add    $0x30,%edx
+    586c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    586f:	f7 e6                	mul    %esi
+    5871:	c1 ea 05             	shr    $0x5,%edx
+    5874:	6b c2 64             	imul   $0x64,%edx,%eax
+    5877:	89 f2                	mov    %esi,%edx
+    5879:	29 c2                	sub    %eax,%edx
+    587b:	89 d0                	mov    %edx,%eax
+    587d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    587f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    5881:	c1 ea 03             	shr    $0x3,%edx
+    5884:	83 c2 30             	add    $0x30,%edx
+    5887:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    588a:	f7 e1                	mul    %ecx
+    588c:	89 f0                	mov    %esi,%eax
+    588e:	c1 ea 03             	shr    $0x3,%edx
+    5891:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    5894:	01 d2                	add    %edx,%edx
+    5896:	29 d0                	sub    %edx,%eax
+    5898:	83 c0 30             	add    $0x30,%eax
+    589b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    589e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    58a1:	50                   	push   %eax
+    58a2:	68 3a 82 00 00       	push   $0x823a
+    58a7:	6a 01                	push   $0x1
+    58a9:	e8 c2 0b 00 00       	call   6470 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    58ae:	58                   	pop    %eax
+    58af:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    58b2:	5a                   	pop    %edx
+    58b3:	68 02 02 00 00       	push   $0x202
+    58b8:	50                   	push   %eax
+    58b9:	e8 0d 07 00 00       	call   5fcb <open>
+    if(fd < 0){
+    58be:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    58c1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    58c3:	85 c0                	test   %eax,%eax
+    58c5:	78 4f                	js     5916 <fsfull+0x106>
+    int total = 0;
+    58c7:	31 db                	xor    %ebx,%ebx
+    58c9:	eb 07                	jmp    58d2 <fsfull+0xc2>
+    58cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    58cf:	90                   	nop
+      total += cc;
+    58d0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    58d2:	83 ec 04             	sub    $0x4,%esp
+    58d5:	68 00 02 00 00       	push   $0x200
+    58da:	68 c0 cc 00 00       	push   $0xccc0
+    58df:	57                   	push   %edi
+    58e0:	e8 aa 06 00 00       	call   5f8f <write>
+      if(cc < 512)
+    58e5:	83 c4 10             	add    $0x10,%esp
+    58e8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    58ed:	7f e1                	jg     58d0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    58ef:	83 ec 04             	sub    $0x4,%esp
+    58f2:	53                   	push   %ebx
+    58f3:	68 56 82 00 00       	push   $0x8256
+    58f8:	6a 01                	push   $0x1
+    58fa:	e8 71 0b 00 00       	call   6470 <printf>
+    close(fd);
+    58ff:	89 3c 24             	mov    %edi,(%esp)
+    5902:	e8 97 06 00 00       	call   5f9e <close>
+    if(total == 0)
+    5907:	83 c4 10             	add    $0x10,%esp
+    590a:	85 db                	test   %ebx,%ebx
+    590c:	74 1e                	je     592c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    590e:	83 c6 01             	add    $0x1,%esi
+    5911:	e9 1a ff ff ff       	jmp    5830 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    5916:	83 ec 04             	sub    $0x4,%esp
+    5919:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    591c:	50                   	push   %eax
+    591d:	68 46 82 00 00       	push   $0x8246
+    5922:	6a 01                	push   $0x1
+    5924:	e8 47 0b 00 00       	call   6470 <printf>
+      break;
+    5929:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    592c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5931:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    5936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    593d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    5940:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    5942:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    5945:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5949:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    594b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    594f:	c1 ea 06             	shr    $0x6,%edx
+    5952:	8d 42 30             	lea    0x30(%edx),%eax
+    5955:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5958:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    595e:	89 f2                	mov    %esi,%edx
+    5960:	29 c2                	sub    %eax,%edx
+    5962:	89 d0                	mov    %edx,%eax
+    5964:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    5966:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5968:	c1 ea 05             	shr    $0x5,%edx
+    596b:	83 c2 30             	add    $0x30,%edx
+    596e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    5971:	f7 e3                	mul    %ebx
+    5973:	c1 ea 05             	shr    $0x5,%edx
+    5976:	6b ca 64             	imul   $0x64,%edx,%ecx
+    5979:	89 f2                	mov    %esi,%edx
+    597b:	29 ca                	sub    %ecx,%edx
+    597d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    5982:	89 d0                	mov    %edx,%eax
+    5984:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    5986:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    5988:	c1 ea 03             	shr    $0x3,%edx
+    598b:	83 c2 30             	add    $0x30,%edx
+    598e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    5991:	f7 e1                	mul    %ecx
+    5993:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    5995:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    5998:	c1 ea 03             	shr    $0x3,%edx
+    599b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    599e:	01 d2                	add    %edx,%edx
+    59a0:	29 d0                	sub    %edx,%eax
+    59a2:	83 c0 30             	add    $0x30,%eax
+    59a5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    59a8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    59ab:	50                   	push   %eax
+    59ac:	e8 38 06 00 00       	call   5fe9 <unlink>
+  while(nfiles >= 0){
+    59b1:	83 c4 10             	add    $0x10,%esp
+    59b4:	83 fe ff             	cmp    $0xffffffff,%esi
+    59b7:	75 87                	jne    5940 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    59b9:	83 ec 08             	sub    $0x8,%esp
+    59bc:	68 66 82 00 00       	push   $0x8266
+    59c1:	6a 01                	push   $0x1
+    59c3:	e8 a8 0a 00 00       	call   6470 <printf>
+}
+    59c8:	83 c4 10             	add    $0x10,%esp
+    59cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    59ce:	5b                   	pop    %ebx
+    59cf:	5e                   	pop    %esi
+    59d0:	5f                   	pop    %edi
+    59d1:	5d                   	pop    %ebp
+    59d2:	c3                   	ret
+    59d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    59da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000059e0 <uio>:
+{
+    59e0:	55                   	push   %ebp
+    59e1:	89 e5                	mov    %esp,%ebp
+    59e3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    59e6:	68 7c 82 00 00       	push   $0x827c
+    59eb:	6a 01                	push   $0x1
+    59ed:	e8 7e 0a 00 00       	call   6470 <printf>
+  pid = fork();
+    59f2:	e8 d9 04 00 00       	call   5ed0 <fork>
+  if(pid == 0){
+    59f7:	83 c4 10             	add    $0x10,%esp
+    59fa:	85 c0                	test   %eax,%eax
+    59fc:	74 1b                	je     5a19 <uio+0x39>
+  } else if(pid < 0){
+    59fe:	78 3d                	js     5a3d <uio+0x5d>
+  wait();
+    5a00:	e8 5d 05 00 00       	call   5f62 <wait>
+  printf(1, "uio test done\n");
+    5a05:	83 ec 08             	sub    $0x8,%esp
+    5a08:	68 86 82 00 00       	push   $0x8286
+    5a0d:	6a 01                	push   $0x1
+    5a0f:	e8 5c 0a 00 00       	call   6470 <printf>
+}
+    5a14:	83 c4 10             	add    $0x10,%esp
+    5a17:	c9                   	leave
+    5a18:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    5a19:	b8 09 00 00 00       	mov    $0x9,%eax
+    5a1e:	ba 70 00 00 00       	mov    $0x70,%edx
+    5a23:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    5a24:	ba 71 00 00 00       	mov    $0x71,%edx
+    5a29:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    5a2a:	52                   	push   %edx
+    5a2b:	52                   	push   %edx
+    5a2c:	68 ac 8c 00 00       	push   $0x8cac
+    5a31:	6a 01                	push   $0x1
+    5a33:	e8 38 0a 00 00       	call   6470 <printf>
+    exit();
+    5a38:	e8 c3 04 00 00       	call   5f00 <exit>
+    printf (1, "fork failed\n");
+    5a3d:	50                   	push   %eax
+    5a3e:	50                   	push   %eax
+    5a3f:	68 0b 82 00 00       	push   $0x820b
+    5a44:	6a 01                	push   $0x1
+    5a46:	e8 25 0a 00 00       	call   6470 <printf>
+    exit();
+    5a4b:	e8 b0 04 00 00       	call   5f00 <exit>
+
+00005a50 <argptest>:
+{
+    5a50:	55                   	push   %ebp
+    5a51:	89 e5                	mov    %esp,%ebp
+    5a53:	53                   	push   %ebx
+    5a54:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    5a57:	6a 00                	push   $0x0
+    5a59:	68 95 82 00 00       	push   $0x8295
+    5a5e:	e8 68 05 00 00       	call   5fcb <open>
+  if (fd < 0) {
+    5a63:	83 c4 10             	add    $0x10,%esp
+    5a66:	85 c0                	test   %eax,%eax
+    5a68:	78 39                	js     5aa3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    5a6a:	83 ec 0c             	sub    $0xc,%esp
+    5a6d:	89 c3                	mov    %eax,%ebx
+    5a6f:	6a 00                	push   $0x0
+    5a71:	e8 dc 05 00 00       	call   6052 <sbrk>
+    5a76:	83 c4 0c             	add    $0xc,%esp
+    5a79:	83 e8 01             	sub    $0x1,%eax
+    5a7c:	6a ff                	push   $0xffffffff
+    5a7e:	50                   	push   %eax
+    5a7f:	53                   	push   %ebx
+    5a80:	e8 fb 04 00 00       	call   5f80 <read>
+  close(fd);
+    5a85:	89 1c 24             	mov    %ebx,(%esp)
+    5a88:	e8 11 05 00 00       	call   5f9e <close>
+  printf(1, "arg test passed\n");
+    5a8d:	58                   	pop    %eax
+    5a8e:	5a                   	pop    %edx
+    5a8f:	68 9a 82 00 00       	push   $0x829a
+    5a94:	6a 01                	push   $0x1
+    5a96:	e8 d5 09 00 00       	call   6470 <printf>
+}
+    5a9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5a9e:	83 c4 10             	add    $0x10,%esp
+    5aa1:	c9                   	leave
+    5aa2:	c3                   	ret
+    printf(2, "open failed\n");
+    5aa3:	51                   	push   %ecx
+    5aa4:	51                   	push   %ecx
+    5aa5:	68 b6 73 00 00       	push   $0x73b6
+    5aaa:	6a 02                	push   $0x2
+    5aac:	e8 bf 09 00 00       	call   6470 <printf>
+    exit();
+    5ab1:	e8 4a 04 00 00       	call   5f00 <exit>
+    5ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005ac0 <kstattest>:
+{
+    5ac0:	55                   	push   %ebp
+    5ac1:	89 e5                	mov    %esp,%ebp
+    5ac3:	53                   	push   %ebx
+    5ac4:	81 ec 1c 01 00 00    	sub    $0x11c,%esp
+  printf(1, "kstat test\n");
+    5aca:	68 ab 82 00 00       	push   $0x82ab
+    5acf:	6a 01                	push   $0x1
+    5ad1:	e8 9a 09 00 00       	call   6470 <printf>
+  if(kstat(&a) < 0){
+    5ad6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+    5adc:	89 04 24             	mov    %eax,(%esp)
+    5adf:	e8 b9 05 00 00       	call   609d <kstat>
+    5ae4:	83 c4 10             	add    $0x10,%esp
+    5ae7:	85 c0                	test   %eax,%eax
+    5ae9:	0f 88 cb 00 00 00    	js     5bba <kstattest+0xfa>
+  fd = open("kstatfile", O_CREATE|O_RDWR);
+    5aef:	83 ec 08             	sub    $0x8,%esp
+    5af2:	68 02 02 00 00       	push   $0x202
+    5af7:	68 c5 82 00 00       	push   $0x82c5
+    5afc:	e8 ca 04 00 00       	call   5fcb <open>
+  if(fd < 0){
+    5b01:	83 c4 10             	add    $0x10,%esp
+  fd = open("kstatfile", O_CREATE|O_RDWR);
+    5b04:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    5b06:	85 c0                	test   %eax,%eax
+    5b08:	0f 88 d2 00 00 00    	js     5be0 <kstattest+0x120>
+  memset(buf, 'k', 512);
+    5b0e:	83 ec 04             	sub    $0x4,%esp
+    5b11:	68 00 02 00 00       	push   $0x200
+    5b16:	6a 6b                	push   $0x6b
+    5b18:	68 c0 cc 00 00       	push   $0xccc0
+    5b1d:	e8 be 01 00 00       	call   5ce0 <memset>
+  if(write(fd, buf, 512) != 512){
+    5b22:	83 c4 0c             	add    $0xc,%esp
+    5b25:	68 00 02 00 00       	push   $0x200
+    5b2a:	68 c0 cc 00 00       	push   $0xccc0
+    5b2f:	53                   	push   %ebx
+    5b30:	e8 5a 04 00 00       	call   5f8f <write>
+    5b35:	83 c4 10             	add    $0x10,%esp
+    5b38:	3d 00 02 00 00       	cmp    $0x200,%eax
+    5b3d:	0f 85 8a 00 00 00    	jne    5bcd <kstattest+0x10d>
+  close(fd);
+    5b43:	83 ec 0c             	sub    $0xc,%esp
+    5b46:	53                   	push   %ebx
+    5b47:	e8 52 04 00 00       	call   5f9e <close>
+  unlink("kstatfile");
+    5b4c:	c7 04 24 c5 82 00 00 	movl   $0x82c5,(%esp)
+    5b53:	e8 91 04 00 00       	call   5fe9 <unlink>
+  if(kstat(&b) < 0){
+    5b58:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+    5b5e:	89 04 24             	mov    %eax,(%esp)
+    5b61:	e8 37 05 00 00       	call   609d <kstat>
+    5b66:	83 c4 10             	add    $0x10,%esp
+    5b69:	85 c0                	test   %eax,%eax
+    5b6b:	78 4d                	js     5bba <kstattest+0xfa>
+  if(b.disk_reqs <= a.disk_reqs || b.disk_cmds > b.disk_reqs ||
+    5b6d:	8b 95 74 ff ff ff    	mov    -0x8c(%ebp),%edx
+    5b73:	39 95 f0 fe ff ff    	cmp    %edx,-0x110(%ebp)
+    5b79:	73 2b                	jae    5ba6 <kstattest+0xe6>
+    5b7b:	8b 85 78 ff ff ff    	mov    -0x88(%ebp),%eax
+    5b81:	39 c2                	cmp    %eax,%edx
+    5b83:	72 21                	jb     5ba6 <kstattest+0xe6>
+     b.disk_cmds + b.disk_merged < b.disk_reqs){
+    5b85:	03 85 7c ff ff ff    	add    -0x84(%ebp),%eax
+  if(b.disk_reqs <= a.disk_reqs || b.disk_cmds > b.disk_reqs ||
+    5b8b:	39 d0                	cmp    %edx,%eax
+    5b8d:	72 17                	jb     5ba6 <kstattest+0xe6>
+  printf(1, "kstat test ok\n");
+    5b8f:	83 ec 08             	sub    $0x8,%esp
+    5b92:	68 18 83 00 00       	push   $0x8318
+    5b97:	6a 01                	push   $0x1
+    5b99:	e8 d2 08 00 00       	call   6470 <printf>
+}
+    5b9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5ba1:	83 c4 10             	add    $0x10,%esp
+    5ba4:	c9                   	leave
+    5ba5:	c3                   	ret
+    printf(1, "kstat: bad disk counters\n");
+    5ba6:	83 ec 08             	sub    $0x8,%esp
+    5ba9:	68 fe 82 00 00       	push   $0x82fe
+    5bae:	6a 01                	push   $0x1
+    5bb0:	e8 bb 08 00 00       	call   6470 <printf>
+    exit();
+    5bb5:	e8 46 03 00 00       	call   5f00 <exit>
+    printf(1, "kstat failed\n");
+    5bba:	51                   	push   %ecx
+    5bbb:	51                   	push   %ecx
+    5bbc:	68 b7 82 00 00       	push   $0x82b7
+    5bc1:	6a 01                	push   $0x1
+    5bc3:	e8 a8 08 00 00       	call   6470 <printf>
+    exit();
+    5bc8:	e8 33 03 00 00       	call   5f00 <exit>
+    printf(1, "write kstatfile failed\n");
+    5bcd:	50                   	push   %eax
+    5bce:	50                   	push   %eax
+    5bcf:	68 e6 82 00 00       	push   $0x82e6
+    5bd4:	6a 01                	push   $0x1
+    5bd6:	e8 95 08 00 00       	call   6470 <printf>
+    exit();
+    5bdb:	e8 20 03 00 00       	call   5f00 <exit>
+    printf(1, "open kstatfile failed\n");
+    5be0:	52                   	push   %edx
+    5be1:	52                   	push   %edx
+    5be2:	68 cf 82 00 00       	push   $0x82cf
+    5be7:	6a 01                	push   $0x1
+    5be9:	e8 82 08 00 00       	call   6470 <printf>
+    exit();
+    5bee:	e8 0d 03 00 00       	call   5f00 <exit>
+    5bf3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00005c00 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    5c00:	69 05 00 9c 00 00 0d 	imul   $0x19660d,0x9c00,%eax
+    5c07:	66 19 00 
+    5c0a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    5c0f:	a3 00 9c 00 00       	mov    %eax,0x9c00
+}
+    5c14:	c3                   	ret
+    5c15:	66 90                	xchg   %ax,%ax
+    5c17:	66 90                	xchg   %ax,%ax
+    5c19:	66 90                	xchg   %ax,%ax
+    5c1b:	66 90                	xchg   %ax,%ax
+    5c1d:	66 90                	xchg   %ax,%ax
+    5c1f:	90                   	nop
+
+00005c20 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    5c20:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    5c21:	31 c0                	xor    %eax,%eax
+{
+    5c23:	89 e5                	mov    %esp,%ebp
+    5c25:	53                   	push   %ebx
+    5c26:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    5c29:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    5c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    5c30:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    5c34:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    5c37:	83 c0 01             	add    $0x1,%eax
+    5c3a:	84 d2                	test   %dl,%dl
+    5c3c:	75 f2                	jne    5c30 <strcpy+0x10>
+    ;
+  return os;
+}
+    5c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5c41:	89 c8                	mov    %ecx,%eax
+    5c43:	c9                   	leave
+    5c44:	c3                   	ret
+    5c45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005c50 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    5c50:	55                   	push   %ebp
+    5c51:	89 e5                	mov    %esp,%ebp
+    5c53:	53                   	push   %ebx
+    5c54:	8b 55 08             	mov    0x8(%ebp),%edx
+    5c57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    5c5a:	0f b6 02             	movzbl (%edx),%eax
+    5c5d:	84 c0                	test   %al,%al
+    5c5f:	75 17                	jne    5c78 <strcmp+0x28>
+    5c61:	eb 3a                	jmp    5c9d <strcmp+0x4d>
+    5c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5c67:	90                   	nop
+    5c68:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    5c6c:	83 c2 01             	add    $0x1,%edx
+    5c6f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    5c72:	84 c0                	test   %al,%al
+    5c74:	74 1a                	je     5c90 <strcmp+0x40>
+    p++, q++;
+    5c76:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    5c78:	0f b6 19             	movzbl (%ecx),%ebx
+    5c7b:	38 c3                	cmp    %al,%bl
+    5c7d:	74 e9                	je     5c68 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    5c7f:	29 d8                	sub    %ebx,%eax
+}
+    5c81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5c84:	c9                   	leave
+    5c85:	c3                   	ret
+    5c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5c8d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    5c90:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    5c94:	31 c0                	xor    %eax,%eax
+    5c96:	29 d8                	sub    %ebx,%eax
+}
+    5c98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5c9b:	c9                   	leave
+    5c9c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    5c9d:	0f b6 19             	movzbl (%ecx),%ebx
+    5ca0:	31 c0                	xor    %eax,%eax
+    5ca2:	eb db                	jmp    5c7f <strcmp+0x2f>
+    5ca4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5caf:	90                   	nop
+
+00005cb0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    5cb0:	55                   	push   %ebp
+    5cb1:	89 e5                	mov    %esp,%ebp
+    5cb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    5cb6:	80 3a 00             	cmpb   $0x0,(%edx)
+    5cb9:	74 15                	je     5cd0 <strlen+0x20>
+    5cbb:	31 c0                	xor    %eax,%eax
+    5cbd:	8d 76 00             	lea    0x0(%esi),%esi
+    5cc0:	83 c0 01             	add    $0x1,%eax
+    5cc3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    5cc7:	89 c1                	mov    %eax,%ecx
+    5cc9:	75 f5                	jne    5cc0 <strlen+0x10>
+    ;
+  return n;
+}
+    5ccb:	89 c8                	mov    %ecx,%eax
+    5ccd:	5d                   	pop    %ebp
+    5cce:	c3                   	ret
+    5ccf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    5cd0:	31 c9                	xor    %ecx,%ecx
+}
+    5cd2:	5d                   	pop    %ebp
+    5cd3:	89 c8                	mov    %ecx,%eax
+    5cd5:	c3                   	ret
+    5cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005ce0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    5ce0:	55                   	push   %ebp
+    5ce1:	89 e5                	mov    %esp,%ebp
+    5ce3:	57                   	push   %edi
+    5ce4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    5ce7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    5cea:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5ced:	89 d7                	mov    %edx,%edi
+    5cef:	fc                   	cld
+    5cf0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    5cf2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    5cf5:	89 d0                	mov    %edx,%eax
+    5cf7:	c9                   	leave
+    5cf8:	c3                   	ret
+    5cf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005d00 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    5d00:	55                   	push   %ebp
+    5d01:	89 e5                	mov    %esp,%ebp
+    5d03:	8b 45 08             	mov    0x8(%ebp),%eax
+    5d06:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    5d0a:	0f b6 10             	movzbl (%eax),%edx
+    5d0d:	84 d2                	test   %dl,%dl
+    5d0f:	75 12                	jne    5d23 <strchr+0x23>
+    5d11:	eb 1d                	jmp    5d30 <strchr+0x30>
+    5d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5d17:	90                   	nop
+    5d18:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    5d1c:	83 c0 01             	add    $0x1,%eax
+    5d1f:	84 d2                	test   %dl,%dl
+    5d21:	74 0d                	je     5d30 <strchr+0x30>
+    if(*s == c)
+    5d23:	38 d1                	cmp    %dl,%cl
+    5d25:	75 f1                	jne    5d18 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    5d27:	5d                   	pop    %ebp
+    5d28:	c3                   	ret
+    5d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    5d30:	31 c0                	xor    %eax,%eax
+}
+    5d32:	5d                   	pop    %ebp
+    5d33:	c3                   	ret
+    5d34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5d3f:	90                   	nop
+
+00005d40 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    5d40:	55                   	push   %ebp
+    5d41:	89 e5                	mov    %esp,%ebp
+    5d43:	57                   	push   %edi
+    5d44:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    5d45:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    5d48:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    5d49:	31 db                	xor    %ebx,%ebx
+{
+    5d4b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    5d4e:	eb 27                	jmp    5d77 <gets+0x37>
+    cc = read(0, &c, 1);
+    5d50:	83 ec 04             	sub    $0x4,%esp
+    5d53:	6a 01                	push   $0x1
+    5d55:	56                   	push   %esi
+    5d56:	6a 00                	push   $0x0
+    5d58:	e8 23 02 00 00       	call   5f80 <read>
+    if(cc < 1)
+    5d5d:	83 c4 10             	add    $0x10,%esp
+    5d60:	85 c0                	test   %eax,%eax
+    5d62:	7e 1d                	jle    5d81 <gets+0x41>
+      break;
+    buf[i++] = c;
+    5d64:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    5d68:	8b 55 08             	mov    0x8(%ebp),%edx
+    5d6b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    5d6f:	3c 0a                	cmp    $0xa,%al
+    5d71:	74 10                	je     5d83 <gets+0x43>
+    5d73:	3c 0d                	cmp    $0xd,%al
+    5d75:	74 0c                	je     5d83 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    5d77:	89 df                	mov    %ebx,%edi
+    5d79:	83 c3 01             	add    $0x1,%ebx
+    5d7c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    5d7f:	7c cf                	jl     5d50 <gets+0x10>
+    5d81:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    5d83:	8b 45 08             	mov    0x8(%ebp),%eax
+    5d86:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    5d8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5d8d:	5b                   	pop    %ebx
+    5d8e:	5e                   	pop    %esi
+    5d8f:	5f                   	pop    %edi
+    5d90:	5d                   	pop    %ebp
+    5d91:	c3                   	ret
+    5d92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5d99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005da0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    5da0:	55                   	push   %ebp
+    5da1:	89 e5                	mov    %esp,%ebp
+    5da3:	56                   	push   %esi
+    5da4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    5da5:	83 ec 08             	sub    $0x8,%esp
+    5da8:	6a 00                	push   $0x0
+    5daa:	ff 75 08             	push   0x8(%ebp)
+    5dad:	e8 19 02 00 00       	call   5fcb <open>
+  if(fd < 0)
+    5db2:	83 c4 10             	add    $0x10,%esp
+    5db5:	85 c0                	test   %eax,%eax
+    5db7:	78 27                	js     5de0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    5db9:	83 ec 08             	sub    $0x8,%esp
+    5dbc:	ff 75 0c             	push   0xc(%ebp)
+    5dbf:	89 c3                	mov    %eax,%ebx
+    5dc1:	50                   	push   %eax
+    5dc2:	e8 31 02 00 00       	call   5ff8 <fstat>
+  close(fd);
+    5dc7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    5dca:	89 c6                	mov    %eax,%esi
+  close(fd);
+    5dcc:	e8 cd 01 00 00       	call   5f9e <close>
+  return r;
+    5dd1:	83 c4 10             	add    $0x10,%esp
+}
+    5dd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5dd7:	89 f0                	mov    %esi,%eax
+    5dd9:	5b                   	pop    %ebx
+    5dda:	5e                   	pop    %esi
+    5ddb:	5d                   	pop    %ebp
+    5ddc:	c3                   	ret
+    5ddd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    5de0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    5de5:	eb ed                	jmp    5dd4 <stat+0x34>
+    5de7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5dee:	66 90                	xchg   %ax,%ax
+
+00005df0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    5df0:	55                   	push   %ebp
+    5df1:	89 e5                	mov    %esp,%ebp
+    5df3:	53                   	push   %ebx
+    5df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    5df7:	0f be 02             	movsbl (%edx),%eax
+    5dfa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    5dfd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    5e00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    5e05:	77 1e                	ja     5e25 <atoi+0x35>
+    5e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5e0e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    5e10:	83 c2 01             	add    $0x1,%edx
+    5e13:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    5e16:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    5e1a:	0f be 02             	movsbl (%edx),%eax
+    5e1d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    5e20:	80 fb 09             	cmp    $0x9,%bl
+    5e23:	76 eb                	jbe    5e10 <atoi+0x20>
+  return n;
+}
+    5e25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5e28:	89 c8                	mov    %ecx,%eax
+    5e2a:	c9                   	leave
+    5e2b:	c3                   	ret
+    5e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005e30 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    5e30:	55                   	push   %ebp
+    5e31:	89 e5                	mov    %esp,%ebp
+    5e33:	57                   	push   %edi
+    5e34:	56                   	push   %esi
+    5e35:	8b 45 10             	mov    0x10(%ebp),%eax
+    5e38:	8b 55 08             	mov    0x8(%ebp),%edx
+    5e3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    5e3e:	85 c0                	test   %eax,%eax
+    5e40:	7e 13                	jle    5e55 <memmove+0x25>
+    5e42:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    5e44:	89 d7                	mov    %edx,%edi
+    5e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    5e50:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    5e51:	39 f8                	cmp    %edi,%eax
+    5e53:	75 fb                	jne    5e50 <memmove+0x20>
+  return vdst;
+}
+    5e55:	5e                   	pop    %esi
+    5e56:	89 d0                	mov    %edx,%eax
+    5e58:	5f                   	pop    %edi
+    5e59:	5d                   	pop    %ebp
+    5e5a:	c3                   	ret
+    5e5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5e5f:	90                   	nop
+
+00005e60 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    5e60:	55                   	push   %ebp
+    5e61:	89 e5                	mov    %esp,%ebp
+    5e63:	56                   	push   %esi
+    5e64:	53                   	push   %ebx
+    5e65:	8b 75 10             	mov    0x10(%ebp),%esi
+    5e68:	8b 55 08             	mov    0x8(%ebp),%edx
+    5e6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    5e6e:	85 f6                	test   %esi,%esi
+    5e70:	74 2e                	je     5ea0 <memcmp+0x40>
+    5e72:	01 c6                	add    %eax,%esi
+    5e74:	eb 14                	jmp    5e8a <memcmp+0x2a>
+    5e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5e7d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    5e80:	83 c0 01             	add    $0x1,%eax
+    5e83:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    5e86:	39 f0                	cmp    %esi,%eax
+    5e88:	74 16                	je     5ea0 <memcmp+0x40>
+    if(*s1 != *s2)
+    5e8a:	0f b6 0a             	movzbl (%edx),%ecx
+    5e8d:	0f b6 18             	movzbl (%eax),%ebx
+    5e90:	38 d9                	cmp    %bl,%cl
+    5e92:	74 ec                	je     5e80 <memcmp+0x20>
+      return *s1 - *s2;
+    5e94:	0f b6 c1             	movzbl %cl,%eax
+    5e97:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    5e99:	5b                   	pop    %ebx
+    5e9a:	5e                   	pop    %esi
+    5e9b:	5d                   	pop    %ebp
+    5e9c:	c3                   	ret
+    5e9d:	8d 76 00             	lea    0x0(%esi),%esi
+    5ea0:	5b                   	pop    %ebx
+  return 0;
+    5ea1:	31 c0                	xor    %eax,%eax
+}
+    5ea3:	5e                   	pop    %esi
+    5ea4:	5d                   	pop    %ebp
+    5ea5:	c3                   	ret
+    5ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5ead:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005eb0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    5eb0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    5eb5:	c3                   	ret
+    5eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5ebd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005ec0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    5ec0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    5ec5:	c3                   	ret
+    5ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005ed0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    5ed0:	a1 40 ed 00 00       	mov    0xed40,%eax
+    5ed5:	85 c0                	test   %eax,%eax
+    5ed7:	74 17                	je     5ef0 <fork+0x20>
+{
+    5ed9:	55                   	push   %ebp
+    5eda:	89 e5                	mov    %esp,%ebp
+    5edc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    5edf:	ff d0                	call   *%eax
+  return _fork();
+}
+    5ee1:	c9                   	leave
+  return _fork();
+    5ee2:	e9 5d 00 00 00       	jmp    5f44 <_fork>
+    5ee7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5eee:	66 90                	xchg   %ax,%ax
+    5ef0:	e9 4f 00 00 00       	jmp    5f44 <_fork>
+    5ef5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005f00 <exit>:
+
+int
+exit(void)
+{
+    5f00:	55                   	push   %ebp
+    5f01:	89 e5                	mov    %esp,%ebp
+    5f03:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    5f06:	a1 40 ed 00 00       	mov    0xed40,%eax
+    5f0b:	85 c0                	test   %eax,%eax
+    5f0d:	74 02                	je     5f11 <exit+0x11>
+    flushhook();
+    5f0f:	ff d0                	call   *%eax
+  _exit();
+    5f11:	e8 3d 00 00 00       	call   5f53 <_exit>
+    5f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5f1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005f20 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    5f20:	55                   	push   %ebp
+  if(flushhook)
+    5f21:	a1 40 ed 00 00       	mov    0xed40,%eax
+{
+    5f26:	89 e5                	mov    %esp,%ebp
+    5f28:	56                   	push   %esi
+    5f29:	53                   	push   %ebx
+    5f2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    5f2d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    5f30:	85 c0                	test   %eax,%eax
+    5f32:	74 02                	je     5f36 <exec+0x16>
+    flushhook();
+    5f34:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    5f36:	89 75 0c             	mov    %esi,0xc(%ebp)
+    5f39:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    5f3c:	5b                   	pop    %ebx
+    5f3d:	5e                   	pop    %esi
+    5f3e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    5f3f:	e9 78 00 00 00       	jmp    5fbc <_exec>
+
+00005f44 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    5f44:	b8 01 00 00 00       	mov    $0x1,%eax
+    5f49:	89 e1                	mov    %esp,%ecx
+    5f4b:	ba 52 5f 00 00       	mov    $0x5f52,%edx
+    5f50:	0f 34                	sysenter
+    5f52:	c3                   	ret
+
+00005f53 <_exit>:
+RAWSYSCALL(exit)
+    5f53:	b8 02 00 00 00       	mov    $0x2,%eax
+    5f58:	89 e1                	mov    %esp,%ecx
+    5f5a:	ba 61 5f 00 00       	mov    $0x5f61,%edx
+    5f5f:	0f 34                	sysenter
+    5f61:	c3                   	ret
+
+00005f62 <wait>:
+SYSCALL(wait)
+    5f62:	b8 03 00 00 00       	mov    $0x3,%eax
+    5f67:	89 e1                	mov    %esp,%ecx
+    5f69:	ba 70 5f 00 00       	mov    $0x5f70,%edx
+    5f6e:	0f 34                	sysenter
+    5f70:	c3                   	ret
+
+00005f71 <pipe>:
+SYSCALL(pipe)
+    5f71:	b8 04 00 00 00       	mov    $0x4,%eax
+    5f76:	89 e1                	mov    %esp,%ecx
+    5f78:	ba 7f 5f 00 00       	mov    $0x5f7f,%edx
+    5f7d:	0f 34                	sysenter
+    5f7f:	c3                   	ret
+
+00005f80 <read>:
+SYSCALL(read)
+    5f80:	b8 05 00 00 00       	mov    $0x5,%eax
+    5f85:	89 e1                	mov    %esp,%ecx
+    5f87:	ba 8e 5f 00 00       	mov    $0x5f8e,%edx
+    5f8c:	0f 34                	sysenter
+    5f8e:	c3                   	ret
+
+00005f8f <write>:
+SYSCALL(write)
+    5f8f:	b8 10 00 00 00       	mov    $0x10,%eax
+    5f94:	89 e1                	mov    %esp,%ecx
+    5f96:	ba 9d 5f 00 00       	mov    $0x5f9d,%edx
+    5f9b:	0f 34                	sysenter
+    5f9d:	c3                   	ret
+
+00005f9e <close>:
+SYSCALL(close)
+    5f9e:	b8 15 00 00 00       	mov    $0x15,%eax
+    5fa3:	89 e1                	mov    %esp,%ecx
+    5fa5:	ba ac 5f 00 00       	mov    $0x5fac,%edx
+    5faa:	0f 34                	sysenter
+    5fac:	c3                   	ret
+
+00005fad <kill>:
+SYSCALL(kill)
+    5fad:	b8 06 00 00 00       	mov    $0x6,%eax
+    5fb2:	89 e1                	mov    %esp,%ecx
+    5fb4:	ba bb 5f 00 00       	mov    $0x5fbb,%edx
+    5fb9:	0f 34                	sysenter
+    5fbb:	c3                   	ret
+
+00005fbc <_exec>:
+RAWSYSCALL(exec)
+    5fbc:	b8 07 00 00 00       	mov    $0x7,%eax
+    5fc1:	89 e1                	mov    %esp,%ecx
+    5fc3:	ba ca 5f 00 00       	mov    $0x5fca,%edx
+    5fc8:	0f 34                	sysenter
+    5fca:	c3                   	ret
+
+00005fcb <open>:
+SYSCALL(open)
+    5fcb:	b8 0f 00 00 00       	mov    $0xf,%eax
+    5fd0:	89 e1                	mov    %esp,%ecx
+    5fd2:	ba d9 5f 00 00       	mov    $0x5fd9,%edx
+    5fd7:	0f 34                	sysenter
+    5fd9:	c3                   	ret
+
+00005fda <mknod>:
+SYSCALL(mknod)
+    5fda:	b8 11 00 00 00       	mov    $0x11,%eax
+    5fdf:	89 e1                	mov    %esp,%ecx
+    5fe1:	ba e8 5f 00 00       	mov    $0x5fe8,%edx
+    5fe6:	0f 34                	sysenter
+    5fe8:	c3                   	ret
+
+00005fe9 <unlink>:
+SYSCALL(unlink)
+    5fe9:	b8 12 00 00 00       	mov    $0x12,%eax
+    5fee:	89 e1                	mov    %esp,%ecx
+    5ff0:	ba f7 5f 00 00       	mov    $0x5ff7,%edx
+    5ff5:	0f 34                	sysenter
+    5ff7:	c3                   	ret
+
+00005ff8 <fstat>:
+SYSCALL(fstat)
+    5ff8:	b8 08 00 00 00       	mov    $0x8,%eax
+    5ffd:	89 e1                	mov    %esp,%ecx
+    5fff:	ba 06 60 00 00       	mov    $0x6006,%edx
+    6004:	0f 34                	sysenter
+    6006:	c3                   	ret
+
+00006007 <link>:
+SYSCALL(link)
+    6007:	b8 13 00 00 00       	mov    $0x13,%eax
+    600c:	89 e1                	mov    %esp,%ecx
+    600e:	ba 15 60 00 00       	mov    $0x6015,%edx
+    6013:	0f 34                	sysenter
+    6015:	c3                   	ret
+
+00006016 <mkdir>:
+SYSCALL(mkdir)
+    6016:	b8 14 00 00 00       	mov    $0x14,%eax
+    601b:	89 e1                	mov    %esp,%ecx
+    601d:	ba 24 60 00 00       	mov    $0x6024,%edx
+    6022:	0f 34                	sysenter
+    6024:	c3                   	ret
+
+00006025 <chdir>:
+SYSCALL(chdir)
+    6025:	b8 09 00 00 00       	mov    $0x9,%eax
+    602a:	89 e1                	mov    %esp,%ecx
+    602c:	ba 33 60 00 00       	mov    $0x6033,%edx
+    6031:	0f 34                	sysenter
+    6033:	c3                   	ret
+
+00006034 <dup>:
+SYSCALL(dup)
+    6034:	b8 0a 00 00 00       	mov    $0xa,%eax
+    6039:	89 e1                	mov    %esp,%ecx
+    603b:	ba 42 60 00 00       	mov    $0x6042,%edx
+    6040:	0f 34                	sysenter
+    6042:	c3                   	ret
+
+00006043 <getpid>:
+SYSCALL(getpid)
+    6043:	b8 0b 00 00 00       	mov    $0xb,%eax
+    6048:	89 e1                	mov    %esp,%ecx
+    604a:	ba 51 60 00 00       	mov    $0x6051,%edx
+    604f:	0f 34                	sysenter
+    6051:	c3                   	ret
+
+00006052 <sbrk>:
+SYSCALL(sbrk)
+    6052:	b8 0c 00 00 00       	mov    $0xc,%eax
+    6057:	89 e1                	mov    %esp,%ecx
+    6059:	ba 60 60 00 00       	mov    $0x6060,%edx
+    605e:	0f 34                	sysenter
+    6060:	c3                   	ret
+
+00006061 <sleep>:
+SYSCALL(sleep)
+    6061:	b8 0d 00 00 00       	mov    $0xd,%eax
+    6066:	89 e1                	mov    %esp,%ecx
+    6068:	ba 6f 60 00 00       	mov    $0x606f,%edx
+    606d:	0f 34                	sysenter
+    606f:	c3                   	ret
+
+00006070 <uptime>:
+SYSCALL(uptime)
+    6070:	b8 0e 00 00 00       	mov    $0xe,%eax
+    6075:	89 e1                	mov    %esp,%ecx
+    6077:	ba 7e 60 00 00       	mov    $0x607e,%edx
+    607c:	0f 34                	sysenter
+    607e:	c3                   	ret
+
+0000607f <mprotect>:
+SYSCALL(mprotect)
+    607f:	b8 16 00 00 00       	mov    $0x16,%eax
+    6084:	89 e1                	mov    %esp,%ecx
+    6086:	ba 8d 60 00 00       	mov    $0x608d,%edx
+    608b:	0f 34                	sysenter
+    608d:	c3                   	ret
+
+0000608e <munprotect>:
+SYSCALL(munprotect)
+    608e:	b8 17 00 00 00       	mov    $0x17,%eax
+    6093:	89 e1                	mov    %esp,%ecx
+    6095:	ba 9c 60 00 00       	mov    $0x609c,%edx
+    609a:	0f 34                	sysenter
+    609c:	c3                   	ret
+
+0000609d <kstat>:
+SYSCALL(kstat)
+    609d:	b8 18 00 00 00       	mov    $0x18,%eax
+    60a2:	89 e1                	mov    %esp,%ecx
+    60a4:	ba ab 60 00 00       	mov    $0x60ab,%edx
+    60a9:	0f 34                	sysenter
+    60ab:	c3                   	ret
+
+000060ac <fcntl>:
+SYSCALL(fcntl)
+    60ac:	b8 19 00 00 00       	mov    $0x19,%eax
+    60b1:	89 e1                	mov    %esp,%ecx
+    60b3:	ba ba 60 00 00       	mov    $0x60ba,%edx
+    60b8:	0f 34                	sysenter
+    60ba:	c3                   	ret
+
+000060bb <splice>:
+SYSCALL(splice)
+    60bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    60c0:	89 e1                	mov    %esp,%ecx
+    60c2:	ba c9 60 00 00       	mov    $0x60c9,%edx
+    60c7:	0f 34                	sysenter
+    60c9:	c3                   	ret
+
+000060ca <sendfile>:
+SYSCALL(sendfile)
+    60ca:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    60cf:	89 e1                	mov    %esp,%ecx
+    60d1:	ba d8 60 00 00       	mov    $0x60d8,%edx
+    60d6:	0f 34                	sysenter
+    60d8:	c3                   	ret
+
+000060d9 <lseek>:
+SYSCALL(lseek)
+    60d9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    60de:	89 e1                	mov    %esp,%ecx
+    60e0:	ba e7 60 00 00       	mov    $0x60e7,%edx
+    60e5:	0f 34                	sysenter
+    60e7:	c3                   	ret
+
+000060e8 <pread>:
+SYSCALL(pread)
+    60e8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    60ed:	89 e1                	mov    %esp,%ecx
+    60ef:	ba f6 60 00 00       	mov    $0x60f6,%edx
+    60f4:	0f 34                	sysenter
+    60f6:	c3                   	ret
+
+000060f7 <pwrite>:
+SYSCALL(pwrite)
+    60f7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    60fc:	89 e1                	mov    %esp,%ecx
+    60fe:	ba 05 61 00 00       	mov    $0x6105,%edx
+    6103:	0f 34                	sysenter
+    6105:	c3                   	ret
+
+00006106 <readv>:
+SYSCALL(readv)
+    6106:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    610b:	89 e1                	mov    %esp,%ecx
+    610d:	ba 14 61 00 00       	mov    $0x6114,%edx
+    6112:	0f 34                	sysenter
+    6114:	c3                   	ret
+
+00006115 <writev>:
+SYSCALL(writev)
+    6115:	b8 20 00 00 00       	mov    $0x20,%eax
+    611a:	89 e1                	mov    %esp,%ecx
+    611c:	ba 23 61 00 00       	mov    $0x6123,%edx
+    6121:	0f 34                	sysenter
+    6123:	c3                   	ret
+
+00006124 <ringsetup>:
+SYSCALL(ringsetup)
+    6124:	b8 21 00 00 00       	mov    $0x21,%eax
+    6129:	89 e1                	mov    %esp,%ecx
+    612b:	ba 32 61 00 00       	mov    $0x6132,%edx
+    6130:	0f 34                	sysenter
+    6132:	c3                   	ret
+
+00006133 <ringenter>:
+SYSCALL(ringenter)
+    6133:	b8 22 00 00 00       	mov    $0x22,%eax
+    6138:	89 e1                	mov    %esp,%ecx
+    613a:	ba 41 61 00 00       	mov    $0x6141,%edx
+    613f:	0f 34                	sysenter
+    6141:	c3                   	ret
+
+00006142 <intgetpid>:
+INTSYSCALL(getpid)
+    6142:	b8 0b 00 00 00       	mov    $0xb,%eax
+    6147:	cd 40                	int    $0x40
+    6149:	c3                   	ret
+    614a:	66 90                	xchg   %ax,%ax
+    614c:	66 90                	xchg   %ax,%ax
+    614e:	66 90                	xchg   %ax,%ax
+
+00006150 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    6150:	55                   	push   %ebp
+    6151:	89 e5                	mov    %esp,%ebp
+    6153:	57                   	push   %edi
+    6154:	56                   	push   %esi
+    6155:	53                   	push   %ebx
+    6156:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    6158:	89 d1                	mov    %edx,%ecx
+{
+    615a:	83 ec 2c             	sub    $0x2c,%esp
+    615d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    6160:	85 d2                	test   %edx,%edx
+    6162:	0f 89 c0 00 00 00    	jns    6228 <printint+0xd8>
+    6168:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    616c:	0f 84 b6 00 00 00    	je     6228 <printint+0xd8>
+    x = -xx;
+    6172:	f7 d9                	neg    %ecx
+    neg = 1;
+    6174:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    6179:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    617c:	31 f6                	xor    %esi,%esi
+    617e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    6180:	89 c8                	mov    %ecx,%eax
+    6182:	31 d2                	xor    %edx,%edx
+    6184:	89 f7                	mov    %esi,%edi
+    6186:	f7 f3                	div    %ebx
+    6188:	8d 76 01             	lea    0x1(%esi),%esi
+    618b:	0f b6 92 5c 8d 00 00 	movzbl 0x8d5c(%edx),%edx
+    6192:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    6196:	89 ca                	mov    %ecx,%edx
+    6198:	89 c1                	mov    %eax,%ecx
+    619a:	39 da                	cmp    %ebx,%edx
+    619c:	73 e2                	jae    6180 <printint+0x30>
+  if(neg)
+    619e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    61a1:	85 c0                	test   %eax,%eax
+    61a3:	74 07                	je     61ac <printint+0x5c>
+    buf[i++] = '-';
+    61a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    61aa:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    61ac:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    61af:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    61b2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    61b4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    61b7:	8b 41 08             	mov    0x8(%ecx),%eax
+    61ba:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    61bd:	89 ce                	mov    %ecx,%esi
+    61bf:	eb 1c                	jmp    61dd <printint+0x8d>
+    61c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    61c8:	89 c1                	mov    %eax,%ecx
+    61ca:	83 c0 01             	add    $0x1,%eax
+    61cd:	89 46 08             	mov    %eax,0x8(%esi)
+    61d0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    61d4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    61d7:	39 df                	cmp    %ebx,%edi
+    61d9:	74 41                	je     621c <printint+0xcc>
+    61db:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    61dd:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    61e0:	3d 80 00 00 00       	cmp    $0x80,%eax
+    61e5:	75 e1                	jne    61c8 <printint+0x78>
+  if(o->f)
+    61e7:	8b 06                	mov    (%esi),%eax
+    61e9:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    61ec:	85 c0                	test   %eax,%eax
+    61ee:	74 40                	je     6230 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    61f0:	50                   	push   %eax
+    61f1:	68 80 00 00 00       	push   $0x80
+    61f6:	6a 01                	push   $0x1
+    61f8:	ff 75 d4             	push   -0x2c(%ebp)
+    61fb:	e8 a0 04 00 00       	call   66a0 <fwrite>
+    6200:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    6204:	83 c4 10             	add    $0x10,%esp
+}
+    6207:	b8 01 00 00 00       	mov    $0x1,%eax
+    620c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    620e:	89 46 08             	mov    %eax,0x8(%esi)
+    6211:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    6215:	8d 57 ff             	lea    -0x1(%edi),%edx
+    6218:	39 df                	cmp    %ebx,%edi
+    621a:	75 bf                	jne    61db <printint+0x8b>
+}
+    621c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    621f:	5b                   	pop    %ebx
+    6220:	5e                   	pop    %esi
+    6221:	5f                   	pop    %edi
+    6222:	5d                   	pop    %ebp
+    6223:	c3                   	ret
+    6224:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    6228:	31 c0                	xor    %eax,%eax
+    622a:	e9 4a ff ff ff       	jmp    6179 <printint+0x29>
+    622f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    6230:	83 ec 04             	sub    $0x4,%esp
+    6233:	68 80 00 00 00       	push   $0x80
+    6238:	ff 75 d4             	push   -0x2c(%ebp)
+    623b:	ff 76 04             	push   0x4(%esi)
+    623e:	e8 4c fd ff ff       	call   5f8f <write>
+    6243:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    6247:	83 c4 10             	add    $0x10,%esp
+    624a:	eb bb                	jmp    6207 <printint+0xb7>
+    624c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00006250 <putc>:
+{
+    6250:	55                   	push   %ebp
+    6251:	89 e5                	mov    %esp,%ebp
+    6253:	56                   	push   %esi
+    6254:	89 d6                	mov    %edx,%esi
+    6256:	53                   	push   %ebx
+    6257:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    6259:	8b 40 08             	mov    0x8(%eax),%eax
+    625c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    6261:	74 1d                	je     6280 <putc+0x30>
+  o->buf[o->n++] = c;
+    6263:	89 f1                	mov    %esi,%ecx
+    6265:	8d 50 01             	lea    0x1(%eax),%edx
+    6268:	89 53 08             	mov    %edx,0x8(%ebx)
+    626b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    626f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    6272:	5b                   	pop    %ebx
+    6273:	5e                   	pop    %esi
+    6274:	5d                   	pop    %ebp
+    6275:	c3                   	ret
+    6276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    627d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    6280:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    6282:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    6285:	85 c0                	test   %eax,%eax
+    6287:	74 2f                	je     62b8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    6289:	50                   	push   %eax
+    628a:	68 80 00 00 00       	push   $0x80
+    628f:	6a 01                	push   $0x1
+    6291:	52                   	push   %edx
+    6292:	e8 09 04 00 00       	call   66a0 <fwrite>
+    6297:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    629a:	89 f1                	mov    %esi,%ecx
+}
+    629c:	ba 01 00 00 00       	mov    $0x1,%edx
+    62a1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    62a3:	89 53 08             	mov    %edx,0x8(%ebx)
+    62a6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    62aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    62ad:	5b                   	pop    %ebx
+    62ae:	5e                   	pop    %esi
+    62af:	5d                   	pop    %ebp
+    62b0:	c3                   	ret
+    62b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    62b8:	83 ec 04             	sub    $0x4,%esp
+    62bb:	68 80 00 00 00       	push   $0x80
+    62c0:	52                   	push   %edx
+    62c1:	ff 73 04             	push   0x4(%ebx)
+    62c4:	e8 c6 fc ff ff       	call   5f8f <write>
+    62c9:	83 c4 10             	add    $0x10,%esp
+    62cc:	eb cc                	jmp    629a <putc+0x4a>
+    62ce:	66 90                	xchg   %ax,%ax
+
+000062d0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    62d0:	55                   	push   %ebp
+    62d1:	89 e5                	mov    %esp,%ebp
+    62d3:	57                   	push   %edi
+    62d4:	89 c7                	mov    %eax,%edi
+    62d6:	56                   	push   %esi
+    62d7:	31 f6                	xor    %esi,%esi
+    62d9:	53                   	push   %ebx
+    62da:	8d 5a 01             	lea    0x1(%edx),%ebx
+    62dd:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    62e0:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    62e3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    62e6:	84 c0                	test   %al,%al
+    62e8:	75 1e                	jne    6308 <vprintf.constprop.0+0x38>
+    62ea:	eb 53                	jmp    633f <vprintf.constprop.0+0x6f>
+    62ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    62f0:	83 f8 25             	cmp    $0x25,%eax
+    62f3:	74 3b                	je     6330 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    62f5:	89 ca                	mov    %ecx,%edx
+    62f7:	89 f8                	mov    %edi,%eax
+    62f9:	e8 52 ff ff ff       	call   6250 <putc>
+  for(i = 0; fmt[i]; i++){
+    62fe:	0f b6 03             	movzbl (%ebx),%eax
+    6301:	83 c3 01             	add    $0x1,%ebx
+    6304:	84 c0                	test   %al,%al
+    6306:	74 37                	je     633f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    6308:	0f be c8             	movsbl %al,%ecx
+    630b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    630e:	85 f6                	test   %esi,%esi
+    6310:	74 de                	je     62f0 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    6312:	83 fe 25             	cmp    $0x25,%esi
+    6315:	75 e7                	jne    62fe <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    6317:	83 f8 25             	cmp    $0x25,%eax
+    631a:	74 4e                	je     636a <vprintf.constprop.0+0x9a>
+    631c:	83 e8 63             	sub    $0x63,%eax
+    631f:	83 f8 15             	cmp    $0x15,%eax
+    6322:	77 34                	ja     6358 <vprintf.constprop.0+0x88>
+    6324:	ff 24 85 04 8d 00 00 	jmp    *0x8d04(,%eax,4)
+    632b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    632f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    6330:	0f b6 03             	movzbl (%ebx),%eax
+    6333:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    6336:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    633b:	84 c0                	test   %al,%al
+    633d:	75 c9                	jne    6308 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    633f:	8b 47 08             	mov    0x8(%edi),%eax
+    6342:	85 c0                	test   %eax,%eax
+    6344:	0f 8f de 00 00 00    	jg     6428 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    634a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    634d:	5b                   	pop    %ebx
+    634e:	5e                   	pop    %esi
+    634f:	5f                   	pop    %edi
+    6350:	5d                   	pop    %ebp
+    6351:	c3                   	ret
+    6352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    6358:	ba 25 00 00 00       	mov    $0x25,%edx
+    635d:	89 f8                	mov    %edi,%eax
+    635f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    6362:	e8 e9 fe ff ff       	call   6250 <putc>
+        putc(o, c);
+    6367:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    636a:	89 ca                	mov    %ecx,%edx
+    636c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    636e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    6370:	e8 db fe ff ff       	call   6250 <putc>
+    6375:	eb 87                	jmp    62fe <vprintf.constprop.0+0x2e>
+    6377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    637e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    6380:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    6383:	83 ec 0c             	sub    $0xc,%esp
+    6386:	b9 10 00 00 00       	mov    $0x10,%ecx
+    638b:	8b 16                	mov    (%esi),%edx
+    638d:	6a 00                	push   $0x0
+        ap++;
+    638f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    6392:	89 f8                	mov    %edi,%eax
+    6394:	e8 b7 fd ff ff       	call   6150 <printint>
+        ap++;
+    6399:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    639c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    639f:	31 f6                	xor    %esi,%esi
+    63a1:	e9 58 ff ff ff       	jmp    62fe <vprintf.constprop.0+0x2e>
+    63a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    63ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    63b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    63b3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    63b5:	83 c0 04             	add    $0x4,%eax
+    63b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    63bb:	85 f6                	test   %esi,%esi
+    63bd:	75 1b                	jne    63da <vprintf.constprop.0+0x10a>
+    63bf:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    63c4:	be fa 8c 00 00       	mov    $0x8cfa,%esi
+    63c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    63d0:	89 f8                	mov    %edi,%eax
+          s++;
+    63d2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    63d5:	e8 76 fe ff ff       	call   6250 <putc>
+        while(*s != 0){
+    63da:	0f be 16             	movsbl (%esi),%edx
+    63dd:	84 d2                	test   %dl,%dl
+    63df:	75 ef                	jne    63d0 <vprintf.constprop.0+0x100>
+      state = 0;
+    63e1:	31 f6                	xor    %esi,%esi
+    63e3:	e9 16 ff ff ff       	jmp    62fe <vprintf.constprop.0+0x2e>
+    63e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    63ef:	90                   	nop
+        printint(o, *ap, 10, 1);
+    63f0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    63f3:	83 ec 0c             	sub    $0xc,%esp
+    63f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    63fb:	8b 16                	mov    (%esi),%edx
+    63fd:	6a 01                	push   $0x1
+    63ff:	eb 8e                	jmp    638f <vprintf.constprop.0+0xbf>
+    6401:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    6408:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    640b:	89 f8                	mov    %edi,%eax
+    640d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    6410:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    6413:	e8 38 fe ff ff       	call   6250 <putc>
+        ap++;
+    6418:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    641b:	31 f6                	xor    %esi,%esi
+    641d:	e9 dc fe ff ff       	jmp    62fe <vprintf.constprop.0+0x2e>
+    6422:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    6428:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    642a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    642d:	85 d2                	test   %edx,%edx
+    642f:	74 1f                	je     6450 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    6431:	52                   	push   %edx
+    6432:	50                   	push   %eax
+    6433:	6a 01                	push   $0x1
+    6435:	51                   	push   %ecx
+    6436:	e8 65 02 00 00       	call   66a0 <fwrite>
+    643b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    643e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    6445:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    6448:	5b                   	pop    %ebx
+    6449:	5e                   	pop    %esi
+    644a:	5f                   	pop    %edi
+    644b:	5d                   	pop    %ebp
+    644c:	c3                   	ret
+    644d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    6450:	83 ec 04             	sub    $0x4,%esp
+    6453:	50                   	push   %eax
+    6454:	51                   	push   %ecx
+    6455:	ff 77 04             	push   0x4(%edi)
+    6458:	e8 32 fb ff ff       	call   5f8f <write>
+    645d:	83 c4 10             	add    $0x10,%esp
+    6460:	eb dc                	jmp    643e <vprintf.constprop.0+0x16e>
+    6462:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00006470 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    6470:	55                   	push   %ebp
+    6471:	89 e5                	mov    %esp,%ebp
+    6473:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    6479:	a1 24 9c 00 00       	mov    0x9c24,%eax
+{
+    647e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    6481:	83 fa 01             	cmp    $0x1,%edx
+    6484:	74 0c                	je     6492 <printf+0x22>
+    6486:	31 c0                	xor    %eax,%eax
+    6488:	83 fa 02             	cmp    $0x2,%edx
+    648b:	0f 44 05 20 9c 00 00 	cmove  0x9c20,%eax
+  o.fd = fd;
+    6492:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    6498:	8b 55 0c             	mov    0xc(%ebp),%edx
+    649b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    649e:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    64a4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    64aa:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    64b1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    64b4:	e8 17 fe ff ff       	call   62d0 <vprintf.constprop.0>
+}
+    64b9:	c9                   	leave
+    64ba:	c3                   	ret
+    64bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    64bf:	90                   	nop
+
+000064c0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    64c0:	55                   	push   %ebp
+    64c1:	89 e5                	mov    %esp,%ebp
+    64c3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    64c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    64cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    64cf:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    64d2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    64d9:	ff ff ff 
+  o.n = 0;
+    64dc:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    64e3:	00 00 00 
+  o.f = f;
+    64e6:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    64ec:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    64f2:	e8 d9 fd ff ff       	call   62d0 <vprintf.constprop.0>
+}
+    64f7:	c9                   	leave
+    64f8:	c3                   	ret
+    64f9:	66 90                	xchg   %ax,%ax
+    64fb:	66 90                	xchg   %ax,%ax
+    64fd:	66 90                	xchg   %ax,%ax
+    64ff:	90                   	nop
+
+00006500 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    6500:	55                   	push   %ebp
+    6501:	89 e5                	mov    %esp,%ebp
+    6503:	53                   	push   %ebx
+    6504:	89 c3                	mov    %eax,%ebx
+    6506:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    6509:	8b 40 0c             	mov    0xc(%eax),%eax
+    650c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    650f:	74 17                	je     6528 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    6511:	83 f8 02             	cmp    $0x2,%eax
+    6514:	74 07                	je     651d <setmode+0x1d>
+    6516:	8b 43 18             	mov    0x18(%ebx),%eax
+    6519:	85 c0                	test   %eax,%eax
+    651b:	74 38                	je     6555 <setmode+0x55>
+    f->mode = IONBF;
+}
+    651d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6520:	c9                   	leave
+    6521:	c3                   	ret
+    6522:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    6528:	83 ec 08             	sub    $0x8,%esp
+    652b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    652e:	50                   	push   %eax
+    652f:	ff 33                	push   (%ebx)
+    6531:	e8 c2 fa ff ff       	call   5ff8 <fstat>
+    6536:	83 c4 10             	add    $0x10,%esp
+    6539:	89 c2                	mov    %eax,%edx
+    653b:	31 c0                	xor    %eax,%eax
+    653d:	85 d2                	test   %edx,%edx
+    653f:	75 0a                	jne    654b <setmode+0x4b>
+    6541:	31 c0                	xor    %eax,%eax
+    6543:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    6548:	0f 94 c0             	sete   %al
+    654b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    654e:	8b 43 18             	mov    0x18(%ebx),%eax
+    6551:	85 c0                	test   %eax,%eax
+    6553:	75 c8                	jne    651d <setmode+0x1d>
+    6555:	83 ec 0c             	sub    $0xc,%esp
+    6558:	68 00 04 00 00       	push   $0x400
+    655d:	e8 de 07 00 00       	call   6d40 <malloc>
+    6562:	83 c4 10             	add    $0x10,%esp
+    6565:	89 43 18             	mov    %eax,0x18(%ebx)
+    6568:	85 c0                	test   %eax,%eax
+    656a:	75 b1                	jne    651d <setmode+0x1d>
+    f->mode = IONBF;
+    656c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    6573:	eb a8                	jmp    651d <setmode+0x1d>
+    6575:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    657c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00006580 <drain>:
+{
+    6580:	55                   	push   %ebp
+    6581:	89 e5                	mov    %esp,%ebp
+    6583:	57                   	push   %edi
+    6584:	56                   	push   %esi
+    6585:	53                   	push   %ebx
+    6586:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    6589:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    658c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    658f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    6596:	85 ff                	test   %edi,%edi
+    6598:	7f 0e                	jg     65a8 <drain+0x28>
+  return 0;
+    659a:	31 c0                	xor    %eax,%eax
+}
+    659c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    659f:	5b                   	pop    %ebx
+    65a0:	5e                   	pop    %esi
+    65a1:	5f                   	pop    %edi
+    65a2:	5d                   	pop    %ebp
+    65a3:	c3                   	ret
+    65a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    65a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    65ab:	8b 58 18             	mov    0x18(%eax),%ebx
+    65ae:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    65b0:	eb 0e                	jmp    65c0 <drain+0x40>
+    65b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    65b8:	29 c7                	sub    %eax,%edi
+    65ba:	01 c3                	add    %eax,%ebx
+    65bc:	85 ff                	test   %edi,%edi
+    65be:	7e da                	jle    659a <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    65c0:	83 ec 04             	sub    $0x4,%esp
+    65c3:	57                   	push   %edi
+    65c4:	53                   	push   %ebx
+    65c5:	56                   	push   %esi
+    65c6:	e8 c4 f9 ff ff       	call   5f8f <write>
+    65cb:	83 c4 10             	add    $0x10,%esp
+    65ce:	85 c0                	test   %eax,%eax
+    65d0:	7f e6                	jg     65b8 <drain+0x38>
+    f->err = 1;
+    65d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    65d5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    65dc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    65e1:	eb b9                	jmp    659c <drain+0x1c>
+    65e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    65ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000065f0 <flushall>:
+
+static void
+flushall(void)
+{
+    65f0:	55                   	push   %ebp
+    65f1:	89 e5                	mov    %esp,%ebp
+    65f3:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    65f4:	bb 40 9c 00 00       	mov    $0x9c40,%ebx
+{
+    65f9:	83 ec 04             	sub    $0x4,%esp
+    65fc:	eb 0d                	jmp    660b <flushall+0x1b>
+    65fe:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    6600:	83 c3 24             	add    $0x24,%ebx
+    6603:	81 fb 80 9e 00 00    	cmp    $0x9e80,%ebx
+    6609:	74 19                	je     6624 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    660b:	8b 43 08             	mov    0x8(%ebx),%eax
+    660e:	85 c0                	test   %eax,%eax
+    6610:	74 ee                	je     6600 <flushall+0x10>
+    6612:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    6614:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    6617:	e8 64 ff ff ff       	call   6580 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    661c:	81 fb 80 9e 00 00    	cmp    $0x9e80,%ebx
+    6622:	75 e7                	jne    660b <flushall+0x1b>
+}
+    6624:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6627:	c9                   	leave
+    6628:	c3                   	ret
+    6629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00006630 <fflush>:
+{
+    6630:	55                   	push   %ebp
+    6631:	89 e5                	mov    %esp,%ebp
+    6633:	57                   	push   %edi
+    6634:	56                   	push   %esi
+    6635:	53                   	push   %ebx
+    6636:	83 ec 0c             	sub    $0xc,%esp
+    6639:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    663c:	85 c0                	test   %eax,%eax
+    663e:	74 28                	je     6668 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    6640:	8b 70 08             	mov    0x8(%eax),%esi
+    6643:	85 f6                	test   %esi,%esi
+    6645:	75 11                	jne    6658 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    6647:	83 c4 0c             	add    $0xc,%esp
+    664a:	89 f0                	mov    %esi,%eax
+    664c:	5b                   	pop    %ebx
+    664d:	5e                   	pop    %esi
+    664e:	5f                   	pop    %edi
+    664f:	5d                   	pop    %ebp
+    6650:	c3                   	ret
+    6651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6658:	83 c4 0c             	add    $0xc,%esp
+    665b:	5b                   	pop    %ebx
+    665c:	5e                   	pop    %esi
+    665d:	5f                   	pop    %edi
+    665e:	5d                   	pop    %ebp
+  return drain(f);
+    665f:	e9 1c ff ff ff       	jmp    6580 <drain>
+    6664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    6668:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    666a:	bb 40 9c 00 00       	mov    $0x9c40,%ebx
+        r = -1;
+    666f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    6674:	eb 15                	jmp    668b <fflush+0x5b>
+    6676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    667d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    6680:	83 c3 24             	add    $0x24,%ebx
+    6683:	81 fb 80 9e 00 00    	cmp    $0x9e80,%ebx
+    6689:	74 bc                	je     6647 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    668b:	8b 43 08             	mov    0x8(%ebx),%eax
+    668e:	85 c0                	test   %eax,%eax
+    6690:	74 ee                	je     6680 <fflush+0x50>
+    6692:	89 d8                	mov    %ebx,%eax
+    6694:	e8 e7 fe ff ff       	call   6580 <drain>
+        r = -1;
+    6699:	85 c0                	test   %eax,%eax
+    669b:	0f 48 f7             	cmovs  %edi,%esi
+    669e:	eb e0                	jmp    6680 <fflush+0x50>
+
+000066a0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    66a0:	55                   	push   %ebp
+    66a1:	89 e5                	mov    %esp,%ebp
+    66a3:	57                   	push   %edi
+    66a4:	56                   	push   %esi
+    66a5:	53                   	push   %ebx
+    66a6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    66a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    66ac:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    66b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    66b3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    66b6:	85 d2                	test   %edx,%edx
+    66b8:	0f 8e 26 01 00 00    	jle    67e4 <fwrite+0x144>
+  if(!f->writable){
+    66be:	8b 46 08             	mov    0x8(%esi),%eax
+    66c1:	85 c0                	test   %eax,%eax
+    66c3:	0f 84 14 01 00 00    	je     67dd <fwrite+0x13d>
+  setmode(f);
+    66c9:	89 f0                	mov    %esi,%eax
+    66cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    66ce:	e8 2d fe ff ff       	call   6500 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    66d3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    66d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    66da:	c7 05 40 ed 00 00 f0 	movl   $0x65f0,0xed40
+    66e1:	65 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    66e4:	0f 84 b6 00 00 00    	je     67a0 <fwrite+0x100>
+    66ea:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    66f0:	0f 8f aa 00 00 00    	jg     67a0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    66f6:	8b 46 20             	mov    0x20(%esi),%eax
+    66f9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    66fc:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    66fe:	3d 00 04 00 00       	cmp    $0x400,%eax
+    6703:	74 6c                	je     6771 <fwrite+0xd1>
+    6705:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    6708:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    670b:	ba 00 04 00 00       	mov    $0x400,%edx
+    6710:	29 c2                	sub    %eax,%edx
+    6712:	39 ca                	cmp    %ecx,%edx
+    6714:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    6717:	85 d2                	test   %edx,%edx
+    6719:	0f 8e d1 00 00 00    	jle    67f0 <fwrite+0x150>
+    671f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    6722:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    6725:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    6728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    672f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    6730:	8d 50 01             	lea    0x1(%eax),%edx
+    6733:	83 c3 01             	add    $0x1,%ebx
+    6736:	8b 4e 18             	mov    0x18(%esi),%ecx
+    6739:	89 56 20             	mov    %edx,0x20(%esi)
+    673c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    6740:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    6743:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    6746:	b8 01 00 00 00       	mov    $0x1,%eax
+    674b:	80 fa 0a             	cmp    $0xa,%dl
+    674e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    6751:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    6754:	39 cb                	cmp    %ecx,%ebx
+    6756:	75 d8                	jne    6730 <fwrite+0x90>
+    6758:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    675b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    675e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    6761:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    6764:	85 db                	test   %ebx,%ebx
+    6766:	7e 19                	jle    6781 <fwrite+0xe1>
+    n -= k;
+    6768:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    676a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    676f:	75 97                	jne    6708 <fwrite+0x68>
+    6771:	89 f0                	mov    %esi,%eax
+    6773:	e8 08 fe ff ff       	call   6580 <drain>
+    6778:	85 c0                	test   %eax,%eax
+    677a:	78 68                	js     67e4 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    677c:	8b 46 20             	mov    0x20(%esi),%eax
+    677f:	eb 87                	jmp    6708 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    6781:	3d 00 04 00 00       	cmp    $0x400,%eax
+    6786:	74 74                	je     67fc <fwrite+0x15c>
+    6788:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    678c:	75 04                	jne    6792 <fwrite+0xf2>
+    678e:	85 ff                	test   %edi,%edi
+    6790:	75 6a                	jne    67fc <fwrite+0x15c>
+    return nmemb;
+    6792:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    6795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    6798:	5b                   	pop    %ebx
+    6799:	5e                   	pop    %esi
+    679a:	5f                   	pop    %edi
+    679b:	5d                   	pop    %ebp
+    679c:	c3                   	ret
+    679d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    67a0:	89 f0                	mov    %esi,%eax
+    67a2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    67a5:	e8 d6 fd ff ff       	call   6580 <drain>
+    67aa:	85 c0                	test   %eax,%eax
+    67ac:	78 2f                	js     67dd <fwrite+0x13d>
+    67ae:	89 75 14             	mov    %esi,0x14(%ebp)
+    67b1:	8b 3e                	mov    (%esi),%edi
+    67b3:	89 de                	mov    %ebx,%esi
+    67b5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    67b8:	eb 0e                	jmp    67c8 <fwrite+0x128>
+    67ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    67c0:	29 c3                	sub    %eax,%ebx
+    67c2:	01 c6                	add    %eax,%esi
+    67c4:	85 db                	test   %ebx,%ebx
+    67c6:	7e ca                	jle    6792 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    67c8:	83 ec 04             	sub    $0x4,%esp
+    67cb:	53                   	push   %ebx
+    67cc:	56                   	push   %esi
+    67cd:	57                   	push   %edi
+    67ce:	e8 bc f7 ff ff       	call   5f8f <write>
+    67d3:	83 c4 10             	add    $0x10,%esp
+    67d6:	85 c0                	test   %eax,%eax
+    67d8:	7f e6                	jg     67c0 <fwrite+0x120>
+    67da:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    67dd:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    67e4:	31 c0                	xor    %eax,%eax
+}
+    67e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    67e9:	5b                   	pop    %ebx
+    67ea:	5e                   	pop    %esi
+    67eb:	5f                   	pop    %edi
+    67ec:	5d                   	pop    %ebp
+    67ed:	c3                   	ret
+    67ee:	66 90                	xchg   %ax,%ax
+    n -= k;
+    67f0:	89 d9                	mov    %ebx,%ecx
+    67f2:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    67f5:	89 cb                	mov    %ecx,%ebx
+    67f7:	e9 6e ff ff ff       	jmp    676a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    67fc:	89 f0                	mov    %esi,%eax
+    67fe:	e8 7d fd ff ff       	call   6580 <drain>
+    6803:	85 c0                	test   %eax,%eax
+    6805:	79 8b                	jns    6792 <fwrite+0xf2>
+    return 0;
+    6807:	31 c0                	xor    %eax,%eax
+    6809:	eb db                	jmp    67e6 <fwrite+0x146>
+    680b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    680f:	90                   	nop
+
+00006810 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    6810:	55                   	push   %ebp
+    6811:	89 e5                	mov    %esp,%ebp
+    6813:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    6816:	8b 45 08             	mov    0x8(%ebp),%eax
+    6819:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    681c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    681f:	ff 75 0c             	push   0xc(%ebp)
+    6822:	6a 01                	push   $0x1
+    6824:	6a 01                	push   $0x1
+    6826:	50                   	push   %eax
+    6827:	e8 74 fe ff ff       	call   66a0 <fwrite>
+    682c:	83 c4 10             	add    $0x10,%esp
+    682f:	83 f8 01             	cmp    $0x1,%eax
+    6832:	75 0c                	jne    6840 <fputc+0x30>
+    6834:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    6838:	c9                   	leave
+    6839:	c3                   	ret
+    683a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    6840:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    6841:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    6846:	c3                   	ret
+    6847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    684e:	66 90                	xchg   %ax,%ax
+
+00006850 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    6850:	55                   	push   %ebp
+    6851:	89 e5                	mov    %esp,%ebp
+    6853:	57                   	push   %edi
+    6854:	56                   	push   %esi
+    6855:	53                   	push   %ebx
+    6856:	83 ec 1c             	sub    $0x1c,%esp
+    6859:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    685c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    685f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    6862:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    6865:	85 d2                	test   %edx,%edx
+    6867:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    686a:	7e 12                	jle    687e <fread+0x2e>
+    686c:	85 ff                	test   %edi,%edi
+    686e:	7e 0e                	jle    687e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    6870:	8b 43 04             	mov    0x4(%ebx),%eax
+    6873:	85 c0                	test   %eax,%eax
+    6875:	75 19                	jne    6890 <fread+0x40>
+    f->err = 1;
+    6877:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    687e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    6881:	31 c0                	xor    %eax,%eax
+}
+    6883:	5b                   	pop    %ebx
+    6884:	5e                   	pop    %esi
+    6885:	5f                   	pop    %edi
+    6886:	5d                   	pop    %ebp
+    6887:	c3                   	ret
+    6888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    688f:	90                   	nop
+  setmode(f);
+    6890:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    6892:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    6894:	e8 67 fc ff ff       	call   6500 <setmode>
+  for(n = 0; n < want; n += k){
+    6899:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    689c:	89 f7                	mov    %esi,%edi
+    689e:	eb 31                	jmp    68d1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    68a0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    68a4:	74 08                	je     68ae <fread+0x5e>
+    68a6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    68ac:	7e 62                	jle    6910 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    68ae:	83 ec 04             	sub    $0x4,%esp
+    68b1:	56                   	push   %esi
+    68b2:	8b 45 08             	mov    0x8(%ebp),%eax
+    68b5:	01 f8                	add    %edi,%eax
+    68b7:	50                   	push   %eax
+    68b8:	ff 33                	push   (%ebx)
+    68ba:	e8 c1 f6 ff ff       	call   5f80 <read>
+    68bf:	83 c4 10             	add    $0x10,%esp
+    68c2:	85 c0                	test   %eax,%eax
+    68c4:	0f 8e ce 00 00 00    	jle    6998 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    68ca:	01 c7                	add    %eax,%edi
+    68cc:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    68cf:	7e 36                	jle    6907 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    68d1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    68d4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    68d7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    68da:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    68dc:	39 c1                	cmp    %eax,%ecx
+    68de:	7d c0                	jge    68a0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    68e0:	29 c8                	sub    %ecx,%eax
+    68e2:	39 f0                	cmp    %esi,%eax
+    68e4:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    68e7:	83 ec 04             	sub    $0x4,%esp
+    68ea:	56                   	push   %esi
+    68eb:	03 4b 18             	add    0x18(%ebx),%ecx
+    68ee:	51                   	push   %ecx
+    68ef:	8b 45 08             	mov    0x8(%ebp),%eax
+    68f2:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    68f4:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    68f6:	50                   	push   %eax
+    68f7:	e8 34 f5 ff ff       	call   5e30 <memmove>
+      f->r += k;
+    68fc:	01 73 1c             	add    %esi,0x1c(%ebx)
+    68ff:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    6902:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    6905:	7f ca                	jg     68d1 <fread+0x81>
+    6907:	89 fe                	mov    %edi,%esi
+    6909:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    690c:	eb 3f                	jmp    694d <fread+0xfd>
+    690e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    6910:	3b 1d 28 9c 00 00    	cmp    0x9c28,%ebx
+    6916:	74 68                	je     6980 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    6918:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    691b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    6922:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    6929:	68 00 04 00 00       	push   $0x400
+    692e:	ff 73 18             	push   0x18(%ebx)
+    6931:	ff 33                	push   (%ebx)
+    6933:	e8 48 f6 ff ff       	call   5f80 <read>
+    6938:	83 c4 10             	add    $0x10,%esp
+    693b:	85 c0                	test   %eax,%eax
+    693d:	78 21                	js     6960 <fread+0x110>
+  else if(n == 0)
+    693f:	75 2f                	jne    6970 <fread+0x120>
+    f->eof = 1;
+    6941:	89 fe                	mov    %edi,%esi
+    6943:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    6946:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    694d:	89 f0                	mov    %esi,%eax
+}
+    694f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    6952:	99                   	cltd
+}
+    6953:	5b                   	pop    %ebx
+    6954:	5e                   	pop    %esi
+  return n / size;
+    6955:	f7 ff                	idiv   %edi
+}
+    6957:	5f                   	pop    %edi
+    6958:	5d                   	pop    %ebp
+    6959:	c3                   	ret
+    695a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    6960:	89 fe                	mov    %edi,%esi
+    6962:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    6965:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    696c:	eb df                	jmp    694d <fread+0xfd>
+    696e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    6970:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    6973:	e9 54 ff ff ff       	jmp    68cc <fread+0x7c>
+    6978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    697f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    6980:	83 ec 0c             	sub    $0xc,%esp
+    6983:	ff 35 24 9c 00 00    	push   0x9c24
+    6989:	e8 a2 fc ff ff       	call   6630 <fflush>
+    698e:	83 c4 10             	add    $0x10,%esp
+    6991:	eb 85                	jmp    6918 <fread+0xc8>
+    6993:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    6997:	90                   	nop
+        if(k < 0)
+    6998:	89 fe                	mov    %edi,%esi
+    699a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    699d:	74 a7                	je     6946 <fread+0xf6>
+    699f:	eb c4                	jmp    6965 <fread+0x115>
+    69a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    69a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    69af:	90                   	nop
+
+000069b0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    69b0:	55                   	push   %ebp
+    69b1:	89 e5                	mov    %esp,%ebp
+    69b3:	53                   	push   %ebx
+    69b4:	83 ec 14             	sub    $0x14,%esp
+    69b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    69ba:	8b 50 04             	mov    0x4(%eax),%edx
+    69bd:	85 d2                	test   %edx,%edx
+    69bf:	74 08                	je     69c9 <fgetc+0x19>
+    69c1:	8b 50 1c             	mov    0x1c(%eax),%edx
+    69c4:	3b 50 20             	cmp    0x20(%eax),%edx
+    69c7:	7c 27                	jl     69f0 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    69c9:	50                   	push   %eax
+    69ca:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    69cd:	6a 01                	push   $0x1
+    69cf:	6a 01                	push   $0x1
+    69d1:	50                   	push   %eax
+    69d2:	e8 79 fe ff ff       	call   6850 <fread>
+    69d7:	83 c4 10             	add    $0x10,%esp
+    69da:	83 f8 01             	cmp    $0x1,%eax
+    69dd:	75 29                	jne    6a08 <fgetc+0x58>
+    69df:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    69e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    69e6:	c9                   	leave
+    69e7:	c3                   	ret
+    69e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    69ef:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    69f0:	8b 48 18             	mov    0x18(%eax),%ecx
+    69f3:	8d 5a 01             	lea    0x1(%edx),%ebx
+    69f6:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    69f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    69fc:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    6a00:	c9                   	leave
+    6a01:	c3                   	ret
+    6a02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    6a08:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    6a0d:	eb d4                	jmp    69e3 <fgetc+0x33>
+    6a0f:	90                   	nop
+
+00006a10 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    6a10:	55                   	push   %ebp
+    6a11:	89 e5                	mov    %esp,%ebp
+    6a13:	57                   	push   %edi
+    6a14:	56                   	push   %esi
+    6a15:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    6a16:	31 db                	xor    %ebx,%ebx
+{
+    6a18:	83 ec 1c             	sub    $0x1c,%esp
+    6a1b:	8b 75 10             	mov    0x10(%ebp),%esi
+    6a1e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    6a20:	eb 2e                	jmp    6a50 <fgets+0x40>
+    6a22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    6a28:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    6a2b:	57                   	push   %edi
+    6a2c:	6a 01                	push   $0x1
+    6a2e:	6a 01                	push   $0x1
+    6a30:	50                   	push   %eax
+    6a31:	e8 1a fe ff ff       	call   6850 <fread>
+    6a36:	83 c4 10             	add    $0x10,%esp
+    6a39:	83 f8 01             	cmp    $0x1,%eax
+    6a3c:	75 62                	jne    6aa0 <fgets+0x90>
+    6a3e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    6a42:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    6a45:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    6a47:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    6a4b:	83 f9 0a             	cmp    $0xa,%ecx
+    6a4e:	74 34                	je     6a84 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    6a50:	89 de                	mov    %ebx,%esi
+    6a52:	83 c3 01             	add    $0x1,%ebx
+    6a55:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    6a58:	7d 46                	jge    6aa0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    6a5a:	8b 47 04             	mov    0x4(%edi),%eax
+    6a5d:	85 c0                	test   %eax,%eax
+    6a5f:	74 c7                	je     6a28 <fgets+0x18>
+    6a61:	8b 47 1c             	mov    0x1c(%edi),%eax
+    6a64:	3b 47 20             	cmp    0x20(%edi),%eax
+    6a67:	7d bf                	jge    6a28 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    6a69:	8b 4f 18             	mov    0x18(%edi),%ecx
+    6a6c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    6a6f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    6a72:	89 77 1c             	mov    %esi,0x1c(%edi)
+    6a75:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    6a79:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    6a7b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    6a7f:	83 f9 0a             	cmp    $0xa,%ecx
+    6a82:	75 cc                	jne    6a50 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    6a84:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a87:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    6a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    6a8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    6a91:	5b                   	pop    %ebx
+    6a92:	5e                   	pop    %esi
+    6a93:	5f                   	pop    %edi
+    6a94:	5d                   	pop    %ebp
+    6a95:	c3                   	ret
+    6a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6a9d:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    6aa0:	8b 45 08             	mov    0x8(%ebp),%eax
+    6aa3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    6aa7:	31 c0                	xor    %eax,%eax
+    6aa9:	85 f6                	test   %esi,%esi
+    6aab:	74 e1                	je     6a8e <fgets+0x7e>
+    6aad:	8b 45 08             	mov    0x8(%ebp),%eax
+    6ab0:	eb dc                	jmp    6a8e <fgets+0x7e>
+    6ab2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00006ac0 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    6ac0:	55                   	push   %ebp
+    6ac1:	89 e5                	mov    %esp,%ebp
+    6ac3:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    6ac4:	bb 40 9c 00 00       	mov    $0x9c40,%ebx
+{
+    6ac9:	83 ec 04             	sub    $0x4,%esp
+    6acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    6ad0:	8b 53 04             	mov    0x4(%ebx),%edx
+    6ad3:	85 d2                	test   %edx,%edx
+    6ad5:	75 07                	jne    6ade <fdopen+0x1e>
+    6ad7:	8b 43 08             	mov    0x8(%ebx),%eax
+    6ada:	85 c0                	test   %eax,%eax
+    6adc:	74 1a                	je     6af8 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    6ade:	83 c3 24             	add    $0x24,%ebx
+    6ae1:	81 fb 80 9e 00 00    	cmp    $0x9e80,%ebx
+    6ae7:	75 e7                	jne    6ad0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    6ae9:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    6aeb:	89 d8                	mov    %ebx,%eax
+    6aed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6af0:	c9                   	leave
+    6af1:	c3                   	ret
+    6af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    6af8:	81 fb 80 9e 00 00    	cmp    $0x9e80,%ebx
+    6afe:	74 e9                	je     6ae9 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    6b00:	83 ec 04             	sub    $0x4,%esp
+    6b03:	6a 24                	push   $0x24
+    6b05:	6a 00                	push   $0x0
+    6b07:	53                   	push   %ebx
+    6b08:	e8 d3 f1 ff ff       	call   5ce0 <memset>
+  f->fd = fd;
+    6b0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    6b10:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    6b17:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    6b1a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    6b1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6b1f:	80 38 72             	cmpb   $0x72,(%eax)
+    6b22:	74 14                	je     6b38 <fdopen+0x78>
+    f->writable = 1;
+    6b24:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    6b2b:	89 d8                	mov    %ebx,%eax
+    6b2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6b30:	c9                   	leave
+    6b31:	c3                   	ret
+    6b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    6b38:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    6b3f:	89 d8                	mov    %ebx,%eax
+    6b41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6b44:	c9                   	leave
+    6b45:	c3                   	ret
+    6b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00006b50 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    6b50:	55                   	push   %ebp
+    6b51:	89 e5                	mov    %esp,%ebp
+    6b53:	56                   	push   %esi
+    6b54:	53                   	push   %ebx
+    6b55:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    6b58:	0f b6 06             	movzbl (%esi),%eax
+    6b5b:	3c 72                	cmp    $0x72,%al
+    6b5d:	74 61                	je     6bc0 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    6b5f:	3c 77                	cmp    $0x77,%al
+    6b61:	74 7d                	je     6be0 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    6b63:	3c 61                	cmp    $0x61,%al
+    6b65:	75 49                	jne    6bb0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    6b67:	83 ec 08             	sub    $0x8,%esp
+    6b6a:	68 01 02 00 00       	push   $0x201
+    6b6f:	ff 75 08             	push   0x8(%ebp)
+    6b72:	e8 54 f4 ff ff       	call   5fcb <open>
+    6b77:	83 c4 10             	add    $0x10,%esp
+    6b7a:	89 c3                	mov    %eax,%ebx
+    6b7c:	85 c0                	test   %eax,%eax
+    6b7e:	78 30                	js     6bb0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    6b80:	83 ec 04             	sub    $0x4,%esp
+    6b83:	6a 02                	push   $0x2
+    6b85:	6a 00                	push   $0x0
+    6b87:	50                   	push   %eax
+    6b88:	e8 4c f5 ff ff       	call   60d9 <lseek>
+    6b8d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    6b90:	83 ec 08             	sub    $0x8,%esp
+    6b93:	56                   	push   %esi
+    6b94:	53                   	push   %ebx
+    6b95:	e8 26 ff ff ff       	call   6ac0 <fdopen>
+    6b9a:	83 c4 10             	add    $0x10,%esp
+    6b9d:	85 c0                	test   %eax,%eax
+    6b9f:	75 11                	jne    6bb2 <fopen+0x62>
+    close(fd);
+    6ba1:	83 ec 0c             	sub    $0xc,%esp
+    6ba4:	53                   	push   %ebx
+    6ba5:	e8 f4 f3 ff ff       	call   5f9e <close>
+    6baa:	83 c4 10             	add    $0x10,%esp
+    6bad:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    6bb0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    6bb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    6bb5:	5b                   	pop    %ebx
+    6bb6:	5e                   	pop    %esi
+    6bb7:	5d                   	pop    %ebp
+    6bb8:	c3                   	ret
+    6bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    6bc0:	83 ec 08             	sub    $0x8,%esp
+    6bc3:	6a 00                	push   $0x0
+    6bc5:	ff 75 08             	push   0x8(%ebp)
+    6bc8:	e8 fe f3 ff ff       	call   5fcb <open>
+    6bcd:	83 c4 10             	add    $0x10,%esp
+    6bd0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    6bd2:	85 db                	test   %ebx,%ebx
+    6bd4:	78 da                	js     6bb0 <fopen+0x60>
+    6bd6:	eb b8                	jmp    6b90 <fopen+0x40>
+    6bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6bdf:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    6be0:	83 ec 08             	sub    $0x8,%esp
+    6be3:	68 01 06 00 00       	push   $0x601
+    6be8:	ff 75 08             	push   0x8(%ebp)
+    6beb:	e8 db f3 ff ff       	call   5fcb <open>
+    6bf0:	83 c4 10             	add    $0x10,%esp
+    6bf3:	89 c3                	mov    %eax,%ebx
+    6bf5:	eb db                	jmp    6bd2 <fopen+0x82>
+    6bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6bfe:	66 90                	xchg   %ax,%ax
+
+00006c00 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    6c00:	55                   	push   %ebp
+    6c01:	89 e5                	mov    %esp,%ebp
+    6c03:	56                   	push   %esi
+    6c04:	53                   	push   %ebx
+    6c05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    6c08:	83 ec 0c             	sub    $0xc,%esp
+    6c0b:	53                   	push   %ebx
+    6c0c:	e8 1f fa ff ff       	call   6630 <fflush>
+    6c11:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    6c13:	58                   	pop    %eax
+    6c14:	ff 33                	push   (%ebx)
+    6c16:	e8 83 f3 ff ff       	call   5f9e <close>
+    6c1b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    6c1e:	85 c0                	test   %eax,%eax
+    6c20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    6c25:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    6c28:	8b 43 18             	mov    0x18(%ebx),%eax
+    6c2b:	85 c0                	test   %eax,%eax
+    6c2d:	0f 95 c1             	setne  %cl
+    6c30:	3d 60 f1 00 00       	cmp    $0xf160,%eax
+    6c35:	0f 95 c2             	setne  %dl
+    6c38:	84 d1                	test   %dl,%cl
+    6c3a:	74 07                	je     6c43 <fclose+0x43>
+    6c3c:	3d 60 ed 00 00       	cmp    $0xed60,%eax
+    6c41:	75 25                	jne    6c68 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    6c43:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    6c4a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    6c4c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    6c53:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    6c5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    6c5d:	5b                   	pop    %ebx
+    6c5e:	5e                   	pop    %esi
+    6c5f:	5d                   	pop    %ebp
+    6c60:	c3                   	ret
+    6c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    6c68:	83 ec 0c             	sub    $0xc,%esp
+    6c6b:	50                   	push   %eax
+    6c6c:	e8 3f 00 00 00       	call   6cb0 <free>
+    6c71:	83 c4 10             	add    $0x10,%esp
+    6c74:	eb cd                	jmp    6c43 <fclose+0x43>
+    6c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00006c80 <feof>:
+
+int
+feof(FILE *f)
+{
+    6c80:	55                   	push   %ebp
+    6c81:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    6c83:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    6c86:	5d                   	pop    %ebp
+  return f->eof;
+    6c87:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    6c8a:	c3                   	ret
+    6c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    6c8f:	90                   	nop
+
+00006c90 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    6c90:	55                   	push   %ebp
+    6c91:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    6c93:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    6c96:	5d                   	pop    %ebp
+  return f->err;
+    6c97:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    6c9a:	c3                   	ret
+    6c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    6c9f:	90                   	nop
+
+00006ca0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    6ca0:	55                   	push   %ebp
+    6ca1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    6ca3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    6ca6:	5d                   	pop    %ebp
+  return f->fd;
+    6ca7:	8b 00                	mov    (%eax),%eax
+}
+    6ca9:	c3                   	ret
+    6caa:	66 90                	xchg   %ax,%ax
+    6cac:	66 90                	xchg   %ax,%ax
+    6cae:	66 90                	xchg   %ax,%ax
+
+00006cb0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    6cb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6cb1:	a1 60 f5 00 00       	mov    0xf560,%eax
+{
+    6cb6:	89 e5                	mov    %esp,%ebp
+    6cb8:	57                   	push   %edi
+    6cb9:	56                   	push   %esi
+    6cba:	53                   	push   %ebx
+    6cbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    6cbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6cc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    6cca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6ccc:	39 ca                	cmp    %ecx,%edx
+    6cce:	73 30                	jae    6d00 <free+0x50>
+    6cd0:	39 c1                	cmp    %eax,%ecx
+    6cd2:	72 04                	jb     6cd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    6cd4:	39 c2                	cmp    %eax,%edx
+    6cd6:	72 f0                	jb     6cc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    6cd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    6cdb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    6cde:	39 f8                	cmp    %edi,%eax
+    6ce0:	74 2e                	je     6d10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    6ce2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    6ce5:	8b 42 04             	mov    0x4(%edx),%eax
+    6ce8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    6ceb:	39 f1                	cmp    %esi,%ecx
+    6ced:	74 38                	je     6d27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    6cef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    6cf1:	5b                   	pop    %ebx
+  freep = p;
+    6cf2:	89 15 60 f5 00 00    	mov    %edx,0xf560
+}
+    6cf8:	5e                   	pop    %esi
+    6cf9:	5f                   	pop    %edi
+    6cfa:	5d                   	pop    %ebp
+    6cfb:	c3                   	ret
+    6cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    6d00:	39 c1                	cmp    %eax,%ecx
+    6d02:	72 d0                	jb     6cd4 <free+0x24>
+    6d04:	eb c2                	jmp    6cc8 <free+0x18>
+    6d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    6d10:	03 70 04             	add    0x4(%eax),%esi
+    6d13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    6d16:	8b 02                	mov    (%edx),%eax
+    6d18:	8b 00                	mov    (%eax),%eax
+    6d1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    6d1d:	8b 42 04             	mov    0x4(%edx),%eax
+    6d20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    6d23:	39 f1                	cmp    %esi,%ecx
+    6d25:	75 c8                	jne    6cef <free+0x3f>
+    p->s.size += bp->s.size;
+    6d27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    6d2a:	89 15 60 f5 00 00    	mov    %edx,0xf560
+    p->s.size += bp->s.size;
+    6d30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    6d33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    6d36:	89 0a                	mov    %ecx,(%edx)
+}
+    6d38:	5b                   	pop    %ebx
+    6d39:	5e                   	pop    %esi
+    6d3a:	5f                   	pop    %edi
+    6d3b:	5d                   	pop    %ebp
+    6d3c:	c3                   	ret
+    6d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00006d40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    6d40:	55                   	push   %ebp
+    6d41:	89 e5                	mov    %esp,%ebp
+    6d43:	57                   	push   %edi
+    6d44:	56                   	push   %esi
+    6d45:	53                   	push   %ebx
+    6d46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    6d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    6d4c:	8b 15 60 f5 00 00    	mov    0xf560,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    6d52:	8d 78 07             	lea    0x7(%eax),%edi
+    6d55:	c1 ef 03             	shr    $0x3,%edi
+    6d58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    6d5b:	85 d2                	test   %edx,%edx
+    6d5d:	0f 84 8d 00 00 00    	je     6df0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6d63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    6d65:	8b 48 04             	mov    0x4(%eax),%ecx
+    6d68:	39 f9                	cmp    %edi,%ecx
+    6d6a:	73 64                	jae    6dd0 <malloc+0x90>
+  if(nu < 4096)
+    6d6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    6d71:	39 df                	cmp    %ebx,%edi
+    6d73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    6d76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    6d7d:	eb 0a                	jmp    6d89 <malloc+0x49>
+    6d7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6d80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    6d82:	8b 48 04             	mov    0x4(%eax),%ecx
+    6d85:	39 f9                	cmp    %edi,%ecx
+    6d87:	73 47                	jae    6dd0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    6d89:	89 c2                	mov    %eax,%edx
+    6d8b:	39 05 60 f5 00 00    	cmp    %eax,0xf560
+    6d91:	75 ed                	jne    6d80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    6d93:	83 ec 0c             	sub    $0xc,%esp
+    6d96:	56                   	push   %esi
+    6d97:	e8 b6 f2 ff ff       	call   6052 <sbrk>
+  if(p == (char*)-1)
+    6d9c:	83 c4 10             	add    $0x10,%esp
+    6d9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6da2:	74 1c                	je     6dc0 <malloc+0x80>
+  hp->s.size = nu;
+    6da4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    6da7:	83 ec 0c             	sub    $0xc,%esp
+    6daa:	83 c0 08             	add    $0x8,%eax
+    6dad:	50                   	push   %eax
+    6dae:	e8 fd fe ff ff       	call   6cb0 <free>
+  return freep;
+    6db3:	8b 15 60 f5 00 00    	mov    0xf560,%edx
+      if((p = morecore(nunits)) == 0)
+    6db9:	83 c4 10             	add    $0x10,%esp
+    6dbc:	85 d2                	test   %edx,%edx
+    6dbe:	75 c0                	jne    6d80 <malloc+0x40>
+        return 0;
+  }
+}
+    6dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    6dc3:	31 c0                	xor    %eax,%eax
+}
+    6dc5:	5b                   	pop    %ebx
+    6dc6:	5e                   	pop    %esi
+    6dc7:	5f                   	pop    %edi
+    6dc8:	5d                   	pop    %ebp
+    6dc9:	c3                   	ret
+    6dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    6dd0:	39 cf                	cmp    %ecx,%edi
+    6dd2:	74 4c                	je     6e20 <malloc+0xe0>
+        p->s.size -= nunits;
+    6dd4:	29 f9                	sub    %edi,%ecx
+    6dd6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    6dd9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    6ddc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    6ddf:	89 15 60 f5 00 00    	mov    %edx,0xf560
+}
+    6de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    6de8:	83 c0 08             	add    $0x8,%eax
+}
+    6deb:	5b                   	pop    %ebx
+    6dec:	5e                   	pop    %esi
+    6ded:	5f                   	pop    %edi
+    6dee:	5d                   	pop    %ebp
+    6def:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    6df0:	c7 05 60 f5 00 00 64 	movl   $0xf564,0xf560
+    6df7:	f5 00 00 
+    base.s.size = 0;
+    6dfa:	b8 64 f5 00 00       	mov    $0xf564,%eax
+    base.s.ptr = freep = prevp = &base;
+    6dff:	c7 05 64 f5 00 00 64 	movl   $0xf564,0xf564
+    6e06:	f5 00 00 
+    base.s.size = 0;
+    6e09:	c7 05 68 f5 00 00 00 	movl   $0x0,0xf568
+    6e10:	00 00 00 
+    if(p->s.size >= nunits){
+    6e13:	e9 54 ff ff ff       	jmp    6d6c <malloc+0x2c>
+    6e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6e1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    6e20:	8b 08                	mov    (%eax),%ecx
+    6e22:	89 0a                	mov    %ecx,(%edx)
+    6e24:	eb b9                	jmp    6ddf <malloc+0x9f>
@@ -7,35 +7,37 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "kstat.h"
+#include "ring.h"
+#include "upage.h"
 
 char buf[8192];
 char name[3];
 char *echoargv[] = { "echo", "ALL", "TESTS", "PASSED", 0 };
-int stdout = 1;
 
 // does chdir() call iput(p->cwd) in a transaction?
 void
 iputtest(void)
 {
-  printf(stdout, "iput test\n");
+  printf(1, "iput test\n");
 
   if(mkdir("iputdir") < 0){
-    printf(stdout, "mkdir failed\n");
+    printf(1, "mkdir failed\n");
     exit();
   }
   if(chdir("iputdir") < 0){
-    printf(stdout, "chdir iputdir failed\n");
+    printf(1, "chdir iputdir failed\n");
     exit();
   }
   if(unlink("../iputdir") < 0){
-    printf(stdout, "unlink ../iputdir failed\n");
+    printf(1, "unlink ../iputdir failed\n");
     exit();
   }
   if(chdir("/") < 0){
-    printf(stdout, "chdir / failed\n");
+    printf(1, "chdir / failed\n");
     exit();
   }
-  printf(stdout, "iput test ok\n");
+  printf(1, "iput test ok\n");
 }
 
 // does exit() call iput(p->cwd) in a transaction?
@@ -44,30 +46,30 @@ exitiputtest(void)
 {
   int pid;
 
-  printf(stdout, "exitiput test\n");
+  printf(1, "exitiput test\n");
 
   pid = fork();
   if(pid < 0){
-    printf(stdout, "fork failed\n");
+    printf(1, "fork failed\n");
     exit();
   }
   if(pid == 0){
     if(mkdir("iputdir") < 0){
-      printf(stdout, "mkdir failed\n");
+      printf(1, "mkdir failed\n");
       exit();
     }
     if(chdir("iputdir") < 0){
-      printf(stdout, "child chdir failed\n");
+      printf(1, "child chdir failed\n");
       exit();
     }
     if(unlink("../iputdir") < 0){
-      printf(stdout, "unlink ../iputdir failed\n");
+      printf(1, "unlink ../iputdir failed\n");
       exit();
     }
     exit();
   }
   wait();
-  printf(stdout, "exitiput test ok\n");
+  printf(1, "exitiput test ok\n");
 }
 
 // does the error path in open() for attempt to write a
@@ -86,31 +88,31 @@ openiputtest(void)
 {
   int pid;
 
-  printf(stdout, "openiput test\n");
+  printf(1, "openiput test\n");
   if(mkdir("oidir") < 0){
-    printf(stdout, "mkdir oidir failed\n");
+    printf(1, "mkdir oidir failed\n");
     exit();
   }
   pid = fork();
   if(pid < 0){
-    printf(stdout, "fork failed\n");
+    printf(1, "fork failed\n");
     exit();
   }
   if(pid == 0){
     int fd = open("oidir", O_RDWR);
     if(fd >= 0){
-      printf(stdout, "open directory for write succeeded\n");
+      printf(1, "open directory for write succeeded\n");
       exit();
     }
     exit();
   }
   sleep(1);
   if(unlink("oidir") != 0){
-    printf(stdout, "unlink failed\n");
+    printf(1, "unlink failed\n");
     exit();
   }
   wait();
-  printf(stdout, "openiput test ok\n");
+  printf(1, "openiput test ok\n");
 }
 
 // simple file system tests
@@ -120,19 +122,19 @@ opentest(void)
 {
   int fd;
 
-  printf(stdout, "open test\n");
+  printf(1, "open test\n");
   fd = open("echo", 0);
   if(fd < 0){
-    printf(stdout, "open echo failed!\n");
+    printf(1, "open echo failed!\n");
     exit();
   }
   close(fd);
   fd = open("doesnotexist", 0);
   if(fd >= 0){
-    printf(stdout, "open doesnotexist succeeded!\n");
+    printf(1, "open doesnotexist succeeded!\n");
     exit();
   }
-  printf(stdout, "open test ok\n");
+  printf(1, "open test ok\n");
 }
 
 void
@@ -141,66 +143,70 @@ writetest(void)
   int fd;
   int i;
 
-  printf(stdout, "small file test\n");
+  printf(1, "small file test\n");
   fd = open("small", O_CREATE|O_RDWR);
   if(fd >= 0){
-    printf(stdout, "creat small succeeded; ok\n");
+    printf(1, "creat small succeeded; ok\n");
   } else {
-    printf(stdout, "error: creat small failed!\n");
+    printf(1, "error: creat small failed!\n");
     exit();
   }
   for(i = 0; i < 100; i++){
     if(write(fd, "aaaaaaaaaa", 10) != 10){
-      printf(stdout, "error: write aa %d new file failed\n", i);
+      printf(1, "error: write aa %d new file failed\n", i);
       exit();
     }
     if(write(fd, "bbbbbbbbbb", 10) != 10){
-      printf(stdout, "error: write bb %d new file failed\n", i);
+      printf(1, "error: write bb %d new file failed\n", i);
       exit();
     }
   }
-  printf(stdout, "writes ok\n");
+  printf(1, "writes ok\n");
   close(fd);
   fd = open("small", O_RDONLY);
   if(fd >= 0){
-    printf(stdout, "open small succeeded ok\n");
+    printf(1, "open small succeeded ok\n");
   } else {
-    printf(stdout, "error: open small failed!\n");
+    printf(1, "error: open small failed!\n");
     exit();
   }
   i = read(fd, buf, 2000);
   if(i == 2000){
-    printf(stdout, "read succeeded ok\n");
+    printf(1, "read succeeded ok\n");
   } else {
-    printf(stdout, "read failed\n");
+    printf(1, "read failed\n");
     exit();
   }
   close(fd);
 
   if(unlink("small") < 0){
-    printf(stdout, "unlink small failed\n");
+    printf(1, "unlink small failed\n");
     exit();
   }
-  printf(stdout, "small file test ok\n");
+  printf(1, "small file test ok\n");
 }
 
+#define BIGBLOCKS (NDIRECT+NINDIRECT+2)
+
 void
 writetest1(void)
 {
   int i, fd, n;
 
-  printf(stdout, "big files test\n");
+  printf(1, "big files test\n");
 
   fd = open("big", O_CREATE|O_RDWR);
   if(fd < 0){
-    printf(stdout, "error: creat big failed!\n");
+    printf(1, "error: creat big failed!\n");
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  // Past the blocks the direct and single-indirect
+  // entries map, so that a double-indirect block is needed.
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
-    if(write(fd, buf, 512) != 512){
-      printf(stdout, "error: write big file failed\n", i);
+    if(write(fd, buf, BSIZE) != BSIZE){
+      printf(1, "error: write big file failed\n", i);
       exit();
     }
   }
@@ -209,25 +215,25 @@ writetest1(void)
 
   fd = open("big", O_RDONLY);
   if(fd < 0){
-    printf(stdout, "error: open big failed!\n");
+    printf(1, "error: open big failed!\n");
     exit();
   }
 
   n = 0;
   for(;;){
-    i = read(fd, buf, 512);
+    i = read(fd, buf, BSIZE);
     if(i == 0){
-      if(n == MAXFILE - 1){
-        printf(stdout, "read only %d blocks from big", n);
+      if(n != BIGBLOCKS){
+        printf(1, "read only %d blocks from big", n);
         exit();
       }
       break;
-    } else if(i != 512){
-      printf(stdout, "read failed %d\n", i);
+    } else if(i != BSIZE){
+      printf(1, "read failed %d\n", i);
       exit();
     }
     if(((int*)buf)[0] != n){
-      printf(stdout, "read content of block %d is %d\n",
+      printf(1, "read content of block %d is %d\n",
              n, ((int*)buf)[0]);
       exit();
     }
@@ -235,10 +241,10 @@ writetest1(void)
   }
   close(fd);
   if(unlink("big") < 0){
-    printf(stdout, "unlink big failed\n");
+    printf(1, "unlink big failed\n");
     exit();
   }
-  printf(stdout, "big files ok\n");
+  printf(1, "big files ok\n");
 }
 
 void
@@ -246,7 +252,7 @@ createtest(void)
 {
   int i, fd;
 
-  printf(stdout, "many creates, followed by unlink test\n");
+  printf(1, "many creates, followed by unlink test\n");
 
   name[0] = 'a';
   name[2] = '\0';
@@ -261,41 +267,41 @@ createtest(void)
     name[1] = '0' + i;
     unlink(name);
   }
-  printf(stdout, "many creates, followed by unlink; ok\n");
+  printf(1, "many creates, followed by unlink; ok\n");
 }
 
 void dirtest(void)
 {
-  printf(stdout, "mkdir test\n");
+  printf(1, "mkdir test\n");
 
   if(mkdir("dir0") < 0){
-    printf(stdout, "mkdir failed\n");
+    printf(1, "mkdir failed\n");
     exit();
   }
 
   if(chdir("dir0") < 0){
-    printf(stdout, "chdir dir0 failed\n");
+    printf(1, "chdir dir0 failed\n");
     exit();
   }
 
   if(chdir("..") < 0){
-    printf(stdout, "chdir .. failed\n");
+    printf(1, "chdir .. failed\n");
     exit();
   }
 
   if(unlink("dir0") < 0){
-    printf(stdout, "unlink dir0 failed\n");
+    printf(1, "unlink dir0 failed\n");
     exit();
   }
-  printf(stdout, "mkdir test ok\n");
+  printf(1, "mkdir test ok\n");
 }
 
 void
 exectest(void)
 {
-  printf(stdout, "exec test\n");
+  printf(1, "exec test\n");
   if(exec("echo", echoargv) < 0){
-    printf(stdout, "exec echo failed\n");
+    printf(1, "exec echo failed\n");
     exit();
   }
 }
@@ -354,6 +360,414 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// resize a pipe's buffer with data in it, and wrap around it
+void
+pipesize(void)
+{
+  int fds[2], i, seq, rseq;
+
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(fcntl(fds[0], F_GETPIPE_SZ, 0) != 4096 ||
+     fcntl(fds[1], F_SETPIPE_SZ, 5000) != 8192){
+    printf(1, "pipesize: F_SETPIPE_SZ failed\n");
+    exit();
+  }
+  seq = rseq = 0;
+  for(i = 0; i < 8192; i++)
+    buf[i] = seq++;
+  if(write(fds[1], buf, 8192) != 8192){
+    printf(1, "pipesize: write failed\n");
+    exit();
+  }
+  if(fcntl(fds[1], F_SETPIPE_SZ, 4096) != -1){
+    printf(1, "pipesize: shrank a full pipe\n");
+    exit();
+  }
+  if(read(fds[0], buf, 3000) != 3000){
+    printf(1, "pipesize: read failed\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++)
+    if((buf[i] & 0xff) != (rseq++ & 0xff)){
+      printf(1, "pipesize: wrong data\n");
+      exit();
+    }
+  for(i = 0; i < 3000; i++)
+    buf[i] = seq++;
+  if(write(fds[1], buf, 3000) != 3000 ||
+     fcntl(fds[1], F_SETPIPE_SZ, 16384) != 16384 ||
+     read(fds[0], buf, sizeof(buf)) != 8192){
+    printf(1, "pipesize: wrap or grow failed\n");
+    exit();
+  }
+  for(i = 0; i < 8192; i++)
+    if((buf[i] & 0xff) != (rseq++ & 0xff)){
+      printf(1, "pipesize: wrong data after grow\n");
+      exit();
+    }
+  close(fds[0]);
+  close(fds[1]);
+  if(fcntl(1, F_GETPIPE_SZ, 0) != -1){
+    printf(1, "pipesize: F_GETPIPE_SZ on a non-pipe\n");
+    exit();
+  }
+  printf(1, "pipesize ok\n");
+}
+
+// splice a file into a pipe, that pipe into another,
+// and that one into a second file
+void
+splicetest(void)
+{
+  int a[2], b[2], fd, i;
+
+  for(i = 0; i < 3000; i++)
+    buf[i] = i;
+  fd = open("splice0", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+    printf(1, "splicetest: create failed\n");
+    exit();
+  }
+  close(fd);
+  if(pipe(a) != 0 || pipe(b) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  fd = open("splice0", O_RDONLY);
+  if(splice(fd, a[1], 5000) != 3000 || splice(fd, a[1], 5000) != 0){
+    printf(1, "splicetest: file to pipe failed\n");
+    exit();
+  }
+  close(fd);
+  if(splice(a[0], b[1], 5000) != 3000 || splice(a[0], a[1], 1) != -1){
+    printf(1, "splicetest: pipe to pipe failed\n");
+    exit();
+  }
+  fd = open("splice1", O_CREATE|O_RDWR);
+  if(splice(b[0], fd, 5000) != 3000){
+    printf(1, "splicetest: pipe to file failed\n");
+    exit();
+  }
+  close(fd);
+  memset(buf, 0, 3000);
+  fd = open("splice1", O_RDONLY);
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    printf(1, "splicetest: short file\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < 3000; i++)
+    if((buf[i] & 0xff) != (i & 0xff)){
+      printf(1, "splicetest: wrong data\n");
+      exit();
+    }
+  close(a[0]);
+  close(a[1]);
+  close(b[0]);
+  close(b[1]);
+  unlink("splice0");
+  unlink("splice1");
+  printf(1, "splicetest ok\n");
+}
+
+// sendfile from an offset into a file, then from the
+// source's own offset into a pipe
+void
+sendfiletest(void)
+{
+  int in, out, fds[2], i;
+
+  for(i = 0; i < 5000; i++)
+    buf[i] = i;
+  in = open("sendfile0", O_CREATE|O_RDWR);
+  if(in < 0 || write(in, buf, 5000) != 5000){
+    printf(1, "sendfiletest: create failed\n");
+    exit();
+  }
+  out = open("sendfile1", O_CREATE|O_RDWR);
+  if(sendfile(out, in, 100, 10000) != 4900 ||
+     sendfile(out, in, 5000, 10) != 0 || sendfile(in, in, -1, 10) != -1){
+    printf(1, "sendfiletest: file to file failed\n");
+    exit();
+  }
+  close(out);
+  memset(buf, 0, 5000);
+  out = open("sendfile1", O_RDONLY);
+  if(read(out, buf, sizeof(buf)) != 4900){
+    printf(1, "sendfiletest: short file\n");
+    exit();
+  }
+  close(out);
+  for(i = 0; i < 4900; i++)
+    if((buf[i] & 0xff) != ((i+100) & 0xff)){
+      printf(1, "sendfiletest: wrong data\n");
+      exit();
+    }
+
+  // in's offset is at 5000 after the write; move it back.
+  close(in);
+  in = open("sendfile0", O_RDONLY);
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(sendfile(fds[1], in, -1, 3000) != 3000 ||
+     read(in, buf, 1) != 1 || (buf[0] & 0xff) != (3000 & 0xff)){
+    printf(1, "sendfiletest: file to pipe failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  close(in);
+  unlink("sendfile0");
+  unlink("sendfile1");
+  printf(1, "sendfiletest ok\n");
+}
+
+// lseek, pread/pwrite and readv/writev
+void
+vectorio(void)
+{
+  struct iovec iov[3];
+  char a[10], b[10];
+  int fd, i;
+
+  for(i = 0; i < 3000; i++)
+    buf[i] = 'a' + i % 26;
+  fd = open("vectorio", O_CREATE|O_RDWR);
+  iov[0].iov_base = buf;
+  iov[0].iov_len = 10;
+  iov[1].iov_base = buf + 10;
+  iov[1].iov_len = 0;
+  iov[2].iov_base = buf + 10;
+  iov[2].iov_len = 2990;
+  if(fd < 0 || writev(fd, iov, 3) != 3000){
+    printf(1, "vectorio: writev failed\n");
+    exit();
+  }
+  if(lseek(fd, 0, SEEK_END) != 3000 || lseek(fd, 1, SEEK_END) != -1 ||
+     lseek(fd, -2990, SEEK_CUR) != 10){
+    printf(1, "vectorio: lseek failed\n");
+    exit();
+  }
+  iov[0].iov_base = a;
+  iov[0].iov_len = 10;
+  iov[1].iov_base = b;
+  iov[1].iov_len = 10;
+  if(readv(fd, iov, 2) != 20 || memcmp(a, buf + 10, 10) != 0 ||
+     memcmp(b, buf + 20, 10) != 0){
+    printf(1, "vectorio: readv failed\n");
+    exit();
+  }
+  // The pwrite() grows the file to 3001 bytes, so 6 are left
+  // to read from 2995.
+  if(pwrite(fd, "XYZ", 3, 2998) != 3 || pread(fd, a, 10, 2995) != 6 ||
+     memcmp(a, buf + 2995, 3) != 0 || memcmp(a + 3, "XYZ", 3) != 0){
+    printf(1, "vectorio: pread/pwrite failed\n");
+    exit();
+  }
+  // Neither moved the offset readv left.
+  if(read(fd, a, 1) != 1 || a[0] != buf[30]){
+    printf(1, "vectorio: offset moved\n");
+    exit();
+  }
+  close(fd);
+  unlink("vectorio");
+  printf(1, "vectorio ok\n");
+}
+
+struct ring ring;
+
+// open, write, fstat and close through a submission ring
+void
+ringtest(void)
+{
+  struct stat st;
+  struct sqe *e;
+  int i, fd, res[4];
+
+  if(ringenter(1) != -1 || ringsetup(&ring) < 0){
+    printf(1, "ringtest: ringsetup failed\n");
+    exit();
+  }
+  e = &ring.sq[ring.sqtail++ % RINGSIZE];
+  e->op = RING_OPEN;
+  e->buf = "ringtest";
+  e->n = O_CREATE|O_RDWR;
+  e->user = 0;
+  if(ringenter(8) != 1 || ring.cqtail != 1 || (fd = ring.cq[0].res) < 0){
+    printf(1, "ringtest: open failed\n");
+    exit();
+  }
+  ring.cqhead++;
+  for(i = 0; i < 3; i++){
+    e = &ring.sq[ring.sqtail++ % RINGSIZE];
+    e->fd = fd;
+    e->user = i;
+  }
+  ring.sq[1].op = RING_WRITE;
+  ring.sq[1].buf = "hello";
+  ring.sq[1].n = 5;
+  ring.sq[2].op = RING_FSTAT;
+  ring.sq[2].buf = &st;
+  ring.sq[3].op = 99;
+  if(ringenter(8) != 3 || ring.sqhead != 4 || ring.cqtail != 4){
+    printf(1, "ringtest: ringenter failed\n");
+    exit();
+  }
+  for(; ring.cqhead != ring.cqtail; ring.cqhead++)
+    res[ring.cq[ring.cqhead].user] = ring.cq[ring.cqhead].res;
+  if(res[0] != 5 || res[1] != 0 || st.size != 5 || res[2] != -1){
+    printf(1, "ringtest: wrong results\n");
+    exit();
+  }
+  close(fd);
+  unlink("ringtest");
+  printf(1, "ringtest ok\n");
+}
+
+// the pages in upage.h agree with getpid() and uptime(),
+// and cannot be written
+void
+upagetest(void)
+{
+  int pid, t;
+
+  pid = fork();
+  if(pid == 0){
+    if(ugetpid() != getpid()){
+      printf(1, "upagetest: wrong pid\n");
+      exit();
+    }
+    t = uptime();
+    if(uuptime() < t || uuptime() > t + 1){
+      printf(1, "upagetest: wrong ticks\n");
+      exit();
+    }
+    ((struct uproc*)UPROC)->pid = 0;
+    printf(1, "upagetest: wrote UPROC\n");
+    exit();
+  }
+  if(pid < 0 || ugetpid() != getpid() || wait() != pid){
+    printf(1, "upagetest failed\n");
+    exit();
+  }
+  printf(1, "upagetest ok\n");
+}
+
+// system calls that write to a page mprotect() made
+// read-only fail, rather than panic the kernel
+void
+rocopyout(void)
+{
+  char *p;
+  int fds[2];
+
+  p = sbrk(2*4096);
+  p = (char*)(((uint)p + 4095) & ~4095);
+  if(pipe(fds) < 0 || mprotect(p, 1) < 0){
+    printf(1, "rocopyout: setup failed\n");
+    exit();
+  }
+  write(fds[1], "x", 1);
+  if(fstat(0, (struct stat*)p) != -1 || pipe((int*)p) != -1 ||
+     kstat((struct kstat*)p) != -1 || read(fds[0], p, 1) != -1){
+    printf(1, "rocopyout: wrote a read-only page\n");
+    exit();
+  }
+  if(munprotect(p, 1) < 0 || fstat(0, (struct stat*)p) < 0){
+    printf(1, "rocopyout: munprotect failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  sbrk(-2*4096);
+  printf(1, "rocopyout ok\n");
+}
+
+// buffered streams write a file in one write(), read it
+// back, and are flushed before fork() so nothing is doubled
+void
+stdiotest(void)
+{
+  struct kstat a, b;
+  struct stat st;
+  FILE *f;
+  int i, pid;
+
+  kstat(&a);
+  if((f = fopen("stdiotest", "w")) == 0){
+    printf(1, "stdiotest: fopen failed\n");
+    exit();
+  }
+  for(i = 0; i < 1000; i++)
+    fputc('a' + i%26, f);
+  fprintf(f, "end %d\n", 42);
+  if(fclose(f) < 0){
+    printf(1, "stdiotest: fclose failed\n");
+    exit();
+  }
+  kstat(&b);
+  // a handful to open and close it, not one per byte
+  if(b.syscalls - a.syscalls > 12){
+    printf(1, "stdiotest: %d system calls\n", b.syscalls - a.syscalls);
+    exit();
+  }
+
+  if((f = fopen("stdiotest", "r")) == 0 || fread(buf, 1, 1000, f) != 1000){
+    printf(1, "stdiotest: fread failed\n");
+    exit();
+  }
+  for(i = 0; i < 1000; i++)
+    if(buf[i] != 'a' + i%26){
+      printf(1, "stdiotest: wrong data\n");
+      exit();
+    }
+  if(fgets(buf, 100, f) == 0 || strcmp(buf, "end 42\n") != 0 ||
+     fgetc(f) != -1 || !feof(f)){
+    printf(1, "stdiotest: fgets failed\n");
+    exit();
+  }
+  fclose(f);
+
+  if((f = fopen("stdiotest", "w")) == 0){
+    printf(1, "stdiotest: fopen failed\n");
+    exit();
+  }
+  fprintf(f, "once");
+  pid = fork();
+  if(pid == 0)
+    exit();
+  if(pid < 0 || wait() != pid){
+    printf(1, "stdiotest: fork failed\n");
+    exit();
+  }
+  fclose(f);
+  if(stat("stdiotest", &st) < 0 || st.size != 4){
+    printf(1, "stdiotest: fork doubled output\n");
+    exit();
+  }
+
+  // "w" empties the file itself, not just the name.
+  if(link("stdiotest", "stdiotest1") < 0 ||
+     (f = fopen("stdiotest1", "w")) == 0){
+    printf(1, "stdiotest: link failed\n");
+    exit();
+  }
+  fprintf(f, "x");
+  fclose(f);
+  if(stat("stdiotest", &st) < 0 || st.size != 1){
+    printf(1, "stdiotest: fopen did not truncate\n");
+    exit();
+  }
+  unlink("stdiotest1");
+  unlink("stdiotest");
+  printf(1, "stdiotest ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -1200,6 +1614,73 @@ bigfile(void)
   printf(1, "bigfile test ok\n");
 }
 
+// Write and read back an mb-MB file, reporting throughput.
+// Each 512-byte piece starts with its index.
+void
+bigfilemb(int mb)
+{
+  int fd, i, j, n, start, t;
+
+  printf(1, "bigfile %d MB test\n", mb);
+  n = mb * (1024*1024 / sizeof(buf));
+
+  unlink("bigfile");
+  fd = open("bigfile", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create bigfile\n");
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < n; i++){
+    for(j = 0; j < sizeof(buf)/512; j++)
+      ((int*)buf)[j*512/4] = i*(sizeof(buf)/512) + j;
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "write bigfile failed at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  t = uptime() - start;
+  printf(1, "bigfile write: %d KB in %d ticks", mb*1024, t);
+  if(t > 0)
+    printf(1, ", %d KB/s", mb*1024*100/t);
+  printf(1, "\n");
+
+  fd = open("bigfile", 0);
+  if(fd < 0){
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < n; i++){
+    if(read(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "read bigfile failed at %d\n", i);
+      exit();
+    }
+    for(j = 0; j < sizeof(buf)/512; j++)
+      if(((int*)buf)[j*512/4] != i*(sizeof(buf)/512) + j){
+        printf(1, "read bigfile wrong data at %d\n", i);
+        exit();
+      }
+  }
+  if(read(fd, buf, sizeof(buf)) != 0){
+    printf(1, "bigfile too long\n");
+    exit();
+  }
+  close(fd);
+  t = uptime() - start;
+  printf(1, "bigfile read: %d KB in %d ticks", mb*1024, t);
+  if(t > 0)
+    printf(1, ", %d KB/s", mb*1024*100/t);
+  printf(1, "\n");
+
+  if(unlink("bigfile") < 0){
+    printf(1, "unlink bigfile failed\n");
+    exit();
+  }
+  printf(1, "bigfile %d MB test ok\n", mb);
+}
+
 void
 fourteen(void)
 {
@@ -1347,7 +1828,7 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // the 50 was NINODE when inodes were not kept after use
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
@@ -1418,7 +1899,7 @@ sbrktest(void)
   char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
   uint amt;
 
-  printf(stdout, "sbrk test\n");
+  printf(1, "sbrk test\n");
   oldbrk = sbrk(0);
 
   // can one sbrk() less than a page?
@@ -1427,7 +1908,7 @@ sbrktest(void)
   for(i = 0; i < 5000; i++){
     b = sbrk(1);
     if(b != a){
-      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      printf(1, "sbrk test failed %d %x %x\n", i, a, b);
       exit();
     }
     *b = 1;
@@ -1435,13 +1916,13 @@ sbrktest(void)
   }
   pid = fork();
   if(pid < 0){
-    printf(stdout, "sbrk test fork failed\n");
+    printf(1, "sbrk test fork failed\n");
     exit();
   }
   c = sbrk(1);
   c = sbrk(1);
   if(c != a + 1){
-    printf(stdout, "sbrk test failed post-fork\n");
+    printf(1, "sbrk test failed post-fork\n");
     exit();
   }
   if(pid == 0)
@@ -1454,7 +1935,7 @@ sbrktest(void)
   amt = (BIG) - (uint)a;
   p = sbrk(amt);
   if (p != a) {
-    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    printf(1, "sbrk test failed to grow big address space; enough phys mem?\n");
     exit();
   }
   lastaddr = (char*) (BIG-1);
@@ -1464,12 +1945,12 @@ sbrktest(void)
   a = sbrk(0);
   c = sbrk(-4096);
   if(c == (char*)0xffffffff){
-    printf(stdout, "sbrk could not deallocate\n");
+    printf(1, "sbrk could not deallocate\n");
     exit();
   }
   c = sbrk(0);
   if(c != a - 4096){
-    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    printf(1, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
     exit();
   }
 
@@ -1477,19 +1958,19 @@ sbrktest(void)
   a = sbrk(0);
   c = sbrk(4096);
   if(c != a || sbrk(0) != a + 4096){
-    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    printf(1, "sbrk re-allocation failed, a %x c %x\n", a, c);
     exit();
   }
   if(*lastaddr == 99){
     // should be zero
-    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    printf(1, "sbrk de-allocation didn't really deallocate\n");
     exit();
   }
 
   a = sbrk(0);
   c = sbrk(-(sbrk(0) - oldbrk));
   if(c != a){
-    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    printf(1, "sbrk downsize failed, a %x c %x\n", a, c);
     exit();
   }
 
@@ -1498,11 +1979,11 @@ sbrktest(void)
     ppid = getpid();
     pid = fork();
     if(pid < 0){
-      printf(stdout, "fork failed\n");
+      printf(1, "fork failed\n");
       exit();
     }
     if(pid == 0){
-      printf(stdout, "oops could read %x = %x\n", a, *a);
+      printf(1, "oops could read %x = %x\n", a, *a);
       kill(ppid);
       exit();
     }
@@ -1536,14 +2017,14 @@ sbrktest(void)
     wait();
   }
   if(c == (char*)0xffffffff){
-    printf(stdout, "failed sbrk leaked memory\n");
+    printf(1, "failed sbrk leaked memory\n");
     exit();
   }
 
   if(sbrk(0) > oldbrk)
     sbrk(-(sbrk(0) - oldbrk));
 
-  printf(stdout, "sbrk test OK\n");
+  printf(1, "sbrk test OK\n");
 }
 
 void
@@ -1565,7 +2046,7 @@ validatetest(void)
   int hi, pid;
   uint p;
 
-  printf(stdout, "validate test\n");
+  printf(1, "validate test\n");
   hi = 1100*1024;
 
   for(p = 0; p <= (uint)hi; p += 4096){
@@ -1581,12 +2062,12 @@ validatetest(void)
 
     // try to crash the kernel by passing in a bad string pointer
     if(link("nosuchfile", (char*)p) != -1){
-      printf(stdout, "link should not succeed\n");
+      printf(1, "link should not succeed\n");
       exit();
     }
   }
 
-  printf(stdout, "validate ok\n");
+  printf(1, "validate ok\n");
 }
 
 // does unintialized data start out zero?
@@ -1596,14 +2077,14 @@ bsstest(void)
 {
   int i;
 
-  printf(stdout, "bss test\n");
+  printf(1, "bss test\n");
   for(i = 0; i < sizeof(uninit); i++){
     if(uninit[i] != '\0'){
-      printf(stdout, "bss test failed\n");
+      printf(1, "bss test failed\n");
       exit();
     }
   }
-  printf(stdout, "bss test ok\n");
+  printf(1, "bss test ok\n");
 }
 
 // does exec return an error if the arguments
@@ -1622,20 +2103,20 @@ bigargtest(void)
     for(i = 0; i < MAXARG-1; i++)
       args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
     args[MAXARG-1] = 0;
-    printf(stdout, "bigarg test\n");
+    printf(1, "bigarg test\n");
     exec("echo", args);
-    printf(stdout, "bigarg test ok\n");
+    printf(1, "bigarg test ok\n");
     fd = open("bigarg-ok", O_CREATE);
     close(fd);
     exit();
   } else if(pid < 0){
-    printf(stdout, "bigargtest: fork failed\n");
+    printf(1, "bigargtest: fork failed\n");
     exit();
   }
   wait();
   fd = open("bigarg-ok", 0);
   if(fd < 0){
-    printf(stdout, "bigarg test failed!\n");
+    printf(1, "bigarg test failed!\n");
     exit();
   }
   close(fd);
@@ -1737,6 +2218,42 @@ void argptest()
   printf(1, "arg test passed\n");
 }
 
+// does the disk queue account for every request it completes?
+void
+kstattest(void)
+{
+  struct kstat a, b;
+  int fd;
+
+  printf(1, "kstat test\n");
+  if(kstat(&a) < 0){
+    printf(1, "kstat failed\n");
+    exit();
+  }
+  fd = open("kstatfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "open kstatfile failed\n");
+    exit();
+  }
+  memset(buf, 'k', 512);
+  if(write(fd, buf, 512) != 512){
+    printf(1, "write kstatfile failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("kstatfile");
+  if(kstat(&b) < 0){
+    printf(1, "kstat failed\n");
+    exit();
+  }
+  if(b.disk_reqs <= a.disk_reqs || b.disk_cmds > b.disk_reqs ||
+     b.disk_cmds + b.disk_merged < b.disk_reqs){
+    printf(1, "kstat: bad disk counters\n");
+    exit();
+  }
+  printf(1, "kstat test ok\n");
+}
+
 unsigned long randstate = 1;
 unsigned int
 rand()
@@ -1750,6 +2267,15 @@ main(int argc, char *argv[])
 {
   printf(1, "usertests starting\n");
 
+  // "usertests bigfile" runs only the slow large-file tests,
+  // which go through double- and triple-indirect blocks.
+  if(argc > 1 && strcmp(argv[1], "bigfile") == 0){
+    bigfilemb(1);
+    bigfilemb(10);
+    bigfilemb(40);
+    exit();
+  }
+
   if(open("usertests.ran", 0) >= 0){
     printf(1, "already ran user tests -- rebuild fs.img\n");
     exit();
@@ -1781,6 +2307,14 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  pipesize();
+  splicetest();
+  sendfiletest();
+  vectorio();
+  ringtest();
+  upagetest();
+  rocopyout();
+  stdiotest();
   preempt();
   exitwait();
 
@@ -1796,6 +2330,7 @@ main(int argc, char *argv[])
   bigdir(); // slow
 
   uio();
+  kstattest();
 
   exectest();
 
@@ -0,0 +1,291 @@
+// Driver for a virtio-blk disk on the legacy PCI transport.
+// Provides the same interface as ide.c, for disk 1 only;
+// build with VIRTIO=1 to use it instead of the IDE driver.
+// Unlike the IDE controller, the device accepts many requests
+// at once, so every process calling iderw() gets its own slot
+// in the queue instead of waiting for the disk to go idle.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "kstat.h"
+#include "pci.h"
+
+#define SECTOR_SIZE   512
+
+// Legacy virtio PCI registers, in the I/O space of BAR0.
+#define VIO_DEVFEAT   0x00    // device features
+#define VIO_DRVFEAT   0x04    // driver (guest) features
+#define VIO_QPFN      0x08    // queue address, in pages
+#define VIO_QSIZE     0x0c    // queue size
+#define VIO_QSEL      0x0e    // queue select
+#define VIO_QNOTIFY   0x10    // queue notify
+#define VIO_STATUS    0x12    // device status
+#define VIO_ISR       0x13    // interrupt status; reading acknowledges
+#define VIO_CONFIG    0x14    // device-specific config
+
+#define VIO_ACK       0x01    // status: guest noticed the device
+#define VIO_DRIVER    0x02    // status: guest has a driver
+#define VIO_DRIVER_OK 0x04    // status: driver is ready
+#define VIO_FAILED    0x80    // status: driver gave up
+
+#define VIO_BLK_CAPACITY 0x00 // config: disk size in sectors (64 bits)
+
+// Ring descriptor.
+struct vdesc {
+  uint addr;        // physical address, low 32 bits
+  uint addrhi;      // high 32 bits, always 0 here
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VDESC_NEXT    1       // chained with next
+#define VDESC_WRITE   2       // device writes (vs reads)
+
+// Block request header, followed by the data and a status byte.
+struct vblkhdr {
+  uint type;
+  uint reserved;
+  uint sector;      // low 32 bits
+  uint sectorhi;
+};
+#define VBLK_IN       0       // read
+#define VBLK_OUT      1       // write
+
+// Largest queue the static ring memory below can hold; the
+// legacy transport lets the device pick the size.
+#define NVDESC        256
+
+static struct spinlock vlock;
+static ushort viobase;
+static uint vqsize;
+static uint capacity;
+static struct kstat viostats;
+
+// The ring: descriptor table and available ring, then, on
+// the next page boundary, the used ring.
+static char vqmem[3*PGSIZE] __attribute__((aligned(PGSIZE)));
+static struct vdesc *desc;
+static volatile ushort *avail;  // flags, idx, ring[vqsize]
+static volatile uint *used;     // flags and idx, then {id, len} pairs
+static ushort usedidx;          // next used entry to look at
+
+// Per-request state, indexed by the request's first descriptor.
+static struct {
+  struct vblkhdr hdr;
+  uchar status;
+  struct buf *b;
+  uint64 qtime;
+} req[NVDESC];
+static char descfree[NVDESC];
+
+int ideirq;
+
+void
+ideinit(void)
+{
+  struct pcidev *d;
+  uint i, n;
+
+  initlock(&vlock, "virtio");
+  if((d = pcifind(0x1af4, 0x1001)) == 0 || !(d->bar[0] & PCI_BAR_IO))
+    panic("virtio: no block device");
+  pcienable(d);
+  viobase = d->bar[0] & PCI_BAR_IOMASK;
+
+  // Reset and identify ourselves; we need no optional features.
+  outb(viobase+VIO_STATUS, 0);
+  outb(viobase+VIO_STATUS, VIO_ACK);
+  outb(viobase+VIO_STATUS, VIO_ACK | VIO_DRIVER);
+  inl(viobase+VIO_DEVFEAT);
+  outl(viobase+VIO_DRVFEAT, 0);
+
+  // Set up queue 0.
+  outw(viobase+VIO_QSEL, 0);
+  vqsize = inw(viobase+VIO_QSIZE);
+  n = 16*vqsize + 2*(3+vqsize);
+  n = PGROUNDUP(n) + 2*3 + 8*vqsize;
+  if(vqsize == 0 || vqsize > NVDESC || n > sizeof(vqmem)){
+    outb(viobase+VIO_STATUS, VIO_FAILED);
+    panic("virtio: queue size");
+  }
+  desc = (struct vdesc*)vqmem;
+  avail = (ushort*)(vqmem + 16*vqsize);
+  used = (uint*)(vqmem + PGROUNDUP(16*vqsize + 2*(3+vqsize)));
+  for(i = 0; i < vqsize; i++)
+    descfree[i] = 1;
+  outl(viobase+VIO_QPFN, V2P(vqmem) / PGSIZE);
+
+  capacity = inl(viobase+VIO_CONFIG+VIO_BLK_CAPACITY);
+  if(inl(viobase+VIO_CONFIG+VIO_BLK_CAPACITY+4) != 0)
+    capacity = 0xffffffff;
+
+  outb(viobase+VIO_STATUS, VIO_ACK | VIO_DRIVER | VIO_DRIVER_OK);
+
+  ideirq = d->irq;
+  ioapicenable(ideirq, ncpu - 1);
+  viostats.disk_dma = 1;
+}
+
+// Allocate a chain of three descriptors, returning the
+// first, or -1 if the ring is full.  Caller holds vlock.
+static int
+descalloc(void)
+{
+  int i, n, idx[3];
+
+  n = 0;
+  for(i = 0; i < vqsize && n < 3; i++)
+    if(descfree[i])
+      idx[n++] = i;
+  if(n < 3)
+    return -1;
+  for(i = 0; i < 3; i++){
+    descfree[idx[i]] = 0;
+    desc[idx[i]].flags = i < 2 ? VDESC_NEXT : 0;
+    desc[idx[i]].next = i < 2 ? idx[i+1] : 0;
+  }
+  return idx[0];
+}
+
+static void
+descfreechain(int i)
+{
+  for(;;){
+    descfree[i] = 1;
+    if(!(desc[i].flags & VDESC_NEXT))
+      break;
+    i = desc[i].next;
+  }
+  wakeup(descfree);
+}
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+  struct buf *b;
+  uint id;
+  uint64 lat;
+
+  acquire(&vlock);
+  // Acknowledge first, so that a completion after this
+  // raises a fresh interrupt.
+  inb(viobase+VIO_ISR);
+  __sync_synchronize();
+  while(usedidx != (used[0] >> 16)){
+    id = used[1 + 2*(usedidx % vqsize)];
+    usedidx++;
+    b = req[id].b;
+    if(req[id].status != 0)
+      panic("virtio: request failed");
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+
+    lat = (rdtsc() - req[id].qtime) >> KSTAT_CYCSHIFT;
+    viostats.disk_lat += lat;
+    if(lat > viostats.disk_latmax)
+      viostats.disk_latmax = lat;
+    viostats.disk_qdepth--;
+    req[id].b = 0;
+    descfreechain(id);
+  }
+  release(&vlock);
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  int i, sector_per_block = BSIZE/SECTOR_SIZE;
+  struct vdesc *d;
+  ushort a;
+
+  if(!holdingsleep(&b->lock))
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+  if(b->dev != 1)
+    panic("iderw: request not for disk 1");
+  if(b->blockno >= idesize(b->dev))
+    panic("iderw: block out of range");
+
+  acquire(&vlock);
+  while((i = descalloc()) < 0)
+    sleep(descfree, &vlock);
+
+  req[i].hdr.type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+  req[i].hdr.reserved = 0;
+  req[i].hdr.sector = b->blockno * sector_per_block;
+  req[i].hdr.sectorhi = 0;
+  req[i].status = 0xff;
+  req[i].b = b;
+  req[i].qtime = rdtsc();
+
+  d = &desc[i];
+  d->addr = V2P(&req[i].hdr);
+  d->addrhi = 0;
+  d->len = sizeof(req[i].hdr);
+  d = &desc[d->next];
+  d->addr = V2P(b->data);
+  d->addrhi = 0;
+  d->len = BSIZE;
+  if(!(b->flags & B_DIRTY))
+    d->flags |= VDESC_WRITE;
+  d = &desc[d->next];
+  d->addr = V2P(&req[i].status);
+  d->addrhi = 0;
+  d->len = 1;
+  d->flags = VDESC_WRITE;
+
+  // Publish the chain, then tell the device.
+  a = avail[1];
+  avail[2 + a % vqsize] = i;
+  __sync_synchronize();
+  avail[1] = a + 1;
+  __sync_synchronize();
+  outw(viobase+VIO_QNOTIFY, 0);
+
+  viostats.disk_reqs++;
+  viostats.disk_cmds++;
+  viostats.disk_sectors += sector_per_block;
+  viostats.disk_qdepth++;
+  viostats.disk_qsum += viostats.disk_qdepth;
+  if(viostats.disk_qdepth > viostats.disk_qmax)
+    viostats.disk_qmax = viostats.disk_qdepth;
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &vlock);
+  release(&vlock);
+}
+
+// Report queue statistics.
+void
+idestat(struct kstat *st)
+{
+  acquire(&vlock);
+  *st = viostats;
+  release(&vlock);
+}
+
+// Size of disk dev, in blocks.
+uint
+idesize(int dev)
+{
+  if(dev != 1)
+    return 0;
+  return capacity / (BSIZE/SECTOR_SIZE);
+}
@@ -6,9 +6,12 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "upage.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+extern void sysentry(void);  // in trapasm.S
+static int sysenter;  // CPU has sysenter
 
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
@@ -16,6 +19,7 @@ void
 seginit(void)
 {
   struct cpu *c;
+  uint a, b, cx, d;
 
   // Map "logical" addresses to virtual addresses using identity map.
   // Cannot share a CODE descriptor for both kernel and user
@@ -27,6 +31,15 @@ seginit(void)
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
   lgdt(c->gdt, sizeof(c->gdt));
+
+  // System calls can also enter with sysenter.  switchuvm()
+  // points its stack at each process's kernel stack.
+  cpuinfo(1, &a, &b, &cx, &d);
+  if(d & CPUID_SEP){
+    sysenter = 1;
+    wrmsr(MSR_SYSENTER_CS, SEG_KCODE<<3);
+    wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+  }
 }
 
 // Return the address of the PTE in page table pgdir
@@ -178,6 +191,8 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
+  if(sysenter)
+    wrmsr(MSR_SYSENTER_ESP, (uint)p->kstack + KSTACKSIZE);
   lcr3(V2P(p->pgdir));  // switch to process's address space
   popcli();
 }
@@ -231,7 +246,7 @@ allocuvm(pde_t *pgdir, uint vbase, uint oldvlimit, uint newvlimit)
   char *mem;
   uint a;
 
-  if(newvlimit >= KERNBASE)
+  if(newvlimit > UPROC)
     return 0;
   if(newvlimit < oldvlimit)
     return oldvlimit;
@@ -294,7 +309,7 @@ freevm(pde_t *pgdir)
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
-  deallocuvm(pgdir, KERNBASE, 0);
+  deallocuvm(pgdir, UPROC, 0);  // not the pages in upage.h
   for(i = 0; i < NPDENTRIES; i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
@@ -304,6 +319,17 @@ freevm(pde_t *pgdir)
   kfree((char*)pgdir);
 }
 
+// Map the pages described in upage.h into pgdir, read-only:
+// the process's own uproc page, and the shared uticks page.
+int
+mapupages(pde_t *pgdir, char *uproc)
+{
+  if(mappages(pgdir, (void*)UPROC, PGSIZE, V2P(uproc), PTE_U) < 0 ||
+     mappages(pgdir, (void*)UTICKS, PGSIZE, V2P(uticks), PTE_U) < 0)
+    return -1;
+  return 0;
+}
+
 // Clear PTE_U on a page. Used to create an inaccessible
 // page beneath the user stack.
 void
@@ -367,10 +393,11 @@ uva2ka(pde_t *pgdir, char *uva)
 }
 
 // Copy len bytes from p to user address va in page table pgdir.
-// Most useful when pgdir is not the current page table.
+// For when pgdir is not the current page table; otherwise
+// use copyout().
 // uva2ka ensures this only works for PTE_U pages.
 int
-copyout(pde_t *pgdir, uint va, void *p, uint len)
+copyoutvm(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
@@ -392,6 +419,54 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return 0;
 }
 
+//PAGEBREAK!
+// Copying to and from the current process.  The user range is
+// checked against the process's bounds once; then ucopy() in
+// copy.S moves it a word at a time, and returns -1 rather
+// than panicking if a page turns out to be missing.
+
+// Is [addr, addr+n) within the current process's memory?
+int
+uvalid(uint addr, uint n)
+{
+  struct proc *p = myproc();
+
+  return addr >= p->vbase && addr < p->vlimit &&
+    addr + n <= p->vlimit && addr + n >= addr;
+}
+
+// Copy n bytes from user address src to dst.
+int
+copyin(void *dst, uint src, uint n)
+{
+  if(!uvalid(src, n))
+    return -1;
+  return ucopy(dst, (void*)src, n);
+}
+
+// Copy n bytes from src to user address dst.
+int
+copyout(uint dst, void *src, uint n)
+{
+  if(!uvalid(dst, n))
+    return -1;
+  return ucopy((void*)dst, src, n);
+}
+
+// Copy the nul-terminated string at user address src to dst,
+// which holds max bytes.  Returns its length.
+int
+copystr(char *dst, uint src, uint max)
+{
+  struct proc *p = myproc();
+
+  if(!uvalid(src, 1))
+    return -1;
+  if(max > p->vlimit - src)
+    max = p->vlimit - src;
+  return ucopystr(dst, (char*)src, max);
+}
+
 int
 mprotect(void *addr, int len){
     pte_t *pte;
@@ -0,0 +1,2830 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	57                   	push   %edi
+    100e:	56                   	push   %esi
+    100f:	be 01 00 00 00       	mov    $0x1,%esi
+    1014:	53                   	push   %ebx
+    1015:	51                   	push   %ecx
+    1016:	83 ec 18             	sub    $0x18,%esp
+    1019:	8b 01                	mov    (%ecx),%eax
+    101b:	8b 59 04             	mov    0x4(%ecx),%ebx
+    101e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1021:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+    1024:	83 f8 01             	cmp    $0x1,%eax
+    1027:	7f 28                	jg     1051 <main+0x51>
+    1029:	eb 54                	jmp    107f <main+0x7f>
+    102b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    102f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+    1030:	83 ec 08             	sub    $0x8,%esp
+    1033:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+    1035:	83 c6 01             	add    $0x1,%esi
+    1038:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+    103b:	50                   	push   %eax
+    103c:	e8 5f 00 00 00       	call   10a0 <wc>
+    close(fd);
+    1041:	89 3c 24             	mov    %edi,(%esp)
+    1044:	e8 b5 04 00 00       	call   14fe <close>
+  for(i = 1; i < argc; i++){
+    1049:	83 c4 10             	add    $0x10,%esp
+    104c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+    104f:	74 29                	je     107a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+    1051:	83 ec 08             	sub    $0x8,%esp
+    1054:	6a 00                	push   $0x0
+    1056:	ff 33                	push   (%ebx)
+    1058:	e8 ce 04 00 00       	call   152b <open>
+    105d:	83 c4 10             	add    $0x10,%esp
+    1060:	89 c7                	mov    %eax,%edi
+    1062:	85 c0                	test   %eax,%eax
+    1064:	79 ca                	jns    1030 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+    1066:	50                   	push   %eax
+    1067:	ff 33                	push   (%ebx)
+    1069:	68 ab 23 00 00       	push   $0x23ab
+    106e:	6a 01                	push   $0x1
+    1070:	e8 5b 09 00 00       	call   19d0 <printf>
+      exit();
+    1075:	e8 e6 03 00 00       	call   1460 <exit>
+  }
+  exit();
+    107a:	e8 e1 03 00 00       	call   1460 <exit>
+    wc(0, "");
+    107f:	52                   	push   %edx
+    1080:	52                   	push   %edx
+    1081:	68 9d 23 00 00       	push   $0x239d
+    1086:	6a 00                	push   $0x0
+    1088:	e8 13 00 00 00       	call   10a0 <wc>
+    exit();
+    108d:	e8 ce 03 00 00       	call   1460 <exit>
+    1092:	66 90                	xchg   %ax,%ax
+    1094:	66 90                	xchg   %ax,%ax
+    1096:	66 90                	xchg   %ax,%ax
+    1098:	66 90                	xchg   %ax,%ax
+    109a:	66 90                	xchg   %ax,%ax
+    109c:	66 90                	xchg   %ax,%ax
+    109e:	66 90                	xchg   %ax,%ax
+
+000010a0 <wc>:
+{
+    10a0:	55                   	push   %ebp
+  l = w = c = 0;
+    10a1:	31 d2                	xor    %edx,%edx
+{
+    10a3:	89 e5                	mov    %esp,%ebp
+    10a5:	57                   	push   %edi
+    10a6:	56                   	push   %esi
+  inword = 0;
+    10a7:	31 f6                	xor    %esi,%esi
+{
+    10a9:	53                   	push   %ebx
+  l = w = c = 0;
+    10aa:	31 db                	xor    %ebx,%ebx
+{
+    10ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+    10af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    10b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    10b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    10c0:	83 ec 04             	sub    $0x4,%esp
+    10c3:	68 00 02 00 00       	push   $0x200
+    10c8:	68 60 2d 00 00       	push   $0x2d60
+    10cd:	ff 75 08             	push   0x8(%ebp)
+    10d0:	e8 0b 04 00 00       	call   14e0 <read>
+    10d5:	83 c4 10             	add    $0x10,%esp
+    10d8:	89 c1                	mov    %eax,%ecx
+    10da:	85 c0                	test   %eax,%eax
+    10dc:	7e 62                	jle    1140 <wc+0xa0>
+    for(i=0; i<n; i++){
+    10de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    10e1:	31 ff                	xor    %edi,%edi
+    10e3:	eb 0d                	jmp    10f2 <wc+0x52>
+    10e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+    10e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+    10ea:	83 c7 01             	add    $0x1,%edi
+    10ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    10f0:	74 3e                	je     1130 <wc+0x90>
+      if(buf[i] == '\n')
+    10f2:	0f be 87 60 2d 00 00 	movsbl 0x2d60(%edi),%eax
+        l++;
+    10f9:	31 c9                	xor    %ecx,%ecx
+    10fb:	3c 0a                	cmp    $0xa,%al
+    10fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+    1100:	83 ec 08             	sub    $0x8,%esp
+    1103:	50                   	push   %eax
+        l++;
+    1104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+    1106:	68 88 23 00 00       	push   $0x2388
+    110b:	e8 50 01 00 00       	call   1260 <strchr>
+    1110:	83 c4 10             	add    $0x10,%esp
+    1113:	85 c0                	test   %eax,%eax
+    1115:	75 d1                	jne    10e8 <wc+0x48>
+      else if(!inword){
+    1117:	85 f6                	test   %esi,%esi
+    1119:	75 cf                	jne    10ea <wc+0x4a>
+        w++;
+    111b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+    111f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+    1124:	83 c7 01             	add    $0x1,%edi
+    1127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    112a:	75 c6                	jne    10f2 <wc+0x52>
+    112c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+    1130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+    1136:	eb 88                	jmp    10c0 <wc+0x20>
+    1138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113f:	90                   	nop
+  if(n < 0){
+    1140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1143:	75 22                	jne    1167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+    1145:	83 ec 08             	sub    $0x8,%esp
+    1148:	ff 75 0c             	push   0xc(%ebp)
+    114b:	52                   	push   %edx
+    114c:	ff 75 e0             	push   -0x20(%ebp)
+    114f:	53                   	push   %ebx
+    1150:	68 9e 23 00 00       	push   $0x239e
+    1155:	6a 01                	push   $0x1
+    1157:	e8 74 08 00 00       	call   19d0 <printf>
+}
+    115c:	83 c4 20             	add    $0x20,%esp
+    115f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1162:	5b                   	pop    %ebx
+    1163:	5e                   	pop    %esi
+    1164:	5f                   	pop    %edi
+    1165:	5d                   	pop    %ebp
+    1166:	c3                   	ret
+    printf(1, "wc: read error\n");
+    1167:	50                   	push   %eax
+    1168:	50                   	push   %eax
+    1169:	68 8e 23 00 00       	push   $0x238e
+    116e:	6a 01                	push   $0x1
+    1170:	e8 5b 08 00 00       	call   19d0 <printf>
+    exit();
+    1175:	e8 e6 02 00 00       	call   1460 <exit>
+    117a:	66 90                	xchg   %ax,%ax
+    117c:	66 90                	xchg   %ax,%ax
+    117e:	66 90                	xchg   %ax,%ax
+
+00001180 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1181:	31 c0                	xor    %eax,%eax
+{
+    1183:	89 e5                	mov    %esp,%ebp
+    1185:	53                   	push   %ebx
+    1186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    118c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1197:	83 c0 01             	add    $0x1,%eax
+    119a:	84 d2                	test   %dl,%dl
+    119c:	75 f2                	jne    1190 <strcpy+0x10>
+    ;
+  return os;
+}
+    119e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11a1:	89 c8                	mov    %ecx,%eax
+    11a3:	c9                   	leave
+    11a4:	c3                   	ret
+    11a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	53                   	push   %ebx
+    11b4:	8b 55 08             	mov    0x8(%ebp),%edx
+    11b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    11ba:	0f b6 02             	movzbl (%edx),%eax
+    11bd:	84 c0                	test   %al,%al
+    11bf:	75 17                	jne    11d8 <strcmp+0x28>
+    11c1:	eb 3a                	jmp    11fd <strcmp+0x4d>
+    11c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11c7:	90                   	nop
+    11c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    11cc:	83 c2 01             	add    $0x1,%edx
+    11cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    11d2:	84 c0                	test   %al,%al
+    11d4:	74 1a                	je     11f0 <strcmp+0x40>
+    p++, q++;
+    11d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    11d8:	0f b6 19             	movzbl (%ecx),%ebx
+    11db:	38 c3                	cmp    %al,%bl
+    11dd:	74 e9                	je     11c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    11df:	29 d8                	sub    %ebx,%eax
+}
+    11e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11e4:	c9                   	leave
+    11e5:	c3                   	ret
+    11e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    11f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    11f4:	31 c0                	xor    %eax,%eax
+    11f6:	29 d8                	sub    %ebx,%eax
+}
+    11f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11fb:	c9                   	leave
+    11fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    11fd:	0f b6 19             	movzbl (%ecx),%ebx
+    1200:	31 c0                	xor    %eax,%eax
+    1202:	eb db                	jmp    11df <strcmp+0x2f>
+    1204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+
+00001210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1216:	80 3a 00             	cmpb   $0x0,(%edx)
+    1219:	74 15                	je     1230 <strlen+0x20>
+    121b:	31 c0                	xor    %eax,%eax
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+    1220:	83 c0 01             	add    $0x1,%eax
+    1223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1227:	89 c1                	mov    %eax,%ecx
+    1229:	75 f5                	jne    1220 <strlen+0x10>
+    ;
+  return n;
+}
+    122b:	89 c8                	mov    %ecx,%eax
+    122d:	5d                   	pop    %ebp
+    122e:	c3                   	ret
+    122f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1230:	31 c9                	xor    %ecx,%ecx
+}
+    1232:	5d                   	pop    %ebp
+    1233:	89 c8                	mov    %ecx,%eax
+    1235:	c3                   	ret
+    1236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    124a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    124d:	89 d7                	mov    %edx,%edi
+    124f:	fc                   	cld
+    1250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1255:	89 d0                	mov    %edx,%eax
+    1257:	c9                   	leave
+    1258:	c3                   	ret
+    1259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	8b 45 08             	mov    0x8(%ebp),%eax
+    1266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    126a:	0f b6 10             	movzbl (%eax),%edx
+    126d:	84 d2                	test   %dl,%dl
+    126f:	75 12                	jne    1283 <strchr+0x23>
+    1271:	eb 1d                	jmp    1290 <strchr+0x30>
+    1273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1277:	90                   	nop
+    1278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    127c:	83 c0 01             	add    $0x1,%eax
+    127f:	84 d2                	test   %dl,%dl
+    1281:	74 0d                	je     1290 <strchr+0x30>
+    if(*s == c)
+    1283:	38 d1                	cmp    %dl,%cl
+    1285:	75 f1                	jne    1278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1287:	5d                   	pop    %ebp
+    1288:	c3                   	ret
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1290:	31 c0                	xor    %eax,%eax
+}
+    1292:	5d                   	pop    %ebp
+    1293:	c3                   	ret
+    1294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+
+000012a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	57                   	push   %edi
+    12a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    12a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    12a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    12a9:	31 db                	xor    %ebx,%ebx
+{
+    12ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    12ae:	eb 27                	jmp    12d7 <gets+0x37>
+    cc = read(0, &c, 1);
+    12b0:	83 ec 04             	sub    $0x4,%esp
+    12b3:	6a 01                	push   $0x1
+    12b5:	56                   	push   %esi
+    12b6:	6a 00                	push   $0x0
+    12b8:	e8 23 02 00 00       	call   14e0 <read>
+    if(cc < 1)
+    12bd:	83 c4 10             	add    $0x10,%esp
+    12c0:	85 c0                	test   %eax,%eax
+    12c2:	7e 1d                	jle    12e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    12c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    12c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    12cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    12cf:	3c 0a                	cmp    $0xa,%al
+    12d1:	74 10                	je     12e3 <gets+0x43>
+    12d3:	3c 0d                	cmp    $0xd,%al
+    12d5:	74 0c                	je     12e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    12d7:	89 df                	mov    %ebx,%edi
+    12d9:	83 c3 01             	add    $0x1,%ebx
+    12dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    12df:	7c cf                	jl     12b0 <gets+0x10>
+    12e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    12e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    12ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12ed:	5b                   	pop    %ebx
+    12ee:	5e                   	pop    %esi
+    12ef:	5f                   	pop    %edi
+    12f0:	5d                   	pop    %ebp
+    12f1:	c3                   	ret
+    12f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	56                   	push   %esi
+    1304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1305:	83 ec 08             	sub    $0x8,%esp
+    1308:	6a 00                	push   $0x0
+    130a:	ff 75 08             	push   0x8(%ebp)
+    130d:	e8 19 02 00 00       	call   152b <open>
+  if(fd < 0)
+    1312:	83 c4 10             	add    $0x10,%esp
+    1315:	85 c0                	test   %eax,%eax
+    1317:	78 27                	js     1340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1319:	83 ec 08             	sub    $0x8,%esp
+    131c:	ff 75 0c             	push   0xc(%ebp)
+    131f:	89 c3                	mov    %eax,%ebx
+    1321:	50                   	push   %eax
+    1322:	e8 31 02 00 00       	call   1558 <fstat>
+  close(fd);
+    1327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    132a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    132c:	e8 cd 01 00 00       	call   14fe <close>
+  return r;
+    1331:	83 c4 10             	add    $0x10,%esp
+}
+    1334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1337:	89 f0                	mov    %esi,%eax
+    1339:	5b                   	pop    %ebx
+    133a:	5e                   	pop    %esi
+    133b:	5d                   	pop    %ebp
+    133c:	c3                   	ret
+    133d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1345:	eb ed                	jmp    1334 <stat+0x34>
+    1347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134e:	66 90                	xchg   %ax,%ax
+
+00001350 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	53                   	push   %ebx
+    1354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1357:	0f be 02             	movsbl (%edx),%eax
+    135a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    135d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1365:	77 1e                	ja     1385 <atoi+0x35>
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1370:	83 c2 01             	add    $0x1,%edx
+    1373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    137a:	0f be 02             	movsbl (%edx),%eax
+    137d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1380:	80 fb 09             	cmp    $0x9,%bl
+    1383:	76 eb                	jbe    1370 <atoi+0x20>
+  return n;
+}
+    1385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1388:	89 c8                	mov    %ecx,%eax
+    138a:	c9                   	leave
+    138b:	c3                   	ret
+    138c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1390:	55                   	push   %ebp
+    1391:	89 e5                	mov    %esp,%ebp
+    1393:	57                   	push   %edi
+    1394:	56                   	push   %esi
+    1395:	8b 45 10             	mov    0x10(%ebp),%eax
+    1398:	8b 55 08             	mov    0x8(%ebp),%edx
+    139b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    139e:	85 c0                	test   %eax,%eax
+    13a0:	7e 13                	jle    13b5 <memmove+0x25>
+    13a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    13a4:	89 d7                	mov    %edx,%edi
+    13a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    13b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    13b1:	39 f8                	cmp    %edi,%eax
+    13b3:	75 fb                	jne    13b0 <memmove+0x20>
+  return vdst;
+}
+    13b5:	5e                   	pop    %esi
+    13b6:	89 d0                	mov    %edx,%eax
+    13b8:	5f                   	pop    %edi
+    13b9:	5d                   	pop    %ebp
+    13ba:	c3                   	ret
+    13bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13bf:	90                   	nop
+
+000013c0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	56                   	push   %esi
+    13c4:	53                   	push   %ebx
+    13c5:	8b 75 10             	mov    0x10(%ebp),%esi
+    13c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    13cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    13ce:	85 f6                	test   %esi,%esi
+    13d0:	74 2e                	je     1400 <memcmp+0x40>
+    13d2:	01 c6                	add    %eax,%esi
+    13d4:	eb 14                	jmp    13ea <memcmp+0x2a>
+    13d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    13e0:	83 c0 01             	add    $0x1,%eax
+    13e3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    13e6:	39 f0                	cmp    %esi,%eax
+    13e8:	74 16                	je     1400 <memcmp+0x40>
+    if(*s1 != *s2)
+    13ea:	0f b6 0a             	movzbl (%edx),%ecx
+    13ed:	0f b6 18             	movzbl (%eax),%ebx
+    13f0:	38 d9                	cmp    %bl,%cl
+    13f2:	74 ec                	je     13e0 <memcmp+0x20>
+      return *s1 - *s2;
+    13f4:	0f b6 c1             	movzbl %cl,%eax
+    13f7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    13f9:	5b                   	pop    %ebx
+    13fa:	5e                   	pop    %esi
+    13fb:	5d                   	pop    %ebp
+    13fc:	c3                   	ret
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+    1400:	5b                   	pop    %ebx
+  return 0;
+    1401:	31 c0                	xor    %eax,%eax
+}
+    1403:	5e                   	pop    %esi
+    1404:	5d                   	pop    %ebp
+    1405:	c3                   	ret
+    1406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001410 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    1410:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    1415:	c3                   	ret
+    1416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001420 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    1420:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    1425:	c3                   	ret
+    1426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001430 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    1430:	a1 60 2f 00 00       	mov    0x2f60,%eax
+    1435:	85 c0                	test   %eax,%eax
+    1437:	74 17                	je     1450 <fork+0x20>
+{
+    1439:	55                   	push   %ebp
+    143a:	89 e5                	mov    %esp,%ebp
+    143c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    143f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1441:	c9                   	leave
+  return _fork();
+    1442:	e9 5d 00 00 00       	jmp    14a4 <_fork>
+    1447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144e:	66 90                	xchg   %ax,%ax
+    1450:	e9 4f 00 00 00       	jmp    14a4 <_fork>
+    1455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001460 <exit>:
+
+int
+exit(void)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1466:	a1 60 2f 00 00       	mov    0x2f60,%eax
+    146b:	85 c0                	test   %eax,%eax
+    146d:	74 02                	je     1471 <exit+0x11>
+    flushhook();
+    146f:	ff d0                	call   *%eax
+  _exit();
+    1471:	e8 3d 00 00 00       	call   14b3 <_exit>
+    1476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001480 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1480:	55                   	push   %ebp
+  if(flushhook)
+    1481:	a1 60 2f 00 00       	mov    0x2f60,%eax
+{
+    1486:	89 e5                	mov    %esp,%ebp
+    1488:	56                   	push   %esi
+    1489:	53                   	push   %ebx
+    148a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    148d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1490:	85 c0                	test   %eax,%eax
+    1492:	74 02                	je     1496 <exec+0x16>
+    flushhook();
+    1494:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1496:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1499:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    149c:	5b                   	pop    %ebx
+    149d:	5e                   	pop    %esi
+    149e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    149f:	e9 78 00 00 00       	jmp    151c <_exec>
+
+000014a4 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    14a4:	b8 01 00 00 00       	mov    $0x1,%eax
+    14a9:	89 e1                	mov    %esp,%ecx
+    14ab:	ba b2 14 00 00       	mov    $0x14b2,%edx
+    14b0:	0f 34                	sysenter
+    14b2:	c3                   	ret
+
+000014b3 <_exit>:
+RAWSYSCALL(exit)
+    14b3:	b8 02 00 00 00       	mov    $0x2,%eax
+    14b8:	89 e1                	mov    %esp,%ecx
+    14ba:	ba c1 14 00 00       	mov    $0x14c1,%edx
+    14bf:	0f 34                	sysenter
+    14c1:	c3                   	ret
+
+000014c2 <wait>:
+SYSCALL(wait)
+    14c2:	b8 03 00 00 00       	mov    $0x3,%eax
+    14c7:	89 e1                	mov    %esp,%ecx
+    14c9:	ba d0 14 00 00       	mov    $0x14d0,%edx
+    14ce:	0f 34                	sysenter
+    14d0:	c3                   	ret
+
+000014d1 <pipe>:
+SYSCALL(pipe)
+    14d1:	b8 04 00 00 00       	mov    $0x4,%eax
+    14d6:	89 e1                	mov    %esp,%ecx
+    14d8:	ba df 14 00 00       	mov    $0x14df,%edx
+    14dd:	0f 34                	sysenter
+    14df:	c3                   	ret
+
+000014e0 <read>:
+SYSCALL(read)
+    14e0:	b8 05 00 00 00       	mov    $0x5,%eax
+    14e5:	89 e1                	mov    %esp,%ecx
+    14e7:	ba ee 14 00 00       	mov    $0x14ee,%edx
+    14ec:	0f 34                	sysenter
+    14ee:	c3                   	ret
+
+000014ef <write>:
+SYSCALL(write)
+    14ef:	b8 10 00 00 00       	mov    $0x10,%eax
+    14f4:	89 e1                	mov    %esp,%ecx
+    14f6:	ba fd 14 00 00       	mov    $0x14fd,%edx
+    14fb:	0f 34                	sysenter
+    14fd:	c3                   	ret
+
+000014fe <close>:
+SYSCALL(close)
+    14fe:	b8 15 00 00 00       	mov    $0x15,%eax
+    1503:	89 e1                	mov    %esp,%ecx
+    1505:	ba 0c 15 00 00       	mov    $0x150c,%edx
+    150a:	0f 34                	sysenter
+    150c:	c3                   	ret
+
+0000150d <kill>:
+SYSCALL(kill)
+    150d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1512:	89 e1                	mov    %esp,%ecx
+    1514:	ba 1b 15 00 00       	mov    $0x151b,%edx
+    1519:	0f 34                	sysenter
+    151b:	c3                   	ret
+
+0000151c <_exec>:
+RAWSYSCALL(exec)
+    151c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1521:	89 e1                	mov    %esp,%ecx
+    1523:	ba 2a 15 00 00       	mov    $0x152a,%edx
+    1528:	0f 34                	sysenter
+    152a:	c3                   	ret
+
+0000152b <open>:
+SYSCALL(open)
+    152b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1530:	89 e1                	mov    %esp,%ecx
+    1532:	ba 39 15 00 00       	mov    $0x1539,%edx
+    1537:	0f 34                	sysenter
+    1539:	c3                   	ret
+
+0000153a <mknod>:
+SYSCALL(mknod)
+    153a:	b8 11 00 00 00       	mov    $0x11,%eax
+    153f:	89 e1                	mov    %esp,%ecx
+    1541:	ba 48 15 00 00       	mov    $0x1548,%edx
+    1546:	0f 34                	sysenter
+    1548:	c3                   	ret
+
+00001549 <unlink>:
+SYSCALL(unlink)
+    1549:	b8 12 00 00 00       	mov    $0x12,%eax
+    154e:	89 e1                	mov    %esp,%ecx
+    1550:	ba 57 15 00 00       	mov    $0x1557,%edx
+    1555:	0f 34                	sysenter
+    1557:	c3                   	ret
+
+00001558 <fstat>:
+SYSCALL(fstat)
+    1558:	b8 08 00 00 00       	mov    $0x8,%eax
+    155d:	89 e1                	mov    %esp,%ecx
+    155f:	ba 66 15 00 00       	mov    $0x1566,%edx
+    1564:	0f 34                	sysenter
+    1566:	c3                   	ret
+
+00001567 <link>:
+SYSCALL(link)
+    1567:	b8 13 00 00 00       	mov    $0x13,%eax
+    156c:	89 e1                	mov    %esp,%ecx
+    156e:	ba 75 15 00 00       	mov    $0x1575,%edx
+    1573:	0f 34                	sysenter
+    1575:	c3                   	ret
+
+00001576 <mkdir>:
+SYSCALL(mkdir)
+    1576:	b8 14 00 00 00       	mov    $0x14,%eax
+    157b:	89 e1                	mov    %esp,%ecx
+    157d:	ba 84 15 00 00       	mov    $0x1584,%edx
+    1582:	0f 34                	sysenter
+    1584:	c3                   	ret
+
+00001585 <chdir>:
+SYSCALL(chdir)
+    1585:	b8 09 00 00 00       	mov    $0x9,%eax
+    158a:	89 e1                	mov    %esp,%ecx
+    158c:	ba 93 15 00 00       	mov    $0x1593,%edx
+    1591:	0f 34                	sysenter
+    1593:	c3                   	ret
+
+00001594 <dup>:
+SYSCALL(dup)
+    1594:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1599:	89 e1                	mov    %esp,%ecx
+    159b:	ba a2 15 00 00       	mov    $0x15a2,%edx
+    15a0:	0f 34                	sysenter
+    15a2:	c3                   	ret
+
+000015a3 <getpid>:
+SYSCALL(getpid)
+    15a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    15a8:	89 e1                	mov    %esp,%ecx
+    15aa:	ba b1 15 00 00       	mov    $0x15b1,%edx
+    15af:	0f 34                	sysenter
+    15b1:	c3                   	ret
+
+000015b2 <sbrk>:
+SYSCALL(sbrk)
+    15b2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    15b7:	89 e1                	mov    %esp,%ecx
+    15b9:	ba c0 15 00 00       	mov    $0x15c0,%edx
+    15be:	0f 34                	sysenter
+    15c0:	c3                   	ret
+
+000015c1 <sleep>:
+SYSCALL(sleep)
+    15c1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    15c6:	89 e1                	mov    %esp,%ecx
+    15c8:	ba cf 15 00 00       	mov    $0x15cf,%edx
+    15cd:	0f 34                	sysenter
+    15cf:	c3                   	ret
+
+000015d0 <uptime>:
+SYSCALL(uptime)
+    15d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    15d5:	89 e1                	mov    %esp,%ecx
+    15d7:	ba de 15 00 00       	mov    $0x15de,%edx
+    15dc:	0f 34                	sysenter
+    15de:	c3                   	ret
+
+000015df <mprotect>:
+SYSCALL(mprotect)
+    15df:	b8 16 00 00 00       	mov    $0x16,%eax
+    15e4:	89 e1                	mov    %esp,%ecx
+    15e6:	ba ed 15 00 00       	mov    $0x15ed,%edx
+    15eb:	0f 34                	sysenter
+    15ed:	c3                   	ret
+
+000015ee <munprotect>:
+SYSCALL(munprotect)
+    15ee:	b8 17 00 00 00       	mov    $0x17,%eax
+    15f3:	89 e1                	mov    %esp,%ecx
+    15f5:	ba fc 15 00 00       	mov    $0x15fc,%edx
+    15fa:	0f 34                	sysenter
+    15fc:	c3                   	ret
+
+000015fd <kstat>:
+SYSCALL(kstat)
+    15fd:	b8 18 00 00 00       	mov    $0x18,%eax
+    1602:	89 e1                	mov    %esp,%ecx
+    1604:	ba 0b 16 00 00       	mov    $0x160b,%edx
+    1609:	0f 34                	sysenter
+    160b:	c3                   	ret
+
+0000160c <fcntl>:
+SYSCALL(fcntl)
+    160c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1611:	89 e1                	mov    %esp,%ecx
+    1613:	ba 1a 16 00 00       	mov    $0x161a,%edx
+    1618:	0f 34                	sysenter
+    161a:	c3                   	ret
+
+0000161b <splice>:
+SYSCALL(splice)
+    161b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1620:	89 e1                	mov    %esp,%ecx
+    1622:	ba 29 16 00 00       	mov    $0x1629,%edx
+    1627:	0f 34                	sysenter
+    1629:	c3                   	ret
+
+0000162a <sendfile>:
+SYSCALL(sendfile)
+    162a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    162f:	89 e1                	mov    %esp,%ecx
+    1631:	ba 38 16 00 00       	mov    $0x1638,%edx
+    1636:	0f 34                	sysenter
+    1638:	c3                   	ret
+
+00001639 <lseek>:
+SYSCALL(lseek)
+    1639:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    163e:	89 e1                	mov    %esp,%ecx
+    1640:	ba 47 16 00 00       	mov    $0x1647,%edx
+    1645:	0f 34                	sysenter
+    1647:	c3                   	ret
+
+00001648 <pread>:
+SYSCALL(pread)
+    1648:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    164d:	89 e1                	mov    %esp,%ecx
+    164f:	ba 56 16 00 00       	mov    $0x1656,%edx
+    1654:	0f 34                	sysenter
+    1656:	c3                   	ret
+
+00001657 <pwrite>:
+SYSCALL(pwrite)
+    1657:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    165c:	89 e1                	mov    %esp,%ecx
+    165e:	ba 65 16 00 00       	mov    $0x1665,%edx
+    1663:	0f 34                	sysenter
+    1665:	c3                   	ret
+
+00001666 <readv>:
+SYSCALL(readv)
+    1666:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    166b:	89 e1                	mov    %esp,%ecx
+    166d:	ba 74 16 00 00       	mov    $0x1674,%edx
+    1672:	0f 34                	sysenter
+    1674:	c3                   	ret
+
+00001675 <writev>:
+SYSCALL(writev)
+    1675:	b8 20 00 00 00       	mov    $0x20,%eax
+    167a:	89 e1                	mov    %esp,%ecx
+    167c:	ba 83 16 00 00       	mov    $0x1683,%edx
+    1681:	0f 34                	sysenter
+    1683:	c3                   	ret
+
+00001684 <ringsetup>:
+SYSCALL(ringsetup)
+    1684:	b8 21 00 00 00       	mov    $0x21,%eax
+    1689:	89 e1                	mov    %esp,%ecx
+    168b:	ba 92 16 00 00       	mov    $0x1692,%edx
+    1690:	0f 34                	sysenter
+    1692:	c3                   	ret
+
+00001693 <ringenter>:
+SYSCALL(ringenter)
+    1693:	b8 22 00 00 00       	mov    $0x22,%eax
+    1698:	89 e1                	mov    %esp,%ecx
+    169a:	ba a1 16 00 00       	mov    $0x16a1,%edx
+    169f:	0f 34                	sysenter
+    16a1:	c3                   	ret
+
+000016a2 <intgetpid>:
+INTSYSCALL(getpid)
+    16a2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    16a7:	cd 40                	int    $0x40
+    16a9:	c3                   	ret
+    16aa:	66 90                	xchg   %ax,%ax
+    16ac:	66 90                	xchg   %ax,%ax
+    16ae:	66 90                	xchg   %ax,%ax
+
+000016b0 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    16b0:	55                   	push   %ebp
+    16b1:	89 e5                	mov    %esp,%ebp
+    16b3:	57                   	push   %edi
+    16b4:	56                   	push   %esi
+    16b5:	53                   	push   %ebx
+    16b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    16b8:	89 d1                	mov    %edx,%ecx
+{
+    16ba:	83 ec 2c             	sub    $0x2c,%esp
+    16bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    16c0:	85 d2                	test   %edx,%edx
+    16c2:	0f 89 c0 00 00 00    	jns    1788 <printint+0xd8>
+    16c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    16cc:	0f 84 b6 00 00 00    	je     1788 <printint+0xd8>
+    x = -xx;
+    16d2:	f7 d9                	neg    %ecx
+    neg = 1;
+    16d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    16d9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    16dc:	31 f6                	xor    %esi,%esi
+    16de:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    16e0:	89 c8                	mov    %ecx,%eax
+    16e2:	31 d2                	xor    %edx,%edx
+    16e4:	89 f7                	mov    %esi,%edi
+    16e6:	f7 f3                	div    %ebx
+    16e8:	8d 76 01             	lea    0x1(%esi),%esi
+    16eb:	0f b6 92 20 24 00 00 	movzbl 0x2420(%edx),%edx
+    16f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    16f6:	89 ca                	mov    %ecx,%edx
+    16f8:	89 c1                	mov    %eax,%ecx
+    16fa:	39 da                	cmp    %ebx,%edx
+    16fc:	73 e2                	jae    16e0 <printint+0x30>
+  if(neg)
+    16fe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1701:	85 c0                	test   %eax,%eax
+    1703:	74 07                	je     170c <printint+0x5c>
+    buf[i++] = '-';
+    1705:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    170a:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    170c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    170f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1712:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    1714:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    1717:	8b 41 08             	mov    0x8(%ecx),%eax
+    171a:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    171d:	89 ce                	mov    %ecx,%esi
+    171f:	eb 1c                	jmp    173d <printint+0x8d>
+    1721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    1728:	89 c1                	mov    %eax,%ecx
+    172a:	83 c0 01             	add    $0x1,%eax
+    172d:	89 46 08             	mov    %eax,0x8(%esi)
+    1730:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    1734:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1737:	39 df                	cmp    %ebx,%edi
+    1739:	74 41                	je     177c <printint+0xcc>
+    173b:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    173d:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    1740:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1745:	75 e1                	jne    1728 <printint+0x78>
+  if(o->f)
+    1747:	8b 06                	mov    (%esi),%eax
+    1749:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    174c:	85 c0                	test   %eax,%eax
+    174e:	74 40                	je     1790 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1750:	50                   	push   %eax
+    1751:	68 80 00 00 00       	push   $0x80
+    1756:	6a 01                	push   $0x1
+    1758:	ff 75 d4             	push   -0x2c(%ebp)
+    175b:	e8 a0 04 00 00       	call   1c00 <fwrite>
+    1760:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1764:	83 c4 10             	add    $0x10,%esp
+}
+    1767:	b8 01 00 00 00       	mov    $0x1,%eax
+    176c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    176e:	89 46 08             	mov    %eax,0x8(%esi)
+    1771:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1775:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1778:	39 df                	cmp    %ebx,%edi
+    177a:	75 bf                	jne    173b <printint+0x8b>
+}
+    177c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    177f:	5b                   	pop    %ebx
+    1780:	5e                   	pop    %esi
+    1781:	5f                   	pop    %edi
+    1782:	5d                   	pop    %ebp
+    1783:	c3                   	ret
+    1784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1788:	31 c0                	xor    %eax,%eax
+    178a:	e9 4a ff ff ff       	jmp    16d9 <printint+0x29>
+    178f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1790:	83 ec 04             	sub    $0x4,%esp
+    1793:	68 80 00 00 00       	push   $0x80
+    1798:	ff 75 d4             	push   -0x2c(%ebp)
+    179b:	ff 76 04             	push   0x4(%esi)
+    179e:	e8 4c fd ff ff       	call   14ef <write>
+    17a3:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    17a7:	83 c4 10             	add    $0x10,%esp
+    17aa:	eb bb                	jmp    1767 <printint+0xb7>
+    17ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000017b0 <putc>:
+{
+    17b0:	55                   	push   %ebp
+    17b1:	89 e5                	mov    %esp,%ebp
+    17b3:	56                   	push   %esi
+    17b4:	89 d6                	mov    %edx,%esi
+    17b6:	53                   	push   %ebx
+    17b7:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    17b9:	8b 40 08             	mov    0x8(%eax),%eax
+    17bc:	3d 80 00 00 00       	cmp    $0x80,%eax
+    17c1:	74 1d                	je     17e0 <putc+0x30>
+  o->buf[o->n++] = c;
+    17c3:	89 f1                	mov    %esi,%ecx
+    17c5:	8d 50 01             	lea    0x1(%eax),%edx
+    17c8:	89 53 08             	mov    %edx,0x8(%ebx)
+    17cb:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    17cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    17d2:	5b                   	pop    %ebx
+    17d3:	5e                   	pop    %esi
+    17d4:	5d                   	pop    %ebp
+    17d5:	c3                   	ret
+    17d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17dd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    17e0:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    17e2:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    17e5:	85 c0                	test   %eax,%eax
+    17e7:	74 2f                	je     1818 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    17e9:	50                   	push   %eax
+    17ea:	68 80 00 00 00       	push   $0x80
+    17ef:	6a 01                	push   $0x1
+    17f1:	52                   	push   %edx
+    17f2:	e8 09 04 00 00       	call   1c00 <fwrite>
+    17f7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    17fa:	89 f1                	mov    %esi,%ecx
+}
+    17fc:	ba 01 00 00 00       	mov    $0x1,%edx
+    1801:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    1803:	89 53 08             	mov    %edx,0x8(%ebx)
+    1806:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    180a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    180d:	5b                   	pop    %ebx
+    180e:	5e                   	pop    %esi
+    180f:	5d                   	pop    %ebp
+    1810:	c3                   	ret
+    1811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    1818:	83 ec 04             	sub    $0x4,%esp
+    181b:	68 80 00 00 00       	push   $0x80
+    1820:	52                   	push   %edx
+    1821:	ff 73 04             	push   0x4(%ebx)
+    1824:	e8 c6 fc ff ff       	call   14ef <write>
+    1829:	83 c4 10             	add    $0x10,%esp
+    182c:	eb cc                	jmp    17fa <putc+0x4a>
+    182e:	66 90                	xchg   %ax,%ax
+
+00001830 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1830:	55                   	push   %ebp
+    1831:	89 e5                	mov    %esp,%ebp
+    1833:	57                   	push   %edi
+    1834:	89 c7                	mov    %eax,%edi
+    1836:	56                   	push   %esi
+    1837:	31 f6                	xor    %esi,%esi
+    1839:	53                   	push   %ebx
+    183a:	8d 5a 01             	lea    0x1(%edx),%ebx
+    183d:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    1840:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    1843:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1846:	84 c0                	test   %al,%al
+    1848:	75 1e                	jne    1868 <vprintf.constprop.0+0x38>
+    184a:	eb 53                	jmp    189f <vprintf.constprop.0+0x6f>
+    184c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1850:	83 f8 25             	cmp    $0x25,%eax
+    1853:	74 3b                	je     1890 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1855:	89 ca                	mov    %ecx,%edx
+    1857:	89 f8                	mov    %edi,%eax
+    1859:	e8 52 ff ff ff       	call   17b0 <putc>
+  for(i = 0; fmt[i]; i++){
+    185e:	0f b6 03             	movzbl (%ebx),%eax
+    1861:	83 c3 01             	add    $0x1,%ebx
+    1864:	84 c0                	test   %al,%al
+    1866:	74 37                	je     189f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1868:	0f be c8             	movsbl %al,%ecx
+    186b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    186e:	85 f6                	test   %esi,%esi
+    1870:	74 de                	je     1850 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1872:	83 fe 25             	cmp    $0x25,%esi
+    1875:	75 e7                	jne    185e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1877:	83 f8 25             	cmp    $0x25,%eax
+    187a:	74 4e                	je     18ca <vprintf.constprop.0+0x9a>
+    187c:	83 e8 63             	sub    $0x63,%eax
+    187f:	83 f8 15             	cmp    $0x15,%eax
+    1882:	77 34                	ja     18b8 <vprintf.constprop.0+0x88>
+    1884:	ff 24 85 c8 23 00 00 	jmp    *0x23c8(,%eax,4)
+    188b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    188f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1890:	0f b6 03             	movzbl (%ebx),%eax
+    1893:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1896:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    189b:	84 c0                	test   %al,%al
+    189d:	75 c9                	jne    1868 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    189f:	8b 47 08             	mov    0x8(%edi),%eax
+    18a2:	85 c0                	test   %eax,%eax
+    18a4:	0f 8f de 00 00 00    	jg     1988 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    18aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18ad:	5b                   	pop    %ebx
+    18ae:	5e                   	pop    %esi
+    18af:	5f                   	pop    %edi
+    18b0:	5d                   	pop    %ebp
+    18b1:	c3                   	ret
+    18b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    18b8:	ba 25 00 00 00       	mov    $0x25,%edx
+    18bd:	89 f8                	mov    %edi,%eax
+    18bf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    18c2:	e8 e9 fe ff ff       	call   17b0 <putc>
+        putc(o, c);
+    18c7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    18ca:	89 ca                	mov    %ecx,%edx
+    18cc:	89 f8                	mov    %edi,%eax
+      state = 0;
+    18ce:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    18d0:	e8 db fe ff ff       	call   17b0 <putc>
+    18d5:	eb 87                	jmp    185e <vprintf.constprop.0+0x2e>
+    18d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18de:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    18e0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    18e3:	83 ec 0c             	sub    $0xc,%esp
+    18e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    18eb:	8b 16                	mov    (%esi),%edx
+    18ed:	6a 00                	push   $0x0
+        ap++;
+    18ef:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    18f2:	89 f8                	mov    %edi,%eax
+    18f4:	e8 b7 fd ff ff       	call   16b0 <printint>
+        ap++;
+    18f9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    18fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    18ff:	31 f6                	xor    %esi,%esi
+    1901:	e9 58 ff ff ff       	jmp    185e <vprintf.constprop.0+0x2e>
+    1906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    190d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1910:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1913:	8b 30                	mov    (%eax),%esi
+        ap++;
+    1915:	83 c0 04             	add    $0x4,%eax
+    1918:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    191b:	85 f6                	test   %esi,%esi
+    191d:	75 1b                	jne    193a <vprintf.constprop.0+0x10a>
+    191f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1924:	be bf 23 00 00       	mov    $0x23bf,%esi
+    1929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    1930:	89 f8                	mov    %edi,%eax
+          s++;
+    1932:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    1935:	e8 76 fe ff ff       	call   17b0 <putc>
+        while(*s != 0){
+    193a:	0f be 16             	movsbl (%esi),%edx
+    193d:	84 d2                	test   %dl,%dl
+    193f:	75 ef                	jne    1930 <vprintf.constprop.0+0x100>
+      state = 0;
+    1941:	31 f6                	xor    %esi,%esi
+    1943:	e9 16 ff ff ff       	jmp    185e <vprintf.constprop.0+0x2e>
+    1948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    194f:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1950:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1953:	83 ec 0c             	sub    $0xc,%esp
+    1956:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    195b:	8b 16                	mov    (%esi),%edx
+    195d:	6a 01                	push   $0x1
+    195f:	eb 8e                	jmp    18ef <vprintf.constprop.0+0xbf>
+    1961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1968:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    196b:	89 f8                	mov    %edi,%eax
+    196d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1970:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1973:	e8 38 fe ff ff       	call   17b0 <putc>
+        ap++;
+    1978:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    197b:	31 f6                	xor    %esi,%esi
+    197d:	e9 dc fe ff ff       	jmp    185e <vprintf.constprop.0+0x2e>
+    1982:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1988:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    198a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    198d:	85 d2                	test   %edx,%edx
+    198f:	74 1f                	je     19b0 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1991:	52                   	push   %edx
+    1992:	50                   	push   %eax
+    1993:	6a 01                	push   $0x1
+    1995:	51                   	push   %ecx
+    1996:	e8 65 02 00 00       	call   1c00 <fwrite>
+    199b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    199e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    19a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19a8:	5b                   	pop    %ebx
+    19a9:	5e                   	pop    %esi
+    19aa:	5f                   	pop    %edi
+    19ab:	5d                   	pop    %ebp
+    19ac:	c3                   	ret
+    19ad:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    19b0:	83 ec 04             	sub    $0x4,%esp
+    19b3:	50                   	push   %eax
+    19b4:	51                   	push   %ecx
+    19b5:	ff 77 04             	push   0x4(%edi)
+    19b8:	e8 32 fb ff ff       	call   14ef <write>
+    19bd:	83 c4 10             	add    $0x10,%esp
+    19c0:	eb dc                	jmp    199e <vprintf.constprop.0+0x16e>
+    19c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000019d0 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    19d0:	55                   	push   %ebp
+    19d1:	89 e5                	mov    %esp,%ebp
+    19d3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    19d9:	a1 04 2b 00 00       	mov    0x2b04,%eax
+{
+    19de:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    19e1:	83 fa 01             	cmp    $0x1,%edx
+    19e4:	74 0c                	je     19f2 <printf+0x22>
+    19e6:	31 c0                	xor    %eax,%eax
+    19e8:	83 fa 02             	cmp    $0x2,%edx
+    19eb:	0f 44 05 00 2b 00 00 	cmove  0x2b00,%eax
+  o.fd = fd;
+    19f2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    19f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    19fb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    19fe:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a04:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    1a0a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1a11:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a14:	e8 17 fe ff ff       	call   1830 <vprintf.constprop.0>
+}
+    1a19:	c9                   	leave
+    1a1a:	c3                   	ret
+    1a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a1f:	90                   	nop
+
+00001a20 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    1a20:	55                   	push   %ebp
+    1a21:	89 e5                	mov    %esp,%ebp
+    1a23:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    1a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1a2f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    1a32:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    1a39:	ff ff ff 
+  o.n = 0;
+    1a3c:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1a43:	00 00 00 
+  o.f = f;
+    1a46:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    1a4c:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1a52:	e8 d9 fd ff ff       	call   1830 <vprintf.constprop.0>
+}
+    1a57:	c9                   	leave
+    1a58:	c3                   	ret
+    1a59:	66 90                	xchg   %ax,%ax
+    1a5b:	66 90                	xchg   %ax,%ax
+    1a5d:	66 90                	xchg   %ax,%ax
+    1a5f:	90                   	nop
+
+00001a60 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1a60:	55                   	push   %ebp
+    1a61:	89 e5                	mov    %esp,%ebp
+    1a63:	53                   	push   %ebx
+    1a64:	89 c3                	mov    %eax,%ebx
+    1a66:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1a69:	8b 40 0c             	mov    0xc(%eax),%eax
+    1a6c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a6f:	74 17                	je     1a88 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1a71:	83 f8 02             	cmp    $0x2,%eax
+    1a74:	74 07                	je     1a7d <setmode+0x1d>
+    1a76:	8b 43 18             	mov    0x18(%ebx),%eax
+    1a79:	85 c0                	test   %eax,%eax
+    1a7b:	74 38                	je     1ab5 <setmode+0x55>
+    f->mode = IONBF;
+}
+    1a7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a80:	c9                   	leave
+    1a81:	c3                   	ret
+    1a82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1a88:	83 ec 08             	sub    $0x8,%esp
+    1a8b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1a8e:	50                   	push   %eax
+    1a8f:	ff 33                	push   (%ebx)
+    1a91:	e8 c2 fa ff ff       	call   1558 <fstat>
+    1a96:	83 c4 10             	add    $0x10,%esp
+    1a99:	89 c2                	mov    %eax,%edx
+    1a9b:	31 c0                	xor    %eax,%eax
+    1a9d:	85 d2                	test   %edx,%edx
+    1a9f:	75 0a                	jne    1aab <setmode+0x4b>
+    1aa1:	31 c0                	xor    %eax,%eax
+    1aa3:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1aa8:	0f 94 c0             	sete   %al
+    1aab:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1aae:	8b 43 18             	mov    0x18(%ebx),%eax
+    1ab1:	85 c0                	test   %eax,%eax
+    1ab3:	75 c8                	jne    1a7d <setmode+0x1d>
+    1ab5:	83 ec 0c             	sub    $0xc,%esp
+    1ab8:	68 00 04 00 00       	push   $0x400
+    1abd:	e8 de 07 00 00       	call   22a0 <malloc>
+    1ac2:	83 c4 10             	add    $0x10,%esp
+    1ac5:	89 43 18             	mov    %eax,0x18(%ebx)
+    1ac8:	85 c0                	test   %eax,%eax
+    1aca:	75 b1                	jne    1a7d <setmode+0x1d>
+    f->mode = IONBF;
+    1acc:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1ad3:	eb a8                	jmp    1a7d <setmode+0x1d>
+    1ad5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001ae0 <drain>:
+{
+    1ae0:	55                   	push   %ebp
+    1ae1:	89 e5                	mov    %esp,%ebp
+    1ae3:	57                   	push   %edi
+    1ae4:	56                   	push   %esi
+    1ae5:	53                   	push   %ebx
+    1ae6:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1ae9:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    1aec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    1aef:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1af6:	85 ff                	test   %edi,%edi
+    1af8:	7f 0e                	jg     1b08 <drain+0x28>
+  return 0;
+    1afa:	31 c0                	xor    %eax,%eax
+}
+    1afc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1aff:	5b                   	pop    %ebx
+    1b00:	5e                   	pop    %esi
+    1b01:	5f                   	pop    %edi
+    1b02:	5d                   	pop    %ebp
+    1b03:	c3                   	ret
+    1b04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    1b08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b0b:	8b 58 18             	mov    0x18(%eax),%ebx
+    1b0e:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    1b10:	eb 0e                	jmp    1b20 <drain+0x40>
+    1b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1b18:	29 c7                	sub    %eax,%edi
+    1b1a:	01 c3                	add    %eax,%ebx
+    1b1c:	85 ff                	test   %edi,%edi
+    1b1e:	7e da                	jle    1afa <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    1b20:	83 ec 04             	sub    $0x4,%esp
+    1b23:	57                   	push   %edi
+    1b24:	53                   	push   %ebx
+    1b25:	56                   	push   %esi
+    1b26:	e8 c4 f9 ff ff       	call   14ef <write>
+    1b2b:	83 c4 10             	add    $0x10,%esp
+    1b2e:	85 c0                	test   %eax,%eax
+    1b30:	7f e6                	jg     1b18 <drain+0x38>
+    f->err = 1;
+    1b32:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b35:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    1b3c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b41:	eb b9                	jmp    1afc <drain+0x1c>
+    1b43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001b50 <flushall>:
+
+static void
+flushall(void)
+{
+    1b50:	55                   	push   %ebp
+    1b51:	89 e5                	mov    %esp,%ebp
+    1b53:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b54:	bb 20 2b 00 00       	mov    $0x2b20,%ebx
+{
+    1b59:	83 ec 04             	sub    $0x4,%esp
+    1b5c:	eb 0d                	jmp    1b6b <flushall+0x1b>
+    1b5e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b60:	83 c3 24             	add    $0x24,%ebx
+    1b63:	81 fb 60 2d 00 00    	cmp    $0x2d60,%ebx
+    1b69:	74 19                	je     1b84 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1b6b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1b6e:	85 c0                	test   %eax,%eax
+    1b70:	74 ee                	je     1b60 <flushall+0x10>
+    1b72:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b74:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1b77:	e8 64 ff ff ff       	call   1ae0 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1b7c:	81 fb 60 2d 00 00    	cmp    $0x2d60,%ebx
+    1b82:	75 e7                	jne    1b6b <flushall+0x1b>
+}
+    1b84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1b87:	c9                   	leave
+    1b88:	c3                   	ret
+    1b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b90 <fflush>:
+{
+    1b90:	55                   	push   %ebp
+    1b91:	89 e5                	mov    %esp,%ebp
+    1b93:	57                   	push   %edi
+    1b94:	56                   	push   %esi
+    1b95:	53                   	push   %ebx
+    1b96:	83 ec 0c             	sub    $0xc,%esp
+    1b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1b9c:	85 c0                	test   %eax,%eax
+    1b9e:	74 28                	je     1bc8 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1ba0:	8b 70 08             	mov    0x8(%eax),%esi
+    1ba3:	85 f6                	test   %esi,%esi
+    1ba5:	75 11                	jne    1bb8 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1ba7:	83 c4 0c             	add    $0xc,%esp
+    1baa:	89 f0                	mov    %esi,%eax
+    1bac:	5b                   	pop    %ebx
+    1bad:	5e                   	pop    %esi
+    1bae:	5f                   	pop    %edi
+    1baf:	5d                   	pop    %ebp
+    1bb0:	c3                   	ret
+    1bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bb8:	83 c4 0c             	add    $0xc,%esp
+    1bbb:	5b                   	pop    %ebx
+    1bbc:	5e                   	pop    %esi
+    1bbd:	5f                   	pop    %edi
+    1bbe:	5d                   	pop    %ebp
+  return drain(f);
+    1bbf:	e9 1c ff ff ff       	jmp    1ae0 <drain>
+    1bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1bc8:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1bca:	bb 20 2b 00 00       	mov    $0x2b20,%ebx
+        r = -1;
+    1bcf:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1bd4:	eb 15                	jmp    1beb <fflush+0x5b>
+    1bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bdd:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1be0:	83 c3 24             	add    $0x24,%ebx
+    1be3:	81 fb 60 2d 00 00    	cmp    $0x2d60,%ebx
+    1be9:	74 bc                	je     1ba7 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1beb:	8b 43 08             	mov    0x8(%ebx),%eax
+    1bee:	85 c0                	test   %eax,%eax
+    1bf0:	74 ee                	je     1be0 <fflush+0x50>
+    1bf2:	89 d8                	mov    %ebx,%eax
+    1bf4:	e8 e7 fe ff ff       	call   1ae0 <drain>
+        r = -1;
+    1bf9:	85 c0                	test   %eax,%eax
+    1bfb:	0f 48 f7             	cmovs  %edi,%esi
+    1bfe:	eb e0                	jmp    1be0 <fflush+0x50>
+
+00001c00 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1c00:	55                   	push   %ebp
+    1c01:	89 e5                	mov    %esp,%ebp
+    1c03:	57                   	push   %edi
+    1c04:	56                   	push   %esi
+    1c05:	53                   	push   %ebx
+    1c06:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1c09:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1c0c:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1c10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1c13:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1c16:	85 d2                	test   %edx,%edx
+    1c18:	0f 8e 26 01 00 00    	jle    1d44 <fwrite+0x144>
+  if(!f->writable){
+    1c1e:	8b 46 08             	mov    0x8(%esi),%eax
+    1c21:	85 c0                	test   %eax,%eax
+    1c23:	0f 84 14 01 00 00    	je     1d3d <fwrite+0x13d>
+  setmode(f);
+    1c29:	89 f0                	mov    %esi,%eax
+    1c2b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c2e:	e8 2d fe ff ff       	call   1a60 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1c33:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1c37:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1c3a:	c7 05 60 2f 00 00 50 	movl   $0x1b50,0x2f60
+    1c41:	1b 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1c44:	0f 84 b6 00 00 00    	je     1d00 <fwrite+0x100>
+    1c4a:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1c50:	0f 8f aa 00 00 00    	jg     1d00 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1c56:	8b 46 20             	mov    0x20(%esi),%eax
+    1c59:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1c5c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1c5e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1c63:	74 6c                	je     1cd1 <fwrite+0xd1>
+    1c65:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1c68:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1c6b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1c70:	29 c2                	sub    %eax,%edx
+    1c72:	39 ca                	cmp    %ecx,%edx
+    1c74:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1c77:	85 d2                	test   %edx,%edx
+    1c79:	0f 8e d1 00 00 00    	jle    1d50 <fwrite+0x150>
+    1c7f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1c82:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1c85:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c8f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1c90:	8d 50 01             	lea    0x1(%eax),%edx
+    1c93:	83 c3 01             	add    $0x1,%ebx
+    1c96:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1c99:	89 56 20             	mov    %edx,0x20(%esi)
+    1c9c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1ca0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1ca3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1ca6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1cab:	80 fa 0a             	cmp    $0xa,%dl
+    1cae:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1cb1:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1cb4:	39 cb                	cmp    %ecx,%ebx
+    1cb6:	75 d8                	jne    1c90 <fwrite+0x90>
+    1cb8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1cbb:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1cbe:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1cc1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1cc4:	85 db                	test   %ebx,%ebx
+    1cc6:	7e 19                	jle    1ce1 <fwrite+0xe1>
+    n -= k;
+    1cc8:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1cca:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1ccf:	75 97                	jne    1c68 <fwrite+0x68>
+    1cd1:	89 f0                	mov    %esi,%eax
+    1cd3:	e8 08 fe ff ff       	call   1ae0 <drain>
+    1cd8:	85 c0                	test   %eax,%eax
+    1cda:	78 68                	js     1d44 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1cdc:	8b 46 20             	mov    0x20(%esi),%eax
+    1cdf:	eb 87                	jmp    1c68 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1ce1:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1ce6:	74 74                	je     1d5c <fwrite+0x15c>
+    1ce8:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1cec:	75 04                	jne    1cf2 <fwrite+0xf2>
+    1cee:	85 ff                	test   %edi,%edi
+    1cf0:	75 6a                	jne    1d5c <fwrite+0x15c>
+    return nmemb;
+    1cf2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cf8:	5b                   	pop    %ebx
+    1cf9:	5e                   	pop    %esi
+    1cfa:	5f                   	pop    %edi
+    1cfb:	5d                   	pop    %ebp
+    1cfc:	c3                   	ret
+    1cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1d00:	89 f0                	mov    %esi,%eax
+    1d02:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1d05:	e8 d6 fd ff ff       	call   1ae0 <drain>
+    1d0a:	85 c0                	test   %eax,%eax
+    1d0c:	78 2f                	js     1d3d <fwrite+0x13d>
+    1d0e:	89 75 14             	mov    %esi,0x14(%ebp)
+    1d11:	8b 3e                	mov    (%esi),%edi
+    1d13:	89 de                	mov    %ebx,%esi
+    1d15:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1d18:	eb 0e                	jmp    1d28 <fwrite+0x128>
+    1d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1d20:	29 c3                	sub    %eax,%ebx
+    1d22:	01 c6                	add    %eax,%esi
+    1d24:	85 db                	test   %ebx,%ebx
+    1d26:	7e ca                	jle    1cf2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1d28:	83 ec 04             	sub    $0x4,%esp
+    1d2b:	53                   	push   %ebx
+    1d2c:	56                   	push   %esi
+    1d2d:	57                   	push   %edi
+    1d2e:	e8 bc f7 ff ff       	call   14ef <write>
+    1d33:	83 c4 10             	add    $0x10,%esp
+    1d36:	85 c0                	test   %eax,%eax
+    1d38:	7f e6                	jg     1d20 <fwrite+0x120>
+    1d3a:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1d3d:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1d44:	31 c0                	xor    %eax,%eax
+}
+    1d46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d49:	5b                   	pop    %ebx
+    1d4a:	5e                   	pop    %esi
+    1d4b:	5f                   	pop    %edi
+    1d4c:	5d                   	pop    %ebp
+    1d4d:	c3                   	ret
+    1d4e:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1d50:	89 d9                	mov    %ebx,%ecx
+    1d52:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1d55:	89 cb                	mov    %ecx,%ebx
+    1d57:	e9 6e ff ff ff       	jmp    1cca <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1d5c:	89 f0                	mov    %esi,%eax
+    1d5e:	e8 7d fd ff ff       	call   1ae0 <drain>
+    1d63:	85 c0                	test   %eax,%eax
+    1d65:	79 8b                	jns    1cf2 <fwrite+0xf2>
+    return 0;
+    1d67:	31 c0                	xor    %eax,%eax
+    1d69:	eb db                	jmp    1d46 <fwrite+0x146>
+    1d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d6f:	90                   	nop
+
+00001d70 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1d70:	55                   	push   %ebp
+    1d71:	89 e5                	mov    %esp,%ebp
+    1d73:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1d76:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d79:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1d7c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1d7f:	ff 75 0c             	push   0xc(%ebp)
+    1d82:	6a 01                	push   $0x1
+    1d84:	6a 01                	push   $0x1
+    1d86:	50                   	push   %eax
+    1d87:	e8 74 fe ff ff       	call   1c00 <fwrite>
+    1d8c:	83 c4 10             	add    $0x10,%esp
+    1d8f:	83 f8 01             	cmp    $0x1,%eax
+    1d92:	75 0c                	jne    1da0 <fputc+0x30>
+    1d94:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1d98:	c9                   	leave
+    1d99:	c3                   	ret
+    1d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1da0:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1da1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1da6:	c3                   	ret
+    1da7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dae:	66 90                	xchg   %ax,%ax
+
+00001db0 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1db0:	55                   	push   %ebp
+    1db1:	89 e5                	mov    %esp,%ebp
+    1db3:	57                   	push   %edi
+    1db4:	56                   	push   %esi
+    1db5:	53                   	push   %ebx
+    1db6:	83 ec 1c             	sub    $0x1c,%esp
+    1db9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1dbc:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1dbf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1dc2:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1dc5:	85 d2                	test   %edx,%edx
+    1dc7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1dca:	7e 12                	jle    1dde <fread+0x2e>
+    1dcc:	85 ff                	test   %edi,%edi
+    1dce:	7e 0e                	jle    1dde <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1dd0:	8b 43 04             	mov    0x4(%ebx),%eax
+    1dd3:	85 c0                	test   %eax,%eax
+    1dd5:	75 19                	jne    1df0 <fread+0x40>
+    f->err = 1;
+    1dd7:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1dde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1de1:	31 c0                	xor    %eax,%eax
+}
+    1de3:	5b                   	pop    %ebx
+    1de4:	5e                   	pop    %esi
+    1de5:	5f                   	pop    %edi
+    1de6:	5d                   	pop    %ebp
+    1de7:	c3                   	ret
+    1de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1def:	90                   	nop
+  setmode(f);
+    1df0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1df2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1df4:	e8 67 fc ff ff       	call   1a60 <setmode>
+  for(n = 0; n < want; n += k){
+    1df9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1dfc:	89 f7                	mov    %esi,%edi
+    1dfe:	eb 31                	jmp    1e31 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1e00:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1e04:	74 08                	je     1e0e <fread+0x5e>
+    1e06:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1e0c:	7e 62                	jle    1e70 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1e0e:	83 ec 04             	sub    $0x4,%esp
+    1e11:	56                   	push   %esi
+    1e12:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e15:	01 f8                	add    %edi,%eax
+    1e17:	50                   	push   %eax
+    1e18:	ff 33                	push   (%ebx)
+    1e1a:	e8 c1 f6 ff ff       	call   14e0 <read>
+    1e1f:	83 c4 10             	add    $0x10,%esp
+    1e22:	85 c0                	test   %eax,%eax
+    1e24:	0f 8e ce 00 00 00    	jle    1ef8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1e2a:	01 c7                	add    %eax,%edi
+    1e2c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1e2f:	7e 36                	jle    1e67 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1e31:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1e34:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1e37:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1e3a:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1e3c:	39 c1                	cmp    %eax,%ecx
+    1e3e:	7d c0                	jge    1e00 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1e40:	29 c8                	sub    %ecx,%eax
+    1e42:	39 f0                	cmp    %esi,%eax
+    1e44:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1e47:	83 ec 04             	sub    $0x4,%esp
+    1e4a:	56                   	push   %esi
+    1e4b:	03 4b 18             	add    0x18(%ebx),%ecx
+    1e4e:	51                   	push   %ecx
+    1e4f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e52:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1e54:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1e56:	50                   	push   %eax
+    1e57:	e8 34 f5 ff ff       	call   1390 <memmove>
+      f->r += k;
+    1e5c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1e5f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1e62:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1e65:	7f ca                	jg     1e31 <fread+0x81>
+    1e67:	89 fe                	mov    %edi,%esi
+    1e69:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1e6c:	eb 3f                	jmp    1ead <fread+0xfd>
+    1e6e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1e70:	3b 1d 08 2b 00 00    	cmp    0x2b08,%ebx
+    1e76:	74 68                	je     1ee0 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1e78:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1e7b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1e82:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1e89:	68 00 04 00 00       	push   $0x400
+    1e8e:	ff 73 18             	push   0x18(%ebx)
+    1e91:	ff 33                	push   (%ebx)
+    1e93:	e8 48 f6 ff ff       	call   14e0 <read>
+    1e98:	83 c4 10             	add    $0x10,%esp
+    1e9b:	85 c0                	test   %eax,%eax
+    1e9d:	78 21                	js     1ec0 <fread+0x110>
+  else if(n == 0)
+    1e9f:	75 2f                	jne    1ed0 <fread+0x120>
+    f->eof = 1;
+    1ea1:	89 fe                	mov    %edi,%esi
+    1ea3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1ea6:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1ead:	89 f0                	mov    %esi,%eax
+}
+    1eaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1eb2:	99                   	cltd
+}
+    1eb3:	5b                   	pop    %ebx
+    1eb4:	5e                   	pop    %esi
+  return n / size;
+    1eb5:	f7 ff                	idiv   %edi
+}
+    1eb7:	5f                   	pop    %edi
+    1eb8:	5d                   	pop    %ebp
+    1eb9:	c3                   	ret
+    1eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1ec0:	89 fe                	mov    %edi,%esi
+    1ec2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1ec5:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1ecc:	eb df                	jmp    1ead <fread+0xfd>
+    1ece:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1ed0:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1ed3:	e9 54 ff ff ff       	jmp    1e2c <fread+0x7c>
+    1ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1edf:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1ee0:	83 ec 0c             	sub    $0xc,%esp
+    1ee3:	ff 35 04 2b 00 00    	push   0x2b04
+    1ee9:	e8 a2 fc ff ff       	call   1b90 <fflush>
+    1eee:	83 c4 10             	add    $0x10,%esp
+    1ef1:	eb 85                	jmp    1e78 <fread+0xc8>
+    1ef3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ef7:	90                   	nop
+        if(k < 0)
+    1ef8:	89 fe                	mov    %edi,%esi
+    1efa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1efd:	74 a7                	je     1ea6 <fread+0xf6>
+    1eff:	eb c4                	jmp    1ec5 <fread+0x115>
+    1f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f0f:	90                   	nop
+
+00001f10 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1f10:	55                   	push   %ebp
+    1f11:	89 e5                	mov    %esp,%ebp
+    1f13:	53                   	push   %ebx
+    1f14:	83 ec 14             	sub    $0x14,%esp
+    1f17:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1f1a:	8b 50 04             	mov    0x4(%eax),%edx
+    1f1d:	85 d2                	test   %edx,%edx
+    1f1f:	74 08                	je     1f29 <fgetc+0x19>
+    1f21:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1f24:	3b 50 20             	cmp    0x20(%eax),%edx
+    1f27:	7c 27                	jl     1f50 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f29:	50                   	push   %eax
+    1f2a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1f2d:	6a 01                	push   $0x1
+    1f2f:	6a 01                	push   $0x1
+    1f31:	50                   	push   %eax
+    1f32:	e8 79 fe ff ff       	call   1db0 <fread>
+    1f37:	83 c4 10             	add    $0x10,%esp
+    1f3a:	83 f8 01             	cmp    $0x1,%eax
+    1f3d:	75 29                	jne    1f68 <fgetc+0x58>
+    1f3f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1f43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f46:	c9                   	leave
+    1f47:	c3                   	ret
+    1f48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f4f:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1f50:	8b 48 18             	mov    0x18(%eax),%ecx
+    1f53:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1f56:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1f59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1f5c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1f60:	c9                   	leave
+    1f61:	c3                   	ret
+    1f62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1f6d:	eb d4                	jmp    1f43 <fgetc+0x33>
+    1f6f:	90                   	nop
+
+00001f70 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1f70:	55                   	push   %ebp
+    1f71:	89 e5                	mov    %esp,%ebp
+    1f73:	57                   	push   %edi
+    1f74:	56                   	push   %esi
+    1f75:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1f76:	31 db                	xor    %ebx,%ebx
+{
+    1f78:	83 ec 1c             	sub    $0x1c,%esp
+    1f7b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1f7e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1f80:	eb 2e                	jmp    1fb0 <fgets+0x40>
+    1f82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1f88:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1f8b:	57                   	push   %edi
+    1f8c:	6a 01                	push   $0x1
+    1f8e:	6a 01                	push   $0x1
+    1f90:	50                   	push   %eax
+    1f91:	e8 1a fe ff ff       	call   1db0 <fread>
+    1f96:	83 c4 10             	add    $0x10,%esp
+    1f99:	83 f8 01             	cmp    $0x1,%eax
+    1f9c:	75 62                	jne    2000 <fgets+0x90>
+    1f9e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1fa5:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1fa7:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1fab:	83 f9 0a             	cmp    $0xa,%ecx
+    1fae:	74 34                	je     1fe4 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1fb0:	89 de                	mov    %ebx,%esi
+    1fb2:	83 c3 01             	add    $0x1,%ebx
+    1fb5:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1fb8:	7d 46                	jge    2000 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1fba:	8b 47 04             	mov    0x4(%edi),%eax
+    1fbd:	85 c0                	test   %eax,%eax
+    1fbf:	74 c7                	je     1f88 <fgets+0x18>
+    1fc1:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1fc4:	3b 47 20             	cmp    0x20(%edi),%eax
+    1fc7:	7d bf                	jge    1f88 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1fc9:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1fcc:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1fcf:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1fd2:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1fd5:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1fd9:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1fdb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1fdf:	83 f9 0a             	cmp    $0xa,%ecx
+    1fe2:	75 cc                	jne    1fb0 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+    1fe7:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1feb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ff1:	5b                   	pop    %ebx
+    1ff2:	5e                   	pop    %esi
+    1ff3:	5f                   	pop    %edi
+    1ff4:	5d                   	pop    %ebp
+    1ff5:	c3                   	ret
+    1ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ffd:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    2000:	8b 45 08             	mov    0x8(%ebp),%eax
+    2003:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    2007:	31 c0                	xor    %eax,%eax
+    2009:	85 f6                	test   %esi,%esi
+    200b:	74 e1                	je     1fee <fgets+0x7e>
+    200d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2010:	eb dc                	jmp    1fee <fgets+0x7e>
+    2012:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2019:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002020 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    2020:	55                   	push   %ebp
+    2021:	89 e5                	mov    %esp,%ebp
+    2023:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    2024:	bb 20 2b 00 00       	mov    $0x2b20,%ebx
+{
+    2029:	83 ec 04             	sub    $0x4,%esp
+    202c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    2030:	8b 53 04             	mov    0x4(%ebx),%edx
+    2033:	85 d2                	test   %edx,%edx
+    2035:	75 07                	jne    203e <fdopen+0x1e>
+    2037:	8b 43 08             	mov    0x8(%ebx),%eax
+    203a:	85 c0                	test   %eax,%eax
+    203c:	74 1a                	je     2058 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    203e:	83 c3 24             	add    $0x24,%ebx
+    2041:	81 fb 60 2d 00 00    	cmp    $0x2d60,%ebx
+    2047:	75 e7                	jne    2030 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    2049:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    204b:	89 d8                	mov    %ebx,%eax
+    204d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2050:	c9                   	leave
+    2051:	c3                   	ret
+    2052:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    2058:	81 fb 60 2d 00 00    	cmp    $0x2d60,%ebx
+    205e:	74 e9                	je     2049 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    2060:	83 ec 04             	sub    $0x4,%esp
+    2063:	6a 24                	push   $0x24
+    2065:	6a 00                	push   $0x0
+    2067:	53                   	push   %ebx
+    2068:	e8 d3 f1 ff ff       	call   1240 <memset>
+  f->fd = fd;
+    206d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    2070:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    2077:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    207a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    207c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    207f:	80 38 72             	cmpb   $0x72,(%eax)
+    2082:	74 14                	je     2098 <fdopen+0x78>
+    f->writable = 1;
+    2084:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    208b:	89 d8                	mov    %ebx,%eax
+    208d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2090:	c9                   	leave
+    2091:	c3                   	ret
+    2092:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    2098:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    209f:	89 d8                	mov    %ebx,%eax
+    20a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    20a4:	c9                   	leave
+    20a5:	c3                   	ret
+    20a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020b0 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    20b0:	55                   	push   %ebp
+    20b1:	89 e5                	mov    %esp,%ebp
+    20b3:	56                   	push   %esi
+    20b4:	53                   	push   %ebx
+    20b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    20b8:	0f b6 06             	movzbl (%esi),%eax
+    20bb:	3c 72                	cmp    $0x72,%al
+    20bd:	74 61                	je     2120 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    20bf:	3c 77                	cmp    $0x77,%al
+    20c1:	74 7d                	je     2140 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    20c3:	3c 61                	cmp    $0x61,%al
+    20c5:	75 49                	jne    2110 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    20c7:	83 ec 08             	sub    $0x8,%esp
+    20ca:	68 01 02 00 00       	push   $0x201
+    20cf:	ff 75 08             	push   0x8(%ebp)
+    20d2:	e8 54 f4 ff ff       	call   152b <open>
+    20d7:	83 c4 10             	add    $0x10,%esp
+    20da:	89 c3                	mov    %eax,%ebx
+    20dc:	85 c0                	test   %eax,%eax
+    20de:	78 30                	js     2110 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    20e0:	83 ec 04             	sub    $0x4,%esp
+    20e3:	6a 02                	push   $0x2
+    20e5:	6a 00                	push   $0x0
+    20e7:	50                   	push   %eax
+    20e8:	e8 4c f5 ff ff       	call   1639 <lseek>
+    20ed:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    20f0:	83 ec 08             	sub    $0x8,%esp
+    20f3:	56                   	push   %esi
+    20f4:	53                   	push   %ebx
+    20f5:	e8 26 ff ff ff       	call   2020 <fdopen>
+    20fa:	83 c4 10             	add    $0x10,%esp
+    20fd:	85 c0                	test   %eax,%eax
+    20ff:	75 11                	jne    2112 <fopen+0x62>
+    close(fd);
+    2101:	83 ec 0c             	sub    $0xc,%esp
+    2104:	53                   	push   %ebx
+    2105:	e8 f4 f3 ff ff       	call   14fe <close>
+    210a:	83 c4 10             	add    $0x10,%esp
+    210d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    2110:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    2112:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2115:	5b                   	pop    %ebx
+    2116:	5e                   	pop    %esi
+    2117:	5d                   	pop    %ebp
+    2118:	c3                   	ret
+    2119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    2120:	83 ec 08             	sub    $0x8,%esp
+    2123:	6a 00                	push   $0x0
+    2125:	ff 75 08             	push   0x8(%ebp)
+    2128:	e8 fe f3 ff ff       	call   152b <open>
+    212d:	83 c4 10             	add    $0x10,%esp
+    2130:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    2132:	85 db                	test   %ebx,%ebx
+    2134:	78 da                	js     2110 <fopen+0x60>
+    2136:	eb b8                	jmp    20f0 <fopen+0x40>
+    2138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    213f:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    2140:	83 ec 08             	sub    $0x8,%esp
+    2143:	68 01 06 00 00       	push   $0x601
+    2148:	ff 75 08             	push   0x8(%ebp)
+    214b:	e8 db f3 ff ff       	call   152b <open>
+    2150:	83 c4 10             	add    $0x10,%esp
+    2153:	89 c3                	mov    %eax,%ebx
+    2155:	eb db                	jmp    2132 <fopen+0x82>
+    2157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    215e:	66 90                	xchg   %ax,%ax
+
+00002160 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2160:	55                   	push   %ebp
+    2161:	89 e5                	mov    %esp,%ebp
+    2163:	56                   	push   %esi
+    2164:	53                   	push   %ebx
+    2165:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2168:	83 ec 0c             	sub    $0xc,%esp
+    216b:	53                   	push   %ebx
+    216c:	e8 1f fa ff ff       	call   1b90 <fflush>
+    2171:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2173:	58                   	pop    %eax
+    2174:	ff 33                	push   (%ebx)
+    2176:	e8 83 f3 ff ff       	call   14fe <close>
+    217b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    217e:	85 c0                	test   %eax,%eax
+    2180:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2185:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2188:	8b 43 18             	mov    0x18(%ebx),%eax
+    218b:	85 c0                	test   %eax,%eax
+    218d:	0f 95 c1             	setne  %cl
+    2190:	3d 80 33 00 00       	cmp    $0x3380,%eax
+    2195:	0f 95 c2             	setne  %dl
+    2198:	84 d1                	test   %dl,%cl
+    219a:	74 07                	je     21a3 <fclose+0x43>
+    219c:	3d 80 2f 00 00       	cmp    $0x2f80,%eax
+    21a1:	75 25                	jne    21c8 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    21a3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    21aa:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    21ac:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    21b3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    21ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    21bd:	5b                   	pop    %ebx
+    21be:	5e                   	pop    %esi
+    21bf:	5d                   	pop    %ebp
+    21c0:	c3                   	ret
+    21c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    21c8:	83 ec 0c             	sub    $0xc,%esp
+    21cb:	50                   	push   %eax
+    21cc:	e8 3f 00 00 00       	call   2210 <free>
+    21d1:	83 c4 10             	add    $0x10,%esp
+    21d4:	eb cd                	jmp    21a3 <fclose+0x43>
+    21d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    21dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000021e0 <feof>:
+
+int
+feof(FILE *f)
+{
+    21e0:	55                   	push   %ebp
+    21e1:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    21e3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    21e6:	5d                   	pop    %ebp
+  return f->eof;
+    21e7:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    21ea:	c3                   	ret
+    21eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21ef:	90                   	nop
+
+000021f0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    21f0:	55                   	push   %ebp
+    21f1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    21f3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    21f6:	5d                   	pop    %ebp
+  return f->err;
+    21f7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    21fa:	c3                   	ret
+    21fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21ff:	90                   	nop
+
+00002200 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    2200:	55                   	push   %ebp
+    2201:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    2203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2206:	5d                   	pop    %ebp
+  return f->fd;
+    2207:	8b 00                	mov    (%eax),%eax
+}
+    2209:	c3                   	ret
+    220a:	66 90                	xchg   %ax,%ax
+    220c:	66 90                	xchg   %ax,%ax
+    220e:	66 90                	xchg   %ax,%ax
+
+00002210 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2210:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2211:	a1 80 37 00 00       	mov    0x3780,%eax
+{
+    2216:	89 e5                	mov    %esp,%ebp
+    2218:	57                   	push   %edi
+    2219:	56                   	push   %esi
+    221a:	53                   	push   %ebx
+    221b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    221e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2228:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    222a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    222c:	39 ca                	cmp    %ecx,%edx
+    222e:	73 30                	jae    2260 <free+0x50>
+    2230:	39 c1                	cmp    %eax,%ecx
+    2232:	72 04                	jb     2238 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2234:	39 c2                	cmp    %eax,%edx
+    2236:	72 f0                	jb     2228 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2238:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    223b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    223e:	39 f8                	cmp    %edi,%eax
+    2240:	74 2e                	je     2270 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2242:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2245:	8b 42 04             	mov    0x4(%edx),%eax
+    2248:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    224b:	39 f1                	cmp    %esi,%ecx
+    224d:	74 38                	je     2287 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    224f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2251:	5b                   	pop    %ebx
+  freep = p;
+    2252:	89 15 80 37 00 00    	mov    %edx,0x3780
+}
+    2258:	5e                   	pop    %esi
+    2259:	5f                   	pop    %edi
+    225a:	5d                   	pop    %ebp
+    225b:	c3                   	ret
+    225c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2260:	39 c1                	cmp    %eax,%ecx
+    2262:	72 d0                	jb     2234 <free+0x24>
+    2264:	eb c2                	jmp    2228 <free+0x18>
+    2266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    226d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2270:	03 70 04             	add    0x4(%eax),%esi
+    2273:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2276:	8b 02                	mov    (%edx),%eax
+    2278:	8b 00                	mov    (%eax),%eax
+    227a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    227d:	8b 42 04             	mov    0x4(%edx),%eax
+    2280:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2283:	39 f1                	cmp    %esi,%ecx
+    2285:	75 c8                	jne    224f <free+0x3f>
+    p->s.size += bp->s.size;
+    2287:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    228a:	89 15 80 37 00 00    	mov    %edx,0x3780
+    p->s.size += bp->s.size;
+    2290:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2293:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2296:	89 0a                	mov    %ecx,(%edx)
+}
+    2298:	5b                   	pop    %ebx
+    2299:	5e                   	pop    %esi
+    229a:	5f                   	pop    %edi
+    229b:	5d                   	pop    %ebp
+    229c:	c3                   	ret
+    229d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000022a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    22a0:	55                   	push   %ebp
+    22a1:	89 e5                	mov    %esp,%ebp
+    22a3:	57                   	push   %edi
+    22a4:	56                   	push   %esi
+    22a5:	53                   	push   %ebx
+    22a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    22a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    22ac:	8b 15 80 37 00 00    	mov    0x3780,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    22b2:	8d 78 07             	lea    0x7(%eax),%edi
+    22b5:	c1 ef 03             	shr    $0x3,%edi
+    22b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    22bb:	85 d2                	test   %edx,%edx
+    22bd:	0f 84 8d 00 00 00    	je     2350 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    22c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    22c5:	8b 48 04             	mov    0x4(%eax),%ecx
+    22c8:	39 f9                	cmp    %edi,%ecx
+    22ca:	73 64                	jae    2330 <malloc+0x90>
+  if(nu < 4096)
+    22cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    22d1:	39 df                	cmp    %ebx,%edi
+    22d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    22d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    22dd:	eb 0a                	jmp    22e9 <malloc+0x49>
+    22df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    22e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    22e2:	8b 48 04             	mov    0x4(%eax),%ecx
+    22e5:	39 f9                	cmp    %edi,%ecx
+    22e7:	73 47                	jae    2330 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    22e9:	89 c2                	mov    %eax,%edx
+    22eb:	39 05 80 37 00 00    	cmp    %eax,0x3780
+    22f1:	75 ed                	jne    22e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    22f3:	83 ec 0c             	sub    $0xc,%esp
+    22f6:	56                   	push   %esi
+    22f7:	e8 b6 f2 ff ff       	call   15b2 <sbrk>
+  if(p == (char*)-1)
+    22fc:	83 c4 10             	add    $0x10,%esp
+    22ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2302:	74 1c                	je     2320 <malloc+0x80>
+  hp->s.size = nu;
+    2304:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2307:	83 ec 0c             	sub    $0xc,%esp
+    230a:	83 c0 08             	add    $0x8,%eax
+    230d:	50                   	push   %eax
+    230e:	e8 fd fe ff ff       	call   2210 <free>
+  return freep;
+    2313:	8b 15 80 37 00 00    	mov    0x3780,%edx
+      if((p = morecore(nunits)) == 0)
+    2319:	83 c4 10             	add    $0x10,%esp
+    231c:	85 d2                	test   %edx,%edx
+    231e:	75 c0                	jne    22e0 <malloc+0x40>
+        return 0;
+  }
+}
+    2320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2323:	31 c0                	xor    %eax,%eax
+}
+    2325:	5b                   	pop    %ebx
+    2326:	5e                   	pop    %esi
+    2327:	5f                   	pop    %edi
+    2328:	5d                   	pop    %ebp
+    2329:	c3                   	ret
+    232a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2330:	39 cf                	cmp    %ecx,%edi
+    2332:	74 4c                	je     2380 <malloc+0xe0>
+        p->s.size -= nunits;
+    2334:	29 f9                	sub    %edi,%ecx
+    2336:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2339:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    233c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    233f:	89 15 80 37 00 00    	mov    %edx,0x3780
+}
+    2345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2348:	83 c0 08             	add    $0x8,%eax
+}
+    234b:	5b                   	pop    %ebx
+    234c:	5e                   	pop    %esi
+    234d:	5f                   	pop    %edi
+    234e:	5d                   	pop    %ebp
+    234f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2350:	c7 05 80 37 00 00 84 	movl   $0x3784,0x3780
+    2357:	37 00 00 
+    base.s.size = 0;
+    235a:	b8 84 37 00 00       	mov    $0x3784,%eax
+    base.s.ptr = freep = prevp = &base;
+    235f:	c7 05 84 37 00 00 84 	movl   $0x3784,0x3784
+    2366:	37 00 00 
+    base.s.size = 0;
+    2369:	c7 05 88 37 00 00 00 	movl   $0x0,0x3788
+    2370:	00 00 00 
+    if(p->s.size >= nunits){
+    2373:	e9 54 ff ff ff       	jmp    22cc <malloc+0x2c>
+    2378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    237f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2380:	8b 08                	mov    (%eax),%ecx
+    2382:	89 0a                	mov    %ecx,(%edx)
+    2384:	eb b9                	jmp    233f <malloc+0x9f>
@@ -0,0 +1,2662 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00001000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+    1000:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    1004:	83 e4 f0             	and    $0xfffffff0,%esp
+    1007:	ff 71 fc             	push   -0x4(%ecx)
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	51                   	push   %ecx
+    100e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+    1011:	e8 ca 02 00 00       	call   12e0 <fork>
+    1016:	85 c0                	test   %eax,%eax
+    1018:	7e 0d                	jle    1027 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+    101a:	83 ec 0c             	sub    $0xc,%esp
+    101d:	6a 05                	push   $0x5
+    101f:	e8 4d 04 00 00       	call   1471 <sleep>
+    1024:	83 c4 10             	add    $0x10,%esp
+  exit();
+    1027:	e8 e4 02 00 00       	call   1310 <exit>
+    102c:	66 90                	xchg   %ax,%ax
+    102e:	66 90                	xchg   %ax,%ax
+
+00001030 <strcpy>:
+#include "x86.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1030:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1031:	31 c0                	xor    %eax,%eax
+{
+    1033:	89 e5                	mov    %esp,%ebp
+    1035:	53                   	push   %ebx
+    1036:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1039:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    103c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1040:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1044:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1047:	83 c0 01             	add    $0x1,%eax
+    104a:	84 d2                	test   %dl,%dl
+    104c:	75 f2                	jne    1040 <strcpy+0x10>
+    ;
+  return os;
+}
+    104e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1051:	89 c8                	mov    %ecx,%eax
+    1053:	c9                   	leave
+    1054:	c3                   	ret
+    1055:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	53                   	push   %ebx
+    1064:	8b 55 08             	mov    0x8(%ebp),%edx
+    1067:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    106a:	0f b6 02             	movzbl (%edx),%eax
+    106d:	84 c0                	test   %al,%al
+    106f:	75 17                	jne    1088 <strcmp+0x28>
+    1071:	eb 3a                	jmp    10ad <strcmp+0x4d>
+    1073:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1077:	90                   	nop
+    1078:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    107c:	83 c2 01             	add    $0x1,%edx
+    107f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1082:	84 c0                	test   %al,%al
+    1084:	74 1a                	je     10a0 <strcmp+0x40>
+    p++, q++;
+    1086:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1088:	0f b6 19             	movzbl (%ecx),%ebx
+    108b:	38 c3                	cmp    %al,%bl
+    108d:	74 e9                	je     1078 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    108f:	29 d8                	sub    %ebx,%eax
+}
+    1091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1094:	c9                   	leave
+    1095:	c3                   	ret
+    1096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10a4:	31 c0                	xor    %eax,%eax
+    10a6:	29 d8                	sub    %ebx,%eax
+}
+    10a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10ab:	c9                   	leave
+    10ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10ad:	0f b6 19             	movzbl (%ecx),%ebx
+    10b0:	31 c0                	xor    %eax,%eax
+    10b2:	eb db                	jmp    108f <strcmp+0x2f>
+    10b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+
+000010c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    10c6:	80 3a 00             	cmpb   $0x0,(%edx)
+    10c9:	74 15                	je     10e0 <strlen+0x20>
+    10cb:	31 c0                	xor    %eax,%eax
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+    10d0:	83 c0 01             	add    $0x1,%eax
+    10d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    10d7:	89 c1                	mov    %eax,%ecx
+    10d9:	75 f5                	jne    10d0 <strlen+0x10>
+    ;
+  return n;
+}
+    10db:	89 c8                	mov    %ecx,%eax
+    10dd:	5d                   	pop    %ebp
+    10de:	c3                   	ret
+    10df:	90                   	nop
+  for(n = 0; s[n]; n++)
+    10e0:	31 c9                	xor    %ecx,%ecx
+}
+    10e2:	5d                   	pop    %ebp
+    10e3:	89 c8                	mov    %ecx,%eax
+    10e5:	c3                   	ret
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    10f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    10fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10fd:	89 d7                	mov    %edx,%edi
+    10ff:	fc                   	cld
+    1100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1105:	89 d0                	mov    %edx,%eax
+    1107:	c9                   	leave
+    1108:	c3                   	ret
+    1109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	8b 45 08             	mov    0x8(%ebp),%eax
+    1116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    111a:	0f b6 10             	movzbl (%eax),%edx
+    111d:	84 d2                	test   %dl,%dl
+    111f:	75 12                	jne    1133 <strchr+0x23>
+    1121:	eb 1d                	jmp    1140 <strchr+0x30>
+    1123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1127:	90                   	nop
+    1128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    112c:	83 c0 01             	add    $0x1,%eax
+    112f:	84 d2                	test   %dl,%dl
+    1131:	74 0d                	je     1140 <strchr+0x30>
+    if(*s == c)
+    1133:	38 d1                	cmp    %dl,%cl
+    1135:	75 f1                	jne    1128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1137:	5d                   	pop    %ebp
+    1138:	c3                   	ret
+    1139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1140:	31 c0                	xor    %eax,%eax
+}
+    1142:	5d                   	pop    %ebp
+    1143:	c3                   	ret
+    1144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+
+00001150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1159:	31 db                	xor    %ebx,%ebx
+{
+    115b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    115e:	eb 27                	jmp    1187 <gets+0x37>
+    cc = read(0, &c, 1);
+    1160:	83 ec 04             	sub    $0x4,%esp
+    1163:	6a 01                	push   $0x1
+    1165:	56                   	push   %esi
+    1166:	6a 00                	push   $0x0
+    1168:	e8 23 02 00 00       	call   1390 <read>
+    if(cc < 1)
+    116d:	83 c4 10             	add    $0x10,%esp
+    1170:	85 c0                	test   %eax,%eax
+    1172:	7e 1d                	jle    1191 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1178:	8b 55 08             	mov    0x8(%ebp),%edx
+    117b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    117f:	3c 0a                	cmp    $0xa,%al
+    1181:	74 10                	je     1193 <gets+0x43>
+    1183:	3c 0d                	cmp    $0xd,%al
+    1185:	74 0c                	je     1193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1187:	89 df                	mov    %ebx,%edi
+    1189:	83 c3 01             	add    $0x1,%ebx
+    118c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    118f:	7c cf                	jl     1160 <gets+0x10>
+    1191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1193:	8b 45 08             	mov    0x8(%ebp),%eax
+    1196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    119a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    119d:	5b                   	pop    %ebx
+    119e:	5e                   	pop    %esi
+    119f:	5f                   	pop    %edi
+    11a0:	5d                   	pop    %ebp
+    11a1:	c3                   	ret
+    11a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	56                   	push   %esi
+    11b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11b5:	83 ec 08             	sub    $0x8,%esp
+    11b8:	6a 00                	push   $0x0
+    11ba:	ff 75 08             	push   0x8(%ebp)
+    11bd:	e8 19 02 00 00       	call   13db <open>
+  if(fd < 0)
+    11c2:	83 c4 10             	add    $0x10,%esp
+    11c5:	85 c0                	test   %eax,%eax
+    11c7:	78 27                	js     11f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    11c9:	83 ec 08             	sub    $0x8,%esp
+    11cc:	ff 75 0c             	push   0xc(%ebp)
+    11cf:	89 c3                	mov    %eax,%ebx
+    11d1:	50                   	push   %eax
+    11d2:	e8 31 02 00 00       	call   1408 <fstat>
+  close(fd);
+    11d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    11da:	89 c6                	mov    %eax,%esi
+  close(fd);
+    11dc:	e8 cd 01 00 00       	call   13ae <close>
+  return r;
+    11e1:	83 c4 10             	add    $0x10,%esp
+}
+    11e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11e7:	89 f0                	mov    %esi,%eax
+    11e9:	5b                   	pop    %ebx
+    11ea:	5e                   	pop    %esi
+    11eb:	5d                   	pop    %ebp
+    11ec:	c3                   	ret
+    11ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    11f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    11f5:	eb ed                	jmp    11e4 <stat+0x34>
+    11f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fe:	66 90                	xchg   %ax,%ax
+
+00001200 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	53                   	push   %ebx
+    1204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1207:	0f be 02             	movsbl (%edx),%eax
+    120a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    120d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1215:	77 1e                	ja     1235 <atoi+0x35>
+    1217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1220:	83 c2 01             	add    $0x1,%edx
+    1223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    122a:	0f be 02             	movsbl (%edx),%eax
+    122d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1230:	80 fb 09             	cmp    $0x9,%bl
+    1233:	76 eb                	jbe    1220 <atoi+0x20>
+  return n;
+}
+    1235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1238:	89 c8                	mov    %ecx,%eax
+    123a:	c9                   	leave
+    123b:	c3                   	ret
+    123c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	8b 45 10             	mov    0x10(%ebp),%eax
+    1248:	8b 55 08             	mov    0x8(%ebp),%edx
+    124b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    124e:	85 c0                	test   %eax,%eax
+    1250:	7e 13                	jle    1265 <memmove+0x25>
+    1252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1254:	89 d7                	mov    %edx,%edi
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1261:	39 f8                	cmp    %edi,%eax
+    1263:	75 fb                	jne    1260 <memmove+0x20>
+  return vdst;
+}
+    1265:	5e                   	pop    %esi
+    1266:	89 d0                	mov    %edx,%eax
+    1268:	5f                   	pop    %edi
+    1269:	5d                   	pop    %ebp
+    126a:	c3                   	ret
+    126b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    126f:	90                   	nop
+
+00001270 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	56                   	push   %esi
+    1274:	53                   	push   %ebx
+    1275:	8b 75 10             	mov    0x10(%ebp),%esi
+    1278:	8b 55 08             	mov    0x8(%ebp),%edx
+    127b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    127e:	85 f6                	test   %esi,%esi
+    1280:	74 2e                	je     12b0 <memcmp+0x40>
+    1282:	01 c6                	add    %eax,%esi
+    1284:	eb 14                	jmp    129a <memcmp+0x2a>
+    1286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    1290:	83 c0 01             	add    $0x1,%eax
+    1293:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    1296:	39 f0                	cmp    %esi,%eax
+    1298:	74 16                	je     12b0 <memcmp+0x40>
+    if(*s1 != *s2)
+    129a:	0f b6 0a             	movzbl (%edx),%ecx
+    129d:	0f b6 18             	movzbl (%eax),%ebx
+    12a0:	38 d9                	cmp    %bl,%cl
+    12a2:	74 ec                	je     1290 <memcmp+0x20>
+      return *s1 - *s2;
+    12a4:	0f b6 c1             	movzbl %cl,%eax
+    12a7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    12a9:	5b                   	pop    %ebx
+    12aa:	5e                   	pop    %esi
+    12ab:	5d                   	pop    %ebp
+    12ac:	c3                   	ret
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+    12b0:	5b                   	pop    %ebx
+  return 0;
+    12b1:	31 c0                	xor    %eax,%eax
+}
+    12b3:	5e                   	pop    %esi
+    12b4:	5d                   	pop    %ebp
+    12b5:	c3                   	ret
+    12b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012c0 <ugetpid>:
+// getpid() and uptime() without a system call, reading the
+// pages described in upage.h.
+int
+ugetpid(void)
+{
+  return ((volatile struct uproc*)UPROC)->pid;
+    12c0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    12c5:	c3                   	ret
+    12c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012d0 <uuptime>:
+
+uint
+uuptime(void)
+{
+  return ((volatile struct uticks*)UTICKS)->ticks;
+    12d0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+}
+    12d5:	c3                   	ret
+    12d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012e0 <fork>:
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    12e0:	a1 a0 2b 00 00       	mov    0x2ba0,%eax
+    12e5:	85 c0                	test   %eax,%eax
+    12e7:	74 17                	je     1300 <fork+0x20>
+{
+    12e9:	55                   	push   %ebp
+    12ea:	89 e5                	mov    %esp,%ebp
+    12ec:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    12ef:	ff d0                	call   *%eax
+  return _fork();
+}
+    12f1:	c9                   	leave
+  return _fork();
+    12f2:	e9 5d 00 00 00       	jmp    1354 <_fork>
+    12f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fe:	66 90                	xchg   %ax,%ax
+    1300:	e9 4f 00 00 00       	jmp    1354 <_fork>
+    1305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001310 <exit>:
+
+int
+exit(void)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    1316:	a1 a0 2b 00 00       	mov    0x2ba0,%eax
+    131b:	85 c0                	test   %eax,%eax
+    131d:	74 02                	je     1321 <exit+0x11>
+    flushhook();
+    131f:	ff d0                	call   *%eax
+  _exit();
+    1321:	e8 3d 00 00 00       	call   1363 <_exit>
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001330 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1330:	55                   	push   %ebp
+  if(flushhook)
+    1331:	a1 a0 2b 00 00       	mov    0x2ba0,%eax
+{
+    1336:	89 e5                	mov    %esp,%ebp
+    1338:	56                   	push   %esi
+    1339:	53                   	push   %ebx
+    133a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    133d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    1340:	85 c0                	test   %eax,%eax
+    1342:	74 02                	je     1346 <exec+0x16>
+    flushhook();
+    1344:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1346:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1349:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    134c:	5b                   	pop    %ebx
+    134d:	5e                   	pop    %esi
+    134e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    134f:	e9 78 00 00 00       	jmp    13cc <_exec>
+
+00001354 <_fork>:
+  int ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    1354:	b8 01 00 00 00       	mov    $0x1,%eax
+    1359:	89 e1                	mov    %esp,%ecx
+    135b:	ba 62 13 00 00       	mov    $0x1362,%edx
+    1360:	0f 34                	sysenter
+    1362:	c3                   	ret
+
+00001363 <_exit>:
+RAWSYSCALL(exit)
+    1363:	b8 02 00 00 00       	mov    $0x2,%eax
+    1368:	89 e1                	mov    %esp,%ecx
+    136a:	ba 71 13 00 00       	mov    $0x1371,%edx
+    136f:	0f 34                	sysenter
+    1371:	c3                   	ret
+
+00001372 <wait>:
+SYSCALL(wait)
+    1372:	b8 03 00 00 00       	mov    $0x3,%eax
+    1377:	89 e1                	mov    %esp,%ecx
+    1379:	ba 80 13 00 00       	mov    $0x1380,%edx
+    137e:	0f 34                	sysenter
+    1380:	c3                   	ret
+
+00001381 <pipe>:
+SYSCALL(pipe)
+    1381:	b8 04 00 00 00       	mov    $0x4,%eax
+    1386:	89 e1                	mov    %esp,%ecx
+    1388:	ba 8f 13 00 00       	mov    $0x138f,%edx
+    138d:	0f 34                	sysenter
+    138f:	c3                   	ret
+
+00001390 <read>:
+SYSCALL(read)
+    1390:	b8 05 00 00 00       	mov    $0x5,%eax
+    1395:	89 e1                	mov    %esp,%ecx
+    1397:	ba 9e 13 00 00       	mov    $0x139e,%edx
+    139c:	0f 34                	sysenter
+    139e:	c3                   	ret
+
+0000139f <write>:
+SYSCALL(write)
+    139f:	b8 10 00 00 00       	mov    $0x10,%eax
+    13a4:	89 e1                	mov    %esp,%ecx
+    13a6:	ba ad 13 00 00       	mov    $0x13ad,%edx
+    13ab:	0f 34                	sysenter
+    13ad:	c3                   	ret
+
+000013ae <close>:
+SYSCALL(close)
+    13ae:	b8 15 00 00 00       	mov    $0x15,%eax
+    13b3:	89 e1                	mov    %esp,%ecx
+    13b5:	ba bc 13 00 00       	mov    $0x13bc,%edx
+    13ba:	0f 34                	sysenter
+    13bc:	c3                   	ret
+
+000013bd <kill>:
+SYSCALL(kill)
+    13bd:	b8 06 00 00 00       	mov    $0x6,%eax
+    13c2:	89 e1                	mov    %esp,%ecx
+    13c4:	ba cb 13 00 00       	mov    $0x13cb,%edx
+    13c9:	0f 34                	sysenter
+    13cb:	c3                   	ret
+
+000013cc <_exec>:
+RAWSYSCALL(exec)
+    13cc:	b8 07 00 00 00       	mov    $0x7,%eax
+    13d1:	89 e1                	mov    %esp,%ecx
+    13d3:	ba da 13 00 00       	mov    $0x13da,%edx
+    13d8:	0f 34                	sysenter
+    13da:	c3                   	ret
+
+000013db <open>:
+SYSCALL(open)
+    13db:	b8 0f 00 00 00       	mov    $0xf,%eax
+    13e0:	89 e1                	mov    %esp,%ecx
+    13e2:	ba e9 13 00 00       	mov    $0x13e9,%edx
+    13e7:	0f 34                	sysenter
+    13e9:	c3                   	ret
+
+000013ea <mknod>:
+SYSCALL(mknod)
+    13ea:	b8 11 00 00 00       	mov    $0x11,%eax
+    13ef:	89 e1                	mov    %esp,%ecx
+    13f1:	ba f8 13 00 00       	mov    $0x13f8,%edx
+    13f6:	0f 34                	sysenter
+    13f8:	c3                   	ret
+
+000013f9 <unlink>:
+SYSCALL(unlink)
+    13f9:	b8 12 00 00 00       	mov    $0x12,%eax
+    13fe:	89 e1                	mov    %esp,%ecx
+    1400:	ba 07 14 00 00       	mov    $0x1407,%edx
+    1405:	0f 34                	sysenter
+    1407:	c3                   	ret
+
+00001408 <fstat>:
+SYSCALL(fstat)
+    1408:	b8 08 00 00 00       	mov    $0x8,%eax
+    140d:	89 e1                	mov    %esp,%ecx
+    140f:	ba 16 14 00 00       	mov    $0x1416,%edx
+    1414:	0f 34                	sysenter
+    1416:	c3                   	ret
+
+00001417 <link>:
+SYSCALL(link)
+    1417:	b8 13 00 00 00       	mov    $0x13,%eax
+    141c:	89 e1                	mov    %esp,%ecx
+    141e:	ba 25 14 00 00       	mov    $0x1425,%edx
+    1423:	0f 34                	sysenter
+    1425:	c3                   	ret
+
+00001426 <mkdir>:
+SYSCALL(mkdir)
+    1426:	b8 14 00 00 00       	mov    $0x14,%eax
+    142b:	89 e1                	mov    %esp,%ecx
+    142d:	ba 34 14 00 00       	mov    $0x1434,%edx
+    1432:	0f 34                	sysenter
+    1434:	c3                   	ret
+
+00001435 <chdir>:
+SYSCALL(chdir)
+    1435:	b8 09 00 00 00       	mov    $0x9,%eax
+    143a:	89 e1                	mov    %esp,%ecx
+    143c:	ba 43 14 00 00       	mov    $0x1443,%edx
+    1441:	0f 34                	sysenter
+    1443:	c3                   	ret
+
+00001444 <dup>:
+SYSCALL(dup)
+    1444:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1449:	89 e1                	mov    %esp,%ecx
+    144b:	ba 52 14 00 00       	mov    $0x1452,%edx
+    1450:	0f 34                	sysenter
+    1452:	c3                   	ret
+
+00001453 <getpid>:
+SYSCALL(getpid)
+    1453:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1458:	89 e1                	mov    %esp,%ecx
+    145a:	ba 61 14 00 00       	mov    $0x1461,%edx
+    145f:	0f 34                	sysenter
+    1461:	c3                   	ret
+
+00001462 <sbrk>:
+SYSCALL(sbrk)
+    1462:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1467:	89 e1                	mov    %esp,%ecx
+    1469:	ba 70 14 00 00       	mov    $0x1470,%edx
+    146e:	0f 34                	sysenter
+    1470:	c3                   	ret
+
+00001471 <sleep>:
+SYSCALL(sleep)
+    1471:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1476:	89 e1                	mov    %esp,%ecx
+    1478:	ba 7f 14 00 00       	mov    $0x147f,%edx
+    147d:	0f 34                	sysenter
+    147f:	c3                   	ret
+
+00001480 <uptime>:
+SYSCALL(uptime)
+    1480:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1485:	89 e1                	mov    %esp,%ecx
+    1487:	ba 8e 14 00 00       	mov    $0x148e,%edx
+    148c:	0f 34                	sysenter
+    148e:	c3                   	ret
+
+0000148f <mprotect>:
+SYSCALL(mprotect)
+    148f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1494:	89 e1                	mov    %esp,%ecx
+    1496:	ba 9d 14 00 00       	mov    $0x149d,%edx
+    149b:	0f 34                	sysenter
+    149d:	c3                   	ret
+
+0000149e <munprotect>:
+SYSCALL(munprotect)
+    149e:	b8 17 00 00 00       	mov    $0x17,%eax
+    14a3:	89 e1                	mov    %esp,%ecx
+    14a5:	ba ac 14 00 00       	mov    $0x14ac,%edx
+    14aa:	0f 34                	sysenter
+    14ac:	c3                   	ret
+
+000014ad <kstat>:
+SYSCALL(kstat)
+    14ad:	b8 18 00 00 00       	mov    $0x18,%eax
+    14b2:	89 e1                	mov    %esp,%ecx
+    14b4:	ba bb 14 00 00       	mov    $0x14bb,%edx
+    14b9:	0f 34                	sysenter
+    14bb:	c3                   	ret
+
+000014bc <fcntl>:
+SYSCALL(fcntl)
+    14bc:	b8 19 00 00 00       	mov    $0x19,%eax
+    14c1:	89 e1                	mov    %esp,%ecx
+    14c3:	ba ca 14 00 00       	mov    $0x14ca,%edx
+    14c8:	0f 34                	sysenter
+    14ca:	c3                   	ret
+
+000014cb <splice>:
+SYSCALL(splice)
+    14cb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14d0:	89 e1                	mov    %esp,%ecx
+    14d2:	ba d9 14 00 00       	mov    $0x14d9,%edx
+    14d7:	0f 34                	sysenter
+    14d9:	c3                   	ret
+
+000014da <sendfile>:
+SYSCALL(sendfile)
+    14da:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    14df:	89 e1                	mov    %esp,%ecx
+    14e1:	ba e8 14 00 00       	mov    $0x14e8,%edx
+    14e6:	0f 34                	sysenter
+    14e8:	c3                   	ret
+
+000014e9 <lseek>:
+SYSCALL(lseek)
+    14e9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    14ee:	89 e1                	mov    %esp,%ecx
+    14f0:	ba f7 14 00 00       	mov    $0x14f7,%edx
+    14f5:	0f 34                	sysenter
+    14f7:	c3                   	ret
+
+000014f8 <pread>:
+SYSCALL(pread)
+    14f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    14fd:	89 e1                	mov    %esp,%ecx
+    14ff:	ba 06 15 00 00       	mov    $0x1506,%edx
+    1504:	0f 34                	sysenter
+    1506:	c3                   	ret
+
+00001507 <pwrite>:
+SYSCALL(pwrite)
+    1507:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    150c:	89 e1                	mov    %esp,%ecx
+    150e:	ba 15 15 00 00       	mov    $0x1515,%edx
+    1513:	0f 34                	sysenter
+    1515:	c3                   	ret
+
+00001516 <readv>:
+SYSCALL(readv)
+    1516:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    151b:	89 e1                	mov    %esp,%ecx
+    151d:	ba 24 15 00 00       	mov    $0x1524,%edx
+    1522:	0f 34                	sysenter
+    1524:	c3                   	ret
+
+00001525 <writev>:
+SYSCALL(writev)
+    1525:	b8 20 00 00 00       	mov    $0x20,%eax
+    152a:	89 e1                	mov    %esp,%ecx
+    152c:	ba 33 15 00 00       	mov    $0x1533,%edx
+    1531:	0f 34                	sysenter
+    1533:	c3                   	ret
+
+00001534 <ringsetup>:
+SYSCALL(ringsetup)
+    1534:	b8 21 00 00 00       	mov    $0x21,%eax
+    1539:	89 e1                	mov    %esp,%ecx
+    153b:	ba 42 15 00 00       	mov    $0x1542,%edx
+    1540:	0f 34                	sysenter
+    1542:	c3                   	ret
+
+00001543 <ringenter>:
+SYSCALL(ringenter)
+    1543:	b8 22 00 00 00       	mov    $0x22,%eax
+    1548:	89 e1                	mov    %esp,%ecx
+    154a:	ba 51 15 00 00       	mov    $0x1551,%edx
+    154f:	0f 34                	sysenter
+    1551:	c3                   	ret
+
+00001552 <intgetpid>:
+INTSYSCALL(getpid)
+    1552:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1557:	cd 40                	int    $0x40
+    1559:	c3                   	ret
+    155a:	66 90                	xchg   %ax,%ax
+    155c:	66 90                	xchg   %ax,%ax
+    155e:	66 90                	xchg   %ax,%ax
+
+00001560 <printint>:
+  o->buf[o->n++] = c;
+}
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    1560:	55                   	push   %ebp
+    1561:	89 e5                	mov    %esp,%ebp
+    1563:	57                   	push   %edi
+    1564:	56                   	push   %esi
+    1565:	53                   	push   %ebx
+    1566:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1568:	89 d1                	mov    %edx,%ecx
+{
+    156a:	83 ec 2c             	sub    $0x2c,%esp
+    156d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    1570:	85 d2                	test   %edx,%edx
+    1572:	0f 89 c0 00 00 00    	jns    1638 <printint+0xd8>
+    1578:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    157c:	0f 84 b6 00 00 00    	je     1638 <printint+0xd8>
+    x = -xx;
+    1582:	f7 d9                	neg    %ecx
+    neg = 1;
+    1584:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1589:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    158c:	31 f6                	xor    %esi,%esi
+    158e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    1590:	89 c8                	mov    %ecx,%eax
+    1592:	31 d2                	xor    %edx,%edx
+    1594:	89 f7                	mov    %esi,%edi
+    1596:	f7 f3                	div    %ebx
+    1598:	8d 76 01             	lea    0x1(%esi),%esi
+    159b:	0f b6 92 98 22 00 00 	movzbl 0x2298(%edx),%edx
+    15a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    15a6:	89 ca                	mov    %ecx,%edx
+    15a8:	89 c1                	mov    %eax,%ecx
+    15aa:	39 da                	cmp    %ebx,%edx
+    15ac:	73 e2                	jae    1590 <printint+0x30>
+  if(neg)
+    15ae:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    15b1:	85 c0                	test   %eax,%eax
+    15b3:	74 07                	je     15bc <printint+0x5c>
+    buf[i++] = '-';
+    15b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    15ba:	89 f7                	mov    %esi,%edi
+  if(o->n == sizeof(o->buf))
+    15bc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    15bf:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    15c2:	01 df                	add    %ebx,%edi
+    fwrite(o->buf, 1, o->n, o->f);
+    15c4:	8d 71 0c             	lea    0xc(%ecx),%esi
+  if(o->n == sizeof(o->buf))
+    15c7:	8b 41 08             	mov    0x8(%ecx),%eax
+    15ca:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    15cd:	89 ce                	mov    %ecx,%esi
+    15cf:	eb 1c                	jmp    15ed <printint+0x8d>
+    15d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  o->buf[o->n++] = c;
+    15d8:	89 c1                	mov    %eax,%ecx
+    15da:	83 c0 01             	add    $0x1,%eax
+    15dd:	89 46 08             	mov    %eax,0x8(%esi)
+    15e0:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+
+  while(--i >= 0)
+    15e4:	8d 57 ff             	lea    -0x1(%edi),%edx
+    15e7:	39 df                	cmp    %ebx,%edi
+    15e9:	74 41                	je     162c <printint+0xcc>
+    15eb:	89 d7                	mov    %edx,%edi
+    putc(o, buf[i]);
+    15ed:	0f b6 17             	movzbl (%edi),%edx
+  if(o->n == sizeof(o->buf))
+    15f0:	3d 80 00 00 00       	cmp    $0x80,%eax
+    15f5:	75 e1                	jne    15d8 <printint+0x78>
+  if(o->f)
+    15f7:	8b 06                	mov    (%esi),%eax
+    15f9:	88 55 d0             	mov    %dl,-0x30(%ebp)
+    15fc:	85 c0                	test   %eax,%eax
+    15fe:	74 40                	je     1640 <printint+0xe0>
+    fwrite(o->buf, 1, o->n, o->f);
+    1600:	50                   	push   %eax
+    1601:	68 80 00 00 00       	push   $0x80
+    1606:	6a 01                	push   $0x1
+    1608:	ff 75 d4             	push   -0x2c(%ebp)
+    160b:	e8 a0 04 00 00       	call   1ab0 <fwrite>
+    1610:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1614:	83 c4 10             	add    $0x10,%esp
+}
+    1617:	b8 01 00 00 00       	mov    $0x1,%eax
+    161c:	31 c9                	xor    %ecx,%ecx
+  o->buf[o->n++] = c;
+    161e:	89 46 08             	mov    %eax,0x8(%esi)
+    1621:	88 54 0e 0c          	mov    %dl,0xc(%esi,%ecx,1)
+  while(--i >= 0)
+    1625:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1628:	39 df                	cmp    %ebx,%edi
+    162a:	75 bf                	jne    15eb <printint+0x8b>
+}
+    162c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    162f:	5b                   	pop    %ebx
+    1630:	5e                   	pop    %esi
+    1631:	5f                   	pop    %edi
+    1632:	5d                   	pop    %ebp
+    1633:	c3                   	ret
+    1634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1638:	31 c0                	xor    %eax,%eax
+    163a:	e9 4a ff ff ff       	jmp    1589 <printint+0x29>
+    163f:	90                   	nop
+    write(o->fd, o->buf, o->n);
+    1640:	83 ec 04             	sub    $0x4,%esp
+    1643:	68 80 00 00 00       	push   $0x80
+    1648:	ff 75 d4             	push   -0x2c(%ebp)
+    164b:	ff 76 04             	push   0x4(%esi)
+    164e:	e8 4c fd ff ff       	call   139f <write>
+    1653:	0f b6 55 d0          	movzbl -0x30(%ebp),%edx
+    1657:	83 c4 10             	add    $0x10,%esp
+    165a:	eb bb                	jmp    1617 <printint+0xb7>
+    165c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001660 <putc>:
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	56                   	push   %esi
+    1664:	89 d6                	mov    %edx,%esi
+    1666:	53                   	push   %ebx
+    1667:	89 c3                	mov    %eax,%ebx
+  if(o->n == sizeof(o->buf))
+    1669:	8b 40 08             	mov    0x8(%eax),%eax
+    166c:	3d 80 00 00 00       	cmp    $0x80,%eax
+    1671:	74 1d                	je     1690 <putc+0x30>
+  o->buf[o->n++] = c;
+    1673:	89 f1                	mov    %esi,%ecx
+    1675:	8d 50 01             	lea    0x1(%eax),%edx
+    1678:	89 53 08             	mov    %edx,0x8(%ebx)
+    167b:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    167f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1682:	5b                   	pop    %ebx
+    1683:	5e                   	pop    %esi
+    1684:	5d                   	pop    %ebp
+    1685:	c3                   	ret
+    1686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    168d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(o->f)
+    1690:	8b 03                	mov    (%ebx),%eax
+    fwrite(o->buf, 1, o->n, o->f);
+    1692:	8d 53 0c             	lea    0xc(%ebx),%edx
+  if(o->f)
+    1695:	85 c0                	test   %eax,%eax
+    1697:	74 2f                	je     16c8 <putc+0x68>
+    fwrite(o->buf, 1, o->n, o->f);
+    1699:	50                   	push   %eax
+    169a:	68 80 00 00 00       	push   $0x80
+    169f:	6a 01                	push   $0x1
+    16a1:	52                   	push   %edx
+    16a2:	e8 09 04 00 00       	call   1ab0 <fwrite>
+    16a7:	83 c4 10             	add    $0x10,%esp
+  o->buf[o->n++] = c;
+    16aa:	89 f1                	mov    %esi,%ecx
+}
+    16ac:	ba 01 00 00 00       	mov    $0x1,%edx
+    16b1:	31 c0                	xor    %eax,%eax
+  o->buf[o->n++] = c;
+    16b3:	89 53 08             	mov    %edx,0x8(%ebx)
+    16b6:	88 4c 03 0c          	mov    %cl,0xc(%ebx,%eax,1)
+}
+    16ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    16bd:	5b                   	pop    %ebx
+    16be:	5e                   	pop    %esi
+    16bf:	5d                   	pop    %ebp
+    16c0:	c3                   	ret
+    16c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    write(o->fd, o->buf, o->n);
+    16c8:	83 ec 04             	sub    $0x4,%esp
+    16cb:	68 80 00 00 00       	push   $0x80
+    16d0:	52                   	push   %edx
+    16d1:	ff 73 04             	push   0x4(%ebx)
+    16d4:	e8 c6 fc ff ff       	call   139f <write>
+    16d9:	83 c4 10             	add    $0x10,%esp
+    16dc:	eb cc                	jmp    16aa <putc+0x4a>
+    16de:	66 90                	xchg   %ax,%ax
+
+000016e0 <vprintf.constprop.0>:
+
+// Only understands %d, %x, %p, %s, %c.
+static void
+vprintf(struct out *o, const char *fmt, uint *ap)
+    16e0:	55                   	push   %ebp
+    16e1:	89 e5                	mov    %esp,%ebp
+    16e3:	57                   	push   %edi
+    16e4:	89 c7                	mov    %eax,%edi
+    16e6:	56                   	push   %esi
+    16e7:	31 f6                	xor    %esi,%esi
+    16e9:	53                   	push   %ebx
+    16ea:	8d 5a 01             	lea    0x1(%edx),%ebx
+    16ed:	83 ec 1c             	sub    $0x1c,%esp
+{
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    16f0:	0f b6 02             	movzbl (%edx),%eax
+vprintf(struct out *o, const char *fmt, uint *ap)
+    16f3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    16f6:	84 c0                	test   %al,%al
+    16f8:	75 1e                	jne    1718 <vprintf.constprop.0+0x38>
+    16fa:	eb 53                	jmp    174f <vprintf.constprop.0+0x6f>
+    16fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1700:	83 f8 25             	cmp    $0x25,%eax
+    1703:	74 3b                	je     1740 <vprintf.constprop.0+0x60>
+        state = '%';
+      } else {
+        putc(o, c);
+    1705:	89 ca                	mov    %ecx,%edx
+    1707:	89 f8                	mov    %edi,%eax
+    1709:	e8 52 ff ff ff       	call   1660 <putc>
+  for(i = 0; fmt[i]; i++){
+    170e:	0f b6 03             	movzbl (%ebx),%eax
+    1711:	83 c3 01             	add    $0x1,%ebx
+    1714:	84 c0                	test   %al,%al
+    1716:	74 37                	je     174f <vprintf.constprop.0+0x6f>
+    c = fmt[i] & 0xff;
+    1718:	0f be c8             	movsbl %al,%ecx
+    171b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    171e:	85 f6                	test   %esi,%esi
+    1720:	74 de                	je     1700 <vprintf.constprop.0+0x20>
+      }
+    } else if(state == '%'){
+    1722:	83 fe 25             	cmp    $0x25,%esi
+    1725:	75 e7                	jne    170e <vprintf.constprop.0+0x2e>
+      if(c == 'd'){
+    1727:	83 f8 25             	cmp    $0x25,%eax
+    172a:	74 4e                	je     177a <vprintf.constprop.0+0x9a>
+    172c:	83 e8 63             	sub    $0x63,%eax
+    172f:	83 f8 15             	cmp    $0x15,%eax
+    1732:	77 34                	ja     1768 <vprintf.constprop.0+0x88>
+    1734:	ff 24 85 40 22 00 00 	jmp    *0x2240(,%eax,4)
+    173b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    173f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1740:	0f b6 03             	movzbl (%ebx),%eax
+    1743:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1746:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    174b:	84 c0                	test   %al,%al
+    174d:	75 c9                	jne    1718 <vprintf.constprop.0+0x38>
+        putc(o, c);
+      }
+      state = 0;
+    }
+  }
+  if(o->n > 0)
+    174f:	8b 47 08             	mov    0x8(%edi),%eax
+    1752:	85 c0                	test   %eax,%eax
+    1754:	0f 8f de 00 00 00    	jg     1838 <vprintf.constprop.0+0x158>
+    emit(o);
+}
+    175a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    175d:	5b                   	pop    %ebx
+    175e:	5e                   	pop    %esi
+    175f:	5f                   	pop    %edi
+    1760:	5d                   	pop    %ebp
+    1761:	c3                   	ret
+    1762:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        putc(o, '%');
+    1768:	ba 25 00 00 00       	mov    $0x25,%edx
+    176d:	89 f8                	mov    %edi,%eax
+    176f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1772:	e8 e9 fe ff ff       	call   1660 <putc>
+        putc(o, c);
+    1777:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    177a:	89 ca                	mov    %ecx,%edx
+    177c:	89 f8                	mov    %edi,%eax
+      state = 0;
+    177e:	31 f6                	xor    %esi,%esi
+        putc(o, c);
+    1780:	e8 db fe ff ff       	call   1660 <putc>
+    1785:	eb 87                	jmp    170e <vprintf.constprop.0+0x2e>
+    1787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178e:	66 90                	xchg   %ax,%ax
+        printint(o, *ap, 16, 0);
+    1790:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1793:	83 ec 0c             	sub    $0xc,%esp
+    1796:	b9 10 00 00 00       	mov    $0x10,%ecx
+    179b:	8b 16                	mov    (%esi),%edx
+    179d:	6a 00                	push   $0x0
+        ap++;
+    179f:	83 c6 04             	add    $0x4,%esi
+        printint(o, *ap, 16, 0);
+    17a2:	89 f8                	mov    %edi,%eax
+    17a4:	e8 b7 fd ff ff       	call   1560 <printint>
+        ap++;
+    17a9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    17ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17af:	31 f6                	xor    %esi,%esi
+    17b1:	e9 58 ff ff ff       	jmp    170e <vprintf.constprop.0+0x2e>
+    17b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    17c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    17c3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    17c5:	83 c0 04             	add    $0x4,%eax
+    17c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    17cb:	85 f6                	test   %esi,%esi
+    17cd:	75 1b                	jne    17ea <vprintf.constprop.0+0x10a>
+    17cf:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    17d4:	be 38 22 00 00       	mov    $0x2238,%esi
+    17d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(o, *s);
+    17e0:	89 f8                	mov    %edi,%eax
+          s++;
+    17e2:	83 c6 01             	add    $0x1,%esi
+          putc(o, *s);
+    17e5:	e8 76 fe ff ff       	call   1660 <putc>
+        while(*s != 0){
+    17ea:	0f be 16             	movsbl (%esi),%edx
+    17ed:	84 d2                	test   %dl,%dl
+    17ef:	75 ef                	jne    17e0 <vprintf.constprop.0+0x100>
+      state = 0;
+    17f1:	31 f6                	xor    %esi,%esi
+    17f3:	e9 16 ff ff ff       	jmp    170e <vprintf.constprop.0+0x2e>
+    17f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ff:	90                   	nop
+        printint(o, *ap, 10, 1);
+    1800:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1803:	83 ec 0c             	sub    $0xc,%esp
+    1806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    180b:	8b 16                	mov    (%esi),%edx
+    180d:	6a 01                	push   $0x1
+    180f:	eb 8e                	jmp    179f <vprintf.constprop.0+0xbf>
+    1811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(o, *ap);
+    1818:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    181b:	89 f8                	mov    %edi,%eax
+    181d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1820:	83 c6 04             	add    $0x4,%esi
+        putc(o, *ap);
+    1823:	e8 38 fe ff ff       	call   1660 <putc>
+        ap++;
+    1828:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    182b:	31 f6                	xor    %esi,%esi
+    182d:	e9 dc fe ff ff       	jmp    170e <vprintf.constprop.0+0x2e>
+    1832:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(o->f)
+    1838:	8b 17                	mov    (%edi),%edx
+    fwrite(o->buf, 1, o->n, o->f);
+    183a:	8d 4f 0c             	lea    0xc(%edi),%ecx
+  if(o->f)
+    183d:	85 d2                	test   %edx,%edx
+    183f:	74 1f                	je     1860 <vprintf.constprop.0+0x180>
+    fwrite(o->buf, 1, o->n, o->f);
+    1841:	52                   	push   %edx
+    1842:	50                   	push   %eax
+    1843:	6a 01                	push   $0x1
+    1845:	51                   	push   %ecx
+    1846:	e8 65 02 00 00       	call   1ab0 <fwrite>
+    184b:	83 c4 10             	add    $0x10,%esp
+  o->n = 0;
+    184e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1855:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1858:	5b                   	pop    %ebx
+    1859:	5e                   	pop    %esi
+    185a:	5f                   	pop    %edi
+    185b:	5d                   	pop    %ebp
+    185c:	c3                   	ret
+    185d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(o->fd, o->buf, o->n);
+    1860:	83 ec 04             	sub    $0x4,%esp
+    1863:	50                   	push   %eax
+    1864:	51                   	push   %ecx
+    1865:	ff 77 04             	push   0x4(%edi)
+    1868:	e8 32 fb ff ff       	call   139f <write>
+    186d:	83 c4 10             	add    $0x10,%esp
+    1870:	eb dc                	jmp    184e <vprintf.constprop.0+0x16e>
+    1872:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001880 <printf>:
+
+// Print to the given fd, through stdout or stderr for 1 or 2.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1880:	55                   	push   %ebp
+    1881:	89 e5                	mov    %esp,%ebp
+    1883:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1889:	a1 44 29 00 00       	mov    0x2944,%eax
+{
+    188e:	8b 55 08             	mov    0x8(%ebp),%edx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    1891:	83 fa 01             	cmp    $0x1,%edx
+    1894:	74 0c                	je     18a2 <printf+0x22>
+    1896:	31 c0                	xor    %eax,%eax
+    1898:	83 fa 02             	cmp    $0x2,%edx
+    189b:	0f 44 05 40 29 00 00 	cmove  0x2940,%eax
+  o.fd = fd;
+    18a2:	89 95 70 ff ff ff    	mov    %edx,-0x90(%ebp)
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18ab:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.f = fd == 1 ? stdout : fd == 2 ? stderr : 0;
+    18ae:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18b4:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  o.n = 0;
+    18ba:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    18c1:	00 00 00 
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18c4:	e8 17 fe ff ff       	call   16e0 <vprintf.constprop.0>
+}
+    18c9:	c9                   	leave
+    18ca:	c3                   	ret
+    18cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18cf:	90                   	nop
+
+000018d0 <fprintf>:
+
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    18d0:	55                   	push   %ebp
+    18d1:	89 e5                	mov    %esp,%ebp
+    18d3:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct out o;
+
+  o.f = f;
+    18d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  o.fd = -1;
+  o.n = 0;
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18df:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  o.fd = -1;
+    18e2:	c7 85 70 ff ff ff ff 	movl   $0xffffffff,-0x90(%ebp)
+    18e9:	ff ff ff 
+  o.n = 0;
+    18ec:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    18f3:	00 00 00 
+  o.f = f;
+    18f6:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  vprintf(&o, fmt, (uint*)(void*)&fmt + 1);
+    18fc:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+    1902:	e8 d9 fd ff ff       	call   16e0 <vprintf.constprop.0>
+}
+    1907:	c9                   	leave
+    1908:	c3                   	ret
+    1909:	66 90                	xchg   %ax,%ax
+    190b:	66 90                	xchg   %ax,%ax
+    190d:	66 90                	xchg   %ax,%ax
+    190f:	90                   	nop
+
+00001910 <setmode>:
+
+// Line buffered if f is the console, else fully buffered,
+// with a buffer if one can be had.
+static void
+setmode(FILE *f)
+{
+    1910:	55                   	push   %ebp
+    1911:	89 e5                	mov    %esp,%ebp
+    1913:	53                   	push   %ebx
+    1914:	89 c3                	mov    %eax,%ebx
+    1916:	83 ec 24             	sub    $0x24,%esp
+  struct stat st;
+
+  if(f->mode == IOWAIT)
+    1919:	8b 40 0c             	mov    0xc(%eax),%eax
+    191c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    191f:	74 17                	je     1938 <setmode+0x28>
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    1921:	83 f8 02             	cmp    $0x2,%eax
+    1924:	74 07                	je     192d <setmode+0x1d>
+    1926:	8b 43 18             	mov    0x18(%ebx),%eax
+    1929:	85 c0                	test   %eax,%eax
+    192b:	74 38                	je     1965 <setmode+0x55>
+    f->mode = IONBF;
+}
+    192d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1930:	c9                   	leave
+    1931:	c3                   	ret
+    1932:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->mode = fstat(f->fd, &st) == 0 && st.type == T_DEV ? IOLBF : IOFBF;
+    1938:	83 ec 08             	sub    $0x8,%esp
+    193b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    193e:	50                   	push   %eax
+    193f:	ff 33                	push   (%ebx)
+    1941:	e8 c2 fa ff ff       	call   1408 <fstat>
+    1946:	83 c4 10             	add    $0x10,%esp
+    1949:	89 c2                	mov    %eax,%edx
+    194b:	31 c0                	xor    %eax,%eax
+    194d:	85 d2                	test   %edx,%edx
+    194f:	75 0a                	jne    195b <setmode+0x4b>
+    1951:	31 c0                	xor    %eax,%eax
+    1953:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1958:	0f 94 c0             	sete   %al
+    195b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  if(f->mode != IONBF && f->buf == 0 && (f->buf = malloc(BUFSIZ)) == 0)
+    195e:	8b 43 18             	mov    0x18(%ebx),%eax
+    1961:	85 c0                	test   %eax,%eax
+    1963:	75 c8                	jne    192d <setmode+0x1d>
+    1965:	83 ec 0c             	sub    $0xc,%esp
+    1968:	68 00 04 00 00       	push   $0x400
+    196d:	e8 de 07 00 00       	call   2150 <malloc>
+    1972:	83 c4 10             	add    $0x10,%esp
+    1975:	89 43 18             	mov    %eax,0x18(%ebx)
+    1978:	85 c0                	test   %eax,%eax
+    197a:	75 b1                	jne    192d <setmode+0x1d>
+    f->mode = IONBF;
+    197c:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+}
+    1983:	eb a8                	jmp    192d <setmode+0x1d>
+    1985:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001990 <drain>:
+{
+    1990:	55                   	push   %ebp
+    1991:	89 e5                	mov    %esp,%ebp
+    1993:	57                   	push   %edi
+    1994:	56                   	push   %esi
+    1995:	53                   	push   %ebx
+    1996:	83 ec 1c             	sub    $0x1c,%esp
+  n = f->n;
+    1999:	8b 78 20             	mov    0x20(%eax),%edi
+{
+    199c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  f->n = 0;
+    199f:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19a6:	85 ff                	test   %edi,%edi
+    19a8:	7f 0e                	jg     19b8 <drain+0x28>
+  return 0;
+    19aa:	31 c0                	xor    %eax,%eax
+}
+    19ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19af:	5b                   	pop    %ebx
+    19b0:	5e                   	pop    %esi
+    19b1:	5f                   	pop    %edi
+    19b2:	5d                   	pop    %ebp
+    19b3:	c3                   	ret
+    19b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && writeall(f->fd, f->buf, n) < 0){
+    19b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19bb:	8b 58 18             	mov    0x18(%eax),%ebx
+    19be:	8b 30                	mov    (%eax),%esi
+  for(; n > 0; p += k, n -= k)
+    19c0:	eb 0e                	jmp    19d0 <drain+0x40>
+    19c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    19c8:	29 c7                	sub    %eax,%edi
+    19ca:	01 c3                	add    %eax,%ebx
+    19cc:	85 ff                	test   %edi,%edi
+    19ce:	7e da                	jle    19aa <drain+0x1a>
+    if((k = write(fd, p, n)) <= 0)
+    19d0:	83 ec 04             	sub    $0x4,%esp
+    19d3:	57                   	push   %edi
+    19d4:	53                   	push   %ebx
+    19d5:	56                   	push   %esi
+    19d6:	e8 c4 f9 ff ff       	call   139f <write>
+    19db:	83 c4 10             	add    $0x10,%esp
+    19de:	85 c0                	test   %eax,%eax
+    19e0:	7f e6                	jg     19c8 <drain+0x38>
+    f->err = 1;
+    19e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    19e5:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+    return -1;
+    19ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    19f1:	eb b9                	jmp    19ac <drain+0x1c>
+    19f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001a00 <flushall>:
+
+static void
+flushall(void)
+{
+    1a00:	55                   	push   %ebp
+    1a01:	89 e5                	mov    %esp,%ebp
+    1a03:	53                   	push   %ebx
+{
+  int r;
+
+  if(f == 0){
+    r = 0;
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a04:	bb 60 29 00 00       	mov    $0x2960,%ebx
+{
+    1a09:	83 ec 04             	sub    $0x4,%esp
+    1a0c:	eb 0d                	jmp    1a1b <flushall+0x1b>
+    1a0e:	66 90                	xchg   %ax,%ax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a10:	83 c3 24             	add    $0x24,%ebx
+    1a13:	81 fb a0 2b 00 00    	cmp    $0x2ba0,%ebx
+    1a19:	74 19                	je     1a34 <flushall+0x34>
+      if(f->writable && drain(f) < 0)
+    1a1b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1a1e:	85 c0                	test   %eax,%eax
+    1a20:	74 ee                	je     1a10 <flushall+0x10>
+    1a22:	89 d8                	mov    %ebx,%eax
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a24:	83 c3 24             	add    $0x24,%ebx
+      if(f->writable && drain(f) < 0)
+    1a27:	e8 64 ff ff ff       	call   1990 <drain>
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a2c:	81 fb a0 2b 00 00    	cmp    $0x2ba0,%ebx
+    1a32:	75 e7                	jne    1a1b <flushall+0x1b>
+}
+    1a34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a37:	c9                   	leave
+    1a38:	c3                   	ret
+    1a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001a40 <fflush>:
+{
+    1a40:	55                   	push   %ebp
+    1a41:	89 e5                	mov    %esp,%ebp
+    1a43:	57                   	push   %edi
+    1a44:	56                   	push   %esi
+    1a45:	53                   	push   %ebx
+    1a46:	83 ec 0c             	sub    $0xc,%esp
+    1a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f == 0){
+    1a4c:	85 c0                	test   %eax,%eax
+    1a4e:	74 28                	je     1a78 <fflush+0x38>
+        r = -1;
+    return r;
+  }
+  if(!f->writable)
+    1a50:	8b 70 08             	mov    0x8(%eax),%esi
+    1a53:	85 f6                	test   %esi,%esi
+    1a55:	75 11                	jne    1a68 <fflush+0x28>
+    return 0;
+  return drain(f);
+}
+    1a57:	83 c4 0c             	add    $0xc,%esp
+    1a5a:	89 f0                	mov    %esi,%eax
+    1a5c:	5b                   	pop    %ebx
+    1a5d:	5e                   	pop    %esi
+    1a5e:	5f                   	pop    %edi
+    1a5f:	5d                   	pop    %ebp
+    1a60:	c3                   	ret
+    1a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a68:	83 c4 0c             	add    $0xc,%esp
+    1a6b:	5b                   	pop    %ebx
+    1a6c:	5e                   	pop    %esi
+    1a6d:	5f                   	pop    %edi
+    1a6e:	5d                   	pop    %ebp
+  return drain(f);
+    1a6f:	e9 1c ff ff ff       	jmp    1990 <drain>
+    1a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = 0;
+    1a78:	31 f6                	xor    %esi,%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a7a:	bb 60 29 00 00       	mov    $0x2960,%ebx
+        r = -1;
+    1a7f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    1a84:	eb 15                	jmp    1a9b <fflush+0x5b>
+    1a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(f = streams; f < &streams[NSTREAM]; f++)
+    1a90:	83 c3 24             	add    $0x24,%ebx
+    1a93:	81 fb a0 2b 00 00    	cmp    $0x2ba0,%ebx
+    1a99:	74 bc                	je     1a57 <fflush+0x17>
+      if(f->writable && drain(f) < 0)
+    1a9b:	8b 43 08             	mov    0x8(%ebx),%eax
+    1a9e:	85 c0                	test   %eax,%eax
+    1aa0:	74 ee                	je     1a90 <fflush+0x50>
+    1aa2:	89 d8                	mov    %ebx,%eax
+    1aa4:	e8 e7 fe ff ff       	call   1990 <drain>
+        r = -1;
+    1aa9:	85 c0                	test   %eax,%eax
+    1aab:	0f 48 f7             	cmovs  %edi,%esi
+    1aae:	eb e0                	jmp    1a90 <fflush+0x50>
+
+00001ab0 <fwrite>:
+
+int
+fwrite(const void *vp, int size, int nmemb, FILE *f)
+{
+    1ab0:	55                   	push   %ebp
+    1ab1:	89 e5                	mov    %esp,%ebp
+    1ab3:	57                   	push   %edi
+    1ab4:	56                   	push   %esi
+    1ab5:	53                   	push   %ebx
+    1ab6:	83 ec 1c             	sub    $0x1c,%esp
+  const char *p;
+  int n, k, i, nl;
+
+  p = vp;
+  n = size * nmemb;
+    1ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1abc:	0f af 55 10          	imul   0x10(%ebp),%edx
+{
+    1ac0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1ac3:	8b 75 14             	mov    0x14(%ebp),%esi
+  if(n <= 0 || wsetup(f) < 0)
+    1ac6:	85 d2                	test   %edx,%edx
+    1ac8:	0f 8e 26 01 00 00    	jle    1bf4 <fwrite+0x144>
+  if(!f->writable){
+    1ace:	8b 46 08             	mov    0x8(%esi),%eax
+    1ad1:	85 c0                	test   %eax,%eax
+    1ad3:	0f 84 14 01 00 00    	je     1bed <fwrite+0x13d>
+  setmode(f);
+    1ad9:	89 f0                	mov    %esi,%eax
+    1adb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1ade:	e8 2d fe ff ff       	call   1910 <setmode>
+    return 0;
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1ae3:	83 7e 0c 02          	cmpl   $0x2,0xc(%esi)
+    1ae7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  flushhook = flushall;
+    1aea:	c7 05 a0 2b 00 00 00 	movl   $0x1a00,0x2ba0
+    1af1:	1a 00 00 
+  if(f->mode == IONBF || n >= BUFSIZ){
+    1af4:	0f 84 b6 00 00 00    	je     1bb0 <fwrite+0x100>
+    1afa:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+    1b00:	0f 8f aa 00 00 00    	jg     1bb0 <fwrite+0x100>
+    }
+    return nmemb;
+  }
+  nl = 0;
+  while(n > 0){
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b06:	8b 46 20             	mov    0x20(%esi),%eax
+    1b09:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  nl = 0;
+    1b0c:	31 ff                	xor    %edi,%edi
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b0e:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b13:	74 6c                	je     1b81 <fwrite+0xd1>
+    1b15:	8d 76 00             	lea    0x0(%esi),%esi
+      return 0;
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1b18:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1b1b:	ba 00 04 00 00       	mov    $0x400,%edx
+    1b20:	29 c2                	sub    %eax,%edx
+    1b22:	39 ca                	cmp    %ecx,%edx
+    1b24:	0f 4f d1             	cmovg  %ecx,%edx
+    for(i = 0; i < k; i++)
+    1b27:	85 d2                	test   %edx,%edx
+    1b29:	0f 8e d1 00 00 00    	jle    1c00 <fwrite+0x150>
+    1b2f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+    1b32:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1b35:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b3f:	90                   	nop
+      if((f->buf[f->n++] = *p++) == '\n')
+    1b40:	8d 50 01             	lea    0x1(%eax),%edx
+    1b43:	83 c3 01             	add    $0x1,%ebx
+    1b46:	8b 4e 18             	mov    0x18(%esi),%ecx
+    1b49:	89 56 20             	mov    %edx,0x20(%esi)
+    1b4c:	0f b6 53 ff          	movzbl -0x1(%ebx),%edx
+    1b50:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    for(i = 0; i < k; i++)
+    1b53:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+        nl = 1;
+    1b56:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b5b:	80 fa 0a             	cmp    $0xa,%dl
+    1b5e:	0f 44 f8             	cmove  %eax,%edi
+    n -= k;
+  }
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1b61:	8b 46 20             	mov    0x20(%esi),%eax
+    for(i = 0; i < k; i++)
+    1b64:	39 cb                	cmp    %ecx,%ebx
+    1b66:	75 d8                	jne    1b40 <fwrite+0x90>
+    1b68:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    n -= k;
+    1b6b:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1b6e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1b71:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  while(n > 0){
+    1b74:	85 db                	test   %ebx,%ebx
+    1b76:	7e 19                	jle    1b91 <fwrite+0xe1>
+    n -= k;
+    1b78:	89 cb                	mov    %ecx,%ebx
+    if(f->n == BUFSIZ && drain(f) < 0)
+    1b7a:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b7f:	75 97                	jne    1b18 <fwrite+0x68>
+    1b81:	89 f0                	mov    %esi,%eax
+    1b83:	e8 08 fe ff ff       	call   1990 <drain>
+    1b88:	85 c0                	test   %eax,%eax
+    1b8a:	78 68                	js     1bf4 <fwrite+0x144>
+    k = BUFSIZ - f->n < n ? BUFSIZ - f->n : n;
+    1b8c:	8b 46 20             	mov    0x20(%esi),%eax
+    1b8f:	eb 87                	jmp    1b18 <fwrite+0x68>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1b91:	3d 00 04 00 00       	cmp    $0x400,%eax
+    1b96:	74 74                	je     1c0c <fwrite+0x15c>
+    1b98:	83 7e 0c 01          	cmpl   $0x1,0xc(%esi)
+    1b9c:	75 04                	jne    1ba2 <fwrite+0xf2>
+    1b9e:	85 ff                	test   %edi,%edi
+    1ba0:	75 6a                	jne    1c0c <fwrite+0x15c>
+    return nmemb;
+    1ba2:	8b 45 10             	mov    0x10(%ebp),%eax
+    return 0;
+  return nmemb;
+}
+    1ba5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ba8:	5b                   	pop    %ebx
+    1ba9:	5e                   	pop    %esi
+    1baa:	5f                   	pop    %edi
+    1bab:	5d                   	pop    %ebp
+    1bac:	c3                   	ret
+    1bad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(drain(f) < 0 || writeall(f->fd, p, n) < 0){
+    1bb0:	89 f0                	mov    %esi,%eax
+    1bb2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1bb5:	e8 d6 fd ff ff       	call   1990 <drain>
+    1bba:	85 c0                	test   %eax,%eax
+    1bbc:	78 2f                	js     1bed <fwrite+0x13d>
+    1bbe:	89 75 14             	mov    %esi,0x14(%ebp)
+    1bc1:	8b 3e                	mov    (%esi),%edi
+    1bc3:	89 de                	mov    %ebx,%esi
+    1bc5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1bc8:	eb 0e                	jmp    1bd8 <fwrite+0x128>
+    1bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(; n > 0; p += k, n -= k)
+    1bd0:	29 c3                	sub    %eax,%ebx
+    1bd2:	01 c6                	add    %eax,%esi
+    1bd4:	85 db                	test   %ebx,%ebx
+    1bd6:	7e ca                	jle    1ba2 <fwrite+0xf2>
+    if((k = write(fd, p, n)) <= 0)
+    1bd8:	83 ec 04             	sub    $0x4,%esp
+    1bdb:	53                   	push   %ebx
+    1bdc:	56                   	push   %esi
+    1bdd:	57                   	push   %edi
+    1bde:	e8 bc f7 ff ff       	call   139f <write>
+    1be3:	83 c4 10             	add    $0x10,%esp
+    1be6:	85 c0                	test   %eax,%eax
+    1be8:	7f e6                	jg     1bd0 <fwrite+0x120>
+    1bea:	8b 75 14             	mov    0x14(%ebp),%esi
+    f->err = 1;
+    1bed:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    return 0;
+    1bf4:	31 c0                	xor    %eax,%eax
+}
+    1bf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bf9:	5b                   	pop    %ebx
+    1bfa:	5e                   	pop    %esi
+    1bfb:	5f                   	pop    %edi
+    1bfc:	5d                   	pop    %ebp
+    1bfd:	c3                   	ret
+    1bfe:	66 90                	xchg   %ax,%ax
+    n -= k;
+    1c00:	89 d9                	mov    %ebx,%ecx
+    1c02:	29 55 e0             	sub    %edx,-0x20(%ebp)
+    1c05:	89 cb                	mov    %ecx,%ebx
+    1c07:	e9 6e ff ff ff       	jmp    1b7a <fwrite+0xca>
+  if((f->n == BUFSIZ || (f->mode == IOLBF && nl)) && drain(f) < 0)
+    1c0c:	89 f0                	mov    %esi,%eax
+    1c0e:	e8 7d fd ff ff       	call   1990 <drain>
+    1c13:	85 c0                	test   %eax,%eax
+    1c15:	79 8b                	jns    1ba2 <fwrite+0xf2>
+    return 0;
+    1c17:	31 c0                	xor    %eax,%eax
+    1c19:	eb db                	jmp    1bf6 <fwrite+0x146>
+    1c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c1f:	90                   	nop
+
+00001c20 <fputc>:
+
+int
+fputc(int c, FILE *f)
+{
+    1c20:	55                   	push   %ebp
+    1c21:	89 e5                	mov    %esp,%ebp
+    1c23:	83 ec 18             	sub    $0x18,%esp
+  char ch;
+
+  ch = c;
+    1c26:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c29:	88 45 f7             	mov    %al,-0x9(%ebp)
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c2c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1c2f:	ff 75 0c             	push   0xc(%ebp)
+    1c32:	6a 01                	push   $0x1
+    1c34:	6a 01                	push   $0x1
+    1c36:	50                   	push   %eax
+    1c37:	e8 74 fe ff ff       	call   1ab0 <fwrite>
+    1c3c:	83 c4 10             	add    $0x10,%esp
+    1c3f:	83 f8 01             	cmp    $0x1,%eax
+    1c42:	75 0c                	jne    1c50 <fputc+0x30>
+    1c44:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1c48:	c9                   	leave
+    1c49:	c3                   	ret
+    1c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1c50:	c9                   	leave
+  return fwrite(&ch, 1, 1, f) == 1 ? (uchar)ch : -1;
+    1c51:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1c56:	c3                   	ret
+    1c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c5e:	66 90                	xchg   %ax,%ax
+
+00001c60 <fread>:
+  return n;
+}
+
+int
+fread(void *vp, int size, int nmemb, FILE *f)
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	57                   	push   %edi
+    1c64:	56                   	push   %esi
+    1c65:	53                   	push   %ebx
+    1c66:	83 ec 1c             	sub    $0x1c,%esp
+    1c69:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *p;
+  int n, want, k;
+
+  p = vp;
+  want = size * nmemb;
+    1c6c:	8b 55 10             	mov    0x10(%ebp),%edx
+{
+    1c6f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  want = size * nmemb;
+    1c72:	0f af d7             	imul   %edi,%edx
+  if(want <= 0 || size <= 0)
+    1c75:	85 d2                	test   %edx,%edx
+    1c77:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1c7a:	7e 12                	jle    1c8e <fread+0x2e>
+    1c7c:	85 ff                	test   %edi,%edi
+    1c7e:	7e 0e                	jle    1c8e <fread+0x2e>
+    return 0;
+  if(!f->readable){
+    1c80:	8b 43 04             	mov    0x4(%ebx),%eax
+    1c83:	85 c0                	test   %eax,%eax
+    1c85:	75 19                	jne    1ca0 <fread+0x40>
+    f->err = 1;
+    1c87:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+      break;
+    else
+      k = 0;
+  }
+  return n / size;
+}
+    1c8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+    1c91:	31 c0                	xor    %eax,%eax
+}
+    1c93:	5b                   	pop    %ebx
+    1c94:	5e                   	pop    %esi
+    1c95:	5f                   	pop    %edi
+    1c96:	5d                   	pop    %ebp
+    1c97:	c3                   	ret
+    1c98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c9f:	90                   	nop
+  setmode(f);
+    1ca0:	89 d8                	mov    %ebx,%eax
+  for(n = 0; n < want; n += k){
+    1ca2:	31 f6                	xor    %esi,%esi
+  setmode(f);
+    1ca4:	e8 67 fc ff ff       	call   1910 <setmode>
+  for(n = 0; n < want; n += k){
+    1ca9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+    1cac:	89 f7                	mov    %esi,%edi
+    1cae:	eb 31                	jmp    1ce1 <fread+0x81>
+    } else if(f->mode == IONBF || want - n >= BUFSIZ){
+    1cb0:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    1cb4:	74 08                	je     1cbe <fread+0x5e>
+    1cb6:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+    1cbc:	7e 62                	jle    1d20 <fread+0xc0>
+      if((k = read(f->fd, p + n, want - n)) <= 0){
+    1cbe:	83 ec 04             	sub    $0x4,%esp
+    1cc1:	56                   	push   %esi
+    1cc2:	8b 45 08             	mov    0x8(%ebp),%eax
+    1cc5:	01 f8                	add    %edi,%eax
+    1cc7:	50                   	push   %eax
+    1cc8:	ff 33                	push   (%ebx)
+    1cca:	e8 c1 f6 ff ff       	call   1390 <read>
+    1ccf:	83 c4 10             	add    $0x10,%esp
+    1cd2:	85 c0                	test   %eax,%eax
+    1cd4:	0f 8e ce 00 00 00    	jle    1da8 <fread+0x148>
+  for(n = 0; n < want; n += k){
+    1cda:	01 c7                	add    %eax,%edi
+    1cdc:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1cdf:	7e 36                	jle    1d17 <fread+0xb7>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1ce1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(f->r < f->n){
+    1ce4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+    1ce7:	8b 43 20             	mov    0x20(%ebx),%eax
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1cea:	29 fe                	sub    %edi,%esi
+    if(f->r < f->n){
+    1cec:	39 c1                	cmp    %eax,%ecx
+    1cee:	7d c0                	jge    1cb0 <fread+0x50>
+      k = f->n - f->r < want - n ? f->n - f->r : want - n;
+    1cf0:	29 c8                	sub    %ecx,%eax
+    1cf2:	39 f0                	cmp    %esi,%eax
+    1cf4:	0f 4e f0             	cmovle %eax,%esi
+      memmove(p + n, f->buf + f->r, k);
+    1cf7:	83 ec 04             	sub    $0x4,%esp
+    1cfa:	56                   	push   %esi
+    1cfb:	03 4b 18             	add    0x18(%ebx),%ecx
+    1cfe:	51                   	push   %ecx
+    1cff:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d02:	01 f8                	add    %edi,%eax
+  for(n = 0; n < want; n += k){
+    1d04:	01 f7                	add    %esi,%edi
+      memmove(p + n, f->buf + f->r, k);
+    1d06:	50                   	push   %eax
+    1d07:	e8 34 f5 ff ff       	call   1240 <memmove>
+      f->r += k;
+    1d0c:	01 73 1c             	add    %esi,0x1c(%ebx)
+    1d0f:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < want; n += k){
+    1d12:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1d15:	7f ca                	jg     1ce1 <fread+0x81>
+    1d17:	89 fe                	mov    %edi,%esi
+    1d19:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d1c:	eb 3f                	jmp    1d5d <fread+0xfd>
+    1d1e:	66 90                	xchg   %ax,%ax
+  if(f == stdin)
+    1d20:	3b 1d 48 29 00 00    	cmp    0x2948,%ebx
+    1d26:	74 68                	je     1d90 <fread+0x130>
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d28:	83 ec 04             	sub    $0x4,%esp
+  f->r = f->n = 0;
+    1d2b:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+    1d32:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+  if((n = read(f->fd, f->buf, BUFSIZ)) < 0)
+    1d39:	68 00 04 00 00       	push   $0x400
+    1d3e:	ff 73 18             	push   0x18(%ebx)
+    1d41:	ff 33                	push   (%ebx)
+    1d43:	e8 48 f6 ff ff       	call   1390 <read>
+    1d48:	83 c4 10             	add    $0x10,%esp
+    1d4b:	85 c0                	test   %eax,%eax
+    1d4d:	78 21                	js     1d70 <fread+0x110>
+  else if(n == 0)
+    1d4f:	75 2f                	jne    1d80 <fread+0x120>
+    f->eof = 1;
+    1d51:	89 fe                	mov    %edi,%esi
+    1d53:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d56:	c7 43 10 01 00 00 00 	movl   $0x1,0x10(%ebx)
+  return n / size;
+    1d5d:	89 f0                	mov    %esi,%eax
+}
+    1d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return n / size;
+    1d62:	99                   	cltd
+}
+    1d63:	5b                   	pop    %ebx
+    1d64:	5e                   	pop    %esi
+  return n / size;
+    1d65:	f7 ff                	idiv   %edi
+}
+    1d67:	5f                   	pop    %edi
+    1d68:	5d                   	pop    %ebp
+    1d69:	c3                   	ret
+    1d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->err = 1;
+    1d70:	89 fe                	mov    %edi,%esi
+    1d72:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1d75:	c7 43 14 01 00 00 00 	movl   $0x1,0x14(%ebx)
+  return n;
+    1d7c:	eb df                	jmp    1d5d <fread+0xfd>
+    1d7e:	66 90                	xchg   %ax,%ax
+    f->n = n;
+    1d80:	89 43 20             	mov    %eax,0x20(%ebx)
+  return n;
+    1d83:	e9 54 ff ff ff       	jmp    1cdc <fread+0x7c>
+    1d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d8f:	90                   	nop
+    fflush(stdout);  // show any prompt first
+    1d90:	83 ec 0c             	sub    $0xc,%esp
+    1d93:	ff 35 44 29 00 00    	push   0x2944
+    1d99:	e8 a2 fc ff ff       	call   1a40 <fflush>
+    1d9e:	83 c4 10             	add    $0x10,%esp
+    1da1:	eb 85                	jmp    1d28 <fread+0xc8>
+    1da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1da7:	90                   	nop
+        if(k < 0)
+    1da8:	89 fe                	mov    %edi,%esi
+    1daa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    1dad:	74 a7                	je     1d56 <fread+0xf6>
+    1daf:	eb c4                	jmp    1d75 <fread+0x115>
+    1db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1db8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dbf:	90                   	nop
+
+00001dc0 <fgetc>:
+
+int
+fgetc(FILE *f)
+{
+    1dc0:	55                   	push   %ebp
+    1dc1:	89 e5                	mov    %esp,%ebp
+    1dc3:	53                   	push   %ebx
+    1dc4:	83 ec 14             	sub    $0x14,%esp
+    1dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  uchar c;
+
+  if(f->readable && f->r < f->n)
+    1dca:	8b 50 04             	mov    0x4(%eax),%edx
+    1dcd:	85 d2                	test   %edx,%edx
+    1dcf:	74 08                	je     1dd9 <fgetc+0x19>
+    1dd1:	8b 50 1c             	mov    0x1c(%eax),%edx
+    1dd4:	3b 50 20             	cmp    0x20(%eax),%edx
+    1dd7:	7c 27                	jl     1e00 <fgetc+0x40>
+    return (uchar)f->buf[f->r++];
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1dd9:	50                   	push   %eax
+    1dda:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    1ddd:	6a 01                	push   $0x1
+    1ddf:	6a 01                	push   $0x1
+    1de1:	50                   	push   %eax
+    1de2:	e8 79 fe ff ff       	call   1c60 <fread>
+    1de7:	83 c4 10             	add    $0x10,%esp
+    1dea:	83 f8 01             	cmp    $0x1,%eax
+    1ded:	75 29                	jne    1e18 <fgetc+0x58>
+    1def:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+    1df3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1df6:	c9                   	leave
+    1df7:	c3                   	ret
+    1df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dff:	90                   	nop
+    return (uchar)f->buf[f->r++];
+    1e00:	8b 48 18             	mov    0x18(%eax),%ecx
+    1e03:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1e06:	89 58 1c             	mov    %ebx,0x1c(%eax)
+}
+    1e09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return (uchar)f->buf[f->r++];
+    1e0c:	0f b6 04 11          	movzbl (%ecx,%edx,1),%eax
+}
+    1e10:	c9                   	leave
+    1e11:	c3                   	ret
+    1e12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e18:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e1d:	eb d4                	jmp    1df3 <fgetc+0x33>
+    1e1f:	90                   	nop
+
+00001e20 <fgets>:
+
+char*
+fgets(char *buf, int max, FILE *f)
+{
+    1e20:	55                   	push   %ebp
+    1e21:	89 e5                	mov    %esp,%ebp
+    1e23:	57                   	push   %edi
+    1e24:	56                   	push   %esi
+    1e25:	53                   	push   %ebx
+  int i, c;
+
+  for(i = 0; i+1 < max; ){
+    1e26:	31 db                	xor    %ebx,%ebx
+{
+    1e28:	83 ec 1c             	sub    $0x1c,%esp
+    1e2b:	8b 75 10             	mov    0x10(%ebp),%esi
+    1e2e:	89 f7                	mov    %esi,%edi
+  for(i = 0; i+1 < max; ){
+    1e30:	eb 2e                	jmp    1e60 <fgets+0x40>
+    1e32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e38:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1e3b:	57                   	push   %edi
+    1e3c:	6a 01                	push   $0x1
+    1e3e:	6a 01                	push   $0x1
+    1e40:	50                   	push   %eax
+    1e41:	e8 1a fe ff ff       	call   1c60 <fread>
+    1e46:	83 c4 10             	add    $0x10,%esp
+    1e49:	83 f8 01             	cmp    $0x1,%eax
+    1e4c:	75 62                	jne    1eb0 <fgets+0x90>
+    1e4e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+    if((c = fgetc(f)) < 0)
+      break;
+    buf[i++] = c;
+    1e52:	8b 55 08             	mov    0x8(%ebp),%edx
+  return fread(&c, 1, 1, f) == 1 ? c : -1;
+    1e55:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1e57:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1e5b:	83 f9 0a             	cmp    $0xa,%ecx
+    1e5e:	74 34                	je     1e94 <fgets+0x74>
+  for(i = 0; i+1 < max; ){
+    1e60:	89 de                	mov    %ebx,%esi
+    1e62:	83 c3 01             	add    $0x1,%ebx
+    1e65:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1e68:	7d 46                	jge    1eb0 <fgets+0x90>
+  if(f->readable && f->r < f->n)
+    1e6a:	8b 47 04             	mov    0x4(%edi),%eax
+    1e6d:	85 c0                	test   %eax,%eax
+    1e6f:	74 c7                	je     1e38 <fgets+0x18>
+    1e71:	8b 47 1c             	mov    0x1c(%edi),%eax
+    1e74:	3b 47 20             	cmp    0x20(%edi),%eax
+    1e77:	7d bf                	jge    1e38 <fgets+0x18>
+    return (uchar)f->buf[f->r++];
+    1e79:	8b 4f 18             	mov    0x18(%edi),%ecx
+    1e7c:	8d 70 01             	lea    0x1(%eax),%esi
+    buf[i++] = c;
+    1e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+    return (uchar)f->buf[f->r++];
+    1e82:	89 77 1c             	mov    %esi,0x1c(%edi)
+    1e85:	0f b6 0c 01          	movzbl (%ecx,%eax,1),%ecx
+    1e89:	89 c8                	mov    %ecx,%eax
+    buf[i++] = c;
+    1e8b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n')
+    1e8f:	83 f9 0a             	cmp    $0xa,%ecx
+    1e92:	75 cc                	jne    1e60 <fgets+0x40>
+      break;
+  }
+  buf[i] = '\0';
+    1e94:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e97:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return i > 0 ? buf : 0;
+    1e9b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1e9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ea1:	5b                   	pop    %ebx
+    1ea2:	5e                   	pop    %esi
+    1ea3:	5f                   	pop    %edi
+    1ea4:	5d                   	pop    %ebp
+    1ea5:	c3                   	ret
+    1ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ead:	8d 76 00             	lea    0x0(%esi),%esi
+  buf[i] = '\0';
+    1eb0:	8b 45 08             	mov    0x8(%ebp),%eax
+    1eb3:	c6 04 30 00          	movb   $0x0,(%eax,%esi,1)
+  return i > 0 ? buf : 0;
+    1eb7:	31 c0                	xor    %eax,%eax
+    1eb9:	85 f6                	test   %esi,%esi
+    1ebb:	74 e1                	je     1e9e <fgets+0x7e>
+    1ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ec0:	eb dc                	jmp    1e9e <fgets+0x7e>
+    1ec2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ec9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ed0 <fdopen>:
+
+// Open a stream on fd: "r" to read it, "w" or "a" to write it.
+FILE*
+fdopen(int fd, const char *mode)
+{
+    1ed0:	55                   	push   %ebp
+    1ed1:	89 e5                	mov    %esp,%ebp
+    1ed3:	53                   	push   %ebx
+  FILE *f;
+
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1ed4:	bb 60 29 00 00       	mov    $0x2960,%ebx
+{
+    1ed9:	83 ec 04             	sub    $0x4,%esp
+    1edc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(!f->readable && !f->writable)
+    1ee0:	8b 53 04             	mov    0x4(%ebx),%edx
+    1ee3:	85 d2                	test   %edx,%edx
+    1ee5:	75 07                	jne    1eee <fdopen+0x1e>
+    1ee7:	8b 43 08             	mov    0x8(%ebx),%eax
+    1eea:	85 c0                	test   %eax,%eax
+    1eec:	74 1a                	je     1f08 <fdopen+0x38>
+  for(f = streams; f < &streams[NSTREAM]; f++)
+    1eee:	83 c3 24             	add    $0x24,%ebx
+    1ef1:	81 fb a0 2b 00 00    	cmp    $0x2ba0,%ebx
+    1ef7:	75 e7                	jne    1ee0 <fdopen+0x10>
+      break;
+  if(f == &streams[NSTREAM])
+    return 0;
+    1ef9:	31 db                	xor    %ebx,%ebx
+  if(mode[0] == 'r')
+    f->readable = 1;
+  else
+    f->writable = 1;
+  return f;
+}
+    1efb:	89 d8                	mov    %ebx,%eax
+    1efd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f00:	c9                   	leave
+    1f01:	c3                   	ret
+    1f02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f == &streams[NSTREAM])
+    1f08:	81 fb a0 2b 00 00    	cmp    $0x2ba0,%ebx
+    1f0e:	74 e9                	je     1ef9 <fdopen+0x29>
+  memset(f, 0, sizeof(*f));
+    1f10:	83 ec 04             	sub    $0x4,%esp
+    1f13:	6a 24                	push   $0x24
+    1f15:	6a 00                	push   $0x0
+    1f17:	53                   	push   %ebx
+    1f18:	e8 d3 f1 ff ff       	call   10f0 <memset>
+  f->fd = fd;
+    1f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  f->mode = IOWAIT;
+    1f20:	c7 43 0c ff ff ff ff 	movl   $0xffffffff,0xc(%ebx)
+  if(mode[0] == 'r')
+    1f27:	83 c4 10             	add    $0x10,%esp
+  f->fd = fd;
+    1f2a:	89 03                	mov    %eax,(%ebx)
+  if(mode[0] == 'r')
+    1f2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1f2f:	80 38 72             	cmpb   $0x72,(%eax)
+    1f32:	74 14                	je     1f48 <fdopen+0x78>
+    f->writable = 1;
+    1f34:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+}
+    1f3b:	89 d8                	mov    %ebx,%eax
+    1f3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f40:	c9                   	leave
+    1f41:	c3                   	ret
+    1f42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->readable = 1;
+    1f48:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+}
+    1f4f:	89 d8                	mov    %ebx,%eax
+    1f51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f54:	c9                   	leave
+    1f55:	c3                   	ret
+    1f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001f60 <fopen>:
+
+// Open path: "r" to read it; "w" to write it from empty;
+// "a" to write at its end.
+FILE*
+fopen(const char *path, const char *mode)
+{
+    1f60:	55                   	push   %ebp
+    1f61:	89 e5                	mov    %esp,%ebp
+    1f63:	56                   	push   %esi
+    1f64:	53                   	push   %ebx
+    1f65:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int fd;
+  FILE *f;
+
+  if(mode[0] == 'r')
+    1f68:	0f b6 06             	movzbl (%esi),%eax
+    1f6b:	3c 72                	cmp    $0x72,%al
+    1f6d:	74 61                	je     1fd0 <fopen+0x70>
+    fd = open(path, O_RDONLY);
+  else if(mode[0] == 'w')
+    1f6f:	3c 77                	cmp    $0x77,%al
+    1f71:	74 7d                	je     1ff0 <fopen+0x90>
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+  else if(mode[0] == 'a'){
+    1f73:	3c 61                	cmp    $0x61,%al
+    1f75:	75 49                	jne    1fc0 <fopen+0x60>
+    if((fd = open(path, O_CREATE|O_WRONLY)) >= 0)
+    1f77:	83 ec 08             	sub    $0x8,%esp
+    1f7a:	68 01 02 00 00       	push   $0x201
+    1f7f:	ff 75 08             	push   0x8(%ebp)
+    1f82:	e8 54 f4 ff ff       	call   13db <open>
+    1f87:	83 c4 10             	add    $0x10,%esp
+    1f8a:	89 c3                	mov    %eax,%ebx
+    1f8c:	85 c0                	test   %eax,%eax
+    1f8e:	78 30                	js     1fc0 <fopen+0x60>
+      lseek(fd, 0, SEEK_END);
+    1f90:	83 ec 04             	sub    $0x4,%esp
+    1f93:	6a 02                	push   $0x2
+    1f95:	6a 00                	push   $0x0
+    1f97:	50                   	push   %eax
+    1f98:	e8 4c f5 ff ff       	call   14e9 <lseek>
+    1f9d:	83 c4 10             	add    $0x10,%esp
+  } else
+    return 0;
+  if(fd < 0)
+    return 0;
+  if((f = fdopen(fd, mode)) == 0)
+    1fa0:	83 ec 08             	sub    $0x8,%esp
+    1fa3:	56                   	push   %esi
+    1fa4:	53                   	push   %ebx
+    1fa5:	e8 26 ff ff ff       	call   1ed0 <fdopen>
+    1faa:	83 c4 10             	add    $0x10,%esp
+    1fad:	85 c0                	test   %eax,%eax
+    1faf:	75 11                	jne    1fc2 <fopen+0x62>
+    close(fd);
+    1fb1:	83 ec 0c             	sub    $0xc,%esp
+    1fb4:	53                   	push   %ebx
+    1fb5:	e8 f4 f3 ff ff       	call   13ae <close>
+    1fba:	83 c4 10             	add    $0x10,%esp
+    1fbd:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+    1fc0:	31 c0                	xor    %eax,%eax
+  return f;
+}
+    1fc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1fc5:	5b                   	pop    %ebx
+    1fc6:	5e                   	pop    %esi
+    1fc7:	5d                   	pop    %ebp
+    1fc8:	c3                   	ret
+    1fc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = open(path, O_RDONLY);
+    1fd0:	83 ec 08             	sub    $0x8,%esp
+    1fd3:	6a 00                	push   $0x0
+    1fd5:	ff 75 08             	push   0x8(%ebp)
+    1fd8:	e8 fe f3 ff ff       	call   13db <open>
+    1fdd:	83 c4 10             	add    $0x10,%esp
+    1fe0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0)
+    1fe2:	85 db                	test   %ebx,%ebx
+    1fe4:	78 da                	js     1fc0 <fopen+0x60>
+    1fe6:	eb b8                	jmp    1fa0 <fopen+0x40>
+    1fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fef:	90                   	nop
+    fd = open(path, O_CREATE|O_WRONLY|O_TRUNC);
+    1ff0:	83 ec 08             	sub    $0x8,%esp
+    1ff3:	68 01 06 00 00       	push   $0x601
+    1ff8:	ff 75 08             	push   0x8(%ebp)
+    1ffb:	e8 db f3 ff ff       	call   13db <open>
+    2000:	83 c4 10             	add    $0x10,%esp
+    2003:	89 c3                	mov    %eax,%ebx
+    2005:	eb db                	jmp    1fe2 <fopen+0x82>
+    2007:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    200e:	66 90                	xchg   %ax,%ax
+
+00002010 <fclose>:
+
+int
+fclose(FILE *f)
+{
+    2010:	55                   	push   %ebp
+    2011:	89 e5                	mov    %esp,%ebp
+    2013:	56                   	push   %esi
+    2014:	53                   	push   %ebx
+    2015:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  r = fflush(f);
+    2018:	83 ec 0c             	sub    $0xc,%esp
+    201b:	53                   	push   %ebx
+    201c:	e8 1f fa ff ff       	call   1a40 <fflush>
+    2021:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    2023:	58                   	pop    %eax
+    2024:	ff 33                	push   (%ebx)
+    2026:	e8 83 f3 ff ff       	call   13ae <close>
+    202b:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    202e:	85 c0                	test   %eax,%eax
+    2030:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2035:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->buf && f->buf != stdinbuf && f->buf != stdoutbuf)
+    2038:	8b 43 18             	mov    0x18(%ebx),%eax
+    203b:	85 c0                	test   %eax,%eax
+    203d:	0f 95 c1             	setne  %cl
+    2040:	3d c0 2f 00 00       	cmp    $0x2fc0,%eax
+    2045:	0f 95 c2             	setne  %dl
+    2048:	84 d1                	test   %dl,%cl
+    204a:	74 07                	je     2053 <fclose+0x43>
+    204c:	3d c0 2b 00 00       	cmp    $0x2bc0,%eax
+    2051:	75 25                	jne    2078 <fclose+0x68>
+    free(f->buf);
+  f->buf = 0;
+    2053:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+  f->readable = f->writable = 0;
+  return r;
+}
+    205a:	89 f0                	mov    %esi,%eax
+  f->readable = f->writable = 0;
+    205c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    2063:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    206a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    206d:	5b                   	pop    %ebx
+    206e:	5e                   	pop    %esi
+    206f:	5d                   	pop    %ebp
+    2070:	c3                   	ret
+    2071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(f->buf);
+    2078:	83 ec 0c             	sub    $0xc,%esp
+    207b:	50                   	push   %eax
+    207c:	e8 3f 00 00 00       	call   20c0 <free>
+    2081:	83 c4 10             	add    $0x10,%esp
+    2084:	eb cd                	jmp    2053 <fclose+0x43>
+    2086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    208d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002090 <feof>:
+
+int
+feof(FILE *f)
+{
+    2090:	55                   	push   %ebp
+    2091:	89 e5                	mov    %esp,%ebp
+  return f->eof;
+    2093:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2096:	5d                   	pop    %ebp
+  return f->eof;
+    2097:	8b 40 10             	mov    0x10(%eax),%eax
+}
+    209a:	c3                   	ret
+    209b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    209f:	90                   	nop
+
+000020a0 <ferror>:
+
+int
+ferror(FILE *f)
+{
+    20a0:	55                   	push   %ebp
+    20a1:	89 e5                	mov    %esp,%ebp
+  return f->err;
+    20a3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20a6:	5d                   	pop    %ebp
+  return f->err;
+    20a7:	8b 40 14             	mov    0x14(%eax),%eax
+}
+    20aa:	c3                   	ret
+    20ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    20af:	90                   	nop
+
+000020b0 <fileno>:
+
+int
+fileno(FILE *f)
+{
+    20b0:	55                   	push   %ebp
+    20b1:	89 e5                	mov    %esp,%ebp
+  return f->fd;
+    20b3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    20b6:	5d                   	pop    %ebp
+  return f->fd;
+    20b7:	8b 00                	mov    (%eax),%eax
+}
+    20b9:	c3                   	ret
+    20ba:	66 90                	xchg   %ax,%ax
+    20bc:	66 90                	xchg   %ax,%ax
+    20be:	66 90                	xchg   %ax,%ax
+
+000020c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    20c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    20c1:	a1 c0 33 00 00       	mov    0x33c0,%eax
+{
+    20c6:	89 e5                	mov    %esp,%ebp
+    20c8:	57                   	push   %edi
+    20c9:	56                   	push   %esi
+    20ca:	53                   	push   %ebx
+    20cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    20ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    20d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    20da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    20dc:	39 ca                	cmp    %ecx,%edx
+    20de:	73 30                	jae    2110 <free+0x50>
+    20e0:	39 c1                	cmp    %eax,%ecx
+    20e2:	72 04                	jb     20e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    20e4:	39 c2                	cmp    %eax,%edx
+    20e6:	72 f0                	jb     20d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    20e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    20eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    20ee:	39 f8                	cmp    %edi,%eax
+    20f0:	74 2e                	je     2120 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    20f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    20f5:	8b 42 04             	mov    0x4(%edx),%eax
+    20f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    20fb:	39 f1                	cmp    %esi,%ecx
+    20fd:	74 38                	je     2137 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    20ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2101:	5b                   	pop    %ebx
+  freep = p;
+    2102:	89 15 c0 33 00 00    	mov    %edx,0x33c0
+}
+    2108:	5e                   	pop    %esi
+    2109:	5f                   	pop    %edi
+    210a:	5d                   	pop    %ebp
+    210b:	c3                   	ret
+    210c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2110:	39 c1                	cmp    %eax,%ecx
+    2112:	72 d0                	jb     20e4 <free+0x24>
+    2114:	eb c2                	jmp    20d8 <free+0x18>
+    2116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    211d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2120:	03 70 04             	add    0x4(%eax),%esi
+    2123:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2126:	8b 02                	mov    (%edx),%eax
+    2128:	8b 00                	mov    (%eax),%eax
+    212a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    212d:	8b 42 04             	mov    0x4(%edx),%eax
+    2130:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2133:	39 f1                	cmp    %esi,%ecx
+    2135:	75 c8                	jne    20ff <free+0x3f>
+    p->s.size += bp->s.size;
+    2137:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    213a:	89 15 c0 33 00 00    	mov    %edx,0x33c0
+    p->s.size += bp->s.size;
+    2140:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2143:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2146:	89 0a                	mov    %ecx,(%edx)
+}
+    2148:	5b                   	pop    %ebx
+    2149:	5e                   	pop    %esi
+    214a:	5f                   	pop    %edi
+    214b:	5d                   	pop    %ebp
+    214c:	c3                   	ret
+    214d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002150 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2150:	55                   	push   %ebp
+    2151:	89 e5                	mov    %esp,%ebp
+    2153:	57                   	push   %edi
+    2154:	56                   	push   %esi
+    2155:	53                   	push   %ebx
+    2156:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2159:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    215c:	8b 15 c0 33 00 00    	mov    0x33c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2162:	8d 78 07             	lea    0x7(%eax),%edi
+    2165:	c1 ef 03             	shr    $0x3,%edi
+    2168:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    216b:	85 d2                	test   %edx,%edx
+    216d:	0f 84 8d 00 00 00    	je     2200 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2173:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2175:	8b 48 04             	mov    0x4(%eax),%ecx
+    2178:	39 f9                	cmp    %edi,%ecx
+    217a:	73 64                	jae    21e0 <malloc+0x90>
+  if(nu < 4096)
+    217c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2181:	39 df                	cmp    %ebx,%edi
+    2183:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2186:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    218d:	eb 0a                	jmp    2199 <malloc+0x49>
+    218f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2190:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2192:	8b 48 04             	mov    0x4(%eax),%ecx
+    2195:	39 f9                	cmp    %edi,%ecx
+    2197:	73 47                	jae    21e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2199:	89 c2                	mov    %eax,%edx
+    219b:	39 05 c0 33 00 00    	cmp    %eax,0x33c0
+    21a1:	75 ed                	jne    2190 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    21a3:	83 ec 0c             	sub    $0xc,%esp
+    21a6:	56                   	push   %esi
+    21a7:	e8 b6 f2 ff ff       	call   1462 <sbrk>
+  if(p == (char*)-1)
+    21ac:	83 c4 10             	add    $0x10,%esp
+    21af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    21b2:	74 1c                	je     21d0 <malloc+0x80>
+  hp->s.size = nu;
+    21b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    21b7:	83 ec 0c             	sub    $0xc,%esp
+    21ba:	83 c0 08             	add    $0x8,%eax
+    21bd:	50                   	push   %eax
+    21be:	e8 fd fe ff ff       	call   20c0 <free>
+  return freep;
+    21c3:	8b 15 c0 33 00 00    	mov    0x33c0,%edx
+      if((p = morecore(nunits)) == 0)
+    21c9:	83 c4 10             	add    $0x10,%esp
+    21cc:	85 d2                	test   %edx,%edx
+    21ce:	75 c0                	jne    2190 <malloc+0x40>
+        return 0;
+  }
+}
+    21d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    21d3:	31 c0                	xor    %eax,%eax
+}
+    21d5:	5b                   	pop    %ebx
+    21d6:	5e                   	pop    %esi
+    21d7:	5f                   	pop    %edi
+    21d8:	5d                   	pop    %ebp
+    21d9:	c3                   	ret
+    21da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    21e0:	39 cf                	cmp    %ecx,%edi
+    21e2:	74 4c                	je     2230 <malloc+0xe0>
+        p->s.size -= nunits;
+    21e4:	29 f9                	sub    %edi,%ecx
+    21e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    21e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    21ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    21ef:	89 15 c0 33 00 00    	mov    %edx,0x33c0
+}
+    21f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    21f8:	83 c0 08             	add    $0x8,%eax
+}
+    21fb:	5b                   	pop    %ebx
+    21fc:	5e                   	pop    %esi
+    21fd:	5f                   	pop    %edi
+    21fe:	5d                   	pop    %ebp
+    21ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2200:	c7 05 c0 33 00 00 c4 	movl   $0x33c4,0x33c0
+    2207:	33 00 00 
+    base.s.size = 0;
+    220a:	b8 c4 33 00 00       	mov    $0x33c4,%eax
+    base.s.ptr = freep = prevp = &base;
+    220f:	c7 05 c4 33 00 00 c4 	movl   $0x33c4,0x33c4
+    2216:	33 00 00 
+    base.s.size = 0;
+    2219:	c7 05 c8 33 00 00 00 	movl   $0x0,0x33c8
+    2220:	00 00 00 
+    if(p->s.size >= nunits){
+    2223:	e9 54 ff ff ff       	jmp    217c <malloc+0x2c>
+    2228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    222f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2230:	8b 08                	mov    (%eax),%ecx
+    2232:	89 0a                	mov    %ecx,(%edx)
+    2234:	eb b9                	jmp    21ef <malloc+0x9f>